@@ -7,6 +7,9 @@
 #ifndef HAMON_ATOMIC_HPP
 #define HAMON_ATOMIC_HPP
 
+#include <hamon/atomic/atomic.hpp>
+#include <hamon/atomic/atomic_flag.hpp>
+#include <hamon/atomic/atomic_ref.hpp>
 #include <hamon/atomic/memory_order.hpp>
 
 #endif // HAMON_ATOMIC_HPP
@@ -0,0 +1,106 @@
+﻿/**
+ *	@file	atomic.hpp
+ *
+ *	@brief	atomic の定義
+ */
+
+#ifndef HAMON_ATOMIC_ATOMIC_HPP
+#define HAMON_ATOMIC_ATOMIC_HPP
+
+#include <hamon/atomic/config.hpp>
+
+#if defined(HAMON_USE_STD_ATOMIC)
+
+#include <atomic>
+
+namespace hamon
+{
+
+using std::atomic;
+
+}	// namespace hamon
+
+#else
+
+#include <hamon/atomic/detail/atomic_base.hpp>
+
+namespace hamon
+{
+
+// 33.5.8 Class template atomic[atomics.types.generic]
+
+template <typename T>
+struct atomic : public hamon::detail::atomic_base<T>
+{
+private:
+	using base_type = hamon::detail::atomic_base<T>;
+
+public:
+	atomic() = default;
+
+	HAMON_CXX11_CONSTEXPR
+	atomic(T desired) noexcept
+		: base_type(desired)
+	{}
+
+	atomic(atomic const&) = delete;
+	atomic& operator=(atomic const&) = delete;
+
+	T operator=(T desired) noexcept
+	{
+		this->store(desired);
+		return desired;
+	}
+};
+
+}	// namespace hamon
+
+#endif
+
+#include <hamon/cstddef/ptrdiff_t.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/cstdint.hpp>
+
+namespace hamon
+{
+
+// 33.5.2 Header <atomic> synopsis[atomics.syn]
+
+using atomic_bool           = hamon::atomic<bool>;
+using atomic_char           = hamon::atomic<char>;
+using atomic_schar          = hamon::atomic<signed char>;
+using atomic_uchar          = hamon::atomic<unsigned char>;
+using atomic_short          = hamon::atomic<short>;
+using atomic_ushort         = hamon::atomic<unsigned short>;
+using atomic_int            = hamon::atomic<int>;
+using atomic_uint           = hamon::atomic<unsigned int>;
+using atomic_long           = hamon::atomic<long>;
+using atomic_ulong          = hamon::atomic<unsigned long>;
+using atomic_llong          = hamon::atomic<long long>;
+using atomic_ullong         = hamon::atomic<unsigned long long>;
+using atomic_char16_t       = hamon::atomic<char16_t>;
+using atomic_char32_t       = hamon::atomic<char32_t>;
+using atomic_wchar_t        = hamon::atomic<wchar_t>;
+
+using atomic_int8_t         = hamon::atomic<hamon::int8_t>;
+using atomic_uint8_t        = hamon::atomic<hamon::uint8_t>;
+using atomic_int16_t        = hamon::atomic<hamon::int16_t>;
+using atomic_uint16_t       = hamon::atomic<hamon::uint16_t>;
+using atomic_int32_t        = hamon::atomic<hamon::int32_t>;
+using atomic_uint32_t       = hamon::atomic<hamon::uint32_t>;
+using atomic_int64_t        = hamon::atomic<hamon::int64_t>;
+using atomic_uint64_t       = hamon::atomic<hamon::uint64_t>;
+
+using atomic_intptr_t       = hamon::atomic<hamon::intptr_t>;
+using atomic_uintptr_t      = hamon::atomic<hamon::uintptr_t>;
+using atomic_size_t         = hamon::atomic<hamon::size_t>;
+using atomic_ptrdiff_t      = hamon::atomic<hamon::ptrdiff_t>;
+using atomic_intmax_t       = hamon::atomic<hamon::intmax_t>;
+using atomic_uintmax_t      = hamon::atomic<hamon::uintmax_t>;
+
+using atomic_signed_lock_free   = hamon::atomic<int>;
+using atomic_unsigned_lock_free = hamon::atomic<unsigned int>;
+
+}	// namespace hamon
+
+#endif // HAMON_ATOMIC_ATOMIC_HPP
@@ -0,0 +1,88 @@
+﻿/**
+ *	@file	atomic_flag.hpp
+ *
+ *	@brief	atomic_flag の定義
+ */
+
+#ifndef HAMON_ATOMIC_ATOMIC_FLAG_HPP
+#define HAMON_ATOMIC_ATOMIC_FLAG_HPP
+
+#include <hamon/atomic/config.hpp>
+
+#if defined(HAMON_USE_STD_ATOMIC)
+
+#include <atomic>
+
+namespace hamon
+{
+
+using std::atomic_flag;
+
+}	// namespace hamon
+
+#else
+
+#include <hamon/atomic/memory_order.hpp>
+#include <hamon/atomic/detail/atomic_exchange.hpp>
+#include <hamon/atomic/detail/atomic_load.hpp>
+#include <hamon/atomic/detail/atomic_store.hpp>
+#include <hamon/atomic/detail/atomic_wait.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+// 33.5.10 Flag type and operations[atomics.flag]
+
+struct atomic_flag
+{
+private:
+	unsigned char m_flag;
+
+public:
+	HAMON_CXX11_CONSTEXPR atomic_flag() noexcept
+		: m_flag(0)
+	{}
+
+	atomic_flag(atomic_flag const&) = delete;
+	atomic_flag& operator=(atomic_flag const&) = delete;
+
+	bool test(hamon::memory_order order = hamon::memory_order::seq_cst) const noexcept
+	{
+		return hamon::detail::atomic_load(const_cast<unsigned char*>(&m_flag), order) != 0;
+	}
+
+	bool test_and_set(hamon::memory_order order = hamon::memory_order::seq_cst) noexcept
+	{
+		return hamon::detail::atomic_exchange(&m_flag, static_cast<unsigned char>(1), order) != 0;
+	}
+
+	void clear(hamon::memory_order order = hamon::memory_order::seq_cst) noexcept
+	{
+		hamon::detail::atomic_store(&m_flag, static_cast<unsigned char>(0), order);
+	}
+
+	void wait(bool old, hamon::memory_order order = hamon::memory_order::seq_cst) const noexcept
+	{
+		hamon::detail::atomic_wait(&m_flag, [this, old, order]
+		{
+			return this->test(order) == old;
+		});
+	}
+
+	void notify_one() noexcept
+	{
+		hamon::detail::atomic_notify_one(&m_flag);
+	}
+
+	void notify_all() noexcept
+	{
+		hamon::detail::atomic_notify_all(&m_flag);
+	}
+};
+
+}	// namespace hamon
+
+#endif
+
+#endif // HAMON_ATOMIC_ATOMIC_FLAG_HPP
@@ -0,0 +1,62 @@
+﻿/**
+ *	@file	atomic_ref.hpp
+ *
+ *	@brief	atomic_ref の定義
+ */
+
+#ifndef HAMON_ATOMIC_ATOMIC_REF_HPP
+#define HAMON_ATOMIC_ATOMIC_REF_HPP
+
+#include <hamon/atomic/config.hpp>
+
+#if defined(HAMON_USE_STD_ATOMIC)
+
+#include <atomic>
+
+namespace hamon
+{
+
+using std::atomic_ref;
+
+}	// namespace hamon
+
+#else
+
+#include <hamon/atomic/detail/atomic_ref_base.hpp>
+#include <hamon/cstdint/uintptr_t.hpp>
+#include <hamon/assert.hpp>
+
+namespace hamon
+{
+
+// 33.5.7 Class template atomic_ref[atomics.ref.generic]
+
+template <typename T>
+class atomic_ref : public hamon::detail::atomic_ref_base<T>
+{
+private:
+	using base_type = hamon::detail::atomic_ref_base<T>;
+
+public:
+	explicit atomic_ref(T& obj) noexcept
+		: base_type(obj)
+	{
+		// [atomics.ref.ops]/3
+		HAMON_ASSERT(reinterpret_cast<hamon::uintptr_t>(&obj) % base_type::required_alignment == 0);
+	}
+
+	atomic_ref(atomic_ref const&) noexcept = default;
+	atomic_ref& operator=(atomic_ref const&) = delete;
+
+	T operator=(T desired) const noexcept
+	{
+		this->store(desired);
+		return desired;
+	}
+};
+
+}	// namespace hamon
+
+#endif
+
+#endif // HAMON_ATOMIC_ATOMIC_REF_HPP
@@ -0,0 +1,23 @@
+﻿/**
+ *	@file	config.hpp
+ *
+ *	@brief
+ */
+
+#ifndef HAMON_ATOMIC_CONFIG_HPP
+#define HAMON_ATOMIC_CONFIG_HPP
+
+#include <hamon/config.hpp>
+
+#if (HAMON_CXX_STANDARD >= 20) && HAMON_HAS_INCLUDE(<atomic>)
+#  include <atomic>
+#endif
+
+#if defined(__cpp_lib_atomic_ref) && (__cpp_lib_atomic_ref >= 201806L) && \
+	defined(__cpp_lib_atomic_wait) && (__cpp_lib_atomic_wait >= 201907L) && \
+	defined(__cpp_lib_atomic_flag_test) && (__cpp_lib_atomic_flag_test >= 201907L) && \
+	defined(__cpp_lib_atomic_value_initialization) && (__cpp_lib_atomic_value_initialization >= 201911L)
+#  define HAMON_USE_STD_ATOMIC
+#endif
+
+#endif // HAMON_ATOMIC_CONFIG_HPP
@@ -0,0 +1,329 @@
+﻿/**
+ *	@file	atomic_base.hpp
+ *
+ *	@brief	atomic_base の定義
+ */
+
+#ifndef HAMON_ATOMIC_DETAIL_ATOMIC_BASE_HPP
+#define HAMON_ATOMIC_DETAIL_ATOMIC_BASE_HPP
+
+#include <hamon/atomic/memory_order.hpp>
+#include <hamon/atomic/detail/atomic_kind.hpp>
+#include <hamon/atomic/detail/atomic_ops.hpp>
+#include <hamon/atomic/detail/atomic_failure_order.hpp>
+#include <hamon/atomic/detail/atomic_fetch_add.hpp>
+#include <hamon/atomic/detail/atomic_fetch_and.hpp>
+#include <hamon/atomic/detail/atomic_fetch_or.hpp>
+#include <hamon/atomic/detail/atomic_fetch_sub.hpp>
+#include <hamon/atomic/detail/atomic_fetch_xor.hpp>
+#include <hamon/atomic/detail/atomic_wait.hpp>
+#include <hamon/cstddef/ptrdiff_t.hpp>
+#include <hamon/type_traits/is_copy_constructible.hpp>
+#include <hamon/type_traits/is_copy_assignable.hpp>
+#include <hamon/type_traits/is_move_constructible.hpp>
+#include <hamon/type_traits/is_move_assignable.hpp>
+#include <hamon/type_traits/is_nothrow_default_constructible.hpp>
+#include <hamon/type_traits/is_object.hpp>
+#include <hamon/type_traits/is_trivially_copyable.hpp>
+#include <hamon/type_traits/remove_pointer.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+namespace detail
+{
+
+template <typename T, atomic_kind = atomic_kind_of<T>::value>
+struct atomic_base;
+
+// 33.5.8.2 Operations on atomic types[atomics.types.operations]
+template <typename T>
+struct atomic_base<T, atomic_kind::generic>
+{
+	static_assert(hamon::is_trivially_copyable<T>::value, "[atomics.types.generic.general]/1");
+	static_assert(hamon::is_copy_constructible<T>::value, "[atomics.types.generic.general]/1");
+	static_assert(hamon::is_move_constructible<T>::value, "[atomics.types.generic.general]/1");
+	static_assert(hamon::is_copy_assignable<T>::value, "[atomics.types.generic.general]/1");
+	static_assert(hamon::is_move_assignable<T>::value, "[atomics.types.generic.general]/1");
+
+protected:
+	using ops = hamon::detail::atomic_ops<T>;
+
+	alignas(hamon::detail::atomic_required_alignment<T>::value) T m_value;
+
+public:
+	using value_type = T;
+
+	static HAMON_CXX11_CONSTEXPR bool is_always_lock_free = ops::is_always_lock_free;
+
+	HAMON_CXX11_CONSTEXPR
+	atomic_base() noexcept(hamon::is_nothrow_default_constructible<T>::value)
+		: m_value()
+	{}
+
+	HAMON_CXX11_CONSTEXPR
+	atomic_base(T desired) noexcept
+		: m_value(desired)
+	{}
+
+	atomic_base(atomic_base const&) = delete;
+	atomic_base& operator=(atomic_base const&) = delete;
+
+	bool is_lock_free() const noexcept
+	{
+		return is_always_lock_free;
+	}
+
+	void store(T desired, hamon::memory_order order = hamon::memory_order::seq_cst) noexcept
+	{
+		ops::store(&m_value, desired, order);
+	}
+
+	T load(hamon::memory_order order = hamon::memory_order::seq_cst) const noexcept
+	{
+		return ops::load(&m_value, order);
+	}
+
+	operator T() const noexcept
+	{
+		return this->load();
+	}
+
+	T exchange(T desired, hamon::memory_order order = hamon::memory_order::seq_cst) noexcept
+	{
+		return ops::exchange(&m_value, desired, order);
+	}
+
+	bool compare_exchange_weak(T& expected, T desired,
+		hamon::memory_order success, hamon::memory_order failure) noexcept
+	{
+		return ops::compare_exchange(&m_value, expected, desired, true, success, failure);
+	}
+
+	bool compare_exchange_strong(T& expected, T desired,
+		hamon::memory_order success, hamon::memory_order failure) noexcept
+	{
+		return ops::compare_exchange(&m_value, expected, desired, false, success, failure);
+	}
+
+	bool compare_exchange_weak(T& expected, T desired,
+		hamon::memory_order order = hamon::memory_order::seq_cst) noexcept
+	{
+		return ops::compare_exchange(&m_value, expected, desired, true,
+			order, hamon::detail::atomic_failure_order(order));
+	}
+
+	bool compare_exchange_strong(T& expected, T desired,
+		hamon::memory_order order = hamon::memory_order::seq_cst) noexcept
+	{
+		return ops::compare_exchange(&m_value, expected, desired, false,
+			order, hamon::detail::atomic_failure_order(order));
+	}
+
+	void wait(T old, hamon::memory_order order = hamon::memory_order::seq_cst) const noexcept
+	{
+		hamon::detail::atomic_wait_value(&m_value, old, order);
+	}
+
+	void notify_one() noexcept
+	{
+		hamon::detail::atomic_notify_one(&m_value);
+	}
+
+	void notify_all() noexcept
+	{
+		hamon::detail::atomic_notify_all(&m_value);
+	}
+};
+
+#if !defined(HAMON_HAS_CXX17_INLINE_VARIABLES)
+
+template <typename T>
+constexpr bool atomic_base<T, atomic_kind::generic>::is_always_lock_free;
+
+#endif
+
+// 33.5.8.3 Specializations for integers[atomics.types.int]
+template <typename T>
+struct atomic_base<T, atomic_kind::integral>
+	: public atomic_base<T, atomic_kind::generic>
+{
+private:
+	using base_type = atomic_base<T, atomic_kind::generic>;
+
+public:
+	using difference_type = T;
+
+	using base_type::base_type;
+
+	T fetch_add(T arg, hamon::memory_order order = hamon::memory_order::seq_cst) noexcept
+	{
+		return hamon::detail::atomic_fetch_add(&this->m_value, arg, order);
+	}
+
+	T fetch_sub(T arg, hamon::memory_order order = hamon::memory_order::seq_cst) noexcept
+	{
+		return hamon::detail::atomic_fetch_sub(&this->m_value, arg, order);
+	}
+
+	T fetch_and(T arg, hamon::memory_order order = hamon::memory_order::seq_cst) noexcept
+	{
+		return hamon::detail::atomic_fetch_and(&this->m_value, arg, order);
+	}
+
+	T fetch_or(T arg, hamon::memory_order order = hamon::memory_order::seq_cst) noexcept
+	{
+		return hamon::detail::atomic_fetch_or(&this->m_value, arg, order);
+	}
+
+	T fetch_xor(T arg, hamon::memory_order order = hamon::memory_order::seq_cst) noexcept
+	{
+		return hamon::detail::atomic_fetch_xor(&this->m_value, arg, order);
+	}
+
+	T operator++(int) noexcept
+	{
+		return this->fetch_add(T(1));
+	}
+
+	T operator--(int) noexcept
+	{
+		return this->fetch_sub(T(1));
+	}
+
+	T operator++() noexcept
+	{
+		return static_cast<T>(this->fetch_add(T(1)) + T(1));
+	}
+
+	T operator--() noexcept
+	{
+		return static_cast<T>(this->fetch_sub(T(1)) - T(1));
+	}
+
+	T operator+=(T operand) noexcept
+	{
+		return static_cast<T>(this->fetch_add(operand) + operand);
+	}
+
+	T operator-=(T operand) noexcept
+	{
+		return static_cast<T>(this->fetch_sub(operand) - operand);
+	}
+
+	T operator&=(T operand) noexcept
+	{
+		return static_cast<T>(this->fetch_and(operand) & operand);
+	}
+
+	T operator|=(T operand) noexcept
+	{
+		return static_cast<T>(this->fetch_or(operand) | operand);
+	}
+
+	T operator^=(T operand) noexcept
+	{
+		return static_cast<T>(this->fetch_xor(operand) ^ operand);
+	}
+};
+
+// 33.5.8.4 Specializations for floating-point types[atomics.types.float]
+template <typename T>
+struct atomic_base<T, atomic_kind::floating>
+	: public atomic_base<T, atomic_kind::generic>
+{
+private:
+	using base_type = atomic_base<T, atomic_kind::generic>;
+
+public:
+	using difference_type = T;
+
+	using base_type::base_type;
+
+	T fetch_add(T arg, hamon::memory_order order = hamon::memory_order::seq_cst) noexcept
+	{
+		return hamon::detail::atomic_fetch_update(&this->m_value, order,
+			[arg](T x) { return static_cast<T>(x + arg); });
+	}
+
+	T fetch_sub(T arg, hamon::memory_order order = hamon::memory_order::seq_cst) noexcept
+	{
+		return hamon::detail::atomic_fetch_update(&this->m_value, order,
+			[arg](T x) { return static_cast<T>(x - arg); });
+	}
+
+	T operator+=(T operand) noexcept
+	{
+		return static_cast<T>(this->fetch_add(operand) + operand);
+	}
+
+	T operator-=(T operand) noexcept
+	{
+		return static_cast<T>(this->fetch_sub(operand) - operand);
+	}
+};
+
+// 33.5.8.5 Partial specialization for pointers[atomics.types.pointer]
+template <typename T>
+struct atomic_base<T, atomic_kind::pointer>
+	: public atomic_base<T, atomic_kind::generic>
+{
+private:
+	using base_type = atomic_base<T, atomic_kind::generic>;
+
+public:
+	using difference_type = hamon::ptrdiff_t;
+
+	using base_type::base_type;
+
+	T fetch_add(hamon::ptrdiff_t arg, hamon::memory_order order = hamon::memory_order::seq_cst) noexcept
+	{
+		static_assert(hamon::is_object<hamon::remove_pointer_t<T>>::value, "[atomics.types.pointer]/4");
+		return hamon::detail::atomic_fetch_update(&this->m_value, order,
+			[arg](T x) { return x + arg; });
+	}
+
+	T fetch_sub(hamon::ptrdiff_t arg, hamon::memory_order order = hamon::memory_order::seq_cst) noexcept
+	{
+		static_assert(hamon::is_object<hamon::remove_pointer_t<T>>::value, "[atomics.types.pointer]/4");
+		return hamon::detail::atomic_fetch_update(&this->m_value, order,
+			[arg](T x) { return x - arg; });
+	}
+
+	T operator++(int) noexcept
+	{
+		return this->fetch_add(1);
+	}
+
+	T operator--(int) noexcept
+	{
+		return this->fetch_sub(1);
+	}
+
+	T operator++() noexcept
+	{
+		return this->fetch_add(1) + 1;
+	}
+
+	T operator--() noexcept
+	{
+		return this->fetch_sub(1) - 1;
+	}
+
+	T operator+=(hamon::ptrdiff_t operand) noexcept
+	{
+		return this->fetch_add(operand) + operand;
+	}
+
+	T operator-=(hamon::ptrdiff_t operand) noexcept
+	{
+		return this->fetch_sub(operand) - operand;
+	}
+};
+
+}	// namespace detail
+
+}	// namespace hamon
+
+#endif // HAMON_ATOMIC_DETAIL_ATOMIC_BASE_HPP
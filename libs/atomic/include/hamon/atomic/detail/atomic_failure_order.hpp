@@ -0,0 +1,35 @@
+﻿/**
+ *	@file	atomic_failure_order.hpp
+ *
+ *	@brief	atomic_failure_order の定義
+ */
+
+#ifndef HAMON_ATOMIC_DETAIL_ATOMIC_FAILURE_ORDER_HPP
+#define HAMON_ATOMIC_DETAIL_ATOMIC_FAILURE_ORDER_HPP
+
+#include <hamon/atomic/memory_order.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+namespace detail
+{
+
+// compare_exchange にメモリオーダーが1つだけ指定されたときの、失敗時のメモリオーダー
+//
+// [atomics.types.operations]/21
+inline HAMON_CXX11_CONSTEXPR hamon::memory_order
+atomic_failure_order(hamon::memory_order order) noexcept
+{
+	return
+		order == hamon::memory_order::acq_rel ? hamon::memory_order::acquire :
+		order == hamon::memory_order::release ? hamon::memory_order::relaxed :
+		order;
+}
+
+}	// namespace detail
+
+}	// namespace hamon
+
+#endif // HAMON_ATOMIC_DETAIL_ATOMIC_FAILURE_ORDER_HPP
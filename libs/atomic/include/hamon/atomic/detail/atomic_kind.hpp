@@ -0,0 +1,44 @@
+﻿/**
+ *	@file	atomic_kind.hpp
+ *
+ *	@brief	atomic_kind の定義
+ */
+
+#ifndef HAMON_ATOMIC_DETAIL_ATOMIC_KIND_HPP
+#define HAMON_ATOMIC_DETAIL_ATOMIC_KIND_HPP
+
+#include <hamon/type_traits/integral_constant.hpp>
+#include <hamon/type_traits/is_floating_point.hpp>
+#include <hamon/type_traits/is_integral.hpp>
+#include <hamon/type_traits/is_pointer.hpp>
+#include <hamon/type_traits/is_same.hpp>
+#include <hamon/type_traits/remove_cv.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+namespace detail
+{
+
+// atomic, atomic_ref が提供する操作の種類
+enum class atomic_kind
+{
+	generic,	// load, store, exchange, compare_exchange のみ
+	integral,	// [atomics.types.int], [atomics.ref.int]
+	floating,	// [atomics.types.float], [atomics.ref.float]
+	pointer,	// [atomics.types.pointer], [atomics.ref.pointer]
+};
+
+template <typename T, typename U = hamon::remove_cv_t<T>>
+using atomic_kind_of = hamon::integral_constant<atomic_kind,
+	(hamon::is_integral<U>::value && !hamon::is_same<U, bool>::value) ? atomic_kind::integral :
+	hamon::is_floating_point<U>::value ? atomic_kind::floating :
+	hamon::is_pointer<U>::value ? atomic_kind::pointer :
+	atomic_kind::generic>;
+
+}	// namespace detail
+
+}	// namespace hamon
+
+#endif // HAMON_ATOMIC_DETAIL_ATOMIC_KIND_HPP
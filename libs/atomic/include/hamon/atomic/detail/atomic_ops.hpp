@@ -0,0 +1,217 @@
+﻿/**
+ *	@file	atomic_ops.hpp
+ *
+ *	@brief	atomic_ops の定義
+ */
+
+#ifndef HAMON_ATOMIC_DETAIL_ATOMIC_OPS_HPP
+#define HAMON_ATOMIC_DETAIL_ATOMIC_OPS_HPP
+
+#include <hamon/atomic/memory_order.hpp>
+#include <hamon/atomic/detail/atomic_compare_exchange.hpp>
+#include <hamon/atomic/detail/atomic_exchange.hpp>
+#include <hamon/atomic/detail/atomic_failure_order.hpp>
+#include <hamon/atomic/detail/atomic_load.hpp>
+#include <hamon/atomic/detail/atomic_spin_lock_pool.hpp>
+#include <hamon/atomic/detail/atomic_store.hpp>
+#include <hamon/atomic/detail/atomic_wait.hpp>
+#include <hamon/atomic/detail/to_gcc_memory_order.hpp>
+#include <hamon/bit/bit_cast.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/cstdint/uint8_t.hpp>
+#include <hamon/cstdint/uint16_t.hpp>
+#include <hamon/cstdint/uint32_t.hpp>
+#include <hamon/cstdint/uint64_t.hpp>
+#include <hamon/cstring/memcmp.hpp>
+#include <hamon/cstring/memcpy.hpp>
+#include <hamon/type_traits/bool_constant.hpp>
+#include <hamon/type_traits/integral_constant.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+namespace detail
+{
+
+// 大きさと配置が整数と同じなら、ロックフリーで扱う
+template <typename T>
+using atomic_is_lock_free_type = hamon::bool_constant<
+	sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8>;
+
+// atomic<T>, atomic_ref<T> が必要とするアラインメント
+template <typename T>
+using atomic_required_alignment = hamon::integral_constant<hamon::size_t,
+	(atomic_is_lock_free_type<T>::value && sizeof(T) > alignof(T)) ? sizeof(T) : alignof(T)>;
+
+template <hamon::size_t N> struct atomic_uint_of_size;
+template <> struct atomic_uint_of_size<1> { using type = hamon::uint8_t; };
+template <> struct atomic_uint_of_size<2> { using type = hamon::uint16_t; };
+template <> struct atomic_uint_of_size<4> { using type = hamon::uint32_t; };
+template <> struct atomic_uint_of_size<8> { using type = hamon::uint64_t; };
+
+// デフォルトコンストラクタを持たない型の値を受け取るためのバッファ
+template <typename T>
+union atomic_value_buffer
+{
+	T value;
+	unsigned char dummy;
+
+	atomic_value_buffer() noexcept : dummy() {}
+};
+
+template <typename T, bool = atomic_is_lock_free_type<T>::value>
+struct atomic_ops;
+
+// ロックフリーで扱える型
+//
+// MSVC では同じ大きさの整数に読み替えて Interlocked 関数で操作する。
+// それ以外では型を問わない __atomic 組み込み関数を使う。
+template <typename T>
+struct atomic_ops<T, true>
+{
+	static HAMON_CXX11_CONSTEXPR bool is_always_lock_free = true;
+
+#if defined(HAMON_MSVC)
+	using uint_type = typename atomic_uint_of_size<sizeof(T)>::type;
+
+	static uint_type* to_uint_ptr(T const* p) noexcept
+	{
+		return reinterpret_cast<uint_type*>(const_cast<T*>(p));
+	}
+
+	static T load(T const* p, hamon::memory_order order) noexcept
+	{
+		return hamon::bit_cast<T>(hamon::detail::atomic_load(to_uint_ptr(p), order));
+	}
+
+	static void store(T* p, T desired, hamon::memory_order order) noexcept
+	{
+		hamon::detail::atomic_store(to_uint_ptr(p), hamon::bit_cast<uint_type>(desired), order);
+	}
+
+	static T exchange(T* p, T desired, hamon::memory_order order) noexcept
+	{
+		return hamon::bit_cast<T>(hamon::detail::atomic_exchange(
+			to_uint_ptr(p), hamon::bit_cast<uint_type>(desired), order));
+	}
+
+	static bool compare_exchange(T* p, T& expected, T desired, bool weak,
+		hamon::memory_order success, hamon::memory_order failure) noexcept
+	{
+		uint_type e = hamon::bit_cast<uint_type>(expected);
+		bool const result = hamon::detail::atomic_compare_exchange(
+			to_uint_ptr(p), &e, hamon::bit_cast<uint_type>(desired), weak, success, failure);
+		if (!result)
+		{
+			expected = hamon::bit_cast<T>(e);
+		}
+		return result;
+	}
+#else
+	static T load(T const* p, hamon::memory_order order) noexcept
+	{
+		atomic_value_buffer<T> buf;
+		__atomic_load(p, &buf.value, hamon::detail::to_gcc_memory_order(order));
+		return buf.value;
+	}
+
+	static void store(T* p, T desired, hamon::memory_order order) noexcept
+	{
+		__atomic_store(p, &desired, hamon::detail::to_gcc_memory_order(order));
+	}
+
+	static T exchange(T* p, T desired, hamon::memory_order order) noexcept
+	{
+		atomic_value_buffer<T> buf;
+		__atomic_exchange(p, &desired, &buf.value, hamon::detail::to_gcc_memory_order(order));
+		return buf.value;
+	}
+
+	static bool compare_exchange(T* p, T& expected, T desired, bool weak,
+		hamon::memory_order success, hamon::memory_order failure) noexcept
+	{
+		return __atomic_compare_exchange(p, &expected, &desired, weak,
+			hamon::detail::to_gcc_memory_order(success),
+			hamon::detail::to_gcc_memory_order(failure));
+	}
+#endif
+};
+
+// ロックフリーで扱えない型
+//
+// アドレスごとのスピンロックで保護する。
+// 値の比較は compare_exchange の仕様に合わせて、オブジェクト表現の比較で行う。
+template <typename T>
+struct atomic_ops<T, false>
+{
+	static HAMON_CXX11_CONSTEXPR bool is_always_lock_free = false;
+
+	static T load(T const* p, hamon::memory_order) noexcept
+	{
+		atomic_value_buffer<T> buf;
+		atomic_spin_lock_pool::scoped_lock lk(p);
+		hamon::memcpy(&buf.value, p, sizeof(T));
+		return buf.value;
+	}
+
+	static void store(T* p, T desired, hamon::memory_order) noexcept
+	{
+		atomic_spin_lock_pool::scoped_lock lk(p);
+		hamon::memcpy(p, &desired, sizeof(T));
+	}
+
+	static T exchange(T* p, T desired, hamon::memory_order) noexcept
+	{
+		atomic_value_buffer<T> buf;
+		atomic_spin_lock_pool::scoped_lock lk(p);
+		hamon::memcpy(&buf.value, p, sizeof(T));
+		hamon::memcpy(p, &desired, sizeof(T));
+		return buf.value;
+	}
+
+	static bool compare_exchange(T* p, T& expected, T desired, bool,
+		hamon::memory_order, hamon::memory_order) noexcept
+	{
+		atomic_spin_lock_pool::scoped_lock lk(p);
+		if (hamon::memcmp(p, &expected, sizeof(T)) == 0)
+		{
+			hamon::memcpy(p, &desired, sizeof(T));
+			return true;
+		}
+
+		hamon::memcpy(&expected, p, sizeof(T));
+		return false;
+	}
+};
+
+// 値を f(old) に置き換え、置き換える前の値を返す
+template <typename T, typename F>
+inline T
+atomic_fetch_update(T* p, hamon::memory_order order, F f) noexcept
+{
+	using ops = hamon::detail::atomic_ops<T>;
+	T expected = ops::load(p, hamon::memory_order::relaxed);
+	while (!ops::compare_exchange(p, expected, f(expected), true,
+		order, hamon::detail::atomic_failure_order(order)))
+	{}
+	return expected;
+}
+
+// p の指す値が old と異なるまで待機する
+template <typename T>
+inline void
+atomic_wait_value(T const* p, T old, hamon::memory_order order) noexcept
+{
+	hamon::detail::atomic_wait(p, [p, &old, order]
+	{
+		T const v = hamon::detail::atomic_ops<T>::load(p, order);
+		return hamon::memcmp(&v, &old, sizeof(T)) == 0;
+	});
+}
+
+}	// namespace detail
+
+}	// namespace hamon
+
+#endif // HAMON_ATOMIC_DETAIL_ATOMIC_OPS_HPP
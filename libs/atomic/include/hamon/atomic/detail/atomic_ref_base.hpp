@@ -0,0 +1,321 @@
+﻿/**
+ *	@file	atomic_ref_base.hpp
+ *
+ *	@brief	atomic_ref_base の定義
+ */
+
+#ifndef HAMON_ATOMIC_DETAIL_ATOMIC_REF_BASE_HPP
+#define HAMON_ATOMIC_DETAIL_ATOMIC_REF_BASE_HPP
+
+#include <hamon/atomic/memory_order.hpp>
+#include <hamon/atomic/detail/atomic_kind.hpp>
+#include <hamon/atomic/detail/atomic_ops.hpp>
+#include <hamon/atomic/detail/atomic_failure_order.hpp>
+#include <hamon/atomic/detail/atomic_fetch_add.hpp>
+#include <hamon/atomic/detail/atomic_fetch_and.hpp>
+#include <hamon/atomic/detail/atomic_fetch_or.hpp>
+#include <hamon/atomic/detail/atomic_fetch_sub.hpp>
+#include <hamon/atomic/detail/atomic_fetch_xor.hpp>
+#include <hamon/atomic/detail/atomic_wait.hpp>
+#include <hamon/cstddef/ptrdiff_t.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/type_traits/is_object.hpp>
+#include <hamon/type_traits/is_trivially_copyable.hpp>
+#include <hamon/type_traits/remove_pointer.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+namespace detail
+{
+
+template <typename T, atomic_kind = atomic_kind_of<T>::value>
+struct atomic_ref_base;
+
+// 33.5.7.2 Operations[atomics.ref.ops]
+template <typename T>
+struct atomic_ref_base<T, atomic_kind::generic>
+{
+	static_assert(hamon::is_trivially_copyable<T>::value, "[atomics.ref.generic.general]/2");
+
+protected:
+	using ops = hamon::detail::atomic_ops<T>;
+
+	T* m_ptr;
+
+public:
+	using value_type = T;
+
+	static HAMON_CXX11_CONSTEXPR hamon::size_t required_alignment =
+		hamon::detail::atomic_required_alignment<T>::value;
+
+	static HAMON_CXX11_CONSTEXPR bool is_always_lock_free = ops::is_always_lock_free;
+
+	explicit atomic_ref_base(T& obj) noexcept
+		: m_ptr(&obj)
+	{}
+
+	atomic_ref_base(atomic_ref_base const&) noexcept = default;
+	atomic_ref_base& operator=(atomic_ref_base const&) = delete;
+
+	bool is_lock_free() const noexcept
+	{
+		return is_always_lock_free;
+	}
+
+	void store(T desired, hamon::memory_order order = hamon::memory_order::seq_cst) const noexcept
+	{
+		ops::store(m_ptr, desired, order);
+	}
+
+	T load(hamon::memory_order order = hamon::memory_order::seq_cst) const noexcept
+	{
+		return ops::load(m_ptr, order);
+	}
+
+	operator T() const noexcept
+	{
+		return this->load();
+	}
+
+	T exchange(T desired, hamon::memory_order order = hamon::memory_order::seq_cst) const noexcept
+	{
+		return ops::exchange(m_ptr, desired, order);
+	}
+
+	bool compare_exchange_weak(T& expected, T desired,
+		hamon::memory_order success, hamon::memory_order failure) const noexcept
+	{
+		return ops::compare_exchange(m_ptr, expected, desired, true, success, failure);
+	}
+
+	bool compare_exchange_strong(T& expected, T desired,
+		hamon::memory_order success, hamon::memory_order failure) const noexcept
+	{
+		return ops::compare_exchange(m_ptr, expected, desired, false, success, failure);
+	}
+
+	bool compare_exchange_weak(T& expected, T desired,
+		hamon::memory_order order = hamon::memory_order::seq_cst) const noexcept
+	{
+		return ops::compare_exchange(m_ptr, expected, desired, true,
+			order, hamon::detail::atomic_failure_order(order));
+	}
+
+	bool compare_exchange_strong(T& expected, T desired,
+		hamon::memory_order order = hamon::memory_order::seq_cst) const noexcept
+	{
+		return ops::compare_exchange(m_ptr, expected, desired, false,
+			order, hamon::detail::atomic_failure_order(order));
+	}
+
+	void wait(T old, hamon::memory_order order = hamon::memory_order::seq_cst) const noexcept
+	{
+		hamon::detail::atomic_wait_value(m_ptr, old, order);
+	}
+
+	void notify_one() const noexcept
+	{
+		hamon::detail::atomic_notify_one(m_ptr);
+	}
+
+	void notify_all() const noexcept
+	{
+		hamon::detail::atomic_notify_all(m_ptr);
+	}
+};
+
+#if !defined(HAMON_HAS_CXX17_INLINE_VARIABLES)
+
+template <typename T>
+constexpr hamon::size_t atomic_ref_base<T, atomic_kind::generic>::required_alignment;
+
+template <typename T>
+constexpr bool atomic_ref_base<T, atomic_kind::generic>::is_always_lock_free;
+
+#endif
+
+// 33.5.7.3 Specializations for integral types[atomics.ref.int]
+template <typename T>
+struct atomic_ref_base<T, atomic_kind::integral>
+	: public atomic_ref_base<T, atomic_kind::generic>
+{
+private:
+	using base_type = atomic_ref_base<T, atomic_kind::generic>;
+
+public:
+	using difference_type = T;
+
+	using base_type::base_type;
+
+	T fetch_add(T arg, hamon::memory_order order = hamon::memory_order::seq_cst) const noexcept
+	{
+		return hamon::detail::atomic_fetch_add(this->m_ptr, arg, order);
+	}
+
+	T fetch_sub(T arg, hamon::memory_order order = hamon::memory_order::seq_cst) const noexcept
+	{
+		return hamon::detail::atomic_fetch_sub(this->m_ptr, arg, order);
+	}
+
+	T fetch_and(T arg, hamon::memory_order order = hamon::memory_order::seq_cst) const noexcept
+	{
+		return hamon::detail::atomic_fetch_and(this->m_ptr, arg, order);
+	}
+
+	T fetch_or(T arg, hamon::memory_order order = hamon::memory_order::seq_cst) const noexcept
+	{
+		return hamon::detail::atomic_fetch_or(this->m_ptr, arg, order);
+	}
+
+	T fetch_xor(T arg, hamon::memory_order order = hamon::memory_order::seq_cst) const noexcept
+	{
+		return hamon::detail::atomic_fetch_xor(this->m_ptr, arg, order);
+	}
+
+	T operator++(int) const noexcept
+	{
+		return this->fetch_add(T(1));
+	}
+
+	T operator--(int) const noexcept
+	{
+		return this->fetch_sub(T(1));
+	}
+
+	T operator++() const noexcept
+	{
+		return static_cast<T>(this->fetch_add(T(1)) + T(1));
+	}
+
+	T operator--() const noexcept
+	{
+		return static_cast<T>(this->fetch_sub(T(1)) - T(1));
+	}
+
+	T operator+=(T operand) const noexcept
+	{
+		return static_cast<T>(this->fetch_add(operand) + operand);
+	}
+
+	T operator-=(T operand) const noexcept
+	{
+		return static_cast<T>(this->fetch_sub(operand) - operand);
+	}
+
+	T operator&=(T operand) const noexcept
+	{
+		return static_cast<T>(this->fetch_and(operand) & operand);
+	}
+
+	T operator|=(T operand) const noexcept
+	{
+		return static_cast<T>(this->fetch_or(operand) | operand);
+	}
+
+	T operator^=(T operand) const noexcept
+	{
+		return static_cast<T>(this->fetch_xor(operand) ^ operand);
+	}
+};
+
+// 33.5.7.4 Specializations for floating-point types[atomics.ref.float]
+template <typename T>
+struct atomic_ref_base<T, atomic_kind::floating>
+	: public atomic_ref_base<T, atomic_kind::generic>
+{
+private:
+	using base_type = atomic_ref_base<T, atomic_kind::generic>;
+
+public:
+	using difference_type = T;
+
+	using base_type::base_type;
+
+	T fetch_add(T arg, hamon::memory_order order = hamon::memory_order::seq_cst) const noexcept
+	{
+		return hamon::detail::atomic_fetch_update(this->m_ptr, order,
+			[arg](T x) { return static_cast<T>(x + arg); });
+	}
+
+	T fetch_sub(T arg, hamon::memory_order order = hamon::memory_order::seq_cst) const noexcept
+	{
+		return hamon::detail::atomic_fetch_update(this->m_ptr, order,
+			[arg](T x) { return static_cast<T>(x - arg); });
+	}
+
+	T operator+=(T operand) const noexcept
+	{
+		return static_cast<T>(this->fetch_add(operand) + operand);
+	}
+
+	T operator-=(T operand) const noexcept
+	{
+		return static_cast<T>(this->fetch_sub(operand) - operand);
+	}
+};
+
+// 33.5.7.5 Partial specialization for pointers[atomics.ref.pointer]
+template <typename T>
+struct atomic_ref_base<T, atomic_kind::pointer>
+	: public atomic_ref_base<T, atomic_kind::generic>
+{
+private:
+	using base_type = atomic_ref_base<T, atomic_kind::generic>;
+
+public:
+	using difference_type = hamon::ptrdiff_t;
+
+	using base_type::base_type;
+
+	T fetch_add(hamon::ptrdiff_t arg, hamon::memory_order order = hamon::memory_order::seq_cst) const noexcept
+	{
+		static_assert(hamon::is_object<hamon::remove_pointer_t<T>>::value, "[atomics.ref.pointer]/1");
+		return hamon::detail::atomic_fetch_update(this->m_ptr, order,
+			[arg](T x) { return x + arg; });
+	}
+
+	T fetch_sub(hamon::ptrdiff_t arg, hamon::memory_order order = hamon::memory_order::seq_cst) const noexcept
+	{
+		static_assert(hamon::is_object<hamon::remove_pointer_t<T>>::value, "[atomics.ref.pointer]/1");
+		return hamon::detail::atomic_fetch_update(this->m_ptr, order,
+			[arg](T x) { return x - arg; });
+	}
+
+	T operator++(int) const noexcept
+	{
+		return this->fetch_add(1);
+	}
+
+	T operator--(int) const noexcept
+	{
+		return this->fetch_sub(1);
+	}
+
+	T operator++() const noexcept
+	{
+		return this->fetch_add(1) + 1;
+	}
+
+	T operator--() const noexcept
+	{
+		return this->fetch_sub(1) - 1;
+	}
+
+	T operator+=(hamon::ptrdiff_t operand) const noexcept
+	{
+		return this->fetch_add(operand) + operand;
+	}
+
+	T operator-=(hamon::ptrdiff_t operand) const noexcept
+	{
+		return this->fetch_sub(operand) - operand;
+	}
+};
+
+}	// namespace detail
+
+}	// namespace hamon
+
+#endif // HAMON_ATOMIC_DETAIL_ATOMIC_REF_BASE_HPP
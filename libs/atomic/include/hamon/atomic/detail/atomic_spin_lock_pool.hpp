@@ -0,0 +1,73 @@
+﻿/**
+ *	@file	atomic_spin_lock_pool.hpp
+ *
+ *	@brief	atomic_spin_lock_pool の定義
+ */
+
+#ifndef HAMON_ATOMIC_DETAIL_ATOMIC_SPIN_LOCK_POOL_HPP
+#define HAMON_ATOMIC_DETAIL_ATOMIC_SPIN_LOCK_POOL_HPP
+
+#include <hamon/atomic/memory_order.hpp>
+#include <hamon/atomic/detail/atomic_exchange.hpp>
+#include <hamon/atomic/detail/atomic_load.hpp>
+#include <hamon/atomic/detail/atomic_store.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/cstdint/uintptr_t.hpp>
+#include <hamon/config.hpp>
+#include <thread>
+
+namespace hamon
+{
+
+namespace detail
+{
+
+// ロックフリーで扱えない大きさの型をアトミックに操作するためのスピンロック
+//
+// アドレスのハッシュでロックを選ぶので、異なるオブジェクトが同じロックを共有することがある。
+class atomic_spin_lock_pool
+{
+private:
+	static hamon::size_t const kPoolSize = 64;
+
+	static int& get_lock(void const* addr) noexcept
+	{
+		static int s_locks[kPoolSize] {};
+		auto const key = reinterpret_cast<hamon::uintptr_t>(addr);
+		return s_locks[(key >> 4) % kPoolSize];
+	}
+
+public:
+	class scoped_lock
+	{
+	private:
+		int& m_lock;
+
+	public:
+		explicit scoped_lock(void const* addr) noexcept
+			: m_lock(get_lock(addr))
+		{
+			while (hamon::detail::atomic_exchange(&m_lock, 1, hamon::memory_order::acquire) != 0)
+			{
+				while (hamon::detail::atomic_load(&m_lock, hamon::memory_order::relaxed) != 0)
+				{
+					std::this_thread::yield();
+				}
+			}
+		}
+
+		~scoped_lock()
+		{
+			hamon::detail::atomic_store(&m_lock, 0, hamon::memory_order::release);
+		}
+
+		scoped_lock(scoped_lock const&) = delete;
+		scoped_lock& operator=(scoped_lock const&) = delete;
+	};
+};
+
+}	// namespace detail
+
+}	// namespace hamon
+
+#endif // HAMON_ATOMIC_DETAIL_ATOMIC_SPIN_LOCK_POOL_HPP
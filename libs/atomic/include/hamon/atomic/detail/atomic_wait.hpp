@@ -0,0 +1,154 @@
+﻿/**
+ *	@file	atomic_wait.hpp
+ *
+ *	@brief	atomic_wait, atomic_notify_one, atomic_notify_all の定義
+ */
+
+#ifndef HAMON_ATOMIC_DETAIL_ATOMIC_WAIT_HPP
+#define HAMON_ATOMIC_DETAIL_ATOMIC_WAIT_HPP
+
+#include <hamon/atomic/memory_order.hpp>
+#include <hamon/atomic/detail/atomic_fetch_add.hpp>
+#include <hamon/atomic/detail/atomic_fetch_sub.hpp>
+#include <hamon/atomic/detail/atomic_load.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/cstdint/uintptr_t.hpp>
+#include <hamon/config.hpp>
+#include <atomic>
+#include <thread>
+
+#if defined(HAMON_PLATFORM_LINUX)
+#include <climits>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#else
+#include <mutex>
+#include <condition_variable>
+#endif
+
+namespace hamon
+{
+
+namespace detail
+{
+
+// 待機しているスレッドを管理するテーブル
+//
+// アドレスのハッシュで振り分けるので、異なるアドレスで待機しているスレッドが同じ要素を共有することがある。
+// Linux では m_version を futex として使い、それ以外では mutex と条件変数で待機する。
+struct alignas(64) atomic_waiter_pool
+{
+	int m_waiters = 0;
+#if defined(HAMON_PLATFORM_LINUX)
+	int m_version = 0;
+#else
+	std::mutex m_mut;
+	std::condition_variable m_cv;
+#endif
+
+	static atomic_waiter_pool& get(void const* addr) noexcept
+	{
+		static hamon::size_t const kPoolSize = 16;
+		static atomic_waiter_pool s_pools[kPoolSize];
+		auto const key = reinterpret_cast<hamon::uintptr_t>(addr);
+		return s_pools[(key >> 6) % kPoolSize];
+	}
+};
+
+/**
+ *	@brief	pred() が true を返す間、addr に対する通知を待つ
+ *
+ *	@param	addr	待機するオブジェクトのアドレス
+ *	@param	pred	オブジェクトの値が変わっていなければ true を返す関数
+ */
+template <typename Pred>
+inline void
+atomic_wait(void const* addr, Pred pred)
+{
+	// 短い時間で値が変わることも多いので、まずは少しだけスピンする
+	for (int i = 0; i < 16; ++i)
+	{
+		if (!pred())
+		{
+			return;
+		}
+
+		std::this_thread::yield();
+	}
+
+	auto& pool = atomic_waiter_pool::get(addr);
+
+	// 通知側は値を書き換えてから m_waiters を確認するので、
+	// m_waiters を増やしてから値を確認すれば通知を取りこぼさない
+	hamon::detail::atomic_fetch_add(&pool.m_waiters, 1, hamon::memory_order::seq_cst);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+
+#if defined(HAMON_PLATFORM_LINUX)
+	for (;;)
+	{
+		int const version = hamon::detail::atomic_load(&pool.m_version, hamon::memory_order::acquire);
+		if (!pred())
+		{
+			break;
+		}
+
+		// m_version が version から変わっていれば、すぐに戻ってくる
+		::syscall(SYS_futex, &pool.m_version, FUTEX_WAIT_PRIVATE, version, nullptr, nullptr, 0);
+	}
+#else
+	{
+		std::unique_lock<std::mutex> lk(pool.m_mut);
+		while (pred())
+		{
+			pool.m_cv.wait(lk);
+		}
+	}
+#endif
+
+	hamon::detail::atomic_fetch_sub(&pool.m_waiters, 1, hamon::memory_order::release);
+}
+
+/**
+ *	@brief	addr で待機している全てのスレッドを起こす
+ */
+inline void
+atomic_notify_all(void const* addr)
+{
+	auto& pool = atomic_waiter_pool::get(addr);
+
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (hamon::detail::atomic_load(&pool.m_waiters, hamon::memory_order::relaxed) == 0)
+	{
+		// 待機しているスレッドがいなければシステムコールを呼ばない
+		return;
+	}
+
+#if defined(HAMON_PLATFORM_LINUX)
+	hamon::detail::atomic_fetch_add(&pool.m_version, 1, hamon::memory_order::seq_cst);
+	::syscall(SYS_futex, &pool.m_version, FUTEX_WAKE_PRIVATE, INT_MAX, nullptr, nullptr, 0);
+#else
+	{
+		std::lock_guard<std::mutex> lk(pool.m_mut);
+	}
+	pool.m_cv.notify_all();
+#endif
+}
+
+/**
+ *	@brief	addr で待機しているスレッドを1つ起こす
+ *
+ *	待機用のテーブルは他のアドレスと共有しているため、実際には全てのスレッドを起こす。
+ *	起こされたスレッドは値を確認し直すので、動作としては問題ない。
+ */
+inline void
+atomic_notify_one(void const* addr)
+{
+	hamon::detail::atomic_notify_all(addr);
+}
+
+}	// namespace detail
+
+}	// namespace hamon
+
+#endif // HAMON_ATOMIC_DETAIL_ATOMIC_WAIT_HPP
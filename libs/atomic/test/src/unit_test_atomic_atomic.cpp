@@ -0,0 +1,266 @@
+﻿/**
+ *	@file	unit_test_atomic_atomic.cpp
+ *
+ *	@brief	atomic のテスト
+ */
+
+#include <hamon/atomic/atomic.hpp>
+#include <hamon/atomic/memory_order.hpp>
+#include <hamon/type_traits/is_copy_constructible.hpp>
+#include <hamon/type_traits/is_copy_assignable.hpp>
+#include <hamon/type_traits/is_same.hpp>
+#include <hamon/vector.hpp>
+#include <gtest/gtest.h>
+#include <thread>
+
+namespace hamon_atomic_test
+{
+
+namespace atomic_test
+{
+
+static_assert(!hamon::is_copy_constructible<hamon::atomic<int>>::value, "");
+static_assert(!hamon::is_copy_assignable<hamon::atomic<int>>::value, "");
+static_assert(hamon::is_same<hamon::atomic<int>::value_type, int>::value, "");
+static_assert(hamon::is_same<hamon::atomic<int>::difference_type, int>::value, "");
+static_assert(hamon::is_same<hamon::atomic<float>::difference_type, float>::value, "");
+static_assert(hamon::is_same<hamon::atomic<int*>::difference_type, hamon::ptrdiff_t>::value, "");
+static_assert(hamon::atomic<int>::is_always_lock_free, "");
+static_assert(hamon::atomic<void*>::is_always_lock_free, "");
+
+struct Point
+{
+	int x;
+	int y;
+};
+
+struct Large
+{
+	int a[8];
+};
+
+template <typename T>
+void test_integral()
+{
+	hamon::atomic<T> a;
+	EXPECT_TRUE(a.is_lock_free());
+	EXPECT_EQ(T(0), a.load());
+
+	a.store(T(3));
+	EXPECT_EQ(T(3), a.load(hamon::memory_order::relaxed));
+	EXPECT_EQ(T(3), static_cast<T>(a));
+	EXPECT_EQ(T(5), (a = T(5)));
+	EXPECT_EQ(T(5), a.exchange(T(6), hamon::memory_order::acq_rel));
+
+	EXPECT_EQ(T(6), a.fetch_add(T(2)));
+	EXPECT_EQ(T(8), a.fetch_sub(T(1), hamon::memory_order::release));
+	EXPECT_EQ(T(7), a.fetch_and(T(3)));
+	EXPECT_EQ(T(3), a.fetch_or(T(4), hamon::memory_order::acquire));
+	EXPECT_EQ(T(7), a.fetch_xor(T(1)));
+	EXPECT_EQ(T(6), a.load());
+
+	EXPECT_EQ(T(6), a++);
+	EXPECT_EQ(T(8), ++a);
+	EXPECT_EQ(T(8), a--);
+	EXPECT_EQ(T(6), --a);
+	EXPECT_EQ(T(9), a += T(3));
+	EXPECT_EQ(T(7), a -= T(2));
+	EXPECT_EQ(T(5), a &= T(5));
+	EXPECT_EQ(T(7), a |= T(2));
+	EXPECT_EQ(T(4), a ^= T(3));
+
+	T expected = T(1);
+	EXPECT_FALSE(a.compare_exchange_strong(expected, T(2)));
+	EXPECT_EQ(T(4), expected);
+	EXPECT_TRUE(a.compare_exchange_strong(expected, T(2)));
+	EXPECT_EQ(T(2), a.load());
+	while (!a.compare_exchange_weak(expected, T(10), hamon::memory_order::acq_rel, hamon::memory_order::relaxed)) {}
+	EXPECT_EQ(T(10), a.load());
+}
+
+template <typename T>
+void test_floating_point()
+{
+	hamon::atomic<T> a{T(1.5)};
+	EXPECT_EQ(T(1.5), a.load());
+	EXPECT_EQ(T(1.5), a.fetch_add(T(2)));
+	EXPECT_EQ(T(3.5), a.fetch_sub(T(0.5), hamon::memory_order::relaxed));
+	EXPECT_EQ(T(4.0), a += T(1));
+	EXPECT_EQ(T(2.5), a -= T(1.5));
+	EXPECT_EQ(T(2.5), a.exchange(T(-1)));
+	EXPECT_EQ(T(-1), a.load());
+}
+
+void test_pointer()
+{
+	int arr[5] = {0, 1, 2, 3, 4};
+	hamon::atomic<int*> a{arr};
+	EXPECT_EQ(arr + 0, a.fetch_add(2));
+	EXPECT_EQ(arr + 2, a.fetch_sub(1));
+	EXPECT_EQ(arr + 1, a++);
+	EXPECT_EQ(arr + 3, ++a);
+	EXPECT_EQ(arr + 3, a--);
+	EXPECT_EQ(arr + 1, --a);
+	EXPECT_EQ(arr + 4, a += 3);
+	EXPECT_EQ(arr + 2, a -= 2);
+	EXPECT_EQ(2, *a.load());
+}
+
+void test_generic()
+{
+	{
+		hamon::atomic<bool> a;
+		EXPECT_FALSE(a.load());
+		EXPECT_FALSE(a.exchange(true));
+		EXPECT_TRUE(a);
+	}
+	{
+		hamon::atomic<Point> a{Point{1, 2}};
+		EXPECT_TRUE(a.is_lock_free());
+		Point p = a.load();
+		EXPECT_EQ(1, p.x);
+		EXPECT_EQ(2, p.y);
+
+		Point expected{1, 3};
+		EXPECT_FALSE(a.compare_exchange_strong(expected, Point{5, 6}));
+		EXPECT_EQ(2, expected.y);
+		EXPECT_TRUE(a.compare_exchange_strong(expected, Point{5, 6}));
+		p = a.exchange(Point{7, 8});
+		EXPECT_EQ(5, p.x);
+		EXPECT_EQ(6, p.y);
+		EXPECT_EQ(7, a.load().x);
+	}
+#if !defined(HAMON_USE_STD_ATOMIC)
+	// std::atomic ではロックフリーでない型に libatomic が必要になる
+	{
+		hamon::atomic<Large> a;
+		EXPECT_FALSE(hamon::atomic<Large>::is_always_lock_free);
+		EXPECT_FALSE(a.is_lock_free());
+		EXPECT_EQ(0, a.load().a[7]);
+
+		Large l{};
+		l.a[7] = 42;
+		a.store(l);
+		EXPECT_EQ(42, a.load().a[7]);
+
+		Large expected{};
+		EXPECT_FALSE(a.compare_exchange_weak(expected, Large{}));
+		EXPECT_EQ(42, expected.a[7]);
+		EXPECT_TRUE(a.compare_exchange_weak(expected, Large{}));
+		EXPECT_EQ(0, a.load().a[7]);
+	}
+#endif
+}
+
+void test_multi_thread()
+{
+	hamon::atomic<int> count{0};
+#if !defined(HAMON_USE_STD_ATOMIC)
+	hamon::atomic<Large> large;
+#endif
+	hamon::vector<std::thread> threads;
+
+	for (int i = 0; i < 4; ++i)
+	{
+		threads.emplace_back([&]
+		{
+			for (int j = 0; j < 10000; ++j)
+			{
+				count.fetch_add(1, hamon::memory_order::relaxed);
+			}
+
+#if !defined(HAMON_USE_STD_ATOMIC)
+
+			for (int j = 0; j < 1000; ++j)
+			{
+				Large expected = large.load();
+				Large desired;
+				do
+				{
+					desired = expected;
+					for (auto& x : desired.a)
+					{
+						++x;
+					}
+				}
+				while (!large.compare_exchange_weak(expected, desired));
+			}
+#endif
+		});
+	}
+
+	for (auto& t : threads)
+	{
+		t.join();
+	}
+
+	EXPECT_EQ(40000, count.load());
+#if !defined(HAMON_USE_STD_ATOMIC)
+	for (auto x : large.load().a)
+	{
+		EXPECT_EQ(4000, x);
+	}
+#endif
+}
+
+void test_wait_notify()
+{
+	hamon::atomic<int> a{0};
+
+	std::thread t([&a]
+	{
+		int last = 0;
+		for (int i = 1; i <= 100; ++i)
+		{
+			a.wait(last);
+			EXPECT_EQ(i, a.load());
+			last = i + 1000;
+			a.store(last);
+			a.notify_one();
+		}
+	});
+
+	for (int i = 1; i <= 100; ++i)
+	{
+		a.store(i);
+		a.notify_one();
+		a.wait(i);
+		EXPECT_EQ(i + 1000, a.load());
+	}
+
+	t.join();
+
+	// 値が異なっていればすぐに戻る
+	a.wait(0, hamon::memory_order::acquire);
+	a.notify_all();
+}
+
+GTEST_TEST(AtomicTest, AtomicTest)
+{
+	test_integral<char>();
+	test_integral<signed char>();
+	test_integral<unsigned char>();
+	test_integral<short>();
+	test_integral<unsigned short>();
+	test_integral<int>();
+	test_integral<unsigned int>();
+	test_integral<long>();
+	test_integral<unsigned long>();
+	test_integral<long long>();
+	test_integral<unsigned long long>();
+
+	test_floating_point<float>();
+	test_floating_point<double>();
+#if !defined(HAMON_USE_STD_ATOMIC)
+	test_floating_point<long double>();
+#endif
+
+	test_pointer();
+	test_generic();
+	test_multi_thread();
+	test_wait_notify();
+}
+
+}	// namespace atomic_test
+
+}	// namespace hamon_atomic_test
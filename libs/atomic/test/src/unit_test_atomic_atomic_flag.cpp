@@ -0,0 +1,69 @@
+﻿/**
+ *	@file	unit_test_atomic_atomic_flag.cpp
+ *
+ *	@brief	atomic_flag のテスト
+ */
+
+#include <hamon/atomic/atomic_flag.hpp>
+#include <hamon/atomic/memory_order.hpp>
+#include <hamon/type_traits/is_copy_constructible.hpp>
+#include <hamon/type_traits/is_copy_assignable.hpp>
+#include <hamon/vector.hpp>
+#include <gtest/gtest.h>
+#include <thread>
+
+namespace hamon_atomic_test
+{
+
+namespace atomic_flag_test
+{
+
+static_assert(!hamon::is_copy_constructible<hamon::atomic_flag>::value, "");
+static_assert(!hamon::is_copy_assignable<hamon::atomic_flag>::value, "");
+
+GTEST_TEST(AtomicTest, AtomicFlagTest)
+{
+	{
+		hamon::atomic_flag f;
+		EXPECT_FALSE(f.test());
+		EXPECT_FALSE(f.test_and_set());
+		EXPECT_TRUE(f.test(hamon::memory_order::acquire));
+		EXPECT_TRUE(f.test_and_set(hamon::memory_order::acq_rel));
+		f.clear(hamon::memory_order::release);
+		EXPECT_FALSE(f.test(hamon::memory_order::relaxed));
+	}
+	{
+		// スピンロックとして使う
+		hamon::atomic_flag f;
+		int count = 0;
+		hamon::vector<std::thread> threads;
+
+		for (int i = 0; i < 4; ++i)
+		{
+			threads.emplace_back([&f, &count]
+			{
+				for (int j = 0; j < 1000; ++j)
+				{
+					while (f.test_and_set(hamon::memory_order::acquire))
+					{
+						f.wait(true, hamon::memory_order::relaxed);
+					}
+					++count;
+					f.clear(hamon::memory_order::release);
+					f.notify_one();
+				}
+			});
+		}
+
+		for (auto& t : threads)
+		{
+			t.join();
+		}
+
+		EXPECT_EQ(4000, count);
+	}
+}
+
+}	// namespace atomic_flag_test
+
+}	// namespace hamon_atomic_test
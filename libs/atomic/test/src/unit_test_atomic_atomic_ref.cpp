@@ -0,0 +1,195 @@
+﻿/**
+ *	@file	unit_test_atomic_atomic_ref.cpp
+ *
+ *	@brief	atomic_ref のテスト
+ */
+
+#include <hamon/atomic/atomic_ref.hpp>
+#include <hamon/atomic/memory_order.hpp>
+#include <hamon/type_traits/is_copy_constructible.hpp>
+#include <hamon/type_traits/is_copy_assignable.hpp>
+#include <hamon/type_traits/is_same.hpp>
+#include <hamon/vector.hpp>
+#include <gtest/gtest.h>
+#include <thread>
+
+namespace hamon_atomic_test
+{
+
+namespace atomic_ref_test
+{
+
+static_assert( hamon::is_copy_constructible<hamon::atomic_ref<int>>::value, "");
+static_assert(!hamon::is_copy_assignable<hamon::atomic_ref<int>>::value, "");
+static_assert(hamon::is_same<hamon::atomic_ref<int>::value_type, int>::value, "");
+static_assert(hamon::is_same<hamon::atomic_ref<int>::difference_type, int>::value, "");
+static_assert(hamon::is_same<hamon::atomic_ref<double>::difference_type, double>::value, "");
+static_assert(hamon::is_same<hamon::atomic_ref<int*>::difference_type, hamon::ptrdiff_t>::value, "");
+static_assert(hamon::atomic_ref<int>::required_alignment >= alignof(int), "");
+static_assert(hamon::atomic_ref<long long>::required_alignment == sizeof(long long), "");
+static_assert(hamon::atomic_ref<int>::is_always_lock_free, "");
+
+struct Large
+{
+	int a[8];
+};
+
+template <typename T>
+void test_integral()
+{
+	T x = T(1);
+	hamon::atomic_ref<T> const r(x);
+	EXPECT_TRUE(r.is_lock_free());
+	EXPECT_EQ(T(1), r.load());
+
+	r.store(T(3), hamon::memory_order::release);
+	EXPECT_EQ(T(3), x);
+	EXPECT_EQ(T(4), (r = T(4)));
+	EXPECT_EQ(T(4), static_cast<T>(r));
+	EXPECT_EQ(T(4), r.exchange(T(6)));
+
+	EXPECT_EQ(T(6), r.fetch_add(T(2)));
+	EXPECT_EQ(T(8), r.fetch_sub(T(1)));
+	EXPECT_EQ(T(7), r.fetch_and(T(3)));
+	EXPECT_EQ(T(3), r.fetch_or(T(4)));
+	EXPECT_EQ(T(7), r.fetch_xor(T(1)));
+	EXPECT_EQ(T(6), x);
+
+	EXPECT_EQ(T(6), r++);
+	EXPECT_EQ(T(8), ++r);
+	EXPECT_EQ(T(8), r--);
+	EXPECT_EQ(T(6), --r);
+	EXPECT_EQ(T(9), r += T(3));
+	EXPECT_EQ(T(7), r -= T(2));
+	EXPECT_EQ(T(5), r &= T(5));
+	EXPECT_EQ(T(7), r |= T(2));
+	EXPECT_EQ(T(4), r ^= T(3));
+
+	T expected = T(1);
+	EXPECT_FALSE(r.compare_exchange_strong(expected, T(2), hamon::memory_order::acq_rel));
+	EXPECT_EQ(T(4), expected);
+	EXPECT_TRUE(r.compare_exchange_strong(expected, T(2)));
+	EXPECT_EQ(T(2), x);
+
+	// コピーしたatomic_refも同じオブジェクトを参照する
+	hamon::atomic_ref<T> r2(r);
+	r2.store(T(11));
+	EXPECT_EQ(T(11), r.load());
+}
+
+template <typename T>
+void test_floating_point()
+{
+	T x = T(1.5);
+	hamon::atomic_ref<T> const r(x);
+	EXPECT_EQ(T(1.5), r.fetch_add(T(2)));
+	EXPECT_EQ(T(3.5), r.fetch_sub(T(0.5)));
+	EXPECT_EQ(T(4.0), r += T(1));
+	EXPECT_EQ(T(2.5), r -= T(1.5));
+	EXPECT_EQ(T(2.5), x);
+}
+
+void test_pointer()
+{
+	int arr[5] = {0, 1, 2, 3, 4};
+	int* p = arr;
+	hamon::atomic_ref<int*> const r(p);
+	EXPECT_EQ(arr + 0, r.fetch_add(2));
+	EXPECT_EQ(arr + 2, r.fetch_sub(1));
+	EXPECT_EQ(arr + 1, r++);
+	EXPECT_EQ(arr + 3, ++r);
+	EXPECT_EQ(arr + 4, r += 1);
+	EXPECT_EQ(arr + 2, r -= 2);
+	EXPECT_EQ(arr + 2, p);
+}
+
+void test_generic()
+{
+#if !defined(HAMON_USE_STD_ATOMIC)
+	// std::atomic_ref ではロックフリーでない型に libatomic が必要になる
+	Large x{};
+	hamon::atomic_ref<Large> const r(x);
+	EXPECT_FALSE(r.is_lock_free());
+
+	Large l{};
+	l.a[0] = 3;
+	r.store(l);
+	EXPECT_EQ(3, x.a[0]);
+
+	Large expected{};
+	EXPECT_FALSE(r.compare_exchange_strong(expected, Large{}));
+	EXPECT_EQ(3, expected.a[0]);
+	EXPECT_TRUE(r.compare_exchange_strong(expected, Large{}));
+	EXPECT_EQ(0, x.a[0]);
+#endif
+}
+
+void test_multi_thread()
+{
+	alignas(hamon::atomic_ref<long>::required_alignment) long count = 0;
+	hamon::vector<std::thread> threads;
+
+	for (int i = 0; i < 4; ++i)
+	{
+		threads.emplace_back([&count]
+		{
+			hamon::atomic_ref<long> r(count);
+			for (int j = 0; j < 10000; ++j)
+			{
+				r.fetch_add(1, hamon::memory_order::relaxed);
+			}
+		});
+	}
+
+	for (auto& t : threads)
+	{
+		t.join();
+	}
+
+	EXPECT_EQ(40000, count);
+}
+
+void test_wait_notify()
+{
+	int x = 0;
+
+	std::thread t([&x]
+	{
+		hamon::atomic_ref<int> r(x);
+		r.wait(0);
+		EXPECT_EQ(1, r.load());
+		r.store(2);
+		r.notify_all();
+	});
+
+	hamon::atomic_ref<int> r(x);
+	r.store(1);
+	r.notify_one();
+	r.wait(1);
+	EXPECT_EQ(2, r.load());
+
+	t.join();
+}
+
+GTEST_TEST(AtomicTest, AtomicRefTest)
+{
+	test_integral<char>();
+	test_integral<unsigned char>();
+	test_integral<short>();
+	test_integral<int>();
+	test_integral<unsigned int>();
+	test_integral<long long>();
+	test_integral<unsigned long long>();
+
+	test_floating_point<float>();
+	test_floating_point<double>();
+
+	test_pointer();
+	test_generic();
+	test_multi_thread();
+	test_wait_notify();
+}
+
+}	// namespace atomic_ref_test
+
+}	// namespace hamon_atomic_test
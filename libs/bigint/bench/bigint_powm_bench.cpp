@@ -0,0 +1,100 @@
+﻿/**
+ *	@file	bigint_powm_bench.cpp
+ *
+ *	@brief	powm, gcd, modinv のベンチマーク
+ *
+ *	256, 512, 1024, 2048, 4096 ビットの乱数について、
+ *	base^exp mod m (m が奇数の場合と偶数の場合)、gcd、modinv の1回あたりの時間を出力する。
+ *	fixed_bigint<Bits> と bigint の両方を計測する。
+ *
+ *	使い方:
+ *		bigint_powm_bench
+ */
+
+#include <hamon/bigint.hpp>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+// 最上位ビットが立った bits ビットの乱数を返す
+template <typename BigInt>
+BigInt make_random(std::mt19937& rng, std::size_t bits, bool odd)
+{
+	BigInt x = 1;
+	for (std::size_t i = 1; i < bits; i += 32)
+	{
+		auto const n = (bits - i) < 32 ? (bits - i) : 32;
+		x <<= n;
+		x |= BigInt(rng() >> (32 - n));
+	}
+	x |= BigInt(1);
+	if (!odd)
+	{
+		x -= BigInt(1);
+	}
+	return x;
+}
+
+// f を少なくとも 200ms 繰り返し、1回あたりの時間 [us] を返す
+template <typename F>
+double measure(F f)
+{
+	std::uint32_t sink = 0;
+	long long count = 0;
+	auto const start = Clock::now();
+	auto end = start;
+	do
+	{
+		sink += static_cast<std::uint32_t>(f());
+		++count;
+		end = Clock::now();
+	}
+	while (end - start < std::chrono::milliseconds(200));
+	if (sink == 0xFFFFFFFFu)
+	{
+		std::printf(" ");
+	}
+	return std::chrono::duration<double, std::micro>(end - start).count() / static_cast<double>(count);
+}
+
+template <typename BigInt>
+void run(char const* name, std::size_t bits)
+{
+	std::mt19937 rng(static_cast<std::uint32_t>(bits));
+	auto const base     = make_random<BigInt>(rng, bits - 1, true);
+	auto const exp      = make_random<BigInt>(rng, bits, true);
+	auto const mod_odd  = make_random<BigInt>(rng, bits, true);
+	auto const mod_even = make_random<BigInt>(rng, bits, false);
+
+	auto const t1 = measure([&]{ return static_cast<bool>(powm(base, exp, mod_odd)  != BigInt(0)); });
+	auto const t2 = measure([&]{ return static_cast<bool>(powm(base, exp, mod_even) != BigInt(0)); });
+	auto const t3 = measure([&]{ return static_cast<bool>(gcd(base, mod_odd)        != BigInt(0)); });
+	auto const t4 = measure([&]{ return static_cast<bool>(modinv(base, mod_odd)     != BigInt(0)); });
+
+	std::printf("%6zu %-20s %14.1f %14.1f %12.2f %12.2f\n", bits, name, t1, t2, t3, t4);
+}
+
+}	// namespace
+
+int main()
+{
+	std::printf("%6s %-20s %14s %14s %12s %12s\n", "bits", "type",
+		"powm odd [us]", "powm even [us]", "gcd [us]", "modinv [us]");
+	run<hamon::fixed_bigint< 256, false>>("fixed_bigint<256>",   256);
+	run<hamon::fixed_bigint< 512, false>>("fixed_bigint<512>",   512);
+	run<hamon::fixed_bigint<1024, false>>("fixed_bigint<1024>", 1024);
+	run<hamon::fixed_bigint<2048, false>>("fixed_bigint<2048>", 2048);
+	run<hamon::fixed_bigint<4096, false>>("fixed_bigint<4096>", 4096);
+	run<hamon::bigint>("bigint",  256);
+	run<hamon::bigint>("bigint",  512);
+	run<hamon::bigint>("bigint", 1024);
+	run<hamon::bigint>("bigint", 2048);
+	run<hamon::bigint>("bigint", 4096);
+}
@@ -0,0 +1,25 @@
+﻿/**
+ *	@file	barrett_reducer_fwd.hpp
+ *
+ *	@brief	barrett_reducer の前方宣言
+ */
+
+#ifndef HAMON_BIGINT_BARRETT_REDUCER_FWD_HPP
+#define HAMON_BIGINT_BARRETT_REDUCER_FWD_HPP
+
+namespace hamon
+{
+
+/**
+ *	@brief	同じ法 m による剰余を繰り返し求めるためのクラス
+ *
+ *	BigInt は basic_bigint または fixed_bigint。
+ *	コンストラクタで前計算を1回行っておき、reduce(x) と mul(x, y) を除算を使わずに計算する。
+ *	結果は常に 0 以上 |m| 未満。m が 0 の場合は x や x * y をそのまま返す。
+ */
+template <typename BigInt>
+class barrett_reducer;
+
+}	// namespace hamon
+
+#endif // HAMON_BIGINT_BARRETT_REDUCER_FWD_HPP
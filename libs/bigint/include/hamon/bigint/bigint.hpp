@@ -23,54 +23,129 @@
 #include <hamon/bigint/bigint_algo/bit_shift_right.hpp>
 #include <hamon/bigint/bigint_algo/compare.hpp>
 #include <hamon/bigint/bigint_algo/is_zero.hpp>
+#include <hamon/bigint/bigint_algo/powm.hpp>
+#include <hamon/bigint/bigint_algo/gcd.hpp>
+#include <hamon/bigint/bigint_algo/extended_gcd.hpp>
+#include <hamon/bigint/bigint_algo/modinv.hpp>
+#include <hamon/bigint/bigint_algo/barrett_reducer.hpp>
+#include <hamon/bigint/barrett_reducer_fwd.hpp>
+#include <hamon/bigint/extended_gcd_result.hpp>
 #include <hamon/bigint/detail/abs_unsigned.hpp>
+#include <hamon/bigint/detail/limb_type.hpp>
+#include <hamon/bigint/detail/small_vector.hpp>
+#include <hamon/bit/bitsof.hpp>
 #include <hamon/concepts/integral.hpp>
 #include <hamon/concepts/detail/constrained_param.hpp>
 #include <hamon/compare/strong_ordering.hpp>
+#include <hamon/memory/allocator.hpp>
+#include <hamon/memory/allocator_traits.hpp>
 #include <hamon/memory/to_address.hpp>
+#include <hamon/memory_resource/polymorphic_allocator.hpp>
 #include <hamon/type_traits/make_unsigned.hpp>
 #include <hamon/string_view.hpp>
 #include <hamon/string.hpp>
-#include <hamon/vector.hpp>
+#include <hamon/utility/move.hpp>
+#include <hamon/cstddef/size_t.hpp>
 #include <hamon/cstdint.hpp>
 #include <hamon/config.hpp>
 #include <istream>
 #include <ostream>
 
+// 絶対値がこのビット数に収まる間は、bigint は動的なメモリ確保を行わない
+#if !defined(HAMON_BIGINT_INLINE_BITS)
+#  define HAMON_BIGINT_INLINE_BITS 256
+#endif
+
 namespace hamon
 {
 
-class bigint;
+template <typename Allocator = hamon::allocator<hamon::detail::bigint_limb_type>>
+class basic_bigint;
+
+// 任意長・符号付き
+using bigint = hamon::basic_bigint<>;
+
+namespace pmr
+{
+
+using bigint = hamon::basic_bigint<
+	hamon::pmr::polymorphic_allocator<hamon::detail::bigint_limb_type>>;
+
+}	// namespace pmr
 
+template <typename Allocator>
 hamon::from_chars_result
-from_chars(char const* first, char const* last, bigint& value, int base = 10);
+from_chars(char const* first, char const* last, basic_bigint<Allocator>& value, int base = 10);
 
+template <typename Allocator>
 hamon::to_chars_result
-to_chars(char* first, char* last, bigint const& value, int base = 10);
+to_chars(char* first, char* last, basic_bigint<Allocator> const& value, int base = 10);
 
-hamon::string to_string(bigint const& value);
+template <typename Allocator>
+hamon::string to_string(basic_bigint<Allocator> const& value);
 
-class bigint
+template <typename Allocator>
+basic_bigint<Allocator>
+powm(basic_bigint<Allocator> const& base, basic_bigint<Allocator> const& exp, basic_bigint<Allocator> const& mod);
+
+template <typename Allocator>
+basic_bigint<Allocator>
+gcd(basic_bigint<Allocator> const& lhs, basic_bigint<Allocator> const& rhs);
+
+template <typename Allocator>
+hamon::extended_gcd_result<basic_bigint<Allocator>>
+extended_gcd(basic_bigint<Allocator> const& lhs, basic_bigint<Allocator> const& rhs);
+
+template <typename Allocator>
+basic_bigint<Allocator>
+modinv(basic_bigint<Allocator> const& x, basic_bigint<Allocator> const& mod);
+
+/**
+ *	@brief	任意長の符号付き整数
+ *
+ *	絶対値が HAMON_BIGINT_INLINE_BITS ビットに収まる間は、桁をオブジェクト内部のバッファに格納するので、
+ *	四則演算や比較でメモリ確保を行わない。それを超えると Allocator でメモリを確保する。
+ *
+ *	複合代入演算子は左辺の領域をそのまま使って計算する。
+ *	二項演算子の結果は左辺のアロケータを使うので、pmr::bigint の左辺を作業用のメモリリソースから作れば、
+ *	式の途中で作られる一時オブジェクトのメモリもそこから確保される。
+ */
+template <typename Allocator>
+class basic_bigint
 {
 private:
-	using MagnitudeType = hamon::vector<hamon::uint32_t>;
+	using limb_type = hamon::detail::bigint_limb_type;
 
 public:
-	bigint() HAMON_NOEXCEPT
+	using allocator_type =
+		typename hamon::allocator_traits<Allocator>::template rebind_alloc<limb_type>;
+
+private:
+	static const hamon::size_t InlineLimbs =
+		(HAMON_BIGINT_INLINE_BITS + hamon::bitsof<limb_type>() - 1) / hamon::bitsof<limb_type>();
+
+	using MagnitudeType = hamon::detail::bigint_small_vector<limb_type, InlineLimbs, allocator_type>;
+
+public:
+	basic_bigint() HAMON_NOEXCEPT
+		: basic_bigint(allocator_type())
+	{}
+
+	explicit basic_bigint(allocator_type const& a) HAMON_NOEXCEPT
 		: m_sign(1)
-		, m_magnitude{0}
+		, m_magnitude(1, limb_type{0}, a)
 	{}
 
 	template <HAMON_CONSTRAINED_PARAM(hamon::integral, Integral)>
-	bigint(Integral n) HAMON_NOEXCEPT
+	basic_bigint(Integral n, allocator_type const& a = allocator_type()) HAMON_NOEXCEPT
 		: m_sign(n < 0 ? -1 : 1)
+		, m_magnitude(a)
 	{
 		bigint_algo::from_uint(hamon::abs_unsigned(n), m_magnitude);
 	}
 
-	explicit bigint(hamon::string_view str)
-		: m_sign(1)
-		, m_magnitude{0}
+	explicit basic_bigint(hamon::string_view str, allocator_type const& a = allocator_type())
+		: basic_bigint(a)
 	{
 		if (str.size() >= 1)
 		{
@@ -119,39 +194,56 @@ public:
 		}
 	}
 
-private:
-	bigint(int sign, MagnitudeType const& mag) HAMON_NOEXCEPT
-		: m_sign(sign)
-		, m_magnitude{mag}
+	basic_bigint(basic_bigint const&) = default;
+	basic_bigint(basic_bigint&&) = default;
+
+	basic_bigint(basic_bigint const& x, allocator_type const& a)
+		: m_sign(x.m_sign)
+		, m_magnitude(x.m_magnitude, a)
 	{}
 
-public:
-	HAMON_NODISCARD bigint operator+() const HAMON_NOEXCEPT
+	basic_bigint& operator=(basic_bigint const&) = default;
+	basic_bigint& operator=(basic_bigint&&) = default;
+
+	allocator_type get_allocator() const HAMON_NOEXCEPT
 	{
-		return *this;
+		return m_magnitude.get_allocator();
 	}
 
-	HAMON_NODISCARD bigint operator-() const HAMON_NOEXCEPT
+	HAMON_NODISCARD basic_bigint operator+() const HAMON_NOEXCEPT
 	{
-		if (bigint_algo::is_zero(m_magnitude))
+		return basic_bigint(*this, this->get_allocator());
+	}
+
+	HAMON_NODISCARD basic_bigint operator-() const HAMON_NOEXCEPT
+	{
+		basic_bigint result(*this, this->get_allocator());
+		if (!bigint_algo::is_zero(m_magnitude))
 		{
-			return *this;
+			result.m_sign = -m_sign;
 		}
-		return {-m_sign, m_magnitude};
+		return result;
 	}
 
-	HAMON_NODISCARD bigint operator~() const HAMON_NOEXCEPT
+	HAMON_NODISCARD basic_bigint operator~() const HAMON_NOEXCEPT
 	{
-		return -(bigint{*this} += 1);
+		// ~x == -(x + 1)
+		basic_bigint result(*this, this->get_allocator());
+		result += 1;
+		if (!bigint_algo::is_zero(result.m_magnitude))
+		{
+			result.m_sign = -result.m_sign;
+		}
+		return result;
 	}
 
 private:
-	void add(bigint const& rhs) HAMON_NOEXCEPT
+	void add(basic_bigint const& rhs) HAMON_NOEXCEPT
 	{
 		bigint_algo::add(m_magnitude, rhs.m_magnitude);
 	}
 
-	void sub(bigint const& rhs) HAMON_NOEXCEPT
+	void sub(basic_bigint const& rhs) HAMON_NOEXCEPT
 	{
 		auto const c = bigint_algo::compare(m_magnitude, rhs.m_magnitude);
 
@@ -168,15 +260,13 @@ private:
 		else if (c < 0)
 		{
 			// lhs = rhs - lhs
-			MagnitudeType tmp(rhs.m_magnitude);
-			bigint_algo::sub(tmp, m_magnitude);
-			m_magnitude = tmp;
+			bigint_algo::sub_reverse(m_magnitude, rhs.m_magnitude);
 			m_sign = -m_sign;
 		}
 	}
-	
+
 public:
-	bigint& operator+=(bigint const& rhs) HAMON_NOEXCEPT
+	basic_bigint& operator+=(basic_bigint const& rhs) HAMON_NOEXCEPT
 	{
 		if (m_sign != rhs.m_sign)
 		{
@@ -190,7 +280,7 @@ public:
 		return *this;
 	}
 
-	bigint& operator-=(bigint const& rhs) HAMON_NOEXCEPT
+	basic_bigint& operator-=(basic_bigint const& rhs) HAMON_NOEXCEPT
 	{
 		if (m_sign != rhs.m_sign)
 		{
@@ -204,9 +294,12 @@ public:
 		return *this;
 	}
 
-	bigint& operator*=(bigint const& rhs) HAMON_NOEXCEPT
+	basic_bigint& operator*=(basic_bigint const& rhs) HAMON_NOEXCEPT
 	{
-		m_magnitude = bigint_algo::multiply(m_magnitude, rhs.m_magnitude);
+		// 乗算は in-place にできないので、結果を作ってから入れ替える
+		MagnitudeType result(this->get_allocator());
+		bigint_algo::multiply(result, m_magnitude, rhs.m_magnitude);
+		m_magnitude = hamon::move(result);
 		if (bigint_algo::is_zero(m_magnitude))
 		{
 			m_sign = 1;
@@ -218,10 +311,12 @@ public:
 		return *this;
 	}
 
-	bigint& operator/=(bigint const& rhs) HAMON_NOEXCEPT
+	basic_bigint& operator/=(basic_bigint const& rhs) HAMON_NOEXCEPT
 	{
-		auto ret = bigint_algo::div_mod(m_magnitude, rhs.m_magnitude);
-		m_magnitude = ret.quo;
+		MagnitudeType quo(this->get_allocator());
+		MagnitudeType rem(this->get_allocator());
+		bigint_algo::div_mod(quo, rem, m_magnitude, rhs.m_magnitude);
+		m_magnitude = hamon::move(quo);
 		if (bigint_algo::is_zero(m_magnitude))
 		{
 			m_sign = 1;
@@ -233,10 +328,12 @@ public:
 		return *this;
 	}
 
-	bigint& operator%=(bigint const& rhs) HAMON_NOEXCEPT
+	basic_bigint& operator%=(basic_bigint const& rhs) HAMON_NOEXCEPT
 	{
-		auto ret = bigint_algo::div_mod(m_magnitude, rhs.m_magnitude);
-		m_magnitude = ret.rem;
+		MagnitudeType quo(this->get_allocator());
+		MagnitudeType rem(this->get_allocator());
+		bigint_algo::div_mod(quo, rem, m_magnitude, rhs.m_magnitude);
+		m_magnitude = hamon::move(rem);
 		if (bigint_algo::is_zero(m_magnitude))
 		{
 			m_sign = 1;
@@ -244,56 +341,56 @@ public:
 		return *this;
 	}
 
-	bigint& operator&=(bigint const& rhs) HAMON_NOEXCEPT
+	basic_bigint& operator&=(basic_bigint const& rhs) HAMON_NOEXCEPT
 	{
 		bigint_algo::bit_and(m_magnitude, rhs.m_magnitude);
 		return *this;
 	}
 
-	bigint& operator|=(bigint const& rhs) HAMON_NOEXCEPT
+	basic_bigint& operator|=(basic_bigint const& rhs) HAMON_NOEXCEPT
 	{
 		bigint_algo::bit_or(m_magnitude, rhs.m_magnitude);
 		return *this;
 	}
 
-	bigint& operator^=(bigint const& rhs) HAMON_NOEXCEPT
+	basic_bigint& operator^=(basic_bigint const& rhs) HAMON_NOEXCEPT
 	{
 		bigint_algo::bit_xor(m_magnitude, rhs.m_magnitude);
 		return *this;
 	}
 
-	bigint& operator<<=(hamon::size_t pos) HAMON_NOEXCEPT
+	basic_bigint& operator<<=(hamon::size_t pos) HAMON_NOEXCEPT
 	{
 		bigint_algo::bit_shift_left(m_magnitude, pos);
 		return *this;
 	}
 
-	bigint& operator>>=(hamon::size_t pos) HAMON_NOEXCEPT
+	basic_bigint& operator>>=(hamon::size_t pos) HAMON_NOEXCEPT
 	{
 		bigint_algo::bit_shift_right(m_magnitude, pos);
 		return *this;
 	}
 
-	bigint& operator++() HAMON_NOEXCEPT
+	basic_bigint& operator++() HAMON_NOEXCEPT
 	{
 		return *this += 1;
 	}
 
-	bigint& operator--() HAMON_NOEXCEPT
+	basic_bigint& operator--() HAMON_NOEXCEPT
 	{
 		return *this -= 1;
 	}
 
-	bigint operator++(int) HAMON_NOEXCEPT
+	basic_bigint operator++(int) HAMON_NOEXCEPT
 	{
-		auto tmp = *this;
+		basic_bigint tmp(*this, this->get_allocator());
 		++(*this);
 		return tmp;
 	}
 
-	bigint operator--(int) HAMON_NOEXCEPT
+	basic_bigint operator--(int) HAMON_NOEXCEPT
 	{
-		auto tmp = *this;
+		basic_bigint tmp(*this, this->get_allocator());
 		--(*this);
 		return tmp;
 	}
@@ -307,7 +404,7 @@ public:
 		return static_cast<Integral>(result * static_cast<UT>(m_sign));
 	}
 
-	HAMON_NODISCARD int compare(bigint const& rhs) const HAMON_NOEXCEPT
+	HAMON_NODISCARD int compare(basic_bigint const& rhs) const HAMON_NOEXCEPT
 	{
 		if (m_sign != rhs.m_sign)
 		{
@@ -317,126 +414,263 @@ public:
 		return bigint_algo::compare(m_magnitude, rhs.m_magnitude) * m_sign;
 	}
 
+private:
+	// out = x mod m (0 <= out < m)
+	static void nonnegative_mod(MagnitudeType& out, basic_bigint const& x, MagnitudeType const& m)
+	{
+		MagnitudeType quo(out.get_allocator());
+		bigint_algo::div_mod(quo, out, x.m_magnitude, m);
+		if (x.m_sign < 0 && !bigint_algo::is_zero(out))
+		{
+			bigint_algo::sub_reverse(out, m);
+		}
+	}
+
+	// 絶対値が 0 なら符号を正にする
+	void fix_sign() HAMON_NOEXCEPT
+	{
+		if (bigint_algo::is_zero(m_magnitude))
+		{
+			m_sign = 1;
+		}
+	}
+
 private:
 	int				m_sign = 1;	// m_magnitude >= 0 なら 1、m_magnitude < 0 なら -1
 	MagnitudeType	m_magnitude;
 
 private:
+	template <typename A>
 	friend hamon::from_chars_result
-	from_chars(char const* first, char const* last, bigint& value, int base);
+	from_chars(char const* first, char const* last, basic_bigint<A>& value, int base);
 
+	template <typename A>
 	friend hamon::to_chars_result
-	to_chars(char* first, char* last, bigint const& value, int base);
+	to_chars(char* first, char* last, basic_bigint<A> const& value, int base);
 
-	friend hamon::string to_string(bigint const& value);
-};
+	template <typename A>
+	friend hamon::string to_string(basic_bigint<A> const& value);
 
-HAMON_NODISCARD inline bigint
-operator+(bigint const& lhs, bigint const& rhs) HAMON_NOEXCEPT
-{
-	return bigint(lhs) += rhs;
-}
+	template <typename A>
+	friend basic_bigint<A>
+	powm(basic_bigint<A> const& base, basic_bigint<A> const& exp, basic_bigint<A> const& mod);
 
-HAMON_NODISCARD inline bigint
-operator-(bigint const& lhs, bigint const& rhs) HAMON_NOEXCEPT
-{
-	return bigint(lhs) -= rhs;
-}
+	template <typename A>
+	friend basic_bigint<A>
+	gcd(basic_bigint<A> const& lhs, basic_bigint<A> const& rhs);
 
-HAMON_NODISCARD inline bigint
-operator*(bigint const& lhs, bigint const& rhs) HAMON_NOEXCEPT
-{
-	return bigint(lhs) *= rhs;
-}
+	template <typename A>
+	friend hamon::extended_gcd_result<basic_bigint<A>>
+	extended_gcd(basic_bigint<A> const& lhs, basic_bigint<A> const& rhs);
 
-HAMON_NODISCARD inline bigint
-operator/(bigint const& lhs, bigint const& rhs) HAMON_NOEXCEPT
-{
-	return bigint(lhs) /= rhs;
-}
+	template <typename A>
+	friend basic_bigint<A>
+	modinv(basic_bigint<A> const& x, basic_bigint<A> const& mod);
 
-HAMON_NODISCARD inline bigint
-operator%(bigint const& lhs, bigint const& rhs) HAMON_NOEXCEPT
-{
-	return bigint(lhs) %= rhs;
-}
+	template <typename BigInt>
+	friend class hamon::barrett_reducer;
 
-HAMON_NODISCARD inline bigint
-operator&(bigint const& lhs, bigint const& rhs) HAMON_NOEXCEPT
-{
-	return bigint(lhs) &= rhs;
-}
+	// 二項演算子は、左辺が一時オブジェクトならその領域を使って計算する。
+	// そうでなければ左辺を左辺のアロケータでコピーして計算する。
 
-HAMON_NODISCARD inline bigint
-operator|(bigint const& lhs, bigint const& rhs) HAMON_NOEXCEPT
-{
-	return bigint(lhs) |= rhs;
-}
+	HAMON_NODISCARD friend basic_bigint
+	operator+(basic_bigint const& lhs, basic_bigint const& rhs) HAMON_NOEXCEPT
+	{
+		basic_bigint result(lhs, lhs.get_allocator());
+		result += rhs;
+		return result;
+	}
 
-HAMON_NODISCARD inline bigint
-operator^(bigint const& lhs, bigint const& rhs) HAMON_NOEXCEPT
-{
-	return bigint(lhs) ^= rhs;
-}
+	HAMON_NODISCARD friend basic_bigint
+	operator+(basic_bigint&& lhs, basic_bigint const& rhs) HAMON_NOEXCEPT
+	{
+		lhs += rhs;
+		return hamon::move(lhs);
+	}
 
-HAMON_NODISCARD inline bigint
-operator<<(bigint const& lhs, hamon::size_t pos) HAMON_NOEXCEPT
-{
-	return bigint(lhs) <<= pos;
-}
+	HAMON_NODISCARD friend basic_bigint
+	operator-(basic_bigint const& lhs, basic_bigint const& rhs) HAMON_NOEXCEPT
+	{
+		basic_bigint result(lhs, lhs.get_allocator());
+		result -= rhs;
+		return result;
+	}
 
-HAMON_NODISCARD inline bigint
-operator>>(bigint const& lhs, hamon::size_t pos) HAMON_NOEXCEPT
-{
-	return bigint(lhs) >>= pos;
-}
+	HAMON_NODISCARD friend basic_bigint
+	operator-(basic_bigint&& lhs, basic_bigint const& rhs) HAMON_NOEXCEPT
+	{
+		lhs -= rhs;
+		return hamon::move(lhs);
+	}
 
-HAMON_NODISCARD inline bool
-operator==(bigint const& lhs, bigint const& rhs) HAMON_NOEXCEPT
-{
-	return lhs.compare(rhs) == 0;
-}
+	HAMON_NODISCARD friend basic_bigint
+	operator*(basic_bigint const& lhs, basic_bigint const& rhs) HAMON_NOEXCEPT
+	{
+		basic_bigint result(lhs, lhs.get_allocator());
+		result *= rhs;
+		return result;
+	}
+
+	HAMON_NODISCARD friend basic_bigint
+	operator*(basic_bigint&& lhs, basic_bigint const& rhs) HAMON_NOEXCEPT
+	{
+		lhs *= rhs;
+		return hamon::move(lhs);
+	}
+
+	HAMON_NODISCARD friend basic_bigint
+	operator/(basic_bigint const& lhs, basic_bigint const& rhs) HAMON_NOEXCEPT
+	{
+		basic_bigint result(lhs, lhs.get_allocator());
+		result /= rhs;
+		return result;
+	}
+
+	HAMON_NODISCARD friend basic_bigint
+	operator/(basic_bigint&& lhs, basic_bigint const& rhs) HAMON_NOEXCEPT
+	{
+		lhs /= rhs;
+		return hamon::move(lhs);
+	}
+
+	HAMON_NODISCARD friend basic_bigint
+	operator%(basic_bigint const& lhs, basic_bigint const& rhs) HAMON_NOEXCEPT
+	{
+		basic_bigint result(lhs, lhs.get_allocator());
+		result %= rhs;
+		return result;
+	}
+
+	HAMON_NODISCARD friend basic_bigint
+	operator%(basic_bigint&& lhs, basic_bigint const& rhs) HAMON_NOEXCEPT
+	{
+		lhs %= rhs;
+		return hamon::move(lhs);
+	}
+
+	HAMON_NODISCARD friend basic_bigint
+	operator&(basic_bigint const& lhs, basic_bigint const& rhs) HAMON_NOEXCEPT
+	{
+		basic_bigint result(lhs, lhs.get_allocator());
+		result &= rhs;
+		return result;
+	}
+
+	HAMON_NODISCARD friend basic_bigint
+	operator&(basic_bigint&& lhs, basic_bigint const& rhs) HAMON_NOEXCEPT
+	{
+		lhs &= rhs;
+		return hamon::move(lhs);
+	}
+
+	HAMON_NODISCARD friend basic_bigint
+	operator|(basic_bigint const& lhs, basic_bigint const& rhs) HAMON_NOEXCEPT
+	{
+		basic_bigint result(lhs, lhs.get_allocator());
+		result |= rhs;
+		return result;
+	}
+
+	HAMON_NODISCARD friend basic_bigint
+	operator|(basic_bigint&& lhs, basic_bigint const& rhs) HAMON_NOEXCEPT
+	{
+		lhs |= rhs;
+		return hamon::move(lhs);
+	}
+
+	HAMON_NODISCARD friend basic_bigint
+	operator^(basic_bigint const& lhs, basic_bigint const& rhs) HAMON_NOEXCEPT
+	{
+		basic_bigint result(lhs, lhs.get_allocator());
+		result ^= rhs;
+		return result;
+	}
+
+	HAMON_NODISCARD friend basic_bigint
+	operator^(basic_bigint&& lhs, basic_bigint const& rhs) HAMON_NOEXCEPT
+	{
+		lhs ^= rhs;
+		return hamon::move(lhs);
+	}
+
+	HAMON_NODISCARD friend basic_bigint
+	operator<<(basic_bigint const& lhs, hamon::size_t pos) HAMON_NOEXCEPT
+	{
+		basic_bigint result(lhs, lhs.get_allocator());
+		result <<= pos;
+		return result;
+	}
+
+	HAMON_NODISCARD friend basic_bigint
+	operator<<(basic_bigint&& lhs, hamon::size_t pos) HAMON_NOEXCEPT
+	{
+		lhs <<= pos;
+		return hamon::move(lhs);
+	}
+
+	HAMON_NODISCARD friend basic_bigint
+	operator>>(basic_bigint const& lhs, hamon::size_t pos) HAMON_NOEXCEPT
+	{
+		basic_bigint result(lhs, lhs.get_allocator());
+		result >>= pos;
+		return result;
+	}
+
+	HAMON_NODISCARD friend basic_bigint
+	operator>>(basic_bigint&& lhs, hamon::size_t pos) HAMON_NOEXCEPT
+	{
+		lhs >>= pos;
+		return hamon::move(lhs);
+	}
+
+	HAMON_NODISCARD friend bool
+	operator==(basic_bigint const& lhs, basic_bigint const& rhs) HAMON_NOEXCEPT
+	{
+		return lhs.compare(rhs) == 0;
+	}
 
 #if defined(HAMON_HAS_CXX20_THREE_WAY_COMPARISON)
-HAMON_NODISCARD inline hamon::strong_ordering
-operator<=>(bigint const& lhs, bigint const& rhs) HAMON_NOEXCEPT
-{
-	return lhs.compare(rhs) <=> 0;
-}
+	HAMON_NODISCARD friend hamon::strong_ordering
+	operator<=>(basic_bigint const& lhs, basic_bigint const& rhs) HAMON_NOEXCEPT
+	{
+		return lhs.compare(rhs) <=> 0;
+	}
 #else
-HAMON_NODISCARD inline bool
-operator!=(bigint const& lhs, bigint const& rhs) HAMON_NOEXCEPT
-{
-	return !(lhs == rhs);
-}
+	HAMON_NODISCARD friend bool
+	operator!=(basic_bigint const& lhs, basic_bigint const& rhs) HAMON_NOEXCEPT
+	{
+		return !(lhs == rhs);
+	}
 
-HAMON_NODISCARD inline bool
-operator<(bigint const& lhs, bigint const& rhs) HAMON_NOEXCEPT
-{
-	return lhs.compare(rhs) < 0;
-}
+	HAMON_NODISCARD friend bool
+	operator<(basic_bigint const& lhs, basic_bigint const& rhs) HAMON_NOEXCEPT
+	{
+		return lhs.compare(rhs) < 0;
+	}
 
-HAMON_NODISCARD inline bool
-operator>(bigint const& lhs, bigint const& rhs) HAMON_NOEXCEPT
-{
-	return rhs < lhs;
-}
+	HAMON_NODISCARD friend bool
+	operator>(basic_bigint const& lhs, basic_bigint const& rhs) HAMON_NOEXCEPT
+	{
+		return rhs < lhs;
+	}
 
-HAMON_NODISCARD inline bool
-operator<=(bigint const& lhs, bigint const& rhs) HAMON_NOEXCEPT
-{
-	return !(lhs > rhs);
-}
+	HAMON_NODISCARD friend bool
+	operator<=(basic_bigint const& lhs, basic_bigint const& rhs) HAMON_NOEXCEPT
+	{
+		return !(lhs > rhs);
+	}
 
-HAMON_NODISCARD inline bool
-operator>=(bigint const& lhs, bigint const& rhs) HAMON_NOEXCEPT
-{
-	return !(lhs < rhs);
-}
+	HAMON_NODISCARD friend bool
+	operator>=(basic_bigint const& lhs, basic_bigint const& rhs) HAMON_NOEXCEPT
+	{
+		return !(lhs < rhs);
+	}
 #endif
+};
 
+template <typename Allocator>
 inline hamon::from_chars_result
-from_chars(char const* first, char const* last, bigint& value, int base)
+from_chars(char const* first, char const* last, basic_bigint<Allocator>& value, int base)
 {
 	value.m_sign = 1;
 	if (first != last && *first == '-')
@@ -447,8 +681,9 @@ from_chars(char const* first, char const* last, bigint& value, int base)
 	return bigint_algo::from_chars(first, last, value.m_magnitude, base);
 }
 
+template <typename Allocator>
 inline hamon::to_chars_result
-to_chars(char* first, char* last, bigint const& value, int base)
+to_chars(char* first, char* last, basic_bigint<Allocator> const& value, int base)
 {
 	if (value.m_sign < 0 && first != last)
 	{
@@ -457,8 +692,9 @@ to_chars(char* first, char* last, bigint const& value, int base)
 	return bigint_algo::to_chars(first, last, value.m_magnitude, base);
 }
 
+template <typename Allocator>
 inline hamon::string
-to_string(bigint const& value)
+to_string(basic_bigint<Allocator> const& value)
 {
 	int base = 10;
 	hamon::size_t len =
@@ -473,13 +709,169 @@ to_string(bigint const& value)
 	return result;
 }
 
-//template <typename CharT, typename Traits>
+/**
+ *	@brief	base^exp mod |mod| を返す
+ *
+ *	結果は 0 以上 |mod| 未満。
+ *	|mod| が奇数ならモンゴメリ乗算、偶数なら Barrett reduction によるスライディングウィンドウ法で計算するので、
+ *	途中の値が |mod|^2 を超えることはない。
+ *	exp が負の場合は base の逆元の -exp 乗を返す(逆元が無ければ 0)。
+ *	mod が 0 の場合は 0 を返す。
+ */
+template <typename Allocator>
+inline basic_bigint<Allocator>
+powm(basic_bigint<Allocator> const& base, basic_bigint<Allocator> const& exp, basic_bigint<Allocator> const& mod)
+{
+	using MagnitudeType = typename basic_bigint<Allocator>::MagnitudeType;
+
+	basic_bigint<Allocator> result(base.get_allocator());
+	if (bigint_algo::is_zero(mod.m_magnitude))
+	{
+		return result;
+	}
+	MagnitudeType b(base.get_allocator());
+	basic_bigint<Allocator>::nonnegative_mod(b, base, mod.m_magnitude);
+	if (exp.m_sign < 0 && !bigint_algo::modinv(b, b, mod.m_magnitude))
+	{
+		return result;
+	}
+	bigint_algo::powm(result.m_magnitude, b, exp.m_magnitude, mod.m_magnitude);
+	return result;
+}
+
+/**
+ *	@brief	|lhs| と |rhs| の最大公約数を返す
+ *
+ *	gcd(0, 0) は 0。
+ *	Lehmer の互除法で、上位ビットから求めた何ステップ分かの商をまとめて適用する。
+ */
+template <typename Allocator>
+inline basic_bigint<Allocator>
+gcd(basic_bigint<Allocator> const& lhs, basic_bigint<Allocator> const& rhs)
+{
+	basic_bigint<Allocator> result(lhs.get_allocator());
+	bigint_algo::gcd(result.m_magnitude, lhs.m_magnitude, rhs.m_magnitude);
+	return result;
+}
+
+/**
+ *	@brief	lhs * x + rhs * y == gcd(lhs, rhs) となる x, y を求める
+ *
+ *	|x| <= |rhs| / gcd、|y| <= |lhs| / gcd。
+ */
+template <typename Allocator>
+inline hamon::extended_gcd_result<basic_bigint<Allocator>>
+extended_gcd(basic_bigint<Allocator> const& lhs, basic_bigint<Allocator> const& rhs)
+{
+	auto const alloc = lhs.get_allocator();
+	hamon::extended_gcd_result<basic_bigint<Allocator>> result
+	{
+		basic_bigint<Allocator>(alloc),
+		basic_bigint<Allocator>(alloc),
+		basic_bigint<Allocator>(alloc),
+	};
+	bool const neg = bigint_algo::extended_gcd(
+		result.gcd.m_magnitude, result.x.m_magnitude, result.y.m_magnitude,
+		lhs.m_magnitude, rhs.m_magnitude);
+
+	// |lhs| * x' + |rhs| * y' == gcd で、x' と y' の符号は逆
+	result.x.m_sign = (neg != (lhs.m_sign < 0)) ? -1 : 1;
+	result.y.m_sign = (neg == (rhs.m_sign < 0)) ? -1 : 1;
+	result.x.fix_sign();
+	result.y.fix_sign();
+	return result;
+}
+
+/**
+ *	@brief	x * y ≡ 1 (mod |mod|) となる 0 以上 |mod| 未満の y を返す
+ *
+ *	逆元が無い(gcd(x, mod) != 1)場合や mod が 0 の場合は 0 を返す。
+ */
+template <typename Allocator>
+inline basic_bigint<Allocator>
+modinv(basic_bigint<Allocator> const& x, basic_bigint<Allocator> const& mod)
+{
+	using MagnitudeType = typename basic_bigint<Allocator>::MagnitudeType;
+
+	basic_bigint<Allocator> result(x.get_allocator());
+	if (bigint_algo::is_zero(mod.m_magnitude))
+	{
+		return result;
+	}
+	MagnitudeType a(x.get_allocator());
+	basic_bigint<Allocator>::nonnegative_mod(a, x, mod.m_magnitude);
+	bigint_algo::modinv(result.m_magnitude, a, mod.m_magnitude);
+	return result;
+}
+
+/**
+ *	@brief	basic_bigint 用の barrett_reducer
+ *
+ *	b^(2k) / |m| をコンストラクタで1回だけ求めておく(k は |m| の桁数)。
+ */
+template <typename Allocator>
+class barrett_reducer<basic_bigint<Allocator>>
+{
+private:
+	using bigint_type = basic_bigint<Allocator>;
+	using MagnitudeType = typename bigint_type::MagnitudeType;
+
+public:
+	explicit barrett_reducer(bigint_type const& mod)
+		: m_reducer(mod.m_magnitude)
+	{}
+
+	// |m|
+	bigint_type modulus() const
+	{
+		bigint_type result(m_reducer.modulus().get_allocator());
+		result.m_magnitude = m_reducer.modulus();
+		return result;
+	}
+
+	// x mod |m|
+	bigint_type reduce(bigint_type const& x) const
+	{
+		if (bigint_algo::is_zero(m_reducer.modulus()))
+		{
+			return x;
+		}
+		bigint_type result(x.get_allocator());
+		m_reducer.reduce(result.m_magnitude, x.m_magnitude);
+		if (x.m_sign < 0 && !bigint_algo::is_zero(result.m_magnitude))
+		{
+			bigint_algo::sub_reverse(result.m_magnitude, m_reducer.modulus());
+		}
+		return result;
+	}
+
+	// lhs * rhs mod |m|
+	bigint_type mul(bigint_type const& lhs, bigint_type const& rhs) const
+	{
+		if (bigint_algo::is_zero(m_reducer.modulus()))
+		{
+			return lhs * rhs;
+		}
+		bigint_type result(lhs.get_allocator());
+		m_reducer.mul(result.m_magnitude, lhs.m_magnitude, rhs.m_magnitude);
+		if (lhs.m_sign != rhs.m_sign && !bigint_algo::is_zero(result.m_magnitude))
+		{
+			bigint_algo::sub_reverse(result.m_magnitude, m_reducer.modulus());
+		}
+		return result;
+	}
+
+private:
+	bigint_algo::barrett_reducer<MagnitudeType>	m_reducer;
+};
+
+//template <typename CharT, typename Traits, typename Allocator>
 //inline std::basic_istream<CharT, Traits>&
-//operator>>(std::basic_istream<CharT, Traits>& is, bigint& x);
+//operator>>(std::basic_istream<CharT, Traits>& is, basic_bigint<Allocator>& x);
 
-template <typename CharT, typename Traits>
+template <typename CharT, typename Traits, typename Allocator>
 inline std::basic_ostream<CharT, Traits>&
-operator<<(std::basic_ostream<CharT, Traits>& os, bigint const& x)
+operator<<(std::basic_ostream<CharT, Traits>& os, basic_bigint<Allocator> const& x)
 {
 	return os << to_string(x);
 }
@@ -491,11 +883,11 @@ operator<<(std::basic_ostream<CharT, Traits>& os, bigint const& x)
 namespace std
 {
 
-template <>
-struct hash<hamon::bigint>
+template <typename Allocator>
+struct hash<hamon::basic_bigint<Allocator>>
 {
 	HAMON_NODISCARD
-	hamon::size_t operator()(hamon::bigint const& x) const HAMON_NOEXCEPT;
+	hamon::size_t operator()(hamon::basic_bigint<Allocator> const& x) const HAMON_NOEXCEPT;
 };
 
 }	// namespace std
@@ -11,11 +11,13 @@
 #include <hamon/bigint/bigint_algo/detail/hi.hpp>
 #include <hamon/bigint/bigint_algo/detail/lo.hpp>
 #include <hamon/bigint/bigint_algo/detail/actual_size.hpp>
+#include <hamon/bigint/bigint_algo/detail/uint128.hpp>
+#include <hamon/bigint/bigint_algo/detail/is_resizable.hpp>
 #include <hamon/array.hpp>
 #include <hamon/algorithm/max.hpp>
 #include <hamon/cstddef/size_t.hpp>
 #include <hamon/utility/make_index_sequence.hpp>
-#include <hamon/vector.hpp>
+#include <hamon/ranges/range_value_t.hpp>
 #include <hamon/config.hpp>
 
 namespace hamon
@@ -25,6 +27,7 @@ namespace bigint_algo
 
 // bigint_algo全体的な取り決め
 // * vector<T> または array<T, N> を対象
+//   (vector は resize できるコンテナであればよい。detail::is_resizable を参照)
 // * T は 符号なし整数型
 // * 数値の格納の仕方はリトルエンディアン。つまり下位の桁を前方に格納する。
 // * arrayを引数にとるものはC++14でconstexpr
@@ -77,10 +80,11 @@ add_impl(T* p1, hamon::size_t n1, T const* p2, hamon::size_t n2)
 
 }	// namespace add_detail
 
-template <typename T>
+template <typename Vector, typename = detail::enable_if_resizable_t<Vector>>
 inline bool
-add(hamon::vector<T>& lhs, hamon::vector<T> const& rhs)
+add(Vector& lhs, Vector const& rhs)
 {
+	using T = hamon::ranges::range_value_t<Vector>;
 	lhs.resize(hamon::max(lhs.size(), rhs.size()));
 	T const carry = add_detail::add_impl(
 		lhs.data(), lhs.size(), rhs.data(), rhs.size());
@@ -91,10 +95,11 @@ add(hamon::vector<T>& lhs, hamon::vector<T> const& rhs)
 	return false;
 }
 
-template <typename T>
+template <typename Vector, typename = detail::enable_if_resizable_t<Vector>>
 inline bool
-add(hamon::vector<T>& lhs, T rhs)
+add(Vector& lhs, hamon::ranges::range_value_t<Vector> rhs)
 {
+	using T = hamon::ranges::range_value_t<Vector>;
 	T const carry = add_detail::add_impl(
 		lhs.data(), lhs.size(), &rhs, 1);
 	if (carry != 0)
@@ -124,6 +129,18 @@ add(hamon::array<T, N>& lhs, T rhs)
 	return carry != 0;
 }
 
+#if defined(__SIZEOF_INT128__)
+// 128bit は __uint128_t の演算で行う
+inline HAMON_CXX14_CONSTEXPR bool
+add(hamon::array<hamon::uint64_t, 2>& lhs, hamon::array<hamon::uint64_t, 2> const& rhs)
+{
+	auto const a = detail::to_uint128(lhs);
+	auto const r = a + detail::to_uint128(rhs);
+	lhs = detail::from_uint128(r);
+	return r < a;
+}
+#endif
+
 }	// namespace bigint_algo
 }	// namespace hamon
 
@@ -0,0 +1,285 @@
+﻿/**
+ *	@file	barrett_reducer.hpp
+ *
+ *	@brief	barrett_reducer の定義
+ */
+
+#ifndef HAMON_BIGINT_BIGINT_ALGO_BARRETT_REDUCER_HPP
+#define HAMON_BIGINT_BIGINT_ALGO_BARRETT_REDUCER_HPP
+
+#include <hamon/bigint/bigint_algo/compare.hpp>
+#include <hamon/bigint/bigint_algo/div_mod.hpp>
+#include <hamon/bigint/bigint_algo/is_zero.hpp>
+#include <hamon/bigint/bigint_algo/multiply.hpp>
+#include <hamon/bigint/bigint_algo/normalize.hpp>
+#include <hamon/bigint/bigint_algo/sub.hpp>
+#include <hamon/bigint/bigint_algo/detail/actual_size.hpp>
+#include <hamon/bigint/bigint_algo/detail/is_resizable.hpp>
+#include <hamon/bigint/bigint_algo/detail/zero.hpp>
+#include <hamon/array.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/utility/move.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+namespace bigint_algo
+{
+
+namespace barrett_detail
+{
+
+// pow_b_div_mod に必要な作業領域の桁数
+inline HAMON_CXX11_CONSTEXPR hamon::size_t
+pow_b_div_mod_work_size(hamon::size_t k)
+{
+	return 5 * k + 3;
+}
+
+// q[0, k+2) = b^(2k) / m、r[0, k) = b^(2k) mod m  (b = 2^bitsof<T>()、m[k-1] != 0)
+// work は pow_b_div_mod_work_size(k) 桁の作業領域
+template <typename T>
+inline HAMON_CXX14_CONSTEXPR void
+pow_b_div_mod(T* q, T* r, T const* m, hamon::size_t k, T* work)
+{
+	hamon::size_t const nu = 2 * k + 1;
+	T* const u  = work;
+	T* const un = u + nu;
+	T* const vn = un + (nu + 1);
+	for (hamon::size_t i = 0; i < nu; ++i)
+	{
+		u[i] = 0;
+	}
+	u[nu - 1] = 1;
+
+	if (k == 1)
+	{
+		r[0] = div_mod_detail::div_mod_1(q, u, nu, m[0]);
+	}
+	else
+	{
+		div_mod_detail::div_mod_n(q, r, un, vn, u, nu, m, k);
+	}
+}
+
+// barrett_reduce に必要な作業領域の桁数
+inline HAMON_CXX11_CONSTEXPR hamon::size_t
+reduce_work_size(hamon::size_t k)
+{
+	return 4 * k + 5;
+}
+
+// r[0, k) = x[0, 2k) mod m[0, k)  (m[k-1] != 0)
+// mu[0, k+2) は pow_b_div_mod で求めた b^(2k) / m
+// work は reduce_work_size(k) 桁の作業領域。r は x と同じ領域でもよい
+//
+// Menezes et al., Handbook of Applied Cryptography, Algorithm 14.42。
+// 商を x の上位 k+1 桁と mu の積で見積もるので、除算命令を使わない。
+// 見積もった商は真の値より高々2小さいだけなので、あまりは m を高々2回引けば求まる。
+template <typename T>
+inline HAMON_CXX14_CONSTEXPR void
+barrett_reduce(T* r, T const* x, T const* m, hamon::size_t k, T const* mu, T* work)
+{
+	T* const q2 = work;					// 2k+3 桁
+	T* const r2 = q2 + (2 * k + 3);		// k+1 桁
+	T* const r1 = r2 + (k + 1);			// k+1 桁
+
+	for (hamon::size_t i = 0; i < 2 * k + 3; ++i)
+	{
+		q2[i] = 0;
+	}
+	multiply_detail::multiply_impl(q2, 2 * k + 3, x + (k - 1), k + 1, mu, k + 2);
+
+	// r = (x - q3 * m) mod b^(k+1)  (q3 = q2 / b^(k+1))
+	for (hamon::size_t i = 0; i < k + 1; ++i)
+	{
+		r2[i] = 0;
+		r1[i] = x[i];
+	}
+	multiply_detail::multiply_impl(r2, k + 1, q2 + (k + 1), k + 2, m, k);
+	sub_detail::sub_impl(r1, k + 1, r2, k + 1);
+
+	while (r1[k] != 0 || compare_detail::compare_impl(r1, m, k) >= 0)
+	{
+		sub_detail::sub_impl(r1, k + 1, m, k);
+	}
+
+	for (hamon::size_t i = 0; i < k; ++i)
+	{
+		r[i] = r1[i];
+	}
+}
+
+}	// namespace barrett_detail
+
+/**
+ *	@brief	同じ法による剰余を繰り返し求めるためのクラス
+ *
+ *	コンストラクタで b^(2k) / m を1回だけ求めておき(k は m の桁数)、
+ *	以降の剰余を乗算と減算だけで計算する(Barrett reduction)。
+ *	m が 0 の場合、reduce は x をそのまま返す。
+ */
+template <typename Vector, typename = void>
+class barrett_reducer;
+
+template <typename Vector>
+class barrett_reducer<Vector, detail::enable_if_resizable_t<Vector>>
+{
+public:
+	explicit barrett_reducer(Vector const& mod)
+		: m_mod(mod)
+		, m_mu(mod.get_allocator())
+	{
+		hamon::size_t const k = m_mod.size();
+		m_mu.resize(k + 2);
+		if (bigint_algo::is_zero(m_mod))
+		{
+			return;
+		}
+		Vector work(mod.get_allocator());
+		work.resize(k + barrett_detail::pow_b_div_mod_work_size(k));
+		barrett_detail::pow_b_div_mod(m_mu.data(), work.data(), m_mod.data(), k, work.data() + k);
+	}
+
+	Vector const& modulus() const HAMON_NOEXCEPT
+	{
+		return m_mod;
+	}
+
+	// out = x mod m
+	// out と x は同じオブジェクトでもよい
+	void reduce(Vector& out, Vector const& x) const
+	{
+		hamon::size_t const k = m_mod.size();
+		hamon::size_t const nx = x.size();
+		if (nx > 2 * k || bigint_algo::is_zero(m_mod))
+		{
+			// b^(2k) 以上の値は通常の除算で求める
+			Vector quo(m_mod.get_allocator());
+			Vector rem(m_mod.get_allocator());
+			bigint_algo::div_mod(quo, rem, x, m_mod);
+			out = hamon::move(rem);
+			return;
+		}
+
+		Vector work(m_mod.get_allocator());
+		work.resize(2 * k + barrett_detail::reduce_work_size(k));
+		for (hamon::size_t i = 0; i < nx; ++i)
+		{
+			work[i] = x[i];
+		}
+		out.resize(k);
+		barrett_detail::barrett_reduce(out.data(), work.data(),
+			m_mod.data(), k, m_mu.data(), work.data() + 2 * k);
+		bigint_algo::normalize(out);
+	}
+
+	// out = lhs * rhs mod m
+	// out と lhs, rhs は同じオブジェクトでもよい
+	void mul(Vector& out, Vector const& lhs, Vector const& rhs) const
+	{
+		Vector product(m_mod.get_allocator());
+		bigint_algo::multiply(product, lhs, rhs);
+		this->reduce(out, product);
+	}
+
+private:
+	Vector	m_mod;
+	Vector	m_mu;
+};
+
+template <typename T, hamon::size_t N>
+class barrett_reducer<hamon::array<T, N>, void>
+{
+private:
+	using array_type = hamon::array<T, N>;
+
+public:
+	explicit HAMON_CXX14_CONSTEXPR
+	barrett_reducer(array_type const& mod)
+		: m_mod(mod)
+		, m_mu{}
+		, m_k(detail::actual_size(mod))
+	{
+		if (m_k == 0)
+		{
+			return;
+		}
+		hamon::array<T, N + 5 * N + 3> work{};
+		barrett_detail::pow_b_div_mod(m_mu.data(), work.data(), m_mod.data(), m_k, work.data() + N);
+	}
+
+	HAMON_CXX11_CONSTEXPR array_type const&
+	modulus() const HAMON_NOEXCEPT
+	{
+		return m_mod;
+	}
+
+	// out = x mod m
+	// out と x は同じオブジェクトでもよい
+	HAMON_CXX14_CONSTEXPR void
+	reduce(array_type& out, array_type const& x) const
+	{
+		hamon::size_t const nx = detail::actual_size(x);
+		if (nx > 2 * m_k || m_k == 0)
+		{
+			out = bigint_algo::div_mod(x, m_mod).rem;
+			return;
+		}
+
+		hamon::array<T, 2 * N + 4 * N + 5> work{};
+		for (hamon::size_t i = 0; i < nx; ++i)
+		{
+			work[i] = x[i];
+		}
+		this->reduce_impl(out, work.data(), work.data() + 2 * m_k);
+	}
+
+	// out = lhs * rhs mod m
+	// out と lhs, rhs は同じオブジェクトでもよい
+	HAMON_CXX14_CONSTEXPR void
+	mul(array_type& out, array_type const& lhs, array_type const& rhs) const
+	{
+		if (m_k == 0)
+		{
+			array_type r{};
+			bigint_algo::multiply(r, lhs, rhs);
+			out = r;
+			return;
+		}
+
+		array_type a = lhs;
+		array_type b = rhs;
+		if (bigint_algo::compare(a, m_mod) >= 0)
+		{
+			this->reduce(a, a);
+		}
+		if (bigint_algo::compare(b, m_mod) >= 0)
+		{
+			this->reduce(b, b);
+		}
+
+		// a, b < m なので積は 2k 桁に収まる
+		hamon::array<T, 2 * N + 4 * N + 5> work{};
+		multiply_detail::multiply_impl(work.data(), 2 * m_k, a.data(), m_k, b.data(), m_k);
+		this->reduce_impl(out, work.data(), work.data() + 2 * m_k);
+	}
+
+private:
+	HAMON_CXX14_CONSTEXPR void
+	reduce_impl(array_type& out, T const* x, T* work) const
+	{
+		array_type r{};
+		barrett_detail::barrett_reduce(r.data(), x, m_mod.data(), m_k, m_mu.data(), work);
+		out = r;
+	}
+
+	array_type				m_mod;
+	hamon::array<T, N + 2>	m_mu;
+	hamon::size_t			m_k;
+};
+
+}	// namespace bigint_algo
+}	// namespace hamon
+
+#endif // HAMON_BIGINT_BIGINT_ALGO_BARRETT_REDUCER_HPP
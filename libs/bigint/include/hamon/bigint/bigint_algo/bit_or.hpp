@@ -8,10 +8,10 @@
 #define HAMON_BIGINT_BIGINT_ALGO_BIT_OR_HPP
 
 #include <hamon/bigint/bigint_algo/normalize.hpp>
+#include <hamon/bigint/bigint_algo/detail/is_resizable.hpp>
 #include <hamon/array.hpp>
 #include <hamon/algorithm/max.hpp>
 #include <hamon/cstddef/size_t.hpp>
-#include <hamon/vector.hpp>
 #include <hamon/config.hpp>
 
 namespace hamon
@@ -34,9 +34,9 @@ bit_or_impl(T* lhs, T const* rhs, hamon::size_t n)
 
 }	// namespace bit_or_detail
 
-template <typename T>
+template <typename Vector, typename = detail::enable_if_resizable_t<Vector>>
 inline void
-bit_or(hamon::vector<T>& lhs, hamon::vector<T> const& rhs)
+bit_or(Vector& lhs, Vector const& rhs)
 {
 	auto const N = hamon::max(lhs.size(), rhs.size());
 	lhs.resize(N);
@@ -10,13 +10,14 @@
 #include <hamon/bigint/bigint_algo/normalize.hpp>
 #include <hamon/bigint/bigint_algo/countl_zero.hpp>
 #include <hamon/bigint/bigint_algo/detail/actual_size.hpp>
+#include <hamon/bigint/bigint_algo/detail/is_resizable.hpp>
 #include <hamon/algorithm/min.hpp>
 #include <hamon/array.hpp>
 #include <hamon/bit/bitsof.hpp>
 #include <hamon/bit/shl.hpp>
 #include <hamon/bit/shr.hpp>
 #include <hamon/cstdint/uintmax_t.hpp>
-#include <hamon/vector.hpp>
+#include <hamon/ranges/range_value_t.hpp>
 #include <hamon/config.hpp>
 
 namespace hamon
@@ -68,10 +69,11 @@ bit_shift_left_impl(T* lhs, hamon::size_t n, hamon::uintmax_t rhs)
 
 }	// namespace bit_shift_left_detail
 
-template <typename T>
+template <typename Vector, typename = detail::enable_if_resizable_t<Vector>>
 inline bool
-bit_shift_left(hamon::vector<T>& lhs, hamon::uintmax_t rhs)
+bit_shift_left(Vector& lhs, hamon::uintmax_t rhs)
 {
+	using T = hamon::ranges::range_value_t<Vector>;
 	auto const quo = static_cast<unsigned int>(rhs / hamon::bitsof<T>());
 	hamon::size_t const N = lhs.size() + quo + 1;
 	lhs.resize(N);
@@ -8,12 +8,12 @@
 #define HAMON_BIGINT_BIGINT_ALGO_BIT_SHIFT_RIGHT_HPP
 
 #include <hamon/bigint/bigint_algo/normalize.hpp>
+#include <hamon/bigint/bigint_algo/detail/is_resizable.hpp>
 #include <hamon/array.hpp>
 #include <hamon/bit/bitsof.hpp>
 #include <hamon/bit/shl.hpp>
 #include <hamon/bit/shr.hpp>
 #include <hamon/cstdint/uintmax_t.hpp>
-#include <hamon/vector.hpp>
 #include <hamon/config.hpp>
 
 namespace hamon
@@ -65,9 +65,9 @@ bit_shift_right_impl(T* lhs, hamon::size_t n, hamon::uintmax_t rhs)
 
 }	// namespace bit_shift_right_detail
 
-template <typename T>
+template <typename Vector, typename = detail::enable_if_resizable_t<Vector>>
 inline void
-bit_shift_right(hamon::vector<T>& lhs, hamon::uintmax_t rhs)
+bit_shift_right(Vector& lhs, hamon::uintmax_t rhs)
 {
 	bit_shift_right_detail::bit_shift_right_impl(lhs.data(), lhs.size(), rhs);
 	bigint_algo::normalize(lhs);
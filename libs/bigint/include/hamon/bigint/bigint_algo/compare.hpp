@@ -7,9 +7,9 @@
 #ifndef HAMON_BIGINT_BIGINT_ALGO_COMPARE_HPP
 #define HAMON_BIGINT_BIGINT_ALGO_COMPARE_HPP
 
+#include <hamon/bigint/bigint_algo/detail/is_resizable.hpp>
 #include <hamon/array.hpp>
 #include <hamon/cstddef/size_t.hpp>
-#include <hamon/vector.hpp>
 #include <hamon/config.hpp>
 
 namespace hamon
@@ -35,9 +35,9 @@ compare_impl(T const* lhs, T const* rhs, hamon::size_t n)
 
 }	// namespace compare_detail
 
-template <typename T>
+template <typename Vector, typename = detail::enable_if_resizable_t<Vector>>
 inline int
-compare(hamon::vector<T> const& lhs, hamon::vector<T> const& rhs)
+compare(Vector const& lhs, Vector const& rhs)
 {
 	auto const NA = lhs.size();
 	auto const NB = rhs.size();
@@ -9,8 +9,13 @@
 
 #include <hamon/array.hpp>
 #include <hamon/cstdint.hpp>
+#include <hamon/type_traits/is_constant_evaluated.hpp>
 #include <hamon/config.hpp>
 
+#if defined(HAMON_MSVC) && defined(_M_X64)
+#  include <intrin.h>
+#endif
+
 namespace hamon
 {
 namespace bigint_algo
@@ -68,6 +73,23 @@ addc(T lhs, T rhs, T carry)
 	return {b, static_cast<T>(c1 + c2)};
 }
 
+#if !defined(__SIZEOF_INT128__) && defined(HAMON_MSVC) && defined(_M_X64) && \
+    defined(HAMON_HAS_CXX20_IS_CONSTANT_EVALUATED)
+// __uint128_t が無い MSVC(x64) では adc 命令を直接使う
+inline HAMON_CXX14_CONSTEXPR hamon::array<hamon::uint64_t, 2>
+addc(hamon::uint64_t lhs, hamon::uint64_t rhs, hamon::uint64_t carry)
+{
+	if (!hamon::is_constant_evaluated())
+	{
+		unsigned __int64 r = 0;
+		unsigned char const c = _addcarry_u64(
+			static_cast<unsigned char>(carry), lhs, rhs, &r);
+		return {r, c};
+	}
+	return detail::addc<hamon::uint64_t>(lhs, rhs, carry);
+}
+#endif
+
 }	// namespace detail
 }	// namespace bigint_algo
 }	// namespace hamon
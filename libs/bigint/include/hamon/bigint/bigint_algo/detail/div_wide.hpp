@@ -0,0 +1,106 @@
+﻿/**
+ *	@file	div_wide.hpp
+ *
+ *	@brief	div_wide 関数の定義
+ */
+
+#ifndef HAMON_BIGINT_BIGINT_ALGO_DETAIL_DIV_WIDE_HPP
+#define HAMON_BIGINT_BIGINT_ALGO_DETAIL_DIV_WIDE_HPP
+
+#include <hamon/bit/bitsof.hpp>
+#include <hamon/type_traits/is_constant_evaluated.hpp>
+#include <hamon/cstdint.hpp>
+#include <hamon/config.hpp>
+
+#if defined(HAMON_MSVC) && defined(_M_X64)
+#  include <intrin.h>
+#endif
+
+namespace hamon
+{
+namespace bigint_algo
+{
+namespace detail
+{
+
+// (hi * 2^bitsof<T> + lo) / d を計算して、商を返し、あまりを rem に格納する
+// hi < d であること(商が T に収まること)
+
+inline HAMON_CXX14_CONSTEXPR hamon::uint8_t
+div_wide(hamon::uint8_t hi, hamon::uint8_t lo, hamon::uint8_t d, hamon::uint8_t& rem)
+{
+	auto const n = static_cast<hamon::uint16_t>((hi << 8) | lo);
+	rem = static_cast<hamon::uint8_t>(n % d);
+	return static_cast<hamon::uint8_t>(n / d);
+}
+
+inline HAMON_CXX14_CONSTEXPR hamon::uint16_t
+div_wide(hamon::uint16_t hi, hamon::uint16_t lo, hamon::uint16_t d, hamon::uint16_t& rem)
+{
+	auto const n = (static_cast<hamon::uint32_t>(hi) << 16) | lo;
+	rem = static_cast<hamon::uint16_t>(n % d);
+	return static_cast<hamon::uint16_t>(n / d);
+}
+
+inline HAMON_CXX14_CONSTEXPR hamon::uint32_t
+div_wide(hamon::uint32_t hi, hamon::uint32_t lo, hamon::uint32_t d, hamon::uint32_t& rem)
+{
+	auto const n = (static_cast<hamon::uint64_t>(hi) << 32) | lo;
+	rem = static_cast<hamon::uint32_t>(n % d);
+	return static_cast<hamon::uint32_t>(n / d);
+}
+
+#if defined(__SIZEOF_INT128__)
+inline HAMON_CXX14_CONSTEXPR hamon::uint64_t
+div_wide(hamon::uint64_t hi, hamon::uint64_t lo, hamon::uint64_t d, hamon::uint64_t& rem)
+{
+	auto const n = (static_cast<__uint128_t>(hi) << 64) | lo;
+	rem = static_cast<hamon::uint64_t>(n % d);
+	return static_cast<hamon::uint64_t>(n / d);
+}
+#endif
+
+// 上記以外の汎用的な実装(主に__uint128_tが使えない環境向け)
+// 1bitずつ商を求める
+template <typename T>
+inline HAMON_CXX14_CONSTEXPR T
+div_wide(T hi, T lo, T d, T& rem)
+{
+	auto const w = static_cast<unsigned int>(hamon::bitsof<T>());
+	for (unsigned int i = 0; i < w; ++i)
+	{
+		bool const top = (hi >> (w - 1)) != 0;
+		hi = static_cast<T>((hi << 1) | (lo >> (w - 1)));
+		lo = static_cast<T>(lo << 1);
+		if (top || hi >= d)
+		{
+			hi = static_cast<T>(hi - d);
+			lo = static_cast<T>(lo | 1);
+		}
+	}
+	rem = hi;
+	return lo;
+}
+
+#if !defined(__SIZEOF_INT128__) && defined(HAMON_MSVC) && defined(_M_X64) && \
+    defined(HAMON_HAS_CXX20_IS_CONSTANT_EVALUATED) && (HAMON_MSVC >= 1920)
+// __uint128_t が無い MSVC(x64) では div 命令を直接使う
+inline HAMON_CXX14_CONSTEXPR hamon::uint64_t
+div_wide(hamon::uint64_t hi, hamon::uint64_t lo, hamon::uint64_t d, hamon::uint64_t& rem)
+{
+	if (!hamon::is_constant_evaluated())
+	{
+		unsigned __int64 r = 0;
+		unsigned __int64 const q = _udiv128(hi, lo, d, &r);
+		rem = r;
+		return q;
+	}
+	return detail::div_wide<hamon::uint64_t>(hi, lo, d, rem);
+}
+#endif
+
+}	// namespace detail
+}	// namespace bigint_algo
+}	// namespace hamon
+
+#endif // HAMON_BIGINT_BIGINT_ALGO_DETAIL_DIV_WIDE_HPP
@@ -0,0 +1,42 @@
+﻿/**
+ *	@file	is_resizable.hpp
+ *
+ *	@brief	is_resizable の定義
+ */
+
+#ifndef HAMON_BIGINT_BIGINT_ALGO_DETAIL_IS_RESIZABLE_HPP
+#define HAMON_BIGINT_BIGINT_ALGO_DETAIL_IS_RESIZABLE_HPP
+
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/type_traits/bool_constant.hpp>
+#include <hamon/type_traits/enable_if.hpp>
+#include <hamon/type_traits/void_t.hpp>
+#include <hamon/utility/declval.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+namespace bigint_algo
+{
+namespace detail
+{
+
+// 要素数を変えられるコンテナ(vector など)かどうか
+// bigint_algo の関数は、これが true なら可変長、false なら固定長(array)として扱う
+template <typename Vector, typename = void>
+struct is_resizable
+	: public hamon::false_type {};
+
+template <typename Vector>
+struct is_resizable<Vector, hamon::void_t<
+	decltype(hamon::declval<Vector&>().resize(hamon::declval<hamon::size_t>()))>>
+	: public hamon::true_type {};
+
+template <typename Vector>
+using enable_if_resizable_t = hamon::enable_if_t<is_resizable<Vector>::value>;
+
+}	// namespace detail
+}	// namespace bigint_algo
+}	// namespace hamon
+
+#endif // HAMON_BIGINT_BIGINT_ALGO_DETAIL_IS_RESIZABLE_HPP
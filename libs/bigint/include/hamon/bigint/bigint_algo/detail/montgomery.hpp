@@ -0,0 +1,108 @@
+﻿/**
+ *	@file	montgomery.hpp
+ *
+ *	@brief	モンゴメリ乗算の定義
+ */
+
+#ifndef HAMON_BIGINT_BIGINT_ALGO_DETAIL_MONTGOMERY_HPP
+#define HAMON_BIGINT_BIGINT_ALGO_DETAIL_MONTGOMERY_HPP
+
+#include <hamon/bigint/bigint_algo/compare.hpp>
+#include <hamon/bigint/bigint_algo/sub.hpp>
+#include <hamon/bigint/bigint_algo/detail/addc.hpp>
+#include <hamon/bigint/bigint_algo/detail/hi.hpp>
+#include <hamon/bigint/bigint_algo/detail/lo.hpp>
+#include <hamon/bigint/bigint_algo/detail/mul.hpp>
+#include <hamon/bit/bitsof.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+namespace bigint_algo
+{
+namespace detail
+{
+
+// -m0^{-1} mod 2^bitsof<T>() を返す (m0 は奇数)
+//
+// 奇数 m0 について m0 * m0 ≡ 1 (mod 8) なので x = m0 から始めて、
+// ニュートン法 x = x * (2 - m0 * x) で正しいビット数を倍々に増やす。
+template <typename T>
+inline HAMON_CXX14_CONSTEXPR T
+montgomery_inverse(T m0)
+{
+	T x = m0;
+	for (hamon::size_t bits = 3; bits < hamon::bitsof<T>(); bits *= 2)
+	{
+		x = detail::lo(detail::mul(x, static_cast<T>(T{2} - detail::lo(detail::mul(m0, x)))));
+	}
+	return static_cast<T>(T{0} - x);
+}
+
+// out[0, n) = a[0, n) * b[0, n) * R^{-1} mod m[0, n)  (R = 2^(bitsof<T>() * n))
+// a, b < m であること。m は奇数で m[n-1] != 0
+// minv は montgomery_inverse(m[0])、t は n+2 桁の作業領域
+// out は a, b と同じ領域でもよい
+//
+// CIOS (Coarsely Integrated Operand Scanning) 法。
+// b の1桁ごとに a * b[i] を足し込んでから、下位1桁が 0 になるように m の倍数を足して1桁ずらす。
+// 途中の値は常に 2m 未満なので、最後に1回だけ m を引けばよい。
+template <typename T>
+inline HAMON_CXX14_CONSTEXPR void
+montgomery_mul(T* out, T const* a, T const* b, T const* m, hamon::size_t n, T minv, T* t)
+{
+	for (hamon::size_t j = 0; j < n + 2; ++j)
+	{
+		t[j] = 0;
+	}
+
+	for (hamon::size_t i = 0; i < n; ++i)
+	{
+		// t += a * b[i]
+		T const bi = b[i];
+		T carry = 0;
+		for (hamon::size_t j = 0; j < n; ++j)
+		{
+			auto const p = detail::mul(a[j], bi);
+			auto const x = detail::addc(t[j], detail::lo(p), carry);
+			t[j] = detail::lo(x);
+			carry = static_cast<T>(detail::hi(p) + detail::hi(x));
+		}
+		auto const x1 = detail::addc(t[n], carry, T{0});
+		t[n] = detail::lo(x1);
+		t[n + 1] = detail::hi(x1);
+
+		// t = (t + u * m) / 2^bitsof<T>()
+		T const u = detail::lo(detail::mul(t[0], minv));
+		auto const p0 = detail::mul(u, m[0]);
+		carry = detail::hi(detail::addc(t[0], detail::lo(p0), T{0}));
+		carry = static_cast<T>(carry + detail::hi(p0));
+		for (hamon::size_t j = 1; j < n; ++j)
+		{
+			auto const p = detail::mul(u, m[j]);
+			auto const x = detail::addc(t[j], detail::lo(p), carry);
+			t[j - 1] = detail::lo(x);
+			carry = static_cast<T>(detail::hi(p) + detail::hi(x));
+		}
+		auto const x2 = detail::addc(t[n], carry, T{0});
+		t[n - 1] = detail::lo(x2);
+		t[n] = static_cast<T>(t[n + 1] + detail::hi(x2));
+	}
+
+	if (t[n] != 0 || compare_detail::compare_impl(t, m, n) >= 0)
+	{
+		sub_detail::sub_impl(t, n + 1, m, n);
+	}
+
+	for (hamon::size_t j = 0; j < n; ++j)
+	{
+		out[j] = t[j];
+	}
+}
+
+}	// namespace detail
+}	// namespace bigint_algo
+}	// namespace hamon
+
+#endif // HAMON_BIGINT_BIGINT_ALGO_DETAIL_MONTGOMERY_HPP
@@ -11,10 +11,16 @@
 #include <hamon/bigint/bigint_algo/bit_shift_left.hpp>
 #include <hamon/bigint/bigint_algo/detail/hi.hpp>
 #include <hamon/bigint/bigint_algo/detail/lo.hpp>
+#include <hamon/bit/bitsof.hpp>
+#include <hamon/type_traits/is_constant_evaluated.hpp>
 #include <hamon/array.hpp>
 #include <hamon/cstdint.hpp>
 #include <hamon/config.hpp>
 
+#if defined(HAMON_MSVC) && defined(_M_X64)
+#  include <intrin.h>
+#endif
+
 namespace hamon
 {
 namespace bigint_algo
@@ -68,9 +74,9 @@ mul(T lhs, T rhs)
 	auto const l  = mul(detail::lo(lhs), detail::lo(rhs));
 
 	ResultType a1{m1};
-	bigint_algo::bit_shift_left(a1, 32);
+	bigint_algo::bit_shift_left(a1, hamon::bitsof<T>() / 2);
 	ResultType a2{m2};
-	bigint_algo::bit_shift_left(a2, 32);
+	bigint_algo::bit_shift_left(a2, hamon::bitsof<T>() / 2);
 
 	ResultType result{l};
 	bigint_algo::add(result, a1);
@@ -79,6 +85,22 @@ mul(T lhs, T rhs)
 	return result;
 }
 
+#if !defined(__SIZEOF_INT128__) && defined(HAMON_MSVC) && defined(_M_X64) && \
+    defined(HAMON_HAS_CXX20_IS_CONSTANT_EVALUATED)
+// __uint128_t が無い MSVC(x64) では mul 命令を直接使う
+inline HAMON_CXX14_CONSTEXPR hamon::array<hamon::uint64_t, 2>
+mul(hamon::uint64_t lhs, hamon::uint64_t rhs)
+{
+	if (!hamon::is_constant_evaluated())
+	{
+		unsigned __int64 h = 0;
+		unsigned __int64 const l = _umul128(lhs, rhs, &h);
+		return {l, h};
+	}
+	return detail::mul<hamon::uint64_t>(lhs, rhs);
+}
+#endif
+
 }	// namespace detail
 }	// namespace bigint_algo
 }	// namespace hamon
@@ -7,11 +7,15 @@
 #ifndef HAMON_BIGINT_BIGINT_ALGO_DETAIL_SUBC_HPP
 #define HAMON_BIGINT_BIGINT_ALGO_DETAIL_SUBC_HPP
 
-#include <hamon/type_traits/make_signed.hpp>
+#include <hamon/type_traits/is_constant_evaluated.hpp>
 #include <hamon/array.hpp>
 #include <hamon/cstdint.hpp>
 #include <hamon/config.hpp>
 
+#if defined(HAMON_MSVC) && defined(_M_X64)
+#  include <intrin.h>
+#endif
+
 namespace hamon
 {
 namespace bigint_algo
@@ -62,13 +66,31 @@ template <typename T>
 inline HAMON_CXX14_CONSTEXPR hamon::array<T, 2>
 subc(T lhs, T rhs, T carry)
 {
-	T const a = static_cast<T>(rhs + static_cast<T>(static_cast<hamon::make_signed_t<T>>(carry)));
+	// carry は 0 か -1 (借りがある)
+	T const a = static_cast<T>(rhs + (carry != 0 ? 1 : 0));
 	T const b = static_cast<T>(lhs - a);
-	T const c1 = a > rhs ? T(-1) : 0;
-	T const c2 = b > lhs ? T(-1) : 0;
-	return {b, static_cast<T>(c1 + c2)};
+	bool const c1 = a < rhs;
+	bool const c2 = b > lhs;
+	return {b, (c1 || c2) ? static_cast<T>(~T{0}) : T{0}};
 }
 
+#if !defined(__SIZEOF_INT128__) && defined(HAMON_MSVC) && defined(_M_X64) && \
+    defined(HAMON_HAS_CXX20_IS_CONSTANT_EVALUATED)
+// __uint128_t が無い MSVC(x64) では sbb 命令を直接使う
+inline HAMON_CXX14_CONSTEXPR hamon::array<hamon::uint64_t, 2>
+subc(hamon::uint64_t lhs, hamon::uint64_t rhs, hamon::uint64_t carry)
+{
+	if (!hamon::is_constant_evaluated())
+	{
+		unsigned __int64 r = 0;
+		unsigned char const c = _subborrow_u64(
+			static_cast<unsigned char>(carry != 0), lhs, rhs, &r);
+		return {r, c != 0 ? ~hamon::uint64_t{0} : hamon::uint64_t{0}};
+	}
+	return detail::subc<hamon::uint64_t>(lhs, rhs, carry);
+}
+#endif
+
 }	// namespace detail
 }	// namespace bigint_algo
 }	// namespace hamon
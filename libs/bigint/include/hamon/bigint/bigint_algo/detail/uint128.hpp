@@ -0,0 +1,44 @@
+﻿/**
+ *	@file	uint128.hpp
+ *
+ *	@brief	to_uint128, from_uint128 関数の定義
+ */
+
+#ifndef HAMON_BIGINT_BIGINT_ALGO_DETAIL_UINT128_HPP
+#define HAMON_BIGINT_BIGINT_ALGO_DETAIL_UINT128_HPP
+
+#include <hamon/array.hpp>
+#include <hamon/cstdint.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+namespace bigint_algo
+{
+namespace detail
+{
+
+#if defined(__SIZEOF_INT128__)
+
+// array<uint64_t, 2> と __uint128_t の相互変換
+// 128bit の演算をネイティブの __uint128_t で行うために使う
+
+inline HAMON_CXX11_CONSTEXPR __uint128_t
+to_uint128(hamon::array<hamon::uint64_t, 2> const& x)
+{
+	return (static_cast<__uint128_t>(x[1]) << 64) | x[0];
+}
+
+inline HAMON_CXX11_CONSTEXPR hamon::array<hamon::uint64_t, 2>
+from_uint128(__uint128_t x)
+{
+	return {{static_cast<hamon::uint64_t>(x), static_cast<hamon::uint64_t>(x >> 64)}};
+}
+
+#endif
+
+}	// namespace detail
+}	// namespace bigint_algo
+}	// namespace hamon
+
+#endif // HAMON_BIGINT_BIGINT_ALGO_DETAIL_UINT128_HPP
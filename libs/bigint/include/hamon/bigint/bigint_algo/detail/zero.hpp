@@ -7,9 +7,9 @@
 #ifndef HAMON_BIGINT_BIGINT_ALGO_DETAIL_ZERO_HPP
 #define HAMON_BIGINT_BIGINT_ALGO_DETAIL_ZERO_HPP
 
+#include <hamon/bigint/bigint_algo/detail/is_resizable.hpp>
 #include <hamon/array.hpp>
 #include <hamon/cstddef/size_t.hpp>
-#include <hamon/vector.hpp>
 #include <hamon/config.hpp>
 
 namespace hamon
@@ -19,9 +19,9 @@ namespace bigint_algo
 namespace detail
 {
 
-template <typename T>
+template <typename Vector, typename = enable_if_resizable_t<Vector>>
 inline void
-zero(hamon::vector<T>& v)
+zero(Vector& v)
 {
 	v.resize(1);
 	v[0] = 0;
@@ -7,17 +7,24 @@
 #ifndef HAMON_BIGINT_BIGINT_ALGO_DIV_MOD_HPP
 #define HAMON_BIGINT_BIGINT_ALGO_DIV_MOD_HPP
 
-#include <hamon/bigint/bigint_algo/compare.hpp>
-#include <hamon/bigint/bigint_algo/bit_shift_left.hpp>
-#include <hamon/bigint/bigint_algo/bit_shift_right.hpp>
-#include <hamon/bigint/bigint_algo/sub.hpp>
-#include <hamon/bigint/bigint_algo/multiply.hpp>
-#include <hamon/bigint/bigint_algo/detail/zero.hpp>
+#include <hamon/bigint/bigint_algo/is_zero.hpp>
+#include <hamon/bigint/bigint_algo/normalize.hpp>
+#include <hamon/bigint/bigint_algo/detail/addc.hpp>
+#include <hamon/bigint/bigint_algo/detail/subc.hpp>
+#include <hamon/bigint/bigint_algo/detail/mul.hpp>
+#include <hamon/bigint/bigint_algo/detail/div_wide.hpp>
+#include <hamon/bigint/bigint_algo/detail/hi.hpp>
+#include <hamon/bigint/bigint_algo/detail/lo.hpp>
 #include <hamon/bigint/bigint_algo/detail/actual_size.hpp>
+#include <hamon/bigint/bigint_algo/detail/uint128.hpp>
+#include <hamon/bigint/bigint_algo/detail/is_resizable.hpp>
+#include <hamon/bit/bitsof.hpp>
+#include <hamon/bit/countl_zero.hpp>
 #include <hamon/bit/shl.hpp>
-#include <hamon/ranges/range_value_t.hpp>
+#include <hamon/bit/shr.hpp>
+#include <hamon/cstddef/size_t.hpp>
 #include <hamon/array.hpp>
-#include <hamon/vector.hpp>
+#include <hamon/ranges/range_value_t.hpp>
 #include <hamon/config.hpp>
 
 namespace hamon
@@ -35,107 +42,221 @@ struct div_mod_result
 namespace div_mod_detail
 {
 
-template <typename VectorType, typename T = hamon::ranges::range_value_t<VectorType>>
+// u[0, n) を1桁の d で割り、商を q[0, n) に格納して、あまりを返す
+template <typename T>
 inline HAMON_CXX14_CONSTEXPR T
-div1(VectorType const& lhs, VectorType const& rhs, VectorType& x)
+div_mod_1(T* q, T const* u, hamon::size_t n, T d)
 {
+	T r = 0;
+	for (hamon::size_t i = n; i > 0; --i)
 	{
-		auto const c = bigint_algo::compare(lhs, rhs);
+		q[i - 1] = detail::div_wide(r, u[i - 1], d, r);
+	}
+	return r;
+}
 
-		// lhs < rhs
-		if (c < 0)
-		{
-			detail::zero(x);
-			return 0;
-		}
+// u[0, nu) を v[0, nv) で割る (nu >= nv >= 2, v[nv-1] != 0)
+// 商を q[0, nu-nv+1) に、あまりを r[0, nv) に格納する
+// un は nu+1 桁、vn は nv 桁の作業領域
+//
+// Knuth, The Art of Computer Programming Vol.2, 4.3.1 Algorithm D。
+// v の最上位ビットが立つように正規化すると、上位2桁から見積もった商の桁は
+// 真の値より高々2大きいだけになるので、1桁あたり乗算と減算を1回ずつで済む。
+template <typename T>
+inline HAMON_CXX14_CONSTEXPR void
+div_mod_n(T* q, T* r, T* un, T* vn,
+	T const* u, hamon::size_t nu, T const* v, hamon::size_t nv)
+{
+	auto const w = static_cast<unsigned int>(hamon::bitsof<T>());
+	auto const s = static_cast<unsigned int>(hamon::countl_zero(v[nv - 1]));
 
-		// lhs == rhs
-		if (c == 0)
-		{
-			x = rhs;
-			return 1;
-		}
+	// 正規化
+	for (hamon::size_t i = nv - 1; i > 0; --i)
+	{
+		vn[i] = static_cast<T>(hamon::shl(v[i], s) | hamon::shr(v[i - 1], w - s));
 	}
+	vn[0] = hamon::shl(v[0], s);
 
-	// 割り算の答えをバイナリサーチで探す
-	T w = hamon::shl(T{1}, static_cast<unsigned int>(hamon::bitsof<T>() - 1));
-	T q = w;
-	for (;;)
+	un[nu] = hamon::shr(u[nu - 1], w - s);
+	for (hamon::size_t i = nu - 1; i > 0; --i)
 	{
-		w /= 2;
-		auto f = bigint_algo::multiply(x, rhs, q);
+		un[i] = static_cast<T>(hamon::shl(u[i], s) | hamon::shr(u[i - 1], w - s));
+	}
+	un[0] = hamon::shl(u[0], s);
 
-		// x と lhs を比較する。ただし、乗算の結果がオーバーフローしている場合は
-		// 必ず x > lhs。
-		auto c = f ? 1 : bigint_algo::compare(x, lhs);
+	T const v1 = vn[nv - 1];
+	T const v2 = vn[nv - 2];
 
-		if (c == 0)
-		{
-			break;
-		}
-		else if (c > 0)
+	for (hamon::size_t j = nu - nv + 1; j > 0; --j)
+	{
+		T* const uj = un + (j - 1);
+
+		// 商の桁を上位2桁から見積もる
+		T qhat = 0;
+		T rhat = 0;
+		bool rhat_overflow = false;
+		if (uj[nv] >= v1)
 		{
-			q = static_cast<T>(q - w);
+			qhat = static_cast<T>(~T{0});
+			auto const x = detail::addc(uj[nv - 1], v1, T{0});
+			rhat = detail::lo(x);
+			rhat_overflow = detail::hi(x) != 0;
 		}
 		else
 		{
-			q = static_cast<T>(q + w);
+			qhat = detail::div_wide(uj[nv], uj[nv - 1], v1, rhat);
 		}
 
-		if (w == 0)
+		while (!rhat_overflow)
 		{
-			if (c > 0)
+			auto const p = detail::mul(qhat, v2);
+			if (detail::hi(p) < rhat || (detail::hi(p) == rhat && detail::lo(p) <= uj[nv - 2]))
 			{
-				q = static_cast<T>(q - 1);
+				break;
 			}
-			else
+			--qhat;
+			auto const x = detail::addc(rhat, v1, T{0});
+			rhat = detail::lo(x);
+			rhat_overflow = detail::hi(x) != 0;
+		}
+
+		// uj -= qhat * vn
+		T k = 0;
+		T borrow = 0;
+		for (hamon::size_t i = 0; i < nv; ++i)
+		{
+			auto const p = detail::mul(qhat, vn[i]);
+			auto const x = detail::addc(detail::lo(p), k, T{0});
+			k = static_cast<T>(detail::hi(p) + detail::hi(x));
+			auto const y = detail::subc(uj[i], detail::lo(x), borrow);
+			uj[i] = detail::lo(y);
+			borrow = detail::hi(y);
+		}
+		auto const y = detail::subc(uj[nv], k, borrow);
+		uj[nv] = detail::lo(y);
+
+		// 引きすぎた場合(確率はおよそ 2/2^bitsof<T>)は1回だけ足し戻す
+		if (detail::hi(y) != 0)
+		{
+			--qhat;
+			T carry = 0;
+			for (hamon::size_t i = 0; i < nv; ++i)
 			{
-				break;
+				auto const x = detail::addc(uj[i], vn[i], carry);
+				uj[i] = detail::lo(x);
+				carry = detail::hi(x);
 			}
+			uj[nv] = static_cast<T>(uj[nv] + carry);
 		}
+
+		q[j - 1] = qhat;
 	}
-	return q;
+
+	// 正規化を戻す(r と un は同じ領域でもよい)
+	for (hamon::size_t i = 0; i + 1 < nv; ++i)
+	{
+		r[i] = static_cast<T>(hamon::shr(un[i], s) | hamon::shl(un[i + 1], w - s));
+	}
+	r[nv - 1] = hamon::shr(un[nv - 1], s);
 }
 
-template <typename T, typename VectorType>
-inline HAMON_CXX14_CONSTEXPR div_mod_result<VectorType>
-div_mod_impl(T const* lhs, hamon::size_t n, VectorType const& rhs)
+}	// namespace div_mod_detail
+
+// rhs が 0 の場合の動作は未規定
+
+// 商を quo に、あまりを rem に格納する
+// quo と rem の領域を再利用するので、繰り返し除算を行う場合はメモリ確保を避けられる
+// quo, rem と lhs, rhs が同じオブジェクトの場合の動作は未規定
+template <typename Vector, typename = detail::enable_if_resizable_t<Vector>>
+inline void
+div_mod(Vector& quo, Vector& rem, Vector const& lhs, Vector const& rhs)
 {
-	div_mod_result<VectorType> result
-	{
-		{0},
-		{0},
-	};
-	VectorType tmp{0};
-	for (hamon::size_t i = n; i > 0; --i)
-	{
-		bigint_algo::bit_shift_left(result.rem, hamon::bitsof<T>());
-		result.rem[0] = lhs[i-1];
+	using T = hamon::ranges::range_value_t<Vector>;
 
-		auto const q = div1(result.rem, rhs, tmp);
-		bigint_algo::bit_shift_left(result.quo, hamon::bitsof<T>());
-		result.quo[0] = q;
+	hamon::size_t const n1 = lhs.size();
+	hamon::size_t const n2 = rhs.size();
 
-		bigint_algo::sub(result.rem, tmp);
+	if (n1 < n2 || bigint_algo::is_zero(rhs))
+	{
+		quo.resize(1);
+		quo[0] = 0;
+		rem = lhs;
+		return;
 	}
-	return result;
-}
 
-}	// namespace div_mod_detail
+	quo.resize(n1 - n2 + 1);
+	if (n2 == 1)
+	{
+		T const r = div_mod_detail::div_mod_1(quo.data(), lhs.data(), n1, rhs[0]);
+		rem.resize(1);
+		rem[0] = r;
+	}
+	else
+	{
+		// 正規化した被除数の作業領域には rem を使う
+		rem.resize(n1 + 1);
+		Vector vn(lhs.get_allocator());
+		vn.resize(n2);
+		div_mod_detail::div_mod_n(
+			quo.data(), rem.data(), rem.data(), vn.data(),
+			lhs.data(), n1, rhs.data(), n2);
+		rem.resize(n2);
+		bigint_algo::normalize(rem);
+	}
+	bigint_algo::normalize(quo);
+}
 
-template <typename T>
-inline div_mod_result<hamon::vector<T>>
-div_mod(hamon::vector<T> const& lhs, hamon::vector<T> const& rhs)
+template <typename Vector, typename = detail::enable_if_resizable_t<Vector>>
+inline div_mod_result<Vector>
+div_mod(Vector const& lhs, Vector const& rhs)
 {
-	return div_mod_detail::div_mod_impl(lhs.data(), lhs.size(), rhs);
+	div_mod_result<Vector> result{Vector(lhs.get_allocator()), Vector(lhs.get_allocator())};
+	bigint_algo::div_mod(result.quo, result.rem, lhs, rhs);
+	return result;
 }
 
 template <typename T, hamon::size_t N>
 inline HAMON_CXX14_CONSTEXPR div_mod_result<hamon::array<T, N>>
 div_mod(hamon::array<T, N> const& lhs, hamon::array<T, N> const& rhs)
 {
-	return div_mod_detail::div_mod_impl(lhs.data(), detail::actual_size(lhs), rhs);
+	hamon::size_t const n1 = detail::actual_size(lhs);
+	hamon::size_t const n2 = detail::actual_size(rhs);
+
+	if (n1 < n2 || n2 == 0)
+	{
+		return {{}, lhs};
+	}
+
+	div_mod_result<hamon::array<T, N>> result{{}, {}};
+	if (n2 == 1)
+	{
+		result.rem[0] = div_mod_detail::div_mod_1(result.quo.data(), lhs.data(), n1, rhs[0]);
+	}
+	else
+	{
+		hamon::array<T, N + 1> un{};
+		hamon::array<T, N> vn{};
+		div_mod_detail::div_mod_n(
+			result.quo.data(), result.rem.data(), un.data(), vn.data(),
+			lhs.data(), n1, rhs.data(), n2);
+	}
+	return result;
+}
+
+#if defined(__SIZEOF_INT128__)
+// 128bit は __uint128_t の演算で行う
+inline HAMON_CXX14_CONSTEXPR div_mod_result<hamon::array<hamon::uint64_t, 2>>
+div_mod(hamon::array<hamon::uint64_t, 2> const& lhs, hamon::array<hamon::uint64_t, 2> const& rhs)
+{
+	auto const b = detail::to_uint128(rhs);
+	if (b == 0)
+	{
+		return {{}, lhs};
+	}
+	auto const a = detail::to_uint128(lhs);
+	return {detail::from_uint128(a / b), detail::from_uint128(a % b)};
 }
+#endif
 
 }	// namespace bigint_algo
 }	// namespace hamon
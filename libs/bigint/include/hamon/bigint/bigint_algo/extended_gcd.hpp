@@ -0,0 +1,88 @@
+﻿/**
+ *	@file	extended_gcd.hpp
+ *
+ *	@brief	extended_gcd 関数の定義
+ */
+
+#ifndef HAMON_BIGINT_BIGINT_ALGO_EXTENDED_GCD_HPP
+#define HAMON_BIGINT_BIGINT_ALGO_EXTENDED_GCD_HPP
+
+#include <hamon/bigint/bigint_algo/gcd.hpp>
+#include <hamon/bigint/bigint_algo/normalize.hpp>
+#include <hamon/bigint/bigint_algo/detail/actual_size.hpp>
+#include <hamon/bigint/bigint_algo/detail/is_resizable.hpp>
+#include <hamon/algorithm/max.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/array.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+namespace bigint_algo
+{
+
+// g = gcd(lhs, rhs) と、lhs * x' + rhs * y' = g を満たす x', y' の絶対値 x, y を求める
+// x' と y' は、どちらかが 0 の場合を除いて符号が逆になる。
+// 戻り値は x' が負かどうか
+// |x'| <= rhs / g、|y'| <= lhs / g
+// g, x, y と lhs, rhs は同じオブジェクトでもよい
+
+template <typename Vector, typename = detail::enable_if_resizable_t<Vector>>
+inline bool
+extended_gcd(Vector& g, Vector& x, Vector& y, Vector const& lhs, Vector const& rhs)
+{
+	hamon::size_t const n = hamon::max(lhs.size(), rhs.size());
+	Vector work(lhs.get_allocator());
+	work.resize(3 * n + gcd_detail::gcd_work_size(n));
+	auto const p = work.data();
+	bool const result = gcd_detail::gcd_impl(p, p + n, p + 2 * n,
+		lhs.data(), lhs.size(), rhs.data(), rhs.size(), n, p + 3 * n);
+	g.resize(n);
+	x.resize(n);
+	y.resize(n);
+	for (hamon::size_t i = 0; i < n; ++i)
+	{
+		g[i] = p[i];
+		x[i] = p[n + i];
+		y[i] = p[2 * n + i];
+	}
+	bigint_algo::normalize(g);
+	bigint_algo::normalize(x);
+	bigint_algo::normalize(y);
+	return result;
+}
+
+template <typename T, hamon::size_t N>
+inline HAMON_CXX14_CONSTEXPR bool
+extended_gcd(
+	hamon::array<T, N>& g,
+	hamon::array<T, N>& x,
+	hamon::array<T, N>& y,
+	hamon::array<T, N> const& lhs,
+	hamon::array<T, N> const& rhs)
+{
+	hamon::size_t const n = hamon::max(detail::actual_size(lhs), detail::actual_size(rhs));
+	hamon::array<T, N> rg{};
+	hamon::array<T, N> rx{};
+	hamon::array<T, N> ry{};
+	bool result = false;
+	if (n == 0)
+	{
+		rx[0] = 1;
+	}
+	else
+	{
+		hamon::array<T, gcd_detail::gcd_work_size(N)> work{};
+		result = gcd_detail::gcd_impl(rg.data(), rx.data(), ry.data(),
+			lhs.data(), n, rhs.data(), n, n, work.data());
+	}
+	g = rg;
+	x = rx;
+	y = ry;
+	return result;
+}
+
+}	// namespace bigint_algo
+}	// namespace hamon
+
+#endif // HAMON_BIGINT_BIGINT_ALGO_EXTENDED_GCD_HPP
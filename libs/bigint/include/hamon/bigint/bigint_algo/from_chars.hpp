@@ -11,6 +11,7 @@
 #include <hamon/bigint/bigint_algo/multiply.hpp>
 #include <hamon/bigint/bigint_algo/compare.hpp>
 #include <hamon/bigint/bigint_algo/pow_n.hpp>
+#include <hamon/bigint/bigint_algo/detail/is_resizable.hpp>
 #include <hamon/algorithm/min.hpp>
 #include <hamon/charconv/from_chars.hpp>
 #include <hamon/cmath/log2.hpp>
@@ -21,7 +22,6 @@
 #include <hamon/system_error/errc.hpp>
 #include <hamon/utility/move.hpp>
 #include <hamon/limits.hpp>
-#include <hamon/vector.hpp>
 #include <hamon/config.hpp>
 
 namespace hamon
@@ -101,9 +101,9 @@ from_chars(char const* first, char const* last, VectorType& value, int base)
 
 }	// namespace from_chars_detail
 
-template <typename T>
+template <typename Vector, typename = detail::enable_if_resizable_t<Vector>>
 inline hamon::from_chars_result
-from_chars(char const* first, char const* last, hamon::vector<T>& value, int base = 10)
+from_chars(char const* first, char const* last, Vector& value, int base = 10)
 {
 	return from_chars_detail::from_chars(first, last, value, base);
 }
@@ -8,6 +8,7 @@
 #define HAMON_BIGINT_BIGINT_ALGO_FROM_UINT_HPP
 
 #include <hamon/bigint/bigint_algo/normalize.hpp>
+#include <hamon/bigint/bigint_algo/detail/is_resizable.hpp>
 #include <hamon/array.hpp>
 #include <hamon/bit/bitsof.hpp>
 #include <hamon/bit/shr.hpp>
@@ -15,7 +16,7 @@
 #include <hamon/system_error/errc.hpp>
 #include <hamon/type_traits/enable_if.hpp>
 #include <hamon/type_traits/is_unsigned.hpp>
-#include <hamon/vector.hpp>
+#include <hamon/ranges/range_value_t.hpp>
 #include <hamon/config.hpp>
 
 namespace hamon
@@ -51,12 +52,14 @@ from_uint(UInt n, T* dst, hamon::size_t size)
 
 }	// namespace from_uint_detail
 
-template <typename UInt, typename T,
-	typename = hamon::enable_if_t<hamon::is_unsigned<UInt>::value>
+template <typename UInt, typename Vector,
+	typename = hamon::enable_if_t<hamon::is_unsigned<UInt>::value>,
+	typename = detail::enable_if_resizable_t<Vector>
 >
 inline from_uint_result
-from_uint(UInt n, hamon::vector<T>& value)
+from_uint(UInt n, Vector& value)
 {
+	using T = hamon::ranges::range_value_t<Vector>;
 	value.resize(sizeof(UInt) > sizeof(T) ? sizeof(UInt) / sizeof(T) : 1);
 	auto ret = from_uint_detail::from_uint(n, value.data(), value.size());
 	bigint_algo::normalize(value);
@@ -0,0 +1,429 @@
+﻿/**
+ *	@file	gcd.hpp
+ *
+ *	@brief	gcd 関数の定義
+ */
+
+#ifndef HAMON_BIGINT_BIGINT_ALGO_GCD_HPP
+#define HAMON_BIGINT_BIGINT_ALGO_GCD_HPP
+
+#include <hamon/bigint/bigint_algo/compare.hpp>
+#include <hamon/bigint/bigint_algo/div_mod.hpp>
+#include <hamon/bigint/bigint_algo/normalize.hpp>
+#include <hamon/bigint/bigint_algo/detail/addc.hpp>
+#include <hamon/bigint/bigint_algo/detail/subc.hpp>
+#include <hamon/bigint/bigint_algo/detail/mul.hpp>
+#include <hamon/bigint/bigint_algo/detail/hi.hpp>
+#include <hamon/bigint/bigint_algo/detail/lo.hpp>
+#include <hamon/bigint/bigint_algo/detail/actual_size.hpp>
+#include <hamon/bigint/bigint_algo/detail/is_resizable.hpp>
+#include <hamon/algorithm/max.hpp>
+#include <hamon/algorithm/min.hpp>
+#include <hamon/bit/bitsof.hpp>
+#include <hamon/bit/countl_zero.hpp>
+#include <hamon/bit/shr.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/cstdint/intmax_t.hpp>
+#include <hamon/cstdint/uintmax_t.hpp>
+#include <hamon/ranges/range_value_t.hpp>
+#include <hamon/array.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+namespace bigint_algo
+{
+
+namespace gcd_detail
+{
+
+// 互除法の連続した何ステップかをまとめた行列
+// (u, v) -> (a * u + b * v, c * u + d * v)
+struct lehmer_matrix
+{
+	hamon::intmax_t	a;
+	hamon::intmax_t	b;
+	hamon::intmax_t	c;
+	hamon::intmax_t	d;
+	hamon::size_t	steps;
+};
+
+// 上位何ビットを使って商を見積もるか
+// 行列の要素が1桁に収まり、途中の計算が intmax_t であふれないようにする
+template <typename T>
+inline HAMON_CXX11_CONSTEXPR hamon::size_t
+lehmer_bits()
+{
+	return hamon::min(hamon::bitsof<T>(), hamon::size_t{62}) - 2;
+}
+
+// x[0, n) の pos ビット目から len ビットを取り出す (len < bitsof<T>())
+template <typename T>
+inline HAMON_CXX14_CONSTEXPR hamon::intmax_t
+extract_bits(T const* x, hamon::size_t n, hamon::size_t pos, hamon::size_t len)
+{
+	auto const w = hamon::bitsof<T>();
+	hamon::size_t const i = pos / w;
+	auto const s = static_cast<unsigned int>(pos % w);
+	auto v = static_cast<hamon::uintmax_t>(hamon::shr(x[i], s));
+	if (s != 0 && i + 1 < n)
+	{
+		v |= static_cast<hamon::uintmax_t>(x[i + 1]) << (w - s);
+	}
+	return static_cast<hamon::intmax_t>(v & ((hamon::uintmax_t{1} << len) - 1));
+}
+
+// u[0, n) >= v[0, n) (u[n-1] != 0, n >= 2) の上位ビットだけを使って互除法を進め、
+// 商が確定したステップをまとめた行列を返す
+//
+// Knuth, The Art of Computer Programming Vol.2, 4.5.2 Algorithm L。
+// 上位ビットの商の上限と下限が一致する間は、それが本当の商と等しい。
+// 1回の多倍長演算で lehmer_bits<T>() ビット程度ずつ進むので、
+// 商ごとに多倍長の除算を行うよりずっと速い。
+template <typename T>
+inline HAMON_CXX14_CONSTEXPR lehmer_matrix
+lehmer_step(T const* u, T const* v, hamon::size_t n)
+{
+	hamon::size_t const p = lehmer_bits<T>();
+	hamon::size_t const h = n * hamon::bitsof<T>() -
+		static_cast<hamon::size_t>(hamon::countl_zero(u[n - 1]));
+	hamon::intmax_t uh = extract_bits(u, n, h - p, p);
+	hamon::intmax_t vh = extract_bits(v, n, h - p, p);
+
+	lehmer_matrix r{1, 0, 0, 1, 0};
+	for (;;)
+	{
+		hamon::intmax_t const d1 = vh + r.c;
+		hamon::intmax_t const d2 = vh + r.d;
+		if (d1 <= 0 || d2 <= 0 || uh + r.a < 0 || uh + r.b < 0)
+		{
+			break;
+		}
+
+		hamon::intmax_t const q = (uh + r.a) / d1;
+		if (q != (uh + r.b) / d2)
+		{
+			break;
+		}
+
+		hamon::intmax_t t = r.a - q * r.c;
+		r.a = r.c;
+		r.c = t;
+		t = r.b - q * r.d;
+		r.b = r.d;
+		r.d = t;
+		t = uh - q * vh;
+		uh = vh;
+		vh = t;
+		++r.steps;
+	}
+	return r;
+}
+
+// out[0, n) = x * p[0, n) - y * q[0, n)  (結果は 0 以上で n 桁に収まること)
+template <typename T>
+inline HAMON_CXX14_CONSTEXPR void
+mul_sub(T* out, T x, T const* p, T y, T const* q, hamon::size_t n)
+{
+	T c1 = 0;
+	T c2 = 0;
+	T borrow = 0;
+	for (hamon::size_t i = 0; i < n; ++i)
+	{
+		auto const s = detail::mul(p[i], x);
+		auto const s2 = detail::addc(detail::lo(s), c1, T{0});
+		c1 = static_cast<T>(detail::hi(s) + detail::hi(s2));
+		auto const t = detail::mul(q[i], y);
+		auto const t2 = detail::addc(detail::lo(t), c2, T{0});
+		c2 = static_cast<T>(detail::hi(t) + detail::hi(t2));
+		auto const d = detail::subc(detail::lo(s2), detail::lo(t2), borrow);
+		out[i] = detail::lo(d);
+		borrow = detail::hi(d);
+	}
+}
+
+// out[0, n) = x * p[0, n) + y * q[0, n)  (結果は n 桁に収まること)
+template <typename T>
+inline HAMON_CXX14_CONSTEXPR void
+mul_add(T* out, T x, T const* p, T y, T const* q, hamon::size_t n)
+{
+	T c1 = 0;
+	T c2 = 0;
+	for (hamon::size_t i = 0; i < n; ++i)
+	{
+		auto const s = detail::mul(p[i], x);
+		auto const s2 = detail::addc(detail::lo(s), c1, T{0});
+		c1 = static_cast<T>(detail::hi(s) + detail::hi(s2));
+		auto const t = detail::mul(q[i], y);
+		auto const t2 = detail::addc(detail::lo(s2), detail::lo(t), c2);
+		out[i] = detail::lo(t2);
+		c2 = static_cast<T>(detail::hi(t) + detail::hi(t2));
+	}
+}
+
+// out[0, n) = p[0, n) + q[0, nq) * r[0, n)  (結果は n 桁に収まること)
+template <typename T>
+inline HAMON_CXX14_CONSTEXPR void
+add_mul(T* out, T const* p, T const* q, hamon::size_t nq, T const* r, hamon::size_t n)
+{
+	for (hamon::size_t i = 0; i < n; ++i)
+	{
+		out[i] = p[i];
+	}
+	for (hamon::size_t i = 0; i < nq && i < n; ++i)
+	{
+		T const b = q[i];
+		if (b == 0)
+		{
+			continue;
+		}
+		T carry = 0;
+		for (hamon::size_t j = 0; i + j < n; ++j)
+		{
+			auto const t = detail::mul(r[j], b);
+			auto const x = detail::addc(out[i + j], detail::lo(t), carry);
+			out[i + j] = detail::lo(x);
+			carry = static_cast<T>(detail::hi(t) + detail::hi(x));
+		}
+	}
+}
+
+template <typename T>
+inline HAMON_CXX14_CONSTEXPR void
+swap_ptr(T*& a, T*& b)
+{
+	T* t = a;
+	a = b;
+	b = t;
+}
+
+template <typename T>
+inline HAMON_CXX14_CONSTEXPR void
+rotate_ptr(T*& a, T*& b, T*& c)
+{
+	T* t = a;
+	a = b;
+	b = c;
+	c = t;
+}
+
+// gcd_impl に必要な作業領域の桁数
+inline HAMON_CXX11_CONSTEXPR hamon::size_t
+gcd_work_size(hamon::size_t n)
+{
+	return 15 * n + 2;
+}
+
+// g[0, n) = gcd(a[0, na), b[0, nb))  (na, nb <= n)
+//
+// x (y) が nullptr でなければ、a * x' + b * y' = g を満たす x' (y') の絶対値を x[0, n) (y[0, n)) に格納する。
+// x' と y' は、どちらかが 0 の場合を除いて符号が逆になる。
+// 戻り値は x' が負かどうか(y' が負なのは戻り値が false で y' != 0 のとき)
+// work は gcd_work_size(n) 桁の作業領域
+//
+// 互除法の各ステップの商は、a と b の上位ビットだけでほとんど決まるので、
+// lehmer_step でまとめて求めた行列を多倍長の値に一度に掛ける。
+// 商が確定しないときだけ、多倍長の除算を1回行う。
+// x', y' も同じ行列で更新する。互除法の係数は1ステップごとに符号が反転するので、
+// 絶対値だけを持てば行列の積は加算だけで済む。
+template <typename T>
+inline HAMON_CXX14_CONSTEXPR bool
+gcd_impl(T* g, T* x, T* y,
+	T const* a, hamon::size_t na,
+	T const* b, hamon::size_t nb,
+	hamon::size_t n, T* work)
+{
+	T* u   = work;
+	T* v   = u + n;
+	T* s1  = v + n;
+	T* s2  = s1 + n;
+	T* x0  = s2 + n;
+	T* x1  = x0 + n;
+	T* xs1 = x1 + n;
+	T* xs2 = xs1 + n;
+	T* y0  = xs2 + n;
+	T* y1  = y0 + n;
+	T* ys1 = y1 + n;
+	T* ys2 = ys1 + n;
+	T* const q  = ys2 + n;			// n+1 桁
+	T* const un = q + (n + 1);		// n+1 桁
+	T* const vn = un + (n + 1);		// n 桁
+
+	for (hamon::size_t i = 0; i < n; ++i)
+	{
+		u[i] = i < na ? a[i] : T{0};
+		v[i] = i < nb ? b[i] : T{0};
+		x0[i] = 0;
+		x1[i] = 0;
+		y0[i] = 0;
+		y1[i] = 0;
+	}
+	x0[0] = 1;
+	y1[0] = 1;
+
+	// u = x0 * a + y0 * b, v = x1 * a + y1 * b
+	// x0 の符号は odd なら負、x1 は x0 と逆。y0 は x0 と逆、y1 は y0 と逆
+	bool odd = false;
+	hamon::size_t nu = detail::actual_size_impl(u, n);
+	hamon::size_t nv = detail::actual_size_impl(v, n);
+	if (compare_detail::compare_impl(u, v, n) < 0)
+	{
+		swap_ptr(u, v);
+		swap_ptr(x0, x1);
+		swap_ptr(y0, y1);
+		odd = !odd;
+		hamon::size_t const t = nu;
+		nu = nv;
+		nv = t;
+	}
+
+	while (nv != 0)
+	{
+		lehmer_matrix mat{1, 0, 0, 1, 0};
+		if (nv >= 2)
+		{
+			mat = lehmer_step(u, v, nu);
+		}
+
+		if (mat.steps == 0)
+		{
+			// (u, v) = (v, u mod v)
+			for (hamon::size_t i = 0; i < n; ++i)
+			{
+				s1[i] = 0;
+			}
+			hamon::size_t nq = 0;
+			if (nv == 1)
+			{
+				s1[0] = div_mod_detail::div_mod_1(q, u, nu, v[0]);
+				nq = nu;
+			}
+			else
+			{
+				div_mod_detail::div_mod_n(q, s1, un, vn, u, nu, v, nv);
+				nq = nu - nv + 1;
+			}
+			rotate_ptr(u, v, s1);
+
+			// (x0, x1) = (x1, x0 + q * x1)
+			if (x != nullptr)
+			{
+				add_mul(xs1, x0, q, nq, x1, n);
+				rotate_ptr(x0, x1, xs1);
+			}
+			if (y != nullptr)
+			{
+				add_mul(ys1, y0, q, nq, y1, n);
+				rotate_ptr(y0, y1, ys1);
+			}
+			odd = !odd;
+		}
+		else
+		{
+			// ステップ数が偶数なら a, d >= 0 かつ b, c <= 0、奇数ならその逆
+			bool const pos = mat.steps % 2 == 0;
+			auto const ma = static_cast<T>(pos ?  mat.a : -mat.a);
+			auto const mb = static_cast<T>(pos ? -mat.b :  mat.b);
+			auto const mc = static_cast<T>(pos ? -mat.c :  mat.c);
+			auto const md = static_cast<T>(pos ?  mat.d : -mat.d);
+			if (pos)
+			{
+				mul_sub(s1, ma, u, mb, v, nu);
+				mul_sub(s2, md, v, mc, u, nu);
+			}
+			else
+			{
+				mul_sub(s1, mb, v, ma, u, nu);
+				mul_sub(s2, mc, u, md, v, nu);
+			}
+			for (hamon::size_t i = nu; i < n; ++i)
+			{
+				s1[i] = 0;
+				s2[i] = 0;
+			}
+			swap_ptr(u, s1);
+			swap_ptr(v, s2);
+
+			if (x != nullptr)
+			{
+				mul_add(xs1, ma, x0, mb, x1, n);
+				mul_add(xs2, mc, x0, md, x1, n);
+				swap_ptr(x0, xs1);
+				swap_ptr(x1, xs2);
+			}
+			if (y != nullptr)
+			{
+				mul_add(ys1, ma, y0, mb, y1, n);
+				mul_add(ys2, mc, y0, md, y1, n);
+				swap_ptr(y0, ys1);
+				swap_ptr(y1, ys2);
+			}
+			if (mat.steps % 2 != 0)
+			{
+				odd = !odd;
+			}
+		}
+
+		nu = detail::actual_size_impl(u, nu);
+		nv = detail::actual_size_impl(v, nu);
+	}
+
+	for (hamon::size_t i = 0; i < n; ++i)
+	{
+		g[i] = u[i];
+		if (x != nullptr)
+		{
+			x[i] = x0[i];
+		}
+		if (y != nullptr)
+		{
+			y[i] = y0[i];
+		}
+	}
+	return odd;
+}
+
+}	// namespace gcd_detail
+
+// out = gcd(lhs, rhs)
+// gcd(0, 0) は 0
+// out と lhs, rhs は同じオブジェクトでもよい
+
+template <typename Vector, typename = detail::enable_if_resizable_t<Vector>>
+inline void
+gcd(Vector& out, Vector const& lhs, Vector const& rhs)
+{
+	using T = hamon::ranges::range_value_t<Vector>;
+
+	hamon::size_t const n = hamon::max(lhs.size(), rhs.size());
+	Vector work(lhs.get_allocator());
+	work.resize(n + gcd_detail::gcd_work_size(n));
+	gcd_detail::gcd_impl(work.data(), static_cast<T*>(nullptr), static_cast<T*>(nullptr),
+		lhs.data(), lhs.size(), rhs.data(), rhs.size(), n, work.data() + n);
+	out.resize(n);
+	for (hamon::size_t i = 0; i < n; ++i)
+	{
+		out[i] = work[i];
+	}
+	bigint_algo::normalize(out);
+}
+
+template <typename T, hamon::size_t N>
+inline HAMON_CXX14_CONSTEXPR void
+gcd(hamon::array<T, N>& out, hamon::array<T, N> const& lhs, hamon::array<T, N> const& rhs)
+{
+	hamon::size_t const n = hamon::max(detail::actual_size(lhs), detail::actual_size(rhs));
+	hamon::array<T, N> g{};
+	if (n != 0)
+	{
+		hamon::array<T, gcd_detail::gcd_work_size(N)> work{};
+		gcd_detail::gcd_impl(g.data(), static_cast<T*>(nullptr), static_cast<T*>(nullptr),
+			lhs.data(), n, rhs.data(), n, n, work.data());
+	}
+	out = g;
+}
+
+}	// namespace bigint_algo
+}	// namespace hamon
+
+#endif // HAMON_BIGINT_BIGINT_ALGO_GCD_HPP
@@ -7,9 +7,9 @@
 #ifndef HAMON_BIGINT_BIGINT_ALGO_IS_ZERO_HPP
 #define HAMON_BIGINT_BIGINT_ALGO_IS_ZERO_HPP
 
+#include <hamon/bigint/bigint_algo/detail/is_resizable.hpp>
 #include <hamon/array.hpp>
 #include <hamon/cstddef/size_t.hpp>
-#include <hamon/vector.hpp>
 #include <hamon/config.hpp>
 
 namespace hamon
@@ -17,9 +17,9 @@ namespace hamon
 namespace bigint_algo
 {
 
-template <typename T>
+template <typename Vector, typename = detail::enable_if_resizable_t<Vector>>
 inline bool
-is_zero(hamon::vector<T> const& vec)
+is_zero(Vector const& vec)
 {
 	return vec.size() == 1 && vec[0] == 0;
 }
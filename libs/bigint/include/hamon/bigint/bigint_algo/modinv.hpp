@@ -0,0 +1,103 @@
+﻿/**
+ *	@file	modinv.hpp
+ *
+ *	@brief	modinv 関数の定義
+ */
+
+#ifndef HAMON_BIGINT_BIGINT_ALGO_MODINV_HPP
+#define HAMON_BIGINT_BIGINT_ALGO_MODINV_HPP
+
+#include <hamon/bigint/bigint_algo/gcd.hpp>
+#include <hamon/bigint/bigint_algo/div_mod.hpp>
+#include <hamon/bigint/bigint_algo/normalize.hpp>
+#include <hamon/bigint/bigint_algo/sub.hpp>
+#include <hamon/bigint/bigint_algo/detail/actual_size.hpp>
+#include <hamon/bigint/bigint_algo/detail/is_resizable.hpp>
+#include <hamon/bigint/bigint_algo/detail/zero.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/array.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+namespace bigint_algo
+{
+
+namespace modinv_detail
+{
+
+// out[0, n) = a[0, n)^{-1} mod m[0, n)  (a < m、m[n-1] != 0)
+// 逆元が存在しなければ false を返す
+// work は gcd_work_size(n) + n 桁の作業領域
+template <typename T>
+inline HAMON_CXX14_CONSTEXPR bool
+modinv_impl(T* out, T const* a, T const* m, hamon::size_t n, T* work)
+{
+	T* const g = work;
+	bool const neg = gcd_detail::gcd_impl(g, out, static_cast<T*>(nullptr),
+		a, n, m, n, n, work + n);
+	if (detail::actual_size_impl(g, n) != 1 || g[0] != 1)
+	{
+		return false;
+	}
+
+	// a * x' ≡ 1 (mod m)、|x'| < m
+	if (neg && detail::actual_size_impl(out, n) != 0)
+	{
+		sub_detail::sub_reverse_impl(out, n, m, n);
+	}
+	return true;
+}
+
+}	// namespace modinv_detail
+
+// out = lhs^{-1} mod rhs (0 <= out < rhs)
+// 逆元が存在しない(gcd(lhs, rhs) != 1)場合は、false を返して out を 0 にする
+// rhs が 0 の場合の動作は未規定
+// out と lhs, rhs は同じオブジェクトでもよい
+
+template <typename Vector, typename = detail::enable_if_resizable_t<Vector>>
+inline bool
+modinv(Vector& out, Vector const& lhs, Vector const& rhs)
+{
+	hamon::size_t const n = rhs.size();
+	Vector quo(lhs.get_allocator());
+	Vector a(lhs.get_allocator());
+	bigint_algo::div_mod(quo, a, lhs, rhs);
+	a.resize(n);
+
+	Vector work(lhs.get_allocator());
+	work.resize(n + gcd_detail::gcd_work_size(n) + n);
+	auto const p = work.data();
+	if (!modinv_detail::modinv_impl(p, a.data(), rhs.data(), n, p + n))
+	{
+		detail::zero(out);
+		return false;
+	}
+	out.resize(n);
+	for (hamon::size_t i = 0; i < n; ++i)
+	{
+		out[i] = p[i];
+	}
+	bigint_algo::normalize(out);
+	return true;
+}
+
+template <typename T, hamon::size_t N>
+inline HAMON_CXX14_CONSTEXPR bool
+modinv(hamon::array<T, N>& out, hamon::array<T, N> const& lhs, hamon::array<T, N> const& rhs)
+{
+	hamon::size_t const n = detail::actual_size(rhs);
+	auto const a = bigint_algo::div_mod(lhs, rhs).rem;
+	hamon::array<T, N> result{};
+	hamon::array<T, gcd_detail::gcd_work_size(N) + N> work{};
+	bool const ok = n != 0 &&
+		modinv_detail::modinv_impl(result.data(), a.data(), rhs.data(), n, work.data());
+	out = ok ? result : hamon::array<T, N>{};
+	return ok;
+}
+
+}	// namespace bigint_algo
+}	// namespace hamon
+
+#endif // HAMON_BIGINT_BIGINT_ALGO_MODINV_HPP
@@ -7,18 +7,20 @@
 #ifndef HAMON_BIGINT_BIGINT_ALGO_MULTIPLY_HPP
 #define HAMON_BIGINT_BIGINT_ALGO_MULTIPLY_HPP
 
-#include <hamon/bigint/bigint_algo/add.hpp>
-#include <hamon/bigint/bigint_algo/bit_shift_left.hpp>
+#include <hamon/bigint/bigint_algo/normalize.hpp>
+#include <hamon/bigint/bigint_algo/detail/addc.hpp>
 #include <hamon/bigint/bigint_algo/detail/hi.hpp>
 #include <hamon/bigint/bigint_algo/detail/lo.hpp>
 #include <hamon/bigint/bigint_algo/detail/mul.hpp>
 #include <hamon/bigint/bigint_algo/detail/zero.hpp>
 #include <hamon/bigint/bigint_algo/detail/actual_size.hpp>
+#include <hamon/bigint/bigint_algo/detail/uint128.hpp>
+#include <hamon/bigint/bigint_algo/detail/is_resizable.hpp>
+#include <hamon/algorithm/min.hpp>
 #include <hamon/array.hpp>
-#include <hamon/bit/bitsof.hpp>
 #include <hamon/cstddef/size_t.hpp>
 #include <hamon/cstdint.hpp>
-#include <hamon/vector.hpp>
+#include <hamon/ranges/range_value_t.hpp>
 #include <hamon/config.hpp>
 
 namespace hamon
@@ -29,31 +31,70 @@ namespace bigint_algo
 namespace multiply_detail
 {
 
-template <typename VectorType, typename T>
+// out[0, n) に lhs[0, n1) * rhs[0, n2) の下位 n 桁を格納する(out は 0 で初期化されていること)
+// 結果が n 桁に収まらない場合は true を返す
+//
+// 筆算と同じ O(n1 * n2) の方法で、lhs の各桁について rhs 全体との積を out に足し込む。
+// 1桁あたりの演算は mul と addc それぞれ1回なので、
+// 倍精度の型(__uint128_t など)がある環境では、ハードウェアの乗算命令とキャリー付き加算命令になる。
+template <typename T>
 inline HAMON_CXX14_CONSTEXPR bool
-multiply_impl(VectorType& out, T const* lhs, hamon::size_t n1, T const* rhs, hamon::size_t n2)
+multiply_impl(T* out, hamon::size_t n, T const* lhs, hamon::size_t n1, T const* rhs, hamon::size_t n2)
 {
-	detail::zero(out);
-	VectorType tmp{0};
 	bool overflow = false;
-	for (hamon::size_t i = n1; i > 0; --i)
+	for (hamon::size_t i = 0; i < n1; ++i)
 	{
-		detail::zero(tmp);
-		for (hamon::size_t j = n2; j > 0; --j)
+		T const b = lhs[i];
+		if (b == 0)
+		{
+			continue;
+		}
+
+		hamon::size_t const m = (i < n) ? hamon::min(n2, n - i) : 0;
+
+		T carry = 0;
+		for (hamon::size_t j = 0; j < m; ++j)
+		{
+			// out[i+j] + rhs[j] * b + carry は倍精度に収まる
+			auto const t = detail::mul(rhs[j], b);
+			auto const x = detail::addc(out[i + j], detail::lo(t), carry);
+			out[i + j] = detail::lo(x);
+			carry = static_cast<T>(detail::hi(t) + detail::hi(x));
+		}
+
+		if (i + m < n)
+		{
+			out[i + m] = carry;
+		}
+		else
 		{
-			auto const t = detail::mul(lhs[i-1], rhs[j-1]);
-			auto const f1 = bigint_algo::add(tmp, detail::hi(t));
-			auto const f2 = bigint_algo::bit_shift_left(tmp, hamon::bitsof<T>());
-			tmp[0] = detail::lo(t);
-			overflow = overflow || f1 || f2;
+			overflow = overflow || carry != 0;
+			for (hamon::size_t j = m; j < n2; ++j)
+			{
+				overflow = overflow || rhs[j] != 0;
+			}
 		}
-		auto const f1 = bigint_algo::bit_shift_left(out, hamon::bitsof<T>());
-		auto const f2 = bigint_algo::add(out, tmp);
-		overflow = overflow || f1 || f2;
 	}
 	return overflow;
 }
 
+template <typename Vector, typename T>
+inline void
+multiply_vector(Vector& out, T const* lhs, hamon::size_t n1, T const* rhs, hamon::size_t n2)
+{
+	out.assign(n1 + n2, T{0});
+	multiply_impl(out.data(), out.size(), lhs, n1, rhs, n2);
+	bigint_algo::normalize(out);
+}
+
+template <typename T, hamon::size_t N>
+inline HAMON_CXX14_CONSTEXPR bool
+multiply_array(hamon::array<T, N>& out, T const* lhs, hamon::size_t n1, T const* rhs, hamon::size_t n2)
+{
+	detail::zero(out);
+	return multiply_impl(out.data(), N, lhs, n1, rhs, n2);
+}
+
 }	// namespace multiply_detail
 
 // 乗算はin-placeに行うことができないので、左辺(lhs)を出力にするパターンは使えない
@@ -61,30 +102,31 @@ multiply_impl(VectorType& out, T const* lhs, hamon::size_t n1, T const* rhs, ham
 // out と lhs, out と rhs が、同じオブジェクトや同じ領域の場合の動作は未規定
 // オーバーフローフラグを戻り値で返す
 
-template <typename T>
+template <typename Vector, typename = detail::enable_if_resizable_t<Vector>>
 inline bool
-multiply(hamon::vector<T>& out, hamon::vector<T> const& lhs, T rhs)
+multiply(Vector& out, Vector const& lhs, hamon::ranges::range_value_t<Vector> rhs)
 {
-	return multiply_detail::multiply_impl(out,
+	multiply_detail::multiply_vector(out,
 		lhs.data(), lhs.size(),
 		&rhs, 1);
+	return false;
 }
 
-template <typename T>
+template <typename Vector, typename = detail::enable_if_resizable_t<Vector>>
 inline bool
-multiply(hamon::vector<T>& out, hamon::vector<T> const& lhs, hamon::vector<T> const& rhs)
+multiply(Vector& out, Vector const& lhs, Vector const& rhs)
 {
-	return multiply_detail::multiply_impl(out,
+	multiply_detail::multiply_vector(out,
 		lhs.data(), lhs.size(),
 		rhs.data(), rhs.size());
+	return false;
 }
 
 template <typename T, hamon::size_t N>
 inline HAMON_CXX14_CONSTEXPR bool
 multiply(hamon::array<T, N>& out, hamon::array<T, N> const& lhs, T rhs)
 {
-
-	return multiply_detail::multiply_impl(out,
+	return multiply_detail::multiply_array(out,
 		lhs.data(), detail::actual_size(lhs),
 		&rhs, 1);
 }
@@ -93,17 +135,41 @@ template <typename T, hamon::size_t N>
 inline HAMON_CXX14_CONSTEXPR bool
 multiply(hamon::array<T, N>& out, hamon::array<T, N> const& lhs, hamon::array<T, N> const& rhs)
 {
-	return multiply_detail::multiply_impl(out,
+	return multiply_detail::multiply_array(out,
 		lhs.data(), detail::actual_size(lhs),
 		rhs.data(), detail::actual_size(rhs));
 }
 
+#if defined(__SIZEOF_INT128__)
+// 128bit は __uint128_t の演算で行う
+inline HAMON_CXX14_CONSTEXPR bool
+multiply(
+	hamon::array<hamon::uint64_t, 2>& out,
+	hamon::array<hamon::uint64_t, 2> const& lhs,
+	hamon::array<hamon::uint64_t, 2> const& rhs)
+{
+	out = detail::from_uint128(detail::to_uint128(lhs) * detail::to_uint128(rhs));
+
+	// 上位の桁が両方 0 でなければ必ずオーバーフローする。
+	// そうでなければ、上位の桁との積と下位同士の積の上位を足したものが 64bit に収まるかどうか
+	if (lhs[1] != 0 && rhs[1] != 0)
+	{
+		return true;
+	}
+	auto const cross =
+		static_cast<__uint128_t>(lhs[1]) * rhs[0] +
+		static_cast<__uint128_t>(lhs[0]) * rhs[1] +
+		((static_cast<__uint128_t>(lhs[0]) * rhs[0]) >> 64);
+	return (cross >> 64) != 0;
+}
+#endif
+
 // 利便性のために、結果を戻り値で返すバージョン(オーバーフローの情報は得られない)
-template <typename T>
-inline hamon::vector<T>
-multiply(hamon::vector<T> const& lhs, hamon::vector<T> const& rhs)
+template <typename Vector, typename = detail::enable_if_resizable_t<Vector>>
+inline Vector
+multiply(Vector const& lhs, Vector const& rhs)
 {
-	hamon::vector<T> result;
+	Vector result(lhs.get_allocator());
 	bigint_algo::multiply(result, lhs, rhs);
 	return result;
 }
@@ -8,7 +8,7 @@
 #define HAMON_BIGINT_BIGINT_ALGO_NORMALIZE_HPP
 
 #include <hamon/bigint/bigint_algo/detail/zero.hpp>
-#include <hamon/vector.hpp>
+#include <hamon/bigint/bigint_algo/detail/is_resizable.hpp>
 #include <hamon/config.hpp>
 
 namespace hamon
@@ -21,9 +21,9 @@ namespace bigint_algo
  *  ・末尾の0を取り除く
  *  ・空の場合は {0} を返す
  */
-template <typename T>
+template <typename Vector, typename = detail::enable_if_resizable_t<Vector>>
 inline void
-normalize(hamon::vector<T>& vec)
+normalize(Vector& vec)
 {
 	auto n = vec.size();
 	if (n == 0)
@@ -8,11 +8,11 @@
 #define HAMON_BIGINT_BIGINT_ALGO_POW_N_HPP
 
 #include <hamon/bigint/bigint_algo/multiply.hpp>
+#include <hamon/bigint/bigint_algo/detail/is_resizable.hpp>
 #include <hamon/array.hpp>
 #include <hamon/cstddef/size_t.hpp>
 #include <hamon/cstdint/uintmax_t.hpp>
 #include <hamon/utility/move.hpp>
-#include <hamon/vector.hpp>
 #include <hamon/config.hpp>
 
 namespace hamon
@@ -82,9 +82,9 @@ pow_n_impl(VectorType& out, VectorType const& x, hamon::uintmax_t y)
 
 }	// namespace pow_n_detail
 
-template <typename T>
+template <typename Vector, typename = detail::enable_if_resizable_t<Vector>>
 inline bool
-pow_n(hamon::vector<T>& out, hamon::vector<T> const& x, hamon::uintmax_t y)
+pow_n(Vector& out, Vector const& x, hamon::uintmax_t y)
 {
 	return pow_n_detail::pow_n_impl(out, x, y);
 }
@@ -0,0 +1,294 @@
+﻿/**
+ *	@file	powm.hpp
+ *
+ *	@brief	powm 関数の定義
+ */
+
+#ifndef HAMON_BIGINT_BIGINT_ALGO_POWM_HPP
+#define HAMON_BIGINT_BIGINT_ALGO_POWM_HPP
+
+#include <hamon/bigint/bigint_algo/barrett_reducer.hpp>
+#include <hamon/bigint/bigint_algo/div_mod.hpp>
+#include <hamon/bigint/bigint_algo/is_zero.hpp>
+#include <hamon/bigint/bigint_algo/multiply.hpp>
+#include <hamon/bigint/bigint_algo/normalize.hpp>
+#include <hamon/bigint/bigint_algo/detail/actual_size.hpp>
+#include <hamon/bigint/bigint_algo/detail/is_resizable.hpp>
+#include <hamon/bigint/bigint_algo/detail/montgomery.hpp>
+#include <hamon/bigint/bigint_algo/detail/zero.hpp>
+#include <hamon/bit/bitsof.hpp>
+#include <hamon/bit/countl_zero.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/array.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+namespace bigint_algo
+{
+
+namespace powm_detail
+{
+
+// 奇数の法によるモンゴメリ乗算
+template <typename T>
+struct montgomery_context
+{
+	T const*		m;
+	hamon::size_t	n;
+	T				minv;
+	T*				work;	// n+2 桁
+
+	HAMON_CXX14_CONSTEXPR void
+	mul(T* out, T const* a, T const* b) const
+	{
+		detail::montgomery_mul(out, a, b, m, n, minv, work);
+	}
+};
+
+// 偶数の法による乗算(Barrett reduction)
+template <typename T>
+struct barrett_context
+{
+	T const*		m;
+	hamon::size_t	n;
+	T const*		mu;		// n+2 桁
+	T*				prod;	// 2n 桁
+	T*				work;	// barrett_detail::reduce_work_size(n) 桁
+
+	HAMON_CXX14_CONSTEXPR void
+	mul(T* out, T const* a, T const* b) const
+	{
+		for (hamon::size_t i = 0; i < 2 * n; ++i)
+		{
+			prod[i] = 0;
+		}
+		multiply_detail::multiply_impl(prod, 2 * n, a, n, b, n);
+		barrett_detail::barrett_reduce(out, prod, m, n, mu, work);
+	}
+};
+
+// 指数のビット数に対するウィンドウの幅(最大 6)
+inline HAMON_CXX11_CONSTEXPR hamon::size_t
+window_bits(hamon::size_t ebits)
+{
+	return
+		ebits > 671 ? 6 :
+		ebits > 239 ? 5 :
+		ebits >  79 ? 4 :
+		ebits >  23 ? 3 :
+		1;
+}
+
+template <typename T>
+inline HAMON_CXX14_CONSTEXPR bool
+test_bit(T const* e, hamon::size_t pos)
+{
+	return ((e[pos / hamon::bitsof<T>()] >> (pos % hamon::bitsof<T>())) & 1) != 0;
+}
+
+// acc[0, n) = g^e
+// e[0, ne) は 0 以外で e[ne-1] != 0、table は 32n 桁の作業領域
+//
+// 左から右へのスライディングウィンドウ法(Handbook of Applied Cryptography, Algorithm 14.85)。
+// g の奇数乗 g, g^3, ..., g^(2^k - 1) を表にしておき、指数の1の並びを k ビットずつまとめて掛ける。
+// 乗算の回数は、2乗が指数のビット数回と、その他がおよそ (ビット数 / (k + 1)) 回になる。
+template <typename T, typename Context>
+inline HAMON_CXX14_CONSTEXPR void
+sliding_window(T* acc, T const* g, T const* e, hamon::size_t ne,
+	hamon::size_t n, Context const& ctx, T* table)
+{
+	hamon::size_t const ebits = ne * hamon::bitsof<T>() -
+		static_cast<hamon::size_t>(hamon::countl_zero(e[ne - 1]));
+	hamon::size_t const k = window_bits(ebits);
+
+	for (hamon::size_t i = 0; i < n; ++i)
+	{
+		table[i] = g[i];
+	}
+	if (k > 1)
+	{
+		// acc を g^2 の作業領域に使う
+		ctx.mul(acc, g, g);
+		hamon::size_t const entries = hamon::size_t{1} << (k - 1);
+		for (hamon::size_t i = 1; i < entries; ++i)
+		{
+			ctx.mul(table + i * n, table + (i - 1) * n, acc);
+		}
+	}
+
+	bool started = false;
+	hamon::size_t i = ebits;
+	while (i > 0)
+	{
+		if (!test_bit(e, i - 1))
+		{
+			ctx.mul(acc, acc, acc);
+			--i;
+			continue;
+		}
+
+		// 最下位ビットが 1 になる、k ビット以下のウィンドウ [l, i)
+		hamon::size_t l = i > k ? i - k : 0;
+		while (!test_bit(e, l))
+		{
+			++l;
+		}
+		hamon::size_t val = 0;
+		for (hamon::size_t j = i; j > l; --j)
+		{
+			val = (val << 1) | (test_bit(e, j - 1) ? 1u : 0u);
+		}
+		T const* const entry = table + ((val - 1) / 2) * n;
+
+		if (started)
+		{
+			for (hamon::size_t j = l; j < i; ++j)
+			{
+				ctx.mul(acc, acc, acc);
+			}
+			ctx.mul(acc, acc, entry);
+		}
+		else
+		{
+			for (hamon::size_t j = 0; j < n; ++j)
+			{
+				acc[j] = entry[j];
+			}
+			started = true;
+		}
+		i = l;
+	}
+}
+
+// powm_impl に必要な作業領域の桁数
+inline HAMON_CXX11_CONSTEXPR hamon::size_t
+powm_work_size(hamon::size_t n)
+{
+	return
+		32 * n +	// table
+		3 * n +		// g, unit, r
+		(n + 2) +	// montgomery_context::work
+		(n + 2) +	// mu
+		2 * n +		// barrett_context::prod
+		barrett_detail::reduce_work_size(n) +
+		barrett_detail::pow_b_div_mod_work_size(n);
+}
+
+// out[0, n) = b[0, n)^e[0, ne) mod m[0, n)  (b < m、m[n-1] != 0)
+// work は powm_work_size(n) 桁の作業領域
+//
+// m が奇数ならモンゴメリ乗算を使う。途中の値を x * R mod m (R = 2^(bitsof<T>() * n)) の形で持つので、
+// 剰余を求めるのに除算が要らない。m が偶数ならモンゴメリ乗算は使えないので、Barrett reduction を使う。
+// どちらも前処理で b^(2n) を m で1回割るだけで、以降は乗算と加減算だけになる。
+template <typename T>
+inline HAMON_CXX14_CONSTEXPR void
+powm_impl(T* out, T const* b, T const* e, hamon::size_t ne,
+	T const* m, hamon::size_t n, T* work)
+{
+	T* const table = work;
+	T* const g     = table + 32 * n;
+	T* const unit  = g + n;
+	T* const r     = unit + n;
+	T* const mw    = r + n;
+	T* const mu    = mw + (n + 2);
+	T* const prod  = mu + (n + 2);
+	T* const rw    = prod + 2 * n;
+	T* const dw    = rw + barrett_detail::reduce_work_size(n);
+
+	for (hamon::size_t i = 0; i < n; ++i)
+	{
+		out[i] = 0;
+		unit[i] = 0;
+	}
+	unit[0] = 1;
+
+	if (n == 1 && m[0] == 1)
+	{
+		return;
+	}
+
+	ne = detail::actual_size_impl(e, ne);
+	if (ne == 0)
+	{
+		out[0] = 1;
+		return;
+	}
+
+	// mu = b^(2n) / m, r = b^(2n) mod m
+	barrett_detail::pow_b_div_mod(mu, r, m, n, dw);
+
+	if ((m[0] & 1) != 0)
+	{
+		montgomery_context<T> const ctx{m, n, detail::montgomery_inverse(m[0]), mw};
+		ctx.mul(g, b, r);	// b * R mod m
+		sliding_window(out, g, e, ne, n, ctx, table);
+		ctx.mul(out, out, unit);
+	}
+	else
+	{
+		barrett_context<T> const ctx{m, n, mu, prod, rw};
+		sliding_window(out, b, e, ne, n, ctx, table);
+	}
+}
+
+}	// namespace powm_detail
+
+// out = base^exp mod mod (0 <= out < mod)
+// mod が 0 のときは 0 を返す
+// out と base, exp, mod は同じオブジェクトでもよい
+
+template <typename Vector, typename = detail::enable_if_resizable_t<Vector>>
+inline void
+powm(Vector& out, Vector const& base, Vector const& exp, Vector const& mod)
+{
+	if (bigint_algo::is_zero(mod))
+	{
+		detail::zero(out);
+		return;
+	}
+
+	hamon::size_t const n = mod.size();
+	Vector quo(mod.get_allocator());
+	Vector b(mod.get_allocator());
+	bigint_algo::div_mod(quo, b, base, mod);
+	b.resize(n);
+
+	Vector work(mod.get_allocator());
+	work.resize(n + powm_detail::powm_work_size(n));
+	auto const p = work.data();
+	powm_detail::powm_impl(p, b.data(), exp.data(), exp.size(), mod.data(), n, p + n);
+
+	out.resize(n);
+	for (hamon::size_t i = 0; i < n; ++i)
+	{
+		out[i] = p[i];
+	}
+	bigint_algo::normalize(out);
+}
+
+template <typename T, hamon::size_t N>
+inline HAMON_CXX14_CONSTEXPR void
+powm(hamon::array<T, N>& out,
+	hamon::array<T, N> const& base,
+	hamon::array<T, N> const& exp,
+	hamon::array<T, N> const& mod)
+{
+	hamon::size_t const n = detail::actual_size(mod);
+	if (n == 0)
+	{
+		detail::zero(out);
+		return;
+	}
+
+	auto const b = bigint_algo::div_mod(base, mod).rem;
+	hamon::array<T, N> result{};
+	hamon::array<T, powm_detail::powm_work_size(N)> work{};
+	powm_detail::powm_impl(result.data(), b.data(), exp.data(), N, mod.data(), n, work.data());
+	out = result;
+}
+
+}	// namespace bigint_algo
+}	// namespace hamon
+
+#endif // HAMON_BIGINT_BIGINT_ALGO_POWM_HPP
@@ -12,9 +12,10 @@
 #include <hamon/bigint/bigint_algo/detail/lo.hpp>
 #include <hamon/bigint/bigint_algo/detail/subc.hpp>
 #include <hamon/bigint/bigint_algo/detail/actual_size.hpp>
+#include <hamon/bigint/bigint_algo/detail/uint128.hpp>
+#include <hamon/bigint/bigint_algo/detail/is_resizable.hpp>
 #include <hamon/algorithm/max.hpp>
 #include <hamon/cstddef/size_t.hpp>
-#include <hamon/vector.hpp>
 #include <hamon/config.hpp>
 
 namespace hamon
@@ -45,11 +46,32 @@ sub_impl(T* p1, hamon::size_t n1, T const* p2, hamon::size_t n2)
 	}
 }
 
+// p1[0, n2) = p2[0, n2) - p1[0, n1)  (n1 <= n2)
+template <typename T>
+inline HAMON_CXX14_CONSTEXPR void
+sub_reverse_impl(T* p1, hamon::size_t n1, T const* p2, hamon::size_t n2)
+{
+	T carry = 0;
+	hamon::size_t i = 0;
+	for (; i < n1; ++i)
+	{
+		auto const x = detail::subc(p2[i], p1[i], carry);
+		p1[i] = detail::lo(x);
+		carry = detail::hi(x);
+	}
+	for (; i < n2; ++i)
+	{
+		auto const x = detail::subc(p2[i], T{0}, carry);
+		p1[i] = detail::lo(x);
+		carry = detail::hi(x);
+	}
+}
+
 }	// namespace sub_detail
 
-template <typename T>
+template <typename Vector, typename = detail::enable_if_resizable_t<Vector>>
 inline void
-sub(hamon::vector<T>& lhs, hamon::vector<T> const& rhs)
+sub(Vector& lhs, Vector const& rhs)
 {
 	lhs.resize(hamon::max(lhs.size(), rhs.size()));
 	sub_detail::sub_impl(
@@ -58,6 +80,21 @@ sub(hamon::vector<T>& lhs, hamon::vector<T> const& rhs)
 	bigint_algo::normalize(lhs);
 }
 
+// lhs = rhs - lhs
+// 結果を lhs に格納するので、lhs の領域を再利用できる
+// lhs > rhs の場合の動作は未規定
+template <typename Vector, typename = detail::enable_if_resizable_t<Vector>>
+inline void
+sub_reverse(Vector& lhs, Vector const& rhs)
+{
+	auto const n1 = lhs.size();
+	lhs.resize(hamon::max(n1, rhs.size()));
+	sub_detail::sub_reverse_impl(
+		lhs.data(), n1,
+		rhs.data(), rhs.size());
+	bigint_algo::normalize(lhs);
+}
+
 template <typename T, hamon::size_t N>
 inline HAMON_CXX14_CONSTEXPR void
 sub(hamon::array<T, N>& lhs, hamon::array<T, N> const& rhs)
@@ -67,6 +104,15 @@ sub(hamon::array<T, N>& lhs, hamon::array<T, N> const& rhs)
 		rhs.data(), detail::actual_size(rhs));
 }
 
+#if defined(__SIZEOF_INT128__)
+// 128bit は __uint128_t の演算で行う
+inline HAMON_CXX14_CONSTEXPR void
+sub(hamon::array<hamon::uint64_t, 2>& lhs, hamon::array<hamon::uint64_t, 2> const& rhs)
+{
+	lhs = detail::from_uint128(detail::to_uint128(lhs) - detail::to_uint128(rhs));
+}
+#endif
+
 }	// namespace bigint_algo
 }	// namespace hamon
 
@@ -10,6 +10,7 @@
 #include <hamon/bigint/bigint_algo/div_mod.hpp>
 #include <hamon/bigint/bigint_algo/pow_n.hpp>
 #include <hamon/bigint/bigint_algo/is_zero.hpp>
+#include <hamon/bigint/bigint_algo/detail/is_resizable.hpp>
 #include <hamon/algorithm/reverse.hpp>
 #include <hamon/algorithm/min.hpp>
 #include <hamon/cmath/log2.hpp>
@@ -19,7 +20,6 @@
 #include <hamon/charconv/to_chars.hpp>
 #include <hamon/cstddef/ptrdiff_t.hpp>
 #include <hamon/limits.hpp>
-#include <hamon/vector.hpp>
 #include <hamon/config.hpp>
 
 namespace hamon
@@ -98,9 +98,9 @@ to_chars(char* first, char* last, VectorType value, int base)
 
 }	// namespace to_chars_detail
 
-template <typename T>
+template <typename Vector, typename = detail::enable_if_resizable_t<Vector>>
 inline hamon::to_chars_result
-to_chars(char* first, char* last, hamon::vector<T> const& value, int base = 10)
+to_chars(char* first, char* last, Vector const& value, int base = 10)
 {
 	return to_chars_detail::to_chars(first, last, value, base);
 }
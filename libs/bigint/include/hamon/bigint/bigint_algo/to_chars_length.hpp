@@ -7,6 +7,7 @@
 #ifndef HAMON_BIGINT_BIGINT_ALGO_TO_CHARS_LENGTH_HPP
 #define HAMON_BIGINT_BIGINT_ALGO_TO_CHARS_LENGTH_HPP
 
+#include <hamon/bigint/bigint_algo/detail/is_resizable.hpp>
 #include <hamon/bit/has_single_bit.hpp>
 #include <hamon/bit/countr_zero.hpp>
 #include <hamon/cmath/log2.hpp>
@@ -15,7 +16,6 @@
 #include <hamon/array.hpp>
 #include <hamon/cstddef/size_t.hpp>
 #include <hamon/limits.hpp>
-#include <hamon/vector.hpp>
 #include <hamon/config.hpp>
 
 namespace hamon
@@ -40,9 +40,9 @@ to_chars_length(VectorType const& value, int base)
 
 }	// namespace to_chars_length_detail
 
-template <typename T>
+template <typename Vector, typename = detail::enable_if_resizable_t<Vector>>
 inline hamon::size_t
-to_chars_length(hamon::vector<T> const& value, int base = 10)
+to_chars_length(Vector const& value, int base = 10)
 {
 	return to_chars_length_detail::to_chars_length(value, base);
 }
@@ -7,6 +7,7 @@
 #ifndef HAMON_BIGINT_BIGINT_ALGO_TO_UINT_HPP
 #define HAMON_BIGINT_BIGINT_ALGO_TO_UINT_HPP
 
+#include <hamon/bigint/bigint_algo/detail/is_resizable.hpp>
 #include <hamon/array.hpp>
 #include <hamon/bit/bitsof.hpp>
 #include <hamon/bit/shl.hpp>
@@ -15,7 +16,6 @@
 #include <hamon/type_traits/enable_if.hpp>
 #include <hamon/type_traits/is_unsigned.hpp>
 #include <hamon/limits.hpp>
-#include <hamon/vector.hpp>
 #include <hamon/config.hpp>
 
 namespace hamon
@@ -64,11 +64,12 @@ to_uint(UInt& dst, T const* src, hamon::size_t size)
 
 }	// namespace to_uint_detail
 
-template <typename UInt, typename T,
-	typename = hamon::enable_if_t<hamon::is_unsigned<UInt>::value>
+template <typename UInt, typename Vector,
+	typename = hamon::enable_if_t<hamon::is_unsigned<UInt>::value>,
+	typename = detail::enable_if_resizable_t<Vector>
 >
 inline to_uint_result
-to_uint(UInt& dst, hamon::vector<T> const& value)
+to_uint(UInt& dst, Vector const& value)
 {
 	return to_uint_detail::to_uint(dst, value.data(), value.size());
 }
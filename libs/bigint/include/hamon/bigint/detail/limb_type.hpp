@@ -0,0 +1,40 @@
+﻿/**
+ *	@file	limb_type.hpp
+ *
+ *	@brief	bigint_limb_type の定義
+ */
+
+#ifndef HAMON_BIGINT_DETAIL_LIMB_TYPE_HPP
+#define HAMON_BIGINT_DETAIL_LIMB_TYPE_HPP
+
+#include <hamon/cstdint/uint32_t.hpp>
+#include <hamon/cstdint/uint64_t.hpp>
+#include <hamon/config.hpp>
+
+// 64bit x 64bit -> 128bit の乗算と、キャリー付き加減算をハードウェアで行える環境では
+// 64bit の桁を使う。そうでない環境では、32bit の桁を使う。
+#if !defined(HAMON_BIGINT_LIMB_BITS)
+#  if defined(__SIZEOF_INT128__) || (defined(HAMON_MSVC) && defined(_M_X64))
+#    define HAMON_BIGINT_LIMB_BITS 64
+#  else
+#    define HAMON_BIGINT_LIMB_BITS 32
+#  endif
+#endif
+
+namespace hamon
+{
+
+namespace detail
+{
+
+#if HAMON_BIGINT_LIMB_BITS == 64
+using bigint_limb_type = hamon::uint64_t;
+#else
+using bigint_limb_type = hamon::uint32_t;
+#endif
+
+}	// namespace detail
+
+}	// namespace hamon
+
+#endif // HAMON_BIGINT_DETAIL_LIMB_TYPE_HPP
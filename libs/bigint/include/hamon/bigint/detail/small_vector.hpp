@@ -0,0 +1,300 @@
+﻿/**
+ *	@file	small_vector.hpp
+ *
+ *	@brief	bigint_small_vector の定義
+ */
+
+#ifndef HAMON_BIGINT_DETAIL_SMALL_VECTOR_HPP
+#define HAMON_BIGINT_DETAIL_SMALL_VECTOR_HPP
+
+#include <hamon/algorithm/max.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/memory/addressof.hpp>
+#include <hamon/memory/allocator_traits.hpp>
+#include <hamon/memory/detail/equals_allocator.hpp>
+#include <hamon/memory/detail/propagate_allocator_on_copy.hpp>
+#include <hamon/memory/detail/propagate_allocator_on_move.hpp>
+#include <hamon/type_traits/is_unsigned.hpp>
+#include <hamon/utility/move.hpp>
+#include <hamon/config.hpp>
+#include <initializer_list>
+
+namespace hamon
+{
+
+namespace detail
+{
+
+/**
+ *	@brief	bigint の桁を格納する、小さいバッファを内部に持つ vector
+ *
+ *	要素数が N 以下の間は内部のバッファを使い、それを超えたときに初めて Allocator でメモリを確保する。
+ *	bigint_algo が使う vector の機能(size, data, resize, push_back など)だけを持つ。
+ *	T は符号なし整数型に限るので、要素の構築や破棄は行わない。
+ */
+template <typename T, hamon::size_t N, typename Allocator>
+class bigint_small_vector
+{
+	static_assert(hamon::is_unsigned<T>::value, "");
+	static_assert(N >= 1, "");
+
+private:
+	using AllocTraits = hamon::allocator_traits<Allocator>;
+
+public:
+	using value_type      = T;
+	using allocator_type  = Allocator;
+	using size_type       = hamon::size_t;
+	using reference       = T&;
+	using const_reference = T const&;
+	using pointer         = T*;
+	using const_pointer   = T const*;
+	using iterator        = T*;
+	using const_iterator  = T const*;
+
+	bigint_small_vector() HAMON_NOEXCEPT
+		: bigint_small_vector(Allocator())
+	{}
+
+	explicit bigint_small_vector(Allocator const& a) HAMON_NOEXCEPT
+		: m_allocator(a)
+		, m_data(m_inline)
+		, m_size(0)
+		, m_capacity(N)
+	{}
+
+	explicit bigint_small_vector(size_type n, Allocator const& a = Allocator())
+		: bigint_small_vector(a)
+	{
+		this->assign(n, T{0});
+	}
+
+	bigint_small_vector(size_type n, T const& value, Allocator const& a = Allocator())
+		: bigint_small_vector(a)
+	{
+		this->assign(n, value);
+	}
+
+	bigint_small_vector(std::initializer_list<T> il, Allocator const& a = Allocator())
+		: bigint_small_vector(a)
+	{
+		this->assign_n(il.begin(), il.size());
+	}
+
+	bigint_small_vector(bigint_small_vector const& x)
+		: bigint_small_vector(x, AllocTraits::select_on_container_copy_construction(x.m_allocator))
+	{}
+
+	bigint_small_vector(bigint_small_vector const& x, Allocator const& a)
+		: bigint_small_vector(a)
+	{
+		this->assign_n(x.data(), x.size());
+	}
+
+	bigint_small_vector(bigint_small_vector&& x) HAMON_NOEXCEPT
+		: bigint_small_vector(Allocator(hamon::move(x.m_allocator)))
+	{
+		this->steal(x);
+	}
+
+	~bigint_small_vector()
+	{
+		this->release();
+	}
+
+	bigint_small_vector& operator=(bigint_small_vector const& x)
+	{
+		if (hamon::addressof(x) == this)
+		{
+			return *this;
+		}
+
+		if (AllocTraits::propagate_on_container_copy_assignment::value &&
+			!hamon::detail::equals_allocator(m_allocator, x.m_allocator))
+		{
+			// 今のアロケータで確保したメモリは、伝播させる前に解放しなければいけない
+			this->release();
+			hamon::detail::propagate_allocator_on_copy(m_allocator, x.m_allocator);
+		}
+
+		this->assign_n(x.data(), x.size());
+		return *this;
+	}
+
+	bigint_small_vector& operator=(bigint_small_vector&& x)
+	{
+		if (hamon::addressof(x) == this)
+		{
+			return *this;
+		}
+
+		bool const equal = hamon::detail::equals_allocator(m_allocator, x.m_allocator);
+		if ((!AllocTraits::propagate_on_container_move_assignment::value && !equal) ||
+			(x.is_inline() && equal))
+		{
+			// x のメモリを steal できない場合と、steal するものがない場合はコピーする。
+			// 今確保しているメモリはそのまま再利用する
+			this->assign_n(x.data(), x.size());
+			return *this;
+		}
+
+		this->release();
+		hamon::detail::propagate_allocator_on_move(m_allocator, x.m_allocator);
+		this->steal(x);
+		return *this;
+	}
+
+	bigint_small_vector& operator=(std::initializer_list<T> il)
+	{
+		this->assign_n(il.begin(), il.size());
+		return *this;
+	}
+
+	void assign(size_type n, T const& value)
+	{
+		this->reserve(n);
+		for (size_type i = 0; i < n; ++i)
+		{
+			m_data[i] = value;
+		}
+		m_size = n;
+	}
+
+	allocator_type get_allocator() const HAMON_NOEXCEPT
+	{
+		return m_allocator;
+	}
+
+	iterator       begin()       HAMON_NOEXCEPT { return m_data; }
+	const_iterator begin() const HAMON_NOEXCEPT { return m_data; }
+	iterator       end()         HAMON_NOEXCEPT { return m_data + m_size; }
+	const_iterator end()   const HAMON_NOEXCEPT { return m_data + m_size; }
+
+	pointer       data()       HAMON_NOEXCEPT { return m_data; }
+	const_pointer data() const HAMON_NOEXCEPT { return m_data; }
+
+	reference       operator[](size_type i)       HAMON_NOEXCEPT { return m_data[i]; }
+	const_reference operator[](size_type i) const HAMON_NOEXCEPT { return m_data[i]; }
+
+	reference       back()       HAMON_NOEXCEPT { return m_data[m_size - 1]; }
+	const_reference back() const HAMON_NOEXCEPT { return m_data[m_size - 1]; }
+
+	bool      empty()    const HAMON_NOEXCEPT { return m_size == 0; }
+	size_type size()     const HAMON_NOEXCEPT { return m_size; }
+	size_type capacity() const HAMON_NOEXCEPT { return m_capacity; }
+
+	// 内部のバッファを使っているかどうか
+	bool is_inline() const HAMON_NOEXCEPT
+	{
+		return m_data == m_inline;
+	}
+
+	void reserve(size_type n)
+	{
+		if (n <= m_capacity)
+		{
+			return;
+		}
+
+		// 繰り返し大きくなる場合に備えて、少なくとも2倍にする
+		size_type const cap = hamon::max(n, m_capacity * 2);
+		T* p = AllocTraits::allocate(m_allocator, cap);
+		for (size_type i = 0; i < m_size; ++i)
+		{
+			p[i] = m_data[i];
+		}
+		this->release();
+		m_data = p;
+		m_capacity = cap;
+	}
+
+	void resize(size_type n)
+	{
+		this->resize(n, T{0});
+	}
+
+	void resize(size_type n, T const& value)
+	{
+		this->reserve(n);
+		for (size_type i = m_size; i < n; ++i)
+		{
+			m_data[i] = value;
+		}
+		m_size = n;
+	}
+
+	void push_back(T const& value)
+	{
+		this->reserve(m_size + 1);
+		m_data[m_size++] = value;
+	}
+
+	void clear() HAMON_NOEXCEPT
+	{
+		m_size = 0;
+	}
+
+	void swap(bigint_small_vector& x)
+	{
+		bigint_small_vector tmp(hamon::move(x));
+		x = hamon::move(*this);
+		*this = hamon::move(tmp);
+	}
+
+private:
+	void assign_n(T const* p, size_type n)
+	{
+		this->reserve(n);
+		for (size_type i = 0; i < n; ++i)
+		{
+			m_data[i] = p[i];
+		}
+		m_size = n;
+	}
+
+	// 確保したメモリを解放して、内部のバッファを使う状態に戻す
+	void release() HAMON_NOEXCEPT
+	{
+		if (!this->is_inline())
+		{
+			AllocTraits::deallocate(m_allocator, m_data, m_capacity);
+			m_data = m_inline;
+			m_capacity = N;
+		}
+	}
+
+	// 空で内部のバッファを使っている *this に、x の要素を移す
+	// (アロケータは等しいこと)
+	void steal(bigint_small_vector& x) HAMON_NOEXCEPT
+	{
+		if (x.is_inline())
+		{
+			for (size_type i = 0; i < x.m_size; ++i)
+			{
+				m_inline[i] = x.m_inline[i];
+			}
+		}
+		else
+		{
+			m_data = x.m_data;
+			m_capacity = x.m_capacity;
+			x.m_data = x.m_inline;
+			x.m_capacity = N;
+		}
+		m_size = x.m_size;
+		x.m_size = 0;
+	}
+
+private:
+	HAMON_NO_UNIQUE_ADDRESS	Allocator m_allocator;
+	T*			m_data;
+	size_type	m_size;
+	size_type	m_capacity;
+	T			m_inline[N];
+};
+
+}	// namespace detail
+
+}	// namespace hamon
+
+#endif // HAMON_BIGINT_DETAIL_SMALL_VECTOR_HPP
@@ -0,0 +1,28 @@
+﻿/**
+ *	@file	extended_gcd_result.hpp
+ *
+ *	@brief	extended_gcd_result の定義
+ */
+
+#ifndef HAMON_BIGINT_EXTENDED_GCD_RESULT_HPP
+#define HAMON_BIGINT_EXTENDED_GCD_RESULT_HPP
+
+namespace hamon
+{
+
+/**
+ *	@brief	extended_gcd の戻り値
+ *
+ *	a * x + b * y == gcd
+ */
+template <typename BigInt>
+struct extended_gcd_result
+{
+	BigInt	gcd;
+	BigInt	x;
+	BigInt	y;
+};
+
+}	// namespace hamon
+
+#endif // HAMON_BIGINT_EXTENDED_GCD_RESULT_HPP
@@ -26,11 +26,20 @@
 #include <hamon/bigint/bigint_algo/compare.hpp>
 #include <hamon/bigint/bigint_algo/is_zero.hpp>
 #include <hamon/bigint/bigint_algo/signbit.hpp>
+#include <hamon/bigint/bigint_algo/powm.hpp>
+#include <hamon/bigint/bigint_algo/gcd.hpp>
+#include <hamon/bigint/bigint_algo/extended_gcd.hpp>
+#include <hamon/bigint/bigint_algo/modinv.hpp>
+#include <hamon/bigint/bigint_algo/barrett_reducer.hpp>
+#include <hamon/bigint/barrett_reducer_fwd.hpp>
+#include <hamon/bigint/extended_gcd_result.hpp>
 #include <hamon/bigint/detail/abs_unsigned.hpp>
+#include <hamon/bigint/detail/limb_type.hpp>
 #include <hamon/concepts/integral.hpp>
 #include <hamon/concepts/detail/constrained_param.hpp>
 #include <hamon/compare/strong_ordering.hpp>
 #include <hamon/memory/to_address.hpp>
+#include <hamon/type_traits/conditional.hpp>
 #include <hamon/type_traits/make_unsigned.hpp>
 #include <hamon/string_view.hpp>
 #include <hamon/string.hpp>
@@ -70,11 +79,31 @@ to_chars(char* first, char* last, fixed_bigint<B, S> const& value, int base = 10
 template <hamon::size_t B, bool S>
 hamon::string to_string(fixed_bigint<B, S> const& value);
 
+template <hamon::size_t B, bool S>
+HAMON_CXX14_CONSTEXPR fixed_bigint<B, S>
+powm(fixed_bigint<B, S> const& base, fixed_bigint<B, S> const& exp, fixed_bigint<B, S> const& mod);
+
+template <hamon::size_t B, bool S>
+HAMON_CXX14_CONSTEXPR fixed_bigint<B, S>
+gcd(fixed_bigint<B, S> const& lhs, fixed_bigint<B, S> const& rhs);
+
+template <hamon::size_t B, bool S>
+HAMON_CXX14_CONSTEXPR hamon::extended_gcd_result<fixed_bigint<B, S>>
+extended_gcd(fixed_bigint<B, S> const& lhs, fixed_bigint<B, S> const& rhs);
+
+template <hamon::size_t B, bool S>
+HAMON_CXX14_CONSTEXPR fixed_bigint<B, S>
+modinv(fixed_bigint<B, S> const& x, fixed_bigint<B, S> const& mod);
+
 template <hamon::size_t Bits, bool Signed>
 class fixed_bigint
 {
 private:
-	using element_type = hamon::uint32_t;
+	// Bits が桁のビット数の倍数でなければ 32bit の桁を使う
+	using element_type = hamon::conditional_t<
+		Bits % (sizeof(hamon::detail::bigint_limb_type) * 8) == 0,
+		hamon::detail::bigint_limb_type,
+		hamon::uint32_t>;
 	static const hamon::size_t N = (Bits / 8) / sizeof(element_type);
 	using vector_type = hamon::array<element_type, N>;
 
@@ -451,6 +480,20 @@ private:
 		}
 	}
 
+	// x mod m (0 <= 戻り値 < m、m != 0)
+	static HAMON_CXX14_CONSTEXPR vector_type
+	nonnegative_mod(vector_type const& x, vector_type const& m) HAMON_NOEXCEPT
+	{
+		auto r = bigint_algo::div_mod(abs(x), m).rem;
+		if (Signed && bigint_algo::signbit(x) && !bigint_algo::is_zero(r))
+		{
+			auto t = m;
+			bigint_algo::sub(t, r);
+			r = t;
+		}
+		return r;
+	}
+
 private:
 	vector_type	m_data;
 
@@ -465,6 +508,25 @@ private:
 
 	template <hamon::size_t B, bool S>
 	friend hamon::string to_string(fixed_bigint<B, S> const& value);
+
+	template <hamon::size_t B, bool S>
+	friend HAMON_CXX14_CONSTEXPR fixed_bigint<B, S>
+	powm(fixed_bigint<B, S> const& base, fixed_bigint<B, S> const& exp, fixed_bigint<B, S> const& mod);
+
+	template <hamon::size_t B, bool S>
+	friend HAMON_CXX14_CONSTEXPR fixed_bigint<B, S>
+	gcd(fixed_bigint<B, S> const& lhs, fixed_bigint<B, S> const& rhs);
+
+	template <hamon::size_t B, bool S>
+	friend HAMON_CXX14_CONSTEXPR hamon::extended_gcd_result<fixed_bigint<B, S>>
+	extended_gcd(fixed_bigint<B, S> const& lhs, fixed_bigint<B, S> const& rhs);
+
+	template <hamon::size_t B, bool S>
+	friend HAMON_CXX14_CONSTEXPR fixed_bigint<B, S>
+	modinv(fixed_bigint<B, S> const& x, fixed_bigint<B, S> const& mod);
+
+	template <typename BigInt>
+	friend class hamon::barrett_reducer;
 };
 
 template <hamon::size_t Bits, bool Signed>
@@ -518,6 +580,189 @@ to_string(fixed_bigint<Bits, Signed> const& value)
 	return result;
 }
 
+/**
+ *	@brief	base^exp mod |mod| を返す
+ *
+ *	結果は 0 以上 |mod| 未満。
+ *	|mod| が奇数ならモンゴメリ乗算、偶数なら Barrett reduction によるスライディングウィンドウ法で計算するので、
+ *	Bits の2倍の幅の型を必要としない。
+ *	exp が負の場合は base の逆元の -exp 乗を返す(逆元が無ければ 0)。
+ *	mod が 0 の場合は 0 を返す。
+ */
+template <hamon::size_t Bits, bool Signed>
+inline HAMON_CXX14_CONSTEXPR fixed_bigint<Bits, Signed>
+powm(
+	fixed_bigint<Bits, Signed> const& base,
+	fixed_bigint<Bits, Signed> const& exp,
+	fixed_bigint<Bits, Signed> const& mod)
+{
+	using bigint_type = fixed_bigint<Bits, Signed>;
+
+	auto const m = bigint_type::abs(mod.m_data);
+	if (bigint_algo::is_zero(m))
+	{
+		return bigint_type{};
+	}
+
+	auto b = bigint_type::nonnegative_mod(base.m_data, m);
+	auto e = exp.m_data;
+	if (Signed && bigint_algo::signbit(e))
+	{
+		if (!bigint_algo::modinv(b, b, m))
+		{
+			return bigint_type{};
+		}
+		bigint_algo::negate(e);
+	}
+
+	typename bigint_type::vector_type result{};
+	bigint_algo::powm(result, b, e, m);
+	return bigint_type(result);
+}
+
+/**
+ *	@brief	|lhs| と |rhs| の最大公約数を返す
+ *
+ *	gcd(0, 0) は 0。
+ */
+template <hamon::size_t Bits, bool Signed>
+inline HAMON_CXX14_CONSTEXPR fixed_bigint<Bits, Signed>
+gcd(fixed_bigint<Bits, Signed> const& lhs, fixed_bigint<Bits, Signed> const& rhs)
+{
+	using bigint_type = fixed_bigint<Bits, Signed>;
+
+	typename bigint_type::vector_type result{};
+	bigint_algo::gcd(result,
+		bigint_type::abs(lhs.m_data),
+		bigint_type::abs(rhs.m_data));
+	return bigint_type(result);
+}
+
+/**
+ *	@brief	lhs * x + rhs * y == gcd(lhs, rhs) となる x, y を求める
+ *
+ *	符号なしの場合、x と y の一方は 2^Bits を法として負の値を表す。
+ */
+template <hamon::size_t Bits, bool Signed>
+inline HAMON_CXX14_CONSTEXPR hamon::extended_gcd_result<fixed_bigint<Bits, Signed>>
+extended_gcd(fixed_bigint<Bits, Signed> const& lhs, fixed_bigint<Bits, Signed> const& rhs)
+{
+	using bigint_type = fixed_bigint<Bits, Signed>;
+
+	typename bigint_type::vector_type g{};
+	typename bigint_type::vector_type x{};
+	typename bigint_type::vector_type y{};
+	bool const neg = bigint_algo::extended_gcd(g, x, y,
+		bigint_type::abs(lhs.m_data),
+		bigint_type::abs(rhs.m_data));
+
+	// |lhs| * x' + |rhs| * y' == gcd で、x' と y' の符号は逆
+	if (neg != (Signed && bigint_algo::signbit(lhs.m_data)))
+	{
+		bigint_algo::negate(x);
+	}
+	if (neg == (Signed && bigint_algo::signbit(rhs.m_data)))
+	{
+		bigint_algo::negate(y);
+	}
+	return {bigint_type(g), bigint_type(x), bigint_type(y)};
+}
+
+/**
+ *	@brief	x * y ≡ 1 (mod |mod|) となる 0 以上 |mod| 未満の y を返す
+ *
+ *	逆元が無い(gcd(x, mod) != 1)場合や mod が 0 の場合は 0 を返す。
+ */
+template <hamon::size_t Bits, bool Signed>
+inline HAMON_CXX14_CONSTEXPR fixed_bigint<Bits, Signed>
+modinv(fixed_bigint<Bits, Signed> const& x, fixed_bigint<Bits, Signed> const& mod)
+{
+	using bigint_type = fixed_bigint<Bits, Signed>;
+
+	auto const m = bigint_type::abs(mod.m_data);
+	if (bigint_algo::is_zero(m))
+	{
+		return bigint_type{};
+	}
+
+	typename bigint_type::vector_type result{};
+	bigint_algo::modinv(result, bigint_type::nonnegative_mod(x.m_data, m), m);
+	return bigint_type(result);
+}
+
+/**
+ *	@brief	fixed_bigint 用の barrett_reducer
+ *
+ *	前計算の結果も含めて固定長の配列に格納するので、定数式でも使える。
+ */
+template <hamon::size_t Bits, bool Signed>
+class barrett_reducer<fixed_bigint<Bits, Signed>>
+{
+private:
+	using bigint_type = fixed_bigint<Bits, Signed>;
+	using vector_type = typename bigint_type::vector_type;
+
+public:
+	explicit HAMON_CXX14_CONSTEXPR
+	barrett_reducer(bigint_type const& mod)
+		: m_reducer(bigint_type::abs(mod.m_data))
+	{}
+
+	// |m|
+	HAMON_CXX14_CONSTEXPR bigint_type
+	modulus() const HAMON_NOEXCEPT
+	{
+		return bigint_type(m_reducer.modulus());
+	}
+
+	// x mod |m|
+	HAMON_CXX14_CONSTEXPR bigint_type
+	reduce(bigint_type const& x) const HAMON_NOEXCEPT
+	{
+		auto const& m = m_reducer.modulus();
+		if (bigint_algo::is_zero(m))
+		{
+			return x;
+		}
+
+		vector_type r{};
+		m_reducer.reduce(r, bigint_type::abs(x.m_data));
+		return bigint_type(negate_mod(r, Signed && bigint_algo::signbit(x.m_data)));
+	}
+
+	// lhs * rhs mod |m|
+	HAMON_CXX14_CONSTEXPR bigint_type
+	mul(bigint_type const& lhs, bigint_type const& rhs) const HAMON_NOEXCEPT
+	{
+		auto const& m = m_reducer.modulus();
+		if (bigint_algo::is_zero(m))
+		{
+			return lhs * rhs;
+		}
+
+		vector_type r{};
+		m_reducer.mul(r, bigint_type::abs(lhs.m_data), bigint_type::abs(rhs.m_data));
+		return bigint_type(negate_mod(r,
+			Signed && bigint_algo::signbit(lhs.m_data) != bigint_algo::signbit(rhs.m_data)));
+	}
+
+private:
+	// neg なら -r mod |m| を返す
+	HAMON_CXX14_CONSTEXPR vector_type
+	negate_mod(vector_type const& r, bool neg) const HAMON_NOEXCEPT
+	{
+		if (!neg || bigint_algo::is_zero(r))
+		{
+			return r;
+		}
+		auto t = m_reducer.modulus();
+		bigint_algo::sub(t, r);
+		return t;
+	}
+
+	bigint_algo::barrett_reducer<vector_type>	m_reducer;
+};
+
 //template <typename CharT, typename Traits>
 //inline std::basic_istream<CharT, Traits>&
 //operator>>(std::basic_istream<CharT, Traits>& is, fixed_bigint& x);
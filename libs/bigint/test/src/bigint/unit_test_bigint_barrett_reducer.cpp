@@ -0,0 +1,149 @@
+﻿/**
+ *	@file	unit_test_bigint_barrett_reducer.cpp
+ *
+ *	@brief	barrett_reducer のテスト
+ */
+
+#include <hamon/bigint.hpp>
+#include <gtest/gtest.h>
+#include "constexpr_test.hpp"
+
+namespace hamon_bigint_test
+{
+
+namespace bigint_barrett_reducer_test
+{
+
+#define VERIFY(...)	if (!(__VA_ARGS__)) { return false; }
+
+template <typename BigInt>
+inline HAMON_CXX14_CONSTEXPR bool
+UnsignedBarrettReducerTest()
+{
+	{
+		hamon::barrett_reducer<BigInt> const r(BigInt{1000});
+		VERIFY(r.modulus() == 1000);
+		VERIFY(r.reduce(BigInt{0}) == 0);
+		VERIFY(r.reduce(BigInt{999}) == 999);
+		VERIFY(r.reduce(BigInt{1000}) == 0);
+		VERIFY(r.reduce(BigInt{123456}) == 456);
+		VERIFY(r.mul(BigInt{123}, BigInt{456}) == 88);
+		VERIFY(r.mul(BigInt{123456}, BigInt{789}) == 784);
+	}
+	{
+		hamon::barrett_reducer<BigInt> const r(BigInt{1});
+		VERIFY(r.reduce(BigInt{123}) == 0);
+		VERIFY(r.mul(BigInt{123}, BigInt{456}) == 0);
+	}
+	{
+		// m が 0 の場合はそのまま返す
+		hamon::barrett_reducer<BigInt> const r(BigInt{0});
+		VERIFY(r.reduce(BigInt{123}) == 123);
+		VERIFY(r.mul(BigInt{123}, BigInt{456}) == 56088);
+	}
+	return true;
+}
+
+template <typename BigInt>
+inline HAMON_CXX14_CONSTEXPR bool
+SignedBarrettReducerTest()
+{
+	// 結果は 0 以上 |m| 未満
+	{
+		hamon::barrett_reducer<BigInt> const r(BigInt{1000});
+		VERIFY(r.reduce(BigInt{-1}) == 999);
+		VERIFY(r.reduce(BigInt{-1000}) == 0);
+		VERIFY(r.reduce(BigInt{-123456}) == 544);
+		VERIFY(r.mul(BigInt{-3}, BigInt{ 4}) == 988);
+		VERIFY(r.mul(BigInt{ 3}, BigInt{-4}) == 988);
+		VERIFY(r.mul(BigInt{-3}, BigInt{-4}) == 12);
+		VERIFY(r.mul(BigInt{-500}, BigInt{2}) == 0);
+	}
+	{
+		hamon::barrett_reducer<BigInt> const r(BigInt{-1000});
+		VERIFY(r.modulus() == 1000);
+		VERIFY(r.reduce(BigInt{123456}) == 456);
+		VERIFY(r.reduce(BigInt{-1}) == 999);
+	}
+	{
+		hamon::barrett_reducer<BigInt> const r(BigInt{0});
+		VERIFY(r.reduce(BigInt{-123}) == -123);
+		VERIFY(r.mul(BigInt{-123}, BigInt{456}) == -56088);
+	}
+	return true;
+}
+
+template <typename BigInt>
+inline HAMON_CXX14_CONSTEXPR bool
+UnsignedBarrettReducerTest2()
+{
+	BigInt const a{"0xFEDCBA9876543210FEDCBA9876543210FEDCBA9876543210"};
+	BigInt const b{"0x123456789ABCDEF0123456789ABCDEF"};
+	{
+		hamon::barrett_reducer<BigInt> const r(BigInt{"0x7FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF"});
+		VERIFY(r.reduce(a) == BigInt{"168628817385265060839367238450463675953"});
+		VERIFY(r.mul(a, b) == BigInt{"19301151933105674915672982699806980801"});
+	}
+	{
+		hamon::barrett_reducer<BigInt> const r(BigInt{"0x30000000000000000000000000"});
+		VERIFY(r.reduce(a) == BigInt{"670446317473717854914657661456"});
+		VERIFY(r.mul(a, b) == BigInt{"2572510658052534925781706575088"});
+	}
+	return true;
+}
+
+template <typename BigInt>
+inline HAMON_CXX14_CONSTEXPR bool
+SignedBarrettReducerTest2()
+{
+	BigInt const a{"0xFEDCBA9876543210FEDCBA9876543210FEDCBA9876543210"};
+	BigInt const b{"0x123456789ABCDEF0123456789ABCDEF"};
+	hamon::barrett_reducer<BigInt> const r(BigInt{"0x7FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF"});
+	VERIFY(r.reduce(-a) == BigInt{"1512366075204170892320065265420429774"});
+	VERIFY(r.mul(-a, b) == BigInt{"150840031527363556816014321016077124926"});
+	return true;
+}
+
+#undef VERIFY
+
+GTEST_TEST(BigIntTest, BarrettReducerTest)
+{
+	EXPECT_TRUE(UnsignedBarrettReducerTest<hamon::bigint>());
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(UnsignedBarrettReducerTest<hamon::int128_t>());
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(UnsignedBarrettReducerTest<hamon::int256_t>());
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(UnsignedBarrettReducerTest<hamon::int512_t>());
+	/*HAMON_CXX14_CONSTEXPR_*/EXPECT_TRUE(UnsignedBarrettReducerTest<hamon::int1024_t>());
+	/*HAMON_CXX14_CONSTEXPR_*/EXPECT_TRUE(UnsignedBarrettReducerTest<hamon::int2048_t>());
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(UnsignedBarrettReducerTest<hamon::uint128_t>());
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(UnsignedBarrettReducerTest<hamon::uint256_t>());
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(UnsignedBarrettReducerTest<hamon::uint512_t>());
+	/*HAMON_CXX14_CONSTEXPR_*/EXPECT_TRUE(UnsignedBarrettReducerTest<hamon::uint1024_t>());
+	/*HAMON_CXX14_CONSTEXPR_*/EXPECT_TRUE(UnsignedBarrettReducerTest<hamon::uint2048_t>());
+
+	EXPECT_TRUE(SignedBarrettReducerTest<hamon::bigint>());
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(SignedBarrettReducerTest<hamon::int128_t>());
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(SignedBarrettReducerTest<hamon::int256_t>());
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(SignedBarrettReducerTest<hamon::int512_t>());
+	/*HAMON_CXX14_CONSTEXPR_*/EXPECT_TRUE(SignedBarrettReducerTest<hamon::int1024_t>());
+	/*HAMON_CXX14_CONSTEXPR_*/EXPECT_TRUE(SignedBarrettReducerTest<hamon::int2048_t>());
+
+	EXPECT_TRUE(UnsignedBarrettReducerTest2<hamon::bigint>());
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(UnsignedBarrettReducerTest2<hamon::int256_t>());
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(UnsignedBarrettReducerTest2<hamon::int512_t>());
+	/*HAMON_CXX14_CONSTEXPR_*/EXPECT_TRUE(UnsignedBarrettReducerTest2<hamon::int1024_t>());
+	/*HAMON_CXX14_CONSTEXPR_*/EXPECT_TRUE(UnsignedBarrettReducerTest2<hamon::int2048_t>());
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(UnsignedBarrettReducerTest2<hamon::uint256_t>());
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(UnsignedBarrettReducerTest2<hamon::uint512_t>());
+	/*HAMON_CXX14_CONSTEXPR_*/EXPECT_TRUE(UnsignedBarrettReducerTest2<hamon::uint1024_t>());
+	/*HAMON_CXX14_CONSTEXPR_*/EXPECT_TRUE(UnsignedBarrettReducerTest2<hamon::uint2048_t>());
+
+	EXPECT_TRUE(SignedBarrettReducerTest2<hamon::bigint>());
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(SignedBarrettReducerTest2<hamon::int256_t>());
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(SignedBarrettReducerTest2<hamon::int512_t>());
+	/*HAMON_CXX14_CONSTEXPR_*/EXPECT_TRUE(SignedBarrettReducerTest2<hamon::int1024_t>());
+	/*HAMON_CXX14_CONSTEXPR_*/EXPECT_TRUE(SignedBarrettReducerTest2<hamon::int2048_t>());
+}
+
+}	// namespace bigint_barrett_reducer_test
+
+}	// namespace hamon_bigint_test
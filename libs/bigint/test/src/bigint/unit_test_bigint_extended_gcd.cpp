@@ -0,0 +1,133 @@
+﻿/**
+ *	@file	unit_test_bigint_extended_gcd.cpp
+ *
+ *	@brief	extended_gcd のテスト
+ */
+
+#include <hamon/bigint.hpp>
+#include <gtest/gtest.h>
+#include "constexpr_test.hpp"
+
+namespace hamon_bigint_test
+{
+
+namespace bigint_extended_gcd_test
+{
+
+#define VERIFY(...)	if (!(__VA_ARGS__)) { return false; }
+
+template <typename BigInt>
+inline HAMON_CXX14_CONSTEXPR bool
+ExtendedGcdTest(BigInt const& a, BigInt const& b, BigInt const& g)
+{
+	// 符号なしの場合も、2^Bits を法として a * x + b * y == gcd が成り立つ
+	auto const r = hamon::extended_gcd(a, b);
+	VERIFY(r.gcd == g);
+	VERIFY(a * r.x + b * r.y == r.gcd);
+	return true;
+}
+
+template <typename BigInt>
+inline HAMON_CXX14_CONSTEXPR bool
+UnsignedExtendedGcdTest()
+{
+	VERIFY(ExtendedGcdTest(BigInt{240}, BigInt{46}, BigInt{2}));
+	VERIFY(ExtendedGcdTest(BigInt{46}, BigInt{240}, BigInt{2}));
+	VERIFY(ExtendedGcdTest(BigInt{17}, BigInt{5}, BigInt{1}));
+	VERIFY(ExtendedGcdTest(BigInt{7}, BigInt{7}, BigInt{7}));
+	VERIFY(ExtendedGcdTest(BigInt{0}, BigInt{12}, BigInt{12}));
+	VERIFY(ExtendedGcdTest(BigInt{12}, BigInt{0}, BigInt{12}));
+	VERIFY(ExtendedGcdTest(
+		BigInt{"0x7EDCBA9876543210FEDCBA9876543200"},
+		BigInt{"0x0F1E2D3C4B5A69788796A5B4C3D2E1F0"},
+		BigInt{48}));
+	{
+		auto const r = hamon::extended_gcd(BigInt{0}, BigInt{0});
+		VERIFY(r.gcd == 0);
+	}
+	return true;
+}
+
+template <typename BigInt>
+inline HAMON_CXX14_CONSTEXPR bool
+SignedExtendedGcdTest()
+{
+	{
+		auto const r = hamon::extended_gcd(BigInt{240}, BigInt{46});
+		VERIFY(r.gcd == 2);
+		VERIFY(r.x == -9);
+		VERIFY(r.y == 47);
+	}
+	{
+		auto const r = hamon::extended_gcd(BigInt{-240}, BigInt{46});
+		VERIFY(r.gcd == 2);
+		VERIFY(r.x == 9);
+		VERIFY(r.y == 47);
+	}
+	{
+		auto const r = hamon::extended_gcd(BigInt{240}, BigInt{-46});
+		VERIFY(r.gcd == 2);
+		VERIFY(r.x == -9);
+		VERIFY(r.y == -47);
+	}
+	{
+		auto const r = hamon::extended_gcd(BigInt{-240}, BigInt{-46});
+		VERIFY(r.gcd == 2);
+		VERIFY(r.x == 9);
+		VERIFY(r.y == -47);
+	}
+	VERIFY(ExtendedGcdTest(BigInt{-12}, BigInt{0}, BigInt{12}));
+	VERIFY(ExtendedGcdTest(BigInt{0}, BigInt{-12}, BigInt{12}));
+	VERIFY(ExtendedGcdTest(
+		-BigInt{"0x7EDCBA9876543210FEDCBA9876543200"},
+		BigInt{"0x0F1E2D3C4B5A69788796A5B4C3D2E1F0"},
+		BigInt{48}));
+	return true;
+}
+
+template <typename BigInt>
+inline HAMON_CXX14_CONSTEXPR bool
+SignedExtendedGcdTest2()
+{
+	auto const r = hamon::extended_gcd(
+		BigInt{"4281743078117879641317947884008060135004962801"},
+		BigInt{"7145929705339707730067618080425315925827"});
+	VERIFY(r.gcd == BigInt{"6917529027641081853"});
+	VERIFY(r.x == BigInt{"380255890588570777232"});
+	VERIFY(r.y == -BigInt{"227844114702743537875716977"});
+	return true;
+}
+
+#undef VERIFY
+
+GTEST_TEST(BigIntTest, ExtendedGcdTest)
+{
+	EXPECT_TRUE(UnsignedExtendedGcdTest<hamon::bigint>());
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(UnsignedExtendedGcdTest<hamon::int128_t>());
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(UnsignedExtendedGcdTest<hamon::int256_t>());
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(UnsignedExtendedGcdTest<hamon::int512_t>());
+	/*HAMON_CXX14_CONSTEXPR_*/EXPECT_TRUE(UnsignedExtendedGcdTest<hamon::int1024_t>());
+	/*HAMON_CXX14_CONSTEXPR_*/EXPECT_TRUE(UnsignedExtendedGcdTest<hamon::int2048_t>());
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(UnsignedExtendedGcdTest<hamon::uint128_t>());
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(UnsignedExtendedGcdTest<hamon::uint256_t>());
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(UnsignedExtendedGcdTest<hamon::uint512_t>());
+	/*HAMON_CXX14_CONSTEXPR_*/EXPECT_TRUE(UnsignedExtendedGcdTest<hamon::uint1024_t>());
+	/*HAMON_CXX14_CONSTEXPR_*/EXPECT_TRUE(UnsignedExtendedGcdTest<hamon::uint2048_t>());
+
+	EXPECT_TRUE(SignedExtendedGcdTest<hamon::bigint>());
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(SignedExtendedGcdTest<hamon::int128_t>());
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(SignedExtendedGcdTest<hamon::int256_t>());
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(SignedExtendedGcdTest<hamon::int512_t>());
+	/*HAMON_CXX14_CONSTEXPR_*/EXPECT_TRUE(SignedExtendedGcdTest<hamon::int1024_t>());
+	/*HAMON_CXX14_CONSTEXPR_*/EXPECT_TRUE(SignedExtendedGcdTest<hamon::int2048_t>());
+
+	EXPECT_TRUE(SignedExtendedGcdTest2<hamon::bigint>());
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(SignedExtendedGcdTest2<hamon::int256_t>());
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(SignedExtendedGcdTest2<hamon::int512_t>());
+	/*HAMON_CXX14_CONSTEXPR_*/EXPECT_TRUE(SignedExtendedGcdTest2<hamon::int1024_t>());
+	/*HAMON_CXX14_CONSTEXPR_*/EXPECT_TRUE(SignedExtendedGcdTest2<hamon::int2048_t>());
+}
+
+}	// namespace bigint_extended_gcd_test
+
+}	// namespace hamon_bigint_test
@@ -0,0 +1,116 @@
+﻿/**
+ *	@file	unit_test_bigint_gcd.cpp
+ *
+ *	@brief	gcd のテスト
+ */
+
+#include <hamon/bigint.hpp>
+#include <hamon/numeric.hpp>
+#include <gtest/gtest.h>
+#include "constexpr_test.hpp"
+
+namespace hamon_bigint_test
+{
+
+namespace bigint_gcd_test
+{
+
+#define VERIFY(...)	if (!(__VA_ARGS__)) { return false; }
+
+template <typename BigInt>
+inline HAMON_CXX14_CONSTEXPR bool
+UnsignedGcdTest()
+{
+	VERIFY(hamon::gcd(BigInt{0}, BigInt{0}) == 0);
+	VERIFY(hamon::gcd(BigInt{0}, BigInt{12}) == 12);
+	VERIFY(hamon::gcd(BigInt{12}, BigInt{0}) == 12);
+	VERIFY(hamon::gcd(BigInt{12}, BigInt{18}) == 6);
+	VERIFY(hamon::gcd(BigInt{18}, BigInt{12}) == 6);
+	VERIFY(hamon::gcd(BigInt{17}, BigInt{5}) == 1);
+	VERIFY(hamon::gcd(BigInt{7}, BigInt{7}) == 7);
+	VERIFY(hamon::gcd(
+		BigInt{"0x7EDCBA9876543210FEDCBA9876543200"},
+		BigInt{"0x0F1E2D3C4B5A69788796A5B4C3D2E1F0"}) == 48);
+	VERIFY(hamon::gcd(
+		BigInt{"0x10000000000000000"},
+		BigInt{"0x300000000"}) == BigInt{"0x100000000"});
+	return true;
+}
+
+template <typename BigInt>
+inline HAMON_CXX14_CONSTEXPR bool
+SignedGcdTest()
+{
+	// 結果は常に 0 以上
+	VERIFY(hamon::gcd(BigInt{-12}, BigInt{ 18}) == 6);
+	VERIFY(hamon::gcd(BigInt{ 12}, BigInt{-18}) == 6);
+	VERIFY(hamon::gcd(BigInt{-12}, BigInt{-18}) == 6);
+	VERIFY(hamon::gcd(BigInt{-12}, BigInt{  0}) == 12);
+	VERIFY(hamon::gcd(BigInt{  0}, BigInt{-12}) == 12);
+	return true;
+}
+
+template <typename BigInt>
+inline HAMON_CXX14_CONSTEXPR bool
+UnsignedGcdTest2()
+{
+	// 共通因数 (2^61 - 1) * 3
+	VERIFY(hamon::gcd(
+		BigInt{"4281743078117879641317947884008060135004962801"},
+		BigInt{"7145929705339707730067618080425315925827"}) ==
+		BigInt{"6917529027641081853"});
+
+	// 隣り合うフィボナッチ数は互いに素
+	VERIFY(hamon::gcd(
+		BigInt{"222232244629420445529739893461909967206666939096499764990979600"},
+		BigInt{"137347080577163115432025771710279131845700275212767467264610201"}) == 1);
+	return true;
+}
+
+#undef VERIFY
+
+GTEST_TEST(BigIntTest, GcdTest)
+{
+	EXPECT_TRUE(UnsignedGcdTest<hamon::bigint>());
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(UnsignedGcdTest<hamon::int128_t>());
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(UnsignedGcdTest<hamon::int256_t>());
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(UnsignedGcdTest<hamon::int512_t>());
+	/*HAMON_CXX14_CONSTEXPR_*/EXPECT_TRUE(UnsignedGcdTest<hamon::int1024_t>());
+	/*HAMON_CXX14_CONSTEXPR_*/EXPECT_TRUE(UnsignedGcdTest<hamon::int2048_t>());
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(UnsignedGcdTest<hamon::uint128_t>());
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(UnsignedGcdTest<hamon::uint256_t>());
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(UnsignedGcdTest<hamon::uint512_t>());
+	/*HAMON_CXX14_CONSTEXPR_*/EXPECT_TRUE(UnsignedGcdTest<hamon::uint1024_t>());
+	/*HAMON_CXX14_CONSTEXPR_*/EXPECT_TRUE(UnsignedGcdTest<hamon::uint2048_t>());
+
+	EXPECT_TRUE(SignedGcdTest<hamon::bigint>());
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(SignedGcdTest<hamon::int128_t>());
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(SignedGcdTest<hamon::int256_t>());
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(SignedGcdTest<hamon::int512_t>());
+	/*HAMON_CXX14_CONSTEXPR_*/EXPECT_TRUE(SignedGcdTest<hamon::int1024_t>());
+	/*HAMON_CXX14_CONSTEXPR_*/EXPECT_TRUE(SignedGcdTest<hamon::int2048_t>());
+
+	EXPECT_TRUE(UnsignedGcdTest2<hamon::bigint>());
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(UnsignedGcdTest2<hamon::int256_t>());
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(UnsignedGcdTest2<hamon::int512_t>());
+	/*HAMON_CXX14_CONSTEXPR_*/EXPECT_TRUE(UnsignedGcdTest2<hamon::int1024_t>());
+	/*HAMON_CXX14_CONSTEXPR_*/EXPECT_TRUE(UnsignedGcdTest2<hamon::int2048_t>());
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(UnsignedGcdTest2<hamon::uint256_t>());
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(UnsignedGcdTest2<hamon::uint512_t>());
+	/*HAMON_CXX14_CONSTEXPR_*/EXPECT_TRUE(UnsignedGcdTest2<hamon::uint1024_t>());
+	/*HAMON_CXX14_CONSTEXPR_*/EXPECT_TRUE(UnsignedGcdTest2<hamon::uint2048_t>());
+}
+
+GTEST_TEST(BigIntTest, NumericGcdTest)
+{
+	// <hamon/numeric.hpp> の gcd と一緒に使える
+	EXPECT_EQ(6, hamon::gcd(12, 18));
+	EXPECT_EQ(6u, hamon::gcd(12u, 18u));
+	EXPECT_EQ(hamon::bigint{6}, hamon::gcd(hamon::bigint{12}, hamon::bigint{18}));
+	EXPECT_EQ(hamon::int256_t{6}, hamon::gcd(hamon::int256_t{12}, hamon::int256_t{18}));
+	EXPECT_EQ(hamon::uint128_t{6}, hamon::gcd(hamon::uint128_t{12}, hamon::uint128_t{18}));
+}
+
+}	// namespace bigint_gcd_test
+
+}	// namespace hamon_bigint_test
@@ -0,0 +1,88 @@
+﻿/**
+ *	@file	unit_test_bigint_modinv.cpp
+ *
+ *	@brief	modinv のテスト
+ */
+
+#include <hamon/bigint.hpp>
+#include <gtest/gtest.h>
+#include "constexpr_test.hpp"
+
+namespace hamon_bigint_test
+{
+
+namespace bigint_modinv_test
+{
+
+#define VERIFY(...)	if (!(__VA_ARGS__)) { return false; }
+
+template <typename BigInt>
+inline HAMON_CXX14_CONSTEXPR bool
+UnsignedModinvTest()
+{
+	VERIFY(hamon::modinv(BigInt{3}, BigInt{11}) == 4);
+	VERIFY(hamon::modinv(BigInt{10}, BigInt{17}) == 12);
+	VERIFY(hamon::modinv(BigInt{7}, BigInt{1000}) == 143);
+	VERIFY(hamon::modinv(BigInt{1007}, BigInt{1000}) == 143);
+	VERIFY(hamon::modinv(BigInt{1}, BigInt{2}) == 1);
+	VERIFY(hamon::modinv(BigInt{5}, BigInt{1}) == 0);
+
+	// 逆元が無い場合は 0
+	VERIFY(hamon::modinv(BigInt{4}, BigInt{8}) == 0);
+	VERIFY(hamon::modinv(BigInt{0}, BigInt{7}) == 0);
+	VERIFY(hamon::modinv(BigInt{3}, BigInt{0}) == 0);
+
+	VERIFY(hamon::modinv(
+		BigInt{"0xFEDCBA9876543211"},
+		BigInt{"0x7FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF"}) ==
+		BigInt{"73488626425238277634474289526142589571"});
+	VERIFY(hamon::modinv(
+		BigInt{65537},
+		BigInt{"3762257022306109707409435382814499840"}) ==
+		BigInt{"1553595095818701603851588412120005633"});
+	return true;
+}
+
+template <typename BigInt>
+inline HAMON_CXX14_CONSTEXPR bool
+SignedModinvTest()
+{
+	// 結果は 0 以上 |mod| 未満
+	VERIFY(hamon::modinv(BigInt{-3}, BigInt{ 11}) == 7);
+	VERIFY(hamon::modinv(BigInt{ 3}, BigInt{-11}) == 4);
+	VERIFY(hamon::modinv(BigInt{-3}, BigInt{-11}) == 7);
+	VERIFY(hamon::modinv(BigInt{-4}, BigInt{  8}) == 0);
+	VERIFY(hamon::modinv(
+		-BigInt{"0xFEDCBA9876543211"},
+		BigInt{"0x7FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF"}) ==
+		BigInt{"96652557035230954097213014189741516156"});
+	return true;
+}
+
+#undef VERIFY
+
+GTEST_TEST(BigIntTest, ModinvTest)
+{
+	EXPECT_TRUE(UnsignedModinvTest<hamon::bigint>());
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(UnsignedModinvTest<hamon::int128_t>());
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(UnsignedModinvTest<hamon::int256_t>());
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(UnsignedModinvTest<hamon::int512_t>());
+	/*HAMON_CXX14_CONSTEXPR_*/EXPECT_TRUE(UnsignedModinvTest<hamon::int1024_t>());
+	/*HAMON_CXX14_CONSTEXPR_*/EXPECT_TRUE(UnsignedModinvTest<hamon::int2048_t>());
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(UnsignedModinvTest<hamon::uint128_t>());
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(UnsignedModinvTest<hamon::uint256_t>());
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(UnsignedModinvTest<hamon::uint512_t>());
+	/*HAMON_CXX14_CONSTEXPR_*/EXPECT_TRUE(UnsignedModinvTest<hamon::uint1024_t>());
+	/*HAMON_CXX14_CONSTEXPR_*/EXPECT_TRUE(UnsignedModinvTest<hamon::uint2048_t>());
+
+	EXPECT_TRUE(SignedModinvTest<hamon::bigint>());
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(SignedModinvTest<hamon::int128_t>());
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(SignedModinvTest<hamon::int256_t>());
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(SignedModinvTest<hamon::int512_t>());
+	/*HAMON_CXX14_CONSTEXPR_*/EXPECT_TRUE(SignedModinvTest<hamon::int1024_t>());
+	/*HAMON_CXX14_CONSTEXPR_*/EXPECT_TRUE(SignedModinvTest<hamon::int2048_t>());
+}
+
+}	// namespace bigint_modinv_test
+
+}	// namespace hamon_bigint_test
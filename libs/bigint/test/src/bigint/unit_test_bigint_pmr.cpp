@@ -0,0 +1,126 @@
+﻿/**
+ *	@file	unit_test_bigint_pmr.cpp
+ *
+ *	@brief	pmr::bigint のテスト
+ */
+
+#include <hamon/bigint.hpp>
+#include <hamon/memory_resource/memory_resource.hpp>
+#include <hamon/memory_resource/new_delete_resource.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/utility/move.hpp>
+#include <gtest/gtest.h>
+
+namespace hamon_bigint_test
+{
+
+namespace bigint_pmr_test
+{
+
+// 確保の回数を数えるメモリリソース
+class counting_resource : public hamon::pmr::memory_resource
+{
+public:
+	hamon::size_t allocate_count = 0;
+	hamon::size_t deallocate_count = 0;
+
+private:
+	void* do_allocate(hamon::size_t bytes, hamon::size_t alignment) override
+	{
+		++allocate_count;
+		return hamon::pmr::new_delete_resource()->allocate(bytes, alignment);
+	}
+
+	void do_deallocate(void* p, hamon::size_t bytes, hamon::size_t alignment) override
+	{
+		++deallocate_count;
+		hamon::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+	}
+
+	bool do_is_equal(hamon::pmr::memory_resource const& other) const noexcept override
+	{
+		return this == &other;
+	}
+};
+
+GTEST_TEST(BigIntTest, PmrSmallValueTest)
+{
+	// 128bit に収まる値の演算では、メモリ確保を行わない
+	counting_resource mr;
+	{
+		hamon::pmr::bigint const a("0xFEDCBA9876543210FEDCBA9876543210", &mr);
+		hamon::pmr::bigint const b("0x0F1E2D3C4B5A69788796A5B4C3D2E1F0", &mr);
+
+		EXPECT_EQ("358865107173706667769993744685789025280", hamon::to_string(a + b));
+		EXPECT_EQ("318674894517761917298656305468934279200", hamon::to_string(a - b));
+		EXPECT_EQ("-318674894517761917298656305468934279200", hamon::to_string(b - a));
+		EXPECT_EQ("6807619187722322092277246899869647113919133345203825520475553406417231609600", hamon::to_string(a * b));
+		EXPECT_EQ(a / b, 16);
+		EXPECT_EQ("17248299598176288763625511342523683600", hamon::to_string(a % b));
+		EXPECT_EQ("43362560108253989444393603209902291486720", hamon::to_string(a << 7));
+		EXPECT_EQ("286949352257704136", hamon::to_string(a >> 70));
+		EXPECT_EQ("18755389471410719937764067193144746000", hamon::to_string(a & b));
+		EXPECT_EQ("340109717702295947832229677492644279280", hamon::to_string(a | b));
+		EXPECT_EQ("321354328230885227894465610299499533280", hamon::to_string(a ^ b));
+		EXPECT_EQ("-338770000845734292534325025077361652241", hamon::to_string(~a));
+		EXPECT_TRUE(b < a);
+
+		hamon::pmr::bigint x(&mr);
+		for (int i = 0; i < 100; ++i)
+		{
+			x += a;
+			x -= b;
+			x *= 3;
+			x /= 5;
+			x %= a;
+			++x;
+		}
+		EXPECT_EQ(x.get_allocator().resource(), &mr);
+		EXPECT_TRUE(x < a);
+	}
+	EXPECT_EQ(0u, mr.allocate_count);
+}
+
+GTEST_TEST(BigIntTest, PmrLargeValueTest)
+{
+	// 大きな値のメモリは、左辺のメモリリソースから確保する
+	counting_resource mr;
+	{
+		hamon::pmr::bigint x(3, &mr);
+		for (int i = 0; i < 10; ++i)
+		{
+			x *= x;
+		}
+		// x = 3^1024
+		EXPECT_EQ(x.get_allocator().resource(), &mr);
+		EXPECT_NE(0u, mr.allocate_count);
+
+		auto const n = mr.allocate_count;
+		auto y = x * x + 1;
+		EXPECT_EQ(y.get_allocator().resource(), &mr);
+		EXPECT_LT(n, mr.allocate_count);
+		EXPECT_EQ((y - 1) / x, x);
+		EXPECT_EQ((y - 1) % x, 0);
+		EXPECT_EQ(y % x, 1);
+
+		// ムーブしても値とメモリリソースは変わらない
+		hamon::pmr::bigint z(hamon::move(y));
+		EXPECT_EQ(z.get_allocator().resource(), &mr);
+		EXPECT_EQ(z, x * x + 1);
+
+		hamon::pmr::bigint w(&mr);
+		w = hamon::move(z);
+		EXPECT_EQ(w, x * x + 1);
+
+		// 小さい値に戻しても正しく扱える
+		w %= 1000;
+		EXPECT_EQ(w, (x * x + 1) % 1000);
+		w = x;
+		EXPECT_EQ(w, x);
+	}
+	EXPECT_EQ(mr.allocate_count, mr.deallocate_count);
+}
+
+}	// namespace bigint_pmr_test
+
+}	// namespace hamon_bigint_test
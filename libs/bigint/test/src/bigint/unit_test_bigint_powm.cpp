@@ -0,0 +1,142 @@
+﻿/**
+ *	@file	unit_test_bigint_powm.cpp
+ *
+ *	@brief	powm のテスト
+ */
+
+#include <hamon/bigint.hpp>
+#include <gtest/gtest.h>
+#include "constexpr_test.hpp"
+
+namespace hamon_bigint_test
+{
+
+namespace bigint_powm_test
+{
+
+#define VERIFY(...)	if (!(__VA_ARGS__)) { return false; }
+
+template <typename BigInt>
+inline HAMON_CXX14_CONSTEXPR bool
+UnsignedPowmTest()
+{
+	VERIFY(hamon::powm(BigInt{4}, BigInt{13}, BigInt{497}) == 445);
+	VERIFY(hamon::powm(BigInt{3}, BigInt{200}, BigInt{1000}) == 1);
+	VERIFY(hamon::powm(BigInt{2}, BigInt{10}, BigInt{1024}) == 0);
+	VERIFY(hamon::powm(BigInt{2}, BigInt{10}, BigInt{1025}) == 1024);
+	VERIFY(hamon::powm(BigInt{123}, BigInt{0}, BigInt{7}) == 1);
+	VERIFY(hamon::powm(BigInt{0}, BigInt{0}, BigInt{7}) == 1);
+	VERIFY(hamon::powm(BigInt{0}, BigInt{5}, BigInt{7}) == 0);
+	VERIFY(hamon::powm(BigInt{123}, BigInt{5}, BigInt{1}) == 0);
+	VERIFY(hamon::powm(BigInt{123}, BigInt{0}, BigInt{1}) == 0);
+
+	// mod が 0 の場合は 0
+	VERIFY(hamon::powm(BigInt{123}, BigInt{5}, BigInt{0}) == 0);
+
+	// 奇数の法(モンゴメリ乗算)と偶数の法(Barrett reduction)
+	VERIFY(hamon::powm(
+		BigInt{"0xFEDCBA9876543210"},
+		BigInt{"0x123456789ABCDEF"},
+		BigInt{"0x7FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF"}) ==
+		BigInt{"87495595173172255746959235425512216740"});
+	VERIFY(hamon::powm(
+		BigInt{"0xFEDCBA9876543210"},
+		BigInt{"0x123456789ABCDEF"},
+		BigInt{"0x7FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFE"}) ==
+		BigInt{"97309079946530982802348405295920679790"});
+	return true;
+}
+
+template <typename BigInt>
+inline HAMON_CXX14_CONSTEXPR bool
+SignedPowmTest()
+{
+	// 結果は 0 以上 |mod| 未満
+	VERIFY(hamon::powm(BigInt{-4}, BigInt{13}, BigInt{497}) == 52);
+	VERIFY(hamon::powm(BigInt{-4}, BigInt{12}, BigInt{497}) == hamon::powm(BigInt{4}, BigInt{12}, BigInt{497}));
+	VERIFY(hamon::powm(BigInt{4}, BigInt{13}, BigInt{-497}) == 445);
+	VERIFY(hamon::powm(BigInt{-4}, BigInt{13}, BigInt{-497}) == 52);
+
+	// exp が負の場合は逆元の累乗
+	VERIFY(hamon::powm(BigInt{3}, BigInt{-1}, BigInt{11}) == 4);
+	VERIFY(hamon::powm(BigInt{3}, BigInt{-2}, BigInt{7}) == 4);
+	VERIFY(hamon::powm(BigInt{-3}, BigInt{-1}, BigInt{11}) == 7);
+	VERIFY(hamon::powm(BigInt{2}, BigInt{-1}, BigInt{4}) == 0);
+	VERIFY(hamon::powm(BigInt{2}, BigInt{-1}, BigInt{0}) == 0);
+	return true;
+}
+
+template <typename BigInt>
+inline HAMON_CXX14_CONSTEXPR bool
+RsaTest()
+{
+	// n = p * q、e * d ≡ 1 (mod (p-1)(q-1))
+	BigInt const n{"3762257022306109711431587912243772937"};
+	BigInt const e{65537};
+	BigInt const d{"1553595095818701603851588412120005633"};
+	BigInt const m{"0x48616D6F6E"};
+	BigInt const c{"656539317001529593772550848763338193"};
+	VERIFY(hamon::powm(m, e, n) == c);
+	VERIFY(hamon::powm(c, d, n) == m);
+	return true;
+}
+
+template <typename BigInt>
+inline HAMON_CXX14_CONSTEXPR bool
+RsaTest2()
+{
+	BigInt const n{"3083706437803207952161440278033057206607987191055791018112606829475554410127542571739705599194803700930704287708197681303741108980476263132357925465337"};
+	BigInt const e{65537};
+	BigInt const d{"532685972540246230776807992242736784350962402763974703084560201359426758579338896224246282535358088730173469787870092070965163537381761784014007051733"};
+	BigInt const m{"116311101400145335706395545518157795145603648353240218555741044"};
+	BigInt const c{"1355221383649674564299888199176506881536930822760166800444578125696689251433401099414492214713580210034537268470191666464739925409190736577929592562458"};
+	VERIFY(hamon::powm(m, e, n) == c);
+	VERIFY(hamon::powm(c, d, n) == m);
+	return true;
+}
+
+#undef VERIFY
+
+GTEST_TEST(BigIntTest, PowmTest)
+{
+	EXPECT_TRUE(UnsignedPowmTest<hamon::bigint>());
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(UnsignedPowmTest<hamon::int128_t>());
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(UnsignedPowmTest<hamon::int256_t>());
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(UnsignedPowmTest<hamon::int512_t>());
+	/*HAMON_CXX14_CONSTEXPR_*/EXPECT_TRUE(UnsignedPowmTest<hamon::int1024_t>());
+	/*HAMON_CXX14_CONSTEXPR_*/EXPECT_TRUE(UnsignedPowmTest<hamon::int2048_t>());
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(UnsignedPowmTest<hamon::uint128_t>());
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(UnsignedPowmTest<hamon::uint256_t>());
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(UnsignedPowmTest<hamon::uint512_t>());
+	/*HAMON_CXX14_CONSTEXPR_*/EXPECT_TRUE(UnsignedPowmTest<hamon::uint1024_t>());
+	/*HAMON_CXX14_CONSTEXPR_*/EXPECT_TRUE(UnsignedPowmTest<hamon::uint2048_t>());
+
+	EXPECT_TRUE(SignedPowmTest<hamon::bigint>());
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(SignedPowmTest<hamon::int128_t>());
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(SignedPowmTest<hamon::int256_t>());
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(SignedPowmTest<hamon::int512_t>());
+	/*HAMON_CXX14_CONSTEXPR_*/EXPECT_TRUE(SignedPowmTest<hamon::int1024_t>());
+	/*HAMON_CXX14_CONSTEXPR_*/EXPECT_TRUE(SignedPowmTest<hamon::int2048_t>());
+
+	EXPECT_TRUE(RsaTest<hamon::bigint>());
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(RsaTest<hamon::int128_t>());
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(RsaTest<hamon::int256_t>());
+	/*HAMON_CXX14_CONSTEXPR_*/EXPECT_TRUE(RsaTest<hamon::int512_t>());
+	/*HAMON_CXX14_CONSTEXPR_*/EXPECT_TRUE(RsaTest<hamon::int1024_t>());
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(RsaTest<hamon::uint128_t>());
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(RsaTest<hamon::uint256_t>());
+	/*HAMON_CXX14_CONSTEXPR_*/EXPECT_TRUE(RsaTest<hamon::uint512_t>());
+	/*HAMON_CXX14_CONSTEXPR_*/EXPECT_TRUE(RsaTest<hamon::uint1024_t>());
+
+	EXPECT_TRUE(RsaTest2<hamon::bigint>());
+	/*HAMON_CXX14_CONSTEXPR_*/EXPECT_TRUE(RsaTest2<hamon::int512_t>());
+	/*HAMON_CXX14_CONSTEXPR_*/EXPECT_TRUE(RsaTest2<hamon::int1024_t>());
+	/*HAMON_CXX14_CONSTEXPR_*/EXPECT_TRUE(RsaTest2<hamon::int2048_t>());
+	/*HAMON_CXX14_CONSTEXPR_*/EXPECT_TRUE(RsaTest2<hamon::uint512_t>());
+	/*HAMON_CXX14_CONSTEXPR_*/EXPECT_TRUE(RsaTest2<hamon::uint1024_t>());
+	/*HAMON_CXX14_CONSTEXPR_*/EXPECT_TRUE(RsaTest2<hamon::uint2048_t>());
+}
+
+}	// namespace bigint_powm_test
+
+}	// namespace hamon_bigint_test
@@ -0,0 +1,636 @@
+﻿/**
+ *	@file	unit_test_bigint_algo_barrett_reducer.cpp
+ *
+ *	@brief	bigint_algo::barrett_reducer のテスト
+ */
+
+#include <hamon/bigint/bigint_algo/barrett_reducer.hpp>
+#include <hamon/array.hpp>
+#include <hamon/cstdint.hpp>
+#include <hamon/vector.hpp>
+#include <gtest/gtest.h>
+#include "constexpr_test.hpp"
+
+namespace hamon_bigint_test
+{
+
+namespace bigint_algo_barrett_reducer_test
+{
+
+#define VERIFY(...)	if (!(__VA_ARGS__)) { return false; }
+
+template <typename VectorType>
+inline HAMON_CXX14_CONSTEXPR bool
+BarrettReducerTest(VectorType const& m, VectorType const& x, VectorType const& y, VectorType const& x_mod, VectorType const& xy_mod)
+{
+	hamon::bigint_algo::barrett_reducer<VectorType> const reducer(m);
+	VERIFY(reducer.modulus() == m);
+	{
+		VectorType c{};
+		reducer.reduce(c, x);
+		VERIFY(c == x_mod);
+	}
+	{
+		VectorType c{};
+		reducer.mul(c, x, y);
+		VERIFY(c == xy_mod);
+	}
+	// 出力と入力が同じオブジェクト
+	{
+		VectorType c = x;
+		reducer.reduce(c, c);
+		VERIFY(c == x_mod);
+	}
+	{
+		VectorType c = x;
+		reducer.mul(c, c, y);
+		VERIFY(c == xy_mod);
+	}
+	return true;
+}
+
+#undef VERIFY
+
+GTEST_TEST(BigIntAlgoTest, BarrettReducerTest)
+{
+	EXPECT_TRUE(BarrettReducerTest(
+		hamon::vector<hamon::uint8_t>{0x07},
+		hamon::vector<hamon::uint8_t>{0x08},
+		hamon::vector<hamon::uint8_t>{0x00},
+		hamon::vector<hamon::uint8_t>{0x01},
+		hamon::vector<hamon::uint8_t>{0x00}));
+	EXPECT_TRUE(BarrettReducerTest(
+		hamon::vector<hamon::uint8_t>{0x07},
+		hamon::vector<hamon::uint8_t>{0x32},
+		hamon::vector<hamon::uint8_t>{0x06},
+		hamon::vector<hamon::uint8_t>{0x01},
+		hamon::vector<hamon::uint8_t>{0x06}));
+	EXPECT_TRUE(BarrettReducerTest(
+		hamon::vector<hamon::uint8_t>{0x07},
+		hamon::vector<hamon::uint8_t>{0x24},
+		hamon::vector<hamon::uint8_t>{0x01},
+		hamon::vector<hamon::uint8_t>{0x01},
+		hamon::vector<hamon::uint8_t>{0x01}));
+	EXPECT_TRUE(BarrettReducerTest(
+		hamon::vector<hamon::uint8_t>{0xE8, 0x03},
+		hamon::vector<hamon::uint8_t>{0xE9, 0x03},
+		hamon::vector<hamon::uint8_t>{0x97, 0x01},
+		hamon::vector<hamon::uint8_t>{0x01},
+		hamon::vector<hamon::uint8_t>{0x97, 0x01}));
+	EXPECT_TRUE(BarrettReducerTest(
+		hamon::vector<hamon::uint8_t>{0xE8, 0x03},
+		hamon::vector<hamon::uint8_t>{0xB4, 0x5A, 0x0A},
+		hamon::vector<hamon::uint8_t>{0x0F, 0x03},
+		hamon::vector<hamon::uint8_t>{0x44, 0x02},
+		hamon::vector<hamon::uint8_t>{0x8C}));
+	EXPECT_TRUE(BarrettReducerTest(
+		hamon::vector<hamon::uint8_t>{0xE8, 0x03},
+		hamon::vector<hamon::uint8_t>{0x71, 0x3A, 0x0F},
+		hamon::vector<hamon::uint8_t>{0xDF, 0x01},
+		hamon::vector<hamon::uint8_t>{0x01},
+		hamon::vector<hamon::uint8_t>{0xDF, 0x01}));
+	EXPECT_TRUE(BarrettReducerTest(
+		hamon::vector<hamon::uint8_t>{0xFF, 0xFF},
+		hamon::vector<hamon::uint8_t>{0x00, 0x00, 0x01},
+		hamon::vector<hamon::uint8_t>{0xA0, 0x1A},
+		hamon::vector<hamon::uint8_t>{0x01},
+		hamon::vector<hamon::uint8_t>{0xA0, 0x1A}));
+	EXPECT_TRUE(BarrettReducerTest(
+		hamon::vector<hamon::uint8_t>{0xFF, 0xFF},
+		hamon::vector<hamon::uint8_t>{0xA4, 0x2D, 0x1F, 0xE6},
+		hamon::vector<hamon::uint8_t>{0x7E, 0x95},
+		hamon::vector<hamon::uint8_t>{0xC4, 0x13},
+		hamon::vector<hamon::uint8_t>{0x02, 0xDA}));
+	EXPECT_TRUE(BarrettReducerTest(
+		hamon::vector<hamon::uint8_t>{0xFF, 0xFF},
+		hamon::vector<hamon::uint8_t>{0x04, 0x00, 0xFC, 0xFF},
+		hamon::vector<hamon::uint8_t>{0x1E, 0x1B},
+		hamon::vector<hamon::uint8_t>{0x01},
+		hamon::vector<hamon::uint8_t>{0x1E, 0x1B}));
+	EXPECT_TRUE(BarrettReducerTest(
+		hamon::vector<hamon::uint8_t>{0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF},
+		hamon::vector<hamon::uint8_t>{0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF},
+		hamon::vector<hamon::uint8_t>{0x7E, 0x48, 0x70, 0xF7, 0x4E, 0x7A, 0x38, 0x6A},
+		hamon::vector<hamon::uint8_t>{0x01},
+		hamon::vector<hamon::uint8_t>{0x7E, 0x48, 0x70, 0xF7, 0x4E, 0x7A, 0x38, 0x6A}));
+	EXPECT_TRUE(BarrettReducerTest(
+		hamon::vector<hamon::uint8_t>{0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF},
+		hamon::vector<hamon::uint8_t>{0x55, 0x78, 0x30, 0xB9, 0x17, 0x70, 0xCE, 0x54, 0x96, 0xD4, 0x86, 0x54, 0x8E, 0x6D, 0x65, 0x87},
+		hamon::vector<hamon::uint8_t>{0xA7, 0x58, 0x0E, 0xC6, 0x4B, 0xF6, 0x69, 0x15},
+		hamon::vector<hamon::uint8_t>{0x0C, 0x7E, 0x43, 0x34, 0xE5, 0xAF, 0x2E, 0x89},
+		hamon::vector<hamon::uint8_t>{0x8F, 0xF6, 0xBE, 0xED, 0x3B, 0x22, 0xB9, 0xED}));
+	EXPECT_TRUE(BarrettReducerTest(
+		hamon::vector<hamon::uint8_t>{0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF},
+		hamon::vector<hamon::uint8_t>{0x10, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF},
+		hamon::vector<hamon::uint8_t>{0xF5, 0x5C, 0x8D, 0x20, 0x2A, 0x6D, 0x1C, 0xA5},
+		hamon::vector<hamon::uint8_t>{0x01},
+		hamon::vector<hamon::uint8_t>{0xF5, 0x5C, 0x8D, 0x20, 0x2A, 0x6D, 0x1C, 0xA5}));
+	EXPECT_TRUE(BarrettReducerTest(
+		hamon::vector<hamon::uint8_t>{0x61, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF},
+		hamon::vector<hamon::uint8_t>{0x62, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF},
+		hamon::vector<hamon::uint8_t>{0xD4, 0xEF, 0x9E, 0xDF, 0x0A, 0x91, 0x30, 0xAA, 0xCD, 0x90, 0x2A, 0xBB, 0xCF, 0x64, 0x73, 0x27},
+		hamon::vector<hamon::uint8_t>{0x01},
+		hamon::vector<hamon::uint8_t>{0xD4, 0xEF, 0x9E, 0xDF, 0x0A, 0x91, 0x30, 0xAA, 0xCD, 0x90, 0x2A, 0xBB, 0xCF, 0x64, 0x73, 0x27}));
+	EXPECT_TRUE(BarrettReducerTest(
+		hamon::vector<hamon::uint8_t>{0x61, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF},
+		hamon::vector<hamon::uint8_t>{0x32, 0x20, 0x03, 0xAA, 0x54, 0xE7, 0x7E, 0xB3, 0x0B, 0x7E, 0x54, 0x70, 0xE1, 0x9A, 0xB4, 0x2A, 0xDE, 0xB0, 0x57, 0x20, 0x26, 0x1A, 0x2E, 0xD9, 0x3F, 0xCF, 0x84, 0x14, 0x71, 0xC9, 0xE6, 0xC7},
+		hamon::vector<hamon::uint8_t>{0x15, 0xA1, 0xB6, 0xCE, 0xA9, 0xD5, 0xB9, 0x4E, 0xC1, 0x8A, 0xE3, 0x1B, 0xD0, 0x4C, 0xA8, 0xB0},
+		hamon::vector<hamon::uint8_t>{0x18, 0x47, 0x7A, 0xC0, 0x02, 0x25, 0x21, 0x97, 0xB3, 0x36, 0xD1, 0x2E, 0x1D, 0xB8, 0x0B, 0x53},
+		hamon::vector<hamon::uint8_t>{0xDC, 0x27, 0x34, 0x6D, 0x93, 0xB1, 0xF1, 0xA5, 0x8B, 0xA0, 0xED, 0xD2, 0x1D, 0xA0, 0x5D, 0x23}));
+	EXPECT_TRUE(BarrettReducerTest(
+		hamon::vector<hamon::uint8_t>{0x61, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF},
+		hamon::vector<hamon::uint8_t>{0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF},
+		hamon::vector<hamon::uint8_t>{0x37, 0x20, 0xBC, 0x6C, 0xB2, 0x78, 0x6D, 0x71, 0x98, 0xE4, 0x4E, 0x96, 0x4C, 0xAA, 0xB8, 0x09},
+		hamon::vector<hamon::uint8_t>{0x01},
+		hamon::vector<hamon::uint8_t>{0x37, 0x20, 0xBC, 0x6C, 0xB2, 0x78, 0x6D, 0x71, 0x98, 0xE4, 0x4E, 0x96, 0x4C, 0xAA, 0xB8, 0x09}));
+	EXPECT_TRUE(BarrettReducerTest(
+		hamon::vector<hamon::uint8_t>{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03},
+		hamon::vector<hamon::uint8_t>{0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03},
+		hamon::vector<hamon::uint8_t>{0xA6, 0x1D, 0xA5, 0x00, 0x0D, 0xD4, 0x12, 0x1B, 0x01},
+		hamon::vector<hamon::uint8_t>{0x01},
+		hamon::vector<hamon::uint8_t>{0xA6, 0x1D, 0xA5, 0x00, 0x0D, 0xD4, 0x12, 0x1B, 0x01}));
+	EXPECT_TRUE(BarrettReducerTest(
+		hamon::vector<hamon::uint8_t>{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03},
+		hamon::vector<hamon::uint8_t>{0x7D, 0x82, 0xCD, 0x51, 0x52, 0x2C, 0xD3, 0x0C, 0x18, 0xDC, 0x5A, 0xE0, 0x66, 0x89, 0x66, 0x97, 0x04},
+		hamon::vector<hamon::uint8_t>{0xF1, 0x2A, 0x9C, 0xCA, 0x85, 0xF5, 0x02, 0xFA, 0x01},
+		hamon::vector<hamon::uint8_t>{0x7D, 0x82, 0xCD, 0x51, 0x52, 0x2C, 0xD3, 0x0C, 0x01},
+		hamon::vector<hamon::uint8_t>{0xAD, 0x59, 0x0C, 0xE0, 0x0D, 0xA9, 0x68, 0xF3, 0x02}));
+	EXPECT_TRUE(BarrettReducerTest(
+		hamon::vector<hamon::uint8_t>{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03},
+		hamon::vector<hamon::uint8_t>{0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08},
+		hamon::vector<hamon::uint8_t>{0x9B, 0x6C, 0xD3, 0x1F, 0x17, 0xC5, 0x43, 0x20, 0x02},
+		hamon::vector<hamon::uint8_t>{0x01},
+		hamon::vector<hamon::uint8_t>{0x9B, 0x6C, 0xD3, 0x1F, 0x17, 0xC5, 0x43, 0x20, 0x02}));
+	EXPECT_TRUE(BarrettReducerTest(
+		hamon::vector<hamon::uint8_t>{0xE6, 0x1B, 0x56, 0xA6, 0x2D, 0x70, 0xE3, 0xAD, 0x8E, 0x44, 0xA0, 0x0F, 0x59, 0xDA, 0x16, 0x18, 0x35, 0x81, 0x44, 0xD8, 0x15, 0x64, 0x6C, 0x9F, 0x75},
+		hamon::vector<hamon::uint8_t>{0xE7, 0x1B, 0x56, 0xA6, 0x2D, 0x70, 0xE3, 0xAD, 0x8E, 0x44, 0xA0, 0x0F, 0x59, 0xDA, 0x16, 0x18, 0x35, 0x81, 0x44, 0xD8, 0x15, 0x64, 0x6C, 0x9F, 0x75},
+		hamon::vector<hamon::uint8_t>{0x67, 0xDE, 0x5F, 0x05, 0xF5, 0x00, 0x71, 0x97, 0x63, 0xAE, 0x02, 0x87, 0x25, 0x89, 0x01, 0x7C, 0x34, 0x18, 0x4A, 0x80, 0xC5, 0x13, 0xB1, 0xBF, 0x37},
+		hamon::vector<hamon::uint8_t>{0x01},
+		hamon::vector<hamon::uint8_t>{0x67, 0xDE, 0x5F, 0x05, 0xF5, 0x00, 0x71, 0x97, 0x63, 0xAE, 0x02, 0x87, 0x25, 0x89, 0x01, 0x7C, 0x34, 0x18, 0x4A, 0x80, 0xC5, 0x13, 0xB1, 0xBF, 0x37}));
+	EXPECT_TRUE(BarrettReducerTest(
+		hamon::vector<hamon::uint8_t>{0xE6, 0x1B, 0x56, 0xA6, 0x2D, 0x70, 0xE3, 0xAD, 0x8E, 0x44, 0xA0, 0x0F, 0x59, 0xDA, 0x16, 0x18, 0x35, 0x81, 0x44, 0xD8, 0x15, 0x64, 0x6C, 0x9F, 0x75},
+		hamon::vector<hamon::uint8_t>{0xFF, 0xA9, 0x38, 0x5E, 0x18, 0x1A, 0x71, 0xBA, 0x3B, 0x38, 0x9E, 0x2F, 0xC7, 0x72, 0x00, 0xAC, 0xB8, 0x39, 0xBF, 0x9A, 0xD6, 0x87, 0x02, 0x12, 0xEE, 0xD0, 0x1B, 0xF8, 0xD4, 0x06, 0x4C, 0xFE, 0xF9, 0xE4, 0x4D, 0x8D, 0x23, 0xD6, 0xA3, 0xA9, 0xFD, 0x59, 0x01, 0x1D, 0xCE, 0x97, 0x08, 0x4C, 0xAC, 0x1F},
+		hamon::vector<hamon::uint8_t>{0xE2, 0x32, 0xA5, 0xC0, 0x79, 0x57, 0x77, 0xD5, 0x7D, 0xB3, 0x39, 0xC9, 0xA7, 0x0A, 0xFB, 0xF8, 0xA8, 0x7E, 0xAC, 0x01, 0xFA, 0xDD, 0xCA, 0xB8, 0x0E},
+		hamon::vector<hamon::uint8_t>{0xFF, 0x79, 0xCE, 0xF9, 0x41, 0x53, 0x22, 0x72, 0x59, 0x41, 0x4A, 0xC8, 0xB2, 0xC9, 0xA4, 0x78, 0xAF, 0x4D, 0x77, 0xA1, 0xB5, 0x6F, 0x7E, 0x12, 0x67},
+		hamon::vector<hamon::uint8_t>{0x84, 0x99, 0xA7, 0x12, 0xE0, 0x34, 0x61, 0x29, 0x4B, 0x30, 0x35, 0xE7, 0x0F, 0x91, 0xD0, 0xBD, 0xA4, 0x22, 0x2F, 0xAF, 0x0E, 0xEC, 0x30, 0x8F, 0x20}));
+	EXPECT_TRUE(BarrettReducerTest(
+		hamon::vector<hamon::uint8_t>{0xE6, 0x1B, 0x56, 0xA6, 0x2D, 0x70, 0xE3, 0xAD, 0x8E, 0x44, 0xA0, 0x0F, 0x59, 0xDA, 0x16, 0x18, 0x35, 0x81, 0x44, 0xD8, 0x15, 0x64, 0x6C, 0x9F, 0x75},
+		hamon::vector<hamon::uint8_t>{0xD9, 0x1A, 0xE6, 0xBC, 0xA5, 0xF7, 0xDF, 0x38, 0x24, 0xF2, 0x85, 0xCF, 0xD1, 0x4E, 0x51, 0xCF, 0x39, 0xF1, 0xBC, 0x80, 0xC7, 0xFC, 0x96, 0xC3, 0x83, 0xC6, 0xF5, 0xBF, 0xAB, 0xB4, 0x99, 0x19, 0x84, 0x3F, 0x74, 0x71, 0xD1, 0xA5, 0x7E, 0xB4, 0xA7, 0xBF, 0xD2, 0x6A, 0x2F, 0x4E, 0x5B, 0x1C, 0x0B, 0x36},
+		hamon::vector<hamon::uint8_t>{0xC5, 0xFA, 0x48, 0x38, 0xF2, 0x65, 0x6D, 0x61, 0x8F, 0x15, 0x85, 0x57, 0x17, 0x8F, 0x6A, 0x00, 0x6A, 0xBE, 0x65, 0x50, 0xF6, 0xFE, 0xAA, 0x73, 0x55},
+		hamon::vector<hamon::uint8_t>{0x01},
+		hamon::vector<hamon::uint8_t>{0xC5, 0xFA, 0x48, 0x38, 0xF2, 0x65, 0x6D, 0x61, 0x8F, 0x15, 0x85, 0x57, 0x17, 0x8F, 0x6A, 0x00, 0x6A, 0xBE, 0x65, 0x50, 0xF6, 0xFE, 0xAA, 0x73, 0x55}));
+	EXPECT_TRUE(BarrettReducerTest(
+		hamon::vector<hamon::uint64_t>{0x0000000000000007},
+		hamon::vector<hamon::uint64_t>{0x0000000000000008},
+		hamon::vector<hamon::uint64_t>{0x0000000000000005},
+		hamon::vector<hamon::uint64_t>{0x0000000000000001},
+		hamon::vector<hamon::uint64_t>{0x0000000000000005}));
+	EXPECT_TRUE(BarrettReducerTest(
+		hamon::vector<hamon::uint64_t>{0x0000000000000007},
+		hamon::vector<hamon::uint64_t>{0x0000000000000032},
+		hamon::vector<hamon::uint64_t>{0x0000000000000003},
+		hamon::vector<hamon::uint64_t>{0x0000000000000001},
+		hamon::vector<hamon::uint64_t>{0x0000000000000003}));
+	EXPECT_TRUE(BarrettReducerTest(
+		hamon::vector<hamon::uint64_t>{0x0000000000000007},
+		hamon::vector<hamon::uint64_t>{0x0000000000000024},
+		hamon::vector<hamon::uint64_t>{0x0000000000000002},
+		hamon::vector<hamon::uint64_t>{0x0000000000000001},
+		hamon::vector<hamon::uint64_t>{0x0000000000000002}));
+	EXPECT_TRUE(BarrettReducerTest(
+		hamon::vector<hamon::uint64_t>{0x00000000000003E8},
+		hamon::vector<hamon::uint64_t>{0x00000000000003E9},
+		hamon::vector<hamon::uint64_t>{0x00000000000002F5},
+		hamon::vector<hamon::uint64_t>{0x0000000000000001},
+		hamon::vector<hamon::uint64_t>{0x00000000000002F5}));
+	EXPECT_TRUE(BarrettReducerTest(
+		hamon::vector<hamon::uint64_t>{0x00000000000003E8},
+		hamon::vector<hamon::uint64_t>{0x00000000000A5AB4},
+		hamon::vector<hamon::uint64_t>{0x000000000000016F},
+		hamon::vector<hamon::uint64_t>{0x0000000000000244},
+		hamon::vector<hamon::uint64_t>{0x000000000000035C}));
+	EXPECT_TRUE(BarrettReducerTest(
+		hamon::vector<hamon::uint64_t>{0x00000000000003E8},
+		hamon::vector<hamon::uint64_t>{0x00000000000F3A71},
+		hamon::vector<hamon::uint64_t>{0x0000000000000096},
+		hamon::vector<hamon::uint64_t>{0x0000000000000001},
+		hamon::vector<hamon::uint64_t>{0x0000000000000096}));
+	EXPECT_TRUE(BarrettReducerTest(
+		hamon::vector<hamon::uint64_t>{0x000000000000FFFF},
+		hamon::vector<hamon::uint64_t>{0x0000000000010000},
+		hamon::vector<hamon::uint64_t>{0x000000000000C2C4},
+		hamon::vector<hamon::uint64_t>{0x0000000000000001},
+		hamon::vector<hamon::uint64_t>{0x000000000000C2C4}));
+	EXPECT_TRUE(BarrettReducerTest(
+		hamon::vector<hamon::uint64_t>{0x000000000000FFFF},
+		hamon::vector<hamon::uint64_t>{0x00000000E61F2DA4},
+		hamon::vector<hamon::uint64_t>{0x000000000000F3E3},
+		hamon::vector<hamon::uint64_t>{0x00000000000013C4},
+		hamon::vector<hamon::uint64_t>{0x000000000000A5A0}));
+	EXPECT_TRUE(BarrettReducerTest(
+		hamon::vector<hamon::uint64_t>{0x000000000000FFFF},
+		hamon::vector<hamon::uint64_t>{0x00000000FFFC0004},
+		hamon::vector<hamon::uint64_t>{0x000000000000C417},
+		hamon::vector<hamon::uint64_t>{0x0000000000000001},
+		hamon::vector<hamon::uint64_t>{0x000000000000C417}));
+	EXPECT_TRUE(BarrettReducerTest(
+		hamon::vector<hamon::uint64_t>{0xFFFFFFFFFFFFFFC5},
+		hamon::vector<hamon::uint64_t>{0xFFFFFFFFFFFFFFC6},
+		hamon::vector<hamon::uint64_t>{0x6797D0D2AC1C2876},
+		hamon::vector<hamon::uint64_t>{0x0000000000000001},
+		hamon::vector<hamon::uint64_t>{0x6797D0D2AC1C2876}));
+	EXPECT_TRUE(BarrettReducerTest(
+		hamon::vector<hamon::uint64_t>{0xFFFFFFFFFFFFFFC5},
+		hamon::vector<hamon::uint64_t>{0x54CE7017B9307855, 0x87656D8E5486D496},
+		hamon::vector<hamon::uint64_t>{0xEF69AD42AF5F60CE},
+		hamon::vector<hamon::uint64_t>{0x892EAFE534437E0C},
+		hamon::vector<hamon::uint64_t>{0x68265AA6B34BF2C9}));
+	EXPECT_TRUE(BarrettReducerTest(
+		hamon::vector<hamon::uint64_t>{0xFFFFFFFFFFFFFFC5},
+		hamon::vector<hamon::uint64_t>{0x0000000000000E10, 0xFFFFFFFFFFFFFF88},
+		hamon::vector<hamon::uint64_t>{0x42A461796749737B},
+		hamon::vector<hamon::uint64_t>{0x0000000000000001},
+		hamon::vector<hamon::uint64_t>{0x42A461796749737B}));
+	EXPECT_TRUE(BarrettReducerTest(
+		hamon::vector<hamon::uint64_t>{0xFFFFFFFFFFFFFF61, 0xFFFFFFFFFFFFFFFF},
+		hamon::vector<hamon::uint64_t>{0xFFFFFFFFFFFFFF62, 0xFFFFFFFFFFFFFFFF},
+		hamon::vector<hamon::uint64_t>{0x68A0BD8A961984D5, 0xCCEB51F7E99691CB},
+		hamon::vector<hamon::uint64_t>{0x0000000000000001},
+		hamon::vector<hamon::uint64_t>{0x68A0BD8A961984D5, 0xCCEB51F7E99691CB}));
+	EXPECT_TRUE(BarrettReducerTest(
+		hamon::vector<hamon::uint64_t>{0xFFFFFFFFFFFFFF61, 0xFFFFFFFFFFFFFFFF},
+		hamon::vector<hamon::uint64_t>{0xB37EE754AA032032, 0x2AB49AE170547E0B, 0xD92E1A262057B0DE, 0xC7E6C9711484CF3F},
+		hamon::vector<hamon::uint64_t>{0x58D4CAB265DDDA65, 0x2F90E1BF0D457C22},
+		hamon::vector<hamon::uint64_t>{0x97212502C07A4718, 0x530BB81D2ED136B3},
+		hamon::vector<hamon::uint64_t>{0xEF7168F7CE3B067D, 0x2ADA336F4F4DF3D0}));
+	EXPECT_TRUE(BarrettReducerTest(
+		hamon::vector<hamon::uint64_t>{0xFFFFFFFFFFFFFF61, 0xFFFFFFFFFFFFFFFF},
+		hamon::vector<hamon::uint64_t>{0x0000000000006400, 0x0000000000000000, 0xFFFFFFFFFFFFFEC0, 0xFFFFFFFFFFFFFFFF},
+		hamon::vector<hamon::uint64_t>{0xC8826D952D86BC16, 0x30109707D3CE573C},
+		hamon::vector<hamon::uint64_t>{0x0000000000000001},
+		hamon::vector<hamon::uint64_t>{0xC8826D952D86BC16, 0x30109707D3CE573C}));
+	EXPECT_TRUE(BarrettReducerTest(
+		hamon::vector<hamon::uint64_t>{0x0000000000000000, 0x0000000000000003},
+		hamon::vector<hamon::uint64_t>{0x0000000000000001, 0x0000000000000003},
+		hamon::vector<hamon::uint64_t>{0xF70A1CD8BCD71085, 0x0000000000000001},
+		hamon::vector<hamon::uint64_t>{0x0000000000000001},
+		hamon::vector<hamon::uint64_t>{0xF70A1CD8BCD71085, 0x0000000000000001}));
+	EXPECT_TRUE(BarrettReducerTest(
+		hamon::vector<hamon::uint64_t>{0x0000000000000000, 0x0000000000000003},
+		hamon::vector<hamon::uint64_t>{0x0CD32C5251CD827D, 0x97668966E05ADC18, 0x0000000000000004},
+		hamon::vector<hamon::uint64_t>{0x3BC1C56CAB6E5537},
+		hamon::vector<hamon::uint64_t>{0x0CD32C5251CD827D, 0x0000000000000001},
+		hamon::vector<hamon::uint64_t>{0xBE73850C603089DB, 0x0000000000000001}));
+	EXPECT_TRUE(BarrettReducerTest(
+		hamon::vector<hamon::uint64_t>{0x0000000000000000, 0x0000000000000003},
+		hamon::vector<hamon::uint64_t>{0x0000000000000001, 0xFFFFFFFFFFFFFFFA, 0x0000000000000008},
+		hamon::vector<hamon::uint64_t>{0x38D0BF0D4CC73CBD, 0x0000000000000002},
+		hamon::vector<hamon::uint64_t>{0x0000000000000001},
+		hamon::vector<hamon::uint64_t>{0x38D0BF0D4CC73CBD, 0x0000000000000002}));
+	EXPECT_TRUE(BarrettReducerTest(
+		hamon::vector<hamon::uint64_t>{0xADE3702DA6561BE6, 0x1816DA590FA0448E, 0x9F6C6415D8448135, 0x0000000000000075},
+		hamon::vector<hamon::uint64_t>{0xADE3702DA6561BE7, 0x1816DA590FA0448E, 0x9F6C6415D8448135, 0x0000000000000075},
+		hamon::vector<hamon::uint64_t>{0xFB7D7A888192AE98, 0x1A5CFD056E4465E5, 0x912F36FB10A87181, 0x0000000000000050},
+		hamon::vector<hamon::uint64_t>{0x0000000000000001},
+		hamon::vector<hamon::uint64_t>{0xFB7D7A888192AE98, 0x1A5CFD056E4465E5, 0x912F36FB10A87181, 0x0000000000000050}));
+	EXPECT_TRUE(BarrettReducerTest(
+		hamon::vector<hamon::uint64_t>{0xADE3702DA6561BE6, 0x1816DA590FA0448E, 0x9F6C6415D8448135, 0x0000000000000075},
+		hamon::vector<hamon::uint64_t>{0xBA711A185E38A9FF, 0xAC0072C72F9E383B, 0x120287D69ABF39B8, 0xFE4C06D4F81BD0EE, 0xA9A3D6238D4DE4F9, 0x4C0897CE1D0159FD, 0x0000000000001FAC},
+		hamon::vector<hamon::uint64_t>{0x90774A847EE08DE6, 0x030221BA794291FB, 0xDEAA01008967209C, 0x0000000000000056},
+		hamon::vector<hamon::uint64_t>{0x72225341F9CE79FF, 0x78A4C9B2C84A4159, 0x127E6FB5A1774DAF, 0x0000000000000067},
+		hamon::vector<hamon::uint64_t>{0x25230C16C4106976, 0x96221FB0F682EB9D, 0x10F9340A4923CBFE, 0x0000000000000054}));
+	EXPECT_TRUE(BarrettReducerTest(
+		hamon::vector<hamon::uint64_t>{0xADE3702DA6561BE6, 0x1816DA590FA0448E, 0x9F6C6415D8448135, 0x0000000000000075},
+		hamon::vector<hamon::uint64_t>{0x38DFF7A5BCE61AD9, 0xCF514ED1CF85F224, 0xC396FCC780BCF139, 0x1999B4ABBFF5C683, 0xB47EA5D171743F84, 0x1C5B4E2F6AD2BFA7, 0x000000000000360B},
+		hamon::vector<hamon::uint64_t>{0x91EBD7A0C33379D1, 0x7FB885C9E0D4560E, 0x6AACA6DFA6FE39C0, 0x0000000000000025},
+		hamon::vector<hamon::uint64_t>{0x0000000000000001},
+		hamon::vector<hamon::uint64_t>{0x91EBD7A0C33379D1, 0x7FB885C9E0D4560E, 0x6AACA6DFA6FE39C0, 0x0000000000000025}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(BarrettReducerTest(
+		hamon::array<hamon::uint8_t, 16>{0x07},
+		hamon::array<hamon::uint8_t, 16>{0x08},
+		hamon::array<hamon::uint8_t, 16>{0x05},
+		hamon::array<hamon::uint8_t, 16>{0x01},
+		hamon::array<hamon::uint8_t, 16>{0x05}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(BarrettReducerTest(
+		hamon::array<hamon::uint8_t, 16>{0x07},
+		hamon::array<hamon::uint8_t, 16>{0x32},
+		hamon::array<hamon::uint8_t, 16>{0x04},
+		hamon::array<hamon::uint8_t, 16>{0x01},
+		hamon::array<hamon::uint8_t, 16>{0x04}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(BarrettReducerTest(
+		hamon::array<hamon::uint8_t, 16>{0x07},
+		hamon::array<hamon::uint8_t, 16>{0x24},
+		hamon::array<hamon::uint8_t, 16>{0x02},
+		hamon::array<hamon::uint8_t, 16>{0x01},
+		hamon::array<hamon::uint8_t, 16>{0x02}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(BarrettReducerTest(
+		hamon::array<hamon::uint8_t, 16>{0xE8, 0x03},
+		hamon::array<hamon::uint8_t, 16>{0xE9, 0x03},
+		hamon::array<hamon::uint8_t, 16>{0xBF, 0x02},
+		hamon::array<hamon::uint8_t, 16>{0x01},
+		hamon::array<hamon::uint8_t, 16>{0xBF, 0x02}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(BarrettReducerTest(
+		hamon::array<hamon::uint8_t, 16>{0xE8, 0x03},
+		hamon::array<hamon::uint8_t, 16>{0xB4, 0x5A, 0x0A},
+		hamon::array<hamon::uint8_t, 16>{0xFF, 0x01},
+		hamon::array<hamon::uint8_t, 16>{0x44, 0x02},
+		hamon::array<hamon::uint8_t, 16>{0x7C, 0x01}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(BarrettReducerTest(
+		hamon::array<hamon::uint8_t, 16>{0xE8, 0x03},
+		hamon::array<hamon::uint8_t, 16>{0x71, 0x3A, 0x0F},
+		hamon::array<hamon::uint8_t, 16>{0x4A, 0x01},
+		hamon::array<hamon::uint8_t, 16>{0x01},
+		hamon::array<hamon::uint8_t, 16>{0x4A, 0x01}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(BarrettReducerTest(
+		hamon::array<hamon::uint8_t, 16>{0xFF, 0xFF},
+		hamon::array<hamon::uint8_t, 16>{0x00, 0x00, 0x01},
+		hamon::array<hamon::uint8_t, 16>{0xC7, 0x8D},
+		hamon::array<hamon::uint8_t, 16>{0x01},
+		hamon::array<hamon::uint8_t, 16>{0xC7, 0x8D}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(BarrettReducerTest(
+		hamon::array<hamon::uint8_t, 16>{0xFF, 0xFF},
+		hamon::array<hamon::uint8_t, 16>{0xA4, 0x2D, 0x1F, 0xE6},
+		hamon::array<hamon::uint8_t, 16>{0xE9, 0x35},
+		hamon::array<hamon::uint8_t, 16>{0xC4, 0x13},
+		hamon::array<hamon::uint8_t, 16>{0x8D, 0x95}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(BarrettReducerTest(
+		hamon::array<hamon::uint8_t, 16>{0xFF, 0xFF},
+		hamon::array<hamon::uint8_t, 16>{0x04, 0x00, 0xFC, 0xFF},
+		hamon::array<hamon::uint8_t, 16>{0xA3, 0x76},
+		hamon::array<hamon::uint8_t, 16>{0x01},
+		hamon::array<hamon::uint8_t, 16>{0xA3, 0x76}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(BarrettReducerTest(
+		hamon::array<hamon::uint8_t, 16>{0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF},
+		hamon::array<hamon::uint8_t, 16>{0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF},
+		hamon::array<hamon::uint8_t, 16>{0x22, 0x45, 0x74, 0x43, 0x1D, 0xFA, 0x38, 0x38},
+		hamon::array<hamon::uint8_t, 16>{0x01},
+		hamon::array<hamon::uint8_t, 16>{0x22, 0x45, 0x74, 0x43, 0x1D, 0xFA, 0x38, 0x38}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(BarrettReducerTest(
+		hamon::array<hamon::uint8_t, 16>{0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF},
+		hamon::array<hamon::uint8_t, 16>{0x55, 0x78, 0x30, 0xB9, 0x17, 0x70, 0xCE, 0x54, 0x96, 0xD4, 0x86, 0x54, 0x8E, 0x6D, 0x65, 0x87},
+		hamon::array<hamon::uint8_t, 16>{0xEC, 0x5C, 0xE9, 0x72, 0x83, 0xC8, 0xA3, 0xC3},
+		hamon::array<hamon::uint8_t, 16>{0x0C, 0x7E, 0x43, 0x34, 0xE5, 0xAF, 0x2E, 0x89},
+		hamon::array<hamon::uint8_t, 16>{0x00, 0x31, 0xEA, 0xEA, 0x1C, 0x6B, 0x2F, 0x6F}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(BarrettReducerTest(
+		hamon::array<hamon::uint8_t, 16>{0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF},
+		hamon::array<hamon::uint8_t, 16>{0x10, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF},
+		hamon::array<hamon::uint8_t, 16>{0x41, 0x82, 0x94, 0x27, 0x0D, 0x67, 0xCB, 0x3F},
+		hamon::array<hamon::uint8_t, 16>{0x01},
+		hamon::array<hamon::uint8_t, 16>{0x41, 0x82, 0x94, 0x27, 0x0D, 0x67, 0xCB, 0x3F}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(BarrettReducerTest(
+		hamon::array<hamon::uint32_t, 14>{0x00000007},
+		hamon::array<hamon::uint32_t, 14>{0x00000008},
+		hamon::array<hamon::uint32_t, 14>{0x00000005},
+		hamon::array<hamon::uint32_t, 14>{0x00000001},
+		hamon::array<hamon::uint32_t, 14>{0x00000005}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(BarrettReducerTest(
+		hamon::array<hamon::uint32_t, 14>{0x00000007},
+		hamon::array<hamon::uint32_t, 14>{0x00000032},
+		hamon::array<hamon::uint32_t, 14>{0x00000004},
+		hamon::array<hamon::uint32_t, 14>{0x00000001},
+		hamon::array<hamon::uint32_t, 14>{0x00000004}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(BarrettReducerTest(
+		hamon::array<hamon::uint32_t, 14>{0x00000007},
+		hamon::array<hamon::uint32_t, 14>{0x00000024},
+		hamon::array<hamon::uint32_t, 14>{0x00000001},
+		hamon::array<hamon::uint32_t, 14>{0x00000001},
+		hamon::array<hamon::uint32_t, 14>{0x00000001}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(BarrettReducerTest(
+		hamon::array<hamon::uint32_t, 14>{0x000003E8},
+		hamon::array<hamon::uint32_t, 14>{0x000003E9},
+		hamon::array<hamon::uint32_t, 14>{0x00000281},
+		hamon::array<hamon::uint32_t, 14>{0x00000001},
+		hamon::array<hamon::uint32_t, 14>{0x00000281}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(BarrettReducerTest(
+		hamon::array<hamon::uint32_t, 14>{0x000003E8},
+		hamon::array<hamon::uint32_t, 14>{0x000A5AB4},
+		hamon::array<hamon::uint32_t, 14>{0x000001B4},
+		hamon::array<hamon::uint32_t, 14>{0x00000244},
+		hamon::array<hamon::uint32_t, 14>{0x00000370}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(BarrettReducerTest(
+		hamon::array<hamon::uint32_t, 14>{0x000003E8},
+		hamon::array<hamon::uint32_t, 14>{0x000F3A71},
+		hamon::array<hamon::uint32_t, 14>{0x000000AA},
+		hamon::array<hamon::uint32_t, 14>{0x00000001},
+		hamon::array<hamon::uint32_t, 14>{0x000000AA}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(BarrettReducerTest(
+		hamon::array<hamon::uint32_t, 14>{0x0000FFFF},
+		hamon::array<hamon::uint32_t, 14>{0x00010000},
+		hamon::array<hamon::uint32_t, 14>{0x00005E4D},
+		hamon::array<hamon::uint32_t, 14>{0x00000001},
+		hamon::array<hamon::uint32_t, 14>{0x00005E4D}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(BarrettReducerTest(
+		hamon::array<hamon::uint32_t, 14>{0x0000FFFF},
+		hamon::array<hamon::uint32_t, 14>{0xE61F2DA4},
+		hamon::array<hamon::uint32_t, 14>{0x000075E5},
+		hamon::array<hamon::uint32_t, 14>{0x000013C4},
+		hamon::array<hamon::uint32_t, 14>{0x00004B6E}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(BarrettReducerTest(
+		hamon::array<hamon::uint32_t, 14>{0x0000FFFF},
+		hamon::array<hamon::uint32_t, 14>{0xFFFC0004},
+		hamon::array<hamon::uint32_t, 14>{0x000071F9},
+		hamon::array<hamon::uint32_t, 14>{0x00000001},
+		hamon::array<hamon::uint32_t, 14>{0x000071F9}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(BarrettReducerTest(
+		hamon::array<hamon::uint32_t, 14>{0xFFFFFFC5, 0xFFFFFFFF},
+		hamon::array<hamon::uint32_t, 14>{0xFFFFFFC6, 0xFFFFFFFF},
+		hamon::array<hamon::uint32_t, 14>{0x6CD32FDD, 0x1B0224AF},
+		hamon::array<hamon::uint32_t, 14>{0x00000001},
+		hamon::array<hamon::uint32_t, 14>{0x6CD32FDD, 0x1B0224AF}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(BarrettReducerTest(
+		hamon::array<hamon::uint32_t, 14>{0xFFFFFFC5, 0xFFFFFFFF},
+		hamon::array<hamon::uint32_t, 14>{0xB9307855, 0x54CE7017, 0x5486D496, 0x87656D8E},
+		hamon::array<hamon::uint32_t, 14>{0x2FD4D4B4, 0x604A6F76},
+		hamon::array<hamon::uint32_t, 14>{0x34437E0C, 0x892EAFE5},
+		hamon::array<hamon::uint32_t, 14>{0x2ECAD996, 0x0B7AC7EC}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(BarrettReducerTest(
+		hamon::array<hamon::uint32_t, 14>{0xFFFFFFC5, 0xFFFFFFFF},
+		hamon::array<hamon::uint32_t, 14>{0x00000E10, 0x00000000, 0xFFFFFF88, 0xFFFFFFFF},
+		hamon::array<hamon::uint32_t, 14>{0x5410DE8F, 0x50073C2A},
+		hamon::array<hamon::uint32_t, 14>{0x00000001},
+		hamon::array<hamon::uint32_t, 14>{0x5410DE8F, 0x50073C2A}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(BarrettReducerTest(
+		hamon::array<hamon::uint32_t, 14>{0xFFFFFF61, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF},
+		hamon::array<hamon::uint32_t, 14>{0xFFFFFF62, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF},
+		hamon::array<hamon::uint32_t, 14>{0x89C83F45, 0x2244D20B, 0x8A7A2DCE, 0x935D8DC0},
+		hamon::array<hamon::uint32_t, 14>{0x00000001},
+		hamon::array<hamon::uint32_t, 14>{0x89C83F45, 0x2244D20B, 0x8A7A2DCE, 0x935D8DC0}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(BarrettReducerTest(
+		hamon::array<hamon::uint32_t, 14>{0xFFFFFF61, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF},
+		hamon::array<hamon::uint32_t, 14>{0xAA032032, 0xB37EE754, 0x70547E0B, 0x2AB49AE1, 0x2057B0DE, 0xD92E1A26, 0x1484CF3F, 0xC7E6C971},
+		hamon::array<hamon::uint32_t, 14>{0xB14C2493, 0x3E17077C, 0x331F09E7, 0x3C8B2CA9},
+		hamon::array<hamon::uint32_t, 14>{0xC07A4718, 0x97212502, 0x2ED136B3, 0x530BB81D},
+		hamon::array<hamon::uint32_t, 14>{0xF3EF2CCD, 0xD9BA791B, 0x16C8D597, 0x0CE0D6D7}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(BarrettReducerTest(
+		hamon::array<hamon::uint32_t, 14>{0xFFFFFF61, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF},
+		hamon::array<hamon::uint32_t, 14>{0x00006400, 0x00000000, 0x00000000, 0x00000000, 0xFFFFFEC0, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF},
+		hamon::array<hamon::uint32_t, 14>{0x173B2756, 0x44AAFBE9, 0x7A978A5E, 0xB3085D9B},
+		hamon::array<hamon::uint32_t, 14>{0x00000001},
+		hamon::array<hamon::uint32_t, 14>{0x173B2756, 0x44AAFBE9, 0x7A978A5E, 0xB3085D9B}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(BarrettReducerTest(
+		hamon::array<hamon::uint32_t, 14>{0x00000000, 0x00000000, 0x00000003},
+		hamon::array<hamon::uint32_t, 14>{0x00000001, 0x00000000, 0x00000003},
+		hamon::array<hamon::uint32_t, 14>{0x45F5C801, 0xD65371EC},
+		hamon::array<hamon::uint32_t, 14>{0x00000001},
+		hamon::array<hamon::uint32_t, 14>{0x45F5C801, 0xD65371EC}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(BarrettReducerTest(
+		hamon::array<hamon::uint32_t, 14>{0x00000000, 0x00000000, 0x00000003},
+		hamon::array<hamon::uint32_t, 14>{0x51CD827D, 0x0CD32C52, 0xE05ADC18, 0x97668966, 0x00000004},
+		hamon::array<hamon::uint32_t, 14>{0xCB59C491, 0x12D48C0C, 0x00000001},
+		hamon::array<hamon::uint32_t, 14>{0x51CD827D, 0x0CD32C52, 0x00000001},
+		hamon::array<hamon::uint32_t, 14>{0x29C39CCD, 0xB38A0209, 0x00000002}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(BarrettReducerTest(
+		hamon::array<hamon::uint32_t, 14>{0x00000000, 0x00000000, 0x00000003},
+		hamon::array<hamon::uint32_t, 14>{0x00000001, 0x00000000, 0xFFFFFFFA, 0xFFFFFFFF, 0x00000008},
+		hamon::array<hamon::uint32_t, 14>{0xB40DF9E2, 0x56F36506, 0x00000001},
+		hamon::array<hamon::uint32_t, 14>{0x00000001},
+		hamon::array<hamon::uint32_t, 14>{0xB40DF9E2, 0x56F36506, 0x00000001}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(BarrettReducerTest(
+		hamon::array<hamon::uint32_t, 14>{0xA6561BE6, 0xADE3702D, 0x0FA0448E, 0x1816DA59, 0xD8448135, 0x9F6C6415, 0x00000075},
+		hamon::array<hamon::uint32_t, 14>{0xA6561BE7, 0xADE3702D, 0x0FA0448E, 0x1816DA59, 0xD8448135, 0x9F6C6415, 0x00000075},
+		hamon::array<hamon::uint32_t, 14>{0xE319E72E, 0xD34921A4, 0x87867AA2, 0x52AD6355, 0x1CDE6916, 0x554B60A9, 0x00000027},
+		hamon::array<hamon::uint32_t, 14>{0x00000001},
+		hamon::array<hamon::uint32_t, 14>{0xE319E72E, 0xD34921A4, 0x87867AA2, 0x52AD6355, 0x1CDE6916, 0x554B60A9, 0x00000027}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(BarrettReducerTest(
+		hamon::array<hamon::uint32_t, 14>{0xA6561BE6, 0xADE3702D, 0x0FA0448E, 0x1816DA59, 0xD8448135, 0x9F6C6415, 0x00000075},
+		hamon::array<hamon::uint32_t, 14>{0x5E38A9FF, 0xBA711A18, 0x2F9E383B, 0xAC0072C7, 0x9ABF39B8, 0x120287D6, 0xF81BD0EE, 0xFE4C06D4, 0x8D4DE4F9, 0xA9A3D623, 0x1D0159FD, 0x4C0897CE, 0x00001FAC},
+		hamon::array<hamon::uint32_t, 14>{0xB6048145, 0xC5BE7DCF, 0x38458CF5, 0xC26168CA, 0x8CE9E219, 0xC199346F, 0x00000023},
+		hamon::array<hamon::uint32_t, 14>{0xF9CE79FF, 0x72225341, 0xC84A4159, 0x78A4C9B2, 0xA1774DAF, 0x127E6FB5, 0x00000067},
+		hamon::array<hamon::uint32_t, 14>{0x4C715B7D, 0x271D6756, 0x55F37DF2, 0xD4E867A8, 0x1CB7AA33, 0x47742B02, 0x00000042}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(BarrettReducerTest(
+		hamon::array<hamon::uint32_t, 14>{0xA6561BE6, 0xADE3702D, 0x0FA0448E, 0x1816DA59, 0xD8448135, 0x9F6C6415, 0x00000075},
+		hamon::array<hamon::uint32_t, 14>{0xBCE61AD9, 0x38DFF7A5, 0xCF85F224, 0xCF514ED1, 0x80BCF139, 0xC396FCC7, 0xBFF5C683, 0x1999B4AB, 0x71743F84, 0xB47EA5D1, 0x6AD2BFA7, 0x1C5B4E2F, 0x0000360B},
+		hamon::array<hamon::uint32_t, 14>{0x96DC2189, 0x71058AD5, 0x9E5DCE3E, 0x39C11824, 0xE72331B2, 0x040F1598, 0x0000003C},
+		hamon::array<hamon::uint32_t, 14>{0x00000001},
+		hamon::array<hamon::uint32_t, 14>{0x96DC2189, 0x71058AD5, 0x9E5DCE3E, 0x39C11824, 0xE72331B2, 0x040F1598, 0x0000003C}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(BarrettReducerTest(
+		hamon::array<hamon::uint64_t, 7>{0x0000000000000007},
+		hamon::array<hamon::uint64_t, 7>{0x0000000000000008},
+		hamon::array<hamon::uint64_t, 7>{0x0000000000000000},
+		hamon::array<hamon::uint64_t, 7>{0x0000000000000001},
+		hamon::array<hamon::uint64_t, 7>{0x0000000000000000}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(BarrettReducerTest(
+		hamon::array<hamon::uint64_t, 7>{0x0000000000000007},
+		hamon::array<hamon::uint64_t, 7>{0x0000000000000032},
+		hamon::array<hamon::uint64_t, 7>{0x0000000000000003},
+		hamon::array<hamon::uint64_t, 7>{0x0000000000000001},
+		hamon::array<hamon::uint64_t, 7>{0x0000000000000003}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(BarrettReducerTest(
+		hamon::array<hamon::uint64_t, 7>{0x0000000000000007},
+		hamon::array<hamon::uint64_t, 7>{0x0000000000000024},
+		hamon::array<hamon::uint64_t, 7>{0x0000000000000003},
+		hamon::array<hamon::uint64_t, 7>{0x0000000000000001},
+		hamon::array<hamon::uint64_t, 7>{0x0000000000000003}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(BarrettReducerTest(
+		hamon::array<hamon::uint64_t, 7>{0x00000000000003E8},
+		hamon::array<hamon::uint64_t, 7>{0x00000000000003E9},
+		hamon::array<hamon::uint64_t, 7>{0x000000000000026C},
+		hamon::array<hamon::uint64_t, 7>{0x0000000000000001},
+		hamon::array<hamon::uint64_t, 7>{0x000000000000026C}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(BarrettReducerTest(
+		hamon::array<hamon::uint64_t, 7>{0x00000000000003E8},
+		hamon::array<hamon::uint64_t, 7>{0x00000000000A5AB4},
+		hamon::array<hamon::uint64_t, 7>{0x0000000000000261},
+		hamon::array<hamon::uint64_t, 7>{0x0000000000000244},
+		hamon::array<hamon::uint64_t, 7>{0x00000000000000DC}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(BarrettReducerTest(
+		hamon::array<hamon::uint64_t, 7>{0x00000000000003E8},
+		hamon::array<hamon::uint64_t, 7>{0x00000000000F3A71},
+		hamon::array<hamon::uint64_t, 7>{0x00000000000003D3},
+		hamon::array<hamon::uint64_t, 7>{0x0000000000000001},
+		hamon::array<hamon::uint64_t, 7>{0x00000000000003D3}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(BarrettReducerTest(
+		hamon::array<hamon::uint64_t, 7>{0x000000000000FFFF},
+		hamon::array<hamon::uint64_t, 7>{0x0000000000010000},
+		hamon::array<hamon::uint64_t, 7>{0x0000000000002D59},
+		hamon::array<hamon::uint64_t, 7>{0x0000000000000001},
+		hamon::array<hamon::uint64_t, 7>{0x0000000000002D59}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(BarrettReducerTest(
+		hamon::array<hamon::uint64_t, 7>{0x000000000000FFFF},
+		hamon::array<hamon::uint64_t, 7>{0x00000000E61F2DA4},
+		hamon::array<hamon::uint64_t, 7>{0x0000000000008304},
+		hamon::array<hamon::uint64_t, 7>{0x00000000000013C4},
+		hamon::array<hamon::uint64_t, 7>{0x000000000000A52D}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(BarrettReducerTest(
+		hamon::array<hamon::uint64_t, 7>{0x000000000000FFFF},
+		hamon::array<hamon::uint64_t, 7>{0x00000000FFFC0004},
+		hamon::array<hamon::uint64_t, 7>{0x0000000000004BCF},
+		hamon::array<hamon::uint64_t, 7>{0x0000000000000001},
+		hamon::array<hamon::uint64_t, 7>{0x0000000000004BCF}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(BarrettReducerTest(
+		hamon::array<hamon::uint64_t, 7>{0xFFFFFFFFFFFFFFC5},
+		hamon::array<hamon::uint64_t, 7>{0xFFFFFFFFFFFFFFC6},
+		hamon::array<hamon::uint64_t, 7>{0x849E28FD6F02FD42},
+		hamon::array<hamon::uint64_t, 7>{0x0000000000000001},
+		hamon::array<hamon::uint64_t, 7>{0x849E28FD6F02FD42}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(BarrettReducerTest(
+		hamon::array<hamon::uint64_t, 7>{0xFFFFFFFFFFFFFFC5},
+		hamon::array<hamon::uint64_t, 7>{0x54CE7017B9307855, 0x87656D8E5486D496},
+		hamon::array<hamon::uint64_t, 7>{0x120B7E3C9339C558},
+		hamon::array<hamon::uint64_t, 7>{0x892EAFE534437E0C},
+		hamon::array<hamon::uint64_t, 7>{0xD155BB6786E76E54}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(BarrettReducerTest(
+		hamon::array<hamon::uint64_t, 7>{0xFFFFFFFFFFFFFFC5},
+		hamon::array<hamon::uint64_t, 7>{0x0000000000000E10, 0xFFFFFFFFFFFFFF88},
+		hamon::array<hamon::uint64_t, 7>{0xEE437CCD9D2A0182},
+		hamon::array<hamon::uint64_t, 7>{0x0000000000000001},
+		hamon::array<hamon::uint64_t, 7>{0xEE437CCD9D2A0182}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(BarrettReducerTest(
+		hamon::array<hamon::uint64_t, 7>{0xFFFFFFFFFFFFFF61, 0xFFFFFFFFFFFFFFFF},
+		hamon::array<hamon::uint64_t, 7>{0xFFFFFFFFFFFFFF62, 0xFFFFFFFFFFFFFFFF},
+		hamon::array<hamon::uint64_t, 7>{0xB9ED733EA3A4E7BE, 0x27708646D1CFE589},
+		hamon::array<hamon::uint64_t, 7>{0x0000000000000001},
+		hamon::array<hamon::uint64_t, 7>{0xB9ED733EA3A4E7BE, 0x27708646D1CFE589}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(BarrettReducerTest(
+		hamon::array<hamon::uint64_t, 7>{0xFFFFFFFFFFFFFF61, 0xFFFFFFFFFFFFFFFF},
+		hamon::array<hamon::uint64_t, 7>{0xB37EE754AA032032, 0x2AB49AE170547E0B, 0xD92E1A262057B0DE, 0xC7E6C9711484CF3F},
+		hamon::array<hamon::uint64_t, 7>{0x065A916BBEDEC0C8, 0x1BB0E975A576FE30},
+		hamon::array<hamon::uint64_t, 7>{0x97212502C07A4718, 0x530BB81D2ED136B3},
+		hamon::array<hamon::uint64_t, 7>{0x11F6E2DBDAF04C33, 0xCD0A22FC458AD9C3}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(BarrettReducerTest(
+		hamon::array<hamon::uint64_t, 7>{0xFFFFFFFFFFFFFF61, 0xFFFFFFFFFFFFFFFF},
+		hamon::array<hamon::uint64_t, 7>{0x0000000000006400, 0x0000000000000000, 0xFFFFFFFFFFFFFEC0, 0xFFFFFFFFFFFFFFFF},
+		hamon::array<hamon::uint64_t, 7>{0xA3481A49E1BDAD40, 0x1694C1D3B31BF637},
+		hamon::array<hamon::uint64_t, 7>{0x0000000000000001},
+		hamon::array<hamon::uint64_t, 7>{0xA3481A49E1BDAD40, 0x1694C1D3B31BF637}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(BarrettReducerTest(
+		hamon::array<hamon::uint64_t, 7>{0x0000000000000000, 0x0000000000000003},
+		hamon::array<hamon::uint64_t, 7>{0x0000000000000001, 0x0000000000000003},
+		hamon::array<hamon::uint64_t, 7>{0xE4BC701AC51FD1B1, 0x0000000000000002},
+		hamon::array<hamon::uint64_t, 7>{0x0000000000000001},
+		hamon::array<hamon::uint64_t, 7>{0xE4BC701AC51FD1B1, 0x0000000000000002}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(BarrettReducerTest(
+		hamon::array<hamon::uint64_t, 7>{0x0000000000000000, 0x0000000000000003},
+		hamon::array<hamon::uint64_t, 7>{0x0CD32C5251CD827D, 0x97668966E05ADC18, 0x0000000000000004},
+		hamon::array<hamon::uint64_t, 7>{0x301FC72E3B3AFD42},
+		hamon::array<hamon::uint64_t, 7>{0x0CD32C5251CD827D, 0x0000000000000001},
+		hamon::array<hamon::uint64_t, 7>{0xB53F4B2990432D3A, 0x0000000000000001}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(BarrettReducerTest(
+		hamon::array<hamon::uint64_t, 7>{0x0000000000000000, 0x0000000000000003},
+		hamon::array<hamon::uint64_t, 7>{0x0000000000000001, 0xFFFFFFFFFFFFFFFA, 0x0000000000000008},
+		hamon::array<hamon::uint64_t, 7>{0x9C563CE8328B99D1, 0x0000000000000002},
+		hamon::array<hamon::uint64_t, 7>{0x0000000000000001},
+		hamon::array<hamon::uint64_t, 7>{0x9C563CE8328B99D1, 0x0000000000000002}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(BarrettReducerTest(
+		hamon::array<hamon::uint64_t, 7>{0xADE3702DA6561BE6, 0x1816DA590FA0448E, 0x9F6C6415D8448135, 0x0000000000000075},
+		hamon::array<hamon::uint64_t, 7>{0xADE3702DA6561BE7, 0x1816DA590FA0448E, 0x9F6C6415D8448135, 0x0000000000000075},
+		hamon::array<hamon::uint64_t, 7>{0x1C6E7E62037ADBD4, 0x5B636CD746BB0888, 0x1953EE6D3578686C, 0x000000000000002F},
+		hamon::array<hamon::uint64_t, 7>{0x0000000000000001},
+		hamon::array<hamon::uint64_t, 7>{0x1C6E7E62037ADBD4, 0x5B636CD746BB0888, 0x1953EE6D3578686C, 0x000000000000002F}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(BarrettReducerTest(
+		hamon::array<hamon::uint64_t, 7>{0xADE3702DA6561BE6, 0x1816DA590FA0448E, 0x9F6C6415D8448135, 0x0000000000000075},
+		hamon::array<hamon::uint64_t, 7>{0xBA711A185E38A9FF, 0xAC0072C72F9E383B, 0x120287D69ABF39B8, 0xFE4C06D4F81BD0EE, 0xA9A3D6238D4DE4F9, 0x4C0897CE1D0159FD, 0x0000000000001FAC},
+		hamon::array<hamon::uint64_t, 7>{0x3274F41B7AC7407F, 0x58C09B9EAACBC9BF, 0x40BB81A9C6723256, 0x0000000000000053},
+		hamon::array<hamon::uint64_t, 7>{0x72225341F9CE79FF, 0x78A4C9B2C84A4159, 0x127E6FB5A1774DAF, 0x0000000000000067},
+		hamon::array<hamon::uint64_t, 7>{0xB4CEF7E08CF535E1, 0xF88A8C01C2D0C193, 0xC9E69753AFDCC4BF, 0x0000000000000066}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(BarrettReducerTest(
+		hamon::array<hamon::uint64_t, 7>{0xADE3702DA6561BE6, 0x1816DA590FA0448E, 0x9F6C6415D8448135, 0x0000000000000075},
+		hamon::array<hamon::uint64_t, 7>{0x38DFF7A5BCE61AD9, 0xCF514ED1CF85F224, 0xC396FCC780BCF139, 0x1999B4ABBFF5C683, 0xB47EA5D171743F84, 0x1C5B4E2F6AD2BFA7, 0x000000000000360B},
+		hamon::array<hamon::uint64_t, 7>{0x8AA878FAE60503BC, 0x6BAB9DA5980C6C70, 0x9E75CB33E7BB0AC6, 0x0000000000000008},
+		hamon::array<hamon::uint64_t, 7>{0x0000000000000001},
+		hamon::array<hamon::uint64_t, 7>{0x8AA878FAE60503BC, 0x6BAB9DA5980C6C70, 0x9E75CB33E7BB0AC6, 0x0000000000000008}));
+}
+
+}	// namespace bigint_algo_barrett_reducer_test
+
+}	// namespace hamon_bigint_test
@@ -524,4 +524,72 @@ GTEST_TEST(BigIntAlgoTest, DivModTest)
 		HAMON_CXX14_CONSTEXPR_EXPECT_EQ(quo, c.quo);
 		HAMON_CXX14_CONSTEXPR_EXPECT_EQ(rem, c.rem);
 	}
+
+	// 商の見積もりの補正と、引きすぎた場合の足し戻しが起きるケース
+	{
+		hamon::vector<hamon::uint32_t> const a{0x00000000, 0x00000000, 0x80000000, 0x7FFFFFFF};
+		hamon::vector<hamon::uint32_t> const b{0x00000001, 0x00000000, 0x80000000};
+		auto const c = hamon::bigint_algo::div_mod(a, b);
+		hamon::vector<hamon::uint32_t> const quo{0xFFFFFFFE};
+		hamon::vector<hamon::uint32_t> const rem{0x00000002, 0xFFFFFFFF, 0x7FFFFFFF};
+		EXPECT_EQ(quo, c.quo);
+		EXPECT_EQ(rem, c.rem);
+	}
+	{
+		hamon::vector<hamon::uint32_t> const a{0x00000003, 0x00000000, 0x80000000};
+		hamon::vector<hamon::uint32_t> const b{0x00000001, 0x00000000, 0x40000000};
+		auto const c = hamon::bigint_algo::div_mod(a, b);
+		hamon::vector<hamon::uint32_t> const quo{0x00000002};
+		hamon::vector<hamon::uint32_t> const rem{0x00000001};
+		EXPECT_EQ(quo, c.quo);
+		EXPECT_EQ(rem, c.rem);
+	}
+	{
+		hamon::vector<hamon::uint64_t> const a{0x0000000000000000, 0x0000000000000000, 0x8000000000000000, 0x7FFFFFFFFFFFFFFF};
+		hamon::vector<hamon::uint64_t> const b{0x0000000000000001, 0x0000000000000000, 0x8000000000000000};
+		auto const c = hamon::bigint_algo::div_mod(a, b);
+		hamon::vector<hamon::uint64_t> const quo{0xFFFFFFFFFFFFFFFE};
+		hamon::vector<hamon::uint64_t> const rem{0x0000000000000002, 0xFFFFFFFFFFFFFFFF, 0x7FFFFFFFFFFFFFFF};
+		EXPECT_EQ(quo, c.quo);
+		EXPECT_EQ(rem, c.rem);
+	}
+	{
+		hamon::vector<hamon::uint64_t> const a{0x0000000000000000, 0x000000000000FFFF, 0xFFFF000000000000, 0xFFFFFFFFFFFFFFFF};
+		hamon::vector<hamon::uint64_t> const b{0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF};
+		auto const c = hamon::bigint_algo::div_mod(a, b);
+		hamon::vector<hamon::uint64_t> const quo{0xFFFF000000000001, 0xFFFFFFFFFFFFFFFF};
+		hamon::vector<hamon::uint64_t> const rem{0xFFFF000000000001, 0x000000000000FFFE};
+		EXPECT_EQ(quo, c.quo);
+		EXPECT_EQ(rem, c.rem);
+	}
+	{
+		using VectorType = hamon::array<hamon::uint32_t, 4>;
+		HAMON_CXX14_CONSTEXPR VectorType a{0x00000000, 0x00000000, 0x80000000, 0x7FFFFFFF};
+		HAMON_CXX14_CONSTEXPR VectorType b{0x00000001, 0x00000000, 0x80000000};
+		HAMON_CXX14_CONSTEXPR auto c = hamon::bigint_algo::div_mod(a, b);
+		HAMON_CXX14_CONSTEXPR VectorType quo{0xFFFFFFFE};
+		HAMON_CXX14_CONSTEXPR VectorType rem{0x00000002, 0xFFFFFFFF, 0x7FFFFFFF};
+		HAMON_CXX14_CONSTEXPR_EXPECT_EQ(quo, c.quo);
+		HAMON_CXX14_CONSTEXPR_EXPECT_EQ(rem, c.rem);
+	}
+	{
+		using VectorType = hamon::array<hamon::uint64_t, 4>;
+		HAMON_CXX14_CONSTEXPR VectorType a{0x0000000000000000, 0x0000000000000000, 0x8000000000000000, 0x7FFFFFFFFFFFFFFF};
+		HAMON_CXX14_CONSTEXPR VectorType b{0x0000000000000001, 0x0000000000000000, 0x8000000000000000};
+		HAMON_CXX14_CONSTEXPR auto c = hamon::bigint_algo::div_mod(a, b);
+		HAMON_CXX14_CONSTEXPR VectorType quo{0xFFFFFFFFFFFFFFFE};
+		HAMON_CXX14_CONSTEXPR VectorType rem{0x0000000000000002, 0xFFFFFFFFFFFFFFFF, 0x7FFFFFFFFFFFFFFF};
+		HAMON_CXX14_CONSTEXPR_EXPECT_EQ(quo, c.quo);
+		HAMON_CXX14_CONSTEXPR_EXPECT_EQ(rem, c.rem);
+	}
+	{
+		using VectorType = hamon::array<hamon::uint64_t, 2>;
+		HAMON_CXX14_CONSTEXPR VectorType a{0x0000000000000000, 0xFFFFFFFFFFFFFFFF};
+		HAMON_CXX14_CONSTEXPR VectorType b{0xFFFFFFFFFFFFFFFF, 0x0000000000000001};
+		HAMON_CXX14_CONSTEXPR auto c = hamon::bigint_algo::div_mod(a, b);
+		HAMON_CXX14_CONSTEXPR VectorType quo{0x7FFFFFFFFFFFFFFF};
+		HAMON_CXX14_CONSTEXPR VectorType rem{0x7FFFFFFFFFFFFFFF, 0x0000000000000001};
+		HAMON_CXX14_CONSTEXPR_EXPECT_EQ(quo, c.quo);
+		HAMON_CXX14_CONSTEXPR_EXPECT_EQ(rem, c.rem);
+	}
 }
@@ -0,0 +1,371 @@
+﻿/**
+ *	@file	unit_test_bigint_algo_extended_gcd.cpp
+ *
+ *	@brief	bigint_algo::extended_gcd のテスト
+ */
+
+#include <hamon/bigint/bigint_algo/extended_gcd.hpp>
+#include <hamon/bigint/bigint_algo/add.hpp>
+#include <hamon/bigint/bigint_algo/compare.hpp>
+#include <hamon/bigint/bigint_algo/multiply.hpp>
+#include <hamon/array.hpp>
+#include <hamon/cstdint.hpp>
+#include <hamon/vector.hpp>
+#include <gtest/gtest.h>
+#include "constexpr_test.hpp"
+
+namespace hamon_bigint_test
+{
+
+namespace bigint_algo_extended_gcd_test
+{
+
+#define VERIFY(...)	if (!(__VA_ARGS__)) { return false; }
+
+template <typename VectorType>
+inline HAMON_CXX14_CONSTEXPR bool
+ExtendedGcdTest(VectorType const& a, VectorType const& b, VectorType const& expected)
+{
+	VectorType g{};
+	VectorType x{};
+	VectorType y{};
+	bool const neg = hamon::bigint_algo::extended_gcd(g, x, y, a, b);
+	VERIFY(g == expected);
+	VERIFY(hamon::bigint_algo::compare(x, b) <= 0 || hamon::bigint_algo::compare(b, VectorType{0}) == 0);
+	VERIFY(hamon::bigint_algo::compare(y, a) <= 0 || hamon::bigint_algo::compare(a, VectorType{0}) == 0);
+
+	// neg なら b * y - a * x == g、そうでなければ a * x - b * y == g
+	VectorType ax{};
+	VectorType by{};
+	hamon::bigint_algo::multiply(ax, a, x);
+	hamon::bigint_algo::multiply(by, b, y);
+	if (neg)
+	{
+		hamon::bigint_algo::add(ax, g);
+		VERIFY(hamon::bigint_algo::compare(ax, by) == 0);
+	}
+	else
+	{
+		hamon::bigint_algo::add(by, g);
+		VERIFY(hamon::bigint_algo::compare(ax, by) == 0);
+	}
+	return true;
+}
+
+#undef VERIFY
+
+GTEST_TEST(BigIntAlgoTest, ExtendedGcdTest)
+{
+	EXPECT_TRUE(ExtendedGcdTest(
+		hamon::vector<hamon::uint8_t>{0x00},
+		hamon::vector<hamon::uint8_t>{0x0C},
+		hamon::vector<hamon::uint8_t>{0x0C}));
+	EXPECT_TRUE(ExtendedGcdTest(
+		hamon::vector<hamon::uint8_t>{0x0C},
+		hamon::vector<hamon::uint8_t>{0x00},
+		hamon::vector<hamon::uint8_t>{0x0C}));
+	EXPECT_TRUE(ExtendedGcdTest(
+		hamon::vector<hamon::uint8_t>{0x0C},
+		hamon::vector<hamon::uint8_t>{0x12},
+		hamon::vector<hamon::uint8_t>{0x06}));
+	EXPECT_TRUE(ExtendedGcdTest(
+		hamon::vector<hamon::uint8_t>{0x11},
+		hamon::vector<hamon::uint8_t>{0x05},
+		hamon::vector<hamon::uint8_t>{0x01}));
+	EXPECT_TRUE(ExtendedGcdTest(
+		hamon::vector<hamon::uint8_t>{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01},
+		hamon::vector<hamon::uint8_t>{0x00, 0x00, 0x00, 0x00, 0x03},
+		hamon::vector<hamon::uint8_t>{0x00, 0x00, 0x00, 0x00, 0x01}));
+	EXPECT_TRUE(ExtendedGcdTest(
+		hamon::vector<hamon::uint8_t>{0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF},
+		hamon::vector<hamon::uint8_t>{0xFF, 0xFF, 0xFF, 0xFF},
+		hamon::vector<hamon::uint8_t>{0xFF, 0xFF, 0xFF, 0xFF}));
+	EXPECT_TRUE(ExtendedGcdTest(
+		hamon::vector<hamon::uint8_t>{0x10, 0x32, 0x54, 0x76, 0x98, 0xBA, 0xDC, 0xFE, 0x10, 0x32, 0x54, 0x76, 0x98, 0xBA, 0xDC, 0xFE},
+		hamon::vector<hamon::uint8_t>{0xF0, 0xE1, 0xD2, 0xC3, 0xB4, 0xA5, 0x96, 0x87, 0x78, 0x69, 0x5A, 0x4B, 0x3C, 0x2D, 0x1E, 0x0F},
+		hamon::vector<hamon::uint8_t>{0xF0}));
+	EXPECT_TRUE(ExtendedGcdTest(
+		hamon::vector<hamon::uint8_t>{0x4E, 0xD6, 0x72, 0x17, 0xE3, 0xCE, 0xDE, 0xC5, 0x08, 0x41, 0xB4, 0x10, 0x45, 0x7B, 0xAC, 0x45, 0x16, 0xE7, 0xBC, 0x0C, 0xAC, 0x96, 0xA4, 0x9F, 0x0A, 0x5D, 0xBD, 0xD3, 0x67, 0x03},
+		hamon::vector<hamon::uint8_t>{0x5A, 0xEA, 0x64, 0x1D, 0xCF, 0xE4, 0x91, 0x1B, 0xBF, 0xAB, 0x72, 0x53, 0x4E, 0xC8, 0x34, 0x7B, 0x32, 0x8D, 0x70, 0x61, 0xA3, 0x8C, 0x88, 0x62, 0x74, 0x5D, 0x0C, 0x12, 0x01},
+		hamon::vector<hamon::uint8_t>{0xEA, 0x0B, 0x42, 0xEF, 0xC3, 0x8E, 0x20, 0x85, 0x2D, 0x63, 0x43, 0x03}));
+	EXPECT_TRUE(ExtendedGcdTest(
+		hamon::vector<hamon::uint8_t>{0x70, 0xC8, 0x35, 0xC4, 0x68, 0x0B, 0x8A, 0x6A, 0x6D, 0xF0, 0x9F, 0xA4, 0x97, 0x28, 0xF4, 0x0D},
+		hamon::vector<hamon::uint8_t>{0x69, 0xE8, 0x8E, 0x27, 0x9D, 0x91, 0xF4, 0x2B, 0xA0, 0x46, 0xC0, 0xD3, 0x24, 0xB7, 0x9F, 0x08},
+		hamon::vector<hamon::uint8_t>{0x01}));
+	EXPECT_TRUE(ExtendedGcdTest(
+		hamon::vector<hamon::uint8_t>{0xF0},
+		hamon::vector<hamon::uint8_t>{0x2E},
+		hamon::vector<hamon::uint8_t>{0x02}));
+	EXPECT_TRUE(ExtendedGcdTest(
+		hamon::vector<hamon::uint8_t>{0x2E},
+		hamon::vector<hamon::uint8_t>{0xF0},
+		hamon::vector<hamon::uint8_t>{0x02}));
+	EXPECT_TRUE(ExtendedGcdTest(
+		hamon::vector<hamon::uint8_t>{0x01},
+		hamon::vector<hamon::uint8_t>{0x01},
+		hamon::vector<hamon::uint8_t>{0x01}));
+	EXPECT_TRUE(ExtendedGcdTest(
+		hamon::vector<hamon::uint8_t>{0x07},
+		hamon::vector<hamon::uint8_t>{0x07},
+		hamon::vector<hamon::uint8_t>{0x07}));
+	EXPECT_TRUE(ExtendedGcdTest(
+		hamon::vector<hamon::uint32_t>{0x00000000},
+		hamon::vector<hamon::uint32_t>{0x0000000C},
+		hamon::vector<hamon::uint32_t>{0x0000000C}));
+	EXPECT_TRUE(ExtendedGcdTest(
+		hamon::vector<hamon::uint32_t>{0x0000000C},
+		hamon::vector<hamon::uint32_t>{0x00000000},
+		hamon::vector<hamon::uint32_t>{0x0000000C}));
+	EXPECT_TRUE(ExtendedGcdTest(
+		hamon::vector<hamon::uint32_t>{0x0000000C},
+		hamon::vector<hamon::uint32_t>{0x00000012},
+		hamon::vector<hamon::uint32_t>{0x00000006}));
+	EXPECT_TRUE(ExtendedGcdTest(
+		hamon::vector<hamon::uint32_t>{0x00000011},
+		hamon::vector<hamon::uint32_t>{0x00000005},
+		hamon::vector<hamon::uint32_t>{0x00000001}));
+	EXPECT_TRUE(ExtendedGcdTest(
+		hamon::vector<hamon::uint32_t>{0x00000000, 0x00000000, 0x00000001},
+		hamon::vector<hamon::uint32_t>{0x00000000, 0x00000003},
+		hamon::vector<hamon::uint32_t>{0x00000000, 0x00000001}));
+	EXPECT_TRUE(ExtendedGcdTest(
+		hamon::vector<hamon::uint32_t>{0xFFFFFFFF, 0xFFFFFFFF},
+		hamon::vector<hamon::uint32_t>{0xFFFFFFFF},
+		hamon::vector<hamon::uint32_t>{0xFFFFFFFF}));
+	EXPECT_TRUE(ExtendedGcdTest(
+		hamon::vector<hamon::uint32_t>{0x76543210, 0xFEDCBA98, 0x76543210, 0xFEDCBA98},
+		hamon::vector<hamon::uint32_t>{0xC3D2E1F0, 0x8796A5B4, 0x4B5A6978, 0x0F1E2D3C},
+		hamon::vector<hamon::uint32_t>{0x000000F0}));
+	EXPECT_TRUE(ExtendedGcdTest(
+		hamon::vector<hamon::uint32_t>{0x1772D64E, 0xC5DECEE3, 0x10B44108, 0x45AC7B45, 0x0CBCE716, 0x9FA496AC, 0xD3BD5D0A, 0x00000367},
+		hamon::vector<hamon::uint32_t>{0x1D64EA5A, 0x1B91E4CF, 0x5372ABBF, 0x7B34C84E, 0x61708D32, 0x62888CA3, 0x120C5D74, 0x00000001},
+		hamon::vector<hamon::uint32_t>{0xEF420BEA, 0x85208EC3, 0x0343632D}));
+	EXPECT_TRUE(ExtendedGcdTest(
+		hamon::vector<hamon::uint32_t>{0xC435C870, 0x6A8A0B68, 0xA49FF06D, 0x0DF42897},
+		hamon::vector<hamon::uint32_t>{0x278EE869, 0x2BF4919D, 0xD3C046A0, 0x089FB724},
+		hamon::vector<hamon::uint32_t>{0x00000001}));
+	EXPECT_TRUE(ExtendedGcdTest(
+		hamon::vector<hamon::uint32_t>{0x000000F0},
+		hamon::vector<hamon::uint32_t>{0x0000002E},
+		hamon::vector<hamon::uint32_t>{0x00000002}));
+	EXPECT_TRUE(ExtendedGcdTest(
+		hamon::vector<hamon::uint32_t>{0x0000002E},
+		hamon::vector<hamon::uint32_t>{0x000000F0},
+		hamon::vector<hamon::uint32_t>{0x00000002}));
+	EXPECT_TRUE(ExtendedGcdTest(
+		hamon::vector<hamon::uint32_t>{0x00000001},
+		hamon::vector<hamon::uint32_t>{0x00000001},
+		hamon::vector<hamon::uint32_t>{0x00000001}));
+	EXPECT_TRUE(ExtendedGcdTest(
+		hamon::vector<hamon::uint32_t>{0x00000007},
+		hamon::vector<hamon::uint32_t>{0x00000007},
+		hamon::vector<hamon::uint32_t>{0x00000007}));
+	EXPECT_TRUE(ExtendedGcdTest(
+		hamon::vector<hamon::uint64_t>{0x0000000000000000},
+		hamon::vector<hamon::uint64_t>{0x000000000000000C},
+		hamon::vector<hamon::uint64_t>{0x000000000000000C}));
+	EXPECT_TRUE(ExtendedGcdTest(
+		hamon::vector<hamon::uint64_t>{0x000000000000000C},
+		hamon::vector<hamon::uint64_t>{0x0000000000000000},
+		hamon::vector<hamon::uint64_t>{0x000000000000000C}));
+	EXPECT_TRUE(ExtendedGcdTest(
+		hamon::vector<hamon::uint64_t>{0x000000000000000C},
+		hamon::vector<hamon::uint64_t>{0x0000000000000012},
+		hamon::vector<hamon::uint64_t>{0x0000000000000006}));
+	EXPECT_TRUE(ExtendedGcdTest(
+		hamon::vector<hamon::uint64_t>{0x0000000000000011},
+		hamon::vector<hamon::uint64_t>{0x0000000000000005},
+		hamon::vector<hamon::uint64_t>{0x0000000000000001}));
+	EXPECT_TRUE(ExtendedGcdTest(
+		hamon::vector<hamon::uint64_t>{0x0000000000000000, 0x0000000000000001},
+		hamon::vector<hamon::uint64_t>{0x0000000300000000},
+		hamon::vector<hamon::uint64_t>{0x0000000100000000}));
+	EXPECT_TRUE(ExtendedGcdTest(
+		hamon::vector<hamon::uint64_t>{0xFFFFFFFFFFFFFFFF},
+		hamon::vector<hamon::uint64_t>{0x00000000FFFFFFFF},
+		hamon::vector<hamon::uint64_t>{0x00000000FFFFFFFF}));
+	EXPECT_TRUE(ExtendedGcdTest(
+		hamon::vector<hamon::uint64_t>{0xFEDCBA9876543210, 0xFEDCBA9876543210},
+		hamon::vector<hamon::uint64_t>{0x8796A5B4C3D2E1F0, 0x0F1E2D3C4B5A6978},
+		hamon::vector<hamon::uint64_t>{0x00000000000000F0}));
+	EXPECT_TRUE(ExtendedGcdTest(
+		hamon::vector<hamon::uint64_t>{0xC5DECEE31772D64E, 0x45AC7B4510B44108, 0x9FA496AC0CBCE716, 0x00000367D3BD5D0A},
+		hamon::vector<hamon::uint64_t>{0x1B91E4CF1D64EA5A, 0x7B34C84E5372ABBF, 0x62888CA361708D32, 0x00000001120C5D74},
+		hamon::vector<hamon::uint64_t>{0x85208EC3EF420BEA, 0x000000000343632D}));
+	EXPECT_TRUE(ExtendedGcdTest(
+		hamon::vector<hamon::uint64_t>{0x6A8A0B68C435C870, 0x0DF42897A49FF06D},
+		hamon::vector<hamon::uint64_t>{0x2BF4919D278EE869, 0x089FB724D3C046A0},
+		hamon::vector<hamon::uint64_t>{0x0000000000000001}));
+	EXPECT_TRUE(ExtendedGcdTest(
+		hamon::vector<hamon::uint64_t>{0x00000000000000F0},
+		hamon::vector<hamon::uint64_t>{0x000000000000002E},
+		hamon::vector<hamon::uint64_t>{0x0000000000000002}));
+	EXPECT_TRUE(ExtendedGcdTest(
+		hamon::vector<hamon::uint64_t>{0x000000000000002E},
+		hamon::vector<hamon::uint64_t>{0x00000000000000F0},
+		hamon::vector<hamon::uint64_t>{0x0000000000000002}));
+	EXPECT_TRUE(ExtendedGcdTest(
+		hamon::vector<hamon::uint64_t>{0x0000000000000001},
+		hamon::vector<hamon::uint64_t>{0x0000000000000001},
+		hamon::vector<hamon::uint64_t>{0x0000000000000001}));
+	EXPECT_TRUE(ExtendedGcdTest(
+		hamon::vector<hamon::uint64_t>{0x0000000000000007},
+		hamon::vector<hamon::uint64_t>{0x0000000000000007},
+		hamon::vector<hamon::uint64_t>{0x0000000000000007}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ExtendedGcdTest(
+		hamon::array<hamon::uint8_t, 48>{0x00},
+		hamon::array<hamon::uint8_t, 48>{0x0C},
+		hamon::array<hamon::uint8_t, 48>{0x0C}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ExtendedGcdTest(
+		hamon::array<hamon::uint8_t, 48>{0x0C},
+		hamon::array<hamon::uint8_t, 48>{0x00},
+		hamon::array<hamon::uint8_t, 48>{0x0C}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ExtendedGcdTest(
+		hamon::array<hamon::uint8_t, 48>{0x0C},
+		hamon::array<hamon::uint8_t, 48>{0x12},
+		hamon::array<hamon::uint8_t, 48>{0x06}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ExtendedGcdTest(
+		hamon::array<hamon::uint8_t, 48>{0x11},
+		hamon::array<hamon::uint8_t, 48>{0x05},
+		hamon::array<hamon::uint8_t, 48>{0x01}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ExtendedGcdTest(
+		hamon::array<hamon::uint8_t, 48>{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01},
+		hamon::array<hamon::uint8_t, 48>{0x00, 0x00, 0x00, 0x00, 0x03},
+		hamon::array<hamon::uint8_t, 48>{0x00, 0x00, 0x00, 0x00, 0x01}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ExtendedGcdTest(
+		hamon::array<hamon::uint8_t, 48>{0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF},
+		hamon::array<hamon::uint8_t, 48>{0xFF, 0xFF, 0xFF, 0xFF},
+		hamon::array<hamon::uint8_t, 48>{0xFF, 0xFF, 0xFF, 0xFF}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ExtendedGcdTest(
+		hamon::array<hamon::uint8_t, 48>{0x10, 0x32, 0x54, 0x76, 0x98, 0xBA, 0xDC, 0xFE, 0x10, 0x32, 0x54, 0x76, 0x98, 0xBA, 0xDC, 0xFE},
+		hamon::array<hamon::uint8_t, 48>{0xF0, 0xE1, 0xD2, 0xC3, 0xB4, 0xA5, 0x96, 0x87, 0x78, 0x69, 0x5A, 0x4B, 0x3C, 0x2D, 0x1E, 0x0F},
+		hamon::array<hamon::uint8_t, 48>{0xF0}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ExtendedGcdTest(
+		hamon::array<hamon::uint8_t, 48>{0x70, 0xC8, 0x35, 0xC4, 0x68, 0x0B, 0x8A, 0x6A, 0x6D, 0xF0, 0x9F, 0xA4, 0x97, 0x28, 0xF4, 0x0D},
+		hamon::array<hamon::uint8_t, 48>{0x69, 0xE8, 0x8E, 0x27, 0x9D, 0x91, 0xF4, 0x2B, 0xA0, 0x46, 0xC0, 0xD3, 0x24, 0xB7, 0x9F, 0x08},
+		hamon::array<hamon::uint8_t, 48>{0x01}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ExtendedGcdTest(
+		hamon::array<hamon::uint8_t, 48>{0xF0},
+		hamon::array<hamon::uint8_t, 48>{0x2E},
+		hamon::array<hamon::uint8_t, 48>{0x02}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ExtendedGcdTest(
+		hamon::array<hamon::uint8_t, 48>{0x2E},
+		hamon::array<hamon::uint8_t, 48>{0xF0},
+		hamon::array<hamon::uint8_t, 48>{0x02}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ExtendedGcdTest(
+		hamon::array<hamon::uint8_t, 48>{0x01},
+		hamon::array<hamon::uint8_t, 48>{0x01},
+		hamon::array<hamon::uint8_t, 48>{0x01}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ExtendedGcdTest(
+		hamon::array<hamon::uint8_t, 48>{0x07},
+		hamon::array<hamon::uint8_t, 48>{0x07},
+		hamon::array<hamon::uint8_t, 48>{0x07}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ExtendedGcdTest(
+		hamon::array<hamon::uint32_t, 16>{0x00000000},
+		hamon::array<hamon::uint32_t, 16>{0x0000000C},
+		hamon::array<hamon::uint32_t, 16>{0x0000000C}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ExtendedGcdTest(
+		hamon::array<hamon::uint32_t, 16>{0x0000000C},
+		hamon::array<hamon::uint32_t, 16>{0x00000000},
+		hamon::array<hamon::uint32_t, 16>{0x0000000C}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ExtendedGcdTest(
+		hamon::array<hamon::uint32_t, 16>{0x0000000C},
+		hamon::array<hamon::uint32_t, 16>{0x00000012},
+		hamon::array<hamon::uint32_t, 16>{0x00000006}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ExtendedGcdTest(
+		hamon::array<hamon::uint32_t, 16>{0x00000011},
+		hamon::array<hamon::uint32_t, 16>{0x00000005},
+		hamon::array<hamon::uint32_t, 16>{0x00000001}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ExtendedGcdTest(
+		hamon::array<hamon::uint32_t, 16>{0x00000000, 0x00000000, 0x00000001},
+		hamon::array<hamon::uint32_t, 16>{0x00000000, 0x00000003},
+		hamon::array<hamon::uint32_t, 16>{0x00000000, 0x00000001}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ExtendedGcdTest(
+		hamon::array<hamon::uint32_t, 16>{0xFFFFFFFF, 0xFFFFFFFF},
+		hamon::array<hamon::uint32_t, 16>{0xFFFFFFFF},
+		hamon::array<hamon::uint32_t, 16>{0xFFFFFFFF}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ExtendedGcdTest(
+		hamon::array<hamon::uint32_t, 16>{0x76543210, 0xFEDCBA98, 0x76543210, 0xFEDCBA98},
+		hamon::array<hamon::uint32_t, 16>{0xC3D2E1F0, 0x8796A5B4, 0x4B5A6978, 0x0F1E2D3C},
+		hamon::array<hamon::uint32_t, 16>{0x000000F0}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ExtendedGcdTest(
+		hamon::array<hamon::uint32_t, 16>{0x1772D64E, 0xC5DECEE3, 0x10B44108, 0x45AC7B45, 0x0CBCE716, 0x9FA496AC, 0xD3BD5D0A, 0x00000367},
+		hamon::array<hamon::uint32_t, 16>{0x1D64EA5A, 0x1B91E4CF, 0x5372ABBF, 0x7B34C84E, 0x61708D32, 0x62888CA3, 0x120C5D74, 0x00000001},
+		hamon::array<hamon::uint32_t, 16>{0xEF420BEA, 0x85208EC3, 0x0343632D}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ExtendedGcdTest(
+		hamon::array<hamon::uint32_t, 16>{0xC435C870, 0x6A8A0B68, 0xA49FF06D, 0x0DF42897},
+		hamon::array<hamon::uint32_t, 16>{0x278EE869, 0x2BF4919D, 0xD3C046A0, 0x089FB724},
+		hamon::array<hamon::uint32_t, 16>{0x00000001}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ExtendedGcdTest(
+		hamon::array<hamon::uint32_t, 16>{0x000000F0},
+		hamon::array<hamon::uint32_t, 16>{0x0000002E},
+		hamon::array<hamon::uint32_t, 16>{0x00000002}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ExtendedGcdTest(
+		hamon::array<hamon::uint32_t, 16>{0x0000002E},
+		hamon::array<hamon::uint32_t, 16>{0x000000F0},
+		hamon::array<hamon::uint32_t, 16>{0x00000002}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ExtendedGcdTest(
+		hamon::array<hamon::uint32_t, 16>{0x00000001},
+		hamon::array<hamon::uint32_t, 16>{0x00000001},
+		hamon::array<hamon::uint32_t, 16>{0x00000001}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ExtendedGcdTest(
+		hamon::array<hamon::uint32_t, 16>{0x00000007},
+		hamon::array<hamon::uint32_t, 16>{0x00000007},
+		hamon::array<hamon::uint32_t, 16>{0x00000007}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ExtendedGcdTest(
+		hamon::array<hamon::uint64_t, 8>{0x0000000000000000},
+		hamon::array<hamon::uint64_t, 8>{0x000000000000000C},
+		hamon::array<hamon::uint64_t, 8>{0x000000000000000C}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ExtendedGcdTest(
+		hamon::array<hamon::uint64_t, 8>{0x000000000000000C},
+		hamon::array<hamon::uint64_t, 8>{0x0000000000000000},
+		hamon::array<hamon::uint64_t, 8>{0x000000000000000C}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ExtendedGcdTest(
+		hamon::array<hamon::uint64_t, 8>{0x000000000000000C},
+		hamon::array<hamon::uint64_t, 8>{0x0000000000000012},
+		hamon::array<hamon::uint64_t, 8>{0x0000000000000006}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ExtendedGcdTest(
+		hamon::array<hamon::uint64_t, 8>{0x0000000000000011},
+		hamon::array<hamon::uint64_t, 8>{0x0000000000000005},
+		hamon::array<hamon::uint64_t, 8>{0x0000000000000001}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ExtendedGcdTest(
+		hamon::array<hamon::uint64_t, 8>{0x0000000000000000, 0x0000000000000001},
+		hamon::array<hamon::uint64_t, 8>{0x0000000300000000},
+		hamon::array<hamon::uint64_t, 8>{0x0000000100000000}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ExtendedGcdTest(
+		hamon::array<hamon::uint64_t, 8>{0xFFFFFFFFFFFFFFFF},
+		hamon::array<hamon::uint64_t, 8>{0x00000000FFFFFFFF},
+		hamon::array<hamon::uint64_t, 8>{0x00000000FFFFFFFF}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ExtendedGcdTest(
+		hamon::array<hamon::uint64_t, 8>{0xFEDCBA9876543210, 0xFEDCBA9876543210},
+		hamon::array<hamon::uint64_t, 8>{0x8796A5B4C3D2E1F0, 0x0F1E2D3C4B5A6978},
+		hamon::array<hamon::uint64_t, 8>{0x00000000000000F0}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ExtendedGcdTest(
+		hamon::array<hamon::uint64_t, 8>{0xC5DECEE31772D64E, 0x45AC7B4510B44108, 0x9FA496AC0CBCE716, 0x00000367D3BD5D0A},
+		hamon::array<hamon::uint64_t, 8>{0x1B91E4CF1D64EA5A, 0x7B34C84E5372ABBF, 0x62888CA361708D32, 0x00000001120C5D74},
+		hamon::array<hamon::uint64_t, 8>{0x85208EC3EF420BEA, 0x000000000343632D}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ExtendedGcdTest(
+		hamon::array<hamon::uint64_t, 8>{0x6A8A0B68C435C870, 0x0DF42897A49FF06D},
+		hamon::array<hamon::uint64_t, 8>{0x2BF4919D278EE869, 0x089FB724D3C046A0},
+		hamon::array<hamon::uint64_t, 8>{0x0000000000000001}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ExtendedGcdTest(
+		hamon::array<hamon::uint64_t, 8>{0x00000000000000F0},
+		hamon::array<hamon::uint64_t, 8>{0x000000000000002E},
+		hamon::array<hamon::uint64_t, 8>{0x0000000000000002}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ExtendedGcdTest(
+		hamon::array<hamon::uint64_t, 8>{0x000000000000002E},
+		hamon::array<hamon::uint64_t, 8>{0x00000000000000F0},
+		hamon::array<hamon::uint64_t, 8>{0x0000000000000002}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ExtendedGcdTest(
+		hamon::array<hamon::uint64_t, 8>{0x0000000000000001},
+		hamon::array<hamon::uint64_t, 8>{0x0000000000000001},
+		hamon::array<hamon::uint64_t, 8>{0x0000000000000001}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ExtendedGcdTest(
+		hamon::array<hamon::uint64_t, 8>{0x0000000000000007},
+		hamon::array<hamon::uint64_t, 8>{0x0000000000000007},
+		hamon::array<hamon::uint64_t, 8>{0x0000000000000007}));
+}
+
+}	// namespace bigint_algo_extended_gcd_test
+
+}	// namespace hamon_bigint_test
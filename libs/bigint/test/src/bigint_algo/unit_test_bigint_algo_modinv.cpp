@@ -0,0 +1,345 @@
+﻿/**
+ *	@file	unit_test_bigint_algo_modinv.cpp
+ *
+ *	@brief	bigint_algo::modinv のテスト
+ */
+
+#include <hamon/bigint/bigint_algo/modinv.hpp>
+#include <hamon/array.hpp>
+#include <hamon/cstdint.hpp>
+#include <hamon/vector.hpp>
+#include <gtest/gtest.h>
+#include "constexpr_test.hpp"
+
+namespace hamon_bigint_test
+{
+
+namespace bigint_algo_modinv_test
+{
+
+#define VERIFY(...)	if (!(__VA_ARGS__)) { return false; }
+
+template <typename VectorType>
+inline HAMON_CXX14_CONSTEXPR bool
+ModinvTest(VectorType const& a, VectorType const& m, VectorType const& expected, bool exists)
+{
+	{
+		VectorType c{};
+		bool f = hamon::bigint_algo::modinv(c, a, m);
+		VERIFY(c == expected);
+		VERIFY(f == exists);
+	}
+	// 出力と入力が同じオブジェクト
+	{
+		VectorType c = a;
+		bool f = hamon::bigint_algo::modinv(c, c, m);
+		VERIFY(c == expected);
+		VERIFY(f == exists);
+	}
+	return true;
+}
+
+#undef VERIFY
+
+GTEST_TEST(BigIntAlgoTest, ModinvTest)
+{
+	EXPECT_TRUE(ModinvTest(
+		hamon::vector<hamon::uint8_t>{0x03},
+		hamon::vector<hamon::uint8_t>{0x0B},
+		hamon::vector<hamon::uint8_t>{0x04},
+		true));
+	EXPECT_TRUE(ModinvTest(
+		hamon::vector<hamon::uint8_t>{0x0A},
+		hamon::vector<hamon::uint8_t>{0x11},
+		hamon::vector<hamon::uint8_t>{0x0C},
+		true));
+	EXPECT_TRUE(ModinvTest(
+		hamon::vector<hamon::uint8_t>{0x04},
+		hamon::vector<hamon::uint8_t>{0x08},
+		hamon::vector<hamon::uint8_t>{0x00},
+		false));
+	EXPECT_TRUE(ModinvTest(
+		hamon::vector<hamon::uint8_t>{0x00},
+		hamon::vector<hamon::uint8_t>{0x07},
+		hamon::vector<hamon::uint8_t>{0x00},
+		false));
+	EXPECT_TRUE(ModinvTest(
+		hamon::vector<hamon::uint8_t>{0x01},
+		hamon::vector<hamon::uint8_t>{0x01},
+		hamon::vector<hamon::uint8_t>{0x00},
+		true));
+	EXPECT_TRUE(ModinvTest(
+		hamon::vector<hamon::uint8_t>{0x0C},
+		hamon::vector<hamon::uint8_t>{0xE8, 0x03},
+		hamon::vector<hamon::uint8_t>{0x00},
+		false));
+	EXPECT_TRUE(ModinvTest(
+		hamon::vector<hamon::uint8_t>{0x07},
+		hamon::vector<hamon::uint8_t>{0xE8, 0x03},
+		hamon::vector<hamon::uint8_t>{0x8F},
+		true));
+	EXPECT_TRUE(ModinvTest(
+		hamon::vector<hamon::uint8_t>{0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01},
+		hamon::vector<hamon::uint8_t>{0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F},
+		hamon::vector<hamon::uint8_t>{0xDB, 0xB6, 0x6D, 0xDB, 0xB6, 0x6D, 0xDB, 0xB6, 0xB6, 0x6D, 0xDB, 0xB6, 0x6D, 0xDB, 0xB6, 0x6D},
+		true));
+	EXPECT_TRUE(ModinvTest(
+		hamon::vector<hamon::uint8_t>{0x11, 0x32, 0x54, 0x76, 0x98, 0xBA, 0xDC, 0xFE, 0x10, 0x32, 0x54, 0x76, 0x98, 0xBA, 0xDC, 0xFE},
+		hamon::vector<hamon::uint8_t>{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01},
+		hamon::vector<hamon::uint8_t>{0xF1, 0xFE, 0x10, 0xF0, 0xFE, 0x10, 0xF0, 0xFE, 0x20, 0xCF, 0x2E, 0x04, 0xAB, 0x70, 0xE6, 0x86},
+		true));
+	EXPECT_TRUE(ModinvTest(
+		hamon::vector<hamon::uint8_t>{0xC0, 0x23, 0xCF, 0xD6, 0xF0, 0x06, 0x6D, 0x2A, 0xB4, 0x20, 0xD1, 0x4B, 0x9A, 0xB5, 0x78, 0x46, 0xF3, 0x44, 0x85, 0xE3, 0x73, 0x37, 0xB9, 0x13, 0x85},
+		hamon::vector<hamon::uint8_t>{0x3F, 0x24, 0x9F, 0x9F, 0x33, 0xE0, 0x60, 0x1A, 0x36, 0xBC, 0xFC, 0xFC, 0x65, 0x5E, 0x0E, 0xDB, 0x67, 0x96, 0x46, 0xD0, 0x3D, 0xBC, 0x99, 0x95, 0xC8, 0xB9, 0x6B, 0xA7, 0xA3, 0x92, 0x65, 0x77},
+		hamon::vector<hamon::uint8_t>{0x00},
+		false));
+	EXPECT_TRUE(ModinvTest(
+		hamon::vector<hamon::uint32_t>{0x00000003},
+		hamon::vector<hamon::uint32_t>{0x0000000B},
+		hamon::vector<hamon::uint32_t>{0x00000004},
+		true));
+	EXPECT_TRUE(ModinvTest(
+		hamon::vector<hamon::uint32_t>{0x0000000A},
+		hamon::vector<hamon::uint32_t>{0x00000011},
+		hamon::vector<hamon::uint32_t>{0x0000000C},
+		true));
+	EXPECT_TRUE(ModinvTest(
+		hamon::vector<hamon::uint32_t>{0x00000004},
+		hamon::vector<hamon::uint32_t>{0x00000008},
+		hamon::vector<hamon::uint32_t>{0x00000000},
+		false));
+	EXPECT_TRUE(ModinvTest(
+		hamon::vector<hamon::uint32_t>{0x00000000},
+		hamon::vector<hamon::uint32_t>{0x00000007},
+		hamon::vector<hamon::uint32_t>{0x00000000},
+		false));
+	EXPECT_TRUE(ModinvTest(
+		hamon::vector<hamon::uint32_t>{0x00000001},
+		hamon::vector<hamon::uint32_t>{0x00000001},
+		hamon::vector<hamon::uint32_t>{0x00000000},
+		true));
+	EXPECT_TRUE(ModinvTest(
+		hamon::vector<hamon::uint32_t>{0x0000000C},
+		hamon::vector<hamon::uint32_t>{0x000003E8},
+		hamon::vector<hamon::uint32_t>{0x00000000},
+		false));
+	EXPECT_TRUE(ModinvTest(
+		hamon::vector<hamon::uint32_t>{0x00000007},
+		hamon::vector<hamon::uint32_t>{0x000003E8},
+		hamon::vector<hamon::uint32_t>{0x0000008F},
+		true));
+	EXPECT_TRUE(ModinvTest(
+		hamon::vector<hamon::uint32_t>{0x00000003, 0x00000000, 0x00000001},
+		hamon::vector<hamon::uint32_t>{0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x7FFFFFFF},
+		hamon::vector<hamon::uint32_t>{0xDB6DB6DB, 0xB6DB6DB6, 0xB6DB6DB6, 0x6DB6DB6D},
+		true));
+	EXPECT_TRUE(ModinvTest(
+		hamon::vector<hamon::uint32_t>{0x76543211, 0xFEDCBA98, 0x76543210, 0xFEDCBA98},
+		hamon::vector<hamon::uint32_t>{0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000001},
+		hamon::vector<hamon::uint32_t>{0xF010FEF1, 0xFEF010FE, 0x042ECF20, 0x86E670AB},
+		true));
+	EXPECT_TRUE(ModinvTest(
+		hamon::vector<hamon::uint32_t>{0xD6CF23C0, 0x2A6D06F0, 0x4BD120B4, 0x4678B59A, 0xE38544F3, 0x13B93773, 0x00000085},
+		hamon::vector<hamon::uint32_t>{0x9F9F243F, 0x1A60E033, 0xFCFCBC36, 0xDB0E5E65, 0xD0469667, 0x9599BC3D, 0xA76BB9C8, 0x776592A3},
+		hamon::vector<hamon::uint32_t>{0x00000000},
+		false));
+	EXPECT_TRUE(ModinvTest(
+		hamon::vector<hamon::uint64_t>{0x0000000000000003},
+		hamon::vector<hamon::uint64_t>{0x000000000000000B},
+		hamon::vector<hamon::uint64_t>{0x0000000000000004},
+		true));
+	EXPECT_TRUE(ModinvTest(
+		hamon::vector<hamon::uint64_t>{0x000000000000000A},
+		hamon::vector<hamon::uint64_t>{0x0000000000000011},
+		hamon::vector<hamon::uint64_t>{0x000000000000000C},
+		true));
+	EXPECT_TRUE(ModinvTest(
+		hamon::vector<hamon::uint64_t>{0x0000000000000004},
+		hamon::vector<hamon::uint64_t>{0x0000000000000008},
+		hamon::vector<hamon::uint64_t>{0x0000000000000000},
+		false));
+	EXPECT_TRUE(ModinvTest(
+		hamon::vector<hamon::uint64_t>{0x0000000000000000},
+		hamon::vector<hamon::uint64_t>{0x0000000000000007},
+		hamon::vector<hamon::uint64_t>{0x0000000000000000},
+		false));
+	EXPECT_TRUE(ModinvTest(
+		hamon::vector<hamon::uint64_t>{0x0000000000000001},
+		hamon::vector<hamon::uint64_t>{0x0000000000000001},
+		hamon::vector<hamon::uint64_t>{0x0000000000000000},
+		true));
+	EXPECT_TRUE(ModinvTest(
+		hamon::vector<hamon::uint64_t>{0x000000000000000C},
+		hamon::vector<hamon::uint64_t>{0x00000000000003E8},
+		hamon::vector<hamon::uint64_t>{0x0000000000000000},
+		false));
+	EXPECT_TRUE(ModinvTest(
+		hamon::vector<hamon::uint64_t>{0x0000000000000007},
+		hamon::vector<hamon::uint64_t>{0x00000000000003E8},
+		hamon::vector<hamon::uint64_t>{0x000000000000008F},
+		true));
+	EXPECT_TRUE(ModinvTest(
+		hamon::vector<hamon::uint64_t>{0x0000000000000003, 0x0000000000000001},
+		hamon::vector<hamon::uint64_t>{0xFFFFFFFFFFFFFFFF, 0x7FFFFFFFFFFFFFFF},
+		hamon::vector<hamon::uint64_t>{0xB6DB6DB6DB6DB6DB, 0x6DB6DB6DB6DB6DB6},
+		true));
+	EXPECT_TRUE(ModinvTest(
+		hamon::vector<hamon::uint64_t>{0xFEDCBA9876543211, 0xFEDCBA9876543210},
+		hamon::vector<hamon::uint64_t>{0x0000000000000000, 0x0000000000000000, 0x0000000000000001},
+		hamon::vector<hamon::uint64_t>{0xFEF010FEF010FEF1, 0x86E670AB042ECF20},
+		true));
+	EXPECT_TRUE(ModinvTest(
+		hamon::vector<hamon::uint64_t>{0x2A6D06F0D6CF23C0, 0x4678B59A4BD120B4, 0x13B93773E38544F3, 0x0000000000000085},
+		hamon::vector<hamon::uint64_t>{0x1A60E0339F9F243F, 0xDB0E5E65FCFCBC36, 0x9599BC3DD0469667, 0x776592A3A76BB9C8},
+		hamon::vector<hamon::uint64_t>{0x0000000000000000},
+		false));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ModinvTest(
+		hamon::array<hamon::uint8_t, 20>{0x03},
+		hamon::array<hamon::uint8_t, 20>{0x0B},
+		hamon::array<hamon::uint8_t, 20>{0x04},
+		true));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ModinvTest(
+		hamon::array<hamon::uint8_t, 20>{0x0A},
+		hamon::array<hamon::uint8_t, 20>{0x11},
+		hamon::array<hamon::uint8_t, 20>{0x0C},
+		true));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ModinvTest(
+		hamon::array<hamon::uint8_t, 20>{0x04},
+		hamon::array<hamon::uint8_t, 20>{0x08},
+		hamon::array<hamon::uint8_t, 20>{0x00},
+		false));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ModinvTest(
+		hamon::array<hamon::uint8_t, 20>{0x00},
+		hamon::array<hamon::uint8_t, 20>{0x07},
+		hamon::array<hamon::uint8_t, 20>{0x00},
+		false));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ModinvTest(
+		hamon::array<hamon::uint8_t, 20>{0x01},
+		hamon::array<hamon::uint8_t, 20>{0x01},
+		hamon::array<hamon::uint8_t, 20>{0x00},
+		true));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ModinvTest(
+		hamon::array<hamon::uint8_t, 20>{0x0C},
+		hamon::array<hamon::uint8_t, 20>{0xE8, 0x03},
+		hamon::array<hamon::uint8_t, 20>{0x00},
+		false));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ModinvTest(
+		hamon::array<hamon::uint8_t, 20>{0x07},
+		hamon::array<hamon::uint8_t, 20>{0xE8, 0x03},
+		hamon::array<hamon::uint8_t, 20>{0x8F},
+		true));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ModinvTest(
+		hamon::array<hamon::uint8_t, 20>{0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01},
+		hamon::array<hamon::uint8_t, 20>{0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F},
+		hamon::array<hamon::uint8_t, 20>{0xDB, 0xB6, 0x6D, 0xDB, 0xB6, 0x6D, 0xDB, 0xB6, 0xB6, 0x6D, 0xDB, 0xB6, 0x6D, 0xDB, 0xB6, 0x6D},
+		true));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ModinvTest(
+		hamon::array<hamon::uint8_t, 20>{0x11, 0x32, 0x54, 0x76, 0x98, 0xBA, 0xDC, 0xFE, 0x10, 0x32, 0x54, 0x76, 0x98, 0xBA, 0xDC, 0xFE},
+		hamon::array<hamon::uint8_t, 20>{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01},
+		hamon::array<hamon::uint8_t, 20>{0xF1, 0xFE, 0x10, 0xF0, 0xFE, 0x10, 0xF0, 0xFE, 0x20, 0xCF, 0x2E, 0x04, 0xAB, 0x70, 0xE6, 0x86},
+		true));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ModinvTest(
+		hamon::array<hamon::uint32_t, 8>{0x00000003},
+		hamon::array<hamon::uint32_t, 8>{0x0000000B},
+		hamon::array<hamon::uint32_t, 8>{0x00000004},
+		true));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ModinvTest(
+		hamon::array<hamon::uint32_t, 8>{0x0000000A},
+		hamon::array<hamon::uint32_t, 8>{0x00000011},
+		hamon::array<hamon::uint32_t, 8>{0x0000000C},
+		true));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ModinvTest(
+		hamon::array<hamon::uint32_t, 8>{0x00000004},
+		hamon::array<hamon::uint32_t, 8>{0x00000008},
+		hamon::array<hamon::uint32_t, 8>{0x00000000},
+		false));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ModinvTest(
+		hamon::array<hamon::uint32_t, 8>{0x00000000},
+		hamon::array<hamon::uint32_t, 8>{0x00000007},
+		hamon::array<hamon::uint32_t, 8>{0x00000000},
+		false));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ModinvTest(
+		hamon::array<hamon::uint32_t, 8>{0x00000001},
+		hamon::array<hamon::uint32_t, 8>{0x00000001},
+		hamon::array<hamon::uint32_t, 8>{0x00000000},
+		true));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ModinvTest(
+		hamon::array<hamon::uint32_t, 8>{0x0000000C},
+		hamon::array<hamon::uint32_t, 8>{0x000003E8},
+		hamon::array<hamon::uint32_t, 8>{0x00000000},
+		false));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ModinvTest(
+		hamon::array<hamon::uint32_t, 8>{0x00000007},
+		hamon::array<hamon::uint32_t, 8>{0x000003E8},
+		hamon::array<hamon::uint32_t, 8>{0x0000008F},
+		true));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ModinvTest(
+		hamon::array<hamon::uint32_t, 8>{0x00000003, 0x00000000, 0x00000001},
+		hamon::array<hamon::uint32_t, 8>{0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x7FFFFFFF},
+		hamon::array<hamon::uint32_t, 8>{0xDB6DB6DB, 0xB6DB6DB6, 0xB6DB6DB6, 0x6DB6DB6D},
+		true));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ModinvTest(
+		hamon::array<hamon::uint32_t, 8>{0x76543211, 0xFEDCBA98, 0x76543210, 0xFEDCBA98},
+		hamon::array<hamon::uint32_t, 8>{0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000001},
+		hamon::array<hamon::uint32_t, 8>{0xF010FEF1, 0xFEF010FE, 0x042ECF20, 0x86E670AB},
+		true));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ModinvTest(
+		hamon::array<hamon::uint32_t, 8>{0xD6CF23C0, 0x2A6D06F0, 0x4BD120B4, 0x4678B59A, 0xE38544F3, 0x13B93773, 0x00000085},
+		hamon::array<hamon::uint32_t, 8>{0x9F9F243F, 0x1A60E033, 0xFCFCBC36, 0xDB0E5E65, 0xD0469667, 0x9599BC3D, 0xA76BB9C8, 0x776592A3},
+		hamon::array<hamon::uint32_t, 8>{0x00000000},
+		false));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ModinvTest(
+		hamon::array<hamon::uint64_t, 4>{0x0000000000000003},
+		hamon::array<hamon::uint64_t, 4>{0x000000000000000B},
+		hamon::array<hamon::uint64_t, 4>{0x0000000000000004},
+		true));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ModinvTest(
+		hamon::array<hamon::uint64_t, 4>{0x000000000000000A},
+		hamon::array<hamon::uint64_t, 4>{0x0000000000000011},
+		hamon::array<hamon::uint64_t, 4>{0x000000000000000C},
+		true));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ModinvTest(
+		hamon::array<hamon::uint64_t, 4>{0x0000000000000004},
+		hamon::array<hamon::uint64_t, 4>{0x0000000000000008},
+		hamon::array<hamon::uint64_t, 4>{0x0000000000000000},
+		false));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ModinvTest(
+		hamon::array<hamon::uint64_t, 4>{0x0000000000000000},
+		hamon::array<hamon::uint64_t, 4>{0x0000000000000007},
+		hamon::array<hamon::uint64_t, 4>{0x0000000000000000},
+		false));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ModinvTest(
+		hamon::array<hamon::uint64_t, 4>{0x0000000000000001},
+		hamon::array<hamon::uint64_t, 4>{0x0000000000000001},
+		hamon::array<hamon::uint64_t, 4>{0x0000000000000000},
+		true));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ModinvTest(
+		hamon::array<hamon::uint64_t, 4>{0x000000000000000C},
+		hamon::array<hamon::uint64_t, 4>{0x00000000000003E8},
+		hamon::array<hamon::uint64_t, 4>{0x0000000000000000},
+		false));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ModinvTest(
+		hamon::array<hamon::uint64_t, 4>{0x0000000000000007},
+		hamon::array<hamon::uint64_t, 4>{0x00000000000003E8},
+		hamon::array<hamon::uint64_t, 4>{0x000000000000008F},
+		true));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ModinvTest(
+		hamon::array<hamon::uint64_t, 4>{0x0000000000000003, 0x0000000000000001},
+		hamon::array<hamon::uint64_t, 4>{0xFFFFFFFFFFFFFFFF, 0x7FFFFFFFFFFFFFFF},
+		hamon::array<hamon::uint64_t, 4>{0xB6DB6DB6DB6DB6DB, 0x6DB6DB6DB6DB6DB6},
+		true));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ModinvTest(
+		hamon::array<hamon::uint64_t, 4>{0xFEDCBA9876543211, 0xFEDCBA9876543210},
+		hamon::array<hamon::uint64_t, 4>{0x0000000000000000, 0x0000000000000000, 0x0000000000000001},
+		hamon::array<hamon::uint64_t, 4>{0xFEF010FEF010FEF1, 0x86E670AB042ECF20},
+		true));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ModinvTest(
+		hamon::array<hamon::uint64_t, 4>{0x2A6D06F0D6CF23C0, 0x4678B59A4BD120B4, 0x13B93773E38544F3, 0x0000000000000085},
+		hamon::array<hamon::uint64_t, 4>{0x1A60E0339F9F243F, 0xDB0E5E65FCFCBC36, 0x9599BC3DD0469667, 0x776592A3A76BB9C8},
+		hamon::array<hamon::uint64_t, 4>{0x0000000000000000},
+		false));
+}
+
+}	// namespace bigint_algo_modinv_test
+
+}	// namespace hamon_bigint_test
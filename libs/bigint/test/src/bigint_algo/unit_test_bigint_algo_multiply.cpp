@@ -191,6 +191,41 @@ GTEST_TEST(BigIntAlgoTest, MultiplyTest)
 		hamon::array<hamon::uint64_t, 4>{0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF},
 		hamon::array<hamon::uint64_t, 4>{0x0000000000000001, 0x0000000000000000, 0xFFFFFFFFFFFFFFFE, 0xFFFFFFFFFFFFFFFF},
 		false));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(MultiplyTest(
+		hamon::array<hamon::uint64_t, 2>{0xFFFFFFFFFFFFFFFF},
+		hamon::array<hamon::uint64_t, 2>{0xFFFFFFFFFFFFFFFF},
+		hamon::array<hamon::uint64_t, 2>{0x0000000000000001, 0xFFFFFFFFFFFFFFFE},
+		false));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(MultiplyTest(
+		hamon::array<hamon::uint64_t, 2>{0x8000000000000000},
+		hamon::array<hamon::uint64_t, 2>{0x0000000000000002},
+		hamon::array<hamon::uint64_t, 2>{0x0000000000000000, 0x0000000000000001},
+		false));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(MultiplyTest(
+		hamon::array<hamon::uint64_t, 2>{0x0000000000000000, 0x8000000000000000},
+		hamon::array<hamon::uint64_t, 2>{0x0000000000000002},
+		hamon::array<hamon::uint64_t, 2>{0x0000000000000000, 0x0000000000000000},
+		true));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(MultiplyTest(
+		hamon::array<hamon::uint64_t, 2>{0x0000000000000000, 0x0000000000000001},
+		hamon::array<hamon::uint64_t, 2>{0x0000000000000000, 0x0000000000000001},
+		hamon::array<hamon::uint64_t, 2>{0x0000000000000000, 0x0000000000000000},
+		true));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(MultiplyTest(
+		hamon::array<hamon::uint64_t, 2>{0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF},
+		hamon::array<hamon::uint64_t, 2>{0xFFFFFFFFFFFFFFFF},
+		hamon::array<hamon::uint64_t, 2>{0x0000000000000001, 0xFFFFFFFFFFFFFFFF},
+		true));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(MultiplyTest(
+		hamon::array<hamon::uint32_t, 3>{0x00000000, 0x00000001},
+		hamon::array<hamon::uint32_t, 3>{0x00000000, 0x00000000, 0x00000001},
+		hamon::array<hamon::uint32_t, 3>{0x00000000, 0x00000000, 0x00000000},
+		true));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(MultiplyTest(
+		hamon::array<hamon::uint32_t, 3>{0xFFFFFFFF, 0xFFFFFFFF},
+		hamon::array<hamon::uint32_t, 3>{0x00000000, 0x00000001},
+		hamon::array<hamon::uint32_t, 3>{0x00000000, 0xFFFFFFFF, 0xFFFFFFFF},
+		false));
 }
 
 }	// namespace bigint_algo_multiply_test
@@ -0,0 +1,338 @@
+﻿/**
+ *	@file	unit_test_bigint_algo_powm.cpp
+ *
+ *	@brief	bigint_algo::powm のテスト
+ */
+
+#include <hamon/bigint/bigint_algo/powm.hpp>
+#include <hamon/array.hpp>
+#include <hamon/cstdint.hpp>
+#include <hamon/vector.hpp>
+#include <gtest/gtest.h>
+#include "constexpr_test.hpp"
+
+namespace hamon_bigint_test
+{
+
+namespace bigint_algo_powm_test
+{
+
+#define VERIFY(...)	if (!(__VA_ARGS__)) { return false; }
+
+template <typename VectorType>
+inline HAMON_CXX14_CONSTEXPR bool
+PowmTest(VectorType const& base, VectorType const& exp, VectorType const& mod, VectorType const& expected)
+{
+	{
+		VectorType c{};
+		hamon::bigint_algo::powm(c, base, exp, mod);
+		VERIFY(c == expected);
+	}
+	// 出力と入力が同じオブジェクト
+	{
+		VectorType c = base;
+		hamon::bigint_algo::powm(c, c, exp, mod);
+		VERIFY(c == expected);
+	}
+	return true;
+}
+
+#undef VERIFY
+
+GTEST_TEST(BigIntAlgoTest, PowmTest)
+{
+	EXPECT_TRUE(PowmTest(
+		hamon::vector<hamon::uint8_t>{0x04},
+		hamon::vector<hamon::uint8_t>{0x0D},
+		hamon::vector<hamon::uint8_t>{0xF1, 0x01},
+		hamon::vector<hamon::uint8_t>{0xBD, 0x01}));
+	EXPECT_TRUE(PowmTest(
+		hamon::vector<hamon::uint8_t>{0x03},
+		hamon::vector<hamon::uint8_t>{0xC8},
+		hamon::vector<hamon::uint8_t>{0xE8, 0x03},
+		hamon::vector<hamon::uint8_t>{0x01}));
+	EXPECT_TRUE(PowmTest(
+		hamon::vector<hamon::uint8_t>{0x15, 0xCD, 0x5B, 0x07},
+		hamon::vector<hamon::uint8_t>{0x00},
+		hamon::vector<hamon::uint8_t>{0x43, 0x42, 0x0F},
+		hamon::vector<hamon::uint8_t>{0x01}));
+	EXPECT_TRUE(PowmTest(
+		hamon::vector<hamon::uint8_t>{0x00},
+		hamon::vector<hamon::uint8_t>{0x05},
+		hamon::vector<hamon::uint8_t>{0x07},
+		hamon::vector<hamon::uint8_t>{0x00}));
+	EXPECT_TRUE(PowmTest(
+		hamon::vector<hamon::uint8_t>{0x05},
+		hamon::vector<hamon::uint8_t>{0x03},
+		hamon::vector<hamon::uint8_t>{0x01},
+		hamon::vector<hamon::uint8_t>{0x00}));
+	EXPECT_TRUE(PowmTest(
+		hamon::vector<hamon::uint8_t>{0x07},
+		hamon::vector<hamon::uint8_t>{0x0B},
+		hamon::vector<hamon::uint8_t>{0x00},
+		hamon::vector<hamon::uint8_t>{0x00}));
+	EXPECT_TRUE(PowmTest(
+		hamon::vector<hamon::uint8_t>{0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F},
+		hamon::vector<hamon::uint8_t>{0x01, 0x00, 0x01},
+		hamon::vector<hamon::uint8_t>{0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01},
+		hamon::vector<hamon::uint8_t>{0x7F, 0xA6, 0xC4, 0x06, 0xD0, 0x0B, 0xB6, 0x0C, 0x7F, 0xF7, 0xAB, 0x01}));
+	EXPECT_TRUE(PowmTest(
+		hamon::vector<hamon::uint8_t>{0x98, 0xBA, 0xDC, 0xFE, 0x10, 0x32, 0x54, 0x76, 0x98, 0xBA, 0xDC, 0xFE},
+		hamon::vector<hamon::uint8_t>{0xEF, 0xCD, 0xAB, 0x89, 0x67, 0x45, 0x23, 0x01},
+		hamon::vector<hamon::uint8_t>{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0},
+		hamon::vector<hamon::uint8_t>{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80}));
+	EXPECT_TRUE(PowmTest(
+		hamon::vector<hamon::uint8_t>{0x95, 0x88, 0xDE, 0x09, 0x16, 0xD0, 0x3C, 0x49, 0xD8, 0xC1, 0x3B, 0xB2, 0x84, 0x45, 0x3F, 0xC3, 0xA5, 0xCE, 0xD8, 0x24, 0x99, 0xA7, 0x9B, 0xF5, 0x87, 0x83, 0x68, 0x76, 0x14, 0xC1, 0x7A, 0x01},
+		hamon::vector<hamon::uint8_t>{0xC2, 0x0A, 0xF1, 0xAB, 0xA7, 0xDF, 0xCC, 0xB2, 0xCF, 0xDA, 0xFE, 0xCA, 0x65, 0x18, 0xA6, 0x18, 0x90, 0x35, 0x04, 0x74, 0x56, 0x7A, 0x4B, 0x99, 0xC2, 0xC4, 0x8E, 0x7F, 0xA3, 0x9A, 0x6F, 0x02},
+		hamon::vector<hamon::uint8_t>{0xF5, 0x7A, 0xE7, 0x04, 0xB0, 0xA6, 0x9A, 0x83, 0xE2, 0x08, 0xB1, 0x6E, 0xDC, 0x61, 0x9D, 0x93, 0x6C, 0xF2, 0x53, 0x5F, 0x68, 0xE1, 0xDF, 0x9F, 0x6E, 0x96, 0x2F, 0xDA, 0x06, 0xD5, 0xC9, 0x03},
+		hamon::vector<hamon::uint8_t>{0xFE, 0x45, 0x5F, 0x8B, 0xEE, 0x0F, 0x78, 0x31, 0xF5, 0x8D, 0x8B, 0xAB, 0xD1, 0xA7, 0x62, 0x86, 0xA0, 0x4D, 0xA9, 0x19, 0xA8, 0x18, 0xE7, 0xE7, 0x9B, 0xE2, 0x9B, 0x69, 0x22, 0x0F, 0x88, 0x03}));
+	EXPECT_TRUE(PowmTest(
+		hamon::vector<hamon::uint8_t>{0x07, 0x23, 0x07, 0x8C, 0x30, 0x34, 0xF2, 0xE2, 0xBF, 0x71, 0x5C, 0xC1, 0x08, 0xB7, 0x62, 0xF3, 0xF1, 0x16, 0x1F, 0x6F, 0x63, 0xF3, 0xD8, 0x64, 0xEA, 0xA9, 0x1A, 0x2D, 0x37, 0x9D, 0xC6, 0x0E},
+		hamon::vector<hamon::uint8_t>{0xED, 0xF5, 0xD2, 0xD9, 0x44, 0x4C, 0x78, 0x1B, 0xFA, 0xEF, 0xF9, 0xD1, 0x62, 0xA0, 0xE2, 0x1F, 0xA0, 0x3F, 0x38, 0x60, 0x58, 0xAC, 0x49, 0x27, 0x18},
+		hamon::vector<hamon::uint8_t>{0x4C, 0x35, 0x3C, 0x52, 0x10, 0x45, 0x5D, 0x06, 0x05, 0xB8, 0x44, 0xAB, 0xB7, 0xBA, 0xF0, 0xFD, 0xC0, 0x86, 0xE5, 0x41, 0x2C, 0x09, 0x6B, 0x8B, 0xB7, 0x70, 0x11, 0xC6, 0x28, 0x35, 0xE3, 0x98},
+		hamon::vector<hamon::uint8_t>{0xE3, 0x28, 0x3F, 0x86, 0x80, 0xCE, 0xE0, 0x72, 0xFC, 0x2E, 0xC2, 0xB6, 0x71, 0xE4, 0x96, 0x6D, 0xAB, 0xDA, 0x6A, 0xC8, 0x5D, 0x1E, 0x74, 0x02, 0x02, 0x16, 0x82, 0xF1, 0x1B, 0x65, 0x76, 0x6D}));
+	EXPECT_TRUE(PowmTest(
+		hamon::vector<hamon::uint32_t>{0x00000004},
+		hamon::vector<hamon::uint32_t>{0x0000000D},
+		hamon::vector<hamon::uint32_t>{0x000001F1},
+		hamon::vector<hamon::uint32_t>{0x000001BD}));
+	EXPECT_TRUE(PowmTest(
+		hamon::vector<hamon::uint32_t>{0x00000003},
+		hamon::vector<hamon::uint32_t>{0x000000C8},
+		hamon::vector<hamon::uint32_t>{0x000003E8},
+		hamon::vector<hamon::uint32_t>{0x00000001}));
+	EXPECT_TRUE(PowmTest(
+		hamon::vector<hamon::uint32_t>{0x075BCD15},
+		hamon::vector<hamon::uint32_t>{0x00000000},
+		hamon::vector<hamon::uint32_t>{0x000F4243},
+		hamon::vector<hamon::uint32_t>{0x00000001}));
+	EXPECT_TRUE(PowmTest(
+		hamon::vector<hamon::uint32_t>{0x00000000},
+		hamon::vector<hamon::uint32_t>{0x00000005},
+		hamon::vector<hamon::uint32_t>{0x00000007},
+		hamon::vector<hamon::uint32_t>{0x00000000}));
+	EXPECT_TRUE(PowmTest(
+		hamon::vector<hamon::uint32_t>{0x00000005},
+		hamon::vector<hamon::uint32_t>{0x00000003},
+		hamon::vector<hamon::uint32_t>{0x00000001},
+		hamon::vector<hamon::uint32_t>{0x00000000}));
+	EXPECT_TRUE(PowmTest(
+		hamon::vector<hamon::uint32_t>{0x00000007},
+		hamon::vector<hamon::uint32_t>{0x0000000B},
+		hamon::vector<hamon::uint32_t>{0x00000000},
+		hamon::vector<hamon::uint32_t>{0x00000000}));
+	EXPECT_TRUE(PowmTest(
+		hamon::vector<hamon::uint32_t>{0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x7FFFFFFF},
+		hamon::vector<hamon::uint32_t>{0x00010001},
+		hamon::vector<hamon::uint32_t>{0xFFFFFFFF, 0xFFFFFFFF, 0x01FFFFFF},
+		hamon::vector<hamon::uint32_t>{0x06C4A67F, 0x0CB60BD0, 0x01ABF77F}));
+	EXPECT_TRUE(PowmTest(
+		hamon::vector<hamon::uint32_t>{0xFEDCBA98, 0x76543210, 0xFEDCBA98},
+		hamon::vector<hamon::uint32_t>{0x89ABCDEF, 0x01234567},
+		hamon::vector<hamon::uint32_t>{0x00000000, 0x00000000, 0x00000000, 0xC0000000},
+		hamon::vector<hamon::uint32_t>{0x00000000, 0x00000000, 0x00000000, 0x80000000}));
+	EXPECT_TRUE(PowmTest(
+		hamon::vector<hamon::uint32_t>{0x09DE8895, 0x493CD016, 0xB23BC1D8, 0xC33F4584, 0x24D8CEA5, 0xF59BA799, 0x76688387, 0x017AC114},
+		hamon::vector<hamon::uint32_t>{0xABF10AC2, 0xB2CCDFA7, 0xCAFEDACF, 0x18A61865, 0x74043590, 0x994B7A56, 0x7F8EC4C2, 0x026F9AA3},
+		hamon::vector<hamon::uint32_t>{0x04E77AF5, 0x839AA6B0, 0x6EB108E2, 0x939D61DC, 0x5F53F26C, 0x9FDFE168, 0xDA2F966E, 0x03C9D506},
+		hamon::vector<hamon::uint32_t>{0x8B5F45FE, 0x31780FEE, 0xAB8B8DF5, 0x8662A7D1, 0x19A94DA0, 0xE7E718A8, 0x699BE29B, 0x03880F22}));
+	EXPECT_TRUE(PowmTest(
+		hamon::vector<hamon::uint32_t>{0x8C072307, 0xE2F23430, 0xC15C71BF, 0xF362B708, 0x6F1F16F1, 0x64D8F363, 0x2D1AA9EA, 0x0EC69D37},
+		hamon::vector<hamon::uint32_t>{0xD9D2F5ED, 0x1B784C44, 0xD1F9EFFA, 0x1FE2A062, 0x60383FA0, 0x2749AC58, 0x00000018},
+		hamon::vector<hamon::uint32_t>{0x523C354C, 0x065D4510, 0xAB44B805, 0xFDF0BAB7, 0x41E586C0, 0x8B6B092C, 0xC61170B7, 0x98E33528},
+		hamon::vector<hamon::uint32_t>{0x863F28E3, 0x72E0CE80, 0xB6C22EFC, 0x6D96E471, 0xC86ADAAB, 0x02741E5D, 0xF1821602, 0x6D76651B}));
+	EXPECT_TRUE(PowmTest(
+		hamon::vector<hamon::uint64_t>{0x0000000000000004},
+		hamon::vector<hamon::uint64_t>{0x000000000000000D},
+		hamon::vector<hamon::uint64_t>{0x00000000000001F1},
+		hamon::vector<hamon::uint64_t>{0x00000000000001BD}));
+	EXPECT_TRUE(PowmTest(
+		hamon::vector<hamon::uint64_t>{0x0000000000000003},
+		hamon::vector<hamon::uint64_t>{0x00000000000000C8},
+		hamon::vector<hamon::uint64_t>{0x00000000000003E8},
+		hamon::vector<hamon::uint64_t>{0x0000000000000001}));
+	EXPECT_TRUE(PowmTest(
+		hamon::vector<hamon::uint64_t>{0x00000000075BCD15},
+		hamon::vector<hamon::uint64_t>{0x0000000000000000},
+		hamon::vector<hamon::uint64_t>{0x00000000000F4243},
+		hamon::vector<hamon::uint64_t>{0x0000000000000001}));
+	EXPECT_TRUE(PowmTest(
+		hamon::vector<hamon::uint64_t>{0x0000000000000000},
+		hamon::vector<hamon::uint64_t>{0x0000000000000005},
+		hamon::vector<hamon::uint64_t>{0x0000000000000007},
+		hamon::vector<hamon::uint64_t>{0x0000000000000000}));
+	EXPECT_TRUE(PowmTest(
+		hamon::vector<hamon::uint64_t>{0x0000000000000005},
+		hamon::vector<hamon::uint64_t>{0x0000000000000003},
+		hamon::vector<hamon::uint64_t>{0x0000000000000001},
+		hamon::vector<hamon::uint64_t>{0x0000000000000000}));
+	EXPECT_TRUE(PowmTest(
+		hamon::vector<hamon::uint64_t>{0x0000000000000007},
+		hamon::vector<hamon::uint64_t>{0x000000000000000B},
+		hamon::vector<hamon::uint64_t>{0x0000000000000000},
+		hamon::vector<hamon::uint64_t>{0x0000000000000000}));
+	EXPECT_TRUE(PowmTest(
+		hamon::vector<hamon::uint64_t>{0xFFFFFFFFFFFFFFFF, 0x7FFFFFFFFFFFFFFF},
+		hamon::vector<hamon::uint64_t>{0x0000000000010001},
+		hamon::vector<hamon::uint64_t>{0xFFFFFFFFFFFFFFFF, 0x0000000001FFFFFF},
+		hamon::vector<hamon::uint64_t>{0x0CB60BD006C4A67F, 0x0000000001ABF77F}));
+	EXPECT_TRUE(PowmTest(
+		hamon::vector<hamon::uint64_t>{0x76543210FEDCBA98, 0x00000000FEDCBA98},
+		hamon::vector<hamon::uint64_t>{0x0123456789ABCDEF},
+		hamon::vector<hamon::uint64_t>{0x0000000000000000, 0xC000000000000000},
+		hamon::vector<hamon::uint64_t>{0x0000000000000000, 0x8000000000000000}));
+	EXPECT_TRUE(PowmTest(
+		hamon::vector<hamon::uint64_t>{0x493CD01609DE8895, 0xC33F4584B23BC1D8, 0xF59BA79924D8CEA5, 0x017AC11476688387},
+		hamon::vector<hamon::uint64_t>{0xB2CCDFA7ABF10AC2, 0x18A61865CAFEDACF, 0x994B7A5674043590, 0x026F9AA37F8EC4C2},
+		hamon::vector<hamon::uint64_t>{0x839AA6B004E77AF5, 0x939D61DC6EB108E2, 0x9FDFE1685F53F26C, 0x03C9D506DA2F966E},
+		hamon::vector<hamon::uint64_t>{0x31780FEE8B5F45FE, 0x8662A7D1AB8B8DF5, 0xE7E718A819A94DA0, 0x03880F22699BE29B}));
+	EXPECT_TRUE(PowmTest(
+		hamon::vector<hamon::uint64_t>{0xE2F234308C072307, 0xF362B708C15C71BF, 0x64D8F3636F1F16F1, 0x0EC69D372D1AA9EA},
+		hamon::vector<hamon::uint64_t>{0x1B784C44D9D2F5ED, 0x1FE2A062D1F9EFFA, 0x2749AC5860383FA0, 0x0000000000000018},
+		hamon::vector<hamon::uint64_t>{0x065D4510523C354C, 0xFDF0BAB7AB44B805, 0x8B6B092C41E586C0, 0x98E33528C61170B7},
+		hamon::vector<hamon::uint64_t>{0x72E0CE80863F28E3, 0x6D96E471B6C22EFC, 0x02741E5DC86ADAAB, 0x6D76651BF1821602}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(PowmTest(
+		hamon::array<hamon::uint8_t, 40>{0x04},
+		hamon::array<hamon::uint8_t, 40>{0x0D},
+		hamon::array<hamon::uint8_t, 40>{0xF1, 0x01},
+		hamon::array<hamon::uint8_t, 40>{0xBD, 0x01}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(PowmTest(
+		hamon::array<hamon::uint8_t, 40>{0x03},
+		hamon::array<hamon::uint8_t, 40>{0xC8},
+		hamon::array<hamon::uint8_t, 40>{0xE8, 0x03},
+		hamon::array<hamon::uint8_t, 40>{0x01}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(PowmTest(
+		hamon::array<hamon::uint8_t, 40>{0x15, 0xCD, 0x5B, 0x07},
+		hamon::array<hamon::uint8_t, 40>{0x00},
+		hamon::array<hamon::uint8_t, 40>{0x43, 0x42, 0x0F},
+		hamon::array<hamon::uint8_t, 40>{0x01}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(PowmTest(
+		hamon::array<hamon::uint8_t, 40>{0x00},
+		hamon::array<hamon::uint8_t, 40>{0x05},
+		hamon::array<hamon::uint8_t, 40>{0x07},
+		hamon::array<hamon::uint8_t, 40>{0x00}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(PowmTest(
+		hamon::array<hamon::uint8_t, 40>{0x05},
+		hamon::array<hamon::uint8_t, 40>{0x03},
+		hamon::array<hamon::uint8_t, 40>{0x01},
+		hamon::array<hamon::uint8_t, 40>{0x00}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(PowmTest(
+		hamon::array<hamon::uint8_t, 40>{0x07},
+		hamon::array<hamon::uint8_t, 40>{0x0B},
+		hamon::array<hamon::uint8_t, 40>{0x00},
+		hamon::array<hamon::uint8_t, 40>{0x00}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(PowmTest(
+		hamon::array<hamon::uint8_t, 40>{0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F},
+		hamon::array<hamon::uint8_t, 40>{0x01, 0x00, 0x01},
+		hamon::array<hamon::uint8_t, 40>{0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01},
+		hamon::array<hamon::uint8_t, 40>{0x7F, 0xA6, 0xC4, 0x06, 0xD0, 0x0B, 0xB6, 0x0C, 0x7F, 0xF7, 0xAB, 0x01}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(PowmTest(
+		hamon::array<hamon::uint8_t, 40>{0x98, 0xBA, 0xDC, 0xFE, 0x10, 0x32, 0x54, 0x76, 0x98, 0xBA, 0xDC, 0xFE},
+		hamon::array<hamon::uint8_t, 40>{0xEF, 0xCD, 0xAB, 0x89, 0x67, 0x45, 0x23, 0x01},
+		hamon::array<hamon::uint8_t, 40>{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0},
+		hamon::array<hamon::uint8_t, 40>{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(PowmTest(
+		hamon::array<hamon::uint32_t, 8>{0x00000004},
+		hamon::array<hamon::uint32_t, 8>{0x0000000D},
+		hamon::array<hamon::uint32_t, 8>{0x000001F1},
+		hamon::array<hamon::uint32_t, 8>{0x000001BD}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(PowmTest(
+		hamon::array<hamon::uint32_t, 8>{0x00000003},
+		hamon::array<hamon::uint32_t, 8>{0x000000C8},
+		hamon::array<hamon::uint32_t, 8>{0x000003E8},
+		hamon::array<hamon::uint32_t, 8>{0x00000001}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(PowmTest(
+		hamon::array<hamon::uint32_t, 8>{0x075BCD15},
+		hamon::array<hamon::uint32_t, 8>{0x00000000},
+		hamon::array<hamon::uint32_t, 8>{0x000F4243},
+		hamon::array<hamon::uint32_t, 8>{0x00000001}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(PowmTest(
+		hamon::array<hamon::uint32_t, 8>{0x00000000},
+		hamon::array<hamon::uint32_t, 8>{0x00000005},
+		hamon::array<hamon::uint32_t, 8>{0x00000007},
+		hamon::array<hamon::uint32_t, 8>{0x00000000}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(PowmTest(
+		hamon::array<hamon::uint32_t, 8>{0x00000005},
+		hamon::array<hamon::uint32_t, 8>{0x00000003},
+		hamon::array<hamon::uint32_t, 8>{0x00000001},
+		hamon::array<hamon::uint32_t, 8>{0x00000000}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(PowmTest(
+		hamon::array<hamon::uint32_t, 8>{0x00000007},
+		hamon::array<hamon::uint32_t, 8>{0x0000000B},
+		hamon::array<hamon::uint32_t, 8>{0x00000000},
+		hamon::array<hamon::uint32_t, 8>{0x00000000}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(PowmTest(
+		hamon::array<hamon::uint32_t, 8>{0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x7FFFFFFF},
+		hamon::array<hamon::uint32_t, 8>{0x00010001},
+		hamon::array<hamon::uint32_t, 8>{0xFFFFFFFF, 0xFFFFFFFF, 0x01FFFFFF},
+		hamon::array<hamon::uint32_t, 8>{0x06C4A67F, 0x0CB60BD0, 0x01ABF77F}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(PowmTest(
+		hamon::array<hamon::uint32_t, 8>{0xFEDCBA98, 0x76543210, 0xFEDCBA98},
+		hamon::array<hamon::uint32_t, 8>{0x89ABCDEF, 0x01234567},
+		hamon::array<hamon::uint32_t, 8>{0x00000000, 0x00000000, 0x00000000, 0xC0000000},
+		hamon::array<hamon::uint32_t, 8>{0x00000000, 0x00000000, 0x00000000, 0x80000000}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(PowmTest(
+		hamon::array<hamon::uint32_t, 8>{0x09DE8895, 0x493CD016, 0xB23BC1D8, 0xC33F4584, 0x24D8CEA5, 0xF59BA799, 0x76688387, 0x017AC114},
+		hamon::array<hamon::uint32_t, 8>{0xABF10AC2, 0xB2CCDFA7, 0xCAFEDACF, 0x18A61865, 0x74043590, 0x994B7A56, 0x7F8EC4C2, 0x026F9AA3},
+		hamon::array<hamon::uint32_t, 8>{0x04E77AF5, 0x839AA6B0, 0x6EB108E2, 0x939D61DC, 0x5F53F26C, 0x9FDFE168, 0xDA2F966E, 0x03C9D506},
+		hamon::array<hamon::uint32_t, 8>{0x8B5F45FE, 0x31780FEE, 0xAB8B8DF5, 0x8662A7D1, 0x19A94DA0, 0xE7E718A8, 0x699BE29B, 0x03880F22}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(PowmTest(
+		hamon::array<hamon::uint32_t, 8>{0x8C072307, 0xE2F23430, 0xC15C71BF, 0xF362B708, 0x6F1F16F1, 0x64D8F363, 0x2D1AA9EA, 0x0EC69D37},
+		hamon::array<hamon::uint32_t, 8>{0xD9D2F5ED, 0x1B784C44, 0xD1F9EFFA, 0x1FE2A062, 0x60383FA0, 0x2749AC58, 0x00000018},
+		hamon::array<hamon::uint32_t, 8>{0x523C354C, 0x065D4510, 0xAB44B805, 0xFDF0BAB7, 0x41E586C0, 0x8B6B092C, 0xC61170B7, 0x98E33528},
+		hamon::array<hamon::uint32_t, 8>{0x863F28E3, 0x72E0CE80, 0xB6C22EFC, 0x6D96E471, 0xC86ADAAB, 0x02741E5D, 0xF1821602, 0x6D76651B}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(PowmTest(
+		hamon::array<hamon::uint64_t, 4>{0x0000000000000004},
+		hamon::array<hamon::uint64_t, 4>{0x000000000000000D},
+		hamon::array<hamon::uint64_t, 4>{0x00000000000001F1},
+		hamon::array<hamon::uint64_t, 4>{0x00000000000001BD}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(PowmTest(
+		hamon::array<hamon::uint64_t, 4>{0x0000000000000003},
+		hamon::array<hamon::uint64_t, 4>{0x00000000000000C8},
+		hamon::array<hamon::uint64_t, 4>{0x00000000000003E8},
+		hamon::array<hamon::uint64_t, 4>{0x0000000000000001}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(PowmTest(
+		hamon::array<hamon::uint64_t, 4>{0x00000000075BCD15},
+		hamon::array<hamon::uint64_t, 4>{0x0000000000000000},
+		hamon::array<hamon::uint64_t, 4>{0x00000000000F4243},
+		hamon::array<hamon::uint64_t, 4>{0x0000000000000001}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(PowmTest(
+		hamon::array<hamon::uint64_t, 4>{0x0000000000000000},
+		hamon::array<hamon::uint64_t, 4>{0x0000000000000005},
+		hamon::array<hamon::uint64_t, 4>{0x0000000000000007},
+		hamon::array<hamon::uint64_t, 4>{0x0000000000000000}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(PowmTest(
+		hamon::array<hamon::uint64_t, 4>{0x0000000000000005},
+		hamon::array<hamon::uint64_t, 4>{0x0000000000000003},
+		hamon::array<hamon::uint64_t, 4>{0x0000000000000001},
+		hamon::array<hamon::uint64_t, 4>{0x0000000000000000}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(PowmTest(
+		hamon::array<hamon::uint64_t, 4>{0x0000000000000007},
+		hamon::array<hamon::uint64_t, 4>{0x000000000000000B},
+		hamon::array<hamon::uint64_t, 4>{0x0000000000000000},
+		hamon::array<hamon::uint64_t, 4>{0x0000000000000000}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(PowmTest(
+		hamon::array<hamon::uint64_t, 4>{0xFFFFFFFFFFFFFFFF, 0x7FFFFFFFFFFFFFFF},
+		hamon::array<hamon::uint64_t, 4>{0x0000000000010001},
+		hamon::array<hamon::uint64_t, 4>{0xFFFFFFFFFFFFFFFF, 0x0000000001FFFFFF},
+		hamon::array<hamon::uint64_t, 4>{0x0CB60BD006C4A67F, 0x0000000001ABF77F}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(PowmTest(
+		hamon::array<hamon::uint64_t, 4>{0x76543210FEDCBA98, 0x00000000FEDCBA98},
+		hamon::array<hamon::uint64_t, 4>{0x0123456789ABCDEF},
+		hamon::array<hamon::uint64_t, 4>{0x0000000000000000, 0xC000000000000000},
+		hamon::array<hamon::uint64_t, 4>{0x0000000000000000, 0x8000000000000000}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(PowmTest(
+		hamon::array<hamon::uint64_t, 4>{0x493CD01609DE8895, 0xC33F4584B23BC1D8, 0xF59BA79924D8CEA5, 0x017AC11476688387},
+		hamon::array<hamon::uint64_t, 4>{0xB2CCDFA7ABF10AC2, 0x18A61865CAFEDACF, 0x994B7A5674043590, 0x026F9AA37F8EC4C2},
+		hamon::array<hamon::uint64_t, 4>{0x839AA6B004E77AF5, 0x939D61DC6EB108E2, 0x9FDFE1685F53F26C, 0x03C9D506DA2F966E},
+		hamon::array<hamon::uint64_t, 4>{0x31780FEE8B5F45FE, 0x8662A7D1AB8B8DF5, 0xE7E718A819A94DA0, 0x03880F22699BE29B}));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(PowmTest(
+		hamon::array<hamon::uint64_t, 4>{0xE2F234308C072307, 0xF362B708C15C71BF, 0x64D8F3636F1F16F1, 0x0EC69D372D1AA9EA},
+		hamon::array<hamon::uint64_t, 4>{0x1B784C44D9D2F5ED, 0x1FE2A062D1F9EFFA, 0x2749AC5860383FA0, 0x0000000000000018},
+		hamon::array<hamon::uint64_t, 4>{0x065D4510523C354C, 0xFDF0BAB7AB44B805, 0x8B6B092C41E586C0, 0x98E33528C61170B7},
+		hamon::array<hamon::uint64_t, 4>{0x72E0CE80863F28E3, 0x6D96E471B6C22EFC, 0x02741E5DC86ADAAB, 0x6D76651BF1821602}));
+}
+
+}	// namespace bigint_algo_powm_test
+
+}	// namespace hamon_bigint_test
@@ -28,6 +28,15 @@ SubTest(VectorType a, VectorType const& b, VectorType const& expected)
 	return true;
 }
 
+template <typename VectorType>
+inline bool
+SubReverseTest(VectorType a, VectorType const& b, VectorType const& expected)
+{
+	hamon::bigint_algo::sub_reverse(a, b);
+	VERIFY(a == expected);
+	return true;
+}
+
 #undef VERIFY
 
 GTEST_TEST(BigIntAlgoTest, SubTest)
@@ -134,6 +143,34 @@ GTEST_TEST(BigIntAlgoTest, SubTest)
 		hamon::array<hamon::uint64_t, 2>{0x03C4165D8B987845, 0x1D4BB9F5419D359D}));
 }
 
+GTEST_TEST(BigIntAlgoTest, SubReverseTest)
+{
+	EXPECT_TRUE(SubReverseTest(
+		hamon::vector<hamon::uint8_t>{0x03},
+		hamon::vector<hamon::uint8_t>{0x39, 0x30},
+		hamon::vector<hamon::uint8_t>{0x36, 0x30}));
+	EXPECT_TRUE(SubReverseTest(
+		hamon::vector<hamon::uint8_t>{0x01},
+		hamon::vector<hamon::uint8_t>{0x00, 0x00, 0x01},
+		hamon::vector<hamon::uint8_t>{0xFF, 0xFF}));
+	EXPECT_TRUE(SubReverseTest(
+		hamon::vector<hamon::uint8_t>{0x89, 0x30, 0x12},
+		hamon::vector<hamon::uint8_t>{0x56, 0x34, 0x12},
+		hamon::vector<hamon::uint8_t>{0xCD, 0x03}));
+	EXPECT_TRUE(SubReverseTest(
+		hamon::vector<hamon::uint8_t>{0x78, 0x56, 0x34, 0x12},
+		hamon::vector<hamon::uint8_t>{0x78, 0x56, 0x34, 0x12},
+		hamon::vector<hamon::uint8_t>{0x00}));
+	EXPECT_TRUE(SubReverseTest(
+		hamon::vector<hamon::uint16_t>{0x0002},
+		hamon::vector<hamon::uint16_t>{0x0000, 0x0000, 0x0000, 0x0001},
+		hamon::vector<hamon::uint16_t>{0xFFFE, 0xFFFF, 0xFFFF}));
+	EXPECT_TRUE(SubReverseTest(
+		hamon::vector<hamon::uint32_t>{0xF25108D0, 0x0D5DFA96, 0x00214281, 0x33248828},
+		hamon::vector<hamon::uint32_t>{0x7DE98115, 0x112210F4, 0x41BE781E, 0x5070421D},
+		hamon::vector<hamon::uint32_t>{0x8B987845, 0x03C4165D, 0x419D359D, 0x1D4BB9F5}));
+}
+
 }	// namespace bigint_algo_sub_test
 
 }	// namespace hamon_bigint_test
@@ -54,10 +54,87 @@ to_chars_integral_width(T value, T base)
 	return result;
 }
 
+// 10進数の桁数
+template <typename T>
+inline HAMON_CXX14_CONSTEXPR int
+to_chars_decimal_width(T value)
+{
+	// 除算の代わりに 10 の累乗と比べる
+	int result = 1;
+	T p = 10;
+	while (value >= p)
+	{
+		++result;
+		if (p > static_cast<T>(~T(0)) / 10)
+		{
+			break;
+		}
+		p = static_cast<T>(p * 10);
+	}
+	return result;
+}
+
+// "00" から "99" までを並べた表の i 番目の文字
+inline HAMON_CXX11_CONSTEXPR char
+to_chars_digits2(unsigned i)
+{
+	return
+		"00010203040506070809"
+		"10111213141516171819"
+		"20212223242526272829"
+		"30313233343536373839"
+		"40414243444546474849"
+		"50515253545556575859"
+		"60616263646566676869"
+		"70717273747576777879"
+		"80818283848586878889"
+		"90919293949596979899"[i];
+}
+
+// 10進数は 2 桁ずつ表から書き込む
+template <typename T>
+inline HAMON_CXX14_CONSTEXPR to_chars_result
+to_chars_unsigned_decimal(char* first, char* last, T value)
+{
+	auto n = to_chars_decimal_width(value);
+	if (n > (last - first))
+	{
+		return {last, hamon::errc::value_too_large};
+	}
+
+	last = first + n;
+	auto p = last;
+	while (value >= 100)
+	{
+		auto const i = static_cast<unsigned>(value % 100) * 2;
+		value = static_cast<T>(value / 100);
+		*--p = to_chars_digits2(i + 1);
+		*--p = to_chars_digits2(i);
+	}
+
+	if (value >= 10)
+	{
+		auto const i = static_cast<unsigned>(value) * 2;
+		*--p = to_chars_digits2(i + 1);
+		*--p = to_chars_digits2(i);
+	}
+	else
+	{
+		*--p = static_cast<char>('0' + value);
+	}
+
+	return {last, hamon::errc{}};
+}
+
 template <typename T>
 inline HAMON_CXX14_CONSTEXPR to_chars_result
 to_chars_unsigned_integral(char* first, char* last, T value, T base)
 {
+	if (base == 10)
+	{
+		return to_chars_unsigned_decimal(first, last, value);
+	}
+
 	auto n = to_chars_integral_width(value, base);
 	if (n > (last - first))
 	{
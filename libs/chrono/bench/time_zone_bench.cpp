@@ -0,0 +1,153 @@
+﻿/**
+ *	@file	time_zone_bench.cpp
+ *
+ *	@brief	time_zone の変換のベンチマーク
+ *
+ *	指定したタイムゾーンについて、to_local, to_sys, get_info の1回あたりの時間を出力する。
+ *	時刻は次の3通りを計測する。
+ *		random     : 1970年から2038年までの一様な乱数 (遷移表の二分探索)
+ *		sequential : 2024年1月1日から1分ずつ進めた時刻 (スレッドごとのキャッシュに当たる)
+ *		outside    : 遷移表の範囲外 (2200年以降) の一様な乱数 (規則から計算する)
+ *
+ *	使い方:
+ *		time_zone_bench [タイムゾーン名 (既定値は America/New_York)]
+ */
+
+#include <hamon/chrono/choose.hpp>
+#include <hamon/chrono/duration.hpp>
+#include <hamon/chrono/get_tzdb.hpp>
+#include <hamon/chrono/local_seconds.hpp>
+#include <hamon/chrono/locate_zone.hpp>
+#include <hamon/chrono/sys_days.hpp>
+#include <hamon/chrono/sys_seconds.hpp>
+#include <hamon/chrono/time_zone.hpp>
+#include <hamon/chrono/year_month_day.hpp>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+hamon::chrono::sys_seconds make_sys(int y)
+{
+	return hamon::chrono::sys_days(
+		hamon::chrono::year(y) / hamon::chrono::January / hamon::chrono::day(1));
+}
+
+std::vector<hamon::chrono::sys_seconds>
+make_random_times(int first_year, int last_year)
+{
+	std::mt19937_64 rng(42);
+	auto const first = make_sys(first_year).time_since_epoch().count();
+	auto const last  = make_sys(last_year).time_since_epoch().count();
+	std::uniform_int_distribution<std::int64_t> dist(first, last - 1);
+
+	std::vector<hamon::chrono::sys_seconds> result(1 << 16);
+	for (auto& t : result)
+	{
+		t = hamon::chrono::sys_seconds(hamon::chrono::seconds(dist(rng)));
+	}
+	return result;
+}
+
+std::vector<hamon::chrono::sys_seconds>
+make_sequential_times()
+{
+	std::vector<hamon::chrono::sys_seconds> result(1 << 16);
+	auto t = make_sys(2024);
+	for (auto& x : result)
+	{
+		x = t;
+		t += hamon::chrono::minutes(1);
+	}
+	return result;
+}
+
+// times の各要素に f を適用することを 300ms 繰り返し、1回あたりの時間 [ns] を返す
+template <typename F>
+double measure(std::vector<hamon::chrono::sys_seconds> const& times, F f)
+{
+	std::int64_t sink = 0;
+	std::size_t count = 0;
+	auto const start = Clock::now();
+	auto end = start;
+	do
+	{
+		for (auto const& t : times)
+		{
+			sink += f(t);
+		}
+		count += times.size();
+		end = Clock::now();
+	}
+	while (end - start < std::chrono::milliseconds(300));
+	if (sink == 0)
+	{
+		std::printf(" ");
+	}
+	return std::chrono::duration<double, std::nano>(end - start).count() / static_cast<double>(count);
+}
+
+}	// namespace
+
+int main(int argc, char* argv[])
+{
+	char const* name = "America/New_York";
+	if (argc > 1)
+	{
+		name = argv[1];
+	}
+
+	auto const* zone = hamon::chrono::locate_zone(name);
+
+	// 最初の呼び出しで遷移表が作られるので、その時間も計測しておく
+	{
+		auto const start = Clock::now();
+		auto const x = zone->to_local(make_sys(2024));
+		auto const end = Clock::now();
+		std::printf("zone: %s, first call (builds the table): %.1f us%s\n", name,
+			std::chrono::duration<double, std::micro>(end - start).count(),
+			x.time_since_epoch().count() == 0 ? " " : "");
+	}
+
+	auto const to_local = [zone](hamon::chrono::sys_seconds t)
+	{
+		return zone->to_local(t).time_since_epoch().count();
+	};
+	auto const to_sys = [zone](hamon::chrono::sys_seconds t)
+	{
+		auto const lt = hamon::chrono::local_seconds(t.time_since_epoch());
+		return zone->to_sys(lt, hamon::chrono::choose::earliest).time_since_epoch().count();
+	};
+	auto const get_info = [zone](hamon::chrono::sys_seconds t)
+	{
+		return static_cast<std::int64_t>(zone->get_info(t).offset.count());
+	};
+
+	struct Input
+	{
+		char const* name;
+		std::vector<hamon::chrono::sys_seconds> times;
+	};
+	Input const inputs[] =
+	{
+		{"random",     make_random_times(1970, 2038)},
+		{"sequential", make_sequential_times()},
+		{"outside",    make_random_times(2200, 2300)},
+	};
+
+	std::printf("%-12s %16s %16s %16s\n", "times", "to_local [ns]", "to_sys [ns]", "get_info [ns]");
+	for (auto const& in : inputs)
+	{
+		auto const r1 = measure(in.times, to_local);
+		auto const r2 = measure(in.times, to_sys);
+		auto const r3 = measure(in.times, get_info);
+		std::printf("%-12s %16.1f %16.1f %16.1f\n", in.name, r1, r2, r3);
+	}
+}
@@ -7,6 +7,7 @@
 #ifndef HAMON_CHRONO_HPP
 #define HAMON_CHRONO_HPP
 
+#include <hamon/chrono/ambiguous_local_time.hpp>
 #include <hamon/chrono/choose.hpp>
 #include <hamon/chrono/clock_cast.hpp>
 #include <hamon/chrono/clock_time_conversion.hpp>
@@ -15,6 +16,8 @@
 #include <hamon/chrono/duration.hpp>
 #include <hamon/chrono/file_clock.hpp>
 #include <hamon/chrono/file_time.hpp>
+#include <hamon/chrono/formatter.hpp>
+#include <hamon/chrono/from_chars.hpp>
 #include <hamon/chrono/get_leap_second_info.hpp>
 #include <hamon/chrono/get_tzdb.hpp>
 #include <hamon/chrono/get_tzdb_list.hpp>
@@ -39,11 +42,15 @@
 #include <hamon/chrono/month.hpp>
 #include <hamon/chrono/month_day.hpp>
 #include <hamon/chrono/month_weekday.hpp>
+#include <hamon/chrono/nonexistent_local_time.hpp>
+#include <hamon/chrono/parse_sys_times.hpp>
 #include <hamon/chrono/steady_clock.hpp>
 #include <hamon/chrono/sys_days.hpp>
 #include <hamon/chrono/sys_info.hpp>
 #include <hamon/chrono/sys_seconds.hpp>
 #include <hamon/chrono/sys_time.hpp>
+#include <hamon/chrono/sys_time_reader.hpp>
+#include <hamon/chrono/sys_time_writer.hpp>
 #include <hamon/chrono/system_clock.hpp>
 #include <hamon/chrono/tai_clock.hpp>
 #include <hamon/chrono/tai_seconds.hpp>
@@ -51,12 +58,15 @@
 #include <hamon/chrono/time_point.hpp>
 #include <hamon/chrono/time_zone.hpp>
 #include <hamon/chrono/time_zone_link.hpp>
+#include <hamon/chrono/to_chars.hpp>
 #include <hamon/chrono/treat_as_floating_point.hpp>
 #include <hamon/chrono/tzdb.hpp>
 #include <hamon/chrono/tzdb_list.hpp>
 #include <hamon/chrono/utc_clock.hpp>
+#include <hamon/chrono/utc_from_sys.hpp>
 #include <hamon/chrono/utc_seconds.hpp>
 #include <hamon/chrono/utc_time.hpp>
+#include <hamon/chrono/utc_to_sys.hpp>
 #include <hamon/chrono/weekday.hpp>
 #include <hamon/chrono/year.hpp>
 #include <hamon/chrono/year_month.hpp>
@@ -184,8 +194,8 @@ const tzdb& reload_tzdb();
 string remote_version();
 
 // [time.zone.exception], exception classes
-class nonexistent_local_time;
-class ambiguous_local_time;
+//class nonexistent_local_time;
+//class ambiguous_local_time;
 
 //// [time.zone.timezone], class time_zone
 //enum class choose { earliest, latest };
@@ -0,0 +1,88 @@
+﻿/**
+ *	@file	ambiguous_local_time.hpp
+ *
+ *	@brief	ambiguous_local_time の定義
+ */
+
+#ifndef HAMON_CHRONO_AMBIGUOUS_LOCAL_TIME_HPP
+#define HAMON_CHRONO_AMBIGUOUS_LOCAL_TIME_HPP
+
+#include <hamon/chrono/config.hpp>
+
+#if defined(HAMON_USE_STD_CHRONO)
+
+#include <chrono>
+
+namespace hamon {
+namespace chrono {
+
+using std::chrono::ambiguous_local_time;
+
+}	// namespace chrono
+}	// namespace hamon
+
+#else
+
+#include <hamon/chrono/local_info.hpp>
+#include <hamon/chrono/local_time.hpp>
+#include <hamon/chrono/detail/datetime_string.hpp>
+#include <hamon/chrono/duration.hpp>
+#include <hamon/chrono/duration/floor.hpp>
+#include <hamon/cstdlib/abort.hpp>
+#include <hamon/stdexcept/runtime_error.hpp>
+#include <hamon/string.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon {
+namespace chrono {
+
+// 30.11.3.2 Class ambiguous_local_time[time.zone.exception.ambig]
+
+class ambiguous_local_time : public hamon::runtime_error
+{
+public:
+	template <typename Duration>
+	ambiguous_local_time(local_time<Duration> const& tp, local_info const& i)
+		: hamon::runtime_error(make_message(tp, i).c_str())
+	{}
+
+private:
+	template <typename Duration>
+	static hamon::string
+	make_message(local_time<Duration> const& tp, local_info const& i)
+	{
+		// [time.zone.exception.ambig]/2
+		auto const t = chrono::floor<chrono::seconds>(tp.time_since_epoch());
+		return
+			detail::datetime_string(tp) + " is ambiguous.  It could be\n" +
+			detail::datetime_string(tp) + ' ' + i.first.abbrev + " == " +
+			detail::datetime_string(t - i.first.offset) + " UTC or\n" +
+			detail::datetime_string(tp) + ' ' + i.second.abbrev + " == " +
+			detail::datetime_string(t - i.second.offset) + " UTC";
+	}
+};
+
+namespace detail
+{
+
+template <typename Duration>
+HAMON_NORETURN inline void
+throw_ambiguous_local_time(local_time<Duration> const& tp, local_info const& i)
+{
+#if !defined(HAMON_NO_EXCEPTIONS)
+	throw chrono::ambiguous_local_time(tp, i);
+#else
+	(void)tp;
+	(void)i;
+	hamon::abort();
+#endif
+}
+
+}	// namespace detail
+
+}	// namespace chrono
+}	// namespace hamon
+
+#endif
+
+#endif // HAMON_CHRONO_AMBIGUOUS_LOCAL_TIME_HPP
@@ -0,0 +1,98 @@
+﻿/**
+ *	@file	chrono_date_cache.hpp
+ *
+ *	@brief	chrono_date_cache の定義
+ */
+
+#ifndef HAMON_CHRONO_DETAIL_CHRONO_DATE_CACHE_HPP
+#define HAMON_CHRONO_DETAIL_CHRONO_DATE_CACHE_HPP
+
+#include <hamon/chrono/detail/chrono_to_chars.hpp>
+#include <hamon/chrono/detail/civil.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon {
+namespace chrono {
+namespace detail {
+
+/**
+ *	@brief	最後に読み書きした日付と、その文字列 ("YYYY-MM-DD")
+ *
+ *	ログのタイムスタンプのように同じ日付が続くときは、
+ *	civil_from_days / days_from_civil と日付の文字列の変換を省ける。
+ */
+class chrono_date_cache
+{
+public:
+	HAMON_CXX14_CONSTEXPR chrono_date_cache() HAMON_NOEXCEPT
+		: m_days(0)
+		, m_size(0)
+		, m_chars{}
+	{}
+
+	// 書くとき: エポックからの日数 n の日付の文字列を返す
+	HAMON_CXX14_CONSTEXPR char const*
+	chars(int n) HAMON_NOEXCEPT
+	{
+		if (m_size == 0 || n != m_days)
+		{
+			char* const end = detail::chrono_write_date(m_chars, detail::civil_from_days(n));
+			m_size = static_cast<int>(end - m_chars);
+			m_days = n;
+		}
+		return m_chars;
+	}
+
+	// 読むとき: [first, end) が覚えている日付の文字列で始まっていれば、その長さを返す。
+	// そうでなければ 0 を返す。
+	HAMON_CXX14_CONSTEXPR int
+	match(char const* first, char const* end) const HAMON_NOEXCEPT
+	{
+		if (m_size == 0 || end - first < m_size)
+		{
+			return 0;
+		}
+
+		for (int i = 0; i < m_size; ++i)
+		{
+			if (first[i] != m_chars[i])
+			{
+				return 0;
+			}
+		}
+		return m_size;
+	}
+
+	// 読んだ日付の文字列 [first, end) と日数 n を覚えておく
+	HAMON_CXX14_CONSTEXPR void
+	store(char const* first, char const* end, int n) HAMON_NOEXCEPT
+	{
+		auto const len = end - first;
+		if (len > chrono_date_max_size)
+		{
+			m_size = 0;
+			return;
+		}
+
+		for (int i = 0; i < len; ++i)
+		{
+			m_chars[i] = first[i];
+		}
+		m_size = static_cast<int>(len);
+		m_days = n;
+	}
+
+	HAMON_CXX14_CONSTEXPR int days() const HAMON_NOEXCEPT { return m_days; }
+	HAMON_CXX14_CONSTEXPR int size() const HAMON_NOEXCEPT { return m_size; }
+
+private:
+	int  m_days;
+	int  m_size;
+	char m_chars[chrono_date_max_size];
+};
+
+}	// namespace detail
+}	// namespace chrono
+}	// namespace hamon
+
+#endif // HAMON_CHRONO_DETAIL_CHRONO_DATE_CACHE_HPP
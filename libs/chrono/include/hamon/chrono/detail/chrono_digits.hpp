@@ -0,0 +1,115 @@
+﻿/**
+ *	@file	chrono_digits.hpp
+ *
+ *	@brief	日付と時刻の数字を読み書きする関数の定義
+ */
+
+#ifndef HAMON_CHRONO_DETAIL_CHRONO_DIGITS_HPP
+#define HAMON_CHRONO_DETAIL_CHRONO_DIGITS_HPP
+
+#include <hamon/cstdint/uint64_t.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon {
+namespace chrono {
+namespace detail {
+
+// "00" から "99" までを並べた表の i 番目の文字
+inline HAMON_CXX11_CONSTEXPR char
+chrono_digits2_table(unsigned i) HAMON_NOEXCEPT
+{
+	return
+		"00010203040506070809"
+		"10111213141516171819"
+		"20212223242526272829"
+		"30313233343536373839"
+		"40414243444546474849"
+		"50515253545556575859"
+		"60616263646566676869"
+		"70717273747576777879"
+		"80818283848586878889"
+		"90919293949596979899"[i];
+}
+
+// 0 <= v < 100 を2桁で書く
+inline HAMON_CXX14_CONSTEXPR char*
+chrono_write_digits2(char* p, unsigned v) HAMON_NOEXCEPT
+{
+	p[0] = detail::chrono_digits2_table(v * 2);
+	p[1] = detail::chrono_digits2_table(v * 2 + 1);
+	return p + 2;
+}
+
+// 0 <= v < 10000 を4桁で書く
+inline HAMON_CXX14_CONSTEXPR char*
+chrono_write_digits4(char* p, unsigned v) HAMON_NOEXCEPT
+{
+	detail::chrono_write_digits2(p, v / 100);
+	return detail::chrono_write_digits2(p + 2, v % 100);
+}
+
+// v を丁度 width 桁で書く (入りきらない上の桁は捨てる)
+inline HAMON_CXX14_CONSTEXPR char*
+chrono_write_digits(char* p, hamon::uint64_t v, unsigned width) HAMON_NOEXCEPT
+{
+	char* const last = p + width;
+	char* q = last;
+	while (width >= 2)
+	{
+		q -= 2;
+		detail::chrono_write_digits2(q, static_cast<unsigned>(v % 100));
+		v /= 100;
+		width -= 2;
+	}
+	if (width == 1)
+	{
+		*--q = static_cast<char>('0' + v % 10);
+	}
+	return last;
+}
+
+// v の10進数の桁数
+inline HAMON_CXX14_CONSTEXPR unsigned
+chrono_decimal_width(hamon::uint64_t v) HAMON_NOEXCEPT
+{
+	unsigned n = 1;
+	while (v >= 100)
+	{
+		v /= 100;
+		n += 2;
+	}
+	return n + (v >= 10 ? 1u : 0u);
+}
+
+// p から丁度 n 文字の数字を読む。
+// 1文字ずつ分岐しないように、数字でない文字があったかどうかを最後にまとめて調べる。
+inline HAMON_CXX14_CONSTEXPR bool
+chrono_read_digits(char const* p, unsigned n, unsigned& out) HAMON_NOEXCEPT
+{
+	unsigned v = 0;
+	unsigned bad = 0;
+	for (unsigned i = 0; i < n; ++i)
+	{
+		unsigned const d = static_cast<unsigned>(static_cast<unsigned char>(p[i])) - '0';
+		bad |= (d > 9) ? 1u : 0u;
+		v = v * 10 + d;
+	}
+	out = v;
+	return bad == 0;
+}
+
+// 2桁の数字を読む
+inline HAMON_CXX14_CONSTEXPR bool
+chrono_read_digits2(char const* p, unsigned& out) HAMON_NOEXCEPT
+{
+	unsigned const d0 = static_cast<unsigned>(static_cast<unsigned char>(p[0])) - '0';
+	unsigned const d1 = static_cast<unsigned>(static_cast<unsigned char>(p[1])) - '0';
+	out = d0 * 10 + d1;
+	return ((d0 <= 9) & (d1 <= 9)) != 0;
+}
+
+}	// namespace detail
+}	// namespace chrono
+}	// namespace hamon
+
+#endif // HAMON_CHRONO_DETAIL_CHRONO_DIGITS_HPP
@@ -0,0 +1,130 @@
+﻿/**
+ *	@file	chrono_format_value.hpp
+ *
+ *	@brief	chrono_format_value の定義
+ */
+
+#ifndef HAMON_CHRONO_DETAIL_CHRONO_FORMAT_VALUE_HPP
+#define HAMON_CHRONO_DETAIL_CHRONO_FORMAT_VALUE_HPP
+
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/cstdint/intmax_t.hpp>
+#include <hamon/cstdint/uint8_t.hpp>
+#include <hamon/cstdint/uint64_t.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon {
+namespace chrono {
+namespace detail {
+
+// 書式化する値が持っている項目。
+// chrono-specs の変換指定子が使う項目を持っていない型は、parse で format_error にする。
+struct chrono_format_fields
+{
+	enum : unsigned
+	{
+		year     = 1 << 0,
+		month    = 1 << 1,
+		day      = 1 << 2,
+		weekday  = 1 << 3,
+		time     = 1 << 4,
+		offset   = 1 << 5,	// %z
+		zone     = 1 << 6,	// %Z
+		duration = 1 << 7,	// %Q %q
+
+		date = year | month | day | weekday,
+	};
+};
+
+// chrono-specs を省略したときの出力 (operator<< と同じもの)
+enum class chrono_default_format : hamon::uint8_t
+{
+	duration,					// count() と単位
+	day,						// %d
+	month,						// %b
+	year,						// %Y
+	weekday,					// %a
+	weekday_indexed,			// %a[index]
+	weekday_last,				// %a[last]
+	month_day,					// %b/%d
+	month_day_last,				// %b/last
+	month_weekday,				// %b/%a[index]
+	month_weekday_last,			// %b/%a[last]
+	year_month,					// %Y/%b
+	year_month_day,				// %F
+	year_month_day_last,		// %Y/%b/last
+	year_month_weekday,			// %Y/%b/%a[index]
+	year_month_weekday_last,	// %Y/%b/%a[last]
+	time_of_day,				// %T
+	date,						// %F
+	date_time,					// %F %T
+};
+
+/**
+ *	@brief	書式化する値を、変換指定子が使う項目に分けたもの
+ *
+ *	Rep は duration::rep (%Q で使う)。duration 以外では使わない。
+ */
+template <typename Rep>
+struct chrono_format_value
+{
+	unsigned              m_fields;
+	chrono_default_format m_default;
+
+	// 日付
+	int      m_year;
+	unsigned m_month;
+	unsigned m_day;
+	unsigned m_weekday;		// weekday::c_encoding()
+	unsigned m_index;		// weekday_indexed::index()
+	bool     m_ok;			// year_month_day::ok() (chrono-specs を省略したときに使う)
+
+	// 時刻
+	bool            m_is_negative;
+	hamon::uint64_t m_days;			// duration の日数 (%j)
+	hamon::uint64_t m_hours;
+	unsigned        m_minutes;
+	unsigned        m_seconds;
+	hamon::uint64_t m_subseconds;
+	unsigned        m_fractional_width;
+
+	// duration
+	Rep             m_count;
+	hamon::intmax_t m_num;
+	hamon::intmax_t m_den;
+
+	// タイムゾーン
+	long long       m_offset;		// 秒
+	char const*     m_abbrev;
+	hamon::size_t   m_abbrev_size;
+
+	HAMON_CXX11_CONSTEXPR chrono_format_value() HAMON_NOEXCEPT
+		: m_fields(0)
+		, m_default(chrono_default_format::date_time)
+		, m_year(0)
+		, m_month(0)
+		, m_day(0)
+		, m_weekday(0)
+		, m_index(0)
+		, m_ok(true)
+		, m_is_negative(false)
+		, m_days(0)
+		, m_hours(0)
+		, m_minutes(0)
+		, m_seconds(0)
+		, m_subseconds(0)
+		, m_fractional_width(0)
+		, m_count()
+		, m_num(1)
+		, m_den(1)
+		, m_offset(0)
+		, m_abbrev(nullptr)
+		, m_abbrev_size(0)
+	{}
+};
+
+}	// namespace detail
+}	// namespace chrono
+}	// namespace hamon
+
+#endif // HAMON_CHRONO_DETAIL_CHRONO_FORMAT_VALUE_HPP
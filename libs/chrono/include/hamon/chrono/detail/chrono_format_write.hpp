@@ -0,0 +1,705 @@
+﻿/**
+ *	@file	chrono_format_write.hpp
+ *
+ *	@brief	chrono_format_write の定義
+ */
+
+#ifndef HAMON_CHRONO_DETAIL_CHRONO_FORMAT_WRITE_HPP
+#define HAMON_CHRONO_DETAIL_CHRONO_FORMAT_WRITE_HPP
+
+#include <hamon/chrono/detail/chrono_format_value.hpp>
+#include <hamon/chrono/detail/chrono_digits.hpp>
+#include <hamon/chrono/detail/chrono_units_suffix.hpp>
+#include <hamon/chrono/detail/civil.hpp>
+#include <hamon/format/format_error.hpp>
+#include <hamon/format/detail/format_floating.hpp>
+#include <hamon/format/detail/format_integer.hpp>
+#include <hamon/format/detail/format_write.hpp>
+#include <hamon/format/detail/std_format_spec.hpp>
+#include <hamon/charconv/to_chars.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/cstdint/uint64_t.hpp>
+#include <hamon/type_traits/bool_constant.hpp>
+#include <hamon/type_traits/is_floating_point.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon {
+namespace chrono {
+namespace detail {
+
+// 30.12 Formatting[time.format]
+//
+// 変換指定子の出力は全て基本文字集合なので、一旦 char のバッファに書いてから
+// CharT として書き込む。ロケールは "C" だけに対応している。
+
+inline char const*
+chrono_weekday_name(unsigned wd) HAMON_NOEXCEPT
+{
+	static char const* const names[] =
+	{
+		"Sunday", "Monday", "Tuesday", "Wednesday", "Thursday", "Friday", "Saturday",
+	};
+	return names[wd];
+}
+
+inline char const*
+chrono_month_name(unsigned m) HAMON_NOEXCEPT
+{
+	static char const* const names[] =
+	{
+		"January", "February", "March", "April", "May", "June",
+		"July", "August", "September", "October", "November", "December",
+	};
+	return names[m - 1];
+}
+
+// 0 を詰めて width 桁以上の10進数を書く
+inline char*
+chrono_put_uint(char* p, hamon::uint64_t value, int width)
+{
+	// 月、日、時、分、秒などの2桁以下の値が殆どなので、先に調べる
+	if (value < 100 && width <= 2)
+	{
+		if (value >= 10 || width == 2)
+		{
+			return detail::chrono_write_digits2(p, static_cast<unsigned>(value));
+		}
+		*p++ = static_cast<char>('0' + value);
+		return p;
+	}
+
+	char buf[20];
+	char* const last = hamon::to_chars(buf, buf + sizeof(buf), value).ptr;
+	for (auto n = last - buf; n < width; ++n)
+	{
+		*p++ = '0';
+	}
+	for (char const* q = buf; q != last; ++q)
+	{
+		*p++ = *q;
+	}
+	return p;
+}
+
+// 負の数は '-' を付けて、絶対値を width 桁以上で書く
+inline char*
+chrono_put_int(char* p, long long value, int width)
+{
+	hamon::uint64_t abs_value = static_cast<hamon::uint64_t>(value);
+	if (value < 0)
+	{
+		*p++ = '-';
+		abs_value = 0 - abs_value;
+	}
+	return detail::chrono_put_uint(p, abs_value, width);
+}
+
+inline char*
+chrono_put_str(char* p, char const* s)
+{
+	while (*s != '\0')
+	{
+		*p++ = *s++;
+	}
+	return p;
+}
+
+inline char*
+chrono_put_str(char* p, char const* s, hamon::size_t n)
+{
+	for (hamon::size_t i = 0; i < n; ++i)
+	{
+		*p++ = s[i];
+	}
+	return p;
+}
+
+inline long long
+chrono_floor_div(long long x, long long y) HAMON_NOEXCEPT
+{
+	return (x >= 0 ? x : x - (y - 1)) / y;
+}
+
+/**
+ *	@brief	chrono_format_value を書き込む
+ */
+template <typename CharT, typename Out, typename Rep>
+class chrono_format_writer
+{
+public:
+	chrono_format_writer(Out out, chrono_format_value<Rep> const& value, hamon::detail::std_format_spec<CharT> const& spec)
+		: m_out(out)
+		, m_value(value)
+		, m_spec(spec)
+	{}
+
+	Out out() const
+	{
+		return m_out;
+	}
+
+	// chrono-specs [first, last) に従って書き込む
+	void write_specs(CharT const* first, CharT const* last)
+	{
+		if (m_value.m_is_negative)
+		{
+			this->write_char('-');
+		}
+
+		while (first != last)
+		{
+			CharT const* p = first;
+			while (p != last && *p != CharT('%'))
+			{
+				++p;
+			}
+			if (p != first)
+			{
+				m_out = hamon::detail::format_write(m_out, first, static_cast<hamon::size_t>(p - first));
+			}
+			if (p == last)
+			{
+				break;
+			}
+
+			// parse で調べてあるので、'%' の後には変換指定子がある
+			++p;
+			bool const modified = (*p == CharT('E') || *p == CharT('O'));
+			if (modified)
+			{
+				++p;
+			}
+
+			if (modified && *p == CharT('z'))
+			{
+				// %Ez と %Oz は時と分の間に ':' を入れる
+				char buf[16];
+				this->write_narrow(buf, this->put_offset(buf, true));
+			}
+			else
+			{
+				this->write_conversion(static_cast<char>(*p));
+			}
+			first = p + 1;
+		}
+	}
+
+	// chrono-specs を省略したときの出力
+	void write_default()
+	{
+		switch (m_value.m_default)
+		{
+		case chrono_default_format::duration:
+			this->write_count();
+			this->write_units_suffix();
+			break;
+		case chrono_default_format::day:
+			this->write_default_day();
+			break;
+		case chrono_default_format::month:
+			this->write_default_month();
+			break;
+		case chrono_default_format::year:
+			this->write_default_year();
+			break;
+		case chrono_default_format::weekday:
+			this->write_default_weekday();
+			break;
+		case chrono_default_format::weekday_indexed:
+			this->write_default_weekday_indexed();
+			break;
+		case chrono_default_format::weekday_last:
+			this->write_default_weekday_last();
+			break;
+		case chrono_default_format::month_day:
+			this->write_default_month();
+			this->write_char('/');
+			this->write_default_day();
+			break;
+		case chrono_default_format::month_day_last:
+			this->write_default_month();
+			this->write_narrow("/last", 5);
+			break;
+		case chrono_default_format::month_weekday:
+			this->write_default_month();
+			this->write_char('/');
+			this->write_default_weekday_indexed();
+			break;
+		case chrono_default_format::month_weekday_last:
+			this->write_default_month();
+			this->write_char('/');
+			this->write_default_weekday_last();
+			break;
+		case chrono_default_format::year_month:
+			this->write_default_year();
+			this->write_char('/');
+			this->write_default_month();
+			break;
+		case chrono_default_format::year_month_day:
+			this->write_conversion('F');
+			if (!m_value.m_ok)
+			{
+				this->write_narrow(" is not a valid date", 20);
+			}
+			break;
+		case chrono_default_format::year_month_day_last:
+			this->write_default_year();
+			this->write_char('/');
+			this->write_default_month();
+			this->write_narrow("/last", 5);
+			break;
+		case chrono_default_format::year_month_weekday:
+			this->write_default_year();
+			this->write_char('/');
+			this->write_default_month();
+			this->write_char('/');
+			this->write_default_weekday_indexed();
+			break;
+		case chrono_default_format::year_month_weekday_last:
+			this->write_default_year();
+			this->write_char('/');
+			this->write_default_month();
+			this->write_char('/');
+			this->write_default_weekday_last();
+			break;
+		case chrono_default_format::time_of_day:
+			if (m_value.m_is_negative)
+			{
+				this->write_char('-');
+			}
+			this->write_conversion('T');
+			break;
+		case chrono_default_format::date:
+			this->write_conversion('F');
+			break;
+		case chrono_default_format::date_time:
+			this->write_conversion('F');
+			this->write_char(' ');
+			this->write_conversion('T');
+			break;
+		}
+	}
+
+private:
+	void write_char(char c)
+	{
+		*m_out = static_cast<CharT>(c);
+		++m_out;
+	}
+
+	void write_narrow(char const* s, hamon::size_t n)
+	{
+		m_out = hamon::detail::format_write_narrow<CharT>(m_out, s, n);
+	}
+
+	void write_narrow(char const* first, char const* last)
+	{
+		this->write_narrow(first, static_cast<hamon::size_t>(last - first));
+	}
+
+	bool weekday_ok() const
+	{
+		return m_value.m_weekday <= 6;
+	}
+
+	bool month_ok() const
+	{
+		return m_value.m_month >= 1 && m_value.m_month <= 12;
+	}
+
+	void write_default_day()
+	{
+		char buf[32];
+		char* p = detail::chrono_put_uint(buf, m_value.m_day, 2);
+		if (!(m_value.m_day >= 1 && m_value.m_day <= 31))
+		{
+			p = detail::chrono_put_str(p, " is not a valid day");
+		}
+		this->write_narrow(buf, p);
+	}
+
+	void write_default_month()
+	{
+		if (this->month_ok())
+		{
+			this->write_conversion('b');
+			return;
+		}
+		char buf[32];
+		char* p = detail::chrono_put_uint(buf, m_value.m_month, 1);
+		p = detail::chrono_put_str(p, " is not a valid month");
+		this->write_narrow(buf, p);
+	}
+
+	void write_default_year()
+	{
+		this->write_conversion('Y');
+		if (m_value.m_year == -32768)
+		{
+			this->write_narrow(" is not a valid year", 20);
+		}
+	}
+
+	void write_default_weekday()
+	{
+		if (this->weekday_ok())
+		{
+			this->write_conversion('a');
+			return;
+		}
+		char buf[32];
+		char* p = detail::chrono_put_uint(buf, m_value.m_weekday, 1);
+		p = detail::chrono_put_str(p, " is not a valid weekday");
+		this->write_narrow(buf, p);
+	}
+
+	void write_default_weekday_indexed()
+	{
+		this->write_default_weekday();
+		char buf[32];
+		char* p = buf;
+		*p++ = '[';
+		p = detail::chrono_put_uint(p, m_value.m_index, 1);
+		if (!(m_value.m_index >= 1 && m_value.m_index <= 5))
+		{
+			p = detail::chrono_put_str(p, " is not a valid index");
+		}
+		*p++ = ']';
+		this->write_narrow(buf, p);
+	}
+
+	void write_default_weekday_last()
+	{
+		this->write_default_weekday();
+		this->write_narrow("[last]", 6);
+	}
+
+	// %Q
+	void write_count()
+	{
+		this->write_count(hamon::is_floating_point<Rep>{});
+	}
+
+	void write_count(hamon::true_type)
+	{
+		// 精度の指定は count() に使う
+		hamon::detail::std_format_spec<CharT> spec;
+		if (m_spec.m_has_precision)
+		{
+			spec.m_has_precision = true;
+			spec.m_precision = m_spec.m_precision;
+			spec.m_type = CharT('f');
+		}
+		m_out = hamon::detail::format_write_floating(m_out, m_value.m_count, spec);
+	}
+
+	void write_count(hamon::false_type)
+	{
+		m_out = hamon::detail::format_write_integer(m_out, m_value.m_count, hamon::detail::std_format_spec<CharT>{});
+	}
+
+	// %q
+	void write_units_suffix()
+	{
+		char buf[chrono_units_suffix_max_size];
+		char* const p = detail::chrono_write_units_suffix(buf, m_value.m_num, m_value.m_den);
+		this->write_narrow(buf, p);
+	}
+
+	// 1月1日からの日数 (0 から)
+	long long day_of_year() const
+	{
+		return
+			detail::days_from_civil({m_value.m_year, m_value.m_month, m_value.m_day}) -
+			detail::days_from_civil({m_value.m_year, 1, 1});
+	}
+
+	// ISO 8601 の週番号と年
+	void iso_week(int& year, unsigned& week) const
+	{
+		// その週の木曜日の年が ISO 8601 の年
+		long long const z = detail::days_from_civil({m_value.m_year, m_value.m_month, m_value.m_day});
+		long long const iso_wd = (m_value.m_weekday + 6) % 7;	// 月曜日が 0
+		int const thursday = static_cast<int>(z - iso_wd + 3);
+		year = detail::civil_from_days(thursday).year;
+		week = static_cast<unsigned>((thursday - detail::days_from_civil({year, 1, 1})) / 7 + 1);
+	}
+
+	unsigned hour12() const
+	{
+		unsigned const h = static_cast<unsigned>(m_value.m_hours % 12);
+		return h == 0 ? 12 : h;
+	}
+
+	char* put_seconds(char* p) const
+	{
+		p = detail::chrono_put_uint(p, m_value.m_seconds, 2);
+		if (m_value.m_fractional_width != 0)
+		{
+			*p++ = '.';
+			p = detail::chrono_put_uint(p, m_value.m_subseconds, static_cast<int>(m_value.m_fractional_width));
+		}
+		return p;
+	}
+
+	char* put_date(char* p, char sep, bool year_first) const
+	{
+		if (year_first)
+		{
+			// %Y-%m-%d
+			p = detail::chrono_put_int(p, m_value.m_year, 4);
+			*p++ = sep;
+			p = detail::chrono_put_uint(p, m_value.m_month, 2);
+			*p++ = sep;
+			return detail::chrono_put_uint(p, m_value.m_day, 2);
+		}
+
+		// %m/%d/%y
+		p = detail::chrono_put_uint(p, m_value.m_month, 2);
+		*p++ = sep;
+		p = detail::chrono_put_uint(p, m_value.m_day, 2);
+		*p++ = sep;
+		return detail::chrono_put_uint(p,
+			static_cast<hamon::uint64_t>(m_value.m_year - detail::chrono_floor_div(m_value.m_year, 100) * 100), 2);
+	}
+
+	char* put_time(char* p, bool seconds, bool subseconds) const
+	{
+		p = detail::chrono_put_uint(p, m_value.m_hours, 2);
+		*p++ = ':';
+		p = detail::chrono_put_uint(p, m_value.m_minutes, 2);
+		if (seconds)
+		{
+			*p++ = ':';
+			p = subseconds ?
+				this->put_seconds(p) :
+				detail::chrono_put_uint(p, m_value.m_seconds, 2);
+		}
+		return p;
+	}
+
+	char* put_weekday_name(char* p, bool full) const
+	{
+		if (!this->weekday_ok())
+		{
+			hamon::detail::throw_format_error("formatting a weekday name needs a valid weekday");
+		}
+		char const* name = detail::chrono_weekday_name(m_value.m_weekday);
+		return full ? detail::chrono_put_str(p, name) : detail::chrono_put_str(p, name, 3);
+	}
+
+	char* put_month_name(char* p, bool full) const
+	{
+		if (!this->month_ok())
+		{
+			hamon::detail::throw_format_error("formatting a month name needs a valid month");
+		}
+		char const* name = detail::chrono_month_name(m_value.m_month);
+		return full ? detail::chrono_put_str(p, name) : detail::chrono_put_str(p, name, 3);
+	}
+
+	char* put_offset(char* p, bool colon) const
+	{
+		long long offset = m_value.m_offset;
+		*p++ = offset < 0 ? '-' : '+';
+		if (offset < 0)
+		{
+			offset = -offset;
+		}
+		p = detail::chrono_put_uint(p, static_cast<hamon::uint64_t>(offset / 3600), 2);
+		if (colon)
+		{
+			*p++ = ':';
+		}
+		return detail::chrono_put_uint(p, static_cast<hamon::uint64_t>(offset / 60 % 60), 2);
+	}
+
+	void write_conversion(char c)
+	{
+		// 一番長いのは %T (時間の20桁と小数部の18桁) か %c
+		char buf[64];
+		char* p = buf;
+		switch (c)
+		{
+		case '%': *p++ = '%';  break;
+		case 'n': *p++ = '\n'; break;
+		case 't': *p++ = '\t'; break;
+
+		// 年
+		case 'C':
+			p = detail::chrono_put_int(p, detail::chrono_floor_div(m_value.m_year, 100), 2);
+			break;
+		case 'y':
+			p = detail::chrono_put_uint(p,
+				static_cast<hamon::uint64_t>(m_value.m_year - detail::chrono_floor_div(m_value.m_year, 100) * 100), 2);
+			break;
+		case 'Y':
+			p = detail::chrono_put_int(p, m_value.m_year, 4);
+			break;
+
+		// 月
+		case 'b':
+		case 'h':
+			p = this->put_month_name(p, false);
+			break;
+		case 'B':
+			p = this->put_month_name(p, true);
+			break;
+		case 'm':
+			p = detail::chrono_put_uint(p, m_value.m_month, 2);
+			break;
+
+		// 日
+		case 'd':
+			p = detail::chrono_put_uint(p, m_value.m_day, 2);
+			break;
+		case 'e':
+			if (m_value.m_day < 10)
+			{
+				*p++ = ' ';
+			}
+			p = detail::chrono_put_uint(p, m_value.m_day, 1);
+			break;
+		case 'j':
+			if (m_value.m_fields & chrono_format_fields::duration)
+			{
+				p = detail::chrono_put_uint(p, m_value.m_days, 1);
+			}
+			else
+			{
+				p = detail::chrono_put_uint(p, static_cast<hamon::uint64_t>(this->day_of_year() + 1), 3);
+			}
+			break;
+
+		// 曜日
+		case 'a':
+			p = this->put_weekday_name(p, false);
+			break;
+		case 'A':
+			p = this->put_weekday_name(p, true);
+			break;
+		case 'u':
+			p = detail::chrono_put_uint(p, m_value.m_weekday == 0 ? 7 : m_value.m_weekday, 1);
+			break;
+		case 'w':
+			p = detail::chrono_put_uint(p, m_value.m_weekday, 1);
+			break;
+
+		// 週
+		case 'U':
+			p = detail::chrono_put_uint(p,
+				static_cast<hamon::uint64_t>((this->day_of_year() + 7 - m_value.m_weekday) / 7), 2);
+			break;
+		case 'W':
+			p = detail::chrono_put_uint(p,
+				static_cast<hamon::uint64_t>((this->day_of_year() + 7 - (m_value.m_weekday + 6) % 7) / 7), 2);
+			break;
+		case 'G':
+		case 'g':
+		case 'V':
+		{
+			int year;
+			unsigned week;
+			this->iso_week(year, week);
+			p =
+				c == 'G' ? detail::chrono_put_int(p, year, 4) :
+				c == 'g' ? detail::chrono_put_uint(p,
+					static_cast<hamon::uint64_t>(year - detail::chrono_floor_div(year, 100) * 100), 2) :
+				detail::chrono_put_uint(p, week, 2);
+			break;
+		}
+
+		// 日付
+		case 'D':
+		case 'x':
+			p = this->put_date(p, '/', false);
+			break;
+		case 'F':
+			p = this->put_date(p, '-', true);
+			break;
+
+		// 時刻
+		case 'H':
+			p = detail::chrono_put_uint(p, m_value.m_hours, 2);
+			break;
+		case 'I':
+			p = detail::chrono_put_uint(p, this->hour12(), 2);
+			break;
+		case 'M':
+			p = detail::chrono_put_uint(p, m_value.m_minutes, 2);
+			break;
+		case 'S':
+			p = this->put_seconds(p);
+			break;
+		case 'p':
+			p = detail::chrono_put_str(p, m_value.m_hours % 24 < 12 ? "AM" : "PM");
+			break;
+		case 'r':
+			p = detail::chrono_put_uint(p, this->hour12(), 2);
+			*p++ = ':';
+			p = detail::chrono_put_uint(p, m_value.m_minutes, 2);
+			*p++ = ':';
+			p = detail::chrono_put_uint(p, m_value.m_seconds, 2);
+			p = detail::chrono_put_str(p, m_value.m_hours % 24 < 12 ? " AM" : " PM");
+			break;
+		case 'R':
+			p = this->put_time(p, false, false);
+			break;
+		case 'T':
+			p = this->put_time(p, true, true);
+			break;
+		case 'X':
+			p = this->put_time(p, true, false);
+			break;
+
+		// 日付と時刻
+		case 'c':
+			// "C" ロケールでは "%a %b %e %H:%M:%S %Y"
+			p = this->put_weekday_name(p, false);
+			*p++ = ' ';
+			p = this->put_month_name(p, false);
+			*p++ = ' ';
+			if (m_value.m_day < 10)
+			{
+				*p++ = ' ';
+			}
+			p = detail::chrono_put_uint(p, m_value.m_day, 1);
+			*p++ = ' ';
+			p = this->put_time(p, true, false);
+			*p++ = ' ';
+			p = detail::chrono_put_int(p, m_value.m_year, 4);
+			break;
+
+		// タイムゾーン
+		case 'z':
+			p = this->put_offset(p, false);
+			break;
+		case 'Z':
+			this->write_narrow(m_value.m_abbrev, m_value.m_abbrev_size);
+			return;
+
+		// duration
+		case 'Q':
+			this->write_count();
+			return;
+		case 'q':
+			this->write_units_suffix();
+			return;
+
+		default:
+			break;
+		}
+		this->write_narrow(buf, p);
+	}
+
+private:
+	Out                               m_out;
+	chrono_format_value<Rep> const&   m_value;
+	hamon::detail::std_format_spec<CharT> const&     m_spec;
+};
+
+}	// namespace detail
+}	// namespace chrono
+}	// namespace hamon
+
+#endif // HAMON_CHRONO_DETAIL_CHRONO_FORMAT_WRITE_HPP
@@ -0,0 +1,199 @@
+﻿/**
+ *	@file	chrono_from_chars.hpp
+ *
+ *	@brief	文字列から日付と時刻を読む関数の定義
+ */
+
+#ifndef HAMON_CHRONO_DETAIL_CHRONO_FROM_CHARS_HPP
+#define HAMON_CHRONO_DETAIL_CHRONO_FROM_CHARS_HPP
+
+#include <hamon/chrono/detail/chrono_digits.hpp>
+#include <hamon/chrono/detail/civil.hpp>
+#include <hamon/cstdint/uint64_t.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon {
+namespace chrono {
+namespace detail {
+
+inline HAMON_CXX11_CONSTEXPR bool
+chrono_is_digit(char c) HAMON_NOEXCEPT
+{
+	return static_cast<unsigned>(static_cast<unsigned char>(c)) - '0' <= 9;
+}
+
+// 年月日が正しい日付かどうか (year_month_day::ok() と同じ)
+inline HAMON_CXX14_CONSTEXPR bool
+chrono_is_valid_date(civil const& c) HAMON_NOEXCEPT
+{
+	if (c.month < 1 || c.month > 12 || c.day < 1)
+	{
+		return false;
+	}
+
+	// 2月以外は 30 | (m ^ (m >> 3)) で 30 か 31 になる
+	bool const leap = c.year % 4 == 0 && (c.year % 100 != 0 || c.year % 400 == 0);
+	unsigned const n = (c.month == 2) ?
+		(leap ? 29u : 28u) :
+		(30u | (c.month ^ (c.month >> 3)));
+	return c.day <= n;
+}
+
+// "[+-]YYYY-MM-DD" を読む。年は4桁か5桁。
+// 読めたときは読んだ文字の次の位置を返し、読めなかったときは nullptr を返す。
+inline HAMON_CXX14_CONSTEXPR char const*
+chrono_read_date(char const* first, char const* end, civil& c) HAMON_NOEXCEPT
+{
+	bool negative = false;
+	if (first != end && (*first == '-' || *first == '+'))
+	{
+		negative = (*first == '-');
+		++first;
+	}
+
+	char const* p = first;
+	while (p != end && p - first < 5 && detail::chrono_is_digit(*p))
+	{
+		++p;
+	}
+
+	auto const n = static_cast<unsigned>(p - first);
+	if (n < 4 || end - p < 6 || p[0] != '-' || p[3] != '-')
+	{
+		return nullptr;
+	}
+
+	unsigned y = 0;
+	unsigned m = 0;
+	unsigned d = 0;
+	detail::chrono_read_digits(first, n, y);
+	if (y > 32767 ||
+		!detail::chrono_read_digits2(p + 1, m) ||
+		!detail::chrono_read_digits2(p + 4, d))
+	{
+		return nullptr;
+	}
+
+	c.year  = negative ? -static_cast<int>(y) : static_cast<int>(y);
+	c.month = m;
+	c.day   = d;
+	return p + 6;
+}
+
+// "hh:mm:ss" を読む。long_hours が true のときは、時を10桁まで読んでもよい。
+// 値の範囲は呼び出し側で調べる。
+inline HAMON_CXX14_CONSTEXPR char const*
+chrono_read_time(
+	char const* first, char const* end, bool long_hours,
+	hamon::uint64_t& hours, unsigned& minutes, unsigned& seconds) HAMON_NOEXCEPT
+{
+	char const* p = first;
+	hamon::uint64_t h = 0;
+	while (p != end && detail::chrono_is_digit(*p) && p - first < (long_hours ? 10 : 2))
+	{
+		h = h * 10 + static_cast<unsigned>(*p - '0');
+		++p;
+	}
+
+	if (p - first < 2 || end - p < 6 || p[0] != ':' || p[3] != ':')
+	{
+		return nullptr;
+	}
+
+	if (!detail::chrono_read_digits2(p + 1, minutes) ||
+		!detail::chrono_read_digits2(p + 4, seconds))
+	{
+		return nullptr;
+	}
+
+	hours = h;
+	return p + 6;
+}
+
+// '.' か ',' に続く小数部を読み、丁度 width 桁の整数にする (下の桁は切り捨てる)。
+// 小数部が無いときは first をそのまま返し、'.' の後に数字が無いときは nullptr を返す。
+inline HAMON_CXX14_CONSTEXPR char const*
+chrono_read_fraction(char const* first, char const* end, unsigned width, hamon::uint64_t& out) HAMON_NOEXCEPT
+{
+	out = 0;
+	if (first == end || (*first != '.' && *first != ','))
+	{
+		return first;
+	}
+
+	char const* const digits = ++first;
+	hamon::uint64_t v = 0;
+	unsigned n = 0;
+	while (first != end && detail::chrono_is_digit(*first))
+	{
+		if (n < width)
+		{
+			v = v * 10 + static_cast<unsigned>(*first - '0');
+			++n;
+		}
+		++first;
+	}
+
+	if (first == digits)
+	{
+		return nullptr;
+	}
+
+	for (; n < width; ++n)
+	{
+		v *= 10;
+	}
+
+	out = v;
+	return first;
+}
+
+// UTC からのずれ ('Z' か "+hh:mm", "+hhmm") を分で読む。
+// ずれが書かれていないときは first をそのまま返し、書式が正しくないときは nullptr を返す。
+inline HAMON_CXX14_CONSTEXPR char const*
+chrono_read_offset(char const* first, char const* end, int& offset) HAMON_NOEXCEPT
+{
+	offset = 0;
+	if (first == end)
+	{
+		return first;
+	}
+
+	if (*first == 'Z' || *first == 'z')
+	{
+		return first + 1;
+	}
+
+	if (*first != '+' && *first != '-')
+	{
+		return first;
+	}
+
+	bool const negative = (*first == '-');
+	char const* p = first + 1;
+	unsigned h = 0;
+	unsigned m = 0;
+	if (end - p < 4 || !detail::chrono_read_digits2(p, h))
+	{
+		return nullptr;
+	}
+	p += 2;
+	if (*p == ':')
+	{
+		++p;
+	}
+	if (end - p < 2 || !detail::chrono_read_digits2(p, m) || h > 23 || m > 59)
+	{
+		return nullptr;
+	}
+
+	int const v = static_cast<int>(h * 60 + m);
+	offset = negative ? -v : v;
+	return p + 2;
+}
+
+}	// namespace detail
+}	// namespace chrono
+}	// namespace hamon
+
+#endif // HAMON_CHRONO_DETAIL_CHRONO_FROM_CHARS_HPP
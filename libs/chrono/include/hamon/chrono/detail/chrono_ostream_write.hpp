@@ -0,0 +1,38 @@
+﻿/**
+ *	@file	chrono_ostream_write.hpp
+ *
+ *	@brief	chrono_ostream_write の定義
+ */
+
+#ifndef HAMON_CHRONO_DETAIL_CHRONO_OSTREAM_WRITE_HPP
+#define HAMON_CHRONO_DETAIL_CHRONO_OSTREAM_WRITE_HPP
+
+#include <hamon/string_view/basic_string_view.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/config.hpp>
+#include <ostream>	// basic_ostream
+
+namespace hamon {
+namespace chrono {
+namespace detail {
+
+// char のバッファ [first, end) を文字列として os に書く。
+// 書く文字は基本文字集合だけなので、charT には1文字ずつ変換すればよい。
+template <typename charT, typename traits>
+inline std::basic_ostream<charT, traits>&
+chrono_ostream_write(std::basic_ostream<charT, traits>& os, char const* first, char const* end)
+{
+	charT buf[128];
+	hamon::size_t n = 0;
+	for (; first != end && n < sizeof(buf) / sizeof(buf[0]); ++first)
+	{
+		buf[n++] = static_cast<charT>(*first);
+	}
+	return os << hamon::basic_string_view<charT, traits>(buf, n);
+}
+
+}	// namespace detail
+}	// namespace chrono
+}	// namespace hamon
+
+#endif // HAMON_CHRONO_DETAIL_CHRONO_OSTREAM_WRITE_HPP
@@ -0,0 +1,130 @@
+﻿/**
+ *	@file	chrono_to_chars.hpp
+ *
+ *	@brief	日付と時刻を文字列に変換する関数の定義
+ */
+
+#ifndef HAMON_CHRONO_DETAIL_CHRONO_TO_CHARS_HPP
+#define HAMON_CHRONO_DETAIL_CHRONO_TO_CHARS_HPP
+
+#include <hamon/chrono/detail/chrono_digits.hpp>
+#include <hamon/chrono/detail/civil.hpp>
+#include <hamon/charconv/to_chars_result.hpp>
+#include <hamon/system_error/errc.hpp>
+#include <hamon/cstdint/uint64_t.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon {
+namespace chrono {
+namespace detail {
+
+// 年の最大の長さ ("-32767")
+HAMON_INLINE_VAR HAMON_CONSTEXPR int chrono_year_max_size = 6;
+
+// "YYYY-MM-DD" の最大の長さ
+HAMON_INLINE_VAR HAMON_CONSTEXPR int chrono_date_max_size = chrono_year_max_size + 6;
+
+// "-hh:mm:ss.fff" の最大の長さ (時は 20 桁、小数部は 18 桁まで)
+HAMON_INLINE_VAR HAMON_CONSTEXPR int chrono_time_max_size = 1 + 20 + 6 + 1 + 18;
+
+// 年を %Y と同じく符号と4桁以上の数字で書く
+inline HAMON_CXX14_CONSTEXPR char*
+chrono_write_year(char* p, int y) HAMON_NOEXCEPT
+{
+	unsigned v = static_cast<unsigned>(y);
+	if (y < 0)
+	{
+		*p++ = '-';
+		v = 0u - v;
+	}
+
+	if (v < 10000)
+	{
+		return detail::chrono_write_digits4(p, v);
+	}
+	return detail::chrono_write_digits(p, v, detail::chrono_decimal_width(v));
+}
+
+// "YYYY-MM-DD" (%F) を書く
+inline HAMON_CXX14_CONSTEXPR char*
+chrono_write_date(char* p, civil const& c) HAMON_NOEXCEPT
+{
+	p = detail::chrono_write_year(p, c.year);
+	*p++ = '-';
+	p = detail::chrono_write_digits2(p, c.month % 100);
+	*p++ = '-';
+	return detail::chrono_write_digits2(p, c.day % 100);
+}
+
+// "hh:mm:ss" (%T) と、fractional_width が 0 でなければ小数部を書く
+inline HAMON_CXX14_CONSTEXPR char*
+chrono_write_time(
+	char* p,
+	hamon::uint64_t hours, unsigned minutes, unsigned seconds,
+	hamon::uint64_t subseconds, unsigned fractional_width) HAMON_NOEXCEPT
+{
+	if (hours < 100)
+	{
+		p = detail::chrono_write_digits2(p, static_cast<unsigned>(hours));
+	}
+	else
+	{
+		p = detail::chrono_write_digits(p, hours, detail::chrono_decimal_width(hours));
+	}
+	*p++ = ':';
+	p = detail::chrono_write_digits2(p, minutes % 100);
+	*p++ = ':';
+	p = detail::chrono_write_digits2(p, seconds % 100);
+	if (fractional_width != 0)
+	{
+		*p++ = '.';
+		p = detail::chrono_write_digits(p, subseconds, fractional_width);
+	}
+	return p;
+}
+
+// hh_mm_ss を %T と同じく書く (負の数には '-' を付ける)
+template <typename HhMmSs>
+inline HAMON_CXX14_CONSTEXPR char*
+chrono_write_hh_mm_ss(char* p, HhMmSs const& hms) HAMON_NOEXCEPT
+{
+	if (hms.is_negative())
+	{
+		*p++ = '-';
+	}
+	return detail::chrono_write_time(p,
+		static_cast<hamon::uint64_t>(hms.hours().count()),
+		static_cast<unsigned>(hms.minutes().count()),
+		static_cast<unsigned>(hms.seconds().count()),
+		static_cast<hamon::uint64_t>(hms.subseconds().count()),
+		HhMmSs::fractional_width);
+}
+
+// [first, end) に十分な大きさがあれば直接書き、無ければ一時的なバッファに書く。
+// out が first でないときは、書き終えた後で [first, end) に写す。
+inline HAMON_CXX14_CONSTEXPR hamon::to_chars_result
+chrono_to_chars_finish(char* first, char* end, char const* out, char* out_last) HAMON_NOEXCEPT
+{
+	if (out == first)
+	{
+		return {out_last, hamon::errc{}};
+	}
+
+	auto const n = out_last - out;
+	if (n > end - first)
+	{
+		return {end, hamon::errc::value_too_large};
+	}
+
+	for (auto i = n; i > 0; --i)
+	{
+		*first++ = *out++;
+	}
+	return {first, hamon::errc{}};
+}
+
+}	// namespace detail
+}	// namespace chrono
+}	// namespace hamon
+
+#endif // HAMON_CHRONO_DETAIL_CHRONO_TO_CHARS_HPP
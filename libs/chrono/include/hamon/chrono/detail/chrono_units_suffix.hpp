@@ -0,0 +1,97 @@
+﻿/**
+ *	@file	chrono_units_suffix.hpp
+ *
+ *	@brief	chrono_units_suffix_name, chrono_write_units_suffix の定義
+ */
+
+#ifndef HAMON_CHRONO_DETAIL_CHRONO_UNITS_SUFFIX_HPP
+#define HAMON_CHRONO_DETAIL_CHRONO_UNITS_SUFFIX_HPP
+
+#include <hamon/chrono/detail/chrono_digits.hpp>
+#include <hamon/cstdint/intmax_t.hpp>
+#include <hamon/cstdint/uint64_t.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon {
+namespace chrono {
+namespace detail {
+
+// 29.5.11 I/O[time.duration.io]/1.1-1.20
+// 名前の付いている units-suffix (無ければ nullptr)
+inline HAMON_CXX14_CONSTEXPR char const*
+chrono_units_suffix_name(hamon::intmax_t num, hamon::intmax_t den) HAMON_NOEXCEPT
+{
+	if (num == 1)
+	{
+		switch (den)
+		{
+		case 1000000000000000000: return "as";
+		case 1000000000000000:    return "fs";
+		case 1000000000000:       return "ps";
+		case 1000000000:          return "ns";
+		case 1000000:             return "us";
+		case 1000:                return "ms";
+		case 100:                 return "cs";
+		case 10:                  return "ds";
+		case 1:                   return "s";
+		default: break;
+		}
+	}
+	else if (den == 1)
+	{
+		switch (num)
+		{
+		case 10:                  return "das";
+		case 100:                 return "hs";
+		case 1000:                return "ks";
+		case 1000000:             return "Ms";
+		case 1000000000:          return "Gs";
+		case 1000000000000:       return "Ts";
+		case 1000000000000000:    return "Ps";
+		case 1000000000000000000: return "Es";
+		case 60:                  return "min";
+		case 3600:                return "h";
+		case 86400:               return "d";
+		default: break;
+		}
+	}
+	return nullptr;
+}
+
+// units-suffix の最大の長さ ("[" num "/" den "]s")
+HAMON_INLINE_VAR HAMON_CONSTEXPR int chrono_units_suffix_max_size = 42;
+
+// units-suffix を書く
+inline HAMON_CXX14_CONSTEXPR char*
+chrono_write_units_suffix(char* p, hamon::intmax_t num, hamon::intmax_t den) HAMON_NOEXCEPT
+{
+	char const* s = detail::chrono_units_suffix_name(num, den);
+	if (s != nullptr)
+	{
+		while (*s != '\0')
+		{
+			*p++ = *s++;
+		}
+		return p;
+	}
+
+	// [time.duration.io]/1.21-1.22 (num と den は正の数)
+	auto const n = static_cast<hamon::uint64_t>(num);
+	*p++ = '[';
+	p = detail::chrono_write_digits(p, n, detail::chrono_decimal_width(n));
+	if (den != 1)
+	{
+		auto const d = static_cast<hamon::uint64_t>(den);
+		*p++ = '/';
+		p = detail::chrono_write_digits(p, d, detail::chrono_decimal_width(d));
+	}
+	*p++ = ']';
+	*p++ = 's';
+	return p;
+}
+
+}	// namespace detail
+}	// namespace chrono
+}	// namespace hamon
+
+#endif // HAMON_CHRONO_DETAIL_CHRONO_UNITS_SUFFIX_HPP
@@ -0,0 +1,4862 @@
+﻿/**
+ *	@file	compiled_tzdata.hpp
+ *
+ *	@brief	compiled_tzdata の定義
+ *
+ *	tools/make_compiled_tzdata.cpp で tzdata.zi (version 2025b) と leap-seconds.list から生成した。
+ *	直接編集しないこと。
+ */
+
+#ifndef HAMON_CHRONO_DETAIL_COMPILED_TZDATA_HPP
+#define HAMON_CHRONO_DETAIL_COMPILED_TZDATA_HPP
+
+#include <hamon/chrono/detail/compiled_tzdb.hpp>
+
+namespace hamon {
+namespace chrono {
+namespace detail {
+namespace tz
+{
+
+inline compiled_tzdb_t const& compiled_tzdata()
+{
+	static constexpr compiled_rule_t rules[] =
+	{
+		{ 1930, 1930, 12, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "" },
+		{ 1931, 1931, 4, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1931, 1931, 10, { compiled_on_t::day, 0, 15 }, 0, 0, true, 3600, "" },
+		{ 1932, 1940, 3, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1932, 1939, 11, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "" },
+		{ 1940, 1940, 7, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "" },
+		{ 1941, 1941, 6, { compiled_on_t::day, 0, 15 }, 0, 0, false, 0, "" },
+		{ 1941, 1941, 10, { compiled_on_t::day, 0, 15 }, 0, 0, true, 3600, "" },
+		{ 1943, 1943, 8, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1943, 1943, 10, { compiled_on_t::day, 0, 15 }, 0, 0, true, 3600, "" },
+		{ 1946, 1946, 3, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1946, 1946, 10, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "" },
+		{ 1963, 1963, 10, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1963, 1963, 12, { compiled_on_t::day, 0, 15 }, 0, 0, true, 3600, "" },
+		{ 1964, 1966, 3, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1964, 1966, 10, { compiled_on_t::day, 0, 15 }, 0, 0, true, 3600, "" },
+		{ 1967, 1967, 4, { compiled_on_t::day, 0, 2 }, 0, 0, false, 0, "" },
+		{ 1967, 1968, 10, { compiled_on_t::weekday_ge, 0, 1 }, 0, 0, true, 3600, "" },
+		{ 1968, 1969, 4, { compiled_on_t::weekday_ge, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1974, 1974, 1, { compiled_on_t::day, 0, 23 }, 0, 0, true, 3600, "" },
+		{ 1974, 1974, 5, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1988, 1988, 12, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "" },
+		{ 1989, 1993, 3, { compiled_on_t::weekday_ge, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1989, 1992, 10, { compiled_on_t::weekday_ge, 0, 15 }, 0, 0, true, 3600, "" },
+		{ 1999, 1999, 10, { compiled_on_t::weekday_ge, 0, 1 }, 0, 0, true, 3600, "" },
+		{ 2000, 2000, 3, { compiled_on_t::day, 0, 3 }, 0, 0, false, 0, "" },
+		{ 2007, 2007, 12, { compiled_on_t::day, 0, 30 }, 0, 0, true, 3600, "" },
+		{ 2008, 2009, 3, { compiled_on_t::weekday_ge, 0, 15 }, 0, 0, false, 0, "" },
+		{ 2008, 2008, 10, { compiled_on_t::weekday_ge, 0, 15 }, 0, 0, true, 3600, "" },
+		{ 2011, 2011, 3, { compiled_on_t::last_weekday, 0, 0 }, 7200, 1, true, 3600, "" },
+		{ 2011, 2011, 10, { compiled_on_t::last_weekday, 0, 0 }, 7200, 1, false, 0, "" },
+		{ 1971, 1985, 10, { compiled_on_t::last_weekday, 0, 0 }, 7200, 1, true, 3600, "D" },
+		{ 1972, 1972, 2, { compiled_on_t::day, 0, 27 }, 7200, 1, false, 0, "S" },
+		{ 1973, 1981, 3, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 1, false, 0, "S" },
+		{ 1982, 1982, 4, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 1, false, 0, "S" },
+		{ 1983, 1985, 3, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 1, false, 0, "S" },
+		{ 1986, 1989, 3, { compiled_on_t::weekday_ge, 0, 15 }, 7200, 1, false, 0, "S" },
+		{ 1986, 1986, 10, { compiled_on_t::day, 0, 19 }, 7200, 1, true, 3600, "D" },
+		{ 1987, 1999, 10, { compiled_on_t::last_weekday, 0, 0 }, 7200, 1, true, 3600, "D" },
+		{ 1990, 1995, 3, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 1, false, 0, "S" },
+		{ 1996, 2005, 3, { compiled_on_t::last_weekday, 0, 0 }, 7200, 1, false, 0, "S" },
+		{ 2000, 2000, 8, { compiled_on_t::last_weekday, 0, 0 }, 7200, 1, true, 3600, "D" },
+		{ 2001, 2007, 10, { compiled_on_t::last_weekday, 0, 0 }, 7200, 1, true, 3600, "D" },
+		{ 2006, 2006, 4, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 1, false, 0, "S" },
+		{ 2007, 2007, 3, { compiled_on_t::last_weekday, 0, 0 }, 7200, 1, false, 0, "S" },
+		{ 2008, 32767, 4, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 1, false, 0, "S" },
+		{ 2008, 32767, 10, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 1, true, 3600, "D" },
+		{ 1971, 1971, 10, { compiled_on_t::last_weekday, 0, 0 }, 7200, 1, true, 3600, "D" },
+		{ 1972, 1972, 2, { compiled_on_t::last_weekday, 0, 0 }, 7200, 1, false, 0, "S" },
+		{ 1989, 1991, 10, { compiled_on_t::last_weekday, 0, 0 }, 7200, 1, true, 3600, "D" },
+		{ 1990, 1992, 3, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 1, false, 0, "S" },
+		{ 1971, 1985, 10, { compiled_on_t::last_weekday, 0, 0 }, 7200, 1, true, 3600, "D" },
+		{ 1986, 1986, 10, { compiled_on_t::day, 0, 19 }, 7200, 1, true, 3600, "D" },
+		{ 1987, 2007, 10, { compiled_on_t::last_weekday, 0, 0 }, 7200, 1, true, 3600, "D" },
+		{ 1972, 1972, 2, { compiled_on_t::day, 0, 27 }, 7200, 1, false, 0, "S" },
+		{ 1973, 1985, 3, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 1, false, 0, "S" },
+		{ 1986, 1990, 3, { compiled_on_t::weekday_ge, 0, 15 }, 7200, 1, false, 0, "S" },
+		{ 1991, 1991, 3, { compiled_on_t::day, 0, 3 }, 7200, 1, false, 0, "S" },
+		{ 1992, 1992, 3, { compiled_on_t::day, 0, 22 }, 7200, 1, false, 0, "S" },
+		{ 1993, 1993, 3, { compiled_on_t::day, 0, 7 }, 7200, 1, false, 0, "S" },
+		{ 1994, 1994, 3, { compiled_on_t::day, 0, 20 }, 7200, 1, false, 0, "S" },
+		{ 1995, 2005, 3, { compiled_on_t::last_weekday, 0, 0 }, 7200, 1, false, 0, "S" },
+		{ 2006, 2006, 4, { compiled_on_t::day, 0, 2 }, 7200, 1, false, 0, "S" },
+		{ 2007, 2007, 3, { compiled_on_t::last_weekday, 0, 0 }, 7200, 1, false, 0, "S" },
+		{ 2008, 32767, 4, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 1, false, 0, "S" },
+		{ 2008, 32767, 10, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 1, true, 3600, "D" },
+		{ 1916, 1916, 10, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 1, true, 3600, "D" },
+		{ 1917, 1917, 3, { compiled_on_t::last_weekday, 0, 0 }, 7200, 1, false, 0, "S" },
+		{ 1917, 1918, 10, { compiled_on_t::weekday_ge, 0, 22 }, 7200, 1, true, 3600, "D" },
+		{ 1918, 1919, 3, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 1, false, 0, "S" },
+		{ 1967, 1967, 10, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 1, true, 3600, "D" },
+		{ 1968, 1968, 3, { compiled_on_t::weekday_ge, 0, 29 }, 7200, 1, false, 0, "S" },
+		{ 1968, 1985, 10, { compiled_on_t::last_weekday, 0, 0 }, 7200, 1, true, 3600, "D" },
+		{ 1969, 1971, 3, { compiled_on_t::weekday_ge, 0, 8 }, 7200, 1, false, 0, "S" },
+		{ 1972, 1972, 2, { compiled_on_t::last_weekday, 0, 0 }, 7200, 1, false, 0, "S" },
+		{ 1973, 1981, 3, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 1, false, 0, "S" },
+		{ 1982, 1983, 3, { compiled_on_t::last_weekday, 0, 0 }, 7200, 1, false, 0, "S" },
+		{ 1984, 1986, 3, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 1, false, 0, "S" },
+		{ 1986, 1986, 10, { compiled_on_t::weekday_ge, 0, 15 }, 7200, 1, true, 3600, "D" },
+		{ 1987, 1990, 3, { compiled_on_t::weekday_ge, 0, 15 }, 7200, 1, false, 0, "S" },
+		{ 1987, 1987, 10, { compiled_on_t::weekday_ge, 0, 22 }, 7200, 1, true, 3600, "D" },
+		{ 1988, 1990, 10, { compiled_on_t::last_weekday, 0, 0 }, 7200, 1, true, 3600, "D" },
+		{ 1991, 1999, 10, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 1, true, 3600, "D" },
+		{ 1991, 2005, 3, { compiled_on_t::last_weekday, 0, 0 }, 7200, 1, false, 0, "S" },
+		{ 2000, 2000, 8, { compiled_on_t::last_weekday, 0, 0 }, 7200, 1, true, 3600, "D" },
+		{ 2001, 32767, 10, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 1, true, 3600, "D" },
+		{ 2006, 2006, 4, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 1, false, 0, "S" },
+		{ 2007, 2007, 3, { compiled_on_t::last_weekday, 0, 0 }, 7200, 1, false, 0, "S" },
+		{ 2008, 32767, 4, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 1, false, 0, "S" },
+		{ 1917, 1917, 1, { compiled_on_t::day, 0, 1 }, 7200, 1, true, 3600, "D" },
+		{ 1917, 1917, 3, { compiled_on_t::last_weekday, 0, 0 }, 7200, 1, false, 0, "S" },
+		{ 1942, 1942, 1, { compiled_on_t::day, 0, 1 }, 7200, 1, true, 3600, "D" },
+		{ 1942, 1942, 3, { compiled_on_t::last_weekday, 0, 0 }, 7200, 1, false, 0, "S" },
+		{ 1942, 1942, 9, { compiled_on_t::day, 0, 27 }, 7200, 1, true, 3600, "D" },
+		{ 1943, 1944, 3, { compiled_on_t::last_weekday, 0, 0 }, 7200, 1, false, 0, "S" },
+		{ 1943, 1943, 10, { compiled_on_t::day, 0, 3 }, 7200, 1, true, 3600, "D" },
+		{ 1971, 1985, 10, { compiled_on_t::last_weekday, 0, 0 }, 7200, 1, true, 3600, "D" },
+		{ 1972, 1972, 2, { compiled_on_t::last_weekday, 0, 0 }, 7200, 1, false, 0, "S" },
+		{ 1973, 1985, 3, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 1, false, 0, "S" },
+		{ 1986, 1990, 3, { compiled_on_t::weekday_ge, 0, 15 }, 7200, 1, false, 0, "S" },
+		{ 1986, 1987, 10, { compiled_on_t::weekday_ge, 0, 15 }, 7200, 1, true, 3600, "D" },
+		{ 1988, 1999, 10, { compiled_on_t::last_weekday, 0, 0 }, 7200, 1, true, 3600, "D" },
+		{ 1991, 1994, 3, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 1, false, 0, "S" },
+		{ 1995, 2005, 3, { compiled_on_t::last_weekday, 0, 0 }, 7200, 1, false, 0, "S" },
+		{ 2000, 2000, 8, { compiled_on_t::last_weekday, 0, 0 }, 7200, 1, true, 3600, "D" },
+		{ 2001, 2007, 10, { compiled_on_t::last_weekday, 0, 0 }, 7200, 1, true, 3600, "D" },
+		{ 2006, 2006, 4, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 1, false, 0, "S" },
+		{ 2007, 2007, 3, { compiled_on_t::last_weekday, 0, 0 }, 7200, 1, false, 0, "S" },
+		{ 2008, 32767, 4, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 1, false, 0, "S" },
+		{ 2008, 32767, 10, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 1, true, 3600, "D" },
+		{ 1974, 1974, 10, { compiled_on_t::last_weekday, 0, 0 }, 7200, 1, true, 3600, "D" },
+		{ 1975, 1975, 3, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 1, false, 0, "S" },
+		{ 1983, 1983, 10, { compiled_on_t::last_weekday, 0, 0 }, 7200, 1, true, 3600, "D" },
+		{ 1984, 1984, 3, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 1, false, 0, "S" },
+		{ 1991, 1991, 11, { compiled_on_t::day, 0, 17 }, 7200, 1, true, 3600, "D" },
+		{ 1992, 1992, 3, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 1, false, 0, "S" },
+		{ 2006, 2006, 12, { compiled_on_t::day, 0, 3 }, 7200, 1, true, 3600, "D" },
+		{ 2007, 2009, 3, { compiled_on_t::last_weekday, 0, 0 }, 7200, 1, false, 0, "S" },
+		{ 2007, 2008, 10, { compiled_on_t::last_weekday, 0, 0 }, 7200, 1, true, 3600, "D" },
+		{ 1997, 2015, 3, { compiled_on_t::last_weekday, 0, 0 }, 14400, 0, true, 3600, "" },
+		{ 1997, 2015, 10, { compiled_on_t::last_weekday, 0, 0 }, 18000, 0, false, 0, "" },
+		{ 1931, 1931, 10, { compiled_on_t::day, 0, 3 }, 39600, 0, true, 3600, "" },
+		{ 1932, 1933, 4, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1932, 1932, 10, { compiled_on_t::day, 0, 3 }, 0, 0, true, 3600, "" },
+		{ 1949, 1952, 12, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "" },
+		{ 1950, 1950, 4, { compiled_on_t::day, 0, 16 }, 3600, 0, false, 0, "" },
+		{ 1951, 1952, 4, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1953, 1953, 3, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1963, 1963, 12, { compiled_on_t::day, 0, 9 }, 0, 0, true, 3600, "" },
+		{ 1964, 1964, 3, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1965, 1965, 1, { compiled_on_t::day, 0, 31 }, 0, 0, true, 3600, "" },
+		{ 1965, 1965, 3, { compiled_on_t::day, 0, 31 }, 0, 0, false, 0, "" },
+		{ 1965, 1965, 12, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "" },
+		{ 1966, 1968, 3, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1966, 1967, 11, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "" },
+		{ 1985, 1985, 11, { compiled_on_t::day, 0, 2 }, 0, 0, true, 3600, "" },
+		{ 1986, 1986, 3, { compiled_on_t::day, 0, 15 }, 0, 0, false, 0, "" },
+		{ 1986, 1986, 10, { compiled_on_t::day, 0, 25 }, 0, 0, true, 3600, "" },
+		{ 1987, 1987, 2, { compiled_on_t::day, 0, 14 }, 0, 0, false, 0, "" },
+		{ 1987, 1987, 10, { compiled_on_t::day, 0, 25 }, 0, 0, true, 3600, "" },
+		{ 1988, 1988, 2, { compiled_on_t::day, 0, 7 }, 0, 0, false, 0, "" },
+		{ 1988, 1988, 10, { compiled_on_t::day, 0, 16 }, 0, 0, true, 3600, "" },
+		{ 1989, 1989, 1, { compiled_on_t::day, 0, 29 }, 0, 0, false, 0, "" },
+		{ 1989, 1989, 10, { compiled_on_t::day, 0, 15 }, 0, 0, true, 3600, "" },
+		{ 1990, 1990, 2, { compiled_on_t::day, 0, 11 }, 0, 0, false, 0, "" },
+		{ 1990, 1990, 10, { compiled_on_t::day, 0, 21 }, 0, 0, true, 3600, "" },
+		{ 1991, 1991, 2, { compiled_on_t::day, 0, 17 }, 0, 0, false, 0, "" },
+		{ 1991, 1991, 10, { compiled_on_t::day, 0, 20 }, 0, 0, true, 3600, "" },
+		{ 1992, 1992, 2, { compiled_on_t::day, 0, 9 }, 0, 0, false, 0, "" },
+		{ 1992, 1992, 10, { compiled_on_t::day, 0, 25 }, 0, 0, true, 3600, "" },
+		{ 1993, 1993, 1, { compiled_on_t::day, 0, 31 }, 0, 0, false, 0, "" },
+		{ 1993, 1995, 10, { compiled_on_t::weekday_ge, 0, 11 }, 0, 0, true, 3600, "" },
+		{ 1994, 1995, 2, { compiled_on_t::weekday_ge, 0, 15 }, 0, 0, false, 0, "" },
+		{ 1996, 1996, 2, { compiled_on_t::day, 0, 11 }, 0, 0, false, 0, "" },
+		{ 1996, 1996, 10, { compiled_on_t::day, 0, 6 }, 0, 0, true, 3600, "" },
+		{ 1997, 1997, 2, { compiled_on_t::day, 0, 16 }, 0, 0, false, 0, "" },
+		{ 1997, 1997, 10, { compiled_on_t::day, 0, 6 }, 0, 0, true, 3600, "" },
+		{ 1998, 1998, 3, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1998, 1998, 10, { compiled_on_t::day, 0, 11 }, 0, 0, true, 3600, "" },
+		{ 1999, 1999, 2, { compiled_on_t::day, 0, 21 }, 0, 0, false, 0, "" },
+		{ 1999, 1999, 10, { compiled_on_t::day, 0, 3 }, 0, 0, true, 3600, "" },
+		{ 2000, 2000, 2, { compiled_on_t::day, 0, 27 }, 0, 0, false, 0, "" },
+		{ 2000, 2001, 10, { compiled_on_t::weekday_ge, 0, 8 }, 0, 0, true, 3600, "" },
+		{ 2001, 2006, 2, { compiled_on_t::weekday_ge, 0, 15 }, 0, 0, false, 0, "" },
+		{ 2002, 2002, 11, { compiled_on_t::day, 0, 3 }, 0, 0, true, 3600, "" },
+		{ 2003, 2003, 10, { compiled_on_t::day, 0, 19 }, 0, 0, true, 3600, "" },
+		{ 2004, 2004, 11, { compiled_on_t::day, 0, 2 }, 0, 0, true, 3600, "" },
+		{ 2005, 2005, 10, { compiled_on_t::day, 0, 16 }, 0, 0, true, 3600, "" },
+		{ 2006, 2006, 11, { compiled_on_t::day, 0, 5 }, 0, 0, true, 3600, "" },
+		{ 2007, 2007, 2, { compiled_on_t::day, 0, 25 }, 0, 0, false, 0, "" },
+		{ 2007, 2007, 10, { compiled_on_t::weekday_ge, 0, 8 }, 0, 0, true, 3600, "" },
+		{ 2008, 2017, 10, { compiled_on_t::weekday_ge, 0, 15 }, 0, 0, true, 3600, "" },
+		{ 2008, 2011, 2, { compiled_on_t::weekday_ge, 0, 15 }, 0, 0, false, 0, "" },
+		{ 2012, 2012, 2, { compiled_on_t::weekday_ge, 0, 22 }, 0, 0, false, 0, "" },
+		{ 2013, 2014, 2, { compiled_on_t::weekday_ge, 0, 15 }, 0, 0, false, 0, "" },
+		{ 2015, 2015, 2, { compiled_on_t::weekday_ge, 0, 22 }, 0, 0, false, 0, "" },
+		{ 2016, 2019, 2, { compiled_on_t::weekday_ge, 0, 15 }, 0, 0, false, 0, "" },
+		{ 2018, 2018, 11, { compiled_on_t::weekday_ge, 0, 1 }, 0, 0, true, 3600, "" },
+		{ 1942, 1942, 4, { compiled_on_t::day, 0, 19 }, 18000, 2, true, 3600, "D" },
+		{ 1942, 1942, 8, { compiled_on_t::day, 0, 31 }, 21600, 2, false, 0, "S" },
+		{ 1943, 1943, 5, { compiled_on_t::day, 0, 2 }, 18000, 2, true, 3600, "D" },
+		{ 1943, 1943, 9, { compiled_on_t::day, 0, 5 }, 21600, 2, false, 0, "S" },
+		{ 1944, 1944, 4, { compiled_on_t::day, 0, 10 }, 18000, 2, true, 1800, "" },
+		{ 1944, 1944, 9, { compiled_on_t::day, 0, 10 }, 21600, 2, false, 0, "S" },
+		{ 1977, 1977, 6, { compiled_on_t::day, 0, 12 }, 7200, 0, true, 3600, "D" },
+		{ 1977, 1978, 10, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 0, false, 0, "S" },
+		{ 1978, 1980, 4, { compiled_on_t::weekday_ge, 0, 15 }, 7200, 0, true, 3600, "D" },
+		{ 1979, 1979, 9, { compiled_on_t::day, 0, 30 }, 7200, 0, false, 0, "S" },
+		{ 1980, 1980, 9, { compiled_on_t::day, 0, 25 }, 7200, 0, false, 0, "S" },
+		{ 2009, 2009, 6, { compiled_on_t::day, 0, 19 }, 82800, 0, true, 3600, "" },
+		{ 2009, 2009, 12, { compiled_on_t::day, 0, 31 }, 86400, 0, false, 0, "" },
+		{ 1979, 1979, 3, { compiled_on_t::day, 0, 31 }, 82800, 0, true, 3600, "S" },
+		{ 1979, 1979, 10, { compiled_on_t::day, 0, 1 }, 3600, 0, false, 0, "" },
+		{ 1980, 1982, 4, { compiled_on_t::weekday_ge, 6, 1 }, 82800, 0, true, 3600, "S" },
+		{ 1980, 1980, 9, { compiled_on_t::day, 0, 29 }, 3600, 0, false, 0, "" },
+		{ 1981, 1981, 9, { compiled_on_t::day, 0, 27 }, 7200, 0, false, 0, "" },
+		{ 1918, 1941, 10, { compiled_on_t::weekday_ge, 6, 1 }, 86400, 0, true, 1800, "-0530" },
+		{ 1919, 1942, 2, { compiled_on_t::weekday_ge, 6, 8 }, 86400, 0, false, 0, "CST" },
+		{ 1942, 1942, 6, { compiled_on_t::day, 0, 27 }, 86400, 0, true, 3600, "CWT" },
+		{ 1945, 1945, 8, { compiled_on_t::day, 0, 14 }, 82800, 2, true, 3600, "CPT" },
+		{ 1945, 1945, 12, { compiled_on_t::day, 0, 15 }, 86400, 0, false, 0, "CST" },
+		{ 1947, 1967, 10, { compiled_on_t::weekday_ge, 6, 1 }, 86400, 0, true, 1800, "-0530" },
+		{ 1948, 1968, 2, { compiled_on_t::weekday_ge, 6, 8 }, 86400, 0, false, 0, "CST" },
+		{ 1973, 1973, 12, { compiled_on_t::day, 0, 5 }, 0, 0, true, 3600, "CDT" },
+		{ 1974, 1974, 2, { compiled_on_t::day, 0, 9 }, 0, 0, false, 0, "CST" },
+		{ 1982, 1982, 12, { compiled_on_t::day, 0, 18 }, 0, 0, true, 3600, "CDT" },
+		{ 1983, 1983, 2, { compiled_on_t::day, 0, 12 }, 0, 0, false, 0, "CST" },
+		{ 1917, 1917, 4, { compiled_on_t::day, 0, 5 }, 86400, 0, true, 3600, "" },
+		{ 1917, 1917, 9, { compiled_on_t::day, 0, 30 }, 86400, 0, false, 0, "" },
+		{ 1918, 1918, 4, { compiled_on_t::day, 0, 13 }, 86400, 0, true, 3600, "" },
+		{ 1918, 1918, 9, { compiled_on_t::day, 0, 15 }, 86400, 0, false, 0, "S" },
+		{ 1942, 1942, 1, { compiled_on_t::day, 0, 11 }, 7200, 0, true, 3600, "D" },
+		{ 1942, 1942, 10, { compiled_on_t::day, 0, 18 }, 7200, 0, false, 0, "S" },
+		{ 1943, 1943, 3, { compiled_on_t::day, 0, 21 }, 7200, 0, true, 3600, "D" },
+		{ 1943, 1943, 10, { compiled_on_t::day, 0, 31 }, 7200, 0, false, 0, "S" },
+		{ 1944, 1945, 3, { compiled_on_t::weekday_ge, 0, 8 }, 7200, 0, true, 3600, "D" },
+		{ 1944, 1945, 11, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 0, false, 0, "S" },
+		{ 1947, 1947, 5, { compiled_on_t::weekday_ge, 0, 15 }, 7200, 0, true, 3600, "D" },
+		{ 1947, 1947, 9, { compiled_on_t::weekday_ge, 0, 8 }, 7200, 0, false, 0, "S" },
+		{ 1948, 1952, 5, { compiled_on_t::weekday_ge, 0, 22 }, 7200, 0, true, 3600, "D" },
+		{ 1948, 1952, 9, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 0, false, 0, "S" },
+		{ 1956, 1956, 5, { compiled_on_t::weekday_ge, 0, 22 }, 7200, 0, true, 3600, "D" },
+		{ 1956, 1956, 10, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1918, 1918, 4, { compiled_on_t::day, 0, 14 }, 7200, 0, true, 3600, "D" },
+		{ 1918, 1918, 10, { compiled_on_t::day, 0, 27 }, 7200, 0, false, 0, "S" },
+		{ 1942, 1942, 2, { compiled_on_t::day, 0, 9 }, 7200, 0, true, 3600, "W" },
+		{ 1945, 1945, 8, { compiled_on_t::day, 0, 14 }, 82800, 2, true, 3600, "P" },
+		{ 1945, 1945, 9, { compiled_on_t::day, 0, 30 }, 7200, 0, false, 0, "S" },
+		{ 1974, 1986, 4, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, true, 3600, "D" },
+		{ 1974, 2006, 10, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1987, 2006, 4, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 0, true, 3600, "D" },
+		{ 2007, 32767, 3, { compiled_on_t::weekday_ge, 0, 8 }, 7200, 0, true, 3600, "D" },
+		{ 2007, 32767, 11, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 0, false, 0, "S" },
+		{ 1948, 1948, 3, { compiled_on_t::day, 0, 14 }, 7260, 0, true, 3600, "D" },
+		{ 1949, 1949, 1, { compiled_on_t::day, 0, 1 }, 7200, 0, false, 0, "S" },
+		{ 1950, 1966, 4, { compiled_on_t::last_weekday, 0, 0 }, 3600, 0, true, 3600, "D" },
+		{ 1950, 1961, 9, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1962, 1966, 10, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1941, 1942, 5, { compiled_on_t::weekday_ge, 1, 1 }, 3600, 0, true, 3600, "S" },
+		{ 1941, 1942, 10, { compiled_on_t::weekday_ge, 1, 1 }, 7200, 0, false, 0, "" },
+		{ 1978, 1978, 11, { compiled_on_t::day, 0, 12 }, 0, 0, true, 1800, "" },
+		{ 1979, 1991, 3, { compiled_on_t::weekday_ge, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1979, 1990, 10, { compiled_on_t::last_weekday, 0, 0 }, 0, 0, true, 1800, "" },
+		{ 1986, 1986, 5, { compiled_on_t::day, 0, 4 }, 7200, 0, true, 3600, "D" },
+		{ 1986, 1991, 9, { compiled_on_t::weekday_ge, 0, 11 }, 7200, 0, false, 0, "S" },
+		{ 1987, 1991, 4, { compiled_on_t::weekday_ge, 0, 11 }, 7200, 0, true, 3600, "D" },
+		{ 1992, 1992, 5, { compiled_on_t::day, 0, 3 }, 0, 0, true, 3600, "" },
+		{ 1993, 1993, 2, { compiled_on_t::day, 0, 6 }, 86400, 0, false, 0, "" },
+		{ 1979, 1980, 2, { compiled_on_t::last_weekday, 0, 0 }, 0, 0, true, 3600, "D" },
+		{ 1979, 1980, 6, { compiled_on_t::weekday_ge, 0, 1 }, 0, 0, false, 0, "S" },
+		{ 1991, 1992, 1, { compiled_on_t::weekday_ge, 6, 15 }, 0, 0, true, 3600, "D" },
+		{ 1991, 1991, 7, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "S" },
+		{ 1992, 1992, 3, { compiled_on_t::day, 0, 15 }, 0, 0, false, 0, "S" },
+		{ 1975, 1975, 4, { compiled_on_t::day, 0, 13 }, 0, 0, true, 3600, "S" },
+		{ 1975, 1975, 10, { compiled_on_t::day, 0, 12 }, 0, 0, false, 0, "" },
+		{ 1976, 1976, 5, { compiled_on_t::day, 0, 15 }, 0, 0, true, 3600, "S" },
+		{ 1976, 1976, 10, { compiled_on_t::day, 0, 11 }, 0, 0, false, 0, "" },
+		{ 1977, 1980, 4, { compiled_on_t::weekday_ge, 0, 1 }, 0, 0, true, 3600, "S" },
+		{ 1977, 1977, 9, { compiled_on_t::day, 0, 25 }, 0, 0, false, 0, "" },
+		{ 1978, 1978, 10, { compiled_on_t::day, 0, 2 }, 0, 0, false, 0, "" },
+		{ 1979, 1997, 9, { compiled_on_t::last_weekday, 0, 0 }, 0, 0, false, 0, "" },
+		{ 1981, 1998, 3, { compiled_on_t::last_weekday, 0, 0 }, 0, 0, true, 3600, "S" },
+		{ 1945, 1945, 4, { compiled_on_t::weekday_ge, 1, 1 }, 7200, 1, true, 3600, "S" },
+		{ 1945, 1945, 10, { compiled_on_t::day, 0, 1 }, 7200, 1, false, 0, "" },
+		{ 1946, 1946, 5, { compiled_on_t::day, 0, 6 }, 7200, 1, true, 3600, "S" },
+		{ 1946, 1949, 10, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 1, false, 0, "" },
+		{ 1947, 1948, 4, { compiled_on_t::weekday_ge, 0, 15 }, 7200, 1, true, 3600, "S" },
+		{ 1949, 1949, 4, { compiled_on_t::day, 0, 9 }, 7200, 1, true, 3600, "S" },
+		{ 1920, 1920, 6, { compiled_on_t::day, 0, 13 }, 7200, 0, true, 3600, "D" },
+		{ 1920, 1921, 10, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1921, 1921, 3, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, true, 3600, "D" },
+		{ 1922, 1966, 4, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, true, 3600, "D" },
+		{ 1922, 1954, 9, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1955, 1966, 10, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1946, 1946, 4, { compiled_on_t::day, 0, 14 }, 7200, 1, true, 3600, "S" },
+		{ 1946, 1946, 10, { compiled_on_t::day, 0, 7 }, 7200, 1, false, 0, "" },
+		{ 1947, 1949, 10, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 1, false, 0, "" },
+		{ 1947, 1947, 4, { compiled_on_t::day, 0, 6 }, 10800, 1, true, 3600, "S" },
+		{ 1947, 1947, 5, { compiled_on_t::day, 0, 11 }, 7200, 1, true, 7200, "M" },
+		{ 1947, 1947, 6, { compiled_on_t::day, 0, 29 }, 10800, 0, true, 3600, "S" },
+		{ 1948, 1948, 4, { compiled_on_t::day, 0, 18 }, 7200, 1, true, 3600, "S" },
+		{ 1949, 1949, 4, { compiled_on_t::day, 0, 10 }, 7200, 1, true, 3600, "S" },
+		{ 1966, 1966, 10, { compiled_on_t::day, 0, 30 }, 0, 0, true, 3600, "EDT" },
+		{ 1967, 1967, 2, { compiled_on_t::day, 0, 28 }, 0, 0, false, 0, "EST" },
+		{ 1969, 1973, 10, { compiled_on_t::last_weekday, 0, 0 }, 0, 0, true, 1800, "-0430" },
+		{ 1970, 1970, 2, { compiled_on_t::day, 0, 21 }, 0, 0, false, 0, "EST" },
+		{ 1971, 1971, 1, { compiled_on_t::day, 0, 20 }, 0, 0, false, 0, "EST" },
+		{ 1972, 1974, 1, { compiled_on_t::day, 0, 21 }, 0, 0, false, 0, "EST" },
+		{ 1920, 1921, 3, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, true, 3600, "D" },
+		{ 1920, 1920, 10, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1921, 1921, 5, { compiled_on_t::day, 0, 22 }, 7200, 0, false, 0, "S" },
+		{ 1965, 1966, 4, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, true, 3600, "D" },
+		{ 1965, 1966, 10, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1948, 1948, 4, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, true, 3600, "D" },
+		{ 1948, 1948, 9, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1977, 1980, 4, { compiled_on_t::weekday_ge, 0, 1 }, 3600, 2, true, 3600, "S" },
+		{ 1977, 1977, 9, { compiled_on_t::last_weekday, 0, 0 }, 3600, 2, false, 0, "" },
+		{ 1978, 1978, 10, { compiled_on_t::day, 0, 1 }, 3600, 2, false, 0, "" },
+		{ 1979, 1995, 9, { compiled_on_t::last_weekday, 0, 0 }, 3600, 2, false, 0, "" },
+		{ 1981, 32767, 3, { compiled_on_t::last_weekday, 0, 0 }, 3600, 2, true, 3600, "S" },
+		{ 1996, 32767, 10, { compiled_on_t::last_weekday, 0, 0 }, 3600, 2, false, 0, "" },
+		{ 1992, 1992, 11, { compiled_on_t::day, 0, 28 }, 0, 0, true, 3600, "" },
+		{ 1993, 1993, 2, { compiled_on_t::day, 0, 5 }, 0, 0, false, 0, "" },
+		{ 1918, 1919, 4, { compiled_on_t::weekday_ge, 0, 8 }, 7200, 0, true, 3600, "D" },
+		{ 1918, 1918, 10, { compiled_on_t::day, 0, 27 }, 7200, 0, false, 0, "S" },
+		{ 1919, 1919, 5, { compiled_on_t::day, 0, 27 }, 7200, 0, false, 0, "S" },
+		{ 1920, 1923, 4, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, true, 3600, "D" },
+		{ 1920, 1920, 10, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1921, 1923, 9, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1942, 1942, 2, { compiled_on_t::day, 0, 9 }, 7200, 0, true, 3600, "W" },
+		{ 1945, 1945, 8, { compiled_on_t::day, 0, 14 }, 82800, 2, true, 3600, "P" },
+		{ 1945, 1945, 9, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1947, 1947, 4, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, true, 3600, "D" },
+		{ 1947, 1947, 9, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1972, 1986, 4, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, true, 3600, "D" },
+		{ 1972, 2006, 10, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1916, 1916, 6, { compiled_on_t::day, 0, 14 }, 82800, 1, true, 3600, "S" },
+		{ 1916, 1919, 10, { compiled_on_t::weekday_ge, 0, 1 }, 82800, 1, false, 0, "" },
+		{ 1917, 1917, 3, { compiled_on_t::day, 0, 24 }, 82800, 1, true, 3600, "S" },
+		{ 1918, 1918, 3, { compiled_on_t::day, 0, 9 }, 82800, 1, true, 3600, "S" },
+		{ 1919, 1919, 3, { compiled_on_t::day, 0, 1 }, 82800, 1, true, 3600, "S" },
+		{ 1920, 1920, 2, { compiled_on_t::day, 0, 14 }, 82800, 1, true, 3600, "S" },
+		{ 1920, 1920, 10, { compiled_on_t::day, 0, 23 }, 82800, 1, false, 0, "" },
+		{ 1921, 1921, 3, { compiled_on_t::day, 0, 14 }, 82800, 1, true, 3600, "S" },
+		{ 1921, 1921, 10, { compiled_on_t::day, 0, 25 }, 82800, 1, false, 0, "" },
+		{ 1922, 1922, 3, { compiled_on_t::day, 0, 25 }, 82800, 1, true, 3600, "S" },
+		{ 1922, 1938, 10, { compiled_on_t::weekday_ge, 6, 1 }, 82800, 1, false, 0, "" },
+		{ 1923, 1923, 5, { compiled_on_t::day, 0, 26 }, 82800, 1, true, 3600, "S" },
+		{ 1924, 1924, 3, { compiled_on_t::day, 0, 29 }, 82800, 1, true, 3600, "S" },
+		{ 1925, 1925, 4, { compiled_on_t::day, 0, 4 }, 82800, 1, true, 3600, "S" },
+		{ 1926, 1926, 4, { compiled_on_t::day, 0, 17 }, 82800, 1, true, 3600, "S" },
+		{ 1927, 1927, 4, { compiled_on_t::day, 0, 9 }, 82800, 1, true, 3600, "S" },
+		{ 1928, 1928, 4, { compiled_on_t::day, 0, 14 }, 82800, 1, true, 3600, "S" },
+		{ 1929, 1929, 4, { compiled_on_t::day, 0, 20 }, 82800, 1, true, 3600, "S" },
+		{ 1930, 1930, 4, { compiled_on_t::day, 0, 12 }, 82800, 1, true, 3600, "S" },
+		{ 1931, 1931, 4, { compiled_on_t::day, 0, 18 }, 82800, 1, true, 3600, "S" },
+		{ 1932, 1932, 4, { compiled_on_t::day, 0, 2 }, 82800, 1, true, 3600, "S" },
+		{ 1933, 1933, 3, { compiled_on_t::day, 0, 25 }, 82800, 1, true, 3600, "S" },
+		{ 1934, 1934, 4, { compiled_on_t::day, 0, 7 }, 82800, 1, true, 3600, "S" },
+		{ 1935, 1935, 3, { compiled_on_t::day, 0, 30 }, 82800, 1, true, 3600, "S" },
+		{ 1936, 1936, 4, { compiled_on_t::day, 0, 18 }, 82800, 1, true, 3600, "S" },
+		{ 1937, 1937, 4, { compiled_on_t::day, 0, 3 }, 82800, 1, true, 3600, "S" },
+		{ 1938, 1938, 3, { compiled_on_t::day, 0, 26 }, 82800, 1, true, 3600, "S" },
+		{ 1939, 1939, 4, { compiled_on_t::day, 0, 15 }, 82800, 1, true, 3600, "S" },
+		{ 1939, 1939, 11, { compiled_on_t::day, 0, 18 }, 82800, 1, false, 0, "" },
+		{ 1940, 1940, 2, { compiled_on_t::day, 0, 25 }, 7200, 0, true, 3600, "S" },
+		{ 1941, 1941, 5, { compiled_on_t::day, 0, 5 }, 0, 0, true, 7200, "M" },
+		{ 1941, 1941, 10, { compiled_on_t::day, 0, 6 }, 0, 0, true, 3600, "S" },
+		{ 1942, 1942, 3, { compiled_on_t::day, 0, 9 }, 0, 0, true, 7200, "M" },
+		{ 1942, 1942, 11, { compiled_on_t::day, 0, 2 }, 10800, 0, true, 3600, "S" },
+		{ 1943, 1943, 3, { compiled_on_t::day, 0, 29 }, 7200, 0, true, 7200, "M" },
+		{ 1943, 1943, 10, { compiled_on_t::day, 0, 4 }, 10800, 0, true, 3600, "S" },
+		{ 1944, 1944, 4, { compiled_on_t::day, 0, 3 }, 7200, 0, true, 7200, "M" },
+		{ 1944, 1944, 10, { compiled_on_t::day, 0, 8 }, 3600, 0, true, 3600, "S" },
+		{ 1945, 1945, 4, { compiled_on_t::day, 0, 2 }, 7200, 0, true, 7200, "M" },
+		{ 1945, 1945, 9, { compiled_on_t::day, 0, 16 }, 10800, 0, false, 0, "" },
+		{ 1976, 1976, 3, { compiled_on_t::day, 0, 28 }, 3600, 0, true, 3600, "S" },
+		{ 1976, 1976, 9, { compiled_on_t::day, 0, 26 }, 3600, 0, false, 0, "" },
+		{ 1942, 1942, 4, { compiled_on_t::day, 0, 2 }, 86400, 0, true, 3600, "S" },
+		{ 1942, 1942, 10, { compiled_on_t::day, 0, 4 }, 3600, 0, false, 0, "" },
+		{ 1981, 1982, 3, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, true, 3600, "S" },
+		{ 1981, 1982, 9, { compiled_on_t::last_weekday, 0, 0 }, 10800, 0, false, 0, "" },
+		{ 1998, 1999, 11, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 0, true, 3600, "" },
+		{ 1999, 2000, 2, { compiled_on_t::last_weekday, 0, 0 }, 10800, 0, false, 0, "" },
+		{ 2009, 2009, 11, { compiled_on_t::day, 0, 29 }, 7200, 0, true, 3600, "" },
+		{ 2010, 2010, 3, { compiled_on_t::last_weekday, 0, 0 }, 10800, 0, false, 0, "" },
+		{ 2010, 2013, 10, { compiled_on_t::weekday_ge, 0, 21 }, 7200, 0, true, 3600, "" },
+		{ 2011, 2011, 3, { compiled_on_t::weekday_ge, 0, 1 }, 10800, 0, false, 0, "" },
+		{ 2012, 2013, 1, { compiled_on_t::weekday_ge, 0, 18 }, 10800, 0, false, 0, "" },
+		{ 2014, 2014, 1, { compiled_on_t::weekday_ge, 0, 18 }, 7200, 0, false, 0, "" },
+		{ 2014, 2018, 11, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 0, true, 3600, "" },
+		{ 2015, 2021, 1, { compiled_on_t::weekday_ge, 0, 12 }, 10800, 0, false, 0, "" },
+		{ 2019, 2019, 11, { compiled_on_t::weekday_ge, 0, 8 }, 7200, 0, true, 3600, "" },
+		{ 2020, 2020, 12, { compiled_on_t::day, 0, 20 }, 7200, 0, true, 3600, "" },
+		{ 1937, 1938, 9, { compiled_on_t::last_weekday, 0, 0 }, 0, 0, true, 3600, "" },
+		{ 1938, 1942, 3, { compiled_on_t::weekday_ge, 0, 19 }, 0, 0, false, 0, "" },
+		{ 1939, 1939, 10, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "" },
+		{ 1940, 1942, 9, { compiled_on_t::last_weekday, 0, 0 }, 0, 0, true, 3600, "" },
+		{ 1943, 1943, 1, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1983, 1983, 9, { compiled_on_t::last_weekday, 0, 0 }, 0, 0, true, 3600, "" },
+		{ 1984, 1985, 4, { compiled_on_t::last_weekday, 0, 0 }, 0, 0, false, 0, "" },
+		{ 1984, 1984, 9, { compiled_on_t::day, 0, 16 }, 0, 0, true, 3600, "" },
+		{ 1985, 2000, 9, { compiled_on_t::weekday_ge, 0, 9 }, 0, 0, true, 3600, "" },
+		{ 1986, 2000, 4, { compiled_on_t::weekday_ge, 0, 16 }, 0, 0, false, 0, "" },
+		{ 2001, 2010, 4, { compiled_on_t::weekday_ge, 0, 15 }, 7200, 0, false, 0, "" },
+		{ 2001, 2010, 9, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 0, true, 3600, "" },
+		{ 1916, 1916, 5, { compiled_on_t::day, 0, 21 }, 7200, 1, true, 3600, "BST" },
+		{ 1916, 1916, 10, { compiled_on_t::day, 0, 1 }, 7200, 1, false, 0, "GMT" },
+		{ 1917, 1917, 4, { compiled_on_t::day, 0, 8 }, 7200, 1, true, 3600, "BST" },
+		{ 1917, 1917, 9, { compiled_on_t::day, 0, 17 }, 7200, 1, false, 0, "GMT" },
+		{ 1918, 1918, 3, { compiled_on_t::day, 0, 24 }, 7200, 1, true, 3600, "BST" },
+		{ 1918, 1918, 9, { compiled_on_t::day, 0, 30 }, 7200, 1, false, 0, "GMT" },
+		{ 1919, 1919, 3, { compiled_on_t::day, 0, 30 }, 7200, 1, true, 3600, "BST" },
+		{ 1919, 1919, 9, { compiled_on_t::day, 0, 29 }, 7200, 1, false, 0, "GMT" },
+		{ 1920, 1920, 3, { compiled_on_t::day, 0, 28 }, 7200, 1, true, 3600, "BST" },
+		{ 1920, 1920, 10, { compiled_on_t::day, 0, 25 }, 7200, 1, false, 0, "GMT" },
+		{ 1921, 1921, 4, { compiled_on_t::day, 0, 3 }, 7200, 1, true, 3600, "BST" },
+		{ 1921, 1921, 10, { compiled_on_t::day, 0, 3 }, 7200, 1, false, 0, "GMT" },
+		{ 1922, 1922, 3, { compiled_on_t::day, 0, 26 }, 7200, 1, true, 3600, "BST" },
+		{ 1922, 1922, 10, { compiled_on_t::day, 0, 8 }, 7200, 1, false, 0, "GMT" },
+		{ 1923, 1923, 4, { compiled_on_t::weekday_ge, 0, 16 }, 7200, 1, true, 3600, "BST" },
+		{ 1923, 1924, 9, { compiled_on_t::weekday_ge, 0, 16 }, 7200, 1, false, 0, "GMT" },
+		{ 1924, 1924, 4, { compiled_on_t::weekday_ge, 0, 9 }, 7200, 1, true, 3600, "BST" },
+		{ 1925, 1926, 4, { compiled_on_t::weekday_ge, 0, 16 }, 7200, 1, true, 3600, "BST" },
+		{ 1925, 1938, 10, { compiled_on_t::weekday_ge, 0, 2 }, 7200, 1, false, 0, "GMT" },
+		{ 1927, 1927, 4, { compiled_on_t::weekday_ge, 0, 9 }, 7200, 1, true, 3600, "BST" },
+		{ 1928, 1929, 4, { compiled_on_t::weekday_ge, 0, 16 }, 7200, 1, true, 3600, "BST" },
+		{ 1930, 1930, 4, { compiled_on_t::weekday_ge, 0, 9 }, 7200, 1, true, 3600, "BST" },
+		{ 1931, 1932, 4, { compiled_on_t::weekday_ge, 0, 16 }, 7200, 1, true, 3600, "BST" },
+		{ 1933, 1933, 4, { compiled_on_t::weekday_ge, 0, 9 }, 7200, 1, true, 3600, "BST" },
+		{ 1934, 1934, 4, { compiled_on_t::weekday_ge, 0, 16 }, 7200, 1, true, 3600, "BST" },
+		{ 1935, 1935, 4, { compiled_on_t::weekday_ge, 0, 9 }, 7200, 1, true, 3600, "BST" },
+		{ 1936, 1937, 4, { compiled_on_t::weekday_ge, 0, 16 }, 7200, 1, true, 3600, "BST" },
+		{ 1938, 1938, 4, { compiled_on_t::weekday_ge, 0, 9 }, 7200, 1, true, 3600, "BST" },
+		{ 1939, 1939, 4, { compiled_on_t::weekday_ge, 0, 16 }, 7200, 1, true, 3600, "BST" },
+		{ 1939, 1939, 11, { compiled_on_t::weekday_ge, 0, 16 }, 7200, 1, false, 0, "GMT" },
+		{ 1940, 1940, 2, { compiled_on_t::weekday_ge, 0, 23 }, 7200, 1, true, 3600, "BST" },
+		{ 1941, 1941, 5, { compiled_on_t::weekday_ge, 0, 2 }, 3600, 1, true, 7200, "BDST" },
+		{ 1941, 1943, 8, { compiled_on_t::weekday_ge, 0, 9 }, 3600, 1, true, 3600, "BST" },
+		{ 1942, 1944, 4, { compiled_on_t::weekday_ge, 0, 2 }, 3600, 1, true, 7200, "BDST" },
+		{ 1944, 1944, 9, { compiled_on_t::weekday_ge, 0, 16 }, 3600, 1, true, 3600, "BST" },
+		{ 1945, 1945, 4, { compiled_on_t::weekday_ge, 1, 2 }, 3600, 1, true, 7200, "BDST" },
+		{ 1945, 1945, 7, { compiled_on_t::weekday_ge, 0, 9 }, 3600, 1, true, 3600, "BST" },
+		{ 1945, 1946, 10, { compiled_on_t::weekday_ge, 0, 2 }, 7200, 1, false, 0, "GMT" },
+		{ 1946, 1946, 4, { compiled_on_t::weekday_ge, 0, 9 }, 7200, 1, true, 3600, "BST" },
+		{ 1947, 1947, 3, { compiled_on_t::day, 0, 16 }, 7200, 1, true, 3600, "BST" },
+		{ 1947, 1947, 4, { compiled_on_t::day, 0, 13 }, 3600, 1, true, 7200, "BDST" },
+		{ 1947, 1947, 8, { compiled_on_t::day, 0, 10 }, 3600, 1, true, 3600, "BST" },
+		{ 1947, 1947, 11, { compiled_on_t::day, 0, 2 }, 7200, 1, false, 0, "GMT" },
+		{ 1948, 1948, 3, { compiled_on_t::day, 0, 14 }, 7200, 1, true, 3600, "BST" },
+		{ 1948, 1948, 10, { compiled_on_t::day, 0, 31 }, 7200, 1, false, 0, "GMT" },
+		{ 1949, 1949, 4, { compiled_on_t::day, 0, 3 }, 7200, 1, true, 3600, "BST" },
+		{ 1949, 1949, 10, { compiled_on_t::day, 0, 30 }, 7200, 1, false, 0, "GMT" },
+		{ 1950, 1952, 4, { compiled_on_t::weekday_ge, 0, 14 }, 7200, 1, true, 3600, "BST" },
+		{ 1950, 1952, 10, { compiled_on_t::weekday_ge, 0, 21 }, 7200, 1, false, 0, "GMT" },
+		{ 1953, 1953, 4, { compiled_on_t::weekday_ge, 0, 16 }, 7200, 1, true, 3600, "BST" },
+		{ 1953, 1960, 10, { compiled_on_t::weekday_ge, 0, 2 }, 7200, 1, false, 0, "GMT" },
+		{ 1954, 1954, 4, { compiled_on_t::weekday_ge, 0, 9 }, 7200, 1, true, 3600, "BST" },
+		{ 1955, 1956, 4, { compiled_on_t::weekday_ge, 0, 16 }, 7200, 1, true, 3600, "BST" },
+		{ 1957, 1957, 4, { compiled_on_t::weekday_ge, 0, 9 }, 7200, 1, true, 3600, "BST" },
+		{ 1958, 1959, 4, { compiled_on_t::weekday_ge, 0, 16 }, 7200, 1, true, 3600, "BST" },
+		{ 1960, 1960, 4, { compiled_on_t::weekday_ge, 0, 9 }, 7200, 1, true, 3600, "BST" },
+		{ 1961, 1963, 3, { compiled_on_t::last_weekday, 0, 0 }, 7200, 1, true, 3600, "BST" },
+		{ 1961, 1968, 10, { compiled_on_t::weekday_ge, 0, 23 }, 7200, 1, false, 0, "GMT" },
+		{ 1964, 1967, 3, { compiled_on_t::weekday_ge, 0, 19 }, 7200, 1, true, 3600, "BST" },
+		{ 1968, 1968, 2, { compiled_on_t::day, 0, 18 }, 7200, 1, true, 3600, "BST" },
+		{ 1972, 1980, 3, { compiled_on_t::weekday_ge, 0, 16 }, 7200, 1, true, 3600, "BST" },
+		{ 1972, 1980, 10, { compiled_on_t::weekday_ge, 0, 23 }, 7200, 1, false, 0, "GMT" },
+		{ 1981, 1995, 3, { compiled_on_t::last_weekday, 0, 0 }, 3600, 2, true, 3600, "BST" },
+		{ 1981, 1989, 10, { compiled_on_t::weekday_ge, 0, 23 }, 3600, 2, false, 0, "GMT" },
+		{ 1990, 1995, 10, { compiled_on_t::weekday_ge, 0, 22 }, 3600, 2, false, 0, "GMT" },
+		{ 1973, 1973, 11, { compiled_on_t::day, 0, 25 }, 0, 0, true, 3600, "D" },
+		{ 1974, 1974, 2, { compiled_on_t::day, 0, 24 }, 0, 0, false, 0, "S" },
+		{ 1983, 1983, 5, { compiled_on_t::day, 0, 21 }, 0, 0, true, 3600, "D" },
+		{ 1983, 1983, 9, { compiled_on_t::day, 0, 22 }, 0, 0, false, 0, "S" },
+		{ 1991, 1991, 3, { compiled_on_t::day, 0, 23 }, 0, 0, true, 3600, "D" },
+		{ 1991, 1991, 9, { compiled_on_t::day, 0, 7 }, 0, 0, false, 0, "S" },
+		{ 2006, 2006, 4, { compiled_on_t::day, 0, 30 }, 0, 0, true, 3600, "D" },
+		{ 2006, 2006, 10, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "S" },
+		{ 1959, 1959, 6, { compiled_on_t::day, 0, 27 }, 7200, 0, true, 3600, "D" },
+		{ 1961, 1961, 1, { compiled_on_t::day, 0, 29 }, 7200, 0, false, 0, "S" },
+		{ 1967, 1967, 9, { compiled_on_t::day, 0, 1 }, 7200, 0, true, 3600, "D" },
+		{ 1969, 1969, 1, { compiled_on_t::day, 0, 26 }, 60, 0, false, 0, "S" },
+		{ 1969, 1969, 6, { compiled_on_t::day, 0, 22 }, 7200, 0, true, 3600, "D" },
+		{ 1969, 1969, 8, { compiled_on_t::day, 0, 31 }, 7200, 0, false, 0, "S" },
+		{ 1970, 1971, 4, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, true, 3600, "D" },
+		{ 1970, 1971, 9, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 0, false, 0, "S" },
+		{ 1973, 1973, 12, { compiled_on_t::day, 0, 16 }, 7200, 0, true, 3600, "D" },
+		{ 1974, 1974, 2, { compiled_on_t::day, 0, 24 }, 7200, 0, false, 0, "S" },
+		{ 1976, 1976, 5, { compiled_on_t::day, 0, 26 }, 7200, 0, true, 3600, "D" },
+		{ 1976, 1976, 8, { compiled_on_t::day, 0, 22 }, 7260, 0, false, 0, "S" },
+		{ 1977, 1977, 4, { compiled_on_t::day, 0, 24 }, 7200, 0, true, 3600, "D" },
+		{ 1977, 1977, 8, { compiled_on_t::day, 0, 28 }, 7200, 0, false, 0, "S" },
+		{ 1916, 1916, 4, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "D" },
+		{ 1916, 1916, 10, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "S" },
+		{ 1920, 1920, 5, { compiled_on_t::day, 0, 9 }, 0, 0, true, 3600, "D" },
+		{ 1920, 1920, 8, { compiled_on_t::day, 0, 29 }, 0, 0, false, 0, "S" },
+		{ 1921, 1921, 5, { compiled_on_t::day, 0, 6 }, 0, 0, true, 3600, "D" },
+		{ 1921, 1922, 9, { compiled_on_t::day, 0, 5 }, 0, 0, false, 0, "S" },
+		{ 1922, 1922, 4, { compiled_on_t::day, 0, 30 }, 0, 0, true, 3600, "D" },
+		{ 1923, 1925, 5, { compiled_on_t::weekday_ge, 0, 1 }, 0, 0, true, 3600, "D" },
+		{ 1923, 1923, 9, { compiled_on_t::day, 0, 4 }, 0, 0, false, 0, "S" },
+		{ 1924, 1924, 9, { compiled_on_t::day, 0, 15 }, 0, 0, false, 0, "S" },
+		{ 1925, 1925, 9, { compiled_on_t::day, 0, 28 }, 0, 0, false, 0, "S" },
+		{ 1926, 1926, 5, { compiled_on_t::day, 0, 16 }, 0, 0, true, 3600, "D" },
+		{ 1926, 1926, 9, { compiled_on_t::day, 0, 13 }, 0, 0, false, 0, "S" },
+		{ 1927, 1927, 5, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "D" },
+		{ 1927, 1927, 9, { compiled_on_t::day, 0, 26 }, 0, 0, false, 0, "S" },
+		{ 1928, 1931, 5, { compiled_on_t::weekday_ge, 0, 8 }, 0, 0, true, 3600, "D" },
+		{ 1928, 1928, 9, { compiled_on_t::day, 0, 9 }, 0, 0, false, 0, "S" },
+		{ 1929, 1929, 9, { compiled_on_t::day, 0, 3 }, 0, 0, false, 0, "S" },
+		{ 1930, 1930, 9, { compiled_on_t::day, 0, 15 }, 0, 0, false, 0, "S" },
+		{ 1931, 1932, 9, { compiled_on_t::weekday_ge, 1, 24 }, 0, 0, false, 0, "S" },
+		{ 1932, 1932, 5, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "D" },
+		{ 1933, 1933, 4, { compiled_on_t::day, 0, 30 }, 0, 0, true, 3600, "D" },
+		{ 1933, 1933, 10, { compiled_on_t::day, 0, 2 }, 0, 0, false, 0, "S" },
+		{ 1934, 1934, 5, { compiled_on_t::day, 0, 20 }, 0, 0, true, 3600, "D" },
+		{ 1934, 1934, 9, { compiled_on_t::day, 0, 16 }, 0, 0, false, 0, "S" },
+		{ 1935, 1935, 6, { compiled_on_t::day, 0, 2 }, 0, 0, true, 3600, "D" },
+		{ 1935, 1935, 9, { compiled_on_t::day, 0, 30 }, 0, 0, false, 0, "S" },
+		{ 1936, 1936, 6, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "D" },
+		{ 1936, 1936, 9, { compiled_on_t::day, 0, 14 }, 0, 0, false, 0, "S" },
+		{ 1937, 1938, 5, { compiled_on_t::weekday_ge, 0, 1 }, 0, 0, true, 3600, "D" },
+		{ 1937, 1941, 9, { compiled_on_t::weekday_ge, 1, 24 }, 0, 0, false, 0, "S" },
+		{ 1939, 1939, 5, { compiled_on_t::day, 0, 28 }, 0, 0, true, 3600, "D" },
+		{ 1940, 1941, 5, { compiled_on_t::weekday_ge, 0, 1 }, 0, 0, true, 3600, "D" },
+		{ 1946, 1949, 4, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, true, 3600, "D" },
+		{ 1946, 1949, 9, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1951, 1954, 4, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, true, 3600, "D" },
+		{ 1951, 1954, 9, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1956, 1959, 4, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, true, 3600, "D" },
+		{ 1956, 1959, 9, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1962, 1973, 4, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, true, 3600, "D" },
+		{ 1962, 1973, 10, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1946, 1946, 4, { compiled_on_t::day, 0, 21 }, 0, 0, true, 3600, "S" },
+		{ 1946, 1946, 12, { compiled_on_t::day, 0, 1 }, 12600, 1, false, 0, "" },
+		{ 1947, 1947, 4, { compiled_on_t::day, 0, 13 }, 12600, 1, true, 3600, "S" },
+		{ 1947, 1947, 11, { compiled_on_t::day, 0, 30 }, 12600, 1, false, 0, "" },
+		{ 1948, 1948, 5, { compiled_on_t::day, 0, 2 }, 12600, 1, true, 3600, "S" },
+		{ 1948, 1952, 10, { compiled_on_t::weekday_ge, 0, 28 }, 12600, 1, false, 0, "" },
+		{ 1949, 1953, 4, { compiled_on_t::weekday_ge, 0, 1 }, 12600, 0, true, 3600, "S" },
+		{ 1953, 1964, 10, { compiled_on_t::weekday_ge, 0, 31 }, 12600, 0, false, 0, "" },
+		{ 1954, 1964, 3, { compiled_on_t::weekday_ge, 0, 18 }, 12600, 0, true, 3600, "S" },
+		{ 1965, 1976, 4, { compiled_on_t::weekday_ge, 0, 16 }, 12600, 0, true, 3600, "S" },
+		{ 1965, 1976, 10, { compiled_on_t::weekday_ge, 0, 16 }, 12600, 0, false, 0, "" },
+		{ 1973, 1973, 12, { compiled_on_t::day, 0, 30 }, 12600, 0, true, 3600, "S" },
+		{ 1979, 1979, 5, { compiled_on_t::day, 0, 13 }, 12600, 0, true, 3600, "S" },
+		{ 1979, 1979, 10, { compiled_on_t::day, 0, 21 }, 12600, 0, false, 0, "" },
+		{ 1987, 1988, 5, { compiled_on_t::weekday_ge, 0, 1 }, 0, 0, true, 3600, "D" },
+		{ 1987, 1988, 9, { compiled_on_t::last_weekday, 0, 0 }, 0, 0, false, 0, "S" },
+		{ 2006, 2006, 5, { compiled_on_t::weekday_ge, 0, 1 }, 0, 0, true, 3600, "D" },
+		{ 2006, 2006, 8, { compiled_on_t::weekday_ge, 1, 1 }, 0, 0, false, 0, "S" },
+		{ 1983, 1983, 5, { compiled_on_t::day, 0, 8 }, 0, 0, true, 3600, "D" },
+		{ 1984, 1987, 4, { compiled_on_t::last_weekday, 0, 0 }, 0, 0, true, 3600, "D" },
+		{ 1983, 1987, 10, { compiled_on_t::last_weekday, 0, 0 }, 0, 0, false, 0, "S" },
+		{ 1988, 1997, 4, { compiled_on_t::weekday_ge, 0, 1 }, 3600, 1, true, 3600, "D" },
+		{ 1988, 1997, 10, { compiled_on_t::last_weekday, 0, 0 }, 3600, 1, false, 0, "S" },
+		{ 2005, 2006, 4, { compiled_on_t::weekday_ge, 0, 1 }, 0, 0, true, 3600, "D" },
+		{ 2005, 2006, 10, { compiled_on_t::last_weekday, 0, 0 }, 0, 0, false, 0, "S" },
+		{ 2012, 2015, 3, { compiled_on_t::weekday_ge, 0, 8 }, 7200, 0, true, 3600, "D" },
+		{ 2012, 2015, 11, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 0, false, 0, "S" },
+		{ 2017, 32767, 3, { compiled_on_t::weekday_ge, 0, 8 }, 7200, 0, true, 3600, "D" },
+		{ 2017, 32767, 11, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 0, false, 0, "S" },
+		{ 1992, 1993, 10, { compiled_on_t::last_weekday, 0, 0 }, 7200, 1, true, 3600, "D" },
+		{ 1993, 1994, 3, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 1, false, 0, "S" },
+		{ 1916, 1916, 6, { compiled_on_t::day, 0, 3 }, 86400, 0, true, 3600, "S" },
+		{ 1916, 1917, 9, { compiled_on_t::day, 0, 30 }, 86400, 0, false, 0, "" },
+		{ 1917, 1917, 3, { compiled_on_t::day, 0, 31 }, 86400, 0, true, 3600, "S" },
+		{ 1918, 1918, 3, { compiled_on_t::day, 0, 9 }, 86400, 0, true, 3600, "S" },
+		{ 1918, 1918, 10, { compiled_on_t::day, 0, 6 }, 86400, 0, false, 0, "" },
+		{ 1919, 1919, 3, { compiled_on_t::day, 0, 1 }, 86400, 0, true, 3600, "S" },
+		{ 1919, 1919, 10, { compiled_on_t::day, 0, 4 }, 86400, 0, false, 0, "" },
+		{ 1920, 1920, 3, { compiled_on_t::day, 0, 20 }, 86400, 0, true, 3600, "S" },
+		{ 1920, 1920, 9, { compiled_on_t::day, 0, 18 }, 86400, 0, false, 0, "" },
+		{ 1940, 1940, 6, { compiled_on_t::day, 0, 14 }, 86400, 0, true, 3600, "S" },
+		{ 1942, 1942, 11, { compiled_on_t::day, 0, 2 }, 7200, 1, false, 0, "" },
+		{ 1943, 1943, 3, { compiled_on_t::day, 0, 29 }, 7200, 1, true, 3600, "S" },
+		{ 1943, 1943, 10, { compiled_on_t::day, 0, 4 }, 7200, 1, false, 0, "" },
+		{ 1944, 1944, 4, { compiled_on_t::day, 0, 2 }, 7200, 1, true, 3600, "S" },
+		{ 1944, 1944, 9, { compiled_on_t::day, 0, 17 }, 7200, 1, false, 0, "" },
+		{ 1945, 1945, 4, { compiled_on_t::day, 0, 2 }, 7200, 0, true, 3600, "S" },
+		{ 1945, 1945, 9, { compiled_on_t::day, 0, 15 }, 3600, 0, false, 0, "" },
+		{ 1946, 1946, 3, { compiled_on_t::day, 0, 17 }, 7200, 1, true, 3600, "S" },
+		{ 1946, 1946, 10, { compiled_on_t::day, 0, 6 }, 7200, 1, false, 0, "" },
+		{ 1947, 1947, 3, { compiled_on_t::day, 0, 16 }, 0, 1, true, 3600, "S" },
+		{ 1947, 1947, 10, { compiled_on_t::day, 0, 5 }, 0, 1, false, 0, "" },
+		{ 1948, 1948, 2, { compiled_on_t::day, 0, 29 }, 7200, 1, true, 3600, "S" },
+		{ 1948, 1948, 10, { compiled_on_t::day, 0, 3 }, 7200, 1, false, 0, "" },
+		{ 1966, 1968, 5, { compiled_on_t::weekday_ge, 0, 22 }, 0, 1, true, 3600, "S" },
+		{ 1966, 1966, 9, { compiled_on_t::day, 0, 24 }, 86400, 0, false, 0, "" },
+		{ 1967, 1969, 9, { compiled_on_t::weekday_ge, 0, 22 }, 0, 1, false, 0, "" },
+		{ 1969, 1969, 6, { compiled_on_t::day, 0, 1 }, 0, 1, true, 3600, "S" },
+		{ 1970, 1970, 5, { compiled_on_t::day, 0, 31 }, 0, 1, true, 3600, "S" },
+		{ 1970, 1970, 9, { compiled_on_t::last_weekday, 0, 0 }, 0, 1, false, 0, "" },
+		{ 1971, 1972, 5, { compiled_on_t::weekday_ge, 0, 22 }, 0, 1, true, 3600, "S" },
+		{ 1971, 1971, 9, { compiled_on_t::last_weekday, 0, 0 }, 0, 1, false, 0, "" },
+		{ 1972, 1972, 10, { compiled_on_t::day, 0, 1 }, 0, 1, false, 0, "" },
+		{ 1973, 1973, 6, { compiled_on_t::day, 0, 3 }, 0, 1, true, 3600, "S" },
+		{ 1973, 1974, 9, { compiled_on_t::last_weekday, 0, 0 }, 0, 1, false, 0, "" },
+		{ 1974, 1974, 5, { compiled_on_t::day, 0, 26 }, 0, 1, true, 3600, "S" },
+		{ 1975, 1975, 6, { compiled_on_t::day, 0, 1 }, 0, 1, true, 3600, "S" },
+		{ 1975, 1977, 9, { compiled_on_t::last_weekday, 0, 0 }, 0, 1, false, 0, "" },
+		{ 1976, 1976, 5, { compiled_on_t::day, 0, 30 }, 0, 1, true, 3600, "S" },
+		{ 1977, 1979, 5, { compiled_on_t::weekday_ge, 0, 22 }, 0, 1, true, 3600, "S" },
+		{ 1978, 1978, 10, { compiled_on_t::day, 0, 1 }, 0, 1, false, 0, "" },
+		{ 1979, 1979, 9, { compiled_on_t::day, 0, 30 }, 0, 1, false, 0, "" },
+		{ 1971, 1971, 10, { compiled_on_t::day, 0, 31 }, 7200, 2, true, -3600, "" },
+		{ 1972, 1980, 3, { compiled_on_t::weekday_ge, 0, 16 }, 7200, 2, false, 0, "" },
+		{ 1972, 1980, 10, { compiled_on_t::weekday_ge, 0, 23 }, 7200, 2, true, -3600, "" },
+		{ 1981, 32767, 3, { compiled_on_t::last_weekday, 0, 0 }, 3600, 2, false, 0, "" },
+		{ 1981, 1989, 10, { compiled_on_t::weekday_ge, 0, 23 }, 3600, 2, true, -3600, "" },
+		{ 1990, 1995, 10, { compiled_on_t::weekday_ge, 0, 22 }, 3600, 2, true, -3600, "" },
+		{ 1996, 32767, 10, { compiled_on_t::last_weekday, 0, 0 }, 3600, 2, true, -3600, "" },
+		{ 1982, 1982, 5, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "" },
+		{ 1982, 1984, 10, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1983, 1983, 3, { compiled_on_t::day, 0, 31 }, 0, 0, true, 3600, "" },
+		{ 1984, 1985, 4, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "" },
+		{ 1985, 1990, 9, { compiled_on_t::last_weekday, 0, 0 }, 3600, 1, false, 0, "" },
+		{ 1986, 1990, 3, { compiled_on_t::last_weekday, 0, 0 }, 3600, 1, true, 3600, "" },
+		{ 1991, 2007, 4, { compiled_on_t::day, 0, 1 }, 10800, 1, true, 3600, "" },
+		{ 1991, 2007, 10, { compiled_on_t::day, 0, 1 }, 10800, 1, false, 0, "" },
+		{ 1941, 1941, 6, { compiled_on_t::day, 0, 22 }, 7200, 0, true, 3600, "D" },
+		{ 1941, 1954, 9, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1946, 1954, 4, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, true, 3600, "D" },
+		{ 1973, 1973, 6, { compiled_on_t::day, 0, 6 }, 0, 0, true, 3600, "S" },
+		{ 1973, 1975, 10, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1974, 1977, 5, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "S" },
+		{ 1976, 1976, 11, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1977, 1977, 10, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1978, 1978, 4, { compiled_on_t::day, 0, 30 }, 0, 0, true, 3600, "S" },
+		{ 1978, 1978, 9, { compiled_on_t::day, 0, 30 }, 0, 0, false, 0, "" },
+		{ 1985, 1985, 4, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "S" },
+		{ 1985, 1985, 10, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1986, 1988, 4, { compiled_on_t::weekday_ge, 5, 1 }, 0, 0, true, 3600, "S" },
+		{ 1986, 1990, 10, { compiled_on_t::weekday_ge, 5, 1 }, 0, 0, false, 0, "" },
+		{ 1989, 1989, 5, { compiled_on_t::day, 0, 8 }, 0, 0, true, 3600, "S" },
+		{ 1990, 1990, 4, { compiled_on_t::day, 0, 27 }, 0, 0, true, 3600, "S" },
+		{ 1991, 1991, 4, { compiled_on_t::day, 0, 17 }, 0, 0, true, 3600, "S" },
+		{ 1991, 1991, 9, { compiled_on_t::day, 0, 27 }, 0, 0, false, 0, "" },
+		{ 1992, 1992, 4, { compiled_on_t::day, 0, 10 }, 0, 0, true, 3600, "S" },
+		{ 1992, 1993, 10, { compiled_on_t::weekday_ge, 5, 1 }, 0, 0, false, 0, "" },
+		{ 1993, 1998, 4, { compiled_on_t::weekday_ge, 5, 1 }, 0, 0, true, 3600, "S" },
+		{ 1994, 1994, 9, { compiled_on_t::weekday_ge, 5, 15 }, 0, 0, false, 0, "" },
+		{ 1995, 1998, 9, { compiled_on_t::weekday_ge, 5, 15 }, 0, 1, false, 0, "" },
+		{ 1999, 1999, 7, { compiled_on_t::day, 0, 1 }, 0, 1, true, 3600, "S" },
+		{ 1999, 2002, 9, { compiled_on_t::last_weekday, 5, 0 }, 0, 1, false, 0, "" },
+		{ 2000, 2001, 3, { compiled_on_t::last_weekday, 4, 0 }, 0, 1, true, 3600, "S" },
+		{ 2002, 2012, 3, { compiled_on_t::last_weekday, 4, 0 }, 86400, 0, true, 3600, "S" },
+		{ 2003, 2003, 10, { compiled_on_t::day, 0, 24 }, 0, 1, false, 0, "" },
+		{ 2004, 2004, 10, { compiled_on_t::day, 0, 15 }, 0, 1, false, 0, "" },
+		{ 2005, 2005, 9, { compiled_on_t::last_weekday, 5, 0 }, 0, 1, false, 0, "" },
+		{ 2006, 2011, 10, { compiled_on_t::last_weekday, 5, 0 }, 0, 1, false, 0, "" },
+		{ 2013, 2013, 12, { compiled_on_t::day, 0, 20 }, 0, 0, false, 0, "" },
+		{ 2014, 2021, 3, { compiled_on_t::last_weekday, 4, 0 }, 86400, 0, true, 3600, "S" },
+		{ 2014, 2022, 10, { compiled_on_t::last_weekday, 5, 0 }, 0, 1, false, 0, "" },
+		{ 2022, 2022, 2, { compiled_on_t::last_weekday, 4, 0 }, 86400, 0, true, 3600, "S" },
+		{ 1948, 1948, 5, { compiled_on_t::weekday_ge, 6, 1 }, 86400, 0, true, 3600, "D" },
+		{ 1948, 1951, 9, { compiled_on_t::weekday_ge, 6, 8 }, 90000, 0, false, 0, "S" },
+		{ 1949, 1949, 4, { compiled_on_t::weekday_ge, 6, 1 }, 86400, 0, true, 3600, "D" },
+		{ 1950, 1951, 5, { compiled_on_t::weekday_ge, 6, 1 }, 86400, 0, true, 3600, "D" },
+		{ 1940, 1940, 7, { compiled_on_t::day, 0, 15 }, 0, 0, true, 3600, "S" },
+		{ 1940, 1940, 10, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1941, 1941, 4, { compiled_on_t::day, 0, 15 }, 0, 0, true, 3600, "S" },
+		{ 1941, 1941, 9, { compiled_on_t::day, 0, 16 }, 0, 0, false, 0, "" },
+		{ 1942, 1944, 4, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "S" },
+		{ 1942, 1942, 10, { compiled_on_t::day, 0, 27 }, 0, 0, false, 0, "" },
+		{ 1943, 1945, 11, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1945, 1945, 4, { compiled_on_t::day, 0, 16 }, 0, 0, true, 3600, "S" },
+		{ 1957, 1957, 5, { compiled_on_t::day, 0, 10 }, 0, 0, true, 3600, "S" },
+		{ 1957, 1958, 10, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1958, 1958, 5, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "S" },
+		{ 1959, 1981, 5, { compiled_on_t::day, 0, 1 }, 3600, 0, true, 3600, "S" },
+		{ 1959, 1965, 9, { compiled_on_t::day, 0, 30 }, 10800, 0, false, 0, "" },
+		{ 1966, 1994, 10, { compiled_on_t::day, 0, 1 }, 10800, 0, false, 0, "" },
+		{ 1982, 1982, 7, { compiled_on_t::day, 0, 25 }, 3600, 0, true, 3600, "S" },
+		{ 1983, 1983, 7, { compiled_on_t::day, 0, 12 }, 3600, 0, true, 3600, "S" },
+		{ 1984, 1988, 5, { compiled_on_t::day, 0, 1 }, 3600, 0, true, 3600, "S" },
+		{ 1989, 1989, 5, { compiled_on_t::day, 0, 6 }, 3600, 0, true, 3600, "S" },
+		{ 1990, 1994, 5, { compiled_on_t::day, 0, 1 }, 3600, 0, true, 3600, "S" },
+		{ 1995, 2010, 4, { compiled_on_t::last_weekday, 5, 0 }, 0, 1, true, 3600, "S" },
+		{ 1995, 2005, 9, { compiled_on_t::last_weekday, 4, 0 }, 86400, 0, false, 0, "" },
+		{ 2006, 2006, 9, { compiled_on_t::day, 0, 21 }, 86400, 0, false, 0, "" },
+		{ 2007, 2007, 9, { compiled_on_t::weekday_ge, 4, 1 }, 86400, 0, false, 0, "" },
+		{ 2008, 2008, 8, { compiled_on_t::last_weekday, 4, 0 }, 86400, 0, false, 0, "" },
+		{ 2009, 2009, 8, { compiled_on_t::day, 0, 20 }, 86400, 0, false, 0, "" },
+		{ 2010, 2010, 8, { compiled_on_t::day, 0, 10 }, 86400, 0, false, 0, "" },
+		{ 2010, 2010, 9, { compiled_on_t::day, 0, 9 }, 86400, 0, true, 3600, "S" },
+		{ 2010, 2010, 9, { compiled_on_t::last_weekday, 4, 0 }, 86400, 0, false, 0, "" },
+		{ 2014, 2014, 5, { compiled_on_t::day, 0, 15 }, 86400, 0, true, 3600, "S" },
+		{ 2014, 2014, 6, { compiled_on_t::day, 0, 26 }, 86400, 0, false, 0, "" },
+		{ 2014, 2014, 7, { compiled_on_t::day, 0, 31 }, 86400, 0, true, 3600, "S" },
+		{ 2014, 2014, 9, { compiled_on_t::last_weekday, 4, 0 }, 86400, 0, false, 0, "" },
+		{ 2023, 32767, 4, { compiled_on_t::last_weekday, 5, 0 }, 0, 0, true, 3600, "S" },
+		{ 2023, 32767, 10, { compiled_on_t::last_weekday, 4, 0 }, 86400, 0, false, 0, "" },
+		{ 1992, 1996, 4, { compiled_on_t::weekday_ge, 0, 7 }, 0, 1, true, 3600, "" },
+		{ 1992, 1996, 9, { compiled_on_t::last_weekday, 0, 0 }, 0, 0, false, 0, "" },
+		{ 1997, 2005, 3, { compiled_on_t::last_weekday, 0, 0 }, 9000, 0, true, 3600, "" },
+		{ 1997, 2004, 10, { compiled_on_t::last_weekday, 0, 0 }, 9000, 0, false, 0, "" },
+		{ 1948, 1948, 6, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "D" },
+		{ 1948, 1948, 9, { compiled_on_t::day, 0, 12 }, 86400, 0, false, 0, "S" },
+		{ 1949, 1949, 4, { compiled_on_t::day, 0, 3 }, 0, 0, true, 3600, "D" },
+		{ 1949, 1951, 9, { compiled_on_t::weekday_ge, 6, 7 }, 86400, 0, false, 0, "S" },
+		{ 1950, 1950, 4, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "D" },
+		{ 1951, 1951, 5, { compiled_on_t::day, 0, 6 }, 0, 0, true, 3600, "D" },
+		{ 1955, 1955, 5, { compiled_on_t::day, 0, 5 }, 0, 0, true, 3600, "D" },
+		{ 1955, 1955, 9, { compiled_on_t::day, 0, 8 }, 86400, 0, false, 0, "S" },
+		{ 1956, 1956, 5, { compiled_on_t::day, 0, 20 }, 0, 0, true, 3600, "D" },
+		{ 1956, 1956, 9, { compiled_on_t::day, 0, 29 }, 86400, 0, false, 0, "S" },
+		{ 1957, 1960, 5, { compiled_on_t::weekday_ge, 0, 1 }, 0, 0, true, 3600, "D" },
+		{ 1957, 1960, 9, { compiled_on_t::weekday_ge, 6, 17 }, 86400, 0, false, 0, "S" },
+		{ 1987, 1988, 5, { compiled_on_t::weekday_ge, 0, 8 }, 7200, 0, true, 3600, "D" },
+		{ 1987, 1988, 10, { compiled_on_t::weekday_ge, 0, 8 }, 10800, 0, false, 0, "S" },
+		{ 1951, 1951, 10, { compiled_on_t::day, 0, 14 }, 7200, 0, true, 3600, "S" },
+		{ 1952, 1952, 1, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1953, 1953, 10, { compiled_on_t::day, 0, 9 }, 7200, 0, true, 3600, "S" },
+		{ 1954, 1954, 1, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1955, 1955, 9, { compiled_on_t::day, 0, 30 }, 0, 0, true, 3600, "S" },
+		{ 1956, 1956, 1, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1982, 1984, 4, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "S" },
+		{ 1982, 1985, 10, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1985, 1985, 4, { compiled_on_t::day, 0, 6 }, 0, 0, true, 3600, "S" },
+		{ 1986, 1986, 4, { compiled_on_t::day, 0, 4 }, 0, 0, true, 3600, "S" },
+		{ 1986, 1986, 10, { compiled_on_t::day, 0, 3 }, 0, 0, false, 0, "" },
+		{ 1987, 1989, 4, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "S" },
+		{ 1987, 1989, 10, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1997, 1997, 4, { compiled_on_t::day, 0, 4 }, 0, 0, true, 3600, "S" },
+		{ 1997, 1997, 10, { compiled_on_t::day, 0, 4 }, 0, 0, false, 0, "" },
+		{ 2013, 2013, 3, { compiled_on_t::last_weekday, 5, 0 }, 3600, 0, true, 3600, "S" },
+		{ 2013, 2013, 10, { compiled_on_t::last_weekday, 5, 0 }, 7200, 0, false, 0, "" },
+		{ 1981, 1984, 10, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, true, 3600, "" },
+		{ 1982, 1985, 3, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 0, false, 0, "" },
+		{ 1985, 1985, 10, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, true, 1800, "" },
+		{ 1986, 1989, 3, { compiled_on_t::weekday_ge, 0, 15 }, 7200, 0, false, 0, "" },
+		{ 1986, 1986, 10, { compiled_on_t::day, 0, 19 }, 7200, 0, true, 1800, "" },
+		{ 1987, 1999, 10, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, true, 1800, "" },
+		{ 1990, 1995, 3, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 0, false, 0, "" },
+		{ 1996, 2005, 3, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "" },
+		{ 2000, 2000, 8, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, true, 1800, "" },
+		{ 2001, 2007, 10, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, true, 1800, "" },
+		{ 2006, 2006, 4, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 0, false, 0, "" },
+		{ 2007, 2007, 3, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "" },
+		{ 2008, 32767, 4, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 0, false, 0, "" },
+		{ 2008, 32767, 10, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 0, true, 1800, "" },
+		{ 1989, 1996, 3, { compiled_on_t::last_weekday, 0, 0 }, 7200, 1, true, 3600, "S" },
+		{ 1989, 1996, 9, { compiled_on_t::last_weekday, 0, 0 }, 7200, 1, false, 0, "" },
+		{ 1939, 1939, 9, { compiled_on_t::day, 0, 12 }, 0, 0, true, 3600, "" },
+		{ 1939, 1939, 11, { compiled_on_t::day, 0, 19 }, 0, 0, false, 0, "" },
+		{ 1940, 1940, 2, { compiled_on_t::day, 0, 25 }, 0, 0, true, 3600, "" },
+		{ 1945, 1945, 11, { compiled_on_t::day, 0, 18 }, 0, 0, false, 0, "" },
+		{ 1950, 1950, 6, { compiled_on_t::day, 0, 11 }, 0, 0, true, 3600, "" },
+		{ 1950, 1950, 10, { compiled_on_t::day, 0, 29 }, 0, 0, false, 0, "" },
+		{ 1967, 1967, 6, { compiled_on_t::day, 0, 3 }, 43200, 0, true, 3600, "" },
+		{ 1967, 1967, 10, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1974, 1974, 6, { compiled_on_t::day, 0, 24 }, 0, 0, true, 3600, "" },
+		{ 1974, 1974, 9, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1976, 1977, 5, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "" },
+		{ 1976, 1976, 8, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1977, 1977, 9, { compiled_on_t::day, 0, 28 }, 0, 0, false, 0, "" },
+		{ 1978, 1978, 6, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "" },
+		{ 1978, 1978, 8, { compiled_on_t::day, 0, 4 }, 0, 0, false, 0, "" },
+		{ 2008, 2008, 6, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "" },
+		{ 2008, 2008, 9, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 2009, 2009, 6, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "" },
+		{ 2009, 2009, 8, { compiled_on_t::day, 0, 21 }, 0, 0, false, 0, "" },
+		{ 2010, 2010, 5, { compiled_on_t::day, 0, 2 }, 0, 0, true, 3600, "" },
+		{ 2010, 2010, 8, { compiled_on_t::day, 0, 8 }, 0, 0, false, 0, "" },
+		{ 2011, 2011, 4, { compiled_on_t::day, 0, 3 }, 0, 0, true, 3600, "" },
+		{ 2011, 2011, 7, { compiled_on_t::day, 0, 31 }, 0, 0, false, 0, "" },
+		{ 2012, 2013, 4, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, true, 3600, "" },
+		{ 2012, 2012, 7, { compiled_on_t::day, 0, 20 }, 10800, 0, false, 0, "" },
+		{ 2012, 2012, 8, { compiled_on_t::day, 0, 20 }, 7200, 0, true, 3600, "" },
+		{ 2012, 2012, 9, { compiled_on_t::day, 0, 30 }, 10800, 0, false, 0, "" },
+		{ 2013, 2013, 7, { compiled_on_t::day, 0, 7 }, 10800, 0, false, 0, "" },
+		{ 2013, 2013, 8, { compiled_on_t::day, 0, 10 }, 7200, 0, true, 3600, "" },
+		{ 2013, 2018, 10, { compiled_on_t::last_weekday, 0, 0 }, 10800, 0, false, 0, "" },
+		{ 2014, 2018, 3, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, true, 3600, "" },
+		{ 2014, 2014, 6, { compiled_on_t::day, 0, 28 }, 10800, 0, false, 0, "" },
+		{ 2014, 2014, 8, { compiled_on_t::day, 0, 2 }, 7200, 0, true, 3600, "" },
+		{ 2015, 2015, 6, { compiled_on_t::day, 0, 14 }, 10800, 0, false, 0, "" },
+		{ 2015, 2015, 7, { compiled_on_t::day, 0, 19 }, 7200, 0, true, 3600, "" },
+		{ 2016, 2016, 6, { compiled_on_t::day, 0, 5 }, 10800, 0, false, 0, "" },
+		{ 2016, 2016, 7, { compiled_on_t::day, 0, 10 }, 7200, 0, true, 3600, "" },
+		{ 2017, 2017, 5, { compiled_on_t::day, 0, 21 }, 10800, 0, false, 0, "" },
+		{ 2017, 2017, 7, { compiled_on_t::day, 0, 2 }, 7200, 0, true, 3600, "" },
+		{ 2018, 2018, 5, { compiled_on_t::day, 0, 13 }, 10800, 0, false, 0, "" },
+		{ 2018, 2018, 6, { compiled_on_t::day, 0, 17 }, 7200, 0, true, 3600, "" },
+		{ 2019, 2019, 5, { compiled_on_t::day, 0, 5 }, 10800, 0, true, -3600, "" },
+		{ 2019, 2019, 6, { compiled_on_t::day, 0, 9 }, 7200, 0, false, 0, "" },
+		{ 2020, 2020, 4, { compiled_on_t::day, 0, 19 }, 10800, 0, true, -3600, "" },
+		{ 2020, 2020, 5, { compiled_on_t::day, 0, 31 }, 7200, 0, false, 0, "" },
+		{ 2021, 2021, 4, { compiled_on_t::day, 0, 11 }, 10800, 0, true, -3600, "" },
+		{ 2021, 2021, 5, { compiled_on_t::day, 0, 16 }, 7200, 0, false, 0, "" },
+		{ 2022, 2022, 3, { compiled_on_t::day, 0, 27 }, 10800, 0, true, -3600, "" },
+		{ 2022, 2022, 5, { compiled_on_t::day, 0, 8 }, 7200, 0, false, 0, "" },
+		{ 2023, 2023, 3, { compiled_on_t::day, 0, 19 }, 10800, 0, true, -3600, "" },
+		{ 2023, 2023, 4, { compiled_on_t::day, 0, 23 }, 7200, 0, false, 0, "" },
+		{ 2024, 2024, 3, { compiled_on_t::day, 0, 10 }, 10800, 0, true, -3600, "" },
+		{ 2024, 2024, 4, { compiled_on_t::day, 0, 14 }, 7200, 0, false, 0, "" },
+		{ 2025, 2025, 2, { compiled_on_t::day, 0, 23 }, 10800, 0, true, -3600, "" },
+		{ 2025, 2025, 4, { compiled_on_t::day, 0, 6 }, 7200, 0, false, 0, "" },
+		{ 2026, 2026, 2, { compiled_on_t::day, 0, 15 }, 10800, 0, true, -3600, "" },
+		{ 2026, 2026, 3, { compiled_on_t::day, 0, 22 }, 7200, 0, false, 0, "" },
+		{ 2027, 2027, 2, { compiled_on_t::day, 0, 7 }, 10800, 0, true, -3600, "" },
+		{ 2027, 2027, 3, { compiled_on_t::day, 0, 14 }, 7200, 0, false, 0, "" },
+		{ 2028, 2028, 1, { compiled_on_t::day, 0, 23 }, 10800, 0, true, -3600, "" },
+		{ 2028, 2028, 3, { compiled_on_t::day, 0, 5 }, 7200, 0, false, 0, "" },
+		{ 2029, 2029, 1, { compiled_on_t::day, 0, 14 }, 10800, 0, true, -3600, "" },
+		{ 2029, 2029, 2, { compiled_on_t::day, 0, 18 }, 7200, 0, false, 0, "" },
+		{ 2029, 2029, 12, { compiled_on_t::day, 0, 30 }, 10800, 0, true, -3600, "" },
+		{ 2030, 2030, 2, { compiled_on_t::day, 0, 10 }, 7200, 0, false, 0, "" },
+		{ 2030, 2030, 12, { compiled_on_t::day, 0, 22 }, 10800, 0, true, -3600, "" },
+		{ 2031, 2031, 1, { compiled_on_t::day, 0, 26 }, 7200, 0, false, 0, "" },
+		{ 2031, 2031, 12, { compiled_on_t::day, 0, 14 }, 10800, 0, true, -3600, "" },
+		{ 2032, 2032, 1, { compiled_on_t::day, 0, 18 }, 7200, 0, false, 0, "" },
+		{ 2032, 2032, 11, { compiled_on_t::day, 0, 28 }, 10800, 0, true, -3600, "" },
+		{ 2033, 2033, 1, { compiled_on_t::day, 0, 9 }, 7200, 0, false, 0, "" },
+		{ 2033, 2033, 11, { compiled_on_t::day, 0, 20 }, 10800, 0, true, -3600, "" },
+		{ 2033, 2033, 12, { compiled_on_t::day, 0, 25 }, 7200, 0, false, 0, "" },
+		{ 2034, 2034, 11, { compiled_on_t::day, 0, 5 }, 10800, 0, true, -3600, "" },
+		{ 2034, 2034, 12, { compiled_on_t::day, 0, 17 }, 7200, 0, false, 0, "" },
+		{ 2035, 2035, 10, { compiled_on_t::day, 0, 28 }, 10800, 0, true, -3600, "" },
+		{ 2035, 2035, 12, { compiled_on_t::day, 0, 9 }, 7200, 0, false, 0, "" },
+		{ 2036, 2036, 10, { compiled_on_t::day, 0, 19 }, 10800, 0, true, -3600, "" },
+		{ 2036, 2036, 11, { compiled_on_t::day, 0, 23 }, 7200, 0, false, 0, "" },
+		{ 2037, 2037, 10, { compiled_on_t::day, 0, 4 }, 10800, 0, true, -3600, "" },
+		{ 2037, 2037, 11, { compiled_on_t::day, 0, 15 }, 7200, 0, false, 0, "" },
+		{ 2038, 2038, 9, { compiled_on_t::day, 0, 26 }, 10800, 0, true, -3600, "" },
+		{ 2038, 2038, 10, { compiled_on_t::day, 0, 31 }, 7200, 0, false, 0, "" },
+		{ 2039, 2039, 9, { compiled_on_t::day, 0, 18 }, 10800, 0, true, -3600, "" },
+		{ 2039, 2039, 10, { compiled_on_t::day, 0, 23 }, 7200, 0, false, 0, "" },
+		{ 2040, 2040, 9, { compiled_on_t::day, 0, 2 }, 10800, 0, true, -3600, "" },
+		{ 2040, 2040, 10, { compiled_on_t::day, 0, 14 }, 7200, 0, false, 0, "" },
+		{ 2041, 2041, 8, { compiled_on_t::day, 0, 25 }, 10800, 0, true, -3600, "" },
+		{ 2041, 2041, 9, { compiled_on_t::day, 0, 29 }, 7200, 0, false, 0, "" },
+		{ 2042, 2042, 8, { compiled_on_t::day, 0, 10 }, 10800, 0, true, -3600, "" },
+		{ 2042, 2042, 9, { compiled_on_t::day, 0, 21 }, 7200, 0, false, 0, "" },
+		{ 2043, 2043, 8, { compiled_on_t::day, 0, 2 }, 10800, 0, true, -3600, "" },
+		{ 2043, 2043, 9, { compiled_on_t::day, 0, 13 }, 7200, 0, false, 0, "" },
+		{ 2044, 2044, 7, { compiled_on_t::day, 0, 24 }, 10800, 0, true, -3600, "" },
+		{ 2044, 2044, 8, { compiled_on_t::day, 0, 28 }, 7200, 0, false, 0, "" },
+		{ 2045, 2045, 7, { compiled_on_t::day, 0, 9 }, 10800, 0, true, -3600, "" },
+		{ 2045, 2045, 8, { compiled_on_t::day, 0, 20 }, 7200, 0, false, 0, "" },
+		{ 2046, 2046, 7, { compiled_on_t::day, 0, 1 }, 10800, 0, true, -3600, "" },
+		{ 2046, 2046, 8, { compiled_on_t::day, 0, 5 }, 7200, 0, false, 0, "" },
+		{ 2047, 2047, 6, { compiled_on_t::day, 0, 23 }, 10800, 0, true, -3600, "" },
+		{ 2047, 2047, 7, { compiled_on_t::day, 0, 28 }, 7200, 0, false, 0, "" },
+		{ 2048, 2048, 6, { compiled_on_t::day, 0, 7 }, 10800, 0, true, -3600, "" },
+		{ 2048, 2048, 7, { compiled_on_t::day, 0, 19 }, 7200, 0, false, 0, "" },
+		{ 2049, 2049, 5, { compiled_on_t::day, 0, 30 }, 10800, 0, true, -3600, "" },
+		{ 2049, 2049, 7, { compiled_on_t::day, 0, 4 }, 7200, 0, false, 0, "" },
+		{ 2050, 2050, 5, { compiled_on_t::day, 0, 15 }, 10800, 0, true, -3600, "" },
+		{ 2050, 2050, 6, { compiled_on_t::day, 0, 26 }, 7200, 0, false, 0, "" },
+		{ 2051, 2051, 5, { compiled_on_t::day, 0, 7 }, 10800, 0, true, -3600, "" },
+		{ 2051, 2051, 6, { compiled_on_t::day, 0, 18 }, 7200, 0, false, 0, "" },
+		{ 2052, 2052, 4, { compiled_on_t::day, 0, 28 }, 10800, 0, true, -3600, "" },
+		{ 2052, 2052, 6, { compiled_on_t::day, 0, 2 }, 7200, 0, false, 0, "" },
+		{ 2053, 2053, 4, { compiled_on_t::day, 0, 13 }, 10800, 0, true, -3600, "" },
+		{ 2053, 2053, 5, { compiled_on_t::day, 0, 25 }, 7200, 0, false, 0, "" },
+		{ 2054, 2054, 4, { compiled_on_t::day, 0, 5 }, 10800, 0, true, -3600, "" },
+		{ 2054, 2054, 5, { compiled_on_t::day, 0, 10 }, 7200, 0, false, 0, "" },
+		{ 2055, 2055, 3, { compiled_on_t::day, 0, 28 }, 10800, 0, true, -3600, "" },
+		{ 2055, 2055, 5, { compiled_on_t::day, 0, 2 }, 7200, 0, false, 0, "" },
+		{ 2056, 2056, 3, { compiled_on_t::day, 0, 12 }, 10800, 0, true, -3600, "" },
+		{ 2056, 2056, 4, { compiled_on_t::day, 0, 23 }, 7200, 0, false, 0, "" },
+		{ 2057, 2057, 3, { compiled_on_t::day, 0, 4 }, 10800, 0, true, -3600, "" },
+		{ 2057, 2057, 4, { compiled_on_t::day, 0, 8 }, 7200, 0, false, 0, "" },
+		{ 2058, 2058, 2, { compiled_on_t::day, 0, 17 }, 10800, 0, true, -3600, "" },
+		{ 2058, 2058, 3, { compiled_on_t::day, 0, 31 }, 7200, 0, false, 0, "" },
+		{ 2059, 2059, 2, { compiled_on_t::day, 0, 9 }, 10800, 0, true, -3600, "" },
+		{ 2059, 2059, 3, { compiled_on_t::day, 0, 23 }, 7200, 0, false, 0, "" },
+		{ 2060, 2060, 2, { compiled_on_t::day, 0, 1 }, 10800, 0, true, -3600, "" },
+		{ 2060, 2060, 3, { compiled_on_t::day, 0, 7 }, 7200, 0, false, 0, "" },
+		{ 2061, 2061, 1, { compiled_on_t::day, 0, 16 }, 10800, 0, true, -3600, "" },
+		{ 2061, 2061, 2, { compiled_on_t::day, 0, 27 }, 7200, 0, false, 0, "" },
+		{ 2062, 2062, 1, { compiled_on_t::day, 0, 8 }, 10800, 0, true, -3600, "" },
+		{ 2062, 2062, 2, { compiled_on_t::day, 0, 12 }, 7200, 0, false, 0, "" },
+		{ 2062, 2062, 12, { compiled_on_t::day, 0, 31 }, 10800, 0, true, -3600, "" },
+		{ 2063, 2063, 2, { compiled_on_t::day, 0, 4 }, 7200, 0, false, 0, "" },
+		{ 2063, 2063, 12, { compiled_on_t::day, 0, 16 }, 10800, 0, true, -3600, "" },
+		{ 2064, 2064, 1, { compiled_on_t::day, 0, 27 }, 7200, 0, false, 0, "" },
+		{ 2064, 2064, 12, { compiled_on_t::day, 0, 7 }, 10800, 0, true, -3600, "" },
+		{ 2065, 2065, 1, { compiled_on_t::day, 0, 11 }, 7200, 0, false, 0, "" },
+		{ 2065, 2065, 11, { compiled_on_t::day, 0, 22 }, 10800, 0, true, -3600, "" },
+		{ 2066, 2066, 1, { compiled_on_t::day, 0, 3 }, 7200, 0, false, 0, "" },
+		{ 2066, 2066, 11, { compiled_on_t::day, 0, 14 }, 10800, 0, true, -3600, "" },
+		{ 2066, 2066, 12, { compiled_on_t::day, 0, 26 }, 7200, 0, false, 0, "" },
+		{ 2067, 2067, 11, { compiled_on_t::day, 0, 6 }, 10800, 0, true, -3600, "" },
+		{ 2067, 2067, 12, { compiled_on_t::day, 0, 11 }, 7200, 0, false, 0, "" },
+		{ 2068, 2068, 10, { compiled_on_t::day, 0, 21 }, 10800, 0, true, -3600, "" },
+		{ 2068, 2068, 12, { compiled_on_t::day, 0, 2 }, 7200, 0, false, 0, "" },
+		{ 2069, 2069, 10, { compiled_on_t::day, 0, 13 }, 10800, 0, true, -3600, "" },
+		{ 2069, 2069, 11, { compiled_on_t::day, 0, 17 }, 7200, 0, false, 0, "" },
+		{ 2070, 2070, 10, { compiled_on_t::day, 0, 5 }, 10800, 0, true, -3600, "" },
+		{ 2070, 2070, 11, { compiled_on_t::day, 0, 9 }, 7200, 0, false, 0, "" },
+		{ 2071, 2071, 9, { compiled_on_t::day, 0, 20 }, 10800, 0, true, -3600, "" },
+		{ 2071, 2071, 11, { compiled_on_t::day, 0, 1 }, 7200, 0, false, 0, "" },
+		{ 2072, 2072, 9, { compiled_on_t::day, 0, 11 }, 10800, 0, true, -3600, "" },
+		{ 2072, 2072, 10, { compiled_on_t::day, 0, 16 }, 7200, 0, false, 0, "" },
+		{ 2073, 2073, 8, { compiled_on_t::day, 0, 27 }, 10800, 0, true, -3600, "" },
+		{ 2073, 2073, 10, { compiled_on_t::day, 0, 8 }, 7200, 0, false, 0, "" },
+		{ 2074, 2074, 8, { compiled_on_t::day, 0, 19 }, 10800, 0, true, -3600, "" },
+		{ 2074, 2074, 9, { compiled_on_t::day, 0, 30 }, 7200, 0, false, 0, "" },
+		{ 2075, 2075, 8, { compiled_on_t::day, 0, 11 }, 10800, 0, true, -3600, "" },
+		{ 2075, 2075, 9, { compiled_on_t::day, 0, 15 }, 7200, 0, false, 0, "" },
+		{ 2076, 2076, 7, { compiled_on_t::day, 0, 26 }, 10800, 0, true, -3600, "" },
+		{ 2076, 2076, 9, { compiled_on_t::day, 0, 6 }, 7200, 0, false, 0, "" },
+		{ 2077, 2077, 7, { compiled_on_t::day, 0, 18 }, 10800, 0, true, -3600, "" },
+		{ 2077, 2077, 8, { compiled_on_t::day, 0, 22 }, 7200, 0, false, 0, "" },
+		{ 2078, 2078, 7, { compiled_on_t::day, 0, 10 }, 10800, 0, true, -3600, "" },
+		{ 2078, 2078, 8, { compiled_on_t::day, 0, 14 }, 7200, 0, false, 0, "" },
+		{ 2079, 2079, 6, { compiled_on_t::day, 0, 25 }, 10800, 0, true, -3600, "" },
+		{ 2079, 2079, 8, { compiled_on_t::day, 0, 6 }, 7200, 0, false, 0, "" },
+		{ 2080, 2080, 6, { compiled_on_t::day, 0, 16 }, 10800, 0, true, -3600, "" },
+		{ 2080, 2080, 7, { compiled_on_t::day, 0, 21 }, 7200, 0, false, 0, "" },
+		{ 2081, 2081, 6, { compiled_on_t::day, 0, 1 }, 10800, 0, true, -3600, "" },
+		{ 2081, 2081, 7, { compiled_on_t::day, 0, 13 }, 7200, 0, false, 0, "" },
+		{ 2082, 2082, 5, { compiled_on_t::day, 0, 24 }, 10800, 0, true, -3600, "" },
+		{ 2082, 2082, 6, { compiled_on_t::day, 0, 28 }, 7200, 0, false, 0, "" },
+		{ 2083, 2083, 5, { compiled_on_t::day, 0, 16 }, 10800, 0, true, -3600, "" },
+		{ 2083, 2083, 6, { compiled_on_t::day, 0, 20 }, 7200, 0, false, 0, "" },
+		{ 2084, 2084, 4, { compiled_on_t::day, 0, 30 }, 10800, 0, true, -3600, "" },
+		{ 2084, 2084, 6, { compiled_on_t::day, 0, 11 }, 7200, 0, false, 0, "" },
+		{ 2085, 2085, 4, { compiled_on_t::day, 0, 22 }, 10800, 0, true, -3600, "" },
+		{ 2085, 2085, 5, { compiled_on_t::day, 0, 27 }, 7200, 0, false, 0, "" },
+		{ 2086, 2086, 4, { compiled_on_t::day, 0, 14 }, 10800, 0, true, -3600, "" },
+		{ 2086, 2086, 5, { compiled_on_t::day, 0, 19 }, 7200, 0, false, 0, "" },
+		{ 2087, 2087, 3, { compiled_on_t::day, 0, 30 }, 10800, 0, true, -3600, "" },
+		{ 2087, 2087, 5, { compiled_on_t::day, 0, 11 }, 7200, 0, false, 0, "" },
+		{ 1997, 32767, 3, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, true, 3600, "S" },
+		{ 1997, 32767, 10, { compiled_on_t::last_weekday, 0, 0 }, 10800, 0, false, 0, "" },
+		{ 1973, 1973, 3, { compiled_on_t::day, 0, 31 }, 0, 1, true, 3600, "S" },
+		{ 1973, 1973, 9, { compiled_on_t::day, 0, 29 }, 0, 1, false, 0, "" },
+		{ 1974, 1974, 4, { compiled_on_t::day, 0, 21 }, 0, 1, true, 3600, "S" },
+		{ 1974, 1974, 9, { compiled_on_t::day, 0, 16 }, 0, 1, false, 0, "" },
+		{ 1975, 1979, 4, { compiled_on_t::weekday_ge, 0, 15 }, 7200, 0, true, 3600, "S" },
+		{ 1975, 1980, 9, { compiled_on_t::weekday_ge, 0, 15 }, 7200, 0, false, 0, "" },
+		{ 1980, 1980, 3, { compiled_on_t::day, 0, 31 }, 7200, 0, true, 3600, "S" },
+		{ 1982, 1982, 10, { compiled_on_t::day, 0, 10 }, 0, 0, true, 3600, "" },
+		{ 1983, 1983, 3, { compiled_on_t::day, 0, 21 }, 0, 0, false, 0, "" },
+		{ 2008, 2008, 10, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, true, 3600, "" },
+		{ 2009, 2009, 3, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "" },
+		{ 1951, 1951, 4, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, true, 3600, "D" },
+		{ 1951, 1951, 9, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1954, 1960, 4, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, true, 3600, "D" },
+		{ 1954, 1960, 9, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1946, 1946, 4, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, true, 3600, "D" },
+		{ 1946, 1946, 9, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1966, 1966, 4, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, true, 3600, "D" },
+		{ 1966, 1966, 10, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1994, 1994, 3, { compiled_on_t::day, 0, 21 }, 0, 0, true, -3600, "WAT" },
+		{ 1994, 2017, 9, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 0, false, 0, "CAT" },
+		{ 1995, 2017, 4, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 0, true, -3600, "WAT" },
+		{ 1935, 1941, 9, { compiled_on_t::day, 0, 14 }, 0, 0, true, 1200, "" },
+		{ 1935, 1941, 12, { compiled_on_t::day, 0, 14 }, 0, 0, false, 0, "" },
+		{ 1977, 1978, 12, { compiled_on_t::weekday_ge, 0, 1 }, 0, 0, true, 3600, "" },
+		{ 1978, 1979, 2, { compiled_on_t::day, 0, 27 }, 0, 0, false, 0, "" },
+		{ 1996, 1996, 12, { compiled_on_t::day, 0, 1 }, 7200, 1, true, 3600, "" },
+		{ 1997, 1997, 3, { compiled_on_t::day, 0, 2 }, 7200, 1, false, 0, "" },
+		{ 1979, 1980, 3, { compiled_on_t::weekday_ge, 0, 16 }, 0, 0, true, 3600, "D" },
+		{ 1979, 1980, 6, { compiled_on_t::weekday_ge, 1, 23 }, 0, 0, false, 0, "S" },
+		{ 2005, 2005, 4, { compiled_on_t::day, 0, 10 }, 0, 0, true, 3600, "D" },
+		{ 2005, 2005, 10, { compiled_on_t::weekday_ge, 0, 1 }, 0, 0, false, 0, "S" },
+		{ 2006, 2006, 4, { compiled_on_t::day, 0, 30 }, 7200, 0, true, 3600, "D" },
+		{ 2006, 2006, 10, { compiled_on_t::weekday_ge, 0, 1 }, 3600, 0, false, 0, "S" },
+		{ 1920, 1920, 3, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, true, 3600, "D" },
+		{ 1920, 1920, 10, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1921, 1966, 4, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, true, 3600, "D" },
+		{ 1921, 1954, 9, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1955, 1966, 10, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1927, 1927, 11, { compiled_on_t::day, 0, 6 }, 7200, 0, true, 3600, "S" },
+		{ 1928, 1928, 3, { compiled_on_t::day, 0, 4 }, 7200, 0, false, 0, "M" },
+		{ 1928, 1933, 10, { compiled_on_t::weekday_ge, 0, 8 }, 7200, 0, true, 1800, "S" },
+		{ 1929, 1933, 3, { compiled_on_t::weekday_ge, 0, 15 }, 7200, 0, false, 0, "M" },
+		{ 1934, 1940, 4, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "M" },
+		{ 1934, 1940, 9, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, true, 1800, "S" },
+		{ 1946, 1946, 1, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "S" },
+		{ 1974, 1974, 11, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 1, true, 3600, "D" },
+		{ 1975, 1975, 2, { compiled_on_t::last_weekday, 0, 0 }, 7200, 1, false, 0, "S" },
+		{ 1975, 1988, 10, { compiled_on_t::last_weekday, 0, 0 }, 7200, 1, true, 3600, "D" },
+		{ 1976, 1989, 3, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 1, false, 0, "S" },
+		{ 1989, 1989, 10, { compiled_on_t::weekday_ge, 0, 8 }, 7200, 1, true, 3600, "D" },
+		{ 1990, 2006, 10, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 1, true, 3600, "D" },
+		{ 1990, 2007, 3, { compiled_on_t::weekday_ge, 0, 15 }, 7200, 1, false, 0, "S" },
+		{ 2007, 32767, 9, { compiled_on_t::last_weekday, 0, 0 }, 7200, 1, true, 3600, "D" },
+		{ 2008, 32767, 4, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 1, false, 0, "S" },
+		{ 1918, 1919, 9, { compiled_on_t::day, 0, 16 }, 7200, 1, false, 0, "" },
+		{ 1919, 1919, 4, { compiled_on_t::day, 0, 15 }, 7200, 1, true, 3600, "S" },
+		{ 1944, 1944, 4, { compiled_on_t::day, 0, 3 }, 7200, 1, true, 3600, "S" },
+		{ 1944, 1944, 10, { compiled_on_t::day, 0, 4 }, 7200, 0, false, 0, "" },
+		{ 1945, 1945, 4, { compiled_on_t::day, 0, 29 }, 0, 0, true, 3600, "S" },
+		{ 1945, 1945, 11, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1946, 1946, 4, { compiled_on_t::day, 0, 14 }, 0, 1, true, 3600, "S" },
+		{ 1946, 1946, 10, { compiled_on_t::day, 0, 7 }, 7200, 1, false, 0, "" },
+		{ 1947, 1947, 5, { compiled_on_t::day, 0, 4 }, 7200, 1, true, 3600, "S" },
+		{ 1947, 1949, 10, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 1, false, 0, "" },
+		{ 1948, 1948, 4, { compiled_on_t::day, 0, 18 }, 7200, 1, true, 3600, "S" },
+		{ 1949, 1949, 4, { compiled_on_t::day, 0, 10 }, 7200, 1, true, 3600, "S" },
+		{ 1957, 1957, 6, { compiled_on_t::day, 0, 2 }, 3600, 1, true, 3600, "S" },
+		{ 1957, 1958, 9, { compiled_on_t::last_weekday, 0, 0 }, 3600, 1, false, 0, "" },
+		{ 1958, 1958, 3, { compiled_on_t::day, 0, 30 }, 3600, 1, true, 3600, "S" },
+		{ 1959, 1959, 5, { compiled_on_t::day, 0, 31 }, 3600, 1, true, 3600, "S" },
+		{ 1959, 1961, 10, { compiled_on_t::weekday_ge, 0, 1 }, 3600, 1, false, 0, "" },
+		{ 1960, 1960, 4, { compiled_on_t::day, 0, 3 }, 3600, 1, true, 3600, "S" },
+		{ 1961, 1964, 5, { compiled_on_t::last_weekday, 0, 0 }, 3600, 1, true, 3600, "S" },
+		{ 1962, 1964, 9, { compiled_on_t::last_weekday, 0, 0 }, 3600, 1, false, 0, "" },
+		{ 1999, 2005, 4, { compiled_on_t::weekday_ge, 5, 15 }, 0, 0, true, 3600, "S" },
+		{ 1999, 2003, 10, { compiled_on_t::weekday_ge, 5, 15 }, 0, 0, false, 0, "" },
+		{ 2004, 2004, 10, { compiled_on_t::day, 0, 1 }, 3600, 0, false, 0, "" },
+		{ 2005, 2005, 10, { compiled_on_t::day, 0, 4 }, 7200, 0, false, 0, "" },
+		{ 2006, 2007, 4, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "S" },
+		{ 2006, 2006, 9, { compiled_on_t::day, 0, 22 }, 0, 0, false, 0, "" },
+		{ 2007, 2007, 9, { compiled_on_t::day, 0, 13 }, 7200, 0, false, 0, "" },
+		{ 2008, 2009, 3, { compiled_on_t::last_weekday, 5, 0 }, 0, 0, true, 3600, "S" },
+		{ 2008, 2008, 9, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 2009, 2009, 9, { compiled_on_t::day, 0, 4 }, 3600, 0, false, 0, "" },
+		{ 2010, 2010, 3, { compiled_on_t::day, 0, 26 }, 0, 0, true, 3600, "S" },
+		{ 2010, 2010, 8, { compiled_on_t::day, 0, 11 }, 0, 0, false, 0, "" },
+		{ 2011, 2011, 4, { compiled_on_t::day, 0, 1 }, 60, 0, true, 3600, "S" },
+		{ 2011, 2011, 8, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 2011, 2011, 8, { compiled_on_t::day, 0, 30 }, 0, 0, true, 3600, "S" },
+		{ 2011, 2011, 9, { compiled_on_t::day, 0, 30 }, 0, 0, false, 0, "" },
+		{ 2012, 2014, 3, { compiled_on_t::last_weekday, 4, 0 }, 86400, 0, true, 3600, "S" },
+		{ 2012, 2012, 9, { compiled_on_t::day, 0, 21 }, 3600, 0, false, 0, "" },
+		{ 2013, 2013, 9, { compiled_on_t::day, 0, 27 }, 0, 0, false, 0, "" },
+		{ 2014, 2014, 10, { compiled_on_t::day, 0, 24 }, 0, 0, false, 0, "" },
+		{ 2015, 2015, 3, { compiled_on_t::day, 0, 28 }, 0, 0, true, 3600, "S" },
+		{ 2015, 2015, 10, { compiled_on_t::day, 0, 23 }, 3600, 0, false, 0, "" },
+		{ 2016, 2018, 3, { compiled_on_t::weekday_le, 6, 30 }, 3600, 0, true, 3600, "S" },
+		{ 2016, 2018, 10, { compiled_on_t::weekday_le, 6, 30 }, 3600, 0, false, 0, "" },
+		{ 2019, 2019, 3, { compiled_on_t::day, 0, 29 }, 0, 0, true, 3600, "S" },
+		{ 2019, 2019, 10, { compiled_on_t::weekday_le, 6, 30 }, 0, 0, false, 0, "" },
+		{ 2020, 2021, 3, { compiled_on_t::weekday_le, 6, 30 }, 0, 0, true, 3600, "S" },
+		{ 2020, 2020, 10, { compiled_on_t::day, 0, 24 }, 3600, 0, false, 0, "" },
+		{ 2021, 2021, 10, { compiled_on_t::day, 0, 29 }, 3600, 0, false, 0, "" },
+		{ 2022, 2022, 3, { compiled_on_t::day, 0, 27 }, 0, 0, true, 3600, "S" },
+		{ 2022, 2035, 10, { compiled_on_t::weekday_le, 6, 30 }, 7200, 0, false, 0, "" },
+		{ 2023, 2023, 4, { compiled_on_t::day, 0, 29 }, 7200, 0, true, 3600, "S" },
+		{ 2024, 2024, 4, { compiled_on_t::day, 0, 20 }, 7200, 0, true, 3600, "S" },
+		{ 2025, 2025, 4, { compiled_on_t::day, 0, 12 }, 7200, 0, true, 3600, "S" },
+		{ 2026, 2054, 3, { compiled_on_t::weekday_le, 6, 30 }, 7200, 0, true, 3600, "S" },
+		{ 2036, 2036, 10, { compiled_on_t::day, 0, 18 }, 7200, 0, false, 0, "" },
+		{ 2037, 2037, 10, { compiled_on_t::day, 0, 10 }, 7200, 0, false, 0, "" },
+		{ 2038, 2038, 9, { compiled_on_t::day, 0, 25 }, 7200, 0, false, 0, "" },
+		{ 2039, 2039, 9, { compiled_on_t::day, 0, 17 }, 7200, 0, false, 0, "" },
+		{ 2040, 2040, 9, { compiled_on_t::day, 0, 1 }, 7200, 0, false, 0, "" },
+		{ 2040, 2040, 10, { compiled_on_t::day, 0, 20 }, 7200, 0, true, 3600, "S" },
+		{ 2040, 2067, 10, { compiled_on_t::weekday_le, 6, 30 }, 7200, 0, false, 0, "" },
+		{ 2041, 2041, 8, { compiled_on_t::day, 0, 24 }, 7200, 0, false, 0, "" },
+		{ 2041, 2041, 10, { compiled_on_t::day, 0, 5 }, 7200, 0, true, 3600, "S" },
+		{ 2042, 2042, 8, { compiled_on_t::day, 0, 16 }, 7200, 0, false, 0, "" },
+		{ 2042, 2042, 9, { compiled_on_t::day, 0, 27 }, 7200, 0, true, 3600, "S" },
+		{ 2043, 2043, 8, { compiled_on_t::day, 0, 1 }, 7200, 0, false, 0, "" },
+		{ 2043, 2043, 9, { compiled_on_t::day, 0, 19 }, 7200, 0, true, 3600, "S" },
+		{ 2044, 2044, 7, { compiled_on_t::day, 0, 23 }, 7200, 0, false, 0, "" },
+		{ 2044, 2044, 9, { compiled_on_t::day, 0, 3 }, 7200, 0, true, 3600, "S" },
+		{ 2045, 2045, 7, { compiled_on_t::day, 0, 15 }, 7200, 0, false, 0, "" },
+		{ 2045, 2045, 8, { compiled_on_t::day, 0, 26 }, 7200, 0, true, 3600, "S" },
+		{ 2046, 2046, 6, { compiled_on_t::day, 0, 30 }, 7200, 0, false, 0, "" },
+		{ 2046, 2046, 8, { compiled_on_t::day, 0, 18 }, 7200, 0, true, 3600, "S" },
+		{ 2047, 2047, 6, { compiled_on_t::day, 0, 22 }, 7200, 0, false, 0, "" },
+		{ 2047, 2047, 8, { compiled_on_t::day, 0, 3 }, 7200, 0, true, 3600, "S" },
+		{ 2048, 2048, 6, { compiled_on_t::day, 0, 6 }, 7200, 0, false, 0, "" },
+		{ 2048, 2048, 7, { compiled_on_t::day, 0, 25 }, 7200, 0, true, 3600, "S" },
+		{ 2049, 2049, 5, { compiled_on_t::day, 0, 29 }, 7200, 0, false, 0, "" },
+		{ 2049, 2049, 7, { compiled_on_t::day, 0, 10 }, 7200, 0, true, 3600, "S" },
+		{ 2050, 2050, 5, { compiled_on_t::day, 0, 21 }, 7200, 0, false, 0, "" },
+		{ 2050, 2050, 7, { compiled_on_t::day, 0, 2 }, 7200, 0, true, 3600, "S" },
+		{ 2051, 2051, 5, { compiled_on_t::day, 0, 6 }, 7200, 0, false, 0, "" },
+		{ 2051, 2051, 6, { compiled_on_t::day, 0, 24 }, 7200, 0, true, 3600, "S" },
+		{ 2052, 2052, 4, { compiled_on_t::day, 0, 27 }, 7200, 0, false, 0, "" },
+		{ 2052, 2052, 6, { compiled_on_t::day, 0, 8 }, 7200, 0, true, 3600, "S" },
+		{ 2053, 2053, 4, { compiled_on_t::day, 0, 12 }, 7200, 0, false, 0, "" },
+		{ 2053, 2053, 5, { compiled_on_t::day, 0, 31 }, 7200, 0, true, 3600, "S" },
+		{ 2054, 2054, 4, { compiled_on_t::day, 0, 4 }, 7200, 0, false, 0, "" },
+		{ 2054, 2054, 5, { compiled_on_t::day, 0, 23 }, 7200, 0, true, 3600, "S" },
+		{ 2055, 2055, 5, { compiled_on_t::day, 0, 8 }, 7200, 0, true, 3600, "S" },
+		{ 2056, 2056, 4, { compiled_on_t::day, 0, 29 }, 7200, 0, true, 3600, "S" },
+		{ 2057, 2057, 4, { compiled_on_t::day, 0, 14 }, 7200, 0, true, 3600, "S" },
+		{ 2058, 2058, 4, { compiled_on_t::day, 0, 6 }, 7200, 0, true, 3600, "S" },
+		{ 2059, 32767, 3, { compiled_on_t::weekday_le, 6, 30 }, 7200, 0, true, 3600, "S" },
+		{ 2068, 2068, 10, { compiled_on_t::day, 0, 20 }, 7200, 0, false, 0, "" },
+		{ 2069, 2069, 10, { compiled_on_t::day, 0, 12 }, 7200, 0, false, 0, "" },
+		{ 2070, 2070, 10, { compiled_on_t::day, 0, 4 }, 7200, 0, false, 0, "" },
+		{ 2071, 2071, 9, { compiled_on_t::day, 0, 19 }, 7200, 0, false, 0, "" },
+		{ 2072, 2072, 9, { compiled_on_t::day, 0, 10 }, 7200, 0, false, 0, "" },
+		{ 2072, 2072, 10, { compiled_on_t::day, 0, 22 }, 7200, 0, true, 3600, "S" },
+		{ 2072, 32767, 10, { compiled_on_t::weekday_le, 6, 30 }, 7200, 0, false, 0, "" },
+		{ 2073, 2073, 9, { compiled_on_t::day, 0, 2 }, 7200, 0, false, 0, "" },
+		{ 2073, 2073, 10, { compiled_on_t::day, 0, 14 }, 7200, 0, true, 3600, "S" },
+		{ 2074, 2074, 8, { compiled_on_t::day, 0, 18 }, 7200, 0, false, 0, "" },
+		{ 2074, 2074, 10, { compiled_on_t::day, 0, 6 }, 7200, 0, true, 3600, "S" },
+		{ 2075, 2075, 8, { compiled_on_t::day, 0, 10 }, 7200, 0, false, 0, "" },
+		{ 2075, 2075, 9, { compiled_on_t::day, 0, 21 }, 7200, 0, true, 3600, "S" },
+		{ 2076, 2076, 7, { compiled_on_t::day, 0, 25 }, 7200, 0, false, 0, "" },
+		{ 2076, 2076, 9, { compiled_on_t::day, 0, 12 }, 7200, 0, true, 3600, "S" },
+		{ 2077, 2077, 7, { compiled_on_t::day, 0, 17 }, 7200, 0, false, 0, "" },
+		{ 2077, 2077, 9, { compiled_on_t::day, 0, 4 }, 7200, 0, true, 3600, "S" },
+		{ 2078, 2078, 7, { compiled_on_t::day, 0, 9 }, 7200, 0, false, 0, "" },
+		{ 2078, 2078, 8, { compiled_on_t::day, 0, 20 }, 7200, 0, true, 3600, "S" },
+		{ 2079, 2079, 6, { compiled_on_t::day, 0, 24 }, 7200, 0, false, 0, "" },
+		{ 2079, 2079, 8, { compiled_on_t::day, 0, 12 }, 7200, 0, true, 3600, "S" },
+		{ 2080, 2080, 6, { compiled_on_t::day, 0, 15 }, 7200, 0, false, 0, "" },
+		{ 2080, 2080, 7, { compiled_on_t::day, 0, 27 }, 7200, 0, true, 3600, "S" },
+		{ 2081, 2081, 6, { compiled_on_t::day, 0, 7 }, 7200, 0, false, 0, "" },
+		{ 2081, 2081, 7, { compiled_on_t::day, 0, 19 }, 7200, 0, true, 3600, "S" },
+		{ 2082, 2082, 5, { compiled_on_t::day, 0, 23 }, 7200, 0, false, 0, "" },
+		{ 2082, 2082, 7, { compiled_on_t::day, 0, 11 }, 7200, 0, true, 3600, "S" },
+		{ 2083, 2083, 5, { compiled_on_t::day, 0, 15 }, 7200, 0, false, 0, "" },
+		{ 2083, 2083, 6, { compiled_on_t::day, 0, 26 }, 7200, 0, true, 3600, "S" },
+		{ 2084, 2084, 4, { compiled_on_t::day, 0, 29 }, 7200, 0, false, 0, "" },
+		{ 2084, 2084, 6, { compiled_on_t::day, 0, 17 }, 7200, 0, true, 3600, "S" },
+		{ 2085, 2085, 4, { compiled_on_t::day, 0, 21 }, 7200, 0, false, 0, "" },
+		{ 2085, 2085, 6, { compiled_on_t::day, 0, 9 }, 7200, 0, true, 3600, "S" },
+		{ 2086, 2086, 4, { compiled_on_t::day, 0, 13 }, 7200, 0, false, 0, "" },
+		{ 2086, 2086, 5, { compiled_on_t::day, 0, 25 }, 7200, 0, true, 3600, "S" },
+		{ 1938, 1938, 1, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "" },
+		{ 1938, 1938, 4, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1938, 1939, 9, { compiled_on_t::last_weekday, 0, 0 }, 0, 0, true, 3600, "" },
+		{ 1939, 1940, 3, { compiled_on_t::weekday_ge, 0, 24 }, 0, 0, false, 0, "" },
+		{ 1986, 1987, 1, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "" },
+		{ 1986, 1987, 4, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1990, 1990, 1, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "" },
+		{ 1990, 1990, 4, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1994, 1994, 1, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "" },
+		{ 1994, 1994, 4, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1936, 1936, 10, { compiled_on_t::day, 0, 31 }, 86400, 0, true, 3600, "D" },
+		{ 1937, 1937, 1, { compiled_on_t::day, 0, 15 }, 86400, 0, false, 0, "S" },
+		{ 1941, 1941, 12, { compiled_on_t::day, 0, 15 }, 86400, 0, true, 3600, "D" },
+		{ 1945, 1945, 11, { compiled_on_t::day, 0, 30 }, 86400, 0, false, 0, "S" },
+		{ 1954, 1954, 4, { compiled_on_t::day, 0, 11 }, 86400, 0, true, 3600, "D" },
+		{ 1954, 1954, 6, { compiled_on_t::day, 0, 4 }, 86400, 0, false, 0, "S" },
+		{ 1977, 1977, 3, { compiled_on_t::day, 0, 27 }, 86400, 0, true, 3600, "D" },
+		{ 1977, 1977, 9, { compiled_on_t::day, 0, 21 }, 86400, 0, false, 0, "S" },
+		{ 1990, 1990, 5, { compiled_on_t::day, 0, 21 }, 0, 0, true, 3600, "D" },
+		{ 1990, 1990, 7, { compiled_on_t::day, 0, 28 }, 86400, 0, false, 0, "S" },
+		{ 2002, 2002, 4, { compiled_on_t::weekday_ge, 0, 2 }, 0, 0, true, 3600, "S" },
+		{ 2002, 2002, 10, { compiled_on_t::weekday_ge, 0, 2 }, 0, 0, false, 0, "" },
+		{ 2008, 2008, 6, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "S" },
+		{ 2008, 2009, 11, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 2009, 2009, 4, { compiled_on_t::day, 0, 15 }, 0, 0, true, 3600, "S" },
+		{ 1955, 1955, 5, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "D" },
+		{ 1955, 1960, 9, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1956, 1963, 4, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, true, 3600, "D" },
+		{ 1961, 1963, 10, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1955, 1955, 5, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "D" },
+		{ 1955, 1960, 9, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1956, 1964, 4, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, true, 3600, "D" },
+		{ 1961, 1964, 10, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1946, 1960, 4, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, true, 3600, "D" },
+		{ 1946, 1954, 9, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1955, 1956, 10, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1957, 1960, 9, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1928, 1928, 6, { compiled_on_t::day, 0, 10 }, 0, 0, true, 3600, "D" },
+		{ 1928, 1928, 10, { compiled_on_t::day, 0, 10 }, 0, 0, false, 0, "S" },
+		{ 1940, 1942, 6, { compiled_on_t::weekday_ge, 0, 1 }, 0, 0, true, 3600, "D" },
+		{ 1940, 1942, 9, { compiled_on_t::weekday_ge, 0, 1 }, 0, 0, false, 0, "S" },
+		{ 1945, 1946, 6, { compiled_on_t::weekday_ge, 0, 1 }, 0, 0, true, 3600, "D" },
+		{ 1945, 1946, 9, { compiled_on_t::weekday_ge, 0, 1 }, 0, 0, false, 0, "S" },
+		{ 1965, 1965, 6, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "D" },
+		{ 1965, 1965, 9, { compiled_on_t::day, 0, 30 }, 0, 0, false, 0, "S" },
+		{ 1966, 1966, 5, { compiled_on_t::day, 0, 29 }, 0, 0, true, 3600, "D" },
+		{ 1966, 1966, 10, { compiled_on_t::day, 0, 2 }, 0, 0, false, 0, "S" },
+		{ 1967, 1967, 4, { compiled_on_t::day, 0, 8 }, 0, 0, true, 3600, "D" },
+		{ 1967, 1968, 9, { compiled_on_t::weekday_ge, 0, 8 }, 0, 0, false, 0, "S" },
+		{ 1968, 1968, 4, { compiled_on_t::day, 0, 14 }, 0, 0, true, 3600, "D" },
+		{ 1969, 1977, 4, { compiled_on_t::last_weekday, 0, 0 }, 0, 0, true, 3600, "D" },
+		{ 1969, 1971, 10, { compiled_on_t::last_weekday, 0, 0 }, 0, 0, false, 0, "S" },
+		{ 1972, 1974, 10, { compiled_on_t::day, 0, 8 }, 0, 0, false, 0, "S" },
+		{ 1975, 1977, 10, { compiled_on_t::last_weekday, 0, 0 }, 0, 0, false, 0, "S" },
+		{ 1978, 1978, 5, { compiled_on_t::day, 0, 7 }, 0, 0, true, 3600, "D" },
+		{ 1978, 1990, 10, { compiled_on_t::weekday_ge, 0, 8 }, 0, 0, false, 0, "S" },
+		{ 1979, 1980, 3, { compiled_on_t::weekday_ge, 0, 15 }, 0, 0, true, 3600, "D" },
+		{ 1981, 1985, 5, { compiled_on_t::weekday_ge, 0, 5 }, 0, 0, true, 3600, "D" },
+		{ 1986, 1989, 3, { compiled_on_t::weekday_ge, 0, 14 }, 0, 0, true, 3600, "D" },
+		{ 1990, 1997, 4, { compiled_on_t::weekday_ge, 0, 1 }, 0, 0, true, 3600, "D" },
+		{ 1991, 1995, 10, { compiled_on_t::weekday_ge, 0, 8 }, 0, 1, false, 0, "S" },
+		{ 1996, 1996, 10, { compiled_on_t::day, 0, 6 }, 0, 1, false, 0, "S" },
+		{ 1997, 1997, 10, { compiled_on_t::day, 0, 12 }, 0, 1, false, 0, "S" },
+		{ 1998, 1999, 3, { compiled_on_t::last_weekday, 0, 0 }, 0, 1, true, 3600, "D" },
+		{ 1998, 2003, 10, { compiled_on_t::last_weekday, 0, 0 }, 0, 1, false, 0, "S" },
+		{ 2000, 2003, 4, { compiled_on_t::weekday_ge, 0, 1 }, 0, 1, true, 3600, "D" },
+		{ 2004, 2004, 3, { compiled_on_t::last_weekday, 0, 0 }, 0, 1, true, 3600, "D" },
+		{ 2006, 2010, 10, { compiled_on_t::last_weekday, 0, 0 }, 0, 1, false, 0, "S" },
+		{ 2007, 2007, 3, { compiled_on_t::weekday_ge, 0, 8 }, 0, 1, true, 3600, "D" },
+		{ 2008, 2008, 3, { compiled_on_t::weekday_ge, 0, 15 }, 0, 1, true, 3600, "D" },
+		{ 2009, 2010, 3, { compiled_on_t::weekday_ge, 0, 8 }, 0, 1, true, 3600, "D" },
+		{ 2011, 2011, 3, { compiled_on_t::weekday_ge, 0, 15 }, 0, 1, true, 3600, "D" },
+		{ 2011, 2011, 11, { compiled_on_t::day, 0, 13 }, 0, 1, false, 0, "S" },
+		{ 2012, 2012, 4, { compiled_on_t::day, 0, 1 }, 0, 1, true, 3600, "D" },
+		{ 2012, 32767, 11, { compiled_on_t::weekday_ge, 0, 1 }, 0, 1, false, 0, "S" },
+		{ 2013, 32767, 3, { compiled_on_t::weekday_ge, 0, 8 }, 0, 1, true, 3600, "D" },
+		{ 1917, 1917, 7, { compiled_on_t::day, 0, 1 }, 82800, 0, true, 3600, "MST" },
+		{ 1917, 1917, 12, { compiled_on_t::day, 0, 28 }, 0, 0, false, 0, "MMT" },
+		{ 1918, 1918, 5, { compiled_on_t::day, 0, 31 }, 79200, 0, true, 7200, "MDST" },
+		{ 1918, 1918, 9, { compiled_on_t::day, 0, 16 }, 3600, 0, true, 3600, "MST" },
+		{ 1919, 1919, 5, { compiled_on_t::day, 0, 31 }, 82800, 0, true, 7200, "MDST" },
+		{ 1919, 1919, 7, { compiled_on_t::day, 0, 1 }, 0, 2, true, 3600, "MSD" },
+		{ 1919, 1919, 8, { compiled_on_t::day, 0, 16 }, 0, 0, false, 0, "MSK" },
+		{ 1921, 1921, 2, { compiled_on_t::day, 0, 14 }, 82800, 0, true, 3600, "MSD" },
+		{ 1921, 1921, 3, { compiled_on_t::day, 0, 20 }, 82800, 0, true, 7200, "+05" },
+		{ 1921, 1921, 9, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "MSD" },
+		{ 1921, 1921, 10, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1981, 1984, 4, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "S" },
+		{ 1981, 1983, 10, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1984, 1995, 9, { compiled_on_t::last_weekday, 0, 0 }, 7200, 1, false, 0, "" },
+		{ 1985, 2010, 3, { compiled_on_t::last_weekday, 0, 0 }, 7200, 1, true, 3600, "S" },
+		{ 1996, 2010, 10, { compiled_on_t::last_weekday, 0, 0 }, 7200, 1, false, 0, "" },
+		{ 1920, 1923, 4, { compiled_on_t::weekday_ge, 0, 15 }, 7200, 0, true, 3600, "S" },
+		{ 1920, 1923, 10, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 0, false, 0, "" },
+		{ 1962, 1962, 4, { compiled_on_t::day, 0, 29 }, 7200, 0, true, 3600, "S" },
+		{ 1962, 1962, 10, { compiled_on_t::day, 0, 1 }, 7200, 0, false, 0, "" },
+		{ 1963, 1965, 5, { compiled_on_t::day, 0, 1 }, 7200, 0, true, 3600, "S" },
+		{ 1963, 1963, 9, { compiled_on_t::day, 0, 30 }, 7200, 0, false, 0, "" },
+		{ 1964, 1964, 10, { compiled_on_t::day, 0, 1 }, 7200, 0, false, 0, "" },
+		{ 1965, 1965, 9, { compiled_on_t::day, 0, 30 }, 7200, 0, false, 0, "" },
+		{ 1966, 1966, 4, { compiled_on_t::day, 0, 24 }, 7200, 0, true, 3600, "S" },
+		{ 1966, 1976, 10, { compiled_on_t::day, 0, 1 }, 7200, 0, false, 0, "" },
+		{ 1967, 1978, 5, { compiled_on_t::day, 0, 1 }, 7200, 0, true, 3600, "S" },
+		{ 1977, 1978, 9, { compiled_on_t::day, 0, 1 }, 7200, 0, false, 0, "" },
+		{ 1983, 1984, 4, { compiled_on_t::day, 0, 9 }, 7200, 0, true, 3600, "S" },
+		{ 1983, 1984, 10, { compiled_on_t::day, 0, 1 }, 7200, 0, false, 0, "" },
+		{ 1986, 1986, 2, { compiled_on_t::day, 0, 16 }, 7200, 0, true, 3600, "S" },
+		{ 1986, 1986, 10, { compiled_on_t::day, 0, 9 }, 7200, 0, false, 0, "" },
+		{ 1987, 1987, 3, { compiled_on_t::day, 0, 1 }, 7200, 0, true, 3600, "S" },
+		{ 1987, 1988, 10, { compiled_on_t::day, 0, 31 }, 7200, 0, false, 0, "" },
+		{ 1988, 1988, 3, { compiled_on_t::day, 0, 15 }, 7200, 0, true, 3600, "S" },
+		{ 1989, 1989, 3, { compiled_on_t::day, 0, 31 }, 7200, 0, true, 3600, "S" },
+		{ 1989, 1989, 10, { compiled_on_t::day, 0, 1 }, 7200, 0, false, 0, "" },
+		{ 1990, 1990, 4, { compiled_on_t::day, 0, 1 }, 7200, 0, true, 3600, "S" },
+		{ 1990, 1990, 9, { compiled_on_t::day, 0, 30 }, 7200, 0, false, 0, "" },
+		{ 1991, 1991, 4, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "S" },
+		{ 1991, 1992, 10, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1992, 1992, 4, { compiled_on_t::day, 0, 8 }, 0, 0, true, 3600, "S" },
+		{ 1993, 1993, 3, { compiled_on_t::day, 0, 26 }, 0, 0, true, 3600, "S" },
+		{ 1993, 1993, 9, { compiled_on_t::day, 0, 25 }, 0, 0, false, 0, "" },
+		{ 1994, 1996, 4, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "S" },
+		{ 1994, 2005, 10, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1997, 1998, 3, { compiled_on_t::last_weekday, 1, 0 }, 0, 0, true, 3600, "S" },
+		{ 1999, 2006, 4, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "S" },
+		{ 2006, 2006, 9, { compiled_on_t::day, 0, 22 }, 0, 0, false, 0, "" },
+		{ 2007, 2007, 3, { compiled_on_t::last_weekday, 5, 0 }, 0, 0, true, 3600, "S" },
+		{ 2007, 2007, 11, { compiled_on_t::weekday_ge, 5, 1 }, 0, 0, false, 0, "" },
+		{ 2008, 2008, 4, { compiled_on_t::weekday_ge, 5, 1 }, 0, 0, true, 3600, "S" },
+		{ 2008, 2008, 11, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 2009, 2009, 3, { compiled_on_t::last_weekday, 5, 0 }, 0, 0, true, 3600, "S" },
+		{ 2010, 2011, 4, { compiled_on_t::weekday_ge, 5, 1 }, 0, 0, true, 3600, "S" },
+		{ 2012, 2022, 3, { compiled_on_t::last_weekday, 5, 0 }, 0, 0, true, 3600, "S" },
+		{ 2009, 2022, 10, { compiled_on_t::last_weekday, 5, 0 }, 0, 0, false, 0, "" },
+		{ 1942, 1943, 9, { compiled_on_t::weekday_ge, 0, 15 }, 7200, 0, true, 3600, "" },
+		{ 1943, 1944, 3, { compiled_on_t::weekday_ge, 0, 15 }, 7200, 0, false, 0, "" },
+		{ 1970, 1970, 5, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "S" },
+		{ 1970, 1985, 10, { compiled_on_t::day, 0, 15 }, 0, 0, false, 0, "" },
+		{ 1971, 1971, 4, { compiled_on_t::day, 0, 30 }, 0, 0, true, 3600, "S" },
+		{ 1972, 1985, 4, { compiled_on_t::last_weekday, 0, 0 }, 0, 0, true, 3600, "S" },
+		{ 1987, 1988, 5, { compiled_on_t::weekday_ge, 0, 1 }, 0, 0, true, 3600, "D" },
+		{ 1987, 1988, 9, { compiled_on_t::last_weekday, 0, 0 }, 0, 0, false, 0, "S" },
+		{ 2008, 2009, 3, { compiled_on_t::weekday_ge, 0, 8 }, 0, 0, false, 0, "" },
+		{ 2007, 2008, 10, { compiled_on_t::weekday_ge, 0, 8 }, 0, 0, true, 3600, "" },
+		{ 1919, 1919, 4, { compiled_on_t::day, 0, 12 }, 86400, 0, true, 3600, "D" },
+		{ 1919, 1919, 9, { compiled_on_t::day, 0, 30 }, 86400, 0, false, 0, "S" },
+		{ 1940, 1940, 6, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "D" },
+		{ 1940, 1940, 10, { compiled_on_t::day, 0, 12 }, 86400, 0, false, 0, "S" },
+		{ 1941, 1941, 3, { compiled_on_t::day, 0, 15 }, 0, 0, true, 3600, "D" },
+		{ 1941, 1941, 11, { compiled_on_t::day, 0, 1 }, 86400, 0, false, 0, "S" },
+		{ 1942, 1942, 1, { compiled_on_t::day, 0, 31 }, 0, 0, true, 3600, "D" },
+		{ 1945, 1945, 9, { compiled_on_t::day, 0, 1 }, 86400, 0, false, 0, "S" },
+		{ 1946, 1946, 5, { compiled_on_t::day, 0, 15 }, 0, 0, true, 3600, "D" },
+		{ 1946, 1946, 9, { compiled_on_t::day, 0, 30 }, 86400, 0, false, 0, "S" },
+		{ 1947, 1947, 4, { compiled_on_t::day, 0, 15 }, 0, 0, true, 3600, "D" },
+		{ 1947, 1947, 10, { compiled_on_t::day, 0, 31 }, 86400, 0, false, 0, "S" },
+		{ 1948, 1949, 5, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "D" },
+		{ 1948, 1949, 9, { compiled_on_t::day, 0, 30 }, 86400, 0, false, 0, "S" },
+		{ 1945, 1945, 5, { compiled_on_t::day, 0, 24 }, 7200, 0, true, 7200, "M" },
+		{ 1945, 1945, 9, { compiled_on_t::day, 0, 24 }, 10800, 0, true, 3600, "S" },
+		{ 1945, 1945, 11, { compiled_on_t::day, 0, 18 }, 7200, 1, false, 0, "" },
+		{ 1967, 1967, 6, { compiled_on_t::day, 0, 3 }, 43200, 0, true, 3600, "S" },
+		{ 1967, 1967, 10, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1974, 1974, 6, { compiled_on_t::day, 0, 24 }, 0, 0, true, 3600, "S" },
+		{ 1974, 1974, 9, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1976, 1977, 5, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "S" },
+		{ 1976, 1976, 8, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1977, 1977, 9, { compiled_on_t::day, 0, 28 }, 0, 0, false, 0, "" },
+		{ 1978, 1978, 6, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "S" },
+		{ 1978, 1978, 8, { compiled_on_t::day, 0, 4 }, 0, 0, false, 0, "" },
+		{ 1947, 1961, 4, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, true, 3600, "D" },
+		{ 1947, 1954, 9, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1955, 1956, 10, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1957, 1958, 9, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1959, 1961, 10, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1957, 1957, 4, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, true, 3600, "D" },
+		{ 1957, 1957, 10, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1959, 1961, 4, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, true, 3600, "D" },
+		{ 1959, 1959, 10, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1960, 1961, 9, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1916, 1916, 5, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "S" },
+		{ 1916, 1916, 10, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1920, 1920, 3, { compiled_on_t::day, 0, 28 }, 0, 0, true, 3600, "S" },
+		{ 1920, 1920, 10, { compiled_on_t::day, 0, 25 }, 0, 0, false, 0, "" },
+		{ 1921, 1921, 4, { compiled_on_t::day, 0, 3 }, 0, 0, true, 3600, "S" },
+		{ 1921, 1921, 10, { compiled_on_t::day, 0, 3 }, 0, 0, false, 0, "" },
+		{ 1922, 1922, 3, { compiled_on_t::day, 0, 26 }, 0, 0, true, 3600, "S" },
+		{ 1922, 1922, 10, { compiled_on_t::day, 0, 8 }, 0, 0, false, 0, "" },
+		{ 1924, 1924, 5, { compiled_on_t::day, 0, 13 }, 0, 0, true, 3600, "S" },
+		{ 1924, 1925, 10, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1925, 1925, 5, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "S" },
+		{ 1940, 1940, 7, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "S" },
+		{ 1940, 1940, 10, { compiled_on_t::day, 0, 6 }, 0, 0, false, 0, "" },
+		{ 1940, 1940, 12, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "S" },
+		{ 1941, 1941, 9, { compiled_on_t::day, 0, 21 }, 0, 0, false, 0, "" },
+		{ 1942, 1942, 4, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "S" },
+		{ 1945, 1945, 10, { compiled_on_t::day, 0, 8 }, 0, 0, false, 0, "" },
+		{ 1946, 1946, 6, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "S" },
+		{ 1946, 1946, 10, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1947, 1948, 4, { compiled_on_t::weekday_ge, 0, 16 }, 0, 0, true, 3600, "S" },
+		{ 1947, 1951, 10, { compiled_on_t::weekday_ge, 0, 2 }, 0, 0, false, 0, "" },
+		{ 1949, 1949, 4, { compiled_on_t::day, 0, 10 }, 0, 0, true, 3600, "S" },
+		{ 1950, 1950, 4, { compiled_on_t::day, 0, 16 }, 0, 0, true, 3600, "S" },
+		{ 1951, 1951, 4, { compiled_on_t::day, 0, 22 }, 0, 0, true, 3600, "S" },
+		{ 1962, 1962, 7, { compiled_on_t::day, 0, 15 }, 0, 0, true, 3600, "S" },
+		{ 1963, 1963, 10, { compiled_on_t::day, 0, 30 }, 0, 0, false, 0, "" },
+		{ 1964, 1964, 5, { compiled_on_t::day, 0, 15 }, 0, 0, true, 3600, "S" },
+		{ 1964, 1964, 10, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1973, 1973, 6, { compiled_on_t::day, 0, 3 }, 3600, 0, true, 3600, "S" },
+		{ 1973, 1976, 10, { compiled_on_t::weekday_ge, 0, 31 }, 7200, 0, false, 0, "" },
+		{ 1974, 1974, 3, { compiled_on_t::day, 0, 31 }, 7200, 0, true, 3600, "S" },
+		{ 1975, 1975, 3, { compiled_on_t::day, 0, 22 }, 7200, 0, true, 3600, "S" },
+		{ 1976, 1976, 3, { compiled_on_t::day, 0, 21 }, 7200, 0, true, 3600, "S" },
+		{ 1977, 1978, 4, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 0, true, 3600, "S" },
+		{ 1977, 1978, 10, { compiled_on_t::weekday_ge, 0, 15 }, 7200, 0, false, 0, "" },
+		{ 1978, 1978, 6, { compiled_on_t::day, 0, 29 }, 0, 0, false, 0, "" },
+		{ 1983, 1983, 7, { compiled_on_t::day, 0, 31 }, 7200, 0, true, 3600, "S" },
+		{ 1983, 1983, 10, { compiled_on_t::day, 0, 2 }, 7200, 0, false, 0, "" },
+		{ 1985, 1985, 4, { compiled_on_t::day, 0, 20 }, 3600, 1, true, 3600, "S" },
+		{ 1985, 1985, 9, { compiled_on_t::day, 0, 28 }, 3600, 1, false, 0, "" },
+		{ 1986, 1993, 3, { compiled_on_t::last_weekday, 0, 0 }, 3600, 1, true, 3600, "S" },
+		{ 1986, 1995, 9, { compiled_on_t::last_weekday, 0, 0 }, 3600, 1, false, 0, "" },
+		{ 1994, 1994, 3, { compiled_on_t::day, 0, 20 }, 3600, 1, true, 3600, "S" },
+		{ 1995, 2006, 3, { compiled_on_t::last_weekday, 0, 0 }, 3600, 1, true, 3600, "S" },
+		{ 1996, 2006, 10, { compiled_on_t::last_weekday, 0, 0 }, 3600, 1, false, 0, "" },
+		{ 1999, 1999, 10, { compiled_on_t::day, 0, 7 }, 7200, 1, true, 3600, "" },
+		{ 2000, 2000, 3, { compiled_on_t::day, 0, 19 }, 7200, 1, false, 0, "" },
+		{ 2000, 2001, 11, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 0, true, 3600, "" },
+		{ 2001, 2002, 1, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "" },
+		{ 2016, 2016, 11, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 0, true, 3600, "" },
+		{ 2017, 2017, 1, { compiled_on_t::weekday_ge, 0, 15 }, 10800, 0, false, 0, "" },
+		{ 1991, 1992, 3, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, true, 3600, "D" },
+		{ 1991, 1992, 9, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1993, 2006, 4, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 0, true, 3600, "D" },
+		{ 1993, 2006, 10, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 2007, 32767, 3, { compiled_on_t::weekday_ge, 0, 8 }, 7200, 0, true, 3600, "D" },
+		{ 2007, 32767, 11, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 0, false, 0, "S" },
+		{ 2005, 32767, 3, { compiled_on_t::last_weekday, 0, 0 }, 3600, 2, true, 7200, "+02" },
+		{ 2004, 32767, 10, { compiled_on_t::last_weekday, 0, 0 }, 3600, 2, false, 0, "+00" },
+		{ 1923, 1925, 10, { compiled_on_t::day, 0, 1 }, 0, 0, true, 1800, "" },
+		{ 1924, 1926, 4, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1933, 1938, 10, { compiled_on_t::last_weekday, 0, 0 }, 0, 0, true, 1800, "" },
+		{ 1934, 1941, 3, { compiled_on_t::last_weekday, 6, 0 }, 86400, 0, false, 0, "" },
+		{ 1939, 1939, 10, { compiled_on_t::day, 0, 1 }, 0, 0, true, 1800, "" },
+		{ 1940, 1940, 10, { compiled_on_t::day, 0, 27 }, 0, 0, true, 1800, "" },
+		{ 1941, 1941, 8, { compiled_on_t::day, 0, 1 }, 0, 0, true, 1800, "" },
+		{ 1942, 1942, 12, { compiled_on_t::day, 0, 14 }, 0, 0, true, 1800, "" },
+		{ 1943, 1943, 3, { compiled_on_t::day, 0, 14 }, 0, 0, false, 0, "" },
+		{ 1959, 1959, 5, { compiled_on_t::day, 0, 24 }, 0, 0, true, 1800, "" },
+		{ 1959, 1959, 11, { compiled_on_t::day, 0, 15 }, 0, 0, false, 0, "" },
+		{ 1960, 1960, 1, { compiled_on_t::day, 0, 17 }, 0, 0, true, 3600, "" },
+		{ 1960, 1960, 3, { compiled_on_t::day, 0, 6 }, 0, 0, false, 0, "" },
+		{ 1965, 1965, 4, { compiled_on_t::day, 0, 4 }, 0, 0, true, 3600, "" },
+		{ 1965, 1965, 9, { compiled_on_t::day, 0, 26 }, 0, 0, false, 0, "" },
+		{ 1968, 1968, 5, { compiled_on_t::day, 0, 27 }, 0, 0, true, 1800, "" },
+		{ 1968, 1968, 12, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1970, 1970, 4, { compiled_on_t::day, 0, 25 }, 0, 0, true, 3600, "" },
+		{ 1970, 1970, 6, { compiled_on_t::day, 0, 14 }, 0, 0, false, 0, "" },
+		{ 1972, 1972, 4, { compiled_on_t::day, 0, 23 }, 0, 0, true, 3600, "" },
+		{ 1972, 1972, 7, { compiled_on_t::day, 0, 16 }, 0, 0, false, 0, "" },
+		{ 1974, 1974, 1, { compiled_on_t::day, 0, 13 }, 0, 0, true, 5400, "" },
+		{ 1974, 1974, 3, { compiled_on_t::day, 0, 10 }, 0, 0, true, 1800, "" },
+		{ 1974, 1974, 9, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1974, 1974, 12, { compiled_on_t::day, 0, 22 }, 0, 0, true, 3600, "" },
+		{ 1975, 1975, 3, { compiled_on_t::day, 0, 30 }, 0, 0, false, 0, "" },
+		{ 1976, 1976, 12, { compiled_on_t::day, 0, 19 }, 0, 0, true, 3600, "" },
+		{ 1977, 1977, 3, { compiled_on_t::day, 0, 6 }, 0, 0, false, 0, "" },
+		{ 1977, 1977, 12, { compiled_on_t::day, 0, 4 }, 0, 0, true, 3600, "" },
+		{ 1978, 1979, 3, { compiled_on_t::weekday_ge, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1978, 1978, 12, { compiled_on_t::day, 0, 17 }, 0, 0, true, 3600, "" },
+		{ 1979, 1979, 4, { compiled_on_t::day, 0, 29 }, 0, 0, true, 3600, "" },
+		{ 1980, 1980, 3, { compiled_on_t::day, 0, 16 }, 0, 0, false, 0, "" },
+		{ 1987, 1987, 12, { compiled_on_t::day, 0, 14 }, 0, 0, true, 3600, "" },
+		{ 1988, 1988, 2, { compiled_on_t::day, 0, 28 }, 0, 0, false, 0, "" },
+		{ 1988, 1988, 12, { compiled_on_t::day, 0, 11 }, 0, 0, true, 3600, "" },
+		{ 1989, 1989, 3, { compiled_on_t::day, 0, 5 }, 0, 0, false, 0, "" },
+		{ 1989, 1989, 10, { compiled_on_t::day, 0, 29 }, 0, 0, true, 3600, "" },
+		{ 1990, 1990, 2, { compiled_on_t::day, 0, 25 }, 0, 0, false, 0, "" },
+		{ 1990, 1991, 10, { compiled_on_t::weekday_ge, 0, 21 }, 0, 0, true, 3600, "" },
+		{ 1991, 1992, 3, { compiled_on_t::weekday_ge, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1992, 1992, 10, { compiled_on_t::day, 0, 18 }, 0, 0, true, 3600, "" },
+		{ 1993, 1993, 2, { compiled_on_t::day, 0, 28 }, 0, 0, false, 0, "" },
+		{ 2004, 2004, 9, { compiled_on_t::day, 0, 19 }, 0, 0, true, 3600, "" },
+		{ 2005, 2005, 3, { compiled_on_t::day, 0, 27 }, 7200, 0, false, 0, "" },
+		{ 2005, 2005, 10, { compiled_on_t::day, 0, 9 }, 7200, 0, true, 3600, "" },
+		{ 2006, 2015, 3, { compiled_on_t::weekday_ge, 0, 8 }, 7200, 0, false, 0, "" },
+		{ 2006, 2014, 10, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 0, true, 3600, "" },
+		{ 1946, 1946, 4, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, true, 3600, "D" },
+		{ 1946, 1946, 9, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1953, 1954, 4, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, true, 3600, "D" },
+		{ 1953, 1959, 9, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1955, 1955, 5, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "D" },
+		{ 1956, 1963, 4, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, true, 3600, "D" },
+		{ 1960, 1960, 10, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1961, 1961, 9, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1962, 1963, 10, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1973, 1973, 12, { compiled_on_t::day, 0, 22 }, 43200, 2, true, 3600, "" },
+		{ 1974, 1974, 3, { compiled_on_t::day, 0, 30 }, 43200, 2, false, 0, "" },
+		{ 1983, 1991, 9, { compiled_on_t::weekday_ge, 6, 22 }, 86400, 0, true, 3600, "" },
+		{ 1984, 1991, 3, { compiled_on_t::weekday_ge, 6, 22 }, 86400, 0, false, 0, "" },
+		{ 1992, 1993, 1, { compiled_on_t::weekday_ge, 6, 22 }, 86400, 0, false, 0, "" },
+		{ 1992, 1992, 10, { compiled_on_t::weekday_ge, 6, 22 }, 86400, 0, true, 3600, "" },
+		{ 1918, 1918, 4, { compiled_on_t::day, 0, 14 }, 7200, 0, true, 3600, "D" },
+		{ 1918, 1918, 10, { compiled_on_t::day, 0, 27 }, 7200, 0, false, 0, "S" },
+		{ 1942, 1942, 2, { compiled_on_t::day, 0, 9 }, 7200, 0, true, 3600, "W" },
+		{ 1945, 1945, 8, { compiled_on_t::day, 0, 14 }, 82800, 2, true, 3600, "P" },
+		{ 1945, 1945, 9, { compiled_on_t::day, 0, 30 }, 7200, 0, false, 0, "S" },
+		{ 1946, 1986, 4, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, true, 3600, "D" },
+		{ 1946, 1946, 9, { compiled_on_t::day, 0, 29 }, 7200, 0, false, 0, "S" },
+		{ 1947, 1961, 9, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1962, 2006, 10, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1916, 1916, 4, { compiled_on_t::day, 0, 23 }, 0, 0, true, 3600, "D" },
+		{ 1916, 1916, 9, { compiled_on_t::day, 0, 17 }, 0, 0, false, 0, "S" },
+		{ 1918, 1918, 4, { compiled_on_t::day, 0, 14 }, 7200, 0, true, 3600, "D" },
+		{ 1918, 1918, 10, { compiled_on_t::day, 0, 27 }, 7200, 0, false, 0, "S" },
+		{ 1937, 1937, 5, { compiled_on_t::day, 0, 16 }, 7200, 0, true, 3600, "D" },
+		{ 1937, 1937, 9, { compiled_on_t::day, 0, 26 }, 7200, 0, false, 0, "S" },
+		{ 1942, 1942, 2, { compiled_on_t::day, 0, 9 }, 7200, 0, true, 3600, "W" },
+		{ 1945, 1945, 8, { compiled_on_t::day, 0, 14 }, 82800, 2, true, 3600, "P" },
+		{ 1945, 1945, 9, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1946, 1946, 5, { compiled_on_t::day, 0, 12 }, 7200, 0, true, 3600, "D" },
+		{ 1946, 1946, 10, { compiled_on_t::day, 0, 13 }, 7200, 0, false, 0, "S" },
+		{ 1947, 1949, 4, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, true, 3600, "D" },
+		{ 1947, 1949, 9, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1950, 1950, 5, { compiled_on_t::day, 0, 1 }, 7200, 0, true, 3600, "D" },
+		{ 1950, 1950, 9, { compiled_on_t::day, 0, 30 }, 7200, 0, false, 0, "S" },
+		{ 1951, 1960, 4, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, true, 3600, "D" },
+		{ 1951, 1958, 9, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1959, 1959, 10, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1960, 1960, 9, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1963, 1963, 4, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, true, 3600, "D" },
+		{ 1963, 1963, 9, { compiled_on_t::day, 0, 22 }, 7200, 0, false, 0, "S" },
+		{ 1966, 1986, 4, { compiled_on_t::last_weekday, 0, 0 }, 7200, 1, true, 3600, "D" },
+		{ 1966, 2005, 10, { compiled_on_t::last_weekday, 0, 0 }, 7200, 1, false, 0, "S" },
+		{ 1987, 2005, 4, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 1, true, 3600, "D" },
+		{ 1977, 1980, 4, { compiled_on_t::weekday_ge, 0, 1 }, 3600, 1, true, 3600, "S" },
+		{ 1977, 1977, 9, { compiled_on_t::last_weekday, 0, 0 }, 3600, 1, false, 0, "" },
+		{ 1978, 1978, 10, { compiled_on_t::day, 0, 1 }, 3600, 1, false, 0, "" },
+		{ 1979, 1995, 9, { compiled_on_t::last_weekday, 0, 0 }, 3600, 1, false, 0, "" },
+		{ 1981, 32767, 3, { compiled_on_t::last_weekday, 0, 0 }, 3600, 1, true, 3600, "S" },
+		{ 1996, 32767, 10, { compiled_on_t::last_weekday, 0, 0 }, 3600, 1, false, 0, "" },
+		{ 2010, 2010, 9, { compiled_on_t::last_weekday, 0, 0 }, 0, 0, true, 3600, "" },
+		{ 2011, 2011, 4, { compiled_on_t::weekday_ge, 6, 1 }, 14400, 0, false, 0, "" },
+		{ 2011, 2011, 9, { compiled_on_t::last_weekday, 6, 0 }, 10800, 0, true, 3600, "" },
+		{ 2012, 2021, 4, { compiled_on_t::weekday_ge, 0, 1 }, 14400, 0, false, 0, "" },
+		{ 2012, 2020, 9, { compiled_on_t::last_weekday, 0, 0 }, 10800, 0, true, 3600, "" },
+		{ 1983, 1984, 4, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "" },
+		{ 1983, 1983, 10, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1985, 1998, 3, { compiled_on_t::last_weekday, 0, 0 }, 0, 0, true, 3600, "" },
+		{ 1984, 1998, 9, { compiled_on_t::last_weekday, 0, 0 }, 0, 0, false, 0, "" },
+		{ 2001, 2001, 4, { compiled_on_t::last_weekday, 6, 0 }, 7200, 0, true, 3600, "" },
+		{ 2001, 2006, 9, { compiled_on_t::last_weekday, 6, 0 }, 7200, 0, false, 0, "" },
+		{ 2002, 2006, 3, { compiled_on_t::last_weekday, 6, 0 }, 7200, 0, true, 3600, "" },
+		{ 2015, 2016, 3, { compiled_on_t::last_weekday, 6, 0 }, 7200, 0, true, 3600, "" },
+		{ 2015, 2016, 9, { compiled_on_t::last_weekday, 6, 0 }, 0, 0, false, 0, "" },
+		{ 1918, 1918, 4, { compiled_on_t::day, 0, 14 }, 7200, 0, true, 3600, "D" },
+		{ 1918, 1918, 10, { compiled_on_t::day, 0, 27 }, 7200, 0, false, 0, "S" },
+		{ 1919, 1919, 5, { compiled_on_t::day, 0, 25 }, 7200, 0, true, 3600, "D" },
+		{ 1919, 1919, 11, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "S" },
+		{ 1942, 1942, 2, { compiled_on_t::day, 0, 9 }, 7200, 0, true, 3600, "W" },
+		{ 1945, 1945, 8, { compiled_on_t::day, 0, 14 }, 82800, 2, true, 3600, "P" },
+		{ 1945, 1945, 9, { compiled_on_t::day, 0, 30 }, 7200, 0, false, 0, "S" },
+		{ 1972, 1986, 4, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, true, 3600, "D" },
+		{ 1972, 2006, 10, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1987, 2006, 4, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 0, true, 3600, "D" },
+		{ 1965, 1965, 4, { compiled_on_t::last_weekday, 0, 0 }, 0, 0, true, 7200, "DD" },
+		{ 1965, 1965, 10, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1940, 1940, 5, { compiled_on_t::day, 0, 31 }, 86400, 2, true, 3600, "D" },
+		{ 1940, 1940, 9, { compiled_on_t::day, 0, 30 }, 86400, 2, false, 0, "S" },
+		{ 1940, 1940, 11, { compiled_on_t::day, 0, 16 }, 86400, 2, true, 3600, "D" },
+		{ 1942, 1946, 10, { compiled_on_t::day, 0, 31 }, 86400, 2, false, 0, "S" },
+		{ 1943, 1944, 3, { compiled_on_t::day, 0, 31 }, 86400, 2, true, 3600, "D" },
+		{ 1945, 1946, 4, { compiled_on_t::day, 0, 15 }, 86400, 2, true, 3600, "D" },
+		{ 1948, 1948, 5, { compiled_on_t::day, 0, 22 }, 86400, 2, true, 7200, "DD" },
+		{ 1948, 1948, 8, { compiled_on_t::day, 0, 31 }, 86400, 2, true, 3600, "D" },
+		{ 1948, 1949, 10, { compiled_on_t::day, 0, 31 }, 86400, 2, false, 0, "S" },
+		{ 1949, 1949, 4, { compiled_on_t::day, 0, 30 }, 86400, 2, true, 3600, "D" },
+		{ 1950, 1950, 4, { compiled_on_t::day, 0, 15 }, 86400, 2, true, 3600, "D" },
+		{ 1950, 1950, 9, { compiled_on_t::day, 0, 14 }, 86400, 2, false, 0, "S" },
+		{ 1951, 1951, 3, { compiled_on_t::day, 0, 31 }, 86400, 2, true, 3600, "D" },
+		{ 1951, 1951, 11, { compiled_on_t::day, 0, 10 }, 86400, 2, false, 0, "S" },
+		{ 1952, 1952, 4, { compiled_on_t::day, 0, 19 }, 86400, 2, true, 3600, "D" },
+		{ 1952, 1952, 10, { compiled_on_t::day, 0, 18 }, 86400, 2, false, 0, "S" },
+		{ 1953, 1953, 4, { compiled_on_t::day, 0, 11 }, 86400, 2, true, 3600, "D" },
+		{ 1953, 1953, 9, { compiled_on_t::day, 0, 12 }, 86400, 2, false, 0, "S" },
+		{ 1954, 1954, 6, { compiled_on_t::day, 0, 12 }, 86400, 2, true, 3600, "D" },
+		{ 1954, 1954, 9, { compiled_on_t::day, 0, 11 }, 86400, 2, false, 0, "S" },
+		{ 1955, 1955, 6, { compiled_on_t::day, 0, 11 }, 86400, 2, true, 3600, "D" },
+		{ 1955, 1955, 9, { compiled_on_t::day, 0, 10 }, 86400, 2, false, 0, "S" },
+		{ 1956, 1956, 6, { compiled_on_t::day, 0, 2 }, 86400, 2, true, 3600, "D" },
+		{ 1956, 1956, 9, { compiled_on_t::day, 0, 29 }, 86400, 2, false, 0, "S" },
+		{ 1957, 1957, 4, { compiled_on_t::day, 0, 27 }, 86400, 2, true, 3600, "D" },
+		{ 1957, 1957, 9, { compiled_on_t::day, 0, 21 }, 86400, 2, false, 0, "S" },
+		{ 1974, 1974, 7, { compiled_on_t::day, 0, 6 }, 86400, 0, true, 3600, "D" },
+		{ 1974, 1974, 10, { compiled_on_t::day, 0, 12 }, 86400, 0, false, 0, "S" },
+		{ 1975, 1975, 4, { compiled_on_t::day, 0, 19 }, 86400, 0, true, 3600, "D" },
+		{ 1975, 1975, 8, { compiled_on_t::day, 0, 30 }, 86400, 0, false, 0, "S" },
+		{ 1980, 1980, 8, { compiled_on_t::day, 0, 2 }, 86400, 1, true, 3600, "D" },
+		{ 1980, 1980, 9, { compiled_on_t::day, 0, 13 }, 86400, 1, false, 0, "S" },
+		{ 1984, 1984, 5, { compiled_on_t::day, 0, 5 }, 86400, 1, true, 3600, "D" },
+		{ 1984, 1984, 8, { compiled_on_t::day, 0, 25 }, 86400, 1, false, 0, "S" },
+		{ 1985, 1985, 4, { compiled_on_t::day, 0, 13 }, 86400, 0, true, 3600, "D" },
+		{ 1985, 1985, 8, { compiled_on_t::day, 0, 31 }, 86400, 0, false, 0, "S" },
+		{ 1986, 1986, 5, { compiled_on_t::day, 0, 17 }, 86400, 0, true, 3600, "D" },
+		{ 1986, 1986, 9, { compiled_on_t::day, 0, 6 }, 86400, 0, false, 0, "S" },
+		{ 1987, 1987, 4, { compiled_on_t::day, 0, 14 }, 86400, 0, true, 3600, "D" },
+		{ 1987, 1987, 9, { compiled_on_t::day, 0, 12 }, 86400, 0, false, 0, "S" },
+		{ 1988, 1988, 4, { compiled_on_t::day, 0, 9 }, 86400, 0, true, 3600, "D" },
+		{ 1988, 1988, 9, { compiled_on_t::day, 0, 3 }, 86400, 0, false, 0, "S" },
+		{ 1989, 1989, 4, { compiled_on_t::day, 0, 29 }, 86400, 0, true, 3600, "D" },
+		{ 1989, 1989, 9, { compiled_on_t::day, 0, 2 }, 86400, 0, false, 0, "S" },
+		{ 1990, 1990, 3, { compiled_on_t::day, 0, 24 }, 86400, 0, true, 3600, "D" },
+		{ 1990, 1990, 8, { compiled_on_t::day, 0, 25 }, 86400, 0, false, 0, "S" },
+		{ 1991, 1991, 3, { compiled_on_t::day, 0, 23 }, 86400, 0, true, 3600, "D" },
+		{ 1991, 1991, 8, { compiled_on_t::day, 0, 31 }, 86400, 0, false, 0, "S" },
+		{ 1992, 1992, 3, { compiled_on_t::day, 0, 28 }, 86400, 0, true, 3600, "D" },
+		{ 1992, 1992, 9, { compiled_on_t::day, 0, 5 }, 86400, 0, false, 0, "S" },
+		{ 1993, 1993, 4, { compiled_on_t::day, 0, 2 }, 0, 0, true, 3600, "D" },
+		{ 1993, 1993, 9, { compiled_on_t::day, 0, 5 }, 0, 0, false, 0, "S" },
+		{ 1994, 1994, 4, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "D" },
+		{ 1994, 1994, 8, { compiled_on_t::day, 0, 28 }, 0, 0, false, 0, "S" },
+		{ 1995, 1995, 3, { compiled_on_t::day, 0, 31 }, 0, 0, true, 3600, "D" },
+		{ 1995, 1995, 9, { compiled_on_t::day, 0, 3 }, 0, 0, false, 0, "S" },
+		{ 1996, 1996, 3, { compiled_on_t::day, 0, 14 }, 86400, 0, true, 3600, "D" },
+		{ 1996, 1996, 9, { compiled_on_t::day, 0, 15 }, 86400, 0, false, 0, "S" },
+		{ 1997, 1997, 3, { compiled_on_t::day, 0, 20 }, 86400, 0, true, 3600, "D" },
+		{ 1997, 1997, 9, { compiled_on_t::day, 0, 13 }, 86400, 0, false, 0, "S" },
+		{ 1998, 1998, 3, { compiled_on_t::day, 0, 20 }, 0, 0, true, 3600, "D" },
+		{ 1998, 1998, 9, { compiled_on_t::day, 0, 6 }, 0, 0, false, 0, "S" },
+		{ 1999, 1999, 4, { compiled_on_t::day, 0, 2 }, 7200, 0, true, 3600, "D" },
+		{ 1999, 1999, 9, { compiled_on_t::day, 0, 3 }, 7200, 0, false, 0, "S" },
+		{ 2000, 2000, 4, { compiled_on_t::day, 0, 14 }, 7200, 0, true, 3600, "D" },
+		{ 2000, 2000, 10, { compiled_on_t::day, 0, 6 }, 3600, 0, false, 0, "S" },
+		{ 2001, 2001, 4, { compiled_on_t::day, 0, 9 }, 3600, 0, true, 3600, "D" },
+		{ 2001, 2001, 9, { compiled_on_t::day, 0, 24 }, 3600, 0, false, 0, "S" },
+		{ 2002, 2002, 3, { compiled_on_t::day, 0, 29 }, 3600, 0, true, 3600, "D" },
+		{ 2002, 2002, 10, { compiled_on_t::day, 0, 7 }, 3600, 0, false, 0, "S" },
+		{ 2003, 2003, 3, { compiled_on_t::day, 0, 28 }, 3600, 0, true, 3600, "D" },
+		{ 2003, 2003, 10, { compiled_on_t::day, 0, 3 }, 3600, 0, false, 0, "S" },
+		{ 2004, 2004, 4, { compiled_on_t::day, 0, 7 }, 3600, 0, true, 3600, "D" },
+		{ 2004, 2004, 9, { compiled_on_t::day, 0, 22 }, 3600, 0, false, 0, "S" },
+		{ 2005, 2012, 4, { compiled_on_t::weekday_le, 5, 1 }, 7200, 0, true, 3600, "D" },
+		{ 2005, 2005, 10, { compiled_on_t::day, 0, 9 }, 7200, 0, false, 0, "S" },
+		{ 2006, 2006, 10, { compiled_on_t::day, 0, 1 }, 7200, 0, false, 0, "S" },
+		{ 2007, 2007, 9, { compiled_on_t::day, 0, 16 }, 7200, 0, false, 0, "S" },
+		{ 2008, 2008, 10, { compiled_on_t::day, 0, 5 }, 7200, 0, false, 0, "S" },
+		{ 2009, 2009, 9, { compiled_on_t::day, 0, 27 }, 7200, 0, false, 0, "S" },
+		{ 2010, 2010, 9, { compiled_on_t::day, 0, 12 }, 7200, 0, false, 0, "S" },
+		{ 2011, 2011, 10, { compiled_on_t::day, 0, 2 }, 7200, 0, false, 0, "S" },
+		{ 2012, 2012, 9, { compiled_on_t::day, 0, 23 }, 7200, 0, false, 0, "S" },
+		{ 2013, 32767, 3, { compiled_on_t::weekday_ge, 5, 23 }, 7200, 0, true, 3600, "D" },
+		{ 2013, 32767, 10, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1942, 1943, 4, { compiled_on_t::day, 0, 30 }, 82800, 0, true, 3600, "" },
+		{ 1942, 1942, 11, { compiled_on_t::day, 0, 17 }, 82800, 0, false, 0, "" },
+		{ 1943, 1943, 9, { compiled_on_t::day, 0, 30 }, 82800, 0, false, 0, "S" },
+		{ 1946, 1946, 4, { compiled_on_t::day, 0, 30 }, 82800, 1, true, 3600, "D" },
+		{ 1946, 1946, 9, { compiled_on_t::day, 0, 30 }, 82800, 1, false, 0, "S" },
+		{ 1947, 1947, 4, { compiled_on_t::day, 0, 19 }, 82800, 1, true, 3600, "D" },
+		{ 1947, 1947, 11, { compiled_on_t::day, 0, 30 }, 82800, 1, false, 0, "S" },
+		{ 1948, 1948, 5, { compiled_on_t::day, 0, 2 }, 82800, 1, true, 3600, "D" },
+		{ 1948, 1948, 10, { compiled_on_t::day, 0, 31 }, 82800, 1, false, 0, "S" },
+		{ 1949, 1950, 4, { compiled_on_t::weekday_ge, 6, 1 }, 82800, 1, true, 3600, "D" },
+		{ 1949, 1950, 10, { compiled_on_t::last_weekday, 6, 0 }, 82800, 1, false, 0, "S" },
+		{ 1951, 1951, 3, { compiled_on_t::day, 0, 31 }, 82800, 1, true, 3600, "D" },
+		{ 1951, 1951, 10, { compiled_on_t::day, 0, 28 }, 82800, 1, false, 0, "S" },
+		{ 1952, 1953, 4, { compiled_on_t::weekday_ge, 6, 1 }, 82800, 1, true, 3600, "D" },
+		{ 1952, 1952, 11, { compiled_on_t::day, 0, 1 }, 82800, 1, false, 0, "S" },
+		{ 1953, 1954, 10, { compiled_on_t::last_weekday, 6, 0 }, 82800, 1, false, 0, "S" },
+		{ 1954, 1956, 3, { compiled_on_t::weekday_ge, 6, 17 }, 82800, 1, true, 3600, "D" },
+		{ 1955, 1955, 11, { compiled_on_t::day, 0, 5 }, 82800, 1, false, 0, "S" },
+		{ 1956, 1964, 11, { compiled_on_t::weekday_ge, 0, 1 }, 12600, 0, false, 0, "S" },
+		{ 1957, 1964, 3, { compiled_on_t::weekday_ge, 0, 18 }, 12600, 0, true, 3600, "D" },
+		{ 1965, 1973, 4, { compiled_on_t::weekday_ge, 0, 16 }, 12600, 0, true, 3600, "D" },
+		{ 1965, 1966, 10, { compiled_on_t::weekday_ge, 0, 16 }, 9000, 0, false, 0, "S" },
+		{ 1967, 1976, 10, { compiled_on_t::weekday_ge, 0, 16 }, 12600, 0, false, 0, "S" },
+		{ 1973, 1973, 12, { compiled_on_t::day, 0, 30 }, 12600, 0, true, 3600, "D" },
+		{ 1975, 1976, 4, { compiled_on_t::weekday_ge, 0, 16 }, 12600, 0, true, 3600, "D" },
+		{ 1979, 1979, 5, { compiled_on_t::day, 0, 13 }, 12600, 0, true, 3600, "D" },
+		{ 1979, 1979, 10, { compiled_on_t::weekday_ge, 0, 16 }, 12600, 0, false, 0, "S" },
+		{ 1920, 1920, 4, { compiled_on_t::day, 0, 5 }, 7200, 1, true, 3600, "S" },
+		{ 1920, 1920, 9, { compiled_on_t::day, 0, 13 }, 7200, 1, false, 0, "" },
+		{ 1946, 1946, 4, { compiled_on_t::day, 0, 14 }, 7200, 1, true, 3600, "S" },
+		{ 1946, 1946, 10, { compiled_on_t::day, 0, 7 }, 7200, 1, false, 0, "" },
+		{ 1947, 1948, 10, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 1, false, 0, "" },
+		{ 1947, 1947, 4, { compiled_on_t::day, 0, 6 }, 7200, 1, true, 3600, "S" },
+		{ 1948, 1948, 4, { compiled_on_t::day, 0, 18 }, 7200, 1, true, 3600, "S" },
+		{ 1980, 1980, 4, { compiled_on_t::day, 0, 6 }, 0, 0, true, 3600, "S" },
+		{ 1980, 1980, 9, { compiled_on_t::day, 0, 28 }, 0, 0, false, 0, "" },
+		{ 1918, 1918, 3, { compiled_on_t::day, 0, 9 }, 0, 1, true, 3600, "S" },
+		{ 1918, 1919, 10, { compiled_on_t::weekday_ge, 6, 1 }, 82800, 1, false, 0, "" },
+		{ 1919, 1919, 3, { compiled_on_t::day, 0, 1 }, 82800, 1, true, 3600, "S" },
+		{ 1920, 1920, 2, { compiled_on_t::day, 0, 14 }, 82800, 1, true, 3600, "S" },
+		{ 1920, 1920, 10, { compiled_on_t::day, 0, 23 }, 82800, 1, false, 0, "" },
+		{ 1921, 1921, 3, { compiled_on_t::day, 0, 14 }, 82800, 1, true, 3600, "S" },
+		{ 1921, 1921, 10, { compiled_on_t::day, 0, 25 }, 82800, 1, false, 0, "" },
+		{ 1922, 1922, 3, { compiled_on_t::day, 0, 25 }, 82800, 1, true, 3600, "S" },
+		{ 1922, 1927, 10, { compiled_on_t::weekday_ge, 6, 1 }, 82800, 1, false, 0, "" },
+		{ 1923, 1923, 4, { compiled_on_t::day, 0, 21 }, 82800, 1, true, 3600, "S" },
+		{ 1924, 1924, 3, { compiled_on_t::day, 0, 29 }, 82800, 1, true, 3600, "S" },
+		{ 1925, 1925, 4, { compiled_on_t::day, 0, 4 }, 82800, 1, true, 3600, "S" },
+		{ 1926, 1926, 4, { compiled_on_t::day, 0, 17 }, 82800, 1, true, 3600, "S" },
+		{ 1927, 1927, 4, { compiled_on_t::day, 0, 9 }, 82800, 1, true, 3600, "S" },
+		{ 1928, 1928, 4, { compiled_on_t::day, 0, 14 }, 82800, 1, true, 3600, "S" },
+		{ 1928, 1938, 10, { compiled_on_t::weekday_ge, 0, 2 }, 7200, 1, false, 0, "" },
+		{ 1929, 1929, 4, { compiled_on_t::day, 0, 21 }, 7200, 1, true, 3600, "S" },
+		{ 1930, 1930, 4, { compiled_on_t::day, 0, 13 }, 7200, 1, true, 3600, "S" },
+		{ 1931, 1931, 4, { compiled_on_t::day, 0, 19 }, 7200, 1, true, 3600, "S" },
+		{ 1932, 1932, 4, { compiled_on_t::day, 0, 3 }, 7200, 1, true, 3600, "S" },
+		{ 1933, 1933, 3, { compiled_on_t::day, 0, 26 }, 7200, 1, true, 3600, "S" },
+		{ 1934, 1934, 4, { compiled_on_t::day, 0, 8 }, 7200, 1, true, 3600, "S" },
+		{ 1935, 1935, 3, { compiled_on_t::day, 0, 31 }, 7200, 1, true, 3600, "S" },
+		{ 1936, 1936, 4, { compiled_on_t::day, 0, 19 }, 7200, 1, true, 3600, "S" },
+		{ 1937, 1937, 4, { compiled_on_t::day, 0, 4 }, 7200, 1, true, 3600, "S" },
+		{ 1938, 1938, 3, { compiled_on_t::day, 0, 27 }, 7200, 1, true, 3600, "S" },
+		{ 1939, 1939, 4, { compiled_on_t::day, 0, 16 }, 7200, 1, true, 3600, "S" },
+		{ 1939, 1939, 11, { compiled_on_t::day, 0, 19 }, 7200, 1, false, 0, "" },
+		{ 1940, 1940, 2, { compiled_on_t::day, 0, 25 }, 7200, 1, true, 3600, "S" },
+		{ 1944, 1944, 9, { compiled_on_t::day, 0, 17 }, 7200, 1, false, 0, "" },
+		{ 1945, 1945, 4, { compiled_on_t::day, 0, 2 }, 7200, 1, true, 3600, "S" },
+		{ 1945, 1945, 9, { compiled_on_t::day, 0, 16 }, 7200, 1, false, 0, "" },
+		{ 1946, 1946, 5, { compiled_on_t::day, 0, 19 }, 7200, 1, true, 3600, "S" },
+		{ 1946, 1946, 10, { compiled_on_t::day, 0, 7 }, 7200, 1, false, 0, "" },
+		{ 1916, 1916, 4, { compiled_on_t::day, 0, 30 }, 82800, 0, true, 3600, "S" },
+		{ 1916, 1916, 10, { compiled_on_t::day, 0, 1 }, 3600, 0, false, 0, "" },
+		{ 1917, 1918, 4, { compiled_on_t::weekday_ge, 1, 15 }, 7200, 1, true, 3600, "S" },
+		{ 1917, 1918, 9, { compiled_on_t::weekday_ge, 1, 15 }, 7200, 1, false, 0, "" },
+		{ 1940, 1940, 4, { compiled_on_t::day, 0, 1 }, 7200, 1, true, 3600, "S" },
+		{ 1942, 1942, 11, { compiled_on_t::day, 0, 2 }, 7200, 1, false, 0, "" },
+		{ 1943, 1943, 3, { compiled_on_t::day, 0, 29 }, 7200, 1, true, 3600, "S" },
+		{ 1943, 1943, 10, { compiled_on_t::day, 0, 4 }, 7200, 1, false, 0, "" },
+		{ 1944, 1945, 4, { compiled_on_t::weekday_ge, 1, 1 }, 7200, 1, true, 3600, "S" },
+		{ 1944, 1944, 10, { compiled_on_t::day, 0, 2 }, 7200, 1, false, 0, "" },
+		{ 1945, 1945, 9, { compiled_on_t::day, 0, 16 }, 7200, 1, false, 0, "" },
+		{ 1977, 1980, 4, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 1, true, 3600, "S" },
+		{ 1977, 1977, 9, { compiled_on_t::last_weekday, 0, 0 }, 7200, 1, false, 0, "" },
+		{ 1978, 1978, 10, { compiled_on_t::day, 0, 1 }, 7200, 1, false, 0, "" },
+		{ 1979, 1995, 9, { compiled_on_t::last_weekday, 0, 0 }, 7200, 1, false, 0, "" },
+		{ 1981, 32767, 3, { compiled_on_t::last_weekday, 0, 0 }, 7200, 1, true, 3600, "S" },
+		{ 1996, 32767, 10, { compiled_on_t::last_weekday, 0, 0 }, 7200, 1, false, 0, "" },
+		{ 1916, 1916, 6, { compiled_on_t::day, 0, 14 }, 82800, 1, true, 3600, "S" },
+		{ 1916, 1919, 10, { compiled_on_t::weekday_ge, 0, 1 }, 82800, 1, false, 0, "" },
+		{ 1917, 1917, 3, { compiled_on_t::day, 0, 24 }, 82800, 1, true, 3600, "S" },
+		{ 1918, 1918, 3, { compiled_on_t::day, 0, 9 }, 82800, 1, true, 3600, "S" },
+		{ 1919, 1919, 3, { compiled_on_t::day, 0, 1 }, 82800, 1, true, 3600, "S" },
+		{ 1920, 1920, 2, { compiled_on_t::day, 0, 14 }, 82800, 1, true, 3600, "S" },
+		{ 1920, 1920, 10, { compiled_on_t::day, 0, 23 }, 82800, 1, false, 0, "" },
+		{ 1921, 1921, 3, { compiled_on_t::day, 0, 14 }, 82800, 1, true, 3600, "S" },
+		{ 1921, 1921, 6, { compiled_on_t::day, 0, 21 }, 82800, 1, false, 0, "" },
+		{ 1939, 1939, 9, { compiled_on_t::day, 0, 11 }, 82800, 1, true, 3600, "S" },
+		{ 1939, 1939, 11, { compiled_on_t::day, 0, 19 }, 3600, 0, false, 0, "" },
+		{ 1944, 1945, 4, { compiled_on_t::weekday_ge, 1, 1 }, 7200, 0, true, 3600, "S" },
+		{ 1944, 1944, 10, { compiled_on_t::day, 0, 8 }, 7200, 0, false, 0, "" },
+		{ 1945, 1945, 9, { compiled_on_t::day, 0, 16 }, 3600, 0, false, 0, "" },
+		{ 1971, 1971, 4, { compiled_on_t::day, 0, 25 }, 82800, 1, true, 3600, "S" },
+		{ 1971, 1971, 9, { compiled_on_t::day, 0, 26 }, 82800, 1, false, 0, "" },
+		{ 1977, 1977, 5, { compiled_on_t::day, 0, 6 }, 0, 0, true, 3600, "S" },
+		{ 1977, 1977, 10, { compiled_on_t::day, 0, 21 }, 0, 0, false, 0, "" },
+		{ 1978, 1978, 3, { compiled_on_t::day, 0, 24 }, 3600, 0, true, 3600, "S" },
+		{ 1978, 1978, 9, { compiled_on_t::day, 0, 22 }, 10800, 0, false, 0, "" },
+		{ 1980, 1980, 4, { compiled_on_t::day, 0, 25 }, 0, 0, true, 3600, "S" },
+		{ 1980, 1980, 10, { compiled_on_t::day, 0, 31 }, 7200, 0, false, 0, "" },
+		{ 1977, 1980, 4, { compiled_on_t::weekday_ge, 0, 1 }, 0, 0, true, 3600, "S" },
+		{ 1977, 1977, 9, { compiled_on_t::last_weekday, 0, 0 }, 0, 0, false, 0, "" },
+		{ 1978, 1978, 10, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1979, 1995, 9, { compiled_on_t::last_weekday, 0, 0 }, 0, 0, false, 0, "" },
+		{ 1981, 32767, 3, { compiled_on_t::last_weekday, 0, 0 }, 0, 0, true, 3600, "S" },
+		{ 1996, 32767, 10, { compiled_on_t::last_weekday, 0, 0 }, 0, 0, false, 0, "" },
+		{ 1946, 1946, 5, { compiled_on_t::day, 0, 15 }, 0, 0, true, 3600, "D" },
+		{ 1946, 1946, 10, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "S" },
+		{ 1947, 1947, 4, { compiled_on_t::day, 0, 15 }, 0, 0, true, 3600, "D" },
+		{ 1947, 1947, 11, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "S" },
+		{ 1948, 1951, 5, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "D" },
+		{ 1948, 1951, 10, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "S" },
+		{ 1952, 1952, 3, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "D" },
+		{ 1952, 1954, 11, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "S" },
+		{ 1953, 1959, 4, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "D" },
+		{ 1955, 1961, 10, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "S" },
+		{ 1960, 1961, 6, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "D" },
+		{ 1974, 1975, 4, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "D" },
+		{ 1974, 1975, 10, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "S" },
+		{ 1979, 1979, 7, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "D" },
+		{ 1979, 1979, 10, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "S" },
+		{ 1932, 1932, 7, { compiled_on_t::day, 0, 7 }, 0, 0, true, 3600, "S" },
+		{ 1932, 1932, 9, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1941, 1941, 4, { compiled_on_t::day, 0, 7 }, 0, 0, true, 3600, "S" },
+		{ 1942, 1942, 11, { compiled_on_t::day, 0, 2 }, 10800, 0, false, 0, "" },
+		{ 1943, 1943, 3, { compiled_on_t::day, 0, 30 }, 0, 0, true, 3600, "S" },
+		{ 1943, 1943, 10, { compiled_on_t::day, 0, 4 }, 0, 0, false, 0, "" },
+		{ 1952, 1952, 7, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "S" },
+		{ 1952, 1952, 11, { compiled_on_t::day, 0, 2 }, 0, 0, false, 0, "" },
+		{ 1975, 1975, 4, { compiled_on_t::day, 0, 12 }, 0, 1, true, 3600, "S" },
+		{ 1975, 1975, 11, { compiled_on_t::day, 0, 26 }, 0, 1, false, 0, "" },
+		{ 1976, 1976, 4, { compiled_on_t::day, 0, 11 }, 7200, 1, true, 3600, "S" },
+		{ 1976, 1976, 10, { compiled_on_t::day, 0, 10 }, 7200, 1, false, 0, "" },
+		{ 1977, 1978, 4, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 1, true, 3600, "S" },
+		{ 1977, 1977, 9, { compiled_on_t::day, 0, 26 }, 7200, 1, false, 0, "" },
+		{ 1978, 1978, 9, { compiled_on_t::day, 0, 24 }, 14400, 0, false, 0, "" },
+		{ 1979, 1979, 4, { compiled_on_t::day, 0, 1 }, 32400, 0, true, 3600, "S" },
+		{ 1979, 1979, 9, { compiled_on_t::day, 0, 29 }, 7200, 0, false, 0, "" },
+		{ 1980, 1980, 4, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "S" },
+		{ 1980, 1980, 9, { compiled_on_t::day, 0, 28 }, 0, 0, false, 0, "" },
+		{ 1918, 1919, 4, { compiled_on_t::day, 0, 15 }, 7200, 0, true, 3600, "S" },
+		{ 1918, 1920, 9, { compiled_on_t::weekday_ge, 1, 15 }, 10800, 0, false, 0, "" },
+		{ 1920, 1920, 4, { compiled_on_t::day, 0, 5 }, 7200, 0, true, 3600, "S" },
+		{ 1945, 1945, 5, { compiled_on_t::day, 0, 1 }, 82800, 0, true, 3600, "S" },
+		{ 1945, 1945, 11, { compiled_on_t::day, 0, 1 }, 3600, 0, false, 0, "" },
+		{ 1946, 1946, 3, { compiled_on_t::day, 0, 31 }, 7200, 1, true, 3600, "S" },
+		{ 1946, 1946, 10, { compiled_on_t::day, 0, 7 }, 7200, 0, false, 0, "" },
+		{ 1947, 1949, 4, { compiled_on_t::weekday_ge, 0, 4 }, 7200, 1, true, 3600, "S" },
+		{ 1947, 1949, 10, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 1, false, 0, "" },
+		{ 1954, 1954, 5, { compiled_on_t::day, 0, 23 }, 0, 0, true, 3600, "S" },
+		{ 1954, 1954, 10, { compiled_on_t::day, 0, 3 }, 0, 0, false, 0, "" },
+		{ 1955, 1955, 5, { compiled_on_t::day, 0, 22 }, 7200, 0, true, 3600, "S" },
+		{ 1955, 1955, 10, { compiled_on_t::day, 0, 2 }, 10800, 0, false, 0, "" },
+		{ 1956, 1957, 6, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 0, true, 3600, "S" },
+		{ 1956, 1957, 9, { compiled_on_t::last_weekday, 0, 0 }, 10800, 0, false, 0, "" },
+		{ 1980, 1980, 4, { compiled_on_t::day, 0, 6 }, 0, 0, true, 3600, "S" },
+		{ 1980, 1980, 9, { compiled_on_t::day, 0, 28 }, 3600, 0, false, 0, "" },
+		{ 1981, 1983, 3, { compiled_on_t::last_weekday, 0, 0 }, 0, 0, true, 3600, "S" },
+		{ 1981, 1983, 9, { compiled_on_t::last_weekday, 0, 0 }, 3600, 0, false, 0, "" },
+		{ 1910, 1910, 1, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1977, 1977, 3, { compiled_on_t::day, 0, 21 }, 82800, 0, true, 3600, "" },
+		{ 1977, 1977, 10, { compiled_on_t::day, 0, 20 }, 86400, 0, false, 0, "" },
+		{ 1978, 1978, 3, { compiled_on_t::day, 0, 24 }, 86400, 0, true, 3600, "" },
+		{ 1978, 1978, 8, { compiled_on_t::day, 0, 5 }, 3600, 0, false, 0, "" },
+		{ 1979, 1979, 5, { compiled_on_t::day, 0, 26 }, 86400, 0, true, 3600, "" },
+		{ 1979, 1979, 9, { compiled_on_t::day, 0, 18 }, 86400, 0, false, 0, "" },
+		{ 1980, 1980, 3, { compiled_on_t::day, 0, 20 }, 86400, 0, true, 3600, "" },
+		{ 1980, 1980, 9, { compiled_on_t::day, 0, 22 }, 86400, 0, false, 0, "" },
+		{ 1991, 1991, 5, { compiled_on_t::day, 0, 2 }, 86400, 0, true, 3600, "" },
+		{ 1992, 1995, 3, { compiled_on_t::day, 0, 21 }, 86400, 0, true, 3600, "" },
+		{ 1991, 1995, 9, { compiled_on_t::day, 0, 21 }, 86400, 0, false, 0, "" },
+		{ 1996, 1996, 3, { compiled_on_t::day, 0, 20 }, 86400, 0, true, 3600, "" },
+		{ 1996, 1996, 9, { compiled_on_t::day, 0, 20 }, 86400, 0, false, 0, "" },
+		{ 1997, 1999, 3, { compiled_on_t::day, 0, 21 }, 86400, 0, true, 3600, "" },
+		{ 1997, 1999, 9, { compiled_on_t::day, 0, 21 }, 86400, 0, false, 0, "" },
+		{ 2000, 2000, 3, { compiled_on_t::day, 0, 20 }, 86400, 0, true, 3600, "" },
+		{ 2000, 2000, 9, { compiled_on_t::day, 0, 20 }, 86400, 0, false, 0, "" },
+		{ 2001, 2003, 3, { compiled_on_t::day, 0, 21 }, 86400, 0, true, 3600, "" },
+		{ 2001, 2003, 9, { compiled_on_t::day, 0, 21 }, 86400, 0, false, 0, "" },
+		{ 2004, 2004, 3, { compiled_on_t::day, 0, 20 }, 86400, 0, true, 3600, "" },
+		{ 2004, 2004, 9, { compiled_on_t::day, 0, 20 }, 86400, 0, false, 0, "" },
+		{ 2005, 2005, 3, { compiled_on_t::day, 0, 21 }, 86400, 0, true, 3600, "" },
+		{ 2005, 2005, 9, { compiled_on_t::day, 0, 21 }, 86400, 0, false, 0, "" },
+		{ 2008, 2008, 3, { compiled_on_t::day, 0, 20 }, 86400, 0, true, 3600, "" },
+		{ 2008, 2008, 9, { compiled_on_t::day, 0, 20 }, 86400, 0, false, 0, "" },
+		{ 2009, 2011, 3, { compiled_on_t::day, 0, 21 }, 86400, 0, true, 3600, "" },
+		{ 2009, 2011, 9, { compiled_on_t::day, 0, 21 }, 86400, 0, false, 0, "" },
+		{ 2012, 2012, 3, { compiled_on_t::day, 0, 20 }, 86400, 0, true, 3600, "" },
+		{ 2012, 2012, 9, { compiled_on_t::day, 0, 20 }, 86400, 0, false, 0, "" },
+		{ 2013, 2015, 3, { compiled_on_t::day, 0, 21 }, 86400, 0, true, 3600, "" },
+		{ 2013, 2015, 9, { compiled_on_t::day, 0, 21 }, 86400, 0, false, 0, "" },
+		{ 2016, 2016, 3, { compiled_on_t::day, 0, 20 }, 86400, 0, true, 3600, "" },
+		{ 2016, 2016, 9, { compiled_on_t::day, 0, 20 }, 86400, 0, false, 0, "" },
+		{ 2017, 2019, 3, { compiled_on_t::day, 0, 21 }, 86400, 0, true, 3600, "" },
+		{ 2017, 2019, 9, { compiled_on_t::day, 0, 21 }, 86400, 0, false, 0, "" },
+		{ 2020, 2020, 3, { compiled_on_t::day, 0, 20 }, 86400, 0, true, 3600, "" },
+		{ 2020, 2020, 9, { compiled_on_t::day, 0, 20 }, 86400, 0, false, 0, "" },
+		{ 2021, 2022, 3, { compiled_on_t::day, 0, 21 }, 86400, 0, true, 3600, "" },
+		{ 2021, 2022, 9, { compiled_on_t::day, 0, 21 }, 86400, 0, false, 0, "" },
+		{ 1917, 1917, 4, { compiled_on_t::day, 0, 8 }, 7200, 0, true, 3600, "D" },
+		{ 1917, 1917, 9, { compiled_on_t::day, 0, 17 }, 7200, 0, false, 0, "S" },
+		{ 1919, 1919, 5, { compiled_on_t::day, 0, 5 }, 82800, 0, true, 3600, "D" },
+		{ 1919, 1919, 8, { compiled_on_t::day, 0, 12 }, 82800, 0, false, 0, "S" },
+		{ 1920, 1935, 5, { compiled_on_t::weekday_ge, 0, 1 }, 82800, 0, true, 3600, "D" },
+		{ 1920, 1935, 10, { compiled_on_t::last_weekday, 0, 0 }, 82800, 0, false, 0, "S" },
+		{ 1936, 1941, 5, { compiled_on_t::weekday_ge, 1, 9 }, 0, 0, true, 3600, "D" },
+		{ 1936, 1941, 10, { compiled_on_t::weekday_ge, 1, 2 }, 0, 0, false, 0, "S" },
+		{ 1946, 1950, 5, { compiled_on_t::weekday_ge, 0, 8 }, 7200, 0, true, 3600, "D" },
+		{ 1946, 1950, 10, { compiled_on_t::weekday_ge, 0, 2 }, 7200, 0, false, 0, "S" },
+		{ 1951, 1986, 4, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, true, 3600, "D" },
+		{ 1951, 1959, 9, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1960, 1986, 10, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1987, 1987, 4, { compiled_on_t::weekday_ge, 0, 1 }, 60, 0, true, 3600, "D" },
+		{ 1987, 2006, 10, { compiled_on_t::last_weekday, 0, 0 }, 60, 0, false, 0, "S" },
+		{ 1988, 1988, 4, { compiled_on_t::weekday_ge, 0, 1 }, 60, 0, true, 7200, "DD" },
+		{ 1989, 2006, 4, { compiled_on_t::weekday_ge, 0, 1 }, 60, 0, true, 3600, "D" },
+		{ 2007, 2011, 3, { compiled_on_t::weekday_ge, 0, 8 }, 60, 0, true, 3600, "D" },
+		{ 2007, 2010, 11, { compiled_on_t::weekday_ge, 0, 1 }, 60, 0, false, 0, "S" },
+		{ 1974, 1974, 11, { compiled_on_t::weekday_ge, 0, 1 }, 9900, 1, true, 3600, "" },
+		{ 1975, 1975, 2, { compiled_on_t::last_weekday, 0, 0 }, 9900, 1, false, 0, "" },
+		{ 1975, 1988, 10, { compiled_on_t::last_weekday, 0, 0 }, 9900, 1, true, 3600, "" },
+		{ 1976, 1989, 3, { compiled_on_t::weekday_ge, 0, 1 }, 9900, 1, false, 0, "" },
+		{ 1989, 1989, 10, { compiled_on_t::weekday_ge, 0, 8 }, 9900, 1, true, 3600, "" },
+		{ 1990, 2006, 10, { compiled_on_t::weekday_ge, 0, 1 }, 9900, 1, true, 3600, "" },
+		{ 1990, 2007, 3, { compiled_on_t::weekday_ge, 0, 15 }, 9900, 1, false, 0, "" },
+		{ 2007, 32767, 9, { compiled_on_t::last_weekday, 0, 0 }, 9900, 1, true, 3600, "" },
+		{ 2008, 32767, 4, { compiled_on_t::weekday_ge, 0, 1 }, 9900, 1, false, 0, "" },
+		{ 1920, 1920, 3, { compiled_on_t::day, 0, 28 }, 0, 0, true, 3600, "S" },
+		{ 1920, 1920, 10, { compiled_on_t::day, 0, 25 }, 0, 0, false, 0, "" },
+		{ 1921, 1921, 4, { compiled_on_t::day, 0, 3 }, 0, 0, true, 3600, "S" },
+		{ 1921, 1921, 10, { compiled_on_t::day, 0, 3 }, 0, 0, false, 0, "" },
+		{ 1922, 1922, 3, { compiled_on_t::day, 0, 26 }, 0, 0, true, 3600, "S" },
+		{ 1922, 1922, 10, { compiled_on_t::day, 0, 8 }, 0, 0, false, 0, "" },
+		{ 1923, 1923, 4, { compiled_on_t::day, 0, 22 }, 0, 0, true, 3600, "S" },
+		{ 1923, 1923, 9, { compiled_on_t::day, 0, 16 }, 0, 0, false, 0, "" },
+		{ 1957, 1961, 5, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "S" },
+		{ 1957, 1961, 10, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1972, 1972, 6, { compiled_on_t::day, 0, 22 }, 0, 0, true, 3600, "S" },
+		{ 1972, 1977, 10, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1973, 1977, 5, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "S" },
+		{ 1978, 1978, 4, { compiled_on_t::day, 0, 30 }, 0, 0, true, 3600, "S" },
+		{ 1978, 1978, 9, { compiled_on_t::day, 0, 30 }, 0, 0, false, 0, "" },
+		{ 1984, 1987, 5, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "S" },
+		{ 1984, 1991, 10, { compiled_on_t::day, 0, 16 }, 0, 0, false, 0, "" },
+		{ 1988, 1988, 6, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "S" },
+		{ 1989, 1989, 5, { compiled_on_t::day, 0, 10 }, 0, 0, true, 3600, "S" },
+		{ 1990, 1992, 5, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "S" },
+		{ 1992, 1992, 10, { compiled_on_t::day, 0, 4 }, 0, 0, false, 0, "" },
+		{ 1993, 32767, 3, { compiled_on_t::last_weekday, 0, 0 }, 0, 0, true, 3600, "S" },
+		{ 1993, 1998, 9, { compiled_on_t::last_weekday, 0, 0 }, 0, 0, false, 0, "" },
+		{ 1999, 32767, 10, { compiled_on_t::last_weekday, 0, 0 }, 0, 0, false, 0, "" },
+		{ 1931, 1931, 4, { compiled_on_t::day, 0, 30 }, 0, 0, true, 3600, "D" },
+		{ 1931, 1931, 10, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "S" },
+		{ 1939, 1939, 2, { compiled_on_t::day, 0, 5 }, 0, 0, true, 3600, "D" },
+		{ 1939, 1939, 6, { compiled_on_t::day, 0, 25 }, 0, 0, false, 0, "S" },
+		{ 1940, 1940, 12, { compiled_on_t::day, 0, 9 }, 0, 0, true, 3600, "D" },
+		{ 1941, 1941, 4, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "S" },
+		{ 1943, 1943, 12, { compiled_on_t::day, 0, 16 }, 0, 0, true, 3600, "W" },
+		{ 1944, 1944, 5, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "S" },
+		{ 1950, 1950, 2, { compiled_on_t::day, 0, 12 }, 0, 0, true, 3600, "D" },
+		{ 1950, 1950, 7, { compiled_on_t::day, 0, 30 }, 0, 0, false, 0, "S" },
+		{ 1996, 2000, 4, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 0, true, 3600, "D" },
+		{ 1996, 2000, 10, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 2001, 2001, 5, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 0, true, 3600, "D" },
+		{ 2001, 2001, 9, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 2002, 2022, 4, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 0, true, 3600, "D" },
+		{ 2002, 2022, 10, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1939, 1939, 4, { compiled_on_t::day, 0, 15 }, 82800, 1, true, 3600, "S" },
+		{ 1939, 1939, 11, { compiled_on_t::day, 0, 18 }, 82800, 1, false, 0, "" },
+		{ 1940, 1940, 2, { compiled_on_t::day, 0, 25 }, 82800, 1, true, 3600, "S" },
+		{ 1941, 1941, 10, { compiled_on_t::day, 0, 6 }, 0, 0, false, 0, "" },
+		{ 1942, 1942, 3, { compiled_on_t::day, 0, 9 }, 0, 0, true, 3600, "S" },
+		{ 1942, 1942, 11, { compiled_on_t::day, 0, 2 }, 10800, 0, false, 0, "" },
+		{ 1943, 1943, 3, { compiled_on_t::day, 0, 29 }, 7200, 0, true, 3600, "S" },
+		{ 1943, 1943, 4, { compiled_on_t::day, 0, 17 }, 7200, 0, false, 0, "" },
+		{ 1943, 1943, 4, { compiled_on_t::day, 0, 25 }, 7200, 0, true, 3600, "S" },
+		{ 1943, 1943, 10, { compiled_on_t::day, 0, 4 }, 7200, 0, false, 0, "" },
+		{ 1944, 1945, 4, { compiled_on_t::weekday_ge, 1, 1 }, 7200, 0, true, 3600, "S" },
+		{ 1944, 1944, 10, { compiled_on_t::day, 0, 8 }, 0, 0, false, 0, "" },
+		{ 1945, 1945, 9, { compiled_on_t::day, 0, 16 }, 0, 0, false, 0, "" },
+		{ 1977, 1977, 4, { compiled_on_t::day, 0, 30 }, 0, 1, true, 3600, "S" },
+		{ 1977, 1977, 9, { compiled_on_t::day, 0, 24 }, 0, 1, false, 0, "" },
+		{ 1978, 1978, 5, { compiled_on_t::day, 0, 1 }, 0, 1, true, 3600, "S" },
+		{ 1978, 1978, 10, { compiled_on_t::day, 0, 1 }, 0, 1, false, 0, "" },
+		{ 1988, 1988, 6, { compiled_on_t::day, 0, 1 }, 0, 1, true, 3600, "S" },
+		{ 1988, 1990, 9, { compiled_on_t::last_weekday, 0, 0 }, 0, 1, false, 0, "" },
+		{ 1989, 1989, 3, { compiled_on_t::day, 0, 26 }, 0, 1, true, 3600, "S" },
+		{ 1990, 1990, 5, { compiled_on_t::day, 0, 1 }, 0, 1, true, 3600, "S" },
+		{ 2005, 2005, 5, { compiled_on_t::day, 0, 1 }, 0, 1, true, 3600, "S" },
+		{ 2005, 2005, 9, { compiled_on_t::day, 0, 30 }, 3600, 1, false, 0, "" },
+		{ 2006, 2008, 3, { compiled_on_t::last_weekday, 0, 0 }, 7200, 1, true, 3600, "S" },
+		{ 2006, 2008, 10, { compiled_on_t::last_weekday, 0, 0 }, 7200, 1, false, 0, "" },
+		{ 1933, 1935, 6, { compiled_on_t::weekday_ge, 0, 8 }, 3600, 0, true, 3600, "D" },
+		{ 1933, 1935, 9, { compiled_on_t::weekday_ge, 0, 8 }, 3600, 0, false, 0, "S" },
+		{ 1936, 1938, 6, { compiled_on_t::weekday_ge, 0, 1 }, 3600, 0, true, 3600, "D" },
+		{ 1936, 1938, 9, { compiled_on_t::weekday_ge, 0, 1 }, 3600, 0, false, 0, "S" },
+		{ 1939, 1939, 5, { compiled_on_t::day, 0, 27 }, 3600, 0, true, 3600, "D" },
+		{ 1939, 1941, 9, { compiled_on_t::weekday_ge, 6, 21 }, 3600, 0, false, 0, "S" },
+		{ 1940, 1940, 5, { compiled_on_t::day, 0, 19 }, 3600, 0, true, 3600, "D" },
+		{ 1941, 1941, 5, { compiled_on_t::day, 0, 4 }, 3600, 0, true, 3600, "D" },
+		{ 1946, 1972, 4, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, true, 3600, "D" },
+		{ 1946, 1956, 9, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1957, 1972, 10, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1993, 2006, 4, { compiled_on_t::weekday_ge, 0, 1 }, 60, 0, true, 3600, "D" },
+		{ 1993, 2006, 10, { compiled_on_t::last_weekday, 0, 0 }, 60, 0, false, 0, "S" },
+		{ 1916, 1916, 6, { compiled_on_t::day, 0, 17 }, 82800, 0, true, 3600, "S" },
+		{ 1916, 1916, 11, { compiled_on_t::day, 0, 1 }, 3600, 0, false, 0, "" },
+		{ 1917, 1921, 3, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "S" },
+		{ 1917, 1921, 10, { compiled_on_t::day, 0, 14 }, 86400, 0, false, 0, "" },
+		{ 1924, 1924, 4, { compiled_on_t::day, 0, 16 }, 82800, 1, true, 3600, "S" },
+		{ 1924, 1924, 10, { compiled_on_t::day, 0, 4 }, 82800, 1, false, 0, "" },
+		{ 1926, 1926, 4, { compiled_on_t::day, 0, 17 }, 82800, 1, true, 3600, "S" },
+		{ 1926, 1929, 10, { compiled_on_t::weekday_ge, 6, 1 }, 82800, 1, false, 0, "" },
+		{ 1927, 1927, 4, { compiled_on_t::day, 0, 9 }, 82800, 1, true, 3600, "S" },
+		{ 1928, 1928, 4, { compiled_on_t::day, 0, 14 }, 82800, 1, true, 3600, "S" },
+		{ 1929, 1929, 4, { compiled_on_t::day, 0, 20 }, 82800, 1, true, 3600, "S" },
+		{ 1931, 1931, 4, { compiled_on_t::day, 0, 18 }, 82800, 1, true, 3600, "S" },
+		{ 1931, 1932, 10, { compiled_on_t::weekday_ge, 6, 1 }, 82800, 1, false, 0, "" },
+		{ 1932, 1932, 4, { compiled_on_t::day, 0, 2 }, 82800, 1, true, 3600, "S" },
+		{ 1934, 1934, 4, { compiled_on_t::day, 0, 7 }, 82800, 1, true, 3600, "S" },
+		{ 1934, 1938, 10, { compiled_on_t::weekday_ge, 6, 1 }, 82800, 1, false, 0, "" },
+		{ 1935, 1935, 3, { compiled_on_t::day, 0, 30 }, 82800, 1, true, 3600, "S" },
+		{ 1936, 1936, 4, { compiled_on_t::day, 0, 18 }, 82800, 1, true, 3600, "S" },
+		{ 1937, 1937, 4, { compiled_on_t::day, 0, 3 }, 82800, 1, true, 3600, "S" },
+		{ 1938, 1938, 3, { compiled_on_t::day, 0, 26 }, 82800, 1, true, 3600, "S" },
+		{ 1939, 1939, 4, { compiled_on_t::day, 0, 15 }, 82800, 1, true, 3600, "S" },
+		{ 1939, 1939, 11, { compiled_on_t::day, 0, 18 }, 82800, 1, false, 0, "" },
+		{ 1940, 1940, 2, { compiled_on_t::day, 0, 24 }, 82800, 1, true, 3600, "S" },
+		{ 1940, 1940, 10, { compiled_on_t::day, 0, 7 }, 82800, 1, false, 0, "" },
+		{ 1941, 1941, 4, { compiled_on_t::day, 0, 5 }, 82800, 1, true, 3600, "S" },
+		{ 1941, 1941, 10, { compiled_on_t::day, 0, 5 }, 82800, 1, false, 0, "" },
+		{ 1942, 1945, 3, { compiled_on_t::weekday_ge, 6, 8 }, 82800, 1, true, 3600, "S" },
+		{ 1942, 1942, 4, { compiled_on_t::day, 0, 25 }, 79200, 1, true, 7200, "M" },
+		{ 1942, 1942, 8, { compiled_on_t::day, 0, 15 }, 79200, 1, true, 3600, "S" },
+		{ 1942, 1945, 10, { compiled_on_t::weekday_ge, 6, 24 }, 82800, 1, false, 0, "" },
+		{ 1943, 1943, 4, { compiled_on_t::day, 0, 17 }, 79200, 1, true, 7200, "M" },
+		{ 1943, 1945, 8, { compiled_on_t::weekday_ge, 6, 25 }, 79200, 1, true, 3600, "S" },
+		{ 1944, 1945, 4, { compiled_on_t::weekday_ge, 6, 21 }, 79200, 1, true, 7200, "M" },
+		{ 1946, 1946, 4, { compiled_on_t::weekday_ge, 6, 1 }, 82800, 1, true, 3600, "S" },
+		{ 1946, 1946, 10, { compiled_on_t::weekday_ge, 6, 1 }, 82800, 1, false, 0, "" },
+		{ 1947, 1966, 4, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 1, true, 3600, "S" },
+		{ 1947, 1965, 10, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 1, false, 0, "" },
+		{ 1976, 1976, 9, { compiled_on_t::last_weekday, 0, 0 }, 3600, 0, false, 0, "" },
+		{ 1977, 1977, 3, { compiled_on_t::last_weekday, 0, 0 }, 0, 1, true, 3600, "S" },
+		{ 1977, 1977, 9, { compiled_on_t::last_weekday, 0, 0 }, 0, 1, false, 0, "" },
+		{ 1978, 1980, 4, { compiled_on_t::weekday_ge, 0, 1 }, 3600, 1, true, 3600, "S" },
+		{ 1978, 1978, 10, { compiled_on_t::day, 0, 1 }, 3600, 1, false, 0, "" },
+		{ 1979, 1980, 9, { compiled_on_t::last_weekday, 0, 0 }, 3600, 1, false, 0, "" },
+		{ 1981, 1986, 3, { compiled_on_t::last_weekday, 0, 0 }, 0, 1, true, 3600, "S" },
+		{ 1981, 1985, 9, { compiled_on_t::last_weekday, 0, 0 }, 0, 1, false, 0, "" },
+		{ 1940, 1940, 6, { compiled_on_t::day, 0, 16 }, 0, 0, true, 3600, "S" },
+		{ 1942, 1942, 11, { compiled_on_t::day, 0, 2 }, 10800, 0, false, 0, "" },
+		{ 1943, 1943, 3, { compiled_on_t::day, 0, 29 }, 7200, 0, true, 3600, "S" },
+		{ 1943, 1943, 4, { compiled_on_t::day, 0, 10 }, 10800, 0, false, 0, "" },
+		{ 1974, 1974, 5, { compiled_on_t::day, 0, 4 }, 0, 0, true, 3600, "S" },
+		{ 1974, 1974, 10, { compiled_on_t::day, 0, 2 }, 0, 0, false, 0, "" },
+		{ 1975, 1975, 5, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "S" },
+		{ 1975, 1975, 10, { compiled_on_t::day, 0, 2 }, 0, 0, false, 0, "" },
+		{ 1976, 1976, 5, { compiled_on_t::day, 0, 2 }, 0, 0, true, 3600, "S" },
+		{ 1976, 1976, 10, { compiled_on_t::day, 0, 3 }, 0, 0, false, 0, "" },
+		{ 1977, 1977, 5, { compiled_on_t::day, 0, 8 }, 0, 0, true, 3600, "S" },
+		{ 1977, 1977, 10, { compiled_on_t::day, 0, 2 }, 0, 0, false, 0, "" },
+		{ 1978, 1978, 5, { compiled_on_t::day, 0, 6 }, 0, 0, true, 3600, "S" },
+		{ 1978, 1978, 10, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1979, 1979, 5, { compiled_on_t::day, 0, 5 }, 0, 0, true, 3600, "S" },
+		{ 1979, 1979, 9, { compiled_on_t::day, 0, 30 }, 0, 0, false, 0, "" },
+		{ 1980, 1980, 5, { compiled_on_t::day, 0, 3 }, 0, 0, true, 3600, "S" },
+		{ 1980, 1980, 10, { compiled_on_t::day, 0, 4 }, 0, 0, false, 0, "" },
+		{ 1981, 1981, 4, { compiled_on_t::day, 0, 26 }, 0, 0, true, 3600, "S" },
+		{ 1981, 1981, 9, { compiled_on_t::day, 0, 27 }, 0, 0, false, 0, "" },
+		{ 1982, 1982, 5, { compiled_on_t::day, 0, 2 }, 0, 0, true, 3600, "S" },
+		{ 1982, 1982, 10, { compiled_on_t::day, 0, 3 }, 0, 0, false, 0, "" },
+		{ 1983, 1983, 4, { compiled_on_t::day, 0, 18 }, 0, 0, true, 3600, "S" },
+		{ 1983, 1983, 10, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1984, 1984, 4, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "S" },
+		{ 1918, 1918, 4, { compiled_on_t::day, 0, 14 }, 7200, 0, true, 3600, "D" },
+		{ 1918, 1918, 10, { compiled_on_t::day, 0, 27 }, 7200, 0, false, 0, "S" },
+		{ 1930, 1934, 5, { compiled_on_t::weekday_ge, 0, 1 }, 0, 0, true, 3600, "D" },
+		{ 1930, 1934, 10, { compiled_on_t::weekday_ge, 0, 1 }, 0, 0, false, 0, "S" },
+		{ 1937, 1941, 4, { compiled_on_t::weekday_ge, 0, 8 }, 0, 0, true, 3600, "D" },
+		{ 1937, 1937, 10, { compiled_on_t::weekday_ge, 0, 8 }, 0, 0, false, 0, "S" },
+		{ 1938, 1938, 10, { compiled_on_t::weekday_ge, 0, 1 }, 0, 0, false, 0, "S" },
+		{ 1939, 1941, 10, { compiled_on_t::weekday_ge, 0, 8 }, 0, 0, false, 0, "S" },
+		{ 1942, 1942, 2, { compiled_on_t::day, 0, 9 }, 7200, 0, true, 3600, "W" },
+		{ 1945, 1945, 8, { compiled_on_t::day, 0, 14 }, 82800, 2, true, 3600, "P" },
+		{ 1945, 1945, 9, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1946, 1946, 4, { compiled_on_t::weekday_ge, 0, 8 }, 7200, 0, true, 3600, "D" },
+		{ 1946, 1946, 10, { compiled_on_t::weekday_ge, 0, 8 }, 7200, 0, false, 0, "S" },
+		{ 1947, 1957, 4, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, true, 3600, "D" },
+		{ 1947, 1957, 9, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1959, 1959, 4, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, true, 3600, "D" },
+		{ 1959, 1959, 10, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1918, 1918, 4, { compiled_on_t::day, 0, 15 }, 82800, 0, true, 3600, "S" },
+		{ 1918, 1919, 10, { compiled_on_t::day, 0, 6 }, 86400, 1, false, 0, "" },
+		{ 1919, 1919, 4, { compiled_on_t::day, 0, 6 }, 82800, 0, true, 3600, "S" },
+		{ 1924, 1924, 4, { compiled_on_t::day, 0, 16 }, 82800, 0, true, 3600, "S" },
+		{ 1924, 1924, 10, { compiled_on_t::day, 0, 4 }, 86400, 1, false, 0, "" },
+		{ 1926, 1926, 4, { compiled_on_t::day, 0, 17 }, 82800, 0, true, 3600, "S" },
+		{ 1926, 1929, 10, { compiled_on_t::weekday_ge, 6, 1 }, 86400, 1, false, 0, "" },
+		{ 1927, 1927, 4, { compiled_on_t::day, 0, 9 }, 82800, 0, true, 3600, "S" },
+		{ 1928, 1928, 4, { compiled_on_t::day, 0, 15 }, 0, 0, true, 3600, "S" },
+		{ 1929, 1929, 4, { compiled_on_t::day, 0, 20 }, 82800, 0, true, 3600, "S" },
+		{ 1937, 1937, 6, { compiled_on_t::day, 0, 16 }, 82800, 0, true, 3600, "S" },
+		{ 1937, 1937, 10, { compiled_on_t::day, 0, 2 }, 86400, 1, false, 0, "" },
+		{ 1938, 1938, 4, { compiled_on_t::day, 0, 2 }, 82800, 0, true, 3600, "S" },
+		{ 1938, 1938, 4, { compiled_on_t::day, 0, 30 }, 82800, 0, true, 7200, "M" },
+		{ 1938, 1938, 10, { compiled_on_t::day, 0, 2 }, 86400, 0, true, 3600, "S" },
+		{ 1939, 1939, 10, { compiled_on_t::day, 0, 7 }, 86400, 1, false, 0, "" },
+		{ 1942, 1942, 5, { compiled_on_t::day, 0, 2 }, 82800, 0, true, 3600, "S" },
+		{ 1942, 1942, 9, { compiled_on_t::day, 0, 1 }, 3600, 0, false, 0, "" },
+		{ 1943, 1946, 4, { compiled_on_t::weekday_ge, 6, 13 }, 82800, 0, true, 3600, "S" },
+		{ 1943, 1944, 10, { compiled_on_t::weekday_ge, 0, 1 }, 3600, 0, false, 0, "" },
+		{ 1945, 1946, 9, { compiled_on_t::last_weekday, 0, 0 }, 3600, 0, false, 0, "" },
+		{ 1949, 1949, 4, { compiled_on_t::day, 0, 30 }, 82800, 0, true, 3600, "S" },
+		{ 1949, 1949, 10, { compiled_on_t::day, 0, 2 }, 3600, 0, false, 0, "" },
+		{ 1974, 1975, 4, { compiled_on_t::weekday_ge, 6, 12 }, 82800, 0, true, 3600, "S" },
+		{ 1974, 1975, 10, { compiled_on_t::weekday_ge, 0, 1 }, 3600, 0, false, 0, "" },
+		{ 1976, 1976, 3, { compiled_on_t::day, 0, 27 }, 82800, 0, true, 3600, "S" },
+		{ 1976, 1977, 9, { compiled_on_t::last_weekday, 0, 0 }, 3600, 0, false, 0, "" },
+		{ 1977, 1977, 4, { compiled_on_t::day, 0, 2 }, 82800, 0, true, 3600, "S" },
+		{ 1978, 1978, 4, { compiled_on_t::day, 0, 2 }, 7200, 1, true, 3600, "S" },
+		{ 1978, 1978, 10, { compiled_on_t::day, 0, 1 }, 7200, 1, false, 0, "" },
+		{ 1919, 1919, 3, { compiled_on_t::day, 0, 30 }, 84600, 0, true, 3600, "D" },
+		{ 1919, 1919, 10, { compiled_on_t::day, 0, 26 }, 0, 0, false, 0, "S" },
+		{ 1920, 1920, 5, { compiled_on_t::day, 0, 2 }, 7200, 0, true, 3600, "D" },
+		{ 1920, 1920, 9, { compiled_on_t::day, 0, 26 }, 0, 0, false, 0, "S" },
+		{ 1921, 1921, 5, { compiled_on_t::day, 0, 15 }, 7200, 0, true, 3600, "D" },
+		{ 1921, 1921, 9, { compiled_on_t::day, 0, 15 }, 7200, 0, false, 0, "S" },
+		{ 1922, 1923, 5, { compiled_on_t::weekday_ge, 0, 8 }, 7200, 0, true, 3600, "D" },
+		{ 1922, 1926, 9, { compiled_on_t::weekday_ge, 0, 15 }, 7200, 0, false, 0, "S" },
+		{ 1924, 1927, 5, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 0, true, 3600, "D" },
+		{ 1927, 1937, 9, { compiled_on_t::weekday_ge, 0, 25 }, 7200, 0, false, 0, "S" },
+		{ 1928, 1937, 4, { compiled_on_t::weekday_ge, 0, 25 }, 7200, 0, true, 3600, "D" },
+		{ 1938, 1940, 4, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, true, 3600, "D" },
+		{ 1938, 1939, 9, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1945, 1948, 9, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1946, 1973, 4, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, true, 3600, "D" },
+		{ 1949, 1950, 11, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1951, 1956, 9, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1957, 1973, 10, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1918, 1919, 3, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, true, 3600, "D" },
+		{ 1918, 1919, 10, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1942, 1942, 2, { compiled_on_t::day, 0, 9 }, 7200, 0, true, 3600, "W" },
+		{ 1945, 1945, 8, { compiled_on_t::day, 0, 14 }, 82800, 2, true, 3600, "P" },
+		{ 1945, 1945, 9, { compiled_on_t::day, 0, 30 }, 7200, 0, false, 0, "S" },
+		{ 1967, 2006, 10, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1967, 1973, 4, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, true, 3600, "D" },
+		{ 1974, 1974, 1, { compiled_on_t::day, 0, 6 }, 7200, 0, true, 3600, "D" },
+		{ 1975, 1975, 2, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, true, 3600, "D" },
+		{ 1976, 1986, 4, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, true, 3600, "D" },
+		{ 1987, 2006, 4, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 0, true, 3600, "D" },
+		{ 2007, 32767, 3, { compiled_on_t::weekday_ge, 0, 8 }, 7200, 0, true, 3600, "D" },
+		{ 2007, 32767, 11, { compiled_on_t::weekday_ge, 0, 1 }, 7200, 0, false, 0, "S" },
+		{ 1921, 1921, 5, { compiled_on_t::day, 0, 1 }, 7200, 0, true, 3600, "D" },
+		{ 1921, 1921, 9, { compiled_on_t::day, 0, 1 }, 7200, 0, false, 0, "S" },
+		{ 1941, 1941, 4, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, true, 3600, "D" },
+		{ 1941, 1941, 9, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1946, 1946, 4, { compiled_on_t::last_weekday, 0, 0 }, 60, 0, true, 3600, "D" },
+		{ 1946, 1946, 6, { compiled_on_t::day, 0, 2 }, 7200, 0, false, 0, "S" },
+		{ 1950, 1961, 4, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, true, 3600, "D" },
+		{ 1950, 1955, 9, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1956, 1961, 10, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0, false, 0, "S" },
+		{ 1927, 1931, 9, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "" },
+		{ 1928, 1932, 4, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1968, 1968, 11, { compiled_on_t::day, 0, 3 }, 14400, 2, true, 3600, "" },
+		{ 1969, 1969, 3, { compiled_on_t::day, 0, 30 }, 10800, 2, false, 0, "" },
+		{ 1969, 1969, 11, { compiled_on_t::day, 0, 23 }, 14400, 2, true, 3600, "" },
+		{ 1970, 1970, 3, { compiled_on_t::day, 0, 29 }, 10800, 2, false, 0, "" },
+		{ 1971, 1971, 3, { compiled_on_t::day, 0, 14 }, 10800, 2, false, 0, "" },
+		{ 1970, 1972, 10, { compiled_on_t::weekday_ge, 0, 9 }, 14400, 2, true, 3600, "" },
+		{ 1972, 1986, 3, { compiled_on_t::weekday_ge, 0, 9 }, 10800, 2, false, 0, "" },
+		{ 1973, 1973, 9, { compiled_on_t::day, 0, 30 }, 14400, 2, true, 3600, "" },
+		{ 1974, 1987, 10, { compiled_on_t::weekday_ge, 0, 9 }, 14400, 2, true, 3600, "" },
+		{ 1987, 1987, 4, { compiled_on_t::day, 0, 12 }, 10800, 2, false, 0, "" },
+		{ 1988, 1990, 3, { compiled_on_t::weekday_ge, 0, 9 }, 10800, 2, false, 0, "" },
+		{ 1988, 1989, 10, { compiled_on_t::weekday_ge, 0, 9 }, 14400, 2, true, 3600, "" },
+		{ 1990, 1990, 9, { compiled_on_t::day, 0, 16 }, 14400, 2, true, 3600, "" },
+		{ 1991, 1996, 3, { compiled_on_t::weekday_ge, 0, 9 }, 10800, 2, false, 0, "" },
+		{ 1991, 1997, 10, { compiled_on_t::weekday_ge, 0, 9 }, 14400, 2, true, 3600, "" },
+		{ 1997, 1997, 3, { compiled_on_t::day, 0, 30 }, 10800, 2, false, 0, "" },
+		{ 1998, 1998, 3, { compiled_on_t::weekday_ge, 0, 9 }, 10800, 2, false, 0, "" },
+		{ 1998, 1998, 9, { compiled_on_t::day, 0, 27 }, 14400, 2, true, 3600, "" },
+		{ 1999, 1999, 4, { compiled_on_t::day, 0, 4 }, 10800, 2, false, 0, "" },
+		{ 1999, 2010, 10, { compiled_on_t::weekday_ge, 0, 9 }, 14400, 2, true, 3600, "" },
+		{ 2000, 2007, 3, { compiled_on_t::weekday_ge, 0, 9 }, 10800, 2, false, 0, "" },
+		{ 2008, 2008, 3, { compiled_on_t::day, 0, 30 }, 10800, 2, false, 0, "" },
+		{ 2009, 2009, 3, { compiled_on_t::weekday_ge, 0, 9 }, 10800, 2, false, 0, "" },
+		{ 2010, 2010, 4, { compiled_on_t::weekday_ge, 0, 1 }, 10800, 2, false, 0, "" },
+		{ 2011, 2011, 5, { compiled_on_t::weekday_ge, 0, 2 }, 10800, 2, false, 0, "" },
+		{ 2011, 2011, 8, { compiled_on_t::weekday_ge, 0, 16 }, 14400, 2, true, 3600, "" },
+		{ 2012, 2014, 4, { compiled_on_t::weekday_ge, 0, 23 }, 10800, 2, false, 0, "" },
+		{ 2012, 2014, 9, { compiled_on_t::weekday_ge, 0, 2 }, 14400, 2, true, 3600, "" },
+		{ 2016, 2018, 5, { compiled_on_t::weekday_ge, 0, 9 }, 10800, 2, false, 0, "" },
+		{ 2016, 2018, 8, { compiled_on_t::weekday_ge, 0, 9 }, 14400, 2, true, 3600, "" },
+		{ 2019, 32767, 4, { compiled_on_t::weekday_ge, 0, 2 }, 10800, 2, false, 0, "" },
+		{ 2019, 2021, 9, { compiled_on_t::weekday_ge, 0, 2 }, 14400, 2, true, 3600, "" },
+		{ 2022, 2022, 9, { compiled_on_t::weekday_ge, 0, 9 }, 14400, 2, true, 3600, "" },
+		{ 2023, 32767, 9, { compiled_on_t::weekday_ge, 0, 2 }, 14400, 2, true, 3600, "" },
+		{ 1975, 1988, 10, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "" },
+		{ 1975, 1978, 3, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1979, 1991, 4, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1989, 1989, 10, { compiled_on_t::day, 0, 22 }, 0, 0, true, 3600, "" },
+		{ 1990, 1990, 10, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "" },
+		{ 1991, 1991, 10, { compiled_on_t::day, 0, 6 }, 0, 0, true, 3600, "" },
+		{ 1992, 1992, 3, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1992, 1992, 10, { compiled_on_t::day, 0, 5 }, 0, 0, true, 3600, "" },
+		{ 1993, 1993, 3, { compiled_on_t::day, 0, 31 }, 0, 0, false, 0, "" },
+		{ 1993, 1995, 10, { compiled_on_t::day, 0, 1 }, 0, 0, true, 3600, "" },
+		{ 1994, 1995, 2, { compiled_on_t::last_weekday, 0, 0 }, 0, 0, false, 0, "" },
+		{ 1996, 1996, 3, { compiled_on_t::day, 0, 1 }, 0, 0, false, 0, "" },
+		{ 1996, 2001, 10, { compiled_on_t::weekday_ge, 0, 1 }, 0, 0, true, 3600, "" },
+		{ 1997, 1997, 2, { compiled_on_t::last_weekday, 0, 0 }, 0, 0, false, 0, "" },
+		{ 1998, 2001, 3, { compiled_on_t::weekday_ge, 0, 1 }, 0, 0, false, 0, "" },
+		{ 2002, 2004, 4, { compiled_on_t::weekday_ge, 0, 1 }, 0, 0, false, 0, "" },
+		{ 2002, 2003, 9, { compiled_on_t::weekday_ge, 0, 1 }, 0, 0, true, 3600, "" },
+		{ 2004, 2009, 10, { compiled_on_t::weekday_ge, 0, 15 }, 0, 0, true, 3600, "" },
+		{ 2005, 2009, 3, { compiled_on_t::weekday_ge, 0, 8 }, 0, 0, false, 0, "" },
+		{ 2010, 2024, 10, { compiled_on_t::weekday_ge, 0, 1 }, 0, 0, true, 3600, "" },
+		{ 2010, 2012, 4, { compiled_on_t::weekday_ge, 0, 8 }, 0, 0, false, 0, "" },
+		{ 2013, 2024, 3, { compiled_on_t::weekday_ge, 0, 22 }, 0, 0, false, 0, "" },
+		{ 1932, 1932, 5, { compiled_on_t::day, 0, 21 }, 0, 1, true, 3600, "S" },
+		{ 1932, 1939, 10, { compiled_on_t::weekday_ge, 0, 1 }, 0, 1, false, 0, "" },
+		{ 1933, 1939, 4, { compiled_on_t::weekday_ge, 0, 2 }, 0, 1, true, 3600, "S" },
+		{ 1979, 1979, 5, { compiled_on_t::day, 0, 27 }, 0, 0, true, 3600, "S" },
+		{ 1979, 1979, 9, { compiled_on_t::last_weekday, 0, 0 }, 0, 0, false, 0, "" },
+		{ 1980, 1980, 4, { compiled_on_t::day, 0, 5 }, 82800, 0, true, 3600, "S" },
+		{ 1980, 1980, 9, { compiled_on_t::last_weekday, 0, 0 }, 3600, 0, false, 0, "" },
+		{ 1991, 1993, 3, { compiled_on_t::last_weekday, 0, 0 }, 0, 1, true, 3600, "S" },
+		{ 1991, 1993, 9, { compiled_on_t::last_weekday, 0, 0 }, 0, 1, false, 0, "" },
+	};
+
+	static constexpr compiled_rule_set_t rule_sets[] =
+	{
+		{ "A", 0, 29 },
+		{ "AM", 29, 2 },
+		{ "AN", 31, 16 },
+		{ "AQ", 47, 4 },
+		{ "AS", 51, 15 },
+		{ "AT", 66, 23 },
+		{ "AU", 89, 7 },
+		{ "AV", 96, 14 },
+		{ "AW", 110, 9 },
+		{ "AZ", 119, 2 },
+		{ "B", 121, 57 },
+		{ "BB", 178, 11 },
+		{ "BD", 189, 2 },
+		{ "BG", 191, 5 },
+		{ "BZ", 196, 11 },
+		{ "Be", 207, 16 },
+		{ "C", 223, 10 },
+		{ "CA", 233, 5 },
+		{ "CH", 238, 2 },
+		{ "CK", 240, 3 },
+		{ "CN", 243, 3 },
+		{ "CO", 246, 2 },
+		{ "CR", 248, 5 },
+		{ "CY", 253, 9 },
+		{ "CZ", 262, 6 },
+		{ "Ch", 268, 6 },
+		{ "DE", 274, 8 },
+		{ "DO", 282, 6 },
+		{ "De", 288, 5 },
+		{ "Dt", 293, 2 },
+		{ "E", 295, 6 },
+		{ "EC", 301, 2 },
+		{ "Ed", 303, 13 },
+		{ "F", 316, 42 },
+		{ "FI", 358, 4 },
+		{ "FJ", 362, 12 },
+		{ "FK", 374, 12 },
+		{ "G", 386, 65 },
+		{ "GT", 451, 8 },
+		{ "Gu", 459, 14 },
+		{ "H", 473, 41 },
+		{ "HK", 514, 14 },
+		{ "HN", 528, 4 },
+		{ "HT", 532, 11 },
+		{ "Ho", 543, 2 },
+		{ "I", 545, 41 },
+		{ "IE", 586, 7 },
+		{ "IQ", 593, 8 },
+		{ "In", 601, 3 },
+		{ "J", 604, 32 },
+		{ "JP", 636, 4 },
+		{ "K", 640, 34 },
+		{ "KG", 674, 4 },
+		{ "KR", 678, 14 },
+		{ "L", 692, 17 },
+		{ "LH", 709, 14 },
+		{ "LV", 723, 2 },
+		{ "M", 725, 183 },
+		{ "MD", 908, 2 },
+		{ "MT", 910, 7 },
+		{ "MU", 917, 4 },
+		{ "Ma", 921, 4 },
+		{ "Me", 925, 4 },
+		{ "NA", 929, 3 },
+		{ "NB", 932, 2 },
+		{ "NC", 934, 4 },
+		{ "NI", 938, 6 },
+		{ "NY", 944, 5 },
+		{ "NZ", 949, 16 },
+		{ "O", 965, 20 },
+		{ "P", 985, 110 },
+		{ "PE", 1095, 10 },
+		{ "PH", 1105, 10 },
+		{ "PK", 1115, 5 },
+		{ "Pe", 1120, 4 },
+		{ "Pi", 1124, 4 },
+		{ "Pu", 1128, 4 },
+		{ "Q", 1132, 39 },
+		{ "R", 1171, 16 },
+		{ "S", 1187, 41 },
+		{ "SA", 1228, 2 },
+		{ "SD", 1230, 4 },
+		{ "SV", 1234, 2 },
+		{ "Sa", 1236, 2 },
+		{ "Sh", 1238, 14 },
+		{ "So", 1252, 3 },
+		{ "Sp", 1255, 9 },
+		{ "St", 1264, 5 },
+		{ "Sw", 1269, 5 },
+		{ "T", 1274, 45 },
+		{ "TO", 1319, 6 },
+		{ "Th", 1325, 6 },
+		{ "Tr", 1331, 2 },
+		{ "U", 1333, 48 },
+		{ "V", 1381, 9 },
+		{ "VU", 1390, 6 },
+		{ "Va", 1396, 9 },
+		{ "W", 1405, 24 },
+		{ "W-", 1429, 6 },
+		{ "WS", 1435, 5 },
+		{ "X", 1440, 9 },
+		{ "Y", 1449, 10 },
+		{ "Yu", 1459, 2 },
+		{ "Z", 1461, 85 },
+		{ "_", 1546, 27 },
+		{ "a", 1573, 9 },
+		{ "b", 1582, 34 },
+		{ "c", 1616, 17 },
+		{ "d", 1633, 22 },
+		{ "e", 1655, 6 },
+		{ "f", 1661, 15 },
+		{ "g", 1676, 19 },
+		{ "h", 1695, 19 },
+		{ "i", 1714, 40 },
+		{ "j", 1754, 19 },
+		{ "k", 1773, 9 },
+		{ "l", 1782, 24 },
+		{ "m", 1806, 16 },
+		{ "n", 1822, 25 },
+		{ "o", 1847, 13 },
+		{ "p", 1860, 45 },
+		{ "q", 1905, 25 },
+		{ "r", 1930, 17 },
+		{ "s", 1947, 30 },
+		{ "t", 1977, 18 },
+		{ "u", 1995, 13 },
+		{ "v", 2008, 9 },
+		{ "x", 2017, 36 },
+		{ "y", 2053, 22 },
+		{ "z", 2075, 9 },
+	};
+
+	static constexpr compiled_continuation_t continuations[] =
+	{
+		{ -968, compiled_continuation_t::none, false, 0, 0, "LMT", 1912, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 0, compiled_continuation_t::none, false, 0, 0, "GMT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 732, compiled_continuation_t::none, false, 0, 0, "LMT", 1891, 3, { compiled_on_t::day, 0, 16 }, 0, 0 },
+		{ 561, compiled_continuation_t::none, false, 0, 0, "PMT", 1911, 3, { compiled_on_t::day, 0, 11 }, 0, 0 },
+		{ 0, compiled_continuation_t::named, false, 108, 0, "WE%sT", 1940, 2, { compiled_on_t::day, 0, 25 }, 7200, 0 },
+		{ 3600, compiled_continuation_t::named, false, 108, 0, "CE%sT", 1946, 10, { compiled_on_t::day, 0, 7 }, 0, 0 },
+		{ 0, compiled_continuation_t::none, false, 0, 0, "WET", 1956, 1, { compiled_on_t::day, 0, 29 }, 0, 0 },
+		{ 3600, compiled_continuation_t::none, false, 0, 0, "CET", 1963, 4, { compiled_on_t::day, 0, 14 }, 0, 0 },
+		{ 0, compiled_continuation_t::named, false, 108, 0, "WE%sT", 1977, 10, { compiled_on_t::day, 0, 21 }, 0, 0 },
+		{ 3600, compiled_continuation_t::named, false, 108, 0, "CE%sT", 1979, 10, { compiled_on_t::day, 0, 26 }, 0, 0 },
+		{ 0, compiled_continuation_t::named, false, 108, 0, "WE%sT", 1981, 5, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 3600, compiled_continuation_t::none, false, 0, 0, "CET", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -3740, compiled_continuation_t::none, false, 0, 0, "LMT", 1912, 1, { compiled_on_t::day, 0, 1 }, 3600, 2 },
+		{ -3600, compiled_continuation_t::none, false, 0, 0, "%z", 1975, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 0, compiled_continuation_t::none, false, 0, 0, "GMT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 7509, compiled_continuation_t::none, false, 0, 0, "LMT", 1900, 10, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 7200, compiled_continuation_t::named, false, 51, 0, "EE%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -1820, compiled_continuation_t::none, false, 0, 0, "LMT", 1913, 10, { compiled_on_t::day, 0, 26 }, 0, 0 },
+		{ 0, compiled_continuation_t::named, false, 57, 0, "%z", 1984, 3, { compiled_on_t::day, 0, 16 }, 0, 0 },
+		{ 3600, compiled_continuation_t::none, false, 0, 0, "%z", 1986, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 0, compiled_continuation_t::named, false, 57, 0, "%z", 2018, 10, { compiled_on_t::day, 0, 28 }, 10800, 0 },
+		{ 3600, compiled_continuation_t::named, false, 57, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -1276, compiled_continuation_t::none, false, 0, 0, "LMT", 1901, 1, { compiled_on_t::day, 0, 1 }, 0, 2 },
+		{ 0, compiled_continuation_t::none, false, 0, 0, "WET", 1918, 5, { compiled_on_t::day, 0, 6 }, 82800, 0 },
+		{ 0, compiled_continuation_t::save, true, 0, 3600, "WEST", 1918, 10, { compiled_on_t::day, 0, 7 }, 82800, 0 },
+		{ 0, compiled_continuation_t::none, false, 0, 0, "WET", 1924, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 0, compiled_continuation_t::named, false, 123, 0, "WE%sT", 1929, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 0, compiled_continuation_t::none, false, 0, 0, "WET", 1967, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 0, compiled_continuation_t::named, false, 86, 0, "WE%sT", 1984, 3, { compiled_on_t::day, 0, 16 }, 0, 0 },
+		{ 3600, compiled_continuation_t::none, false, 0, 0, "CET", 1986, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 3600, compiled_continuation_t::named, false, 30, 0, "CE%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -3168, compiled_continuation_t::none, false, 0, 0, "LMT", 1934, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -3600, compiled_continuation_t::none, false, 0, 0, "%z", 1976, 4, { compiled_on_t::day, 0, 14 }, 0, 0 },
+		{ 0, compiled_continuation_t::named, false, 57, 0, "%z", 2018, 10, { compiled_on_t::day, 0, 28 }, 10800, 0 },
+		{ 3600, compiled_continuation_t::named, false, 57, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 6720, compiled_continuation_t::none, false, 0, 0, "LMT", 1892, 2, { compiled_on_t::day, 0, 8 }, 0, 0 },
+		{ 5400, compiled_continuation_t::none, false, 0, 0, "SAST", 1903, 3, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 7200, compiled_continuation_t::named, false, 80, 0, "SAST", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 7588, compiled_continuation_t::none, false, 0, 0, "LMT", 1931, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 7200, compiled_continuation_t::named, false, 81, 0, "CA%sT", 2000, 1, { compiled_on_t::day, 0, 15 }, 43200, 0 },
+		{ 10800, compiled_continuation_t::none, false, 0, 0, "EAT", 2021, 2, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 7200, compiled_continuation_t::none, false, 0, 0, "CAT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 7808, compiled_continuation_t::none, false, 0, 0, "LMT", 1931, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 7200, compiled_continuation_t::named, false, 81, 0, "CA%sT", 2000, 1, { compiled_on_t::day, 0, 15 }, 43200, 0 },
+		{ 10800, compiled_continuation_t::none, false, 0, 0, "EAT", 2017, 11, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 7200, compiled_continuation_t::none, false, 0, 0, "CAT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 815, compiled_continuation_t::none, false, 0, 0, "LMT", 1905, 7, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 0, compiled_continuation_t::none, false, 0, 0, "GMT", 1908, 7, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 815, compiled_continuation_t::none, false, 0, 0, "LMT", 1914, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 1800, compiled_continuation_t::none, false, 0, 0, "%z", 1919, 9, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 3600, compiled_continuation_t::none, false, 0, 0, "WAT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 7818, compiled_continuation_t::none, false, 0, 0, "LMT", 1909, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 7200, compiled_continuation_t::none, false, 0, 0, "CAT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -2588, compiled_continuation_t::none, false, 0, 0, "LMT", 1882, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -2588, compiled_continuation_t::none, false, 0, 0, "MMT", 1919, 3, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -2670, compiled_continuation_t::none, false, 0, 0, "MMT", 1972, 1, { compiled_on_t::day, 0, 7 }, 0, 0 },
+		{ 0, compiled_continuation_t::none, false, 0, 0, "GMT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 8836, compiled_continuation_t::none, false, 0, 0, "LMT", 1908, 5, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 9000, compiled_continuation_t::none, false, 0, 0, "%z", 1928, 6, { compiled_on_t::day, 0, 30 }, 86400, 0 },
+		{ 10800, compiled_continuation_t::none, false, 0, 0, "EAT", 1930, 1, { compiled_on_t::day, 0, 4 }, 86400, 0 },
+		{ 9000, compiled_continuation_t::none, false, 0, 0, "%z", 1936, 12, { compiled_on_t::day, 0, 31 }, 86400, 0 },
+		{ 9900, compiled_continuation_t::none, false, 0, 0, "%z", 1942, 7, { compiled_on_t::day, 0, 31 }, 86400, 0 },
+		{ 10800, compiled_continuation_t::none, false, 0, 0, "EAT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 3612, compiled_continuation_t::none, false, 0, 0, "LMT", 1912, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 3600, compiled_continuation_t::none, false, 0, 0, "WAT", 1979, 10, { compiled_on_t::day, 0, 14 }, 0, 0 },
+		{ 3600, compiled_continuation_t::save, true, 0, 3600, "WAST", 1980, 3, { compiled_on_t::day, 0, 8 }, 0, 0 },
+		{ 3600, compiled_continuation_t::none, false, 0, 0, "WAT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 1616, compiled_continuation_t::none, false, 0, 0, "LMT", 1884, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -2205, compiled_continuation_t::none, false, 0, 0, "LMT", 1912, 1, { compiled_on_t::day, 0, 1 }, 0, 2 },
+		{ 0, compiled_continuation_t::none, false, 0, 0, "GMT", 2018, 1, { compiled_on_t::day, 0, 1 }, 3600, 0 },
+		{ 3600, compiled_continuation_t::none, false, 0, 0, "WAT", 2019, 1, { compiled_on_t::day, 0, 1 }, 7200, 0 },
+		{ 0, compiled_continuation_t::none, false, 0, 0, "GMT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 3164, compiled_continuation_t::none, false, 0, 0, "LMT", 1920, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 3600, compiled_continuation_t::named, false, 54, 0, "CE%sT", 1959, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 7200, compiled_continuation_t::none, false, 0, 0, "EET", 1982, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 3600, compiled_continuation_t::named, false, 54, 0, "CE%sT", 1990, 5, { compiled_on_t::day, 0, 4 }, 0, 0 },
+		{ 7200, compiled_continuation_t::none, false, 0, 0, "EET", 1996, 9, { compiled_on_t::day, 0, 30 }, 0, 0 },
+		{ 3600, compiled_continuation_t::named, false, 54, 0, "CE%sT", 1997, 10, { compiled_on_t::day, 0, 4 }, 0, 0 },
+		{ 7200, compiled_continuation_t::none, false, 0, 0, "EET", 2012, 11, { compiled_on_t::day, 0, 10 }, 7200, 0 },
+		{ 3600, compiled_continuation_t::named, false, 54, 0, "CE%sT", 2013, 10, { compiled_on_t::day, 0, 25 }, 7200, 0 },
+		{ 7200, compiled_continuation_t::none, false, 0, 0, "EET", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 2444, compiled_continuation_t::none, false, 0, 0, "LMT", 1881, 5, { compiled_on_t::day, 0, 12 }, 0, 0 },
+		{ 561, compiled_continuation_t::none, false, 0, 0, "PMT", 1911, 3, { compiled_on_t::day, 0, 11 }, 0, 0 },
+		{ 3600, compiled_continuation_t::named, false, 118, 0, "CE%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 4104, compiled_continuation_t::none, false, 0, 0, "LMT", 1892, 2, { compiled_on_t::day, 0, 8 }, 0, 0 },
+		{ 5400, compiled_continuation_t::none, false, 0, 0, "%z", 1903, 3, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 7200, compiled_continuation_t::none, false, 0, 0, "SAST", 1942, 9, { compiled_on_t::day, 0, 20 }, 7200, 0 },
+		{ 7200, compiled_continuation_t::save, true, 0, 3600, "SAST", 1943, 3, { compiled_on_t::day, 0, 21 }, 7200, 0 },
+		{ 7200, compiled_continuation_t::none, false, 0, 0, "SAST", 1990, 3, { compiled_on_t::day, 0, 21 }, 0, 0 },
+		{ 7200, compiled_continuation_t::named, false, 63, 0, "%s", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 44002, compiled_continuation_t::none, false, 0, 0, "LMT", 1867, 10, { compiled_on_t::day, 0, 19 }, 45875, 0 },
+		{ -42398, compiled_continuation_t::none, false, 0, 0, "LMT", 1900, 8, { compiled_on_t::day, 0, 20 }, 43200, 0 },
+		{ -39600, compiled_continuation_t::none, false, 0, 0, "NST", 1942, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -39600, compiled_continuation_t::named, false, 125, 0, "N%sT", 1946, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -39600, compiled_continuation_t::none, false, 0, 0, "NST", 1967, 4, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -39600, compiled_continuation_t::none, false, 0, 0, "BST", 1969, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -39600, compiled_continuation_t::named, false, 125, 0, "B%sT", 1983, 10, { compiled_on_t::day, 0, 30 }, 7200, 0 },
+		{ -36000, compiled_continuation_t::named, false, 125, 0, "AH%sT", 1983, 11, { compiled_on_t::day, 0, 30 }, 0, 0 },
+		{ -36000, compiled_continuation_t::named, false, 125, 0, "H%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 50424, compiled_continuation_t::none, false, 0, 0, "LMT", 1867, 10, { compiled_on_t::day, 0, 19 }, 52297, 0 },
+		{ -35976, compiled_continuation_t::none, false, 0, 0, "LMT", 1900, 8, { compiled_on_t::day, 0, 20 }, 43200, 0 },
+		{ -36000, compiled_continuation_t::none, false, 0, 0, "AST", 1942, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -36000, compiled_continuation_t::named, false, 125, 0, "A%sT", 1967, 4, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -36000, compiled_continuation_t::none, false, 0, 0, "AHST", 1969, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -36000, compiled_continuation_t::named, false, 125, 0, "AH%sT", 1983, 10, { compiled_on_t::day, 0, 30 }, 7200, 0 },
+		{ -32400, compiled_continuation_t::named, false, 125, 0, "Y%sT", 1983, 11, { compiled_on_t::day, 0, 30 }, 0, 0 },
+		{ -32400, compiled_continuation_t::named, false, 125, 0, "AK%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -11568, compiled_continuation_t::none, false, 0, 0, "LMT", 1914, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -10800, compiled_continuation_t::named, false, 10, 0, "%z", 1990, 9, { compiled_on_t::day, 0, 17 }, 0, 0 },
+		{ -10800, compiled_continuation_t::none, false, 0, 0, "%z", 1995, 9, { compiled_on_t::day, 0, 14 }, 0, 0 },
+		{ -10800, compiled_continuation_t::named, false, 10, 0, "%z", 2003, 9, { compiled_on_t::day, 0, 24 }, 0, 0 },
+		{ -10800, compiled_continuation_t::none, false, 0, 0, "%z", 2012, 10, { compiled_on_t::day, 0, 21 }, 0, 0 },
+		{ -10800, compiled_continuation_t::named, false, 10, 0, "%z", 2013, 9, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -10800, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14028, compiled_continuation_t::none, false, 0, 0, "LMT", 1894, 10, { compiled_on_t::day, 0, 31 }, 0, 0 },
+		{ -15408, compiled_continuation_t::none, false, 0, 0, "CMT", 1920, 5, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "%z", 1930, 12, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::named, false, 0, 0, "%z", 1969, 10, { compiled_on_t::day, 0, 5 }, 0, 0 },
+		{ -10800, compiled_continuation_t::named, false, 0, 0, "%z", 1999, 10, { compiled_on_t::day, 0, 3 }, 0, 0 },
+		{ -14400, compiled_continuation_t::named, false, 0, 0, "%z", 2000, 3, { compiled_on_t::day, 0, 3 }, 0, 0 },
+		{ -10800, compiled_continuation_t::named, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -15788, compiled_continuation_t::none, false, 0, 0, "LMT", 1894, 10, { compiled_on_t::day, 0, 31 }, 0, 0 },
+		{ -15408, compiled_continuation_t::none, false, 0, 0, "CMT", 1920, 5, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "%z", 1930, 12, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::named, false, 0, 0, "%z", 1969, 10, { compiled_on_t::day, 0, 5 }, 0, 0 },
+		{ -10800, compiled_continuation_t::named, false, 0, 0, "%z", 1991, 3, { compiled_on_t::day, 0, 3 }, 0, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "%z", 1991, 10, { compiled_on_t::day, 0, 20 }, 0, 0 },
+		{ -10800, compiled_continuation_t::named, false, 0, 0, "%z", 1999, 10, { compiled_on_t::day, 0, 3 }, 0, 0 },
+		{ -14400, compiled_continuation_t::named, false, 0, 0, "%z", 2000, 3, { compiled_on_t::day, 0, 3 }, 0, 0 },
+		{ -10800, compiled_continuation_t::none, false, 0, 0, "%z", 2004, 6, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "%z", 2004, 6, { compiled_on_t::day, 0, 20 }, 0, 0 },
+		{ -10800, compiled_continuation_t::named, false, 0, 0, "%z", 2008, 10, { compiled_on_t::day, 0, 18 }, 0, 0 },
+		{ -10800, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -15408, compiled_continuation_t::none, false, 0, 0, "LMT", 1894, 10, { compiled_on_t::day, 0, 31 }, 0, 0 },
+		{ -15408, compiled_continuation_t::none, false, 0, 0, "CMT", 1920, 5, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "%z", 1930, 12, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::named, false, 0, 0, "%z", 1969, 10, { compiled_on_t::day, 0, 5 }, 0, 0 },
+		{ -10800, compiled_continuation_t::named, false, 0, 0, "%z", 1991, 3, { compiled_on_t::day, 0, 3 }, 0, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "%z", 1991, 10, { compiled_on_t::day, 0, 20 }, 0, 0 },
+		{ -10800, compiled_continuation_t::named, false, 0, 0, "%z", 1999, 10, { compiled_on_t::day, 0, 3 }, 0, 0 },
+		{ -14400, compiled_continuation_t::named, false, 0, 0, "%z", 2000, 3, { compiled_on_t::day, 0, 3 }, 0, 0 },
+		{ -10800, compiled_continuation_t::named, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -15672, compiled_continuation_t::none, false, 0, 0, "LMT", 1894, 10, { compiled_on_t::day, 0, 31 }, 0, 0 },
+		{ -15408, compiled_continuation_t::none, false, 0, 0, "CMT", 1920, 5, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "%z", 1930, 12, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::named, false, 0, 0, "%z", 1969, 10, { compiled_on_t::day, 0, 5 }, 0, 0 },
+		{ -10800, compiled_continuation_t::named, false, 0, 0, "%z", 1990, 3, { compiled_on_t::day, 0, 4 }, 0, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "%z", 1990, 10, { compiled_on_t::day, 0, 28 }, 0, 0 },
+		{ -14400, compiled_continuation_t::save, true, 0, 3600, "%z", 1991, 3, { compiled_on_t::day, 0, 17 }, 0, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "%z", 1991, 10, { compiled_on_t::day, 0, 6 }, 0, 0 },
+		{ -10800, compiled_continuation_t::save, true, 0, 3600, "%z", 1992, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -10800, compiled_continuation_t::named, false, 0, 0, "%z", 1999, 10, { compiled_on_t::day, 0, 3 }, 0, 0 },
+		{ -14400, compiled_continuation_t::named, false, 0, 0, "%z", 2000, 3, { compiled_on_t::day, 0, 3 }, 0, 0 },
+		{ -10800, compiled_continuation_t::named, false, 0, 0, "%z", 2008, 10, { compiled_on_t::day, 0, 18 }, 0, 0 },
+		{ -10800, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -16044, compiled_continuation_t::none, false, 0, 0, "LMT", 1894, 10, { compiled_on_t::day, 0, 31 }, 0, 0 },
+		{ -15408, compiled_continuation_t::none, false, 0, 0, "CMT", 1920, 5, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "%z", 1930, 12, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::named, false, 0, 0, "%z", 1969, 10, { compiled_on_t::day, 0, 5 }, 0, 0 },
+		{ -10800, compiled_continuation_t::named, false, 0, 0, "%z", 1991, 3, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "%z", 1991, 5, { compiled_on_t::day, 0, 7 }, 0, 0 },
+		{ -10800, compiled_continuation_t::named, false, 0, 0, "%z", 1999, 10, { compiled_on_t::day, 0, 3 }, 0, 0 },
+		{ -14400, compiled_continuation_t::named, false, 0, 0, "%z", 2000, 3, { compiled_on_t::day, 0, 3 }, 0, 0 },
+		{ -10800, compiled_continuation_t::none, false, 0, 0, "%z", 2004, 6, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "%z", 2004, 6, { compiled_on_t::day, 0, 20 }, 0, 0 },
+		{ -10800, compiled_continuation_t::named, false, 0, 0, "%z", 2008, 10, { compiled_on_t::day, 0, 18 }, 0, 0 },
+		{ -10800, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -16516, compiled_continuation_t::none, false, 0, 0, "LMT", 1894, 10, { compiled_on_t::day, 0, 31 }, 0, 0 },
+		{ -15408, compiled_continuation_t::none, false, 0, 0, "CMT", 1920, 5, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "%z", 1930, 12, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::named, false, 0, 0, "%z", 1969, 10, { compiled_on_t::day, 0, 5 }, 0, 0 },
+		{ -10800, compiled_continuation_t::named, false, 0, 0, "%z", 1990, 3, { compiled_on_t::day, 0, 4 }, 0, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "%z", 1990, 10, { compiled_on_t::day, 0, 15 }, 0, 0 },
+		{ -14400, compiled_continuation_t::save, true, 0, 3600, "%z", 1991, 3, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "%z", 1991, 10, { compiled_on_t::day, 0, 15 }, 0, 0 },
+		{ -14400, compiled_continuation_t::save, true, 0, 3600, "%z", 1992, 3, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "%z", 1992, 10, { compiled_on_t::day, 0, 18 }, 0, 0 },
+		{ -10800, compiled_continuation_t::named, false, 0, 0, "%z", 1999, 10, { compiled_on_t::day, 0, 3 }, 0, 0 },
+		{ -14400, compiled_continuation_t::named, false, 0, 0, "%z", 2000, 3, { compiled_on_t::day, 0, 3 }, 0, 0 },
+		{ -10800, compiled_continuation_t::none, false, 0, 0, "%z", 2004, 5, { compiled_on_t::day, 0, 23 }, 0, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "%z", 2004, 9, { compiled_on_t::day, 0, 26 }, 0, 0 },
+		{ -10800, compiled_continuation_t::named, false, 0, 0, "%z", 2008, 10, { compiled_on_t::day, 0, 18 }, 0, 0 },
+		{ -10800, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -16612, compiled_continuation_t::none, false, 0, 0, "LMT", 1894, 10, { compiled_on_t::day, 0, 31 }, 0, 0 },
+		{ -15408, compiled_continuation_t::none, false, 0, 0, "CMT", 1920, 5, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "%z", 1930, 12, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::named, false, 0, 0, "%z", 1969, 10, { compiled_on_t::day, 0, 5 }, 0, 0 },
+		{ -10800, compiled_continuation_t::named, false, 0, 0, "%z", 1999, 10, { compiled_on_t::day, 0, 3 }, 0, 0 },
+		{ -14400, compiled_continuation_t::named, false, 0, 0, "%z", 2000, 3, { compiled_on_t::day, 0, 3 }, 0, 0 },
+		{ -10800, compiled_continuation_t::none, false, 0, 0, "%z", 2004, 6, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "%z", 2004, 6, { compiled_on_t::day, 0, 20 }, 0, 0 },
+		{ -10800, compiled_continuation_t::named, false, 0, 0, "%z", 2008, 10, { compiled_on_t::day, 0, 18 }, 0, 0 },
+		{ -10800, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -15700, compiled_continuation_t::none, false, 0, 0, "LMT", 1894, 10, { compiled_on_t::day, 0, 31 }, 0, 0 },
+		{ -15408, compiled_continuation_t::none, false, 0, 0, "CMT", 1920, 5, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "%z", 1930, 12, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::named, false, 0, 0, "%z", 1969, 10, { compiled_on_t::day, 0, 5 }, 0, 0 },
+		{ -10800, compiled_continuation_t::named, false, 0, 0, "%z", 1991, 3, { compiled_on_t::day, 0, 3 }, 0, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "%z", 1991, 10, { compiled_on_t::day, 0, 20 }, 0, 0 },
+		{ -10800, compiled_continuation_t::named, false, 0, 0, "%z", 1999, 10, { compiled_on_t::day, 0, 3 }, 0, 0 },
+		{ -14400, compiled_continuation_t::named, false, 0, 0, "%z", 2000, 3, { compiled_on_t::day, 0, 3 }, 0, 0 },
+		{ -10800, compiled_continuation_t::named, false, 0, 0, "%z", 2008, 10, { compiled_on_t::day, 0, 18 }, 0, 0 },
+		{ -10800, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -16444, compiled_continuation_t::none, false, 0, 0, "LMT", 1894, 10, { compiled_on_t::day, 0, 31 }, 0, 0 },
+		{ -15408, compiled_continuation_t::none, false, 0, 0, "CMT", 1920, 5, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "%z", 1930, 12, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::named, false, 0, 0, "%z", 1969, 10, { compiled_on_t::day, 0, 5 }, 0, 0 },
+		{ -10800, compiled_continuation_t::named, false, 0, 0, "%z", 1991, 3, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "%z", 1991, 5, { compiled_on_t::day, 0, 7 }, 0, 0 },
+		{ -10800, compiled_continuation_t::named, false, 0, 0, "%z", 1999, 10, { compiled_on_t::day, 0, 3 }, 0, 0 },
+		{ -14400, compiled_continuation_t::named, false, 0, 0, "%z", 2000, 3, { compiled_on_t::day, 0, 3 }, 0, 0 },
+		{ -10800, compiled_continuation_t::none, false, 0, 0, "%z", 2004, 5, { compiled_on_t::day, 0, 31 }, 0, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "%z", 2004, 7, { compiled_on_t::day, 0, 25 }, 0, 0 },
+		{ -10800, compiled_continuation_t::named, false, 0, 0, "%z", 2008, 10, { compiled_on_t::day, 0, 18 }, 0, 0 },
+		{ -10800, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -15924, compiled_continuation_t::none, false, 0, 0, "LMT", 1894, 10, { compiled_on_t::day, 0, 31 }, 0, 0 },
+		{ -15408, compiled_continuation_t::none, false, 0, 0, "CMT", 1920, 5, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "%z", 1930, 12, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::named, false, 0, 0, "%z", 1969, 10, { compiled_on_t::day, 0, 5 }, 0, 0 },
+		{ -10800, compiled_continuation_t::named, false, 0, 0, "%z", 1990, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -10800, compiled_continuation_t::save, true, 0, 3600, "%z", 1990, 3, { compiled_on_t::day, 0, 14 }, 0, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "%z", 1990, 10, { compiled_on_t::day, 0, 15 }, 0, 0 },
+		{ -14400, compiled_continuation_t::save, true, 0, 3600, "%z", 1991, 3, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "%z", 1991, 6, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -10800, compiled_continuation_t::none, false, 0, 0, "%z", 1999, 10, { compiled_on_t::day, 0, 3 }, 0, 0 },
+		{ -14400, compiled_continuation_t::save, true, 0, 3600, "%z", 2000, 3, { compiled_on_t::day, 0, 3 }, 0, 0 },
+		{ -10800, compiled_continuation_t::none, false, 0, 0, "%z", 2004, 5, { compiled_on_t::day, 0, 31 }, 0, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "%z", 2004, 7, { compiled_on_t::day, 0, 25 }, 0, 0 },
+		{ -10800, compiled_continuation_t::named, false, 0, 0, "%z", 2008, 1, { compiled_on_t::day, 0, 21 }, 0, 0 },
+		{ -14400, compiled_continuation_t::named, false, 83, 0, "%z", 2009, 10, { compiled_on_t::day, 0, 11 }, 0, 0 },
+		{ -10800, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -15652, compiled_continuation_t::none, false, 0, 0, "LMT", 1894, 10, { compiled_on_t::day, 0, 31 }, 0, 0 },
+		{ -15408, compiled_continuation_t::none, false, 0, 0, "CMT", 1920, 5, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "%z", 1930, 12, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::named, false, 0, 0, "%z", 1969, 10, { compiled_on_t::day, 0, 5 }, 0, 0 },
+		{ -10800, compiled_continuation_t::named, false, 0, 0, "%z", 1991, 3, { compiled_on_t::day, 0, 3 }, 0, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "%z", 1991, 10, { compiled_on_t::day, 0, 20 }, 0, 0 },
+		{ -10800, compiled_continuation_t::named, false, 0, 0, "%z", 1999, 10, { compiled_on_t::day, 0, 3 }, 0, 0 },
+		{ -14400, compiled_continuation_t::named, false, 0, 0, "%z", 2000, 3, { compiled_on_t::day, 0, 3 }, 0, 0 },
+		{ -10800, compiled_continuation_t::none, false, 0, 0, "%z", 2004, 6, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "%z", 2004, 6, { compiled_on_t::day, 0, 13 }, 0, 0 },
+		{ -10800, compiled_continuation_t::named, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -16392, compiled_continuation_t::none, false, 0, 0, "LMT", 1894, 10, { compiled_on_t::day, 0, 31 }, 0, 0 },
+		{ -15408, compiled_continuation_t::none, false, 0, 0, "CMT", 1920, 5, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "%z", 1930, 12, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::named, false, 0, 0, "%z", 1969, 10, { compiled_on_t::day, 0, 5 }, 0, 0 },
+		{ -10800, compiled_continuation_t::named, false, 0, 0, "%z", 1999, 10, { compiled_on_t::day, 0, 3 }, 0, 0 },
+		{ -14400, compiled_continuation_t::named, false, 0, 0, "%z", 2000, 3, { compiled_on_t::day, 0, 3 }, 0, 0 },
+		{ -10800, compiled_continuation_t::none, false, 0, 0, "%z", 2004, 5, { compiled_on_t::day, 0, 30 }, 0, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "%z", 2004, 6, { compiled_on_t::day, 0, 20 }, 0, 0 },
+		{ -10800, compiled_continuation_t::named, false, 0, 0, "%z", 2008, 10, { compiled_on_t::day, 0, 18 }, 0, 0 },
+		{ -10800, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -13840, compiled_continuation_t::none, false, 0, 0, "LMT", 1890, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -13840, compiled_continuation_t::none, false, 0, 0, "AMT", 1931, 10, { compiled_on_t::day, 0, 10 }, 0, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "%z", 1972, 10, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -10800, compiled_continuation_t::none, false, 0, 0, "%z", 1974, 4, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::named, false, 128, 0, "%z", 2024, 10, { compiled_on_t::day, 0, 15 }, 0, 0 },
+		{ -10800, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -9244, compiled_continuation_t::none, false, 0, 0, "LMT", 1914, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -10800, compiled_continuation_t::named, false, 10, 0, "%z", 2003, 9, { compiled_on_t::day, 0, 24 }, 0, 0 },
+		{ -10800, compiled_continuation_t::none, false, 0, 0, "%z", 2011, 10, { compiled_on_t::day, 0, 16 }, 0, 0 },
+		{ -10800, compiled_continuation_t::named, false, 10, 0, "%z", 2012, 10, { compiled_on_t::day, 0, 21 }, 0, 0 },
+		{ -10800, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -25260, compiled_continuation_t::none, false, 0, 0, "LMT", 1922, 1, { compiled_on_t::day, 0, 1 }, 25200, 2 },
+		{ -25200, compiled_continuation_t::none, false, 0, 0, "MST", 1927, 6, { compiled_on_t::day, 0, 10 }, 0, 0 },
+		{ -21600, compiled_continuation_t::none, false, 0, 0, "CST", 1930, 11, { compiled_on_t::day, 0, 15 }, 0, 0 },
+		{ -25200, compiled_continuation_t::named, false, 117, 0, "M%sT", 1932, 4, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -21600, compiled_continuation_t::none, false, 0, 0, "CST", 1942, 4, { compiled_on_t::day, 0, 24 }, 0, 0 },
+		{ -25200, compiled_continuation_t::none, false, 0, 0, "MST", 1970, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -25200, compiled_continuation_t::named, false, 117, 0, "M%sT", 2010, 4, { compiled_on_t::day, 0, 4 }, 7200, 0 },
+		{ -21600, compiled_continuation_t::named, false, 117, 0, "C%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14309, compiled_continuation_t::none, false, 0, 0, "LMT", 1911, 8, { compiled_on_t::day, 0, 28 }, 0, 0 },
+		{ -14400, compiled_continuation_t::named, false, 11, 0, "A%sT", 1944, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::named, false, 11, 0, "AST/-0330", 1945, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::named, false, 11, 0, "A%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -11636, compiled_continuation_t::none, false, 0, 0, "LMT", 1914, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -10800, compiled_continuation_t::named, false, 10, 0, "%z", 1988, 9, { compiled_on_t::day, 0, 12 }, 0, 0 },
+		{ -10800, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -21168, compiled_continuation_t::none, false, 0, 0, "LMT", 1912, 4, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -21600, compiled_continuation_t::named, false, 14, 0, "%s", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14560, compiled_continuation_t::none, false, 0, 0, "LMT", 1914, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::named, false, 10, 0, "%z", 1988, 9, { compiled_on_t::day, 0, 12 }, 0, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "%z", 1999, 9, { compiled_on_t::day, 0, 30 }, 0, 0 },
+		{ -14400, compiled_continuation_t::named, false, 10, 0, "%z", 2000, 10, { compiled_on_t::day, 0, 15 }, 0, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -17776, compiled_continuation_t::none, false, 0, 0, "LMT", 1884, 3, { compiled_on_t::day, 0, 13 }, 0, 0 },
+		{ -17776, compiled_continuation_t::none, false, 0, 0, "BMT", 1914, 11, { compiled_on_t::day, 0, 23 }, 0, 0 },
+		{ -18000, compiled_continuation_t::named, false, 21, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -27889, compiled_continuation_t::none, false, 0, 0, "LMT", 1883, 11, { compiled_on_t::day, 0, 18 }, 72000, 2 },
+		{ -28800, compiled_continuation_t::named, false, 125, 0, "P%sT", 1923, 5, { compiled_on_t::day, 0, 13 }, 7200, 0 },
+		{ -25200, compiled_continuation_t::named, false, 125, 0, "M%sT", 1974, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -25200, compiled_continuation_t::none, false, 0, 0, "MST", 1974, 2, { compiled_on_t::day, 0, 3 }, 7200, 0 },
+		{ -25200, compiled_continuation_t::named, false, 125, 0, "M%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 0, compiled_continuation_t::none, false, 0, 0, "-00", 1920, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -25200, compiled_continuation_t::named, false, 101, 0, "M%sT", 1999, 10, { compiled_on_t::day, 0, 31 }, 7200, 0 },
+		{ -21600, compiled_continuation_t::named, false, 16, 0, "C%sT", 2000, 10, { compiled_on_t::day, 0, 29 }, 7200, 0 },
+		{ -18000, compiled_continuation_t::none, false, 0, 0, "EST", 2000, 11, { compiled_on_t::day, 0, 5 }, 0, 0 },
+		{ -21600, compiled_continuation_t::none, false, 0, 0, "CST", 2001, 4, { compiled_on_t::day, 0, 1 }, 10800, 0 },
+		{ -25200, compiled_continuation_t::named, false, 16, 0, "M%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -13108, compiled_continuation_t::none, false, 0, 0, "LMT", 1914, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::named, false, 10, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -20824, compiled_continuation_t::none, false, 0, 0, "LMT", 1922, 1, { compiled_on_t::day, 0, 1 }, 21600, 2 },
+		{ -21600, compiled_continuation_t::none, false, 0, 0, "CST", 1981, 12, { compiled_on_t::day, 0, 26 }, 7200, 0 },
+		{ -18000, compiled_continuation_t::none, false, 0, 0, "EST", 1983, 1, { compiled_on_t::day, 0, 4 }, 0, 0 },
+		{ -21600, compiled_continuation_t::named, false, 117, 0, "C%sT", 1997, 10, { compiled_on_t::day, 0, 26 }, 7200, 0 },
+		{ -18000, compiled_continuation_t::named, false, 117, 0, "E%sT", 1998, 8, { compiled_on_t::day, 0, 2 }, 7200, 0 },
+		{ -21600, compiled_continuation_t::named, false, 117, 0, "C%sT", 2015, 2, { compiled_on_t::day, 0, 1 }, 7200, 0 },
+		{ -18000, compiled_continuation_t::none, false, 0, 0, "EST", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -16064, compiled_continuation_t::none, false, 0, 0, "LMT", 1890, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -16060, compiled_continuation_t::none, false, 0, 0, "CMT", 1912, 2, { compiled_on_t::day, 0, 12 }, 0, 0 },
+		{ -16200, compiled_continuation_t::none, false, 0, 0, "%z", 1965, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "%z", 2007, 12, { compiled_on_t::day, 0, 9 }, 10800, 0 },
+		{ -16200, compiled_continuation_t::none, false, 0, 0, "%z", 2016, 5, { compiled_on_t::day, 0, 1 }, 9000, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -12560, compiled_continuation_t::none, false, 0, 0, "LMT", 1911, 7, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "%z", 1967, 10, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -10800, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -21036, compiled_continuation_t::none, false, 0, 0, "LMT", 1883, 11, { compiled_on_t::day, 0, 18 }, 64800, 2 },
+		{ -21600, compiled_continuation_t::named, false, 125, 0, "C%sT", 1920, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -21600, compiled_continuation_t::named, false, 25, 0, "C%sT", 1936, 3, { compiled_on_t::day, 0, 1 }, 7200, 0 },
+		{ -18000, compiled_continuation_t::none, false, 0, 0, "EST", 1936, 11, { compiled_on_t::day, 0, 15 }, 7200, 0 },
+		{ -21600, compiled_continuation_t::named, false, 25, 0, "C%sT", 1942, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -21600, compiled_continuation_t::named, false, 125, 0, "C%sT", 1946, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -21600, compiled_continuation_t::named, false, 25, 0, "C%sT", 1967, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -21600, compiled_continuation_t::named, false, 125, 0, "C%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -25460, compiled_continuation_t::none, false, 0, 0, "LMT", 1922, 1, { compiled_on_t::day, 0, 1 }, 25200, 2 },
+		{ -25200, compiled_continuation_t::none, false, 0, 0, "MST", 1927, 6, { compiled_on_t::day, 0, 10 }, 0, 0 },
+		{ -21600, compiled_continuation_t::none, false, 0, 0, "CST", 1930, 11, { compiled_on_t::day, 0, 15 }, 0, 0 },
+		{ -25200, compiled_continuation_t::named, false, 117, 0, "M%sT", 1932, 4, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -21600, compiled_continuation_t::none, false, 0, 0, "CST", 1996, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -21600, compiled_continuation_t::named, false, 117, 0, "C%sT", 1998, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -21600, compiled_continuation_t::none, false, 0, 0, "CST", 1998, 4, { compiled_on_t::weekday_ge, 0, 1 }, 10800, 0 },
+		{ -25200, compiled_continuation_t::named, false, 117, 0, "M%sT", 2022, 10, { compiled_on_t::day, 0, 30 }, 7200, 0 },
+		{ -21600, compiled_continuation_t::none, false, 0, 0, "CST", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -25556, compiled_continuation_t::none, false, 0, 0, "LMT", 1922, 1, { compiled_on_t::day, 0, 1 }, 25200, 2 },
+		{ -25200, compiled_continuation_t::none, false, 0, 0, "MST", 1927, 6, { compiled_on_t::day, 0, 10 }, 0, 0 },
+		{ -21600, compiled_continuation_t::none, false, 0, 0, "CST", 1930, 11, { compiled_on_t::day, 0, 15 }, 0, 0 },
+		{ -25200, compiled_continuation_t::named, false, 117, 0, "M%sT", 1932, 4, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -21600, compiled_continuation_t::none, false, 0, 0, "CST", 1996, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -21600, compiled_continuation_t::named, false, 117, 0, "C%sT", 1998, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -21600, compiled_continuation_t::none, false, 0, 0, "CST", 1998, 4, { compiled_on_t::weekday_ge, 0, 1 }, 10800, 0 },
+		{ -25200, compiled_continuation_t::named, false, 117, 0, "M%sT", 2010, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -25200, compiled_continuation_t::named, false, 125, 0, "M%sT", 2022, 10, { compiled_on_t::day, 0, 30 }, 7200, 0 },
+		{ -21600, compiled_continuation_t::none, false, 0, 0, "CST", 2022, 11, { compiled_on_t::day, 0, 30 }, 0, 0 },
+		{ -25200, compiled_continuation_t::named, false, 125, 0, "M%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -20173, compiled_continuation_t::none, false, 0, 0, "LMT", 1890, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -20173, compiled_continuation_t::none, false, 0, 0, "SJMT", 1921, 1, { compiled_on_t::day, 0, 15 }, 0, 0 },
+		{ -21600, compiled_continuation_t::named, false, 22, 0, "C%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -17296, compiled_continuation_t::none, false, 0, 0, "LMT", 1890, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -16965, compiled_continuation_t::none, false, 0, 0, "SMT", 1910, 1, { compiled_on_t::day, 0, 10 }, 0, 0 },
+		{ -18000, compiled_continuation_t::none, false, 0, 0, "%z", 1916, 7, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -16965, compiled_continuation_t::none, false, 0, 0, "SMT", 1918, 9, { compiled_on_t::day, 0, 10 }, 0, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "%z", 1919, 7, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -16965, compiled_continuation_t::none, false, 0, 0, "SMT", 1927, 9, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -18000, compiled_continuation_t::named, false, 127, 0, "%z", 1932, 9, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "%z", 1942, 6, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -18000, compiled_continuation_t::none, false, 0, 0, "%z", 1942, 8, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "%z", 1946, 8, { compiled_on_t::day, 0, 28 }, 86400, 0 },
+		{ -18000, compiled_continuation_t::save, true, 0, 3600, "%z", 1947, 3, { compiled_on_t::day, 0, 31 }, 86400, 0 },
+		{ -18000, compiled_continuation_t::none, false, 0, 0, "%z", 1947, 5, { compiled_on_t::day, 0, 21 }, 82800, 0 },
+		{ -14400, compiled_continuation_t::named, false, 127, 0, "%z", 2025, 3, { compiled_on_t::day, 0, 20 }, 0, 0 },
+		{ -10800, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -13460, compiled_continuation_t::none, false, 0, 0, "LMT", 1914, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::named, false, 10, 0, "%z", 2003, 9, { compiled_on_t::day, 0, 24 }, 0, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "%z", 2004, 10, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::named, false, 10, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -4480, compiled_continuation_t::none, false, 0, 0, "LMT", 1916, 7, { compiled_on_t::day, 0, 28 }, 0, 0 },
+		{ -10800, compiled_continuation_t::none, false, 0, 0, "%z", 1980, 4, { compiled_on_t::day, 0, 6 }, 7200, 0 },
+		{ -10800, compiled_continuation_t::named, false, 30, 0, "%z", 1996, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 0, compiled_continuation_t::none, false, 0, 0, "GMT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -33460, compiled_continuation_t::none, false, 0, 0, "LMT", 1900, 8, { compiled_on_t::day, 0, 20 }, 0, 0 },
+		{ -32400, compiled_continuation_t::named, false, 101, 0, "Y%sT", 1965, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -32400, compiled_continuation_t::named, false, 102, 0, "Y%sT", 1973, 10, { compiled_on_t::day, 0, 28 }, 0, 0 },
+		{ -28800, compiled_continuation_t::none, false, 0, 0, "PST", 1980, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -28800, compiled_continuation_t::named, false, 16, 0, "P%sT", 2020, 11, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -25200, compiled_continuation_t::none, false, 0, 0, "MST", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -28856, compiled_continuation_t::none, false, 0, 0, "LMT", 1884, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -28800, compiled_continuation_t::named, false, 16, 0, "P%sT", 1947, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -28800, compiled_continuation_t::named, false, 96, 0, "P%sT", 1972, 8, { compiled_on_t::day, 0, 30 }, 7200, 0 },
+		{ -25200, compiled_continuation_t::none, false, 0, 0, "MST", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -25196, compiled_continuation_t::none, false, 0, 0, "LMT", 1883, 11, { compiled_on_t::day, 0, 18 }, 68400, 2 },
+		{ -25200, compiled_continuation_t::named, false, 125, 0, "M%sT", 1920, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -25200, compiled_continuation_t::named, false, 28, 0, "M%sT", 1942, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -25200, compiled_continuation_t::named, false, 125, 0, "M%sT", 1946, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -25200, compiled_continuation_t::named, false, 28, 0, "M%sT", 1967, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -25200, compiled_continuation_t::named, false, 125, 0, "M%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -19931, compiled_continuation_t::none, false, 0, 0, "LMT", 1905, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -21600, compiled_continuation_t::none, false, 0, 0, "CST", 1915, 5, { compiled_on_t::day, 0, 15 }, 7200, 0 },
+		{ -18000, compiled_continuation_t::none, false, 0, 0, "EST", 1942, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -18000, compiled_continuation_t::named, false, 125, 0, "E%sT", 1946, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -18000, compiled_continuation_t::named, false, 29, 0, "E%sT", 1967, 6, { compiled_on_t::day, 0, 14 }, 60, 0 },
+		{ -18000, compiled_continuation_t::named, false, 125, 0, "E%sT", 1969, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -18000, compiled_continuation_t::none, false, 0, 0, "EST", 1973, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -18000, compiled_continuation_t::named, false, 125, 0, "E%sT", 1975, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -18000, compiled_continuation_t::none, false, 0, 0, "EST", 1975, 4, { compiled_on_t::day, 0, 27 }, 7200, 0 },
+		{ -18000, compiled_continuation_t::named, false, 125, 0, "E%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -27232, compiled_continuation_t::none, false, 0, 0, "LMT", 1906, 9, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -25200, compiled_continuation_t::named, false, 32, 0, "M%sT", 1987, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -25200, compiled_continuation_t::named, false, 16, 0, "M%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -16768, compiled_continuation_t::none, false, 0, 0, "LMT", 1914, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -18000, compiled_continuation_t::named, false, 10, 0, "%z", 1988, 9, { compiled_on_t::day, 0, 12 }, 0, 0 },
+		{ -18000, compiled_continuation_t::none, false, 0, 0, "%z", 1993, 9, { compiled_on_t::day, 0, 28 }, 0, 0 },
+		{ -18000, compiled_continuation_t::named, false, 10, 0, "%z", 1994, 9, { compiled_on_t::day, 0, 22 }, 0, 0 },
+		{ -18000, compiled_continuation_t::none, false, 0, 0, "%z", 2008, 6, { compiled_on_t::day, 0, 24 }, 0, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "%z", 2013, 11, { compiled_on_t::day, 0, 10 }, 0, 0 },
+		{ -18000, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -21408, compiled_continuation_t::none, false, 0, 0, "LMT", 1921, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -21600, compiled_continuation_t::named, false, 82, 0, "C%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -29447, compiled_continuation_t::none, false, 0, 0, "LMT", 1884, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -28800, compiled_continuation_t::named, false, 96, 0, "P%sT", 1946, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -28800, compiled_continuation_t::none, false, 0, 0, "PST", 1947, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -28800, compiled_continuation_t::named, false, 96, 0, "P%sT", 1987, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -28800, compiled_continuation_t::named, false, 16, 0, "P%sT", 2015, 3, { compiled_on_t::day, 0, 8 }, 7200, 0 },
+		{ -25200, compiled_continuation_t::none, false, 0, 0, "MST", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -9240, compiled_continuation_t::none, false, 0, 0, "LMT", 1914, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -10800, compiled_continuation_t::named, false, 10, 0, "%z", 1990, 9, { compiled_on_t::day, 0, 17 }, 0, 0 },
+		{ -10800, compiled_continuation_t::none, false, 0, 0, "%z", 1999, 9, { compiled_on_t::day, 0, 30 }, 0, 0 },
+		{ -10800, compiled_continuation_t::named, false, 10, 0, "%z", 2000, 10, { compiled_on_t::day, 0, 22 }, 0, 0 },
+		{ -10800, compiled_continuation_t::none, false, 0, 0, "%z", 2001, 9, { compiled_on_t::day, 0, 13 }, 0, 0 },
+		{ -10800, compiled_continuation_t::named, false, 10, 0, "%z", 2002, 10, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -10800, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14388, compiled_continuation_t::none, false, 0, 0, "LMT", 1902, 6, { compiled_on_t::day, 0, 15 }, 0, 0 },
+		{ -14400, compiled_continuation_t::named, false, 16, 0, "A%sT", 1953, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::named, false, 40, 0, "A%sT", 1954, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "AST", 1972, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::named, false, 40, 0, "A%sT", 1974, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::named, false, 16, 0, "A%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14500, compiled_continuation_t::none, false, 0, 0, "LMT", 1884, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -12652, compiled_continuation_t::none, false, 0, 0, "NST", 1918, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -12652, compiled_continuation_t::named, false, 16, 0, "N%sT", 1919, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -12652, compiled_continuation_t::none, false, 0, 0, "NST", 1935, 3, { compiled_on_t::day, 0, 30 }, 0, 0 },
+		{ -12600, compiled_continuation_t::none, false, 0, 0, "NST", 1936, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -12600, compiled_continuation_t::named, false, 114, 0, "N%sT", 1942, 5, { compiled_on_t::day, 0, 11 }, 0, 0 },
+		{ -12600, compiled_continuation_t::named, false, 16, 0, "N%sT", 1946, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -12600, compiled_continuation_t::named, false, 114, 0, "N%sT", 1966, 3, { compiled_on_t::day, 0, 15 }, 7200, 0 },
+		{ -14400, compiled_continuation_t::named, false, 114, 0, "A%sT", 2011, 11, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::named, false, 16, 0, "A%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -17072, compiled_continuation_t::none, false, 0, 0, "LMT", 1890, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -18430, compiled_continuation_t::none, false, 0, 0, "KMT", 1912, 2, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -18000, compiled_continuation_t::none, false, 0, 0, "EST", 1979, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -18000, compiled_continuation_t::named, false, 125, 0, "E%sT", 2015, 3, { compiled_on_t::day, 0, 8 }, 7200, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "AST", 2018, 3, { compiled_on_t::day, 0, 11 }, 10800, 0 },
+		{ -18000, compiled_continuation_t::named, false, 125, 0, "E%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -21724, compiled_continuation_t::none, false, 0, 0, "LMT", 1918, 10, { compiled_on_t::day, 0, 5 }, 0, 0 },
+		{ -21600, compiled_continuation_t::named, false, 38, 0, "C%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -19160, compiled_continuation_t::none, false, 0, 0, "LMT", 1890, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -18840, compiled_continuation_t::none, false, 0, 0, "QMT", 1931, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -18000, compiled_continuation_t::named, false, 31, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -13959, compiled_continuation_t::none, false, 0, 0, "LMT", 1911, 8, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "%z", 1915, 3, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -13500, compiled_continuation_t::none, false, 0, 0, "%z", 1975, 8, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -10800, compiled_continuation_t::none, false, 0, 0, "%z", 1992, 3, { compiled_on_t::day, 0, 29 }, 3600, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -15264, compiled_continuation_t::none, false, 0, 0, "LMT", 1902, 6, { compiled_on_t::day, 0, 15 }, 0, 0 },
+		{ -14400, compiled_continuation_t::named, false, 40, 0, "A%sT", 1918, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::named, false, 16, 0, "A%sT", 1919, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::named, false, 40, 0, "A%sT", 1942, 2, { compiled_on_t::day, 0, 9 }, 7200, 1 },
+		{ -14400, compiled_continuation_t::named, false, 16, 0, "A%sT", 1946, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::named, false, 40, 0, "A%sT", 1974, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::named, false, 16, 0, "A%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -19768, compiled_continuation_t::none, false, 0, 0, "LMT", 1890, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -19776, compiled_continuation_t::none, false, 0, 0, "HMT", 1925, 7, { compiled_on_t::day, 0, 19 }, 43200, 0 },
+		{ -18000, compiled_continuation_t::named, false, 77, 0, "C%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -26632, compiled_continuation_t::none, false, 0, 0, "LMT", 1922, 1, { compiled_on_t::day, 0, 1 }, 25200, 2 },
+		{ -25200, compiled_continuation_t::none, false, 0, 0, "MST", 1927, 6, { compiled_on_t::day, 0, 10 }, 0, 0 },
+		{ -21600, compiled_continuation_t::none, false, 0, 0, "CST", 1930, 11, { compiled_on_t::day, 0, 15 }, 0, 0 },
+		{ -25200, compiled_continuation_t::named, false, 117, 0, "M%sT", 1932, 4, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -21600, compiled_continuation_t::none, false, 0, 0, "CST", 1942, 4, { compiled_on_t::day, 0, 24 }, 0, 0 },
+		{ -25200, compiled_continuation_t::none, false, 0, 0, "MST", 1996, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -25200, compiled_continuation_t::named, false, 117, 0, "M%sT", 1999, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -25200, compiled_continuation_t::none, false, 0, 0, "MST", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -20678, compiled_continuation_t::none, false, 0, 0, "LMT", 1883, 11, { compiled_on_t::day, 0, 18 }, 64800, 2 },
+		{ -21600, compiled_continuation_t::named, false, 125, 0, "C%sT", 1920, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -21600, compiled_continuation_t::named, false, 48, 0, "C%sT", 1942, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -21600, compiled_continuation_t::named, false, 125, 0, "C%sT", 1946, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -21600, compiled_continuation_t::named, false, 48, 0, "C%sT", 1955, 4, { compiled_on_t::day, 0, 24 }, 7200, 0 },
+		{ -18000, compiled_continuation_t::none, false, 0, 0, "EST", 1957, 9, { compiled_on_t::day, 0, 29 }, 7200, 0 },
+		{ -21600, compiled_continuation_t::none, false, 0, 0, "CST", 1958, 4, { compiled_on_t::day, 0, 27 }, 7200, 0 },
+		{ -18000, compiled_continuation_t::none, false, 0, 0, "EST", 1969, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -18000, compiled_continuation_t::named, false, 125, 0, "E%sT", 1971, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -18000, compiled_continuation_t::none, false, 0, 0, "EST", 2006, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -18000, compiled_continuation_t::named, false, 125, 0, "E%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -20790, compiled_continuation_t::none, false, 0, 0, "LMT", 1883, 11, { compiled_on_t::day, 0, 18 }, 64800, 2 },
+		{ -21600, compiled_continuation_t::named, false, 125, 0, "C%sT", 1947, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -21600, compiled_continuation_t::named, false, 87, 0, "C%sT", 1962, 4, { compiled_on_t::day, 0, 29 }, 7200, 0 },
+		{ -18000, compiled_continuation_t::none, false, 0, 0, "EST", 1963, 10, { compiled_on_t::day, 0, 27 }, 7200, 0 },
+		{ -21600, compiled_continuation_t::named, false, 125, 0, "C%sT", 1991, 10, { compiled_on_t::day, 0, 27 }, 7200, 0 },
+		{ -18000, compiled_continuation_t::none, false, 0, 0, "EST", 2006, 4, { compiled_on_t::day, 0, 2 }, 7200, 0 },
+		{ -21600, compiled_continuation_t::named, false, 125, 0, "C%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -20723, compiled_continuation_t::none, false, 0, 0, "LMT", 1883, 11, { compiled_on_t::day, 0, 18 }, 64800, 2 },
+		{ -21600, compiled_continuation_t::named, false, 125, 0, "C%sT", 1951, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -21600, compiled_continuation_t::named, false, 61, 0, "C%sT", 1961, 4, { compiled_on_t::day, 0, 30 }, 7200, 0 },
+		{ -18000, compiled_continuation_t::none, false, 0, 0, "EST", 1969, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -18000, compiled_continuation_t::named, false, 125, 0, "E%sT", 1974, 1, { compiled_on_t::day, 0, 6 }, 7200, 0 },
+		{ -21600, compiled_continuation_t::save, true, 0, 3600, "CDT", 1974, 10, { compiled_on_t::day, 0, 27 }, 7200, 0 },
+		{ -18000, compiled_continuation_t::named, false, 125, 0, "E%sT", 1976, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -18000, compiled_continuation_t::none, false, 0, 0, "EST", 2006, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -18000, compiled_continuation_t::named, false, 125, 0, "E%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -20947, compiled_continuation_t::none, false, 0, 0, "LMT", 1883, 11, { compiled_on_t::day, 0, 18 }, 64800, 2 },
+		{ -21600, compiled_continuation_t::named, false, 125, 0, "C%sT", 1955, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -21600, compiled_continuation_t::named, false, 75, 0, "C%sT", 1965, 4, { compiled_on_t::day, 0, 25 }, 7200, 0 },
+		{ -18000, compiled_continuation_t::none, false, 0, 0, "EST", 1966, 10, { compiled_on_t::day, 0, 30 }, 7200, 0 },
+		{ -21600, compiled_continuation_t::named, false, 125, 0, "C%sT", 1977, 10, { compiled_on_t::day, 0, 30 }, 7200, 0 },
+		{ -18000, compiled_continuation_t::none, false, 0, 0, "EST", 2006, 4, { compiled_on_t::day, 0, 2 }, 7200, 0 },
+		{ -21600, compiled_continuation_t::named, false, 125, 0, "C%sT", 2007, 11, { compiled_on_t::day, 0, 4 }, 7200, 0 },
+		{ -18000, compiled_continuation_t::named, false, 125, 0, "E%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -20823, compiled_continuation_t::none, false, 0, 0, "LMT", 1883, 11, { compiled_on_t::day, 0, 18 }, 64800, 2 },
+		{ -21600, compiled_continuation_t::named, false, 125, 0, "C%sT", 1946, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -21600, compiled_continuation_t::named, false, 74, 0, "C%sT", 1964, 4, { compiled_on_t::day, 0, 26 }, 7200, 0 },
+		{ -18000, compiled_continuation_t::none, false, 0, 0, "EST", 1967, 10, { compiled_on_t::day, 0, 29 }, 7200, 0 },
+		{ -21600, compiled_continuation_t::named, false, 125, 0, "C%sT", 1969, 4, { compiled_on_t::day, 0, 27 }, 7200, 0 },
+		{ -18000, compiled_continuation_t::named, false, 125, 0, "E%sT", 1971, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -18000, compiled_continuation_t::none, false, 0, 0, "EST", 2006, 4, { compiled_on_t::day, 0, 2 }, 7200, 0 },
+		{ -21600, compiled_continuation_t::named, false, 125, 0, "C%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -20416, compiled_continuation_t::none, false, 0, 0, "LMT", 1883, 11, { compiled_on_t::day, 0, 18 }, 64800, 2 },
+		{ -21600, compiled_continuation_t::named, false, 125, 0, "C%sT", 1954, 4, { compiled_on_t::day, 0, 25 }, 7200, 0 },
+		{ -18000, compiled_continuation_t::none, false, 0, 0, "EST", 1969, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -18000, compiled_continuation_t::named, false, 125, 0, "E%sT", 1973, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -18000, compiled_continuation_t::none, false, 0, 0, "EST", 2006, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -18000, compiled_continuation_t::named, false, 125, 0, "E%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -21007, compiled_continuation_t::none, false, 0, 0, "LMT", 1883, 11, { compiled_on_t::day, 0, 18 }, 64800, 2 },
+		{ -21600, compiled_continuation_t::named, false, 125, 0, "C%sT", 1946, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -21600, compiled_continuation_t::named, false, 94, 0, "C%sT", 1964, 4, { compiled_on_t::day, 0, 26 }, 7200, 0 },
+		{ -18000, compiled_continuation_t::none, false, 0, 0, "EST", 1969, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -18000, compiled_continuation_t::named, false, 125, 0, "E%sT", 1971, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -18000, compiled_continuation_t::none, false, 0, 0, "EST", 2006, 4, { compiled_on_t::day, 0, 2 }, 7200, 0 },
+		{ -21600, compiled_continuation_t::named, false, 125, 0, "C%sT", 2007, 11, { compiled_on_t::day, 0, 4 }, 7200, 0 },
+		{ -18000, compiled_continuation_t::named, false, 125, 0, "E%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -20785, compiled_continuation_t::none, false, 0, 0, "LMT", 1883, 11, { compiled_on_t::day, 0, 18 }, 64800, 2 },
+		{ -21600, compiled_continuation_t::named, false, 125, 0, "C%sT", 1946, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -21600, compiled_continuation_t::named, false, 76, 0, "C%sT", 1961, 4, { compiled_on_t::day, 0, 30 }, 7200, 0 },
+		{ -18000, compiled_continuation_t::none, false, 0, 0, "EST", 1969, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -18000, compiled_continuation_t::named, false, 125, 0, "E%sT", 1971, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -18000, compiled_continuation_t::none, false, 0, 0, "EST", 2006, 4, { compiled_on_t::day, 0, 2 }, 7200, 0 },
+		{ -21600, compiled_continuation_t::named, false, 125, 0, "C%sT", 2007, 3, { compiled_on_t::day, 0, 11 }, 7200, 0 },
+		{ -18000, compiled_continuation_t::named, false, 125, 0, "E%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 0, compiled_continuation_t::none, false, 0, 0, "-00", 1953, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -28800, compiled_continuation_t::named, false, 101, 0, "P%sT", 1979, 4, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0 },
+		{ -25200, compiled_continuation_t::named, false, 101, 0, "M%sT", 1980, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -25200, compiled_continuation_t::named, false, 16, 0, "M%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 0, compiled_continuation_t::none, false, 0, 0, "-00", 1942, 8, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -18000, compiled_continuation_t::named, false, 101, 0, "E%sT", 1999, 10, { compiled_on_t::day, 0, 31 }, 7200, 0 },
+		{ -21600, compiled_continuation_t::named, false, 16, 0, "C%sT", 2000, 10, { compiled_on_t::day, 0, 29 }, 7200, 0 },
+		{ -18000, compiled_continuation_t::named, false, 16, 0, "E%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -18430, compiled_continuation_t::none, false, 0, 0, "LMT", 1890, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -18430, compiled_continuation_t::none, false, 0, 0, "KMT", 1912, 2, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -18000, compiled_continuation_t::none, false, 0, 0, "EST", 1974, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -18000, compiled_continuation_t::named, false, 125, 0, "E%sT", 1984, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -18000, compiled_continuation_t::none, false, 0, 0, "EST", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 54139, compiled_continuation_t::none, false, 0, 0, "LMT", 1867, 10, { compiled_on_t::day, 0, 19 }, 56012, 0 },
+		{ -32261, compiled_continuation_t::none, false, 0, 0, "LMT", 1900, 8, { compiled_on_t::day, 0, 20 }, 43200, 0 },
+		{ -28800, compiled_continuation_t::none, false, 0, 0, "PST", 1942, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -28800, compiled_continuation_t::named, false, 125, 0, "P%sT", 1946, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -28800, compiled_continuation_t::none, false, 0, 0, "PST", 1969, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -28800, compiled_continuation_t::named, false, 125, 0, "P%sT", 1980, 4, { compiled_on_t::day, 0, 27 }, 7200, 0 },
+		{ -32400, compiled_continuation_t::named, false, 125, 0, "Y%sT", 1980, 10, { compiled_on_t::day, 0, 26 }, 7200, 0 },
+		{ -28800, compiled_continuation_t::named, false, 125, 0, "P%sT", 1983, 10, { compiled_on_t::day, 0, 30 }, 7200, 0 },
+		{ -32400, compiled_continuation_t::named, false, 125, 0, "Y%sT", 1983, 11, { compiled_on_t::day, 0, 30 }, 0, 0 },
+		{ -32400, compiled_continuation_t::named, false, 125, 0, "AK%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -20582, compiled_continuation_t::none, false, 0, 0, "LMT", 1883, 11, { compiled_on_t::day, 0, 18 }, 64800, 2 },
+		{ -21600, compiled_continuation_t::named, false, 125, 0, "C%sT", 1921, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -21600, compiled_continuation_t::named, false, 126, 0, "C%sT", 1942, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -21600, compiled_continuation_t::named, false, 125, 0, "C%sT", 1946, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -21600, compiled_continuation_t::named, false, 126, 0, "C%sT", 1961, 7, { compiled_on_t::day, 0, 23 }, 7200, 0 },
+		{ -18000, compiled_continuation_t::none, false, 0, 0, "EST", 1968, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -18000, compiled_continuation_t::named, false, 125, 0, "E%sT", 1974, 1, { compiled_on_t::day, 0, 6 }, 7200, 0 },
+		{ -21600, compiled_continuation_t::save, true, 0, 3600, "CDT", 1974, 10, { compiled_on_t::day, 0, 27 }, 7200, 0 },
+		{ -18000, compiled_continuation_t::named, false, 125, 0, "E%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -20364, compiled_continuation_t::none, false, 0, 0, "LMT", 1883, 11, { compiled_on_t::day, 0, 18 }, 64800, 2 },
+		{ -21600, compiled_continuation_t::named, false, 125, 0, "C%sT", 1946, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -21600, compiled_continuation_t::none, false, 0, 0, "CST", 1968, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -21600, compiled_continuation_t::named, false, 125, 0, "C%sT", 2000, 10, { compiled_on_t::day, 0, 29 }, 7200, 0 },
+		{ -18000, compiled_continuation_t::named, false, 125, 0, "E%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -16356, compiled_continuation_t::none, false, 0, 0, "LMT", 1890, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -16356, compiled_continuation_t::none, false, 0, 0, "CMT", 1931, 10, { compiled_on_t::day, 0, 15 }, 0, 0 },
+		{ -16356, compiled_continuation_t::save, true, 0, 3600, "BST", 1932, 3, { compiled_on_t::day, 0, 21 }, 0, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -18492, compiled_continuation_t::none, false, 0, 0, "LMT", 1890, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -18516, compiled_continuation_t::none, false, 0, 0, "LMT", 1908, 7, { compiled_on_t::day, 0, 28 }, 0, 0 },
+		{ -18000, compiled_continuation_t::named, false, 71, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -28378, compiled_continuation_t::none, false, 0, 0, "LMT", 1883, 11, { compiled_on_t::day, 0, 18 }, 72000, 2 },
+		{ -28800, compiled_continuation_t::named, false, 125, 0, "P%sT", 1946, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -28800, compiled_continuation_t::named, false, 17, 0, "P%sT", 1967, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -28800, compiled_continuation_t::named, false, 125, 0, "P%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -8572, compiled_continuation_t::none, false, 0, 0, "LMT", 1914, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -10800, compiled_continuation_t::named, false, 10, 0, "%z", 1990, 9, { compiled_on_t::day, 0, 17 }, 0, 0 },
+		{ -10800, compiled_continuation_t::none, false, 0, 0, "%z", 1995, 10, { compiled_on_t::day, 0, 13 }, 0, 0 },
+		{ -10800, compiled_continuation_t::named, false, 10, 0, "%z", 1996, 9, { compiled_on_t::day, 0, 4 }, 0, 0 },
+		{ -10800, compiled_continuation_t::none, false, 0, 0, "%z", 1999, 9, { compiled_on_t::day, 0, 30 }, 0, 0 },
+		{ -10800, compiled_continuation_t::named, false, 10, 0, "%z", 2000, 10, { compiled_on_t::day, 0, 22 }, 0, 0 },
+		{ -10800, compiled_continuation_t::none, false, 0, 0, "%z", 2001, 9, { compiled_on_t::day, 0, 13 }, 0, 0 },
+		{ -10800, compiled_continuation_t::named, false, 10, 0, "%z", 2002, 10, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -10800, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -20708, compiled_continuation_t::none, false, 0, 0, "LMT", 1890, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -20712, compiled_continuation_t::none, false, 0, 0, "MMT", 1934, 6, { compiled_on_t::day, 0, 23 }, 0, 0 },
+		{ -21600, compiled_continuation_t::none, false, 0, 0, "CST", 1973, 5, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -18000, compiled_continuation_t::none, false, 0, 0, "EST", 1975, 2, { compiled_on_t::day, 0, 16 }, 0, 0 },
+		{ -21600, compiled_continuation_t::named, false, 66, 0, "C%sT", 1992, 1, { compiled_on_t::day, 0, 1 }, 14400, 0 },
+		{ -18000, compiled_continuation_t::none, false, 0, 0, "EST", 1992, 9, { compiled_on_t::day, 0, 24 }, 0, 0 },
+		{ -21600, compiled_continuation_t::none, false, 0, 0, "CST", 1993, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -18000, compiled_continuation_t::none, false, 0, 0, "EST", 1997, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -21600, compiled_continuation_t::named, false, 66, 0, "C%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14404, compiled_continuation_t::none, false, 0, 0, "LMT", 1914, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::named, false, 10, 0, "%z", 1988, 9, { compiled_on_t::day, 0, 12 }, 0, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "%z", 1993, 9, { compiled_on_t::day, 0, 28 }, 0, 0 },
+		{ -14400, compiled_continuation_t::named, false, 10, 0, "%z", 1994, 9, { compiled_on_t::day, 0, 22 }, 0, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14660, compiled_continuation_t::none, false, 0, 0, "LMT", 1890, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14660, compiled_continuation_t::none, false, 0, 0, "FFMT", 1911, 5, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "AST", 1980, 4, { compiled_on_t::day, 0, 6 }, 0, 0 },
+		{ -14400, compiled_continuation_t::save, true, 0, 3600, "ADT", 1980, 9, { compiled_on_t::day, 0, 28 }, 0, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "AST", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -23400, compiled_continuation_t::none, false, 0, 0, "LMT", 1922, 1, { compiled_on_t::day, 0, 1 }, 21600, 2 },
+		{ -21600, compiled_continuation_t::none, false, 0, 0, "CST", 1988, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -21600, compiled_continuation_t::named, false, 125, 0, "C%sT", 1989, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -21600, compiled_continuation_t::named, false, 117, 0, "C%sT", 2010, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -21600, compiled_continuation_t::named, false, 125, 0, "C%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -25540, compiled_continuation_t::none, false, 0, 0, "LMT", 1922, 1, { compiled_on_t::day, 0, 1 }, 25200, 2 },
+		{ -25200, compiled_continuation_t::none, false, 0, 0, "MST", 1927, 6, { compiled_on_t::day, 0, 10 }, 0, 0 },
+		{ -21600, compiled_continuation_t::none, false, 0, 0, "CST", 1930, 11, { compiled_on_t::day, 0, 15 }, 0, 0 },
+		{ -25200, compiled_continuation_t::named, false, 117, 0, "M%sT", 1932, 4, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -21600, compiled_continuation_t::none, false, 0, 0, "CST", 1942, 4, { compiled_on_t::day, 0, 24 }, 0, 0 },
+		{ -25200, compiled_continuation_t::none, false, 0, 0, "MST", 1970, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -25200, compiled_continuation_t::named, false, 117, 0, "M%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -21027, compiled_continuation_t::none, false, 0, 0, "LMT", 1885, 9, { compiled_on_t::day, 0, 18 }, 43200, 0 },
+		{ -21600, compiled_continuation_t::named, false, 125, 0, "C%sT", 1946, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -21600, compiled_continuation_t::named, false, 62, 0, "C%sT", 1969, 4, { compiled_on_t::day, 0, 27 }, 7200, 0 },
+		{ -18000, compiled_continuation_t::none, false, 0, 0, "EST", 1973, 4, { compiled_on_t::day, 0, 29 }, 7200, 0 },
+		{ -21600, compiled_continuation_t::named, false, 125, 0, "C%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -21508, compiled_continuation_t::none, false, 0, 0, "LMT", 1922, 1, { compiled_on_t::day, 0, 1 }, 21600, 2 },
+		{ -21600, compiled_continuation_t::none, false, 0, 0, "CST", 1981, 12, { compiled_on_t::day, 0, 26 }, 7200, 0 },
+		{ -18000, compiled_continuation_t::none, false, 0, 0, "EST", 1982, 11, { compiled_on_t::day, 0, 2 }, 7200, 0 },
+		{ -21600, compiled_continuation_t::named, false, 117, 0, "C%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 54822, compiled_continuation_t::none, false, 0, 0, "LMT", 1867, 10, { compiled_on_t::day, 0, 19 }, 56695, 0 },
+		{ -31578, compiled_continuation_t::none, false, 0, 0, "LMT", 1900, 8, { compiled_on_t::day, 0, 20 }, 43200, 0 },
+		{ -28800, compiled_continuation_t::none, false, 0, 0, "PST", 1942, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -28800, compiled_continuation_t::named, false, 125, 0, "P%sT", 1946, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -28800, compiled_continuation_t::none, false, 0, 0, "PST", 1969, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -28800, compiled_continuation_t::named, false, 125, 0, "P%sT", 1983, 10, { compiled_on_t::day, 0, 30 }, 7200, 0 },
+		{ -28800, compiled_continuation_t::none, false, 0, 0, "PST", 2015, 11, { compiled_on_t::day, 0, 1 }, 7200, 0 },
+		{ -32400, compiled_continuation_t::named, false, 125, 0, "AK%sT", 2018, 11, { compiled_on_t::day, 0, 4 }, 7200, 0 },
+		{ -28800, compiled_continuation_t::none, false, 0, 0, "PST", 2019, 1, { compiled_on_t::day, 0, 20 }, 7200, 0 },
+		{ -32400, compiled_continuation_t::named, false, 125, 0, "AK%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -23796, compiled_continuation_t::none, false, 0, 0, "LMT", 1922, 1, { compiled_on_t::day, 0, 1 }, 25200, 2 },
+		{ -25200, compiled_continuation_t::none, false, 0, 0, "MST", 1927, 6, { compiled_on_t::day, 0, 10 }, 0, 0 },
+		{ -21600, compiled_continuation_t::none, false, 0, 0, "CST", 1930, 11, { compiled_on_t::day, 0, 15 }, 0, 0 },
+		{ -25200, compiled_continuation_t::named, false, 117, 0, "M%sT", 1932, 4, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -21600, compiled_continuation_t::named, false, 117, 0, "C%sT", 2001, 9, { compiled_on_t::day, 0, 30 }, 7200, 0 },
+		{ -21600, compiled_continuation_t::none, false, 0, 0, "CST", 2002, 2, { compiled_on_t::day, 0, 20 }, 0, 0 },
+		{ -21600, compiled_continuation_t::named, false, 117, 0, "C%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -13480, compiled_continuation_t::none, false, 0, 0, "LMT", 1911, 6, { compiled_on_t::day, 0, 15 }, 0, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "AST", 1980, 5, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -10800, compiled_continuation_t::none, false, 0, 0, "%z", 1987, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -10800, compiled_continuation_t::named, false, 16, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -15548, compiled_continuation_t::none, false, 0, 0, "LMT", 1883, 12, { compiled_on_t::day, 0, 9 }, 0, 0 },
+		{ -18000, compiled_continuation_t::none, false, 0, 0, "EST", 1902, 6, { compiled_on_t::day, 0, 15 }, 0, 0 },
+		{ -14400, compiled_continuation_t::named, false, 16, 0, "A%sT", 1933, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::named, false, 119, 0, "A%sT", 1942, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::named, false, 16, 0, "A%sT", 1946, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::named, false, 119, 0, "A%sT", 1973, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::named, false, 16, 0, "A%sT", 1993, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::named, false, 119, 0, "A%sT", 2007, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::named, false, 16, 0, "A%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -24076, compiled_continuation_t::none, false, 0, 0, "LMT", 1922, 1, { compiled_on_t::day, 0, 1 }, 21600, 2 },
+		{ -25200, compiled_continuation_t::none, false, 0, 0, "MST", 1927, 6, { compiled_on_t::day, 0, 10 }, 0, 0 },
+		{ -21600, compiled_continuation_t::none, false, 0, 0, "CST", 1930, 11, { compiled_on_t::day, 0, 15 }, 0, 0 },
+		{ -25200, compiled_continuation_t::named, false, 117, 0, "M%sT", 1932, 4, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -21600, compiled_continuation_t::none, false, 0, 0, "CST", 1988, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -21600, compiled_continuation_t::named, false, 125, 0, "C%sT", 1989, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -21600, compiled_continuation_t::named, false, 117, 0, "C%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -13491, compiled_continuation_t::none, false, 0, 0, "LMT", 1908, 6, { compiled_on_t::day, 0, 10 }, 0, 0 },
+		{ -13491, compiled_continuation_t::none, false, 0, 0, "MMT", 1920, 5, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "%z", 1923, 10, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -12600, compiled_continuation_t::named, false, 93, 0, "%z", 1942, 12, { compiled_on_t::day, 0, 14 }, 0, 0 },
+		{ -10800, compiled_continuation_t::named, false, 93, 0, "%z", 1960, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -10800, compiled_continuation_t::named, false, 93, 0, "%z", 1968, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -10800, compiled_continuation_t::named, false, 93, 0, "%z", 1970, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -10800, compiled_continuation_t::named, false, 93, 0, "%z", 1974, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -10800, compiled_continuation_t::named, false, 93, 0, "%z", 1974, 3, { compiled_on_t::day, 0, 10 }, 0, 0 },
+		{ -10800, compiled_continuation_t::named, false, 93, 0, "%z", 1974, 12, { compiled_on_t::day, 0, 22 }, 0, 0 },
+		{ -10800, compiled_continuation_t::named, false, 93, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -17762, compiled_continuation_t::none, false, 0, 0, "LMT", 1883, 11, { compiled_on_t::day, 0, 18 }, 61200, 2 },
+		{ -18000, compiled_continuation_t::named, false, 125, 0, "E%sT", 1920, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -18000, compiled_continuation_t::named, false, 67, 0, "E%sT", 1942, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -18000, compiled_continuation_t::named, false, 125, 0, "E%sT", 1946, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -18000, compiled_continuation_t::named, false, 67, 0, "E%sT", 1967, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -18000, compiled_continuation_t::named, false, 125, 0, "E%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 46702, compiled_continuation_t::none, false, 0, 0, "LMT", 1867, 10, { compiled_on_t::day, 0, 19 }, 48575, 0 },
+		{ -39698, compiled_continuation_t::none, false, 0, 0, "LMT", 1900, 8, { compiled_on_t::day, 0, 20 }, 43200, 0 },
+		{ -39600, compiled_continuation_t::none, false, 0, 0, "NST", 1942, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -39600, compiled_continuation_t::named, false, 125, 0, "N%sT", 1946, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -39600, compiled_continuation_t::none, false, 0, 0, "NST", 1967, 4, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -39600, compiled_continuation_t::none, false, 0, 0, "BST", 1969, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -39600, compiled_continuation_t::named, false, 125, 0, "B%sT", 1983, 10, { compiled_on_t::day, 0, 30 }, 7200, 0 },
+		{ -32400, compiled_continuation_t::named, false, 125, 0, "Y%sT", 1983, 11, { compiled_on_t::day, 0, 30 }, 0, 0 },
+		{ -32400, compiled_continuation_t::named, false, 125, 0, "AK%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -7780, compiled_continuation_t::none, false, 0, 0, "LMT", 1914, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -7200, compiled_continuation_t::named, false, 10, 0, "%z", 1990, 9, { compiled_on_t::day, 0, 17 }, 0, 0 },
+		{ -7200, compiled_continuation_t::none, false, 0, 0, "%z", 1999, 9, { compiled_on_t::day, 0, 30 }, 0, 0 },
+		{ -7200, compiled_continuation_t::named, false, 10, 0, "%z", 2000, 10, { compiled_on_t::day, 0, 15 }, 0, 0 },
+		{ -7200, compiled_continuation_t::none, false, 0, 0, "%z", 2001, 9, { compiled_on_t::day, 0, 13 }, 0, 0 },
+		{ -7200, compiled_continuation_t::named, false, 10, 0, "%z", 2002, 10, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -7200, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -24427, compiled_continuation_t::none, false, 0, 0, "LMT", 1883, 11, { compiled_on_t::day, 0, 18 }, 68400, 2 },
+		{ -25200, compiled_continuation_t::named, false, 125, 0, "M%sT", 2010, 11, { compiled_on_t::day, 0, 7 }, 7200, 0 },
+		{ -21600, compiled_continuation_t::named, false, 125, 0, "C%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -24312, compiled_continuation_t::none, false, 0, 0, "LMT", 1883, 11, { compiled_on_t::day, 0, 18 }, 68400, 2 },
+		{ -25200, compiled_continuation_t::named, false, 125, 0, "M%sT", 1992, 10, { compiled_on_t::day, 0, 25 }, 7200, 0 },
+		{ -21600, compiled_continuation_t::named, false, 125, 0, "C%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -24339, compiled_continuation_t::none, false, 0, 0, "LMT", 1883, 11, { compiled_on_t::day, 0, 18 }, 68400, 2 },
+		{ -25200, compiled_continuation_t::named, false, 125, 0, "M%sT", 2003, 10, { compiled_on_t::day, 0, 26 }, 7200, 0 },
+		{ -21600, compiled_continuation_t::named, false, 125, 0, "C%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -12416, compiled_continuation_t::none, false, 0, 0, "LMT", 1916, 7, { compiled_on_t::day, 0, 28 }, 0, 0 },
+		{ -10800, compiled_continuation_t::none, false, 0, 0, "%z", 1980, 4, { compiled_on_t::day, 0, 6 }, 7200, 0 },
+		{ -10800, compiled_continuation_t::named, false, 30, 0, "%z", 2023, 3, { compiled_on_t::day, 0, 26 }, 3600, 2 },
+		{ -7200, compiled_continuation_t::none, false, 0, 0, "%z", 2023, 10, { compiled_on_t::day, 0, 29 }, 3600, 2 },
+		{ -7200, compiled_continuation_t::named, false, 30, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -25060, compiled_continuation_t::none, false, 0, 0, "LMT", 1922, 1, { compiled_on_t::day, 0, 1 }, 25200, 2 },
+		{ -25200, compiled_continuation_t::none, false, 0, 0, "MST", 1927, 6, { compiled_on_t::day, 0, 10 }, 0, 0 },
+		{ -21600, compiled_continuation_t::none, false, 0, 0, "CST", 1930, 11, { compiled_on_t::day, 0, 15 }, 0, 0 },
+		{ -25200, compiled_continuation_t::named, false, 117, 0, "M%sT", 1932, 4, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -21600, compiled_continuation_t::none, false, 0, 0, "CST", 1996, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -21600, compiled_continuation_t::named, false, 117, 0, "C%sT", 1998, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -21600, compiled_continuation_t::none, false, 0, 0, "CST", 1998, 4, { compiled_on_t::weekday_ge, 0, 1 }, 10800, 0 },
+		{ -25200, compiled_continuation_t::named, false, 117, 0, "M%sT", 2010, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -25200, compiled_continuation_t::named, false, 125, 0, "M%sT", 2022, 10, { compiled_on_t::day, 0, 30 }, 7200, 0 },
+		{ -21600, compiled_continuation_t::none, false, 0, 0, "CST", 2022, 11, { compiled_on_t::day, 0, 30 }, 0, 0 },
+		{ -21600, compiled_continuation_t::named, false, 125, 0, "C%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -19088, compiled_continuation_t::none, false, 0, 0, "LMT", 1890, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -19176, compiled_continuation_t::none, false, 0, 0, "CMT", 1908, 4, { compiled_on_t::day, 0, 22 }, 0, 0 },
+		{ -18000, compiled_continuation_t::none, false, 0, 0, "EST", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -13240, compiled_continuation_t::none, false, 0, 0, "LMT", 1911, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -13252, compiled_continuation_t::none, false, 0, 0, "PMT", 1935, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -13236, compiled_continuation_t::none, false, 0, 0, "PMT", 1945, 10, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -12600, compiled_continuation_t::none, false, 0, 0, "%z", 1984, 10, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -10800, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -26898, compiled_continuation_t::none, false, 0, 0, "LMT", 1883, 11, { compiled_on_t::day, 0, 18 }, 68400, 2 },
+		{ -25200, compiled_continuation_t::named, false, 125, 0, "M%sT", 1944, 1, { compiled_on_t::day, 0, 1 }, 60, 0 },
+		{ -25200, compiled_continuation_t::none, false, 0, 0, "MST", 1944, 4, { compiled_on_t::day, 0, 1 }, 60, 0 },
+		{ -25200, compiled_continuation_t::named, false, 125, 0, "M%sT", 1944, 10, { compiled_on_t::day, 0, 1 }, 60, 0 },
+		{ -25200, compiled_continuation_t::none, false, 0, 0, "MST", 1967, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -25200, compiled_continuation_t::named, false, 125, 0, "M%sT", 1968, 3, { compiled_on_t::day, 0, 21 }, 0, 0 },
+		{ -25200, compiled_continuation_t::none, false, 0, 0, "MST", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -17360, compiled_continuation_t::none, false, 0, 0, "LMT", 1890, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -17340, compiled_continuation_t::none, false, 0, 0, "PPMT", 1917, 1, { compiled_on_t::day, 0, 24 }, 43200, 0 },
+		{ -18000, compiled_continuation_t::named, false, 43, 0, "E%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -15336, compiled_continuation_t::none, false, 0, 0, "LMT", 1914, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::named, false, 10, 0, "%z", 1988, 9, { compiled_on_t::day, 0, 12 }, 0, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -15865, compiled_continuation_t::none, false, 0, 0, "LMT", 1899, 3, { compiled_on_t::day, 0, 28 }, 43200, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "AST", 1942, 5, { compiled_on_t::day, 0, 3 }, 0, 0 },
+		{ -14400, compiled_continuation_t::named, false, 125, 0, "A%sT", 1946, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "AST", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -17020, compiled_continuation_t::none, false, 0, 0, "LMT", 1890, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -16965, compiled_continuation_t::none, false, 0, 0, "SMT", 1910, 1, { compiled_on_t::day, 0, 10 }, 0, 0 },
+		{ -18000, compiled_continuation_t::none, false, 0, 0, "%z", 1916, 7, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -16965, compiled_continuation_t::none, false, 0, 0, "SMT", 1918, 9, { compiled_on_t::day, 0, 10 }, 0, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "%z", 1919, 7, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -16965, compiled_continuation_t::none, false, 0, 0, "SMT", 1927, 9, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -18000, compiled_continuation_t::named, false, 127, 0, "%z", 1932, 9, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "%z", 1942, 6, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -18000, compiled_continuation_t::none, false, 0, 0, "%z", 1942, 8, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "%z", 1946, 8, { compiled_on_t::day, 0, 28 }, 86400, 0 },
+		{ -18000, compiled_continuation_t::save, true, 0, 3600, "%z", 1947, 3, { compiled_on_t::day, 0, 31 }, 86400, 0 },
+		{ -18000, compiled_continuation_t::none, false, 0, 0, "%z", 1947, 5, { compiled_on_t::day, 0, 21 }, 82800, 0 },
+		{ -14400, compiled_continuation_t::named, false, 127, 0, "%z", 2016, 12, { compiled_on_t::day, 0, 4 }, 0, 0 },
+		{ -10800, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 0, compiled_continuation_t::none, false, 0, 0, "-00", 1957, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -21600, compiled_continuation_t::named, false, 101, 0, "C%sT", 2000, 10, { compiled_on_t::day, 0, 29 }, 7200, 0 },
+		{ -18000, compiled_continuation_t::none, false, 0, 0, "EST", 2001, 4, { compiled_on_t::day, 0, 1 }, 10800, 0 },
+		{ -21600, compiled_continuation_t::named, false, 16, 0, "C%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -8376, compiled_continuation_t::none, false, 0, 0, "LMT", 1914, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -10800, compiled_continuation_t::named, false, 10, 0, "%z", 1990, 9, { compiled_on_t::day, 0, 17 }, 0, 0 },
+		{ -10800, compiled_continuation_t::none, false, 0, 0, "%z", 1999, 9, { compiled_on_t::day, 0, 30 }, 0, 0 },
+		{ -10800, compiled_continuation_t::named, false, 10, 0, "%z", 2000, 10, { compiled_on_t::day, 0, 15 }, 0, 0 },
+		{ -10800, compiled_continuation_t::none, false, 0, 0, "%z", 2001, 9, { compiled_on_t::day, 0, 13 }, 0, 0 },
+		{ -10800, compiled_continuation_t::named, false, 10, 0, "%z", 2002, 10, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -10800, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -25116, compiled_continuation_t::none, false, 0, 0, "LMT", 1905, 9, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -25200, compiled_continuation_t::named, false, 122, 0, "M%sT", 1960, 4, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0 },
+		{ -21600, compiled_continuation_t::none, false, 0, 0, "CST", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 0, compiled_continuation_t::none, false, 0, 0, "-00", 1947, 8, { compiled_on_t::day, 0, 31 }, 0, 0 },
+		{ -21600, compiled_continuation_t::named, false, 101, 0, "C%sT", 2000, 10, { compiled_on_t::day, 0, 29 }, 7200, 0 },
+		{ -18000, compiled_continuation_t::none, false, 0, 0, "EST", 2001, 4, { compiled_on_t::day, 0, 1 }, 10800, 0 },
+		{ -21600, compiled_continuation_t::named, false, 16, 0, "C%sT", 2006, 10, { compiled_on_t::day, 0, 29 }, 7200, 0 },
+		{ -18000, compiled_continuation_t::none, false, 0, 0, "EST", 2007, 3, { compiled_on_t::day, 0, 11 }, 10800, 0 },
+		{ -21600, compiled_continuation_t::named, false, 16, 0, "C%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -16272, compiled_continuation_t::none, false, 0, 0, "LMT", 1914, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -18000, compiled_continuation_t::named, false, 10, 0, "%z", 1988, 9, { compiled_on_t::day, 0, 12 }, 0, 0 },
+		{ -18000, compiled_continuation_t::none, false, 0, 0, "%z", 2008, 6, { compiled_on_t::day, 0, 24 }, 0, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "%z", 2013, 11, { compiled_on_t::day, 0, 10 }, 0, 0 },
+		{ -18000, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -13128, compiled_continuation_t::none, false, 0, 0, "LMT", 1914, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::named, false, 10, 0, "%z", 1988, 9, { compiled_on_t::day, 0, 12 }, 0, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "%z", 2008, 6, { compiled_on_t::day, 0, 24 }, 0, 0 },
+		{ -10800, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -16965, compiled_continuation_t::none, false, 0, 0, "LMT", 1890, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -16965, compiled_continuation_t::none, false, 0, 0, "SMT", 1910, 1, { compiled_on_t::day, 0, 10 }, 0, 0 },
+		{ -18000, compiled_continuation_t::none, false, 0, 0, "%z", 1916, 7, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -16965, compiled_continuation_t::none, false, 0, 0, "SMT", 1918, 9, { compiled_on_t::day, 0, 10 }, 0, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "%z", 1919, 7, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -16965, compiled_continuation_t::none, false, 0, 0, "SMT", 1927, 9, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -18000, compiled_continuation_t::named, false, 127, 0, "%z", 1932, 9, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "%z", 1942, 6, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -18000, compiled_continuation_t::none, false, 0, 0, "%z", 1942, 8, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "%z", 1946, 7, { compiled_on_t::day, 0, 14 }, 86400, 0 },
+		{ -14400, compiled_continuation_t::save, true, 0, 3600, "%z", 1946, 8, { compiled_on_t::day, 0, 28 }, 86400, 0 },
+		{ -18000, compiled_continuation_t::save, true, 0, 3600, "%z", 1947, 3, { compiled_on_t::day, 0, 31 }, 86400, 0 },
+		{ -18000, compiled_continuation_t::none, false, 0, 0, "%z", 1947, 5, { compiled_on_t::day, 0, 21 }, 82800, 0 },
+		{ -14400, compiled_continuation_t::named, false, 127, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -16776, compiled_continuation_t::none, false, 0, 0, "LMT", 1890, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -16800, compiled_continuation_t::none, false, 0, 0, "SDMT", 1933, 4, { compiled_on_t::day, 0, 1 }, 43200, 0 },
+		{ -18000, compiled_continuation_t::named, false, 27, 0, "%s", 1974, 10, { compiled_on_t::day, 0, 27 }, 0, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "AST", 2000, 10, { compiled_on_t::day, 0, 29 }, 7200, 0 },
+		{ -18000, compiled_continuation_t::named, false, 125, 0, "E%sT", 2000, 12, { compiled_on_t::day, 0, 3 }, 3600, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "AST", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -11188, compiled_continuation_t::none, false, 0, 0, "LMT", 1914, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -10800, compiled_continuation_t::named, false, 10, 0, "%z", 1963, 10, { compiled_on_t::day, 0, 23 }, 0, 0 },
+		{ -10800, compiled_continuation_t::save, true, 0, 3600, "%z", 1964, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -10800, compiled_continuation_t::named, false, 10, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -5272, compiled_continuation_t::none, false, 0, 0, "LMT", 1916, 7, { compiled_on_t::day, 0, 28 }, 0, 0 },
+		{ -7200, compiled_continuation_t::none, false, 0, 0, "%z", 1980, 4, { compiled_on_t::day, 0, 6 }, 7200, 0 },
+		{ -7200, compiled_continuation_t::named, false, 107, 0, "%z", 1981, 3, { compiled_on_t::day, 0, 29 }, 0, 0 },
+		{ -3600, compiled_continuation_t::named, false, 30, 0, "%z", 2024, 3, { compiled_on_t::day, 0, 31 }, 0, 0 },
+		{ -7200, compiled_continuation_t::named, false, 30, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 53927, compiled_continuation_t::none, false, 0, 0, "LMT", 1867, 10, { compiled_on_t::day, 0, 19 }, 55800, 0 },
+		{ -32473, compiled_continuation_t::none, false, 0, 0, "LMT", 1900, 8, { compiled_on_t::day, 0, 20 }, 43200, 0 },
+		{ -28800, compiled_continuation_t::none, false, 0, 0, "PST", 1942, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -28800, compiled_continuation_t::named, false, 125, 0, "P%sT", 1946, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -28800, compiled_continuation_t::none, false, 0, 0, "PST", 1969, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -28800, compiled_continuation_t::named, false, 125, 0, "P%sT", 1983, 10, { compiled_on_t::day, 0, 30 }, 7200, 0 },
+		{ -32400, compiled_continuation_t::named, false, 125, 0, "Y%sT", 1983, 11, { compiled_on_t::day, 0, 30 }, 0, 0 },
+		{ -32400, compiled_continuation_t::named, false, 125, 0, "AK%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -12652, compiled_continuation_t::none, false, 0, 0, "LMT", 1884, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -12652, compiled_continuation_t::named, false, 114, 0, "N%sT", 1918, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -12652, compiled_continuation_t::named, false, 16, 0, "N%sT", 1919, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -12652, compiled_continuation_t::named, false, 114, 0, "N%sT", 1935, 3, { compiled_on_t::day, 0, 30 }, 0, 0 },
+		{ -12600, compiled_continuation_t::named, false, 114, 0, "N%sT", 1942, 5, { compiled_on_t::day, 0, 11 }, 0, 0 },
+		{ -12600, compiled_continuation_t::named, false, 16, 0, "N%sT", 1946, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -12600, compiled_continuation_t::named, false, 114, 0, "N%sT", 2011, 11, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -12600, compiled_continuation_t::named, false, 16, 0, "N%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -25880, compiled_continuation_t::none, false, 0, 0, "LMT", 1905, 9, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -25200, compiled_continuation_t::named, false, 16, 0, "M%sT", 1946, 4, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0 },
+		{ -25200, compiled_continuation_t::named, false, 122, 0, "M%sT", 1950, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -25200, compiled_continuation_t::named, false, 88, 0, "M%sT", 1972, 4, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0 },
+		{ -21600, compiled_continuation_t::none, false, 0, 0, "CST", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -20932, compiled_continuation_t::none, false, 0, 0, "LMT", 1921, 4, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -21600, compiled_continuation_t::named, false, 42, 0, "C%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -16508, compiled_continuation_t::none, false, 0, 0, "LMT", 1916, 7, { compiled_on_t::day, 0, 28 }, 0, 0 },
+		{ -14400, compiled_continuation_t::named, false, 91, 0, "A%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -28084, compiled_continuation_t::none, false, 0, 0, "LMT", 1922, 1, { compiled_on_t::day, 0, 1 }, 25200, 2 },
+		{ -25200, compiled_continuation_t::none, false, 0, 0, "MST", 1924, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -28800, compiled_continuation_t::none, false, 0, 0, "PST", 1927, 6, { compiled_on_t::day, 0, 10 }, 0, 0 },
+		{ -25200, compiled_continuation_t::none, false, 0, 0, "MST", 1930, 11, { compiled_on_t::day, 0, 15 }, 0, 0 },
+		{ -28800, compiled_continuation_t::none, false, 0, 0, "PST", 1931, 4, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -28800, compiled_continuation_t::save, true, 0, 3600, "PDT", 1931, 9, { compiled_on_t::day, 0, 30 }, 0, 0 },
+		{ -28800, compiled_continuation_t::none, false, 0, 0, "PST", 1942, 4, { compiled_on_t::day, 0, 24 }, 0, 0 },
+		{ -28800, compiled_continuation_t::save, true, 0, 3600, "PWT", 1945, 8, { compiled_on_t::day, 0, 14 }, 82800, 2 },
+		{ -28800, compiled_continuation_t::save, true, 0, 3600, "PPT", 1945, 11, { compiled_on_t::day, 0, 15 }, 0, 0 },
+		{ -28800, compiled_continuation_t::none, false, 0, 0, "PST", 1948, 4, { compiled_on_t::day, 0, 5 }, 0, 0 },
+		{ -28800, compiled_continuation_t::save, true, 0, 3600, "PDT", 1949, 1, { compiled_on_t::day, 0, 14 }, 0, 0 },
+		{ -28800, compiled_continuation_t::none, false, 0, 0, "PST", 1950, 5, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -28800, compiled_continuation_t::save, true, 0, 3600, "PDT", 1950, 9, { compiled_on_t::day, 0, 24 }, 0, 0 },
+		{ -28800, compiled_continuation_t::none, false, 0, 0, "PST", 1951, 4, { compiled_on_t::day, 0, 29 }, 7200, 0 },
+		{ -28800, compiled_continuation_t::save, true, 0, 3600, "PDT", 1951, 9, { compiled_on_t::day, 0, 30 }, 7200, 0 },
+		{ -28800, compiled_continuation_t::none, false, 0, 0, "PST", 1952, 4, { compiled_on_t::day, 0, 27 }, 7200, 0 },
+		{ -28800, compiled_continuation_t::save, true, 0, 3600, "PDT", 1952, 9, { compiled_on_t::day, 0, 28 }, 7200, 0 },
+		{ -28800, compiled_continuation_t::none, false, 0, 0, "PST", 1954, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -28800, compiled_continuation_t::named, false, 17, 0, "P%sT", 1961, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -28800, compiled_continuation_t::none, false, 0, 0, "PST", 1976, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -28800, compiled_continuation_t::named, false, 125, 0, "P%sT", 1996, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -28800, compiled_continuation_t::named, false, 117, 0, "P%sT", 2001, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -28800, compiled_continuation_t::named, false, 125, 0, "P%sT", 2002, 2, { compiled_on_t::day, 0, 20 }, 0, 0 },
+		{ -28800, compiled_continuation_t::named, false, 117, 0, "P%sT", 2010, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -28800, compiled_continuation_t::named, false, 125, 0, "P%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -19052, compiled_continuation_t::none, false, 0, 0, "LMT", 1895, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -18000, compiled_continuation_t::named, false, 16, 0, "E%sT", 1919, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -18000, compiled_continuation_t::named, false, 124, 0, "E%sT", 1942, 2, { compiled_on_t::day, 0, 9 }, 7200, 1 },
+		{ -18000, compiled_continuation_t::named, false, 16, 0, "E%sT", 1946, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -18000, compiled_continuation_t::named, false, 124, 0, "E%sT", 1974, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -18000, compiled_continuation_t::named, false, 16, 0, "E%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -29548, compiled_continuation_t::none, false, 0, 0, "LMT", 1884, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -28800, compiled_continuation_t::named, false, 96, 0, "P%sT", 1987, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -28800, compiled_continuation_t::named, false, 16, 0, "P%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -32412, compiled_continuation_t::none, false, 0, 0, "LMT", 1900, 8, { compiled_on_t::day, 0, 20 }, 0, 0 },
+		{ -32400, compiled_continuation_t::named, false, 101, 0, "Y%sT", 1965, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -32400, compiled_continuation_t::named, false, 102, 0, "Y%sT", 1966, 2, { compiled_on_t::day, 0, 27 }, 0, 0 },
+		{ -28800, compiled_continuation_t::none, false, 0, 0, "PST", 1980, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -28800, compiled_continuation_t::named, false, 16, 0, "P%sT", 2020, 11, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -25200, compiled_continuation_t::none, false, 0, 0, "MST", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -23316, compiled_continuation_t::none, false, 0, 0, "LMT", 1887, 7, { compiled_on_t::day, 0, 16 }, 0, 0 },
+		{ -21600, compiled_continuation_t::named, false, 97, 0, "C%sT", 2006, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -21600, compiled_continuation_t::named, false, 16, 0, "C%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 52865, compiled_continuation_t::none, false, 0, 0, "LMT", 1867, 10, { compiled_on_t::day, 0, 19 }, 54738, 0 },
+		{ -33535, compiled_continuation_t::none, false, 0, 0, "LMT", 1900, 8, { compiled_on_t::day, 0, 20 }, 43200, 0 },
+		{ -32400, compiled_continuation_t::none, false, 0, 0, "YST", 1942, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -32400, compiled_continuation_t::named, false, 125, 0, "Y%sT", 1946, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -32400, compiled_continuation_t::none, false, 0, 0, "YST", 1969, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -32400, compiled_continuation_t::named, false, 125, 0, "Y%sT", 1983, 11, { compiled_on_t::day, 0, 30 }, 0, 0 },
+		{ -32400, compiled_continuation_t::named, false, 125, 0, "AK%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 0, compiled_continuation_t::none, false, 0, 0, "-00", 1969, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 28800, compiled_continuation_t::none, false, 0, 0, "%z", 2009, 10, { compiled_on_t::day, 0, 18 }, 7200, 0 },
+		{ 39600, compiled_continuation_t::none, false, 0, 0, "%z", 2010, 3, { compiled_on_t::day, 0, 5 }, 7200, 0 },
+		{ 28800, compiled_continuation_t::none, false, 0, 0, "%z", 2011, 10, { compiled_on_t::day, 0, 28 }, 7200, 0 },
+		{ 39600, compiled_continuation_t::none, false, 0, 0, "%z", 2012, 2, { compiled_on_t::day, 0, 21 }, 61200, 2 },
+		{ 28800, compiled_continuation_t::none, false, 0, 0, "%z", 2016, 10, { compiled_on_t::day, 0, 22 }, 0, 0 },
+		{ 39600, compiled_continuation_t::none, false, 0, 0, "%z", 2018, 3, { compiled_on_t::day, 0, 11 }, 14400, 0 },
+		{ 28800, compiled_continuation_t::none, false, 0, 0, "%z", 2018, 10, { compiled_on_t::day, 0, 7 }, 14400, 0 },
+		{ 39600, compiled_continuation_t::none, false, 0, 0, "%z", 2019, 3, { compiled_on_t::day, 0, 17 }, 10800, 0 },
+		{ 28800, compiled_continuation_t::none, false, 0, 0, "%z", 2019, 10, { compiled_on_t::day, 0, 4 }, 10800, 0 },
+		{ 39600, compiled_continuation_t::none, false, 0, 0, "%z", 2020, 3, { compiled_on_t::day, 0, 8 }, 10800, 0 },
+		{ 28800, compiled_continuation_t::none, false, 0, 0, "%z", 2020, 10, { compiled_on_t::day, 0, 4 }, 60, 0 },
+		{ 39600, compiled_continuation_t::none, false, 0, 0, "%z", 2021, 3, { compiled_on_t::day, 0, 14 }, 0, 0 },
+		{ 28800, compiled_continuation_t::none, false, 0, 0, "%z", 2021, 10, { compiled_on_t::day, 0, 3 }, 60, 0 },
+		{ 39600, compiled_continuation_t::none, false, 0, 0, "%z", 2022, 3, { compiled_on_t::day, 0, 13 }, 0, 0 },
+		{ 28800, compiled_continuation_t::none, false, 0, 0, "%z", 2022, 10, { compiled_on_t::day, 0, 2 }, 60, 0 },
+		{ 39600, compiled_continuation_t::none, false, 0, 0, "%z", 2023, 3, { compiled_on_t::day, 0, 9 }, 10800, 0 },
+		{ 28800, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 0, compiled_continuation_t::none, false, 0, 0, "-00", 1957, 1, { compiled_on_t::day, 0, 13 }, 0, 0 },
+		{ 25200, compiled_continuation_t::none, false, 0, 0, "%z", 1964, 11, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 0, compiled_continuation_t::none, false, 0, 0, "-00", 1969, 2, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 25200, compiled_continuation_t::none, false, 0, 0, "%z", 2009, 10, { compiled_on_t::day, 0, 18 }, 7200, 0 },
+		{ 18000, compiled_continuation_t::none, false, 0, 0, "%z", 2010, 3, { compiled_on_t::day, 0, 10 }, 72000, 2 },
+		{ 25200, compiled_continuation_t::none, false, 0, 0, "%z", 2011, 10, { compiled_on_t::day, 0, 28 }, 7200, 0 },
+		{ 18000, compiled_continuation_t::none, false, 0, 0, "%z", 2012, 2, { compiled_on_t::day, 0, 21 }, 72000, 2 },
+		{ 25200, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 0, compiled_continuation_t::none, false, 0, 0, "-00", 1899, 11, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 36000, compiled_continuation_t::none, false, 0, 0, "AEST", 1916, 10, { compiled_on_t::day, 0, 1 }, 7200, 0 },
+		{ 36000, compiled_continuation_t::save, true, 0, 3600, "AEDT", 1917, 2, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 36000, compiled_continuation_t::named, false, 6, 0, "AE%sT", 1919, 4, { compiled_on_t::day, 0, 1 }, 0, 1 },
+		{ 0, compiled_continuation_t::none, false, 0, 0, "-00", 1948, 3, { compiled_on_t::day, 0, 25 }, 0, 0 },
+		{ 36000, compiled_continuation_t::named, false, 6, 0, "AE%sT", 1967, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 36000, compiled_continuation_t::named, false, 5, 0, "AE%sT", 2010, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 36000, compiled_continuation_t::save, true, 0, 3600, "AEDT", 2011, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 36000, compiled_continuation_t::named, false, 5, 0, "AE%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 0, compiled_continuation_t::none, false, 0, 0, "-00", 1954, 2, { compiled_on_t::day, 0, 13 }, 0, 0 },
+		{ 21600, compiled_continuation_t::none, false, 0, 0, "%z", 2009, 10, { compiled_on_t::day, 0, 18 }, 7200, 0 },
+		{ 18000, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 0, compiled_continuation_t::none, false, 0, 0, "-00", 1965, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::named, false, 0, 0, "%z", 1969, 10, { compiled_on_t::day, 0, 5 }, 0, 0 },
+		{ -10800, compiled_continuation_t::named, false, 0, 0, "%z", 1982, 5, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::named, false, 127, 0, "%z", 2016, 12, { compiled_on_t::day, 0, 4 }, 0, 0 },
+		{ -10800, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 0, compiled_continuation_t::none, false, 0, 0, "-00", 1976, 12, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -10800, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 0, compiled_continuation_t::none, false, 0, 0, "-00", 2005, 2, { compiled_on_t::day, 0, 12 }, 0, 0 },
+		{ 0, compiled_continuation_t::named, false, 92, 0, "%s", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 0, compiled_continuation_t::none, false, 0, 0, "-00", 1957, 12, { compiled_on_t::day, 0, 16 }, 0, 0 },
+		{ 25200, compiled_continuation_t::none, false, 0, 0, "%z", 1994, 2, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 0, compiled_continuation_t::none, false, 0, 0, "-00", 1994, 11, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 25200, compiled_continuation_t::none, false, 0, 0, "%z", 2023, 12, { compiled_on_t::day, 0, 18 }, 7200, 0 },
+		{ 18000, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 18468, compiled_continuation_t::none, false, 0, 0, "LMT", 1924, 5, { compiled_on_t::day, 0, 2 }, 0, 0 },
+		{ 18000, compiled_continuation_t::none, false, 0, 0, "%z", 1930, 6, { compiled_on_t::day, 0, 21 }, 0, 0 },
+		{ 21600, compiled_continuation_t::named, false, 78, 0, "%z", 1991, 3, { compiled_on_t::day, 0, 31 }, 7200, 1 },
+		{ 18000, compiled_continuation_t::named, false, 78, 0, "%z", 1992, 1, { compiled_on_t::day, 0, 19 }, 7200, 1 },
+		{ 21600, compiled_continuation_t::named, false, 78, 0, "%z", 2004, 10, { compiled_on_t::day, 0, 31 }, 7200, 1 },
+		{ 21600, compiled_continuation_t::none, false, 0, 0, "%z", 2024, 3, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 18000, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 8624, compiled_continuation_t::none, false, 0, 0, "LMT", 1931, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 7200, compiled_continuation_t::named, false, 49, 0, "EE%sT", 2022, 10, { compiled_on_t::day, 0, 28 }, 0, 1 },
+		{ 10800, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 42596, compiled_continuation_t::none, false, 0, 0, "LMT", 1924, 5, { compiled_on_t::day, 0, 2 }, 0, 0 },
+		{ 43200, compiled_continuation_t::none, false, 0, 0, "%z", 1930, 6, { compiled_on_t::day, 0, 21 }, 0, 0 },
+		{ 46800, compiled_continuation_t::named, false, 78, 0, "%z", 1982, 4, { compiled_on_t::day, 0, 1 }, 0, 1 },
+		{ 43200, compiled_continuation_t::named, false, 78, 0, "%z", 1991, 3, { compiled_on_t::day, 0, 31 }, 7200, 1 },
+		{ 39600, compiled_continuation_t::named, false, 78, 0, "%z", 1992, 1, { compiled_on_t::day, 0, 19 }, 7200, 1 },
+		{ 43200, compiled_continuation_t::named, false, 78, 0, "%z", 2010, 3, { compiled_on_t::day, 0, 28 }, 7200, 1 },
+		{ 39600, compiled_continuation_t::named, false, 78, 0, "%z", 2011, 3, { compiled_on_t::day, 0, 27 }, 7200, 1 },
+		{ 43200, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 12064, compiled_continuation_t::none, false, 0, 0, "LMT", 1924, 5, { compiled_on_t::day, 0, 2 }, 0, 0 },
+		{ 14400, compiled_continuation_t::none, false, 0, 0, "%z", 1930, 6, { compiled_on_t::day, 0, 21 }, 0, 0 },
+		{ 18000, compiled_continuation_t::none, false, 0, 0, "%z", 1981, 10, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 21600, compiled_continuation_t::none, false, 0, 0, "%z", 1982, 4, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 18000, compiled_continuation_t::named, false, 78, 0, "%z", 1991, 3, { compiled_on_t::day, 0, 31 }, 7200, 1 },
+		{ 14400, compiled_continuation_t::named, false, 78, 0, "%z", 1992, 1, { compiled_on_t::day, 0, 19 }, 7200, 1 },
+		{ 18000, compiled_continuation_t::named, false, 78, 0, "%z", 1994, 9, { compiled_on_t::day, 0, 25 }, 7200, 1 },
+		{ 14400, compiled_continuation_t::named, false, 78, 0, "%z", 2004, 10, { compiled_on_t::day, 0, 31 }, 7200, 1 },
+		{ 18000, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 13720, compiled_continuation_t::none, false, 0, 0, "LMT", 1924, 5, { compiled_on_t::day, 0, 2 }, 0, 0 },
+		{ 14400, compiled_continuation_t::none, false, 0, 0, "%z", 1930, 6, { compiled_on_t::day, 0, 21 }, 0, 0 },
+		{ 18000, compiled_continuation_t::none, false, 0, 0, "%z", 1981, 4, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 18000, compiled_continuation_t::save, true, 0, 3600, "%z", 1981, 10, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 21600, compiled_continuation_t::none, false, 0, 0, "%z", 1982, 4, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 18000, compiled_continuation_t::named, false, 78, 0, "%z", 1991, 3, { compiled_on_t::day, 0, 31 }, 7200, 1 },
+		{ 14400, compiled_continuation_t::named, false, 78, 0, "%z", 1992, 1, { compiled_on_t::day, 0, 19 }, 7200, 1 },
+		{ 18000, compiled_continuation_t::named, false, 78, 0, "%z", 2004, 10, { compiled_on_t::day, 0, 31 }, 7200, 1 },
+		{ 18000, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 14012, compiled_continuation_t::none, false, 0, 0, "LMT", 1924, 5, { compiled_on_t::day, 0, 2 }, 0, 0 },
+		{ 14400, compiled_continuation_t::none, false, 0, 0, "%z", 1930, 6, { compiled_on_t::day, 0, 21 }, 0, 0 },
+		{ 18000, compiled_continuation_t::named, false, 78, 0, "%z", 1991, 3, { compiled_on_t::day, 0, 31 }, 7200, 0 },
+		{ 14400, compiled_continuation_t::named, false, 78, 0, "%z", 1992, 1, { compiled_on_t::day, 0, 19 }, 7200, 0 },
+		{ 18000, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 12464, compiled_continuation_t::none, false, 0, 0, "LMT", 1924, 5, { compiled_on_t::day, 0, 2 }, 0, 0 },
+		{ 10800, compiled_continuation_t::none, false, 0, 0, "%z", 1930, 6, { compiled_on_t::day, 0, 21 }, 0, 0 },
+		{ 18000, compiled_continuation_t::none, false, 0, 0, "%z", 1981, 10, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 21600, compiled_continuation_t::none, false, 0, 0, "%z", 1982, 4, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 18000, compiled_continuation_t::named, false, 78, 0, "%z", 1991, 3, { compiled_on_t::day, 0, 31 }, 7200, 1 },
+		{ 14400, compiled_continuation_t::named, false, 78, 0, "%z", 1992, 1, { compiled_on_t::day, 0, 19 }, 7200, 1 },
+		{ 18000, compiled_continuation_t::named, false, 78, 0, "%z", 1999, 3, { compiled_on_t::day, 0, 28 }, 7200, 1 },
+		{ 14400, compiled_continuation_t::named, false, 78, 0, "%z", 2004, 10, { compiled_on_t::day, 0, 31 }, 7200, 1 },
+		{ 18000, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 10660, compiled_continuation_t::none, false, 0, 0, "LMT", 1890, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 10656, compiled_continuation_t::none, false, 0, 0, "BMT", 1918, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 10800, compiled_continuation_t::none, false, 0, 0, "%z", 1982, 5, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 10800, compiled_continuation_t::named, false, 47, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 11964, compiled_continuation_t::none, false, 0, 0, "LMT", 1924, 5, { compiled_on_t::day, 0, 2 }, 0, 0 },
+		{ 10800, compiled_continuation_t::none, false, 0, 0, "%z", 1957, 3, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 14400, compiled_continuation_t::named, false, 78, 0, "%z", 1991, 3, { compiled_on_t::day, 0, 31 }, 7200, 1 },
+		{ 10800, compiled_continuation_t::named, false, 78, 0, "%z", 1992, 9, { compiled_on_t::last_weekday, 0, 0 }, 7200, 1 },
+		{ 14400, compiled_continuation_t::none, false, 0, 0, "%z", 1996, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 14400, compiled_continuation_t::named, false, 30, 0, "%z", 1997, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 14400, compiled_continuation_t::named, false, 9, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 24124, compiled_continuation_t::none, false, 0, 0, "LMT", 1880, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 24124, compiled_continuation_t::none, false, 0, 0, "BMT", 1920, 4, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 25200, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 20100, compiled_continuation_t::none, false, 0, 0, "LMT", 1919, 12, { compiled_on_t::day, 0, 10 }, 0, 0 },
+		{ 21600, compiled_continuation_t::none, false, 0, 0, "%z", 1930, 6, { compiled_on_t::day, 0, 21 }, 0, 0 },
+		{ 25200, compiled_continuation_t::named, false, 78, 0, "%z", 1991, 3, { compiled_on_t::day, 0, 31 }, 7200, 1 },
+		{ 21600, compiled_continuation_t::named, false, 78, 0, "%z", 1992, 1, { compiled_on_t::day, 0, 19 }, 7200, 1 },
+		{ 25200, compiled_continuation_t::named, false, 78, 0, "%z", 1995, 5, { compiled_on_t::day, 0, 28 }, 0, 0 },
+		{ 21600, compiled_continuation_t::named, false, 78, 0, "%z", 2011, 3, { compiled_on_t::day, 0, 27 }, 7200, 1 },
+		{ 25200, compiled_continuation_t::none, false, 0, 0, "%z", 2014, 10, { compiled_on_t::day, 0, 26 }, 7200, 1 },
+		{ 21600, compiled_continuation_t::none, false, 0, 0, "%z", 2016, 3, { compiled_on_t::day, 0, 27 }, 7200, 1 },
+		{ 25200, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 8520, compiled_continuation_t::none, false, 0, 0, "LMT", 1880, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 7200, compiled_continuation_t::named, false, 116, 0, "EE%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 17904, compiled_continuation_t::none, false, 0, 0, "LMT", 1924, 5, { compiled_on_t::day, 0, 2 }, 0, 0 },
+		{ 18000, compiled_continuation_t::none, false, 0, 0, "%z", 1930, 6, { compiled_on_t::day, 0, 21 }, 0, 0 },
+		{ 21600, compiled_continuation_t::named, false, 78, 0, "%z", 1991, 3, { compiled_on_t::day, 0, 31 }, 7200, 1 },
+		{ 18000, compiled_continuation_t::named, false, 78, 0, "%z", 1991, 8, { compiled_on_t::day, 0, 31 }, 7200, 0 },
+		{ 18000, compiled_continuation_t::named, false, 52, 0, "%z", 2005, 8, { compiled_on_t::day, 0, 12 }, 0, 0 },
+		{ 21600, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 27232, compiled_continuation_t::none, false, 0, 0, "LMT", 1919, 12, { compiled_on_t::day, 0, 15 }, 0, 0 },
+		{ 28800, compiled_continuation_t::none, false, 0, 0, "%z", 1930, 6, { compiled_on_t::day, 0, 21 }, 0, 0 },
+		{ 32400, compiled_continuation_t::named, false, 78, 0, "%z", 1991, 3, { compiled_on_t::day, 0, 31 }, 7200, 1 },
+		{ 28800, compiled_continuation_t::named, false, 78, 0, "%z", 1992, 1, { compiled_on_t::day, 0, 19 }, 7200, 1 },
+		{ 32400, compiled_continuation_t::named, false, 78, 0, "%z", 2011, 3, { compiled_on_t::day, 0, 27 }, 7200, 1 },
+		{ 36000, compiled_continuation_t::none, false, 0, 0, "%z", 2014, 10, { compiled_on_t::day, 0, 26 }, 7200, 1 },
+		{ 28800, compiled_continuation_t::none, false, 0, 0, "%z", 2016, 3, { compiled_on_t::day, 0, 27 }, 7200, 0 },
+		{ 32400, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 19164, compiled_continuation_t::none, false, 0, 0, "LMT", 1880, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 19172, compiled_continuation_t::none, false, 0, 0, "MMT", 1906, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 19800, compiled_continuation_t::none, false, 0, 0, "%z", 1942, 1, { compiled_on_t::day, 0, 5 }, 0, 0 },
+		{ 19800, compiled_continuation_t::save, true, 0, 1800, "%z", 1942, 9, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 19800, compiled_continuation_t::save, true, 0, 3600, "%z", 1945, 10, { compiled_on_t::day, 0, 16 }, 7200, 0 },
+		{ 19800, compiled_continuation_t::none, false, 0, 0, "%z", 1996, 5, { compiled_on_t::day, 0, 25 }, 0, 0 },
+		{ 23400, compiled_continuation_t::none, false, 0, 0, "%z", 1996, 10, { compiled_on_t::day, 0, 26 }, 1800, 0 },
+		{ 21600, compiled_continuation_t::none, false, 0, 0, "%z", 2006, 4, { compiled_on_t::day, 0, 15 }, 1800, 0 },
+		{ 19800, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 8712, compiled_continuation_t::none, false, 0, 0, "LMT", 1920, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 7200, compiled_continuation_t::named, false, 79, 0, "EE%sT", 2022, 10, { compiled_on_t::day, 0, 28 }, 0, 0 },
+		{ 10800, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 21700, compiled_continuation_t::none, false, 0, 0, "LMT", 1890, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 21200, compiled_continuation_t::none, false, 0, 0, "HMT", 1941, 10, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 23400, compiled_continuation_t::none, false, 0, 0, "%z", 1942, 5, { compiled_on_t::day, 0, 15 }, 0, 0 },
+		{ 19800, compiled_continuation_t::none, false, 0, 0, "%z", 1942, 9, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 23400, compiled_continuation_t::none, false, 0, 0, "%z", 1951, 9, { compiled_on_t::day, 0, 30 }, 0, 0 },
+		{ 21600, compiled_continuation_t::none, false, 0, 0, "%z", 2009, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 21600, compiled_continuation_t::named, false, 12, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 30140, compiled_continuation_t::none, false, 0, 0, "LMT", 1911, 12, { compiled_on_t::day, 0, 31 }, 57600, 2 },
+		{ 28800, compiled_continuation_t::none, false, 0, 0, "%z", 1942, 2, { compiled_on_t::day, 0, 21 }, 82800, 0 },
+		{ 32400, compiled_continuation_t::none, false, 0, 0, "%z", 1976, 5, { compiled_on_t::day, 0, 3 }, 0, 0 },
+		{ 28800, compiled_continuation_t::none, false, 0, 0, "%z", 2000, 9, { compiled_on_t::day, 0, 17 }, 0, 0 },
+		{ 32400, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 13272, compiled_continuation_t::none, false, 0, 0, "LMT", 1920, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 14400, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 16512, compiled_continuation_t::none, false, 0, 0, "LMT", 1924, 5, { compiled_on_t::day, 0, 2 }, 0, 0 },
+		{ 18000, compiled_continuation_t::none, false, 0, 0, "%z", 1930, 6, { compiled_on_t::day, 0, 21 }, 0, 0 },
+		{ 21600, compiled_continuation_t::named, false, 78, 0, "%z", 1991, 3, { compiled_on_t::day, 0, 31 }, 7200, 1 },
+		{ 18000, compiled_continuation_t::save, true, 0, 3600, "%z", 1991, 9, { compiled_on_t::day, 0, 9 }, 7200, 1 },
+		{ 18000, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 8148, compiled_continuation_t::none, false, 0, 0, "LMT", 1921, 11, { compiled_on_t::day, 0, 14 }, 0, 0 },
+		{ 7200, compiled_continuation_t::named, false, 23, 0, "EE%sT", 1998, 9, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 7200, compiled_continuation_t::named, false, 30, 0, "EE%sT", 2016, 9, { compiled_on_t::day, 0, 8 }, 0, 0 },
+		{ 10800, compiled_continuation_t::none, false, 0, 0, "%z", 2017, 10, { compiled_on_t::day, 0, 29 }, 3600, 2 },
+		{ 7200, compiled_continuation_t::named, false, 30, 0, "EE%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 8272, compiled_continuation_t::none, false, 0, 0, "LMT", 1900, 10, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 7200, compiled_continuation_t::named, false, 103, 0, "EET/EEST", 1948, 5, { compiled_on_t::day, 0, 15 }, 0, 0 },
+		{ 7200, compiled_continuation_t::named, false, 51, 0, "EE%sT", 1967, 6, { compiled_on_t::day, 0, 5 }, 0, 0 },
+		{ 7200, compiled_continuation_t::named, false, 103, 0, "I%sT", 1996, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 7200, compiled_continuation_t::named, false, 49, 0, "EE%sT", 1999, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 7200, compiled_continuation_t::named, false, 70, 0, "EE%sT", 2008, 8, { compiled_on_t::day, 0, 29 }, 0, 0 },
+		{ 7200, compiled_continuation_t::none, false, 0, 0, "EET", 2008, 9, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 7200, compiled_continuation_t::named, false, 70, 0, "EE%sT", 2010, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 7200, compiled_continuation_t::none, false, 0, 0, "EET", 2010, 3, { compiled_on_t::day, 0, 27 }, 60, 0 },
+		{ 7200, compiled_continuation_t::named, false, 70, 0, "EE%sT", 2011, 8, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 7200, compiled_continuation_t::none, false, 0, 0, "EET", 2012, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 7200, compiled_continuation_t::named, false, 70, 0, "EE%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 8423, compiled_continuation_t::none, false, 0, 0, "LMT", 1900, 10, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 7200, compiled_continuation_t::named, false, 103, 0, "EET/EEST", 1948, 5, { compiled_on_t::day, 0, 15 }, 0, 0 },
+		{ 7200, compiled_continuation_t::named, false, 51, 0, "EE%sT", 1967, 6, { compiled_on_t::day, 0, 5 }, 0, 0 },
+		{ 7200, compiled_continuation_t::named, false, 103, 0, "I%sT", 1996, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 7200, compiled_continuation_t::named, false, 49, 0, "EE%sT", 1999, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 7200, compiled_continuation_t::named, false, 70, 0, "EE%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 25590, compiled_continuation_t::none, false, 0, 0, "LMT", 1906, 7, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 25590, compiled_continuation_t::none, false, 0, 0, "PLMT", 1911, 5, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 25200, compiled_continuation_t::none, false, 0, 0, "%z", 1942, 12, { compiled_on_t::day, 0, 31 }, 82800, 0 },
+		{ 28800, compiled_continuation_t::none, false, 0, 0, "%z", 1945, 3, { compiled_on_t::day, 0, 14 }, 82800, 0 },
+		{ 32400, compiled_continuation_t::none, false, 0, 0, "%z", 1945, 9, { compiled_on_t::day, 0, 1 }, 86400, 0 },
+		{ 25200, compiled_continuation_t::none, false, 0, 0, "%z", 1947, 4, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 28800, compiled_continuation_t::none, false, 0, 0, "%z", 1955, 7, { compiled_on_t::day, 0, 1 }, 3600, 0 },
+		{ 25200, compiled_continuation_t::none, false, 0, 0, "%z", 1959, 12, { compiled_on_t::day, 0, 31 }, 82800, 0 },
+		{ 28800, compiled_continuation_t::none, false, 0, 0, "%z", 1975, 6, { compiled_on_t::day, 0, 13 }, 0, 0 },
+		{ 25200, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 27402, compiled_continuation_t::none, false, 0, 0, "LMT", 1904, 10, { compiled_on_t::day, 0, 29 }, 61200, 2 },
+		{ 28800, compiled_continuation_t::none, false, 0, 0, "HKT", 1941, 6, { compiled_on_t::day, 0, 15 }, 10800, 0 },
+		{ 28800, compiled_continuation_t::save, true, 0, 3600, "HKST", 1941, 10, { compiled_on_t::day, 0, 1 }, 14400, 0 },
+		{ 28800, compiled_continuation_t::save, true, 0, 1800, "HKWT", 1941, 12, { compiled_on_t::day, 0, 25 }, 0, 0 },
+		{ 32400, compiled_continuation_t::none, false, 0, 0, "JST", 1945, 11, { compiled_on_t::day, 0, 18 }, 7200, 0 },
+		{ 28800, compiled_continuation_t::named, false, 41, 0, "HK%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 21996, compiled_continuation_t::none, false, 0, 0, "LMT", 1905, 8, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 21600, compiled_continuation_t::none, false, 0, 0, "%z", 1978, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 25200, compiled_continuation_t::named, false, 100, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 25025, compiled_continuation_t::none, false, 0, 0, "LMT", 1880, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 25025, compiled_continuation_t::none, false, 0, 0, "IMT", 1920, 1, { compiled_on_t::day, 0, 25 }, 0, 0 },
+		{ 25200, compiled_continuation_t::none, false, 0, 0, "%z", 1930, 6, { compiled_on_t::day, 0, 21 }, 0, 0 },
+		{ 28800, compiled_continuation_t::named, false, 78, 0, "%z", 1991, 3, { compiled_on_t::day, 0, 31 }, 7200, 1 },
+		{ 25200, compiled_continuation_t::named, false, 78, 0, "%z", 1992, 1, { compiled_on_t::day, 0, 19 }, 7200, 1 },
+		{ 28800, compiled_continuation_t::named, false, 78, 0, "%z", 2011, 3, { compiled_on_t::day, 0, 27 }, 7200, 1 },
+		{ 32400, compiled_continuation_t::none, false, 0, 0, "%z", 2014, 10, { compiled_on_t::day, 0, 26 }, 7200, 1 },
+		{ 28800, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 25632, compiled_continuation_t::none, false, 0, 0, "LMT", 1867, 8, { compiled_on_t::day, 0, 10 }, 0, 0 },
+		{ 25632, compiled_continuation_t::none, false, 0, 0, "BMT", 1923, 12, { compiled_on_t::day, 0, 31 }, 60000, 2 },
+		{ 26400, compiled_continuation_t::none, false, 0, 0, "%z", 1932, 11, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 27000, compiled_continuation_t::none, false, 0, 0, "%z", 1942, 3, { compiled_on_t::day, 0, 23 }, 0, 0 },
+		{ 32400, compiled_continuation_t::none, false, 0, 0, "%z", 1945, 9, { compiled_on_t::day, 0, 23 }, 0, 0 },
+		{ 27000, compiled_continuation_t::none, false, 0, 0, "%z", 1948, 5, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 28800, compiled_continuation_t::none, false, 0, 0, "%z", 1950, 5, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 27000, compiled_continuation_t::none, false, 0, 0, "%z", 1964, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 25200, compiled_continuation_t::none, false, 0, 0, "WIB", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 33768, compiled_continuation_t::none, false, 0, 0, "LMT", 1932, 11, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 32400, compiled_continuation_t::none, false, 0, 0, "%z", 1944, 9, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 34200, compiled_continuation_t::none, false, 0, 0, "%z", 1964, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 32400, compiled_continuation_t::none, false, 0, 0, "WIT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 8454, compiled_continuation_t::none, false, 0, 0, "LMT", 1880, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 8440, compiled_continuation_t::none, false, 0, 0, "JMT", 1918, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 7200, compiled_continuation_t::named, false, 103, 0, "I%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 16608, compiled_continuation_t::none, false, 0, 0, "LMT", 1890, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 14400, compiled_continuation_t::none, false, 0, 0, "%z", 1945, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 16200, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 38076, compiled_continuation_t::none, false, 0, 0, "LMT", 1922, 11, { compiled_on_t::day, 0, 10 }, 0, 0 },
+		{ 39600, compiled_continuation_t::none, false, 0, 0, "%z", 1930, 6, { compiled_on_t::day, 0, 21 }, 0, 0 },
+		{ 43200, compiled_continuation_t::named, false, 78, 0, "%z", 1991, 3, { compiled_on_t::day, 0, 31 }, 7200, 1 },
+		{ 39600, compiled_continuation_t::named, false, 78, 0, "%z", 1992, 1, { compiled_on_t::day, 0, 19 }, 7200, 1 },
+		{ 43200, compiled_continuation_t::named, false, 78, 0, "%z", 2010, 3, { compiled_on_t::day, 0, 28 }, 7200, 1 },
+		{ 39600, compiled_continuation_t::named, false, 78, 0, "%z", 2011, 3, { compiled_on_t::day, 0, 27 }, 7200, 1 },
+		{ 43200, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 16092, compiled_continuation_t::none, false, 0, 0, "LMT", 1907, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 19800, compiled_continuation_t::none, false, 0, 0, "%z", 1942, 9, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 19800, compiled_continuation_t::save, true, 0, 3600, "%z", 1945, 10, { compiled_on_t::day, 0, 15 }, 0, 0 },
+		{ 19800, compiled_continuation_t::none, false, 0, 0, "%z", 1951, 9, { compiled_on_t::day, 0, 30 }, 0, 0 },
+		{ 18000, compiled_continuation_t::none, false, 0, 0, "%z", 1971, 3, { compiled_on_t::day, 0, 26 }, 0, 0 },
+		{ 18000, compiled_continuation_t::named, false, 73, 0, "PK%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 20476, compiled_continuation_t::none, false, 0, 0, "LMT", 1920, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 19800, compiled_continuation_t::none, false, 0, 0, "%z", 1986, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 20700, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 32533, compiled_continuation_t::none, false, 0, 0, "LMT", 1919, 12, { compiled_on_t::day, 0, 15 }, 0, 0 },
+		{ 28800, compiled_continuation_t::none, false, 0, 0, "%z", 1930, 6, { compiled_on_t::day, 0, 21 }, 0, 0 },
+		{ 32400, compiled_continuation_t::named, false, 78, 0, "%z", 1991, 3, { compiled_on_t::day, 0, 31 }, 7200, 1 },
+		{ 28800, compiled_continuation_t::named, false, 78, 0, "%z", 1992, 1, { compiled_on_t::day, 0, 19 }, 7200, 1 },
+		{ 32400, compiled_continuation_t::named, false, 78, 0, "%z", 2004, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 36000, compiled_continuation_t::named, false, 78, 0, "%z", 2011, 3, { compiled_on_t::day, 0, 27 }, 7200, 1 },
+		{ 39600, compiled_continuation_t::none, false, 0, 0, "%z", 2011, 9, { compiled_on_t::day, 0, 13 }, 0, 1 },
+		{ 36000, compiled_continuation_t::none, false, 0, 0, "%z", 2014, 10, { compiled_on_t::day, 0, 26 }, 7200, 1 },
+		{ 32400, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 21208, compiled_continuation_t::none, false, 0, 0, "LMT", 1854, 6, { compiled_on_t::day, 0, 28 }, 0, 0 },
+		{ 21200, compiled_continuation_t::none, false, 0, 0, "HMT", 1870, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 19270, compiled_continuation_t::none, false, 0, 0, "MMT", 1906, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 19800, compiled_continuation_t::none, false, 0, 0, "IST", 1941, 10, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 19800, compiled_continuation_t::save, true, 0, 3600, "%z", 1942, 5, { compiled_on_t::day, 0, 15 }, 0, 0 },
+		{ 19800, compiled_continuation_t::none, false, 0, 0, "IST", 1942, 9, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 19800, compiled_continuation_t::save, true, 0, 3600, "%z", 1945, 10, { compiled_on_t::day, 0, 15 }, 0, 0 },
+		{ 19800, compiled_continuation_t::none, false, 0, 0, "IST", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 22286, compiled_continuation_t::none, false, 0, 0, "LMT", 1920, 1, { compiled_on_t::day, 0, 6 }, 0, 0 },
+		{ 21600, compiled_continuation_t::none, false, 0, 0, "%z", 1930, 6, { compiled_on_t::day, 0, 21 }, 0, 0 },
+		{ 25200, compiled_continuation_t::named, false, 78, 0, "%z", 1991, 3, { compiled_on_t::day, 0, 31 }, 7200, 1 },
+		{ 21600, compiled_continuation_t::named, false, 78, 0, "%z", 1992, 1, { compiled_on_t::day, 0, 19 }, 7200, 1 },
+		{ 25200, compiled_continuation_t::named, false, 78, 0, "%z", 2011, 3, { compiled_on_t::day, 0, 27 }, 7200, 1 },
+		{ 28800, compiled_continuation_t::none, false, 0, 0, "%z", 2014, 10, { compiled_on_t::day, 0, 26 }, 7200, 1 },
+		{ 25200, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 26480, compiled_continuation_t::none, false, 0, 0, "LMT", 1926, 3, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 27000, compiled_continuation_t::none, false, 0, 0, "%z", 1933, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 28800, compiled_continuation_t::named, false, 64, 0, "%z", 1942, 2, { compiled_on_t::day, 0, 16 }, 0, 0 },
+		{ 32400, compiled_continuation_t::none, false, 0, 0, "%z", 1945, 9, { compiled_on_t::day, 0, 12 }, 0, 0 },
+		{ 28800, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 27250, compiled_continuation_t::none, false, 0, 0, "LMT", 1904, 10, { compiled_on_t::day, 0, 30 }, 0, 0 },
+		{ 28800, compiled_continuation_t::none, false, 0, 0, "CST", 1941, 12, { compiled_on_t::day, 0, 21 }, 82800, 0 },
+		{ 32400, compiled_continuation_t::named, false, 104, 0, "%z", 1945, 9, { compiled_on_t::day, 0, 30 }, 86400, 0 },
+		{ 28800, compiled_continuation_t::named, false, 104, 0, "C%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 36192, compiled_continuation_t::none, false, 0, 0, "LMT", 1924, 5, { compiled_on_t::day, 0, 2 }, 0, 0 },
+		{ 36000, compiled_continuation_t::none, false, 0, 0, "%z", 1930, 6, { compiled_on_t::day, 0, 21 }, 0, 0 },
+		{ 39600, compiled_continuation_t::named, false, 78, 0, "%z", 1991, 3, { compiled_on_t::day, 0, 31 }, 7200, 1 },
+		{ 36000, compiled_continuation_t::named, false, 78, 0, "%z", 1992, 1, { compiled_on_t::day, 0, 19 }, 7200, 1 },
+		{ 39600, compiled_continuation_t::named, false, 78, 0, "%z", 2011, 3, { compiled_on_t::day, 0, 27 }, 7200, 1 },
+		{ 43200, compiled_continuation_t::none, false, 0, 0, "%z", 2014, 10, { compiled_on_t::day, 0, 26 }, 7200, 1 },
+		{ 36000, compiled_continuation_t::none, false, 0, 0, "%z", 2016, 4, { compiled_on_t::day, 0, 24 }, 7200, 1 },
+		{ 39600, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 28656, compiled_continuation_t::none, false, 0, 0, "LMT", 1920, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 28656, compiled_continuation_t::none, false, 0, 0, "MMT", 1932, 11, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 28800, compiled_continuation_t::none, false, 0, 0, "%z", 1942, 2, { compiled_on_t::day, 0, 9 }, 0, 0 },
+		{ 32400, compiled_continuation_t::none, false, 0, 0, "%z", 1945, 9, { compiled_on_t::day, 0, 23 }, 0, 0 },
+		{ 28800, compiled_continuation_t::none, false, 0, 0, "WITA", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -57368, compiled_continuation_t::none, false, 0, 0, "LMT", 1844, 12, { compiled_on_t::day, 0, 31 }, 0, 0 },
+		{ 29032, compiled_continuation_t::none, false, 0, 0, "LMT", 1899, 9, { compiled_on_t::day, 0, 6 }, 14400, 2 },
+		{ 28800, compiled_continuation_t::named, false, 72, 0, "P%sT", 1942, 2, { compiled_on_t::day, 0, 11 }, 86400, 0 },
+		{ 32400, compiled_continuation_t::none, false, 0, 0, "JST", 1945, 3, { compiled_on_t::day, 0, 4 }, 0, 0 },
+		{ 28800, compiled_continuation_t::named, false, 72, 0, "P%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 8008, compiled_continuation_t::none, false, 0, 0, "LMT", 1921, 11, { compiled_on_t::day, 0, 14 }, 0, 0 },
+		{ 7200, compiled_continuation_t::named, false, 23, 0, "EE%sT", 1998, 9, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 7200, compiled_continuation_t::named, false, 30, 0, "EE%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 20928, compiled_continuation_t::none, false, 0, 0, "LMT", 1924, 5, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 21600, compiled_continuation_t::none, false, 0, 0, "%z", 1930, 6, { compiled_on_t::day, 0, 21 }, 0, 0 },
+		{ 25200, compiled_continuation_t::named, false, 78, 0, "%z", 1991, 3, { compiled_on_t::day, 0, 31 }, 7200, 1 },
+		{ 21600, compiled_continuation_t::named, false, 78, 0, "%z", 1992, 1, { compiled_on_t::day, 0, 19 }, 7200, 1 },
+		{ 25200, compiled_continuation_t::named, false, 78, 0, "%z", 2010, 3, { compiled_on_t::day, 0, 28 }, 7200, 1 },
+		{ 21600, compiled_continuation_t::named, false, 78, 0, "%z", 2011, 3, { compiled_on_t::day, 0, 27 }, 7200, 1 },
+		{ 25200, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 19900, compiled_continuation_t::none, false, 0, 0, "LMT", 1919, 12, { compiled_on_t::day, 0, 14 }, 21600, 0 },
+		{ 21600, compiled_continuation_t::none, false, 0, 0, "%z", 1930, 6, { compiled_on_t::day, 0, 21 }, 0, 0 },
+		{ 25200, compiled_continuation_t::named, false, 78, 0, "%z", 1991, 3, { compiled_on_t::day, 0, 31 }, 7200, 1 },
+		{ 21600, compiled_continuation_t::named, false, 78, 0, "%z", 1992, 1, { compiled_on_t::day, 0, 19 }, 7200, 1 },
+		{ 25200, compiled_continuation_t::named, false, 78, 0, "%z", 1993, 5, { compiled_on_t::day, 0, 23 }, 0, 0 },
+		{ 21600, compiled_continuation_t::named, false, 78, 0, "%z", 2011, 3, { compiled_on_t::day, 0, 27 }, 7200, 1 },
+		{ 25200, compiled_continuation_t::none, false, 0, 0, "%z", 2014, 10, { compiled_on_t::day, 0, 26 }, 7200, 1 },
+		{ 21600, compiled_continuation_t::none, false, 0, 0, "%z", 2016, 7, { compiled_on_t::day, 0, 24 }, 7200, 1 },
+		{ 25200, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 17610, compiled_continuation_t::none, false, 0, 0, "LMT", 1919, 11, { compiled_on_t::day, 0, 14 }, 0, 0 },
+		{ 18000, compiled_continuation_t::none, false, 0, 0, "%z", 1930, 6, { compiled_on_t::day, 0, 21 }, 0, 0 },
+		{ 21600, compiled_continuation_t::named, false, 78, 0, "%z", 1991, 3, { compiled_on_t::day, 0, 31 }, 7200, 1 },
+		{ 18000, compiled_continuation_t::named, false, 78, 0, "%z", 1992, 1, { compiled_on_t::day, 0, 19 }, 7200, 1 },
+		{ 21600, compiled_continuation_t::named, false, 78, 0, "%z", 2011, 3, { compiled_on_t::day, 0, 27 }, 7200, 1 },
+		{ 25200, compiled_continuation_t::none, false, 0, 0, "%z", 2014, 10, { compiled_on_t::day, 0, 26 }, 7200, 1 },
+		{ 21600, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 12324, compiled_continuation_t::none, false, 0, 0, "LMT", 1924, 5, { compiled_on_t::day, 0, 2 }, 0, 0 },
+		{ 10800, compiled_continuation_t::none, false, 0, 0, "%z", 1930, 6, { compiled_on_t::day, 0, 21 }, 0, 0 },
+		{ 18000, compiled_continuation_t::none, false, 0, 0, "%z", 1981, 4, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 18000, compiled_continuation_t::save, true, 0, 3600, "%z", 1981, 10, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 21600, compiled_continuation_t::none, false, 0, 0, "%z", 1982, 4, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 18000, compiled_continuation_t::named, false, 78, 0, "%z", 1989, 3, { compiled_on_t::day, 0, 26 }, 7200, 1 },
+		{ 14400, compiled_continuation_t::named, false, 78, 0, "%z", 1992, 1, { compiled_on_t::day, 0, 19 }, 7200, 1 },
+		{ 18000, compiled_continuation_t::named, false, 78, 0, "%z", 1992, 3, { compiled_on_t::day, 0, 29 }, 7200, 1 },
+		{ 14400, compiled_continuation_t::named, false, 78, 0, "%z", 2004, 10, { compiled_on_t::day, 0, 31 }, 7200, 1 },
+		{ 18000, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 26240, compiled_continuation_t::none, false, 0, 0, "LMT", 1908, 5, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 26240, compiled_continuation_t::none, false, 0, 0, "PMT", 1932, 11, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 27000, compiled_continuation_t::none, false, 0, 0, "%z", 1942, 1, { compiled_on_t::day, 0, 29 }, 0, 0 },
+		{ 32400, compiled_continuation_t::none, false, 0, 0, "%z", 1945, 9, { compiled_on_t::day, 0, 23 }, 0, 0 },
+		{ 27000, compiled_continuation_t::none, false, 0, 0, "%z", 1948, 5, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 28800, compiled_continuation_t::none, false, 0, 0, "%z", 1950, 5, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 27000, compiled_continuation_t::none, false, 0, 0, "%z", 1964, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 28800, compiled_continuation_t::none, false, 0, 0, "WITA", 1988, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 25200, compiled_continuation_t::none, false, 0, 0, "WIB", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 30180, compiled_continuation_t::none, false, 0, 0, "LMT", 1908, 4, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 30600, compiled_continuation_t::none, false, 0, 0, "KST", 1912, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 32400, compiled_continuation_t::none, false, 0, 0, "JST", 1945, 8, { compiled_on_t::day, 0, 24 }, 0, 0 },
+		{ 32400, compiled_continuation_t::none, false, 0, 0, "KST", 2015, 8, { compiled_on_t::day, 0, 15 }, 0, 0 },
+		{ 30600, compiled_continuation_t::none, false, 0, 0, "KST", 2018, 5, { compiled_on_t::day, 0, 4 }, 84600, 0 },
+		{ 32400, compiled_continuation_t::none, false, 0, 0, "KST", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 12368, compiled_continuation_t::none, false, 0, 0, "LMT", 1920, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 14400, compiled_continuation_t::none, false, 0, 0, "%z", 1972, 6, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 10800, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 15268, compiled_continuation_t::none, false, 0, 0, "LMT", 1924, 5, { compiled_on_t::day, 0, 2 }, 0, 0 },
+		{ 14400, compiled_continuation_t::none, false, 0, 0, "%z", 1930, 6, { compiled_on_t::day, 0, 21 }, 0, 0 },
+		{ 18000, compiled_continuation_t::none, false, 0, 0, "%z", 1981, 4, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 18000, compiled_continuation_t::save, true, 0, 3600, "%z", 1981, 10, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 21600, compiled_continuation_t::none, false, 0, 0, "%z", 1982, 4, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 18000, compiled_continuation_t::named, false, 78, 0, "%z", 1991, 3, { compiled_on_t::day, 0, 31 }, 7200, 1 },
+		{ 14400, compiled_continuation_t::named, false, 78, 0, "%z", 1992, 1, { compiled_on_t::day, 0, 19 }, 7200, 1 },
+		{ 18000, compiled_continuation_t::named, false, 78, 0, "%z", 2004, 10, { compiled_on_t::day, 0, 31 }, 7200, 1 },
+		{ 21600, compiled_continuation_t::none, false, 0, 0, "%z", 2024, 3, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 18000, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 15712, compiled_continuation_t::none, false, 0, 0, "LMT", 1924, 5, { compiled_on_t::day, 0, 2 }, 0, 0 },
+		{ 14400, compiled_continuation_t::none, false, 0, 0, "%z", 1930, 6, { compiled_on_t::day, 0, 21 }, 0, 0 },
+		{ 18000, compiled_continuation_t::none, false, 0, 0, "%z", 1981, 4, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 18000, compiled_continuation_t::save, true, 0, 3600, "%z", 1981, 10, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 21600, compiled_continuation_t::none, false, 0, 0, "%z", 1982, 4, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 18000, compiled_continuation_t::named, false, 78, 0, "%z", 1991, 3, { compiled_on_t::day, 0, 31 }, 7200, 1 },
+		{ 14400, compiled_continuation_t::named, false, 78, 0, "%z", 1991, 9, { compiled_on_t::day, 0, 29 }, 7200, 1 },
+		{ 18000, compiled_continuation_t::named, false, 78, 0, "%z", 1992, 1, { compiled_on_t::day, 0, 19 }, 7200, 1 },
+		{ 21600, compiled_continuation_t::named, false, 78, 0, "%z", 1992, 3, { compiled_on_t::day, 0, 29 }, 7200, 1 },
+		{ 18000, compiled_continuation_t::named, false, 78, 0, "%z", 2004, 10, { compiled_on_t::day, 0, 31 }, 7200, 1 },
+		{ 21600, compiled_continuation_t::none, false, 0, 0, "%z", 2018, 12, { compiled_on_t::day, 0, 21 }, 0, 0 },
+		{ 18000, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 11212, compiled_continuation_t::none, false, 0, 0, "LMT", 1947, 3, { compiled_on_t::day, 0, 14 }, 0, 0 },
+		{ 10800, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 34248, compiled_continuation_t::none, false, 0, 0, "LMT", 1905, 8, { compiled_on_t::day, 0, 23 }, 0, 0 },
+		{ 32400, compiled_continuation_t::none, false, 0, 0, "%z", 1945, 8, { compiled_on_t::day, 0, 25 }, 0, 0 },
+		{ 39600, compiled_continuation_t::named, false, 78, 0, "%z", 1991, 3, { compiled_on_t::day, 0, 31 }, 7200, 1 },
+		{ 36000, compiled_continuation_t::named, false, 78, 0, "%z", 1992, 1, { compiled_on_t::day, 0, 19 }, 7200, 1 },
+		{ 39600, compiled_continuation_t::named, false, 78, 0, "%z", 1997, 3, { compiled_on_t::last_weekday, 0, 0 }, 7200, 1 },
+		{ 36000, compiled_continuation_t::named, false, 78, 0, "%z", 2011, 3, { compiled_on_t::day, 0, 27 }, 7200, 1 },
+		{ 39600, compiled_continuation_t::none, false, 0, 0, "%z", 2014, 10, { compiled_on_t::day, 0, 26 }, 7200, 1 },
+		{ 36000, compiled_continuation_t::none, false, 0, 0, "%z", 2016, 3, { compiled_on_t::day, 0, 27 }, 7200, 1 },
+		{ 39600, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 16073, compiled_continuation_t::none, false, 0, 0, "LMT", 1924, 5, { compiled_on_t::day, 0, 2 }, 0, 0 },
+		{ 14400, compiled_continuation_t::none, false, 0, 0, "%z", 1930, 6, { compiled_on_t::day, 0, 21 }, 0, 0 },
+		{ 18000, compiled_continuation_t::none, false, 0, 0, "%z", 1981, 4, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 18000, compiled_continuation_t::save, true, 0, 3600, "%z", 1981, 10, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 21600, compiled_continuation_t::none, false, 0, 0, "%z", 1982, 4, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 18000, compiled_continuation_t::named, false, 78, 0, "%z", 1992, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 18000, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 30472, compiled_continuation_t::none, false, 0, 0, "LMT", 1908, 4, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 30600, compiled_continuation_t::none, false, 0, 0, "KST", 1912, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 32400, compiled_continuation_t::none, false, 0, 0, "JST", 1945, 9, { compiled_on_t::day, 0, 8 }, 0, 0 },
+		{ 32400, compiled_continuation_t::named, false, 53, 0, "K%sT", 1954, 3, { compiled_on_t::day, 0, 21 }, 0, 0 },
+		{ 30600, compiled_continuation_t::named, false, 53, 0, "K%sT", 1961, 8, { compiled_on_t::day, 0, 10 }, 0, 0 },
+		{ 32400, compiled_continuation_t::named, false, 53, 0, "K%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 29143, compiled_continuation_t::none, false, 0, 0, "LMT", 1901, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 28800, compiled_continuation_t::named, false, 84, 0, "C%sT", 1949, 5, { compiled_on_t::day, 0, 28 }, 0, 0 },
+		{ 28800, compiled_continuation_t::named, false, 20, 0, "C%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 24925, compiled_continuation_t::none, false, 0, 0, "LMT", 1901, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 24925, compiled_continuation_t::none, false, 0, 0, "SMT", 1905, 6, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 25200, compiled_continuation_t::none, false, 0, 0, "%z", 1933, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 25200, compiled_continuation_t::save, true, 0, 1200, "%z", 1936, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 26400, compiled_continuation_t::none, false, 0, 0, "%z", 1941, 9, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 27000, compiled_continuation_t::none, false, 0, 0, "%z", 1942, 2, { compiled_on_t::day, 0, 16 }, 0, 0 },
+		{ 32400, compiled_continuation_t::none, false, 0, 0, "%z", 1945, 9, { compiled_on_t::day, 0, 12 }, 0, 0 },
+		{ 27000, compiled_continuation_t::none, false, 0, 0, "%z", 1981, 12, { compiled_on_t::day, 0, 31 }, 57600, 2 },
+		{ 28800, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 36892, compiled_continuation_t::none, false, 0, 0, "LMT", 1924, 5, { compiled_on_t::day, 0, 2 }, 0, 0 },
+		{ 36000, compiled_continuation_t::none, false, 0, 0, "%z", 1930, 6, { compiled_on_t::day, 0, 21 }, 0, 0 },
+		{ 39600, compiled_continuation_t::named, false, 78, 0, "%z", 1991, 3, { compiled_on_t::day, 0, 31 }, 7200, 1 },
+		{ 36000, compiled_continuation_t::named, false, 78, 0, "%z", 1992, 1, { compiled_on_t::day, 0, 19 }, 7200, 1 },
+		{ 39600, compiled_continuation_t::named, false, 78, 0, "%z", 2011, 3, { compiled_on_t::day, 0, 27 }, 7200, 1 },
+		{ 43200, compiled_continuation_t::none, false, 0, 0, "%z", 2014, 10, { compiled_on_t::day, 0, 26 }, 7200, 1 },
+		{ 39600, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 29160, compiled_continuation_t::none, false, 0, 0, "LMT", 1896, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 28800, compiled_continuation_t::none, false, 0, 0, "CST", 1937, 10, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 32400, compiled_continuation_t::none, false, 0, 0, "JST", 1945, 9, { compiled_on_t::day, 0, 21 }, 3600, 0 },
+		{ 28800, compiled_continuation_t::named, false, 110, 0, "C%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 16631, compiled_continuation_t::none, false, 0, 0, "LMT", 1924, 5, { compiled_on_t::day, 0, 2 }, 0, 0 },
+		{ 18000, compiled_continuation_t::none, false, 0, 0, "%z", 1930, 6, { compiled_on_t::day, 0, 21 }, 0, 0 },
+		{ 21600, compiled_continuation_t::named, false, 78, 0, "%z", 1991, 3, { compiled_on_t::day, 0, 31 }, 7200, 0 },
+		{ 18000, compiled_continuation_t::named, false, 78, 0, "%z", 1992, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 18000, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 10751, compiled_continuation_t::none, false, 0, 0, "LMT", 1880, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 10751, compiled_continuation_t::none, false, 0, 0, "TBMT", 1924, 5, { compiled_on_t::day, 0, 2 }, 0, 0 },
+		{ 10800, compiled_continuation_t::none, false, 0, 0, "%z", 1957, 3, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 14400, compiled_continuation_t::named, false, 78, 0, "%z", 1991, 3, { compiled_on_t::day, 0, 31 }, 7200, 1 },
+		{ 10800, compiled_continuation_t::named, false, 78, 0, "%z", 1992, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 10800, compiled_continuation_t::named, false, 109, 0, "%z", 1994, 9, { compiled_on_t::last_weekday, 0, 0 }, 0, 0 },
+		{ 14400, compiled_continuation_t::named, false, 109, 0, "%z", 1996, 10, { compiled_on_t::last_weekday, 0, 0 }, 0, 0 },
+		{ 14400, compiled_continuation_t::save, true, 0, 3600, "%z", 1997, 3, { compiled_on_t::last_weekday, 0, 0 }, 0, 0 },
+		{ 14400, compiled_continuation_t::named, false, 109, 0, "%z", 2004, 6, { compiled_on_t::day, 0, 27 }, 0, 0 },
+		{ 10800, compiled_continuation_t::named, false, 78, 0, "%z", 2005, 3, { compiled_on_t::last_weekday, 0, 0 }, 7200, 0 },
+		{ 14400, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 12344, compiled_continuation_t::none, false, 0, 0, "LMT", 1916, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 12344, compiled_continuation_t::none, false, 0, 0, "TMT", 1935, 6, { compiled_on_t::day, 0, 13 }, 0, 0 },
+		{ 12600, compiled_continuation_t::named, false, 113, 0, "%z", 1977, 10, { compiled_on_t::day, 0, 20 }, 86400, 0 },
+		{ 14400, compiled_continuation_t::named, false, 113, 0, "%z", 1978, 11, { compiled_on_t::day, 0, 10 }, 86400, 0 },
+		{ 12600, compiled_continuation_t::named, false, 113, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 21516, compiled_continuation_t::none, false, 0, 0, "LMT", 1947, 8, { compiled_on_t::day, 0, 15 }, 0, 0 },
+		{ 19800, compiled_continuation_t::none, false, 0, 0, "%z", 1987, 10, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 21600, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 33539, compiled_continuation_t::none, false, 0, 0, "LMT", 1887, 12, { compiled_on_t::day, 0, 31 }, 54000, 2 },
+		{ 32400, compiled_continuation_t::named, false, 50, 0, "J%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 20391, compiled_continuation_t::none, false, 0, 0, "LMT", 1919, 12, { compiled_on_t::day, 0, 22 }, 0, 0 },
+		{ 21600, compiled_continuation_t::none, false, 0, 0, "%z", 1930, 6, { compiled_on_t::day, 0, 21 }, 0, 0 },
+		{ 25200, compiled_continuation_t::named, false, 78, 0, "%z", 1991, 3, { compiled_on_t::day, 0, 31 }, 7200, 1 },
+		{ 21600, compiled_continuation_t::named, false, 78, 0, "%z", 1992, 1, { compiled_on_t::day, 0, 19 }, 7200, 1 },
+		{ 25200, compiled_continuation_t::named, false, 78, 0, "%z", 2002, 5, { compiled_on_t::day, 0, 1 }, 10800, 0 },
+		{ 21600, compiled_continuation_t::named, false, 78, 0, "%z", 2011, 3, { compiled_on_t::day, 0, 27 }, 7200, 1 },
+		{ 25200, compiled_continuation_t::none, false, 0, 0, "%z", 2014, 10, { compiled_on_t::day, 0, 26 }, 7200, 1 },
+		{ 21600, compiled_continuation_t::none, false, 0, 0, "%z", 2016, 5, { compiled_on_t::day, 0, 29 }, 7200, 1 },
+		{ 25200, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 25652, compiled_continuation_t::none, false, 0, 0, "LMT", 1905, 8, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 25200, compiled_continuation_t::none, false, 0, 0, "%z", 1978, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 28800, compiled_continuation_t::named, false, 100, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 21020, compiled_continuation_t::none, false, 0, 0, "LMT", 1928, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 21600, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 34374, compiled_continuation_t::none, false, 0, 0, "LMT", 1919, 12, { compiled_on_t::day, 0, 15 }, 0, 0 },
+		{ 28800, compiled_continuation_t::none, false, 0, 0, "%z", 1930, 6, { compiled_on_t::day, 0, 21 }, 0, 0 },
+		{ 32400, compiled_continuation_t::named, false, 78, 0, "%z", 1981, 4, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 39600, compiled_continuation_t::named, false, 78, 0, "%z", 1991, 3, { compiled_on_t::day, 0, 31 }, 7200, 1 },
+		{ 36000, compiled_continuation_t::named, false, 78, 0, "%z", 1992, 1, { compiled_on_t::day, 0, 19 }, 7200, 1 },
+		{ 39600, compiled_continuation_t::named, false, 78, 0, "%z", 2011, 3, { compiled_on_t::day, 0, 27 }, 7200, 1 },
+		{ 43200, compiled_continuation_t::none, false, 0, 0, "%z", 2011, 9, { compiled_on_t::day, 0, 13 }, 0, 1 },
+		{ 39600, compiled_continuation_t::none, false, 0, 0, "%z", 2014, 10, { compiled_on_t::day, 0, 26 }, 7200, 1 },
+		{ 36000, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 31651, compiled_continuation_t::none, false, 0, 0, "LMT", 1922, 11, { compiled_on_t::day, 0, 15 }, 0, 0 },
+		{ 32400, compiled_continuation_t::none, false, 0, 0, "%z", 1930, 6, { compiled_on_t::day, 0, 21 }, 0, 0 },
+		{ 36000, compiled_continuation_t::named, false, 78, 0, "%z", 1991, 3, { compiled_on_t::day, 0, 31 }, 7200, 1 },
+		{ 32400, compiled_continuation_t::named, false, 78, 0, "%z", 1992, 1, { compiled_on_t::day, 0, 19 }, 7200, 1 },
+		{ 36000, compiled_continuation_t::named, false, 78, 0, "%z", 2011, 3, { compiled_on_t::day, 0, 27 }, 7200, 1 },
+		{ 39600, compiled_continuation_t::none, false, 0, 0, "%z", 2014, 10, { compiled_on_t::day, 0, 26 }, 7200, 1 },
+		{ 36000, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 31138, compiled_continuation_t::none, false, 0, 0, "LMT", 1919, 12, { compiled_on_t::day, 0, 15 }, 0, 0 },
+		{ 28800, compiled_continuation_t::none, false, 0, 0, "%z", 1930, 6, { compiled_on_t::day, 0, 21 }, 0, 0 },
+		{ 32400, compiled_continuation_t::named, false, 78, 0, "%z", 1991, 3, { compiled_on_t::day, 0, 31 }, 7200, 1 },
+		{ 28800, compiled_continuation_t::named, false, 78, 0, "%z", 1992, 1, { compiled_on_t::day, 0, 19 }, 7200, 1 },
+		{ 32400, compiled_continuation_t::named, false, 78, 0, "%z", 2011, 3, { compiled_on_t::day, 0, 27 }, 7200, 1 },
+		{ 36000, compiled_continuation_t::none, false, 0, 0, "%z", 2014, 10, { compiled_on_t::day, 0, 26 }, 7200, 1 },
+		{ 32400, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 23087, compiled_continuation_t::none, false, 0, 0, "LMT", 1880, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 23087, compiled_continuation_t::none, false, 0, 0, "RMT", 1920, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 23400, compiled_continuation_t::none, false, 0, 0, "%z", 1942, 5, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 32400, compiled_continuation_t::none, false, 0, 0, "%z", 1945, 5, { compiled_on_t::day, 0, 3 }, 0, 0 },
+		{ 23400, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 14553, compiled_continuation_t::none, false, 0, 0, "LMT", 1916, 7, { compiled_on_t::day, 0, 3 }, 0, 0 },
+		{ 13505, compiled_continuation_t::none, false, 0, 0, "PMT", 1919, 7, { compiled_on_t::day, 0, 15 }, 14400, 0 },
+		{ 14400, compiled_continuation_t::none, false, 0, 0, "%z", 1930, 6, { compiled_on_t::day, 0, 21 }, 0, 0 },
+		{ 18000, compiled_continuation_t::named, false, 78, 0, "%z", 1991, 3, { compiled_on_t::day, 0, 31 }, 7200, 1 },
+		{ 14400, compiled_continuation_t::named, false, 78, 0, "%z", 1992, 1, { compiled_on_t::day, 0, 19 }, 7200, 1 },
+		{ 18000, compiled_continuation_t::named, false, 78, 0, "%z", 2011, 3, { compiled_on_t::day, 0, 27 }, 7200, 1 },
+		{ 21600, compiled_continuation_t::none, false, 0, 0, "%z", 2014, 10, { compiled_on_t::day, 0, 26 }, 7200, 1 },
+		{ 18000, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 10680, compiled_continuation_t::none, false, 0, 0, "LMT", 1924, 5, { compiled_on_t::day, 0, 2 }, 0, 0 },
+		{ 10800, compiled_continuation_t::none, false, 0, 0, "%z", 1957, 3, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 14400, compiled_continuation_t::named, false, 78, 0, "%z", 1991, 3, { compiled_on_t::day, 0, 31 }, 7200, 1 },
+		{ 10800, compiled_continuation_t::named, false, 78, 0, "%z", 1995, 9, { compiled_on_t::day, 0, 24 }, 7200, 1 },
+		{ 14400, compiled_continuation_t::none, false, 0, 0, "%z", 1997, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 14400, compiled_continuation_t::named, false, 78, 0, "%z", 2011, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 14400, compiled_continuation_t::named, false, 1, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -6160, compiled_continuation_t::none, false, 0, 0, "LMT", 1884, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -6872, compiled_continuation_t::none, false, 0, 0, "HMT", 1912, 1, { compiled_on_t::day, 0, 1 }, 7200, 2 },
+		{ -7200, compiled_continuation_t::named, false, 120, 0, "%z", 1966, 10, { compiled_on_t::day, 0, 2 }, 7200, 1 },
+		{ -3600, compiled_continuation_t::none, false, 0, 0, "%z", 1982, 3, { compiled_on_t::day, 0, 28 }, 0, 1 },
+		{ -3600, compiled_continuation_t::named, false, 120, 0, "%z", 1986, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -3600, compiled_continuation_t::named, false, 30, 0, "%z", 1992, 12, { compiled_on_t::day, 0, 27 }, 3600, 1 },
+		{ 0, compiled_continuation_t::named, false, 30, 0, "WE%sT", 1993, 6, { compiled_on_t::day, 0, 17 }, 3600, 2 },
+		{ -3600, compiled_continuation_t::named, false, 30, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -15558, compiled_continuation_t::none, false, 0, 0, "LMT", 1890, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -15558, compiled_continuation_t::named, false, 15, 0, "BMT/BST", 1930, 1, { compiled_on_t::day, 0, 1 }, 7200, 0 },
+		{ -14400, compiled_continuation_t::named, false, 15, 0, "A%sT", 1974, 4, { compiled_on_t::day, 0, 28 }, 7200, 0 },
+		{ -14400, compiled_continuation_t::named, false, 16, 0, "A%sT", 1976, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::named, false, 125, 0, "A%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -3696, compiled_continuation_t::none, false, 0, 0, "LMT", 1922, 3, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -3600, compiled_continuation_t::none, false, 0, 0, "%z", 1946, 9, { compiled_on_t::day, 0, 30 }, 3600, 0 },
+		{ 0, compiled_continuation_t::none, false, 0, 0, "WET", 1980, 4, { compiled_on_t::day, 0, 6 }, 0, 1 },
+		{ 0, compiled_continuation_t::save, true, 0, 3600, "WEST", 1980, 9, { compiled_on_t::day, 0, 28 }, 3600, 2 },
+		{ 0, compiled_continuation_t::named, false, 30, 0, "WE%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -5644, compiled_continuation_t::none, false, 0, 0, "LMT", 1912, 1, { compiled_on_t::day, 0, 1 }, 7200, 2 },
+		{ -7200, compiled_continuation_t::none, false, 0, 0, "%z", 1942, 9, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -7200, compiled_continuation_t::save, true, 0, 3600, "%z", 1945, 10, { compiled_on_t::day, 0, 15 }, 0, 0 },
+		{ -7200, compiled_continuation_t::none, false, 0, 0, "%z", 1975, 11, { compiled_on_t::day, 0, 25 }, 7200, 0 },
+		{ -3600, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -1624, compiled_continuation_t::none, false, 0, 0, "LMT", 1908, 1, { compiled_on_t::day, 0, 11 }, 0, 0 },
+		{ 0, compiled_continuation_t::none, false, 0, 0, "WET", 1981, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 0, compiled_continuation_t::named, false, 30, 0, "WE%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -4056, compiled_continuation_t::none, false, 0, 0, "LMT", 1884, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -4056, compiled_continuation_t::none, false, 0, 0, "FMT", 1912, 1, { compiled_on_t::day, 0, 1 }, 3600, 2 },
+		{ -3600, compiled_continuation_t::named, false, 120, 0, "%z", 1966, 10, { compiled_on_t::day, 0, 2 }, 7200, 1 },
+		{ 0, compiled_continuation_t::none, false, 0, 0, "WET", 1982, 4, { compiled_on_t::day, 0, 4 }, 0, 0 },
+		{ 0, compiled_continuation_t::named, false, 120, 0, "WE%sT", 1986, 7, { compiled_on_t::day, 0, 31 }, 0, 0 },
+		{ 0, compiled_continuation_t::named, false, 30, 0, "WE%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -8768, compiled_continuation_t::none, false, 0, 0, "LMT", 1890, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -7200, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -13884, compiled_continuation_t::none, false, 0, 0, "LMT", 1890, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -13884, compiled_continuation_t::none, false, 0, 0, "SMT", 1912, 3, { compiled_on_t::day, 0, 12 }, 0, 0 },
+		{ -14400, compiled_continuation_t::named, false, 36, 0, "%z", 1983, 5, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -10800, compiled_continuation_t::named, false, 36, 0, "%z", 1985, 9, { compiled_on_t::day, 0, 15 }, 0, 0 },
+		{ -14400, compiled_continuation_t::named, false, 36, 0, "%z", 2010, 9, { compiled_on_t::day, 0, 5 }, 7200, 0 },
+		{ -10800, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 33260, compiled_continuation_t::none, false, 0, 0, "LMT", 1895, 2, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 32400, compiled_continuation_t::none, false, 0, 0, "ACST", 1899, 5, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 34200, compiled_continuation_t::named, false, 6, 0, "AC%sT", 1971, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 34200, compiled_continuation_t::named, false, 4, 0, "AC%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 36728, compiled_continuation_t::none, false, 0, 0, "LMT", 1895, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 36000, compiled_continuation_t::named, false, 6, 0, "AE%sT", 1971, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 36000, compiled_continuation_t::named, false, 3, 0, "AE%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 33948, compiled_continuation_t::none, false, 0, 0, "LMT", 1895, 2, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 36000, compiled_continuation_t::none, false, 0, 0, "AEST", 1896, 8, { compiled_on_t::day, 0, 23 }, 0, 0 },
+		{ 32400, compiled_continuation_t::none, false, 0, 0, "ACST", 1899, 5, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 34200, compiled_continuation_t::named, false, 6, 0, "AC%sT", 1971, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 34200, compiled_continuation_t::named, false, 2, 0, "AC%sT", 2000, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 34200, compiled_continuation_t::named, false, 4, 0, "AC%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 31400, compiled_continuation_t::none, false, 0, 0, "LMT", 1895, 2, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 32400, compiled_continuation_t::none, false, 0, 0, "ACST", 1899, 5, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 34200, compiled_continuation_t::named, false, 6, 0, "AC%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 30928, compiled_continuation_t::none, false, 0, 0, "LMT", 1895, 12, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 31500, compiled_continuation_t::named, false, 6, 0, "%z", 1943, 7, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 31500, compiled_continuation_t::named, false, 8, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 35356, compiled_continuation_t::none, false, 0, 0, "LMT", 1895, 9, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 36000, compiled_continuation_t::named, false, 5, 0, "AE%sT", 1919, 10, { compiled_on_t::day, 0, 24 }, 0, 0 },
+		{ 36000, compiled_continuation_t::named, false, 6, 0, "AE%sT", 1967, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 36000, compiled_continuation_t::named, false, 5, 0, "AE%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 35756, compiled_continuation_t::none, false, 0, 0, "LMT", 1895, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 36000, compiled_continuation_t::named, false, 6, 0, "AE%sT", 1971, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 36000, compiled_continuation_t::named, false, 3, 0, "AE%sT", 1992, 7, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 36000, compiled_continuation_t::named, false, 44, 0, "AE%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 38180, compiled_continuation_t::none, false, 0, 0, "LMT", 1895, 2, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 36000, compiled_continuation_t::none, false, 0, 0, "AEST", 1981, 3, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 37800, compiled_continuation_t::named, false, 55, 0, "%z", 1985, 7, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 37800, compiled_continuation_t::named, false, 55, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 34792, compiled_continuation_t::none, false, 0, 0, "LMT", 1895, 2, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 36000, compiled_continuation_t::named, false, 6, 0, "AE%sT", 1971, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 36000, compiled_continuation_t::named, false, 7, 0, "AE%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 27804, compiled_continuation_t::none, false, 0, 0, "LMT", 1895, 12, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 28800, compiled_continuation_t::named, false, 6, 0, "AW%sT", 1943, 7, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 28800, compiled_continuation_t::named, false, 8, 0, "AW%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 36292, compiled_continuation_t::none, false, 0, 0, "LMT", 1895, 2, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 36000, compiled_continuation_t::named, false, 6, 0, "AE%sT", 1971, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 36000, compiled_continuation_t::named, false, 2, 0, "AE%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 0, compiled_continuation_t::none, false, 0, 0, "GMT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -3600, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -36000, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -39600, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -43200, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -7200, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -10800, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -14400, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -18000, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -21600, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -25200, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -28800, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -32400, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 3600, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 36000, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 39600, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 43200, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 46800, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 50400, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 7200, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 10800, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 14400, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 18000, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 21600, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 25200, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 28800, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 32400, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 0, compiled_continuation_t::none, false, 0, 0, "UTC", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 364, compiled_continuation_t::none, false, 0, 0, "LMT", 1901, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 0, compiled_continuation_t::none, false, 0, 0, "WET", 1946, 9, { compiled_on_t::day, 0, 30 }, 0, 0 },
+		{ 3600, compiled_continuation_t::none, false, 0, 0, "CET", 1985, 3, { compiled_on_t::day, 0, 31 }, 7200, 0 },
+		{ 3600, compiled_continuation_t::named, false, 30, 0, "CE%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 11532, compiled_continuation_t::none, false, 0, 0, "LMT", 1924, 5, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 10800, compiled_continuation_t::none, false, 0, 0, "%z", 1930, 6, { compiled_on_t::day, 0, 21 }, 0, 0 },
+		{ 14400, compiled_continuation_t::named, false, 78, 0, "%z", 1989, 3, { compiled_on_t::day, 0, 26 }, 7200, 1 },
+		{ 10800, compiled_continuation_t::named, false, 78, 0, "%z", 1991, 3, { compiled_on_t::day, 0, 31 }, 7200, 1 },
+		{ 14400, compiled_continuation_t::none, false, 0, 0, "%z", 1992, 3, { compiled_on_t::day, 0, 29 }, 7200, 1 },
+		{ 10800, compiled_continuation_t::named, false, 78, 0, "%z", 2011, 3, { compiled_on_t::day, 0, 27 }, 7200, 1 },
+		{ 14400, compiled_continuation_t::none, false, 0, 0, "%z", 2014, 10, { compiled_on_t::day, 0, 26 }, 7200, 1 },
+		{ 10800, compiled_continuation_t::none, false, 0, 0, "%z", 2016, 3, { compiled_on_t::day, 0, 27 }, 7200, 1 },
+		{ 14400, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 5692, compiled_continuation_t::none, false, 0, 0, "LMT", 1895, 9, { compiled_on_t::day, 0, 14 }, 0, 0 },
+		{ 5692, compiled_continuation_t::none, false, 0, 0, "AMT", 1916, 7, { compiled_on_t::day, 0, 28 }, 60, 0 },
+		{ 7200, compiled_continuation_t::named, false, 111, 0, "EE%sT", 1941, 4, { compiled_on_t::day, 0, 30 }, 0, 0 },
+		{ 3600, compiled_continuation_t::named, false, 111, 0, "CE%sT", 1944, 4, { compiled_on_t::day, 0, 4 }, 0, 0 },
+		{ 7200, compiled_continuation_t::named, false, 111, 0, "EE%sT", 1981, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 7200, compiled_continuation_t::named, false, 30, 0, "EE%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 4920, compiled_continuation_t::none, false, 0, 0, "LMT", 1884, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 3600, compiled_continuation_t::none, false, 0, 0, "CET", 1941, 4, { compiled_on_t::day, 0, 18 }, 82800, 0 },
+		{ 3600, compiled_continuation_t::named, false, 107, 0, "CE%sT", 1945, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 3600, compiled_continuation_t::none, false, 0, 0, "CET", 1945, 5, { compiled_on_t::day, 0, 8 }, 7200, 1 },
+		{ 3600, compiled_continuation_t::save, true, 0, 3600, "CEST", 1945, 9, { compiled_on_t::day, 0, 16 }, 7200, 1 },
+		{ 3600, compiled_continuation_t::none, false, 0, 0, "CET", 1982, 11, { compiled_on_t::day, 0, 27 }, 0, 0 },
+		{ 3600, compiled_continuation_t::named, false, 30, 0, "CE%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 3208, compiled_continuation_t::none, false, 0, 0, "LMT", 1893, 4, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 3600, compiled_continuation_t::named, false, 107, 0, "CE%sT", 1945, 5, { compiled_on_t::day, 0, 24 }, 7200, 0 },
+		{ 3600, compiled_continuation_t::named, false, 85, 0, "CE%sT", 1946, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 3600, compiled_continuation_t::named, false, 26, 0, "CE%sT", 1980, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 3600, compiled_continuation_t::named, false, 30, 0, "CE%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 1050, compiled_continuation_t::none, false, 0, 0, "LMT", 1880, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 1050, compiled_continuation_t::none, false, 0, 0, "BMT", 1892, 5, { compiled_on_t::day, 0, 1 }, 1050, 0 },
+		{ 0, compiled_continuation_t::none, false, 0, 0, "WET", 1914, 11, { compiled_on_t::day, 0, 8 }, 0, 0 },
+		{ 3600, compiled_continuation_t::none, false, 0, 0, "CET", 1916, 5, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 3600, compiled_continuation_t::named, false, 107, 0, "CE%sT", 1918, 11, { compiled_on_t::day, 0, 11 }, 39600, 2 },
+		{ 0, compiled_continuation_t::named, false, 106, 0, "WE%sT", 1940, 5, { compiled_on_t::day, 0, 20 }, 7200, 1 },
+		{ 3600, compiled_continuation_t::named, false, 107, 0, "CE%sT", 1944, 9, { compiled_on_t::day, 0, 3 }, 0, 0 },
+		{ 3600, compiled_continuation_t::named, false, 106, 0, "CE%sT", 1977, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 3600, compiled_continuation_t::named, false, 30, 0, "CE%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 6264, compiled_continuation_t::none, false, 0, 0, "LMT", 1891, 10, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 6264, compiled_continuation_t::none, false, 0, 0, "BMT", 1931, 7, { compiled_on_t::day, 0, 24 }, 0, 0 },
+		{ 7200, compiled_continuation_t::named, false, 129, 0, "EE%sT", 1981, 3, { compiled_on_t::day, 0, 29 }, 7200, 1 },
+		{ 7200, compiled_continuation_t::named, false, 107, 0, "EE%sT", 1991, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 7200, compiled_continuation_t::named, false, 129, 0, "EE%sT", 1994, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 7200, compiled_continuation_t::named, false, 109, 0, "EE%sT", 1997, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 7200, compiled_continuation_t::named, false, 30, 0, "EE%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 4580, compiled_continuation_t::none, false, 0, 0, "LMT", 1890, 11, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 3600, compiled_continuation_t::named, false, 107, 0, "CE%sT", 1918, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 3600, compiled_continuation_t::named, false, 112, 0, "CE%sT", 1941, 4, { compiled_on_t::day, 0, 7 }, 82800, 0 },
+		{ 3600, compiled_continuation_t::named, false, 107, 0, "CE%sT", 1945, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 3600, compiled_continuation_t::named, false, 112, 0, "CE%sT", 1984, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 3600, compiled_continuation_t::named, false, 30, 0, "CE%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 6920, compiled_continuation_t::none, false, 0, 0, "LMT", 1880, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 6900, compiled_continuation_t::none, false, 0, 0, "CMT", 1918, 2, { compiled_on_t::day, 0, 15 }, 0, 0 },
+		{ 6264, compiled_continuation_t::none, false, 0, 0, "BMT", 1931, 7, { compiled_on_t::day, 0, 24 }, 0, 0 },
+		{ 7200, compiled_continuation_t::named, false, 129, 0, "EE%sT", 1940, 8, { compiled_on_t::day, 0, 15 }, 0, 0 },
+		{ 7200, compiled_continuation_t::save, true, 0, 3600, "EEST", 1941, 7, { compiled_on_t::day, 0, 17 }, 0, 0 },
+		{ 3600, compiled_continuation_t::named, false, 107, 0, "CE%sT", 1944, 8, { compiled_on_t::day, 0, 24 }, 0, 0 },
+		{ 10800, compiled_continuation_t::named, false, 78, 0, "MSK/MSD", 1990, 5, { compiled_on_t::day, 0, 6 }, 7200, 0 },
+		{ 7200, compiled_continuation_t::named, false, 78, 0, "EE%sT", 1992, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 7200, compiled_continuation_t::named, false, 109, 0, "EE%sT", 1997, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 7200, compiled_continuation_t::named, false, 58, 0, "EE%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -1521, compiled_continuation_t::none, false, 0, 0, "LMT", 1880, 8, { compiled_on_t::day, 0, 2 }, 0, 0 },
+		{ -1521, compiled_continuation_t::none, false, 0, 0, "DMT", 1916, 5, { compiled_on_t::day, 0, 21 }, 7200, 1 },
+		{ -1521, compiled_continuation_t::save, true, 0, 3600, "IST", 1916, 10, { compiled_on_t::day, 0, 1 }, 7200, 1 },
+		{ 0, compiled_continuation_t::named, false, 37, 0, "%s", 1921, 12, { compiled_on_t::day, 0, 6 }, 0, 0 },
+		{ 0, compiled_continuation_t::named, false, 37, 0, "GMT/IST", 1940, 2, { compiled_on_t::day, 0, 25 }, 7200, 1 },
+		{ 0, compiled_continuation_t::save, true, 0, 3600, "IST", 1946, 10, { compiled_on_t::day, 0, 6 }, 7200, 1 },
+		{ 0, compiled_continuation_t::none, false, 0, 0, "GMT", 1947, 3, { compiled_on_t::day, 0, 16 }, 7200, 1 },
+		{ 0, compiled_continuation_t::save, true, 0, 3600, "IST", 1947, 11, { compiled_on_t::day, 0, 2 }, 7200, 1 },
+		{ 0, compiled_continuation_t::none, false, 0, 0, "GMT", 1948, 4, { compiled_on_t::day, 0, 18 }, 7200, 1 },
+		{ 0, compiled_continuation_t::named, false, 37, 0, "GMT/IST", 1968, 10, { compiled_on_t::day, 0, 27 }, 0, 0 },
+		{ 3600, compiled_continuation_t::named, false, 46, 0, "IST/GMT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -1284, compiled_continuation_t::none, false, 0, 0, "LMT", 1880, 8, { compiled_on_t::day, 0, 2 }, 0, 0 },
+		{ 0, compiled_continuation_t::named, false, 37, 0, "%s", 1957, 4, { compiled_on_t::day, 0, 14 }, 7200, 0 },
+		{ 3600, compiled_continuation_t::none, false, 0, 0, "CET", 1982, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 3600, compiled_continuation_t::named, false, 30, 0, "CE%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 5989, compiled_continuation_t::none, false, 0, 0, "LMT", 1878, 5, { compiled_on_t::day, 0, 31 }, 0, 0 },
+		{ 5989, compiled_continuation_t::none, false, 0, 0, "HMT", 1921, 5, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 7200, compiled_continuation_t::named, false, 34, 0, "EE%sT", 1983, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 7200, compiled_continuation_t::named, false, 30, 0, "EE%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 6952, compiled_continuation_t::none, false, 0, 0, "LMT", 1880, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 7016, compiled_continuation_t::none, false, 0, 0, "IMT", 1910, 10, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 7200, compiled_continuation_t::named, false, 89, 0, "EE%sT", 1978, 6, { compiled_on_t::day, 0, 29 }, 0, 0 },
+		{ 10800, compiled_continuation_t::named, false, 89, 0, "%z", 1984, 11, { compiled_on_t::day, 0, 1 }, 7200, 0 },
+		{ 7200, compiled_continuation_t::named, false, 89, 0, "EE%sT", 2007, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 7200, compiled_continuation_t::named, false, 30, 0, "EE%sT", 2011, 3, { compiled_on_t::day, 0, 27 }, 3600, 2 },
+		{ 7200, compiled_continuation_t::none, false, 0, 0, "EET", 2011, 3, { compiled_on_t::day, 0, 28 }, 3600, 2 },
+		{ 7200, compiled_continuation_t::named, false, 30, 0, "EE%sT", 2014, 3, { compiled_on_t::day, 0, 30 }, 3600, 2 },
+		{ 7200, compiled_continuation_t::none, false, 0, 0, "EET", 2014, 3, { compiled_on_t::day, 0, 31 }, 3600, 2 },
+		{ 7200, compiled_continuation_t::named, false, 30, 0, "EE%sT", 2015, 10, { compiled_on_t::day, 0, 25 }, 3600, 2 },
+		{ 7200, compiled_continuation_t::save, true, 0, 3600, "EEST", 2015, 11, { compiled_on_t::day, 0, 8 }, 3600, 2 },
+		{ 7200, compiled_continuation_t::named, false, 30, 0, "EE%sT", 2016, 9, { compiled_on_t::day, 0, 7 }, 0, 0 },
+		{ 10800, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 4920, compiled_continuation_t::none, false, 0, 0, "LMT", 1893, 4, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 3600, compiled_continuation_t::named, false, 107, 0, "CE%sT", 1945, 4, { compiled_on_t::day, 0, 10 }, 0, 0 },
+		{ 7200, compiled_continuation_t::named, false, 69, 0, "EE%sT", 1946, 4, { compiled_on_t::day, 0, 7 }, 0, 0 },
+		{ 10800, compiled_continuation_t::named, false, 78, 0, "MSK/MSD", 1989, 3, { compiled_on_t::day, 0, 26 }, 7200, 1 },
+		{ 7200, compiled_continuation_t::named, false, 78, 0, "EE%sT", 2011, 3, { compiled_on_t::day, 0, 27 }, 7200, 1 },
+		{ 10800, compiled_continuation_t::none, false, 0, 0, "%z", 2014, 10, { compiled_on_t::day, 0, 26 }, 7200, 1 },
+		{ 7200, compiled_continuation_t::none, false, 0, 0, "EET", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 11928, compiled_continuation_t::none, false, 0, 0, "LMT", 1919, 7, { compiled_on_t::day, 0, 1 }, 0, 2 },
+		{ 10800, compiled_continuation_t::none, false, 0, 0, "%z", 1930, 6, { compiled_on_t::day, 0, 21 }, 0, 0 },
+		{ 14400, compiled_continuation_t::named, false, 78, 0, "%z", 1989, 3, { compiled_on_t::day, 0, 26 }, 7200, 1 },
+		{ 10800, compiled_continuation_t::named, false, 78, 0, "MSK/MSD", 1991, 3, { compiled_on_t::day, 0, 31 }, 7200, 1 },
+		{ 14400, compiled_continuation_t::none, false, 0, 0, "%z", 1992, 3, { compiled_on_t::day, 0, 29 }, 7200, 1 },
+		{ 10800, compiled_continuation_t::named, false, 78, 0, "MSK/MSD", 2011, 3, { compiled_on_t::day, 0, 27 }, 7200, 1 },
+		{ 14400, compiled_continuation_t::none, false, 0, 0, "MSK", 2014, 10, { compiled_on_t::day, 0, 26 }, 7200, 1 },
+		{ 10800, compiled_continuation_t::none, false, 0, 0, "MSK", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 7324, compiled_continuation_t::none, false, 0, 0, "LMT", 1880, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 7324, compiled_continuation_t::none, false, 0, 0, "KMT", 1924, 5, { compiled_on_t::day, 0, 2 }, 0, 0 },
+		{ 7200, compiled_continuation_t::none, false, 0, 0, "EET", 1930, 6, { compiled_on_t::day, 0, 21 }, 0, 0 },
+		{ 10800, compiled_continuation_t::none, false, 0, 0, "MSK", 1941, 9, { compiled_on_t::day, 0, 20 }, 0, 0 },
+		{ 3600, compiled_continuation_t::named, false, 107, 0, "CE%sT", 1943, 11, { compiled_on_t::day, 0, 6 }, 0, 0 },
+		{ 10800, compiled_continuation_t::named, false, 78, 0, "MSK/MSD", 1990, 7, { compiled_on_t::day, 0, 1 }, 7200, 0 },
+		{ 7200, compiled_continuation_t::save, true, 0, 3600, "EEST", 1991, 9, { compiled_on_t::day, 0, 29 }, 10800, 0 },
+		{ 7200, compiled_continuation_t::named, false, 107, 0, "EE%sT", 1996, 5, { compiled_on_t::day, 0, 13 }, 0, 0 },
+		{ 7200, compiled_continuation_t::named, false, 30, 0, "EE%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -2205, compiled_continuation_t::none, false, 0, 0, "LMT", 1884, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -2205, compiled_continuation_t::none, false, 0, 0, "LMT", 1912, 1, { compiled_on_t::day, 0, 1 }, 0, 2 },
+		{ 0, compiled_continuation_t::named, false, 120, 0, "WE%sT", 1966, 10, { compiled_on_t::day, 0, 2 }, 7200, 1 },
+		{ 3600, compiled_continuation_t::none, false, 0, 0, "CET", 1976, 9, { compiled_on_t::day, 0, 26 }, 3600, 0 },
+		{ 0, compiled_continuation_t::named, false, 120, 0, "WE%sT", 1986, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 0, compiled_continuation_t::named, false, 30, 0, "WE%sT", 1992, 9, { compiled_on_t::day, 0, 27 }, 3600, 2 },
+		{ 3600, compiled_continuation_t::named, false, 30, 0, "CE%sT", 1996, 3, { compiled_on_t::day, 0, 31 }, 3600, 2 },
+		{ 0, compiled_continuation_t::named, false, 30, 0, "WE%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -75, compiled_continuation_t::none, false, 0, 0, "LMT", 1847, 12, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 0, compiled_continuation_t::named, false, 37, 0, "%s", 1968, 10, { compiled_on_t::day, 0, 27 }, 0, 0 },
+		{ 3600, compiled_continuation_t::none, false, 0, 0, "BST", 1971, 10, { compiled_on_t::day, 0, 31 }, 7200, 2 },
+		{ 0, compiled_continuation_t::named, false, 37, 0, "%s", 1996, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 0, compiled_continuation_t::named, false, 30, 0, "GMT/BST", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -884, compiled_continuation_t::none, false, 0, 0, "LMT", 1901, 1, { compiled_on_t::day, 0, 1 }, 0, 2 },
+		{ 0, compiled_continuation_t::named, false, 123, 0, "WE%sT", 1940, 3, { compiled_on_t::day, 0, 16 }, 82800, 0 },
+		{ 3600, compiled_continuation_t::named, false, 123, 0, "CE%sT", 1979, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 3600, compiled_continuation_t::named, false, 30, 0, "CE%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 3484, compiled_continuation_t::none, false, 0, 0, "LMT", 1893, 11, { compiled_on_t::day, 0, 2 }, 0, 0 },
+		{ 3600, compiled_continuation_t::named, false, 45, 0, "CE%sT", 1973, 3, { compiled_on_t::day, 0, 31 }, 0, 0 },
+		{ 3600, compiled_continuation_t::named, false, 59, 0, "CE%sT", 1981, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 3600, compiled_continuation_t::named, false, 30, 0, "CE%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 6616, compiled_continuation_t::none, false, 0, 0, "LMT", 1880, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 6600, compiled_continuation_t::none, false, 0, 0, "MMT", 1924, 5, { compiled_on_t::day, 0, 2 }, 0, 0 },
+		{ 7200, compiled_continuation_t::none, false, 0, 0, "EET", 1930, 6, { compiled_on_t::day, 0, 21 }, 0, 0 },
+		{ 10800, compiled_continuation_t::none, false, 0, 0, "MSK", 1941, 6, { compiled_on_t::day, 0, 28 }, 0, 0 },
+		{ 3600, compiled_continuation_t::named, false, 107, 0, "CE%sT", 1944, 7, { compiled_on_t::day, 0, 3 }, 0, 0 },
+		{ 10800, compiled_continuation_t::named, false, 78, 0, "MSK/MSD", 1990, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 10800, compiled_continuation_t::none, false, 0, 0, "MSK", 1991, 3, { compiled_on_t::day, 0, 31 }, 7200, 1 },
+		{ 7200, compiled_continuation_t::named, false, 78, 0, "EE%sT", 2011, 3, { compiled_on_t::day, 0, 27 }, 7200, 1 },
+		{ 10800, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 9017, compiled_continuation_t::none, false, 0, 0, "LMT", 1880, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 9017, compiled_continuation_t::none, false, 0, 0, "MMT", 1916, 7, { compiled_on_t::day, 0, 3 }, 0, 0 },
+		{ 9079, compiled_continuation_t::named, false, 78, 0, "%s", 1919, 7, { compiled_on_t::day, 0, 1 }, 0, 2 },
+		{ 10800, compiled_continuation_t::named, false, 78, 0, "%s", 1921, 10, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 10800, compiled_continuation_t::named, false, 78, 0, "MSK/MSD", 1922, 10, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 7200, compiled_continuation_t::none, false, 0, 0, "EET", 1930, 6, { compiled_on_t::day, 0, 21 }, 0, 0 },
+		{ 10800, compiled_continuation_t::named, false, 78, 0, "MSK/MSD", 1991, 3, { compiled_on_t::day, 0, 31 }, 7200, 1 },
+		{ 7200, compiled_continuation_t::named, false, 78, 0, "EE%sT", 1992, 1, { compiled_on_t::day, 0, 19 }, 7200, 1 },
+		{ 10800, compiled_continuation_t::named, false, 78, 0, "MSK/MSD", 2011, 3, { compiled_on_t::day, 0, 27 }, 7200, 1 },
+		{ 14400, compiled_continuation_t::none, false, 0, 0, "MSK", 2014, 10, { compiled_on_t::day, 0, 26 }, 7200, 1 },
+		{ 10800, compiled_continuation_t::none, false, 0, 0, "MSK", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 561, compiled_continuation_t::none, false, 0, 0, "LMT", 1891, 3, { compiled_on_t::day, 0, 16 }, 0, 0 },
+		{ 561, compiled_continuation_t::none, false, 0, 0, "PMT", 1911, 3, { compiled_on_t::day, 0, 11 }, 0, 0 },
+		{ 0, compiled_continuation_t::named, false, 33, 0, "WE%sT", 1940, 6, { compiled_on_t::day, 0, 14 }, 82800, 0 },
+		{ 3600, compiled_continuation_t::named, false, 107, 0, "CE%sT", 1944, 8, { compiled_on_t::day, 0, 25 }, 0, 0 },
+		{ 0, compiled_continuation_t::named, false, 33, 0, "WE%sT", 1945, 9, { compiled_on_t::day, 0, 16 }, 10800, 0 },
+		{ 3600, compiled_continuation_t::named, false, 33, 0, "CE%sT", 1977, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 3600, compiled_continuation_t::named, false, 30, 0, "CE%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 3464, compiled_continuation_t::none, false, 0, 0, "LMT", 1850, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 3464, compiled_continuation_t::none, false, 0, 0, "PMT", 1891, 10, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 3600, compiled_continuation_t::named, false, 107, 0, "CE%sT", 1945, 5, { compiled_on_t::day, 0, 9 }, 0, 0 },
+		{ 3600, compiled_continuation_t::named, false, 24, 0, "CE%sT", 1946, 12, { compiled_on_t::day, 0, 1 }, 10800, 0 },
+		{ 3600, compiled_continuation_t::save, true, 0, -3600, "GMT", 1947, 2, { compiled_on_t::day, 0, 23 }, 7200, 0 },
+		{ 3600, compiled_continuation_t::named, false, 24, 0, "CE%sT", 1979, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 3600, compiled_continuation_t::named, false, 30, 0, "CE%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 5794, compiled_continuation_t::none, false, 0, 0, "LMT", 1880, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 5794, compiled_continuation_t::none, false, 0, 0, "RMT", 1918, 4, { compiled_on_t::day, 0, 15 }, 7200, 0 },
+		{ 5794, compiled_continuation_t::save, true, 0, 3600, "LST", 1918, 9, { compiled_on_t::day, 0, 16 }, 10800, 0 },
+		{ 5794, compiled_continuation_t::none, false, 0, 0, "RMT", 1919, 4, { compiled_on_t::day, 0, 1 }, 7200, 0 },
+		{ 5794, compiled_continuation_t::save, true, 0, 3600, "LST", 1919, 5, { compiled_on_t::day, 0, 22 }, 10800, 0 },
+		{ 5794, compiled_continuation_t::none, false, 0, 0, "RMT", 1926, 5, { compiled_on_t::day, 0, 11 }, 0, 0 },
+		{ 7200, compiled_continuation_t::none, false, 0, 0, "EET", 1940, 8, { compiled_on_t::day, 0, 5 }, 0, 0 },
+		{ 10800, compiled_continuation_t::none, false, 0, 0, "MSK", 1941, 7, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 3600, compiled_continuation_t::named, false, 107, 0, "CE%sT", 1944, 10, { compiled_on_t::day, 0, 13 }, 0, 0 },
+		{ 10800, compiled_continuation_t::named, false, 78, 0, "MSK/MSD", 1989, 3, { compiled_on_t::last_weekday, 0, 0 }, 7200, 1 },
+		{ 7200, compiled_continuation_t::save, true, 0, 3600, "EEST", 1989, 9, { compiled_on_t::last_weekday, 0, 0 }, 7200, 1 },
+		{ 7200, compiled_continuation_t::named, false, 56, 0, "EE%sT", 1997, 1, { compiled_on_t::day, 0, 21 }, 0, 0 },
+		{ 7200, compiled_continuation_t::named, false, 30, 0, "EE%sT", 2000, 2, { compiled_on_t::day, 0, 29 }, 0, 0 },
+		{ 7200, compiled_continuation_t::none, false, 0, 0, "EET", 2001, 1, { compiled_on_t::day, 0, 2 }, 0, 0 },
+		{ 7200, compiled_continuation_t::named, false, 30, 0, "EE%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 2996, compiled_continuation_t::none, false, 0, 0, "LMT", 1866, 12, { compiled_on_t::day, 0, 12 }, 0, 0 },
+		{ 2996, compiled_continuation_t::none, false, 0, 0, "RMT", 1893, 10, { compiled_on_t::day, 0, 31 }, 82800, 2 },
+		{ 3600, compiled_continuation_t::named, false, 45, 0, "CE%sT", 1943, 9, { compiled_on_t::day, 0, 10 }, 0, 0 },
+		{ 3600, compiled_continuation_t::named, false, 107, 0, "CE%sT", 1944, 6, { compiled_on_t::day, 0, 4 }, 0, 0 },
+		{ 3600, compiled_continuation_t::named, false, 45, 0, "CE%sT", 1980, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 3600, compiled_continuation_t::named, false, 30, 0, "CE%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 12020, compiled_continuation_t::none, false, 0, 0, "LMT", 1919, 7, { compiled_on_t::day, 0, 1 }, 0, 2 },
+		{ 10800, compiled_continuation_t::none, false, 0, 0, "%z", 1930, 6, { compiled_on_t::day, 0, 21 }, 0, 0 },
+		{ 14400, compiled_continuation_t::none, false, 0, 0, "%z", 1935, 1, { compiled_on_t::day, 0, 27 }, 0, 0 },
+		{ 14400, compiled_continuation_t::named, false, 78, 0, "%z", 1989, 3, { compiled_on_t::day, 0, 26 }, 7200, 1 },
+		{ 10800, compiled_continuation_t::named, false, 78, 0, "%z", 1991, 3, { compiled_on_t::day, 0, 31 }, 7200, 1 },
+		{ 7200, compiled_continuation_t::named, false, 78, 0, "%z", 1991, 9, { compiled_on_t::day, 0, 29 }, 7200, 1 },
+		{ 10800, compiled_continuation_t::none, false, 0, 0, "%z", 1991, 10, { compiled_on_t::day, 0, 20 }, 10800, 0 },
+		{ 14400, compiled_continuation_t::named, false, 78, 0, "%z", 2010, 3, { compiled_on_t::day, 0, 28 }, 7200, 1 },
+		{ 10800, compiled_continuation_t::named, false, 78, 0, "%z", 2011, 3, { compiled_on_t::day, 0, 27 }, 7200, 1 },
+		{ 14400, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 11058, compiled_continuation_t::none, false, 0, 0, "LMT", 1919, 7, { compiled_on_t::day, 0, 1 }, 0, 2 },
+		{ 10800, compiled_continuation_t::none, false, 0, 0, "%z", 1930, 6, { compiled_on_t::day, 0, 21 }, 0, 0 },
+		{ 14400, compiled_continuation_t::named, false, 78, 0, "%z", 1988, 3, { compiled_on_t::day, 0, 27 }, 7200, 1 },
+		{ 10800, compiled_continuation_t::named, false, 78, 0, "%z", 1991, 3, { compiled_on_t::day, 0, 31 }, 7200, 1 },
+		{ 14400, compiled_continuation_t::none, false, 0, 0, "%z", 1992, 3, { compiled_on_t::day, 0, 29 }, 7200, 1 },
+		{ 10800, compiled_continuation_t::named, false, 78, 0, "%z", 2011, 3, { compiled_on_t::day, 0, 27 }, 7200, 1 },
+		{ 14400, compiled_continuation_t::none, false, 0, 0, "%z", 2014, 10, { compiled_on_t::day, 0, 26 }, 7200, 1 },
+		{ 10800, compiled_continuation_t::none, false, 0, 0, "%z", 2016, 12, { compiled_on_t::day, 0, 4 }, 7200, 1 },
+		{ 14400, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 8184, compiled_continuation_t::none, false, 0, 0, "LMT", 1880, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 8160, compiled_continuation_t::none, false, 0, 0, "SMT", 1924, 5, { compiled_on_t::day, 0, 2 }, 0, 0 },
+		{ 7200, compiled_continuation_t::none, false, 0, 0, "EET", 1930, 6, { compiled_on_t::day, 0, 21 }, 0, 0 },
+		{ 10800, compiled_continuation_t::none, false, 0, 0, "MSK", 1941, 11, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 3600, compiled_continuation_t::named, false, 107, 0, "CE%sT", 1944, 4, { compiled_on_t::day, 0, 13 }, 0, 0 },
+		{ 10800, compiled_continuation_t::named, false, 78, 0, "MSK/MSD", 1990, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 10800, compiled_continuation_t::none, false, 0, 0, "MSK", 1990, 7, { compiled_on_t::day, 0, 1 }, 7200, 0 },
+		{ 7200, compiled_continuation_t::none, false, 0, 0, "EET", 1992, 3, { compiled_on_t::day, 0, 20 }, 0, 0 },
+		{ 7200, compiled_continuation_t::named, false, 107, 0, "EE%sT", 1994, 5, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 10800, compiled_continuation_t::named, false, 107, 0, "MSK/MSD", 1996, 3, { compiled_on_t::day, 0, 31 }, 0, 1 },
+		{ 10800, compiled_continuation_t::save, true, 0, 3600, "MSD", 1996, 10, { compiled_on_t::day, 0, 27 }, 10800, 1 },
+		{ 10800, compiled_continuation_t::none, false, 0, 0, "MSK", 1997, 3, { compiled_on_t::last_weekday, 0, 0 }, 3600, 2 },
+		{ 7200, compiled_continuation_t::named, false, 30, 0, "EE%sT", 2014, 3, { compiled_on_t::day, 0, 30 }, 7200, 0 },
+		{ 14400, compiled_continuation_t::none, false, 0, 0, "MSK", 2014, 10, { compiled_on_t::day, 0, 26 }, 7200, 1 },
+		{ 10800, compiled_continuation_t::none, false, 0, 0, "MSK", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 5596, compiled_continuation_t::none, false, 0, 0, "LMT", 1880, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 7016, compiled_continuation_t::none, false, 0, 0, "IMT", 1894, 11, { compiled_on_t::day, 0, 30 }, 0, 0 },
+		{ 7200, compiled_continuation_t::none, false, 0, 0, "EET", 1942, 11, { compiled_on_t::day, 0, 2 }, 10800, 0 },
+		{ 3600, compiled_continuation_t::named, false, 107, 0, "CE%sT", 1945, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 3600, compiled_continuation_t::none, false, 0, 0, "CET", 1945, 4, { compiled_on_t::day, 0, 2 }, 10800, 0 },
+		{ 7200, compiled_continuation_t::none, false, 0, 0, "EET", 1979, 3, { compiled_on_t::day, 0, 31 }, 82800, 0 },
+		{ 7200, compiled_continuation_t::named, false, 13, 0, "EE%sT", 1982, 9, { compiled_on_t::day, 0, 26 }, 10800, 0 },
+		{ 7200, compiled_continuation_t::named, false, 107, 0, "EE%sT", 1991, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 7200, compiled_continuation_t::named, false, 109, 0, "EE%sT", 1997, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 7200, compiled_continuation_t::named, false, 30, 0, "EE%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 5940, compiled_continuation_t::none, false, 0, 0, "LMT", 1880, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 5940, compiled_continuation_t::none, false, 0, 0, "TMT", 1918, 2, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 3600, compiled_continuation_t::named, false, 107, 0, "CE%sT", 1919, 7, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 5940, compiled_continuation_t::none, false, 0, 0, "TMT", 1921, 5, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 7200, compiled_continuation_t::none, false, 0, 0, "EET", 1940, 8, { compiled_on_t::day, 0, 6 }, 0, 0 },
+		{ 10800, compiled_continuation_t::none, false, 0, 0, "MSK", 1941, 9, { compiled_on_t::day, 0, 15 }, 0, 0 },
+		{ 3600, compiled_continuation_t::named, false, 107, 0, "CE%sT", 1944, 9, { compiled_on_t::day, 0, 22 }, 0, 0 },
+		{ 10800, compiled_continuation_t::named, false, 78, 0, "MSK/MSD", 1989, 3, { compiled_on_t::day, 0, 26 }, 7200, 1 },
+		{ 7200, compiled_continuation_t::save, true, 0, 3600, "EEST", 1989, 9, { compiled_on_t::day, 0, 24 }, 7200, 1 },
+		{ 7200, compiled_continuation_t::named, false, 107, 0, "EE%sT", 1998, 9, { compiled_on_t::day, 0, 22 }, 0, 0 },
+		{ 7200, compiled_continuation_t::named, false, 30, 0, "EE%sT", 1999, 10, { compiled_on_t::day, 0, 31 }, 14400, 0 },
+		{ 7200, compiled_continuation_t::none, false, 0, 0, "EET", 2002, 2, { compiled_on_t::day, 0, 21 }, 0, 0 },
+		{ 7200, compiled_continuation_t::named, false, 30, 0, "EE%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 4760, compiled_continuation_t::none, false, 0, 0, "LMT", 1914, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 3600, compiled_continuation_t::none, false, 0, 0, "CET", 1940, 6, { compiled_on_t::day, 0, 16 }, 0, 0 },
+		{ 3600, compiled_continuation_t::named, false, 121, 0, "CE%sT", 1984, 7, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 3600, compiled_continuation_t::named, false, 30, 0, "CE%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 11616, compiled_continuation_t::none, false, 0, 0, "LMT", 1919, 7, { compiled_on_t::day, 0, 1 }, 0, 2 },
+		{ 10800, compiled_continuation_t::none, false, 0, 0, "%z", 1930, 6, { compiled_on_t::day, 0, 21 }, 0, 0 },
+		{ 14400, compiled_continuation_t::named, false, 78, 0, "%z", 1989, 3, { compiled_on_t::day, 0, 26 }, 7200, 1 },
+		{ 10800, compiled_continuation_t::named, false, 78, 0, "%z", 1991, 3, { compiled_on_t::day, 0, 31 }, 7200, 1 },
+		{ 7200, compiled_continuation_t::named, false, 78, 0, "%z", 1992, 1, { compiled_on_t::day, 0, 19 }, 7200, 1 },
+		{ 10800, compiled_continuation_t::named, false, 78, 0, "%z", 2011, 3, { compiled_on_t::day, 0, 27 }, 7200, 1 },
+		{ 14400, compiled_continuation_t::none, false, 0, 0, "%z", 2014, 10, { compiled_on_t::day, 0, 26 }, 7200, 1 },
+		{ 10800, compiled_continuation_t::none, false, 0, 0, "%z", 2016, 3, { compiled_on_t::day, 0, 27 }, 7200, 1 },
+		{ 14400, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 3921, compiled_continuation_t::none, false, 0, 0, "LMT", 1893, 4, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 3600, compiled_continuation_t::named, false, 107, 0, "CE%sT", 1920, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 3600, compiled_continuation_t::named, false, 105, 0, "CE%sT", 1940, 4, { compiled_on_t::day, 0, 1 }, 7200, 1 },
+		{ 3600, compiled_continuation_t::named, false, 107, 0, "CE%sT", 1945, 4, { compiled_on_t::day, 0, 2 }, 7200, 1 },
+		{ 3600, compiled_continuation_t::save, true, 0, 3600, "CEST", 1945, 4, { compiled_on_t::day, 0, 12 }, 7200, 1 },
+		{ 3600, compiled_continuation_t::none, false, 0, 0, "CET", 1946, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 3600, compiled_continuation_t::named, false, 105, 0, "CE%sT", 1981, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 3600, compiled_continuation_t::named, false, 30, 0, "CE%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 6076, compiled_continuation_t::none, false, 0, 0, "LMT", 1880, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 5040, compiled_continuation_t::none, false, 0, 0, "WMT", 1917, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 5736, compiled_continuation_t::none, false, 0, 0, "KMT", 1919, 10, { compiled_on_t::day, 0, 10 }, 0, 0 },
+		{ 3600, compiled_continuation_t::none, false, 0, 0, "CET", 1920, 7, { compiled_on_t::day, 0, 12 }, 0, 0 },
+		{ 7200, compiled_continuation_t::none, false, 0, 0, "EET", 1920, 10, { compiled_on_t::day, 0, 9 }, 0, 0 },
+		{ 3600, compiled_continuation_t::none, false, 0, 0, "CET", 1940, 8, { compiled_on_t::day, 0, 3 }, 0, 0 },
+		{ 10800, compiled_continuation_t::none, false, 0, 0, "MSK", 1941, 6, { compiled_on_t::day, 0, 24 }, 0, 0 },
+		{ 3600, compiled_continuation_t::named, false, 107, 0, "CE%sT", 1944, 8, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 10800, compiled_continuation_t::named, false, 78, 0, "MSK/MSD", 1989, 3, { compiled_on_t::day, 0, 26 }, 7200, 1 },
+		{ 7200, compiled_continuation_t::named, false, 78, 0, "EE%sT", 1991, 9, { compiled_on_t::day, 0, 29 }, 7200, 1 },
+		{ 7200, compiled_continuation_t::named, false, 107, 0, "EE%sT", 1998, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 7200, compiled_continuation_t::none, false, 0, 0, "EET", 1998, 3, { compiled_on_t::day, 0, 29 }, 3600, 2 },
+		{ 3600, compiled_continuation_t::named, false, 30, 0, "CE%sT", 1999, 10, { compiled_on_t::day, 0, 31 }, 3600, 2 },
+		{ 7200, compiled_continuation_t::none, false, 0, 0, "EET", 2003, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 7200, compiled_continuation_t::named, false, 30, 0, "EE%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 10660, compiled_continuation_t::none, false, 0, 0, "LMT", 1920, 1, { compiled_on_t::day, 0, 3 }, 0, 0 },
+		{ 10800, compiled_continuation_t::none, false, 0, 0, "%z", 1930, 6, { compiled_on_t::day, 0, 21 }, 0, 0 },
+		{ 14400, compiled_continuation_t::none, false, 0, 0, "%z", 1961, 11, { compiled_on_t::day, 0, 11 }, 0, 0 },
+		{ 14400, compiled_continuation_t::named, false, 78, 0, "%z", 1988, 3, { compiled_on_t::day, 0, 27 }, 7200, 1 },
+		{ 10800, compiled_continuation_t::named, false, 78, 0, "MSK/MSD", 1991, 3, { compiled_on_t::day, 0, 31 }, 7200, 1 },
+		{ 14400, compiled_continuation_t::none, false, 0, 0, "%z", 1992, 3, { compiled_on_t::day, 0, 29 }, 7200, 1 },
+		{ 10800, compiled_continuation_t::named, false, 78, 0, "MSK/MSD", 2011, 3, { compiled_on_t::day, 0, 27 }, 7200, 1 },
+		{ 14400, compiled_continuation_t::none, false, 0, 0, "MSK", 2014, 10, { compiled_on_t::day, 0, 26 }, 7200, 1 },
+		{ 10800, compiled_continuation_t::none, false, 0, 0, "MSK", 2018, 10, { compiled_on_t::day, 0, 28 }, 7200, 1 },
+		{ 14400, compiled_continuation_t::none, false, 0, 0, "%z", 2020, 12, { compiled_on_t::day, 0, 27 }, 7200, 1 },
+		{ 10800, compiled_continuation_t::none, false, 0, 0, "MSK", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 5040, compiled_continuation_t::none, false, 0, 0, "LMT", 1880, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 5040, compiled_continuation_t::none, false, 0, 0, "WMT", 1915, 8, { compiled_on_t::day, 0, 5 }, 0, 0 },
+		{ 3600, compiled_continuation_t::named, false, 107, 0, "CE%sT", 1918, 9, { compiled_on_t::day, 0, 16 }, 10800, 0 },
+		{ 7200, compiled_continuation_t::named, false, 69, 0, "EE%sT", 1922, 6, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 3600, compiled_continuation_t::named, false, 69, 0, "CE%sT", 1940, 6, { compiled_on_t::day, 0, 23 }, 7200, 0 },
+		{ 3600, compiled_continuation_t::named, false, 107, 0, "CE%sT", 1944, 10, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 3600, compiled_continuation_t::named, false, 69, 0, "CE%sT", 1977, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 3600, compiled_continuation_t::named, false, 98, 0, "CE%sT", 1988, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 3600, compiled_continuation_t::named, false, 30, 0, "CE%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 2048, compiled_continuation_t::none, false, 0, 0, "LMT", 1853, 7, { compiled_on_t::day, 0, 16 }, 0, 0 },
+		{ 1786, compiled_continuation_t::none, false, 0, 0, "BMT", 1894, 6, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 3600, compiled_continuation_t::named, false, 18, 0, "CE%sT", 1981, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 3600, compiled_continuation_t::named, false, 30, 0, "CE%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 0, compiled_continuation_t::none, false, 0, 0, "-00", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 17380, compiled_continuation_t::none, false, 0, 0, "LMT", 1907, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 18000, compiled_continuation_t::none, false, 0, 0, "%z", 1996, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 21600, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 17640, compiled_continuation_t::none, false, 0, 0, "LMT", 1880, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 17640, compiled_continuation_t::none, false, 0, 0, "MMT", 1960, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 18000, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 13800, compiled_continuation_t::none, false, 0, 0, "LMT", 1907, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 14400, compiled_continuation_t::named, false, 60, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 45184, compiled_continuation_t::none, false, 0, 0, "LMT", 1892, 7, { compiled_on_t::day, 0, 5 }, 0, 0 },
+		{ -41216, compiled_continuation_t::none, false, 0, 0, "LMT", 1911, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -41400, compiled_continuation_t::none, false, 0, 0, "%z", 1950, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -39600, compiled_continuation_t::named, false, 99, 0, "%z", 2011, 12, { compiled_on_t::day, 0, 29 }, 86400, 0 },
+		{ 46800, compiled_continuation_t::named, false, 99, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 41944, compiled_continuation_t::none, false, 0, 0, "LMT", 1868, 11, { compiled_on_t::day, 0, 2 }, 0, 0 },
+		{ 41400, compiled_continuation_t::named, false, 68, 0, "NZ%sT", 1946, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 43200, compiled_continuation_t::named, false, 68, 0, "NZ%sT", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 37336, compiled_continuation_t::none, false, 0, 0, "LMT", 1880, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 35312, compiled_continuation_t::none, false, 0, 0, "PMMT", 1895, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 36000, compiled_continuation_t::none, false, 0, 0, "%z", 1942, 7, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 32400, compiled_continuation_t::none, false, 0, 0, "%z", 1945, 8, { compiled_on_t::day, 0, 21 }, 0, 0 },
+		{ 36000, compiled_continuation_t::none, false, 0, 0, "%z", 2014, 12, { compiled_on_t::day, 0, 28 }, 7200, 0 },
+		{ 39600, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 44028, compiled_continuation_t::none, false, 0, 0, "LMT", 1868, 11, { compiled_on_t::day, 0, 2 }, 0, 0 },
+		{ 44100, compiled_continuation_t::none, false, 0, 0, "%z", 1946, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 45900, compiled_continuation_t::named, false, 115, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -26248, compiled_continuation_t::none, false, 0, 0, "LMT", 1890, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -26248, compiled_continuation_t::none, false, 0, 0, "EMT", 1932, 9, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -25200, compiled_continuation_t::named, false, 127, 0, "%z", 1982, 3, { compiled_on_t::day, 0, 14 }, 10800, 2 },
+		{ -21600, compiled_continuation_t::named, false, 127, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 40396, compiled_continuation_t::none, false, 0, 0, "LMT", 1912, 1, { compiled_on_t::day, 0, 13 }, 0, 0 },
+		{ 39600, compiled_continuation_t::named, false, 95, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -41096, compiled_continuation_t::none, false, 0, 0, "LMT", 1901, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -39600, compiled_continuation_t::none, false, 0, 0, "%z", 2011, 12, { compiled_on_t::day, 0, 30 }, 0, 0 },
+		{ 46800, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 42944, compiled_continuation_t::none, false, 0, 0, "LMT", 1915, 10, { compiled_on_t::day, 0, 26 }, 0, 0 },
+		{ 43200, compiled_continuation_t::named, false, 35, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -21504, compiled_continuation_t::none, false, 0, 0, "LMT", 1931, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -18000, compiled_continuation_t::none, false, 0, 0, "%z", 1986, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -21600, compiled_continuation_t::named, false, 31, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -32388, compiled_continuation_t::none, false, 0, 0, "LMT", 1912, 10, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -32400, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 38388, compiled_continuation_t::none, false, 0, 0, "LMT", 1912, 10, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 39600, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -51660, compiled_continuation_t::none, false, 0, 0, "LMT", 1844, 12, { compiled_on_t::day, 0, 31 }, 0, 0 },
+		{ 34740, compiled_continuation_t::none, false, 0, 0, "LMT", 1901, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 36000, compiled_continuation_t::none, false, 0, 0, "GST", 1941, 12, { compiled_on_t::day, 0, 10 }, 0, 0 },
+		{ 32400, compiled_continuation_t::none, false, 0, 0, "%z", 1944, 7, { compiled_on_t::day, 0, 31 }, 0, 0 },
+		{ 36000, compiled_continuation_t::named, false, 39, 0, "G%sT", 2000, 12, { compiled_on_t::day, 0, 23 }, 0, 0 },
+		{ 36000, compiled_continuation_t::none, false, 0, 0, "ChST", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -37886, compiled_continuation_t::none, false, 0, 0, "LMT", 1896, 1, { compiled_on_t::day, 0, 13 }, 43200, 0 },
+		{ -37800, compiled_continuation_t::none, false, 0, 0, "HST", 1933, 4, { compiled_on_t::day, 0, 30 }, 7200, 0 },
+		{ -37800, compiled_continuation_t::save, true, 0, 3600, "HDT", 1933, 5, { compiled_on_t::day, 0, 21 }, 43200, 0 },
+		{ -37800, compiled_continuation_t::named, false, 125, 0, "H%sT", 1947, 6, { compiled_on_t::day, 0, 8 }, 7200, 0 },
+		{ -36000, compiled_continuation_t::none, false, 0, 0, "HST", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 0, compiled_continuation_t::none, false, 0, 0, "-00", 1937, 8, { compiled_on_t::day, 0, 31 }, 0, 0 },
+		{ -43200, compiled_continuation_t::none, false, 0, 0, "%z", 1979, 10, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -39600, compiled_continuation_t::none, false, 0, 0, "%z", 1994, 12, { compiled_on_t::day, 0, 31 }, 0, 0 },
+		{ 46800, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -37760, compiled_continuation_t::none, false, 0, 0, "LMT", 1901, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -38400, compiled_continuation_t::none, false, 0, 0, "%z", 1979, 10, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -36000, compiled_continuation_t::none, false, 0, 0, "%z", 1994, 12, { compiled_on_t::day, 0, 31 }, 0, 0 },
+		{ 50400, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -47284, compiled_continuation_t::none, false, 0, 0, "LMT", 1844, 12, { compiled_on_t::day, 0, 31 }, 0, 0 },
+		{ 39116, compiled_continuation_t::none, false, 0, 0, "LMT", 1901, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 39600, compiled_continuation_t::none, false, 0, 0, "%z", 1914, 10, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 32400, compiled_continuation_t::none, false, 0, 0, "%z", 1919, 2, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 39600, compiled_continuation_t::none, false, 0, 0, "%z", 1937, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 36000, compiled_continuation_t::none, false, 0, 0, "%z", 1941, 4, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 32400, compiled_continuation_t::none, false, 0, 0, "%z", 1945, 8, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 39600, compiled_continuation_t::none, false, 0, 0, "%z", 1969, 10, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 43200, compiled_continuation_t::none, false, 0, 0, "%z", 1999, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 39600, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 40160, compiled_continuation_t::none, false, 0, 0, "LMT", 1901, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 39600, compiled_continuation_t::none, false, 0, 0, "%z", 1937, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 36000, compiled_continuation_t::none, false, 0, 0, "%z", 1941, 4, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 32400, compiled_continuation_t::none, false, 0, 0, "%z", 1944, 2, { compiled_on_t::day, 0, 6 }, 0, 0 },
+		{ 39600, compiled_continuation_t::none, false, 0, 0, "%z", 1969, 10, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -43200, compiled_continuation_t::none, false, 0, 0, "%z", 1993, 8, { compiled_on_t::day, 0, 20 }, 86400, 0 },
+		{ 43200, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -33480, compiled_continuation_t::none, false, 0, 0, "LMT", 1912, 10, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -34200, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 40060, compiled_continuation_t::none, false, 0, 0, "LMT", 1921, 1, { compiled_on_t::day, 0, 15 }, 0, 0 },
+		{ 41400, compiled_continuation_t::none, false, 0, 0, "%z", 1942, 8, { compiled_on_t::day, 0, 29 }, 0, 0 },
+		{ 32400, compiled_continuation_t::none, false, 0, 0, "%z", 1945, 9, { compiled_on_t::day, 0, 8 }, 0, 0 },
+		{ 41400, compiled_continuation_t::none, false, 0, 0, "%z", 1979, 2, { compiled_on_t::day, 0, 10 }, 7200, 0 },
+		{ 43200, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -40780, compiled_continuation_t::none, false, 0, 0, "LMT", 1952, 10, { compiled_on_t::day, 0, 16 }, 0, 0 },
+		{ -40800, compiled_continuation_t::none, false, 0, 0, "%z", 1964, 7, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -39600, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 40312, compiled_continuation_t::none, false, 0, 0, "LMT", 1901, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 40320, compiled_continuation_t::none, false, 0, 0, "%z", 1951, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 41400, compiled_continuation_t::none, false, 0, 0, "%z", 1974, 10, { compiled_on_t::day, 0, 27 }, 7200, 1 },
+		{ 41400, compiled_continuation_t::save, true, 0, 3600, "%z", 1975, 3, { compiled_on_t::day, 0, 2 }, 7200, 1 },
+		{ 41400, compiled_continuation_t::none, false, 0, 0, "%z", 2015, 10, { compiled_on_t::day, 0, 4 }, 7200, 1 },
+		{ 39600, compiled_continuation_t::none, false, 0, 0, "%z", 2019, 7, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 39600, compiled_continuation_t::named, false, 2, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 39948, compiled_continuation_t::none, false, 0, 0, "LMT", 1912, 1, { compiled_on_t::day, 0, 13 }, 0, 0 },
+		{ 39600, compiled_continuation_t::named, false, 65, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 45432, compiled_continuation_t::none, false, 0, 0, "LMT", 1892, 7, { compiled_on_t::day, 0, 5 }, 0, 0 },
+		{ -40968, compiled_continuation_t::none, false, 0, 0, "LMT", 1911, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -39600, compiled_continuation_t::none, false, 0, 0, "SST", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -54124, compiled_continuation_t::none, false, 0, 0, "LMT", 1844, 12, { compiled_on_t::day, 0, 31 }, 0, 0 },
+		{ 32276, compiled_continuation_t::none, false, 0, 0, "LMT", 1901, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 32400, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -31220, compiled_continuation_t::none, false, 0, 0, "LMT", 1901, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -30600, compiled_continuation_t::none, false, 0, 0, "%z", 1998, 4, { compiled_on_t::day, 0, 27 }, 0, 0 },
+		{ -28800, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 35320, compiled_continuation_t::none, false, 0, 0, "LMT", 1880, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 35312, compiled_continuation_t::none, false, 0, 0, "PMMT", 1895, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 36000, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 48056, compiled_continuation_t::none, false, 0, 0, "LMT", 1899, 12, { compiled_on_t::day, 0, 26 }, 0, 0 },
+		{ -38344, compiled_continuation_t::none, false, 0, 0, "LMT", 1952, 10, { compiled_on_t::day, 0, 16 }, 0, 0 },
+		{ -37800, compiled_continuation_t::none, false, 0, 0, "%z", 1978, 11, { compiled_on_t::day, 0, 12 }, 0, 0 },
+		{ -36000, compiled_continuation_t::named, false, 19, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -35896, compiled_continuation_t::none, false, 0, 0, "LMT", 1912, 10, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ -36000, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 41524, compiled_continuation_t::none, false, 0, 0, "LMT", 1901, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 43200, compiled_continuation_t::none, false, 0, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 44352, compiled_continuation_t::none, false, 0, 0, "LMT", 1945, 9, { compiled_on_t::day, 0, 10 }, 0, 0 },
+		{ 44400, compiled_continuation_t::none, false, 0, 0, "%z", 1961, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 46800, compiled_continuation_t::none, false, 0, 0, "%z", 1999, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+		{ 46800, compiled_continuation_t::named, false, 90, 0, "%z", -32767, 1, { compiled_on_t::day, 0, 1 }, 0, 0 },
+	};
+
+	static constexpr compiled_zone_t zones[] =
+	{
+		{ "Africa/Abidjan", 14, 0, 2 },
+		{ "Africa/Algiers", 14, 2, 10 },
+		{ "Africa/Bissau", 13, 12, 3 },
+		{ "Africa/Cairo", 12, 15, 2 },
+		{ "Africa/Casablanca", 17, 17, 5 },
+		{ "Africa/Ceuta", 12, 22, 9 },
+		{ "Africa/El_Aaiun", 15, 31, 4 },
+		{ "Africa/Johannesburg", 19, 35, 3 },
+		{ "Africa/Juba", 11, 38, 4 },
+		{ "Africa/Khartoum", 15, 42, 4 },
+		{ "Africa/Lagos", 12, 46, 5 },
+		{ "Africa/Maputo", 13, 51, 2 },
+		{ "Africa/Monrovia", 15, 53, 4 },
+		{ "Africa/Nairobi", 14, 57, 6 },
+		{ "Africa/Ndjamena", 15, 63, 4 },
+		{ "Africa/Sao_Tome", 15, 67, 5 },
+		{ "Africa/Tripoli", 14, 72, 9 },
+		{ "Africa/Tunis", 12, 81, 3 },
+		{ "Africa/Windhoek", 15, 84, 6 },
+		{ "America/Adak", 12, 90, 9 },
+		{ "America/Anchorage", 17, 99, 8 },
+		{ "America/Araguaina", 17, 107, 7 },
+		{ "America/Argentina/Buenos_Aires", 30, 114, 7 },
+		{ "America/Argentina/Catamarca", 27, 121, 12 },
+		{ "America/Argentina/Cordoba", 25, 133, 9 },
+		{ "America/Argentina/Jujuy", 23, 142, 13 },
+		{ "America/Argentina/La_Rioja", 26, 155, 12 },
+		{ "America/Argentina/Mendoza", 25, 167, 16 },
+		{ "America/Argentina/Rio_Gallegos", 30, 183, 10 },
+		{ "America/Argentina/Salta", 23, 193, 10 },
+		{ "America/Argentina/San_Juan", 26, 203, 12 },
+		{ "America/Argentina/San_Luis", 26, 215, 16 },
+		{ "America/Argentina/Tucuman", 25, 231, 11 },
+		{ "America/Argentina/Ushuaia", 25, 242, 10 },
+		{ "America/Asuncion", 16, 252, 6 },
+		{ "America/Bahia", 13, 258, 5 },
+		{ "America/Bahia_Banderas", 22, 263, 8 },
+		{ "America/Barbados", 16, 271, 4 },
+		{ "America/Belem", 13, 275, 3 },
+		{ "America/Belize", 14, 278, 2 },
+		{ "America/Boa_Vista", 17, 280, 5 },
+		{ "America/Bogota", 14, 285, 3 },
+		{ "America/Boise", 13, 288, 5 },
+		{ "America/Cambridge_Bay", 21, 293, 6 },
+		{ "America/Campo_Grande", 20, 299, 2 },
+		{ "America/Cancun", 14, 301, 7 },
+		{ "America/Caracas", 15, 308, 6 },
+		{ "America/Cayenne", 15, 314, 3 },
+		{ "America/Chicago", 15, 317, 8 },
+		{ "America/Chihuahua", 17, 325, 9 },
+		{ "America/Ciudad_Juarez", 21, 334, 11 },
+		{ "America/Costa_Rica", 18, 345, 3 },
+		{ "America/Coyhaique", 17, 348, 14 },
+		{ "America/Cuiaba", 14, 362, 4 },
+		{ "America/Danmarkshavn", 20, 366, 4 },
+		{ "America/Dawson", 14, 370, 6 },
+		{ "America/Dawson_Creek", 20, 376, 4 },
+		{ "America/Denver", 14, 380, 6 },
+		{ "America/Detroit", 15, 386, 10 },
+		{ "America/Edmonton", 16, 396, 3 },
+		{ "America/Eirunepe", 16, 399, 7 },
+		{ "America/El_Salvador", 19, 406, 2 },
+		{ "America/Fort_Nelson", 19, 408, 6 },
+		{ "America/Fortaleza", 17, 414, 7 },
+		{ "America/Glace_Bay", 17, 421, 6 },
+		{ "America/Goose_Bay", 17, 427, 10 },
+		{ "America/Grand_Turk", 18, 437, 6 },
+		{ "America/Guatemala", 17, 443, 2 },
+		{ "America/Guayaquil", 17, 445, 3 },
+		{ "America/Guyana", 14, 448, 5 },
+		{ "America/Halifax", 15, 453, 7 },
+		{ "America/Havana", 14, 460, 3 },
+		{ "America/Hermosillo", 18, 463, 8 },
+		{ "America/Indiana/Indianapolis", 28, 471, 11 },
+		{ "America/Indiana/Knox", 20, 482, 7 },
+		{ "America/Indiana/Marengo", 23, 489, 9 },
+		{ "America/Indiana/Petersburg", 26, 498, 8 },
+		{ "America/Indiana/Tell_City", 25, 506, 8 },
+		{ "America/Indiana/Vevay", 21, 514, 6 },
+		{ "America/Indiana/Vincennes", 25, 520, 8 },
+		{ "America/Indiana/Winamac", 23, 528, 8 },
+		{ "America/Inuvik", 14, 536, 4 },
+		{ "America/Iqaluit", 15, 540, 4 },
+		{ "America/Jamaica", 15, 544, 5 },
+		{ "America/Juneau", 14, 549, 10 },
+		{ "America/Kentucky/Louisville", 27, 559, 9 },
+		{ "America/Kentucky/Monticello", 27, 568, 5 },
+		{ "America/La_Paz", 14, 573, 4 },
+		{ "America/Lima", 12, 577, 3 },
+		{ "America/Los_Angeles", 19, 580, 4 },
+		{ "America/Maceio", 14, 584, 9 },
+		{ "America/Managua", 15, 593, 9 },
+		{ "America/Manaus", 14, 602, 5 },
+		{ "America/Martinique", 18, 607, 5 },
+		{ "America/Matamoros", 17, 612, 5 },
+		{ "America/Mazatlan", 16, 617, 7 },
+		{ "America/Menominee", 17, 624, 5 },
+		{ "America/Merida", 14, 629, 4 },
+		{ "America/Metlakatla", 18, 633, 10 },
+		{ "America/Mexico_City", 19, 643, 7 },
+		{ "America/Miquelon", 16, 650, 4 },
+		{ "America/Moncton", 15, 654, 9 },
+		{ "America/Monterrey", 17, 663, 7 },
+		{ "America/Montevideo", 18, 670, 11 },
+		{ "America/New_York", 16, 681, 6 },
+		{ "America/Nome", 12, 687, 9 },
+		{ "America/Noronha", 15, 696, 7 },
+		{ "America/North_Dakota/Beulah", 27, 703, 3 },
+		{ "America/North_Dakota/Center", 27, 706, 3 },
+		{ "America/North_Dakota/New_Salem", 30, 709, 3 },
+		{ "America/Nuuk", 12, 712, 5 },
+		{ "America/Ojinaga", 15, 717, 11 },
+		{ "America/Panama", 14, 728, 3 },
+		{ "America/Paramaribo", 18, 731, 5 },
+		{ "America/Phoenix", 15, 736, 7 },
+		{ "America/Port-au-Prince", 22, 743, 3 },
+		{ "America/Porto_Velho", 19, 746, 3 },
+		{ "America/Puerto_Rico", 19, 749, 4 },
+		{ "America/Punta_Arenas", 20, 753, 14 },
+		{ "America/Rankin_Inlet", 20, 767, 4 },
+		{ "America/Recife", 14, 771, 7 },
+		{ "America/Regina", 14, 778, 3 },
+		{ "America/Resolute", 16, 781, 6 },
+		{ "America/Rio_Branco", 18, 787, 5 },
+		{ "America/Santarem", 16, 792, 4 },
+		{ "America/Santiago", 16, 796, 14 },
+		{ "America/Santo_Domingo", 21, 810, 6 },
+		{ "America/Sao_Paulo", 17, 816, 4 },
+		{ "America/Scoresbysund", 20, 820, 5 },
+		{ "America/Sitka", 13, 825, 8 },
+		{ "America/St_Johns", 16, 833, 8 },
+		{ "America/Swift_Current", 21, 841, 5 },
+		{ "America/Tegucigalpa", 19, 846, 2 },
+		{ "America/Thule", 13, 848, 2 },
+		{ "America/Tijuana", 15, 850, 25 },
+		{ "America/Toronto", 15, 875, 6 },
+		{ "America/Vancouver", 17, 881, 3 },
+		{ "America/Whitehorse", 18, 884, 6 },
+		{ "America/Winnipeg", 16, 890, 3 },
+		{ "America/Yakutat", 15, 893, 7 },
+		{ "Antarctica/Casey", 16, 900, 18 },
+		{ "Antarctica/Davis", 16, 918, 8 },
+		{ "Antarctica/Macquarie", 20, 926, 9 },
+		{ "Antarctica/Mawson", 17, 935, 3 },
+		{ "Antarctica/Palmer", 17, 938, 5 },
+		{ "Antarctica/Rothera", 18, 943, 2 },
+		{ "Antarctica/Troll", 16, 945, 2 },
+		{ "Antarctica/Vostok", 17, 947, 5 },
+		{ "Asia/Almaty", 11, 952, 7 },
+		{ "Asia/Amman", 10, 959, 3 },
+		{ "Asia/Anadyr", 11, 962, 8 },
+		{ "Asia/Aqtau", 10, 970, 9 },
+		{ "Asia/Aqtobe", 11, 979, 9 },
+		{ "Asia/Ashgabat", 13, 988, 5 },
+		{ "Asia/Atyrau", 11, 993, 9 },
+		{ "Asia/Baghdad", 12, 1002, 4 },
+		{ "Asia/Baku", 9, 1006, 7 },
+		{ "Asia/Bangkok", 12, 1013, 3 },
+		{ "Asia/Barnaul", 12, 1016, 9 },
+		{ "Asia/Beirut", 11, 1025, 2 },
+		{ "Asia/Bishkek", 12, 1027, 6 },
+		{ "Asia/Chita", 10, 1033, 8 },
+		{ "Asia/Colombo", 12, 1041, 9 },
+		{ "Asia/Damascus", 13, 1050, 3 },
+		{ "Asia/Dhaka", 10, 1053, 7 },
+		{ "Asia/Dili", 9, 1060, 5 },
+		{ "Asia/Dubai", 10, 1065, 2 },
+		{ "Asia/Dushanbe", 13, 1067, 5 },
+		{ "Asia/Famagusta", 14, 1072, 5 },
+		{ "Asia/Gaza", 9, 1077, 12 },
+		{ "Asia/Hebron", 11, 1089, 6 },
+		{ "Asia/Ho_Chi_Minh", 16, 1095, 10 },
+		{ "Asia/Hong_Kong", 14, 1105, 6 },
+		{ "Asia/Hovd", 9, 1111, 3 },
+		{ "Asia/Irkutsk", 12, 1114, 8 },
+		{ "Asia/Jakarta", 12, 1122, 9 },
+		{ "Asia/Jayapura", 13, 1131, 4 },
+		{ "Asia/Jerusalem", 14, 1135, 3 },
+		{ "Asia/Kabul", 10, 1138, 3 },
+		{ "Asia/Kamchatka", 14, 1141, 7 },
+		{ "Asia/Karachi", 12, 1148, 6 },
+		{ "Asia/Kathmandu", 14, 1154, 3 },
+		{ "Asia/Khandyga", 13, 1157, 9 },
+		{ "Asia/Kolkata", 12, 1166, 8 },
+		{ "Asia/Krasnoyarsk", 16, 1174, 7 },
+		{ "Asia/Kuching", 12, 1181, 5 },
+		{ "Asia/Macau", 10, 1186, 4 },
+		{ "Asia/Magadan", 12, 1190, 8 },
+		{ "Asia/Makassar", 13, 1198, 5 },
+		{ "Asia/Manila", 11, 1203, 5 },
+		{ "Asia/Nicosia", 12, 1208, 3 },
+		{ "Asia/Novokuznetsk", 17, 1211, 7 },
+		{ "Asia/Novosibirsk", 16, 1218, 9 },
+		{ "Asia/Omsk", 9, 1227, 7 },
+		{ "Asia/Oral", 9, 1234, 10 },
+		{ "Asia/Pontianak", 14, 1244, 9 },
+		{ "Asia/Pyongyang", 14, 1253, 6 },
+		{ "Asia/Qatar", 10, 1259, 3 },
+		{ "Asia/Qostanay", 13, 1262, 10 },
+		{ "Asia/Qyzylorda", 14, 1272, 12 },
+		{ "Asia/Riyadh", 11, 1284, 2 },
+		{ "Asia/Sakhalin", 13, 1286, 9 },
+		{ "Asia/Samarkand", 14, 1295, 7 },
+		{ "Asia/Seoul", 10, 1302, 6 },
+		{ "Asia/Shanghai", 13, 1308, 3 },
+		{ "Asia/Singapore", 14, 1311, 9 },
+		{ "Asia/Srednekolymsk", 18, 1320, 7 },
+		{ "Asia/Taipei", 11, 1327, 4 },
+		{ "Asia/Tashkent", 13, 1331, 5 },
+		{ "Asia/Tbilisi", 12, 1336, 11 },
+		{ "Asia/Tehran", 11, 1347, 5 },
+		{ "Asia/Thimphu", 12, 1352, 3 },
+		{ "Asia/Tokyo", 10, 1355, 2 },
+		{ "Asia/Tomsk", 10, 1357, 9 },
+		{ "Asia/Ulaanbaatar", 16, 1366, 3 },
+		{ "Asia/Urumqi", 11, 1369, 2 },
+		{ "Asia/Ust-Nera", 13, 1371, 9 },
+		{ "Asia/Vladivostok", 16, 1380, 7 },
+		{ "Asia/Yakutsk", 12, 1387, 7 },
+		{ "Asia/Yangon", 11, 1394, 5 },
+		{ "Asia/Yekaterinburg", 18, 1399, 8 },
+		{ "Asia/Yerevan", 12, 1407, 7 },
+		{ "Atlantic/Azores", 15, 1414, 8 },
+		{ "Atlantic/Bermuda", 16, 1422, 5 },
+		{ "Atlantic/Canary", 15, 1427, 5 },
+		{ "Atlantic/Cape_Verde", 19, 1432, 5 },
+		{ "Atlantic/Faroe", 14, 1437, 3 },
+		{ "Atlantic/Madeira", 16, 1440, 6 },
+		{ "Atlantic/South_Georgia", 22, 1446, 2 },
+		{ "Atlantic/Stanley", 16, 1448, 6 },
+		{ "Australia/Adelaide", 18, 1454, 4 },
+		{ "Australia/Brisbane", 18, 1458, 3 },
+		{ "Australia/Broken_Hill", 21, 1461, 6 },
+		{ "Australia/Darwin", 16, 1467, 3 },
+		{ "Australia/Eucla", 15, 1470, 3 },
+		{ "Australia/Hobart", 16, 1473, 4 },
+		{ "Australia/Lindeman", 18, 1477, 4 },
+		{ "Australia/Lord_Howe", 19, 1481, 4 },
+		{ "Australia/Melbourne", 19, 1485, 3 },
+		{ "Australia/Perth", 15, 1488, 3 },
+		{ "Australia/Sydney", 16, 1491, 3 },
+		{ "Etc/GMT", 7, 1494, 1 },
+		{ "Etc/GMT+1", 9, 1495, 1 },
+		{ "Etc/GMT+10", 10, 1496, 1 },
+		{ "Etc/GMT+11", 10, 1497, 1 },
+		{ "Etc/GMT+12", 10, 1498, 1 },
+		{ "Etc/GMT+2", 9, 1499, 1 },
+		{ "Etc/GMT+3", 9, 1500, 1 },
+		{ "Etc/GMT+4", 9, 1501, 1 },
+		{ "Etc/GMT+5", 9, 1502, 1 },
+		{ "Etc/GMT+6", 9, 1503, 1 },
+		{ "Etc/GMT+7", 9, 1504, 1 },
+		{ "Etc/GMT+8", 9, 1505, 1 },
+		{ "Etc/GMT+9", 9, 1506, 1 },
+		{ "Etc/GMT-1", 9, 1507, 1 },
+		{ "Etc/GMT-10", 10, 1508, 1 },
+		{ "Etc/GMT-11", 10, 1509, 1 },
+		{ "Etc/GMT-12", 10, 1510, 1 },
+		{ "Etc/GMT-13", 10, 1511, 1 },
+		{ "Etc/GMT-14", 10, 1512, 1 },
+		{ "Etc/GMT-2", 9, 1513, 1 },
+		{ "Etc/GMT-3", 9, 1514, 1 },
+		{ "Etc/GMT-4", 9, 1515, 1 },
+		{ "Etc/GMT-5", 9, 1516, 1 },
+		{ "Etc/GMT-6", 9, 1517, 1 },
+		{ "Etc/GMT-7", 9, 1518, 1 },
+		{ "Etc/GMT-8", 9, 1519, 1 },
+		{ "Etc/GMT-9", 9, 1520, 1 },
+		{ "Etc/UTC", 7, 1521, 1 },
+		{ "Europe/Andorra", 14, 1522, 4 },
+		{ "Europe/Astrakhan", 16, 1526, 9 },
+		{ "Europe/Athens", 13, 1535, 6 },
+		{ "Europe/Belgrade", 15, 1541, 7 },
+		{ "Europe/Berlin", 13, 1548, 5 },
+		{ "Europe/Brussels", 15, 1553, 9 },
+		{ "Europe/Bucharest", 16, 1562, 7 },
+		{ "Europe/Budapest", 15, 1569, 6 },
+		{ "Europe/Chisinau", 15, 1575, 10 },
+		{ "Europe/Dublin", 13, 1585, 11 },
+		{ "Europe/Gibraltar", 16, 1596, 4 },
+		{ "Europe/Helsinki", 15, 1600, 4 },
+		{ "Europe/Istanbul", 15, 1604, 13 },
+		{ "Europe/Kaliningrad", 18, 1617, 7 },
+		{ "Europe/Kirov", 12, 1624, 8 },
+		{ "Europe/Kyiv", 11, 1632, 9 },
+		{ "Europe/Lisbon", 13, 1641, 8 },
+		{ "Europe/London", 13, 1649, 5 },
+		{ "Europe/Madrid", 13, 1654, 4 },
+		{ "Europe/Malta", 12, 1658, 4 },
+		{ "Europe/Minsk", 12, 1662, 9 },
+		{ "Europe/Moscow", 13, 1671, 11 },
+		{ "Europe/Paris", 12, 1682, 7 },
+		{ "Europe/Prague", 13, 1689, 7 },
+		{ "Europe/Riga", 11, 1696, 15 },
+		{ "Europe/Rome", 11, 1711, 6 },
+		{ "Europe/Samara", 13, 1717, 10 },
+		{ "Europe/Saratov", 14, 1727, 9 },
+		{ "Europe/Simferopol", 17, 1736, 15 },
+		{ "Europe/Sofia", 12, 1751, 10 },
+		{ "Europe/Tallinn", 14, 1761, 13 },
+		{ "Europe/Tirane", 13, 1774, 4 },
+		{ "Europe/Ulyanovsk", 16, 1778, 9 },
+		{ "Europe/Vienna", 13, 1787, 8 },
+		{ "Europe/Vilnius", 14, 1795, 15 },
+		{ "Europe/Volgograd", 16, 1810, 11 },
+		{ "Europe/Warsaw", 13, 1821, 9 },
+		{ "Europe/Zurich", 13, 1830, 4 },
+		{ "Factory", 7, 1834, 1 },
+		{ "Indian/Chagos", 13, 1835, 3 },
+		{ "Indian/Maldives", 15, 1838, 3 },
+		{ "Indian/Mauritius", 16, 1841, 2 },
+		{ "Pacific/Apia", 12, 1843, 5 },
+		{ "Pacific/Auckland", 16, 1848, 3 },
+		{ "Pacific/Bougainville", 20, 1851, 6 },
+		{ "Pacific/Chatham", 15, 1857, 3 },
+		{ "Pacific/Easter", 14, 1860, 4 },
+		{ "Pacific/Efate", 13, 1864, 2 },
+		{ "Pacific/Fakaofo", 15, 1866, 3 },
+		{ "Pacific/Fiji", 12, 1869, 2 },
+		{ "Pacific/Galapagos", 17, 1871, 3 },
+		{ "Pacific/Gambier", 15, 1874, 2 },
+		{ "Pacific/Guadalcanal", 19, 1876, 2 },
+		{ "Pacific/Guam", 12, 1878, 6 },
+		{ "Pacific/Honolulu", 16, 1884, 5 },
+		{ "Pacific/Kanton", 14, 1889, 4 },
+		{ "Pacific/Kiritimati", 18, 1893, 4 },
+		{ "Pacific/Kosrae", 14, 1897, 10 },
+		{ "Pacific/Kwajalein", 17, 1907, 7 },
+		{ "Pacific/Marquesas", 17, 1914, 2 },
+		{ "Pacific/Nauru", 13, 1916, 5 },
+		{ "Pacific/Niue", 12, 1921, 3 },
+		{ "Pacific/Norfolk", 15, 1924, 7 },
+		{ "Pacific/Noumea", 14, 1931, 2 },
+		{ "Pacific/Pago_Pago", 17, 1933, 3 },
+		{ "Pacific/Palau", 13, 1936, 3 },
+		{ "Pacific/Pitcairn", 16, 1939, 3 },
+		{ "Pacific/Port_Moresby", 20, 1942, 3 },
+		{ "Pacific/Rarotonga", 17, 1945, 4 },
+		{ "Pacific/Tahiti", 14, 1949, 2 },
+		{ "Pacific/Tarawa", 14, 1951, 2 },
+		{ "Pacific/Tongatapu", 17, 1953, 4 },
+	};
+
+	static constexpr compiled_link_t links[] =
+	{
+		{ "Africa/Accra", 12, "Africa/Abidjan", 14 },
+		{ "Africa/Addis_Ababa", 18, "Africa/Nairobi", 14 },
+		{ "Africa/Asmara", 13, "Africa/Nairobi", 14 },
+		{ "Africa/Asmera", 13, "Africa/Nairobi", 14 },
+		{ "Africa/Bamako", 13, "Africa/Abidjan", 14 },
+		{ "Africa/Bangui", 13, "Africa/Lagos", 12 },
+		{ "Africa/Banjul", 13, "Africa/Abidjan", 14 },
+		{ "Africa/Blantyre", 15, "Africa/Maputo", 13 },
+		{ "Africa/Brazzaville", 18, "Africa/Lagos", 12 },
+		{ "Africa/Bujumbura", 16, "Africa/Maputo", 13 },
+		{ "Africa/Conakry", 14, "Africa/Abidjan", 14 },
+		{ "Africa/Dakar", 12, "Africa/Abidjan", 14 },
+		{ "Africa/Dar_es_Salaam", 20, "Africa/Nairobi", 14 },
+		{ "Africa/Djibouti", 15, "Africa/Nairobi", 14 },
+		{ "Africa/Douala", 13, "Africa/Lagos", 12 },
+		{ "Africa/Freetown", 15, "Africa/Abidjan", 14 },
+		{ "Africa/Gaborone", 15, "Africa/Maputo", 13 },
+		{ "Africa/Harare", 13, "Africa/Maputo", 13 },
+		{ "Africa/Kampala", 14, "Africa/Nairobi", 14 },
+		{ "Africa/Kigali", 13, "Africa/Maputo", 13 },
+		{ "Africa/Kinshasa", 15, "Africa/Lagos", 12 },
+		{ "Africa/Libreville", 17, "Africa/Lagos", 12 },
+		{ "Africa/Lome", 11, "Africa/Abidjan", 14 },
+		{ "Africa/Luanda", 13, "Africa/Lagos", 12 },
+		{ "Africa/Lubumbashi", 17, "Africa/Maputo", 13 },
+		{ "Africa/Lusaka", 13, "Africa/Maputo", 13 },
+		{ "Africa/Malabo", 13, "Africa/Lagos", 12 },
+		{ "Africa/Maseru", 13, "Africa/Johannesburg", 19 },
+		{ "Africa/Mbabane", 14, "Africa/Johannesburg", 19 },
+		{ "Africa/Mogadishu", 16, "Africa/Nairobi", 14 },
+		{ "Africa/Niamey", 13, "Africa/Lagos", 12 },
+		{ "Africa/Nouakchott", 17, "Africa/Abidjan", 14 },
+		{ "Africa/Ouagadougou", 18, "Africa/Abidjan", 14 },
+		{ "Africa/Porto-Novo", 17, "Africa/Lagos", 12 },
+		{ "Africa/Timbuktu", 15, "Africa/Abidjan", 14 },
+		{ "America/Anguilla", 16, "America/Puerto_Rico", 19 },
+		{ "America/Antigua", 15, "America/Puerto_Rico", 19 },
+		{ "America/Argentina/ComodRivadavia", 32, "America/Argentina/Catamarca", 27 },
+		{ "America/Aruba", 13, "America/Puerto_Rico", 19 },
+		{ "America/Atikokan", 16, "America/Panama", 14 },
+		{ "America/Atka", 12, "America/Adak", 12 },
+		{ "America/Blanc-Sablon", 20, "America/Puerto_Rico", 19 },
+		{ "America/Buenos_Aires", 20, "America/Argentina/Buenos_Aires", 30 },
+		{ "America/Catamarca", 17, "America/Argentina/Catamarca", 27 },
+		{ "America/Cayman", 14, "America/Panama", 14 },
+		{ "America/Coral_Harbour", 21, "America/Panama", 14 },
+		{ "America/Cordoba", 15, "America/Argentina/Cordoba", 25 },
+		{ "America/Creston", 15, "America/Phoenix", 15 },
+		{ "America/Curacao", 15, "America/Puerto_Rico", 19 },
+		{ "America/Dominica", 16, "America/Puerto_Rico", 19 },
+		{ "America/Ensenada", 16, "America/Tijuana", 15 },
+		{ "America/Fort_Wayne", 18, "America/Indiana/Indianapolis", 28 },
+		{ "America/Godthab", 15, "America/Nuuk", 12 },
+		{ "America/Grenada", 15, "America/Puerto_Rico", 19 },
+		{ "America/Guadeloupe", 18, "America/Puerto_Rico", 19 },
+		{ "America/Indianapolis", 20, "America/Indiana/Indianapolis", 28 },
+		{ "America/Jujuy", 13, "America/Argentina/Jujuy", 23 },
+		{ "America/Knox_IN", 15, "America/Indiana/Knox", 20 },
+		{ "America/Kralendijk", 18, "America/Puerto_Rico", 19 },
+		{ "America/Louisville", 18, "America/Kentucky/Louisville", 27 },
+		{ "America/Lower_Princes", 21, "America/Puerto_Rico", 19 },
+		{ "America/Marigot", 15, "America/Puerto_Rico", 19 },
+		{ "America/Mendoza", 15, "America/Argentina/Mendoza", 25 },
+		{ "America/Montreal", 16, "America/Toronto", 15 },
+		{ "America/Montserrat", 18, "America/Puerto_Rico", 19 },
+		{ "America/Nassau", 14, "America/Toronto", 15 },
+		{ "America/Nipigon", 15, "America/Toronto", 15 },
+		{ "America/Pangnirtung", 19, "America/Iqaluit", 15 },
+		{ "America/Port_of_Spain", 21, "America/Puerto_Rico", 19 },
+		{ "America/Porto_Acre", 18, "America/Rio_Branco", 18 },
+		{ "America/Rainy_River", 19, "America/Winnipeg", 16 },
+		{ "America/Rosario", 15, "America/Argentina/Cordoba", 25 },
+		{ "America/Santa_Isabel", 20, "America/Tijuana", 15 },
+		{ "America/Shiprock", 16, "America/Denver", 14 },
+		{ "America/St_Barthelemy", 21, "America/Puerto_Rico", 19 },
+		{ "America/St_Kitts", 16, "America/Puerto_Rico", 19 },
+		{ "America/St_Lucia", 16, "America/Puerto_Rico", 19 },
+		{ "America/St_Thomas", 17, "America/Puerto_Rico", 19 },
+		{ "America/St_Vincent", 18, "America/Puerto_Rico", 19 },
+		{ "America/Thunder_Bay", 19, "America/Toronto", 15 },
+		{ "America/Tortola", 15, "America/Puerto_Rico", 19 },
+		{ "America/Virgin", 14, "America/Puerto_Rico", 19 },
+		{ "America/Yellowknife", 19, "America/Edmonton", 16 },
+		{ "Antarctica/DumontDUrville", 25, "Pacific/Port_Moresby", 20 },
+		{ "Antarctica/McMurdo", 18, "Pacific/Auckland", 16 },
+		{ "Antarctica/South_Pole", 21, "Pacific/Auckland", 16 },
+		{ "Antarctica/Syowa", 16, "Asia/Riyadh", 11 },
+		{ "Arctic/Longyearbyen", 19, "Europe/Berlin", 13 },
+		{ "Asia/Aden", 9, "Asia/Riyadh", 11 },
+		{ "Asia/Ashkhabad", 14, "Asia/Ashgabat", 13 },
+		{ "Asia/Bahrain", 12, "Asia/Qatar", 10 },
+		{ "Asia/Brunei", 11, "Asia/Kuching", 12 },
+		{ "Asia/Calcutta", 13, "Asia/Kolkata", 12 },
+		{ "Asia/Choibalsan", 15, "Asia/Ulaanbaatar", 16 },
+		{ "Asia/Chongqing", 14, "Asia/Shanghai", 13 },
+		{ "Asia/Chungking", 14, "Asia/Shanghai", 13 },
+		{ "Asia/Dacca", 10, "Asia/Dhaka", 10 },
+		{ "Asia/Harbin", 11, "Asia/Shanghai", 13 },
+		{ "Asia/Istanbul", 13, "Europe/Istanbul", 15 },
+		{ "Asia/Kashgar", 12, "Asia/Urumqi", 11 },
+		{ "Asia/Katmandu", 13, "Asia/Kathmandu", 14 },
+		{ "Asia/Kuala_Lumpur", 17, "Asia/Singapore", 14 },
+		{ "Asia/Kuwait", 11, "Asia/Riyadh", 11 },
+		{ "Asia/Macao", 10, "Asia/Macau", 10 },
+		{ "Asia/Muscat", 11, "Asia/Dubai", 10 },
+		{ "Asia/Phnom_Penh", 15, "Asia/Bangkok", 12 },
+		{ "Asia/Rangoon", 12, "Asia/Yangon", 11 },
+		{ "Asia/Saigon", 11, "Asia/Ho_Chi_Minh", 16 },
+		{ "Asia/Tel_Aviv", 13, "Asia/Jerusalem", 14 },
+		{ "Asia/Thimbu", 11, "Asia/Thimphu", 12 },
+		{ "Asia/Ujung_Pandang", 18, "Asia/Makassar", 13 },
+		{ "Asia/Ulan_Bator", 15, "Asia/Ulaanbaatar", 16 },
+		{ "Asia/Vientiane", 14, "Asia/Bangkok", 12 },
+		{ "Atlantic/Faeroe", 15, "Atlantic/Faroe", 14 },
+		{ "Atlantic/Jan_Mayen", 18, "Europe/Berlin", 13 },
+		{ "Atlantic/Reykjavik", 18, "Africa/Abidjan", 14 },
+		{ "Atlantic/St_Helena", 18, "Africa/Abidjan", 14 },
+		{ "Australia/ACT", 13, "Australia/Sydney", 16 },
+		{ "Australia/Canberra", 18, "Australia/Sydney", 16 },
+		{ "Australia/Currie", 16, "Australia/Hobart", 16 },
+		{ "Australia/LHI", 13, "Australia/Lord_Howe", 19 },
+		{ "Australia/NSW", 13, "Australia/Sydney", 16 },
+		{ "Australia/North", 15, "Australia/Darwin", 16 },
+		{ "Australia/Queensland", 20, "Australia/Brisbane", 18 },
+		{ "Australia/South", 15, "Australia/Adelaide", 18 },
+		{ "Australia/Tasmania", 18, "Australia/Hobart", 16 },
+		{ "Australia/Victoria", 18, "Australia/Melbourne", 19 },
+		{ "Australia/West", 14, "Australia/Perth", 15 },
+		{ "Australia/Yancowinna", 20, "Australia/Broken_Hill", 21 },
+		{ "Brazil/Acre", 11, "America/Rio_Branco", 18 },
+		{ "Brazil/DeNoronha", 16, "America/Noronha", 15 },
+		{ "Brazil/East", 11, "America/Sao_Paulo", 17 },
+		{ "Brazil/West", 11, "America/Manaus", 14 },
+		{ "CET", 3, "Europe/Brussels", 15 },
+		{ "CST6CDT", 7, "America/Chicago", 15 },
+		{ "Canada/Atlantic", 15, "America/Halifax", 15 },
+		{ "Canada/Central", 14, "America/Winnipeg", 16 },
+		{ "Canada/Eastern", 14, "America/Toronto", 15 },
+		{ "Canada/Mountain", 15, "America/Edmonton", 16 },
+		{ "Canada/Newfoundland", 19, "America/St_Johns", 16 },
+		{ "Canada/Pacific", 14, "America/Vancouver", 17 },
+		{ "Canada/Saskatchewan", 19, "America/Regina", 14 },
+		{ "Canada/Yukon", 12, "America/Whitehorse", 18 },
+		{ "Chile/Continental", 17, "America/Santiago", 16 },
+		{ "Chile/EasterIsland", 18, "Pacific/Easter", 14 },
+		{ "Cuba", 4, "America/Havana", 14 },
+		{ "EET", 3, "Europe/Athens", 13 },
+		{ "EST", 3, "America/Panama", 14 },
+		{ "EST5EDT", 7, "America/New_York", 16 },
+		{ "Egypt", 5, "Africa/Cairo", 12 },
+		{ "Eire", 4, "Europe/Dublin", 13 },
+		{ "Etc/GMT+0", 9, "Etc/GMT", 7 },
+		{ "Etc/GMT-0", 9, "Etc/GMT", 7 },
+		{ "Etc/GMT0", 8, "Etc/GMT", 7 },
+		{ "Etc/Greenwich", 13, "Etc/GMT", 7 },
+		{ "Etc/UCT", 7, "Etc/UTC", 7 },
+		{ "Etc/Universal", 13, "Etc/UTC", 7 },
+		{ "Etc/Zulu", 8, "Etc/UTC", 7 },
+		{ "Europe/Amsterdam", 16, "Europe/Brussels", 15 },
+		{ "Europe/Belfast", 14, "Europe/London", 13 },
+		{ "Europe/Bratislava", 17, "Europe/Prague", 13 },
+		{ "Europe/Busingen", 15, "Europe/Zurich", 13 },
+		{ "Europe/Copenhagen", 17, "Europe/Berlin", 13 },
+		{ "Europe/Guernsey", 15, "Europe/London", 13 },
+		{ "Europe/Isle_of_Man", 18, "Europe/London", 13 },
+		{ "Europe/Jersey", 13, "Europe/London", 13 },
+		{ "Europe/Kiev", 11, "Europe/Kyiv", 11 },
+		{ "Europe/Ljubljana", 16, "Europe/Belgrade", 15 },
+		{ "Europe/Luxembourg", 17, "Europe/Brussels", 15 },
+		{ "Europe/Mariehamn", 16, "Europe/Helsinki", 15 },
+		{ "Europe/Monaco", 13, "Europe/Paris", 12 },
+		{ "Europe/Nicosia", 14, "Asia/Nicosia", 12 },
+		{ "Europe/Oslo", 11, "Europe/Berlin", 13 },
+		{ "Europe/Podgorica", 16, "Europe/Belgrade", 15 },
+		{ "Europe/San_Marino", 17, "Europe/Rome", 11 },
+		{ "Europe/Sarajevo", 15, "Europe/Belgrade", 15 },
+		{ "Europe/Skopje", 13, "Europe/Belgrade", 15 },
+		{ "Europe/Stockholm", 16, "Europe/Berlin", 13 },
+		{ "Europe/Tiraspol", 15, "Europe/Chisinau", 15 },
+		{ "Europe/Uzhgorod", 15, "Europe/Kyiv", 11 },
+		{ "Europe/Vaduz", 12, "Europe/Zurich", 13 },
+		{ "Europe/Vatican", 14, "Europe/Rome", 11 },
+		{ "Europe/Zagreb", 13, "Europe/Belgrade", 15 },
+		{ "Europe/Zaporozhye", 17, "Europe/Kyiv", 11 },
+		{ "GB", 2, "Europe/London", 13 },
+		{ "GB-Eire", 7, "Europe/London", 13 },
+		{ "GMT", 3, "Etc/GMT", 7 },
+		{ "GMT+0", 5, "Etc/GMT", 7 },
+		{ "GMT-0", 5, "Etc/GMT", 7 },
+		{ "GMT0", 4, "Etc/GMT", 7 },
+		{ "Greenwich", 9, "Etc/GMT", 7 },
+		{ "HST", 3, "Pacific/Honolulu", 16 },
+		{ "Hongkong", 8, "Asia/Hong_Kong", 14 },
+		{ "Iceland", 7, "Africa/Abidjan", 14 },
+		{ "Indian/Antananarivo", 19, "Africa/Nairobi", 14 },
+		{ "Indian/Christmas", 16, "Asia/Bangkok", 12 },
+		{ "Indian/Cocos", 12, "Asia/Yangon", 11 },
+		{ "Indian/Comoro", 13, "Africa/Nairobi", 14 },
+		{ "Indian/Kerguelen", 16, "Indian/Maldives", 15 },
+		{ "Indian/Mahe", 11, "Asia/Dubai", 10 },
+		{ "Indian/Mayotte", 14, "Africa/Nairobi", 14 },
+		{ "Indian/Reunion", 14, "Asia/Dubai", 10 },
+		{ "Iran", 4, "Asia/Tehran", 11 },
+		{ "Israel", 6, "Asia/Jerusalem", 14 },
+		{ "Jamaica", 7, "America/Jamaica", 15 },
+		{ "Japan", 5, "Asia/Tokyo", 10 },
+		{ "Kwajalein", 9, "Pacific/Kwajalein", 17 },
+		{ "Libya", 5, "Africa/Tripoli", 14 },
+		{ "MET", 3, "Europe/Brussels", 15 },
+		{ "MST", 3, "America/Phoenix", 15 },
+		{ "MST7MDT", 7, "America/Denver", 14 },
+		{ "Mexico/BajaNorte", 16, "America/Tijuana", 15 },
+		{ "Mexico/BajaSur", 14, "America/Mazatlan", 16 },
+		{ "Mexico/General", 14, "America/Mexico_City", 19 },
+		{ "NZ", 2, "Pacific/Auckland", 16 },
+		{ "NZ-CHAT", 7, "Pacific/Chatham", 15 },
+		{ "Navajo", 6, "America/Denver", 14 },
+		{ "PRC", 3, "Asia/Shanghai", 13 },
+		{ "PST8PDT", 7, "America/Los_Angeles", 19 },
+		{ "Pacific/Chuuk", 13, "Pacific/Port_Moresby", 20 },
+		{ "Pacific/Enderbury", 17, "Pacific/Kanton", 14 },
+		{ "Pacific/Funafuti", 16, "Pacific/Tarawa", 14 },
+		{ "Pacific/Johnston", 16, "Pacific/Honolulu", 16 },
+		{ "Pacific/Majuro", 14, "Pacific/Tarawa", 14 },
+		{ "Pacific/Midway", 14, "Pacific/Pago_Pago", 17 },
+		{ "Pacific/Pohnpei", 15, "Pacific/Guadalcanal", 19 },
+		{ "Pacific/Ponape", 14, "Pacific/Guadalcanal", 19 },
+		{ "Pacific/Saipan", 14, "Pacific/Guam", 12 },
+		{ "Pacific/Samoa", 13, "Pacific/Pago_Pago", 17 },
+		{ "Pacific/Truk", 12, "Pacific/Port_Moresby", 20 },
+		{ "Pacific/Wake", 12, "Pacific/Tarawa", 14 },
+		{ "Pacific/Wallis", 14, "Pacific/Tarawa", 14 },
+		{ "Pacific/Yap", 11, "Pacific/Port_Moresby", 20 },
+		{ "Poland", 6, "Europe/Warsaw", 13 },
+		{ "Portugal", 8, "Europe/Lisbon", 13 },
+		{ "ROC", 3, "Asia/Taipei", 11 },
+		{ "ROK", 3, "Asia/Seoul", 10 },
+		{ "Singapore", 9, "Asia/Singapore", 14 },
+		{ "Turkey", 6, "Europe/Istanbul", 15 },
+		{ "UCT", 3, "Etc/UTC", 7 },
+		{ "US/Alaska", 9, "America/Anchorage", 17 },
+		{ "US/Aleutian", 11, "America/Adak", 12 },
+		{ "US/Arizona", 10, "America/Phoenix", 15 },
+		{ "US/Central", 10, "America/Chicago", 15 },
+		{ "US/East-Indiana", 15, "America/Indiana/Indianapolis", 28 },
+		{ "US/Eastern", 10, "America/New_York", 16 },
+		{ "US/Hawaii", 9, "Pacific/Honolulu", 16 },
+		{ "US/Indiana-Starke", 17, "America/Indiana/Knox", 20 },
+		{ "US/Michigan", 11, "America/Detroit", 15 },
+		{ "US/Mountain", 11, "America/Denver", 14 },
+		{ "US/Pacific", 10, "America/Los_Angeles", 19 },
+		{ "US/Samoa", 8, "Pacific/Pago_Pago", 17 },
+		{ "UTC", 3, "Etc/UTC", 7 },
+		{ "Universal", 9, "Etc/UTC", 7 },
+		{ "W-SU", 4, "Europe/Moscow", 13 },
+		{ "WET", 3, "Europe/Lisbon", 13 },
+		{ "Zulu", 4, "Etc/UTC", 7 },
+	};
+
+	static constexpr compiled_leap_second_t leap_seconds[] =
+	{
+		{ 78796800, 1 },
+		{ 94694400, 1 },
+		{ 126230400, 1 },
+		{ 157766400, 1 },
+		{ 189302400, 1 },
+		{ 220924800, 1 },
+		{ 252460800, 1 },
+		{ 283996800, 1 },
+		{ 315532800, 1 },
+		{ 362793600, 1 },
+		{ 394329600, 1 },
+		{ 425865600, 1 },
+		{ 489024000, 1 },
+		{ 567993600, 1 },
+		{ 631152000, 1 },
+		{ 662688000, 1 },
+		{ 709948800, 1 },
+		{ 741484800, 1 },
+		{ 773020800, 1 },
+		{ 820454400, 1 },
+		{ 867715200, 1 },
+		{ 915148800, 1 },
+		{ 1136073600, 1 },
+		{ 1230768000, 1 },
+		{ 1341100800, 1 },
+		{ 1435708800, 1 },
+		{ 1483228800, 1 },
+	};
+
+	static constexpr compiled_tzdb_t db =
+	{
+		"2025b",
+		zones,         341,
+		continuations, 1957,
+		rule_sets,     130,
+		rules,         2084,
+		links,         257,
+		leap_seconds,  27,
+	};
+
+	return db;
+}
+
+}	// namespace tz
+}	// namespace detail
+}	// namespace chrono
+}	// namespace hamon
+
+#endif // HAMON_CHRONO_DETAIL_COMPILED_TZDATA_HPP
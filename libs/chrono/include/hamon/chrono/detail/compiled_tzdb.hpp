@@ -0,0 +1,134 @@
+﻿/**
+ *	@file	compiled_tzdb.hpp
+ *
+ *	@brief	compiled_tzdb の定義
+ */
+
+#ifndef HAMON_CHRONO_DETAIL_COMPILED_TZDB_HPP
+#define HAMON_CHRONO_DETAIL_COMPILED_TZDB_HPP
+
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/cstdint/int16_t.hpp>
+#include <hamon/cstdint/int32_t.hpp>
+#include <hamon/cstdint/int64_t.hpp>
+#include <hamon/cstdint/uint8_t.hpp>
+#include <hamon/cstdint/uint16_t.hpp>
+
+namespace hamon {
+namespace chrono {
+namespace detail {
+namespace tz
+{
+
+// tzdata をビルド時に変換した静的な表。
+// tools/make_compiled_tzdata.cpp が tzdata.zi と leap-seconds.list から
+// compiled_tzdata.hpp を生成する。
+// 実行時に文字列を解析したり、ソートしたりせずに tzdb を作るために使う。
+//
+// どの構造体も集成体で、定数式で初期化できる。
+// 時間は全て秒単位で、年は chrono::year の値をそのまま持つ。
+
+// on_t を表す
+//  m_kind が day               なら m_day 日
+//  m_kind が last_weekday      なら最後の m_weekday 曜日
+//  m_kind が weekday_ge        なら m_day 日以降で最初の m_weekday 曜日
+//  m_kind が weekday_le        なら m_day 日以前で最後の m_weekday 曜日
+struct compiled_on_t
+{
+	enum kind_t : hamon::uint8_t { day, last_weekday, weekday_ge, weekday_le };
+
+	kind_t         m_kind;
+	hamon::uint8_t m_weekday;	// chrono::weekday::c_encoding()
+	hamon::uint8_t m_day;
+};
+
+// until や at の時計の種類は tz::clock_t の値
+struct compiled_rule_t
+{
+	hamon::int16_t  m_from;
+	hamon::int16_t  m_to;
+	hamon::uint8_t  m_in;
+	compiled_on_t   m_on;
+	hamon::int32_t  m_at;
+	hamon::uint8_t  m_at_clock;
+	bool            m_is_dst;
+	hamon::int32_t  m_save;
+	char const*     m_letters;
+};
+
+// 同じ名前の規則は compiled_tzdb_t::m_rules の [m_first, m_first + m_count) に並んでいる
+struct compiled_rule_set_t
+{
+	char const*     m_name;
+	hamon::uint16_t m_first;
+	hamon::uint16_t m_count;
+};
+
+struct compiled_continuation_t
+{
+	// RULES の種類
+	//  none  : 常に標準時 ("-")
+	//  save  : SAVE が固定されている (m_save, m_is_dst)
+	//  named : 規則の名前 (compiled_tzdb_t::m_rule_sets[m_rule_set])
+	enum rules_kind_t : hamon::uint8_t { none, save, named };
+
+	hamon::int32_t  m_stdoff;
+	rules_kind_t    m_rules_kind;
+	bool            m_is_dst;
+	hamon::uint16_t m_rule_set;
+	hamon::int32_t  m_save;
+	char const*     m_format;
+	hamon::int16_t  m_year;
+	hamon::uint8_t  m_in;
+	compiled_on_t   m_on;
+	hamon::int32_t  m_at;
+	hamon::uint8_t  m_at_clock;
+};
+
+// continuation は compiled_tzdb_t::m_continuations の [m_first, m_first + m_count) に並んでいる
+struct compiled_zone_t
+{
+	char const*     m_name;
+	hamon::size_t   m_name_length;
+	hamon::uint16_t m_first;
+	hamon::uint16_t m_count;
+};
+
+struct compiled_link_t
+{
+	char const*     m_name;
+	hamon::size_t   m_name_length;
+	char const*     m_target;
+	hamon::size_t   m_target_length;
+};
+
+struct compiled_leap_second_t
+{
+	hamon::int64_t  m_date;		// sys_seconds
+	hamon::int32_t  m_value;
+};
+
+// zones, links, rule_sets は名前順にソートされている
+struct compiled_tzdb_t
+{
+	char const*                     m_version;
+	compiled_zone_t const*          m_zones;
+	hamon::size_t                   m_zones_size;
+	compiled_continuation_t const*  m_continuations;
+	hamon::size_t                   m_continuations_size;
+	compiled_rule_set_t const*      m_rule_sets;
+	hamon::size_t                   m_rule_sets_size;
+	compiled_rule_t const*          m_rules;
+	hamon::size_t                   m_rules_size;
+	compiled_link_t const*          m_links;
+	hamon::size_t                   m_links_size;
+	compiled_leap_second_t const*   m_leap_seconds;
+	hamon::size_t                   m_leap_seconds_size;
+};
+
+}	// namespace tz
+}	// namespace detail
+}	// namespace chrono
+}	// namespace hamon
+
+#endif // HAMON_CHRONO_DETAIL_COMPILED_TZDB_HPP
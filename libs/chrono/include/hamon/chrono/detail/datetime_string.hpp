@@ -0,0 +1,79 @@
+﻿/**
+ *	@file	datetime_string.hpp
+ *
+ *	@brief	datetime_string の定義
+ */
+
+#ifndef HAMON_CHRONO_DETAIL_DATETIME_STRING_HPP
+#define HAMON_CHRONO_DETAIL_DATETIME_STRING_HPP
+
+#include <hamon/chrono/sys_days.hpp>
+#include <hamon/chrono/year_month_day.hpp>
+#include <hamon/chrono/duration.hpp>
+#include <hamon/chrono/duration/floor.hpp>
+#include <hamon/chrono/time_point.hpp>
+#include <hamon/string.hpp>
+
+namespace hamon {
+namespace chrono {
+namespace detail {
+
+inline void
+append_digits(hamon::string& s, long long v, int width)
+{
+	char buf[20];
+	int n = 0;
+	do
+	{
+		buf[n++] = static_cast<char>('0' + v % 10);
+		v /= 10;
+	}
+	while (v != 0 || n < width);
+
+	while (n > 0)
+	{
+		s.push_back(buf[--n]);
+	}
+}
+
+// エポックからの時間 t を "YYYY-MM-DD hh:mm:ss" の形式の文字列にする
+inline hamon::string
+datetime_string(chrono::seconds t)
+{
+	auto const d = chrono::floor<chrono::days>(t);
+	chrono::year_month_day const ymd{chrono::sys_days{d}};
+	auto const s = (t - d).count();
+
+	hamon::string result;
+	int y = static_cast<int>(ymd.year());
+	if (y < 0)
+	{
+		result.push_back('-');
+		y = -y;
+	}
+	detail::append_digits(result, y, 4);
+	result.push_back('-');
+	detail::append_digits(result, static_cast<unsigned>(ymd.month()), 2);
+	result.push_back('-');
+	detail::append_digits(result, static_cast<unsigned>(ymd.day()), 2);
+	result.push_back(' ');
+	detail::append_digits(result, s / 3600, 2);
+	result.push_back(':');
+	detail::append_digits(result, s / 60 % 60, 2);
+	result.push_back(':');
+	detail::append_digits(result, s % 60, 2);
+	return result;
+}
+
+template <typename Clock, typename Duration>
+inline hamon::string
+datetime_string(chrono::time_point<Clock, Duration> const& tp)
+{
+	return detail::datetime_string(chrono::floor<chrono::seconds>(tp.time_since_epoch()));
+}
+
+}	// namespace detail
+}	// namespace chrono
+}	// namespace hamon
+
+#endif // HAMON_CHRONO_DETAIL_DATETIME_STRING_HPP
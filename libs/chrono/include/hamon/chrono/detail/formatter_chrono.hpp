@@ -0,0 +1,237 @@
+﻿/**
+ *	@file	formatter_chrono.hpp
+ *
+ *	@brief	formatter_chrono の定義
+ */
+
+#ifndef HAMON_CHRONO_DETAIL_FORMATTER_CHRONO_HPP
+#define HAMON_CHRONO_DETAIL_FORMATTER_CHRONO_HPP
+
+#include <hamon/chrono/detail/chrono_format_value.hpp>
+#include <hamon/chrono/detail/chrono_format_write.hpp>
+#include <hamon/format/basic_format_parse_context.hpp>
+#include <hamon/format/format_error.hpp>
+#include <hamon/format/detail/format_buffer.hpp>
+#include <hamon/format/detail/format_write_padded_by.hpp>
+#include <hamon/format/detail/std_format_spec.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon {
+namespace chrono {
+namespace detail {
+
+// 30.12 Formatting[time.format]/6
+// 変換指定子 c (修飾子 modifier 付き) を、項目 fields を持つ型に使えるかどうかを調べる
+template <typename CharT>
+inline HAMON_CXX14_CONSTEXPR void
+chrono_check_conversion(CharT modifier, CharT c, unsigned fields)
+{
+	using F = chrono_format_fields;
+
+	if (modifier == CharT('E'))
+	{
+		switch (c)
+		{
+		case CharT('c'): case CharT('C'): case CharT('x'): case CharT('X'):
+		case CharT('y'): case CharT('Y'): case CharT('z'):
+			break;
+		default:
+			hamon::detail::throw_format_error("invalid use of the 'E' modifier in chrono-specs");
+		}
+	}
+	else if (modifier == CharT('O'))
+	{
+		switch (c)
+		{
+		case CharT('d'): case CharT('e'): case CharT('H'): case CharT('I'):
+		case CharT('m'): case CharT('M'): case CharT('S'): case CharT('u'):
+		case CharT('U'): case CharT('V'): case CharT('w'): case CharT('W'):
+		case CharT('y'): case CharT('z'):
+			break;
+		default:
+			hamon::detail::throw_format_error("invalid use of the 'O' modifier in chrono-specs");
+		}
+	}
+
+	unsigned required = 0;
+	switch (c)
+	{
+	case CharT('%'): case CharT('n'): case CharT('t'):
+		break;
+
+	case CharT('C'): case CharT('y'): case CharT('Y'):
+		required = F::year;
+		break;
+
+	case CharT('b'): case CharT('B'): case CharT('h'): case CharT('m'):
+		required = F::month;
+		break;
+
+	case CharT('d'): case CharT('e'):
+		required = F::day;
+		break;
+
+	case CharT('a'): case CharT('A'): case CharT('u'): case CharT('w'):
+		required = F::weekday;
+		break;
+
+	case CharT('j'):
+		// duration では日数
+		required = (fields & F::duration) ? F::duration : F::date;
+		break;
+
+	case CharT('D'): case CharT('F'): case CharT('x'):
+		required = F::year | F::month | F::day;
+		break;
+
+	case CharT('g'): case CharT('G'): case CharT('U'): case CharT('V'): case CharT('W'):
+		required = F::date;
+		break;
+
+	case CharT('H'): case CharT('I'): case CharT('M'): case CharT('S'):
+	case CharT('p'): case CharT('r'): case CharT('R'): case CharT('T'): case CharT('X'):
+		required = F::time;
+		break;
+
+	case CharT('c'):
+		required = F::date | F::time;
+		break;
+
+	case CharT('z'):
+		required = F::offset;
+		break;
+
+	case CharT('Z'):
+		required = F::zone;
+		break;
+
+	case CharT('q'): case CharT('Q'):
+		required = F::duration;
+		break;
+
+	default:
+		hamon::detail::throw_format_error("invalid conversion specifier in chrono-specs");
+	}
+
+	if ((fields & required) != required)
+	{
+		hamon::detail::throw_format_error("the conversion specifier in chrono-specs needs a field the type does not have");
+	}
+}
+
+/**
+ *	@brief	chrono の型の formatter の共通部分
+ *
+ *	chrono-format-spec:
+ *		fill-and-align(opt) width(opt) precision(opt) L(opt) chrono-specs(opt)
+ *
+ *	chrono-specs はフォーマット文字列の中を指しておく。
+ *	(フォーマット文字列は format 関数の呼び出しが終わるまで生存している)
+ */
+template <typename CharT>
+class formatter_chrono
+{
+protected:
+	HAMON_CXX14_CONSTEXPR typename hamon::basic_format_parse_context<CharT>::iterator
+	parse_chrono(hamon::basic_format_parse_context<CharT>& pc, unsigned fields, bool allow_precision)
+	{
+		using hamon::detail::format_spec_fields;
+		auto first = hamon::detail::parse_std_format_spec(pc, m_spec,
+			format_spec_fields::fill_align |
+			format_spec_fields::width |
+			format_spec_fields::precision |
+			format_spec_fields::locale);
+		auto const last = pc.end();
+
+		if (m_spec.m_has_precision && !allow_precision)
+		{
+			hamon::detail::throw_format_error("precision is only allowed for a duration with a floating-point representation");
+		}
+
+		if (first == last || *first == CharT('}'))
+		{
+			return first;
+		}
+
+		if (*first != CharT('%'))
+		{
+			hamon::detail::throw_format_error("chrono-specs must start with a conversion specifier");
+		}
+
+		auto const specs_first = first;
+		while (first != last && *first != CharT('}'))
+		{
+			if (*first == CharT('{'))
+			{
+				hamon::detail::throw_format_error("'{' is not allowed in chrono-specs");
+			}
+
+			if (*first == CharT('%'))
+			{
+				++first;
+				CharT modifier = CharT();
+				if (first != last && (*first == CharT('E') || *first == CharT('O')))
+				{
+					modifier = *first;
+					++first;
+				}
+				if (first == last)
+				{
+					hamon::detail::throw_format_error("missing conversion specifier after '%' in chrono-specs");
+				}
+				detail::chrono_check_conversion(modifier, *first, fields);
+			}
+			++first;
+		}
+
+		m_chrono_specs = &*specs_first;
+		m_chrono_specs_size = static_cast<hamon::size_t>(first - specs_first);
+		return first;
+	}
+
+	template <typename Rep, typename FormatContext>
+	typename FormatContext::iterator
+	format_chrono(chrono_format_value<Rep> const& value, FormatContext& ctx) const
+	{
+		auto const spec = hamon::detail::resolve_std_format_spec(m_spec, ctx);
+		if (spec.m_width == 0)
+		{
+			return this->write(ctx.out(), value, spec);
+		}
+
+		// 表示幅は文字列を作らずに数える
+		using iterator = hamon::detail::format_buffer_iterator<CharT>;
+		return hamon::detail::format_write_padded_by(ctx.out(), spec, hamon::detail::format_align::left, true,
+			[&](iterator out)
+			{
+				return this->write(out, value, spec);
+			});
+	}
+
+private:
+	template <typename Out, typename Rep>
+	Out write(Out out, chrono_format_value<Rep> const& value, hamon::detail::std_format_spec<CharT> const& spec) const
+	{
+		chrono_format_writer<CharT, Out, Rep> writer(out, value, spec);
+		if (m_chrono_specs_size == 0)
+		{
+			writer.write_default();
+		}
+		else
+		{
+			writer.write_specs(m_chrono_specs, m_chrono_specs + m_chrono_specs_size);
+		}
+		return writer.out();
+	}
+
+	hamon::detail::std_format_spec<CharT> m_spec{};
+	CharT const*                          m_chrono_specs = nullptr;
+	hamon::size_t                         m_chrono_specs_size = 0;
+};
+
+}	// namespace detail
+}	// namespace chrono
+}	// namespace hamon
+
+#endif // HAMON_CHRONO_DETAIL_FORMATTER_CHRONO_HPP
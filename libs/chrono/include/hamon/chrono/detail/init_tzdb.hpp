@@ -7,45 +7,47 @@
 #ifndef HAMON_CHRONO_DETAIL_INIT_TZDB_HPP
 #define HAMON_CHRONO_DETAIL_INIT_TZDB_HPP
 
-#include <hamon/chrono/detail/tz.hpp>
-#include <hamon/chrono/detail/parse_tzdata.hpp>
-#include <hamon/chrono/detail/parse_leap_seconds.hpp>
+#include <hamon/chrono/detail/compiled_tzdata.hpp>
+#include <hamon/chrono/detail/private_ctor_tag.hpp>
 #include <hamon/chrono/tzdb.hpp>
-#include <hamon/algorithm/ranges/sort.hpp>
-#include <sstream>
+#include <hamon/chrono/duration.hpp>
+#include <hamon/chrono/sys_seconds.hpp>
+#include <hamon/cstddef/size_t.hpp>
 
 namespace hamon {
 namespace chrono {
 namespace detail {
 
-HAMON_WARNING_PUSH()
-HAMON_WARNING_DISABLE_CLANG("-Woverlength-strings")
-
-inline void init_tzdb(hamon::chrono::tzdb& tzdb, tz::rules_storage_type& rules)
+// 組み込みの tzdata から tzdb を作る。
+// 表はビルド時にソート済みなので、ここではテキストの解析もソートも行わない。
+// zone と link は表の文字列を参照するだけで、continuation と規則は zone ごとに最初に必要になったときに作る。
+inline void init_tzdb(hamon::chrono::tzdb& tzdb)
 {
-	{
-		const char* s =
-#include <hamon/chrono/detail/tzdata.zi>
-		;
-		std::istringstream tzdata(s);
+	auto const& db = tz::compiled_tzdata();
 
-		parse_tzdata(tzdb, rules, tzdata);
+	tzdb.version = db.m_version;
+
+	tzdb.zones.reserve(db.m_zones_size);
+	for (hamon::size_t i = 0; i < db.m_zones_size; ++i)
+	{
+		tzdb.zones.emplace_back(hamon::chrono::detail::private_ctor_tag{}, db, db.m_zones[i]);
+	}
 
-		hamon::ranges::sort(tzdb.zones);
-		hamon::ranges::sort(tzdb.links);
-		hamon::ranges::sort(rules, {}, [](tz::rules_storage_type::const_reference p) { return p.first; });
+	tzdb.links.reserve(db.m_links_size);
+	for (hamon::size_t i = 0; i < db.m_links_size; ++i)
+	{
+		tzdb.links.emplace_back(hamon::chrono::detail::private_ctor_tag{}, db.m_links[i]);
 	}
+
+	tzdb.leap_seconds.reserve(db.m_leap_seconds_size);
+	for (hamon::size_t i = 0; i < db.m_leap_seconds_size; ++i)
 	{
-		const char* s =
-#include <hamon/chrono/detail/leap-seconds.list>
-		;
-		std::istringstream leap_seconds_data(s);
-		parse_leap_seconds(tzdb.leap_seconds, leap_seconds_data);
+		tzdb.leap_seconds.emplace_back(hamon::chrono::detail::private_ctor_tag{},
+			chrono::sys_seconds{ chrono::seconds{ db.m_leap_seconds[i].m_date } },
+			chrono::seconds{ db.m_leap_seconds[i].m_value });
 	}
 }
 
-HAMON_WARNING_POP()
-
 }	// namespace detail
 }	// namespace chrono
 }	// namespace hamon
@@ -0,0 +1,160 @@
+﻿/**
+ *	@file	leap_second_table.hpp
+ *
+ *	@brief	leap_second_table の定義
+ */
+
+#ifndef HAMON_CHRONO_DETAIL_LEAP_SECOND_TABLE_HPP
+#define HAMON_CHRONO_DETAIL_LEAP_SECOND_TABLE_HPP
+
+#include <hamon/chrono/leap_second.hpp>
+#include <hamon/chrono/get_tzdb.hpp>
+#include <hamon/chrono/duration.hpp>
+#include <hamon/chrono/sys_seconds.hpp>
+#include <hamon/chrono/sys_time.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/vector.hpp>
+
+namespace hamon {
+namespace chrono {
+namespace detail {
+
+/**
+ *	@brief	閏秒の累積値の表
+ *
+ *	tzdb::leap_seconds を先頭から足し合わせる代わりに、各閏秒より前の閏秒の合計を持っておき、二分探索で求める。
+ *	ほとんどの時刻は最後の閏秒より後なので、最初に最後の閏秒と比べる。
+ *	連続した時刻を変換するときは、前回の位置 (hint) から調べる。
+ */
+class leap_second_table
+{
+public:
+	explicit leap_second_table(hamon::vector<chrono::leap_second> const& leap_seconds)
+		: m_total{0}
+	{
+		m_entries.reserve(leap_seconds.size());
+		for (auto const& ls : leap_seconds)
+		{
+			m_entries.push_back({ ls.date(), ls.date() + m_total, m_total, ls.value() });
+			m_total += ls.value();
+		}
+	}
+
+	hamon::size_t size() const HAMON_NOEXCEPT
+	{
+		return m_entries.size();
+	}
+
+	// 最初の i 個の閏秒の合計
+	chrono::seconds elapsed(hamon::size_t i) const HAMON_NOEXCEPT
+	{
+		return i < m_entries.size() ? m_entries[i].m_elapsed : m_total;
+	}
+
+	// t より後に挿入される最初の閏秒の位置 (t 以前に挿入された閏秒の数)
+	template <typename Duration>
+	hamon::size_t sys_index(chrono::sys_time<Duration> const& t, hamon::size_t hint = 0) const
+	{
+		// 比較は utc_clock::from_sys と同じく、leap_second と t の共通の型で行う
+		hamon::size_t const n = m_entries.size();
+		if (n == 0 || !(t < m_entries[n - 1].m_date))
+		{
+			return n;
+		}
+
+		if ((hint == 0 || !(t < m_entries[hint - 1].m_date)) &&
+			(hint < n && t < m_entries[hint].m_date))
+		{
+			return hint;
+		}
+
+		hamon::size_t lo = 0;
+		hamon::size_t hi = n - 1;
+		while (lo < hi)
+		{
+			hamon::size_t const mid = lo + (hi - lo) / 2;
+			if (t < m_entries[mid].m_date)
+			{
+				hi = mid;
+			}
+			else
+			{
+				lo = mid + 1;
+			}
+		}
+		return lo;
+	}
+
+	// utc 時刻 ut (1970-01-01 からの秒数を sys_seconds で表したもの) 以降で最初の閏秒の位置
+	hamon::size_t utc_index(chrono::sys_seconds ut, hamon::size_t hint = 0) const HAMON_NOEXCEPT
+	{
+		hamon::size_t const n = m_entries.size();
+		if (n == 0 || ut > m_entries[n - 1].m_utc_date)
+		{
+			return n;
+		}
+
+		if ((hint == 0 || ut > m_entries[hint - 1].m_utc_date) &&
+			(hint < n && ut <= m_entries[hint].m_utc_date))
+		{
+			return hint;
+		}
+
+		hamon::size_t lo = 0;
+		hamon::size_t hi = n - 1;
+		while (lo < hi)
+		{
+			hamon::size_t const mid = lo + (hi - lo) / 2;
+			if (ut <= m_entries[mid].m_utc_date)
+			{
+				hi = mid;
+			}
+			else
+			{
+				lo = mid + 1;
+			}
+		}
+		return lo;
+	}
+
+	// utc_index が返した位置 i について、ut が i 番目の閏秒そのものかどうか
+	bool is_at(hamon::size_t i, chrono::sys_seconds ut) const HAMON_NOEXCEPT
+	{
+		return i < m_entries.size() && m_entries[i].m_utc_date == ut;
+	}
+
+	chrono::seconds value(hamon::size_t i) const HAMON_NOEXCEPT
+	{
+		return m_entries[i].m_value;
+	}
+
+private:
+	struct entry_t
+	{
+		chrono::sys_seconds m_date;			// 閏秒が挿入される時刻
+		chrono::sys_seconds m_utc_date;		// その utc 時刻
+		chrono::seconds     m_elapsed;		// この閏秒より前の閏秒の合計
+		chrono::seconds     m_value;
+	};
+
+	hamon::vector<entry_t> m_entries;
+	chrono::seconds        m_total;
+};
+
+/**
+ *	@brief	get_tzdb() の閏秒から作った表を返す
+ *
+ *	get_tzdb() は呼び出すたびに tzdb_list のロックを取るので、最初に作った表を使い続ける。
+ *	(tzdb_list の先頭を置き換える reload_tzdb はまだ実装していない)
+ */
+inline leap_second_table const& get_leap_second_table()
+{
+	static leap_second_table const table(chrono::get_tzdb().leap_seconds);
+	return table;
+}
+
+}	// namespace detail
+}	// namespace chrono
+}	// namespace hamon
+
+#endif // HAMON_CHRONO_DETAIL_LEAP_SECOND_TABLE_HPP
@@ -0,0 +1,139 @@
+﻿/**
+ *	@file	load_compiled_zone.hpp
+ *
+ *	@brief	load_compiled_zone の定義
+ */
+
+#ifndef HAMON_CHRONO_DETAIL_LOAD_COMPILED_ZONE_HPP
+#define HAMON_CHRONO_DETAIL_LOAD_COMPILED_ZONE_HPP
+
+#include <hamon/chrono/detail/compiled_tzdb.hpp>
+#include <hamon/chrono/detail/tz.hpp>
+#include <hamon/chrono/day.hpp>
+#include <hamon/chrono/duration.hpp>
+#include <hamon/chrono/month.hpp>
+#include <hamon/chrono/weekday.hpp>
+#include <hamon/chrono/year.hpp>
+#include <hamon/algorithm/ranges/sort.hpp>
+#include <hamon/algorithm/ranges/unique.hpp>
+#include <hamon/cstdint/uint16_t.hpp>
+#include <hamon/memory/addressof.hpp>
+#include <hamon/string.hpp>
+#include <hamon/utility/move.hpp>
+#include <hamon/vector.hpp>
+
+namespace hamon {
+namespace chrono {
+namespace detail {
+namespace tz
+{
+
+inline tz::on_t
+to_on(tz::compiled_on_t const& on)
+{
+	switch (on.m_kind)
+	{
+	case tz::compiled_on_t::last_weekday:
+		return chrono::weekday_last{ chrono::weekday{ on.m_weekday } };
+
+	case tz::compiled_on_t::weekday_ge:
+	case tz::compiled_on_t::weekday_le:
+		return tz::constrained_weekday_t{
+			chrono::weekday{ on.m_weekday },
+			on.m_kind == tz::compiled_on_t::weekday_ge ?
+				tz::constrained_weekday_t::ge : tz::constrained_weekday_t::le,
+			chrono::day{ on.m_day } };
+
+	default:
+		return chrono::day{ on.m_day };
+	}
+}
+
+inline tz::rule_t
+to_rule(tz::compiled_rule_t const& r)
+{
+	tz::rule_t result;
+	result.m_from    = chrono::year{ r.m_from };
+	result.m_to      = chrono::year{ r.m_to };
+	result.m_in      = chrono::month{ r.m_in };
+	result.m_on      = tz::to_on(r.m_on);
+	result.m_at      = tz::at_t{ chrono::seconds{ r.m_at }, static_cast<tz::clock_t>(r.m_at_clock) };
+	result.m_save    = tz::save_t{ chrono::seconds{ r.m_save }, r.m_is_dst };
+	result.m_letters = r.m_letters;
+	return result;
+}
+
+/**
+ *	@brief	静的な表の zone から、continuation と、それが参照する規則を作る
+ *
+ *	rules には zone が参照する規則だけを、名前順に追加する。
+ *	continuation の m_rule_database は rules を指すので、rules は continuations より長く生存させること。
+ */
+inline void
+load_compiled_zone(
+	tz::compiled_tzdb_t const& db,
+	tz::compiled_zone_t const& zone,
+	hamon::vector<tz::continuation_t>& continuations,
+	tz::rules_storage_type& rules)
+{
+	// rule_sets は名前順に並んでいるので、添字の順に追加すればソート済みになる
+	hamon::vector<hamon::uint16_t> rule_sets;
+	for (hamon::uint16_t i = 0; i < zone.m_count; ++i)
+	{
+		auto const& c = db.m_continuations[zone.m_first + i];
+		if (c.m_rules_kind == tz::compiled_continuation_t::named)
+		{
+			rule_sets.push_back(c.m_rule_set);
+		}
+	}
+	hamon::ranges::sort(rule_sets);
+	rule_sets.erase(hamon::ranges::unique(rule_sets).begin(), rule_sets.end());
+
+	rules.reserve(rule_sets.size());
+	for (auto const i : rule_sets)
+	{
+		auto const& rs = db.m_rule_sets[i];
+		hamon::vector<tz::rule_t> v;
+		v.reserve(rs.m_count);
+		for (hamon::uint16_t j = 0; j < rs.m_count; ++j)
+		{
+			v.push_back(tz::to_rule(db.m_rules[rs.m_first + j]));
+		}
+		rules.emplace_back(hamon::string{ rs.m_name }, hamon::move(v));
+	}
+
+	continuations.reserve(zone.m_count);
+	for (hamon::uint16_t i = 0; i < zone.m_count; ++i)
+	{
+		auto const& c = db.m_continuations[zone.m_first + i];
+		tz::continuation_t result;
+		result.m_rule_database = hamon::addressof(rules);
+		result.m_stdoff = chrono::seconds{ c.m_stdoff };
+		switch (c.m_rules_kind)
+		{
+		case tz::compiled_continuation_t::save:
+			result.m_rules = tz::save_t{ chrono::seconds{ c.m_save }, c.m_is_dst };
+			break;
+
+		case tz::compiled_continuation_t::named:
+			result.m_rules = hamon::string{ db.m_rule_sets[c.m_rule_set].m_name };
+			break;
+
+		default:
+			break;
+		}
+		result.m_format = c.m_format;
+		result.m_year = chrono::year{ c.m_year };
+		result.m_in = chrono::month{ c.m_in };
+		result.m_on = tz::to_on(c.m_on);
+		result.m_at = tz::at_t{ chrono::seconds{ c.m_at }, static_cast<tz::clock_t>(c.m_at_clock) };
+		continuations.push_back(hamon::move(result));
+	}
+}
+
+}	// namespace tz
+}	// namespace detail
+}	// namespace chrono
+}	// namespace hamon
+
+#endif // HAMON_CHRONO_DETAIL_LOAD_COMPILED_ZONE_HPP
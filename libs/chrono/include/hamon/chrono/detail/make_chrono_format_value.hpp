@@ -0,0 +1,85 @@
+﻿/**
+ *	@file	make_chrono_format_value.hpp
+ *
+ *	@brief	make_chrono_format_value の定義
+ */
+
+#ifndef HAMON_CHRONO_DETAIL_MAKE_CHRONO_FORMAT_VALUE_HPP
+#define HAMON_CHRONO_DETAIL_MAKE_CHRONO_FORMAT_VALUE_HPP
+
+#include <hamon/chrono/detail/chrono_format_value.hpp>
+#include <hamon/chrono/day.hpp>
+#include <hamon/chrono/duration.hpp>
+#include <hamon/chrono/hh_mm_ss.hpp>
+#include <hamon/chrono/month.hpp>
+#include <hamon/chrono/sys_days.hpp>
+#include <hamon/chrono/sys_time.hpp>
+#include <hamon/chrono/time_point/floor.hpp>
+#include <hamon/chrono/weekday.hpp>
+#include <hamon/chrono/year.hpp>
+#include <hamon/chrono/year_month_day.hpp>
+#include <hamon/cstdint/uint64_t.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon {
+namespace chrono {
+namespace detail {
+
+template <typename Rep>
+inline void
+chrono_format_set_date(chrono_format_value<Rep>& v, chrono::year_month_day const& ymd)
+{
+	v.m_year    = static_cast<int>(ymd.year());
+	v.m_month   = static_cast<unsigned>(ymd.month());
+	v.m_day     = static_cast<unsigned>(ymd.day());
+	v.m_weekday = chrono::weekday{chrono::sys_days{ymd}}.c_encoding();
+	v.m_ok      = ymd.ok();
+}
+
+template <typename Rep, typename Duration>
+inline void
+chrono_format_set_time(chrono_format_value<Rep>& v, chrono::hh_mm_ss<Duration> const& hms)
+{
+	v.m_is_negative      = hms.is_negative();
+	v.m_hours            = static_cast<hamon::uint64_t>(hms.hours().count());
+	v.m_minutes          = static_cast<unsigned>(hms.minutes().count());
+	v.m_seconds          = static_cast<unsigned>(hms.seconds().count());
+	v.m_subseconds       = static_cast<hamon::uint64_t>(hms.subseconds().count());
+	v.m_fractional_width = chrono::hh_mm_ss<Duration>::fractional_width;
+}
+
+// time_point を日付と時刻に分ける
+template <typename Rep, typename Duration>
+inline void
+chrono_format_set_time_point(chrono_format_value<Rep>& v, chrono::sys_time<Duration> const& tp)
+{
+	auto const dp = chrono::floor<chrono::days>(tp);
+	detail::chrono_format_set_date(v, chrono::year_month_day{dp});
+	detail::chrono_format_set_time(v, chrono::hh_mm_ss<decltype(tp - dp)>{tp - dp});
+}
+
+template <typename Rep, typename Period>
+inline chrono_format_value<Rep>
+make_chrono_format_value(chrono::duration<Rep, Period> const& d)
+{
+	using F = chrono_format_fields;
+	chrono_format_value<Rep> v;
+	v.m_fields  = F::time | F::duration;
+	v.m_default = chrono_default_format::duration;
+	v.m_count   = d.count();
+	v.m_num     = Period::num;
+	v.m_den     = Period::den;
+
+	// %H は 24 時間に収め、日数は %j で書く
+	chrono::hh_mm_ss<chrono::duration<Rep, Period>> const hms{d};
+	detail::chrono_format_set_time(v, hms);
+	v.m_days  = v.m_hours / 24;
+	v.m_hours = v.m_hours % 24;
+	return v;
+}
+
+}	// namespace detail
+}	// namespace chrono
+}	// namespace hamon
+
+#endif // HAMON_CHRONO_DETAIL_MAKE_CHRONO_FORMAT_VALUE_HPP
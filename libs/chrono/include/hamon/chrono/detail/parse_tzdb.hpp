@@ -0,0 +1,44 @@
+﻿/**
+ *	@file	parse_tzdb.hpp
+ *
+ *	@brief	parse_tzdb の定義
+ */
+
+#ifndef HAMON_CHRONO_DETAIL_PARSE_TZDB_HPP
+#define HAMON_CHRONO_DETAIL_PARSE_TZDB_HPP
+
+#include <hamon/chrono/detail/tz.hpp>
+#include <hamon/chrono/detail/parse_tzdata.hpp>
+#include <hamon/chrono/detail/parse_leap_seconds.hpp>
+#include <hamon/chrono/tzdb.hpp>
+#include <hamon/algorithm/ranges/sort.hpp>
+#include <istream>
+
+namespace hamon {
+namespace chrono {
+namespace detail {
+
+/**
+ *	@brief	tzdata.zi 形式と leap-seconds.list 形式のテキストから tzdb を作る
+ *
+ *	組み込みのデータは init_tzdb が静的な表から作るので、
+ *	これは実行時に新しい tzdata を読み込むときに使う。
+ *	zone が参照する規則は rules に格納されるので、rules は tzdb より長く生存させること。
+ */
+inline void parse_tzdb(hamon::chrono::tzdb& tzdb, tz::rules_storage_type& rules,
+	std::istream& tzdata, std::istream& leap_seconds)
+{
+	parse_tzdata(tzdb, rules, tzdata);
+
+	hamon::ranges::sort(tzdb.zones);
+	hamon::ranges::sort(tzdb.links);
+	hamon::ranges::sort(rules, {}, [](tz::rules_storage_type::const_reference p) { return p.first; });
+
+	parse_leap_seconds(tzdb.leap_seconds, leap_seconds);
+}
+
+}	// namespace detail
+}	// namespace chrono
+}	// namespace hamon
+
+#endif // HAMON_CHRONO_DETAIL_PARSE_TZDB_HPP
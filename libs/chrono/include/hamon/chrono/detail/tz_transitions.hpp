@@ -0,0 +1,754 @@
+﻿/**
+ *	@file	tz_transitions.hpp
+ *
+ *	@brief	time_zone の遷移表の定義
+ */
+
+#ifndef HAMON_CHRONO_DETAIL_TZ_TRANSITIONS_HPP
+#define HAMON_CHRONO_DETAIL_TZ_TRANSITIONS_HPP
+
+#include <hamon/chrono/detail/tz.hpp>
+#include <hamon/chrono/local_info.hpp>
+#include <hamon/chrono/sys_info.hpp>
+#include <hamon/chrono/sys_seconds.hpp>
+#include <hamon/chrono/sys_days.hpp>
+#include <hamon/chrono/year_month_day.hpp>
+#include <hamon/chrono/year_month_weekday.hpp>
+#include <hamon/chrono/year.hpp>
+#include <hamon/chrono/month.hpp>
+#include <hamon/chrono/day.hpp>
+#include <hamon/chrono/duration.hpp>
+#include <hamon/chrono/time_point/floor.hpp>
+#include <hamon/algorithm/max.hpp>
+#include <hamon/algorithm/min.hpp>
+#include <hamon/algorithm/ranges/lower_bound.hpp>
+#include <hamon/algorithm/ranges/sort.hpp>
+#include <hamon/cstddef/ptrdiff_t.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/string.hpp>
+#include <hamon/utility/move.hpp>
+#include <hamon/variant.hpp>
+#include <hamon/vector.hpp>
+#include <hamon/config.hpp>
+
+// 遷移表を作る年の範囲 [FIRST_YEAR, LAST_YEAR]
+// この範囲の外の時刻は、変換するたびに規則から計算する。
+#if !defined(HAMON_CHRONO_TZ_TABLE_FIRST_YEAR)
+#  define HAMON_CHRONO_TZ_TABLE_FIRST_YEAR 1800
+#endif
+
+#if !defined(HAMON_CHRONO_TZ_TABLE_LAST_YEAR)
+#  define HAMON_CHRONO_TZ_TABLE_LAST_YEAR 2100
+#endif
+
+namespace hamon {
+namespace chrono {
+namespace detail {
+
+namespace tz
+{
+
+// 遷移から次の遷移までの間の情報
+struct period_t
+{
+	chrono::seconds m_offset;
+	chrono::minutes m_save;
+	hamon::string   m_abbrev;
+};
+
+// 時刻の順に並べた遷移の列
+//
+// m_begins[i] から m_begins[i + 1] までの間は m_periods[i] になる。
+// そのため m_begins は m_periods より要素が1つ多い。
+// 最初の期間の始まりが sys_seconds::min() であれば、それより前の時刻も含む。
+// 最後の期間の終わりが sys_seconds::max() であれば、それより後の時刻も含む。
+struct transitions_t
+{
+	hamon::vector<chrono::sys_seconds> m_begins;
+	hamon::vector<tz::period_t>        m_periods;
+};
+
+inline chrono::sys_seconds
+saturating_add(chrono::sys_seconds t, chrono::seconds d)
+{
+	if (d > chrono::seconds{0} && t > chrono::sys_seconds::max() - d)
+	{
+		return chrono::sys_seconds::max();
+	}
+	if (d < chrono::seconds{0} && t < chrono::sys_seconds::min() - d)
+	{
+		return chrono::sys_seconds::min();
+	}
+	return t + d;
+}
+
+inline chrono::sys_seconds
+start_of_year(int y)
+{
+	return chrono::sys_days{chrono::year{y} / chrono::January / 1};
+}
+
+// t を含む年 (chrono::year で扱える範囲に丸める)
+inline int
+year_of(chrono::sys_seconds t)
+{
+	int const limit = 30000;
+	if (t < tz::start_of_year(-limit))
+	{
+		return -limit;
+	}
+	if (t >= tz::start_of_year(limit))
+	{
+		return limit;
+	}
+	return static_cast<int>(chrono::year_month_day{chrono::floor<chrono::days>(t)}.year());
+}
+
+// y 年 m 月の ON の日付
+inline chrono::sys_days
+to_sys_days(chrono::year y, chrono::month m, tz::on_t const& on)
+{
+	if (auto const* d = hamon::get_if<chrono::day>(&on))
+	{
+		return chrono::sys_days{chrono::year_month_day{y, m, *d}};
+	}
+	if (auto const* wdl = hamon::get_if<chrono::weekday_last>(&on))
+	{
+		return chrono::sys_days{chrono::year_month_weekday_last{y, m, *wdl}};
+	}
+	return chrono::sys_days{hamon::get<tz::constrained_weekday_t>(on)(y, m)};
+}
+
+// 日付と AT の時刻 t を UTC に変換する
+inline chrono::sys_seconds
+to_utc(chrono::seconds t, tz::clock_t clock, chrono::seconds stdoff, chrono::seconds save)
+{
+	switch (clock)
+	{
+	case tz::clock_t::universal:
+		break;
+	case tz::clock_t::standard:
+		t -= stdoff;
+		break;
+	case tz::clock_t::local:
+		t -= stdoff + save;
+		break;
+	}
+	return chrono::sys_seconds{t};
+}
+
+// continuation の UNTIL を UTC に変換する (UNTIL がなければ sys_seconds::max())
+inline chrono::sys_seconds
+until_utc(tz::continuation_t const& c, chrono::seconds save)
+{
+	if (c.m_year == chrono::year::min())
+	{
+		return chrono::sys_seconds::max();
+	}
+
+	auto const t = tz::to_sys_days(c.m_year, c.m_in, c.m_on).time_since_epoch() + c.m_at.m_time;
+	return tz::to_utc(t, c.m_at.m_clock, c.m_stdoff, save);
+}
+
+// "+hh", "+hhmm", "+hhmmss" の形式の文字列にする
+inline hamon::string
+format_offset(chrono::seconds offset)
+{
+	auto s = offset.count();
+	hamon::string result(1, s < 0 ? '-' : '+');
+	if (s < 0)
+	{
+		s = -s;
+	}
+
+	auto append2 = [&result](decltype(s) v)
+	{
+		result.push_back(static_cast<char>('0' + (v / 10) % 10));
+		result.push_back(static_cast<char>('0' + v % 10));
+	};
+
+	append2(s / 3600);
+	if (s % 3600 != 0)
+	{
+		append2(s / 60 % 60);
+	}
+	if (s % 60 != 0)
+	{
+		append2(s % 60);
+	}
+	return result;
+}
+
+// FORMAT から略称を作る
+//   "A/B" : 夏時間でなければ A、夏時間なら B
+//   "%s"  : 規則の LETTERS に置き換える
+//   "%z"  : UTC からのオフセットに置き換える
+inline hamon::string
+format_abbrev(hamon::string const& format, hamon::string const& letters, bool is_dst, chrono::seconds offset)
+{
+	auto const slash = format.find('/');
+	if (slash != hamon::string::npos)
+	{
+		return is_dst ? format.substr(slash + 1) : format.substr(0, slash);
+	}
+
+	auto const pos = format.find('%');
+	if (pos == hamon::string::npos || pos + 1 >= format.size())
+	{
+		return format;
+	}
+
+	hamon::string result = format.substr(0, pos);
+	if (format[pos + 1] == 's')
+	{
+		result += letters;
+	}
+	else if (format[pos + 1] == 'z')
+	{
+		result += tz::format_offset(offset);
+	}
+	result += format.substr(pos + 2);
+	return result;
+}
+
+inline tz::period_t
+make_period(tz::continuation_t const& c, chrono::seconds save, bool is_dst, hamon::string const& letters)
+{
+	auto const offset = c.m_stdoff + save;
+	return { offset, chrono::duration_cast<chrono::minutes>(save), tz::format_abbrev(c.m_format, letters, is_dst, offset) };
+}
+
+inline bool
+same_period(tz::period_t const& x, tz::period_t const& y)
+{
+	return x.m_offset == y.m_offset && x.m_save == y.m_save && x.m_abbrev == y.m_abbrev;
+}
+
+// 時刻 t から始まる期間を追加する
+// 直前の期間と同じ内容であれば、直前の期間を延ばす。
+// 直前の期間と同じ時刻から始まる場合は、直前の期間を上書きする。
+inline void
+push_period(tz::transitions_t& tr, chrono::sys_seconds t, tz::period_t p)
+{
+	if (!tr.m_periods.empty() && t <= tr.m_begins.back())
+	{
+		tr.m_periods.back() = hamon::move(p);
+		auto const n = tr.m_periods.size();
+		if (n >= 2 && tz::same_period(tr.m_periods[n - 2], tr.m_periods[n - 1]))
+		{
+			tr.m_periods.pop_back();
+			tr.m_begins.pop_back();
+		}
+		return;
+	}
+
+	if (!tr.m_periods.empty() && tz::same_period(tr.m_periods.back(), p))
+	{
+		return;
+	}
+
+	tr.m_begins.push_back(t);
+	tr.m_periods.push_back(hamon::move(p));
+}
+
+inline hamon::vector<tz::rule_t> const*
+find_rules(tz::rules_storage_type const& rules_db, hamon::string const& name)
+{
+	// rules_db は名前順にソートされている
+	auto const it = hamon::ranges::lower_bound(rules_db, name, {},
+		[](tz::rules_storage_type::const_reference p) -> hamon::string const& { return p.first; });
+	if (it == rules_db.end() || it->first != name)
+	{
+		return nullptr;
+	}
+	return &it->second;
+}
+
+// 規則がある年に適用される時刻
+struct occurrence_t
+{
+	// 日付と AT の時刻 (時計の種類は m_rule->m_at.m_clock)
+	chrono::seconds   m_time;
+	tz::rule_t const* m_rule;
+};
+
+inline tz::occurrence_t
+make_occurrence(tz::rule_t const& r, chrono::year y)
+{
+	return { tz::to_sys_days(y, r.m_in, r.m_on).time_since_epoch() + r.m_at.m_time, &r };
+}
+
+// y 年に適用される規則を、時刻の順に out に入れる
+inline void
+occurrences_in_year(hamon::vector<tz::rule_t> const& rules, chrono::year y, hamon::vector<tz::occurrence_t>& out)
+{
+	out.clear();
+	for (auto const& r : rules)
+	{
+		if (r.m_from <= y && y <= r.m_to)
+		{
+			out.push_back(tz::make_occurrence(r, y));
+		}
+	}
+	hamon::ranges::sort(out, {}, [](tz::occurrence_t const& o) { return o.m_time; });
+}
+
+// y 年より前に最後に適用された規則と、その1つ前に適用された規則
+struct latest_occurrences_t
+{
+	tz::occurrence_t m_last;
+	tz::occurrence_t m_prev;
+};
+
+inline tz::latest_occurrences_t
+latest_occurrences(hamon::vector<tz::rule_t> const& rules, chrono::year y)
+{
+	tz::latest_occurrences_t result{ {chrono::seconds{0}, nullptr}, {chrono::seconds{0}, nullptr} };
+
+	auto update = [&result](tz::occurrence_t const& o)
+	{
+		if (result.m_last.m_rule == nullptr || result.m_last.m_time < o.m_time)
+		{
+			result.m_prev = result.m_last;
+			result.m_last = o;
+		}
+		else if (result.m_prev.m_rule == nullptr || result.m_prev.m_time < o.m_time)
+		{
+			result.m_prev = o;
+		}
+	};
+
+	for (auto const& r : rules)
+	{
+		if (!(r.m_from < y))
+		{
+			continue;
+		}
+
+		// 規則ごとに、適用された最後の2年だけを調べればよい
+		auto const last = hamon::min(r.m_to, y - chrono::years{1});
+		update(tz::make_occurrence(r, last));
+		if (r.m_from < last)
+		{
+			update(tz::make_occurrence(r, last - chrono::years{1}));
+		}
+	}
+
+	return result;
+}
+
+// まだどの規則も適用されていないときの LETTERS
+// (SAVE が 0 の規則のうち、最初に適用されるもの)
+inline hamon::string
+initial_letters(hamon::vector<tz::rule_t> const& rules)
+{
+	tz::rule_t const* result = nullptr;
+	chrono::year first_year{};
+	chrono::seconds first_time{};
+	for (auto const& r : rules)
+	{
+		if (r.m_save.m_time != chrono::seconds{0})
+		{
+			continue;
+		}
+
+		auto const t = tz::make_occurrence(r, r.m_from).m_time;
+		if (result == nullptr || r.m_from < first_year || (r.m_from == first_year && t < first_time))
+		{
+			result = &r;
+			first_year = r.m_from;
+			first_time = t;
+		}
+	}
+	return result != nullptr ? result->m_letters : hamon::string{};
+}
+
+// STDOFF と SAVE
+struct offsets_t
+{
+	chrono::seconds m_stdoff;
+	chrono::seconds m_save;
+};
+
+// 規則に従う continuation の期間を tr に追加し、continuation の終わりの時刻を返す
+//
+// start は continuation の始まりの時刻、offsets はその直前の STDOFF と SAVE。
+// 戻るときには offsets を continuation の終わりの STDOFF と SAVE にする。
+// 規則は first_year 年から調べ始め、それより前の状態は latest_occurrences で求める。
+inline chrono::sys_seconds
+push_rule_periods(
+	tz::transitions_t& tr,
+	tz::continuation_t const& c,
+	hamon::vector<tz::rule_t> const& rules,
+	chrono::sys_seconds start,
+	tz::offsets_t& offsets,
+	int first_year,
+	int last_year,
+	chrono::sys_seconds to,
+	hamon::vector<tz::occurrence_t>& occurrences)
+{
+	auto const prev = offsets;
+	chrono::seconds save{0};
+	bool is_dst = false;
+	hamon::string letters = tz::initial_letters(rules);
+	chrono::sys_seconds begin = start;
+
+	auto const latest = tz::latest_occurrences(rules, chrono::year{first_year});
+	if (latest.m_last.m_rule != nullptr)
+	{
+		auto const prev_save = latest.m_prev.m_rule != nullptr ?
+			latest.m_prev.m_rule->m_save.m_time : chrono::seconds{0};
+		auto const t = tz::to_utc(latest.m_last.m_time, latest.m_last.m_rule->m_at.m_clock, c.m_stdoff, prev_save);
+		begin   = hamon::max(start, t);
+		save    = latest.m_last.m_rule->m_save.m_time;
+		is_dst  = latest.m_last.m_rule->m_save.m_is_dst;
+		letters = latest.m_last.m_rule->m_letters;
+	}
+	tz::push_period(tr, begin, tz::make_period(c, save, is_dst, letters));
+
+	for (int y = first_year; y <= last_year; ++y)
+	{
+		tz::occurrences_in_year(rules, chrono::year{y}, occurrences);
+		for (auto const& o : occurrences)
+		{
+			// AT がローカル時刻であれば、その直前の SAVE で UTC に変換する。
+			// ただし、直前の continuation のオフセットで continuation の始まり以前になる規則は、
+			// zic と同じように continuation の始まりに適用する。
+			auto t = tz::to_utc(o.m_time, o.m_rule->m_at.m_clock, prev.m_stdoff, prev.m_save);
+			if (start < t)
+			{
+				t = tz::to_utc(o.m_time, o.m_rule->m_at.m_clock, c.m_stdoff, save);
+			}
+			auto const until = tz::until_utc(c, save);
+			if (t >= until)
+			{
+				offsets = { c.m_stdoff, save };
+				return until;
+			}
+
+			save   = o.m_rule->m_save.m_time;
+			is_dst = o.m_rule->m_save.m_is_dst;
+			tz::push_period(tr, hamon::max(start, t), tz::make_period(c, save, is_dst, o.m_rule->m_letters));
+
+			if (tr.m_begins.back() >= to)
+			{
+				// これより後の期間は使わない
+				offsets = { c.m_stdoff, save };
+				return tz::until_utc(c, save);
+			}
+		}
+	}
+
+	offsets = { c.m_stdoff, save };
+	if (c.m_year != chrono::year::min())
+	{
+		return tz::until_utc(c, save);
+	}
+
+	// 最後の continuation で、まだ適用される規則が残っていれば、
+	// 最後の期間がどこまで続くかはわからない
+	for (auto const& r : rules)
+	{
+		if (chrono::year{last_year} < r.m_to)
+		{
+			return tz::start_of_year(last_year + 1);
+		}
+	}
+	return chrono::sys_seconds::max();
+}
+
+/**
+ *	@brief	[from, to) と重なる期間を求める
+ *
+ *	zic と同じように、continuation を順に辿りながら、各年に適用される規則を時刻の順に適用する。
+ *	from の前年より前については、規則ごとに最後に適用された年だけを調べるので、
+ *	計算量は [from, to) の年数と continuation の数に比例する。
+ */
+inline void
+make_transitions(
+	hamon::vector<tz::continuation_t> const& continuations,
+	tz::rules_storage_type const& rules_db,
+	chrono::sys_seconds from,
+	chrono::sys_seconds to,
+	tz::transitions_t& tr)
+{
+	tr.m_begins.clear();
+	tr.m_periods.clear();
+
+	int const from_year = tz::year_of(from);
+	int const to_year   = tz::year_of(to);
+	hamon::vector<tz::occurrence_t> occurrences;
+
+	chrono::sys_seconds start = chrono::sys_seconds::min();
+	chrono::sys_seconds end   = chrono::sys_seconds::max();
+	tz::offsets_t offsets{ continuations.front().m_stdoff, chrono::seconds{0} };
+	for (auto const& c : continuations)
+	{
+		hamon::vector<tz::rule_t> const* rules = nullptr;
+		if (auto const* name = hamon::get_if<hamon::string>(&c.m_rules))
+		{
+			rules = tz::find_rules(rules_db, *name);
+		}
+
+		if (rules == nullptr)
+		{
+			// 常に標準時か、SAVE が固定されている
+			tz::save_t save{chrono::seconds{0}, false};
+			if (auto const* s = hamon::get_if<tz::save_t>(&c.m_rules))
+			{
+				save = *s;
+			}
+			tz::push_period(tr, start, tz::make_period(c, save.m_time, save.m_is_dst, hamon::string{}));
+			end = tz::until_utc(c, save.m_time);
+			offsets = { c.m_stdoff, save.m_time };
+		}
+		else
+		{
+			bool const has_until = c.m_year != chrono::year::min();
+			int const until_year = has_until ? static_cast<int>(c.m_year) : to_year + 1;
+
+			// continuation の始まりの前年か from の前年のうち、遅い方から調べる。
+			// ただし UNTIL の時点の SAVE が必要なので、UNTIL の前年より後からにはしない。
+			int first_year = hamon::min(from_year - 1, until_year - 1);
+			if (start != chrono::sys_seconds::min())
+			{
+				first_year = hamon::max(first_year, tz::year_of(start) - 1);
+			}
+			int const last_year = has_until ? until_year : hamon::max(first_year, to_year) + 1;
+
+			end = tz::push_rule_periods(tr, c, *rules, start, offsets, first_year, last_year, to, occurrences);
+		}
+
+		if (end >= to || tr.m_begins.back() >= to)
+		{
+			break;
+		}
+		start = hamon::max(start, end);
+	}
+	tr.m_begins.push_back(hamon::max(end, tr.m_begins.back()));
+
+	// [from, to) と重ならない期間を取り除く
+	auto const n = tr.m_periods.size();
+	hamon::size_t first = 0;
+	while (first + 1 < n && tr.m_begins[first + 1] <= from)
+	{
+		++first;
+	}
+	hamon::size_t last = n;
+	while (last > first + 1 && tr.m_begins[last - 1] >= to)
+	{
+		--last;
+	}
+	tr.m_begins.erase(tr.m_begins.begin() + static_cast<hamon::ptrdiff_t>(last + 1), tr.m_begins.end());
+	tr.m_begins.erase(tr.m_begins.begin(), tr.m_begins.begin() + static_cast<hamon::ptrdiff_t>(first));
+	tr.m_periods.erase(tr.m_periods.begin() + static_cast<hamon::ptrdiff_t>(last), tr.m_periods.end());
+	tr.m_periods.erase(tr.m_periods.begin(), tr.m_periods.begin() + static_cast<hamon::ptrdiff_t>(first));
+}
+
+// time_zone が持つ遷移表を作る
+inline void
+make_transition_table(
+	hamon::vector<tz::continuation_t> const& continuations,
+	tz::rules_storage_type const& rules_db,
+	tz::transitions_t& tr)
+{
+	tz::make_transitions(continuations, rules_db,
+		tz::start_of_year(HAMON_CHRONO_TZ_TABLE_FIRST_YEAR),
+		tz::start_of_year(HAMON_CHRONO_TZ_TABLE_LAST_YEAR + 1),
+		tr);
+	tr.m_begins.shrink_to_fit();
+	tr.m_periods.shrink_to_fit();
+}
+
+// [from, to] が tr の範囲に含まれるかどうか
+inline bool
+covers(tz::transitions_t const& tr, chrono::sys_seconds from, chrono::sys_seconds to)
+{
+	return
+		!tr.m_periods.empty() &&
+		tr.m_begins.front() <= from &&
+		(to < tr.m_begins.back() || tr.m_begins.back() == chrono::sys_seconds::max());
+}
+
+#if defined(HAMON_HAS_CXX11_THREAD_LOCAL)
+
+// 最後に見つかった期間
+struct last_hit_t
+{
+	tz::transitions_t const* m_table;
+	hamon::size_t            m_index;
+};
+
+inline tz::last_hit_t&
+last_hit()
+{
+	// 同じタイムゾーンの近い時刻を続けて変換することが多いので、
+	// スレッドごとに最後に見つかった期間を覚えておき、二分探索を省く
+	thread_local tz::last_hit_t s_last_hit{nullptr, 0};
+	return s_last_hit;
+}
+
+#endif
+
+// t を含む期間の番号 (tr の範囲外なら m_periods.size())
+inline hamon::size_t
+find_period(tz::transitions_t const& tr, chrono::sys_seconds t)
+{
+	auto const n = tr.m_periods.size();
+	if (!tz::covers(tr, t, t))
+	{
+		return n;
+	}
+
+	auto const* const begins = tr.m_begins.data();
+
+#if defined(HAMON_HAS_CXX11_THREAD_LOCAL)
+	auto& hit = tz::last_hit();
+	if (hit.m_table == &tr && hit.m_index < n &&
+		begins[hit.m_index] <= t && t < begins[hit.m_index + 1])
+	{
+		return hit.m_index;
+	}
+#endif
+
+	// begins[i] <= t となる最後の i を探す。
+	// 探索する時刻はランダムなことが多く、分岐の予測が当たらないので、
+	// 比較の結果で分岐しない二分探索にする。
+	auto const* base = begins;
+	hamon::size_t len = n;
+	while (len > 1)
+	{
+		auto const half = len / 2;
+		base = (base[half] <= t) ? base + half : base;
+		len -= half;
+	}
+	auto const i = static_cast<hamon::size_t>(base - begins);
+
+#if defined(HAMON_HAS_CXX11_THREAD_LOCAL)
+	hit.m_table = &tr;
+	hit.m_index = i;
+#endif
+	return i;
+}
+
+inline chrono::sys_info
+to_sys_info(tz::transitions_t const& tr, hamon::size_t i)
+{
+	auto const& p = tr.m_periods[i];
+	return { tr.m_begins[i], tr.m_begins[i + 1], p.m_offset, p.m_save, p.m_abbrev };
+}
+
+// ローカル時刻 lt (の値を sys_seconds にしたもの) が、i 番目の期間のローカル時刻の範囲に含まれるかどうか
+inline bool
+contains_local(tz::transitions_t const& tr, hamon::size_t i, chrono::sys_seconds lt)
+{
+	auto const offset = tr.m_periods[i].m_offset;
+	return
+		(tr.m_begins[i] == chrono::sys_seconds::min() || tr.m_begins[i] + offset <= lt) &&
+		(tr.m_begins[i + 1] == chrono::sys_seconds::max() || lt < tr.m_begins[i + 1] + offset);
+}
+
+// ローカル時刻に対応する期間の番号
+struct local_periods_t
+{
+	int           m_result;	// local_info::unique, local_info::nonexistent, local_info::ambiguous
+	hamon::size_t m_first;
+	hamon::size_t m_second;
+};
+
+/**
+ *	@brief	ローカル時刻 lt (の値を sys_seconds にしたもの) に対応する期間を求める
+ *
+ *	UTC からのオフセットは1日未満なので、lt の前後1日の期間だけを調べればよい。
+ *	tr は [lt - 1日, lt + 1日] を含んでいなければならない。
+ */
+inline tz::local_periods_t
+find_local_periods(tz::transitions_t const& tr, chrono::sys_seconds lt)
+{
+	auto const lo_time = tz::saturating_add(lt, -chrono::days{1});
+	auto const hi_time = tz::saturating_add(lt,  chrono::days{1});
+	auto const n = tr.m_periods.size();
+	auto const i = tz::find_period(tr, lt);
+
+	hamon::size_t lo = i;
+	while (lo > 0 && lo_time < tr.m_begins[lo])
+	{
+		--lo;
+	}
+	hamon::size_t hi = i;
+	while (hi + 1 < n && tr.m_begins[hi + 1] <= hi_time)
+	{
+		++hi;
+	}
+
+	hamon::size_t found[2] = {};
+	int count = 0;
+	for (auto k = lo; k <= hi && count < 2; ++k)
+	{
+		if (tz::contains_local(tr, k, lt))
+		{
+			found[count++] = k;
+		}
+	}
+
+	if (count == 1)
+	{
+		return { chrono::local_info::unique, found[0], found[0] };
+	}
+
+	if (count == 2)
+	{
+		return { chrono::local_info::ambiguous, found[0], found[1] };
+	}
+
+	for (auto k = lo; k < hi; ++k)
+	{
+		// k 番目の期間の終わりと k + 1 番目の期間の始まりの間の、存在しない時刻
+		auto const end = tr.m_begins[k + 1];
+		if (end + tr.m_periods[k].m_offset <= lt && lt < end + tr.m_periods[k + 1].m_offset)
+		{
+			return { chrono::local_info::nonexistent, k, k + 1 };
+		}
+	}
+
+	return { chrono::local_info::unique, i, i };
+}
+
+inline chrono::local_info
+to_local_info(tz::transitions_t const& tr, tz::local_periods_t const& p)
+{
+	if (p.m_result == chrono::local_info::unique)
+	{
+		return { p.m_result, tz::to_sys_info(tr, p.m_first), chrono::sys_info{} };
+	}
+	return { p.m_result, tz::to_sys_info(tr, p.m_first), tz::to_sys_info(tr, p.m_second) };
+}
+
+// ローカル時刻を UTC に変換するのに必要な情報
+struct local_offsets_t
+{
+	int                 m_result;	// local_info::unique, local_info::nonexistent, local_info::ambiguous
+	chrono::seconds     m_first;	// 1つ目の期間のオフセット
+	chrono::seconds     m_second;	// 2つ目の期間のオフセット
+	chrono::sys_seconds m_first_end;	// 1つ目の期間の終わり
+};
+
+inline tz::local_offsets_t
+to_local_offsets(tz::transitions_t const& tr, tz::local_periods_t const& p)
+{
+	return
+	{
+		p.m_result,
+		tr.m_periods[p.m_first].m_offset,
+		tr.m_periods[p.m_second].m_offset,
+		tr.m_begins[p.m_first + 1],
+	};
+}
+
+}	// namespace tz
+
+}	// namespace detail
+}	// namespace chrono
+}	// namespace hamon
+
+#endif // HAMON_CHRONO_DETAIL_TZ_TRANSITIONS_HPP
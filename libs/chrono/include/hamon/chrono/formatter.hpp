@@ -0,0 +1,375 @@
+﻿/**
+ *	@file	formatter.hpp
+ *
+ *	@brief	chrono の型の formatter の特殊化
+ */
+
+#ifndef HAMON_CHRONO_FORMATTER_HPP
+#define HAMON_CHRONO_FORMATTER_HPP
+
+#include <hamon/chrono/config.hpp>
+
+#if !defined(HAMON_USE_STD_CHRONO)
+
+#include <hamon/chrono/detail/chrono_format_value.hpp>
+#include <hamon/chrono/detail/formatter_chrono.hpp>
+#include <hamon/chrono/detail/make_chrono_format_value.hpp>
+#include <hamon/chrono/day.hpp>
+#include <hamon/chrono/duration.hpp>
+#include <hamon/chrono/file_clock.hpp>
+#include <hamon/chrono/get_leap_second_info.hpp>
+#include <hamon/chrono/gps_clock.hpp>
+#include <hamon/chrono/hh_mm_ss.hpp>
+#include <hamon/chrono/local_time.hpp>
+#include <hamon/chrono/month.hpp>
+#include <hamon/chrono/month_day.hpp>
+#include <hamon/chrono/month_weekday.hpp>
+#include <hamon/chrono/sys_days.hpp>
+#include <hamon/chrono/sys_time.hpp>
+#include <hamon/chrono/tai_clock.hpp>
+#include <hamon/chrono/utc_clock.hpp>
+#include <hamon/chrono/weekday.hpp>
+#include <hamon/chrono/year.hpp>
+#include <hamon/chrono/year_month.hpp>
+#include <hamon/chrono/year_month_day.hpp>
+#include <hamon/chrono/year_month_weekday.hpp>
+#include <hamon/format/basic_format_parse_context.hpp>
+#include <hamon/format/config.hpp>
+#include <hamon/format/formatter.hpp>
+#include <hamon/ratio/ratio_less.hpp>
+#include <hamon/type_traits/common_type.hpp>
+#include <hamon/type_traits/is_floating_point.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon {
+namespace chrono {
+namespace detail {
+
+// sys_time, utc_time などの共通部分
+template <typename CharT>
+class formatter_chrono_time_point
+	: public detail::formatter_chrono<CharT>
+{
+public:
+	HAMON_CXX14_CONSTEXPR typename hamon::basic_format_parse_context<CharT>::iterator
+	parse(hamon::basic_format_parse_context<CharT>& pc)
+	{
+		using F = chrono_format_fields;
+		return this->parse_chrono(pc, F::date | F::time | F::offset | F::zone, false);
+	}
+
+protected:
+	// sys_time<Duration> を、タイムゾーンの略称 abbrev として書式化する
+	template <typename Duration, typename FormatContext>
+	typename FormatContext::iterator
+	format_sys_time(chrono::sys_time<Duration> const& tp, char const* abbrev, bool leap_second, FormatContext& ctx) const
+	{
+		using F = chrono_format_fields;
+		chrono_format_value<int> v;
+		v.m_fields      = F::date | F::time | F::offset | F::zone;
+		v.m_default     = chrono_default_format::date_time;
+		v.m_abbrev      = abbrev;
+		v.m_abbrev_size = 3;
+		detail::chrono_format_set_time_point(v, tp);
+		if (leap_second)
+		{
+			// 閏秒は 23:59:60 と書く
+			v.m_seconds += 1;
+		}
+		return this->format_chrono(v, ctx);
+	}
+};
+
+}	// namespace detail
+}	// namespace chrono
+}	// namespace hamon
+
+HAMON_FORMAT_START_NAMESPACE
+
+// 30.12 Formatting[time.format]
+
+template <typename Rep, typename Period, typename CharT>
+struct formatter<hamon::chrono::duration<Rep, Period>, CharT>
+	: public hamon::chrono::detail::formatter_chrono<CharT>
+{
+	HAMON_CXX14_CONSTEXPR typename hamon::basic_format_parse_context<CharT>::iterator
+	parse(hamon::basic_format_parse_context<CharT>& pc)
+	{
+		using F = hamon::chrono::detail::chrono_format_fields;
+		return this->parse_chrono(pc, F::time | F::duration, hamon::is_floating_point<Rep>::value);
+	}
+
+	template <typename FormatContext>
+	typename FormatContext::iterator
+	format(hamon::chrono::duration<Rep, Period> const& d, FormatContext& ctx) const
+	{
+		return this->format_chrono(hamon::chrono::detail::make_chrono_format_value(d), ctx);
+	}
+};
+
+template <typename Duration, typename CharT>
+struct formatter<hamon::chrono::sys_time<Duration>, CharT>
+	: public hamon::chrono::detail::formatter_chrono<CharT>
+{
+	HAMON_CXX14_CONSTEXPR typename hamon::basic_format_parse_context<CharT>::iterator
+	parse(hamon::basic_format_parse_context<CharT>& pc)
+	{
+		using F = hamon::chrono::detail::chrono_format_fields;
+		return this->parse_chrono(pc, F::date | F::time | F::offset | F::zone, false);
+	}
+
+	template <typename FormatContext>
+	typename FormatContext::iterator
+	format(hamon::chrono::sys_time<Duration> const& tp, FormatContext& ctx) const
+	{
+		using F = hamon::chrono::detail::chrono_format_fields;
+		using hamon::chrono::detail::chrono_default_format;
+		hamon::chrono::detail::chrono_format_value<int> v;
+		v.m_fields      = F::date | F::time | F::offset | F::zone;
+		// sys_days などの1日以上の単位は、operator<< と同じく日付だけ書く
+		v.m_default     = hamon::ratio_less<typename Duration::period, hamon::chrono::days::period>::value ?
+			chrono_default_format::date_time : chrono_default_format::date;
+		v.m_abbrev      = "UTC";
+		v.m_abbrev_size = 3;
+		hamon::chrono::detail::chrono_format_set_time_point(v, tp);
+		return this->format_chrono(v, ctx);
+	}
+};
+
+template <typename Duration, typename CharT>
+struct formatter<hamon::chrono::utc_time<Duration>, CharT>
+	: public hamon::chrono::detail::formatter_chrono_time_point<CharT>
+{
+	template <typename FormatContext>
+	typename FormatContext::iterator
+	format(hamon::chrono::utc_time<Duration> const& tp, FormatContext& ctx) const
+	{
+		return this->format_sys_time(hamon::chrono::utc_clock::to_sys(tp), "UTC",
+			hamon::chrono::get_leap_second_info(tp).is_leap_second, ctx);
+	}
+};
+
+template <typename Duration, typename CharT>
+struct formatter<hamon::chrono::tai_time<Duration>, CharT>
+	: public hamon::chrono::detail::formatter_chrono_time_point<CharT>
+{
+	template <typename FormatContext>
+	typename FormatContext::iterator
+	format(hamon::chrono::tai_time<Duration> const& tp, FormatContext& ctx) const
+	{
+		// [time.clock.tai.nonmembers]/1
+		using D = hamon::common_type_t<Duration, hamon::chrono::seconds>;
+		return this->format_sys_time(
+			hamon::chrono::sys_time<D>{tp.time_since_epoch()} - hamon::chrono::seconds{378691200},
+			"TAI", false, ctx);
+	}
+};
+
+template <typename Duration, typename CharT>
+struct formatter<hamon::chrono::gps_time<Duration>, CharT>
+	: public hamon::chrono::detail::formatter_chrono_time_point<CharT>
+{
+	template <typename FormatContext>
+	typename FormatContext::iterator
+	format(hamon::chrono::gps_time<Duration> const& tp, FormatContext& ctx) const
+	{
+		// [time.clock.gps.nonmembers]/1
+		using D = hamon::common_type_t<Duration, hamon::chrono::seconds>;
+		return this->format_sys_time(
+			hamon::chrono::sys_time<D>{tp.time_since_epoch()} + hamon::chrono::seconds{315964800},
+			"GPS", false, ctx);
+	}
+};
+
+template <typename Duration, typename CharT>
+struct formatter<hamon::chrono::file_time<Duration>, CharT>
+	: public hamon::chrono::detail::formatter_chrono_time_point<CharT>
+{
+	template <typename FormatContext>
+	typename FormatContext::iterator
+	format(hamon::chrono::file_time<Duration> const& tp, FormatContext& ctx) const
+	{
+		return this->format_sys_time(hamon::chrono::file_clock::to_sys(tp), "UTC", false, ctx);
+	}
+};
+
+template <typename Duration, typename CharT>
+struct formatter<hamon::chrono::local_time<Duration>, CharT>
+	: public hamon::chrono::detail::formatter_chrono<CharT>
+{
+	HAMON_CXX14_CONSTEXPR typename hamon::basic_format_parse_context<CharT>::iterator
+	parse(hamon::basic_format_parse_context<CharT>& pc)
+	{
+		// タイムゾーンの情報を持たないので %z と %Z は使えない
+		using F = hamon::chrono::detail::chrono_format_fields;
+		return this->parse_chrono(pc, F::date | F::time, false);
+	}
+
+	template <typename FormatContext>
+	typename FormatContext::iterator
+	format(hamon::chrono::local_time<Duration> const& tp, FormatContext& ctx) const
+	{
+		using F = hamon::chrono::detail::chrono_format_fields;
+		hamon::chrono::detail::chrono_format_value<int> v;
+		v.m_fields  = F::date | F::time;
+		v.m_default = hamon::chrono::detail::chrono_default_format::date_time;
+		hamon::chrono::detail::chrono_format_set_time_point(v,
+			hamon::chrono::sys_time<Duration>{tp.time_since_epoch()});
+		return this->format_chrono(v, ctx);
+	}
+};
+
+#define HAMON_CHRONO_CALENDAR_FORMATTER(Type, Fields)	\
+	template <typename CharT>	\
+	struct formatter<hamon::chrono::Type, CharT>	\
+		: public hamon::chrono::detail::formatter_chrono<CharT>	\
+	{	\
+		HAMON_CXX14_CONSTEXPR typename hamon::basic_format_parse_context<CharT>::iterator	\
+		parse(hamon::basic_format_parse_context<CharT>& pc)	\
+		{	\
+			using F = hamon::chrono::detail::chrono_format_fields;	\
+			return this->parse_chrono(pc, Fields, false);	\
+		}	\
+	\
+		template <typename FormatContext>	\
+		typename FormatContext::iterator	\
+		format(hamon::chrono::Type const& x, FormatContext& ctx) const	\
+		{	\
+			using F = hamon::chrono::detail::chrono_format_fields;	\
+			hamon::chrono::detail::chrono_format_value<int> v;	\
+			v.m_fields  = Fields;	\
+			v.m_default = hamon::chrono::detail::chrono_default_format::Type;	\
+			set(v, x);	\
+			return this->format_chrono(v, ctx);	\
+		}	\
+	\
+	private:	\
+		static void set(hamon::chrono::detail::chrono_format_value<int>& v, hamon::chrono::Type const& x);	\
+	};	\
+	\
+	template <typename CharT>	\
+	inline void	\
+	formatter<hamon::chrono::Type, CharT>::set(hamon::chrono::detail::chrono_format_value<int>& v, hamon::chrono::Type const& x)
+
+HAMON_CHRONO_CALENDAR_FORMATTER(day, F::day)
+{
+	v.m_day = static_cast<unsigned>(x);
+}
+
+HAMON_CHRONO_CALENDAR_FORMATTER(month, F::month)
+{
+	v.m_month = static_cast<unsigned>(x);
+}
+
+HAMON_CHRONO_CALENDAR_FORMATTER(year, F::year)
+{
+	v.m_year = static_cast<int>(x);
+}
+
+HAMON_CHRONO_CALENDAR_FORMATTER(weekday, F::weekday)
+{
+	v.m_weekday = x.c_encoding();
+}
+
+HAMON_CHRONO_CALENDAR_FORMATTER(weekday_indexed, F::weekday)
+{
+	v.m_weekday = x.weekday().c_encoding();
+	v.m_index   = x.index();
+}
+
+HAMON_CHRONO_CALENDAR_FORMATTER(weekday_last, F::weekday)
+{
+	v.m_weekday = x.weekday().c_encoding();
+}
+
+HAMON_CHRONO_CALENDAR_FORMATTER(month_day, F::month | F::day)
+{
+	v.m_month = static_cast<unsigned>(x.month());
+	v.m_day   = static_cast<unsigned>(x.day());
+}
+
+HAMON_CHRONO_CALENDAR_FORMATTER(month_day_last, F::month)
+{
+	v.m_month = static_cast<unsigned>(x.month());
+}
+
+HAMON_CHRONO_CALENDAR_FORMATTER(month_weekday, F::month | F::weekday)
+{
+	v.m_month   = static_cast<unsigned>(x.month());
+	v.m_weekday = x.weekday_indexed().weekday().c_encoding();
+	v.m_index   = x.weekday_indexed().index();
+}
+
+HAMON_CHRONO_CALENDAR_FORMATTER(month_weekday_last, F::month | F::weekday)
+{
+	v.m_month   = static_cast<unsigned>(x.month());
+	v.m_weekday = x.weekday_last().weekday().c_encoding();
+}
+
+HAMON_CHRONO_CALENDAR_FORMATTER(year_month, F::year | F::month)
+{
+	v.m_year  = static_cast<int>(x.year());
+	v.m_month = static_cast<unsigned>(x.month());
+}
+
+HAMON_CHRONO_CALENDAR_FORMATTER(year_month_day, F::date)
+{
+	hamon::chrono::detail::chrono_format_set_date(v, x);
+}
+
+HAMON_CHRONO_CALENDAR_FORMATTER(year_month_day_last, F::date)
+{
+	hamon::chrono::detail::chrono_format_set_date(v,
+		hamon::chrono::year_month_day{x.year(), x.month(), x.day()});
+}
+
+HAMON_CHRONO_CALENDAR_FORMATTER(year_month_weekday, F::date)
+{
+	hamon::chrono::detail::chrono_format_set_date(v,
+		hamon::chrono::year_month_day{hamon::chrono::sys_days{x}});
+	v.m_year    = static_cast<int>(x.year());
+	v.m_month   = static_cast<unsigned>(x.month());
+	v.m_weekday = x.weekday().c_encoding();
+	v.m_index   = x.index();
+}
+
+HAMON_CHRONO_CALENDAR_FORMATTER(year_month_weekday_last, F::date)
+{
+	hamon::chrono::detail::chrono_format_set_date(v,
+		hamon::chrono::year_month_day{hamon::chrono::sys_days{x}});
+	v.m_year    = static_cast<int>(x.year());
+	v.m_month   = static_cast<unsigned>(x.month());
+	v.m_weekday = x.weekday().c_encoding();
+}
+
+#undef HAMON_CHRONO_CALENDAR_FORMATTER
+
+template <typename Duration, typename CharT>
+struct formatter<hamon::chrono::hh_mm_ss<Duration>, CharT>
+	: public hamon::chrono::detail::formatter_chrono<CharT>
+{
+	HAMON_CXX14_CONSTEXPR typename hamon::basic_format_parse_context<CharT>::iterator
+	parse(hamon::basic_format_parse_context<CharT>& pc)
+	{
+		using F = hamon::chrono::detail::chrono_format_fields;
+		return this->parse_chrono(pc, F::time, false);
+	}
+
+	template <typename FormatContext>
+	typename FormatContext::iterator
+	format(hamon::chrono::hh_mm_ss<Duration> const& hms, FormatContext& ctx) const
+	{
+		using F = hamon::chrono::detail::chrono_format_fields;
+		hamon::chrono::detail::chrono_format_value<int> v;
+		v.m_fields  = F::time;
+		v.m_default = hamon::chrono::detail::chrono_default_format::time_of_day;
+		hamon::chrono::detail::chrono_format_set_time(v, hms);
+		return this->format_chrono(v, ctx);
+	}
+};
+
+HAMON_FORMAT_END_NAMESPACE
+
+#endif
+
+#endif // HAMON_CHRONO_FORMATTER_HPP
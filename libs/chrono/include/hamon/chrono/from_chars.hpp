@@ -0,0 +1,149 @@
+﻿/**
+ *	@file	from_chars.hpp
+ *
+ *	@brief	from_chars の定義
+ */
+
+#ifndef HAMON_CHRONO_FROM_CHARS_HPP
+#define HAMON_CHRONO_FROM_CHARS_HPP
+
+#include <hamon/chrono/sys_time_reader.hpp>
+#include <hamon/chrono/sys_time.hpp>
+#include <hamon/chrono/day.hpp>
+#include <hamon/chrono/duration.hpp>
+#include <hamon/chrono/duration/duration_cast.hpp>
+#include <hamon/chrono/hh_mm_ss.hpp>
+#include <hamon/chrono/month.hpp>
+#include <hamon/chrono/year.hpp>
+#include <hamon/chrono/year_month_day.hpp>
+#include <hamon/chrono/detail/chrono_from_chars.hpp>
+#include <hamon/chrono/detail/chrono_units_suffix.hpp>
+#include <hamon/chrono/detail/civil.hpp>
+#include <hamon/charconv/from_chars.hpp>
+#include <hamon/charconv/from_chars_result.hpp>
+#include <hamon/system_error/errc.hpp>
+#include <hamon/cstdint/uint64_t.hpp>
+#include <hamon/type_traits/enable_if.hpp>
+#include <hamon/type_traits/is_integral.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon {
+namespace chrono {
+
+// to_chars で書いた形式の文字列を読む。
+// 読めたときは読んだ文字の次の位置を返す。
+// 読めなかったときは {first, errc::invalid_argument} を返し、value は変更しない。
+
+/**
+ *	@brief	"YYYY-MM-DD" の形式の日付を読む
+ *
+ *	年は符号と4桁か5桁の数字。正しい日付 (ok() が true) でなければ読めない。
+ */
+inline HAMON_CXX14_CONSTEXPR hamon::from_chars_result
+from_chars(char const* first, char const* end, hamon::chrono::year_month_day& ymd) HAMON_NOEXCEPT
+{
+	detail::civil c{};
+	char const* const p = detail::chrono_read_date(first, end, c);
+	if (p == nullptr || !detail::chrono_is_valid_date(c))
+	{
+		return {first, hamon::errc::invalid_argument};
+	}
+
+	ymd = hamon::chrono::year_month_day{
+		hamon::chrono::year{c.year},
+		hamon::chrono::month{c.month},
+		hamon::chrono::day{c.day}};
+	return {p, hamon::errc{}};
+}
+
+/**
+ *	@brief	"hh:mm:ss.fff" の形式の時刻を読む
+ *
+ *	先頭に '-' があれば負の値になる。時は10桁まで読める。
+ *	小数部は hh_mm_ss<Duration>::precision の精度で切り捨てる。
+ */
+template <typename Duration>
+inline HAMON_CXX14_CONSTEXPR hamon::from_chars_result
+from_chars(char const* first, char const* end, hamon::chrono::hh_mm_ss<Duration>& hms) HAMON_NOEXCEPT
+{
+	using precision = typename hamon::chrono::hh_mm_ss<Duration>::precision;
+
+	bool const negative = (first != end && *first == '-');
+	hamon::uint64_t h = 0;
+	unsigned m = 0;
+	unsigned s = 0;
+	hamon::uint64_t sub = 0;
+	char const* p = detail::chrono_read_time(first + (negative ? 1 : 0), end, true, h, m, s);
+	if (p != nullptr && m < 60 && s < 60)
+	{
+		p = detail::chrono_read_fraction(p, end, hamon::chrono::hh_mm_ss<Duration>::fractional_width, sub);
+	}
+	else
+	{
+		p = nullptr;
+	}
+
+	if (p == nullptr)
+	{
+		return {first, hamon::errc::invalid_argument};
+	}
+
+	using seconds_rep = hamon::chrono::seconds::rep;
+	precision const d =
+		hamon::chrono::seconds{static_cast<seconds_rep>(h * 3600 + m * 60 + s)} +
+		precision{static_cast<typename precision::rep>(sub)};
+	hms = hamon::chrono::hh_mm_ss<Duration>{
+		hamon::chrono::duration_cast<Duration>(negative ? -d : d)};
+	return {p, hamon::errc{}};
+}
+
+/**
+ *	@brief	count() と units-suffix ("42ms" など) の形式の duration を読む
+ *
+ *	units-suffix は Period のものと一致しなければならない。
+ *	rep が整数の duration だけに使える。
+ */
+template <typename Rep, typename Period,
+	typename = hamon::enable_if_t<hamon::is_integral<Rep>::value>>
+inline HAMON_CXX14_CONSTEXPR hamon::from_chars_result
+from_chars(char const* first, char const* end, hamon::chrono::duration<Rep, Period>& d) HAMON_NOEXCEPT
+{
+	Rep count{};
+	auto const r = hamon::from_chars(first, end, count);
+	if (r.ec != hamon::errc{})
+	{
+		return {first, hamon::errc::invalid_argument};
+	}
+
+	char buf[detail::chrono_units_suffix_max_size]{};
+	char const* const suffix_last = detail::chrono_write_units_suffix(buf, Period::num, Period::den);
+	char const* p = r.ptr;
+	for (char const* q = buf; q != suffix_last; ++q, ++p)
+	{
+		if (p == end || *p != *q)
+		{
+			return {first, hamon::errc::invalid_argument};
+		}
+	}
+
+	d = hamon::chrono::duration<Rep, Period>{count};
+	return {p, hamon::errc{}};
+}
+
+/**
+ *	@brief	ISO 8601 / RFC 3339 の形式のタイムスタンプを読む
+ *
+ *	読める書式は sys_time_reader を参照。
+ *	タイムスタンプを続けて読むときは、日付を覚えておく sys_time_reader を使うと速い。
+ */
+template <typename Duration>
+inline HAMON_CXX14_CONSTEXPR hamon::from_chars_result
+from_chars(char const* first, char const* end, hamon::chrono::sys_time<Duration>& tp) HAMON_NOEXCEPT
+{
+	return hamon::chrono::sys_time_reader<Duration>{}.from_chars(first, end, tp);
+}
+
+}	// namespace chrono
+}	// namespace hamon
+
+#endif // HAMON_CHRONO_FROM_CHARS_HPP
@@ -24,6 +24,8 @@ using std::chrono::hh_mm_ss;
 #else
 
 #include <hamon/chrono/duration.hpp>
+#include <hamon/chrono/detail/chrono_ostream_write.hpp>
+#include <hamon/chrono/detail/chrono_to_chars.hpp>
 #include <hamon/ratio.hpp>
 #include <hamon/type_traits/common_type.hpp>
 #include <ostream>
@@ -141,12 +143,14 @@ private:
 
 template <typename charT, typename traits, typename Duration>
 std::basic_ostream<charT, traits>&
-operator<<(std::basic_ostream<charT, traits>& os, hh_mm_ss<Duration> const& hms);
-#if 0	// TODO
+operator<<(std::basic_ostream<charT, traits>& os, hh_mm_ss<Duration> const& hms)
 {
-	return os << format(os.getloc(), STATICALLY-WIDEN<charT>("{:L%T}"), hms);
+	// [time.hms.nonmembers]/1
+	// format(os.getloc(), STATICALLY-WIDEN<charT>("{:L%T}"), hms) と同じ
+	char buf[detail::chrono_time_max_size];
+	char* const p = detail::chrono_write_hh_mm_ss(buf, hms);
+	return detail::chrono_ostream_write(os, buf, p);
 }
-#endif
 
 }	// namespace chrono
 }	// namespace hamon
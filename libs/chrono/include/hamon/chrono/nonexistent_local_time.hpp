@@ -0,0 +1,86 @@
+﻿/**
+ *	@file	nonexistent_local_time.hpp
+ *
+ *	@brief	nonexistent_local_time の定義
+ */
+
+#ifndef HAMON_CHRONO_NONEXISTENT_LOCAL_TIME_HPP
+#define HAMON_CHRONO_NONEXISTENT_LOCAL_TIME_HPP
+
+#include <hamon/chrono/config.hpp>
+
+#if defined(HAMON_USE_STD_CHRONO)
+
+#include <chrono>
+
+namespace hamon {
+namespace chrono {
+
+using std::chrono::nonexistent_local_time;
+
+}	// namespace chrono
+}	// namespace hamon
+
+#else
+
+#include <hamon/chrono/local_info.hpp>
+#include <hamon/chrono/local_time.hpp>
+#include <hamon/chrono/detail/datetime_string.hpp>
+#include <hamon/cstdlib/abort.hpp>
+#include <hamon/stdexcept/runtime_error.hpp>
+#include <hamon/string.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon {
+namespace chrono {
+
+// 30.11.3.1 Class nonexistent_local_time[time.zone.exception.nonexist]
+
+class nonexistent_local_time : public hamon::runtime_error
+{
+public:
+	template <typename Duration>
+	nonexistent_local_time(local_time<Duration> const& tp, local_info const& i)
+		: hamon::runtime_error(make_message(tp, i).c_str())
+	{}
+
+private:
+	template <typename Duration>
+	static hamon::string
+	make_message(local_time<Duration> const& tp, local_info const& i)
+	{
+		// [time.zone.exception.nonexist]/2
+		return
+			detail::datetime_string(tp) + " is in a gap between\n" +
+			detail::datetime_string(i.first.end.time_since_epoch() + i.first.offset) + ' ' +
+			i.first.abbrev + " and\n" +
+			detail::datetime_string(i.second.begin.time_since_epoch() + i.second.offset) + ' ' +
+			i.second.abbrev + " which are both equivalent to\n" +
+			detail::datetime_string(i.first.end) + " UTC";
+	}
+};
+
+namespace detail
+{
+
+template <typename Duration>
+HAMON_NORETURN inline void
+throw_nonexistent_local_time(local_time<Duration> const& tp, local_info const& i)
+{
+#if !defined(HAMON_NO_EXCEPTIONS)
+	throw chrono::nonexistent_local_time(tp, i);
+#else
+	(void)tp;
+	(void)i;
+	hamon::abort();
+#endif
+}
+
+}	// namespace detail
+
+}	// namespace chrono
+}	// namespace hamon
+
+#endif
+
+#endif // HAMON_CHRONO_NONEXISTENT_LOCAL_TIME_HPP
@@ -0,0 +1,60 @@
+﻿/**
+ *	@file	parse_sys_times.hpp
+ *
+ *	@brief	parse_sys_times の定義
+ */
+
+#ifndef HAMON_CHRONO_PARSE_SYS_TIMES_HPP
+#define HAMON_CHRONO_PARSE_SYS_TIMES_HPP
+
+#include <hamon/chrono/sys_time_reader.hpp>
+#include <hamon/chrono/sys_time.hpp>
+#include <hamon/system_error/errc.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/span.hpp>
+#include <hamon/string_view.hpp>
+#include <hamon/assert.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon {
+namespace chrono {
+
+/**
+ *	@brief	タイムスタンプの文字列の列をまとめて sys_time に変換する
+ *
+ *	in[i] 全体が sys_time_reader で読める文字列なら、その値を out[i] に書く。
+ *	読めない文字列があればそこで止まり、その位置を返す (out[i] 以降は変更しない)。
+ *	全て読めたときは in.size() を返す。
+ *
+ *	ログの列のように同じ日付が続くときは、日付の変換と検査を省く。
+ *
+ *	@pre	out.size() >= in.size()
+ */
+template <typename Duration>
+inline hamon::size_t
+parse_sys_times(
+	hamon::span<hamon::string_view const> in,
+	hamon::span<hamon::chrono::sys_time<Duration>> out)
+{
+	HAMON_ASSERT(out.size() >= in.size());
+
+	hamon::chrono::sys_time_reader<Duration> reader;
+	for (hamon::size_t i = 0; i < in.size(); ++i)
+	{
+		char const* const first = in[i].data();
+		char const* const end = first + in[i].size();
+		hamon::chrono::sys_time<Duration> tp{};
+		auto const r = reader.from_chars(first, end, tp);
+		if (r.ec != hamon::errc{} || r.ptr != end)
+		{
+			return i;
+		}
+		out[i] = tp;
+	}
+	return in.size();
+}
+
+}	// namespace chrono
+}	// namespace hamon
+
+#endif // HAMON_CHRONO_PARSE_SYS_TIMES_HPP
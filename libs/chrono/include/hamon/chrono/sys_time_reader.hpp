@@ -0,0 +1,127 @@
+﻿/**
+ *	@file	sys_time_reader.hpp
+ *
+ *	@brief	sys_time_reader の定義
+ */
+
+#ifndef HAMON_CHRONO_SYS_TIME_READER_HPP
+#define HAMON_CHRONO_SYS_TIME_READER_HPP
+
+#include <hamon/chrono/sys_time.hpp>
+#include <hamon/chrono/duration.hpp>
+#include <hamon/chrono/hh_mm_ss.hpp>
+#include <hamon/chrono/time_point/floor.hpp>
+#include <hamon/chrono/detail/chrono_date_cache.hpp>
+#include <hamon/chrono/detail/chrono_from_chars.hpp>
+#include <hamon/chrono/detail/civil.hpp>
+#include <hamon/charconv/from_chars_result.hpp>
+#include <hamon/system_error/errc.hpp>
+#include <hamon/cstdint/uint64_t.hpp>
+#include <hamon/type_traits/common_type.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon {
+namespace chrono {
+
+/**
+ *	@brief	ISO 8601 / RFC 3339 の形式のタイムスタンプを sys_time に読む
+ *
+ *	読める書式:
+ *		date ["T" / "t" / " " time [fraction] [offset]]
+ *		date     = ["+" / "-"] YYYY "-" MM "-" DD (年は4桁か5桁)
+ *		time     = hh ":" mm ":" ss
+ *		fraction = ("." / ",") 1*DIGIT
+ *		offset   = "Z" / "z" / ("+" / "-") hh [":"] mm
+ *
+ *	offset があれば UTC に直す。小数部は Duration の精度で切り捨てる。
+ *	秒が 60 (閏秒) のときは 59 秒として読む。
+ *	" " の後が時刻でなければ、日付だけを読んでそこで止まる。
+ *
+ *	最後に読んだ日付の文字列を覚えておき、同じ日付が続くときは日付の変換と検査を省く。
+ */
+template <typename Duration>
+class sys_time_reader
+{
+	using precision =
+		typename hamon::chrono::hh_mm_ss<hamon::common_type_t<Duration, hamon::chrono::seconds>>::precision;
+
+	using result_duration = hamon::common_type_t<hamon::chrono::seconds, precision>;
+
+	HAMON_CXX11_STATIC_CONSTEXPR unsigned fractional_width =
+		hamon::chrono::hh_mm_ss<hamon::common_type_t<Duration, hamon::chrono::seconds>>::fractional_width;
+
+public:
+	HAMON_CXX14_CONSTEXPR hamon::from_chars_result
+	from_chars(char const* first, char const* end, hamon::chrono::sys_time<Duration>& tp)
+	{
+		char const* p = first + m_cache.match(first, end);
+		int n = m_cache.days();
+		if (p == first)
+		{
+			detail::civil c{};
+			p = detail::chrono_read_date(first, end, c);
+			if (p == nullptr || !detail::chrono_is_valid_date(c))
+			{
+				return {first, hamon::errc::invalid_argument};
+			}
+			n = detail::days_from_civil(c);
+			m_cache.store(first, p, n);
+		}
+
+		hamon::uint64_t h = 0;
+		unsigned m = 0;
+		unsigned s = 0;
+		hamon::uint64_t sub = 0;
+		int offset = 0;
+		if (p != end && (*p == 'T' || *p == 't' || *p == ' '))
+		{
+			char const* q = detail::chrono_read_time(p + 1, end, false, h, m, s);
+			if (q != nullptr && h < 24 && m < 60 && s <= 60)
+			{
+				q = detail::chrono_read_fraction(q, end, fractional_width, sub);
+				if (q != nullptr)
+				{
+					q = detail::chrono_read_offset(q, end, offset);
+				}
+				if (q == nullptr)
+				{
+					return {first, hamon::errc::invalid_argument};
+				}
+				p = q;
+			}
+			else if (*p != ' ')
+			{
+				return {first, hamon::errc::invalid_argument};
+			}
+			else
+			{
+				h = 0;
+				m = 0;
+				s = 0;
+			}
+		}
+
+		using seconds_rep = hamon::chrono::seconds::rep;
+		auto const secs =
+			static_cast<seconds_rep>(n) * 86400 +
+			static_cast<seconds_rep>(h * 3600 + m * 60 + (s == 60 ? 59 : s)) -
+			static_cast<seconds_rep>(offset) * 60;
+		result_duration const d = hamon::chrono::seconds{secs} +
+			precision{static_cast<typename precision::rep>(sub)};
+		tp = hamon::chrono::floor<Duration>(hamon::chrono::sys_time<result_duration>{d});
+		return {p, hamon::errc{}};
+	}
+
+private:
+	detail::chrono_date_cache m_cache;
+};
+
+#if !defined(HAMON_HAS_CXX17_INLINE_VARIABLES)
+template <typename Duration>
+HAMON_CXX11_CONSTEXPR unsigned sys_time_reader<Duration>::fractional_width;
+#endif
+
+}	// namespace chrono
+}	// namespace hamon
+
+#endif // HAMON_CHRONO_SYS_TIME_READER_HPP
@@ -0,0 +1,76 @@
+﻿/**
+ *	@file	sys_time_writer.hpp
+ *
+ *	@brief	sys_time_writer の定義
+ */
+
+#ifndef HAMON_CHRONO_SYS_TIME_WRITER_HPP
+#define HAMON_CHRONO_SYS_TIME_WRITER_HPP
+
+#include <hamon/chrono/sys_time.hpp>
+#include <hamon/chrono/duration.hpp>
+#include <hamon/chrono/hh_mm_ss.hpp>
+#include <hamon/chrono/time_point/floor.hpp>
+#include <hamon/chrono/treat_as_floating_point.hpp>
+#include <hamon/chrono/detail/chrono_date_cache.hpp>
+#include <hamon/chrono/detail/chrono_to_chars.hpp>
+#include <hamon/charconv/to_chars_result.hpp>
+#include <hamon/type_traits/common_type.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon {
+namespace chrono {
+
+/**
+ *	@brief	sys_time を RFC 3339 の形式 ("YYYY-MM-DDThh:mm:ss.fffZ") で書く
+ *
+ *	小数部の桁数は hh_mm_ss<Duration>::fractional_width。
+ *	最後に書いた日付の文字列を覚えておき、同じ日の時刻が続くときは日付の変換を省く。
+ */
+template <typename Duration>
+class sys_time_writer
+{
+	static_assert(!hamon::chrono::treat_as_floating_point<typename Duration::rep>::value,
+		"sys_time_writer requires an integral duration");
+
+	using time_of_day = hamon::common_type_t<Duration, hamon::chrono::days>;
+
+public:
+	// 書く文字列の最大の長さ
+	HAMON_CXX11_STATIC_CONSTEXPR int max_size =
+		detail::chrono_date_max_size + 1 + detail::chrono_time_max_size + 1;
+
+	HAMON_CXX14_CONSTEXPR hamon::to_chars_result
+	to_chars(char* first, char* end, hamon::chrono::sys_time<Duration> const& tp)
+	{
+		auto const dp = hamon::chrono::floor<hamon::chrono::days>(tp);
+		hamon::chrono::hh_mm_ss<time_of_day> const hms{tp - dp};
+		int const n = static_cast<int>(dp.time_since_epoch().count());
+		char const* const date = m_cache.chars(n);
+
+		char buf[max_size]{};
+		char* const out = (end - first >= max_size) ? first : buf;
+		char* p = out;
+		for (int i = 0; i < m_cache.size(); ++i)
+		{
+			*p++ = date[i];
+		}
+		*p++ = 'T';
+		p = detail::chrono_write_hh_mm_ss(p, hms);
+		*p++ = 'Z';
+		return detail::chrono_to_chars_finish(first, end, out, p);
+	}
+
+private:
+	detail::chrono_date_cache m_cache;
+};
+
+#if !defined(HAMON_HAS_CXX17_INLINE_VARIABLES)
+template <typename Duration>
+HAMON_CXX11_CONSTEXPR int sys_time_writer<Duration>::max_size;
+#endif
+
+}	// namespace chrono
+}	// namespace hamon
+
+#endif // HAMON_CHRONO_SYS_TIME_WRITER_HPP
@@ -27,14 +27,21 @@ using std::chrono::sys_days;
 #else
 
 #include <hamon/chrono/duration.hpp>
+#include <hamon/chrono/hh_mm_ss.hpp>
 #include <hamon/chrono/time_point.hpp>
+#include <hamon/chrono/time_point/floor.hpp>
 #include <hamon/chrono/treat_as_floating_point.hpp>
+#include <hamon/chrono/detail/chrono_ostream_write.hpp>
+#include <hamon/chrono/detail/chrono_to_chars.hpp>
+#include <hamon/chrono/detail/civil.hpp>
 #include <hamon/chrono/detail/windows.hpp>
 #include <hamon/cstdint.hpp>
 #include <hamon/detail/statically_widen.hpp>
 #include <hamon/ratio.hpp>
 #include <hamon/system_error/generic_category.hpp>
 #include <hamon/system_error/system_error.hpp>
+#include <hamon/type_traits/common_type.hpp>
+#include <hamon/type_traits/enable_if.hpp>
 #include <hamon/config.hpp>
 #include <ctime>
 #include <ostream>	// basic_ostream
@@ -117,24 +124,36 @@ public:
 
 // 30.7.2.3 Non-member functions[time.clock.system.nonmembers]
 
-// TODO
-//template <typename charT, typename traits, typename Duration>
-//requires (!hamon::chrono::treat_as_floating_point<typename Duration::rep>::value && Duration{1} < days{1})	// [time.clock.system.nonmembers]/1
-//std::basic_ostream<charT, traits>&
-//operator<<(std::basic_ostream<charT, traits>& os, sys_time<Duration> const& tp)
-//{
-//	// [time.clock.system.nonmembers]/2
-//	return os << format(os.getloc(), HAMON_STATICALLY_WIDEN(charT, "{:L%F %T}"), tp);
-//}
-
-// TODO
-//template <typename charT, typename traits>
-//std::basic_ostream<charT, traits>&
-//operator<<(std::basic_ostream<charT, traits>& os, sys_days const& dp)
-//{
-//	// [time.clock.system.nonmembers]/4,5
-//	return os << year_month_day{dp};
-//}
+template <typename charT, typename traits, typename Duration,
+	typename = hamon::enable_if_t<
+		!hamon::chrono::treat_as_floating_point<typename Duration::rep>::value &&	// [time.clock.system.nonmembers]/1
+		hamon::ratio_less<typename Duration::period, hamon::chrono::days::period>::value>>
+std::basic_ostream<charT, traits>&
+operator<<(std::basic_ostream<charT, traits>& os, sys_time<Duration> const& tp)
+{
+	// [time.clock.system.nonmembers]/2
+	// format(os.getloc(), HAMON_STATICALLY_WIDEN(charT, "{:L%F %T}"), tp) と同じ
+	auto const dp = hamon::chrono::floor<hamon::chrono::days>(tp);
+	hamon::chrono::hh_mm_ss<hamon::common_type_t<Duration, hamon::chrono::days>> const hms{tp - dp};
+	char buf[detail::chrono_date_max_size + 1 + detail::chrono_time_max_size];
+	char* p = detail::chrono_write_date(buf,
+		detail::civil_from_days(static_cast<int>(dp.time_since_epoch().count())));
+	*p++ = ' ';
+	p = detail::chrono_write_hh_mm_ss(p, hms);
+	return detail::chrono_ostream_write(os, buf, p);
+}
+
+template <typename charT, typename traits>
+std::basic_ostream<charT, traits>&
+operator<<(std::basic_ostream<charT, traits>& os, sys_days const& dp)
+{
+	// [time.clock.system.nonmembers]/4,5
+	// os << year_month_day{dp} と同じ (sys_days から作った year_month_day は ok() が true)
+	char buf[detail::chrono_date_max_size];
+	char* const p = detail::chrono_write_date(buf,
+		detail::civil_from_days(static_cast<int>(dp.time_since_epoch().count())));
+	return detail::chrono_ostream_write(os, buf, p);
+}
 
 // TODO
 //template <typename charT, typename traits, typename Duration, typename Alloc = allocator<charT>>
@@ -24,20 +24,32 @@ using std::chrono::time_zone;
 #else
 
 #include <hamon/chrono/sys_info.hpp>
+#include <hamon/chrono/sys_seconds.hpp>
 #include <hamon/chrono/system_clock.hpp>
 #include <hamon/chrono/local_info.hpp>
+#include <hamon/chrono/local_seconds.hpp>
 #include <hamon/chrono/local_time.hpp>
 #include <hamon/chrono/duration.hpp>
 #include <hamon/chrono/choose.hpp>
+#include <hamon/chrono/nonexistent_local_time.hpp>
+#include <hamon/chrono/ambiguous_local_time.hpp>
+#include <hamon/chrono/time_point/floor.hpp>
+#include <hamon/chrono/detail/compiled_tzdb.hpp>
+#include <hamon/chrono/detail/load_compiled_zone.hpp>
 #include <hamon/chrono/detail/tz.hpp>
+#include <hamon/chrono/detail/tz_transitions.hpp>
 #include <hamon/chrono/detail/private_ctor_tag.hpp>
 #include <hamon/compare/strong_ordering.hpp>
 #include <hamon/memory/addressof.hpp>
+#include <hamon/memory/make_unique.hpp>
+#include <hamon/memory/unique_ptr.hpp>
 #include <hamon/string.hpp>
 #include <hamon/string_view.hpp>
 #include <hamon/type_traits/common_type.hpp>
 #include <hamon/vector.hpp>
 #include <hamon/config.hpp>
+#include <atomic>
+#include <mutex>
 
 namespace hamon {
 namespace chrono {
@@ -47,8 +59,32 @@ namespace chrono {
 class time_zone
 {
 public:
-	time_zone(time_zone&&) = default;
-	time_zone& operator=(time_zone&&) = default;
+	time_zone(time_zone&& x) HAMON_NOEXCEPT
+		: m_name(hamon::move(x.m_name))
+		, m_continuations(hamon::move(x.m_continuations))
+		, m_rules_db(x.m_rules_db)
+		, m_compiled_db(x.m_compiled_db)
+		, m_compiled_zone(x.m_compiled_zone)
+		, m_cache(x.m_cache.exchange(nullptr)) {}
+
+	time_zone& operator=(time_zone&& x) HAMON_NOEXCEPT
+	{
+		if (this != hamon::addressof(x))
+		{
+			m_name           = hamon::move(x.m_name);
+			m_continuations  = hamon::move(x.m_continuations);
+			m_rules_db       = x.m_rules_db;
+			m_compiled_db    = x.m_compiled_db;
+			m_compiled_zone  = x.m_compiled_zone;
+			delete m_cache.exchange(x.m_cache.exchange(nullptr));
+		}
+		return *this;
+	}
+
+	~time_zone()
+	{
+		delete m_cache.load();
+	}
 
 	// unspecified additional constructors
 	explicit
@@ -58,10 +94,30 @@ public:
 		detail::tz::rules_storage_type const& rules_db)
 		: m_name(hamon::move(name))
 		, m_continuations(hamon::move(continuations))
-		, m_rules_db(hamon::addressof(rules_db)) {}
+		, m_rules_db(hamon::addressof(rules_db))
+		, m_compiled_db(nullptr)
+		, m_compiled_zone(nullptr)
+		, m_cache(nullptr) {}
+
+	// 静的な表 (compiled_tzdata) の zone を参照する。
+	// 名前は表の文字列をそのまま返し、continuation と規則は最初に必要になったときに作る。
+	explicit
+	time_zone(hamon::chrono::detail::private_ctor_tag,
+		detail::tz::compiled_tzdb_t const& db,
+		detail::tz::compiled_zone_t const& zone) HAMON_NOEXCEPT
+		: m_name()
+		, m_continuations()
+		, m_rules_db(nullptr)
+		, m_compiled_db(hamon::addressof(db))
+		, m_compiled_zone(hamon::addressof(zone))
+		, m_cache(nullptr) {}
 
 	HAMON_NODISCARD hamon::string_view name() const HAMON_NOEXCEPT
 	{
+		if (m_compiled_zone != nullptr)
+		{
+			return hamon::string_view{ m_compiled_zone->m_name, m_compiled_zone->m_name_length };
+		}
 		return m_name;
 	}
 
@@ -84,6 +140,21 @@ public:
 	to_local(sys_time<Duration> const& tp) const;
 
 private:
+	struct cache_t;
+
+	cache_t& cache() const;
+	detail::tz::transitions_t const& transitions() const;
+
+	// transitions() を呼んだ後で使うこと
+	hamon::vector<detail::tz::continuation_t> const& continuations() const;
+	detail::tz::rules_storage_type const& rules_db() const;
+
+	sys_info   get_info_impl(sys_seconds st) const;
+	local_info get_info_impl(local_seconds lt) const;
+	seconds    offset_at(sys_seconds st) const;
+
+	detail::tz::local_offsets_t local_offsets(local_seconds lt) const;
+
 	hamon::string m_name;
 	// Note the first line has a name + continuation_t, the other lines
 	// are just __continuations. So there is always at least one item in
@@ -95,8 +166,214 @@ private:
 	// to find its associated tzdb entry and thus not possible to find its
 	// associated rules. Therefore a link to the rules in stored in this class.
 	detail::tz::rules_storage_type const* m_rules_db;
+
+	// 静的な表から作った場合は、m_name, m_continuations, m_rules_db の代わりにこちらを使う
+	detail::tz::compiled_tzdb_t const* m_compiled_db;
+	detail::tz::compiled_zone_t const* m_compiled_zone;
+
+	// 遷移表は最初に必要になったときに作る。
+	// time_zone をムーブできるように、once_flag と一緒にヒープに置く。
+	// tzdb の初期化で zone の数だけ確保しないように、ヒープに置くのも最初に必要になったときにする。
+	struct cache_t
+	{
+		std::atomic<bool>         m_ready{false};
+		std::once_flag            m_once;
+		detail::tz::transitions_t m_table;
+
+		// 静的な表から作った zone の continuation と規則
+		hamon::vector<detail::tz::continuation_t> m_continuations;
+		detail::tz::rules_storage_type            m_rules;
+	};
+
+	mutable std::atomic<cache_t*> m_cache;
 };
 
+// 30.11.5.2 Member functions[time.zone.members]
+
+template <typename Duration>
+inline sys_info
+time_zone::get_info(sys_time<Duration> const& st) const
+{
+	return this->get_info_impl(chrono::floor<seconds>(st));
+}
+
+template <typename Duration>
+inline local_info
+time_zone::get_info(local_time<Duration> const& tp) const
+{
+	return this->get_info_impl(chrono::floor<seconds>(tp));
+}
+
+template <typename Duration>
+inline sys_time<hamon::common_type_t<Duration, seconds>>
+time_zone::to_sys(local_time<Duration> const& tp) const
+{
+	// [time.zone.members]/5
+	auto const lo = this->local_offsets(chrono::floor<seconds>(tp));
+	if (lo.m_result == local_info::nonexistent)
+	{
+		detail::throw_nonexistent_local_time(tp, this->get_info(tp));
+	}
+	if (lo.m_result == local_info::ambiguous)
+	{
+		detail::throw_ambiguous_local_time(tp, this->get_info(tp));
+	}
+	return sys_time<hamon::common_type_t<Duration, seconds>>{tp.time_since_epoch()} - lo.m_first;
+}
+
+template <typename Duration>
+inline sys_time<hamon::common_type_t<Duration, seconds>>
+time_zone::to_sys(local_time<Duration> const& tp, choose z) const
+{
+	// [time.zone.members]/7
+	auto const lo = this->local_offsets(chrono::floor<seconds>(tp));
+	if (lo.m_result == local_info::nonexistent)
+	{
+		return lo.m_first_end;
+	}
+	if (lo.m_result == local_info::ambiguous && z == choose::latest)
+	{
+		return sys_time<hamon::common_type_t<Duration, seconds>>{tp.time_since_epoch()} - lo.m_second;
+	}
+	return sys_time<hamon::common_type_t<Duration, seconds>>{tp.time_since_epoch()} - lo.m_first;
+}
+
+template <typename Duration>
+inline local_time<hamon::common_type_t<Duration, seconds>>
+time_zone::to_local(sys_time<Duration> const& tp) const
+{
+	// [time.zone.members]/9
+	return local_time<hamon::common_type_t<Duration, seconds>>{tp.time_since_epoch()} +
+		this->offset_at(chrono::floor<seconds>(tp));
+}
+
+inline time_zone::cache_t&
+time_zone::cache() const
+{
+	cache_t* p = m_cache.load(std::memory_order_acquire);
+	if (p == nullptr)
+	{
+		// 他のスレッドが先に置いた場合は、そちらを使う
+		auto q = hamon::make_unique<cache_t>();
+		if (m_cache.compare_exchange_strong(p, q.get(),
+			std::memory_order_acq_rel, std::memory_order_acquire))
+		{
+			p = q.release();
+		}
+	}
+	return *p;
+}
+
+inline detail::tz::transitions_t const&
+time_zone::transitions() const
+{
+	cache_t& c = this->cache();
+
+	// 作った後は call_once を呼ばずに済むようにする
+	if (!c.m_ready.load(std::memory_order_acquire))
+	{
+		std::call_once(c.m_once, [this, &c]
+		{
+			if (m_compiled_zone != nullptr)
+			{
+				detail::tz::load_compiled_zone(*m_compiled_db, *m_compiled_zone,
+					c.m_continuations, c.m_rules);
+			}
+			detail::tz::make_transition_table(this->continuations(), this->rules_db(), c.m_table);
+			c.m_ready.store(true, std::memory_order_release);
+		});
+	}
+	return c.m_table;
+}
+
+inline hamon::vector<detail::tz::continuation_t> const&
+time_zone::continuations() const
+{
+	if (m_compiled_zone != nullptr)
+	{
+		return m_cache.load(std::memory_order_acquire)->m_continuations;
+	}
+	return m_continuations;
+}
+
+inline detail::tz::rules_storage_type const&
+time_zone::rules_db() const
+{
+	if (m_compiled_zone != nullptr)
+	{
+		return m_cache.load(std::memory_order_acquire)->m_rules;
+	}
+	return *m_rules_db;
+}
+
+inline sys_info
+time_zone::get_info_impl(sys_seconds st) const
+{
+	auto const& table = this->transitions();
+	auto const i = detail::tz::find_period(table, st);
+	if (i < table.m_periods.size())
+	{
+		return detail::tz::to_sys_info(table, i);
+	}
+
+	// 遷移表の範囲外なので、規則から求める
+	detail::tz::transitions_t tr;
+	detail::tz::make_transitions(this->continuations(), this->rules_db(),
+		st, detail::tz::saturating_add(st, seconds{1}), tr);
+	return detail::tz::to_sys_info(tr, detail::tz::find_period(tr, st));
+}
+
+inline local_info
+time_zone::get_info_impl(local_seconds lt) const
+{
+	sys_seconds const t{lt.time_since_epoch()};
+	auto const from = detail::tz::saturating_add(t, -days{1});
+	auto const to   = detail::tz::saturating_add(t,  days{1});
+
+	auto const& table = this->transitions();
+	if (detail::tz::covers(table, from, to))
+	{
+		return detail::tz::to_local_info(table, detail::tz::find_local_periods(table, t));
+	}
+
+	// 遷移表の範囲外なので、規則から求める
+	detail::tz::transitions_t tr;
+	detail::tz::make_transitions(this->continuations(), this->rules_db(),
+		from, detail::tz::saturating_add(to, seconds{1}), tr);
+	return detail::tz::to_local_info(tr, detail::tz::find_local_periods(tr, t));
+}
+
+inline detail::tz::local_offsets_t
+time_zone::local_offsets(local_seconds lt) const
+{
+	sys_seconds const t{lt.time_since_epoch()};
+	auto const from = detail::tz::saturating_add(t, -days{1});
+	auto const to   = detail::tz::saturating_add(t,  days{1});
+
+	auto const& table = this->transitions();
+	if (detail::tz::covers(table, from, to))
+	{
+		return detail::tz::to_local_offsets(table, detail::tz::find_local_periods(table, t));
+	}
+
+	detail::tz::transitions_t tr;
+	detail::tz::make_transitions(this->continuations(), this->rules_db(),
+		from, detail::tz::saturating_add(to, seconds{1}), tr);
+	return detail::tz::to_local_offsets(tr, detail::tz::find_local_periods(tr, t));
+}
+
+inline seconds
+time_zone::offset_at(sys_seconds st) const
+{
+	auto const& table = this->transitions();
+	auto const i = detail::tz::find_period(table, st);
+	if (i < table.m_periods.size())
+	{
+		return table.m_periods[i].m_offset;
+	}
+	return this->get_info_impl(st).offset;
+}
+
 // 30.11.5.3 Non-member functions[time.zone.nonmembers]
 
 HAMON_NODISCARD inline bool
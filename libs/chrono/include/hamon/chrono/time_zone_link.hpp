@@ -23,8 +23,10 @@ using std::chrono::time_zone_link;
 
 #else
 
+#include <hamon/chrono/detail/compiled_tzdb.hpp>
 #include <hamon/chrono/detail/private_ctor_tag.hpp>
 #include <hamon/compare/strong_ordering.hpp>
+#include <hamon/memory/addressof.hpp>
 #include <hamon/string.hpp>
 #include <hamon/string_view.hpp>
 #include <hamon/config.hpp>
@@ -44,17 +46,31 @@ public:
 	explicit
 	time_zone_link(hamon::chrono::detail::private_ctor_tag,
 		hamon::string_view name, hamon::string_view target)
-		: m_name{ name }, m_target{ target } {}
+		: m_name{ name }, m_target{ target }, m_compiled{ nullptr } {}
+
+	// 静的な表 (compiled_tzdata) の文字列を参照する
+	explicit
+	time_zone_link(hamon::chrono::detail::private_ctor_tag,
+		detail::tz::compiled_link_t const& link) HAMON_NOEXCEPT
+		: m_name{}, m_target{}, m_compiled{ hamon::addressof(link) } {}
 
 	HAMON_NODISCARD hamon::string_view name() const HAMON_NOEXCEPT
 	{
 		// [time.zone.link.members]/1
+		if (m_compiled != nullptr)
+		{
+			return hamon::string_view{ m_compiled->m_name, m_compiled->m_name_length };
+		}
 		return m_name;
 	}
 
 	HAMON_NODISCARD hamon::string_view target() const HAMON_NOEXCEPT
 	{
 		// [time.zone.link.members]/2
+		if (m_compiled != nullptr)
+		{
+			return hamon::string_view{ m_compiled->m_target, m_compiled->m_target_length };
+		}
 		return m_target;
 	}
 
@@ -64,6 +80,7 @@ private:
 	// pointers are immutable. This makes it possible to directly return a
 	// pointer in the time_zone in the 'locate_zone' function.
 	hamon::string m_target;
+	detail::tz::compiled_link_t const* m_compiled;
 };
 
 // 30.11.9.3 Non-member functions[time.zone.link.nonmembers]
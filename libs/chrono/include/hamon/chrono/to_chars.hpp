@@ -0,0 +1,97 @@
+﻿/**
+ *	@file	to_chars.hpp
+ *
+ *	@brief	to_chars の定義
+ */
+
+#ifndef HAMON_CHRONO_TO_CHARS_HPP
+#define HAMON_CHRONO_TO_CHARS_HPP
+
+#include <hamon/chrono/sys_time_writer.hpp>
+#include <hamon/chrono/sys_time.hpp>
+#include <hamon/chrono/duration.hpp>
+#include <hamon/chrono/hh_mm_ss.hpp>
+#include <hamon/chrono/year_month_day.hpp>
+#include <hamon/chrono/detail/chrono_to_chars.hpp>
+#include <hamon/chrono/detail/chrono_units_suffix.hpp>
+#include <hamon/charconv/to_chars.hpp>
+#include <hamon/charconv/to_chars_result.hpp>
+#include <hamon/system_error/errc.hpp>
+#include <hamon/type_traits/enable_if.hpp>
+#include <hamon/type_traits/is_integral.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon {
+namespace chrono {
+
+// 日付や時刻を、書式を固定して [first, end) に書く。
+// 書式化の指定を解釈しないので format より速い。
+// [first, end) に入りきらないときは {end, errc::value_too_large} を返す。
+
+/**
+ *	@brief	year_month_day を "YYYY-MM-DD" (%F) の形式で書く
+ */
+inline HAMON_CXX14_CONSTEXPR hamon::to_chars_result
+to_chars(char* first, char* end, hamon::chrono::year_month_day const& ymd) HAMON_NOEXCEPT
+{
+	char buf[detail::chrono_date_max_size]{};
+	char* const out = (end - first >= detail::chrono_date_max_size) ? first : buf;
+	char* const p = detail::chrono_write_date(out, detail::civil{
+		static_cast<int>(ymd.year()),
+		static_cast<unsigned>(ymd.month()),
+		static_cast<unsigned>(ymd.day())});
+	return detail::chrono_to_chars_finish(first, end, out, p);
+}
+
+/**
+ *	@brief	hh_mm_ss を "hh:mm:ss.fff" (%T) の形式で書く
+ *
+ *	小数部の桁数は hh_mm_ss<Duration>::fractional_width。
+ */
+template <typename Duration>
+inline HAMON_CXX14_CONSTEXPR hamon::to_chars_result
+to_chars(char* first, char* end, hamon::chrono::hh_mm_ss<Duration> const& hms) HAMON_NOEXCEPT
+{
+	char buf[detail::chrono_time_max_size]{};
+	char* const out = (end - first >= detail::chrono_time_max_size) ? first : buf;
+	char* const p = detail::chrono_write_hh_mm_ss(out, hms);
+	return detail::chrono_to_chars_finish(first, end, out, p);
+}
+
+/**
+ *	@brief	duration を count() と units-suffix ("42ms" など) で書く
+ *
+ *	rep が整数の duration だけに使える。
+ */
+template <typename Rep, typename Period,
+	typename = hamon::enable_if_t<hamon::is_integral<Rep>::value>>
+inline HAMON_CXX14_CONSTEXPR hamon::to_chars_result
+to_chars(char* first, char* end, hamon::chrono::duration<Rep, Period> const& d) HAMON_NOEXCEPT
+{
+	auto const r = hamon::to_chars(first, end, d.count());
+	if (r.ec != hamon::errc{})
+	{
+		return r;
+	}
+
+	char buf[detail::chrono_units_suffix_max_size]{};
+	char* const p = detail::chrono_write_units_suffix(buf, Period::num, Period::den);
+	return detail::chrono_to_chars_finish(r.ptr, end, buf, p);
+}
+
+/**
+ *	@brief	sys_time を RFC 3339 の形式 ("YYYY-MM-DDThh:mm:ss.fffZ") で書く
+ *
+ *	同じ日の時刻を続けて書くときは、日付を覚えておく sys_time_writer を使うと速い。
+ */
+template <typename Duration>
+inline HAMON_CXX14_CONSTEXPR hamon::to_chars_result
+to_chars(char* first, char* end, hamon::chrono::sys_time<Duration> const& tp) HAMON_NOEXCEPT
+{
+	return hamon::chrono::sys_time_writer<Duration>{}.to_chars(first, end, tp);
+}
+
+}	// namespace chrono
+}	// namespace hamon
+
+#endif // HAMON_CHRONO_TO_CHARS_HPP
@@ -47,7 +47,9 @@ public:
 	// unspecified additional constructors
 	explicit tzdb_list(hamon::chrono::detail::private_ctor_tag)
 	{
-		chrono::detail::init_tzdb(m_tzdb.emplace_front(), m_rules.emplace_front());
+		// 組み込みの tzdb は規則を静的な表に持つので、m_rules は空のままでよい
+		m_rules.emplace_front();
+		chrono::detail::init_tzdb(m_tzdb.emplace_front());
 	}
 
 	using const_iterator = hamon::forward_list<hamon::chrono::tzdb>::const_iterator;
@@ -30,7 +30,7 @@ using std::chrono::get_leap_second_info;
 #include <hamon/chrono/duration.hpp>
 #include <hamon/chrono/time_point.hpp>
 #include <hamon/chrono/system_clock.hpp>
-#include <hamon/chrono/get_tzdb.hpp>
+#include <hamon/chrono/detail/leap_second_table.hpp>
 #include <hamon/ratio.hpp>
 #include <hamon/type_traits/common_type.hpp>
 #include <hamon/memory/allocator.hpp>
@@ -96,18 +96,8 @@ public:
 	{
 		// [time.clock.utc.members]/3
 		using R = hamon::chrono::utc_time<hamon::common_type_t<Duration, hamon::chrono::seconds>>;
-		auto const& tzdb = hamon::chrono::get_tzdb();
-		R result{ t.time_since_epoch() };
-		for (const auto& leap_second : tzdb.leap_seconds)
-		{
-			if (leap_second > t)
-			{
-				return result;
-			}
-
-			result += leap_second.value();
-		}
-		return result;
+		auto const& table = hamon::chrono::detail::get_leap_second_table();
+		return R{ t.time_since_epoch() + table.elapsed(table.sys_index(t)) };
 	}
 };
 
@@ -144,30 +134,14 @@ hamon::chrono::leap_second_info
 get_leap_second_info(hamon::chrono::utc_time<Duration> const& ut)
 {
 	// [time.clock.utc.nonmembers]/6
-	auto const& tzdb = hamon::chrono::get_tzdb();
-	if (HAMON_UNLIKELY(tzdb.leap_seconds.empty()))
-	{
-		return { false, hamon::chrono::seconds{0} };
-	}
-
+	auto const& table = hamon::chrono::detail::get_leap_second_table();
 	hamon::chrono::sys_seconds sys{ hamon::chrono::floor<hamon::chrono::seconds>(ut).time_since_epoch() };
-	hamon::chrono::seconds elapsed{ 0 };
-	for (auto const& leap_second : tzdb.leap_seconds)
+	auto const i = table.utc_index(sys);
+	if (table.is_at(i, sys))
 	{
-		if (sys == leap_second.date() + elapsed)
-		{
-			return { leap_second.value() > hamon::chrono::seconds{0}, elapsed + leap_second.value() };
-		}
-
-		if (sys < leap_second.date() + elapsed)
-		{
-			return { false, elapsed };
-		}
-
-		elapsed += leap_second.value();
+		return { table.value(i) > hamon::chrono::seconds{0}, table.elapsed(i) + table.value(i) };
 	}
-
-	return { false, elapsed };
+	return { false, table.elapsed(i) };
 }
 
 }	// namespace chrono
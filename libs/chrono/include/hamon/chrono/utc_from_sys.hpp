@@ -0,0 +1,63 @@
+﻿/**
+ *	@file	utc_from_sys.hpp
+ *
+ *	@brief	utc_from_sys の定義
+ */
+
+#ifndef HAMON_CHRONO_UTC_FROM_SYS_HPP
+#define HAMON_CHRONO_UTC_FROM_SYS_HPP
+
+#include <hamon/chrono/config.hpp>
+#include <hamon/chrono/utc_clock.hpp>
+#include <hamon/chrono/sys_time.hpp>
+#include <hamon/chrono/duration.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/span.hpp>
+#include <hamon/type_traits/common_type.hpp>
+#include <hamon/assert.hpp>
+#include <hamon/config.hpp>
+
+#if !defined(HAMON_USE_STD_CHRONO)
+#include <hamon/chrono/detail/leap_second_table.hpp>
+#endif
+
+namespace hamon {
+namespace chrono {
+
+/**
+ *	@brief	sys_time の列をまとめて utc_time に変換する
+ *
+ *	out[i] = utc_clock::from_sys(in[i]) と同じ結果になる。
+ *	閏秒の表を1回だけ取得し、直前の要素の位置から探すので、時刻順に並んだ列を速く変換できる。
+ *
+ *	@pre	out.size() >= in.size()
+ */
+template <typename Duration>
+inline void
+utc_from_sys(
+	hamon::span<hamon::chrono::sys_time<Duration> const> in,
+	hamon::span<hamon::chrono::utc_time<hamon::common_type_t<Duration, hamon::chrono::seconds>>> out)
+{
+	HAMON_ASSERT(out.size() >= in.size());
+
+#if defined(HAMON_USE_STD_CHRONO)
+	for (hamon::size_t i = 0; i < in.size(); ++i)
+	{
+		out[i] = hamon::chrono::utc_clock::from_sys(in[i]);
+	}
+#else
+	using R = hamon::chrono::utc_time<hamon::common_type_t<Duration, hamon::chrono::seconds>>;
+	auto const& table = hamon::chrono::detail::get_leap_second_table();
+	hamon::size_t hint = 0;
+	for (hamon::size_t i = 0; i < in.size(); ++i)
+	{
+		hint = table.sys_index(in[i], hint);
+		out[i] = R{ in[i].time_since_epoch() + table.elapsed(hint) };
+	}
+#endif
+}
+
+}	// namespace chrono
+}	// namespace hamon
+
+#endif // HAMON_CHRONO_UTC_FROM_SYS_HPP
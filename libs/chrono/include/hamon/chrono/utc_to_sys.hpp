@@ -0,0 +1,79 @@
+﻿/**
+ *	@file	utc_to_sys.hpp
+ *
+ *	@brief	utc_to_sys の定義
+ */
+
+#ifndef HAMON_CHRONO_UTC_TO_SYS_HPP
+#define HAMON_CHRONO_UTC_TO_SYS_HPP
+
+#include <hamon/chrono/config.hpp>
+#include <hamon/chrono/utc_clock.hpp>
+#include <hamon/chrono/sys_time.hpp>
+#include <hamon/chrono/sys_seconds.hpp>
+#include <hamon/chrono/duration.hpp>
+#include <hamon/chrono/time_point/floor.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/span.hpp>
+#include <hamon/type_traits/common_type.hpp>
+#include <hamon/assert.hpp>
+#include <hamon/config.hpp>
+
+#if !defined(HAMON_USE_STD_CHRONO)
+#include <hamon/chrono/detail/leap_second_table.hpp>
+#endif
+
+namespace hamon {
+namespace chrono {
+
+/**
+ *	@brief	utc_time の列をまとめて sys_time に変換する
+ *
+ *	out[i] = utc_clock::to_sys(in[i]) と同じ結果になる。
+ *	閏秒の表を1回だけ取得し、直前の要素の位置から探すので、時刻順に並んだ列を速く変換できる。
+ *
+ *	@pre	out.size() >= in.size()
+ */
+template <typename Duration>
+inline void
+utc_to_sys(
+	hamon::span<hamon::chrono::utc_time<Duration> const> in,
+	hamon::span<hamon::chrono::sys_time<hamon::common_type_t<Duration, hamon::chrono::seconds>>> out)
+{
+	HAMON_ASSERT(out.size() >= in.size());
+
+#if defined(HAMON_USE_STD_CHRONO)
+	for (hamon::size_t i = 0; i < in.size(); ++i)
+	{
+		out[i] = hamon::chrono::utc_clock::to_sys(in[i]);
+	}
+#else
+	using D = hamon::common_type_t<Duration, hamon::chrono::seconds>;
+	using R = hamon::chrono::sys_time<D>;
+	auto const& table = hamon::chrono::detail::get_leap_second_table();
+	hamon::size_t hint = 0;
+	for (hamon::size_t i = 0; i < in.size(); ++i)
+	{
+		// utc_clock::to_sys と同じ計算
+		hamon::chrono::sys_seconds const sys{ hamon::chrono::floor<hamon::chrono::seconds>(in[i]).time_since_epoch() };
+		hint = table.utc_index(sys, hint);
+		auto elapsed = table.elapsed(hint);
+		bool is_leap_second = false;
+		if (table.is_at(hint, sys))
+		{
+			elapsed += table.value(hint);
+			is_leap_second = table.value(hint) > hamon::chrono::seconds{0};
+		}
+
+		R const result{ in[i].time_since_epoch() - elapsed };
+		out[i] = is_leap_second ?
+			hamon::chrono::floor<hamon::chrono::seconds>(result) + hamon::chrono::seconds{1} - D{1} :
+			result;
+	}
+#endif
+}
+
+}	// namespace chrono
+}	// namespace hamon
+
+#endif // HAMON_CHRONO_UTC_TO_SYS_HPP
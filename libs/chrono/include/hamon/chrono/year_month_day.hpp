@@ -33,6 +33,8 @@ using std::chrono::year_month_day_last;
 #include <hamon/chrono/year_month.hpp>
 #include <hamon/chrono/month_day.hpp>
 #include <hamon/chrono/last_spec.hpp>
+#include <hamon/chrono/detail/chrono_ostream_write.hpp>
+#include <hamon/chrono/detail/chrono_to_chars.hpp>
 #include <hamon/chrono/detail/civil.hpp>
 #include <hamon/compare/strong_ordering.hpp>
 #include <hamon/detail/statically_widen.hpp>
@@ -323,17 +325,27 @@ operator-(year_month_day const& ymd, years const& dy) HAMON_NOEXCEPT
 	return ymd + (-dy);
 }
 
-#if 0	// TODO
 template <typename charT, typename traits>
 std::basic_ostream<charT, traits>&
 operator<<(std::basic_ostream<charT, traits>& os, year_month_day const& ymd)
 {
 	// [time.cal.ymd.nonmembers]/14
-	return os << (ymd.ok() ?
-		format(HAMON_STATICALLY_WIDEN(charT, "{:%F}"), ymd) :
-		format(HAMON_STATICALLY_WIDEN(charT, "{:%F} is not a valid date"), ymd));
+	char buf[detail::chrono_date_max_size + 24];
+	char* p = detail::chrono_write_date(buf, detail::civil{
+		static_cast<int>(ymd.year()),
+		static_cast<unsigned>(ymd.month()),
+		static_cast<unsigned>(ymd.day())});
+	if (!ymd.ok())
+	{
+		for (char const* s = " is not a valid date"; *s != '\0'; ++s)
+		{
+			*p++ = *s;
+		}
+	}
+	return detail::chrono_ostream_write(os, buf, p);
 }
 
+#if 0	// TODO
 template <typename charT, typename traits, typename Alloc = hamon::allocator<charT>>
 std::basic_istream<charT, traits>&
 from_stream(
@@ -0,0 +1,147 @@
+﻿/**
+ *	@file	unit_test_chrono_detail_compiled_tzdata.cpp
+ *
+ *	@brief	compiled_tzdata のテスト
+ */
+
+#include <hamon/chrono/config.hpp>
+
+#if !defined(HAMON_USE_STD_CHRONO)
+
+#include <hamon/chrono/detail/compiled_tzdata.hpp>
+#include <hamon/chrono/detail/init_tzdb.hpp>
+#include <hamon/chrono/detail/parse_tzdb.hpp>
+#include <hamon/chrono/detail/tz.hpp>
+#include <hamon/chrono/duration.hpp>
+#include <hamon/chrono/local_info.hpp>
+#include <hamon/chrono/local_seconds.hpp>
+#include <hamon/chrono/sys_days.hpp>
+#include <hamon/chrono/sys_info.hpp>
+#include <hamon/chrono/sys_seconds.hpp>
+#include <hamon/chrono/tzdb.hpp>
+#include <hamon/chrono/year_month_day.hpp>
+#include <hamon/string.hpp>
+#include <hamon/utility/move.hpp>
+#include <hamon/config.hpp>
+#include <gtest/gtest.h>
+#include <sstream>
+
+namespace hamon_chrono_test
+{
+
+namespace compiled_tzdata_test
+{
+
+inline bool equal(hamon::chrono::sys_info const& x, hamon::chrono::sys_info const& y)
+{
+	return x.begin == y.begin && x.end == y.end && x.offset == y.offset &&
+		x.save == y.save && x.abbrev == y.abbrev;
+}
+
+HAMON_WARNING_PUSH()
+HAMON_WARNING_DISABLE_CLANG("-Woverlength-strings")
+
+// 組み込みのテキストを実行時に解析した tzdb
+inline void parse_builtin_tzdb(hamon::chrono::tzdb& db, hamon::chrono::detail::tz::rules_storage_type& rules)
+{
+	const char* s1 =
+#include <hamon/chrono/detail/tzdata.zi>
+	;
+	const char* s2 =
+#include <hamon/chrono/detail/leap-seconds.list>
+	;
+	std::istringstream tzdata(s1);
+	std::istringstream leap_seconds(s2);
+	hamon::chrono::detail::parse_tzdb(db, rules, tzdata, leap_seconds);
+}
+
+HAMON_WARNING_POP()
+
+GTEST_TEST(ChronoTest, CompiledTzdataTest)
+{
+	using namespace hamon::chrono;
+
+	// 静的な表から作った tzdb と、テキストを解析した tzdb は同じ内容になる
+	// (tzdata.zi を更新したのに compiled_tzdata.hpp を作り直していないと失敗する)
+	tzdb compiled;
+	detail::init_tzdb(compiled);
+
+	tzdb parsed;
+	detail::tz::rules_storage_type rules;
+	parse_builtin_tzdb(parsed, rules);
+
+	EXPECT_EQ(parsed.version, compiled.version);
+
+	ASSERT_EQ(parsed.links.size(), compiled.links.size());
+	for (hamon::size_t i = 0; i < parsed.links.size(); ++i)
+	{
+		EXPECT_EQ(parsed.links[i].name(),   compiled.links[i].name());
+		EXPECT_EQ(parsed.links[i].target(), compiled.links[i].target());
+	}
+
+	ASSERT_EQ(parsed.leap_seconds.size(), compiled.leap_seconds.size());
+	for (hamon::size_t i = 0; i < parsed.leap_seconds.size(); ++i)
+	{
+		EXPECT_TRUE(parsed.leap_seconds[i].date()  == compiled.leap_seconds[i].date());
+		EXPECT_TRUE(parsed.leap_seconds[i].value() == compiled.leap_seconds[i].value());
+	}
+
+	ASSERT_EQ(parsed.zones.size(), compiled.zones.size());
+	for (hamon::size_t i = 0; i < parsed.zones.size(); ++i)
+	{
+		auto const& p = parsed.zones[i];
+		auto const& c = compiled.zones[i];
+		ASSERT_EQ(p.name(), c.name());
+
+		// 遷移表の範囲内と範囲外の両方を調べる
+		for (int y = 1840; y <= 2400; y += (y < 2100 ? 7 : 100))
+		{
+			auto const m = static_cast<unsigned>(y % 12 + 1);
+			sys_seconds const st{ sys_days{ year{y} / month{m} / 1 } };
+			EXPECT_TRUE(equal(p.get_info(st), c.get_info(st))) << p.name() << " " << y << "/" << m;
+
+			local_seconds const lt{ st.time_since_epoch() };
+			auto const pl = p.get_info(lt);
+			auto const cl = c.get_info(lt);
+			EXPECT_EQ(pl.result, cl.result);
+			EXPECT_TRUE(equal(pl.first, cl.first));
+			EXPECT_TRUE(equal(pl.second, cl.second));
+		}
+	}
+}
+
+GTEST_TEST(ChronoTest, CompiledTzdataMoveTest)
+{
+	using namespace hamon::chrono;
+
+	tzdb db;
+	detail::init_tzdb(db);
+
+	// ムーブした後も、静的な表を参照したまま使える
+	auto const i1 = db.locate_zone("Asia/Tokyo")->get_info(sys_days{ year{2024} / 1 / 1 });
+	auto zones = hamon::move(db.zones);
+	time_zone const* tokyo = nullptr;
+	for (auto const& z : zones)
+	{
+		if (z.name() == "Asia/Tokyo")
+		{
+			tokyo = &z;
+		}
+	}
+	ASSERT_TRUE(tokyo != nullptr);
+	auto const i2 = tokyo->get_info(sys_days{ year{2024} / 1 / 1 });
+	EXPECT_TRUE(equal(i1, i2));
+	EXPECT_TRUE(i2.offset == hours{9});
+
+	hamon::string const name{ zones.back().name() };
+	auto const i3 = zones.back().get_info(sys_days{ year{2024} / 7 / 1 });
+	time_zone moved(hamon::move(zones.back()));
+	EXPECT_EQ(name, moved.name());
+	EXPECT_TRUE(equal(i3, moved.get_info(sys_days{ year{2024} / 7 / 1 })));
+}
+
+}	// namespace compiled_tzdata_test
+
+}	// namespace hamon_chrono_test
+
+#endif
@@ -0,0 +1,107 @@
+﻿/**
+ *	@file	unit_test_chrono_detail_leap_second_table.cpp
+ *
+ *	@brief	leap_second_table のテスト
+ */
+
+#include <hamon/chrono/config.hpp>
+
+#if !defined(HAMON_USE_STD_CHRONO)
+
+#include <hamon/chrono/detail/leap_second_table.hpp>
+#include <hamon/chrono/detail/private_ctor_tag.hpp>
+#include <hamon/chrono/leap_second.hpp>
+#include <hamon/chrono/sys_seconds.hpp>
+#include <hamon/chrono/sys_time.hpp>
+#include <hamon/chrono/duration.hpp>
+#include <hamon/vector.hpp>
+#include <gtest/gtest.h>
+
+namespace hamon_chrono_test
+{
+
+namespace leap_second_table_test
+{
+
+GTEST_TEST(ChronoTest, LeapSecondTableTest)
+{
+	namespace chrono = hamon::chrono;
+	using namespace hamon::chrono_literals;
+	using chrono::sys_seconds;
+
+	// 空の表
+	{
+		chrono::detail::leap_second_table const table({});
+		EXPECT_EQ(0u, table.size());
+		EXPECT_EQ(0u, table.sys_index(sys_seconds{ 100_s }));
+		EXPECT_EQ(0u, table.utc_index(sys_seconds{ 100_s }));
+		EXPECT_TRUE(table.elapsed(0) == 0_s);
+		EXPECT_FALSE(table.is_at(0, sys_seconds{ 100_s }));
+	}
+
+	// 負の閏秒を含む表
+	hamon::vector<chrono::leap_second> leap_seconds;
+	leap_seconds.emplace_back(chrono::detail::private_ctor_tag{}, sys_seconds{ 100_s },  1_s);
+	leap_seconds.emplace_back(chrono::detail::private_ctor_tag{}, sys_seconds{ 200_s },  1_s);
+	leap_seconds.emplace_back(chrono::detail::private_ctor_tag{}, sys_seconds{ 300_s }, -1_s);
+	leap_seconds.emplace_back(chrono::detail::private_ctor_tag{}, sys_seconds{ 400_s },  1_s);
+	chrono::detail::leap_second_table const table(leap_seconds);
+
+	EXPECT_EQ(4u, table.size());
+	EXPECT_TRUE(table.elapsed(0) == 0_s);
+	EXPECT_TRUE(table.elapsed(1) == 1_s);
+	EXPECT_TRUE(table.elapsed(2) == 2_s);
+	EXPECT_TRUE(table.elapsed(3) == 1_s);
+	EXPECT_TRUE(table.elapsed(4) == 2_s);
+
+	// sys 時刻 t 以前に挿入された閏秒の数
+	EXPECT_EQ(0u, table.sys_index(sys_seconds::min()));
+	EXPECT_EQ(0u, table.sys_index(sys_seconds{ 99_s }));
+	EXPECT_EQ(1u, table.sys_index(sys_seconds{ 100_s }));
+	EXPECT_EQ(1u, table.sys_index(chrono::sys_time<chrono::milliseconds>{ 199999_ms }));
+	EXPECT_EQ(2u, table.sys_index(chrono::sys_time<chrono::milliseconds>{ 200000_ms }));
+	EXPECT_EQ(3u, table.sys_index(sys_seconds{ 300_s }));
+	EXPECT_EQ(4u, table.sys_index(sys_seconds{ 400_s }));
+	EXPECT_EQ(4u, table.sys_index(sys_seconds::max()));
+
+	// hint が正しくなくても同じ結果になる
+	for (hamon::size_t hint = 0; hint <= 4; ++hint)
+	{
+		EXPECT_EQ(0u, table.sys_index(sys_seconds{ 50_s }, hint));
+		EXPECT_EQ(1u, table.sys_index(sys_seconds{ 150_s }, hint));
+		EXPECT_EQ(2u, table.sys_index(sys_seconds{ 250_s }, hint));
+		EXPECT_EQ(3u, table.sys_index(sys_seconds{ 350_s }, hint));
+		EXPECT_EQ(4u, table.sys_index(sys_seconds{ 450_s }, hint));
+	}
+
+	// utc 時刻での閏秒の位置は 100, 201, 302, 401
+	EXPECT_EQ(0u, table.utc_index(sys_seconds{ 100_s }));
+	EXPECT_TRUE(table.is_at(0, sys_seconds{ 100_s }));
+	EXPECT_EQ(1u, table.utc_index(sys_seconds{ 101_s }));
+	EXPECT_FALSE(table.is_at(1, sys_seconds{ 101_s }));
+	EXPECT_EQ(1u, table.utc_index(sys_seconds{ 201_s }));
+	EXPECT_TRUE(table.is_at(1, sys_seconds{ 201_s }));
+	EXPECT_EQ(2u, table.utc_index(sys_seconds{ 302_s }));
+	EXPECT_TRUE(table.is_at(2, sys_seconds{ 302_s }));
+	EXPECT_TRUE(table.value(2) == -1_s);
+	EXPECT_EQ(3u, table.utc_index(sys_seconds{ 303_s }));
+	EXPECT_EQ(3u, table.utc_index(sys_seconds{ 401_s }));
+	EXPECT_TRUE(table.is_at(3, sys_seconds{ 401_s }));
+	EXPECT_EQ(4u, table.utc_index(sys_seconds{ 402_s }));
+	EXPECT_FALSE(table.is_at(4, sys_seconds{ 402_s }));
+
+	for (hamon::size_t hint = 0; hint <= 4; ++hint)
+	{
+		EXPECT_EQ(0u, table.utc_index(sys_seconds{ 50_s }, hint));
+		EXPECT_EQ(1u, table.utc_index(sys_seconds{ 150_s }, hint));
+		EXPECT_EQ(2u, table.utc_index(sys_seconds{ 250_s }, hint));
+		EXPECT_EQ(3u, table.utc_index(sys_seconds{ 350_s }, hint));
+		EXPECT_EQ(4u, table.utc_index(sys_seconds{ 450_s }, hint));
+	}
+}
+
+}	// namespace leap_second_table_test
+
+}	// namespace hamon_chrono_test
+
+#endif
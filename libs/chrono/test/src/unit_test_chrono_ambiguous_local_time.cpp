@@ -0,0 +1,37 @@
+﻿/**
+ *	@file	unit_test_chrono_ambiguous_local_time.cpp
+ *
+ *	@brief	ambiguous_local_time のテスト
+ */
+
+#include <hamon/chrono/ambiguous_local_time.hpp>
+#include <hamon/chrono/local_info.hpp>
+#include <hamon/chrono/local_days.hpp>
+#include <hamon/chrono/locate_zone.hpp>
+#include <hamon/chrono/sys_days.hpp>
+#include <hamon/chrono/time_zone.hpp>
+#include <hamon/chrono/year.hpp>
+#include <hamon/chrono/year_month.hpp>
+#include <hamon/chrono/year_month_day.hpp>
+#include <hamon/chrono/duration.hpp>
+#include <hamon/stdexcept/runtime_error.hpp>
+#include <hamon/type_traits/is_base_of.hpp>
+#include <gtest/gtest.h>
+#include <string>
+
+GTEST_TEST(ChronoTest, AmbiguousLocalTimeTest)
+{
+	using namespace hamon::chrono;
+
+	static_assert(hamon::is_base_of<hamon::runtime_error, ambiguous_local_time>::value, "");
+
+	auto const lt = local_days{year{2016}/11/6} + hours{1} + minutes{30};
+	auto const i = locate_zone("America/New_York")->get_info(lt);
+	EXPECT_TRUE(i.result == local_info::ambiguous);
+
+	ambiguous_local_time const ex(lt, i);
+	EXPECT_EQ(std::string(
+		"2016-11-06 01:30:00 is ambiguous.  It could be\n"
+		"2016-11-06 01:30:00 EDT == 2016-11-06 05:30:00 UTC or\n"
+		"2016-11-06 01:30:00 EST == 2016-11-06 06:30:00 UTC"), ex.what());
+}
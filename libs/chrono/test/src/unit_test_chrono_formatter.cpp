@@ -0,0 +1,144 @@
+﻿/**
+ *	@file	unit_test_chrono_formatter.cpp
+ *
+ *	@brief	chrono の型の formatter のテスト
+ */
+
+#include <hamon/chrono/formatter.hpp>
+#include <hamon/chrono.hpp>
+#include <hamon/format/format.hpp>
+#include <hamon/format/format_error.hpp>
+#include <hamon/format/format_to_n.hpp>
+#include <hamon/format/formatted_size.hpp>
+#include <hamon/format/runtime_format.hpp>
+#include <hamon/ratio.hpp>
+#include <hamon/string.hpp>
+#include <gtest/gtest.h>
+
+#if !defined(HAMON_USE_STD_CHRONO)
+
+namespace hamon_chrono_test
+{
+
+namespace formatter_test
+{
+
+GTEST_TEST(ChronoFormatterTest, DurationTest)
+{
+	using namespace hamon::chrono;
+	EXPECT_EQ("42s", hamon::format("{}", seconds{42}));
+	EXPECT_EQ("-1500ms", hamon::format("{}", milliseconds{-1500}));
+	EXPECT_EQ("1.5ms", hamon::format("{}", duration<double, hamon::milli>{1.5}));
+	EXPECT_EQ("1.250s", hamon::format("{:.3}", duration<double>{1.25}));
+	EXPECT_EQ("3min", hamon::format("{}", duration<int, hamon::ratio<60>>{3}));
+	EXPECT_EQ("3[3/7]s", hamon::format("{}", duration<int, hamon::ratio<3, 7>>{3}));
+	EXPECT_EQ("3[30]s", hamon::format("{}", duration<int, hamon::ratio<30>>{3}));
+	EXPECT_EQ("01:03:04", hamon::format("{:%H:%M:%S}", hours{25} + minutes{3} + seconds{4}));
+	EXPECT_EQ("2 01:00:00.003", hamon::format("{:%j %T}", hours{49} + milliseconds{3}));
+	EXPECT_EQ("-00:03:04", hamon::format("{:%T}", -(minutes{3} + seconds{4})));
+	EXPECT_EQ("7 us", hamon::format("{:%Q %q}", microseconds{7}));
+	EXPECT_EQ("  42s", hamon::format("{:>5}", seconds{42}));
+}
+
+GTEST_TEST(ChronoFormatterTest, CalendarTest)
+{
+	using namespace hamon::chrono;
+	EXPECT_EQ("05", hamon::format("{}", day{5}));
+	EXPECT_EQ("00 is not a valid day", hamon::format("{}", day{0}));
+	EXPECT_EQ(" 5", hamon::format("{:%e}", day{5}));
+	EXPECT_EQ("Feb", hamon::format("{}", month{2}));
+	EXPECT_EQ("13 is not a valid month", hamon::format("{}", month{13}));
+	EXPECT_EQ("11 Nov", hamon::format("{:%m %b}", month{11}));
+	EXPECT_EQ("2024", hamon::format("{}", year{2024}));
+	EXPECT_EQ("-0005", hamon::format("{}", year{-5}));
+	EXPECT_EQ("-32768 is not a valid year", hamon::format("{}", year{-32768}));
+	EXPECT_EQ("-0001 -01 99", hamon::format("{:%Y %C %y}", year{-1}));
+	EXPECT_EQ("Wed", hamon::format("{}", weekday{3}));
+	EXPECT_EQ("9 is not a valid weekday", hamon::format("{}", weekday{9}));
+	EXPECT_EQ("Mon[2]", hamon::format("{}", weekday_indexed{weekday{1}, 2}));
+	EXPECT_EQ("Mon[7 is not a valid index]", hamon::format("{}", weekday_indexed{weekday{1}, 7}));
+	EXPECT_EQ("Sun[last]", hamon::format("{}", weekday_last{weekday{0}}));
+	EXPECT_EQ("Mar/14", hamon::format("{}", month_day{month{3}, day{14}}));
+	EXPECT_EQ("Feb/last", hamon::format("{}", month_day_last{month{2}}));
+	EXPECT_EQ("Mar/Fri[1]", hamon::format("{}", month_weekday{month{3}, weekday_indexed{weekday{5}, 1}}));
+	EXPECT_EQ("Mar/Fri[last]", hamon::format("{}", month_weekday_last{month{3}, weekday_last{weekday{5}}}));
+	EXPECT_EQ("2024/Jul", hamon::format("{}", year_month{year{2024}, month{7}}));
+	EXPECT_EQ("2024-02-29", hamon::format("{}", year_month_day{year{2024}, month{2}, day{29}}));
+	EXPECT_EQ("2023-02-29 is not a valid date", hamon::format("{}", year_month_day{year{2023}, month{2}, day{29}}));
+	EXPECT_EQ("2024/Feb/last", hamon::format("{}", year_month_day_last{year{2024}, month_day_last{month{2}}}));
+	EXPECT_EQ("2024/Mar/Sun[2]", hamon::format("{}", year_month_weekday{year{2024}, month{3}, weekday_indexed{weekday{0}, 2}}));
+	EXPECT_EQ("2024/Mar/Sun[last]", hamon::format("{}", year_month_weekday_last{year{2024}, month{3}, weekday_last{weekday{0}}}));
+}
+
+GTEST_TEST(ChronoFormatterTest, HhMmSsTest)
+{
+	using namespace hamon::chrono;
+	EXPECT_EQ("01:02:03.004", hamon::format("{}", hh_mm_ss<milliseconds>{milliseconds{3723004}}));
+	EXPECT_EQ("-00:01:01", hamon::format("{}", hh_mm_ss<seconds>{seconds{-61}}));
+}
+
+GTEST_TEST(ChronoFormatterTest, TimePointTest)
+{
+	using namespace hamon::chrono;
+	sys_days const sd = year_month_day{year{2024}, month{12}, day{30}};
+	EXPECT_EQ("2024-12-30", hamon::format("{}", sd));
+	EXPECT_EQ("2024-12-30 13:05:07", hamon::format("{}", sd + hours{13} + minutes{5} + seconds{7}));
+	EXPECT_EQ("2024-12-30 00:00:00.000012", hamon::format("{}", sys_time<microseconds>{sd.time_since_epoch()} + microseconds{12}));
+	EXPECT_EQ("Mon Monday Dec December Dec 20 24 2024 12 30 30 365 1 1",
+		hamon::format("{:%a %A %b %B %h %C %y %Y %m %d %e %j %u %w}", sd));
+	EXPECT_EQ("52 53 01 2025 25", hamon::format("{:%U %W %V %G %g}", sd));
+	EXPECT_EQ("00 00 53 2020 20", hamon::format("{:%U %W %V %G %g}", sys_days{year_month_day{year{2021}, month{1}, day{1}}}));
+	EXPECT_EQ("12/30/24|2024-12-30|12/30/24|Mon Dec 30 15:00:00 2024", hamon::format("{:%D|%F|%x|%c}", sd + hours{15}));
+	EXPECT_EQ("03 PM 03:04:05 PM 15:04 15:04:05 15:04:05", hamon::format("{:%I %p %r %R %T %X}", sd + hours{15} + minutes{4} + seconds{5}));
+	EXPECT_EQ("12 AM", hamon::format("{:%I %p}", sd));
+	EXPECT_EQ("+0000 +00:00 +00:00 UTC %\n\t.", hamon::format("{:%z %Ez %Oz %Z %%%n%t.}", sd));
+	EXPECT_EQ("2024 30 00", hamon::format("{:%EY %Od %OH}", sd));
+	EXPECT_EQ("               2024-12-30", hamon::format("{:>25%F}", sd));
+	EXPECT_EQ("**2024-12-30**", hamon::format("{:*^{}%F}", sd, 14));
+	EXPECT_EQ(L"2024-12-30 00:00:00", hamon::format(L"{:%F %T}", sd));
+
+	EXPECT_EQ("2000-01-01 01:30:00", hamon::format("{}", local_days{year_month_day{year{2000}, month{1}, day{1}}} + minutes{90}));
+}
+
+GTEST_TEST(ChronoFormatterTest, ClockTest)
+{
+	using namespace hamon::chrono;
+	auto const leap = utc_clock::from_sys(sys_days{year_month_day{year{2017}, month{1}, day{1}}});
+	EXPECT_EQ("2016-12-31 23:59:60", hamon::format("{}", leap - seconds{1}));
+	EXPECT_EQ("2016-12-31 23:59:59", hamon::format("{}", leap - seconds{2}));
+
+	sys_days const sd = year_month_day{year{2024}, month{12}, day{30}};
+	EXPECT_EQ("2024-12-30 00:00:37 TAI", hamon::format("{:%F %T %Z}", tai_clock::from_utc(utc_clock::from_sys(sd))));
+	EXPECT_EQ("2024-12-30 00:00:18 GPS", hamon::format("{:%F %T %Z}", gps_clock::from_utc(utc_clock::from_sys(sd))));
+}
+
+GTEST_TEST(ChronoFormatterTest, FormatToNTest)
+{
+	using namespace hamon::chrono;
+	sys_days const sd = year_month_day{year{2024}, month{12}, day{30}};
+	char buf[8]{};
+	auto r = hamon::format_to_n(buf, 8, "{}", sd);
+	EXPECT_EQ(10, r.size);
+	EXPECT_EQ(hamon::string("2024-12-"), hamon::string(buf, r.out));
+	EXPECT_EQ(24u, hamon::formatted_size("{:%c}", sd));
+}
+
+GTEST_TEST(ChronoFormatterTest, ErrorTest)
+{
+	using namespace hamon::chrono;
+	sys_days const sd = year_month_day{year{2024}, month{12}, day{30}};
+	EXPECT_THROW((void)hamon::format(hamon::runtime_format("{:%a}"), weekday{9}), hamon::format_error);
+	EXPECT_THROW((void)hamon::format(hamon::runtime_format("{:%Y}"), day{9}), hamon::format_error);
+	EXPECT_THROW((void)hamon::format(hamon::runtime_format("{:%Z}"), local_days{}), hamon::format_error);
+	EXPECT_THROW((void)hamon::format(hamon::runtime_format("{:%Ea}"), sd), hamon::format_error);
+	EXPECT_THROW((void)hamon::format(hamon::runtime_format("{:.3%T}"), seconds{1}), hamon::format_error);
+	EXPECT_THROW((void)hamon::format(hamon::runtime_format("{:F}"), sd), hamon::format_error);
+	EXPECT_THROW((void)hamon::format(hamon::runtime_format("{:%"), sd), hamon::format_error);
+	EXPECT_THROW((void)hamon::format(hamon::runtime_format("{:%Q}"), sd), hamon::format_error);
+}
+
+}	// namespace formatter_test
+
+}	// namespace hamon_chrono_test
+
+#endif
@@ -0,0 +1,267 @@
+﻿/**
+ *	@file	unit_test_chrono_from_chars.cpp
+ *
+ *	@brief	from_chars のテスト
+ */
+
+#include <hamon/chrono/from_chars.hpp>
+#include <hamon/chrono/year_month_day.hpp>
+#include <hamon/chrono/hh_mm_ss.hpp>
+#include <hamon/chrono/duration.hpp>
+#include <hamon/chrono/sys_time.hpp>
+#include <hamon/chrono/sys_days.hpp>
+#include <hamon/ratio.hpp>
+#include <hamon/string_view.hpp>
+#include <hamon/system_error/errc.hpp>
+#include <hamon/config.hpp>
+#include <gtest/gtest.h>
+#include "constexpr_test.hpp"
+
+namespace hamon_chrono_test
+{
+
+namespace from_chars_test
+{
+
+#define VERIFY(...)	if (!(__VA_ARGS__)) { return false; }
+
+// s 全体を読めたときだけ true を返す
+template <typename T>
+bool from_string(hamon::string_view s, T& x)
+{
+	auto const r = hamon::chrono::from_chars(s.data(), s.data() + s.size(), x);
+	return r.ec == hamon::errc{} && r.ptr == s.data() + s.size();
+}
+
+template <typename T>
+bool equal(T const& x, T const& y)
+{
+	return x == y;
+}
+
+template <typename Duration>
+bool equal(hamon::chrono::hh_mm_ss<Duration> const& x, hamon::chrono::hh_mm_ss<Duration> const& y)
+{
+	return x.to_duration() == y.to_duration();
+}
+
+// 読めなかったときは {first, invalid_argument} を返し、x は変更しない
+template <typename T>
+bool fails(hamon::string_view s, T x)
+{
+	T const old = x;
+	auto const r = hamon::chrono::from_chars(s.data(), s.data() + s.size(), x);
+	return r.ec == hamon::errc::invalid_argument && r.ptr == s.data() && equal(x, old);
+}
+
+inline HAMON_CXX14_CONSTEXPR bool
+test_year_month_day_constexpr()
+{
+	using namespace hamon::chrono;
+	char const s[] = "2024-02-29T";
+	year_month_day ymd{};
+	auto const r = hamon::chrono::from_chars(s, s + 11, ymd);
+	VERIFY(r.ec == hamon::errc{});
+	VERIFY(r.ptr == s + 10);
+	VERIFY(ymd == year_month_day{year{2024}, month{2}, day{29}});
+	return true;
+}
+
+GTEST_TEST(ChronoTest, FromCharsYearMonthDayTest)
+{
+	using namespace hamon::chrono;
+
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(test_year_month_day_constexpr());
+
+	year_month_day ymd{};
+	EXPECT_TRUE(from_string("1970-01-01", ymd));
+	EXPECT_EQ(year_month_day(year{1970}, month{1}, day{1}), ymd);
+	EXPECT_TRUE(from_string("-0001-12-31", ymd));
+	EXPECT_EQ(year_month_day(year{-1}, month{12}, day{31}), ymd);
+	EXPECT_TRUE(from_string("+12345-06-07", ymd));
+	EXPECT_EQ(year_month_day(year{12345}, month{6}, day{7}), ymd);
+	EXPECT_TRUE(from_string("2000-02-29", ymd));
+	EXPECT_EQ(year_month_day(year{2000}, month{2}, day{29}), ymd);
+
+	EXPECT_TRUE(fails("", ymd));
+	EXPECT_TRUE(fails("197-01-01", ymd));
+	EXPECT_TRUE(fails("123456-01-01", ymd));
+	EXPECT_TRUE(fails("32768-01-01", ymd));
+	EXPECT_TRUE(fails("1970-1-01", ymd));
+	EXPECT_TRUE(fails("1970/01/01", ymd));
+	EXPECT_TRUE(fails("1970-01-0", ymd));
+	EXPECT_TRUE(fails("1970-00-01", ymd));
+	EXPECT_TRUE(fails("1970-13-01", ymd));
+	EXPECT_TRUE(fails("1970-01-00", ymd));
+	EXPECT_TRUE(fails("1970-01-32", ymd));
+	EXPECT_TRUE(fails("1970-04-31", ymd));
+	EXPECT_TRUE(fails("1900-02-29", ymd));
+	EXPECT_TRUE(fails("1970-0a-01", ymd));
+}
+
+GTEST_TEST(ChronoTest, FromCharsHhMmSsTest)
+{
+	using namespace hamon::chrono;
+
+	{
+		hh_mm_ss<seconds> hms{};
+		EXPECT_TRUE(from_string("01:02:03", hms));
+		EXPECT_EQ(seconds{3723}, hms.to_duration());
+		EXPECT_TRUE(from_string("-01:02:03", hms));
+		EXPECT_EQ(seconds{-3723}, hms.to_duration());
+		EXPECT_TRUE(from_string("123:00:00", hms));
+		EXPECT_EQ(seconds{123 * 3600}, hms.to_duration());
+
+		// 小数部は読んで切り捨てる
+		EXPECT_TRUE(from_string("00:00:01.999", hms));
+		EXPECT_EQ(seconds{1}, hms.to_duration());
+
+		EXPECT_TRUE(fails("", hms));
+		EXPECT_TRUE(fails("1:02:03", hms));
+		EXPECT_TRUE(fails("01:2:03", hms));
+		EXPECT_TRUE(fails("01:60:00", hms));
+		EXPECT_TRUE(fails("01:00:60", hms));
+		EXPECT_TRUE(fails("01-00-00", hms));
+		EXPECT_TRUE(fails("-", hms));
+	}
+	{
+		hh_mm_ss<milliseconds> hms{};
+		EXPECT_TRUE(from_string("01:02:03.004", hms));
+		EXPECT_EQ(milliseconds{3723004}, hms.to_duration());
+		EXPECT_TRUE(from_string("01:02:03,5", hms));
+		EXPECT_EQ(milliseconds{3723500}, hms.to_duration());
+		EXPECT_TRUE(from_string("00:00:00.0019", hms));
+		EXPECT_EQ(milliseconds{1}, hms.to_duration());
+		EXPECT_TRUE(from_string("-00:00:00.250", hms));
+		EXPECT_EQ(milliseconds{-250}, hms.to_duration());
+		EXPECT_TRUE(fails("00:00:00.", hms));
+	}
+	{
+		hh_mm_ss<nanoseconds> hms{};
+		EXPECT_TRUE(from_string("23:59:59.999999999", hms));
+		EXPECT_EQ(nanoseconds{86399999999999}, hms.to_duration());
+	}
+	{
+		hh_mm_ss<minutes> hms{};
+		EXPECT_TRUE(from_string("01:02:59", hms));
+		EXPECT_EQ(minutes{62}, hms.to_duration());
+	}
+}
+
+GTEST_TEST(ChronoTest, FromCharsDurationTest)
+{
+	using namespace hamon::chrono;
+
+	{
+		milliseconds d{};
+		EXPECT_TRUE(from_string("42ms", d));
+		EXPECT_EQ(milliseconds{42}, d);
+		EXPECT_TRUE(from_string("-7ms", d));
+		EXPECT_EQ(milliseconds{-7}, d);
+
+		EXPECT_TRUE(fails("", d));
+		EXPECT_TRUE(fails("ms", d));
+		EXPECT_TRUE(fails("42", d));
+		EXPECT_TRUE(fails("42s", d));
+		EXPECT_TRUE(fails("42m", d));
+		EXPECT_TRUE(fails("42us", d));
+	}
+	{
+		minutes d{};
+		EXPECT_TRUE(from_string("3min", d));
+		EXPECT_EQ(minutes{3}, d);
+	}
+	{
+		weeks d{};
+		EXPECT_TRUE(from_string("5[604800]s", d));
+		EXPECT_EQ(weeks{5}, d);
+	}
+	{
+		duration<int, hamon::ratio<1, 3>> d{};
+		EXPECT_TRUE(from_string("12[1/3]s", d));
+		EXPECT_EQ(12, d.count());
+		EXPECT_TRUE(fails("12[1/4]s", d));
+	}
+}
+
+GTEST_TEST(ChronoTest, FromCharsSysTimeTest)
+{
+	using namespace hamon::chrono;
+
+	{
+		sys_seconds tp{};
+		EXPECT_TRUE(from_string("1970-01-01T00:00:00Z", tp));
+		EXPECT_EQ(sys_seconds{seconds{0}}, tp);
+		EXPECT_TRUE(from_string("2000-01-01T01:02:03Z", tp));
+		EXPECT_EQ(sys_seconds{seconds{946688523}}, tp);
+		EXPECT_TRUE(from_string("2000-01-01 01:02:03", tp));
+		EXPECT_EQ(sys_seconds{seconds{946688523}}, tp);
+		EXPECT_TRUE(from_string("2000-01-01t01:02:03z", tp));
+		EXPECT_EQ(sys_seconds{seconds{946688523}}, tp);
+		EXPECT_TRUE(from_string("1969-12-31T23:59:59Z", tp));
+		EXPECT_EQ(sys_seconds{seconds{-1}}, tp);
+		EXPECT_TRUE(from_string("2000-01-01", tp));
+		EXPECT_EQ(sys_seconds{seconds{946684800}}, tp);
+
+		// UTC からのずれ
+		EXPECT_TRUE(from_string("2000-01-01T10:02:03+09:00", tp));
+		EXPECT_EQ(sys_seconds{seconds{946688523}}, tp);
+		EXPECT_TRUE(from_string("1999-12-31T20:32:03-0430", tp));
+		EXPECT_EQ(sys_seconds{seconds{946688523}}, tp);
+
+		// 閏秒は 59 秒として読む
+		EXPECT_TRUE(from_string("2016-12-31T23:59:60Z", tp));
+		EXPECT_EQ(sys_seconds{seconds{1483228799}}, tp);
+
+		// 小数部は切り捨てる
+		EXPECT_TRUE(from_string("2000-01-01T01:02:03.999Z", tp));
+		EXPECT_EQ(sys_seconds{seconds{946688523}}, tp);
+
+		// " " の後が時刻でなければ日付だけを読む
+		{
+			auto const s = hamon::string_view("2000-01-01 foo");
+			auto const r = hamon::chrono::from_chars(s.data(), s.data() + s.size(), tp);
+			EXPECT_TRUE(r.ec == hamon::errc{});
+			EXPECT_TRUE(r.ptr == s.data() + 10);
+			EXPECT_EQ(sys_seconds{seconds{946684800}}, tp);
+		}
+
+		EXPECT_TRUE(fails("", tp));
+		EXPECT_TRUE(fails("2000-01-01T", tp));
+		EXPECT_TRUE(fails("2000-01-01T24:00:00Z", tp));
+		EXPECT_TRUE(fails("2000-01-01T00:60:00Z", tp));
+		EXPECT_TRUE(fails("2000-01-01T00:00:61Z", tp));
+		EXPECT_TRUE(fails("2000-01-01T00:00:00.Z", tp));
+		EXPECT_TRUE(fails("2000-01-01T00:00:00+9", tp));
+		EXPECT_TRUE(fails("2000-01-01T00:00:00+24:00", tp));
+		EXPECT_TRUE(fails("2000-02-30T00:00:00Z", tp));
+	}
+	{
+		sys_time<milliseconds> tp{};
+		EXPECT_TRUE(from_string("2000-01-01T01:02:03.004Z", tp));
+		EXPECT_EQ(sys_time<milliseconds>{milliseconds{946688523004}}, tp);
+		EXPECT_TRUE(from_string("2000-01-01T01:02:03.0049Z", tp));
+		EXPECT_EQ(sys_time<milliseconds>{milliseconds{946688523004}}, tp);
+		EXPECT_TRUE(from_string("2000-01-01T01:02:03,5Z", tp));
+		EXPECT_EQ(sys_time<milliseconds>{milliseconds{946688523500}}, tp);
+	}
+	{
+		sys_time<nanoseconds> tp{};
+		EXPECT_TRUE(from_string("1969-12-31T23:59:59.999999999Z", tp));
+		EXPECT_EQ(sys_time<nanoseconds>{nanoseconds{-1}}, tp);
+	}
+	{
+		sys_days tp{};
+		EXPECT_TRUE(from_string("2023-12-31", tp));
+		EXPECT_EQ(sys_days{days{19722}}, tp);
+		// 時刻は切り捨てる
+		EXPECT_TRUE(from_string("1969-12-31T12:00:00Z", tp));
+		EXPECT_EQ(sys_days{days{-1}}, tp);
+	}
+}
+
+#undef VERIFY
+
+}	// namespace from_chars_test
+
+}	// namespace hamon_chrono_test
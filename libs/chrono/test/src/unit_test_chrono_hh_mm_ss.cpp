@@ -8,6 +8,7 @@
 #include <hamon/type_traits.hpp>
 #include <hamon/utility/declval.hpp>
 #include <gtest/gtest.h>
+#include <sstream>
 #include "constexpr_test.hpp"
 
 namespace hamon_chrono_test
@@ -309,6 +310,31 @@ GTEST_TEST(ChronoTest, HHMMSSTest)
 	HAMON_CXX11_CONSTEXPR_EXPECT_TRUE( check_duration(microfortnights(-10000)) == -120960000);
 }
 
+GTEST_TEST(ChronoTest, HHMMSSOStreamTest)
+{
+	using namespace hamon::chrono;
+	{
+		std::stringstream ss;
+		ss << hh_mm_ss<seconds>{seconds{3723}};
+		EXPECT_EQ("01:02:03", ss.str());
+	}
+	{
+		std::stringstream ss;
+		ss << hh_mm_ss<milliseconds>{milliseconds{-3723004}};
+		EXPECT_EQ("-01:02:03.004", ss.str());
+	}
+	{
+		std::stringstream ss;
+		ss << hh_mm_ss<hours>{hours{123}};
+		EXPECT_EQ("123:00:00", ss.str());
+	}
+	{
+		std::wstringstream ss;
+		ss << hh_mm_ss<microseconds>{microseconds{12}};
+		EXPECT_EQ(L"00:00:00.000012", ss.str());
+	}
+}
+
 }	// namespace hh_mm_ss_test
 
 }	// namespace hamon_chrono_test
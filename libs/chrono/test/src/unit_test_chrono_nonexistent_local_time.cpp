@@ -0,0 +1,46 @@
+﻿/**
+ *	@file	unit_test_chrono_nonexistent_local_time.cpp
+ *
+ *	@brief	nonexistent_local_time のテスト
+ */
+
+#include <hamon/chrono/nonexistent_local_time.hpp>
+#include <hamon/chrono/local_info.hpp>
+#include <hamon/chrono/local_days.hpp>
+#include <hamon/chrono/locate_zone.hpp>
+#include <hamon/chrono/sys_days.hpp>
+#include <hamon/chrono/time_zone.hpp>
+#include <hamon/chrono/year.hpp>
+#include <hamon/chrono/year_month.hpp>
+#include <hamon/chrono/year_month_day.hpp>
+#include <hamon/chrono/duration.hpp>
+#include <hamon/stdexcept/runtime_error.hpp>
+#include <hamon/type_traits/is_base_of.hpp>
+#include <gtest/gtest.h>
+#include <string>
+
+GTEST_TEST(ChronoTest, NonexistentLocalTimeTest)
+{
+	using namespace hamon::chrono;
+
+	static_assert(hamon::is_base_of<hamon::runtime_error, nonexistent_local_time>::value, "");
+
+	auto const lt = local_days{year{2016}/3/13} + hours{2} + minutes{30};
+	auto const i = locate_zone("America/New_York")->get_info(lt);
+	EXPECT_TRUE(i.result == local_info::nonexistent);
+
+	nonexistent_local_time const ex(lt, i);
+	EXPECT_EQ(std::string(
+		"2016-03-13 02:30:00 is in a gap between\n"
+		"2016-03-13 02:00:00 EST and\n"
+		"2016-03-13 03:00:00 EDT which are both equivalent to\n"
+		"2016-03-13 07:00:00 UTC"), ex.what());
+
+	// 秒より細かい時刻
+	nonexistent_local_time const ex2(local_time<milliseconds>{lt} + milliseconds{250}, i);
+	EXPECT_EQ(std::string(
+		"2016-03-13 02:30:00 is in a gap between\n"
+		"2016-03-13 02:00:00 EST and\n"
+		"2016-03-13 03:00:00 EDT which are both equivalent to\n"
+		"2016-03-13 07:00:00 UTC"), ex2.what());
+}
@@ -0,0 +1,72 @@
+﻿/**
+ *	@file	unit_test_chrono_parse_sys_times.cpp
+ *
+ *	@brief	parse_sys_times のテスト
+ */
+
+#include <hamon/chrono/parse_sys_times.hpp>
+#include <hamon/chrono/duration.hpp>
+#include <hamon/chrono/sys_time.hpp>
+#include <hamon/span.hpp>
+#include <hamon/string_view.hpp>
+#include <hamon/config.hpp>
+#include <gtest/gtest.h>
+
+namespace hamon_chrono_test
+{
+
+namespace parse_sys_times_test
+{
+
+GTEST_TEST(ChronoTest, ParseSysTimesTest)
+{
+	using namespace hamon::chrono;
+	using tp_type = sys_time<milliseconds>;
+
+	{
+		hamon::string_view const in[] =
+		{
+			"2000-01-01T00:00:00.000Z",
+			"2000-01-01T00:00:00.001Z",
+			"2000-01-01T23:59:59.999Z",
+			"2000-01-02T00:00:00Z",
+			"2000-01-02 09:00:00+09:00",
+		};
+		tp_type out[5]{};
+		auto const n = parse_sys_times(
+			hamon::span<hamon::string_view const>{in},
+			hamon::span<tp_type>{out});
+		EXPECT_EQ(5u, n);
+		EXPECT_EQ(tp_type{milliseconds{946684800000}}, out[0]);
+		EXPECT_EQ(tp_type{milliseconds{946684800001}}, out[1]);
+		EXPECT_EQ(tp_type{milliseconds{946771199999}}, out[2]);
+		EXPECT_EQ(tp_type{milliseconds{946771200000}}, out[3]);
+		EXPECT_EQ(tp_type{milliseconds{946771200000}}, out[4]);
+	}
+	{
+		// 読めない文字列の位置を返し、それ以降は変更しない
+		hamon::string_view const in[] =
+		{
+			"2000-01-01T00:00:00Z",
+			"2000-01-01T00:00:00Zxyz",
+			"2000-01-01T00:00:00Z",
+		};
+		tp_type out[3]{};
+		auto const n = parse_sys_times(
+			hamon::span<hamon::string_view const>{in},
+			hamon::span<tp_type>{out});
+		EXPECT_EQ(1u, n);
+		EXPECT_EQ(tp_type{milliseconds{946684800000}}, out[0]);
+		EXPECT_EQ(tp_type{}, out[1]);
+		EXPECT_EQ(tp_type{}, out[2]);
+	}
+	{
+		hamon::span<hamon::string_view const> in{};
+		hamon::span<tp_type> out{};
+		EXPECT_EQ(0u, parse_sys_times(in, out));
+	}
+}
+
+}	// namespace parse_sys_times_test
+
+}	// namespace hamon_chrono_test
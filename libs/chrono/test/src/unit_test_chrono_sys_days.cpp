@@ -7,13 +7,29 @@
 #include <hamon/chrono/sys_days.hpp>
 #include <hamon/config.hpp>
 #include <gtest/gtest.h>
+#include <sstream>
 
 namespace hamon_chrono_test
 {
 
 GTEST_TEST(ChronoTest, SysDaysTest)
 {
-	// TODO
+	using namespace hamon::chrono;
+	{
+		std::stringstream ss;
+		ss << sys_days{days{0}};
+		EXPECT_EQ("1970-01-01", ss.str());
+	}
+	{
+		std::stringstream ss;
+		ss << sys_days{days{19722}};
+		EXPECT_EQ("2023-12-31", ss.str());
+	}
+	{
+		std::wstringstream ss;
+		ss << sys_days{days{-1}};
+		EXPECT_EQ(L"1969-12-31", ss.str());
+	}
 }
 
 }	// namespace hamon_chrono_test
@@ -8,6 +8,7 @@
 #include <hamon/chrono/duration.hpp>
 #include <hamon/config.hpp>
 #include <gtest/gtest.h>
+#include <iomanip>
 #include <sstream>
 
 namespace hamon_chrono_test
@@ -15,7 +16,6 @@ namespace hamon_chrono_test
 
 GTEST_TEST(ChronoTest, SysSecondsTest)
 {
-#if 0	// TODO
 	namespace chrono = hamon::chrono;
 	using namespace hamon::chrono_literals;
 	{
@@ -25,15 +25,29 @@ GTEST_TEST(ChronoTest, SysSecondsTest)
 	}
 	{
 		std::stringstream ss;
-		ss << chrono::sys_seconds{946'684'800_s};
+		ss << chrono::sys_seconds{946684800_s};
 		EXPECT_EQ("2000-01-01 00:00:00", ss.str());
 	}
 	{
 		std::stringstream ss;
-		ss << chrono::sys_seconds{946'688'523_s};
+		ss << chrono::sys_seconds{946688523_s};
 		EXPECT_EQ("2000-01-01 01:02:03", ss.str());
 	}
-#endif
+	{
+		std::stringstream ss;
+		ss << chrono::sys_seconds{-1_s};
+		EXPECT_EQ("1969-12-31 23:59:59", ss.str());
+	}
+	{
+		std::stringstream ss;
+		ss << chrono::sys_time<chrono::milliseconds>{chrono::milliseconds{946688523004}};
+		EXPECT_EQ("2000-01-01 01:02:03.004", ss.str());
+	}
+	{
+		std::wstringstream ss;
+		ss << std::setw(21) << chrono::sys_seconds{0_s};
+		EXPECT_EQ(L"  1970-01-01 00:00:00", ss.str());
+	}
 }
 
 }	// namespace hamon_chrono_test
@@ -0,0 +1,80 @@
+﻿/**
+ *	@file	unit_test_chrono_sys_time_reader.cpp
+ *
+ *	@brief	sys_time_reader のテスト
+ */
+
+#include <hamon/chrono/sys_time_reader.hpp>
+#include <hamon/chrono/duration.hpp>
+#include <hamon/chrono/sys_time.hpp>
+#include <hamon/string_view.hpp>
+#include <hamon/system_error/errc.hpp>
+#include <hamon/config.hpp>
+#include <gtest/gtest.h>
+
+namespace hamon_chrono_test
+{
+
+namespace sys_time_reader_test
+{
+
+template <typename Duration>
+bool from_string(
+	hamon::chrono::sys_time_reader<Duration>& reader,
+	hamon::string_view s,
+	hamon::chrono::sys_time<Duration>& tp)
+{
+	auto const r = reader.from_chars(s.data(), s.data() + s.size(), tp);
+	return r.ec == hamon::errc{} && r.ptr == s.data() + s.size();
+}
+
+GTEST_TEST(ChronoTest, SysTimeReaderTest)
+{
+	using namespace hamon::chrono;
+
+	{
+		sys_time_reader<seconds> reader;
+		sys_seconds tp{};
+		// 同じ日付が続く
+		EXPECT_TRUE(from_string(reader, "2000-01-01T00:00:00Z", tp));
+		EXPECT_EQ(sys_seconds{seconds{946684800}}, tp);
+		EXPECT_TRUE(from_string(reader, "2000-01-01T01:02:03Z", tp));
+		EXPECT_EQ(sys_seconds{seconds{946688523}}, tp);
+		EXPECT_TRUE(from_string(reader, "2000-01-01 23:59:59", tp));
+		EXPECT_EQ(sys_seconds{seconds{946771199}}, tp);
+		EXPECT_TRUE(from_string(reader, "2000-01-01", tp));
+		EXPECT_EQ(sys_seconds{seconds{946684800}}, tp);
+		// 日付が変わる
+		EXPECT_TRUE(from_string(reader, "2000-01-02T00:00:00Z", tp));
+		EXPECT_EQ(sys_seconds{seconds{946771200}}, tp);
+		// 覚えている日付の後の時刻が正しくなければ読めない
+		EXPECT_FALSE(from_string(reader, "2000-01-02T25:00:00Z", tp));
+		EXPECT_EQ(sys_seconds{seconds{946771200}}, tp);
+		// 正しくない日付は覚えない
+		EXPECT_FALSE(from_string(reader, "2000-02-30T00:00:00Z", tp));
+		EXPECT_FALSE(from_string(reader, "2000-02-30T00:00:00Z", tp));
+		EXPECT_TRUE(from_string(reader, "2000-01-02T00:00:01Z", tp));
+		EXPECT_EQ(sys_seconds{seconds{946771201}}, tp);
+		// 年の桁数が違うときは別の日付
+		EXPECT_TRUE(from_string(reader, "+2000-01-02T00:00:01Z", tp));
+		EXPECT_EQ(sys_seconds{seconds{946771201}}, tp);
+		EXPECT_TRUE(from_string(reader, "-2000-01-02T00:00:01Z", tp));
+		EXPECT_EQ(sys_seconds{seconds{-125281036799}}, tp);
+		// 日付の文字列より短い
+		EXPECT_FALSE(from_string(reader, "-2000-01-0", tp));
+	}
+	{
+		sys_time_reader<milliseconds> reader;
+		sys_time<milliseconds> tp{};
+		EXPECT_TRUE(from_string(reader, "2000-01-01T01:02:03.004Z", tp));
+		EXPECT_EQ(sys_time<milliseconds>{milliseconds{946688523004}}, tp);
+		EXPECT_TRUE(from_string(reader, "2000-01-01T01:02:03.5+00:00", tp));
+		EXPECT_EQ(sys_time<milliseconds>{milliseconds{946688523500}}, tp);
+		EXPECT_TRUE(from_string(reader, "2000-01-01T01:02:03.123456789-01:00", tp));
+		EXPECT_EQ(sys_time<milliseconds>{milliseconds{946692123123}}, tp);
+	}
+}
+
+}	// namespace sys_time_reader_test
+
+}	// namespace hamon_chrono_test
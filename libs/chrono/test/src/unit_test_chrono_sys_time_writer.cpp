@@ -0,0 +1,71 @@
+﻿/**
+ *	@file	unit_test_chrono_sys_time_writer.cpp
+ *
+ *	@brief	sys_time_writer のテスト
+ */
+
+#include <hamon/chrono/sys_time_writer.hpp>
+#include <hamon/chrono/duration.hpp>
+#include <hamon/chrono/sys_time.hpp>
+#include <hamon/string.hpp>
+#include <hamon/system_error/errc.hpp>
+#include <hamon/config.hpp>
+#include <gtest/gtest.h>
+
+namespace hamon_chrono_test
+{
+
+namespace sys_time_writer_test
+{
+
+template <typename Duration>
+hamon::string to_string(
+	hamon::chrono::sys_time_writer<Duration>& w,
+	hamon::chrono::sys_time<Duration> const& tp)
+{
+	char buf[hamon::chrono::sys_time_writer<Duration>::max_size]{};
+	auto const r = w.to_chars(buf, buf + sizeof(buf), tp);
+	EXPECT_TRUE(r.ec == hamon::errc{});
+	return hamon::string(buf, r.ptr);
+}
+
+GTEST_TEST(ChronoTest, SysTimeWriterTest)
+{
+	using namespace hamon::chrono;
+
+	{
+		sys_time_writer<seconds> w;
+		// 同じ日が続く
+		EXPECT_EQ("2000-01-01T00:00:00Z", to_string(w, sys_seconds{seconds{946684800}}));
+		EXPECT_EQ("2000-01-01T01:02:03Z", to_string(w, sys_seconds{seconds{946688523}}));
+		EXPECT_EQ("2000-01-01T23:59:59Z", to_string(w, sys_seconds{seconds{946771199}}));
+		// 日付が変わる
+		EXPECT_EQ("2000-01-02T00:00:00Z", to_string(w, sys_seconds{seconds{946771200}}));
+		// 前の日に戻る
+		EXPECT_EQ("2000-01-01T12:00:00Z", to_string(w, sys_seconds{seconds{946728000}}));
+		EXPECT_EQ("1969-12-31T23:59:59Z", to_string(w, sys_seconds{seconds{-1}}));
+		EXPECT_EQ("1970-01-01T00:00:00Z", to_string(w, sys_seconds{seconds{0}}));
+	}
+	{
+		sys_time_writer<microseconds> w;
+		EXPECT_EQ("2000-01-01T01:02:03.000004Z", to_string(w, sys_time<microseconds>{microseconds{946688523000004}}));
+		EXPECT_EQ("2000-01-01T01:02:03.500000Z", to_string(w, sys_time<microseconds>{microseconds{946688523500000}}));
+		EXPECT_EQ("-0001-01-01T00:00:00.000000Z", to_string(w, sys_time<microseconds>{seconds{-62198755200}}));
+	}
+	{
+		// バッファが足りないときは書かない
+		sys_time_writer<milliseconds> w;
+		char buf[24]{};
+		auto const tp = sys_time<milliseconds>{milliseconds{946688523004}};
+		auto r = w.to_chars(buf, buf + 23, tp);
+		EXPECT_TRUE(r.ec == hamon::errc::value_too_large);
+		EXPECT_TRUE(r.ptr == buf + 23);
+		r = w.to_chars(buf, buf + 24, tp);
+		EXPECT_TRUE(r.ec == hamon::errc{});
+		EXPECT_EQ("2000-01-01T01:02:03.004Z", hamon::string(buf, r.ptr));
+	}
+}
+
+}	// namespace sys_time_writer_test
+
+}	// namespace hamon_chrono_test
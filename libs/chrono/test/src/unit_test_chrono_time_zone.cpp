@@ -5,10 +5,23 @@
  */
 
 #include <hamon/chrono/time_zone.hpp>
+#include <hamon/chrono/ambiguous_local_time.hpp>
+#include <hamon/chrono/choose.hpp>
+#include <hamon/chrono/duration.hpp>
 #include <hamon/chrono/get_tzdb.hpp>
+#include <hamon/chrono/local_info.hpp>
+#include <hamon/chrono/local_seconds.hpp>
+#include <hamon/chrono/locate_zone.hpp>
+#include <hamon/chrono/nonexistent_local_time.hpp>
+#include <hamon/chrono/sys_days.hpp>
+#include <hamon/chrono/sys_info.hpp>
+#include <hamon/chrono/sys_seconds.hpp>
+#include <hamon/chrono/year_month_day.hpp>
 #include <hamon/compare.hpp>
 #include <hamon/type_traits.hpp>
 #include <gtest/gtest.h>
+#include <thread>
+#include <vector>
 
 namespace hamon_chrono_test
 {
@@ -86,10 +99,301 @@ inline void comparison_test()
 #endif
 }
 
+inline hamon::chrono::sys_seconds
+make_sys(int y, unsigned m, unsigned d, long long h = 0, long long mi = 0, long long s = 0)
+{
+	return hamon::chrono::sys_days{hamon::chrono::year_month_day{
+		hamon::chrono::year{y}, hamon::chrono::month{m}, hamon::chrono::day{d}}} +
+		hamon::chrono::hours{h} + hamon::chrono::minutes{mi} + hamon::chrono::seconds{s};
+}
+
+inline hamon::chrono::local_seconds
+make_local(int y, unsigned m, unsigned d, long long h = 0, long long mi = 0, long long s = 0)
+{
+	return hamon::chrono::local_seconds{make_sys(y, m, d, h, mi, s).time_since_epoch()};
+}
+
+inline void get_info_sys_test()
+{
+	using namespace hamon::chrono;
+
+	{
+		auto const* zone = locate_zone("America/New_York");
+		static_assert(hamon::is_same<decltype(zone->get_info(sys_seconds{})), sys_info>::value, "");
+
+		auto const i = zone->get_info(make_sys(2024, 7, 1));
+		EXPECT_TRUE(i.begin  == make_sys(2024, 3, 10, 7));
+		EXPECT_TRUE(i.end    == make_sys(2024, 11, 3, 6));
+		EXPECT_TRUE(i.offset == hours{-4});
+		EXPECT_TRUE(i.save   == minutes{60});
+		EXPECT_TRUE(i.abbrev == "EDT");
+
+		// 遷移の直前と直後
+		EXPECT_TRUE(zone->get_info(make_sys(2024, 3, 10, 7) - seconds{1}).abbrev == "EST");
+		EXPECT_TRUE(zone->get_info(make_sys(2024, 3, 10, 7)).abbrev == "EDT");
+		EXPECT_TRUE(zone->get_info(make_sys(2024, 11, 3, 6) - seconds{1}).abbrev == "EDT");
+		EXPECT_TRUE(zone->get_info(make_sys(2024, 11, 3, 6)).abbrev == "EST");
+
+		// 秒より細かい時刻
+		auto const j = zone->get_info(sys_time<milliseconds>{make_sys(2024, 3, 10, 7)} - milliseconds{1});
+		EXPECT_TRUE(j.end    == make_sys(2024, 3, 10, 7));
+		EXPECT_TRUE(j.offset == hours{-5});
+		EXPECT_TRUE(j.save   == minutes{0});
+		EXPECT_TRUE(j.abbrev == "EST");
+
+		// 最初の期間
+		auto const k = zone->get_info(make_sys(1800, 1, 1));
+		EXPECT_TRUE(k.begin  == sys_seconds::min());
+		EXPECT_TRUE(k.end    == make_sys(1883, 11, 18, 17));
+		EXPECT_TRUE(k.offset == -(hours{4} + minutes{56} + seconds{2}));
+		EXPECT_TRUE(k.save   == minutes{0});
+		EXPECT_TRUE(k.abbrev == "LMT");
+	}
+	{
+		auto const* zone = locate_zone("Europe/London");
+		auto const i = zone->get_info(make_sys(2024, 1, 15));
+		EXPECT_TRUE(i.begin  == make_sys(2023, 10, 29, 1));
+		EXPECT_TRUE(i.end    == make_sys(2024, 3, 31, 1));
+		EXPECT_TRUE(i.offset == hours{0});
+		EXPECT_TRUE(i.save   == minutes{0});
+		EXPECT_TRUE(i.abbrev == "GMT");
+
+		auto const j = zone->get_info(make_sys(2024, 7, 15));
+		EXPECT_TRUE(j.begin  == make_sys(2024, 3, 31, 1));
+		EXPECT_TRUE(j.end    == make_sys(2024, 10, 27, 1));
+		EXPECT_TRUE(j.offset == hours{1});
+		EXPECT_TRUE(j.save   == minutes{60});
+		EXPECT_TRUE(j.abbrev == "BST");
+	}
+	{
+		// 最後の遷移の後はずっと同じ
+		auto const* zone = locate_zone("Asia/Tokyo");
+		auto const i = zone->get_info(make_sys(2024, 1, 1));
+		EXPECT_TRUE(i.begin  == make_sys(1951, 9, 8, 15));
+		EXPECT_TRUE(i.end    == sys_seconds::max());
+		EXPECT_TRUE(i.offset == hours{9});
+		EXPECT_TRUE(i.save   == minutes{0});
+		EXPECT_TRUE(i.abbrev == "JST");
+
+		auto const j = zone->get_info(make_sys(3000, 1, 1));
+		EXPECT_TRUE(j.begin  == make_sys(1951, 9, 8, 15));
+		EXPECT_TRUE(j.end    == sys_seconds::max());
+		EXPECT_TRUE(j.abbrev == "JST");
+
+		auto const k = zone->get_info(make_sys(1700, 1, 1));
+		EXPECT_TRUE(k.begin  == sys_seconds::min());
+		EXPECT_TRUE(k.end    == make_sys(1887, 12, 31, 15));
+		EXPECT_TRUE(k.offset == hours{9} + minutes{18} + seconds{59});
+		EXPECT_TRUE(k.abbrev == "LMT");
+	}
+	{
+		// 遷移表の範囲外は規則から計算する
+		auto const* zone = locate_zone("America/New_York");
+		auto const i = zone->get_info(make_sys(2200, 7, 1));
+		EXPECT_TRUE(i.begin  == make_sys(2200, 3, 9, 7));
+		EXPECT_TRUE(i.end    == make_sys(2200, 11, 2, 6));
+		EXPECT_TRUE(i.offset == hours{-4});
+		EXPECT_TRUE(i.save   == minutes{60});
+		EXPECT_TRUE(i.abbrev == "EDT");
+
+		// 遷移表の終わりをまたぐ期間
+		auto const j = zone->get_info(make_sys(2101, 1, 1));
+		EXPECT_TRUE(j.begin  == make_sys(2100, 11, 7, 6));
+		EXPECT_TRUE(j.end    == make_sys(2101, 3, 13, 7));
+		EXPECT_TRUE(j.abbrev == "EST");
+		EXPECT_TRUE(zone->get_info(make_sys(2101, 3, 13, 7)).abbrev == "EDT");
+	}
+	{
+		// FORMAT が %z
+		auto const* zone = locate_zone("America/Sao_Paulo");
+		auto const i = zone->get_info(make_sys(2024, 7, 1));
+		EXPECT_TRUE(i.begin  == make_sys(2019, 2, 17, 2));
+		EXPECT_TRUE(i.end    == sys_seconds::max());
+		EXPECT_TRUE(i.offset == hours{-3});
+		EXPECT_TRUE(i.abbrev == "-03");
+
+		EXPECT_TRUE(locate_zone("Asia/Kathmandu")->get_info(make_sys(2024, 7, 1)).abbrev == "+0545");
+	}
+	{
+		// 30分の夏時間
+		auto const* zone = locate_zone("Australia/Lord_Howe");
+		auto const i = zone->get_info(make_sys(2024, 1, 1));
+		EXPECT_TRUE(i.begin  == make_sys(2023, 9, 30, 15, 30));
+		EXPECT_TRUE(i.end    == make_sys(2024, 4, 6, 15));
+		EXPECT_TRUE(i.offset == hours{11});
+		EXPECT_TRUE(i.save   == minutes{30});
+		EXPECT_TRUE(i.abbrev == "+11");
+	}
+}
+
+inline void get_info_local_test()
+{
+	using namespace hamon::chrono;
+
+	auto const* zone = locate_zone("America/New_York");
+	static_assert(hamon::is_same<decltype(zone->get_info(local_seconds{})), local_info>::value, "");
+
+	{
+		auto const i = zone->get_info(make_local(2024, 7, 1));
+		EXPECT_TRUE(i.result == local_info::unique);
+		EXPECT_TRUE(i.first.begin  == make_sys(2024, 3, 10, 7));
+		EXPECT_TRUE(i.first.end    == make_sys(2024, 11, 3, 6));
+		EXPECT_TRUE(i.first.abbrev == "EDT");
+	}
+	{
+		auto const i = zone->get_info(make_local(2024, 3, 10, 2, 30));
+		EXPECT_TRUE(i.result == local_info::nonexistent);
+		EXPECT_TRUE(i.first.end     == make_sys(2024, 3, 10, 7));
+		EXPECT_TRUE(i.first.abbrev  == "EST");
+		EXPECT_TRUE(i.second.begin  == make_sys(2024, 3, 10, 7));
+		EXPECT_TRUE(i.second.abbrev == "EDT");
+	}
+	{
+		auto const i = zone->get_info(make_local(2024, 11, 3, 1, 30));
+		EXPECT_TRUE(i.result == local_info::ambiguous);
+		EXPECT_TRUE(i.first.end     == make_sys(2024, 11, 3, 6));
+		EXPECT_TRUE(i.first.abbrev  == "EDT");
+		EXPECT_TRUE(i.second.begin  == make_sys(2024, 11, 3, 6));
+		EXPECT_TRUE(i.second.abbrev == "EST");
+	}
+
+	// 境界
+	EXPECT_TRUE(zone->get_info(make_local(2024, 3, 10, 1, 59, 59)).result == local_info::unique);
+	EXPECT_TRUE(zone->get_info(make_local(2024, 3, 10, 2)).result == local_info::nonexistent);
+	EXPECT_TRUE(zone->get_info(make_local(2024, 3, 10, 2, 59, 59)).result == local_info::nonexistent);
+	EXPECT_TRUE(zone->get_info(make_local(2024, 3, 10, 3)).result == local_info::unique);
+	EXPECT_TRUE(zone->get_info(make_local(2024, 11, 3, 0, 59, 59)).result == local_info::unique);
+	EXPECT_TRUE(zone->get_info(make_local(2024, 11, 3, 1)).result == local_info::ambiguous);
+	EXPECT_TRUE(zone->get_info(make_local(2024, 11, 3, 1, 59, 59)).result == local_info::ambiguous);
+	EXPECT_TRUE(zone->get_info(make_local(2024, 11, 3, 2)).result == local_info::unique);
+
+	// 遷移表の範囲外
+	EXPECT_TRUE(zone->get_info(make_local(2200, 3, 9, 2, 30)).result == local_info::nonexistent);
+	EXPECT_TRUE(zone->get_info(make_local(2200, 11, 2, 1, 30)).result == local_info::ambiguous);
+	EXPECT_TRUE(zone->get_info(make_local(2200, 7, 1)).result == local_info::unique);
+	EXPECT_TRUE(zone->get_info(make_local(1700, 1, 1)).result == local_info::unique);
+	EXPECT_TRUE(zone->get_info(make_local(1700, 1, 1)).first.abbrev == "LMT");
+
+	// 南半球
+	{
+		auto const* sydney = locate_zone("Australia/Sydney");
+		auto const i = sydney->get_info(make_local(2024, 4, 7, 2, 30));
+		EXPECT_TRUE(i.result == local_info::ambiguous);
+		EXPECT_TRUE(i.first.abbrev  == "AEDT");
+		EXPECT_TRUE(i.second.abbrev == "AEST");
+
+		auto const j = sydney->get_info(make_local(2024, 10, 6, 2, 30));
+		EXPECT_TRUE(j.result == local_info::nonexistent);
+		EXPECT_TRUE(j.first.abbrev  == "AEST");
+		EXPECT_TRUE(j.second.abbrev == "AEDT");
+	}
+}
+
+inline void to_sys_test()
+{
+	using namespace hamon::chrono;
+
+	auto const* zone = locate_zone("America/New_York");
+	static_assert(hamon::is_same<decltype(zone->to_sys(local_seconds{})), sys_seconds>::value, "");
+	static_assert(hamon::is_same<decltype(zone->to_sys(local_time<minutes>{})), sys_seconds>::value, "");
+	static_assert(hamon::is_same<decltype(zone->to_sys(local_time<milliseconds>{})), sys_time<milliseconds>>::value, "");
+	static_assert(hamon::is_same<decltype(zone->to_sys(local_seconds{}, choose::earliest)), sys_seconds>::value, "");
+	static_assert(hamon::is_same<decltype(zone->to_sys(local_time<milliseconds>{}, choose::earliest)), sys_time<milliseconds>>::value, "");
+
+	EXPECT_TRUE(zone->to_sys(make_local(2024, 7, 1, 12)) == make_sys(2024, 7, 1, 16));
+	EXPECT_TRUE(zone->to_sys(make_local(2024, 1, 1, 12)) == make_sys(2024, 1, 1, 17));
+	EXPECT_TRUE(zone->to_sys(local_time<milliseconds>{make_local(2024, 7, 1, 12)} + milliseconds{5}) ==
+		sys_time<milliseconds>{make_sys(2024, 7, 1, 16)} + milliseconds{5});
+
+	EXPECT_TRUE(zone->to_sys(make_local(2024, 7, 1, 12), choose::earliest) == make_sys(2024, 7, 1, 16));
+	EXPECT_TRUE(zone->to_sys(make_local(2024, 7, 1, 12), choose::latest)   == make_sys(2024, 7, 1, 16));
+	EXPECT_TRUE(zone->to_sys(make_local(2024, 3, 10, 2, 30), choose::earliest) == make_sys(2024, 3, 10, 7));
+	EXPECT_TRUE(zone->to_sys(make_local(2024, 3, 10, 2, 30), choose::latest)   == make_sys(2024, 3, 10, 7));
+	EXPECT_TRUE(zone->to_sys(make_local(2024, 11, 3, 1, 30), choose::earliest) == make_sys(2024, 11, 3, 5, 30));
+	EXPECT_TRUE(zone->to_sys(make_local(2024, 11, 3, 1, 30), choose::latest)   == make_sys(2024, 11, 3, 6, 30));
+	EXPECT_TRUE(zone->to_sys(make_local(2200, 11, 2, 1, 30), choose::earliest) == make_sys(2200, 11, 2, 5, 30));
+	EXPECT_TRUE(zone->to_sys(make_local(2200, 11, 2, 1, 30), choose::latest)   == make_sys(2200, 11, 2, 6, 30));
+
+#if !defined(HAMON_NO_EXCEPTIONS)
+	EXPECT_THROW((void)zone->to_sys(make_local(2024, 3, 10, 2, 30)), nonexistent_local_time);
+	EXPECT_THROW((void)zone->to_sys(make_local(2024, 11, 3, 1, 30)), ambiguous_local_time);
+	EXPECT_THROW((void)zone->to_sys(make_local(2200, 3, 9, 2, 30)),  nonexistent_local_time);
+	EXPECT_THROW((void)zone->to_sys(make_local(2200, 11, 2, 1, 30)), ambiguous_local_time);
+#endif
+}
+
+inline void to_local_test()
+{
+	using namespace hamon::chrono;
+
+	auto const* zone = locate_zone("America/New_York");
+	static_assert(hamon::is_same<decltype(zone->to_local(sys_seconds{})), local_seconds>::value, "");
+	static_assert(hamon::is_same<decltype(zone->to_local(sys_time<minutes>{})), local_seconds>::value, "");
+	static_assert(hamon::is_same<decltype(zone->to_local(sys_time<milliseconds>{})), local_time<milliseconds>>::value, "");
+
+	EXPECT_TRUE(zone->to_local(make_sys(2024, 7, 1, 16)) == make_local(2024, 7, 1, 12));
+	EXPECT_TRUE(zone->to_local(make_sys(2024, 1, 1, 17)) == make_local(2024, 1, 1, 12));
+	EXPECT_TRUE(zone->to_local(make_sys(2024, 11, 3, 5, 30)) == make_local(2024, 11, 3, 1, 30));
+	EXPECT_TRUE(zone->to_local(make_sys(2024, 11, 3, 6, 30)) == make_local(2024, 11, 3, 1, 30));
+	EXPECT_TRUE(zone->to_local(make_sys(2200, 7, 1, 16)) == make_local(2200, 7, 1, 12));
+	EXPECT_TRUE(zone->to_local(sys_time<milliseconds>{make_sys(2024, 3, 10, 7)} - milliseconds{1}) ==
+		local_time<milliseconds>{make_local(2024, 3, 10, 2)} - milliseconds{1});
+
+	EXPECT_TRUE(locate_zone("Asia/Tokyo")->to_local(make_sys(2024, 1, 1)) == make_local(2024, 1, 1, 9));
+	EXPECT_TRUE(locate_zone("Asia/Kolkata")->to_local(make_sys(2024, 1, 1)) == make_local(2024, 1, 1, 5, 30));
+
+	// 全てのタイムゾーンで、to_local と to_sys が逆の変換になっている
+	for (auto const& zone2 : get_tzdb().zones)
+	{
+		for (int y = 1900; y <= 2300; y += 13)
+		{
+			auto const st = make_sys(y, 6, 15, 12);
+			auto const lt = zone2.to_local(st);
+			EXPECT_TRUE(zone2.to_sys(lt, choose::earliest) == st || zone2.to_sys(lt, choose::latest) == st);
+		}
+	}
+}
+
+inline void thread_test()
+{
+	using namespace hamon::chrono;
+
+	// 複数のスレッドから同時に使っても同じ結果になる
+	auto const* zone = locate_zone("Europe/Paris");
+	std::vector<std::thread> threads;
+	std::vector<int> results(8);
+	for (int n = 0; n < 8; ++n)
+	{
+		threads.emplace_back([zone, &results, n]
+		{
+			int ok = 0;
+			for (int y = 1970; y < 2100; ++y)
+			{
+				auto const i = zone->get_info(make_sys(y, 1, 15));
+				ok += (i.abbrev == "CET" && zone->to_local(make_sys(y, 1, 15)) == make_local(y, 1, 15, 1)) ? 1 : 0;
+			}
+			results[static_cast<hamon::size_t>(n)] = ok;
+		});
+	}
+	for (auto& t : threads)
+	{
+		t.join();
+	}
+	for (auto r : results)
+	{
+		EXPECT_EQ(130, r);
+	}
+}
+
 GTEST_TEST(ChronoTest, TimeZoneTest)
 {
 	name_test();
 	comparison_test();
+	get_info_sys_test();
+	get_info_local_test();
+	to_sys_test();
+	to_local_test();
+	thread_test();
 }
 
 }	// namespace time_zone_test
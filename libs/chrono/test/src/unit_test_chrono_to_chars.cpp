@@ -0,0 +1,167 @@
+﻿/**
+ *	@file	unit_test_chrono_to_chars.cpp
+ *
+ *	@brief	to_chars のテスト
+ */
+
+#include <hamon/chrono/to_chars.hpp>
+#include <hamon/chrono/year_month_day.hpp>
+#include <hamon/chrono/hh_mm_ss.hpp>
+#include <hamon/chrono/duration.hpp>
+#include <hamon/chrono/sys_time.hpp>
+#include <hamon/chrono/sys_days.hpp>
+#include <hamon/ratio.hpp>
+#include <hamon/string.hpp>
+#include <hamon/system_error/errc.hpp>
+#include <hamon/config.hpp>
+#include <gtest/gtest.h>
+#include "constexpr_test.hpp"
+
+namespace hamon_chrono_test
+{
+
+namespace to_chars_test
+{
+
+#define VERIFY(...)	if (!(__VA_ARGS__)) { return false; }
+
+template <typename T>
+hamon::string to_string(T const& x)
+{
+	char buf[128]{};
+	auto const r = hamon::chrono::to_chars(buf, buf + sizeof(buf), x);
+	EXPECT_TRUE(r.ec == hamon::errc{});
+	return hamon::string(buf, r.ptr);
+}
+
+inline HAMON_CXX14_CONSTEXPR bool
+test_year_month_day_constexpr()
+{
+	using namespace hamon::chrono;
+	char buf[16]{};
+	auto const r = hamon::chrono::to_chars(buf, buf + 16, year_month_day{year{2024}, month{2}, day{29}});
+	VERIFY(r.ec == hamon::errc{});
+	VERIFY(r.ptr == buf + 10);
+	VERIFY(buf[0] == '2');
+	VERIFY(buf[3] == '4');
+	VERIFY(buf[4] == '-');
+	VERIFY(buf[5] == '0');
+	VERIFY(buf[6] == '2');
+	VERIFY(buf[7] == '-');
+	VERIFY(buf[8] == '2');
+	VERIFY(buf[9] == '9');
+	return true;
+}
+
+GTEST_TEST(ChronoTest, ToCharsYearMonthDayTest)
+{
+	using namespace hamon::chrono;
+
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(test_year_month_day_constexpr());
+
+	EXPECT_EQ("1970-01-01", to_string(year_month_day{year{1970}, month{1}, day{1}}));
+	EXPECT_EQ("0001-12-31", to_string(year_month_day{year{1}, month{12}, day{31}}));
+	EXPECT_EQ("-0001-01-01", to_string(year_month_day{year{-1}, month{1}, day{1}}));
+	EXPECT_EQ("12345-06-07", to_string(year_month_day{year{12345}, month{6}, day{7}}));
+	EXPECT_EQ("-32767-01-01", to_string(year_month_day{year{-32767}, month{1}, day{1}}));
+
+	// バッファが足りない
+	{
+		char buf[9]{};
+		auto const r = hamon::chrono::to_chars(buf, buf + 9, year_month_day{year{2000}, month{1}, day{1}});
+		EXPECT_TRUE(r.ec == hamon::errc::value_too_large);
+		EXPECT_TRUE(r.ptr == buf + 9);
+	}
+	// 丁度の大きさ
+	{
+		char buf[10]{};
+		auto const r = hamon::chrono::to_chars(buf, buf + 10, year_month_day{year{2000}, month{1}, day{1}});
+		EXPECT_TRUE(r.ec == hamon::errc{});
+		EXPECT_EQ("2000-01-01", hamon::string(buf, r.ptr));
+	}
+}
+
+GTEST_TEST(ChronoTest, ToCharsHhMmSsTest)
+{
+	using namespace hamon::chrono;
+
+	EXPECT_EQ("00:00:00", to_string(hh_mm_ss<seconds>{seconds{0}}));
+	EXPECT_EQ("01:02:03", to_string(hh_mm_ss<seconds>{seconds{3723}}));
+	EXPECT_EQ("-01:02:03", to_string(hh_mm_ss<seconds>{seconds{-3723}}));
+	EXPECT_EQ("100:00:00", to_string(hh_mm_ss<hours>{hours{100}}));
+	EXPECT_EQ("00:01:00", to_string(hh_mm_ss<minutes>{minutes{1}}));
+	EXPECT_EQ("01:02:03.004", to_string(hh_mm_ss<milliseconds>{milliseconds{3723004}}));
+	EXPECT_EQ("00:00:00.000001", to_string(hh_mm_ss<microseconds>{microseconds{1}}));
+	EXPECT_EQ("23:59:59.999999999", to_string(hh_mm_ss<nanoseconds>{nanoseconds{86399999999999}}));
+	EXPECT_EQ("00:00:01.5", to_string(hh_mm_ss<duration<int, hamon::ratio<1, 2>>>{duration<int, hamon::ratio<1, 2>>{3}}));
+
+	{
+		char buf[8]{};
+		auto const r = hamon::chrono::to_chars(buf, buf + 7, hh_mm_ss<seconds>{seconds{0}});
+		EXPECT_TRUE(r.ec == hamon::errc::value_too_large);
+	}
+	{
+		char buf[8]{};
+		auto const r = hamon::chrono::to_chars(buf, buf + 8, hh_mm_ss<seconds>{seconds{0}});
+		EXPECT_TRUE(r.ec == hamon::errc{});
+		EXPECT_EQ("00:00:00", hamon::string(buf, r.ptr));
+	}
+}
+
+GTEST_TEST(ChronoTest, ToCharsDurationTest)
+{
+	using namespace hamon::chrono;
+
+	EXPECT_EQ("42ms", to_string(milliseconds{42}));
+	EXPECT_EQ("-7s", to_string(seconds{-7}));
+	EXPECT_EQ("0ns", to_string(nanoseconds{0}));
+	EXPECT_EQ("3min", to_string(minutes{3}));
+	EXPECT_EQ("24h", to_string(hours{24}));
+	EXPECT_EQ("1d", to_string(days{1}));
+	EXPECT_EQ("5[604800]s", to_string(weeks{5}));
+	EXPECT_EQ("12[1/3]s", to_string(duration<int, hamon::ratio<1, 3>>{12}));
+
+	{
+		char buf[4]{};
+		auto const r = hamon::chrono::to_chars(buf, buf + 4, milliseconds{123});
+		EXPECT_TRUE(r.ec == hamon::errc::value_too_large);
+		EXPECT_TRUE(r.ptr == buf + 4);
+	}
+	{
+		char buf[2]{};
+		auto const r = hamon::chrono::to_chars(buf, buf + 2, milliseconds{123});
+		EXPECT_TRUE(r.ec == hamon::errc::value_too_large);
+	}
+}
+
+GTEST_TEST(ChronoTest, ToCharsSysTimeTest)
+{
+	using namespace hamon::chrono;
+
+	EXPECT_EQ("1970-01-01T00:00:00Z", to_string(sys_seconds{seconds{0}}));
+	EXPECT_EQ("2000-01-01T01:02:03Z", to_string(sys_seconds{seconds{946688523}}));
+	EXPECT_EQ("1969-12-31T23:59:59Z", to_string(sys_seconds{seconds{-1}}));
+	EXPECT_EQ("2000-01-01T01:02:03.004Z", to_string(sys_time<milliseconds>{milliseconds{946688523004}}));
+	EXPECT_EQ("1969-12-31T23:59:59.999999Z", to_string(sys_time<microseconds>{microseconds{-1}}));
+	EXPECT_EQ("2023-12-31T00:00:00Z", to_string(sys_days{days{19722}}));
+	EXPECT_EQ("1970-01-01T01:00:00Z", to_string(sys_time<hours>{hours{1}}));
+
+	{
+		char buf[19]{};
+		auto const r = hamon::chrono::to_chars(buf, buf + 19, sys_seconds{seconds{0}});
+		EXPECT_TRUE(r.ec == hamon::errc::value_too_large);
+		EXPECT_TRUE(r.ptr == buf + 19);
+	}
+	{
+		char buf[20]{};
+		auto const r = hamon::chrono::to_chars(buf, buf + 20, sys_seconds{seconds{0}});
+		EXPECT_TRUE(r.ec == hamon::errc{});
+		EXPECT_EQ("1970-01-01T00:00:00Z", hamon::string(buf, r.ptr));
+	}
+}
+
+#undef VERIFY
+
+}	// namespace to_chars_test
+
+}	// namespace hamon_chrono_test
@@ -0,0 +1,97 @@
+﻿/**
+ *	@file	unit_test_chrono_utc_from_sys.cpp
+ *
+ *	@brief	utc_from_sys のテスト
+ */
+
+#include <hamon/chrono/utc_from_sys.hpp>
+#include <hamon/chrono/utc_clock.hpp>
+#include <hamon/chrono/get_tzdb.hpp>
+#include <hamon/chrono/sys_time.hpp>
+#include <hamon/chrono/duration.hpp>
+#include <hamon/span.hpp>
+#include <hamon/type_traits/is_same.hpp>
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace hamon_chrono_test
+{
+
+namespace utc_from_sys_test
+{
+
+template <typename Duration>
+void check(std::vector<hamon::chrono::sys_time<Duration>> const& in)
+{
+	namespace chrono = hamon::chrono;
+	using CT = typename decltype(chrono::utc_clock::from_sys(in[0]))::duration;
+
+	std::vector<chrono::utc_time<CT>> out(in.size());
+	chrono::utc_from_sys(
+		hamon::span<chrono::sys_time<Duration> const>{ in.data(), in.size() },
+		hamon::span<chrono::utc_time<CT>>{ out.data(), out.size() });
+
+	for (hamon::size_t i = 0; i < in.size(); ++i)
+	{
+		EXPECT_TRUE(out[i] == chrono::utc_clock::from_sys(in[i])) << i;
+	}
+}
+
+GTEST_TEST(ChronoTest, UtcFromSysTest)
+{
+	namespace chrono = hamon::chrono;
+	using namespace hamon::chrono_literals;
+
+	static_assert(hamon::is_same<void, decltype(chrono::utc_from_sys(
+		hamon::span<chrono::sys_time<chrono::milliseconds> const>{},
+		hamon::span<chrono::utc_time<chrono::milliseconds>>{}))>::value, "");
+	static_assert(hamon::is_same<void, decltype(chrono::utc_from_sys(
+		hamon::span<chrono::sys_time<chrono::minutes> const>{},
+		hamon::span<chrono::utc_time<chrono::seconds>>{}))>::value, "");
+
+	// 空の列
+	check(std::vector<chrono::sys_seconds>{});
+
+	// 全ての閏秒の前後 (時刻順)
+	std::vector<chrono::sys_seconds> s;
+	std::vector<chrono::sys_time<chrono::nanoseconds>> ns;
+	s.push_back(chrono::sys_seconds::min());
+	s.push_back(chrono::sys_seconds{ 0_s });
+	for (auto const& ls : chrono::get_tzdb().leap_seconds)
+	{
+		s.push_back(ls.date() - 1_s);
+		s.push_back(ls.date());
+		s.push_back(ls.date() + 1_s);
+		ns.push_back(ls.date() - 1_ns);
+		ns.push_back(ls.date());
+		ns.push_back(ls.date() + 1_ns);
+	}
+	s.push_back(chrono::sys_seconds{ 4000000000_s });
+	check(s);
+	check(ns);
+
+	// 逆順や飛び飛びに並んでいても同じ結果になる
+	std::vector<chrono::sys_seconds> reversed;
+	for (hamon::size_t i = s.size(); i > 0; --i)
+	{
+		reversed.push_back(s[i - 1]);
+	}
+	check(reversed);
+	std::vector<chrono::sys_seconds> mixed;
+	for (hamon::size_t i = 0; i < s.size(); ++i)
+	{
+		mixed.push_back(s[(i * 7) % s.size()]);
+	}
+	check(mixed);
+
+	// 分単位の入力は秒単位になる
+	check(std::vector<chrono::sys_time<chrono::minutes>>{
+		chrono::sys_time<chrono::minutes>{ 0_min },
+		chrono::sys_time<chrono::minutes>{ 20000000_min },
+		chrono::sys_time<chrono::minutes>{ 40000000_min },
+	});
+}
+
+}	// namespace utc_from_sys_test
+
+}	// namespace hamon_chrono_test
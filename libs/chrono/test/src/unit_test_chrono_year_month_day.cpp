@@ -11,6 +11,7 @@
 #include <hamon/type_traits/is_same.hpp>
 #include <hamon/config.hpp>
 #include <gtest/gtest.h>
+#include <sstream>
 #include "constexpr_test.hpp"
 
 namespace hamon_chrono_test
@@ -620,6 +621,31 @@ GTEST_TEST(ChronoTest, YearMonthDayTest)
 	}
 }
 
+GTEST_TEST(ChronoTest, YearMonthDayOStreamTest)
+{
+	using namespace hamon::chrono;
+	{
+		std::stringstream ss;
+		ss << year_month_day{year{2024}, month{2}, day{29}};
+		EXPECT_EQ("2024-02-29", ss.str());
+	}
+	{
+		std::stringstream ss;
+		ss << year_month_day{year{2023}, month{2}, day{29}};
+		EXPECT_EQ("2023-02-29 is not a valid date", ss.str());
+	}
+	{
+		std::stringstream ss;
+		ss << year_month_day{year{-5}, month{1}, day{1}};
+		EXPECT_EQ("-0005-01-01", ss.str());
+	}
+	{
+		std::wstringstream ss;
+		ss << year_month_day{year{12345}, month{12}, day{31}};
+		EXPECT_EQ(L"12345-12-31", ss.str());
+	}
+}
+
 }	// namespace year_month_day_test
 
 }	// namespace hamon_chrono_test
@@ -0,0 +1,354 @@
+﻿/**
+ *	@file	make_compiled_tzdata.cpp
+ *
+ *	@brief	compiled_tzdata.hpp を生成するツール
+ *
+ *	tzdata.zi と leap-seconds.list を実行時と同じパーサで読み込み、
+ *	ソート済みの静的な表 (detail/compiled_tzdb.hpp の構造体) として標準出力に書き出す。
+ *
+ *	tzdata.zi か leap-seconds.list を更新したときは、このツールを実行して
+ *	include/hamon/chrono/detail/compiled_tzdata.hpp を作り直すこと。
+ *
+ *	使い方:
+ *		make_compiled_tzdata > include/hamon/chrono/detail/compiled_tzdata.hpp
+ */
+
+#include <hamon/chrono/detail/parse.hpp>
+#include <hamon/chrono/detail/parse_leap_seconds.hpp>
+#include <hamon/chrono/detail/parse_link.hpp>
+#include <hamon/chrono/detail/parse_rule.hpp>
+#include <hamon/chrono/detail/parse_version.hpp>
+#include <hamon/chrono/detail/parse_zone.hpp>
+#include <hamon/chrono/detail/tz.hpp>
+#include <hamon/chrono/tzdb.hpp>
+#include <hamon/algorithm/ranges/lower_bound.hpp>
+#include <hamon/algorithm/ranges/sort.hpp>
+#include <hamon/string.hpp>
+#include <hamon/utility/move.hpp>
+#include <hamon/variant.hpp>
+#include <hamon/vector.hpp>
+#include <cstdio>
+#include <exception>
+#include <sstream>
+
+namespace
+{
+
+namespace tz = hamon::chrono::detail::tz;
+
+struct zone_entry
+{
+	hamon::string                         m_name;
+	hamon::vector<tz::continuation_t>     m_continuations;
+};
+
+// parse_tzdata と同じ手順で読み込む。
+// ただし zone は time_zone を作らずに、continuation をそのまま取っておく。
+void parse(hamon::chrono::tzdb& db, tz::rules_storage_type& rules,
+	hamon::vector<zone_entry>& zones, std::istream& input)
+{
+	namespace detail = hamon::chrono::detail;
+
+	db.version = detail::parse_version(input);
+	while (true)
+	{
+		int c = hamon::tolower(input.get());
+		switch (c)
+		{
+		case std::istream::traits_type::eof():
+			return;
+
+		case ' ':
+		case '\t':
+		case '\n':
+			break;
+
+		case '#':
+			detail::skip_line(input);
+			break;
+
+		case 'r':
+			detail::skip(input, "ule");
+			detail::parse_rule(rules, input);
+			break;
+
+		case 'z':
+		{
+			detail::skip(input, "one");
+			detail::skip_mandatory_whitespace(input);
+			zone_entry zone;
+			zone.m_name = detail::parse_string(input);
+			detail::skip_mandatory_whitespace(input);
+			do
+			{
+				zone.m_continuations.emplace_back(detail::parse_continuation(rules, input));
+				detail::skip_line(input);
+				detail::skip_optional_whitespace(input);
+			} while (hamon::isdigit(input.peek()) || input.peek() == '-');
+			zones.push_back(hamon::move(zone));
+			break;
+		}
+
+		case 'l':
+			detail::skip(input, "ink");
+			detail::parse_link(db, input);
+			break;
+
+		default:
+			hamon::detail::throw_runtime_error("corrupt tzdb: unexpected input");
+		}
+	}
+}
+
+hamon::string quote(hamon::string_view s)
+{
+	hamon::string result = "\"";
+	for (char c : s)
+	{
+		if (c == '"' || c == '\\')
+		{
+			result += '\\';
+		}
+		result += c;
+	}
+	result += '"';
+	return result;
+}
+
+hamon::string on_string(tz::on_t const& on)
+{
+	char buf[64];
+	if (auto const* d = hamon::get_if<hamon::chrono::day>(&on))
+	{
+		std::snprintf(buf, sizeof(buf), "{ compiled_on_t::day, 0, %u }",
+			static_cast<unsigned>(*d));
+	}
+	else if (auto const* wl = hamon::get_if<hamon::chrono::weekday_last>(&on))
+	{
+		std::snprintf(buf, sizeof(buf), "{ compiled_on_t::last_weekday, %u, 0 }",
+			wl->weekday().c_encoding());
+	}
+	else
+	{
+		auto const& cw = hamon::get<tz::constrained_weekday_t>(on);
+		std::snprintf(buf, sizeof(buf), "{ compiled_on_t::%s, %u, %u }",
+			cw.m_comparison == tz::constrained_weekday_t::ge ? "weekday_ge" : "weekday_le",
+			cw.m_weekday.c_encoding(), static_cast<unsigned>(cw.m_day));
+	}
+	return buf;
+}
+
+long long count(hamon::chrono::seconds s)
+{
+	return static_cast<long long>(s.count());
+}
+
+unsigned clock_value(tz::clock_t c)
+{
+	return static_cast<unsigned>(c);
+}
+
+void write(hamon::chrono::tzdb const& db, tz::rules_storage_type const& rules,
+	hamon::vector<zone_entry> const& zones)
+{
+	std::printf(
+		"/**\n"
+		" *\t@file\tcompiled_tzdata.hpp\n"
+		" *\n"
+		" *\t@brief\tcompiled_tzdata の定義\n"
+		" *\n"
+		" *\ttools/make_compiled_tzdata.cpp で tzdata.zi (version %s) と leap-seconds.list から生成した。\n"
+		" *\t直接編集しないこと。\n"
+		" */\n"
+		"\n"
+		"#ifndef HAMON_CHRONO_DETAIL_COMPILED_TZDATA_HPP\n"
+		"#define HAMON_CHRONO_DETAIL_COMPILED_TZDATA_HPP\n"
+		"\n"
+		"#include <hamon/chrono/detail/compiled_tzdb.hpp>\n"
+		"\n"
+		"namespace hamon {\n"
+		"namespace chrono {\n"
+		"namespace detail {\n"
+		"namespace tz\n"
+		"{\n"
+		"\n"
+		"inline compiled_tzdb_t const& compiled_tzdata()\n"
+		"{\n",
+		db.version.c_str());
+
+	std::printf("\tstatic constexpr compiled_rule_t rules[] =\n\t{\n");
+	hamon::vector<unsigned> rule_first;
+	unsigned rule_index = 0;
+	for (auto const& r : rules)
+	{
+		rule_first.push_back(rule_index);
+		for (auto const& rule : r.second)
+		{
+			std::printf("\t\t{ %d, %d, %u, %s, %lld, %u, %s, %lld, %s },\n",
+				static_cast<int>(rule.m_from),
+				static_cast<int>(rule.m_to),
+				static_cast<unsigned>(rule.m_in),
+				on_string(rule.m_on).c_str(),
+				count(rule.m_at.m_time),
+				clock_value(rule.m_at.m_clock),
+				rule.m_save.m_is_dst ? "true" : "false",
+				count(rule.m_save.m_time),
+				quote(rule.m_letters).c_str());
+			++rule_index;
+		}
+	}
+	std::printf("\t};\n\n");
+
+	std::printf("\tstatic constexpr compiled_rule_set_t rule_sets[] =\n\t{\n");
+	for (hamon::size_t i = 0; i < rules.size(); ++i)
+	{
+		std::printf("\t\t{ %s, %u, %u },\n",
+			quote(rules[i].first).c_str(), rule_first[i],
+			static_cast<unsigned>(rules[i].second.size()));
+	}
+	std::printf("\t};\n\n");
+
+	std::printf("\tstatic constexpr compiled_continuation_t continuations[] =\n\t{\n");
+	for (auto const& z : zones)
+	{
+		for (auto const& c : z.m_continuations)
+		{
+			char const* kind = "none";
+			bool is_dst = false;
+			hamon::size_t rule_set = 0;
+			long long save = 0;
+			if (auto const* s = hamon::get_if<tz::save_t>(&c.m_rules))
+			{
+				kind = "save";
+				is_dst = s->m_is_dst;
+				save = count(s->m_time);
+			}
+			else if (auto const* name = hamon::get_if<hamon::string>(&c.m_rules))
+			{
+				kind = "named";
+				auto it = hamon::ranges::lower_bound(rules, *name, {},
+					[](tz::rules_storage_type::const_reference p) -> hamon::string const& { return p.first; });
+				if (it == rules.end() || it->first != *name)
+				{
+					hamon::detail::throw_runtime_error("corrupt tzdb: unknown rule name");
+				}
+				rule_set = static_cast<hamon::size_t>(it - rules.begin());
+			}
+			std::printf("\t\t{ %lld, compiled_continuation_t::%s, %s, %u, %lld, %s, %d, %u, %s, %lld, %u },\n",
+				count(c.m_stdoff),
+				kind,
+				is_dst ? "true" : "false",
+				static_cast<unsigned>(rule_set),
+				save,
+				quote(c.m_format).c_str(),
+				static_cast<int>(c.m_year),
+				static_cast<unsigned>(c.m_in),
+				on_string(c.m_on).c_str(),
+				count(c.m_at.m_time),
+				clock_value(c.m_at.m_clock));
+		}
+	}
+	std::printf("\t};\n\n");
+
+	std::printf("\tstatic constexpr compiled_zone_t zones[] =\n\t{\n");
+	unsigned continuation_index = 0;
+	for (auto const& z : zones)
+	{
+		std::printf("\t\t{ %s, %u, %u, %u },\n",
+			quote(z.m_name).c_str(),
+			static_cast<unsigned>(z.m_name.size()),
+			continuation_index,
+			static_cast<unsigned>(z.m_continuations.size()));
+		continuation_index += static_cast<unsigned>(z.m_continuations.size());
+	}
+	std::printf("\t};\n\n");
+
+	std::printf("\tstatic constexpr compiled_link_t links[] =\n\t{\n");
+	for (auto const& l : db.links)
+	{
+		std::printf("\t\t{ %s, %u, %s, %u },\n",
+			quote(l.name()).c_str(), static_cast<unsigned>(l.name().size()),
+			quote(l.target()).c_str(), static_cast<unsigned>(l.target().size()));
+	}
+	std::printf("\t};\n\n");
+
+	std::printf("\tstatic constexpr compiled_leap_second_t leap_seconds[] =\n\t{\n");
+	for (auto const& ls : db.leap_seconds)
+	{
+		std::printf("\t\t{ %lld, %lld },\n",
+			count(ls.date().time_since_epoch()), count(ls.value()));
+	}
+	std::printf("\t};\n\n");
+
+	std::printf(
+		"\tstatic constexpr compiled_tzdb_t db =\n"
+		"\t{\n"
+		"\t\t%s,\n"
+		"\t\tzones,         %u,\n"
+		"\t\tcontinuations, %u,\n"
+		"\t\trule_sets,     %u,\n"
+		"\t\trules,         %u,\n"
+		"\t\tlinks,         %u,\n"
+		"\t\tleap_seconds,  %u,\n"
+		"\t};\n"
+		"\n"
+		"\treturn db;\n"
+		"}\n"
+		"\n"
+		"}\t// namespace tz\n"
+		"}\t// namespace detail\n"
+		"}\t// namespace chrono\n"
+		"}\t// namespace hamon\n"
+		"\n"
+		"#endif // HAMON_CHRONO_DETAIL_COMPILED_TZDATA_HPP\n",
+		quote(db.version).c_str(),
+		static_cast<unsigned>(zones.size()),
+		continuation_index,
+		static_cast<unsigned>(rules.size()),
+		rule_index,
+		static_cast<unsigned>(db.links.size()),
+		static_cast<unsigned>(db.leap_seconds.size()));
+}
+
+}	// namespace
+
+HAMON_WARNING_PUSH()
+HAMON_WARNING_DISABLE_CLANG("-Woverlength-strings")
+
+int main()
+{
+	try
+	{
+		hamon::chrono::tzdb db;
+		tz::rules_storage_type rules;
+		hamon::vector<zone_entry> zones;
+		{
+			const char* s =
+#include <hamon/chrono/detail/tzdata.zi>
+			;
+			std::istringstream tzdata(s);
+			parse(db, rules, zones, tzdata);
+		}
+		{
+			const char* s =
+#include <hamon/chrono/detail/leap-seconds.list>
+			;
+			std::istringstream leap_seconds_data(s);
+			hamon::chrono::detail::parse_leap_seconds(db.leap_seconds, leap_seconds_data);
+		}
+
+		hamon::ranges::sort(zones, {}, [](zone_entry const& z) -> hamon::string const& { return z.m_name; });
+		hamon::ranges::sort(db.links);
+		hamon::ranges::sort(rules, {}, [](tz::rules_storage_type::const_reference p) -> hamon::string const& { return p.first; });
+
+		write(db, rules, zones);
+	}
+	catch (std::exception const& e)
+	{
+		std::fprintf(stderr, "make_compiled_tzdata: %s\n", e.what());
+		return 1;
+	}
+	return 0;
+}
+
+HAMON_WARNING_POP()
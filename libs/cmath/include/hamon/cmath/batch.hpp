@@ -0,0 +1,24 @@
+﻿/**
+ *	@file	batch.hpp
+ *
+ *	@brief	配列の要素をまとめて計算する数学関数
+ */
+
+#ifndef HAMON_CMATH_BATCH_HPP
+#define HAMON_CMATH_BATCH_HPP
+
+#include <hamon/cmath/batch/cos.hpp>
+#include <hamon/cmath/batch/erf.hpp>
+#include <hamon/cmath/batch/exp.hpp>
+#include <hamon/cmath/batch/exp2.hpp>
+#include <hamon/cmath/batch/fast.hpp>
+#include <hamon/cmath/batch/log.hpp>
+#include <hamon/cmath/batch/log10.hpp>
+#include <hamon/cmath/batch/log2.hpp>
+#include <hamon/cmath/batch/pow.hpp>
+#include <hamon/cmath/batch/rsqrt.hpp>
+#include <hamon/cmath/batch/sin.hpp>
+#include <hamon/cmath/batch/sqrt.hpp>
+#include <hamon/cmath/batch/tan.hpp>
+
+#endif // HAMON_CMATH_BATCH_HPP
@@ -0,0 +1,188 @@
+﻿/**
+ *	@file	apply.hpp
+ *
+ *	@brief	batch_apply の定義
+ */
+
+#ifndef HAMON_CMATH_BATCH_DETAIL_APPLY_HPP
+#define HAMON_CMATH_BATCH_DETAIL_APPLY_HPP
+
+#include <hamon/cmath/batch/detail/simd.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/span.hpp>
+#include <hamon/type_traits/bool_constant.hpp>
+#include <hamon/type_traits/is_same.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+namespace batch
+{
+
+namespace detail
+{
+
+// float と double はそれぞれの型の SIMD 型で計算する
+template <typename T>
+using is_simd_value_type = hamon::bool_constant<
+	hamon::is_same<T, float>::value || hamon::is_same<T, double>::value>;
+
+// 1要素をスカラーで計算する
+template <typename Op, typename T>
+inline T
+apply_one(T x, bool precise) HAMON_NOEXCEPT
+{
+	bool special;
+	T const r = Op::eval(x, special);
+	return (precise && special) ? Op::reference(x) : r;
+}
+
+template <typename Op, typename T>
+inline T
+apply_one(T x, T y, bool precise) HAMON_NOEXCEPT
+{
+	bool special;
+	T const r = Op::eval(x, y, special);
+	return (precise && special) ? Op::reference(x, y) : r;
+}
+
+// 単項演算
+//
+// Op::eval は SIMD 型とスカラー(T)の両方で呼ばれ、
+// カーネルで計算できない要素の special を true にする。
+// precise が true の場合、その要素は Op::reference (スカラーの hamon:: の関数) で計算し直す。
+template <typename Op, typename T>
+inline void
+batch_apply(hamon::span<T const> in, hamon::span<T> out, bool precise, hamon::false_type) HAMON_NOEXCEPT
+{
+	for (hamon::size_t i = 0; i < out.size(); ++i)
+	{
+		out[i] = Op::reference(in[i]);
+	}
+	(void)precise;
+}
+
+template <typename Op, typename T>
+inline void
+batch_apply(hamon::span<T const> in, hamon::span<T> out, bool precise, hamon::true_type) HAMON_NOEXCEPT
+{
+	using V = simd_type<T>;
+	using traits = simd_traits<V>;
+	HAMON_CONSTEXPR hamon::size_t lanes = traits::lanes;
+
+	hamon::size_t const n = out.size();
+	hamon::size_t i = 0;
+	for (; i + lanes <= n; i += lanes)
+	{
+		V const x = traits::load(in.data() + i);
+		typename traits::mask_type special;
+		V const r = Op::eval(x, special);
+
+		if (precise && any(special))
+		{
+			// in と out が同じ範囲の場合に備えて、先に入力を退避しておく
+			T xs[lanes];
+			for (hamon::size_t k = 0; k < lanes; ++k)
+			{
+				xs[k] = in[i + k];
+			}
+			for (hamon::size_t k = 0; k < lanes; ++k)
+			{
+				out[i + k] = apply_one<Op>(xs[k], true);
+			}
+			continue;
+		}
+
+		traits::store(out.data() + i, r);
+	}
+
+	for (; i < n; ++i)
+	{
+		out[i] = apply_one<Op>(in[i], precise);
+	}
+}
+
+template <typename Op, typename T>
+inline void
+batch_apply(hamon::span<T const> in, hamon::span<T> out, bool precise) HAMON_NOEXCEPT
+{
+	batch_apply<Op>(in, out, precise, is_simd_value_type<T>{});
+}
+
+// 二項演算
+//
+// y_stride が 0 の場合、y[0] を全ての要素に使う
+template <typename Op, typename T>
+inline void
+batch_apply(hamon::span<T const> x, T const* y, hamon::size_t y_stride,
+	hamon::span<T> out, bool precise, hamon::false_type) HAMON_NOEXCEPT
+{
+	for (hamon::size_t i = 0; i < out.size(); ++i)
+	{
+		out[i] = Op::reference(x[i], y[i * y_stride]);
+	}
+	(void)precise;
+}
+
+template <typename Op, typename T>
+inline void
+batch_apply(hamon::span<T const> x, T const* y, hamon::size_t y_stride,
+	hamon::span<T> out, bool precise, hamon::true_type) HAMON_NOEXCEPT
+{
+	using V = simd_type<T>;
+	using traits = simd_traits<V>;
+	HAMON_CONSTEXPR hamon::size_t lanes = traits::lanes;
+
+	// y が空の配列を指している場合もあるので、y_stride が 0 の時だけ読む
+	V const y0 = (y_stride == 0) ? y[0] : T(0);
+
+	hamon::size_t const n = out.size();
+	hamon::size_t i = 0;
+	for (; i + lanes <= n; i += lanes)
+	{
+		V const vx = traits::load(x.data() + i);
+		V const vy = (y_stride == 0) ? y0 : traits::load(y + i);
+		typename traits::mask_type special;
+		V const r = Op::eval(vx, vy, special);
+
+		if (precise && any(special))
+		{
+			T xs[lanes];
+			T ys[lanes];
+			for (hamon::size_t k = 0; k < lanes; ++k)
+			{
+				xs[k] = x[i + k];
+				ys[k] = y[(i + k) * y_stride];
+			}
+			for (hamon::size_t k = 0; k < lanes; ++k)
+			{
+				out[i + k] = apply_one<Op>(xs[k], ys[k], true);
+			}
+			continue;
+		}
+
+		traits::store(out.data() + i, r);
+	}
+
+	for (; i < n; ++i)
+	{
+		out[i] = apply_one<Op>(x[i], y[i * y_stride], precise);
+	}
+}
+
+template <typename Op, typename T>
+inline void
+batch_apply(hamon::span<T const> x, T const* y, hamon::size_t y_stride,
+	hamon::span<T> out, bool precise) HAMON_NOEXCEPT
+{
+	batch_apply<Op>(x, y, y_stride, out, precise, is_simd_value_type<T>{});
+}
+
+}	// namespace detail
+
+}	// namespace batch
+
+}	// namespace hamon
+
+#endif // HAMON_CMATH_BATCH_DETAIL_APPLY_HPP
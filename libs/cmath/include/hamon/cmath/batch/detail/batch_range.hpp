@@ -0,0 +1,60 @@
+﻿/**
+ *	@file	batch_range.hpp
+ *
+ *	@brief	batch 関数に渡す範囲の制約
+ */
+
+#ifndef HAMON_CMATH_BATCH_DETAIL_BATCH_RANGE_HPP
+#define HAMON_CMATH_BATCH_DETAIL_BATCH_RANGE_HPP
+
+#include <hamon/ranges/range_value_t.hpp>
+#include <hamon/span.hpp>
+#include <hamon/type_traits/conjunction.hpp>
+#include <hamon/type_traits/enable_if.hpp>
+#include <hamon/type_traits/is_constructible.hpp>
+#include <hamon/type_traits/is_floating_point.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+namespace batch
+{
+
+namespace detail
+{
+
+// 要素の型は最初の入力の範囲から推論する
+template <typename Range>
+using batch_value_t = hamon::ranges::range_value_t<Range>;
+
+// 入力には span<T const> に変換できる範囲 (T の連続した範囲) を渡せる。
+// 出力は span<T> に変換できる範囲で、一時オブジェクトのコンテナは渡せない。
+template <typename T, typename OutRange, typename... InRanges>
+using enable_if_batch_ranges_t = hamon::enable_if_t<hamon::conjunction<
+	hamon::is_floating_point<T>,
+	hamon::is_constructible<hamon::span<T>, OutRange>,
+	hamon::is_constructible<hamon::span<T const>, InRanges&>...
+>::value>;
+
+template <typename T, typename Range>
+inline hamon::span<T const>
+batch_input(Range& r) HAMON_NOEXCEPT
+{
+	return hamon::span<T const>(r);
+}
+
+template <typename T, typename Range>
+inline hamon::span<T>
+batch_output(Range& r) HAMON_NOEXCEPT
+{
+	return hamon::span<T>(r);
+}
+
+}	// namespace detail
+
+}	// namespace batch
+
+}	// namespace hamon
+
+#endif // HAMON_CMATH_BATCH_DETAIL_BATCH_RANGE_HPP
@@ -0,0 +1,120 @@
+﻿/**
+ *	@file	erf_kernel.hpp
+ *
+ *	@brief	batch::erf のカーネルの定義
+ */
+
+#ifndef HAMON_CMATH_BATCH_DETAIL_ERF_KERNEL_HPP
+#define HAMON_CMATH_BATCH_DETAIL_ERF_KERNEL_HPP
+
+#include <hamon/cmath/batch/detail/simd.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+namespace batch
+{
+
+namespace detail
+{
+
+// hamon::erf の定数式版と同じ区分多項式の係数。
+// erf_coefficients()[j][i] が区間 i の j 次の係数(高次から)で、
+// 区間 0-4 は |x| < 2.2 の x*x の整数部、区間 5-9 は 2.2 <= |x| < 6.9 の |x| の整数部 - 2 に対応する。
+inline double const (&erf_coefficients(double_tag))[13][10]
+{
+	static double const table[13][10] =
+	{
+		{ 5.958930743e-11, 2.372510631e-11, 9.49905026e-12, 3.82722073e-12, 1.55296588e-12, -2.9734388465e-10, -1.951073787e-11, 3.147682272e-11, 2.31936337e-11, -3.67789363e-12 },
+		{ -1.13739022964e-9, -4.5493253732e-10, -1.8310229805e-10, -7.421598602e-11, -3.032205868e-11, 2.69776334046e-9, -3.2302692214e-10, -4.8465972408e-10, -6.303206648e-11, 2.0876046746e-10 },
+		{ 1.466005199839e-8, 5.90362766598e-9, 2.39463074e-9, 9.793057408e-10, 4.0424830707e-10, -6.40788827665e-9, 5.22461866919e-9, 6.3675740242e-10, -2.64888267434e-9, -1.93319027226e-9 },
+		{ -1.635035446196e-7, -6.642090827576e-8, -2.721444369609e-8, -1.126008898854e-8, -4.71135111493e-9, -1.6678201321e-8, 3.42940918551e-9, 3.377623323271e-8, 2.050708040581e-8, -4.35953392472e-9 },
+		{ 1.6461004480962e-6, 6.7595634268133e-7, 2.8045522331686e-7, 1.1775134830784e-7, 5.011915876293e-8, -2.1854388148686e-7, -3.5772874310272e-7, -1.5451139637086e-7, 1.1371857327578e-7, 1.8006992266137e-7 },
+		{ -1.492559551950604e-5, -6.21188515924e-6, -2.61830022482897e-6, -1.1199275838265e-6, -4.8722516178974e-7, 2.66246030457984e-6, 1.9999935792654e-7, -2.03340624738438e-6, -2.11211337219663e-6, -7.8441223763969e-7 },
+		{ 1.2055331122299265e-4, 5.10388300970969e-5, 2.195455056768781e-5, 9.62023443095201e-6, 4.30683284629395e-6, 1.612722157047886e-5, 2.687044575042908e-5, 1.947204525295057e-5, 3.68797328322935e-6, -6.75407647949153e-6 },
+		{ -8.548326981129666e-4, -3.7015410692956173e-4, -1.6358986921372656e-4, -7.404402135070773e-5, -3.445026145385764e-5, -2.5616361025506629e-4, -1.1843240273775776e-4, 2.854147231653228e-5, 9.823686253424796e-5, 8.428418334440096e-5 },
+		{ 0.00522397762482322257, 0.00233307631218880978, 0.00107052153564110318, 5.0689993654144881e-4, 2.4879276133931664e-4, 1.5380842432375365e-4, -8.0991728956032271e-4, -0.00101565063152200272, -6.5860243990455368e-4, -1.7604388937031815e-4 },
+		{ -0.0268661706450773342, -0.0125498847718219221, -0.00608284718113590151, -0.00307553051439272889, -0.00162940941748079288, 0.00815533022524927908, 0.00661062970502241174, 0.00271187003520095655, -7.5285814895230877e-4, -0.0023972961143507161 },
+		{ 0.11283791670954881569, 0.05657061146827041994, 0.02986978465246258244, 0.01668977892553165586, 0.00988786373932350462, -0.01402283663896319337, 0.00909530922354827295, 0.02328095035422810727, 0.02585434424202960464, 0.0206412902387602297 },
+		{ -0.37612638903183748117, -0.2137966477645600658, -0.13055593046562267625, -0.08548534594781312114, -0.05962426839442303805, -0.19746892495383021487, -0.2016007277849101314, -0.16725021123116877197, -0.11637092784486193258, -0.06905562880005864105 },
+		{ 1.12837916709551257377, 0.84270079294971486929, 0.67493323603965504676, 0.56909076642393639985, 0.49766113250947636708, 0.71511720328842845913, 0.51169696718727644908, 0.32490054966649436974, 0.18267336775296612024, 0.09084526782065478489 },
+	};
+	return table;
+}
+
+// float 版は double の係数を丸めたもの
+inline float const (&erf_coefficients(float_tag))[13][10]
+{
+	struct table_type
+	{
+		float v[13][10];
+
+		table_type()
+		{
+			auto const& c = erf_coefficients(double_tag{});
+			for (int j = 0; j < 13; ++j)
+			{
+				for (int i = 0; i < 10; ++i)
+				{
+					v[j][i] = static_cast<float>(c[j][i]);
+				}
+			}
+		}
+	};
+	static table_type const table;
+	return table.v;
+}
+
+// 係数を区間ごとに選ぶので、分岐せずに全ての要素を同じ多項式で計算できる
+template <typename V>
+inline V
+erf_kernel(V x) HAMON_NOEXCEPT
+{
+	using T = typename simd_traits<V>::value_type;
+
+	V const w = vabs(x);
+
+	auto const small_arg = lt(w, V(static_cast<T>(2.2)));
+	auto const large_arg = mask_not(lt(w, V(static_cast<T>(6.9))));
+
+	// 区間 0-4 は w*w, 区間 5-9 は w で分割する
+	V const u = select(small_arg, w * w, select(large_arg, V(6.0), w));
+	V ui = vround(u);
+	ui = select(gt(ui, u), ui - V(1.0), ui);
+	V const t = u - ui;
+	V const index = select(small_arg, ui, ui + V(3.0));
+
+	auto const& c = erf_coefficients(value_tag<V>{});
+	auto const i = vtoint(index);
+	V p = gather(c[0], i);
+	for (int j = 1; j < 13; ++j)
+	{
+		p = p * t + gather(c[j], i);
+	}
+
+	// 区間 5-9 は 1 - p^16
+	V p2 = p * p;
+	p2 = p2 * p2;
+	p2 = p2 * p2;
+	p2 = p2 * p2;
+
+	V const y = select(small_arg, p * w, select(large_arg, V(1.0), V(1.0) - p2));
+	return from_bits(to_bits(y) | sign_bits(x));
+}
+
+// NaN はスカラー版で計算する
+template <typename V>
+inline typename simd_traits<V>::mask_type
+erf_special(V x) HAMON_NOEXCEPT
+{
+	return mask_not(eq(x, x));
+}
+
+}	// namespace detail
+
+}	// namespace batch
+
+}	// namespace hamon
+
+#endif // HAMON_CMATH_BATCH_DETAIL_ERF_KERNEL_HPP
@@ -0,0 +1,179 @@
+﻿/**
+ *	@file	exp_kernel.hpp
+ *
+ *	@brief	batch::exp, batch::exp2 のカーネルの定義
+ */
+
+#ifndef HAMON_CMATH_BATCH_DETAIL_EXP_KERNEL_HPP
+#define HAMON_CMATH_BATCH_DETAIL_EXP_KERNEL_HPP
+
+#include <hamon/cmath/batch/detail/simd.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+namespace batch
+{
+
+namespace detail
+{
+
+// 結果が正規化数に収まる引数の範囲。これを超える値(と NaN)はスカラー版で計算する。
+inline HAMON_CONSTEXPR double exp_max_arg(double_tag) HAMON_NOEXCEPT { return 708.0; }
+inline HAMON_CONSTEXPR float  exp_max_arg(float_tag)  HAMON_NOEXCEPT { return 87.0f; }
+inline HAMON_CONSTEXPR double exp2_max_arg(double_tag) HAMON_NOEXCEPT { return 1021.0; }
+inline HAMON_CONSTEXPR float  exp2_max_arg(float_tag)  HAMON_NOEXCEPT { return 125.0f; }
+
+// |hi - lo| <= ln2/2 での exp(hi - lo) に 2^k を掛けた値 (fdlibm の __ieee754_exp)
+// k は整数値で、2^k が正規化数であること
+template <typename V>
+inline V
+exp_core(V hi, V lo, V k, double_tag) HAMON_NOEXCEPT
+{
+	using U = typename simd_traits<V>::uint_type;
+
+	V const P1 =  1.66666666666666019037e-01;
+	V const P2 = -2.77777777770155933842e-03;
+	V const P3 =  6.61375632143793436117e-05;
+	V const P4 = -1.65339022054652515390e-06;
+	V const P5 =  4.13813679705723846039e-08;
+
+	V const r = hi - lo;
+	V const t = r * r;
+	V const c = r - t * (P1 + t * (P2 + t * (P3 + t * (P4 + t * P5))));
+	V const y = V(1.0) - ((lo - (r * c) / (V(2.0) - c)) - hi);
+
+	// 2^k を指数部に直接組み立てる
+	V const scale = from_bits(shl(vtoint(k) + U(1023), 52));
+	return y * scale;
+}
+
+// float 版 (fdlibm の __ieee754_expf)
+template <typename V>
+inline V
+exp_core(V hi, V lo, V k, float_tag) HAMON_NOEXCEPT
+{
+	using U = typename simd_traits<V>::uint_type;
+
+	V const P1 =  1.6666625440e-1f;
+	V const P2 = -2.7667332906e-3f;
+
+	V const r = hi - lo;
+	V const t = r * r;
+	V const c = r - t * (P1 + t * P2);
+	V const y = V(1.0f) - ((lo - (r * c) / (V(2.0f) - c)) - hi);
+
+	V const scale = from_bits(shl(vtoint(k) + U(127), 23));
+	return y * scale;
+}
+
+template <typename V>
+inline V
+exp_core(V hi, V lo, V k) HAMON_NOEXCEPT
+{
+	return exp_core(hi, lo, k, value_tag<V>{});
+}
+
+template <typename V>
+inline V
+exp_kernel(V x, double_tag) HAMON_NOEXCEPT
+{
+	V const invln2 = 1.44269504088896338700e+00;
+	V const ln2_hi = 6.93147180369123816490e-01;
+	V const ln2_lo = 1.90821492927058770002e-10;
+
+	// ln2_hi の下位ビットは 0 なので、k * ln2_hi は誤差なく計算できる
+	V const k = vround(x * invln2);
+	return exp_core(x - k * ln2_hi, k * ln2_lo, k);
+}
+
+template <typename V>
+inline V
+exp_kernel(V x, float_tag) HAMON_NOEXCEPT
+{
+	V const invln2 = 1.4426950216e+00f;
+	V const ln2_hi = 6.9314575195e-01f;
+	V const ln2_lo = 1.4286067653e-06f;
+
+	V const k = vround(x * invln2);
+	return exp_core(x - k * ln2_hi, k * ln2_lo, k);
+}
+
+template <typename V>
+inline V
+exp_kernel(V x) HAMON_NOEXCEPT
+{
+	return exp_kernel(x, value_tag<V>{});
+}
+
+// Veltkamp の分割に使う定数 (2^(仮数部のビット数の半分) + 1)
+inline HAMON_CONSTEXPR double veltkamp_split(double_tag) HAMON_NOEXCEPT { return 134217729.0; }	// 2^27 + 1
+inline HAMON_CONSTEXPR float  veltkamp_split(float_tag)  HAMON_NOEXCEPT { return 4097.0f; }	// 2^12 + 1
+
+// Veltkamp の分割による a * b = p + e (e は丸め誤差)
+template <typename V>
+inline V
+two_prod_error(V a, V b, V p) HAMON_NOEXCEPT
+{
+	V const split = veltkamp_split(value_tag<V>{});
+	V const ca = split * a;
+	V const ah = ca - (ca - a);
+	V const al = a - ah;
+	V const cb = split * b;
+	V const bh = cb - (cb - b);
+	V const bl = b - bh;
+	return ((ah * bh - p) + ah * bl + al * bh) + al * bl;
+}
+
+// ln(2) を最も近い値 (head) と残り (tail) に分けたもの
+inline HAMON_CONSTEXPR double ln2_head(double_tag) HAMON_NOEXCEPT { return 6.93147180559945286227e-01; }
+inline HAMON_CONSTEXPR double ln2_tail(double_tag) HAMON_NOEXCEPT { return 2.31904681384629961549e-17; }
+inline HAMON_CONSTEXPR float  ln2_head(float_tag)  HAMON_NOEXCEPT { return 6.9314718246e-01f; }
+inline HAMON_CONSTEXPR float  ln2_tail(float_tag)  HAMON_NOEXCEPT { return -1.9046542999e-09f; }
+
+// |t| <= 1/2 程度での 2^t に 2^k を掛けた値
+template <typename V>
+inline V
+exp2_core(V t, V k) HAMON_NOEXCEPT
+{
+	V const ln2    = ln2_head(value_tag<V>{});
+	V const ln2_lo = ln2_tail(value_tag<V>{});
+
+	// t * ln(2) を hi + (-lo) の2つの値で表す
+	V const hi = t * ln2;
+	V const lo = -(two_prod_error(t, ln2, hi) + t * ln2_lo);
+	return exp_core(hi, lo, k);
+}
+
+template <typename V>
+inline V
+exp2_kernel(V x) HAMON_NOEXCEPT
+{
+	V const k = vround(x);
+	return exp2_core(x - k, k);
+}
+
+template <typename V>
+inline typename simd_traits<V>::mask_type
+exp_special(V x) HAMON_NOEXCEPT
+{
+	V const m = exp_max_arg(value_tag<V>{});
+	return mask_not(mask_and(le(x, m), ge(x, -m)));
+}
+
+template <typename V>
+inline typename simd_traits<V>::mask_type
+exp2_special(V x) HAMON_NOEXCEPT
+{
+	V const m = exp2_max_arg(value_tag<V>{});
+	return mask_not(mask_and(le(x, m), ge(x, -m)));
+}
+
+}	// namespace detail
+
+}	// namespace batch
+
+}	// namespace hamon
+
+#endif // HAMON_CMATH_BATCH_DETAIL_EXP_KERNEL_HPP
@@ -0,0 +1,256 @@
+﻿/**
+ *	@file	log_kernel.hpp
+ *
+ *	@brief	batch::log, batch::log2, batch::log10 のカーネルの定義
+ */
+
+#ifndef HAMON_CMATH_BATCH_DETAIL_LOG_KERNEL_HPP
+#define HAMON_CMATH_BATCH_DETAIL_LOG_KERNEL_HPP
+
+#include <hamon/cmath/batch/detail/simd.hpp>
+#include <hamon/cstdint/uint32_t.hpp>
+#include <hamon/cstdint/uint64_t.hpp>
+#include <hamon/limits.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+namespace batch
+{
+
+namespace detail
+{
+
+// x = 2^k * (1 + f), sqrt(2)/2 <= 1 + f < sqrt(2) と分解した結果
+template <typename V>
+struct log_reduced
+{
+	V k;
+	V f;
+	V hfsq;		// f * f / 2
+	V r;		// log(1 + f) - (f - hfsq)
+};
+
+// x は正の正規化数であること (fdlibm の k_log.h と同じ分解)
+template <typename V>
+inline log_reduced<V>
+log_reduce(V x, double_tag) HAMON_NOEXCEPT
+{
+	using U = typename simd_traits<V>::uint_type;
+
+	V const Lg1 = 6.666666666666735130e-01;
+	V const Lg2 = 3.999999999940941908e-01;
+	V const Lg3 = 2.857142874366239149e-01;
+	V const Lg4 = 2.222219843214978396e-01;
+	V const Lg5 = 1.818357216161805012e-01;
+	V const Lg6 = 1.531383769920937332e-01;
+	V const Lg7 = 1.479819860511658591e-01;
+
+	// 仮数部が sqrt(2)/2 以上になるように指数部をずらす。
+	// 符号付きのシフトを使わないように、指数部に 1024 を足しておく。
+	U const sqrt2_2 = 0x3fe6a09e667f3bcdull;
+	U const ix = to_bits(x) + U(0x4000000000000000ull) - sqrt2_2;
+	U const e = shr(ix, 52);
+	V const k = from_bits(U(0x4330000000000000ull) | e) - V(4503599627371520.0);	// 2^52 + 1024
+	V const m = from_bits((ix & U(0x000fffffffffffffull)) + sqrt2_2);
+
+	V const f = m - V(1.0);
+	V const hfsq = V(0.5) * f * f;
+	V const s = f / (V(2.0) + f);
+	V const z = s * s;
+	V const w = z * z;
+	V const t1 = w * (Lg2 + w * (Lg4 + w * Lg6));
+	V const t2 = z * (Lg1 + w * (Lg3 + w * (Lg5 + w * Lg7)));
+	return { k, f, hfsq, s * (hfsq + t2 + t1) };
+}
+
+// float 版 (fdlibm の k_logf.h)
+template <typename V>
+inline log_reduced<V>
+log_reduce(V x, float_tag) HAMON_NOEXCEPT
+{
+	using U = typename simd_traits<V>::uint_type;
+
+	V const Lg1 = 6.6666662693e-01f;
+	V const Lg2 = 4.0000972152e-01f;
+	V const Lg3 = 2.8498786688e-01f;
+	V const Lg4 = 2.4279078841e-01f;
+
+	U const sqrt2_2 = 0x3f3504f3u;
+	U const ix = to_bits(x) + U(0x40000000u) - sqrt2_2;
+	U const e = shr(ix, 23);
+	V const k = from_bits(U(0x4b000000u) | e) - V(8388736.0f);	// 2^23 + 128
+	V const m = from_bits((ix & U(0x007fffffu)) + sqrt2_2);
+
+	V const f = m - V(1.0f);
+	V const hfsq = V(0.5f) * f * f;
+	V const s = f / (V(2.0f) + f);
+	V const z = s * s;
+	V const w = z * z;
+	V const t1 = w * (Lg2 + w * Lg4);
+	V const t2 = z * (Lg1 + w * Lg3);
+	return { k, f, hfsq, s * (hfsq + t2 + t1) };
+}
+
+template <typename V>
+inline V
+log_kernel(V x, double_tag) HAMON_NOEXCEPT
+{
+	V const ln2_hi = 6.93147180369123816490e-01;
+	V const ln2_lo = 1.90821492927058770002e-10;
+
+	auto const a = log_reduce(x, double_tag{});
+	return a.k * ln2_hi - ((a.hfsq - (a.r + a.k * ln2_lo)) - a.f);
+}
+
+template <typename V>
+inline V
+log_kernel(V x, float_tag) HAMON_NOEXCEPT
+{
+	V const ln2_hi = 6.9313812256e-01f;
+	V const ln2_lo = 9.0580006145e-06f;
+
+	auto const a = log_reduce(x, float_tag{});
+	return a.k * ln2_hi - ((a.hfsq - (a.r + a.k * ln2_lo)) - a.f);
+}
+
+template <typename V>
+inline V
+log_kernel(V x) HAMON_NOEXCEPT
+{
+	return log_kernel(x, value_tag<V>{});
+}
+
+// 仮数部の上位半分だけを残すマスク
+inline HAMON_CONSTEXPR hamon::uint64_t high_half_mask(double_tag) HAMON_NOEXCEPT { return 0xffffffff00000000ull; }
+inline HAMON_CONSTEXPR hamon::uint32_t high_half_mask(float_tag)  HAMON_NOEXCEPT { return 0xfffff000u; }
+
+// log(1 + f) を仮数部の上位半分に収まる hi と lo に分ける
+template <typename V>
+inline void
+log_split(log_reduced<V> const& a, V& hi, V& lo) HAMON_NOEXCEPT
+{
+	using U = typename simd_traits<V>::uint_type;
+	hi = from_bits(to_bits(a.f - a.hfsq) & U(high_half_mask(value_tag<V>{})));
+	lo = (a.f - hi) - a.hfsq + a.r;
+}
+
+// log2(x) を hi + lo で返す (fdlibm の e_log2.c, e_log2f.c)
+template <typename V>
+inline void
+log2_hi_lo(V x, V& hi, V& lo, double_tag) HAMON_NOEXCEPT
+{
+	V const ivln2hi = 1.44269504072144627571e+00;
+	V const ivln2lo = 1.67517131648865118353e-10;
+
+	auto const a = log_reduce(x, double_tag{});
+	V fh;
+	V fl;
+	log_split(a, fh, fl);
+
+	V const val_hi = fh * ivln2hi;
+	V const val_lo = (fl + fh) * ivln2lo + fl * ivln2hi;
+	V const w = a.k + val_hi;
+	lo = val_lo + ((a.k - w) + val_hi);
+	hi = w;
+}
+
+template <typename V>
+inline void
+log2_hi_lo(V x, V& hi, V& lo, float_tag) HAMON_NOEXCEPT
+{
+	V const ivln2hi =  1.4428710938e+00f;
+	V const ivln2lo = -1.7605285393e-04f;
+
+	auto const a = log_reduce(x, float_tag{});
+	V fh;
+	V fl;
+	log_split(a, fh, fl);
+
+	V const val_hi = fh * ivln2hi;
+	V const val_lo = (fl + fh) * ivln2lo + fl * ivln2hi;
+	V const w = a.k + val_hi;
+	lo = val_lo + ((a.k - w) + val_hi);
+	hi = w;
+}
+
+template <typename V>
+inline V
+log2_kernel(V x) HAMON_NOEXCEPT
+{
+	V hi;
+	V lo;
+	log2_hi_lo(x, hi, lo, value_tag<V>{});
+	return lo + hi;
+}
+
+// fdlibm の e_log10.c
+template <typename V>
+inline V
+log10_kernel(V x, double_tag) HAMON_NOEXCEPT
+{
+	V const ivln10hi  = 4.34294481878168880939e-01;
+	V const ivln10lo  = 2.50829467116452752298e-11;
+	V const log10_2hi = 3.01029995663611771306e-01;
+	V const log10_2lo = 3.69423907715893078616e-13;
+
+	auto const a = log_reduce(x, double_tag{});
+	V fh;
+	V fl;
+	log_split(a, fh, fl);
+
+	V const val_hi = fh * ivln10hi;
+	V const y2 = a.k * log10_2hi;
+	V const val_lo = a.k * log10_2lo + (fl + fh) * ivln10lo + fl * ivln10hi;
+	V const w = y2 + val_hi;
+	return (val_lo + ((y2 - w) + val_hi)) + w;
+}
+
+// fdlibm の e_log10f.c
+template <typename V>
+inline V
+log10_kernel(V x, float_tag) HAMON_NOEXCEPT
+{
+	V const ivln10hi  =  4.3432617188e-01f;
+	V const ivln10lo  = -3.1689971365e-05f;
+	V const log10_2hi =  3.0102920532e-01f;
+	V const log10_2lo =  7.9034151668e-07f;
+
+	auto const a = log_reduce(x, float_tag{});
+	V fh;
+	V fl;
+	log_split(a, fh, fl);
+
+	V const val_hi = fh * ivln10hi;
+	V const y2 = a.k * log10_2hi;
+	V const val_lo = a.k * log10_2lo + (fl + fh) * ivln10lo + fl * ivln10hi;
+	V const w = y2 + val_hi;
+	return (val_lo + ((y2 - w) + val_hi)) + w;
+}
+
+template <typename V>
+inline V
+log10_kernel(V x) HAMON_NOEXCEPT
+{
+	return log10_kernel(x, value_tag<V>{});
+}
+
+// 正の正規化数で無い値(0, 負数, 非正規化数, ∞, NaN)はスカラー版で計算する
+template <typename V>
+inline typename simd_traits<V>::mask_type
+log_special(V x) HAMON_NOEXCEPT
+{
+	using T = typename simd_traits<V>::value_type;
+	return mask_not(mask_and(
+		ge(x, V(hamon::numeric_limits<T>::min())),
+		le(x, V(hamon::numeric_limits<T>::max()))));
+}
+
+}	// namespace detail
+
+}	// namespace batch
+
+}	// namespace hamon
+
+#endif // HAMON_CMATH_BATCH_DETAIL_LOG_KERNEL_HPP
@@ -0,0 +1,185 @@
+﻿/**
+ *	@file	pow_kernel.hpp
+ *
+ *	@brief	batch::pow のカーネルの定義
+ */
+
+#ifndef HAMON_CMATH_BATCH_DETAIL_POW_KERNEL_HPP
+#define HAMON_CMATH_BATCH_DETAIL_POW_KERNEL_HPP
+
+#include <hamon/cmath/batch/detail/exp_kernel.hpp>
+#include <hamon/cmath/batch/detail/log_kernel.hpp>
+#include <hamon/cmath/batch/detail/simd.hpp>
+#include <hamon/limits.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+namespace batch
+{
+
+namespace detail
+{
+
+// y * log2(x) がこの範囲を超える場合はスカラー版で計算する
+inline HAMON_CONSTEXPR double pow_max_exponent(double_tag) HAMON_NOEXCEPT { return 1020.0; }
+inline HAMON_CONSTEXPR float  pow_max_exponent(float_tag)  HAMON_NOEXCEPT { return 125.0f; }
+
+// 下位 32bit を 0 にする
+template <typename V>
+inline V
+clear_low_word(V x) HAMON_NOEXCEPT
+{
+	using U = typename simd_traits<V>::uint_type;
+	return from_bits(to_bits(x) & U(0xffffffff00000000ull));
+}
+
+// log2(x) を hi + lo で返す (fdlibm の e_pow.c)
+//
+// log2_hi_lo より精度が高く、hi + lo は log2(x) を約 64bit の精度で表す。
+// pow では y * log2(x) の誤差が指数に効くので、こちらを使う。
+// x は正の正規化数であること。
+template <typename V>
+inline void
+log2_ext(V x, V& hi, V& lo) HAMON_NOEXCEPT
+{
+	using U = typename simd_traits<V>::uint_type;
+
+	V const L1 = 5.99999999999994648725e-01;
+	V const L2 = 4.28571428578550184252e-01;
+	V const L3 = 3.33333329818377432918e-01;
+	V const L4 = 2.72728123808534006489e-01;
+	V const L5 = 2.30660745775561754067e-01;
+	V const L6 = 2.06975017800338417784e-01;
+	V const cp   =  9.61796693925975554329e-01;	// 2/(3*ln2)
+	V const cp_h =  9.61796700954437255859e-01;
+	V const cp_l = -7.02846165095275826516e-09;
+
+	// x = 2^n * m (1 <= m < 2)
+	U const bits = to_bits(x);
+	V n = from_bits(U(0x4330000000000000ull) | shr(bits, 52)) - V(4503599627371519.0);	// 2^52 + 1023
+	V m = from_bits((bits & U(0x000fffffffffffffull)) | U(0x3ff0000000000000ull));
+
+	// m を [sqrt(3)/2, sqrt(3)) に寄せて、1 と 1.5 のどちらに近いかで分ける
+	auto const big = ge(m, V(1.7320499420166016));
+	m = select(big, m * V(0.5), m);
+	n = select(big, n + V(1.0), n);
+	auto const k = ge(m, V(1.224745750427246));
+	V const bp   = select(k, V(1.5), V(1.0));
+	V const dp_h = select(k, V(5.84962487220764160156e-01), V(0.0));	// log2(1.5) の上位
+	V const dp_l = select(k, V(1.35003920212974897128e-08), V(0.0));	// log2(1.5) の下位
+
+	// s = (m - bp) / (m + bp) を s_h + s_l で表す
+	V const u0 = m - bp;
+	V const v0 = V(1.0) / (m + bp);
+	V const ss = u0 * v0;
+	V const s_h = clear_low_word(ss);
+	V const t_h0 = clear_low_word(m + bp);
+	V const t_l0 = m - (t_h0 - bp);
+	V const s_l = v0 * ((u0 - s_h * t_h0) - s_h * t_l0);
+
+	// log(m / bp) = 2s + 2s^3/3 + ... に 3 / (2 * ln2) を掛けたもの
+	V s2 = ss * ss;
+	V r = s2 * s2 * (L1 + s2 * (L2 + s2 * (L3 + s2 * (L4 + s2 * (L5 + s2 * L6)))));
+	r = r + s_l * (s_h + ss);
+	s2 = s_h * s_h;
+	V const t_h = clear_low_word(V(3.0) + s2 + r);
+	V const t_l = r - ((t_h - V(3.0)) - s2);
+	V const u = s_h * t_h;
+	V const v = s_l * t_h + t_l * ss;
+	V const p_h = clear_low_word(u + v);
+	V const p_l = v - (p_h - u);
+	V const z_h = cp_h * p_h;
+	V const z_l = cp_l * p_h + p_l * cp + dp_l;
+
+	// log2(x) = n + dp + z
+	V const t1 = clear_low_word(((z_h + z_l) + dp_h) + n);
+	hi = t1;
+	lo = z_l - (((t1 - n) - dp_h) - z_h);
+}
+
+// pow(x, y) = 2^(y * log2(x))
+// log2(x) と y * log2(x) を2つの double で表して、指数の誤差を抑える。
+//
+// x が正の正規化数で、y が有限で、y * log2(x) が範囲内の場合以外は special を true にする。
+template <typename V>
+inline V
+pow_kernel(V x, V y, typename simd_traits<V>::mask_type& special, double_tag) HAMON_NOEXCEPT
+{
+	V lh;
+	V ll;
+	log2_ext(x, lh, ll);
+
+	// y が大きすぎると two_prod_error の分割で溢れるので、y の範囲も制限する
+	auto const y_ok = mask_and(le(y, V(1.0e300)), ge(y, V(-1.0e300)));
+	V const yy = select(y_ok, y, V(0.0));
+
+	V const ph = yy * lh;
+	V const pl = two_prod_error(yy, lh, ph) + yy * ll;
+
+	V const max_exponent = pow_max_exponent(double_tag{});
+	auto const p_ok = mask_and(le(ph, max_exponent), ge(ph, -max_exponent));
+	special = mask_or(log_special(x), mask_not(mask_and(y_ok, p_ok)));
+
+	V const k = vround(select(p_ok, ph, V(0.0)));
+	return exp2_core((ph - k) + pl, k);
+}
+
+// float の pow は y * log2(x) を double で計算する。
+// float の精度では y * log2(x) の誤差が結果の誤差として大きく現れるが、
+// double の log2_kernel と exp2_kernel を使えば、2つの値に分けなくても十分な精度になる。
+//
+// p には float に丸めた y * log2(x) を返す。
+inline float
+pow_wide(float x, float y, float& p) HAMON_NOEXCEPT
+{
+	double const w = static_cast<double>(y) * log2_kernel(static_cast<double>(x));
+	// float に収まらない値(と NaN)は範囲外の値にしておく
+	p = static_cast<float>((w <= 1.0e30 && w >= -1.0e30) ? w : 1.0e30);
+	return static_cast<float>(exp2_kernel(w));
+}
+
+#if defined(HAMON_CMATH_BATCH_SIMD)
+inline simd_float
+pow_wide(simd_float x, simd_float y, simd_float& p) HAMON_NOEXCEPT
+{
+	simd_double x0, x1, y0, y1;
+	widen(x, x0, x1);
+	widen(y, y0, y1);
+	simd_double const w0 = y0 * log2_kernel(x0);
+	simd_double const w1 = y1 * log2_kernel(x1);
+	p = narrow(w0, w1);
+	return narrow(exp2_kernel(w0), exp2_kernel(w1));
+}
+#endif
+
+template <typename V>
+inline V
+pow_kernel(V x, V y, typename simd_traits<V>::mask_type& special, float_tag) HAMON_NOEXCEPT
+{
+	V p;
+	V const r = pow_wide(x, y, p);
+
+	V const max_y = hamon::numeric_limits<float>::max();
+	V const max_exponent = pow_max_exponent(float_tag{});
+	auto const y_ok = mask_and(le(y, max_y), ge(y, -max_y));
+	auto const p_ok = mask_and(le(p, max_exponent), ge(p, -max_exponent));
+	special = mask_or(log_special(x), mask_not(mask_and(y_ok, p_ok)));
+	return r;
+}
+
+template <typename V>
+inline V
+pow_kernel(V x, V y, typename simd_traits<V>::mask_type& special) HAMON_NOEXCEPT
+{
+	return pow_kernel(x, y, special, value_tag<V>{});
+}
+
+}	// namespace detail
+
+}	// namespace batch
+
+}	// namespace hamon
+
+#endif // HAMON_CMATH_BATCH_DETAIL_POW_KERNEL_HPP
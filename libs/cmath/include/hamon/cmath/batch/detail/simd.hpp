@@ -0,0 +1,693 @@
+﻿/**
+ *	@file	simd.hpp
+ *
+ *	@brief	batch 関数の内部で使う SIMD 型の定義
+ */
+
+#ifndef HAMON_CMATH_BATCH_DETAIL_SIMD_HPP
+#define HAMON_CMATH_BATCH_DETAIL_SIMD_HPP
+
+#include <hamon/cmath/batch/detail/simd_uint64.hpp>
+#include <hamon/bit/bit_cast.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/cstdint/int32_t.hpp>
+#include <hamon/cstdint/int64_t.hpp>
+#include <hamon/cstdint/uint32_t.hpp>
+#include <hamon/cstdint/uint64_t.hpp>
+#include <hamon/type_traits/type_identity.hpp>
+#include <hamon/config.hpp>
+#include <cmath>
+
+// SSE2, AVX2, AArch64 の NEON で SIMD 実装を使う。HAMON_NO_SIMD を定義すると使わない。
+#if defined(HAMON_SIMD_AVX2) || defined(HAMON_SIMD_SSE2) || defined(HAMON_SIMD_NEON64)
+#  define HAMON_CMATH_BATCH_SIMD
+#endif
+
+namespace hamon
+{
+
+namespace batch
+{
+
+namespace detail
+{
+
+// カーネルは double, hamon::uint64_t, bool を要素とする次の操作だけを使って書く。
+// スカラー版はそれぞれの型そのものを使い、SIMD 版は simd_double, simd_uint64, simd_mask を使う。
+// float のカーネルは同様に float, hamon::uint32_t, bool (SIMD 版は simd_float, simd_uint32, simd_float_mask) を使う。
+//
+// 算術演算   : + - * / (浮動小数点数), + - & | ^ (整数)
+// 比較       : lt, le, gt, ge, eq -> mask
+// マスク     : mask_and, mask_or, mask_not, any, select, mask_from_bits
+// ビット操作 : to_bits, from_bits, shl, shr
+// その他     : vround (最も近い整数への丸め), vtoint (整数値の double を整数へ),
+//              vsqrt, gather
+// 型の変換   : widen (simd_float の前半と後半を simd_double へ), narrow (その逆)。SIMD 版だけにある。
+
+// カーネルを要素の型で選ぶためのタグ
+using double_tag = hamon::type_identity<double>;
+using float_tag  = hamon::type_identity<float>;
+
+// スカラー版
+
+inline bool lt(double a, double b) HAMON_NOEXCEPT { return a <  b; }
+inline bool le(double a, double b) HAMON_NOEXCEPT { return a <= b; }
+inline bool gt(double a, double b) HAMON_NOEXCEPT { return a >  b; }
+inline bool ge(double a, double b) HAMON_NOEXCEPT { return a >= b; }
+inline bool eq(double a, double b) HAMON_NOEXCEPT { return a == b; }
+
+inline bool mask_and(bool a, bool b) HAMON_NOEXCEPT { return a && b; }
+inline bool mask_or(bool a, bool b) HAMON_NOEXCEPT { return a || b; }
+inline bool mask_not(bool a) HAMON_NOEXCEPT { return !a; }
+inline bool any(bool a) HAMON_NOEXCEPT { return a; }
+inline double select(bool m, double a, double b) HAMON_NOEXCEPT { return m ? a : b; }
+inline bool mask_from_bits(hamon::uint64_t a) HAMON_NOEXCEPT { return a != 0; }
+
+inline hamon::uint64_t to_bits(double a) HAMON_NOEXCEPT { return hamon::bit_cast<hamon::uint64_t>(a); }
+inline double from_bits(hamon::uint64_t a) HAMON_NOEXCEPT { return hamon::bit_cast<double>(a); }
+inline hamon::uint64_t shl(hamon::uint64_t a, int n) HAMON_NOEXCEPT { return a << n; }
+inline hamon::uint64_t shr(hamon::uint64_t a, int n) HAMON_NOEXCEPT { return a >> n; }
+
+inline double vround(double a) HAMON_NOEXCEPT { return std::nearbyint(a); }
+inline hamon::uint64_t vtoint(double a) HAMON_NOEXCEPT
+{
+	// 範囲外の値(カーネルが結果を捨てる要素)の変換が未定義動作にならないようにする
+	return (a >= -2147483648.0 && a <= 2147483647.0) ?
+		static_cast<hamon::uint64_t>(static_cast<hamon::int64_t>(a)) : 0;
+}
+inline double vsqrt(double a) HAMON_NOEXCEPT { return std::sqrt(a); }
+inline double gather(double const* table, hamon::uint64_t i) HAMON_NOEXCEPT { return table[i]; }
+
+inline bool lt(float a, float b) HAMON_NOEXCEPT { return a <  b; }
+inline bool le(float a, float b) HAMON_NOEXCEPT { return a <= b; }
+inline bool gt(float a, float b) HAMON_NOEXCEPT { return a >  b; }
+inline bool ge(float a, float b) HAMON_NOEXCEPT { return a >= b; }
+inline bool eq(float a, float b) HAMON_NOEXCEPT { return a == b; }
+
+inline float select(bool m, float a, float b) HAMON_NOEXCEPT { return m ? a : b; }
+inline bool mask_from_bits(hamon::uint32_t a) HAMON_NOEXCEPT { return a != 0; }
+
+inline hamon::uint32_t to_bits(float a) HAMON_NOEXCEPT { return hamon::bit_cast<hamon::uint32_t>(a); }
+inline float from_bits(hamon::uint32_t a) HAMON_NOEXCEPT { return hamon::bit_cast<float>(a); }
+inline hamon::uint32_t shl(hamon::uint32_t a, int n) HAMON_NOEXCEPT { return a << n; }
+inline hamon::uint32_t shr(hamon::uint32_t a, int n) HAMON_NOEXCEPT { return a >> n; }
+
+inline float vround(float a) HAMON_NOEXCEPT { return std::nearbyint(a); }
+inline hamon::uint32_t vtoint(float a) HAMON_NOEXCEPT
+{
+	return (a >= -2147483648.0f && a < 2147483648.0f) ?
+		static_cast<hamon::uint32_t>(static_cast<hamon::int32_t>(a)) : 0;
+}
+inline float vsqrt(float a) HAMON_NOEXCEPT { return std::sqrt(a); }
+inline float gather(float const* table, hamon::uint32_t i) HAMON_NOEXCEPT { return table[i]; }
+
+template <typename V>
+struct simd_traits;
+
+template <typename V>
+using value_tag = hamon::type_identity<typename simd_traits<V>::value_type>;
+
+// 符号ビットだけが立った値
+inline HAMON_CONSTEXPR hamon::uint64_t sign_bit(double_tag) HAMON_NOEXCEPT { return 0x8000000000000000ull; }
+inline HAMON_CONSTEXPR hamon::uint32_t sign_bit(float_tag) HAMON_NOEXCEPT { return 0x80000000u; }
+
+template <>
+struct simd_traits<double>
+{
+	using value_type = double;
+	using uint_type = hamon::uint64_t;
+	using mask_type = bool;
+
+	static constexpr hamon::size_t lanes = 1;
+
+	template <typename T>
+	static double load(T const* p) HAMON_NOEXCEPT { return static_cast<double>(*p); }
+
+	template <typename T>
+	static void store(T* p, double v) HAMON_NOEXCEPT { *p = static_cast<T>(v); }
+};
+
+template <>
+struct simd_traits<float>
+{
+	using value_type = float;
+	using uint_type = hamon::uint32_t;
+	using mask_type = bool;
+
+	static constexpr hamon::size_t lanes = 1;
+
+	static float load(float const* p) HAMON_NOEXCEPT { return *p; }
+	static void store(float* p, float v) HAMON_NOEXCEPT { *p = v; }
+};
+
+#if defined(HAMON_SIMD_AVX2)
+
+struct simd_mask
+{
+	__m256d v;
+};
+
+struct simd_double
+{
+	__m256d v;
+
+	simd_double() = default;
+	simd_double(__m256d x) HAMON_NOEXCEPT : v(x) {}
+	simd_double(double x) HAMON_NOEXCEPT : v(_mm256_set1_pd(x)) {}
+
+	friend simd_double operator+(simd_double a, simd_double b) HAMON_NOEXCEPT { return _mm256_add_pd(a.v, b.v); }
+	friend simd_double operator-(simd_double a, simd_double b) HAMON_NOEXCEPT { return _mm256_sub_pd(a.v, b.v); }
+	friend simd_double operator*(simd_double a, simd_double b) HAMON_NOEXCEPT { return _mm256_mul_pd(a.v, b.v); }
+	friend simd_double operator/(simd_double a, simd_double b) HAMON_NOEXCEPT { return _mm256_div_pd(a.v, b.v); }
+	friend simd_double operator-(simd_double a) HAMON_NOEXCEPT { return _mm256_xor_pd(a.v, _mm256_set1_pd(-0.0)); }
+};
+
+inline simd_mask lt(simd_double a, simd_double b) HAMON_NOEXCEPT { return { _mm256_cmp_pd(a.v, b.v, _CMP_LT_OQ) }; }
+inline simd_mask le(simd_double a, simd_double b) HAMON_NOEXCEPT { return { _mm256_cmp_pd(a.v, b.v, _CMP_LE_OQ) }; }
+inline simd_mask gt(simd_double a, simd_double b) HAMON_NOEXCEPT { return { _mm256_cmp_pd(a.v, b.v, _CMP_GT_OQ) }; }
+inline simd_mask ge(simd_double a, simd_double b) HAMON_NOEXCEPT { return { _mm256_cmp_pd(a.v, b.v, _CMP_GE_OQ) }; }
+inline simd_mask eq(simd_double a, simd_double b) HAMON_NOEXCEPT { return { _mm256_cmp_pd(a.v, b.v, _CMP_EQ_OQ) }; }
+
+inline simd_mask mask_and(simd_mask a, simd_mask b) HAMON_NOEXCEPT { return { _mm256_and_pd(a.v, b.v) }; }
+inline simd_mask mask_or(simd_mask a, simd_mask b) HAMON_NOEXCEPT { return { _mm256_or_pd(a.v, b.v) }; }
+inline simd_mask mask_not(simd_mask a) HAMON_NOEXCEPT
+{
+	return { _mm256_xor_pd(a.v, _mm256_castsi256_pd(_mm256_set1_epi64x(-1))) };
+}
+inline bool any(simd_mask a) HAMON_NOEXCEPT { return _mm256_movemask_pd(a.v) != 0; }
+inline simd_double select(simd_mask m, simd_double a, simd_double b) HAMON_NOEXCEPT
+{
+	return _mm256_blendv_pd(b.v, a.v, m.v);
+}
+inline simd_mask mask_from_bits(simd_uint64 a) HAMON_NOEXCEPT { return { _mm256_castsi256_pd(a.v) }; }
+
+inline simd_uint64 to_bits(simd_double a) HAMON_NOEXCEPT { return _mm256_castpd_si256(a.v); }
+inline simd_double from_bits(simd_uint64 a) HAMON_NOEXCEPT { return _mm256_castsi256_pd(a.v); }
+
+inline simd_double vround(simd_double a) HAMON_NOEXCEPT
+{
+	return _mm256_round_pd(a.v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+}
+inline simd_uint64 vtoint(simd_double a) HAMON_NOEXCEPT
+{
+	return _mm256_cvtepi32_epi64(_mm256_cvtpd_epi32(a.v));
+}
+inline simd_double vsqrt(simd_double a) HAMON_NOEXCEPT { return _mm256_sqrt_pd(a.v); }
+inline simd_double gather(double const* table, simd_uint64 i) HAMON_NOEXCEPT
+{
+	return _mm256_i64gather_pd(table, i.v, 8);
+}
+
+template <>
+struct simd_traits<simd_double>
+{
+	using value_type = double;
+	using uint_type = simd_uint64;
+	using mask_type = simd_mask;
+
+	static constexpr hamon::size_t lanes = 4;
+
+	static simd_double load(double const* p) HAMON_NOEXCEPT { return _mm256_loadu_pd(p); }
+	static void store(double* p, simd_double v) HAMON_NOEXCEPT { _mm256_storeu_pd(p, v.v); }
+};
+
+struct simd_float_mask
+{
+	__m256 v;
+};
+
+struct simd_uint32
+{
+	__m256i v;
+
+	simd_uint32() = default;
+	simd_uint32(__m256i x) HAMON_NOEXCEPT : v(x) {}
+	simd_uint32(hamon::uint32_t x) HAMON_NOEXCEPT : v(_mm256_set1_epi32(static_cast<int>(x))) {}
+
+	friend simd_uint32 operator+(simd_uint32 a, simd_uint32 b) HAMON_NOEXCEPT { return _mm256_add_epi32(a.v, b.v); }
+	friend simd_uint32 operator-(simd_uint32 a, simd_uint32 b) HAMON_NOEXCEPT { return _mm256_sub_epi32(a.v, b.v); }
+	friend simd_uint32 operator&(simd_uint32 a, simd_uint32 b) HAMON_NOEXCEPT { return _mm256_and_si256(a.v, b.v); }
+	friend simd_uint32 operator|(simd_uint32 a, simd_uint32 b) HAMON_NOEXCEPT { return _mm256_or_si256(a.v, b.v); }
+	friend simd_uint32 operator^(simd_uint32 a, simd_uint32 b) HAMON_NOEXCEPT { return _mm256_xor_si256(a.v, b.v); }
+};
+
+inline simd_uint32 shl(simd_uint32 a, int n) HAMON_NOEXCEPT { return _mm256_sll_epi32(a.v, _mm_cvtsi32_si128(n)); }
+inline simd_uint32 shr(simd_uint32 a, int n) HAMON_NOEXCEPT { return _mm256_srl_epi32(a.v, _mm_cvtsi32_si128(n)); }
+
+struct simd_float
+{
+	__m256 v;
+
+	simd_float() = default;
+	simd_float(__m256 x) HAMON_NOEXCEPT : v(x) {}
+	simd_float(float x) HAMON_NOEXCEPT : v(_mm256_set1_ps(x)) {}
+
+	friend simd_float operator+(simd_float a, simd_float b) HAMON_NOEXCEPT { return _mm256_add_ps(a.v, b.v); }
+	friend simd_float operator-(simd_float a, simd_float b) HAMON_NOEXCEPT { return _mm256_sub_ps(a.v, b.v); }
+	friend simd_float operator*(simd_float a, simd_float b) HAMON_NOEXCEPT { return _mm256_mul_ps(a.v, b.v); }
+	friend simd_float operator/(simd_float a, simd_float b) HAMON_NOEXCEPT { return _mm256_div_ps(a.v, b.v); }
+	friend simd_float operator-(simd_float a) HAMON_NOEXCEPT { return _mm256_xor_ps(a.v, _mm256_set1_ps(-0.0f)); }
+};
+
+inline simd_float_mask lt(simd_float a, simd_float b) HAMON_NOEXCEPT { return { _mm256_cmp_ps(a.v, b.v, _CMP_LT_OQ) }; }
+inline simd_float_mask le(simd_float a, simd_float b) HAMON_NOEXCEPT { return { _mm256_cmp_ps(a.v, b.v, _CMP_LE_OQ) }; }
+inline simd_float_mask gt(simd_float a, simd_float b) HAMON_NOEXCEPT { return { _mm256_cmp_ps(a.v, b.v, _CMP_GT_OQ) }; }
+inline simd_float_mask ge(simd_float a, simd_float b) HAMON_NOEXCEPT { return { _mm256_cmp_ps(a.v, b.v, _CMP_GE_OQ) }; }
+inline simd_float_mask eq(simd_float a, simd_float b) HAMON_NOEXCEPT { return { _mm256_cmp_ps(a.v, b.v, _CMP_EQ_OQ) }; }
+
+inline simd_float_mask mask_and(simd_float_mask a, simd_float_mask b) HAMON_NOEXCEPT { return { _mm256_and_ps(a.v, b.v) }; }
+inline simd_float_mask mask_or(simd_float_mask a, simd_float_mask b) HAMON_NOEXCEPT { return { _mm256_or_ps(a.v, b.v) }; }
+inline simd_float_mask mask_not(simd_float_mask a) HAMON_NOEXCEPT
+{
+	return { _mm256_xor_ps(a.v, _mm256_castsi256_ps(_mm256_set1_epi32(-1))) };
+}
+inline bool any(simd_float_mask a) HAMON_NOEXCEPT { return _mm256_movemask_ps(a.v) != 0; }
+inline simd_float select(simd_float_mask m, simd_float a, simd_float b) HAMON_NOEXCEPT
+{
+	return _mm256_blendv_ps(b.v, a.v, m.v);
+}
+inline simd_float_mask mask_from_bits(simd_uint32 a) HAMON_NOEXCEPT { return { _mm256_castsi256_ps(a.v) }; }
+
+inline simd_uint32 to_bits(simd_float a) HAMON_NOEXCEPT { return _mm256_castps_si256(a.v); }
+inline simd_float from_bits(simd_uint32 a) HAMON_NOEXCEPT { return _mm256_castsi256_ps(a.v); }
+
+inline simd_float vround(simd_float a) HAMON_NOEXCEPT
+{
+	return _mm256_round_ps(a.v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+}
+inline simd_uint32 vtoint(simd_float a) HAMON_NOEXCEPT { return _mm256_cvtps_epi32(a.v); }
+inline simd_float vsqrt(simd_float a) HAMON_NOEXCEPT { return _mm256_sqrt_ps(a.v); }
+inline simd_float gather(float const* table, simd_uint32 i) HAMON_NOEXCEPT
+{
+	return _mm256_i32gather_ps(table, i.v, 4);
+}
+
+inline void widen(simd_float a, simd_double& lo, simd_double& hi) HAMON_NOEXCEPT
+{
+	lo = _mm256_cvtps_pd(_mm256_castps256_ps128(a.v));
+	hi = _mm256_cvtps_pd(_mm256_extractf128_ps(a.v, 1));
+}
+inline simd_float narrow(simd_double lo, simd_double hi) HAMON_NOEXCEPT
+{
+	return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm256_cvtpd_ps(lo.v)), _mm256_cvtpd_ps(hi.v), 1);
+}
+
+template <>
+struct simd_traits<simd_float>
+{
+	using value_type = float;
+	using uint_type = simd_uint32;
+	using mask_type = simd_float_mask;
+
+	static constexpr hamon::size_t lanes = 8;
+
+	static simd_float load(float const* p) HAMON_NOEXCEPT { return _mm256_loadu_ps(p); }
+	static void store(float* p, simd_float v) HAMON_NOEXCEPT { _mm256_storeu_ps(p, v.v); }
+};
+
+#elif defined(HAMON_SIMD_SSE2)
+
+struct simd_mask
+{
+	__m128d v;
+};
+
+struct simd_double
+{
+	__m128d v;
+
+	simd_double() = default;
+	simd_double(__m128d x) HAMON_NOEXCEPT : v(x) {}
+	simd_double(double x) HAMON_NOEXCEPT : v(_mm_set1_pd(x)) {}
+
+	friend simd_double operator+(simd_double a, simd_double b) HAMON_NOEXCEPT { return _mm_add_pd(a.v, b.v); }
+	friend simd_double operator-(simd_double a, simd_double b) HAMON_NOEXCEPT { return _mm_sub_pd(a.v, b.v); }
+	friend simd_double operator*(simd_double a, simd_double b) HAMON_NOEXCEPT { return _mm_mul_pd(a.v, b.v); }
+	friend simd_double operator/(simd_double a, simd_double b) HAMON_NOEXCEPT { return _mm_div_pd(a.v, b.v); }
+	friend simd_double operator-(simd_double a) HAMON_NOEXCEPT { return _mm_xor_pd(a.v, _mm_set1_pd(-0.0)); }
+};
+
+inline simd_mask lt(simd_double a, simd_double b) HAMON_NOEXCEPT { return { _mm_cmplt_pd(a.v, b.v) }; }
+inline simd_mask le(simd_double a, simd_double b) HAMON_NOEXCEPT { return { _mm_cmple_pd(a.v, b.v) }; }
+inline simd_mask gt(simd_double a, simd_double b) HAMON_NOEXCEPT { return { _mm_cmpgt_pd(a.v, b.v) }; }
+inline simd_mask ge(simd_double a, simd_double b) HAMON_NOEXCEPT { return { _mm_cmpge_pd(a.v, b.v) }; }
+inline simd_mask eq(simd_double a, simd_double b) HAMON_NOEXCEPT { return { _mm_cmpeq_pd(a.v, b.v) }; }
+
+inline simd_mask mask_and(simd_mask a, simd_mask b) HAMON_NOEXCEPT { return { _mm_and_pd(a.v, b.v) }; }
+inline simd_mask mask_or(simd_mask a, simd_mask b) HAMON_NOEXCEPT { return { _mm_or_pd(a.v, b.v) }; }
+inline simd_mask mask_not(simd_mask a) HAMON_NOEXCEPT
+{
+	return { _mm_xor_pd(a.v, _mm_castsi128_pd(_mm_set1_epi32(-1))) };
+}
+inline bool any(simd_mask a) HAMON_NOEXCEPT { return _mm_movemask_pd(a.v) != 0; }
+inline simd_double select(simd_mask m, simd_double a, simd_double b) HAMON_NOEXCEPT
+{
+	return _mm_or_pd(_mm_and_pd(m.v, a.v), _mm_andnot_pd(m.v, b.v));
+}
+inline simd_mask mask_from_bits(simd_uint64 a) HAMON_NOEXCEPT { return { _mm_castsi128_pd(a.v) }; }
+
+inline simd_uint64 to_bits(simd_double a) HAMON_NOEXCEPT { return _mm_castpd_si128(a.v); }
+inline simd_double from_bits(simd_uint64 a) HAMON_NOEXCEPT { return _mm_castsi128_pd(a.v); }
+
+// SSE2 には丸め命令が無いので、int32 への変換(最も近い整数への丸め)を経由する。
+// カーネルが vround に渡す値の範囲は int32 に収まる。
+inline simd_double vround(simd_double a) HAMON_NOEXCEPT
+{
+	return _mm_cvtepi32_pd(_mm_cvtpd_epi32(a.v));
+}
+inline simd_uint64 vtoint(simd_double a) HAMON_NOEXCEPT
+{
+	__m128i const i = _mm_cvtpd_epi32(a.v);
+	return _mm_unpacklo_epi32(i, _mm_srai_epi32(i, 31));
+}
+inline simd_double vsqrt(simd_double a) HAMON_NOEXCEPT { return _mm_sqrt_pd(a.v); }
+inline simd_double gather(double const* table, simd_uint64 i) HAMON_NOEXCEPT
+{
+	hamon::uint64_t idx[2];
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(idx), i.v);
+	return _mm_setr_pd(table[idx[0]], table[idx[1]]);
+}
+
+template <>
+struct simd_traits<simd_double>
+{
+	using value_type = double;
+	using uint_type = simd_uint64;
+	using mask_type = simd_mask;
+
+	static constexpr hamon::size_t lanes = 2;
+
+	static simd_double load(double const* p) HAMON_NOEXCEPT { return _mm_loadu_pd(p); }
+	static void store(double* p, simd_double v) HAMON_NOEXCEPT { _mm_storeu_pd(p, v.v); }
+};
+
+struct simd_float_mask
+{
+	__m128 v;
+};
+
+struct simd_uint32
+{
+	__m128i v;
+
+	simd_uint32() = default;
+	simd_uint32(__m128i x) HAMON_NOEXCEPT : v(x) {}
+	simd_uint32(hamon::uint32_t x) HAMON_NOEXCEPT : v(_mm_set1_epi32(static_cast<int>(x))) {}
+
+	friend simd_uint32 operator+(simd_uint32 a, simd_uint32 b) HAMON_NOEXCEPT { return _mm_add_epi32(a.v, b.v); }
+	friend simd_uint32 operator-(simd_uint32 a, simd_uint32 b) HAMON_NOEXCEPT { return _mm_sub_epi32(a.v, b.v); }
+	friend simd_uint32 operator&(simd_uint32 a, simd_uint32 b) HAMON_NOEXCEPT { return _mm_and_si128(a.v, b.v); }
+	friend simd_uint32 operator|(simd_uint32 a, simd_uint32 b) HAMON_NOEXCEPT { return _mm_or_si128(a.v, b.v); }
+	friend simd_uint32 operator^(simd_uint32 a, simd_uint32 b) HAMON_NOEXCEPT { return _mm_xor_si128(a.v, b.v); }
+};
+
+inline simd_uint32 shl(simd_uint32 a, int n) HAMON_NOEXCEPT { return _mm_sll_epi32(a.v, _mm_cvtsi32_si128(n)); }
+inline simd_uint32 shr(simd_uint32 a, int n) HAMON_NOEXCEPT { return _mm_srl_epi32(a.v, _mm_cvtsi32_si128(n)); }
+
+struct simd_float
+{
+	__m128 v;
+
+	simd_float() = default;
+	simd_float(__m128 x) HAMON_NOEXCEPT : v(x) {}
+	simd_float(float x) HAMON_NOEXCEPT : v(_mm_set1_ps(x)) {}
+
+	friend simd_float operator+(simd_float a, simd_float b) HAMON_NOEXCEPT { return _mm_add_ps(a.v, b.v); }
+	friend simd_float operator-(simd_float a, simd_float b) HAMON_NOEXCEPT { return _mm_sub_ps(a.v, b.v); }
+	friend simd_float operator*(simd_float a, simd_float b) HAMON_NOEXCEPT { return _mm_mul_ps(a.v, b.v); }
+	friend simd_float operator/(simd_float a, simd_float b) HAMON_NOEXCEPT { return _mm_div_ps(a.v, b.v); }
+	friend simd_float operator-(simd_float a) HAMON_NOEXCEPT { return _mm_xor_ps(a.v, _mm_set1_ps(-0.0f)); }
+};
+
+inline simd_float_mask lt(simd_float a, simd_float b) HAMON_NOEXCEPT { return { _mm_cmplt_ps(a.v, b.v) }; }
+inline simd_float_mask le(simd_float a, simd_float b) HAMON_NOEXCEPT { return { _mm_cmple_ps(a.v, b.v) }; }
+inline simd_float_mask gt(simd_float a, simd_float b) HAMON_NOEXCEPT { return { _mm_cmpgt_ps(a.v, b.v) }; }
+inline simd_float_mask ge(simd_float a, simd_float b) HAMON_NOEXCEPT { return { _mm_cmpge_ps(a.v, b.v) }; }
+inline simd_float_mask eq(simd_float a, simd_float b) HAMON_NOEXCEPT { return { _mm_cmpeq_ps(a.v, b.v) }; }
+
+inline simd_float_mask mask_and(simd_float_mask a, simd_float_mask b) HAMON_NOEXCEPT { return { _mm_and_ps(a.v, b.v) }; }
+inline simd_float_mask mask_or(simd_float_mask a, simd_float_mask b) HAMON_NOEXCEPT { return { _mm_or_ps(a.v, b.v) }; }
+inline simd_float_mask mask_not(simd_float_mask a) HAMON_NOEXCEPT
+{
+	return { _mm_xor_ps(a.v, _mm_castsi128_ps(_mm_set1_epi32(-1))) };
+}
+inline bool any(simd_float_mask a) HAMON_NOEXCEPT { return _mm_movemask_ps(a.v) != 0; }
+inline simd_float select(simd_float_mask m, simd_float a, simd_float b) HAMON_NOEXCEPT
+{
+	return _mm_or_ps(_mm_and_ps(m.v, a.v), _mm_andnot_ps(m.v, b.v));
+}
+inline simd_float_mask mask_from_bits(simd_uint32 a) HAMON_NOEXCEPT { return { _mm_castsi128_ps(a.v) }; }
+
+inline simd_uint32 to_bits(simd_float a) HAMON_NOEXCEPT { return _mm_castps_si128(a.v); }
+inline simd_float from_bits(simd_uint32 a) HAMON_NOEXCEPT { return _mm_castsi128_ps(a.v); }
+
+// double と同じく int32 への変換を経由する
+inline simd_float vround(simd_float a) HAMON_NOEXCEPT
+{
+	return _mm_cvtepi32_ps(_mm_cvtps_epi32(a.v));
+}
+inline simd_uint32 vtoint(simd_float a) HAMON_NOEXCEPT { return _mm_cvtps_epi32(a.v); }
+inline simd_float vsqrt(simd_float a) HAMON_NOEXCEPT { return _mm_sqrt_ps(a.v); }
+inline simd_float gather(float const* table, simd_uint32 i) HAMON_NOEXCEPT
+{
+	hamon::uint32_t idx[4];
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(idx), i.v);
+	return _mm_setr_ps(table[idx[0]], table[idx[1]], table[idx[2]], table[idx[3]]);
+}
+
+inline void widen(simd_float a, simd_double& lo, simd_double& hi) HAMON_NOEXCEPT
+{
+	lo = _mm_cvtps_pd(a.v);
+	hi = _mm_cvtps_pd(_mm_movehl_ps(a.v, a.v));
+}
+inline simd_float narrow(simd_double lo, simd_double hi) HAMON_NOEXCEPT
+{
+	return _mm_movelh_ps(_mm_cvtpd_ps(lo.v), _mm_cvtpd_ps(hi.v));
+}
+
+template <>
+struct simd_traits<simd_float>
+{
+	using value_type = float;
+	using uint_type = simd_uint32;
+	using mask_type = simd_float_mask;
+
+	static constexpr hamon::size_t lanes = 4;
+
+	static simd_float load(float const* p) HAMON_NOEXCEPT { return _mm_loadu_ps(p); }
+	static void store(float* p, simd_float v) HAMON_NOEXCEPT { _mm_storeu_ps(p, v.v); }
+};
+
+#elif defined(HAMON_SIMD_NEON64)
+
+struct simd_mask
+{
+	uint64x2_t v;
+};
+
+struct simd_double
+{
+	float64x2_t v;
+
+	simd_double() = default;
+	simd_double(float64x2_t x) HAMON_NOEXCEPT : v(x) {}
+	simd_double(double x) HAMON_NOEXCEPT : v(vdupq_n_f64(x)) {}
+
+	friend simd_double operator+(simd_double a, simd_double b) HAMON_NOEXCEPT { return vaddq_f64(a.v, b.v); }
+	friend simd_double operator-(simd_double a, simd_double b) HAMON_NOEXCEPT { return vsubq_f64(a.v, b.v); }
+	friend simd_double operator*(simd_double a, simd_double b) HAMON_NOEXCEPT { return vmulq_f64(a.v, b.v); }
+	friend simd_double operator/(simd_double a, simd_double b) HAMON_NOEXCEPT { return vdivq_f64(a.v, b.v); }
+	friend simd_double operator-(simd_double a) HAMON_NOEXCEPT { return vnegq_f64(a.v); }
+};
+
+inline simd_mask lt(simd_double a, simd_double b) HAMON_NOEXCEPT { return { vcltq_f64(a.v, b.v) }; }
+inline simd_mask le(simd_double a, simd_double b) HAMON_NOEXCEPT { return { vcleq_f64(a.v, b.v) }; }
+inline simd_mask gt(simd_double a, simd_double b) HAMON_NOEXCEPT { return { vcgtq_f64(a.v, b.v) }; }
+inline simd_mask ge(simd_double a, simd_double b) HAMON_NOEXCEPT { return { vcgeq_f64(a.v, b.v) }; }
+inline simd_mask eq(simd_double a, simd_double b) HAMON_NOEXCEPT { return { vceqq_f64(a.v, b.v) }; }
+
+inline simd_mask mask_and(simd_mask a, simd_mask b) HAMON_NOEXCEPT { return { vandq_u64(a.v, b.v) }; }
+inline simd_mask mask_or(simd_mask a, simd_mask b) HAMON_NOEXCEPT { return { vorrq_u64(a.v, b.v) }; }
+inline simd_mask mask_not(simd_mask a) HAMON_NOEXCEPT
+{
+	return { vreinterpretq_u64_u32(vmvnq_u32(vreinterpretq_u32_u64(a.v))) };
+}
+inline bool any(simd_mask a) HAMON_NOEXCEPT { return vmaxvq_u32(vreinterpretq_u32_u64(a.v)) != 0; }
+inline simd_double select(simd_mask m, simd_double a, simd_double b) HAMON_NOEXCEPT
+{
+	return vbslq_f64(m.v, a.v, b.v);
+}
+inline simd_mask mask_from_bits(simd_uint64 a) HAMON_NOEXCEPT { return { a.v }; }
+
+inline simd_uint64 to_bits(simd_double a) HAMON_NOEXCEPT { return vreinterpretq_u64_f64(a.v); }
+inline simd_double from_bits(simd_uint64 a) HAMON_NOEXCEPT { return vreinterpretq_f64_u64(a.v); }
+
+inline simd_double vround(simd_double a) HAMON_NOEXCEPT { return vrndnq_f64(a.v); }
+inline simd_uint64 vtoint(simd_double a) HAMON_NOEXCEPT
+{
+	return vreinterpretq_u64_s64(vcvtnq_s64_f64(a.v));
+}
+inline simd_double vsqrt(simd_double a) HAMON_NOEXCEPT { return vsqrtq_f64(a.v); }
+inline simd_double gather(double const* table, simd_uint64 i) HAMON_NOEXCEPT
+{
+	float64x2_t r = vdupq_n_f64(table[vgetq_lane_u64(i.v, 0)]);
+	return vsetq_lane_f64(table[vgetq_lane_u64(i.v, 1)], r, 1);
+}
+
+template <>
+struct simd_traits<simd_double>
+{
+	using value_type = double;
+	using uint_type = simd_uint64;
+	using mask_type = simd_mask;
+
+	static constexpr hamon::size_t lanes = 2;
+
+	static simd_double load(double const* p) HAMON_NOEXCEPT { return vld1q_f64(p); }
+	static void store(double* p, simd_double v) HAMON_NOEXCEPT { vst1q_f64(p, v.v); }
+};
+
+struct simd_float_mask
+{
+	uint32x4_t v;
+};
+
+struct simd_uint32
+{
+	uint32x4_t v;
+
+	simd_uint32() = default;
+	simd_uint32(uint32x4_t x) HAMON_NOEXCEPT : v(x) {}
+	simd_uint32(hamon::uint32_t x) HAMON_NOEXCEPT : v(vdupq_n_u32(x)) {}
+
+	friend simd_uint32 operator+(simd_uint32 a, simd_uint32 b) HAMON_NOEXCEPT { return vaddq_u32(a.v, b.v); }
+	friend simd_uint32 operator-(simd_uint32 a, simd_uint32 b) HAMON_NOEXCEPT { return vsubq_u32(a.v, b.v); }
+	friend simd_uint32 operator&(simd_uint32 a, simd_uint32 b) HAMON_NOEXCEPT { return vandq_u32(a.v, b.v); }
+	friend simd_uint32 operator|(simd_uint32 a, simd_uint32 b) HAMON_NOEXCEPT { return vorrq_u32(a.v, b.v); }
+	friend simd_uint32 operator^(simd_uint32 a, simd_uint32 b) HAMON_NOEXCEPT { return veorq_u32(a.v, b.v); }
+};
+
+inline simd_uint32 shl(simd_uint32 a, int n) HAMON_NOEXCEPT { return vshlq_u32(a.v, vdupq_n_s32(n)); }
+inline simd_uint32 shr(simd_uint32 a, int n) HAMON_NOEXCEPT { return vshlq_u32(a.v, vdupq_n_s32(-n)); }
+
+struct simd_float
+{
+	float32x4_t v;
+
+	simd_float() = default;
+	simd_float(float32x4_t x) HAMON_NOEXCEPT : v(x) {}
+	simd_float(float x) HAMON_NOEXCEPT : v(vdupq_n_f32(x)) {}
+
+	friend simd_float operator+(simd_float a, simd_float b) HAMON_NOEXCEPT { return vaddq_f32(a.v, b.v); }
+	friend simd_float operator-(simd_float a, simd_float b) HAMON_NOEXCEPT { return vsubq_f32(a.v, b.v); }
+	friend simd_float operator*(simd_float a, simd_float b) HAMON_NOEXCEPT { return vmulq_f32(a.v, b.v); }
+	friend simd_float operator/(simd_float a, simd_float b) HAMON_NOEXCEPT { return vdivq_f32(a.v, b.v); }
+	friend simd_float operator-(simd_float a) HAMON_NOEXCEPT { return vnegq_f32(a.v); }
+};
+
+inline simd_float_mask lt(simd_float a, simd_float b) HAMON_NOEXCEPT { return { vcltq_f32(a.v, b.v) }; }
+inline simd_float_mask le(simd_float a, simd_float b) HAMON_NOEXCEPT { return { vcleq_f32(a.v, b.v) }; }
+inline simd_float_mask gt(simd_float a, simd_float b) HAMON_NOEXCEPT { return { vcgtq_f32(a.v, b.v) }; }
+inline simd_float_mask ge(simd_float a, simd_float b) HAMON_NOEXCEPT { return { vcgeq_f32(a.v, b.v) }; }
+inline simd_float_mask eq(simd_float a, simd_float b) HAMON_NOEXCEPT { return { vceqq_f32(a.v, b.v) }; }
+
+inline simd_float_mask mask_and(simd_float_mask a, simd_float_mask b) HAMON_NOEXCEPT { return { vandq_u32(a.v, b.v) }; }
+inline simd_float_mask mask_or(simd_float_mask a, simd_float_mask b) HAMON_NOEXCEPT { return { vorrq_u32(a.v, b.v) }; }
+inline simd_float_mask mask_not(simd_float_mask a) HAMON_NOEXCEPT { return { vmvnq_u32(a.v) }; }
+inline bool any(simd_float_mask a) HAMON_NOEXCEPT { return vmaxvq_u32(a.v) != 0; }
+inline simd_float select(simd_float_mask m, simd_float a, simd_float b) HAMON_NOEXCEPT
+{
+	return vbslq_f32(m.v, a.v, b.v);
+}
+inline simd_float_mask mask_from_bits(simd_uint32 a) HAMON_NOEXCEPT { return { a.v }; }
+
+inline simd_uint32 to_bits(simd_float a) HAMON_NOEXCEPT { return vreinterpretq_u32_f32(a.v); }
+inline simd_float from_bits(simd_uint32 a) HAMON_NOEXCEPT { return vreinterpretq_f32_u32(a.v); }
+
+inline simd_float vround(simd_float a) HAMON_NOEXCEPT { return vrndnq_f32(a.v); }
+inline simd_uint32 vtoint(simd_float a) HAMON_NOEXCEPT
+{
+	return vreinterpretq_u32_s32(vcvtnq_s32_f32(a.v));
+}
+inline simd_float vsqrt(simd_float a) HAMON_NOEXCEPT { return vsqrtq_f32(a.v); }
+inline simd_float gather(float const* table, simd_uint32 i) HAMON_NOEXCEPT
+{
+	float32x4_t r = vdupq_n_f32(table[vgetq_lane_u32(i.v, 0)]);
+	r = vsetq_lane_f32(table[vgetq_lane_u32(i.v, 1)], r, 1);
+	r = vsetq_lane_f32(table[vgetq_lane_u32(i.v, 2)], r, 2);
+	return vsetq_lane_f32(table[vgetq_lane_u32(i.v, 3)], r, 3);
+}
+
+inline void widen(simd_float a, simd_double& lo, simd_double& hi) HAMON_NOEXCEPT
+{
+	lo = vcvt_f64_f32(vget_low_f32(a.v));
+	hi = vcvt_high_f64_f32(a.v);
+}
+inline simd_float narrow(simd_double lo, simd_double hi) HAMON_NOEXCEPT
+{
+	return vcvt_high_f32_f64(vcvt_f32_f64(lo.v), hi.v);
+}
+
+template <>
+struct simd_traits<simd_float>
+{
+	using value_type = float;
+	using uint_type = simd_uint32;
+	using mask_type = simd_float_mask;
+
+	static constexpr hamon::size_t lanes = 4;
+
+	static simd_float load(float const* p) HAMON_NOEXCEPT { return vld1q_f32(p); }
+	static void store(float* p, simd_float v) HAMON_NOEXCEPT { vst1q_f32(p, v.v); }
+};
+
+#endif
+
+// T の要素をまとめて計算する型
+template <typename T>
+struct simd_type_of
+{
+	using type = T;
+};
+
+#if defined(HAMON_CMATH_BATCH_SIMD)
+template <>
+struct simd_type_of<double>
+{
+	using type = simd_double;
+};
+
+template <>
+struct simd_type_of<float>
+{
+	using type = simd_float;
+};
+#endif
+
+template <typename T>
+using simd_type = typename simd_type_of<T>::type;
+
+// x の符号ビット
+template <typename V>
+inline typename simd_traits<V>::uint_type
+sign_bits(V x) HAMON_NOEXCEPT
+{
+	using U = typename simd_traits<V>::uint_type;
+	return to_bits(x) & U(sign_bit(value_tag<V>{}));
+}
+
+// x の絶対値 (NaN はそのまま)
+template <typename V>
+inline V
+vabs(V x) HAMON_NOEXCEPT
+{
+	return from_bits(to_bits(x) ^ sign_bits(x));
+}
+
+}	// namespace detail
+
+}	// namespace batch
+
+}	// namespace hamon
+
+#endif // HAMON_CMATH_BATCH_DETAIL_SIMD_HPP
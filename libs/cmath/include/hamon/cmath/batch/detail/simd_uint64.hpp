@@ -0,0 +1,175 @@
+﻿/**
+ *	@file	simd_uint64.hpp
+ *
+ *	@brief	64bit 符号なし整数の SIMD 型の定義
+ *
+ *	batch 関数のカーネルと、hamon::multi_lane_xoshiro256plusplus の両方で使う。
+ */
+
+#ifndef HAMON_CMATH_BATCH_DETAIL_SIMD_UINT64_HPP
+#define HAMON_CMATH_BATCH_DETAIL_SIMD_UINT64_HPP
+
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/cstdint/uint64_t.hpp>
+#include <hamon/config.hpp>
+
+#if defined(HAMON_SIMD_AVX2)
+#  include <immintrin.h>
+#elif defined(HAMON_SIMD_SSE2)
+#  include <emmintrin.h>
+#elif defined(HAMON_SIMD_NEON64)
+#  include <arm_neon.h>
+#endif
+
+namespace hamon
+{
+
+namespace batch
+{
+
+namespace detail
+{
+
+// 64bit 符号なし整数を lanes 個まとめて扱う型
+//
+// 使える操作は + - & | ^ と、shl, shr、それとメモリとの間の load, store (アライメントは不要) だけ。
+// SIMD 命令を使えない場合は lanes == 1 になる。
+
+#if defined(HAMON_SIMD_AVX2)
+
+struct simd_uint64
+{
+	static HAMON_CONSTEXPR hamon::size_t lanes = 4;
+
+	__m256i v;
+
+	simd_uint64() = default;
+	simd_uint64(__m256i x) HAMON_NOEXCEPT : v(x) {}
+	simd_uint64(hamon::uint64_t x) HAMON_NOEXCEPT
+		: v(_mm256_set1_epi64x(static_cast<long long>(x))) {}
+
+	static simd_uint64 load(hamon::uint64_t const* p) HAMON_NOEXCEPT
+	{
+		return _mm256_loadu_si256(reinterpret_cast<__m256i const*>(p));
+	}
+
+	void store(hamon::uint64_t* p) const HAMON_NOEXCEPT
+	{
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v);
+	}
+
+	friend simd_uint64 operator+(simd_uint64 a, simd_uint64 b) HAMON_NOEXCEPT { return _mm256_add_epi64(a.v, b.v); }
+	friend simd_uint64 operator-(simd_uint64 a, simd_uint64 b) HAMON_NOEXCEPT { return _mm256_sub_epi64(a.v, b.v); }
+	friend simd_uint64 operator&(simd_uint64 a, simd_uint64 b) HAMON_NOEXCEPT { return _mm256_and_si256(a.v, b.v); }
+	friend simd_uint64 operator|(simd_uint64 a, simd_uint64 b) HAMON_NOEXCEPT { return _mm256_or_si256(a.v, b.v); }
+	friend simd_uint64 operator^(simd_uint64 a, simd_uint64 b) HAMON_NOEXCEPT { return _mm256_xor_si256(a.v, b.v); }
+};
+
+inline simd_uint64 shl(simd_uint64 a, int n) HAMON_NOEXCEPT { return _mm256_sll_epi64(a.v, _mm_cvtsi32_si128(n)); }
+inline simd_uint64 shr(simd_uint64 a, int n) HAMON_NOEXCEPT { return _mm256_srl_epi64(a.v, _mm_cvtsi32_si128(n)); }
+
+#elif defined(HAMON_SIMD_SSE2)
+
+struct simd_uint64
+{
+	static HAMON_CONSTEXPR hamon::size_t lanes = 2;
+
+	__m128i v;
+
+	simd_uint64() = default;
+	simd_uint64(__m128i x) HAMON_NOEXCEPT : v(x) {}
+	simd_uint64(hamon::uint64_t x) HAMON_NOEXCEPT
+		: v(_mm_set1_epi64x(static_cast<long long>(x))) {}
+
+	static simd_uint64 load(hamon::uint64_t const* p) HAMON_NOEXCEPT
+	{
+		return _mm_loadu_si128(reinterpret_cast<__m128i const*>(p));
+	}
+
+	void store(hamon::uint64_t* p) const HAMON_NOEXCEPT
+	{
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(p), v);
+	}
+
+	friend simd_uint64 operator+(simd_uint64 a, simd_uint64 b) HAMON_NOEXCEPT { return _mm_add_epi64(a.v, b.v); }
+	friend simd_uint64 operator-(simd_uint64 a, simd_uint64 b) HAMON_NOEXCEPT { return _mm_sub_epi64(a.v, b.v); }
+	friend simd_uint64 operator&(simd_uint64 a, simd_uint64 b) HAMON_NOEXCEPT { return _mm_and_si128(a.v, b.v); }
+	friend simd_uint64 operator|(simd_uint64 a, simd_uint64 b) HAMON_NOEXCEPT { return _mm_or_si128(a.v, b.v); }
+	friend simd_uint64 operator^(simd_uint64 a, simd_uint64 b) HAMON_NOEXCEPT { return _mm_xor_si128(a.v, b.v); }
+};
+
+inline simd_uint64 shl(simd_uint64 a, int n) HAMON_NOEXCEPT { return _mm_sll_epi64(a.v, _mm_cvtsi32_si128(n)); }
+inline simd_uint64 shr(simd_uint64 a, int n) HAMON_NOEXCEPT { return _mm_srl_epi64(a.v, _mm_cvtsi32_si128(n)); }
+
+#elif defined(HAMON_SIMD_NEON64)
+
+struct simd_uint64
+{
+	static HAMON_CONSTEXPR hamon::size_t lanes = 2;
+
+	uint64x2_t v;
+
+	simd_uint64() = default;
+	simd_uint64(uint64x2_t x) HAMON_NOEXCEPT : v(x) {}
+	simd_uint64(hamon::uint64_t x) HAMON_NOEXCEPT : v(vdupq_n_u64(x)) {}
+
+	static simd_uint64 load(hamon::uint64_t const* p) HAMON_NOEXCEPT
+	{
+		return vld1q_u64(p);
+	}
+
+	void store(hamon::uint64_t* p) const HAMON_NOEXCEPT
+	{
+		vst1q_u64(p, v);
+	}
+
+	friend simd_uint64 operator+(simd_uint64 a, simd_uint64 b) HAMON_NOEXCEPT { return vaddq_u64(a.v, b.v); }
+	friend simd_uint64 operator-(simd_uint64 a, simd_uint64 b) HAMON_NOEXCEPT { return vsubq_u64(a.v, b.v); }
+	friend simd_uint64 operator&(simd_uint64 a, simd_uint64 b) HAMON_NOEXCEPT { return vandq_u64(a.v, b.v); }
+	friend simd_uint64 operator|(simd_uint64 a, simd_uint64 b) HAMON_NOEXCEPT { return vorrq_u64(a.v, b.v); }
+	friend simd_uint64 operator^(simd_uint64 a, simd_uint64 b) HAMON_NOEXCEPT { return veorq_u64(a.v, b.v); }
+};
+
+inline simd_uint64 shl(simd_uint64 a, int n) HAMON_NOEXCEPT { return vshlq_u64(a.v, vdupq_n_s64(n)); }
+inline simd_uint64 shr(simd_uint64 a, int n) HAMON_NOEXCEPT { return vshlq_u64(a.v, vdupq_n_s64(-n)); }
+
+#else
+
+struct simd_uint64
+{
+	static HAMON_CONSTEXPR hamon::size_t lanes = 1;
+
+	hamon::uint64_t v;
+
+	simd_uint64() = default;
+	simd_uint64(hamon::uint64_t x) HAMON_NOEXCEPT : v(x) {}
+
+	static simd_uint64 load(hamon::uint64_t const* p) HAMON_NOEXCEPT
+	{
+		return *p;
+	}
+
+	void store(hamon::uint64_t* p) const HAMON_NOEXCEPT
+	{
+		*p = v;
+	}
+
+	friend simd_uint64 operator+(simd_uint64 a, simd_uint64 b) HAMON_NOEXCEPT { return a.v + b.v; }
+	friend simd_uint64 operator-(simd_uint64 a, simd_uint64 b) HAMON_NOEXCEPT { return a.v - b.v; }
+	friend simd_uint64 operator&(simd_uint64 a, simd_uint64 b) HAMON_NOEXCEPT { return a.v & b.v; }
+	friend simd_uint64 operator|(simd_uint64 a, simd_uint64 b) HAMON_NOEXCEPT { return a.v | b.v; }
+	friend simd_uint64 operator^(simd_uint64 a, simd_uint64 b) HAMON_NOEXCEPT { return a.v ^ b.v; }
+};
+
+inline simd_uint64 shl(simd_uint64 a, int n) HAMON_NOEXCEPT { return a.v << n; }
+inline simd_uint64 shr(simd_uint64 a, int n) HAMON_NOEXCEPT { return a.v >> n; }
+
+#endif
+
+}	// namespace detail
+
+}	// namespace batch
+
+}	// namespace hamon
+
+#endif // HAMON_CMATH_BATCH_DETAIL_SIMD_UINT64_HPP
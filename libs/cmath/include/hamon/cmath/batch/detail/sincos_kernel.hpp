@@ -0,0 +1,236 @@
+﻿/**
+ *	@file	sincos_kernel.hpp
+ *
+ *	@brief	batch::sin, batch::cos, batch::tan のカーネルの定義
+ */
+
+#ifndef HAMON_CMATH_BATCH_DETAIL_SINCOS_KERNEL_HPP
+#define HAMON_CMATH_BATCH_DETAIL_SINCOS_KERNEL_HPP
+
+#include <hamon/cmath/batch/detail/simd.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+namespace batch
+{
+
+namespace detail
+{
+
+// 引数の範囲。これを超える値(と NaN, ±∞)はスカラー版で計算する。
+// この範囲では π/2 の倍数 n が double で 2^16, float で 2^13 未満になり、
+// n と π/2 の上位の部分の積が誤差なく計算できる。
+inline HAMON_CONSTEXPR double sincos_max_arg(double_tag) HAMON_NOEXCEPT { return 1.0e5; }
+inline HAMON_CONSTEXPR float  sincos_max_arg(float_tag)  HAMON_NOEXCEPT { return 8192.0f; }
+
+// x = n * π/2 + (y0 + y1) となる n, y0, y1 を求める (fdlibm の __ieee754_rem_pio2 と同じ分割)
+template <typename V>
+struct rem_pio2_result
+{
+	V n;
+	V y0;
+	V y1;
+};
+
+template <typename V>
+inline rem_pio2_result<V>
+rem_pio2(V x, double_tag) HAMON_NOEXCEPT
+{
+	V const invpio2 = 6.36619772367581382433e-01;
+	V const pio2_1  = 1.57079632673412561417e+00;
+	V const pio2_1t = 6.07710050650619224932e-11;
+	V const pio2_2  = 6.07710050630396597660e-11;
+	V const pio2_2t = 2.02226624879595063154e-21;
+	V const pio2_3  = 2.02226624871116645580e-21;
+	V const pio2_3t = 8.47842766036889956997e-32;
+
+	V const fn = vround(x * invpio2);
+
+	// 桁落ちの大きさで分岐せず、常に3段階とも計算する
+	V r = x - fn * pio2_1;
+	V w = fn * pio2_1t;
+
+	V t = r;
+	w = fn * pio2_2;
+	r = t - w;
+	w = fn * pio2_2t - ((t - r) - w);
+
+	t = r;
+	w = fn * pio2_3;
+	r = t - w;
+	w = fn * pio2_3t - ((t - r) - w);
+
+	V const y0 = r - w;
+	V const y1 = (r - y0) - w;
+	return { fn, y0, y1 };
+}
+
+// float 版。π/2 を 11bit ずつの3つと残りに分けて、double と同じように計算する
+template <typename V>
+inline rem_pio2_result<V>
+rem_pio2(V x, float_tag) HAMON_NOEXCEPT
+{
+	V const invpio2 = 6.3661974669e-01f;
+	V const pio2_1  = 1.5703125000e+00f;
+	V const pio2_2  = 4.8375129700e-04f;
+	V const pio2_3  = 7.5495336205e-08f;
+	V const pio2_3t = 2.5633440683e-12f;
+
+	V const fn = vround(x * invpio2);
+
+	V t = x - fn * pio2_1;
+	V w = fn * pio2_2;
+	V r = t - w;
+
+	t = r;
+	w = fn * pio2_3;
+	r = t - w;
+	w = fn * pio2_3t - ((t - r) - w);
+
+	V const y0 = r - w;
+	V const y1 = (r - y0) - w;
+	return { fn, y0, y1 };
+}
+
+// [-π/4, π/4] での sin(x + y) (fdlibm の __kernel_sin)
+template <typename V>
+inline V
+kernel_sin(V x, V y, double_tag) HAMON_NOEXCEPT
+{
+	V const S1 = -1.66666666666666324348e-01;
+	V const S2 =  8.33333333332248946124e-03;
+	V const S3 = -1.98412698298579493134e-04;
+	V const S4 =  2.75573137070700676789e-06;
+	V const S5 = -2.50507602534068634195e-08;
+	V const S6 =  1.58969099521155010221e-10;
+
+	V const z = x * x;
+	V const w = z * z;
+	V const r = S2 + z * (S3 + z * S4) + z * w * (S5 + z * S6);
+	V const v = z * x;
+	return x - ((z * (V(0.5) * y - v * r) - y) - v * S1);
+}
+
+// float 版。計算の形は double と同じで、多項式は Cephes の sinf のもの
+template <typename V>
+inline V
+kernel_sin(V x, V y, float_tag) HAMON_NOEXCEPT
+{
+	V const S1 = -1.6666654611e-01f;
+	V const S2 =  8.3321608736e-03f;
+	V const S3 = -1.9515295891e-04f;
+
+	V const z = x * x;
+	V const r = S2 + z * S3;
+	V const v = z * x;
+	return x - ((z * (V(0.5f) * y - v * r) - y) - v * S1);
+}
+
+// [-π/4, π/4] での cos(x + y) (fdlibm の __kernel_cos)
+template <typename V>
+inline V
+kernel_cos(V x, V y, double_tag) HAMON_NOEXCEPT
+{
+	V const C1 =  4.16666666666666019037e-02;
+	V const C2 = -1.38888888888741095749e-03;
+	V const C3 =  2.48015872894767294178e-05;
+	V const C4 = -2.75573143513906633035e-07;
+	V const C5 =  2.08757232129817482790e-09;
+	V const C6 = -1.13596475577881948265e-11;
+
+	V const z = x * x;
+	V const w = z * z;
+	V const r = z * (C1 + z * (C2 + z * C3)) + w * w * (C4 + z * (C5 + z * C6));
+	V const hz = V(0.5) * z;
+	V const one = 1.0;
+	V const u = one - hz;
+	return u + (((one - u) - hz) + (z * r - x * y));
+}
+
+// float 版。多項式は Cephes の cosf のもの
+template <typename V>
+inline V
+kernel_cos(V x, V y, float_tag) HAMON_NOEXCEPT
+{
+	V const C1 =  4.166664568298827e-02f;
+	V const C2 = -1.388731625493765e-03f;
+	V const C3 =  2.443315711809948e-05f;
+
+	V const z = x * x;
+	V const r = z * (C1 + z * (C2 + z * C3));
+	V const hz = V(0.5f) * z;
+	V const one = 1.0f;
+	V const u = one - hz;
+	return u + (((one - u) - hz) + (z * r - x * y));
+}
+
+template <typename V>
+inline typename simd_traits<V>::mask_type
+sincos_special(V x) HAMON_NOEXCEPT
+{
+	// NaN も含めるために、否定の形で判定する
+	return mask_not(le(vabs(x), V(sincos_max_arg(value_tag<V>{}))));
+}
+
+// n & 1 == 1 なら a, そうでなければ b
+template <typename V>
+inline V
+select_odd(typename simd_traits<V>::uint_type n, V a, V b) HAMON_NOEXCEPT
+{
+	using U = typename simd_traits<V>::uint_type;
+	return select(mask_from_bits(U(0) - (n & U(1))), a, b);
+}
+
+// n & 2 == 2 なら符号を反転する
+template <typename V>
+inline V
+negate_if_bit1(typename simd_traits<V>::uint_type n, V x) HAMON_NOEXCEPT
+{
+	using U = typename simd_traits<V>::uint_type;
+	using T = typename simd_traits<V>::value_type;
+	return from_bits(to_bits(x) ^ shl(n & U(2), static_cast<int>(sizeof(T) * 8) - 2));
+}
+
+template <typename V>
+inline V
+sin_kernel(V x) HAMON_NOEXCEPT
+{
+	auto const r = rem_pio2(x, value_tag<V>{});
+	auto const n = vtoint(r.n);
+	V const s = kernel_sin(r.y0, r.y1, value_tag<V>{});
+	V const c = kernel_cos(r.y0, r.y1, value_tag<V>{});
+	return negate_if_bit1(n, select_odd(n, c, s));
+}
+
+template <typename V>
+inline V
+cos_kernel(V x) HAMON_NOEXCEPT
+{
+	using U = typename simd_traits<V>::uint_type;
+	auto const r = rem_pio2(x, value_tag<V>{});
+	auto const n = vtoint(r.n) + U(1);
+	V const s = kernel_sin(r.y0, r.y1, value_tag<V>{});
+	V const c = kernel_cos(r.y0, r.y1, value_tag<V>{});
+	return negate_if_bit1(n, select_odd(n, c, s));
+}
+
+template <typename V>
+inline V
+tan_kernel(V x) HAMON_NOEXCEPT
+{
+	auto const r = rem_pio2(x, value_tag<V>{});
+	auto const n = vtoint(r.n);
+	V const s = kernel_sin(r.y0, r.y1, value_tag<V>{});
+	V const c = kernel_cos(r.y0, r.y1, value_tag<V>{});
+	return select_odd(n, -c / s, s / c);
+}
+
+}	// namespace detail
+
+}	// namespace batch
+
+}	// namespace hamon
+
+#endif // HAMON_CMATH_BATCH_DETAIL_SINCOS_KERNEL_HPP
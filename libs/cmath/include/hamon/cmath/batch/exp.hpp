@@ -0,0 +1,96 @@
+﻿/**
+ *	@file	exp.hpp
+ *
+ *	@brief	batch::exp の定義
+ */
+
+#ifndef HAMON_CMATH_BATCH_EXP_HPP
+#define HAMON_CMATH_BATCH_EXP_HPP
+
+#include <hamon/cmath/batch/detail/apply.hpp>
+#include <hamon/cmath/batch/detail/batch_range.hpp>
+#include <hamon/cmath/batch/detail/exp_kernel.hpp>
+#include <hamon/cmath/batch/detail/simd.hpp>
+#include <hamon/cmath/batch/fast.hpp>
+#include <hamon/cmath/exp.hpp>
+#include <hamon/assert.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+namespace batch
+{
+
+namespace detail
+{
+
+struct exp_op
+{
+	template <typename V>
+	static V eval(V x, typename simd_traits<V>::mask_type& special) HAMON_NOEXCEPT
+	{
+		special = exp_special(x);
+		return exp_kernel(x);
+	}
+
+	template <typename T>
+	static T reference(T x) HAMON_NOEXCEPT
+	{
+		return hamon::exp(x);
+	}
+};
+
+}	// namespace detail
+
+/**
+ *	@brief	e を底とする指数関数をまとめて計算する
+ *
+ *	@param	in	引数の配列
+ *	@param	out	結果を格納する配列
+ *
+ *	out[i] = hamon::exp(in[i]) を計算する。
+ *	float と double は SIMD の多項式近似で計算する。それ以外の型は hamon::exp を呼び出す。
+ *
+ *	|x| <= 708 (float は |x| <= 87) の範囲は SIMD で計算し、それ以外の値(NaN を含む)は hamon::exp で計算する。
+ *	最大誤差(実測)は double で 1 ULP, float で 1 ULP 以下。
+ *
+ *	in と out の要素数は同じでなければならない。
+ *	in と out は同じ範囲でもよいが、一部だけが重なっていてはいけない。
+ */
+template <typename InRange, typename OutRange,
+	typename FloatType = detail::batch_value_t<InRange>,
+	typename = detail::enable_if_batch_ranges_t<FloatType, OutRange, InRange>>
+inline void
+exp(InRange&& in, OutRange&& out) HAMON_NOEXCEPT
+{
+	auto const src = detail::batch_input<FloatType>(in);
+	auto const dst = detail::batch_output<FloatType>(out);
+	HAMON_ASSERT(src.size() == dst.size());
+	detail::batch_apply<detail::exp_op>(src, dst, true);
+}
+
+/**
+ *	@brief	e を底とする指数関数をまとめて計算する (精度より速度を優先する)
+ *
+ *	特殊な値の検査を省略する以外は、通常のモードと同じ。
+ *
+ *	@see	fast_t
+ */
+template <typename InRange, typename OutRange,
+	typename FloatType = detail::batch_value_t<InRange>,
+	typename = detail::enable_if_batch_ranges_t<FloatType, OutRange, InRange>>
+inline void
+exp(fast_t, InRange&& in, OutRange&& out) HAMON_NOEXCEPT
+{
+	auto const src = detail::batch_input<FloatType>(in);
+	auto const dst = detail::batch_output<FloatType>(out);
+	HAMON_ASSERT(src.size() == dst.size());
+	detail::batch_apply<detail::exp_op>(src, dst, false);
+}
+
+}	// namespace batch
+
+}	// namespace hamon
+
+#endif // HAMON_CMATH_BATCH_EXP_HPP
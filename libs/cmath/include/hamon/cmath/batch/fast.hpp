@@ -0,0 +1,39 @@
+﻿/**
+ *	@file	fast.hpp
+ *
+ *	@brief	fast_t の定義
+ */
+
+#ifndef HAMON_CMATH_BATCH_FAST_HPP
+#define HAMON_CMATH_BATCH_FAST_HPP
+
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+namespace batch
+{
+
+/**
+ *	@brief	batch 関数の精度より速度を優先するモードを選ぶタグ
+ *
+ *	fast を最初の引数に渡すと、NaN・∞・範囲外の値の検査と、
+ *	それらをスカラー版の関数で計算し直す処理を省略する。
+ *	各関数の定義域内の有限の値に対しては通常のモードと同じ結果になり、
+ *	それ以外の値に対する結果は未規定(例外や未定義動作にはならない)。
+ *
+ *	-ffast-math などで NaN や ∞ が現れないことを前提にコンパイルする場合も、こちらを使うこと。
+ */
+struct fast_t
+{
+	explicit fast_t() = default;
+};
+
+HAMON_STATIC_CONSTEXPR fast_t fast{};
+
+}	// namespace batch
+
+}	// namespace hamon
+
+#endif // HAMON_CMATH_BATCH_FAST_HPP
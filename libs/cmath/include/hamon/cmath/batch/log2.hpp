@@ -0,0 +1,96 @@
+﻿/**
+ *	@file	log2.hpp
+ *
+ *	@brief	batch::log2 の定義
+ */
+
+#ifndef HAMON_CMATH_BATCH_LOG2_HPP
+#define HAMON_CMATH_BATCH_LOG2_HPP
+
+#include <hamon/cmath/batch/detail/apply.hpp>
+#include <hamon/cmath/batch/detail/batch_range.hpp>
+#include <hamon/cmath/batch/detail/log_kernel.hpp>
+#include <hamon/cmath/batch/detail/simd.hpp>
+#include <hamon/cmath/batch/fast.hpp>
+#include <hamon/cmath/log2.hpp>
+#include <hamon/assert.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+namespace batch
+{
+
+namespace detail
+{
+
+struct log2_op
+{
+	template <typename V>
+	static V eval(V x, typename simd_traits<V>::mask_type& special) HAMON_NOEXCEPT
+	{
+		special = log_special(x);
+		return log2_kernel(x);
+	}
+
+	template <typename T>
+	static T reference(T x) HAMON_NOEXCEPT
+	{
+		return hamon::log2(x);
+	}
+};
+
+}	// namespace detail
+
+/**
+ *	@brief	2 を底とする対数をまとめて計算する
+ *
+ *	@param	in	引数の配列
+ *	@param	out	結果を格納する配列
+ *
+ *	out[i] = hamon::log2(in[i]) を計算する。
+ *	float と double は SIMD の多項式近似で計算する。それ以外の型は hamon::log2 を呼び出す。
+ *
+ *	正の正規化数は SIMD で計算し、それ以外の値(0, 負数, 非正規化数, ∞, NaN)は hamon::log2 で計算する。
+ *	最大誤差(実測)は double で 1 ULP, float で 1 ULP 以下。
+ *
+ *	in と out の要素数は同じでなければならない。
+ *	in と out は同じ範囲でもよいが、一部だけが重なっていてはいけない。
+ */
+template <typename InRange, typename OutRange,
+	typename FloatType = detail::batch_value_t<InRange>,
+	typename = detail::enable_if_batch_ranges_t<FloatType, OutRange, InRange>>
+inline void
+log2(InRange&& in, OutRange&& out) HAMON_NOEXCEPT
+{
+	auto const src = detail::batch_input<FloatType>(in);
+	auto const dst = detail::batch_output<FloatType>(out);
+	HAMON_ASSERT(src.size() == dst.size());
+	detail::batch_apply<detail::log2_op>(src, dst, true);
+}
+
+/**
+ *	@brief	2 を底とする対数をまとめて計算する (精度より速度を優先する)
+ *
+ *	特殊な値の検査を省略する以外は、通常のモードと同じ。
+ *
+ *	@see	fast_t
+ */
+template <typename InRange, typename OutRange,
+	typename FloatType = detail::batch_value_t<InRange>,
+	typename = detail::enable_if_batch_ranges_t<FloatType, OutRange, InRange>>
+inline void
+log2(fast_t, InRange&& in, OutRange&& out) HAMON_NOEXCEPT
+{
+	auto const src = detail::batch_input<FloatType>(in);
+	auto const dst = detail::batch_output<FloatType>(out);
+	HAMON_ASSERT(src.size() == dst.size());
+	detail::batch_apply<detail::log2_op>(src, dst, false);
+}
+
+}	// namespace batch
+
+}	// namespace hamon
+
+#endif // HAMON_CMATH_BATCH_LOG2_HPP
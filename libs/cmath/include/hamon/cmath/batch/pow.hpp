@@ -0,0 +1,151 @@
+﻿/**
+ *	@file	pow.hpp
+ *
+ *	@brief	batch::pow の定義
+ */
+
+#ifndef HAMON_CMATH_BATCH_POW_HPP
+#define HAMON_CMATH_BATCH_POW_HPP
+
+#include <hamon/cmath/batch/detail/apply.hpp>
+#include <hamon/cmath/batch/detail/batch_range.hpp>
+#include <hamon/cmath/batch/detail/pow_kernel.hpp>
+#include <hamon/cmath/batch/detail/simd.hpp>
+#include <hamon/cmath/batch/fast.hpp>
+#include <hamon/cmath/pow.hpp>
+#include <hamon/type_traits/type_identity.hpp>
+#include <hamon/assert.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+namespace batch
+{
+
+namespace detail
+{
+
+struct pow_op
+{
+	template <typename V>
+	static V eval(V x, V y, typename simd_traits<V>::mask_type& special) HAMON_NOEXCEPT
+	{
+		return pow_kernel(x, y, special);
+	}
+
+	template <typename T>
+	static T reference(T x, T y) HAMON_NOEXCEPT
+	{
+		return hamon::pow(x, y);
+	}
+};
+
+}	// namespace detail
+
+/**
+ *	@brief	べき乗をまとめて計算する
+ *
+ *	@param	x	底の配列
+ *	@param	y	指数の配列
+ *	@param	out	結果を格納する配列
+ *
+ *	out[i] = hamon::pow(x[i], y[i]) を計算する。
+ *	float と double は SIMD で 2^(y * log2(x)) として計算する。
+ *	double では log2(x) と y * log2(x) を2つの double の和で表すので、指数が大きくても誤差は増えない。
+ *	float では float のレーンを double に広げて計算し、結果を float に戻す。
+ *	それ以外の型は hamon::pow を呼び出す。
+ *
+ *	x が正の正規化数で、y が有限で、|y * log2(x)| <= 1020 (float は 125) の場合は SIMD で計算し、
+ *	それ以外の場合(x が 0 以下の場合や、結果が溢れる場合を含む)は hamon::pow で計算する。
+ *	最大誤差(実測)は double で 1.5 ULP, float で 1 ULP 以下。
+ *
+ *	x, y, out の要素数は同じでなければならない。
+ *	out は x または y と同じ範囲でもよいが、一部だけが重なっていてはいけない。
+ */
+template <typename XRange, typename YRange, typename OutRange,
+	typename FloatType = detail::batch_value_t<XRange>,
+	typename = detail::enable_if_batch_ranges_t<FloatType, OutRange, XRange, YRange>>
+inline void
+pow(
+	XRange&& x,
+	YRange&& y,
+	OutRange&& out) HAMON_NOEXCEPT
+{
+	auto const xs = detail::batch_input<FloatType>(x);
+	auto const ys = detail::batch_input<FloatType>(y);
+	auto const dst = detail::batch_output<FloatType>(out);
+	HAMON_ASSERT(xs.size() == dst.size());
+	HAMON_ASSERT(ys.size() == dst.size());
+	detail::batch_apply<detail::pow_op>(xs, ys.data(), 1, dst, true);
+}
+
+/**
+ *	@brief	指数が共通のべき乗をまとめて計算する
+ *
+ *	out[i] = hamon::pow(x[i], y) を計算する。
+ */
+template <typename XRange, typename OutRange,
+	typename FloatType = detail::batch_value_t<XRange>,
+	typename = detail::enable_if_batch_ranges_t<FloatType, OutRange, XRange>>
+inline void
+pow(
+	XRange&& x,
+	hamon::type_identity_t<FloatType> y,
+	OutRange&& out) HAMON_NOEXCEPT
+{
+	auto const xs = detail::batch_input<FloatType>(x);
+	auto const dst = detail::batch_output<FloatType>(out);
+	HAMON_ASSERT(xs.size() == dst.size());
+	detail::batch_apply<detail::pow_op>(xs, &y, 0, dst, true);
+}
+
+/**
+ *	@brief	べき乗をまとめて計算する (精度より速度を優先する)
+ *
+ *	@see	fast_t
+ */
+template <typename XRange, typename YRange, typename OutRange,
+	typename FloatType = detail::batch_value_t<XRange>,
+	typename = detail::enable_if_batch_ranges_t<FloatType, OutRange, XRange, YRange>>
+inline void
+pow(
+	fast_t,
+	XRange&& x,
+	YRange&& y,
+	OutRange&& out) HAMON_NOEXCEPT
+{
+	auto const xs = detail::batch_input<FloatType>(x);
+	auto const ys = detail::batch_input<FloatType>(y);
+	auto const dst = detail::batch_output<FloatType>(out);
+	HAMON_ASSERT(xs.size() == dst.size());
+	HAMON_ASSERT(ys.size() == dst.size());
+	detail::batch_apply<detail::pow_op>(xs, ys.data(), 1, dst, false);
+}
+
+/**
+ *	@brief	指数が共通のべき乗をまとめて計算する (精度より速度を優先する)
+ *
+ *	@see	fast_t
+ */
+template <typename XRange, typename OutRange,
+	typename FloatType = detail::batch_value_t<XRange>,
+	typename = detail::enable_if_batch_ranges_t<FloatType, OutRange, XRange>>
+inline void
+pow(
+	fast_t,
+	XRange&& x,
+	hamon::type_identity_t<FloatType> y,
+	OutRange&& out) HAMON_NOEXCEPT
+{
+	auto const xs = detail::batch_input<FloatType>(x);
+	auto const dst = detail::batch_output<FloatType>(out);
+	HAMON_ASSERT(xs.size() == dst.size());
+	detail::batch_apply<detail::pow_op>(xs, &y, 0, dst, false);
+}
+
+}	// namespace batch
+
+}	// namespace hamon
+
+#endif // HAMON_CMATH_BATCH_POW_HPP
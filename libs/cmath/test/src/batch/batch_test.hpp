@@ -0,0 +1,247 @@
+﻿/**
+ *	@file	batch_test.hpp
+ *
+ *	@brief
+ */
+
+#ifndef UNIT_TEST_CMATH_BATCH_BATCH_TEST_HPP
+#define UNIT_TEST_CMATH_BATCH_BATCH_TEST_HPP
+
+#include <hamon/cmath/fabs.hpp>
+#include <hamon/cmath/isinf.hpp>
+#include <hamon/cmath/isnan.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/limits.hpp>
+#include <hamon/span.hpp>
+#include <hamon/type_traits/bool_constant.hpp>
+#include <hamon/type_traits/is_same.hpp>
+#include <hamon/vector.hpp>
+#include <gtest/gtest.h>
+#include <cmath>
+#include "get_random_value.hpp"
+
+namespace hamon_cmath_test
+{
+
+namespace batch_test
+{
+
+// SIMD のブロック(2, 4, 8 要素)と端数の両方を通るような要素数
+static hamon::size_t const s_batch_sizes[] = { 0, 1, 2, 3, 4, 5, 7, 8, 9, 13, 17, 100 };
+
+using BatchTestTypes = ::testing::Types<float, double, long double>;
+
+template <typename T>
+class BatchTest : public ::testing::Test {};
+
+TYPED_TEST_SUITE(BatchTest, BatchTestTypes);
+
+// actual と真の値 expected の差を、T の ULP 単位で返す
+template <typename T>
+double ulp_error(T actual, long double expected)
+{
+	T const e = static_cast<T>(expected);
+	if (hamon::isnan(e) || hamon::isinf(e) || e == 0 || hamon::isnan(actual) || hamon::isinf(actual))
+	{
+		return (e == actual || (hamon::isnan(e) && hamon::isnan(actual))) ?
+			0.0 : hamon::numeric_limits<double>::infinity();
+	}
+
+	// 非正規化数も扱えるように std:: の関数を使う
+	int const digits = hamon::numeric_limits<T>::digits;
+	int exp = std::ilogb(e);
+	if (exp < hamon::numeric_limits<T>::min_exponent - 1)
+	{
+		exp = hamon::numeric_limits<T>::min_exponent - 1;
+	}
+	long double const ulp = std::ldexp(1.0L, exp - digits + 1);
+	return static_cast<double>(hamon::fabs(static_cast<long double>(actual) - expected) / ulp);
+}
+
+// 2つの値が同じか (NaN 同士も同じとみなす)
+template <typename T>
+void expect_same_value(T expected, T actual, T arg)
+{
+	if (hamon::isnan(expected))
+	{
+		EXPECT_TRUE(hamon::isnan(actual)) << "arg: " << arg;
+	}
+	else
+	{
+		EXPECT_EQ(expected, actual) << "arg: " << arg;
+	}
+}
+
+template <typename T>
+hamon::vector<T> make_random_values(hamon::size_t n, T min, T max)
+{
+	hamon::vector<T> result(n);
+	for (auto& x : result)
+	{
+		x = get_random_value<T>(min, max);
+	}
+	return result;
+}
+
+// 精度の基準にする値
+//
+// hamon:: のスカラーの関数が実行時に std:: の関数を呼ぶ環境 (C++20 以降) では、scalar_func の結果を基準にする。
+// それより前の環境では、実行時にも定数式用の実装が使われて誤差が大きい (sin(2π) 付近などで 10^7 ULP 程度)
+// ので、long double の exact_func の結果を基準にする。
+#if defined(HAMON_HAS_CXX20_IS_CONSTANT_EVALUATED)
+
+template <typename T, typename ScalarFunc, typename ExactFunc>
+long double reference_value(ScalarFunc scalar_func, ExactFunc, T x)
+{
+	return static_cast<long double>(scalar_func(x));
+}
+
+// 誤差の許容値 (batch 関数の最大誤差に、基準の std:: の関数の誤差 (2 ULP 以下) を足したもの)
+inline double reference_tolerance(double max_ulp)
+{
+	return max_ulp + 2.0;
+}
+
+#else
+
+template <typename T, typename ScalarFunc, typename ExactFunc>
+long double reference_value(ScalarFunc, ExactFunc exact_func, T x)
+{
+	return exact_func(static_cast<long double>(x));
+}
+
+// long double の参照値が double と同じ精度の環境もあるので、その分の余裕を持たせる
+inline double reference_tolerance(double max_ulp)
+{
+	return max_ulp + 0.5;
+}
+
+#endif
+
+// 最大誤差 (実測値) のうち T に対応するもの
+template <typename T>
+double max_ulp_of(double max_ulp_double, double max_ulp_float)
+{
+	return hamon::is_same<T, float>::value ? max_ulp_float : max_ulp_double;
+}
+
+// 単項の batch 関数のテスト
+//
+// BatchFunc / FastFunc : (span<T const>, span<T>) を受け取る batch 関数
+// ScalarFunc           : 同じ計算をするスカラーの hamon:: の関数
+// ExactFunc            : scalar_func を基準にできない環境で、真の値として使う long double の関数
+//
+// [min, max] は SIMD で計算する範囲の中であること。
+template <typename T, typename BatchFunc, typename FastFunc, typename ScalarFunc, typename ExactFunc>
+void test_unary(
+	BatchFunc batch_func, FastFunc fast_func, ScalarFunc scalar_func, ExactFunc exact_func,
+	T min, T max, double max_ulp_double, double max_ulp_float, hamon::true_type)
+{
+	double const tolerance = reference_tolerance(max_ulp_of<T>(max_ulp_double, max_ulp_float));
+
+	for (auto n : s_batch_sizes)
+	{
+		auto const in = make_random_values<T>(n, min, max);
+		hamon::vector<T> out(n);
+		batch_func(in, out);
+		for (hamon::size_t i = 0; i < n; ++i)
+		{
+			EXPECT_LE(ulp_error(out[i], reference_value(scalar_func, exact_func, in[i])), tolerance)
+				<< "arg: " << in[i] << ", actual: " << out[i] << ", scalar: " << scalar_func(in[i]);
+		}
+
+		// 定義域内の値は fast でも同じ結果になる
+		hamon::vector<T> out_fast(n);
+		fast_func(in, out_fast);
+		for (hamon::size_t i = 0; i < n; ++i)
+		{
+			EXPECT_EQ(out[i], out_fast[i]) << "arg: " << in[i];
+		}
+
+		// in と out が同じ範囲
+		auto buf = in;
+		batch_func(buf, buf);
+		EXPECT_TRUE(buf == out);
+	}
+}
+
+template <typename T, typename BatchFunc, typename FastFunc, typename ScalarFunc, typename ExactFunc>
+void test_unary(
+	BatchFunc batch_func, FastFunc fast_func, ScalarFunc scalar_func, ExactFunc,
+	T min, T max, double, double, hamon::false_type)
+{
+	// SIMD で計算しない型は、スカラー版の関数と同じ結果になる
+	for (auto n : s_batch_sizes)
+	{
+		auto const in = make_random_values<T>(n, min, max);
+		hamon::vector<T> out(n);
+		batch_func(in, out);
+		hamon::vector<T> out_fast(n);
+		fast_func(in, out_fast);
+		for (hamon::size_t i = 0; i < n; ++i)
+		{
+			expect_same_value(scalar_func(in[i]), out[i], in[i]);
+			expect_same_value(scalar_func(in[i]), out_fast[i], in[i]);
+		}
+	}
+}
+
+template <typename T, typename BatchFunc, typename FastFunc, typename ScalarFunc, typename ExactFunc>
+void test_unary(
+	BatchFunc batch_func, FastFunc fast_func, ScalarFunc scalar_func, ExactFunc exact_func,
+	T min, T max, double max_ulp_double, double max_ulp_float)
+{
+	test_unary<T>(batch_func, fast_func, scalar_func, exact_func, min, max, max_ulp_double, max_ulp_float,
+		hamon::bool_constant<hamon::numeric_limits<T>::digits <= 53>{});
+}
+
+// 特殊な値はスカラー版の関数と同じ結果になる
+//
+// 特殊な値と普通の値を混ぜて、SIMD のブロックの中に特殊な値がある場合を調べる。
+template <typename T, typename BatchFunc, typename ScalarFunc>
+void test_unary_special(BatchFunc batch_func, ScalarFunc scalar_func, hamon::vector<T> const& specials, T normal)
+{
+	T normal_result;
+	batch_func(hamon::span<T const>(&normal, 1), hamon::span<T>(&normal_result, 1));
+
+	hamon::vector<T> in;
+	for (auto x : specials)
+	{
+		in.push_back(x);
+		in.push_back(normal);
+		in.push_back(normal);
+	}
+	in.push_back(normal);
+
+	hamon::vector<T> out(in.size());
+	batch_func(in, out);
+	for (hamon::size_t i = 0; i < in.size(); ++i)
+	{
+		if (i % 3 == 0 && i / 3 < specials.size())
+		{
+			expect_same_value(scalar_func(in[i]), out[i], in[i]);
+		}
+		else
+		{
+			EXPECT_EQ(normal_result, out[i]);
+		}
+	}
+}
+
+// span 以外の範囲を渡した結果 (out) が、span を渡した場合と同じになるか
+template <typename T, typename BatchFunc, typename Range>
+void expect_same_as_span(BatchFunc batch_func, hamon::vector<T> const& in, Range const& out)
+{
+	hamon::vector<T> expected(in.size());
+	batch_func(hamon::span<T const>(in), hamon::span<T>(expected));
+	for (hamon::size_t i = 0; i < in.size(); ++i)
+	{
+		expect_same_value(expected[i], out[i], in[i]);
+	}
+}
+
+}	// namespace batch_test
+
+}	// namespace hamon_cmath_test
+
+#endif // UNIT_TEST_CMATH_BATCH_BATCH_TEST_HPP
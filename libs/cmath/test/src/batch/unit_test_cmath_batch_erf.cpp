@@ -0,0 +1,52 @@
+﻿/**
+ *	@file	unit_test_cmath_batch_erf.cpp
+ *
+ *	@brief	batch::erf のテスト
+ */
+
+#include <hamon/cmath/batch/erf.hpp>
+#include <hamon/cmath/erf.hpp>
+#include <hamon/array.hpp>
+#include <hamon/limits.hpp>
+#include <hamon/span.hpp>
+#include <hamon/vector.hpp>
+#include <gtest/gtest.h>
+#include <cmath>
+#include "batch_test.hpp"
+
+namespace hamon_cmath_test
+{
+
+namespace batch_test
+{
+
+TYPED_TEST(BatchTest, ErfTest)
+{
+	using T = TypeParam;
+
+	auto batch_func = [](hamon::span<T const> in, hamon::span<T> out) { hamon::batch::erf(in, out); };
+	auto fast_func = [](hamon::span<T const> in, hamon::span<T> out) { hamon::batch::erf(hamon::batch::fast, in, out); };
+	auto scalar_func = [](T x) { return hamon::erf(x); };
+	auto exact_func = [](long double x) { return std::erf(x); };
+
+	test_unary<T>(batch_func, fast_func, scalar_func, exact_func, T(-1), T(1), 2.5, 3.0);
+	test_unary<T>(batch_func, fast_func, scalar_func, exact_func, T(-7), T(7), 2.5, 3.0);
+
+	auto const nan = hamon::numeric_limits<T>::quiet_NaN();
+	test_unary_special<T>(batch_func, scalar_func, { nan }, T(0.5));
+
+	// span 以外の連続した範囲をそのまま渡せる
+	{
+		hamon::vector<T> const in = { T(0.5), T(1), T(2), T(3), T(4) };
+		hamon::array<T, 5> out{};
+		hamon::batch::erf(in, out);
+		expect_same_as_span<T>(batch_func, in, out);
+		hamon::vector<T> out_fast(in.size());
+		hamon::batch::erf(hamon::batch::fast, in, out_fast);
+		expect_same_as_span<T>(fast_func, in, out_fast);
+	}
+}
+
+}	// namespace batch_test
+
+}	// namespace hamon_cmath_test
@@ -0,0 +1,141 @@
+﻿/**
+ *	@file	unit_test_cmath_batch_pow.cpp
+ *
+ *	@brief	batch::pow のテスト
+ */
+
+#include <hamon/cmath/batch/pow.hpp>
+#include <hamon/cmath/pow.hpp>
+#include <hamon/array.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/limits.hpp>
+#include <hamon/span.hpp>
+#include <hamon/type_traits/is_same.hpp>
+#include <hamon/vector.hpp>
+#include <gtest/gtest.h>
+#include <cmath>
+#include "batch_test.hpp"
+
+namespace hamon_cmath_test
+{
+
+namespace batch_test
+{
+
+// 精度の基準にする値 (reference_value を参照)
+template <typename T>
+long double pow_reference(T x, T y)
+{
+	return reference_value(
+		[y](T a) { return hamon::pow(a, y); },
+		[y](long double a) { return std::pow(a, static_cast<long double>(y)); },
+		x);
+}
+
+template <typename T>
+void test_pow(T x_min, T x_max, T y_min, T y_max, hamon::true_type)
+{
+	double const tolerance = reference_tolerance(max_ulp_of<T>(1.5, 1.0));
+
+	for (auto n : s_batch_sizes)
+	{
+		auto const x = make_random_values<T>(n, x_min, x_max);
+		auto const y = make_random_values<T>(n, y_min, y_max);
+		T const y0 = get_random_value<T>(y_min, y_max);
+
+		hamon::vector<T> out(n);
+		hamon::batch::pow(x, y, hamon::span<T>(out));
+		for (hamon::size_t i = 0; i < n; ++i)
+		{
+			EXPECT_LE(ulp_error(out[i], pow_reference(x[i], y[i])), tolerance)
+				<< "x: " << x[i] << ", y: " << y[i] << ", actual: " << out[i];
+		}
+
+		hamon::vector<T> out_fast(n);
+		hamon::batch::pow(hamon::batch::fast, x, y, hamon::span<T>(out_fast));
+		EXPECT_TRUE(out == out_fast);
+
+		// 指数が共通
+		hamon::batch::pow(x, y0, hamon::span<T>(out));
+		for (hamon::size_t i = 0; i < n; ++i)
+		{
+			EXPECT_LE(ulp_error(out[i], pow_reference(x[i], y0)), tolerance)
+				<< "x: " << x[i] << ", y: " << y0 << ", actual: " << out[i];
+		}
+
+		hamon::batch::pow(hamon::batch::fast, x, y0, hamon::span<T>(out_fast));
+		EXPECT_TRUE(out == out_fast);
+
+		// out と x が同じ範囲
+		auto buf = x;
+		hamon::batch::pow(buf, y0, buf);
+		EXPECT_TRUE(buf == out);
+
+		// span を渡した場合と同じ結果になる
+		hamon::vector<T> out_span(n);
+		hamon::batch::pow(hamon::span<T const>(x), hamon::span<T const>(y), hamon::span<T>(out_span));
+		hamon::batch::pow(x, y, out);
+		EXPECT_TRUE(out == out_span);
+	}
+}
+
+template <typename T>
+void test_pow(T x_min, T x_max, T y_min, T y_max, hamon::false_type)
+{
+	for (auto n : s_batch_sizes)
+	{
+		auto const x = make_random_values<T>(n, x_min, x_max);
+		auto const y = make_random_values<T>(n, y_min, y_max);
+
+		hamon::vector<T> out(n);
+		hamon::batch::pow(x, y, hamon::span<T>(out));
+		for (hamon::size_t i = 0; i < n; ++i)
+		{
+			expect_same_value(hamon::pow(x[i], y[i]), out[i], x[i]);
+		}
+
+		hamon::batch::pow(x, y_max, hamon::span<T>(out));
+		for (hamon::size_t i = 0; i < n; ++i)
+		{
+			expect_same_value(hamon::pow(x[i], y_max), out[i], x[i]);
+		}
+	}
+}
+
+template <typename T>
+void test_pow(T x_min, T x_max, T y_min, T y_max)
+{
+	test_pow<T>(x_min, x_max, y_min, y_max,
+		hamon::bool_constant<hamon::numeric_limits<T>::digits <= 53>{});
+}
+
+TYPED_TEST(BatchTest, PowTest)
+{
+	using T = TypeParam;
+
+	test_pow<T>(T(0.01), T(100), T(-10), T(10));
+	test_pow<T>(T(0.99), T(1.01), T(-1000), T(1000));
+	// float で SIMD で計算する範囲は |y * log2(x)| <= 125
+	T const max_y = hamon::is_same<T, float>::value ? T(6) : T(30);
+	test_pow<T>(T(1), T(1e6), -max_y, max_y);
+
+	// 特殊な値はスカラー版の関数と同じ結果になる
+	auto const nan = hamon::numeric_limits<T>::quiet_NaN();
+	auto const inf = hamon::numeric_limits<T>::infinity();
+	hamon::vector<T> const x = { T(2),   nan,  T(2), T(0), T(-2), T(-2),  inf, T(2),  T(1),  T(2),   T(0.5) };
+	hamon::vector<T> const y = { T(0.5), T(2), nan,  T(2), T(3),  T(0.5), T(2), inf,   nan,   T(1e4), -inf };
+	hamon::array<T, 11> out{};
+	hamon::batch::pow(x, y, out);
+	for (hamon::size_t i = 0; i < x.size(); ++i)
+	{
+		if (i == 0)
+		{
+			continue;
+		}
+		expect_same_value(hamon::pow(x[i], y[i]), out[i], x[i]);
+	}
+}
+
+}	// namespace batch_test
+
+}	// namespace hamon_cmath_test
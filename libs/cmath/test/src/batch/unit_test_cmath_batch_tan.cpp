@@ -0,0 +1,56 @@
+﻿/**
+ *	@file	unit_test_cmath_batch_tan.cpp
+ *
+ *	@brief	batch::tan のテスト
+ */
+
+#include <hamon/cmath/batch/tan.hpp>
+#include <hamon/cmath/tan.hpp>
+#include <hamon/array.hpp>
+#include <hamon/limits.hpp>
+#include <hamon/span.hpp>
+#include <hamon/type_traits/is_same.hpp>
+#include <hamon/vector.hpp>
+#include <gtest/gtest.h>
+#include <cmath>
+#include "batch_test.hpp"
+
+namespace hamon_cmath_test
+{
+
+namespace batch_test
+{
+
+TYPED_TEST(BatchTest, TanTest)
+{
+	using T = TypeParam;
+
+	auto batch_func = [](hamon::span<T const> in, hamon::span<T> out) { hamon::batch::tan(in, out); };
+	auto fast_func = [](hamon::span<T const> in, hamon::span<T> out) { hamon::batch::tan(hamon::batch::fast, in, out); };
+	auto scalar_func = [](T x) { return hamon::tan(x); };
+	auto exact_func = [](long double x) { return std::tan(x); };
+
+	// float で SIMD で計算する範囲は |x| <= 8192
+	T const max_arg = hamon::is_same<T, float>::value ? T(8192) : T(100000);
+	test_unary<T>(batch_func, fast_func, scalar_func, exact_func, T(-10), T(10), 3.0, 2.5);
+	test_unary<T>(batch_func, fast_func, scalar_func, exact_func, -max_arg, max_arg, 3.0, 2.5);
+
+	auto const nan = hamon::numeric_limits<T>::quiet_NaN();
+	auto const inf = hamon::numeric_limits<T>::infinity();
+	test_unary_special<T>(batch_func, scalar_func, { nan, inf, -inf, T(1e6), T(-1e20) }, T(0.5));
+
+	// span 以外の連続した範囲をそのまま渡せる
+	{
+		hamon::vector<T> const in = { T(0.5), T(1), T(2), T(3), T(4) };
+		hamon::array<T, 5> out{};
+		hamon::batch::tan(in, out);
+		expect_same_as_span<T>(batch_func, in, out);
+		hamon::vector<T> out_fast(in.size());
+		hamon::batch::tan(hamon::batch::fast, in, out_fast);
+		expect_same_as_span<T>(fast_func, in, out_fast);
+	}
+}
+
+}	// namespace batch_test
+
+}	// namespace hamon_cmath_test
@@ -25,6 +25,7 @@
 #include <hamon/config/suffix/noreturn.hpp>
 #include <hamon/config/suffix/override.hpp>
 #include <hamon/config/suffix/pragma.hpp>
+#include <hamon/config/suffix/simd.hpp>
 #include <hamon/config/suffix/unreachable.hpp>
 #include <hamon/config/suffix/warning.hpp>
 
@@ -0,0 +1,39 @@
+﻿/**
+ *	@file	simd.hpp
+ *
+ *	@brief	使用できる SIMD 命令の判定
+ *
+ *	HAMON_NO_SIMD を定義すると、全てのライブラリで SIMD 実装を使用しない。
+ */
+
+#ifndef HAMON_CONFIG_SUFFIX_SIMD_HPP
+#define HAMON_CONFIG_SUFFIX_SIMD_HPP
+
+#if !defined(HAMON_NO_SIMD)
+
+#  if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#    define HAMON_SIMD_SSE2
+#  endif
+
+#  if defined(HAMON_SIMD_SSE2) && defined(__AVX__)
+#    define HAMON_SIMD_AVX
+#  endif
+
+#  if defined(HAMON_SIMD_AVX) && defined(__AVX2__)
+#    define HAMON_SIMD_AVX2
+#  endif
+
+#  if defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#    define HAMON_SIMD_NEON
+#    if defined(__aarch64__) || defined(_M_ARM64)
+#      define HAMON_SIMD_NEON64
+#    endif
+#  endif
+
+#endif
+
+#if defined(HAMON_SIMD_SSE2) || defined(HAMON_SIMD_NEON)
+#  define HAMON_SIMD
+#endif
+
+#endif // HAMON_CONFIG_SUFFIX_SIMD_HPP
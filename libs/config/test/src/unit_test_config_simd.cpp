@@ -0,0 +1,28 @@
+﻿/**
+ *	@file	unit_test_config_simd.cpp
+ *
+ *	@brief	HAMON_SIMD のテスト
+ */
+
+#include <hamon/config.hpp>
+#include <gtest/gtest.h>
+
+#if defined(HAMON_NO_SIMD) && defined(HAMON_SIMD)
+#  error "HAMON_SIMD must not be defined when HAMON_NO_SIMD is defined"
+#endif
+
+#if defined(HAMON_SIMD_AVX2) && !defined(HAMON_SIMD_AVX)
+#  error "HAMON_SIMD_AVX2 implies HAMON_SIMD_AVX"
+#endif
+
+#if defined(HAMON_SIMD_AVX) && !defined(HAMON_SIMD_SSE2)
+#  error "HAMON_SIMD_AVX implies HAMON_SIMD_SSE2"
+#endif
+
+#if defined(HAMON_SIMD_NEON64) && !defined(HAMON_SIMD_NEON)
+#  error "HAMON_SIMD_NEON64 implies HAMON_SIMD_NEON"
+#endif
+
+#if (defined(HAMON_SIMD_SSE2) || defined(HAMON_SIMD_NEON)) && !defined(HAMON_SIMD)
+#  error "HAMON_SIMD must be defined"
+#endif
@@ -0,0 +1,192 @@
+﻿/**
+ *	@file	flat_search.hpp
+ *
+ *	@brief	flat_lower_bound, flat_upper_bound の定義
+ */
+
+#ifndef HAMON_CONTAINER_DETAIL_FLAT_SEARCH_HPP
+#define HAMON_CONTAINER_DETAIL_FLAT_SEARCH_HPP
+
+#include <hamon/algorithm/ranges/lower_bound.hpp>
+#include <hamon/algorithm/ranges/upper_bound.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/detail/overload_priority.hpp>
+#include <hamon/ranges/begin.hpp>
+#include <hamon/ranges/concepts/contiguous_range.hpp>
+#include <hamon/ranges/concepts/sized_range.hpp>
+#include <hamon/ranges/data.hpp>
+#include <hamon/ranges/iterator_t.hpp>
+#include <hamon/ranges/range_value_t.hpp>
+#include <hamon/ranges/size.hpp>
+#include <hamon/type_traits/conjunction.hpp>
+#include <hamon/type_traits/enable_if.hpp>
+#include <hamon/type_traits/is_arithmetic.hpp>
+#include <hamon/type_traits/is_constant_evaluated.hpp>
+#include <hamon/type_traits/is_same.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+namespace detail
+{
+
+template <typename T>
+HAMON_CXX14_CONSTEXPR void
+flat_search_prefetch(T const* p) HAMON_NOEXCEPT
+{
+#if defined(HAMON_HAS_CXX20_IS_CONSTANT_EVALUATED) && HAMON_HAS_BUILTIN(__builtin_prefetch)
+	if (!hamon::is_constant_evaluated())
+	{
+		__builtin_prefetch(p);
+	}
+#else
+	(void)p;
+#endif
+}
+
+// 分岐の無い二分探索
+//
+// 比較結果で探索範囲の先頭を選ぶだけにすることで、条件付きムーブにコンパイルされるようにする。
+// 次のループで参照する可能性のある2要素は先読みしておく。
+template <typename T, typename Pred>
+HAMON_CXX14_CONSTEXPR T const*
+branchless_partition_point(T const* first, hamon::size_t len, Pred& pred)
+{
+	if (len == 0)
+	{
+		return first;
+	}
+
+	while (len > 1)
+	{
+		auto const half = len / 2;
+		auto const next_half = (len - half) / 2;
+		hamon::detail::flat_search_prefetch(first + next_half);
+		hamon::detail::flat_search_prefetch(first + half + next_half);
+		first = pred(first[half - 1]) ? first + half : first;
+		len -= half;
+	}
+
+	return first + (pred(*first) ? 1 : 0);
+}
+
+template <typename T, typename Compare>
+struct flat_lower_bound_pred
+{
+	T const& value;
+	Compare& comp;
+
+	template <typename U>
+	HAMON_CXX14_CONSTEXPR bool
+	operator()(U const& x) const
+	{
+		return comp(x, value);
+	}
+};
+
+template <typename T, typename Compare>
+struct flat_upper_bound_pred
+{
+	T const& value;
+	Compare& comp;
+
+	template <typename U>
+	HAMON_CXX14_CONSTEXPR bool
+	operator()(U const& x) const
+	{
+		return !comp(value, x);
+	}
+};
+
+// キーが算術型で、かつ連続したメモリに格納されている場合のみ分岐の無い二分探索を使う
+template <typename Range, typename T>
+using is_branchless_searchable = hamon::conjunction<
+	hamon::ranges::contiguous_range_t<Range>,
+	hamon::ranges::sized_range_t<Range>,
+	hamon::is_same<hamon::ranges::range_value_t<Range>, T>,
+	hamon::is_arithmetic<T>
+>;
+
+struct flat_lower_bound_fn
+{
+private:
+	template <typename Range, typename T, typename Compare,
+		typename = hamon::enable_if_t<
+			hamon::detail::is_branchless_searchable<Range, T>::value>>
+	static HAMON_CXX14_CONSTEXPR hamon::ranges::iterator_t<Range&>
+	impl(Range& rg, T const& value, Compare& comp, hamon::detail::overload_priority<1>)
+	{
+		auto const first = hamon::ranges::data(rg);
+		hamon::detail::flat_lower_bound_pred<T, Compare> pred{value, comp};
+		auto const p = hamon::detail::branchless_partition_point(
+			first, static_cast<hamon::size_t>(hamon::ranges::size(rg)), pred);
+		return hamon::ranges::begin(rg) + (p - first);
+	}
+
+	template <typename Range, typename T, typename Compare>
+	static HAMON_CXX14_CONSTEXPR hamon::ranges::iterator_t<Range&>
+	impl(Range& rg, T const& value, Compare& comp, hamon::detail::overload_priority<0>)
+	{
+		return hamon::ranges::lower_bound(rg, value, comp);
+	}
+
+public:
+	/**
+	 *	@brief	flat_map, flat_set 等の、ソート済みのキーコンテナに対する lower_bound
+	 *
+	 *	ranges::lower_bound と同じ結果を返す。
+	 */
+	template <typename Range, typename T, typename Compare>
+	HAMON_CXX14_CONSTEXPR hamon::ranges::iterator_t<Range&>
+	operator()(Range& rg, T const& value, Compare comp) const
+	{
+		return impl(rg, value, comp, hamon::detail::overload_priority<1>{});
+	}
+};
+
+struct flat_upper_bound_fn
+{
+private:
+	template <typename Range, typename T, typename Compare,
+		typename = hamon::enable_if_t<
+			hamon::detail::is_branchless_searchable<Range, T>::value>>
+	static HAMON_CXX14_CONSTEXPR hamon::ranges::iterator_t<Range&>
+	impl(Range& rg, T const& value, Compare& comp, hamon::detail::overload_priority<1>)
+	{
+		auto const first = hamon::ranges::data(rg);
+		hamon::detail::flat_upper_bound_pred<T, Compare> pred{value, comp};
+		auto const p = hamon::detail::branchless_partition_point(
+			first, static_cast<hamon::size_t>(hamon::ranges::size(rg)), pred);
+		return hamon::ranges::begin(rg) + (p - first);
+	}
+
+	template <typename Range, typename T, typename Compare>
+	static HAMON_CXX14_CONSTEXPR hamon::ranges::iterator_t<Range&>
+	impl(Range& rg, T const& value, Compare& comp, hamon::detail::overload_priority<0>)
+	{
+		return hamon::ranges::upper_bound(rg, value, comp);
+	}
+
+public:
+	/**
+	 *	@brief	flat_map, flat_set 等の、ソート済みのキーコンテナに対する upper_bound
+	 *
+	 *	ranges::upper_bound と同じ結果を返す。
+	 */
+	template <typename Range, typename T, typename Compare>
+	HAMON_CXX14_CONSTEXPR hamon::ranges::iterator_t<Range&>
+	operator()(Range& rg, T const& value, Compare comp) const
+	{
+		return impl(rg, value, comp, hamon::detail::overload_priority<1>{});
+	}
+};
+
+HAMON_INLINE_VAR HAMON_CONSTEXPR flat_lower_bound_fn flat_lower_bound{};
+HAMON_INLINE_VAR HAMON_CONSTEXPR flat_upper_bound_fn flat_upper_bound{};
+
+}	// namespace detail
+
+}	// namespace hamon
+
+#endif // HAMON_CONTAINER_DETAIL_FLAT_SEARCH_HPP
@@ -0,0 +1,202 @@
+﻿/**
+ *	@file	eytzinger_index.hpp
+ *
+ *	@brief	eytzinger_index クラステンプレートの定義
+ */
+
+#ifndef HAMON_CONTAINER_EYTZINGER_INDEX_HPP
+#define HAMON_CONTAINER_EYTZINGER_INDEX_HPP
+
+#include <hamon/container/detail/flat_search.hpp>
+#include <hamon/bit/bit_width.hpp>
+#include <hamon/bit/countr_one.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/functional/less.hpp>
+#include <hamon/ranges/begin.hpp>
+#include <hamon/ranges/range_difference_t.hpp>
+#include <hamon/ranges/size.hpp>
+#include <hamon/utility/move.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+/**
+ *	@brief	ソート済みのキー列に対する、Eytzinger 配置の探索インデックス
+ *
+ *	@tparam	KeyContainer	キーを格納するコンテナ (hamon::vector<Key> など)
+ *	@tparam	Compare			キーの比較関数
+ *
+ *	ソート済みのキー列 (flat_map::keys() など) を、幅優先順 (Eytzinger 配置) に並べ替えて保持する。
+ *	探索の前半で参照する要素が配列の先頭付近に集まるため、
+ *	大きなキー列に対する二分探索のキャッシュミスを減らすことができる。
+ *
+ *	@note	インデックスは構築時点のキー列をコピーしたスナップショットであり、
+ *			元のコンテナ (flat_map など) とは結び付いていない。
+ *			元のコンテナを変更しても検出されないので、変更した後は assign で作り直すこと。
+ *			作り直さずに使った場合、返される位置は現在のコンテナの内容とは無関係になる。
+ *
+ *			位置の検証を呼び出し側に残すため、コンテナのイテレータを返す関数は提供せず、
+ *			ソート済みキー列での位置 (lower_bound_index, upper_bound_index) だけを返す。
+ */
+template <
+	typename KeyContainer,
+	typename Compare = hamon::less<typename KeyContainer::value_type>
+>
+class eytzinger_index
+{
+public:
+	using key_type           = typename KeyContainer::value_type;
+	using key_compare        = Compare;
+	using key_container_type = KeyContainer;
+	using size_type          = hamon::size_t;
+
+	HAMON_CXX14_CONSTEXPR
+	eytzinger_index()
+		: m_keys(), m_compare()
+	{}
+
+	HAMON_CXX14_CONSTEXPR explicit
+	eytzinger_index(key_compare const& comp)
+		: m_keys(), m_compare(comp)
+	{}
+
+	/**
+	 *	@brief	ソート済みのキー列からインデックスを構築する
+	 *
+	 *	@param	sorted_keys	comp の順にソートされたランダムアクセス可能な範囲
+	 */
+	template <typename Range>
+	HAMON_CXX14_CONSTEXPR explicit
+	eytzinger_index(Range const& sorted_keys, key_compare const& comp = key_compare())
+		: m_keys(), m_compare(comp)
+	{
+		this->assign(sorted_keys);
+	}
+
+	/**
+	 *	@brief	インデックスを構築し直す
+	 */
+	template <typename Range>
+	HAMON_CXX14_CONSTEXPR void
+	assign(Range const& sorted_keys)
+	{
+		using difference_type = hamon::ranges::range_difference_t<Range const>;
+
+		auto const n = static_cast<size_type>(hamon::ranges::size(sorted_keys));
+		auto const first = hamon::ranges::begin(sorted_keys);
+
+		key_container_type keys;
+		keys.reserve(n);
+		for (size_type k = 1; k <= n; ++k)
+		{
+			keys.push_back(first[static_cast<difference_type>(rank(k, n))]);
+		}
+
+		m_keys = hamon::move(keys);
+	}
+
+	HAMON_NODISCARD HAMON_CXX11_CONSTEXPR size_type
+	size() const HAMON_NOEXCEPT
+	{
+		return static_cast<size_type>(m_keys.size());
+	}
+
+	HAMON_NODISCARD HAMON_CXX11_CONSTEXPR bool
+	empty() const HAMON_NOEXCEPT
+	{
+		return m_keys.empty();
+	}
+
+	HAMON_NODISCARD HAMON_CXX11_CONSTEXPR key_compare
+	key_comp() const
+	{
+		return m_compare;
+	}
+
+	/**
+	 *	@brief	x 以上となる最初の要素の、ソート済みキー列での位置を返す
+	 *
+	 *	@return	見つからなかった場合は size() を返す
+	 */
+	template <typename K>
+	HAMON_NODISCARD HAMON_CXX14_CONSTEXPR size_type
+	lower_bound_index(K const& x) const
+	{
+		hamon::detail::flat_lower_bound_pred<K, key_compare const> pred{x, m_compare};
+		return this->search(pred);
+	}
+
+	/**
+	 *	@brief	x より大きい最初の要素の、ソート済みキー列での位置を返す
+	 *
+	 *	@return	見つからなかった場合は size() を返す
+	 */
+	template <typename K>
+	HAMON_NODISCARD HAMON_CXX14_CONSTEXPR size_type
+	upper_bound_index(K const& x) const
+	{
+		hamon::detail::flat_upper_bound_pred<K, key_compare const> pred{x, m_compare};
+		return this->search(pred);
+	}
+
+private:
+	// Eytzinger 配置での位置 k (1-origin) にある要素の、ソート済みキー列での位置 (0-origin)
+	//
+	// 要素数 n の完全二分木を、最下段を左詰めにした形と見なして計算する。
+	static HAMON_CXX14_CONSTEXPR size_type
+	rank(size_type k, size_type n) HAMON_NOEXCEPT
+	{
+		auto const h = hamon::bit_width(n) - 1;		// 最下段の深さ
+		auto const d = hamon::bit_width(k) - 1;		// k の深さ
+		auto const leaves = n - ((size_type{1} << h) - 1);	// 最下段の要素数
+
+		// 最下段が全て埋まっているとした場合の位置
+		auto const full_rank = ((((k - (size_type{1} << d)) * 2) + 1) << (h - d)) - 1;
+
+		// 存在しない最下段の要素の分だけ前に詰める
+		auto const preceding_leaves = (full_rank + 1) / 2;
+		return preceding_leaves > leaves ?
+			full_rank - (preceding_leaves - leaves) :
+			full_rank;
+	}
+
+	template <typename Pred>
+	HAMON_CXX14_CONSTEXPR size_type
+	search(Pred& pred) const
+	{
+		// 1キャッシュラインに収まる要素数。4段下の子孫を先読みする
+		size_type const block =
+			sizeof(key_type) < 64 ? 64 / sizeof(key_type) : 1;
+
+		auto const n = this->size();
+		auto const keys = m_keys.data();
+		size_type k = 1;
+		while (k <= n)
+		{
+			if (k * block <= n)
+			{
+				hamon::detail::flat_search_prefetch(keys + (k * block - 1));
+			}
+
+			k = 2 * k + (pred(keys[k - 1]) ? 1 : 0);
+		}
+
+		// 最後に左へ進んだ位置まで戻る
+		k >>= hamon::countr_one(k) + 1;
+
+		return k == 0 ? n : rank(k, n);
+	}
+
+private:
+	key_container_type m_keys;
+
+#if !(defined(HAMON_GCC_VERSION) && (HAMON_GCC_VERSION < 130000))
+	HAMON_NO_UNIQUE_ADDRESS	// gcc12 で no_unique_address を指定すると constexpr にならなくなってしまう
+#endif
+	key_compare m_compare;
+};
+
+}	// namespace hamon
+
+#endif // HAMON_CONTAINER_EYTZINGER_INDEX_HPP
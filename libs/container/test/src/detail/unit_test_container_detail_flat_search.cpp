@@ -0,0 +1,95 @@
+﻿/**
+ *	@file	unit_test_container_detail_flat_search.cpp
+ *
+ *	@brief	flat_lower_bound, flat_upper_bound のテスト
+ */
+
+#include <hamon/container/detail/flat_search.hpp>
+#include <hamon/algorithm/ranges/lower_bound.hpp>
+#include <hamon/algorithm/ranges/upper_bound.hpp>
+#include <hamon/functional/greater.hpp>
+#include <hamon/functional/less.hpp>
+#include <hamon/ranges/begin.hpp>
+#include <hamon/vector.hpp>
+#include <hamon/string.hpp>
+#include <hamon/config.hpp>
+#include <gtest/gtest.h>
+#include "constexpr_test.hpp"
+
+namespace hamon_container_test
+{
+
+namespace flat_search_test
+{
+
+#define VERIFY(...)	if (!(__VA_ARGS__)) { return false; }
+
+inline HAMON_CXX14_CONSTEXPR bool test_array()
+{
+	{
+		int const a[] = {1, 1, 2, 3, 5, 8, 8, 8, 13, 21, 34};
+		for (int x = 0; x < 36; ++x)
+		{
+			VERIFY(hamon::detail::flat_lower_bound(a, x, hamon::less<>{}) == hamon::ranges::lower_bound(a, x, hamon::less<>{}));
+			VERIFY(hamon::detail::flat_upper_bound(a, x, hamon::less<>{}) == hamon::ranges::upper_bound(a, x, hamon::less<>{}));
+		}
+	}
+	{
+		long const a[] = {9, 7, 7, 4, 2};
+		for (long x = -1; x < 11; ++x)
+		{
+			VERIFY(hamon::detail::flat_lower_bound(a, x, hamon::greater<>{}) == hamon::ranges::lower_bound(a, x, hamon::greater<>{}));
+			VERIFY(hamon::detail::flat_upper_bound(a, x, hamon::greater<>{}) == hamon::ranges::upper_bound(a, x, hamon::greater<>{}));
+		}
+	}
+	return true;
+}
+
+template <typename T>
+HAMON_CXX20_CONSTEXPR bool test_vector()
+{
+	for (int n = 0; n < 40; ++n)
+	{
+		hamon::vector<T> v;
+		for (int i = 0; i < n; ++i)
+		{
+			v.push_back(static_cast<T>(i * 2));
+		}
+
+		auto const& cv = v;
+		for (int i = -1; i < n * 2 + 2; ++i)
+		{
+			T const x = static_cast<T>(i);
+			VERIFY(hamon::detail::flat_lower_bound(v, x, hamon::less<T>{}) == hamon::ranges::lower_bound(v, x, hamon::less<T>{}));
+			VERIFY(hamon::detail::flat_upper_bound(v, x, hamon::less<T>{}) == hamon::ranges::upper_bound(v, x, hamon::less<T>{}));
+			VERIFY(hamon::detail::flat_lower_bound(cv, x, hamon::less<T>{}) == hamon::ranges::lower_bound(cv, x, hamon::less<T>{}));
+			VERIFY(hamon::detail::flat_upper_bound(cv, x, hamon::less<T>{}) == hamon::ranges::upper_bound(cv, x, hamon::less<T>{}));
+		}
+	}
+	return true;
+}
+
+#undef VERIFY
+
+GTEST_TEST(ContainerTest, FlatSearchTest)
+{
+	static_assert( hamon::detail::is_branchless_searchable<hamon::vector<int>, int>::value, "");
+	static_assert( hamon::detail::is_branchless_searchable<hamon::vector<double> const, double>::value, "");
+	static_assert(!hamon::detail::is_branchless_searchable<hamon::vector<int>, long>::value, "");
+	static_assert(!hamon::detail::is_branchless_searchable<hamon::vector<hamon::string>, hamon::string>::value, "");
+
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(test_array());
+	HAMON_CXX20_CONSTEXPR_EXPECT_TRUE(test_vector<int>());
+	HAMON_CXX20_CONSTEXPR_EXPECT_TRUE(test_vector<unsigned short>());
+	HAMON_CXX20_CONSTEXPR_EXPECT_TRUE(test_vector<double>());
+
+	{
+		hamon::vector<hamon::string> v = {"a", "c", "e"};
+		EXPECT_TRUE(hamon::detail::flat_lower_bound(v, hamon::string("b"), hamon::less<>{}) == v.begin() + 1);
+		EXPECT_TRUE(hamon::detail::flat_upper_bound(v, hamon::string("c"), hamon::less<>{}) == v.begin() + 2);
+	}
+}
+
+}	// namespace flat_search_test
+
+}	// namespace hamon_container_test
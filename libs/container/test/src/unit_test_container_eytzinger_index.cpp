@@ -0,0 +1,123 @@
+﻿/**
+ *	@file	unit_test_container_eytzinger_index.cpp
+ *
+ *	@brief	eytzinger_index のテスト
+ */
+
+#include <hamon/container/eytzinger_index.hpp>
+#include <hamon/algorithm/ranges/lower_bound.hpp>
+#include <hamon/algorithm/ranges/upper_bound.hpp>
+#include <hamon/cstddef/ptrdiff_t.hpp>
+#include <hamon/flat_map.hpp>
+#include <hamon/flat_set.hpp>
+#include <hamon/functional/greater.hpp>
+#include <hamon/string.hpp>
+#include <hamon/vector.hpp>
+#include <hamon/config.hpp>
+#include <gtest/gtest.h>
+#include "constexpr_test.hpp"
+
+namespace hamon_container_test
+{
+
+namespace eytzinger_index_test
+{
+
+#define VERIFY(...)	if (!(__VA_ARGS__)) { return false; }
+
+template <typename T>
+HAMON_CXX20_CONSTEXPR bool test(int max_n)
+{
+	for (int n = 0; n < max_n; ++n)
+	{
+		hamon::vector<T> v;
+		for (int i = 0; i < n; ++i)
+		{
+			v.push_back(static_cast<T>(i * 2));
+		}
+
+		hamon::eytzinger_index<hamon::vector<T>> index(v);
+		VERIFY(index.size() == v.size());
+		VERIFY(index.empty() == v.empty());
+
+		for (int i = -1; i < n * 2 + 2; ++i)
+		{
+			T const x = static_cast<T>(i);
+			VERIFY(v.begin() + static_cast<hamon::ptrdiff_t>(index.lower_bound_index(x)) == hamon::ranges::lower_bound(v, x));
+			VERIFY(v.begin() + static_cast<hamon::ptrdiff_t>(index.upper_bound_index(x)) == hamon::ranges::upper_bound(v, x));
+		}
+	}
+
+	{
+		hamon::vector<T> v = {T{1}, T{1}, T{2}, T{2}, T{2}, T{5}};
+		hamon::eytzinger_index<hamon::vector<T>> index(v);
+		VERIFY(index.lower_bound_index(T{0}) == 0);
+		VERIFY(index.lower_bound_index(T{1}) == 0);
+		VERIFY(index.lower_bound_index(T{2}) == 2);
+		VERIFY(index.lower_bound_index(T{3}) == 5);
+		VERIFY(index.lower_bound_index(T{6}) == 6);
+		VERIFY(index.upper_bound_index(T{0}) == 0);
+		VERIFY(index.upper_bound_index(T{1}) == 2);
+		VERIFY(index.upper_bound_index(T{2}) == 5);
+		VERIFY(index.upper_bound_index(T{5}) == 6);
+	}
+
+	{
+		hamon::vector<T> v = {T{9}, T{7}, T{4}, T{3}};
+		hamon::eytzinger_index<hamon::vector<T>, hamon::greater<T>> index(v);
+		VERIFY(index.lower_bound_index(T{10}) == 0);
+		VERIFY(index.lower_bound_index(T{7}) == 1);
+		VERIFY(index.lower_bound_index(T{5}) == 2);
+		VERIFY(index.lower_bound_index(T{3}) == 3);
+		VERIFY(index.lower_bound_index(T{2}) == 4);
+	}
+
+	return true;
+}
+
+#undef VERIFY
+
+GTEST_TEST(ContainerTest, EytzingerIndexTest)
+{
+	HAMON_CXX20_CONSTEXPR_EXPECT_TRUE(test<int>(16));
+	HAMON_CXX20_CONSTEXPR_EXPECT_TRUE(test<unsigned char>(16));
+	HAMON_CXX20_CONSTEXPR_EXPECT_TRUE(test<float>(16));
+	EXPECT_TRUE(test<int>(300));
+	EXPECT_TRUE(test<unsigned char>(100));
+	EXPECT_TRUE(test<double>(300));
+
+	{
+		hamon::flat_map<int, hamon::string> m =
+		{
+			{3, "C"},
+			{1, "A"},
+			{4, "D"},
+			{6, "F"},
+			{2, "B"},
+		};
+		hamon::eytzinger_index<hamon::vector<int>> index(m.keys());
+		EXPECT_EQ(0u, index.lower_bound_index(0));
+		EXPECT_EQ(3u, index.lower_bound_index(4));
+		EXPECT_EQ(4u, index.lower_bound_index(5));
+		EXPECT_EQ(5u, index.lower_bound_index(7));
+		EXPECT_EQ("D", m.values()[index.lower_bound_index(4)]);
+
+		// インデックスはスナップショットなので、変更後は構築し直す
+		m.emplace(5, "E");
+		EXPECT_EQ(5u, index.lower_bound_index(7));	// 変更は検出されないので、古い結果のまま
+		index.assign(m.keys());
+		EXPECT_EQ("E", m.values()[index.lower_bound_index(5)]);
+		EXPECT_EQ(6u, index.lower_bound_index(7));
+		EXPECT_EQ(6u, index.upper_bound_index(6));
+	}
+	{
+		hamon::flat_set<hamon::string> s = {"banana", "apple", "cherry"};
+		hamon::eytzinger_index<hamon::vector<hamon::string>> index(s);
+		EXPECT_EQ(1u, index.lower_bound_index(hamon::string("b")));
+		EXPECT_EQ(3u, index.upper_bound_index(hamon::string("cherry")));
+	}
+}
+
+}	// namespace eytzinger_index_test
+
+}	// namespace hamon_container_test
@@ -20,16 +20,17 @@
 #include <hamon/algorithm/ranges/adjacent_find.hpp>
 #include <hamon/algorithm/ranges/equal.hpp>
 #include <hamon/algorithm/ranges/inplace_merge.hpp>
+#include <hamon/algorithm/ranges/is_sorted.hpp>
 #include <hamon/algorithm/ranges/lower_bound.hpp>
 #include <hamon/algorithm/ranges/sort.hpp>
 #include <hamon/algorithm/ranges/unique.hpp>
-#include <hamon/algorithm/ranges/upper_bound.hpp>
 #include <hamon/algorithm/remove_if.hpp>
 #include <hamon/compare/detail/synth_three_way.hpp>
 #include <hamon/concepts/detail/constrained_param.hpp>
 #include <hamon/concepts/swap.hpp>
 #include <hamon/container/detail/alloc_rebind.hpp>
 #include <hamon/container/detail/container_compatible_range.hpp>
+#include <hamon/container/detail/flat_search.hpp>
 #include <hamon/container/detail/has_is_transparent.hpp>
 #include <hamon/container/detail/iter_key_type.hpp>
 #include <hamon/container/detail/iter_mapped_type.hpp>
@@ -869,6 +870,38 @@ public:
 		this->insert(hamon::sorted_unique, il.begin(), il.end());
 	}
 
+	/**
+	 *	@brief	source の全要素を移動して挿入する (extension)
+	 *
+	 *	source の要素を各コンテナの末尾にまとめて追加し、一度のマージで整列と重複の除去を行う。
+	 *	キーが重複する場合は *this の要素が残る。
+	 *	呼び出し後、source は空になる。
+	 */
+	template <typename C2>
+	HAMON_CXX14_CONSTEXPR void
+	merge(flat_map<Key, T, C2, KeyContainer, MappedContainer>&& source)
+	{
+		auto cont = hamon::move(source).extract();
+		HAMON_ASSERT(cont.keys.size() == cont.values.size());
+
+		hamon::detail::reserve_append_size(this->c.keys, cont.keys);
+		hamon::detail::reserve_append_size(this->c.values, cont.values);
+
+		auto gd = hamon::detail::make_exception_guard([&]() noexcept { clear(); });
+		using difference_t = hamon::ranges::range_difference_t<decltype(c.keys)>;
+		auto const m = static_cast<difference_t>(c.keys.size());
+		for (auto& k : cont.keys)
+		{
+			c.keys.emplace(c.keys.end(), hamon::move(k));
+		}
+		for (auto& v : cont.values)
+		{
+			c.values.emplace(c.values.end(), hamon::move(v));
+		}
+		this->sort_merge_unique(m);
+		gd.complete();
+	}
+
 	HAMON_CXX14_CONSTEXPR containers
 	extract() &&
 	{
@@ -1209,14 +1242,14 @@ public:
 	HAMON_CXX14_CONSTEXPR iterator
 	lower_bound(key_type const& x)
 	{
-		return binary_search(*this, hamon::ranges::lower_bound, x);
+		return binary_search(*this, hamon::detail::flat_lower_bound, x);
 	}
 
 	HAMON_NODISCARD	// nodiscard as an extension
 	HAMON_CXX11_CONSTEXPR const_iterator
 	lower_bound(key_type const& x) const
 	{
-		return binary_search(*this, hamon::ranges::lower_bound, x);
+		return binary_search(*this, hamon::detail::flat_lower_bound, x);
 	}
 
 	template <typename K,
@@ -1225,7 +1258,7 @@ public:
 	HAMON_CXX14_CONSTEXPR iterator
 	lower_bound(K const& x)
 	{
-		return binary_search(*this, hamon::ranges::lower_bound, x);
+		return binary_search(*this, hamon::detail::flat_lower_bound, x);
 	}
 
 	template <typename K,
@@ -1234,21 +1267,21 @@ public:
 	HAMON_CXX11_CONSTEXPR const_iterator
 	lower_bound(K const& x) const
 	{
-		return binary_search(*this, hamon::ranges::lower_bound, x);
+		return binary_search(*this, hamon::detail::flat_lower_bound, x);
 	}
 
 	HAMON_NODISCARD	// nodiscard as an extension
 	HAMON_CXX14_CONSTEXPR iterator
 	upper_bound(key_type const& x)
 	{
-		return binary_search(*this, hamon::ranges::upper_bound, x);
+		return binary_search(*this, hamon::detail::flat_upper_bound, x);
 	}
 
 	HAMON_NODISCARD	// nodiscard as an extension
 	HAMON_CXX11_CONSTEXPR const_iterator
 	upper_bound(key_type const& x) const
 	{
-		return binary_search(*this, hamon::ranges::upper_bound, x);
+		return binary_search(*this, hamon::detail::flat_upper_bound, x);
 	}
 
 	template <typename K,
@@ -1257,7 +1290,7 @@ public:
 	HAMON_CXX14_CONSTEXPR iterator
 	upper_bound(K const& x)
 	{
-		return binary_search(*this, hamon::ranges::upper_bound, x);
+		return binary_search(*this, hamon::detail::flat_upper_bound, x);
 	}
 
 	template <typename K,
@@ -1266,7 +1299,7 @@ public:
 	HAMON_CXX11_CONSTEXPR const_iterator
 	upper_bound(K const& x) const
 	{
-		return binary_search(*this, hamon::ranges::upper_bound, x);
+		return binary_search(*this, hamon::detail::flat_upper_bound, x);
 	}
 
 	HAMON_NODISCARD	// nodiscard as an extension
@@ -1421,9 +1454,7 @@ private:
 		auto const m = static_cast<difference_t>(c.keys.size());
 		this->append(first, last);
 		HAMON_ASSERT(this->is_sorted_and_unique(c.keys | hamon::views::drop(m)));
-		auto zv = hamon::views::zip(c.keys, c.values);
-		hamon::ranges::inplace_merge(zv, zv.begin() + m, this->value_comp());
-		this->unique(zv);
+		this->merge_unique(m);
 		gd.complete();
 	}
 
@@ -1435,18 +1466,57 @@ private:
 		using difference_t = hamon::ranges::range_difference_t<decltype(c.keys)>;
 		auto const m = static_cast<difference_t>(c.keys.size());
 		this->append(first, last);
-		auto zv = hamon::views::zip(c.keys, c.values);
-		hamon::ranges::sort(zv | hamon::views::drop(m), this->value_comp());
-		hamon::ranges::inplace_merge(zv, zv.begin() + m, this->value_comp());
-		this->unique(zv);
+		this->sort_merge_unique(m);
 		gd.complete();
 	}
 
+	template <typename Difference>
+	HAMON_CXX14_CONSTEXPR void
+	sort_merge_unique(Difference m)
+	{
+		// 追加された要素が既にソートされていれば (一括ロードではよくある) ソートを省く
+		auto zv = hamon::views::zip(c.keys, c.values);
+		auto tail = zv | hamon::views::drop(m);
+		if (!hamon::ranges::is_sorted(tail, this->value_comp()))
+		{
+			hamon::ranges::sort(tail, this->value_comp());
+		}
+
+		this->merge_unique(m);
+	}
+
+	// [0, m) と [m, size()) がそれぞれソートされている状態から、全体をソートして重複を取り除く
+	template <typename Difference>
+	HAMON_CXX14_CONSTEXPR void
+	merge_unique(Difference m)
+	{
+		auto const key_first  = c.keys.begin();
+		auto const key_middle = key_first + m;
+		if (key_middle == c.keys.end())
+		{
+			return;
+		}
+
+		// 追加された要素の最小値より小さい要素は移動しないので、マージと重複の除去の対象外にできる
+		auto const p = hamon::ranges::lower_bound(key_first, key_middle, *key_middle, this->compare) - key_first;
+
+		auto zv = hamon::views::zip(c.keys, c.values);
+		if (p != m)
+		{
+			hamon::ranges::inplace_merge(zv.begin() + p, zv.begin() + m, zv.end(), this->value_comp());
+		}
+
+		auto it = hamon::ranges::unique(zv.begin() + p, zv.end(), key_equiv(this->compare)).begin();
+		auto dist = it - zv.begin();
+		c.keys.erase(c.keys.begin() + dist, c.keys.end());
+		c.values.erase(c.values.begin() + dist, c.values.end());
+	}
+
 	template <typename K, typename... Args>
 	HAMON_CXX14_CONSTEXPR hamon::pair<iterator, bool>
 	try_emplace_impl(K&& k, Args&&... args)
 	{
-		auto key_iter = hamon::ranges::lower_bound(c.keys, k, this->compare);
+		auto key_iter = hamon::detail::flat_lower_bound(c.keys, k, this->compare);
 		return this->try_emplace_pos(hamon::move(key_iter), hamon::forward<K>(k), hamon::forward<Args>(args)...);
 	}
 
@@ -1550,7 +1620,7 @@ private:
 	static HAMON_CXX14_CONSTEXPR hamon::pair<It, It>
 	equal_range_impl(Self&& self, K const& k)
 	{
-		auto key_first = hamon::ranges::lower_bound(self.c.keys, k, self.compare);
+		auto key_first = hamon::detail::flat_lower_bound(self.c.keys, k, self.compare);
 		auto key_last = key_first;
 		if (!(key_first == self.c.keys.end() || self.compare(k, *key_first)))
 		{
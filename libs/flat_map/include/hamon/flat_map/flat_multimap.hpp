@@ -21,15 +21,14 @@
 #include <hamon/algorithm/ranges/equal_range.hpp>
 #include <hamon/algorithm/ranges/inplace_merge.hpp>
 #include <hamon/algorithm/ranges/is_sorted.hpp>
-#include <hamon/algorithm/ranges/lower_bound.hpp>
 #include <hamon/algorithm/ranges/sort.hpp>
-#include <hamon/algorithm/ranges/upper_bound.hpp>
 #include <hamon/algorithm/remove_if.hpp>
 #include <hamon/compare/detail/synth_three_way.hpp>
 #include <hamon/concepts/detail/constrained_param.hpp>
 #include <hamon/concepts/swap.hpp>
 #include <hamon/container/detail/alloc_rebind.hpp>
 #include <hamon/container/detail/container_compatible_range.hpp>
+#include <hamon/container/detail/flat_search.hpp>
 #include <hamon/container/detail/has_is_transparent.hpp>
 #include <hamon/container/detail/iter_key_type.hpp>
 #include <hamon/container/detail/iter_mapped_type.hpp>
@@ -956,14 +955,14 @@ public:
 	HAMON_CXX14_CONSTEXPR iterator
 	lower_bound(key_type const& x)
 	{
-		return binary_search(*this, hamon::ranges::lower_bound, x);
+		return binary_search(*this, hamon::detail::flat_lower_bound, x);
 	}
 
 	HAMON_NODISCARD	// nodiscard as an extension
 	HAMON_CXX11_CONSTEXPR const_iterator
 	lower_bound(key_type const& x) const
 	{
-		return binary_search(*this, hamon::ranges::lower_bound, x);
+		return binary_search(*this, hamon::detail::flat_lower_bound, x);
 	}
 
 	template <typename K,
@@ -972,7 +971,7 @@ public:
 	HAMON_CXX14_CONSTEXPR iterator
 	lower_bound(K const& x)
 	{
-		return binary_search(*this, hamon::ranges::lower_bound, x);
+		return binary_search(*this, hamon::detail::flat_lower_bound, x);
 	}
 
 	template <typename K,
@@ -981,21 +980,21 @@ public:
 	HAMON_CXX11_CONSTEXPR const_iterator
 	lower_bound(K const& x) const
 	{
-		return binary_search(*this, hamon::ranges::lower_bound, x);
+		return binary_search(*this, hamon::detail::flat_lower_bound, x);
 	}
 
 	HAMON_NODISCARD	// nodiscard as an extension
 	HAMON_CXX14_CONSTEXPR iterator
 	upper_bound(key_type const& x)
 	{
-		return binary_search(*this, hamon::ranges::upper_bound, x);
+		return binary_search(*this, hamon::detail::flat_upper_bound, x);
 	}
 
 	HAMON_NODISCARD	// nodiscard as an extension
 	HAMON_CXX11_CONSTEXPR const_iterator
 	upper_bound(key_type const& x) const
 	{
-		return binary_search(*this, hamon::ranges::upper_bound, x);
+		return binary_search(*this, hamon::detail::flat_upper_bound, x);
 	}
 
 	template <typename K,
@@ -1004,7 +1003,7 @@ public:
 	HAMON_CXX14_CONSTEXPR iterator
 	upper_bound(K const& x)
 	{
-		return binary_search(*this, hamon::ranges::upper_bound, x);
+		return binary_search(*this, hamon::detail::flat_upper_bound, x);
 	}
 
 	template <typename K,
@@ -1013,7 +1012,7 @@ public:
 	HAMON_CXX11_CONSTEXPR const_iterator
 	upper_bound(K const& x) const
 	{
-		return binary_search(*this, hamon::ranges::upper_bound, x);
+		return binary_search(*this, hamon::detail::flat_upper_bound, x);
 	}
 
 	HAMON_NODISCARD	// nodiscard as an extension
@@ -1193,7 +1192,7 @@ private:
 	HAMON_CXX14_CONSTEXPR iterator
 	try_emplace_impl(K&& k, Args&&... args)
 	{
-		auto key_iter = hamon::ranges::upper_bound(c.keys, k, this->compare);
+		auto key_iter = hamon::detail::flat_upper_bound(c.keys, k, this->compare);
 		auto mapped_iter = corresponding_mapped_it(*this, key_iter);
 		return this->emplace_exact_pos(
 			hamon::move(key_iter), hamon::move(mapped_iter),
@@ -0,0 +1,147 @@
+﻿/**
+ *	@file	unit_test_flat_map_merge.cpp
+ *
+ *	@brief	merge のテスト
+ *
+ *	template<class C2>
+ *	constexpr void merge(flat_map<Key, T, C2, KeyContainer, MappedContainer>&& source);	// extension
+ */
+
+#include <hamon/flat_map/flat_map.hpp>
+#include <hamon/functional/greater.hpp>
+#include <hamon/functional/less.hpp>
+#include <hamon/type_traits/is_same.hpp>
+#include <hamon/utility/declval.hpp>
+#include <hamon/utility/move.hpp>
+#include <hamon/vector.hpp>
+#include <hamon/deque.hpp>
+#include <hamon/string.hpp>
+#include <gtest/gtest.h>
+#include <sstream>
+#include "constexpr_test.hpp"
+#include "flat_map_test_helper.hpp"
+
+namespace hamon_flat_map_test
+{
+
+namespace merge_test
+{
+
+#if !defined(HAMON_USE_STD_FLAT_MAP)
+
+#define VERIFY(...)	if (!(__VA_ARGS__)) { return false; }
+
+template <typename KeyContainer, typename MappedContainer>
+HAMON_CXX20_CONSTEXPR bool test()
+{
+	using Key = typename KeyContainer::value_type;
+	using T = typename MappedContainer::value_type;
+	using Map = hamon::flat_map<Key, T, hamon::less<Key>, KeyContainer, MappedContainer>;
+	using Map2 = hamon::flat_map<Key, T, hamon::greater<Key>, KeyContainer, MappedContainer>;
+
+	static_assert(hamon::is_same<decltype(hamon::declval<Map&>().merge(hamon::declval<Map&&>())), void>::value, "");
+	static_assert(hamon::is_same<decltype(hamon::declval<Map&>().merge(hamon::declval<Map2&&>())), void>::value, "");
+
+	{
+		Map v;
+		Map s
+		{
+			{Key{3}, T{30}},
+			{Key{1}, T{10}},
+			{Key{2}, T{20}},
+		};
+		v.merge(hamon::move(s));
+		VERIFY(check_invariant(v));
+		VERIFY(s.empty());
+		VERIFY(v.size() == 3);
+		VERIFY(v[Key{1}] == T{10});
+		VERIFY(v[Key{2}] == T{20});
+		VERIFY(v[Key{3}] == T{30});
+	}
+	{
+		// 追加される要素が全て既存の要素より後ろ
+		Map v
+		{
+			{Key{1}, T{10}},
+			{Key{2}, T{20}},
+		};
+		Map s
+		{
+			{Key{4}, T{40}},
+			{Key{3}, T{30}},
+		};
+		v.merge(hamon::move(s));
+		VERIFY(check_invariant(v));
+		VERIFY(s.empty());
+		VERIFY(v.size() == 4);
+		VERIFY((v.begin() + 2)->first == Key{3});
+		VERIFY((v.begin() + 2)->second == T{30});
+		VERIFY((v.begin() + 3)->first == Key{4});
+		VERIFY((v.begin() + 3)->second == T{40});
+	}
+	{
+		// 重複するキーは *this の要素が残る
+		Map v
+		{
+			{Key{1}, T{10}},
+			{Key{3}, T{30}},
+			{Key{5}, T{50}},
+		};
+		Map2 s
+		{
+			{Key{2}, T{21}},
+			{Key{3}, T{31}},
+			{Key{6}, T{61}},
+		};
+		v.merge(hamon::move(s));
+		VERIFY(check_invariant(v));
+		VERIFY(s.empty());
+		VERIFY(v.size() == 5);
+		VERIFY(v[Key{1}] == T{10});
+		VERIFY(v[Key{2}] == T{21});
+		VERIFY(v[Key{3}] == T{30});
+		VERIFY(v[Key{5}] == T{50});
+		VERIFY(v[Key{6}] == T{61});
+	}
+
+	return true;
+}
+
+#undef VERIFY
+
+GTEST_TEST(FlatMapTest, MergeTest)
+{
+	HAMON_CXX20_CONSTEXPR_EXPECT_TRUE((test<hamon::vector<int>, hamon::vector<double>>()));
+	HAMON_CXX20_CONSTEXPR_EXPECT_TRUE((test<hamon::vector<float>, hamon::deque<char>>()));
+	HAMON_CXX20_CONSTEXPR_EXPECT_TRUE((test<hamon::deque<char>, hamon::vector<long>>()));
+	HAMON_CXX20_CONSTEXPR_EXPECT_TRUE((test<MinSequenceContainer<int>, MinSequenceContainer<char>>()));
+
+	{
+		hamon::flat_map<hamon::string, int> fm =
+		{
+			{"B", 1},
+			{"D", 2},
+		};
+		hamon::flat_map<hamon::string, int> fm2 =
+		{
+			{"A", 3},
+			{"D", 4},
+			{"C", 5},
+		};
+
+		fm.merge(hamon::move(fm2));
+
+		std::stringstream ss;
+		for (auto const& x : fm)
+		{
+			ss << x.first << ":" << x.second << ", ";
+		}
+		EXPECT_EQ("A:3, B:1, C:5, D:2, ", ss.str());
+	}
+}
+
+#endif
+
+}	// namespace merge_test
+
+}	// namespace hamon_flat_map_test
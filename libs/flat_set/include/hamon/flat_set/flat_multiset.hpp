@@ -30,6 +30,7 @@
 #include <hamon/concepts/swap.hpp>
 #include <hamon/container/detail/alloc_rebind.hpp>
 #include <hamon/container/detail/container_compatible_range.hpp>
+#include <hamon/container/detail/flat_search.hpp>
 #include <hamon/container/detail/has_is_transparent.hpp>
 #include <hamon/container/detail/iter_value_type.hpp>
 #include <hamon/container/detail/reserve_append_size.hpp>
@@ -736,14 +737,14 @@ public:
 	HAMON_CXX14_CONSTEXPR iterator
 	lower_bound(key_type const& x)
 	{
-		return iterator(hamon::ranges::lower_bound(c, x, compare));
+		return iterator(hamon::detail::flat_lower_bound(c, x, compare));
 	}
 
 	HAMON_NODISCARD	// nodiscard as an extension
 	HAMON_CXX11_CONSTEXPR const_iterator
 	lower_bound(key_type const& x) const
 	{
-		return const_iterator(hamon::ranges::lower_bound(c, x, compare));
+		return const_iterator(hamon::detail::flat_lower_bound(c, x, compare));
 	}
 
 	template <typename K,
@@ -752,7 +753,7 @@ public:
 	HAMON_CXX14_CONSTEXPR iterator
 	lower_bound(K const& x)
 	{
-		return iterator(hamon::ranges::lower_bound(c, x, compare));
+		return iterator(hamon::detail::flat_lower_bound(c, x, compare));
 	}
 
 	template <typename K,
@@ -761,21 +762,21 @@ public:
 	HAMON_CXX11_CONSTEXPR const_iterator
 	lower_bound(K const& x) const
 	{
-		return const_iterator(hamon::ranges::lower_bound(c, x, compare));
+		return const_iterator(hamon::detail::flat_lower_bound(c, x, compare));
 	}
 
 	HAMON_NODISCARD	// nodiscard as an extension
 	HAMON_CXX14_CONSTEXPR iterator
 	upper_bound(key_type const& x)
 	{
-		return iterator(hamon::ranges::upper_bound(c, x, compare));
+		return iterator(hamon::detail::flat_upper_bound(c, x, compare));
 	}
 
 	HAMON_NODISCARD	// nodiscard as an extension
 	HAMON_CXX11_CONSTEXPR const_iterator
 	upper_bound(key_type const& x) const
 	{
-		return const_iterator(hamon::ranges::upper_bound(c, x, compare));
+		return const_iterator(hamon::detail::flat_upper_bound(c, x, compare));
 	}
 
 	template <typename K,
@@ -784,7 +785,7 @@ public:
 	HAMON_CXX14_CONSTEXPR iterator
 	upper_bound(K const& x)
 	{
-		return iterator(hamon::ranges::upper_bound(c, x, compare));
+		return iterator(hamon::detail::flat_upper_bound(c, x, compare));
 	}
 
 	template <typename K,
@@ -793,7 +794,7 @@ public:
 	HAMON_CXX11_CONSTEXPR const_iterator
 	upper_bound(K const& x) const
 	{
-		return const_iterator(hamon::ranges::upper_bound(c, x, compare));
+		return const_iterator(hamon::detail::flat_upper_bound(c, x, compare));
 	}
 
 	HAMON_NODISCARD	// nodiscard as an extension
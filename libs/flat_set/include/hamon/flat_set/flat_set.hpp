@@ -18,11 +18,11 @@
 #include <hamon/algorithm/ranges/adjacent_find.hpp>
 #include <hamon/algorithm/ranges/equal.hpp>
 #include <hamon/algorithm/ranges/inplace_merge.hpp>
+#include <hamon/algorithm/ranges/is_sorted.hpp>
 #include <hamon/algorithm/ranges/lexicographical_compare.hpp>
 #include <hamon/algorithm/ranges/lower_bound.hpp>
 #include <hamon/algorithm/ranges/sort.hpp>
 #include <hamon/algorithm/ranges/unique.hpp>
-#include <hamon/algorithm/ranges/upper_bound.hpp>
 #include <hamon/algorithm/remove_if.hpp>
 #include <hamon/compare/detail/synth_three_way.hpp>
 #include <hamon/concepts/detail/constrained_param.hpp>
@@ -30,6 +30,7 @@
 #include <hamon/concepts/swap.hpp>
 #include <hamon/container/detail/alloc_rebind.hpp>
 #include <hamon/container/detail/container_compatible_range.hpp>
+#include <hamon/container/detail/flat_search.hpp>
 #include <hamon/container/detail/has_is_transparent.hpp>
 #include <hamon/container/detail/iter_value_type.hpp>
 #include <hamon/container/detail/reserve_append_size.hpp>
@@ -591,6 +592,28 @@ public:
 		this->insert(hamon::sorted_unique, il.begin(), il.end());
 	}
 
+	/**
+	 *	@brief	source の全要素を移動して挿入する (extension)
+	 *
+	 *	source の要素をコンテナの末尾にまとめて追加し、一度のマージで整列と重複の除去を行う。
+	 *	キーが重複する場合は *this の要素が残る。
+	 *	呼び出し後、source は空になる。
+	 */
+	template <typename C2>
+	HAMON_CXX14_CONSTEXPR void
+	merge(flat_set<Key, C2, KeyContainer>&& source)
+	{
+		auto cont = hamon::move(source).extract();
+		hamon::detail::reserve_append_size(this->c, cont);
+
+		auto gd = hamon::detail::make_exception_guard([&]() noexcept { clear(); });
+		using difference_t = hamon::ranges::range_difference_t<decltype(c)>;
+		auto const m = static_cast<difference_t>(c.size());
+		this->append(cont.begin(), cont.end());
+		this->sort_merge_unique(m);
+		gd.complete();
+	}
+
 	HAMON_CXX14_CONSTEXPR container_type
 	extract() &&
 	{
@@ -766,14 +789,14 @@ public:
 	HAMON_CXX14_CONSTEXPR iterator
 	lower_bound(key_type const& x)
 	{
-		return iterator(hamon::ranges::lower_bound(c, x, compare));
+		return iterator(hamon::detail::flat_lower_bound(c, x, compare));
 	}
 
 	HAMON_NODISCARD	// nodiscard as an extension
 	HAMON_CXX11_CONSTEXPR const_iterator
 	lower_bound(key_type const& x) const
 	{
-		return const_iterator(hamon::ranges::lower_bound(c, x, compare));
+		return const_iterator(hamon::detail::flat_lower_bound(c, x, compare));
 	}
 
 	template <typename K,
@@ -782,7 +805,7 @@ public:
 	HAMON_CXX14_CONSTEXPR iterator
 	lower_bound(K const& x)
 	{
-		return iterator(hamon::ranges::lower_bound(c, x, compare));
+		return iterator(hamon::detail::flat_lower_bound(c, x, compare));
 	}
 
 	template <typename K,
@@ -791,21 +814,21 @@ public:
 	HAMON_CXX11_CONSTEXPR const_iterator
 	lower_bound(K const& x) const
 	{
-		return const_iterator(hamon::ranges::lower_bound(c, x, compare));
+		return const_iterator(hamon::detail::flat_lower_bound(c, x, compare));
 	}
 
 	HAMON_NODISCARD	// nodiscard as an extension
 	HAMON_CXX14_CONSTEXPR iterator
 	upper_bound(key_type const& x)
 	{
-		return iterator(hamon::ranges::upper_bound(c, x, compare));
+		return iterator(hamon::detail::flat_upper_bound(c, x, compare));
 	}
 
 	HAMON_NODISCARD	// nodiscard as an extension
 	HAMON_CXX11_CONSTEXPR const_iterator
 	upper_bound(key_type const& x) const
 	{
-		return const_iterator(hamon::ranges::upper_bound(c, x, compare));
+		return const_iterator(hamon::detail::flat_upper_bound(c, x, compare));
 	}
 
 	template <typename K,
@@ -814,7 +837,7 @@ public:
 	HAMON_CXX14_CONSTEXPR iterator
 	upper_bound(K const& x)
 	{
-		return iterator(hamon::ranges::upper_bound(c, x, compare));
+		return iterator(hamon::detail::flat_upper_bound(c, x, compare));
 	}
 
 	template <typename K,
@@ -823,7 +846,7 @@ public:
 	HAMON_CXX11_CONSTEXPR const_iterator
 	upper_bound(K const& x) const
 	{
-		return const_iterator(hamon::ranges::upper_bound(c, x, compare));
+		return const_iterator(hamon::detail::flat_upper_bound(c, x, compare));
 	}
 
 	HAMON_NODISCARD	// nodiscard as an extension
@@ -962,8 +985,7 @@ private:
 		auto const m = static_cast<difference_t>(c.size());
 		this->append(hamon::move(first), hamon::move(last));
 		HAMON_ASSERT(this->is_sorted_and_unique(c | hamon::views::drop(m)));
-		hamon::ranges::inplace_merge(c, c.begin() + m, this->compare);
-		this->unique();
+		this->merge_unique(m);
 		gd.complete();
 	}
 
@@ -975,12 +997,46 @@ private:
 		using difference_t = hamon::ranges::range_difference_t<decltype(c)>;
 		auto const m = static_cast<difference_t>(c.size());
 		this->append(hamon::move(first), hamon::move(last));
-		hamon::ranges::sort(c | hamon::views::drop(m), this->compare);
-		hamon::ranges::inplace_merge(c, c.begin() + m, this->compare);
-		this->unique();
+		this->sort_merge_unique(m);
 		gd.complete();
 	}
 
+	template <typename Difference>
+	HAMON_CXX14_CONSTEXPR void
+	sort_merge_unique(Difference m)
+	{
+		// 追加された要素が既にソートされていれば (一括ロードではよくある) ソートを省く
+		auto tail = c | hamon::views::drop(m);
+		if (!hamon::ranges::is_sorted(tail, this->compare))
+		{
+			hamon::ranges::sort(tail, this->compare);
+		}
+
+		this->merge_unique(m);
+	}
+
+	// [0, m) と [m, size()) がそれぞれソートされている状態から、全体をソートして重複を取り除く
+	template <typename Difference>
+	HAMON_CXX14_CONSTEXPR void
+	merge_unique(Difference m)
+	{
+		auto const middle = c.begin() + m;
+		if (middle == c.end())
+		{
+			return;
+		}
+
+		// 追加された要素の最小値より小さい要素は移動しないので、マージと重複の除去の対象外にできる
+		auto const pos = hamon::ranges::lower_bound(c.begin(), middle, *middle, this->compare);
+		if (pos != middle)
+		{
+			hamon::ranges::inplace_merge(pos, middle, c.end(), this->compare);
+		}
+
+		auto it = hamon::ranges::unique(pos, c.end(), key_equiv(this->compare)).begin();
+		c.erase(it, c.end());
+	}
+
 	template <typename... Args>
 	HAMON_CXX14_CONSTEXPR hamon::pair<iterator, bool>
 	emplace_impl(Args&&... args)
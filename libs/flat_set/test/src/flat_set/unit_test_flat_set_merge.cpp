@@ -0,0 +1,123 @@
+﻿/**
+ *	@file	unit_test_flat_set_merge.cpp
+ *
+ *	@brief	merge のテスト
+ *
+ *	template<class C2>
+ *	constexpr void merge(flat_set<Key, C2, KeyContainer>&& source);	// extension
+ */
+
+#include <hamon/flat_set/flat_set.hpp>
+#include <hamon/functional/greater.hpp>
+#include <hamon/functional/less.hpp>
+#include <hamon/type_traits/is_same.hpp>
+#include <hamon/utility/declval.hpp>
+#include <hamon/utility/move.hpp>
+#include <hamon/vector.hpp>
+#include <hamon/deque.hpp>
+#include <hamon/string.hpp>
+#include <gtest/gtest.h>
+#include <sstream>
+#include "constexpr_test.hpp"
+#include "flat_set_test_helper.hpp"
+
+namespace hamon_flat_set_test
+{
+
+namespace merge_test
+{
+
+#if !defined(HAMON_USE_STD_FLAT_SET)
+
+#define VERIFY(...)	if (!(__VA_ARGS__)) { return false; }
+
+template <typename KeyContainer, typename Compare>
+HAMON_CXX20_CONSTEXPR bool test()
+{
+	using Key = typename KeyContainer::value_type;
+	using Set = hamon::flat_set<Key, Compare, KeyContainer>;
+	using Set2 = hamon::flat_set<Key, hamon::greater<Key>, KeyContainer>;
+
+	static_assert(hamon::is_same<decltype(hamon::declval<Set&>().merge(hamon::declval<Set&&>())), void>::value, "");
+	static_assert(hamon::is_same<decltype(hamon::declval<Set&>().merge(hamon::declval<Set2&&>())), void>::value, "");
+
+	{
+		Set v;
+		Set s{Key{3}, Key{1}, Key{2}};
+		v.merge(hamon::move(s));
+		VERIFY(check_invariant(v));
+		VERIFY(s.empty());
+		VERIFY(v.size() == 3);
+		VERIFY(v.count(Key{1}) == 1);
+		VERIFY(v.count(Key{2}) == 1);
+		VERIFY(v.count(Key{3}) == 1);
+	}
+	{
+		// 追加される要素が全て既存の要素より後ろ
+		Set v{Key{1}, Key{2}, Key{3}};
+		Set s{Key{4}, Key{5}};
+		v.merge(hamon::move(s));
+		VERIFY(check_invariant(v));
+		VERIFY(s.empty());
+		VERIFY(v.size() == 5);
+		VERIFY(v.count(Key{4}) == 1);
+		VERIFY(v.count(Key{5}) == 1);
+	}
+	{
+		// 重複と入れ子
+		Set v{Key{1}, Key{3}, Key{5}, Key{7}};
+		Set2 s{Key{2}, Key{3}, Key{6}, Key{8}};
+		v.merge(hamon::move(s));
+		VERIFY(check_invariant(v));
+		VERIFY(s.empty());
+		VERIFY(v.size() == 7);
+		VERIFY(v.count(Key{0}) == 0);
+		VERIFY(v.count(Key{1}) == 1);
+		VERIFY(v.count(Key{2}) == 1);
+		VERIFY(v.count(Key{3}) == 1);
+		VERIFY(v.count(Key{4}) == 0);
+		VERIFY(v.count(Key{5}) == 1);
+		VERIFY(v.count(Key{6}) == 1);
+		VERIFY(v.count(Key{7}) == 1);
+		VERIFY(v.count(Key{8}) == 1);
+	}
+	{
+		Set v{Key{1}, Key{2}};
+		Set s;
+		v.merge(hamon::move(s));
+		VERIFY(check_invariant(v));
+		VERIFY(v.size() == 2);
+	}
+
+	return true;
+}
+
+#undef VERIFY
+
+GTEST_TEST(FlatSetTest, MergeTest)
+{
+	HAMON_CXX20_CONSTEXPR_EXPECT_TRUE((test<hamon::vector<int>, hamon::less<int>>()));
+	HAMON_CXX20_CONSTEXPR_EXPECT_TRUE((test<hamon::vector<int>, hamon::greater<int>>()));
+	HAMON_CXX20_CONSTEXPR_EXPECT_TRUE((test<hamon::deque<char>, hamon::less<>>()));
+	HAMON_CXX20_CONSTEXPR_EXPECT_TRUE((test<MinSequenceContainer<int>, hamon::less<int>>()));
+
+	{
+		hamon::flat_set<hamon::string> fs = {"B", "D"};
+		hamon::flat_set<hamon::string> fs2 = {"A", "D", "C", "E"};
+
+		fs.merge(hamon::move(fs2));
+
+		std::stringstream ss;
+		for (auto const& x : fs)
+		{
+			ss << x << ", ";
+		}
+		EXPECT_EQ("A, B, C, D, E, ", ss.str());
+	}
+}
+
+#endif
+
+}	// namespace merge_test
+
+}	// namespace hamon_flat_set_test
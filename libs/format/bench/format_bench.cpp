@@ -0,0 +1,269 @@
+﻿/**
+ *	@file	format_bench.cpp
+ *
+ *	@brief	hamon::format と snprintf, std::ostringstream の比較ベンチマーク
+ *
+ *	次の書式について、1回あたりの時間を出力する。
+ *		int            : "{}"                   (int)
+ *		log line       : "[{}] {}: {} ({:.3f} ms)" (int, const char*, string_view, double)
+ *		hex / width    : "{:08x} {:>10} {:<6}"  (unsigned, int, const char*)
+ *
+ *	方法ごとの出力先は次の通り。
+ *		snprintf              : char の配列
+ *		ostringstream         : 毎回作り直す std::ostringstream
+ *		format_to (char*)     : char の配列
+ *		format_to_n (char*)   : char の配列
+ *		format (string)       : 戻り値の hamon::string
+ *		format_to (runtime)   : char の配列 (runtime_format で書式文字列を実行時に解析する)
+ *
+ *	使い方:
+ *		format_bench
+ */
+
+#include <hamon/format.hpp>
+#include <hamon/string_view.hpp>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <sstream>
+#include <iomanip>
+#include <string>
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+int const kCount = 1024;
+
+// f を 300ms 繰り返し、1回あたりの時間 [ns] を返す (f は kCount 回の処理を行う)
+template <typename F>
+double measure(F f)
+{
+	std::size_t sink = 0;
+	long long count = 0;
+	auto const start = Clock::now();
+	auto end = start;
+	do
+	{
+		sink += f();
+		count += kCount;
+		end = Clock::now();
+	}
+	while (end - start < std::chrono::milliseconds(300));
+	if (sink == 0)
+	{
+		std::printf(" ");
+	}
+	return std::chrono::duration<double, std::nano>(end - start).count() / static_cast<double>(count);
+}
+
+char const* const kLevels[] = { "debug", "info", "warn", "error" };
+
+void print_row(char const* name, double t_int, double t_log, double t_hex)
+{
+	std::printf("%-22s %12.1f %12.1f %12.1f\n", name, t_int, t_log, t_hex);
+}
+
+}	// namespace
+
+int main()
+{
+	char buf[256];
+	hamon::string_view const message("request completed");
+
+	std::printf("%-22s %12s %12s %12s\n", "[ns]", "int", "log line", "hex / width");
+
+	print_row("snprintf",
+		measure([&]
+		{
+			std::size_t n = 0;
+			for (int i = 0; i < kCount; ++i)
+			{
+				n += static_cast<std::size_t>(std::snprintf(buf, sizeof(buf), "%d", i * 7919));
+			}
+			return n;
+		}),
+		measure([&]
+		{
+			std::size_t n = 0;
+			for (int i = 0; i < kCount; ++i)
+			{
+				n += static_cast<std::size_t>(std::snprintf(buf, sizeof(buf), "[%d] %s: %.*s (%.3f ms)",
+					i, kLevels[i & 3], static_cast<int>(message.size()), message.data(), i * 0.125));
+			}
+			return n;
+		}),
+		measure([&]
+		{
+			std::size_t n = 0;
+			for (int i = 0; i < kCount; ++i)
+			{
+				n += static_cast<std::size_t>(std::snprintf(buf, sizeof(buf), "%08x %10d %-6s",
+					static_cast<unsigned int>(i) * 2654435761u, i, kLevels[i & 3]));
+			}
+			return n;
+		}));
+
+	print_row("ostringstream",
+		measure([&]
+		{
+			std::size_t n = 0;
+			for (int i = 0; i < kCount; ++i)
+			{
+				std::ostringstream os;
+				os << i * 7919;
+				n += os.str().size();
+			}
+			return n;
+		}),
+		measure([&]
+		{
+			std::size_t n = 0;
+			for (int i = 0; i < kCount; ++i)
+			{
+				std::ostringstream os;
+				os << '[' << i << "] " << kLevels[i & 3] << ": ";
+				os.write(message.data(), static_cast<std::streamsize>(message.size()));
+				os << " (" << std::fixed << std::setprecision(3) << i * 0.125 << " ms)";
+				n += os.str().size();
+			}
+			return n;
+		}),
+		measure([&]
+		{
+			std::size_t n = 0;
+			for (int i = 0; i < kCount; ++i)
+			{
+				std::ostringstream os;
+				os << std::hex << std::setw(8) << std::setfill('0') << static_cast<unsigned int>(i) * 2654435761u
+					<< std::dec << std::setfill(' ') << ' ' << std::setw(10) << i << ' '
+					<< std::left << std::setw(6) << kLevels[i & 3];
+				n += os.str().size();
+			}
+			return n;
+		}));
+
+	print_row("format_to (char*)",
+		measure([&]
+		{
+			std::size_t n = 0;
+			for (int i = 0; i < kCount; ++i)
+			{
+				n += static_cast<std::size_t>(hamon::format_to(buf, "{}", i * 7919) - buf);
+			}
+			return n;
+		}),
+		measure([&]
+		{
+			std::size_t n = 0;
+			for (int i = 0; i < kCount; ++i)
+			{
+				n += static_cast<std::size_t>(hamon::format_to(buf, "[{}] {}: {} ({:.3f} ms)",
+					i, kLevels[i & 3], message, i * 0.125) - buf);
+			}
+			return n;
+		}),
+		measure([&]
+		{
+			std::size_t n = 0;
+			for (int i = 0; i < kCount; ++i)
+			{
+				n += static_cast<std::size_t>(hamon::format_to(buf, "{:08x} {:>10} {:<6}",
+					static_cast<unsigned int>(i) * 2654435761u, i, kLevels[i & 3]) - buf);
+			}
+			return n;
+		}));
+
+	print_row("format_to_n (char*)",
+		measure([&]
+		{
+			std::size_t n = 0;
+			for (int i = 0; i < kCount; ++i)
+			{
+				n += static_cast<std::size_t>(hamon::format_to_n(buf, sizeof(buf), "{}", i * 7919).size);
+			}
+			return n;
+		}),
+		measure([&]
+		{
+			std::size_t n = 0;
+			for (int i = 0; i < kCount; ++i)
+			{
+				n += static_cast<std::size_t>(hamon::format_to_n(buf, sizeof(buf), "[{}] {}: {} ({:.3f} ms)",
+					i, kLevels[i & 3], message, i * 0.125).size);
+			}
+			return n;
+		}),
+		measure([&]
+		{
+			std::size_t n = 0;
+			for (int i = 0; i < kCount; ++i)
+			{
+				n += static_cast<std::size_t>(hamon::format_to_n(buf, sizeof(buf), "{:08x} {:>10} {:<6}",
+					static_cast<unsigned int>(i) * 2654435761u, i, kLevels[i & 3]).size);
+			}
+			return n;
+		}));
+
+	print_row("format (string)",
+		measure([&]
+		{
+			std::size_t n = 0;
+			for (int i = 0; i < kCount; ++i)
+			{
+				n += hamon::format("{}", i * 7919).size();
+			}
+			return n;
+		}),
+		measure([&]
+		{
+			std::size_t n = 0;
+			for (int i = 0; i < kCount; ++i)
+			{
+				n += hamon::format("[{}] {}: {} ({:.3f} ms)", i, kLevels[i & 3], message, i * 0.125).size();
+			}
+			return n;
+		}),
+		measure([&]
+		{
+			std::size_t n = 0;
+			for (int i = 0; i < kCount; ++i)
+			{
+				n += hamon::format("{:08x} {:>10} {:<6}",
+					static_cast<unsigned int>(i) * 2654435761u, i, kLevels[i & 3]).size();
+			}
+			return n;
+		}));
+
+	print_row("format_to (runtime)",
+		measure([&]
+		{
+			std::size_t n = 0;
+			for (int i = 0; i < kCount; ++i)
+			{
+				n += static_cast<std::size_t>(hamon::format_to(buf, hamon::runtime_format("{}"), i * 7919) - buf);
+			}
+			return n;
+		}),
+		measure([&]
+		{
+			std::size_t n = 0;
+			for (int i = 0; i < kCount; ++i)
+			{
+				n += static_cast<std::size_t>(hamon::format_to(buf, hamon::runtime_format("[{}] {}: {} ({:.3f} ms)"),
+					i, kLevels[i & 3], message, i * 0.125) - buf);
+			}
+			return n;
+		}),
+		measure([&]
+		{
+			std::size_t n = 0;
+			for (int i = 0; i < kCount; ++i)
+			{
+				n += static_cast<std::size_t>(hamon::format_to(buf, hamon::runtime_format("{:08x} {:>10} {:<6}"),
+					static_cast<unsigned int>(i) * 2654435761u, i, kLevels[i & 3]) - buf);
+			}
+			return n;
+		}));
+}
@@ -0,0 +1,41 @@
+﻿/**
+ *	@file	format.hpp
+ *
+ *	@brief	Format library
+ */
+
+#ifndef HAMON_FORMAT_HPP
+#define HAMON_FORMAT_HPP
+
+#include <hamon/format/basic_format_arg.hpp>
+#include <hamon/format/basic_format_args.hpp>
+#include <hamon/format/basic_format_context.hpp>
+#include <hamon/format/basic_format_parse_context.hpp>
+#include <hamon/format/basic_format_string.hpp>
+#include <hamon/format/format.hpp>
+#include <hamon/format/format_args.hpp>
+#include <hamon/format/format_context.hpp>
+#include <hamon/format/format_error.hpp>
+#include <hamon/format/format_kind.hpp>
+#include <hamon/format/format_parse_context.hpp>
+#include <hamon/format/format_string.hpp>
+#include <hamon/format/format_to.hpp>
+#include <hamon/format/format_to_n.hpp>
+#include <hamon/format/format_to_n_result.hpp>
+#include <hamon/format/formattable.hpp>
+#include <hamon/format/formatted_size.hpp>
+#include <hamon/format/formatter.hpp>
+#include <hamon/format/make_format_args.hpp>
+#include <hamon/format/make_wformat_args.hpp>
+#include <hamon/format/range_format.hpp>
+#include <hamon/format/range_formatter.hpp>
+#include <hamon/format/runtime_format.hpp>
+#include <hamon/format/vformat.hpp>
+#include <hamon/format/vformat_to.hpp>
+#include <hamon/format/visit_format_arg.hpp>
+#include <hamon/format/wformat_args.hpp>
+#include <hamon/format/wformat_context.hpp>
+#include <hamon/format/wformat_parse_context.hpp>
+#include <hamon/format/wformat_string.hpp>
+
+#endif // HAMON_FORMAT_HPP
@@ -0,0 +1,186 @@
+﻿/**
+ *	@file	basic_format_arg.hpp
+ *
+ *	@brief	basic_format_arg の定義
+ */
+
+#ifndef HAMON_FORMAT_BASIC_FORMAT_ARG_HPP
+#define HAMON_FORMAT_BASIC_FORMAT_ARG_HPP
+
+#include <hamon/format/config.hpp>
+
+#if defined(HAMON_USE_STD_FORMAT)
+
+namespace hamon
+{
+
+using std::basic_format_arg;
+
+}	// namespace hamon
+
+#else
+
+#include <hamon/format/basic_format_parse_context.hpp>
+#include <hamon/format/detail/format_arg_type.hpp>
+#include <hamon/string_view/basic_string_view.hpp>
+#include <hamon/utility/declval.hpp>
+#include <hamon/utility/forward.hpp>
+#include <hamon/variant/monostate.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+namespace detail
+{
+
+struct format_arg_access;
+
+}	// namespace detail
+
+// 28.5.8.1 Class template basic_format_arg[format.arg]
+
+template <typename Context>
+class basic_format_arg
+{
+private:
+	using char_type = typename Context::char_type;
+
+	using format_func_t = void (*)(
+		hamon::basic_format_parse_context<char_type>&, Context&, void const*);
+
+	struct string_value
+	{
+		char_type const* m_data;
+		hamon::size_t    m_size;
+	};
+
+	struct handle_value
+	{
+		void const*   m_ptr;
+		format_func_t m_format;
+	};
+
+public:
+	class handle
+	{
+	private:
+		handle_value m_value;
+
+		explicit handle(handle_value v) HAMON_NOEXCEPT
+			: m_value(v) {}
+
+		friend class basic_format_arg;
+
+	public:
+		void format(hamon::basic_format_parse_context<char_type>& parse_ctx, Context& format_ctx) const
+		{
+			m_value.m_format(parse_ctx, format_ctx, m_value.m_ptr);
+		}
+	};
+
+private:
+	union value_type
+	{
+		hamon::monostate   m_none;
+		bool               m_bool;
+		char_type          m_char;
+		int                m_int;
+		unsigned int       m_unsigned;
+		long long          m_long_long;
+		unsigned long long m_unsigned_long_long;
+		float              m_float;
+		double             m_double;
+		long double        m_long_double;
+		char_type const*   m_cstring;
+		string_value       m_string;
+		void const*        m_pointer;
+		handle_value       m_handle;
+
+		value_type() HAMON_NOEXCEPT : m_none() {}
+		value_type(bool v) HAMON_NOEXCEPT : m_bool(v) {}
+		value_type(char_type v) HAMON_NOEXCEPT : m_char(v) {}
+		value_type(int v) HAMON_NOEXCEPT : m_int(v) {}
+		value_type(unsigned int v) HAMON_NOEXCEPT : m_unsigned(v) {}
+		value_type(long long v) HAMON_NOEXCEPT : m_long_long(v) {}
+		value_type(unsigned long long v) HAMON_NOEXCEPT : m_unsigned_long_long(v) {}
+		value_type(float v) HAMON_NOEXCEPT : m_float(v) {}
+		value_type(double v) HAMON_NOEXCEPT : m_double(v) {}
+		value_type(long double v) HAMON_NOEXCEPT : m_long_double(v) {}
+		value_type(char_type const* v) HAMON_NOEXCEPT : m_cstring(v) {}
+		value_type(string_value v) HAMON_NOEXCEPT : m_string(v) {}
+		value_type(void const* v) HAMON_NOEXCEPT : m_pointer(v) {}
+		value_type(handle_value v) HAMON_NOEXCEPT : m_handle(v) {}
+	};
+
+	detail::format_arg_type m_type;
+	value_type              m_value;
+
+	friend struct detail::format_arg_access;
+
+	basic_format_arg(detail::format_arg_type type, value_type value) HAMON_NOEXCEPT
+		: m_type(type)
+		, m_value(value)
+	{}
+
+public:
+	basic_format_arg() HAMON_NOEXCEPT
+		: m_type(detail::format_arg_type::none)
+	{}
+
+	explicit operator bool() const HAMON_NOEXCEPT
+	{
+		return m_type != detail::format_arg_type::none;
+	}
+
+	template <typename Visitor>
+	auto visit(Visitor&& vis)
+	->decltype(hamon::forward<Visitor>(vis)(hamon::declval<hamon::monostate&>()))
+	{
+		switch (m_type)
+		{
+		case detail::format_arg_type::bool_type:
+			return hamon::forward<Visitor>(vis)(m_value.m_bool);
+		case detail::format_arg_type::char_type:
+			return hamon::forward<Visitor>(vis)(m_value.m_char);
+		case detail::format_arg_type::int_type:
+			return hamon::forward<Visitor>(vis)(m_value.m_int);
+		case detail::format_arg_type::unsigned_type:
+			return hamon::forward<Visitor>(vis)(m_value.m_unsigned);
+		case detail::format_arg_type::long_long_type:
+			return hamon::forward<Visitor>(vis)(m_value.m_long_long);
+		case detail::format_arg_type::unsigned_long_long_type:
+			return hamon::forward<Visitor>(vis)(m_value.m_unsigned_long_long);
+		case detail::format_arg_type::float_type:
+			return hamon::forward<Visitor>(vis)(m_value.m_float);
+		case detail::format_arg_type::double_type:
+			return hamon::forward<Visitor>(vis)(m_value.m_double);
+		case detail::format_arg_type::long_double_type:
+			return hamon::forward<Visitor>(vis)(m_value.m_long_double);
+		case detail::format_arg_type::const_char_type_ptr_type:
+			return hamon::forward<Visitor>(vis)(m_value.m_cstring);
+		case detail::format_arg_type::string_view_type:
+		{
+			hamon::basic_string_view<char_type> sv(m_value.m_string.m_data, m_value.m_string.m_size);
+			return hamon::forward<Visitor>(vis)(sv);
+		}
+		case detail::format_arg_type::pointer_type:
+			return hamon::forward<Visitor>(vis)(m_value.m_pointer);
+		case detail::format_arg_type::handle_type:
+		{
+			handle h(m_value.m_handle);
+			return hamon::forward<Visitor>(vis)(h);
+		}
+		default:
+			break;
+		}
+		return hamon::forward<Visitor>(vis)(m_value.m_none);
+	}
+};
+
+}	// namespace hamon
+
+#endif
+
+#endif // HAMON_FORMAT_BASIC_FORMAT_ARG_HPP
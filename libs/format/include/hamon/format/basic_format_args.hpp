@@ -0,0 +1,62 @@
+﻿/**
+ *	@file	basic_format_args.hpp
+ *
+ *	@brief	basic_format_args の定義
+ */
+
+#ifndef HAMON_FORMAT_BASIC_FORMAT_ARGS_HPP
+#define HAMON_FORMAT_BASIC_FORMAT_ARGS_HPP
+
+#include <hamon/format/config.hpp>
+
+#if defined(HAMON_USE_STD_FORMAT)
+
+namespace hamon
+{
+
+using std::basic_format_args;
+
+}	// namespace hamon
+
+#else
+
+#include <hamon/format/basic_format_arg.hpp>
+#include <hamon/format/detail/format_arg_store.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+// 28.5.8.3 Class template basic_format_args[format.args]
+
+template <typename Context>
+class basic_format_args
+{
+private:
+	hamon::size_t                     m_size;
+	hamon::basic_format_arg<Context> const* m_data;
+
+public:
+	template <typename... Args>
+	basic_format_args(detail::format_arg_store<Context, Args...> const& store) HAMON_NOEXCEPT
+		: m_size(sizeof...(Args))
+		, m_data(store.m_args)
+	{}
+
+	hamon::basic_format_arg<Context> get(hamon::size_t i) const HAMON_NOEXCEPT
+	{
+		return i < m_size ? m_data[i] : hamon::basic_format_arg<Context>();
+	}
+
+	hamon::size_t size() const HAMON_NOEXCEPT
+	{
+		return m_size;
+	}
+};
+
+}	// namespace hamon
+
+#endif
+
+#endif // HAMON_FORMAT_BASIC_FORMAT_ARGS_HPP
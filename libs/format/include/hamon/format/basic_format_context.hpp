@@ -0,0 +1,112 @@
+﻿/**
+ *	@file	basic_format_context.hpp
+ *
+ *	@brief	basic_format_context の定義
+ */
+
+#ifndef HAMON_FORMAT_BASIC_FORMAT_CONTEXT_HPP
+#define HAMON_FORMAT_BASIC_FORMAT_CONTEXT_HPP
+
+#include <hamon/format/config.hpp>
+
+#if defined(HAMON_USE_STD_FORMAT)
+
+namespace hamon
+{
+
+using std::basic_format_context;
+
+}	// namespace hamon
+
+#else
+
+#include <hamon/format/basic_format_arg.hpp>
+#include <hamon/format/basic_format_args.hpp>
+#include <hamon/format/formatter.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/utility/move.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+namespace detail
+{
+
+template <typename Out, typename CharT>
+struct format_context_storage;
+
+}	// namespace detail
+
+// 28.5.6.7 Class template basic_format_context[format.context]
+//
+// ロケールには対応していない (常に C ロケールと同じ表記になる) ので、locale() は持たない。
+
+template <typename Out, typename CharT>
+class basic_format_context
+{
+public:
+	using iterator  = Out;
+	using char_type = CharT;
+
+	template <typename T>
+	using formatter_type = hamon::formatter<T, CharT>;
+
+private:
+	hamon::basic_format_args<basic_format_context> m_args;
+	Out m_out;
+
+	template <typename O, typename C>
+	friend struct detail::format_context_storage;
+
+	basic_format_context(Out out, hamon::basic_format_args<basic_format_context> args)
+		: m_args(args)
+		, m_out(hamon::move(out))
+	{}
+
+public:
+	basic_format_context(basic_format_context const&) = delete;
+	basic_format_context& operator=(basic_format_context const&) = delete;
+
+	hamon::basic_format_arg<basic_format_context> arg(hamon::size_t id) const HAMON_NOEXCEPT
+	{
+		return m_args.get(id);
+	}
+
+	iterator out()
+	{
+		return hamon::move(m_out);
+	}
+
+	void advance_to(iterator it)
+	{
+		m_out = hamon::move(it);
+	}
+};
+
+namespace detail
+{
+
+// basic_format_context はコピーもムーブもできないので、これを通して構築する
+template <typename Out, typename CharT>
+struct format_context_storage
+{
+	hamon::basic_format_context<Out, CharT> m_context;
+
+	format_context_storage(Out out, hamon::basic_format_args<hamon::basic_format_context<Out, CharT>> args)
+		: m_context(hamon::move(out), args)
+	{}
+
+	// other と同じ引数を持ち、out に書き込む basic_format_context を作る
+	format_context_storage(Out out, hamon::basic_format_context<Out, CharT> const& other)
+		: m_context(hamon::move(out), other.m_args)
+	{}
+};
+
+}	// namespace detail
+
+}	// namespace hamon
+
+#endif
+
+#endif // HAMON_FORMAT_BASIC_FORMAT_CONTEXT_HPP
@@ -0,0 +1,160 @@
+﻿/**
+ *	@file	basic_format_parse_context.hpp
+ *
+ *	@brief	basic_format_parse_context の定義
+ */
+
+#ifndef HAMON_FORMAT_BASIC_FORMAT_PARSE_CONTEXT_HPP
+#define HAMON_FORMAT_BASIC_FORMAT_PARSE_CONTEXT_HPP
+
+#include <hamon/format/config.hpp>
+
+#if defined(HAMON_USE_STD_FORMAT)
+
+namespace hamon
+{
+
+using std::basic_format_parse_context;
+
+}	// namespace hamon
+
+#else
+
+#include <hamon/format/format_error.hpp>
+#include <hamon/format/detail/format_arg_type.hpp>
+#include <hamon/string_view/basic_string_view.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+namespace detail
+{
+
+struct format_parse_context_access;
+
+}	// namespace detail
+
+// 28.5.6.6 Class template basic_format_parse_context[format.parse.ctx]
+
+template <typename CharT>
+class basic_format_parse_context
+{
+public:
+	using char_type      = CharT;
+	using const_iterator = typename hamon::basic_string_view<CharT>::const_iterator;
+	using iterator       = const_iterator;
+
+private:
+	enum indexing { unknown, manual, automatic };
+
+	iterator                        m_begin;
+	iterator                        m_end;
+	indexing                        m_indexing;
+	hamon::size_t                   m_next_arg_id;
+	hamon::size_t                   m_num_args;
+	detail::format_arg_type const*  m_types;	// コンパイル時に書式文字列を検査するときだけ設定される
+
+	friend struct detail::format_parse_context_access;
+
+public:
+	HAMON_CXX11_CONSTEXPR explicit
+	basic_format_parse_context(hamon::basic_string_view<CharT> fmt, hamon::size_t num_args = 0) HAMON_NOEXCEPT
+		: m_begin(fmt.begin())
+		, m_end(fmt.end())
+		, m_indexing(unknown)
+		, m_next_arg_id(0)
+		, m_num_args(num_args)
+		, m_types(nullptr)
+	{}
+
+	basic_format_parse_context(basic_format_parse_context const&) = delete;
+	basic_format_parse_context& operator=(basic_format_parse_context const&) = delete;
+
+	HAMON_CXX11_CONSTEXPR const_iterator begin() const HAMON_NOEXCEPT { return m_begin; }
+	HAMON_CXX11_CONSTEXPR const_iterator end() const HAMON_NOEXCEPT { return m_end; }
+
+	HAMON_CXX14_CONSTEXPR void advance_to(const_iterator it)
+	{
+		m_begin = it;
+	}
+
+	HAMON_CXX14_CONSTEXPR hamon::size_t next_arg_id()
+	{
+		// [format.parse.ctx]/9
+		if (m_indexing == manual)
+		{
+			hamon::detail::throw_format_error("cannot switch from manual to automatic argument indexing");
+		}
+
+		m_indexing = automatic;
+
+		// [format.parse.ctx]/10
+		if (m_types != nullptr && m_next_arg_id >= m_num_args)
+		{
+			hamon::detail::throw_format_error("argument index out of range");
+		}
+
+		return m_next_arg_id++;
+	}
+
+	HAMON_CXX14_CONSTEXPR void check_arg_id(hamon::size_t id)
+	{
+		// [format.parse.ctx]/12
+		if (m_indexing == automatic)
+		{
+			hamon::detail::throw_format_error("cannot switch from automatic to manual argument indexing");
+		}
+
+		m_indexing = manual;
+
+		// [format.parse.ctx]/13
+		if (m_types != nullptr && id >= m_num_args)
+		{
+			hamon::detail::throw_format_error("argument index out of range");
+		}
+	}
+
+	// 動的な幅と精度に使う引数が整数型かどうか
+	HAMON_CXX14_CONSTEXPR void check_dynamic_spec_integral(hamon::size_t id)
+	{
+		if (m_types != nullptr &&
+			(id >= m_num_args || !detail::is_integral_format_arg_type(m_types[id])))
+		{
+			hamon::detail::throw_format_error("width and precision must be of integral type");
+		}
+	}
+
+	HAMON_CXX14_CONSTEXPR void check_dynamic_spec_string(hamon::size_t id)
+	{
+		if (m_types != nullptr &&
+			(id >= m_num_args ||
+				(m_types[id] != detail::format_arg_type::const_char_type_ptr_type &&
+				 m_types[id] != detail::format_arg_type::string_view_type)))
+		{
+			hamon::detail::throw_format_error("argument must be of string type");
+		}
+	}
+};
+
+namespace detail
+{
+
+struct format_parse_context_access
+{
+	template <typename CharT>
+	static HAMON_CXX14_CONSTEXPR void
+	set_types(hamon::basic_format_parse_context<CharT>& ctx, detail::format_arg_type const* types)
+	{
+		ctx.m_types = types;
+	}
+};
+
+}	// namespace detail
+
+}	// namespace hamon
+
+#endif
+
+#endif // HAMON_FORMAT_BASIC_FORMAT_PARSE_CONTEXT_HPP
@@ -0,0 +1,109 @@
+﻿/**
+ *	@file	basic_format_string.hpp
+ *
+ *	@brief	basic_format_string の定義
+ */
+
+#ifndef HAMON_FORMAT_BASIC_FORMAT_STRING_HPP
+#define HAMON_FORMAT_BASIC_FORMAT_STRING_HPP
+
+#include <hamon/format/config.hpp>
+
+#if defined(HAMON_USE_STD_FORMAT)
+
+namespace hamon
+{
+
+using std::basic_format_string;
+
+}	// namespace hamon
+
+#else
+
+#include <hamon/format/runtime_format.hpp>
+#include <hamon/format/detail/compiled_format_string.hpp>
+#include <hamon/string_view/basic_string_view.hpp>
+#include <hamon/type_traits/enable_if.hpp>
+#include <hamon/type_traits/is_convertible.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+namespace detail
+{
+
+struct format_string_access;
+
+}	// namespace detail
+
+// 28.5.4 Class template basic_format_string[format.fmt.string]
+//
+// C++20 以降ではコンストラクタが consteval なので、書式文字列の誤りはコンパイルエラーになる。
+// それより前では、書式化するときに検査して format_error を投げる。
+//
+// C++20 以降では、コンパイル時に解析した結果 (置換フィールドの間の文字列の位置と、parse 済みの formatter の列)
+// を compiled_format_string として保持し、書式化するときは書式文字列を解析し直さない。
+// runtime_format から作った場合と、C++20 より前では、vformat_to_impl が書式文字列を先頭から解析する。
+
+template <typename CharT, typename... Args>
+struct basic_format_string
+{
+private:
+	hamon::basic_string_view<CharT> m_str;
+#if defined(HAMON_HAS_CXX20_CONSTEVAL)
+	detail::compiled_format_string<CharT, Args...> m_compiled;
+#endif
+
+	friend struct detail::format_string_access;
+
+public:
+	template <typename T,
+		typename = hamon::enable_if_t<
+			hamon::is_convertible<T const&, hamon::basic_string_view<CharT>>::value>>
+#if defined(HAMON_HAS_CXX20_CONSTEVAL)
+	consteval
+#else
+	HAMON_CXX11_CONSTEXPR
+#endif
+	basic_format_string(T const& s)
+		: m_str(s)
+	{
+#if defined(HAMON_HAS_CXX20_CONSTEVAL)
+		m_compiled.compile(m_str);
+#endif
+	}
+
+	basic_format_string(detail::runtime_format_string<CharT> s) HAMON_NOEXCEPT
+		: m_str(s.m_str)
+	{}
+
+	HAMON_CXX11_CONSTEXPR hamon::basic_string_view<CharT>
+	get() const HAMON_NOEXCEPT
+	{
+		return m_str;
+	}
+};
+
+namespace detail
+{
+
+struct format_string_access
+{
+#if defined(HAMON_HAS_CXX20_CONSTEVAL)
+	template <typename CharT, typename... Args>
+	static HAMON_CXX11_CONSTEXPR detail::compiled_format_string<CharT, Args...> const&
+	compiled(hamon::basic_format_string<CharT, Args...> const& fmt) HAMON_NOEXCEPT
+	{
+		return fmt.m_compiled;
+	}
+#endif
+};
+
+}	// namespace detail
+
+}	// namespace hamon
+
+#endif
+
+#endif // HAMON_FORMAT_BASIC_FORMAT_STRING_HPP
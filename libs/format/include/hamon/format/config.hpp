@@ -0,0 +1,30 @@
+﻿/**
+ *	@file	config.hpp
+ *
+ *	@brief
+ */
+
+#ifndef HAMON_FORMAT_CONFIG_HPP
+#define HAMON_FORMAT_CONFIG_HPP
+
+#include <hamon/config.hpp>
+
+#if (HAMON_CXX_STANDARD >= 20) && HAMON_HAS_INCLUDE(<format>)
+#  include <format>
+#endif
+
+#if defined(__cpp_lib_format) && (__cpp_lib_format >= 202207L) && \
+	defined(__cpp_lib_format_ranges) && (__cpp_lib_format_ranges >= 202207L)
+#  define HAMON_USE_STD_FORMAT
+#endif
+
+// formatter を特殊化するときに使う
+#if defined(HAMON_USE_STD_FORMAT)
+#define HAMON_FORMAT_START_NAMESPACE namespace std {
+#else
+#define HAMON_FORMAT_START_NAMESPACE namespace hamon {
+#endif
+
+#define HAMON_FORMAT_END_NAMESPACE   }
+
+#endif // HAMON_FORMAT_CONFIG_HPP
@@ -0,0 +1,321 @@
+﻿/**
+ *	@file	compiled_format_string.hpp
+ *
+ *	@brief	compiled_format_string の定義
+ */
+
+#ifndef HAMON_FORMAT_DETAIL_COMPILED_FORMAT_STRING_HPP
+#define HAMON_FORMAT_DETAIL_COMPILED_FORMAT_STRING_HPP
+
+#include <hamon/format/basic_format_arg.hpp>
+#include <hamon/format/basic_format_args.hpp>
+#include <hamon/format/basic_format_context.hpp>
+#include <hamon/format/basic_format_parse_context.hpp>
+#include <hamon/format/formatter.hpp>
+#include <hamon/format/visit_format_arg.hpp>
+#include <hamon/format/detail/format_arg_store.hpp>
+#include <hamon/format/detail/format_arg_type.hpp>
+#include <hamon/format/detail/format_buffer.hpp>
+#include <hamon/format/detail/parse_format_string.hpp>
+#include <hamon/format/detail/vformat_to_impl.hpp>
+#include <hamon/string_view/basic_string_view.hpp>
+#include <hamon/tuple/get.hpp>
+#include <hamon/tuple/tuple.hpp>
+#include <hamon/type_traits/integral_constant.hpp>
+#include <hamon/type_traits/remove_cvref.hpp>
+#include <hamon/utility/declval.hpp>
+#include <hamon/utility/index_sequence.hpp>
+#include <hamon/utility/make_index_sequence.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon {
+namespace detail {
+
+// 置換フィールド1つ分の formatter
+//
+// basic_format_arg が値を直接持つ型 (算術型, 文字, 文字列, ポインタ) は、
+// コンパイル時に parse した formatter を保持し、書式化するときは format だけを呼ぶ。
+template <typename T, typename CharT, format_arg_type Type = format_arg_type_of<T, CharT>::value>
+struct compiled_format_field
+{
+private:
+	using Context = hamon::basic_format_context<detail::format_buffer_iterator<CharT>, CharT>;
+	using type_tag = hamon::integral_constant<format_arg_type, Type>;
+	using value_type = decltype(format_arg_access::get_value(
+		hamon::declval<hamon::basic_format_arg<Context> const&>(), type_tag{}));
+
+	hamon::formatter<value_type, CharT> m_formatter;
+
+public:
+	static HAMON_CXX11_CONSTEXPR bool parsed_at_compile_time() HAMON_NOEXCEPT
+	{
+		return true;
+	}
+
+	HAMON_CXX14_CONSTEXPR typename hamon::basic_format_parse_context<CharT>::iterator
+	parse(hamon::basic_format_parse_context<CharT>& pc)
+	{
+		return m_formatter.parse(pc);
+	}
+
+	void format(hamon::basic_format_arg<Context> const& arg, hamon::basic_string_view<CharT>, Context& ctx) const
+	{
+		ctx.advance_to(m_formatter.format(format_arg_access::get_value(arg, type_tag{}), ctx));
+	}
+};
+
+// handle で持つ型 (範囲, タプル, ユーザー定義型など) は、コンパイル時には検査だけを行い、
+// 書式化するときに format-spec を parse する。
+// format-spec に置換フィールドが入れ子になっていないときだけ使うので、parse_context の引数の数は使わない。
+template <typename T, typename CharT>
+struct compiled_format_field<T, CharT, format_arg_type::handle_type>
+{
+private:
+	using Context = hamon::basic_format_context<detail::format_buffer_iterator<CharT>, CharT>;
+
+public:
+	static HAMON_CXX11_CONSTEXPR bool parsed_at_compile_time() HAMON_NOEXCEPT
+	{
+		return false;
+	}
+
+	HAMON_CXX14_CONSTEXPR typename hamon::basic_format_parse_context<CharT>::iterator
+	parse(hamon::basic_format_parse_context<CharT>& pc)
+	{
+		hamon::formatter<T, CharT> f;
+		return f.parse(pc);
+	}
+
+	void format(hamon::basic_format_arg<Context> const& arg, hamon::basic_string_view<CharT> spec, Context& ctx) const
+	{
+		hamon::basic_format_parse_context<CharT> pc(spec);
+		hamon::visit_format_arg(format_arg_formatter<Context>{pc, ctx}, arg);
+	}
+};
+
+/**
+ *	@brief	コンパイル時に解析した書式文字列
+ *
+ *	basic_format_string の consteval コンストラクタで compile を呼び、書式文字列を検査する。
+ *	置換フィールドが引数を先頭から順に1回ずつ使う場合 ("{} {:x}" や "{0} {1}" など) は、
+ *	置換フィールドの間の文字列の位置と、parse 済みの formatter の列を保持する。
+ *	書式化するときは書式文字列を解析し直さずに、文字列のコピーと各 formatter の format だけを行う。
+ *
+ *	引数の順番を入れ替える場合、同じ引数を2回使う場合、
+ *	handle で持つ型の format-spec に置換フィールドが入れ子になっている場合は保持せず (compiled() が false)、
+ *	vformat_to_impl で書式化する。
+ */
+template <typename CharT, typename... Args>
+class compiled_format_string
+{
+private:
+	using Context = hamon::basic_format_context<detail::format_buffer_iterator<CharT>, CharT>;
+	using parse_iterator = typename hamon::basic_format_parse_context<CharT>::iterator;
+	using parse_func_t = parse_iterator (*)(hamon::basic_format_parse_context<CharT>&, compiled_format_string&);
+	using index_sequence = hamon::make_index_sequence<sizeof...(Args)>;
+
+	static const hamon::size_t N = sizeof...(Args);
+
+	// 書式文字列の中の [m_first, m_last)。m_escaped なら "{{" と "}}" を含む
+	struct text_segment
+	{
+		hamon::size_t m_first;
+		hamon::size_t m_last;
+		bool          m_escaped;
+
+		HAMON_CXX11_CONSTEXPR text_segment() HAMON_NOEXCEPT
+			: m_first(0), m_last(0), m_escaped(false) {}
+	};
+
+	hamon::tuple<compiled_format_field<hamon::remove_cvref_t<Args>, CharT>...> m_fields;
+	text_segment  m_texts[N + 1];	// i 番目の置換フィールドの前の文字列と、最後の置換フィールドの後の文字列
+	hamon::size_t m_specs[N + 1];	// i 番目の置換フィールドの format-spec の先頭
+	hamon::size_t m_num_fields;
+	bool          m_compiled;
+
+	struct compile_handler
+	{
+		hamon::basic_format_parse_context<CharT>& m_parse_ctx;
+		compiled_format_string& m_self;
+		CharT const*            m_begin;
+		parse_func_t const*     m_parsers;
+		hamon::size_t           m_text_size;	// 今の文字列の、"{{" と "}}" を1文字と数えた長さ
+		bool                    m_in_text;
+
+		HAMON_CXX14_CONSTEXPR void on_text(CharT const* first, CharT const* last)
+		{
+			if (!m_self.m_compiled)
+			{
+				return;
+			}
+
+			// "{{" と "}}" を含む文字列は、複数回に分けて渡される
+			auto& t = m_self.m_texts[m_self.m_num_fields];
+			if (!m_in_text)
+			{
+				t.m_first = static_cast<hamon::size_t>(first - m_begin);
+				m_text_size = 0;
+				m_in_text = true;
+			}
+			t.m_last = static_cast<hamon::size_t>(last - m_begin);
+			m_text_size += static_cast<hamon::size_t>(last - first);
+			t.m_escaped = (t.m_last - t.m_first) != m_text_size;
+		}
+
+		HAMON_CXX14_CONSTEXPR void on_arg(hamon::size_t id)
+		{
+			// id が範囲内であることは basic_format_parse_context が調べている
+			auto const spec = static_cast<hamon::size_t>(m_parse_ctx.begin() - m_begin);
+			m_parse_ctx.advance_to(m_parsers[id](m_parse_ctx, m_self));
+
+			if (!m_self.m_compiled)
+			{
+				return;
+			}
+
+			if (id != m_self.m_num_fields)
+			{
+				m_self.m_compiled = false;
+				return;
+			}
+
+			m_self.m_specs[id] = spec;
+			++m_self.m_num_fields;
+			m_in_text = false;
+		}
+	};
+
+	template <hamon::size_t I>
+	static HAMON_CXX14_CONSTEXPR parse_iterator
+	parse_field(hamon::basic_format_parse_context<CharT>& pc, compiled_format_string& self)
+	{
+		auto& f = hamon::get<I>(self.m_fields);
+		auto const first = pc.begin();
+		auto const last = f.parse(pc);
+
+		// 書式化するときに parse し直す format-spec は、入れ子の置換フィールドを含まないこと
+		if (!f.parsed_at_compile_time())
+		{
+			for (auto it = first; it != last; ++it)
+			{
+				if (*it == CharT('{'))
+				{
+					self.m_compiled = false;
+				}
+			}
+		}
+
+		return last;
+	}
+
+	template <hamon::size_t... Is>
+	HAMON_CXX14_CONSTEXPR void
+	compile_impl(hamon::basic_string_view<CharT> fmt, hamon::index_sequence<Is...>)
+	{
+		// 引数が無いときのために、末尾に要素を1つ追加しておく
+		format_arg_type const types[] =
+		{
+			format_arg_type_of<hamon::remove_cvref_t<Args>, CharT>::value...,
+			format_arg_type::none
+		};
+		parse_func_t const parsers[] =
+		{
+			&compiled_format_string::parse_field<Is>...,
+			nullptr
+		};
+
+		m_num_fields = 0;
+		m_compiled = true;
+
+		hamon::basic_format_parse_context<CharT> pc(fmt, N);
+		detail::format_parse_context_access::set_types(pc, types);
+		compile_handler handler{pc, *this, fmt.data(), parsers, 0, false};
+		detail::parse_format_string(pc, handler);
+	}
+
+	static void
+	write_text(detail::format_buffer<CharT>& buf, CharT const* fmt, text_segment const& t)
+	{
+		CharT const* first = fmt + t.m_first;
+		CharT const* const last = fmt + t.m_last;
+
+		if (t.m_escaped)
+		{
+			// "{{" と "}}" は1文字目だけを書き出す
+			for (CharT const* p = first; p != last; ++p)
+			{
+				if (*p == CharT('{') || *p == CharT('}'))
+				{
+					++p;
+					buf.append(first, static_cast<hamon::size_t>(p - first));
+					first = p + 1;
+				}
+			}
+		}
+
+		if (first != last)
+		{
+			buf.append(first, static_cast<hamon::size_t>(last - first));
+		}
+	}
+
+	template <hamon::size_t I>
+	int format_field(detail::format_buffer<CharT>& buf, hamon::basic_string_view<CharT> fmt, Context& ctx) const
+	{
+		if (I < m_num_fields)
+		{
+			compiled_format_string::write_text(buf, fmt.data(), m_texts[I]);
+			hamon::get<I>(m_fields).format(ctx.arg(I), fmt.substr(m_specs[I]), ctx);
+		}
+		return 0;
+	}
+
+	template <hamon::size_t... Is>
+	void format_impl(
+		detail::format_buffer<CharT>& buf,
+		hamon::basic_string_view<CharT> fmt,
+		hamon::basic_format_args<Context> args,
+		hamon::index_sequence<Is...>) const
+	{
+		detail::format_context_storage<detail::format_buffer_iterator<CharT>, CharT> storage(
+			detail::format_buffer_iterator<CharT>(buf), args);
+		int const dummy[] = {0, this->format_field<Is>(buf, fmt, storage.m_context)...};
+		(void)dummy;
+		compiled_format_string::write_text(buf, fmt.data(), m_texts[m_num_fields]);
+	}
+
+public:
+	HAMON_CXX11_CONSTEXPR compiled_format_string() HAMON_NOEXCEPT
+		: m_fields()
+		, m_texts()
+		, m_specs()
+		, m_num_fields(0)
+		, m_compiled(false)
+	{}
+
+	// fmt を検査して解析する。誤りがあれば format_error を投げる
+	HAMON_CXX14_CONSTEXPR void compile(hamon::basic_string_view<CharT> fmt)
+	{
+		this->compile_impl(fmt, index_sequence{});
+	}
+
+	HAMON_CXX11_CONSTEXPR bool compiled() const HAMON_NOEXCEPT
+	{
+		return m_compiled;
+	}
+
+	// compiled() が true のときだけ呼ぶこと。fmt は compile に渡したものと同じであること
+	void format(
+		detail::format_buffer<CharT>& buf,
+		hamon::basic_string_view<CharT> fmt,
+		hamon::basic_format_args<Context> args) const
+	{
+		this->format_impl(buf, fmt, args, index_sequence{});
+	}
+};
+
+}	// namespace detail
+}	// namespace hamon
+
+#endif // HAMON_FORMAT_DETAIL_COMPILED_FORMAT_STRING_HPP
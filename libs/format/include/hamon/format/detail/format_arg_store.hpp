@@ -0,0 +1,369 @@
+﻿/**
+ *	@file	format_arg_store.hpp
+ *
+ *	@brief	format_arg_store の定義
+ */
+
+#ifndef HAMON_FORMAT_DETAIL_FORMAT_ARG_STORE_HPP
+#define HAMON_FORMAT_DETAIL_FORMAT_ARG_STORE_HPP
+
+#include <hamon/format/basic_format_arg.hpp>
+#include <hamon/format/basic_format_parse_context.hpp>
+#include <hamon/format/detail/format_arg_type.hpp>
+#include <hamon/format/detail/is_string_like.hpp>
+#include <hamon/string_view/basic_string_view.hpp>
+#include <hamon/cstddef/nullptr_t.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/memory/addressof.hpp>
+#include <hamon/type_traits/bool_constant.hpp>
+#include <hamon/type_traits/conditional.hpp>
+#include <hamon/type_traits/integral_constant.hpp>
+#include <hamon/type_traits/is_array.hpp>
+#include <hamon/type_traits/is_const.hpp>
+#include <hamon/type_traits/is_default_constructible.hpp>
+#include <hamon/type_traits/is_integral.hpp>
+#include <hamon/type_traits/is_pointer.hpp>
+#include <hamon/type_traits/is_same.hpp>
+#include <hamon/type_traits/is_signed.hpp>
+#include <hamon/type_traits/is_void.hpp>
+#include <hamon/type_traits/remove_const.hpp>
+#include <hamon/type_traits/remove_extent.hpp>
+#include <hamon/type_traits/remove_pointer.hpp>
+#include <hamon/type_traits/void_t.hpp>
+#include <hamon/utility/declval.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon {
+namespace detail {
+
+// 28.5.8.1 Class template basic_format_arg[format.arg]/6
+// 型 T (cv 修飾と参照を除いたもの) の引数を basic_format_arg のどの型で持つか
+
+template <typename T>
+struct is_format_char_type
+	: public hamon::bool_constant<
+		hamon::is_same<T, char>::value ||
+		hamon::is_same<T, wchar_t>::value ||
+#if defined(HAMON_HAS_CXX20_CHAR8_T)
+		hamon::is_same<T, char8_t>::value ||
+#endif
+		hamon::is_same<T, char16_t>::value ||
+		hamon::is_same<T, char32_t>::value>
+{};
+
+template <typename T, typename CharT>
+struct is_format_cstring
+	: public hamon::bool_constant<
+		hamon::is_same<T, CharT*>::value ||
+		hamon::is_same<T, CharT const*>::value ||
+		(hamon::is_array<T>::value &&
+			hamon::is_same<hamon::remove_const_t<hamon::remove_extent_t<T>>, CharT>::value)>
+{};
+
+template <typename T>
+struct is_format_pointer
+	: public hamon::bool_constant<
+		hamon::is_same<T, hamon::nullptr_t>::value ||
+		(hamon::is_pointer<T>::value && hamon::is_void<hamon::remove_pointer_t<T>>::value)>
+{};
+
+template <typename T, typename CharT>
+struct format_arg_type_of
+	: public hamon::integral_constant<format_arg_type,
+		hamon::is_same<T, bool>::value ? format_arg_type::bool_type :
+		hamon::is_same<T, CharT>::value ? format_arg_type::char_type :
+		(hamon::is_same<T, char>::value && hamon::is_same<CharT, wchar_t>::value) ? format_arg_type::char_type :
+		is_format_char_type<T>::value ? format_arg_type::handle_type :
+		(hamon::is_integral<T>::value && hamon::is_signed<T>::value) ?
+			(sizeof(T) <= sizeof(int) ? format_arg_type::int_type : format_arg_type::long_long_type) :
+		hamon::is_integral<T>::value ?
+			(sizeof(T) <= sizeof(unsigned int) ? format_arg_type::unsigned_type : format_arg_type::unsigned_long_long_type) :
+		hamon::is_same<T, float>::value ? format_arg_type::float_type :
+		hamon::is_same<T, double>::value ? format_arg_type::double_type :
+		hamon::is_same<T, long double>::value ? format_arg_type::long_double_type :
+		is_format_cstring<T, CharT>::value ? format_arg_type::const_char_type_ptr_type :
+		is_string_like<T, CharT>::value ? format_arg_type::string_view_type :
+		is_format_pointer<T>::value ? format_arg_type::pointer_type :
+		format_arg_type::handle_type>
+{};
+
+// formatter<T, CharT> の const な format で、T const を書式化できるかどうか
+template <typename T, typename Context, typename = void>
+struct is_formattable_with_const
+	: public hamon::false_type {};
+
+template <typename T, typename Context>
+struct is_formattable_with_const<T, Context, hamon::void_t<
+	decltype(hamon::declval<typename Context::template formatter_type<T> const&>().format(
+		hamon::declval<T const&>(), hamon::declval<Context&>()))>>
+	: public hamon::true_type {};
+
+template <typename T, typename Context, typename = void>
+struct is_formattable_with_mutable
+	: public hamon::false_type {};
+
+template <typename T, typename Context>
+struct is_formattable_with_mutable<T, Context, hamon::void_t<
+	decltype(hamon::declval<typename Context::template formatter_type<T> const&>().format(
+		hamon::declval<T&>(), hamon::declval<Context&>()))>>
+	: public hamon::true_type {};
+
+struct format_arg_access
+{
+	template <typename Context, typename V>
+	static hamon::basic_format_arg<Context>
+	make(format_arg_type type, V v) HAMON_NOEXCEPT
+	{
+		using value_type = typename hamon::basic_format_arg<Context>::value_type;
+		return hamon::basic_format_arg<Context>(type, value_type(v));
+	}
+
+	template <typename Context, typename CharT>
+	static hamon::basic_format_arg<Context>
+	make_string(CharT const* data, hamon::size_t size) HAMON_NOEXCEPT
+	{
+		using arg_type = hamon::basic_format_arg<Context>;
+		using value_type = typename arg_type::value_type;
+		return arg_type(format_arg_type::string_view_type,
+			value_type(typename arg_type::string_value{data, size}));
+	}
+
+	// 保持している値の型が分かっているときに、visit を通さずに値を取り出す
+	template <typename Context>
+	static bool
+	get_value(hamon::basic_format_arg<Context> const& a, hamon::integral_constant<format_arg_type, format_arg_type::bool_type>) HAMON_NOEXCEPT
+	{
+		return a.m_value.m_bool;
+	}
+
+	template <typename Context>
+	static typename Context::char_type
+	get_value(hamon::basic_format_arg<Context> const& a, hamon::integral_constant<format_arg_type, format_arg_type::char_type>) HAMON_NOEXCEPT
+	{
+		return a.m_value.m_char;
+	}
+
+	template <typename Context>
+	static int
+	get_value(hamon::basic_format_arg<Context> const& a, hamon::integral_constant<format_arg_type, format_arg_type::int_type>) HAMON_NOEXCEPT
+	{
+		return a.m_value.m_int;
+	}
+
+	template <typename Context>
+	static unsigned int
+	get_value(hamon::basic_format_arg<Context> const& a, hamon::integral_constant<format_arg_type, format_arg_type::unsigned_type>) HAMON_NOEXCEPT
+	{
+		return a.m_value.m_unsigned;
+	}
+
+	template <typename Context>
+	static long long
+	get_value(hamon::basic_format_arg<Context> const& a, hamon::integral_constant<format_arg_type, format_arg_type::long_long_type>) HAMON_NOEXCEPT
+	{
+		return a.m_value.m_long_long;
+	}
+
+	template <typename Context>
+	static unsigned long long
+	get_value(hamon::basic_format_arg<Context> const& a, hamon::integral_constant<format_arg_type, format_arg_type::unsigned_long_long_type>) HAMON_NOEXCEPT
+	{
+		return a.m_value.m_unsigned_long_long;
+	}
+
+	template <typename Context>
+	static float
+	get_value(hamon::basic_format_arg<Context> const& a, hamon::integral_constant<format_arg_type, format_arg_type::float_type>) HAMON_NOEXCEPT
+	{
+		return a.m_value.m_float;
+	}
+
+	template <typename Context>
+	static double
+	get_value(hamon::basic_format_arg<Context> const& a, hamon::integral_constant<format_arg_type, format_arg_type::double_type>) HAMON_NOEXCEPT
+	{
+		return a.m_value.m_double;
+	}
+
+	template <typename Context>
+	static long double
+	get_value(hamon::basic_format_arg<Context> const& a, hamon::integral_constant<format_arg_type, format_arg_type::long_double_type>) HAMON_NOEXCEPT
+	{
+		return a.m_value.m_long_double;
+	}
+
+	template <typename Context>
+	static typename Context::char_type const*
+	get_value(hamon::basic_format_arg<Context> const& a, hamon::integral_constant<format_arg_type, format_arg_type::const_char_type_ptr_type>) HAMON_NOEXCEPT
+	{
+		return a.m_value.m_cstring;
+	}
+
+	template <typename Context>
+	static hamon::basic_string_view<typename Context::char_type>
+	get_value(hamon::basic_format_arg<Context> const& a, hamon::integral_constant<format_arg_type, format_arg_type::string_view_type>) HAMON_NOEXCEPT
+	{
+		return hamon::basic_string_view<typename Context::char_type>(a.m_value.m_string.m_data, a.m_value.m_string.m_size);
+	}
+
+	template <typename Context>
+	static void const*
+	get_value(hamon::basic_format_arg<Context> const& a, hamon::integral_constant<format_arg_type, format_arg_type::pointer_type>) HAMON_NOEXCEPT
+	{
+		return a.m_value.m_pointer;
+	}
+
+	// handle は書式化するときに formatter を作り、parse と format を呼ぶ
+	template <typename Context, typename TQ>
+	static void
+	format_handle(hamon::basic_format_parse_context<typename Context::char_type>& parse_ctx,
+		Context& format_ctx, void const* ptr)
+	{
+		using TD = hamon::remove_const_t<TQ>;
+		typename Context::template formatter_type<TD> f;
+		parse_ctx.advance_to(f.parse(parse_ctx));
+		format_ctx.advance_to(f.format(*const_cast<TQ*>(static_cast<TD const*>(ptr)), format_ctx));
+	}
+
+	template <typename Context, typename TQ>
+	static hamon::basic_format_arg<Context>
+	make_handle(TQ& v) HAMON_NOEXCEPT
+	{
+		using arg_type = hamon::basic_format_arg<Context>;
+		using value_type = typename arg_type::value_type;
+		return arg_type(format_arg_type::handle_type,
+			value_type(typename arg_type::handle_value{
+				static_cast<void const*>(hamon::addressof(v)),
+				&format_arg_access::format_handle<Context, TQ>}));
+	}
+};
+
+template <typename Context, typename T>
+inline hamon::basic_format_arg<Context>
+make_format_arg_impl(T& v, hamon::integral_constant<format_arg_type, format_arg_type::bool_type>)
+{
+	return format_arg_access::make<Context>(format_arg_type::bool_type, static_cast<bool>(v));
+}
+
+template <typename Context, typename T>
+inline hamon::basic_format_arg<Context>
+make_format_arg_impl(T& v, hamon::integral_constant<format_arg_type, format_arg_type::char_type>)
+{
+	using char_type = typename Context::char_type;
+	using U = hamon::conditional_t<hamon::is_same<T, char_type>::value, char_type, unsigned char>;
+	return format_arg_access::make<Context>(format_arg_type::char_type,
+		static_cast<char_type>(static_cast<U>(v)));
+}
+
+template <typename Context, typename T>
+inline hamon::basic_format_arg<Context>
+make_format_arg_impl(T& v, hamon::integral_constant<format_arg_type, format_arg_type::int_type>)
+{
+	return format_arg_access::make<Context>(format_arg_type::int_type, static_cast<int>(v));
+}
+
+template <typename Context, typename T>
+inline hamon::basic_format_arg<Context>
+make_format_arg_impl(T& v, hamon::integral_constant<format_arg_type, format_arg_type::unsigned_type>)
+{
+	return format_arg_access::make<Context>(format_arg_type::unsigned_type, static_cast<unsigned int>(v));
+}
+
+template <typename Context, typename T>
+inline hamon::basic_format_arg<Context>
+make_format_arg_impl(T& v, hamon::integral_constant<format_arg_type, format_arg_type::long_long_type>)
+{
+	return format_arg_access::make<Context>(format_arg_type::long_long_type, static_cast<long long>(v));
+}
+
+template <typename Context, typename T>
+inline hamon::basic_format_arg<Context>
+make_format_arg_impl(T& v, hamon::integral_constant<format_arg_type, format_arg_type::unsigned_long_long_type>)
+{
+	return format_arg_access::make<Context>(format_arg_type::unsigned_long_long_type, static_cast<unsigned long long>(v));
+}
+
+template <typename Context, typename T>
+inline hamon::basic_format_arg<Context>
+make_format_arg_impl(T& v, hamon::integral_constant<format_arg_type, format_arg_type::float_type>)
+{
+	return format_arg_access::make<Context>(format_arg_type::float_type, static_cast<float>(v));
+}
+
+template <typename Context, typename T>
+inline hamon::basic_format_arg<Context>
+make_format_arg_impl(T& v, hamon::integral_constant<format_arg_type, format_arg_type::double_type>)
+{
+	return format_arg_access::make<Context>(format_arg_type::double_type, static_cast<double>(v));
+}
+
+template <typename Context, typename T>
+inline hamon::basic_format_arg<Context>
+make_format_arg_impl(T& v, hamon::integral_constant<format_arg_type, format_arg_type::long_double_type>)
+{
+	return format_arg_access::make<Context>(format_arg_type::long_double_type, static_cast<long double>(v));
+}
+
+template <typename Context, typename T>
+inline hamon::basic_format_arg<Context>
+make_format_arg_impl(T& v, hamon::integral_constant<format_arg_type, format_arg_type::const_char_type_ptr_type>)
+{
+	using char_type = typename Context::char_type;
+	return format_arg_access::make<Context>(format_arg_type::const_char_type_ptr_type,
+		static_cast<char_type const*>(v));
+}
+
+template <typename Context, typename T>
+inline hamon::basic_format_arg<Context>
+make_format_arg_impl(T& v, hamon::integral_constant<format_arg_type, format_arg_type::string_view_type>)
+{
+	return format_arg_access::make_string<Context>(v.data(), static_cast<hamon::size_t>(v.size()));
+}
+
+template <typename Context, typename T>
+inline hamon::basic_format_arg<Context>
+make_format_arg_impl(T& v, hamon::integral_constant<format_arg_type, format_arg_type::pointer_type>)
+{
+	return format_arg_access::make<Context>(format_arg_type::pointer_type, static_cast<void const*>(v));
+}
+
+template <typename Context, typename T>
+inline hamon::basic_format_arg<Context>
+make_format_arg_impl(T& v, hamon::integral_constant<format_arg_type, format_arg_type::handle_type>)
+{
+	using TD = hamon::remove_const_t<T>;
+	static_assert(hamon::is_default_constructible<typename Context::template formatter_type<TD>>::value,
+		"formatter is not specialized for this type");
+
+	// const で書式化できるなら const のまま持つ
+	using TQ = hamon::conditional_t<is_formattable_with_const<TD, Context>::value, TD const, T>;
+	static_assert(is_formattable_with_const<TD, Context>::value ||
+		(!hamon::is_const<T>::value && is_formattable_with_mutable<TD, Context>::value),
+		"formatter cannot format this (const) type");
+	return format_arg_access::make_handle<Context>(static_cast<TQ&>(v));
+}
+
+template <typename Context, typename T>
+inline hamon::basic_format_arg<Context>
+make_format_arg(T& v)
+{
+	using TD = hamon::remove_const_t<T>;
+	return detail::make_format_arg_impl<Context>(v,
+		format_arg_type_of<TD, typename Context::char_type>{});
+}
+
+// 28.5.8.2 Class template format-arg-store[format.arg.store]
+template <typename Context, typename... Args>
+struct format_arg_store
+{
+	hamon::basic_format_arg<Context> m_args[sizeof...(Args) == 0 ? 1 : sizeof...(Args)];
+
+	explicit format_arg_store(Args&... args)
+		: m_args{detail::make_format_arg<Context>(args)...}
+	{}
+};
+
+}	// namespace detail
+}	// namespace hamon
+
+#endif // HAMON_FORMAT_DETAIL_FORMAT_ARG_STORE_HPP
@@ -0,0 +1,48 @@
+﻿/**
+ *	@file	format_arg_type.hpp
+ *
+ *	@brief	format_arg_type の定義
+ */
+
+#ifndef HAMON_FORMAT_DETAIL_FORMAT_ARG_TYPE_HPP
+#define HAMON_FORMAT_DETAIL_FORMAT_ARG_TYPE_HPP
+
+#include <hamon/cstdint/uint8_t.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon {
+namespace detail {
+
+// basic_format_arg が保持している値の型
+enum class format_arg_type : hamon::uint8_t
+{
+	none,
+	bool_type,
+	char_type,
+	int_type,
+	unsigned_type,
+	long_long_type,
+	unsigned_long_long_type,
+	float_type,
+	double_type,
+	long_double_type,
+	const_char_type_ptr_type,
+	string_view_type,
+	pointer_type,
+	handle_type,
+};
+
+inline HAMON_CXX11_CONSTEXPR bool
+is_integral_format_arg_type(format_arg_type t) HAMON_NOEXCEPT
+{
+	return
+		t == format_arg_type::int_type ||
+		t == format_arg_type::unsigned_type ||
+		t == format_arg_type::long_long_type ||
+		t == format_arg_type::unsigned_long_long_type;
+}
+
+}	// namespace detail
+}	// namespace hamon
+
+#endif // HAMON_FORMAT_DETAIL_FORMAT_ARG_TYPE_HPP
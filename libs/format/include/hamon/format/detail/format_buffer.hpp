@@ -0,0 +1,412 @@
+﻿/**
+ *	@file	format_buffer.hpp
+ *
+ *	@brief	format_buffer の定義
+ */
+
+#ifndef HAMON_FORMAT_DETAIL_FORMAT_BUFFER_HPP
+#define HAMON_FORMAT_DETAIL_FORMAT_BUFFER_HPP
+
+#include <hamon/format/detail/format_width.hpp>
+#include <hamon/string/char_traits.hpp>
+#include <hamon/iterator/output_iterator_tag.hpp>
+#include <hamon/cstddef/ptrdiff_t.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/limits.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon {
+namespace detail {
+
+/**
+ *	@brief	書式化の出力先
+ *
+ *	formatter は format_buffer_iterator を通して、このバッファの [m_data, m_data + m_capacity) に書き込む。
+ *	いっぱいになったら派生クラスの do_flush で書き出して空きを作る。
+ *	出力先がポインタなら m_data は出力先そのものを指すので、コピーは発生しない。
+ *	どの派生クラスもメモリ確保をしない。
+ */
+template <typename CharT>
+class format_buffer
+{
+public:
+	void push_back(CharT c)
+	{
+		if (m_size == m_capacity)
+		{
+			this->do_flush();
+		}
+		m_data[m_size++] = c;
+	}
+
+	void append(CharT const* s, hamon::size_t n)
+	{
+		for (;;)
+		{
+			hamon::size_t const k = n < m_capacity - m_size ? n : m_capacity - m_size;
+			hamon::char_traits<CharT>::copy(m_data + m_size, s, k);
+			m_size += k;
+			n -= k;
+			if (n == 0)
+			{
+				break;
+			}
+			s += k;
+			this->do_flush();
+		}
+	}
+
+	void fill(hamon::size_t n, CharT c)
+	{
+		for (;;)
+		{
+			hamon::size_t const k = n < m_capacity - m_size ? n : m_capacity - m_size;
+			hamon::char_traits<CharT>::assign(m_data + m_size, k, c);
+			m_size += k;
+			n -= k;
+			if (n == 0)
+			{
+				break;
+			}
+			this->do_flush();
+		}
+	}
+
+	// n 文字を連続して書き込める領域があればその先頭を返す。無ければ nullptr を返す。
+	// 書き込んだら commit で確定する。
+	CharT* reserve(hamon::size_t n)
+	{
+		if (m_capacity - m_size < n)
+		{
+			this->do_flush();
+			if (m_capacity - m_size < n)
+			{
+				return nullptr;
+			}
+		}
+		return m_data + m_size;
+	}
+
+	void commit(hamon::size_t n) HAMON_NOEXCEPT
+	{
+		m_size += n;
+	}
+
+protected:
+	format_buffer(CharT* data, hamon::size_t capacity) HAMON_NOEXCEPT
+		: m_data(data)
+		, m_size(0)
+		, m_capacity(capacity)
+	{}
+
+	~format_buffer() = default;
+
+	format_buffer(format_buffer const&) = delete;
+	format_buffer& operator=(format_buffer const&) = delete;
+
+	// [m_data, m_data + m_size) を書き出して、m_size < m_capacity にする
+	virtual void do_flush() = 0;
+
+	CharT*        m_data;
+	hamon::size_t m_size;
+	hamon::size_t m_capacity;
+};
+
+// format_buffer に書き込む出力イテレータ
+template <typename CharT>
+class format_buffer_iterator
+{
+public:
+	using iterator_category = hamon::output_iterator_tag;
+	using value_type        = void;
+	using difference_type   = hamon::ptrdiff_t;
+	using pointer           = void;
+	using reference         = void;
+
+	format_buffer_iterator() HAMON_NOEXCEPT
+		: m_buffer(nullptr) {}
+
+	explicit format_buffer_iterator(format_buffer<CharT>& buffer) HAMON_NOEXCEPT
+		: m_buffer(&buffer) {}
+
+	format_buffer_iterator& operator=(CharT c)
+	{
+		m_buffer->push_back(c);
+		return *this;
+	}
+
+	format_buffer_iterator& operator*() HAMON_NOEXCEPT { return *this; }
+	format_buffer_iterator& operator++() HAMON_NOEXCEPT { return *this; }
+	format_buffer_iterator& operator++(int) HAMON_NOEXCEPT { return *this; }
+
+	format_buffer<CharT>& buffer() const HAMON_NOEXCEPT { return *m_buffer; }
+
+private:
+	format_buffer<CharT>* m_buffer;
+};
+
+template <typename CharT>
+struct format_buffer_storage
+{
+	static const hamon::size_t size = 256;
+};
+
+// 任意の出力イテレータに書き出すバッファ
+template <typename Out, typename CharT>
+class iterator_format_buffer final : public format_buffer<CharT>
+{
+public:
+	explicit iterator_format_buffer(Out out)
+		: format_buffer<CharT>(m_storage, format_buffer_storage<CharT>::size)
+		, m_out(out)
+	{}
+
+	Out out()
+	{
+		this->do_flush();
+		return m_out;
+	}
+
+private:
+	void do_flush() override
+	{
+		for (hamon::size_t i = 0; i < this->m_size; ++i)
+		{
+			*m_out = m_storage[i];
+			++m_out;
+		}
+		this->m_size = 0;
+	}
+
+	Out   m_out;
+	CharT m_storage[format_buffer_storage<CharT>::size];
+};
+
+// ポインタの指す先に直接書き込むバッファ
+template <typename CharT>
+class iterator_format_buffer<CharT*, CharT> final : public format_buffer<CharT>
+{
+public:
+	explicit iterator_format_buffer(CharT* out) HAMON_NOEXCEPT
+		: format_buffer<CharT>(out, hamon::numeric_limits<hamon::size_t>::max())
+	{}
+
+	CharT* out() HAMON_NOEXCEPT
+	{
+		return this->m_data + this->m_size;
+	}
+
+private:
+	void do_flush() override
+	{
+		// m_capacity は size_t の最大値なので、ここには来ない
+	}
+};
+
+// 最大 n 文字まで出力し、全体の文字数を数えるバッファ
+template <typename Out, typename CharT>
+class format_to_n_buffer final : public format_buffer<CharT>
+{
+public:
+	format_to_n_buffer(Out out, hamon::size_t n)
+		: format_buffer<CharT>(m_storage, format_buffer_storage<CharT>::size)
+		, m_out(out)
+		, m_limit(n)
+		, m_count(0)
+	{}
+
+	Out out()
+	{
+		this->do_flush();
+		return m_out;
+	}
+
+	hamon::size_t count() const HAMON_NOEXCEPT
+	{
+		return m_count + this->m_size;
+	}
+
+private:
+	void do_flush() override
+	{
+		hamon::size_t const written = m_count < m_limit ? m_count : m_limit;
+		hamon::size_t const n =
+			this->m_size < m_limit - written ? this->m_size : m_limit - written;
+		for (hamon::size_t i = 0; i < n; ++i)
+		{
+			*m_out = m_storage[i];
+			++m_out;
+		}
+		m_count += this->m_size;
+		this->m_size = 0;
+	}
+
+	Out           m_out;
+	hamon::size_t m_limit;
+	hamon::size_t m_count;
+	CharT         m_storage[format_buffer_storage<CharT>::size];
+};
+
+// ポインタの指す先に直接書き込み、n 文字を超えた分は数えるだけにするバッファ
+template <typename CharT>
+class format_to_n_buffer<CharT*, CharT> final : public format_buffer<CharT>
+{
+public:
+	format_to_n_buffer(CharT* out, hamon::size_t n) HAMON_NOEXCEPT
+		: format_buffer<CharT>(out, n)
+		, m_out(out)
+		, m_limit(n)
+		, m_count(0)
+	{}
+
+	CharT* out() HAMON_NOEXCEPT
+	{
+		if (this->m_data == m_storage)
+		{
+			this->do_flush();
+		}
+		return m_out + (count() < m_limit ? count() : m_limit);
+	}
+
+	hamon::size_t count() const HAMON_NOEXCEPT
+	{
+		return m_count + this->m_size;
+	}
+
+private:
+	void do_flush() override
+	{
+		if (this->m_data == m_storage)
+		{
+			// 出力先の残りに入る分だけコピーし、以降は捨てる
+			hamon::size_t const written = m_count < m_limit ? m_count : m_limit;
+			hamon::size_t const n =
+				this->m_size < m_limit - written ? this->m_size : m_limit - written;
+			hamon::char_traits<CharT>::copy(m_out + written, m_storage, n);
+		}
+
+		// 出力先に直接書き込んだ分は、そのまま確定する。
+		// reserve で出力先の残りより大きな領域を求められることもあるので、
+		// これ以降は m_storage に書き込んでからコピーする。
+		m_count += this->m_size;
+		this->m_data     = m_storage;
+		this->m_size     = 0;
+		this->m_capacity = format_buffer_storage<CharT>::size;
+	}
+
+	CharT*        m_out;
+	hamon::size_t m_limit;
+	hamon::size_t m_count;
+	CharT         m_storage[format_buffer_storage<CharT>::size];
+};
+
+// 文字数を数えるだけのバッファ
+template <typename CharT>
+class counting_format_buffer final : public format_buffer<CharT>
+{
+public:
+	counting_format_buffer() HAMON_NOEXCEPT
+		: format_buffer<CharT>(m_storage, format_buffer_storage<CharT>::size)
+		, m_count(0)
+	{}
+
+	hamon::size_t count() const HAMON_NOEXCEPT
+	{
+		return m_count + this->m_size;
+	}
+
+private:
+	void do_flush() override
+	{
+		m_count += this->m_size;
+		this->m_size = 0;
+	}
+
+	hamon::size_t m_count;
+	CharT         m_storage[format_buffer_storage<CharT>::size];
+};
+
+// 書き込まれた文字列の表示幅を、文字列を保持せずに数えるバッファ
+//
+// out を指定したときは、書き込まれた文字をそのまま out にも書き出す。
+template <typename CharT>
+class width_counting_format_buffer final : public format_buffer<CharT>
+{
+public:
+	explicit width_counting_format_buffer(format_buffer<CharT>* out = nullptr) HAMON_NOEXCEPT
+		: format_buffer<CharT>(m_storage, format_buffer_storage<CharT>::size)
+		, m_out(out)
+		, m_pending(0)
+		, m_width(0)
+	{}
+
+	// 残りを書き出して、表示幅を返す
+	hamon::size_t finish()
+	{
+		this->forward();
+		m_width += detail::format_estimate_width(m_storage, m_storage + this->m_size);
+		this->m_size = 0;
+		m_pending = 0;
+		return m_width;
+	}
+
+private:
+	// まだ out に書き出していない部分を書き出す
+	void forward()
+	{
+		if (m_out != nullptr)
+		{
+			m_out->append(m_storage + m_pending, this->m_size - m_pending);
+		}
+	}
+
+	void do_flush() override
+	{
+		this->forward();
+
+		// 末尾で切れているコードポイントは、書き出し済みのまま先頭に残しておき、続きと合わせて数える
+		auto const n = detail::format_complete_size(m_storage, this->m_size);
+		m_width += detail::format_estimate_width(m_storage, m_storage + n);
+		m_pending = this->m_size - n;
+		hamon::char_traits<CharT>::move(m_storage, m_storage + n, m_pending);
+		this->m_size = m_pending;
+	}
+
+	format_buffer<CharT>* m_out;
+	hamon::size_t m_pending;
+	hamon::size_t m_width;
+	CharT         m_storage[format_buffer_storage<CharT>::size];
+};
+
+// 文字列の末尾にまとめて追加するバッファ
+template <typename String>
+class string_format_buffer final : public format_buffer<typename String::value_type>
+{
+	using CharT = typename String::value_type;
+
+public:
+	explicit string_format_buffer(String& str)
+		: format_buffer<CharT>(m_storage, format_buffer_storage<CharT>::size)
+		, m_str(str)
+	{}
+
+	void finish()
+	{
+		this->do_flush();
+	}
+
+private:
+	void do_flush() override
+	{
+		m_str.append(m_storage, this->m_size);
+		this->m_size = 0;
+	}
+
+	String& m_str;
+	CharT   m_storage[format_buffer_storage<CharT>::size];
+};
+
+}	// namespace detail
+}	// namespace hamon
+
+#endif // HAMON_FORMAT_DETAIL_FORMAT_BUFFER_HPP
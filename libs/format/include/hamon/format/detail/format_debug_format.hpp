@@ -0,0 +1,40 @@
+﻿/**
+ *	@file	format_debug_format.hpp
+ *
+ *	@brief	format_maybe_set_debug_format の定義
+ */
+
+#ifndef HAMON_FORMAT_DETAIL_FORMAT_DEBUG_FORMAT_HPP
+#define HAMON_FORMAT_DETAIL_FORMAT_DEBUG_FORMAT_HPP
+
+#include <hamon/utility/declval.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon {
+namespace detail {
+
+// formatter が set_debug_format を持っていれば呼ぶ
+template <typename Formatter>
+inline HAMON_CXX14_CONSTEXPR auto
+format_maybe_set_debug_format_impl(Formatter& f, int)
+->decltype(f.set_debug_format(), void())
+{
+	f.set_debug_format();
+}
+
+template <typename Formatter>
+inline HAMON_CXX14_CONSTEXPR void
+format_maybe_set_debug_format_impl(Formatter&, long)
+{}
+
+template <typename Formatter>
+inline HAMON_CXX14_CONSTEXPR void
+format_maybe_set_debug_format(Formatter& f)
+{
+	detail::format_maybe_set_debug_format_impl(f, 0);
+}
+
+}	// namespace detail
+}	// namespace hamon
+
+#endif // HAMON_FORMAT_DETAIL_FORMAT_DEBUG_FORMAT_HPP
@@ -0,0 +1,142 @@
+﻿/**
+ *	@file	format_escape.hpp
+ *
+ *	@brief	format_write_escaped, format_escaped_width の定義
+ */
+
+#ifndef HAMON_FORMAT_DETAIL_FORMAT_ESCAPE_HPP
+#define HAMON_FORMAT_DETAIL_FORMAT_ESCAPE_HPP
+
+#include <hamon/format/detail/format_width.hpp>
+#include <hamon/format/detail/format_write.hpp>
+#include <hamon/charconv/to_chars.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/cstdint/uint32_t.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon {
+namespace detail {
+
+// 28.5.6.5 Formatting escaped characters and strings[format.string.escaped]
+//
+// 制御文字と不正なコードユニットだけをエスケープする。
+// (General_Category が Separator や Other のコードポイントや、
+//  Grapheme_Extend のコードポイントは区別せずにそのまま出力する)
+
+// エスケープした1文字を buf に書き、その長さを返す。エスケープしなくてよければ 0 を返す。
+template <typename CharT>
+inline hamon::size_t
+format_escape_code_point(char (&buf)[16], hamon::uint32_t cp, bool valid, CharT quote) HAMON_NOEXCEPT
+{
+	char c = 0;
+	if (valid)
+	{
+		switch (cp)
+		{
+		case '\t': c = 't';  break;
+		case '\n': c = 'n';  break;
+		case '\r': c = 'r';  break;
+		case '\\': c = '\\'; break;
+		default:
+			if (cp == static_cast<hamon::uint32_t>(quote))
+			{
+				c = static_cast<char>(cp);
+			}
+			break;
+		}
+	}
+
+	if (c != 0)
+	{
+		buf[0] = '\\';
+		buf[1] = c;
+		return 2;
+	}
+
+	if (valid && cp >= 0x20 && cp != 0x7F)
+	{
+		return 0;
+	}
+
+	// \u{hex} か \x{hex}
+	buf[0] = '\\';
+	buf[1] = valid ? 'u' : 'x';
+	buf[2] = '{';
+	auto const r = hamon::to_chars(buf + 3, buf + 13, cp, 16);
+	*r.ptr = '}';
+	return static_cast<hamon::size_t>(r.ptr - buf) + 1;
+}
+
+// first から last までをエスケープし、quote で囲んで書き込む
+template <typename CharT, typename Out>
+inline Out
+format_write_escaped(Out out, CharT const* first, CharT const* last, CharT quote)
+{
+	*out = quote;
+	++out;
+
+	CharT const* plain = first;
+	while (first != last)
+	{
+		hamon::uint32_t cp = 0;
+		bool valid = true;
+		hamon::size_t n = detail::format_decode(first, last, cp, valid);
+		if (!valid)
+		{
+			cp = static_cast<hamon::uint32_t>(*first) &
+				(sizeof(CharT) == 1 ? 0xFFu : sizeof(CharT) == 2 ? 0xFFFFu : 0xFFFFFFFFu);
+		}
+
+		char buf[16] {};
+		hamon::size_t const len = detail::format_escape_code_point(buf, cp, valid, quote);
+		if (len != 0)
+		{
+			out = detail::format_write(out, plain, static_cast<hamon::size_t>(first - plain));
+			out = detail::format_write_narrow<CharT>(out, buf, len);
+			plain = first + n;
+		}
+		first += n;
+	}
+	out = detail::format_write(out, plain, static_cast<hamon::size_t>(first - plain));
+
+	*out = quote;
+	++out;
+	return out;
+}
+
+// format_write_escaped が書き込む文字列の表示幅
+template <typename CharT>
+inline hamon::size_t
+format_escaped_width(CharT const* first, CharT const* last, CharT quote) HAMON_NOEXCEPT
+{
+	hamon::size_t width = 2;
+	while (first != last)
+	{
+		hamon::uint32_t cp = 0;
+		bool valid = true;
+		hamon::size_t n = detail::format_decode(first, last, cp, valid);
+		if (!valid)
+		{
+			cp = static_cast<hamon::uint32_t>(*first) &
+				(sizeof(CharT) == 1 ? 0xFFu : sizeof(CharT) == 2 ? 0xFFFFu : 0xFFFFFFFFu);
+		}
+
+		char buf[16] {};
+		hamon::size_t const len = detail::format_escape_code_point(buf, cp, valid, quote);
+		if (len != 0)
+		{
+			width += len;
+		}
+		else
+		{
+			width += is_format_wide_code_point(cp) ? 2 : 1;
+		}
+		first += n;
+	}
+	return width;
+}
+
+}	// namespace detail
+}	// namespace hamon
+
+#endif // HAMON_FORMAT_DETAIL_FORMAT_ESCAPE_HPP
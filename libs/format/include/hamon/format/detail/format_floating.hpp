@@ -0,0 +1,432 @@
+﻿/**
+ *	@file	format_floating.hpp
+ *
+ *	@brief	format_write_floating の定義
+ */
+
+#ifndef HAMON_FORMAT_DETAIL_FORMAT_FLOATING_HPP
+#define HAMON_FORMAT_DETAIL_FORMAT_FLOATING_HPP
+
+#include <hamon/format/detail/std_format_spec.hpp>
+#include <hamon/format/detail/format_padding.hpp>
+#include <hamon/format/format_error.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/type_traits/conditional.hpp>
+#include <hamon/type_traits/is_same.hpp>
+#include <hamon/limits.hpp>
+#include <hamon/config.hpp>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+#if (HAMON_CXX_STANDARD >= 17) && HAMON_HAS_INCLUDE(<charconv>)
+#  include <charconv>
+#  if defined(__cpp_lib_to_chars) && (__cpp_lib_to_chars >= 201611L)
+#    define HAMON_FORMAT_HAS_STD_FLOATING_TO_CHARS
+#  endif
+#endif
+
+namespace hamon {
+namespace detail {
+
+// 浮動小数点数の文字列化
+//
+// hamon::to_chars は整数型にしか対応していないので、
+// 精度を指定しないとき (最短の表現) は std::to_chars があればそれを使い、
+// 無ければ snprintf で精度を増やしながら strtod で読み戻して最短の桁数を探す。
+// 精度を指定したときは std::to_chars か snprintf を使う。
+// どちらもスタック上のバッファに書き込むので、メモリ確保はしない。
+
+template <typename T>
+struct format_floating_limits
+{
+	// 整数部の最大桁数
+	static const int max_integer_digits  = hamon::numeric_limits<T>::max_exponent10 + 1;
+	// 小数部の最大桁数 (これより下の桁は常に 0)
+	static const int max_fraction_digits = hamon::numeric_limits<T>::digits - hamon::numeric_limits<T>::min_exponent;
+};
+
+inline int
+format_snprintf(char* buf, hamon::size_t n, char const* fmt, int precision, double value)
+{
+	return std::snprintf(buf, n, fmt, precision, value);
+}
+
+inline int
+format_snprintf(char* buf, hamon::size_t n, char const* fmt, int precision, long double value)
+{
+	return std::snprintf(buf, n, fmt, precision, value);
+}
+
+inline bool format_round_trips(char const* s, float value)       { return std::strtof(s, nullptr) == value; }
+inline bool format_round_trips(char const* s, double value)      { return std::strtod(s, nullptr) == value; }
+inline bool format_round_trips(char const* s, long double value) { return std::strtold(s, nullptr) == value; }
+
+template <typename T>
+using format_printf_type = typename hamon::conditional<
+	hamon::is_same<T, long double>::value, long double, double>::type;
+
+// "%[#].*[L]c" を作る
+template <typename T>
+inline void
+format_make_printf_spec(char (&fmt)[8], char conversion, bool alternate)
+{
+	char* p = fmt;
+	*p++ = '%';
+	if (alternate)
+	{
+		*p++ = '#';
+	}
+	*p++ = '.';
+	*p++ = '*';
+	if (hamon::is_same<T, long double>::value)
+	{
+		*p++ = 'L';
+	}
+	*p++ = conversion;
+	*p = '\0';
+}
+
+// value (非負の有限値) を最短の10進表現で書き込み、末尾を返す。書き込めなければ nullptr を返す。
+template <typename T>
+inline char*
+format_floating_shortest(char* first, char* last, T value)
+{
+#if defined(HAMON_FORMAT_HAS_STD_FLOATING_TO_CHARS)
+	auto const r = std::to_chars(first, last, value);
+	return r.ec == std::errc{} ? r.ptr : nullptr;
+#else
+	// 読み戻して同じ値になる最小の精度を探す
+	char sci[64] {};
+	int len = 0;
+	for (int p = 0; ; ++p)
+	{
+		len = detail::format_snprintf(sci, sizeof(sci),
+			hamon::is_same<T, long double>::value ? "%.*Le" : "%.*e",
+			p, static_cast<format_printf_type<T>>(value));
+		if (p + 1 >= hamon::numeric_limits<T>::max_digits10 || detail::format_round_trips(sci, value))
+		{
+			break;
+		}
+	}
+
+	// 仮数部の数字と指数に分ける
+	char digits[64] {};
+	int n = 0;
+	char const* p = sci;
+	for (; *p != 'e'; ++p)
+	{
+		if (*p != '.')
+		{
+			digits[n++] = *p;
+		}
+	}
+	int const exp = std::atoi(p + 1);
+
+	// 固定小数点表記の長さ。指数表記以下なら固定小数点表記にする
+	int const fixed_len =
+		exp >= n - 1 ? exp + 1 :
+		exp >= 0     ? n + 1 :
+		n + 1 - exp;
+
+	if (fixed_len > len)
+	{
+		if (last - first < len)
+		{
+			return nullptr;
+		}
+		for (int i = 0; i < len; ++i)
+		{
+			*first++ = sci[i];
+		}
+		return first;
+	}
+
+	if (last - first < fixed_len)
+	{
+		return nullptr;
+	}
+
+	if (exp >= n - 1)
+	{
+		for (int i = 0; i < n; ++i)
+		{
+			*first++ = digits[i];
+		}
+		for (int i = n - 1; i < exp; ++i)
+		{
+			*first++ = '0';
+		}
+	}
+	else if (exp >= 0)
+	{
+		for (int i = 0; i < n; ++i)
+		{
+			if (i == exp + 1)
+			{
+				*first++ = '.';
+			}
+			*first++ = digits[i];
+		}
+	}
+	else
+	{
+		*first++ = '0';
+		*first++ = '.';
+		for (int i = exp + 1; i < 0; ++i)
+		{
+			*first++ = '0';
+		}
+		for (int i = 0; i < n; ++i)
+		{
+			*first++ = digits[i];
+		}
+	}
+	return first;
+#endif
+}
+
+// [pos, end) を後ろにずらして、pos の位置に c を n 個挿入する。last を超えるなら nullptr を返す。
+inline char*
+format_insert_chars(char* last, char* end, char* pos, hamon::size_t n, char c)
+{
+	if (static_cast<hamon::size_t>(last - end) < n)
+	{
+		return nullptr;
+	}
+	for (char* p = end; p != pos; )
+	{
+		--p;
+		p[n] = *p;
+	}
+	for (hamon::size_t i = 0; i < n; ++i)
+	{
+		pos[i] = c;
+	}
+	return end + n;
+}
+
+inline char*
+format_find_char(char* first, char* last, char c)
+{
+	for (; first != last; ++first)
+	{
+		if (*first == c)
+		{
+			return first;
+		}
+	}
+	return last;
+}
+
+/**
+ *	@brief	value (非負の有限値) を spec の表示形式と精度で書き込み、末尾を返す
+ *
+ *	書き込めなければ nullptr を返す。大文字にするのは呼び出し側で行う。
+ */
+template <typename CharT, typename T>
+inline char*
+format_floating_to_chars(char* first, char* last, T value, std_format_spec<CharT> const& spec)
+{
+	char type = static_cast<char>(spec.m_type);
+	if ('A' <= type && type <= 'Z')
+	{
+		type = static_cast<char>(type - 'A' + 'a');
+	}
+
+	if (type == 0 && !spec.m_has_precision)
+	{
+		char* end = detail::format_floating_shortest(first, last, value);
+		if (end != nullptr && spec.m_alternate &&
+			format_find_char(first, end, '.') == end)
+		{
+			// '#' なら必ず小数点を付ける
+			end = format_insert_chars(last, end, format_find_char(first, end, 'e'), 1, '.');
+		}
+		return end;
+	}
+
+	int precision = 6;
+	if (spec.m_has_precision)
+	{
+		precision = static_cast<int>(spec.m_precision);
+	}
+	else if (type == 'a')
+	{
+		precision = -1;	// 最短
+	}
+
+	// 下位の桁が必ず 0 になる精度は、後から 0 を詰める
+	int const limit = format_floating_limits<T>::max_fraction_digits;
+	hamon::size_t extra_zeros = 0;
+	if (precision > limit)
+	{
+		extra_zeros = static_cast<hamon::size_t>(precision - limit);
+		precision = limit;
+	}
+
+	char conversion = type == 0 ? 'g' : type;
+	char* end = nullptr;
+
+#if defined(HAMON_FORMAT_HAS_STD_FLOATING_TO_CHARS)
+	if (!(conversion == 'g' && spec.m_alternate))
+	{
+		std::chars_format const fmt =
+			conversion == 'a' ? std::chars_format::hex :
+			conversion == 'e' ? std::chars_format::scientific :
+			conversion == 'f' ? std::chars_format::fixed :
+			std::chars_format::general;
+		auto const r = precision < 0 ?
+			std::to_chars(first, last, value, fmt) :
+			std::to_chars(first, last, value, fmt, precision);
+		if (r.ec != std::errc{})
+		{
+			return nullptr;
+		}
+		end = r.ptr;
+	}
+	else
+#endif
+	{
+		char fmt[8] {};
+		detail::format_make_printf_spec<T>(fmt, conversion, spec.m_alternate);
+		if (precision < 0)
+		{
+			// "%.*a" の精度に負の値を渡すと、精度の指定が無いものとして扱われる
+			precision = -1;
+		}
+		int const n = detail::format_snprintf(first, static_cast<hamon::size_t>(last - first),
+			fmt, precision, static_cast<format_printf_type<T>>(value));
+		if (n < 0 || n >= last - first)
+		{
+			return nullptr;
+		}
+		end = first + n;
+
+		if (conversion == 'a')
+		{
+			// 先頭の "0x" を取り除く
+			for (char* p = first + 2; p != end; ++p)
+			{
+				p[-2] = *p;
+			}
+			end -= 2;
+		}
+	}
+
+	if (spec.m_alternate && conversion != 'g' && format_find_char(first, end, '.') == end)
+	{
+		// '#' なら必ず小数点を付ける
+		char* pos = conversion == 'a' ? format_find_char(first, end, 'p') :
+			conversion == 'e' ? format_find_char(first, end, 'e') : end;
+		end = format_insert_chars(last, end, pos, 1, '.');
+		if (end == nullptr)
+		{
+			return nullptr;
+		}
+	}
+
+	if (extra_zeros != 0 && (conversion != 'g' || spec.m_alternate))
+	{
+		char* pos = conversion == 'a' ? format_find_char(first, end, 'p') :
+			conversion == 'f' ? end : format_find_char(first, end, 'e');
+		end = format_insert_chars(last, end, pos, extra_zeros, '0');
+	}
+
+	return end;
+}
+
+// 符号を含めた [buf, end) を書き込む
+template <typename CharT, typename Out>
+inline Out
+format_write_floating_chars(Out out, char* buf, char* end, bool has_sign, std_format_spec<CharT> const& spec)
+{
+	char type = static_cast<char>(spec.m_type);
+	if ('A' <= type && type <= 'Z')
+	{
+		for (char* p = buf; p != end; ++p)
+		{
+			if ('a' <= *p && *p <= 'z')
+			{
+				*p = static_cast<char>(*p - 'a' + 'A');
+			}
+		}
+	}
+
+	hamon::size_t const n = static_cast<hamon::size_t>(end - buf);
+	if (spec.m_zero_padding && spec.m_align == format_align::none)
+	{
+		return detail::format_write_zero_padded_narrow(out, spec, buf, has_sign ? 1 : 0, n);
+	}
+	return detail::format_write_padded_narrow(out, spec, buf, n, format_align::right);
+}
+
+// 大きな精度のとき用
+template <typename CharT, typename Out, typename T>
+inline Out
+format_write_floating_large(Out out, T value, char sign, std_format_spec<CharT> const& spec)
+{
+	char buf[
+		format_floating_limits<T>::max_integer_digits +
+		format_floating_limits<T>::max_fraction_digits + 16];
+	char* p = buf;
+	if (sign != 0)
+	{
+		*p++ = sign;
+	}
+	char* end = detail::format_floating_to_chars(p, buf + sizeof(buf), value, spec);
+	if (end == nullptr)
+	{
+		hamon::detail::throw_format_error("floating-point value is too long to format");
+	}
+	return detail::format_write_floating_chars(out, buf, end, sign != 0, spec);
+}
+
+// 浮動小数点数を書き込む
+template <typename CharT, typename Out, typename T>
+inline Out
+format_write_floating(Out out, T value, std_format_spec<CharT> const& spec)
+{
+	bool const negative = std::signbit(value);
+	T const abs_value = negative ? -value : value;
+	char const sign =
+		negative ? '-' :
+		spec.m_sign == format_sign::plus ? '+' :
+		spec.m_sign == format_sign::space ? ' ' : 0;
+
+	if (!std::isfinite(abs_value))
+	{
+		char buf[4] {};
+		char* p = buf;
+		if (sign != 0)
+		{
+			*p++ = sign;
+		}
+		char const* s = std::isnan(abs_value) ? "nan" : "inf";
+		for (int i = 0; i < 3; ++i)
+		{
+			*p++ = s[i];
+		}
+		std_format_spec<CharT> s2 = spec;
+		s2.m_zero_padding = false;
+		return detail::format_write_floating_chars(out, buf, p, sign != 0, s2);
+	}
+
+	char buf[128];
+	char* p = buf;
+	if (sign != 0)
+	{
+		*p++ = sign;
+	}
+	char* end = detail::format_floating_to_chars(p, buf + sizeof(buf), abs_value, spec);
+	if (end == nullptr)
+	{
+		return detail::format_write_floating_large(out, abs_value, sign, spec);
+	}
+	return detail::format_write_floating_chars(out, buf, end, sign != 0, spec);
+}
+
+}	// namespace detail
+}	// namespace hamon
+
+#endif // HAMON_FORMAT_DETAIL_FORMAT_FLOATING_HPP
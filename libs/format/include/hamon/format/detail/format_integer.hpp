@@ -0,0 +1,141 @@
+﻿/**
+ *	@file	format_integer.hpp
+ *
+ *	@brief	format_write_integer の定義
+ */
+
+#ifndef HAMON_FORMAT_DETAIL_FORMAT_INTEGER_HPP
+#define HAMON_FORMAT_DETAIL_FORMAT_INTEGER_HPP
+
+#include <hamon/format/detail/std_format_spec.hpp>
+#include <hamon/format/detail/format_padding.hpp>
+#include <hamon/format/detail/format_width.hpp>
+#include <hamon/format/detail/format_write.hpp>
+#include <hamon/format/format_error.hpp>
+#include <hamon/charconv/to_chars.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/cstdint/uint32_t.hpp>
+#include <hamon/type_traits/is_signed.hpp>
+#include <hamon/type_traits/make_unsigned.hpp>
+#include <hamon/limits.hpp>
+
+namespace hamon {
+namespace detail {
+
+// 整数を文字として書き込む (表示形式 'c')
+template <typename CharT, typename Out, typename T>
+inline Out
+format_write_integer_as_char(Out out, T value, std_format_spec<CharT> const& spec)
+{
+	using U = hamon::make_unsigned_t<CharT>;
+	if ((hamon::is_signed<T>::value && value < 0) ||
+		static_cast<unsigned long long>(value) > static_cast<unsigned long long>(hamon::numeric_limits<U>::max()))
+	{
+		hamon::detail::throw_format_error("integral cannot be stored in char type");
+	}
+
+	CharT const c = static_cast<CharT>(static_cast<U>(value));
+	if (spec.m_width <= 1)
+	{
+		*out = c;
+		++out;
+		return out;
+	}
+
+	hamon::size_t const width =
+		detail::is_format_wide_code_point(static_cast<hamon::uint32_t>(static_cast<U>(c))) ? 2 : 1;
+	return detail::format_write_padded(out, spec, &c, 1, width, format_align::left);
+}
+
+// 整数を書き込む
+template <typename CharT, typename Out, typename T>
+inline Out
+format_write_integer(Out out, T value, std_format_spec<CharT> const& spec)
+{
+	if (spec.m_type == CharT('c'))
+	{
+		return detail::format_write_integer_as_char(out, value, spec);
+	}
+
+	using U = hamon::make_unsigned_t<T>;
+
+	// 符号 + 接頭辞 (最大3文字) + 2進数の桁
+	char buf[hamon::numeric_limits<U>::digits + 3] {};
+	char* p = buf;
+
+	U abs_value = static_cast<U>(value);
+	if (hamon::is_signed<T>::value && value < 0)
+	{
+		abs_value = static_cast<U>(U(0) - abs_value);
+		*p++ = '-';
+	}
+	else if (spec.m_sign == format_sign::plus)
+	{
+		*p++ = '+';
+	}
+	else if (spec.m_sign == format_sign::space)
+	{
+		*p++ = ' ';
+	}
+
+	int base = 10;
+	bool upper = false;
+	switch (static_cast<char>(spec.m_type))
+	{
+	case 'b':
+	case 'B':
+		base = 2;
+		if (spec.m_alternate)
+		{
+			*p++ = '0';
+			*p++ = static_cast<char>(spec.m_type);
+		}
+		break;
+	case 'o':
+		base = 8;
+		if (spec.m_alternate && abs_value != 0)
+		{
+			*p++ = '0';
+		}
+		break;
+	case 'X':
+		upper = true;
+		HAMON_FALLTHROUGH();
+	case 'x':
+		base = 16;
+		if (spec.m_alternate)
+		{
+			*p++ = '0';
+			*p++ = static_cast<char>(spec.m_type);
+		}
+		break;
+	default:
+		break;
+	}
+
+	hamon::size_t const prefix_size = static_cast<hamon::size_t>(p - buf);
+	auto const r = hamon::to_chars(p, buf + sizeof(buf), abs_value, base);
+	if (upper)
+	{
+		for (char* q = p; q != r.ptr; ++q)
+		{
+			if ('a' <= *q && *q <= 'f')
+			{
+				*q = static_cast<char>(*q - 'a' + 'A');
+			}
+		}
+	}
+
+	hamon::size_t const n = static_cast<hamon::size_t>(r.ptr - buf);
+	if (spec.m_zero_padding && spec.m_align == format_align::none)
+	{
+		return detail::format_write_zero_padded_narrow(out, spec, buf, prefix_size, n);
+	}
+
+	return detail::format_write_padded_narrow(out, spec, buf, n, format_align::right);
+}
+
+}	// namespace detail
+}	// namespace hamon
+
+#endif // HAMON_FORMAT_DETAIL_FORMAT_INTEGER_HPP
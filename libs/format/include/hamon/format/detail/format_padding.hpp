@@ -0,0 +1,109 @@
+﻿/**
+ *	@file	format_padding.hpp
+ *
+ *	@brief	format_write_padding, format_write_padded の定義
+ */
+
+#ifndef HAMON_FORMAT_DETAIL_FORMAT_PADDING_HPP
+#define HAMON_FORMAT_DETAIL_FORMAT_PADDING_HPP
+
+#include <hamon/format/detail/std_format_spec.hpp>
+#include <hamon/format/detail/format_write.hpp>
+#include <hamon/cstddef/size_t.hpp>
+
+namespace hamon {
+namespace detail {
+
+// 埋め文字を n 個書き込む
+template <typename CharT, typename Out>
+inline Out
+format_write_padding(Out out, std_format_spec<CharT> const& spec, hamon::size_t n)
+{
+	if (spec.m_fill_size == 1)
+	{
+		return detail::format_fill(out, n, spec.m_fill[0]);
+	}
+
+	for (hamon::size_t i = 0; i < n; ++i)
+	{
+		out = detail::format_write(out, spec.m_fill, spec.m_fill_size);
+	}
+	return out;
+}
+
+struct format_padding_size
+{
+	hamon::size_t m_before;
+	hamon::size_t m_after;
+};
+
+// 表示幅 width の文字列を書き込むときの、前後の埋め文字の数
+template <typename CharT>
+inline format_padding_size
+format_compute_padding(std_format_spec<CharT> const& spec, hamon::size_t width, format_align default_align) HAMON_NOEXCEPT
+{
+	if (spec.m_width <= width)
+	{
+		return {0, 0};
+	}
+
+	hamon::size_t const n = spec.m_width - width;
+	format_align const align = spec.m_align == format_align::none ? default_align : spec.m_align;
+	switch (align)
+	{
+	case format_align::right:
+		return {n, 0};
+	case format_align::center:
+		return {n / 2, n - n / 2};
+	default:
+		return {0, n};
+	}
+}
+
+// 表示幅 width の文字列 [s, s + n) を、埋め文字で揃えて書き込む
+template <typename CharT, typename Out>
+inline Out
+format_write_padded(Out out, std_format_spec<CharT> const& spec,
+	CharT const* s, hamon::size_t n, hamon::size_t width, format_align default_align)
+{
+	auto const padding = detail::format_compute_padding(spec, width, default_align);
+	out = detail::format_write_padding(out, spec, padding.m_before);
+	out = detail::format_write(out, s, n);
+	return detail::format_write_padding(out, spec, padding.m_after);
+}
+
+// 数字や記号だけからなる char の文字列 [s, s + n) を、埋め文字で揃えて書き込む
+template <typename CharT, typename Out>
+inline Out
+format_write_padded_narrow(Out out, std_format_spec<CharT> const& spec,
+	char const* s, hamon::size_t n, format_align default_align)
+{
+	if (spec.m_width <= n)
+	{
+		return detail::format_write_narrow<CharT>(out, s, n);
+	}
+
+	auto const padding = detail::format_compute_padding(spec, n, default_align);
+	out = detail::format_write_padding(out, spec, padding.m_before);
+	out = detail::format_write_narrow<CharT>(out, s, n);
+	return detail::format_write_padding(out, spec, padding.m_after);
+}
+
+// 符号と接頭辞 [s, s + prefix_size) の後に 0 を詰めて、[s + prefix_size, s + n) を書き込む
+template <typename CharT, typename Out>
+inline Out
+format_write_zero_padded_narrow(Out out, std_format_spec<CharT> const& spec,
+	char const* s, hamon::size_t prefix_size, hamon::size_t n)
+{
+	out = detail::format_write_narrow<CharT>(out, s, prefix_size);
+	if (spec.m_width > n)
+	{
+		out = detail::format_fill(out, spec.m_width - n, CharT('0'));
+	}
+	return detail::format_write_narrow<CharT>(out, s + prefix_size, n - prefix_size);
+}
+
+}	// namespace detail
+}	// namespace hamon
+
+#endif // HAMON_FORMAT_DETAIL_FORMAT_PADDING_HPP
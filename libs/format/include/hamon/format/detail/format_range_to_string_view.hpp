@@ -0,0 +1,67 @@
+﻿/**
+ *	@file	format_range_to_string_view.hpp
+ *
+ *	@brief	format_range_to_string_view の定義
+ */
+
+#ifndef HAMON_FORMAT_DETAIL_FORMAT_RANGE_TO_STRING_VIEW_HPP
+#define HAMON_FORMAT_DETAIL_FORMAT_RANGE_TO_STRING_VIEW_HPP
+
+#include <hamon/ranges/begin.hpp>
+#include <hamon/ranges/end.hpp>
+#include <hamon/ranges/data.hpp>
+#include <hamon/ranges/size.hpp>
+#include <hamon/ranges/range_value_t.hpp>
+#include <hamon/ranges/concepts/contiguous_range.hpp>
+#include <hamon/ranges/concepts/sized_range.hpp>
+#include <hamon/string/basic_string.hpp>
+#include <hamon/string_view/basic_string_view.hpp>
+#include <hamon/type_traits/bool_constant.hpp>
+#include <hamon/type_traits/is_same.hpp>
+#include <hamon/cstddef/size_t.hpp>
+
+namespace hamon {
+namespace detail {
+
+template <typename CharT, typename R>
+inline hamon::basic_string_view<CharT>
+format_range_to_string_view_impl(R& r, hamon::basic_string<CharT>&, hamon::true_type)
+{
+	return hamon::basic_string_view<CharT>(
+		hamon::ranges::data(r), static_cast<hamon::size_t>(hamon::ranges::size(r)));
+}
+
+template <typename CharT, typename R>
+inline hamon::basic_string_view<CharT>
+format_range_to_string_view_impl(R& r, hamon::basic_string<CharT>& str, hamon::false_type)
+{
+	auto it = hamon::ranges::begin(r);
+	auto const last = hamon::ranges::end(r);
+	for (; it != last; ++it)
+	{
+		str.push_back(static_cast<CharT>(*it));
+	}
+	return hamon::basic_string_view<CharT>(str.data(), str.size());
+}
+
+/**
+ *	@brief	文字の範囲 r を basic_string_view として返す
+ *
+ *	r が連続した CharT の範囲ならコピーせずにそのまま参照する。
+ *	そうでなければ str にコピーして、str を参照する。
+ */
+template <typename CharT, typename R>
+inline hamon::basic_string_view<CharT>
+format_range_to_string_view(R& r, hamon::basic_string<CharT>& str)
+{
+	using is_contiguous = hamon::bool_constant<
+		hamon::ranges::contiguous_range_t<R>::value &&
+		hamon::ranges::sized_range_t<R>::value &&
+		hamon::is_same<hamon::ranges::range_value_t<R>, CharT>::value>;
+	return detail::format_range_to_string_view_impl(r, str, is_contiguous{});
+}
+
+}	// namespace detail
+}	// namespace hamon
+
+#endif // HAMON_FORMAT_DETAIL_FORMAT_RANGE_TO_STRING_VIEW_HPP
@@ -0,0 +1,73 @@
+﻿/**
+ *	@file	format_to_impl.hpp
+ *
+ *	@brief	format_to_impl の定義
+ */
+
+#ifndef HAMON_FORMAT_DETAIL_FORMAT_TO_IMPL_HPP
+#define HAMON_FORMAT_DETAIL_FORMAT_TO_IMPL_HPP
+
+#include <hamon/format/basic_format_args.hpp>
+#include <hamon/format/basic_format_context.hpp>
+#include <hamon/format/basic_format_string.hpp>
+#include <hamon/format/detail/format_buffer.hpp>
+#include <hamon/format/detail/vformat_to_impl.hpp>
+#include <hamon/utility/move.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon {
+namespace detail {
+
+/**
+ *	@brief	basic_format_string と args を書式化して buf に書き込む
+ *
+ *	fmt がコンパイル時に解析済みなら、その formatter の列で書式化する。
+ *	そうでなければ vformat_to_impl で書式文字列を解析しながら書式化する。
+ */
+template <typename CharT, typename... Args>
+inline void
+format_to_impl(
+	detail::format_buffer<CharT>& buf,
+	hamon::basic_format_string<CharT, Args...> const& fmt,
+	hamon::basic_format_args<hamon::basic_format_context<detail::format_buffer_iterator<CharT>, CharT>> args)
+{
+#if defined(HAMON_HAS_CXX20_CONSTEVAL)
+	auto const& compiled = detail::format_string_access::compiled(fmt);
+	if (compiled.compiled())
+	{
+		compiled.format(buf, fmt.get(), args);
+		return;
+	}
+#endif
+	detail::vformat_to_impl(buf, fmt.get(), args);
+}
+
+// 任意の出力イテレータに書き出す
+template <typename Out, typename CharT, typename... Args>
+inline Out
+format_to_iterator(
+	Out out,
+	hamon::basic_format_string<CharT, Args...> const& fmt,
+	hamon::basic_format_args<hamon::basic_format_context<detail::format_buffer_iterator<CharT>, CharT>> args)
+{
+	detail::iterator_format_buffer<Out, CharT> buf(hamon::move(out));
+	detail::format_to_impl(buf, fmt, args);
+	return buf.out();
+}
+
+// formatter の中から呼ばれたときは、同じバッファに直接書き込む
+template <typename CharT, typename... Args>
+inline detail::format_buffer_iterator<CharT>
+format_to_iterator(
+	detail::format_buffer_iterator<CharT> out,
+	hamon::basic_format_string<CharT, Args...> const& fmt,
+	hamon::basic_format_args<hamon::basic_format_context<detail::format_buffer_iterator<CharT>, CharT>> args)
+{
+	detail::format_to_impl(out.buffer(), fmt, args);
+	return out;
+}
+
+}	// namespace detail
+}	// namespace hamon
+
+#endif // HAMON_FORMAT_DETAIL_FORMAT_TO_IMPL_HPP
@@ -0,0 +1,219 @@
+﻿/**
+ *	@file	format_width.hpp
+ *
+ *	@brief	format_estimate_width, format_complete_size, format_truncate_to_width の定義
+ */
+
+#ifndef HAMON_FORMAT_DETAIL_FORMAT_WIDTH_HPP
+#define HAMON_FORMAT_DETAIL_FORMAT_WIDTH_HPP
+
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/cstdint/uint32_t.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon {
+namespace detail {
+
+// [format.string.std]/13
+// 表示幅が 2 になるコードポイントかどうか
+inline HAMON_CXX11_CONSTEXPR bool
+is_format_wide_code_point(hamon::uint32_t c) HAMON_NOEXCEPT
+{
+	return
+		(0x1100  <= c && c <= 0x115F) ||
+		(0x2329  <= c && c <= 0x232A) ||
+		(0x2E80  <= c && c <= 0x303E) ||
+		(0x3040  <= c && c <= 0xA4CF) ||
+		(0xAC00  <= c && c <= 0xD7A3) ||
+		(0xF900  <= c && c <= 0xFAFF) ||
+		(0xFE10  <= c && c <= 0xFE19) ||
+		(0xFE30  <= c && c <= 0xFE6F) ||
+		(0xFF00  <= c && c <= 0xFF60) ||
+		(0xFFE0  <= c && c <= 0xFFE6) ||
+		(0x1F300 <= c && c <= 0x1F64F) ||
+		(0x1F900 <= c && c <= 0x1F9FF) ||
+		(0x20000 <= c && c <= 0x2FFFD) ||
+		(0x30000 <= c && c <= 0x3FFFD);
+}
+
+/**
+ *	@brief	先頭のコードポイントを読む
+ *
+ *	char は UTF-8、2バイトの wchar_t は UTF-16、それ以外は UTF-32 とみなす。
+ *	不正なコードユニットは、それ1つを1文字として扱い、valid を false にする。
+ */
+template <typename CharT>
+inline hamon::size_t
+format_decode(CharT const* first, CharT const* last, hamon::uint32_t& cp, bool& valid) HAMON_NOEXCEPT
+{
+	valid = true;
+	if (sizeof(CharT) == 1)
+	{
+		auto const c = static_cast<unsigned char>(*first);
+		hamon::size_t n = 0;
+		hamon::uint32_t min_value = 0;
+		if (c < 0x80)
+		{
+			cp = c;
+			return 1;
+		}
+		else if ((c & 0xE0) == 0xC0)
+		{
+			n = 2;
+			cp = c & 0x1Fu;
+			min_value = 0x80;
+		}
+		else if ((c & 0xF0) == 0xE0)
+		{
+			n = 3;
+			cp = c & 0x0Fu;
+			min_value = 0x800;
+		}
+		else if ((c & 0xF8) == 0xF0)
+		{
+			n = 4;
+			cp = c & 0x07u;
+			min_value = 0x10000;
+		}
+
+		if (n == 0 || static_cast<hamon::size_t>(last - first) < n)
+		{
+			cp = c;
+			valid = false;
+			return 1;
+		}
+
+		for (hamon::size_t i = 1; i < n; ++i)
+		{
+			auto const t = static_cast<unsigned char>(first[i]);
+			if ((t & 0xC0) != 0x80)
+			{
+				cp = c;
+				valid = false;
+				return 1;
+			}
+			cp = (cp << 6) | (t & 0x3Fu);
+		}
+
+		if (cp < min_value || cp > 0x10FFFF || (0xD800 <= cp && cp <= 0xDFFF))
+		{
+			cp = c;
+			valid = false;
+			return 1;
+		}
+		return n;
+	}
+	else if (sizeof(CharT) == 2)
+	{
+		auto const c = static_cast<hamon::uint32_t>(*first) & 0xFFFFu;
+		if ((c & 0xFC00) == 0xD800 && last - first >= 2)
+		{
+			auto const t = static_cast<hamon::uint32_t>(first[1]) & 0xFFFFu;
+			if ((t & 0xFC00) == 0xDC00)
+			{
+				cp = 0x10000 + ((c - 0xD800) << 10) + (t - 0xDC00);
+				return 2;
+			}
+		}
+		cp = c;
+		valid = (c & 0xF800) != 0xD800;
+		return 1;
+	}
+	else
+	{
+		cp = static_cast<hamon::uint32_t>(*first);
+		valid = cp <= 0x10FFFF && !(0xD800 <= cp && cp <= 0xDFFF);
+		return 1;
+	}
+}
+
+// 文字列の表示幅を求める
+template <typename CharT>
+inline hamon::size_t
+format_estimate_width(CharT const* first, CharT const* last) HAMON_NOEXCEPT
+{
+	hamon::size_t width = 0;
+	while (first != last)
+	{
+		if (static_cast<hamon::uint32_t>(*first) < 0x80)
+		{
+			++first;
+			++width;
+			continue;
+		}
+
+		hamon::uint32_t cp = 0;
+		bool valid = true;
+		first += detail::format_decode(first, last, cp, valid);
+		width += (valid && is_format_wide_code_point(cp)) ? 2 : 1;
+	}
+	return width;
+}
+
+// [s, s + n) のうち、コードポイントが途中で切れていない先頭部分の長さを返す
+// 末尾で切れているコードポイントは、続きと合わせて数える必要がある
+template <typename CharT>
+inline hamon::size_t
+format_complete_size(CharT const* s, hamon::size_t n) HAMON_NOEXCEPT
+{
+	if (sizeof(CharT) == 1)
+	{
+		// 末尾の3バイト以内にある先頭バイトを探し、そのシーケンスが収まっているか調べる
+		for (hamon::size_t i = 1; i <= 3 && i <= n; ++i)
+		{
+			auto const c = static_cast<unsigned char>(s[n - i]);
+			if ((c & 0xC0) == 0x80)
+			{
+				continue;
+			}
+
+			hamon::size_t const len =
+				(c & 0xE0) == 0xC0 ? 2 :
+				(c & 0xF0) == 0xE0 ? 3 :
+				(c & 0xF8) == 0xF0 ? 4 : 1;
+			return len > i ? n - i : n;
+		}
+		return n;
+	}
+	else if (sizeof(CharT) == 2)
+	{
+		// 上位サロゲートで終わっていれば、下位サロゲートと合わせて数える
+		if (n != 0 && (static_cast<hamon::uint32_t>(s[n - 1]) & 0xFC00u) == 0xD800u)
+		{
+			return n - 1;
+		}
+		return n;
+	}
+	else
+	{
+		return n;
+	}
+}
+
+// 表示幅が max_width を超えない最長の先頭部分を求め、そのコードユニット数を返す
+template <typename CharT>
+inline hamon::size_t
+format_truncate_to_width(CharT const* first, CharT const* last, hamon::size_t max_width, hamon::size_t& width) HAMON_NOEXCEPT
+{
+	CharT const* p = first;
+	width = 0;
+	while (p != last)
+	{
+		hamon::uint32_t cp = 0;
+		bool valid = true;
+		hamon::size_t const n = detail::format_decode(p, last, cp, valid);
+		hamon::size_t const w = (valid && is_format_wide_code_point(cp)) ? 2 : 1;
+		if (width + w > max_width)
+		{
+			break;
+		}
+		width += w;
+		p += n;
+	}
+	return static_cast<hamon::size_t>(p - first);
+}
+
+}	// namespace detail
+}	// namespace hamon
+
+#endif // HAMON_FORMAT_DETAIL_FORMAT_WIDTH_HPP
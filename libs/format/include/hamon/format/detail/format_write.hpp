@@ -0,0 +1,109 @@
+﻿/**
+ *	@file	format_write.hpp
+ *
+ *	@brief	format_write, format_fill, format_write_narrow の定義
+ */
+
+#ifndef HAMON_FORMAT_DETAIL_FORMAT_WRITE_HPP
+#define HAMON_FORMAT_DETAIL_FORMAT_WRITE_HPP
+
+#include <hamon/format/detail/format_buffer.hpp>
+#include <hamon/cstddef/size_t.hpp>
+
+namespace hamon {
+namespace detail {
+
+// 出力イテレータに文字列を書き込む。
+// format_buffer_iterator のときはまとめてコピーする。
+
+template <typename Out, typename CharT>
+inline Out
+format_write(Out out, CharT const* s, hamon::size_t n)
+{
+	for (hamon::size_t i = 0; i < n; ++i)
+	{
+		*out = s[i];
+		++out;
+	}
+	return out;
+}
+
+template <typename CharT>
+inline detail::format_buffer_iterator<CharT>
+format_write(detail::format_buffer_iterator<CharT> out, CharT const* s, hamon::size_t n)
+{
+	out.buffer().append(s, n);
+	return out;
+}
+
+template <typename Out, typename CharT>
+inline Out
+format_fill(Out out, hamon::size_t n, CharT c)
+{
+	for (hamon::size_t i = 0; i < n; ++i)
+	{
+		*out = c;
+		++out;
+	}
+	return out;
+}
+
+template <typename CharT>
+inline detail::format_buffer_iterator<CharT>
+format_fill(detail::format_buffer_iterator<CharT> out, hamon::size_t n, CharT c)
+{
+	out.buffer().fill(n, c);
+	return out;
+}
+
+// char の文字列 (数字や記号など、基本文字集合だけのもの) を CharT として書き込む
+template <typename CharT, typename Out>
+inline Out
+format_write_narrow(Out out, char const* s, hamon::size_t n)
+{
+	for (hamon::size_t i = 0; i < n; ++i)
+	{
+		*out = static_cast<CharT>(s[i]);
+		++out;
+	}
+	return out;
+}
+
+template <typename CharT>
+inline void
+format_write_narrow_impl(detail::format_buffer<CharT>& buf, char const* s, hamon::size_t n)
+{
+	if (CharT* p = buf.reserve(n))
+	{
+		for (hamon::size_t i = 0; i < n; ++i)
+		{
+			p[i] = static_cast<CharT>(s[i]);
+		}
+		buf.commit(n);
+		return;
+	}
+
+	for (hamon::size_t i = 0; i < n; ++i)
+	{
+		buf.push_back(static_cast<CharT>(s[i]));
+	}
+}
+
+inline void
+format_write_narrow_impl(detail::format_buffer<char>& buf, char const* s, hamon::size_t n)
+{
+	buf.append(s, n);
+}
+
+template <typename CharT>
+inline detail::format_buffer_iterator<CharT>
+format_write_narrow(detail::format_buffer_iterator<CharT> out, char const* s, hamon::size_t n)
+{
+	detail::format_write_narrow_impl(out.buffer(), s, n);
+	return out;
+}
+
+}	// namespace detail
+}	// namespace hamon
+
+#endif // HAMON_FORMAT_DETAIL_FORMAT_WRITE_HPP
@@ -0,0 +1,70 @@
+﻿/**
+ *	@file	format_write_padded_by.hpp
+ *
+ *	@brief	format_write_padded_by の定義
+ */
+
+#ifndef HAMON_FORMAT_DETAIL_FORMAT_WRITE_PADDED_BY_HPP
+#define HAMON_FORMAT_DETAIL_FORMAT_WRITE_PADDED_BY_HPP
+
+#include <hamon/format/detail/format_buffer.hpp>
+#include <hamon/format/detail/format_padding.hpp>
+#include <hamon/format/detail/format_width.hpp>
+#include <hamon/format/detail/std_format_spec.hpp>
+#include <hamon/string/basic_string.hpp>
+#include <hamon/cstddef/size_t.hpp>
+
+namespace hamon {
+namespace detail {
+
+/**
+ *	@brief	f が書き込む文字列を、埋め文字で揃えて out に書き込む
+ *
+ *	f は format_buffer_iterator<CharT> を受け取って書き込み、書き込み終わった位置を返す関数。
+ *	表示幅は width_counting_format_buffer で数えるので、文字列を保持しない。
+ *
+ *	- 左寄せのときは、out に書き込みながら表示幅を数え、最後に埋め文字を書き込む。
+ *	- それ以外で multipass が true のときは、表示幅を数えるためだけに f を1回余分に呼ぶ。
+ *	- 入力範囲のように2回書き込めないときだけは、一旦文字列に書き込む。
+ */
+template <typename CharT, typename F>
+inline format_buffer_iterator<CharT>
+format_write_padded_by(format_buffer_iterator<CharT> out, std_format_spec<CharT> const& spec,
+	format_align default_align, bool multipass, F f)
+{
+	using iterator = format_buffer_iterator<CharT>;
+
+	format_align const align = spec.m_align == format_align::none ? default_align : spec.m_align;
+	if (align == format_align::left)
+	{
+		width_counting_format_buffer<CharT> buf(&out.buffer());
+		f(iterator(buf));
+		auto const padding = detail::format_compute_padding(spec, buf.finish(), default_align);
+		return detail::format_write_padding(out, spec, padding.m_after);
+	}
+
+	if (multipass)
+	{
+		width_counting_format_buffer<CharT> buf;
+		f(iterator(buf));
+		auto const padding = detail::format_compute_padding(spec, buf.finish(), default_align);
+		out = detail::format_write_padding(out, spec, padding.m_before);
+		out = f(out);
+		return detail::format_write_padding(out, spec, padding.m_after);
+	}
+
+	hamon::basic_string<CharT> str;
+	{
+		string_format_buffer<hamon::basic_string<CharT>> buf(str);
+		f(iterator(buf));
+		buf.finish();
+	}
+	return detail::format_write_padded(out, spec, str.data(), str.size(),
+		detail::format_estimate_width(str.data(), str.data() + str.size()),
+		default_align);
+}
+
+}	// namespace detail
+}	// namespace hamon
+
+#endif // HAMON_FORMAT_DETAIL_FORMAT_WRITE_PADDED_BY_HPP
@@ -0,0 +1,123 @@
+﻿/**
+ *	@file	formatter_char.hpp
+ *
+ *	@brief	formatter_char の定義
+ */
+
+#ifndef HAMON_FORMAT_DETAIL_FORMATTER_CHAR_HPP
+#define HAMON_FORMAT_DETAIL_FORMATTER_CHAR_HPP
+
+#include <hamon/format/basic_format_parse_context.hpp>
+#include <hamon/format/format_error.hpp>
+#include <hamon/format/detail/std_format_spec.hpp>
+#include <hamon/format/detail/format_escape.hpp>
+#include <hamon/format/detail/format_integer.hpp>
+#include <hamon/format/detail/format_padding.hpp>
+#include <hamon/format/detail/format_width.hpp>
+#include <hamon/cstdint/uint32_t.hpp>
+#include <hamon/type_traits/make_unsigned.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon {
+namespace detail {
+
+// 書式指定の type が整数の表示形式かどうか
+template <typename CharT>
+inline HAMON_CXX11_CONSTEXPR bool
+is_format_integer_type(CharT c) HAMON_NOEXCEPT
+{
+	return
+		c == CharT('b') || c == CharT('B') ||
+		c == CharT('d') || c == CharT('o') ||
+		c == CharT('x') || c == CharT('X');
+}
+
+// sign, '#', '0' は整数の表示形式でしか使えない
+template <typename CharT>
+inline HAMON_CXX14_CONSTEXPR void
+check_format_spec_only_for_integer(std_format_spec<CharT> const& spec)
+{
+	if (spec.m_sign != format_sign::none || spec.m_alternate || spec.m_zero_padding)
+	{
+		hamon::detail::throw_format_error("sign, '#' and '0' are not allowed for this presentation type");
+	}
+}
+
+// 28.5.6.4 Formatter specializations[format.formatter.spec]
+// formatter<charT, charT> と formatter<char, wchar_t> の実装
+template <typename CharT>
+struct formatter_char
+{
+private:
+	std_format_spec<CharT> m_spec;
+
+public:
+	HAMON_CXX14_CONSTEXPR typename hamon::basic_format_parse_context<CharT>::iterator
+	parse(hamon::basic_format_parse_context<CharT>& pc)
+	{
+		auto it = detail::parse_std_format_spec(pc, m_spec,
+			format_spec_fields::all & ~format_spec_fields::precision);
+		it = detail::check_format_spec_end(it, pc.end());
+
+		CharT const t = m_spec.m_type;
+		if (t == CharT() || t == CharT('c') || t == CharT('?'))
+		{
+			detail::check_format_spec_only_for_integer(m_spec);
+		}
+		else if (!detail::is_format_integer_type(t))
+		{
+			hamon::detail::throw_format_error("invalid presentation type for char");
+		}
+
+		return it;
+	}
+
+	template <typename FormatContext>
+	typename FormatContext::iterator
+	format(CharT c, FormatContext& ctx) const
+	{
+		using U = hamon::make_unsigned_t<CharT>;
+		auto const spec = detail::resolve_std_format_spec(m_spec, ctx);
+
+		if (detail::is_format_integer_type(spec.m_type))
+		{
+			return detail::format_write_integer(ctx.out(), static_cast<U>(c), spec);
+		}
+
+		if (spec.m_type == CharT('?'))
+		{
+			if (spec.m_width == 0)
+			{
+				return detail::format_write_escaped(ctx.out(), &c, &c + 1, CharT('\''));
+			}
+
+			auto const padding = detail::format_compute_padding(spec,
+				detail::format_escaped_width(&c, &c + 1, CharT('\'')), format_align::left);
+			auto out = detail::format_write_padding(ctx.out(), spec, padding.m_before);
+			out = detail::format_write_escaped(out, &c, &c + 1, CharT('\''));
+			return detail::format_write_padding(out, spec, padding.m_after);
+		}
+
+		auto out = ctx.out();
+		if (spec.m_width <= 1)
+		{
+			*out = c;
+			++out;
+			return out;
+		}
+
+		hamon::size_t const width =
+			detail::is_format_wide_code_point(static_cast<hamon::uint32_t>(static_cast<U>(c))) ? 2 : 1;
+		return detail::format_write_padded(out, spec, &c, 1, width, format_align::left);
+	}
+
+	HAMON_CXX14_CONSTEXPR void set_debug_format() HAMON_NOEXCEPT
+	{
+		m_spec.m_type = CharT('?');
+	}
+};
+
+}	// namespace detail
+}	// namespace hamon
+
+#endif // HAMON_FORMAT_DETAIL_FORMATTER_CHAR_HPP
@@ -0,0 +1,61 @@
+﻿/**
+ *	@file	formatter_floating.hpp
+ *
+ *	@brief	formatter_floating の定義
+ */
+
+#ifndef HAMON_FORMAT_DETAIL_FORMATTER_FLOATING_HPP
+#define HAMON_FORMAT_DETAIL_FORMATTER_FLOATING_HPP
+
+#include <hamon/format/basic_format_parse_context.hpp>
+#include <hamon/format/format_error.hpp>
+#include <hamon/format/detail/std_format_spec.hpp>
+#include <hamon/format/detail/format_floating.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon {
+namespace detail {
+
+// 28.5.6.4 Formatter specializations[format.formatter.spec]
+// 浮動小数点数型の formatter の実装
+template <typename T, typename CharT>
+struct formatter_floating
+{
+private:
+	std_format_spec<CharT> m_spec;
+
+public:
+	HAMON_CXX14_CONSTEXPR typename hamon::basic_format_parse_context<CharT>::iterator
+	parse(hamon::basic_format_parse_context<CharT>& pc)
+	{
+		auto it = detail::parse_std_format_spec(pc, m_spec);
+		it = detail::check_format_spec_end(it, pc.end());
+
+		switch (static_cast<char>(m_spec.m_type))
+		{
+		case 0:
+		case 'a': case 'A':
+		case 'e': case 'E':
+		case 'f': case 'F':
+		case 'g': case 'G':
+			break;
+		default:
+			hamon::detail::throw_format_error("invalid presentation type for floating-point");
+		}
+
+		return it;
+	}
+
+	template <typename FormatContext>
+	typename FormatContext::iterator
+	format(T value, FormatContext& ctx) const
+	{
+		// 'L' を指定しても C ロケールと同じ表記にする
+		return detail::format_write_floating(ctx.out(), value, detail::resolve_std_format_spec(m_spec, ctx));
+	}
+};
+
+}	// namespace detail
+}	// namespace hamon
+
+#endif // HAMON_FORMAT_DETAIL_FORMATTER_FLOATING_HPP
@@ -0,0 +1,111 @@
+﻿/**
+ *	@file	formatter_integer.hpp
+ *
+ *	@brief	formatter_integer の定義
+ */
+
+#ifndef HAMON_FORMAT_DETAIL_FORMATTER_INTEGER_HPP
+#define HAMON_FORMAT_DETAIL_FORMATTER_INTEGER_HPP
+
+#include <hamon/format/basic_format_parse_context.hpp>
+#include <hamon/format/format_error.hpp>
+#include <hamon/format/detail/formatter_char.hpp>
+#include <hamon/format/detail/std_format_spec.hpp>
+#include <hamon/format/detail/format_integer.hpp>
+#include <hamon/format/detail/format_padding.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon {
+namespace detail {
+
+// 28.5.6.4 Formatter specializations[format.formatter.spec]
+// 整数型の formatter の実装
+template <typename T, typename CharT>
+struct formatter_integer
+{
+private:
+	std_format_spec<CharT> m_spec;
+
+public:
+	HAMON_CXX14_CONSTEXPR typename hamon::basic_format_parse_context<CharT>::iterator
+	parse(hamon::basic_format_parse_context<CharT>& pc)
+	{
+		auto it = detail::parse_std_format_spec(pc, m_spec,
+			format_spec_fields::all & ~format_spec_fields::precision);
+		it = detail::check_format_spec_end(it, pc.end());
+
+		CharT const t = m_spec.m_type;
+		if (t == CharT('c'))
+		{
+			detail::check_format_spec_only_for_integer(m_spec);
+		}
+		else if (t != CharT() && !detail::is_format_integer_type(t))
+		{
+			hamon::detail::throw_format_error("invalid presentation type for integer");
+		}
+
+		return it;
+	}
+
+	template <typename FormatContext>
+	typename FormatContext::iterator
+	format(T value, FormatContext& ctx) const
+	{
+		if (!m_spec.m_width_is_arg)
+		{
+			return detail::format_write_integer(ctx.out(), value, m_spec);
+		}
+		return detail::format_write_integer(ctx.out(), value, detail::resolve_std_format_spec(m_spec, ctx));
+	}
+};
+
+// bool の formatter の実装
+template <typename CharT>
+struct formatter_bool
+{
+private:
+	std_format_spec<CharT> m_spec;
+
+public:
+	HAMON_CXX14_CONSTEXPR typename hamon::basic_format_parse_context<CharT>::iterator
+	parse(hamon::basic_format_parse_context<CharT>& pc)
+	{
+		auto it = detail::parse_std_format_spec(pc, m_spec,
+			format_spec_fields::all & ~format_spec_fields::precision);
+		it = detail::check_format_spec_end(it, pc.end());
+
+		CharT const t = m_spec.m_type;
+		if (t == CharT() || t == CharT('s'))
+		{
+			detail::check_format_spec_only_for_integer(m_spec);
+		}
+		else if (!detail::is_format_integer_type(t))
+		{
+			hamon::detail::throw_format_error("invalid presentation type for bool");
+		}
+
+		return it;
+	}
+
+	template <typename FormatContext>
+	typename FormatContext::iterator
+	format(bool value, FormatContext& ctx) const
+	{
+		auto const spec = detail::resolve_std_format_spec(m_spec, ctx);
+
+		if (detail::is_format_integer_type(spec.m_type))
+		{
+			return detail::format_write_integer(ctx.out(), static_cast<unsigned char>(value), spec);
+		}
+
+		// 'L' を指定しても C ロケールと同じ表記にする
+		return value ?
+			detail::format_write_padded_narrow(ctx.out(), spec, "true", 4, format_align::left) :
+			detail::format_write_padded_narrow(ctx.out(), spec, "false", 5, format_align::left);
+	}
+};
+
+}	// namespace detail
+}	// namespace hamon
+
+#endif // HAMON_FORMAT_DETAIL_FORMATTER_INTEGER_HPP
@@ -0,0 +1,63 @@
+﻿/**
+ *	@file	formatter_pointer.hpp
+ *
+ *	@brief	formatter_pointer の定義
+ */
+
+#ifndef HAMON_FORMAT_DETAIL_FORMATTER_POINTER_HPP
+#define HAMON_FORMAT_DETAIL_FORMATTER_POINTER_HPP
+
+#include <hamon/format/basic_format_parse_context.hpp>
+#include <hamon/format/format_error.hpp>
+#include <hamon/format/detail/std_format_spec.hpp>
+#include <hamon/format/detail/format_integer.hpp>
+#include <hamon/cstdint/uintptr_t.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon {
+namespace detail {
+
+// 28.5.6.4 Formatter specializations[format.formatter.spec]
+// nullptr_t, void*, const void* の formatter の実装
+template <typename CharT>
+struct formatter_pointer
+{
+private:
+	std_format_spec<CharT> m_spec;
+
+public:
+	HAMON_CXX14_CONSTEXPR typename hamon::basic_format_parse_context<CharT>::iterator
+	parse(hamon::basic_format_parse_context<CharT>& pc)
+	{
+		auto it = detail::parse_std_format_spec(pc, m_spec,
+			format_spec_fields::fill_align |
+			format_spec_fields::zero |
+			format_spec_fields::width |
+			format_spec_fields::type);
+		it = detail::check_format_spec_end(it, pc.end());
+
+		CharT const t = m_spec.m_type;
+		if (t != CharT() && t != CharT('p') && t != CharT('P'))
+		{
+			hamon::detail::throw_format_error("invalid presentation type for pointer");
+		}
+
+		return it;
+	}
+
+	template <typename FormatContext>
+	typename FormatContext::iterator
+	format(void const* p, FormatContext& ctx) const
+	{
+		// "0x" を付けた16進数として書き込む
+		auto spec = detail::resolve_std_format_spec(m_spec, ctx);
+		spec.m_alternate = true;
+		spec.m_type = spec.m_type == CharT('P') ? CharT('X') : CharT('x');
+		return detail::format_write_integer(ctx.out(), reinterpret_cast<hamon::uintptr_t>(p), spec);
+	}
+};
+
+}	// namespace detail
+}	// namespace hamon
+
+#endif // HAMON_FORMAT_DETAIL_FORMATTER_POINTER_HPP
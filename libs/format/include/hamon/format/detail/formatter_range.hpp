@@ -0,0 +1,223 @@
+﻿/**
+ *	@file	formatter_range.hpp
+ *
+ *	@brief	範囲の formatter の定義
+ */
+
+#ifndef HAMON_FORMAT_DETAIL_FORMATTER_RANGE_HPP
+#define HAMON_FORMAT_DETAIL_FORMATTER_RANGE_HPP
+
+#include <hamon/format/config.hpp>
+
+#if !defined(HAMON_USE_STD_FORMAT)
+
+#include <hamon/format/basic_format_parse_context.hpp>
+#include <hamon/format/format_kind.hpp>
+#include <hamon/format/formattable.hpp>
+#include <hamon/format/formatter.hpp>
+#include <hamon/format/range_format.hpp>
+#include <hamon/format/range_formatter.hpp>
+#include <hamon/format/detail/format_range_to_string_view.hpp>
+#include <hamon/format/detail/is_string_like.hpp>
+#include <hamon/detail/statically_widen.hpp>
+#include <hamon/ranges/concepts/input_range.hpp>
+#include <hamon/ranges/range_reference_t.hpp>
+#include <hamon/string/basic_string.hpp>
+#include <hamon/string_view/basic_string_view.hpp>
+#include <hamon/type_traits/bool_constant.hpp>
+#include <hamon/type_traits/conditional.hpp>
+#include <hamon/type_traits/conjunction.hpp>
+#include <hamon/type_traits/enable_if.hpp>
+#include <hamon/type_traits/integral_constant.hpp>
+#include <hamon/type_traits/is_same.hpp>
+#include <hamon/type_traits/remove_cvref.hpp>
+#include <hamon/type_traits/remove_extent.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+namespace detail
+{
+
+// 28.5.7.3 Class template range-default-formatter[format.range.fmtdef]
+
+// const-formattable-range
+template <typename R, typename CharT, bool = hamon::ranges::input_range_t<R const>::value>
+struct const_formattable_range
+	: public hamon::false_type {};
+
+template <typename R, typename CharT>
+struct const_formattable_range<R, CharT, true>
+	: public hamon::formattable_t<hamon::ranges::range_reference_t<R const>, CharT> {};
+
+// fmt-maybe-const
+template <typename R, typename CharT>
+using fmt_maybe_const =
+	hamon::conditional_t<const_formattable_range<R, CharT>::value, R const, R>;
+
+template <hamon::range_format K, typename R, typename CharT>
+struct range_default_formatter;
+
+template <typename R, typename CharT>
+struct range_default_formatter<hamon::range_format::sequence, R, CharT>
+{
+private:
+	using maybe_const_r = fmt_maybe_const<R, CharT>;
+
+	hamon::range_formatter<hamon::remove_cvref_t<hamon::ranges::range_reference_t<maybe_const_r>>, CharT> m_underlying;
+
+public:
+	HAMON_CXX14_CONSTEXPR void
+	set_separator(hamon::basic_string_view<CharT> sep) HAMON_NOEXCEPT
+	{
+		m_underlying.set_separator(sep);
+	}
+
+	HAMON_CXX14_CONSTEXPR void
+	set_brackets(hamon::basic_string_view<CharT> opening, hamon::basic_string_view<CharT> closing) HAMON_NOEXCEPT
+	{
+		m_underlying.set_brackets(opening, closing);
+	}
+
+	HAMON_CXX14_CONSTEXPR typename hamon::basic_format_parse_context<CharT>::iterator
+	parse(hamon::basic_format_parse_context<CharT>& pc)
+	{
+		return m_underlying.parse(pc);
+	}
+
+	template <typename FormatContext>
+	typename FormatContext::iterator
+	format(maybe_const_r& r, FormatContext& ctx) const
+	{
+		return m_underlying.format(r, ctx);
+	}
+};
+
+// 28.5.7.4 Specialization of range-default-formatter for maps[format.range.fmtmap]
+template <typename R, typename CharT>
+struct range_default_formatter<hamon::range_format::map, R, CharT>
+{
+private:
+	using maybe_const_map = fmt_maybe_const<R, CharT>;
+	using element_type = hamon::remove_cvref_t<hamon::ranges::range_reference_t<maybe_const_map>>;
+
+	hamon::range_formatter<element_type, CharT> m_underlying;
+
+public:
+	HAMON_CXX14_CONSTEXPR range_default_formatter()
+	{
+		m_underlying.set_brackets(
+			HAMON_STATICALLY_WIDEN(CharT, "{"),
+			HAMON_STATICALLY_WIDEN(CharT, "}"));
+		m_underlying.underlying().set_brackets({}, {});
+		m_underlying.underlying().set_separator(HAMON_STATICALLY_WIDEN(CharT, ": "));
+	}
+
+	HAMON_CXX14_CONSTEXPR typename hamon::basic_format_parse_context<CharT>::iterator
+	parse(hamon::basic_format_parse_context<CharT>& pc)
+	{
+		return m_underlying.parse(pc);
+	}
+
+	template <typename FormatContext>
+	typename FormatContext::iterator
+	format(maybe_const_map& r, FormatContext& ctx) const
+	{
+		return m_underlying.format(r, ctx);
+	}
+};
+
+// 28.5.7.5 Specialization of range-default-formatter for sets[format.range.fmtset]
+template <typename R, typename CharT>
+struct range_default_formatter<hamon::range_format::set, R, CharT>
+{
+private:
+	using maybe_const_set = fmt_maybe_const<R, CharT>;
+
+	hamon::range_formatter<hamon::remove_cvref_t<hamon::ranges::range_reference_t<maybe_const_set>>, CharT> m_underlying;
+
+public:
+	HAMON_CXX14_CONSTEXPR range_default_formatter()
+	{
+		m_underlying.set_brackets(
+			HAMON_STATICALLY_WIDEN(CharT, "{"),
+			HAMON_STATICALLY_WIDEN(CharT, "}"));
+	}
+
+	HAMON_CXX14_CONSTEXPR typename hamon::basic_format_parse_context<CharT>::iterator
+	parse(hamon::basic_format_parse_context<CharT>& pc)
+	{
+		return m_underlying.parse(pc);
+	}
+
+	template <typename FormatContext>
+	typename FormatContext::iterator
+	format(maybe_const_set& r, FormatContext& ctx) const
+	{
+		return m_underlying.format(r, ctx);
+	}
+};
+
+// 28.5.7.6 Specialization of range-default-formatter for strings[format.range.fmtstr]
+template <hamon::range_format K, typename R, typename CharT>
+struct range_default_string_formatter
+{
+private:
+	hamon::formatter<hamon::basic_string_view<CharT>, CharT> m_underlying;
+
+public:
+	HAMON_CXX14_CONSTEXPR typename hamon::basic_format_parse_context<CharT>::iterator
+	parse(hamon::basic_format_parse_context<CharT>& pc)
+	{
+		auto it = m_underlying.parse(pc);
+		if (K == hamon::range_format::debug_string)
+		{
+			m_underlying.set_debug_format();
+		}
+		return it;
+	}
+
+	template <typename FormatContext>
+	typename FormatContext::iterator
+	format(fmt_maybe_const<R, CharT>& r, FormatContext& ctx) const
+	{
+		// 連続した文字の範囲ならコピーしない
+		hamon::basic_string<CharT> str;
+		return m_underlying.format(detail::format_range_to_string_view(r, str), ctx);
+	}
+};
+
+template <typename R, typename CharT>
+struct range_default_formatter<hamon::range_format::string, R, CharT>
+	: public range_default_string_formatter<hamon::range_format::string, R, CharT> {};
+
+template <typename R, typename CharT>
+struct range_default_formatter<hamon::range_format::debug_string, R, CharT>
+	: public range_default_string_formatter<hamon::range_format::debug_string, R, CharT> {};
+
+// format_kind<R> が disabled でなく、要素が書式化できる範囲かどうか
+// 文字列と文字の配列は formatter.hpp で特殊化しているので除く
+template <typename R, typename CharT,
+	bool = HAMON_FORMAT_KIND(R) != hamon::range_format::disabled &&
+		!detail::is_string_like<R, CharT>::value &&
+		!hamon::is_same<hamon::remove_extent_t<R>, CharT>::value>
+struct is_range_default_formattable
+	: public hamon::false_type {};
+
+template <typename R, typename CharT>
+struct is_range_default_formattable<R, CharT, true>
+	: public hamon::formattable_t<hamon::ranges::range_reference_t<R>, CharT> {};
+
+}	// namespace detail
+
+// 28.5.7.3 Class template range-default-formatter[format.range.fmtdef]
+template <typename R, typename CharT>
+struct formatter<R, CharT, hamon::enable_if_t<detail::is_range_default_formattable<R, CharT>::value>>
+	: public detail::range_default_formatter<HAMON_FORMAT_KIND(R), R, CharT> {};
+
+}	// namespace hamon
+
+#endif
+
+#endif // HAMON_FORMAT_DETAIL_FORMATTER_RANGE_HPP
@@ -0,0 +1,116 @@
+﻿/**
+ *	@file	formatter_string.hpp
+ *
+ *	@brief	formatter_string の定義
+ */
+
+#ifndef HAMON_FORMAT_DETAIL_FORMATTER_STRING_HPP
+#define HAMON_FORMAT_DETAIL_FORMATTER_STRING_HPP
+
+#include <hamon/format/basic_format_parse_context.hpp>
+#include <hamon/format/format_error.hpp>
+#include <hamon/format/detail/std_format_spec.hpp>
+#include <hamon/format/detail/format_escape.hpp>
+#include <hamon/format/detail/format_padding.hpp>
+#include <hamon/format/detail/format_width.hpp>
+#include <hamon/format/detail/format_write.hpp>
+#include <hamon/string/basic_string.hpp>
+#include <hamon/string_view/basic_string_view.hpp>
+#include <hamon/iterator/back_inserter.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon {
+namespace detail {
+
+// 28.5.6.4 Formatter specializations[format.formatter.spec]
+// 文字列の formatter の実装
+template <typename CharT>
+struct formatter_string
+{
+private:
+	std_format_spec<CharT> m_spec;
+
+	template <typename Out>
+	Out write(Out out, CharT const* s, hamon::size_t n, std_format_spec<CharT> const& spec) const
+	{
+		if (spec.m_width == 0 && !spec.m_has_precision)
+		{
+			return detail::format_write(out, s, n);
+		}
+
+		hamon::size_t width = 0;
+		if (spec.m_has_precision)
+		{
+			n = detail::format_truncate_to_width(s, s + n, spec.m_precision, width);
+		}
+		else
+		{
+			width = detail::format_estimate_width(s, s + n);
+		}
+		return detail::format_write_padded(out, spec, s, n, width, format_align::left);
+	}
+
+public:
+	HAMON_CXX14_CONSTEXPR typename hamon::basic_format_parse_context<CharT>::iterator
+	parse(hamon::basic_format_parse_context<CharT>& pc)
+	{
+		auto it = detail::parse_std_format_spec(pc, m_spec,
+			format_spec_fields::fill_align |
+			format_spec_fields::width |
+			format_spec_fields::precision |
+			format_spec_fields::type);
+		it = detail::check_format_spec_end(it, pc.end());
+
+		CharT const t = m_spec.m_type;
+		if (t != CharT() && t != CharT('s') && t != CharT('?'))
+		{
+			hamon::detail::throw_format_error("invalid presentation type for string");
+		}
+
+		return it;
+	}
+
+	template <typename FormatContext>
+	typename FormatContext::iterator
+	format(hamon::basic_string_view<CharT> str, FormatContext& ctx) const
+	{
+		auto const spec = detail::resolve_std_format_spec(m_spec, ctx);
+
+		if (spec.m_type != CharT('?'))
+		{
+			return this->write(ctx.out(), str.data(), str.size(), spec);
+		}
+
+		CharT const* first = str.data();
+		CharT const* last  = first + str.size();
+		if (spec.m_width == 0 && !spec.m_has_precision)
+		{
+			return detail::format_write_escaped(ctx.out(), first, last, CharT('"'));
+		}
+
+		if (!spec.m_has_precision)
+		{
+			auto const padding = detail::format_compute_padding(spec,
+				detail::format_escaped_width(first, last, CharT('"')), format_align::left);
+			auto out = detail::format_write_padding(ctx.out(), spec, padding.m_before);
+			out = detail::format_write_escaped(out, first, last, CharT('"'));
+			return detail::format_write_padding(out, spec, padding.m_after);
+		}
+
+		// 精度はエスケープした後の文字列に適用するので、一旦文字列にする
+		hamon::basic_string<CharT> escaped;
+		detail::format_write_escaped(hamon::back_inserter(escaped), first, last, CharT('"'));
+		return this->write(ctx.out(), escaped.data(), escaped.size(), spec);
+	}
+
+	HAMON_CXX14_CONSTEXPR void set_debug_format() HAMON_NOEXCEPT
+	{
+		m_spec.m_type = CharT('?');
+	}
+};
+
+}	// namespace detail
+}	// namespace hamon
+
+#endif // HAMON_FORMAT_DETAIL_FORMATTER_STRING_HPP
@@ -0,0 +1,202 @@
+﻿/**
+ *	@file	formatter_tuple.hpp
+ *
+ *	@brief	pair と tuple の formatter の定義
+ */
+
+#ifndef HAMON_FORMAT_DETAIL_FORMATTER_TUPLE_HPP
+#define HAMON_FORMAT_DETAIL_FORMATTER_TUPLE_HPP
+
+#include <hamon/format/config.hpp>
+
+#if !defined(HAMON_USE_STD_FORMAT)
+
+#include <hamon/format/basic_format_context.hpp>
+#include <hamon/format/basic_format_parse_context.hpp>
+#include <hamon/format/format_error.hpp>
+#include <hamon/format/formattable.hpp>
+#include <hamon/format/formatter.hpp>
+#include <hamon/format/detail/format_buffer.hpp>
+#include <hamon/format/detail/format_debug_format.hpp>
+#include <hamon/format/detail/format_padding.hpp>
+#include <hamon/format/detail/format_write.hpp>
+#include <hamon/format/detail/format_write_padded_by.hpp>
+#include <hamon/format/detail/std_format_spec.hpp>
+#include <hamon/detail/statically_widen.hpp>
+#include <hamon/pair/pair.hpp>
+#include <hamon/string_view/basic_string_view.hpp>
+#include <hamon/tuple/adl_get.hpp>
+#include <hamon/tuple/get.hpp>
+#include <hamon/tuple/tuple.hpp>
+#include <hamon/type_traits/conjunction.hpp>
+#include <hamon/type_traits/enable_if.hpp>
+#include <hamon/type_traits/remove_cvref.hpp>
+#include <hamon/utility/index_sequence.hpp>
+#include <hamon/utility/make_index_sequence.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/config.hpp>
+#include <tuple>
+#include <utility>
+
+namespace hamon
+{
+
+namespace detail
+{
+
+// 28.5.9 Formatting tuples[format.tuple]
+template <typename CharT, typename... Ts>
+class formatter_tuple
+{
+private:
+	hamon::tuple<hamon::formatter<hamon::remove_cvref_t<Ts>, CharT>...> m_underlying;
+	hamon::basic_string_view<CharT> m_separator       = HAMON_STATICALLY_WIDEN(CharT, ", ");
+	hamon::basic_string_view<CharT> m_opening_bracket = HAMON_STATICALLY_WIDEN(CharT, "(");
+	hamon::basic_string_view<CharT> m_closing_bracket = HAMON_STATICALLY_WIDEN(CharT, ")");
+	detail::std_format_spec<CharT>  m_spec;
+
+	using index_sequence = hamon::make_index_sequence<sizeof...(Ts)>;
+
+	template <hamon::size_t I>
+	HAMON_CXX14_CONSTEXPR int
+	parse_one(hamon::basic_format_parse_context<CharT>& pc)
+	{
+		auto& f = hamon::get<I>(m_underlying);
+		pc.advance_to(f.parse(pc));
+		detail::format_maybe_set_debug_format(f);
+		return 0;
+	}
+
+	template <hamon::size_t... Is>
+	HAMON_CXX14_CONSTEXPR void
+	parse_each(hamon::basic_format_parse_context<CharT>& pc, hamon::index_sequence<Is...>)
+	{
+		int const dummy[] = {0, this->parse_one<Is>(pc)...};
+		(void)dummy;
+	}
+
+	template <hamon::size_t I, typename Tuple, typename FormatContext>
+	typename FormatContext::iterator
+	format_one(Tuple const& t, FormatContext& ctx, typename FormatContext::iterator out) const
+	{
+		if (I != 0)
+		{
+			out = detail::format_write(out, m_separator.data(), m_separator.size());
+		}
+		ctx.advance_to(out);
+		return hamon::get<I>(m_underlying).format(hamon::adl_get<I>(t), ctx);
+	}
+
+	template <typename Tuple, typename FormatContext, hamon::size_t... Is>
+	typename FormatContext::iterator
+	format_elements(Tuple const& t, FormatContext& ctx, hamon::index_sequence<Is...>) const
+	{
+		auto out = detail::format_write(ctx.out(), m_opening_bracket.data(), m_opening_bracket.size());
+		int const dummy[] = {0, ((out = this->format_one<Is>(t, ctx, out)), 0)...};
+		(void)dummy;
+		return detail::format_write(out, m_closing_bracket.data(), m_closing_bracket.size());
+	}
+
+public:
+	HAMON_CXX14_CONSTEXPR void
+	set_separator(hamon::basic_string_view<CharT> sep) HAMON_NOEXCEPT
+	{
+		m_separator = sep;
+	}
+
+	HAMON_CXX14_CONSTEXPR void
+	set_brackets(hamon::basic_string_view<CharT> opening, hamon::basic_string_view<CharT> closing) HAMON_NOEXCEPT
+	{
+		m_opening_bracket = opening;
+		m_closing_bracket = closing;
+	}
+
+	HAMON_CXX14_CONSTEXPR typename hamon::basic_format_parse_context<CharT>::iterator
+	parse(hamon::basic_format_parse_context<CharT>& pc)
+	{
+		// tuple-fill-and-align width tuple-type
+		auto first = detail::parse_std_format_spec(pc, m_spec,
+			detail::format_spec_fields::fill_align |
+			detail::format_spec_fields::width);
+		auto const last = pc.end();
+
+		if (first != last && *first == CharT('m'))
+		{
+			if (sizeof...(Ts) != 2)
+			{
+				hamon::detail::throw_format_error("'m' is only valid for pair or tuple of two elements");
+			}
+			m_separator = HAMON_STATICALLY_WIDEN(CharT, ": ");
+			m_opening_bracket = {};
+			m_closing_bracket = {};
+			++first;
+		}
+		else if (first != last && *first == CharT('n'))
+		{
+			m_opening_bracket = {};
+			m_closing_bracket = {};
+			++first;
+		}
+
+		first = detail::check_format_spec_end(first, last);
+
+		// 各要素の formatter には空の format-spec を渡す
+		pc.advance_to(first);
+		this->parse_each(pc, index_sequence{});
+		return first;
+	}
+
+	template <typename Tuple, typename FormatContext>
+	typename FormatContext::iterator
+	format(Tuple const& t, FormatContext& ctx) const
+	{
+		auto const spec = detail::resolve_std_format_spec(m_spec, ctx);
+		if (spec.m_width == 0)
+		{
+			return this->format_elements(t, ctx, index_sequence{});
+		}
+
+		// 表示幅は文字列を作らずに数える
+		using iterator = typename FormatContext::iterator;
+		return detail::format_write_padded_by(ctx.out(), spec, detail::format_align::left, true,
+			[&](iterator out)
+			{
+				detail::format_context_storage<iterator, CharT> storage(out, ctx);
+				return this->format_elements(t, storage.m_context, index_sequence{});
+			});
+	}
+};
+
+template <typename CharT, typename... Ts>
+using enable_if_formattable_tuple_t =
+	hamon::enable_if_t<hamon::conjunction<hamon::formattable_t<Ts, CharT>...>::value>;
+
+}	// namespace detail
+
+// 28.5.9 Formatting tuples[format.tuple]
+
+template <typename CharT, typename T1, typename T2>
+struct formatter<hamon::pair<T1, T2>, CharT, detail::enable_if_formattable_tuple_t<CharT, T1, T2>>
+	: public detail::formatter_tuple<CharT, T1, T2> {};
+
+template <typename CharT, typename... Ts>
+struct formatter<hamon::tuple<Ts...>, CharT, detail::enable_if_formattable_tuple_t<CharT, Ts...>>
+	: public detail::formatter_tuple<CharT, Ts...> {};
+
+#if !defined(HAMON_USE_STD_PAIR)
+template <typename CharT, typename T1, typename T2>
+struct formatter<std::pair<T1, T2>, CharT, detail::enable_if_formattable_tuple_t<CharT, T1, T2>>
+	: public detail::formatter_tuple<CharT, T1, T2> {};
+#endif
+
+#if !defined(HAMON_USE_STD_TUPLE)
+template <typename CharT, typename... Ts>
+struct formatter<std::tuple<Ts...>, CharT, detail::enable_if_formattable_tuple_t<CharT, Ts...>>
+	: public detail::formatter_tuple<CharT, Ts...> {};
+#endif
+
+}	// namespace hamon
+
+#endif
+
+#endif // HAMON_FORMAT_DETAIL_FORMATTER_TUPLE_HPP
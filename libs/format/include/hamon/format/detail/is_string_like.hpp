@@ -0,0 +1,46 @@
+﻿/**
+ *	@file	is_string_like.hpp
+ *
+ *	@brief	is_string_like の定義
+ */
+
+#ifndef HAMON_FORMAT_DETAIL_IS_STRING_LIKE_HPP
+#define HAMON_FORMAT_DETAIL_IS_STRING_LIKE_HPP
+
+#include <hamon/type_traits/bool_constant.hpp>
+#include <hamon/type_traits/conjunction.hpp>
+#include <hamon/type_traits/is_convertible.hpp>
+#include <hamon/type_traits/is_same.hpp>
+#include <hamon/type_traits/void_t.hpp>
+#include <hamon/type_traits/integral_constant.hpp>
+#include <hamon/utility/declval.hpp>
+#include <hamon/cstddef/size_t.hpp>
+
+namespace hamon {
+namespace detail {
+
+// T が basic_string や basic_string_view のように、
+// traits_type を持ち、data() と size() で CharT の連続した文字列を取り出せる型かどうか。
+// hamon と std の両方の文字列型を同じように扱うために使う。
+template <typename T, typename CharT, typename = void>
+struct is_string_like
+	: public hamon::false_type {};
+
+template <typename T, typename CharT>
+struct is_string_like<T, CharT, hamon::void_t<
+	typename T::traits_type,
+	typename T::value_type,
+	decltype(hamon::declval<T const&>().data()),
+	decltype(hamon::declval<T const&>().size())>>
+	: public hamon::conjunction<
+		hamon::is_same<typename T::value_type, CharT>,
+		hamon::is_same<typename T::traits_type::char_type, CharT>,
+		hamon::is_convertible<decltype(hamon::declval<T const&>().data()), CharT const*>,
+		hamon::is_convertible<decltype(hamon::declval<T const&>().size()), hamon::size_t>
+	>
+{};
+
+}	// namespace detail
+}	// namespace hamon
+
+#endif // HAMON_FORMAT_DETAIL_IS_STRING_LIKE_HPP
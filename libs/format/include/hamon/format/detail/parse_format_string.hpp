@@ -0,0 +1,123 @@
+﻿/**
+ *	@file	parse_format_string.hpp
+ *
+ *	@brief	parse_format_string の定義
+ */
+
+#ifndef HAMON_FORMAT_DETAIL_PARSE_FORMAT_STRING_HPP
+#define HAMON_FORMAT_DETAIL_PARSE_FORMAT_STRING_HPP
+
+#include <hamon/format/basic_format_parse_context.hpp>
+#include <hamon/format/format_error.hpp>
+#include <hamon/format/detail/std_format_spec.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon {
+namespace detail {
+
+/**
+ *	@brief	書式文字列を先頭から1回だけ走査する
+ *
+ *	置換フィールド以外の文字列は handler.on_text(first, last) に渡す。
+ *	("{{" と "}}" は1文字にして渡す)
+ *	置換フィールドは arg-id を読んだ後、pc を format-spec の先頭に進めて handler.on_arg(id) を呼ぶ。
+ *	on_arg は formatter の parse で pc を '}' の位置まで進めること。
+ *
+ *	実行時の書式化と、C++20 でのコンパイル時の検査の両方で使う。
+ */
+template <typename CharT, typename Handler>
+inline HAMON_CXX14_CONSTEXPR void
+parse_format_string(hamon::basic_format_parse_context<CharT>& pc, Handler& handler)
+{
+	auto first = pc.begin();
+	auto const last = pc.end();
+	auto plain = first;
+
+	while (first != last)
+	{
+		CharT const c = *first;
+		if (c == CharT('{'))
+		{
+			handler.on_text(plain, first);
+			++first;
+			if (first == last)
+			{
+				hamon::detail::throw_format_error("unmatched '{' in format string");
+			}
+
+			if (*first == CharT('{'))
+			{
+				// "{{"
+				plain = first;
+				++first;
+				continue;
+			}
+
+			// arg-id
+			hamon::size_t id = 0;
+			if (*first == CharT('}') || *first == CharT(':'))
+			{
+				id = pc.next_arg_id();
+			}
+			else if (*first == CharT('0'))
+			{
+				++first;
+				pc.check_arg_id(id);
+			}
+			else if (is_format_digit(*first))
+			{
+				first = detail::parse_format_number(first, last, id);
+				pc.check_arg_id(id);
+			}
+			else
+			{
+				hamon::detail::throw_format_error("invalid arg-id in format string");
+			}
+
+			if (first != last && *first == CharT(':'))
+			{
+				++first;
+			}
+			else if (first == last || *first != CharT('}'))
+			{
+				hamon::detail::throw_format_error("invalid arg-id in format string");
+			}
+
+			pc.advance_to(first);
+			handler.on_arg(id);
+
+			first = pc.begin();
+			if (first == last || *first != CharT('}'))
+			{
+				hamon::detail::throw_format_error("missing '}' in format string");
+			}
+			++first;
+			plain = first;
+		}
+		else if (c == CharT('}'))
+		{
+			++first;
+			if (first == last || *first != CharT('}'))
+			{
+				hamon::detail::throw_format_error("unmatched '}' in format string");
+			}
+
+			// "}}" の1文字目までを渡す
+			handler.on_text(plain, first);
+			++first;
+			plain = first;
+		}
+		else
+		{
+			++first;
+		}
+	}
+
+	handler.on_text(plain, last);
+}
+
+}	// namespace detail
+}	// namespace hamon
+
+#endif // HAMON_FORMAT_DETAIL_PARSE_FORMAT_STRING_HPP
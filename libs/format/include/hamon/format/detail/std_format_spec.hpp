@@ -0,0 +1,394 @@
+﻿/**
+ *	@file	std_format_spec.hpp
+ *
+ *	@brief	std_format_spec の定義
+ */
+
+#ifndef HAMON_FORMAT_DETAIL_STD_FORMAT_SPEC_HPP
+#define HAMON_FORMAT_DETAIL_STD_FORMAT_SPEC_HPP
+
+#include <hamon/format/format_error.hpp>
+#include <hamon/format/visit_format_arg.hpp>
+#include <hamon/type_traits/enable_if.hpp>
+#include <hamon/type_traits/is_integral.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/cstdint/uint8_t.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon {
+namespace detail {
+
+// 28.5.2.2 Standard format specifiers[format.string.std]
+
+enum class format_align : hamon::uint8_t
+{
+	none,
+	left,
+	right,
+	center,
+};
+
+enum class format_sign : hamon::uint8_t
+{
+	none,
+	minus,
+	plus,
+	space,
+};
+
+// parse_std_format_spec で解析する部分
+struct format_spec_fields
+{
+	enum : unsigned
+	{
+		fill_align = 1 << 0,
+		sign       = 1 << 1,
+		alternate  = 1 << 2,
+		zero       = 1 << 3,
+		width      = 1 << 4,
+		precision  = 1 << 5,
+		locale     = 1 << 6,
+		type       = 1 << 7,
+
+		all = fill_align | sign | alternate | zero | width | precision | locale | type,
+	};
+};
+
+template <typename CharT>
+struct std_format_spec
+{
+	CharT          m_fill[4];			// 1文字分のコードユニット (UTF-8 なら最大4つ)
+	hamon::uint8_t m_fill_size;
+	format_align   m_align;
+	format_sign    m_sign;
+	bool           m_alternate;
+	bool           m_zero_padding;
+	bool           m_locale_specific;
+	bool           m_width_is_arg;		// m_width は引数の番号
+	bool           m_precision_is_arg;	// m_precision は引数の番号
+	bool           m_has_precision;
+	CharT          m_type;				// 指定されていなければ 0
+	hamon::size_t  m_width;				// 指定されていなければ 0
+	hamon::size_t  m_precision;
+
+	HAMON_CXX11_CONSTEXPR std_format_spec() HAMON_NOEXCEPT
+		: m_fill{CharT(' '), CharT(), CharT(), CharT()}
+		, m_fill_size(1)
+		, m_align(format_align::none)
+		, m_sign(format_sign::none)
+		, m_alternate(false)
+		, m_zero_padding(false)
+		, m_locale_specific(false)
+		, m_width_is_arg(false)
+		, m_precision_is_arg(false)
+		, m_has_precision(false)
+		, m_type(CharT())
+		, m_width(0)
+		, m_precision(0)
+	{}
+};
+
+// 先頭の1文字 (コードポイント) が何コードユニットか
+template <typename CharT, typename Iterator>
+inline HAMON_CXX14_CONSTEXPR hamon::size_t
+format_code_point_length(Iterator first, Iterator last) HAMON_NOEXCEPT
+{
+	hamon::size_t n = 1;
+	if (sizeof(CharT) == 1)
+	{
+		auto const c = static_cast<unsigned char>(*first);
+		n = c < 0x80 ? 1 :
+			(c & 0xE0) == 0xC0 ? 2 :
+			(c & 0xF0) == 0xE0 ? 3 :
+			(c & 0xF8) == 0xF0 ? 4 : 1;
+	}
+	else if (sizeof(CharT) == 2)
+	{
+		auto const c = static_cast<unsigned long>(*first);
+		n = (c & 0xFC00) == 0xD800 ? 2 : 1;
+	}
+
+	return static_cast<hamon::size_t>(last - first) < n ? 1 : n;
+}
+
+template <typename CharT>
+inline HAMON_CXX11_CONSTEXPR bool
+is_format_align_char(CharT c) HAMON_NOEXCEPT
+{
+	return c == '<' || c == '>' || c == '^';
+}
+
+template <typename CharT>
+inline HAMON_CXX11_CONSTEXPR bool
+is_format_digit(CharT c) HAMON_NOEXCEPT
+{
+	return '0' <= c && c <= '9';
+}
+
+// 10進数の非負整数を読む
+template <typename Iterator>
+inline HAMON_CXX14_CONSTEXPR Iterator
+parse_format_number(Iterator first, Iterator last, hamon::size_t& result)
+{
+	hamon::size_t value = 0;
+	for (; first != last && is_format_digit(*first); ++first)
+	{
+		value = value * 10 + static_cast<hamon::size_t>(*first - '0');
+		if (value > 0x7FFFFFFF)
+		{
+			hamon::detail::throw_format_error("number is too large in format string");
+		}
+	}
+	result = value;
+	return first;
+}
+
+// arg-id を読む。'{' の次から始まり、'}' を指すイテレータを返す。
+template <typename ParseContext, typename Iterator>
+inline HAMON_CXX14_CONSTEXPR Iterator
+parse_format_arg_id(ParseContext& pc, Iterator first, Iterator last, hamon::size_t& id)
+{
+	if (first == last)
+	{
+		hamon::detail::throw_format_error("unmatched '{' in format spec");
+	}
+
+	if (*first == '}')
+	{
+		id = pc.next_arg_id();
+		return first;
+	}
+
+	if (!is_format_digit(*first))
+	{
+		hamon::detail::throw_format_error("invalid arg-id in format string");
+	}
+
+	if (*first == '0')
+	{
+		// 先頭の 0 は "0" のときだけ
+		id = 0;
+		++first;
+	}
+	else
+	{
+		first = detail::parse_format_number(first, last, id);
+	}
+
+	if (first == last || *first != '}')
+	{
+		hamon::detail::throw_format_error("invalid arg-id in format string");
+	}
+
+	pc.check_arg_id(id);
+	return first;
+}
+
+// 幅や精度の {arg-id} を読む。'{' を指すイテレータを受け取り、'}' の次を返す。
+template <typename ParseContext, typename Iterator>
+inline HAMON_CXX14_CONSTEXPR Iterator
+parse_format_dynamic_spec(ParseContext& pc, Iterator first, Iterator last, hamon::size_t& id)
+{
+	first = detail::parse_format_arg_id(pc, first + 1, last, id);
+	pc.check_dynamic_spec_integral(id);
+	return first + 1;
+}
+
+/**
+ *	@brief	std-format-spec を読む
+ *
+ *	fields に含まれる部分だけを読み、読み終えた位置を返す。
+ *	残り ('}' かどうかや、chrono-specs など) は呼び出し側で調べる。
+ */
+template <typename ParseContext, typename CharT>
+inline HAMON_CXX14_CONSTEXPR typename ParseContext::iterator
+parse_std_format_spec(ParseContext& pc, std_format_spec<CharT>& spec, unsigned fields = format_spec_fields::all)
+{
+	auto first = pc.begin();
+	auto const last = pc.end();
+
+	if (first == last || *first == CharT('}'))
+	{
+		return first;
+	}
+
+	// fill-and-align
+	if (fields & format_spec_fields::fill_align)
+	{
+		hamon::size_t const n = detail::format_code_point_length<CharT>(first, last);
+		if (static_cast<hamon::size_t>(last - first) > n && is_format_align_char(first[n]))
+		{
+			if (*first == CharT('{') || *first == CharT('}'))
+			{
+				hamon::detail::throw_format_error("invalid fill character '{' or '}'");
+			}
+
+			for (hamon::size_t i = 0; i < n; ++i)
+			{
+				spec.m_fill[i] = first[i];
+			}
+			spec.m_fill_size = static_cast<hamon::uint8_t>(n);
+			first += n;
+		}
+
+		if (first != last && is_format_align_char(*first))
+		{
+			spec.m_align =
+				*first == CharT('<') ? format_align::left :
+				*first == CharT('>') ? format_align::right :
+				format_align::center;
+			++first;
+		}
+	}
+
+	// sign
+	if ((fields & format_spec_fields::sign) && first != last)
+	{
+		if (*first == CharT('+'))
+		{
+			spec.m_sign = format_sign::plus;
+			++first;
+		}
+		else if (*first == CharT('-'))
+		{
+			spec.m_sign = format_sign::minus;
+			++first;
+		}
+		else if (*first == CharT(' '))
+		{
+			spec.m_sign = format_sign::space;
+			++first;
+		}
+	}
+
+	// #
+	if ((fields & format_spec_fields::alternate) && first != last && *first == CharT('#'))
+	{
+		spec.m_alternate = true;
+		++first;
+	}
+
+	// 0
+	if ((fields & format_spec_fields::zero) && first != last && *first == CharT('0'))
+	{
+		spec.m_zero_padding = true;
+		++first;
+	}
+
+	// width
+	if ((fields & format_spec_fields::width) && first != last)
+	{
+		if (*first == CharT('0'))
+		{
+			hamon::detail::throw_format_error("width must not start with '0'");
+		}
+		else if (is_format_digit(*first))
+		{
+			first = detail::parse_format_number(first, last, spec.m_width);
+		}
+		else if (*first == CharT('{'))
+		{
+			first = detail::parse_format_dynamic_spec(pc, first, last, spec.m_width);
+			spec.m_width_is_arg = true;
+		}
+	}
+
+	// precision
+	if ((fields & format_spec_fields::precision) && first != last && *first == CharT('.'))
+	{
+		++first;
+		if (first != last && is_format_digit(*first))
+		{
+			first = detail::parse_format_number(first, last, spec.m_precision);
+		}
+		else if (first != last && *first == CharT('{'))
+		{
+			first = detail::parse_format_dynamic_spec(pc, first, last, spec.m_precision);
+			spec.m_precision_is_arg = true;
+		}
+		else
+		{
+			hamon::detail::throw_format_error("missing precision after '.' in format string");
+		}
+		spec.m_has_precision = true;
+	}
+
+	// L
+	if ((fields & format_spec_fields::locale) && first != last && *first == CharT('L'))
+	{
+		spec.m_locale_specific = true;
+		++first;
+	}
+
+	// type
+	if ((fields & format_spec_fields::type) && first != last &&
+		*first != CharT('}') && *first != CharT('{'))
+	{
+		spec.m_type = *first;
+		++first;
+	}
+
+	return first;
+}
+
+// 書式指定の最後 ('}' か文字列の終わり) かどうかを調べる
+template <typename Iterator>
+inline HAMON_CXX14_CONSTEXPR Iterator
+check_format_spec_end(Iterator first, Iterator last)
+{
+	if (first != last && *first != '}')
+	{
+		hamon::detail::throw_format_error("invalid format specifier");
+	}
+	return first;
+}
+
+// 動的な幅と精度の値を取り出す
+struct format_dynamic_spec_visitor
+{
+	template <typename T, typename = hamon::enable_if_t<hamon::is_integral<T>::value>>
+	hamon::size_t operator()(T value) const
+	{
+		if (value < T(0))
+		{
+			hamon::detail::throw_format_error("width and precision must be non-negative integers");
+		}
+		return static_cast<hamon::size_t>(value);
+	}
+
+	hamon::size_t operator()(bool) const
+	{
+		hamon::detail::throw_format_error("width and precision must be integers");
+	}
+
+	template <typename T, typename = hamon::enable_if_t<!hamon::is_integral<T>::value>>
+	hamon::size_t operator()(T const&) const
+	{
+		hamon::detail::throw_format_error("width and precision must be integers");
+	}
+};
+
+// 動的な幅と精度を引数の値で置き換える
+template <typename CharT, typename FormatContext>
+inline std_format_spec<CharT>
+resolve_std_format_spec(std_format_spec<CharT> spec, FormatContext& ctx)
+{
+	if (spec.m_width_is_arg)
+	{
+		spec.m_width = hamon::visit_format_arg(format_dynamic_spec_visitor{}, ctx.arg(spec.m_width));
+		spec.m_width_is_arg = false;
+	}
+
+	if (spec.m_precision_is_arg)
+	{
+		spec.m_precision = hamon::visit_format_arg(format_dynamic_spec_visitor{}, ctx.arg(spec.m_precision));
+		spec.m_precision_is_arg = false;
+	}
+
+	return spec;
+}
+
+}	// namespace detail
+}	// namespace hamon
+
+#endif // HAMON_FORMAT_DETAIL_STD_FORMAT_SPEC_HPP
@@ -0,0 +1,105 @@
+﻿/**
+ *	@file	vformat_to_impl.hpp
+ *
+ *	@brief	vformat_to_impl の定義
+ */
+
+#ifndef HAMON_FORMAT_DETAIL_VFORMAT_TO_IMPL_HPP
+#define HAMON_FORMAT_DETAIL_VFORMAT_TO_IMPL_HPP
+
+#include <hamon/format/basic_format_arg.hpp>
+#include <hamon/format/basic_format_args.hpp>
+#include <hamon/format/basic_format_context.hpp>
+#include <hamon/format/basic_format_parse_context.hpp>
+#include <hamon/format/format_error.hpp>
+#include <hamon/format/visit_format_arg.hpp>
+#include <hamon/format/detail/format_buffer.hpp>
+#include <hamon/format/detail/parse_format_string.hpp>
+#include <hamon/string_view/basic_string_view.hpp>
+#include <hamon/variant/monostate.hpp>
+#include <hamon/cstddef/size_t.hpp>
+
+namespace hamon {
+namespace detail {
+
+// 引数の型の formatter で、format-spec を読んでから書式化する
+template <typename Context>
+struct format_arg_formatter
+{
+	using char_type = typename Context::char_type;
+
+	hamon::basic_format_parse_context<char_type>& m_parse_ctx;
+	Context& m_ctx;
+
+	void operator()(hamon::monostate) const
+	{
+		hamon::detail::throw_format_error("argument index out of range");
+	}
+
+	void operator()(typename hamon::basic_format_arg<Context>::handle h) const
+	{
+		h.format(m_parse_ctx, m_ctx);
+	}
+
+	template <typename T>
+	void operator()(T value) const
+	{
+		typename Context::template formatter_type<T> f;
+		m_parse_ctx.advance_to(f.parse(m_parse_ctx));
+		m_ctx.advance_to(f.format(value, m_ctx));
+	}
+};
+
+template <typename Context>
+struct vformat_to_handler
+{
+	using char_type = typename Context::char_type;
+
+	hamon::basic_format_parse_context<char_type>& m_parse_ctx;
+	Context& m_ctx;
+	detail::format_buffer<char_type>& m_buffer;
+
+	void on_text(char_type const* first, char_type const* last)
+	{
+		if (first != last)
+		{
+			m_buffer.append(first, static_cast<hamon::size_t>(last - first));
+		}
+	}
+
+	void on_arg(hamon::size_t id)
+	{
+		hamon::visit_format_arg(
+			format_arg_formatter<Context>{m_parse_ctx, m_ctx}, m_ctx.arg(id));
+	}
+};
+
+/**
+ *	@brief	fmt と args を書式化して buf に書き込む
+ *
+ *	出力イテレータの型ごとに書式化の処理を実体化しないように、
+ *	常に format_buffer_iterator を出力先とする basic_format_context を使う。
+ *
+ *	fmt は呼び出しのたびに先頭から解析し、置換フィールドごとに引数の型の formatter を作って parse と format を行う。
+ *	basic_format_string がコンパイル時に検査した場合でも、その解析結果は使わない。
+ */
+template <typename CharT>
+inline void
+vformat_to_impl(
+	detail::format_buffer<CharT>& buf,
+	hamon::basic_string_view<CharT> fmt,
+	hamon::basic_format_args<hamon::basic_format_context<detail::format_buffer_iterator<CharT>, CharT>> args)
+{
+	using Context = hamon::basic_format_context<detail::format_buffer_iterator<CharT>, CharT>;
+
+	detail::format_context_storage<detail::format_buffer_iterator<CharT>, CharT> storage(
+		detail::format_buffer_iterator<CharT>(buf), args);
+	hamon::basic_format_parse_context<CharT> pc(fmt, args.size());
+	vformat_to_handler<Context> handler{pc, storage.m_context, buf};
+	detail::parse_format_string(pc, handler);
+}
+
+}	// namespace detail
+}	// namespace hamon
+
+#endif // HAMON_FORMAT_DETAIL_VFORMAT_TO_IMPL_HPP
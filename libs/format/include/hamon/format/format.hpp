@@ -0,0 +1,65 @@
+﻿/**
+ *	@file	format.hpp
+ *
+ *	@brief	format の定義
+ */
+
+#ifndef HAMON_FORMAT_FORMAT_HPP
+#define HAMON_FORMAT_FORMAT_HPP
+
+#include <hamon/format/config.hpp>
+
+#if defined(HAMON_USE_STD_FORMAT)
+
+namespace hamon
+{
+
+using std::format;
+
+}	// namespace hamon
+
+#else
+
+#include <hamon/format/format_args.hpp>
+#include <hamon/format/wformat_args.hpp>
+#include <hamon/format/format_string.hpp>
+#include <hamon/format/wformat_string.hpp>
+#include <hamon/format/make_format_args.hpp>
+#include <hamon/format/make_wformat_args.hpp>
+#include <hamon/format/detail/format_buffer.hpp>
+#include <hamon/format/detail/format_to_impl.hpp>
+#include <hamon/string/string.hpp>
+#include <hamon/string/wstring.hpp>
+
+namespace hamon
+{
+
+// 28.5.5 Formatting functions[format.functions]
+
+template <typename... Args>
+inline hamon::string
+format(hamon::format_string<Args...> fmt, Args&&... args)
+{
+	hamon::string result;
+	detail::string_format_buffer<hamon::string> buf(result);
+	detail::format_to_impl(buf, fmt, hamon::format_args(hamon::make_format_args(args...)));
+	buf.finish();
+	return result;
+}
+
+template <typename... Args>
+inline hamon::wstring
+format(hamon::wformat_string<Args...> fmt, Args&&... args)
+{
+	hamon::wstring result;
+	detail::string_format_buffer<hamon::wstring> buf(result);
+	detail::format_to_impl(buf, fmt, hamon::wformat_args(hamon::make_wformat_args(args...)));
+	buf.finish();
+	return result;
+}
+
+}	// namespace hamon
+
+#endif
+
+#endif // HAMON_FORMAT_FORMAT_HPP
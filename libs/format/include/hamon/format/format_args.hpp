@@ -0,0 +1,20 @@
+﻿/**
+ *	@file	format_args.hpp
+ *
+ *	@brief	format_args の定義
+ */
+
+#ifndef HAMON_FORMAT_FORMAT_ARGS_HPP
+#define HAMON_FORMAT_FORMAT_ARGS_HPP
+
+#include <hamon/format/basic_format_args.hpp>
+#include <hamon/format/format_context.hpp>
+
+namespace hamon
+{
+
+using format_args = hamon::basic_format_args<hamon::format_context>;
+
+}	// namespace hamon
+
+#endif // HAMON_FORMAT_FORMAT_ARGS_HPP
@@ -0,0 +1,35 @@
+﻿/**
+ *	@file	format_context.hpp
+ *
+ *	@brief	format_context の定義
+ */
+
+#ifndef HAMON_FORMAT_FORMAT_CONTEXT_HPP
+#define HAMON_FORMAT_FORMAT_CONTEXT_HPP
+
+#include <hamon/format/config.hpp>
+
+#if defined(HAMON_USE_STD_FORMAT)
+
+namespace hamon
+{
+
+using std::format_context;
+
+}	// namespace hamon
+
+#else
+
+#include <hamon/format/basic_format_context.hpp>
+#include <hamon/format/detail/format_buffer.hpp>
+
+namespace hamon
+{
+
+using format_context = hamon::basic_format_context<detail::format_buffer_iterator<char>, char>;
+
+}	// namespace hamon
+
+#endif
+
+#endif // HAMON_FORMAT_FORMAT_CONTEXT_HPP
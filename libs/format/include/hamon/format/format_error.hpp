@@ -0,0 +1,68 @@
+﻿/**
+ *	@file	format_error.hpp
+ *
+ *	@brief	format_error の定義
+ */
+
+#ifndef HAMON_FORMAT_FORMAT_ERROR_HPP
+#define HAMON_FORMAT_FORMAT_ERROR_HPP
+
+#include <hamon/format/config.hpp>
+
+#if defined(HAMON_USE_STD_FORMAT)
+
+namespace hamon
+{
+
+using std::format_error;
+
+}	// namespace hamon
+
+#else
+
+#include <hamon/cstdlib/abort.hpp>
+#include <hamon/stdexcept/runtime_error.hpp>
+#include <hamon/config.hpp>
+#include <string>
+
+namespace hamon
+{
+
+// 28.5.10 Class format_error[format.error]
+
+class format_error : public hamon::runtime_error
+{
+public:
+	explicit format_error(std::string const& what_arg)
+		: hamon::runtime_error(what_arg) {}
+
+	explicit format_error(char const* what_arg)
+		: hamon::runtime_error(what_arg) {}
+};
+
+}	// namespace hamon
+
+#endif
+
+namespace hamon
+{
+
+namespace detail
+{
+
+HAMON_NORETURN inline void
+throw_format_error(char const* msg)
+{
+#if !defined(HAMON_NO_EXCEPTIONS)
+	throw hamon::format_error(msg);
+#else
+	(void)msg;
+	hamon::abort();
+#endif
+}
+
+}	// namespace detail
+
+}	// namespace hamon
+
+#endif // HAMON_FORMAT_FORMAT_ERROR_HPP
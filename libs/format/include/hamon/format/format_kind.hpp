@@ -0,0 +1,118 @@
+﻿/**
+ *	@file	format_kind.hpp
+ *
+ *	@brief	format_kind の定義
+ */
+
+#ifndef HAMON_FORMAT_FORMAT_KIND_HPP
+#define HAMON_FORMAT_FORMAT_KIND_HPP
+
+#include <hamon/format/config.hpp>
+#include <hamon/format/range_format.hpp>
+
+#if defined(HAMON_USE_STD_FORMAT)
+
+namespace hamon
+{
+
+using std::format_kind;
+
+}	// namespace hamon
+
+#else
+
+#include <hamon/ranges/concepts/input_range.hpp>
+#include <hamon/ranges/range_reference_t.hpp>
+#include <hamon/tuple/concepts/pair_like.hpp>
+#include <hamon/type_traits/integral_constant.hpp>
+#include <hamon/type_traits/is_same.hpp>
+#include <hamon/type_traits/remove_cvref.hpp>
+#include <hamon/type_traits/void_t.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+namespace detail
+{
+
+template <typename R, typename = void>
+struct format_kind_has_key_type
+	: public hamon::false_type {};
+
+template <typename R>
+struct format_kind_has_key_type<R, hamon::void_t<typename R::key_type>>
+	: public hamon::true_type {};
+
+template <typename R, typename = void>
+struct format_kind_has_mapped_type
+	: public hamon::false_type {};
+
+template <typename R>
+struct format_kind_has_mapped_type<R, hamon::void_t<typename R::mapped_type>>
+	: public hamon::true_type {};
+
+// format_kind の既定値
+template <typename R, bool = hamon::ranges::input_range_t<R>::value>
+struct format_kind_default
+	: public hamon::integral_constant<range_format, range_format::disabled> {};
+
+template <typename R>
+struct format_kind_default<R, true>
+	: public hamon::integral_constant<range_format,
+		hamon::is_same<hamon::remove_cvref_t<hamon::ranges::range_reference_t<R>>, R>::value ?
+			range_format::disabled :
+		format_kind_has_key_type<R>::value ?
+			((format_kind_has_mapped_type<R>::value &&
+				hamon::pair_like_t<hamon::remove_cvref_t<hamon::ranges::range_reference_t<R>>>::value) ?
+				range_format::map : range_format::set) :
+		range_format::sequence>
+{};
+
+}	// namespace detail
+
+// 28.5.7.1 Variable template format_kind[format.range.fmtkind]
+
+#if defined(HAMON_HAS_CXX14_VARIABLE_TEMPLATES)
+
+template <typename R>
+HAMON_INLINE_VAR HAMON_CONSTEXPR
+range_format format_kind = detail::format_kind_default<R>::value;
+
+#else
+
+template <typename R>
+struct format_kind
+{
+	HAMON_STATIC_CONSTEXPR range_format value = detail::format_kind_default<R>::value;
+};
+
+#endif
+
+}	// namespace hamon
+
+#endif
+
+#if defined(HAMON_HAS_CXX14_VARIABLE_TEMPLATES)
+
+#define HAMON_FORMAT_KIND(...)	\
+	::hamon::format_kind<__VA_ARGS__>
+
+#define HAMON_FORMAT_SPECIALIZE_FORMAT_KIND(Value, ...)		\
+	HAMON_INLINE_VAR HAMON_CONSTEXPR						\
+	range_format format_kind<__VA_ARGS__> = Value
+
+#else
+
+#define HAMON_FORMAT_KIND(...)	\
+	::hamon::format_kind<__VA_ARGS__>::value
+
+#define HAMON_FORMAT_SPECIALIZE_FORMAT_KIND(Value, ...)	\
+	struct format_kind<__VA_ARGS__>	                    \
+	{	                                                \
+		HAMON_STATIC_CONSTEXPR range_format value = Value;	\
+	}
+
+#endif
+
+#endif // HAMON_FORMAT_FORMAT_KIND_HPP
@@ -0,0 +1,19 @@
+﻿/**
+ *	@file	format_parse_context.hpp
+ *
+ *	@brief	format_parse_context の定義
+ */
+
+#ifndef HAMON_FORMAT_FORMAT_PARSE_CONTEXT_HPP
+#define HAMON_FORMAT_FORMAT_PARSE_CONTEXT_HPP
+
+#include <hamon/format/basic_format_parse_context.hpp>
+
+namespace hamon
+{
+
+using format_parse_context = hamon::basic_format_parse_context<char>;
+
+}	// namespace hamon
+
+#endif // HAMON_FORMAT_FORMAT_PARSE_CONTEXT_HPP
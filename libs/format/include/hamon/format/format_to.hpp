@@ -0,0 +1,55 @@
+﻿/**
+ *	@file	format_to.hpp
+ *
+ *	@brief	format_to の定義
+ */
+
+#ifndef HAMON_FORMAT_FORMAT_TO_HPP
+#define HAMON_FORMAT_FORMAT_TO_HPP
+
+#include <hamon/format/config.hpp>
+
+#if defined(HAMON_USE_STD_FORMAT)
+
+namespace hamon
+{
+
+using std::format_to;
+
+}	// namespace hamon
+
+#else
+
+#include <hamon/format/format_args.hpp>
+#include <hamon/format/wformat_args.hpp>
+#include <hamon/format/format_string.hpp>
+#include <hamon/format/wformat_string.hpp>
+#include <hamon/format/make_format_args.hpp>
+#include <hamon/format/make_wformat_args.hpp>
+#include <hamon/format/detail/format_to_impl.hpp>
+#include <hamon/utility/move.hpp>
+
+namespace hamon
+{
+
+// 28.5.5 Formatting functions[format.functions]
+
+template <typename Out, typename... Args>
+inline Out
+format_to(Out out, hamon::format_string<Args...> fmt, Args&&... args)
+{
+	return detail::format_to_iterator(hamon::move(out), fmt, hamon::format_args(hamon::make_format_args(args...)));
+}
+
+template <typename Out, typename... Args>
+inline Out
+format_to(Out out, hamon::wformat_string<Args...> fmt, Args&&... args)
+{
+	return detail::format_to_iterator(hamon::move(out), fmt, hamon::wformat_args(hamon::make_wformat_args(args...)));
+}
+
+}	// namespace hamon
+
+#endif
+
+#endif // HAMON_FORMAT_FORMAT_TO_HPP
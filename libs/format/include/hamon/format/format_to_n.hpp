@@ -0,0 +1,78 @@
+﻿/**
+ *	@file	format_to_n.hpp
+ *
+ *	@brief	format_to_n の定義
+ */
+
+#ifndef HAMON_FORMAT_FORMAT_TO_N_HPP
+#define HAMON_FORMAT_FORMAT_TO_N_HPP
+
+#include <hamon/format/config.hpp>
+
+#if defined(HAMON_USE_STD_FORMAT)
+
+namespace hamon
+{
+
+using std::format_to_n;
+
+}	// namespace hamon
+
+#else
+
+#include <hamon/format/basic_format_args.hpp>
+#include <hamon/format/basic_format_string.hpp>
+#include <hamon/format/format_args.hpp>
+#include <hamon/format/wformat_args.hpp>
+#include <hamon/format/format_to_n_result.hpp>
+#include <hamon/format/format_string.hpp>
+#include <hamon/format/wformat_string.hpp>
+#include <hamon/format/make_format_args.hpp>
+#include <hamon/format/make_wformat_args.hpp>
+#include <hamon/format/detail/format_buffer.hpp>
+#include <hamon/format/detail/format_to_impl.hpp>
+#include <hamon/iterator/iter_difference_t.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/utility/move.hpp>
+
+namespace hamon
+{
+
+// 28.5.5 Formatting functions[format.functions]
+
+namespace detail
+{
+
+template <typename Out, typename CharT, typename... Args, typename Context>
+inline hamon::format_to_n_result<Out>
+format_to_n_impl(Out out, hamon::iter_difference_t<Out> n,
+	hamon::basic_format_string<CharT, Args...> const& fmt, hamon::basic_format_args<Context> args)
+{
+	detail::format_to_n_buffer<Out, CharT> buf(hamon::move(out),
+		n > 0 ? static_cast<hamon::size_t>(n) : 0);
+	detail::format_to_impl(buf, fmt, args);
+	Out last = buf.out();
+	return { hamon::move(last), static_cast<hamon::iter_difference_t<Out>>(buf.count()) };
+}
+
+}	// namespace detail
+
+template <typename Out, typename... Args>
+inline hamon::format_to_n_result<Out>
+format_to_n(Out out, hamon::iter_difference_t<Out> n, hamon::format_string<Args...> fmt, Args&&... args)
+{
+	return detail::format_to_n_impl(hamon::move(out), n, fmt, hamon::format_args(hamon::make_format_args(args...)));
+}
+
+template <typename Out, typename... Args>
+inline hamon::format_to_n_result<Out>
+format_to_n(Out out, hamon::iter_difference_t<Out> n, hamon::wformat_string<Args...> fmt, Args&&... args)
+{
+	return detail::format_to_n_impl(hamon::move(out), n, fmt, hamon::wformat_args(hamon::make_wformat_args(args...)));
+}
+
+}	// namespace hamon
+
+#endif
+
+#endif // HAMON_FORMAT_FORMAT_TO_N_HPP
@@ -0,0 +1,105 @@
+﻿/**
+ *	@file	formattable.hpp
+ *
+ *	@brief	formattable の定義
+ */
+
+#ifndef HAMON_FORMAT_FORMATTABLE_HPP
+#define HAMON_FORMAT_FORMATTABLE_HPP
+
+#include <hamon/format/config.hpp>
+#include <hamon/type_traits/bool_constant.hpp>
+
+#if defined(HAMON_USE_STD_FORMAT)
+
+namespace hamon
+{
+
+using std::formattable;
+
+}	// namespace hamon
+
+#else
+
+#include <hamon/format/basic_format_context.hpp>
+#include <hamon/format/basic_format_parse_context.hpp>
+#include <hamon/format/formatter.hpp>
+#include <hamon/format/detail/format_buffer.hpp>
+#include <hamon/concepts/semiregular.hpp>
+#include <hamon/type_traits/conjunction.hpp>
+#include <hamon/type_traits/is_same.hpp>
+#include <hamon/type_traits/remove_const.hpp>
+#include <hamon/type_traits/remove_reference.hpp>
+#include <hamon/utility/declval.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+namespace detail
+{
+
+// 28.5.6.3 Concept formattable[format.formattable]
+// formattable-with
+template <typename T, typename Context,
+	typename Formatter = typename Context::template formatter_type<hamon::remove_const_t<T>>>
+struct formattable_with_impl
+{
+private:
+	using parse_context = hamon::basic_format_parse_context<typename Context::char_type>;
+
+	template <typename U, typename F,
+		typename P = decltype(hamon::declval<F&>().parse(hamon::declval<parse_context&>())),
+		typename R = decltype(hamon::declval<F const&>().format(hamon::declval<U&>(), hamon::declval<Context&>()))
+	>
+	static auto test(int) -> hamon::conjunction<
+		hamon::semiregular_t<F>,
+		hamon::is_same<P, typename parse_context::iterator>,
+		hamon::is_same<R, typename Context::iterator>>;
+
+	template <typename U, typename F>
+	static auto test(...) -> hamon::false_type;
+
+public:
+	using type = decltype(test<T, Formatter>(0));
+};
+
+template <typename T, typename Context>
+using formattable_with = typename formattable_with_impl<T, Context>::type;
+
+}	// namespace detail
+
+#if defined(HAMON_HAS_CXX20_CONCEPTS)
+
+template <typename T, typename CharT>
+concept formattable =
+	detail::formattable_with<hamon::remove_reference_t<T>,
+		hamon::basic_format_context<detail::format_buffer_iterator<CharT>, CharT>>::value;
+
+#else
+
+template <typename T, typename CharT>
+using formattable =
+	detail::formattable_with<hamon::remove_reference_t<T>,
+		hamon::basic_format_context<detail::format_buffer_iterator<CharT>, CharT>>;
+
+#endif
+
+}	// namespace hamon
+
+#endif
+
+namespace hamon
+{
+
+template <typename T, typename CharT>
+using formattable_t =
+#if defined(HAMON_HAS_CXX20_CONCEPTS)
+	hamon::bool_constant<hamon::formattable<T, CharT>>;
+#else
+	hamon::formattable<T, CharT>;
+#endif
+
+}	// namespace hamon
+
+#endif // HAMON_FORMAT_FORMATTABLE_HPP
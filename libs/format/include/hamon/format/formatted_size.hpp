@@ -0,0 +1,60 @@
+﻿/**
+ *	@file	formatted_size.hpp
+ *
+ *	@brief	formatted_size の定義
+ */
+
+#ifndef HAMON_FORMAT_FORMATTED_SIZE_HPP
+#define HAMON_FORMAT_FORMATTED_SIZE_HPP
+
+#include <hamon/format/config.hpp>
+
+#if defined(HAMON_USE_STD_FORMAT)
+
+namespace hamon
+{
+
+using std::formatted_size;
+
+}	// namespace hamon
+
+#else
+
+#include <hamon/format/format_args.hpp>
+#include <hamon/format/wformat_args.hpp>
+#include <hamon/format/format_string.hpp>
+#include <hamon/format/wformat_string.hpp>
+#include <hamon/format/make_format_args.hpp>
+#include <hamon/format/make_wformat_args.hpp>
+#include <hamon/format/detail/format_buffer.hpp>
+#include <hamon/format/detail/format_to_impl.hpp>
+#include <hamon/cstddef/size_t.hpp>
+
+namespace hamon
+{
+
+// 28.5.5 Formatting functions[format.functions]
+
+template <typename... Args>
+inline hamon::size_t
+formatted_size(hamon::format_string<Args...> fmt, Args&&... args)
+{
+	detail::counting_format_buffer<char> buf;
+	detail::format_to_impl(buf, fmt, hamon::format_args(hamon::make_format_args(args...)));
+	return buf.count();
+}
+
+template <typename... Args>
+inline hamon::size_t
+formatted_size(hamon::wformat_string<Args...> fmt, Args&&... args)
+{
+	detail::counting_format_buffer<wchar_t> buf;
+	detail::format_to_impl(buf, fmt, hamon::wformat_args(hamon::make_wformat_args(args...)));
+	return buf.count();
+}
+
+}	// namespace hamon
+
+#endif
+
+#endif // HAMON_FORMAT_FORMATTED_SIZE_HPP
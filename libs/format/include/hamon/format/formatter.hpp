@@ -0,0 +1,219 @@
+﻿/**
+ *	@file	formatter.hpp
+ *
+ *	@brief	formatter の定義
+ */
+
+#ifndef HAMON_FORMAT_FORMATTER_HPP
+#define HAMON_FORMAT_FORMATTER_HPP
+
+#include <hamon/format/config.hpp>
+
+#if defined(HAMON_USE_STD_FORMAT)
+
+namespace hamon
+{
+
+using std::formatter;
+
+}	// namespace hamon
+
+#else
+
+#include <hamon/format/detail/formatter_char.hpp>
+#include <hamon/format/detail/formatter_string.hpp>
+#include <hamon/format/detail/formatter_integer.hpp>
+#include <hamon/format/detail/formatter_floating.hpp>
+#include <hamon/format/detail/formatter_pointer.hpp>
+#include <hamon/string/basic_string.hpp>
+#include <hamon/string_view/basic_string_view.hpp>
+#include <hamon/string_view/config.hpp>
+#include <hamon/string/config.hpp>
+#include <hamon/cstddef/nullptr_t.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/config.hpp>
+#include <string>
+
+#if defined(HAMON_HAS_STD_STRING_VIEW)
+#include <string_view>
+#endif
+
+namespace hamon
+{
+
+// 28.5.6.1 Formatter requirements[formatter.requirements]
+// 28.5.6.4 Formatter specializations[format.formatter.spec]
+
+// 特殊化されていない formatter は無効 (disabled)
+//
+// 範囲やタプルの formatter を制約付きで部分特殊化するために、
+// C++20 のコンセプトの代わりに SFINAE で使う3番目のテンプレート引数を持つ。
+template <typename T, typename CharT = char, typename Enable = void>
+struct formatter
+{
+	formatter() = delete;
+	formatter(formatter const&) = delete;
+	formatter& operator=(formatter const&) = delete;
+};
+
+// 文字型
+template <>
+struct formatter<char, char>
+	: public detail::formatter_char<char> {};
+
+template <>
+struct formatter<wchar_t, wchar_t>
+	: public detail::formatter_char<wchar_t> {};
+
+template <>
+struct formatter<char, wchar_t>
+	: public detail::formatter_char<wchar_t> {};
+
+// 文字列型
+template <typename CharT>
+struct formatter<CharT*, CharT>
+	: public detail::formatter_string<CharT>
+{
+	template <typename FormatContext>
+	typename FormatContext::iterator
+	format(CharT* s, FormatContext& ctx) const
+	{
+		return detail::formatter_string<CharT>::format(hamon::basic_string_view<CharT>(s), ctx);
+	}
+};
+
+template <typename CharT>
+struct formatter<CharT const*, CharT>
+	: public detail::formatter_string<CharT>
+{
+	template <typename FormatContext>
+	typename FormatContext::iterator
+	format(CharT const* s, FormatContext& ctx) const
+	{
+		return detail::formatter_string<CharT>::format(hamon::basic_string_view<CharT>(s), ctx);
+	}
+};
+
+template <typename CharT, hamon::size_t N>
+struct formatter<CharT[N], CharT>
+	: public detail::formatter_string<CharT>
+{
+	template <typename FormatContext>
+	typename FormatContext::iterator
+	format(CharT const (&s)[N], FormatContext& ctx) const
+	{
+		// 配列の中の最初のヌル文字まで
+		hamon::size_t n = 0;
+		while (n < N && s[n] != CharT())
+		{
+			++n;
+		}
+		return detail::formatter_string<CharT>::format(hamon::basic_string_view<CharT>(s, n), ctx);
+	}
+};
+
+template <typename CharT, typename Traits, typename Allocator>
+struct formatter<hamon::basic_string<CharT, Traits, Allocator>, CharT>
+	: public detail::formatter_string<CharT>
+{
+	template <typename FormatContext>
+	typename FormatContext::iterator
+	format(hamon::basic_string<CharT, Traits, Allocator> const& s, FormatContext& ctx) const
+	{
+		return detail::formatter_string<CharT>::format(hamon::basic_string_view<CharT>(s.data(), s.size()), ctx);
+	}
+};
+
+template <typename CharT, typename Traits>
+struct formatter<hamon::basic_string_view<CharT, Traits>, CharT>
+	: public detail::formatter_string<CharT>
+{
+	template <typename FormatContext>
+	typename FormatContext::iterator
+	format(hamon::basic_string_view<CharT, Traits> s, FormatContext& ctx) const
+	{
+		return detail::formatter_string<CharT>::format(hamon::basic_string_view<CharT>(s.data(), s.size()), ctx);
+	}
+};
+
+#if !defined(HAMON_USE_STD_STRING)
+template <typename CharT, typename Traits, typename Allocator>
+struct formatter<std::basic_string<CharT, Traits, Allocator>, CharT>
+	: public detail::formatter_string<CharT>
+{
+	template <typename FormatContext>
+	typename FormatContext::iterator
+	format(std::basic_string<CharT, Traits, Allocator> const& s, FormatContext& ctx) const
+	{
+		return detail::formatter_string<CharT>::format(hamon::basic_string_view<CharT>(s.data(), s.size()), ctx);
+	}
+};
+#endif
+
+#if defined(HAMON_HAS_STD_STRING_VIEW) && !defined(HAMON_USE_STD_STRING_VIEW)
+template <typename CharT, typename Traits>
+struct formatter<std::basic_string_view<CharT, Traits>, CharT>
+	: public detail::formatter_string<CharT>
+{
+	template <typename FormatContext>
+	typename FormatContext::iterator
+	format(std::basic_string_view<CharT, Traits> s, FormatContext& ctx) const
+	{
+		return detail::formatter_string<CharT>::format(hamon::basic_string_view<CharT>(s.data(), s.size()), ctx);
+	}
+};
+#endif
+
+// 算術型
+template <typename CharT>
+struct formatter<bool, CharT>
+	: public detail::formatter_bool<CharT> {};
+
+#define HAMON_FORMAT_INTEGER_FORMATTER(T)	\
+	template <typename CharT>	\
+	struct formatter<T, CharT>	\
+		: public detail::formatter_integer<T, CharT> {}
+
+HAMON_FORMAT_INTEGER_FORMATTER(signed char);
+HAMON_FORMAT_INTEGER_FORMATTER(short);
+HAMON_FORMAT_INTEGER_FORMATTER(int);
+HAMON_FORMAT_INTEGER_FORMATTER(long);
+HAMON_FORMAT_INTEGER_FORMATTER(long long);
+HAMON_FORMAT_INTEGER_FORMATTER(unsigned char);
+HAMON_FORMAT_INTEGER_FORMATTER(unsigned short);
+HAMON_FORMAT_INTEGER_FORMATTER(unsigned int);
+HAMON_FORMAT_INTEGER_FORMATTER(unsigned long);
+HAMON_FORMAT_INTEGER_FORMATTER(unsigned long long);
+
+#undef HAMON_FORMAT_INTEGER_FORMATTER
+
+template <typename CharT>
+struct formatter<float, CharT>
+	: public detail::formatter_floating<float, CharT> {};
+
+template <typename CharT>
+struct formatter<double, CharT>
+	: public detail::formatter_floating<double, CharT> {};
+
+template <typename CharT>
+struct formatter<long double, CharT>
+	: public detail::formatter_floating<long double, CharT> {};
+
+// ポインタ型
+template <typename CharT>
+struct formatter<hamon::nullptr_t, CharT>
+	: public detail::formatter_pointer<CharT> {};
+
+template <typename CharT>
+struct formatter<void*, CharT>
+	: public detail::formatter_pointer<CharT> {};
+
+template <typename CharT>
+struct formatter<void const*, CharT>
+	: public detail::formatter_pointer<CharT> {};
+
+}	// namespace hamon
+
+#endif
+
+#endif // HAMON_FORMAT_FORMATTER_HPP
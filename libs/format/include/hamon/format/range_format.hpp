@@ -0,0 +1,48 @@
+﻿/**
+ *	@file	range_format.hpp
+ *
+ *	@brief	range_format の定義
+ */
+
+#ifndef HAMON_FORMAT_RANGE_FORMAT_HPP
+#define HAMON_FORMAT_RANGE_FORMAT_HPP
+
+#include <hamon/format/config.hpp>
+
+#if defined(HAMON_USE_STD_FORMAT)
+
+namespace hamon
+{
+
+using std::range_format;
+
+}	// namespace hamon
+
+#else
+
+namespace hamon
+{
+
+// 28.5.7.1 Variable template format_kind[format.range.fmtkind]
+
+// string は hamon::string と同じ名前なので、GCC の -Wshadow を抑える
+HAMON_WARNING_PUSH()
+HAMON_WARNING_DISABLE_GCC("-Wshadow")
+
+enum class range_format
+{
+	disabled,
+	map,
+	set,
+	sequence,
+	string,
+	debug_string,
+};
+
+HAMON_WARNING_POP()
+
+}	// namespace hamon
+
+#endif
+
+#endif // HAMON_FORMAT_RANGE_FORMAT_HPP
@@ -0,0 +1,306 @@
+﻿/**
+ *	@file	range_formatter.hpp
+ *
+ *	@brief	range_formatter の定義
+ */
+
+#ifndef HAMON_FORMAT_RANGE_FORMATTER_HPP
+#define HAMON_FORMAT_RANGE_FORMATTER_HPP
+
+#include <hamon/format/config.hpp>
+
+#if defined(HAMON_USE_STD_FORMAT)
+
+namespace hamon
+{
+
+using std::range_formatter;
+
+}	// namespace hamon
+
+#else
+
+#include <hamon/format/basic_format_context.hpp>
+#include <hamon/format/basic_format_parse_context.hpp>
+#include <hamon/format/format_error.hpp>
+#include <hamon/format/formattable.hpp>
+#include <hamon/format/formatter.hpp>
+#include <hamon/format/detail/format_buffer.hpp>
+#include <hamon/format/detail/format_debug_format.hpp>
+#include <hamon/format/detail/format_escape.hpp>
+#include <hamon/format/detail/format_padding.hpp>
+#include <hamon/format/detail/format_range_to_string_view.hpp>
+#include <hamon/format/detail/format_width.hpp>
+#include <hamon/format/detail/format_write.hpp>
+#include <hamon/format/detail/format_write_padded_by.hpp>
+#include <hamon/format/detail/std_format_spec.hpp>
+#include <hamon/detail/statically_widen.hpp>
+#include <hamon/ranges/begin.hpp>
+#include <hamon/ranges/end.hpp>
+#include <hamon/ranges/concepts/forward_range.hpp>
+#include <hamon/string/basic_string.hpp>
+#include <hamon/string_view/basic_string_view.hpp>
+#include <hamon/tuple/concepts/pair_like.hpp>
+#include <hamon/type_traits/bool_constant.hpp>
+#include <hamon/type_traits/is_same.hpp>
+#include <hamon/type_traits/remove_cvref.hpp>
+#include <hamon/type_traits/remove_reference.hpp>
+#include <hamon/utility/declval.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+namespace detail
+{
+
+// 'm' を指定したときに、要素の formatter の括弧と区切り文字を変える
+template <typename Formatter, typename CharT>
+inline HAMON_CXX14_CONSTEXPR auto
+range_formatter_set_map_format(Formatter& f, CharT const* sep, int)
+->decltype(f.set_brackets({}, {}), void())
+{
+	f.set_brackets({}, {});
+	f.set_separator(sep);
+}
+
+template <typename Formatter, typename CharT>
+inline HAMON_CXX14_CONSTEXPR void
+range_formatter_set_map_format(Formatter&, CharT const*, long)
+{
+	hamon::detail::throw_format_error("'m' is only valid for pair or tuple of two elements");
+}
+
+}	// namespace detail
+
+// 28.5.7.2 Class template range_formatter[format.range.formatter]
+
+template <typename T, typename CharT = char>
+class range_formatter
+{
+	static_assert(hamon::is_same<hamon::remove_cvref_t<T>, T>::value, "");
+	static_assert(hamon::formattable_t<T, CharT>::value, "");
+
+private:
+	hamon::formatter<T, CharT>      m_underlying;
+	hamon::basic_string_view<CharT> m_separator       = HAMON_STATICALLY_WIDEN(CharT, ", ");
+	hamon::basic_string_view<CharT> m_opening_bracket = HAMON_STATICALLY_WIDEN(CharT, "[");
+	hamon::basic_string_view<CharT> m_closing_bracket = HAMON_STATICALLY_WIDEN(CharT, "]");
+	detail::std_format_spec<CharT>  m_spec;		// m_type は 'm', 's', '?' (?s) のいずれか
+	bool                            m_no_brackets = false;
+
+public:
+	HAMON_CXX14_CONSTEXPR void
+	set_separator(hamon::basic_string_view<CharT> sep) HAMON_NOEXCEPT
+	{
+		m_separator = sep;
+	}
+
+	HAMON_CXX14_CONSTEXPR void
+	set_brackets(hamon::basic_string_view<CharT> opening, hamon::basic_string_view<CharT> closing) HAMON_NOEXCEPT
+	{
+		m_opening_bracket = opening;
+		m_closing_bracket = closing;
+	}
+
+	HAMON_CXX14_CONSTEXPR hamon::formatter<T, CharT>&
+	underlying() HAMON_NOEXCEPT
+	{
+		return m_underlying;
+	}
+
+	HAMON_CXX11_CONSTEXPR hamon::formatter<T, CharT> const&
+	underlying() const HAMON_NOEXCEPT
+	{
+		return m_underlying;
+	}
+
+	HAMON_CXX14_CONSTEXPR typename hamon::basic_format_parse_context<CharT>::iterator
+	parse(hamon::basic_format_parse_context<CharT>& pc)
+	{
+		// range-fill-and-align width
+		auto first = detail::parse_std_format_spec(pc, m_spec,
+			detail::format_spec_fields::fill_align |
+			detail::format_spec_fields::width);
+		auto const last = pc.end();
+
+		// n
+		if (first != last && *first == CharT('n'))
+		{
+			m_no_brackets = true;
+			++first;
+		}
+
+		// range-type
+		if (first != last && *first == CharT('m'))
+		{
+			if (!hamon::pair_like_t<T>::value)
+			{
+				hamon::detail::throw_format_error("'m' is only valid for pair or tuple of two elements");
+			}
+			m_spec.m_type = CharT('m');
+			m_opening_bracket = HAMON_STATICALLY_WIDEN(CharT, "{");
+			m_closing_bracket = HAMON_STATICALLY_WIDEN(CharT, "}");
+			detail::range_formatter_set_map_format(m_underlying, HAMON_STATICALLY_WIDEN(CharT, ": "), 0);
+			++first;
+		}
+		else if (first != last && (*first == CharT('s') || *first == CharT('?')))
+		{
+			if (*first == CharT('?'))
+			{
+				++first;
+				if (first == last || *first != CharT('s'))
+				{
+					hamon::detail::throw_format_error("'?' must be followed by 's' in range format spec");
+				}
+				m_spec.m_type = CharT('?');
+			}
+			else
+			{
+				m_spec.m_type = CharT('s');
+			}
+			++first;
+
+			if (!hamon::is_same<T, CharT>::value)
+			{
+				hamon::detail::throw_format_error("'s' and '?s' are only valid for ranges of characters");
+			}
+			if (m_no_brackets)
+			{
+				hamon::detail::throw_format_error("'n' cannot be used with 's' or '?s'");
+			}
+			if (first != last && *first == CharT(':'))
+			{
+				hamon::detail::throw_format_error("format spec for elements cannot be used with 's' or '?s'");
+			}
+			return detail::check_format_spec_end(first, last);
+		}
+
+		// range-underlying-spec
+		bool const has_underlying_spec = first != last && *first == CharT(':');
+		if (has_underlying_spec)
+		{
+			++first;
+		}
+		else
+		{
+			first = detail::check_format_spec_end(first, last);
+		}
+
+		pc.advance_to(first);
+		first = m_underlying.parse(pc);
+		if (!has_underlying_spec)
+		{
+			detail::format_maybe_set_debug_format(m_underlying);
+		}
+
+		return detail::check_format_spec_end(first, last);
+	}
+
+	template <typename R, typename FormatContext>
+	typename FormatContext::iterator
+	format(R&& r, FormatContext& ctx) const
+	{
+		auto const spec = detail::resolve_std_format_spec(m_spec, ctx);
+
+		if (spec.m_type == CharT('s') || spec.m_type == CharT('?'))
+		{
+			return this->format_string(r, spec, ctx, hamon::is_same<T, CharT>{});
+		}
+
+		if (spec.m_width == 0)
+		{
+			return this->format_elements(r, ctx);
+		}
+
+		// 表示幅は文字列を作らずに数える。
+		// 右寄せと中央寄せでは要素を2回書式化するので、2回走査できる範囲でなければならない
+		using iterator = typename FormatContext::iterator;
+		return detail::format_write_padded_by(ctx.out(), spec, detail::format_align::left,
+			hamon::ranges::forward_range_t<hamon::remove_reference_t<R>>::value,
+			[&](iterator out)
+			{
+				detail::format_context_storage<iterator, CharT> storage(out, ctx);
+				return this->format_elements(r, storage.m_context);
+			});
+	}
+
+private:
+	template <typename R, typename FormatContext>
+	typename FormatContext::iterator
+	format_elements(R&& r, FormatContext& ctx) const
+	{
+		auto out = ctx.out();
+		if (!m_no_brackets)
+		{
+			out = detail::format_write(out, m_opening_bracket.data(), m_opening_bracket.size());
+		}
+
+		auto it = hamon::ranges::begin(r);
+		auto const last = hamon::ranges::end(r);
+		for (bool first = true; it != last; ++it)
+		{
+			if (!first)
+			{
+				out = detail::format_write(out, m_separator.data(), m_separator.size());
+			}
+			first = false;
+			ctx.advance_to(out);
+			out = m_underlying.format(*it, ctx);
+		}
+
+		if (!m_no_brackets)
+		{
+			out = detail::format_write(out, m_closing_bracket.data(), m_closing_bracket.size());
+		}
+		return out;
+	}
+
+	// 's' と '?s' : 文字の範囲を文字列として書式化する
+	// 要素が文字でないときは parse で弾いているので呼ばれない
+	template <typename R, typename FormatContext>
+	typename FormatContext::iterator
+	format_string(R&&, detail::std_format_spec<CharT> const&, FormatContext& ctx, hamon::false_type) const
+	{
+		return ctx.out();
+	}
+
+	template <typename R, typename FormatContext>
+	typename FormatContext::iterator
+	format_string(R&& r, detail::std_format_spec<CharT> const& spec, FormatContext& ctx, hamon::true_type) const
+	{
+		hamon::basic_string<CharT> str;
+		auto const sv = detail::format_range_to_string_view(r, str);
+		auto const first = sv.data();
+		auto const last = sv.data() + sv.size();
+
+		if (spec.m_type == CharT('?'))
+		{
+			auto out = ctx.out();
+			auto padding = detail::format_padding_size{0, 0};
+			if (spec.m_width != 0)
+			{
+				padding = detail::format_compute_padding(spec,
+					detail::format_escaped_width(first, last, CharT('"')),
+					detail::format_align::left);
+			}
+			out = detail::format_write_padding(out, spec, padding.m_before);
+			out = detail::format_write_escaped(out, first, last, CharT('"'));
+			return detail::format_write_padding(out, spec, padding.m_after);
+		}
+
+		if (spec.m_width == 0)
+		{
+			return detail::format_write(ctx.out(), first, sv.size());
+		}
+		return detail::format_write_padded(ctx.out(), spec, first, sv.size(),
+			detail::format_estimate_width(first, last),
+			detail::format_align::left);
+	}
+};
+
+}	// namespace hamon
+
+#endif
+
+#endif // HAMON_FORMAT_RANGE_FORMATTER_HPP
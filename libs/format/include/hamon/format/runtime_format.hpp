@@ -0,0 +1,68 @@
+﻿/**
+ *	@file	runtime_format.hpp
+ *
+ *	@brief	runtime_format の定義
+ */
+
+#ifndef HAMON_FORMAT_RUNTIME_FORMAT_HPP
+#define HAMON_FORMAT_RUNTIME_FORMAT_HPP
+
+#include <hamon/format/config.hpp>
+
+#if defined(HAMON_USE_STD_FORMAT)
+
+// std::runtime_format が無い標準ライブラリでは提供しない
+#if defined(__cpp_lib_format) && (__cpp_lib_format >= 202311L)
+
+namespace hamon
+{
+
+using std::runtime_format;
+
+}	// namespace hamon
+
+#endif
+
+#else
+
+#include <hamon/string_view/basic_string_view.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+namespace detail
+{
+
+// 28.5.4 Class template basic_format_string[format.fmt.string]
+// runtime-format-string
+template <typename CharT>
+struct runtime_format_string
+{
+	hamon::basic_string_view<CharT> m_str;
+
+	HAMON_CXX11_CONSTEXPR explicit
+	runtime_format_string(hamon::basic_string_view<CharT> s) HAMON_NOEXCEPT
+		: m_str(s) {}
+};
+
+}	// namespace detail
+
+// 書式文字列をコンパイル時に検査せず、実行時に検査する
+inline detail::runtime_format_string<char>
+runtime_format(hamon::basic_string_view<char> fmt) HAMON_NOEXCEPT
+{
+	return detail::runtime_format_string<char>(fmt);
+}
+
+inline detail::runtime_format_string<wchar_t>
+runtime_format(hamon::basic_string_view<wchar_t> fmt) HAMON_NOEXCEPT
+{
+	return detail::runtime_format_string<wchar_t>(fmt);
+}
+
+}	// namespace hamon
+
+#endif
+
+#endif // HAMON_FORMAT_RUNTIME_FORMAT_HPP
@@ -0,0 +1,61 @@
+﻿/**
+ *	@file	vformat.hpp
+ *
+ *	@brief	vformat の定義
+ */
+
+#ifndef HAMON_FORMAT_VFORMAT_HPP
+#define HAMON_FORMAT_VFORMAT_HPP
+
+#include <hamon/format/config.hpp>
+
+#if defined(HAMON_USE_STD_FORMAT)
+
+namespace hamon
+{
+
+using std::vformat;
+
+}	// namespace hamon
+
+#else
+
+#include <hamon/format/format_args.hpp>
+#include <hamon/format/wformat_args.hpp>
+#include <hamon/format/detail/format_buffer.hpp>
+#include <hamon/format/detail/vformat_to_impl.hpp>
+#include <hamon/string/string.hpp>
+#include <hamon/string/wstring.hpp>
+#include <hamon/string_view/string_view.hpp>
+#include <hamon/string_view/wstring_view.hpp>
+
+namespace hamon
+{
+
+// 28.5.5 Formatting functions[format.functions]
+
+inline hamon::string
+vformat(hamon::string_view fmt, hamon::format_args args)
+{
+	hamon::string result;
+	detail::string_format_buffer<hamon::string> buf(result);
+	detail::vformat_to_impl(buf, fmt, args);
+	buf.finish();
+	return result;
+}
+
+inline hamon::wstring
+vformat(hamon::wstring_view fmt, hamon::wformat_args args)
+{
+	hamon::wstring result;
+	detail::string_format_buffer<hamon::wstring> buf(result);
+	detail::vformat_to_impl(buf, fmt, args);
+	buf.finish();
+	return result;
+}
+
+}	// namespace hamon
+
+#endif
+
+#endif // HAMON_FORMAT_VFORMAT_HPP
@@ -0,0 +1,73 @@
+﻿/**
+ *	@file	vformat_to.hpp
+ *
+ *	@brief	vformat_to の定義
+ */
+
+#ifndef HAMON_FORMAT_VFORMAT_TO_HPP
+#define HAMON_FORMAT_VFORMAT_TO_HPP
+
+#include <hamon/format/config.hpp>
+
+#if defined(HAMON_USE_STD_FORMAT)
+
+namespace hamon
+{
+
+using std::vformat_to;
+
+}	// namespace hamon
+
+#else
+
+#include <hamon/format/format_args.hpp>
+#include <hamon/format/wformat_args.hpp>
+#include <hamon/format/detail/format_buffer.hpp>
+#include <hamon/format/detail/vformat_to_impl.hpp>
+#include <hamon/string_view/string_view.hpp>
+#include <hamon/string_view/wstring_view.hpp>
+#include <hamon/utility/move.hpp>
+
+namespace hamon
+{
+
+// 28.5.5 Formatting functions[format.functions]
+
+template <typename Out>
+inline Out
+vformat_to(Out out, hamon::string_view fmt, hamon::format_args args)
+{
+	detail::iterator_format_buffer<Out, char> buf(hamon::move(out));
+	detail::vformat_to_impl(buf, fmt, args);
+	return buf.out();
+}
+
+template <typename Out>
+inline Out
+vformat_to(Out out, hamon::wstring_view fmt, hamon::wformat_args args)
+{
+	detail::iterator_format_buffer<Out, wchar_t> buf(hamon::move(out));
+	detail::vformat_to_impl(buf, fmt, args);
+	return buf.out();
+}
+
+// formatter の中から呼ばれたときは、同じバッファに直接書き込む
+inline detail::format_buffer_iterator<char>
+vformat_to(detail::format_buffer_iterator<char> out, hamon::string_view fmt, hamon::format_args args)
+{
+	detail::vformat_to_impl(out.buffer(), fmt, args);
+	return out;
+}
+
+inline detail::format_buffer_iterator<wchar_t>
+vformat_to(detail::format_buffer_iterator<wchar_t> out, hamon::wstring_view fmt, hamon::wformat_args args)
+{
+	detail::vformat_to_impl(out.buffer(), fmt, args);
+	return out;
+}
+
+}	// namespace hamon
+
+#endif
+
+#endif // HAMON_FORMAT_VFORMAT_TO_HPP
@@ -0,0 +1,44 @@
+﻿/**
+ *	@file	visit_format_arg.hpp
+ *
+ *	@brief	visit_format_arg の定義
+ */
+
+#ifndef HAMON_FORMAT_VISIT_FORMAT_ARG_HPP
+#define HAMON_FORMAT_VISIT_FORMAT_ARG_HPP
+
+#include <hamon/format/config.hpp>
+
+#if defined(HAMON_USE_STD_FORMAT)
+
+namespace hamon
+{
+
+using std::visit_format_arg;
+
+}	// namespace hamon
+
+#else
+
+#include <hamon/format/basic_format_arg.hpp>
+#include <hamon/utility/declval.hpp>
+#include <hamon/utility/forward.hpp>
+#include <hamon/variant/monostate.hpp>
+
+namespace hamon
+{
+
+// 28.5.8.1 Class template basic_format_arg[format.arg]
+
+template <typename Visitor, typename Context>
+auto visit_format_arg(Visitor&& vis, hamon::basic_format_arg<Context> arg)
+->decltype(hamon::forward<Visitor>(vis)(hamon::declval<hamon::monostate&>()))
+{
+	return arg.visit(hamon::forward<Visitor>(vis));
+}
+
+}	// namespace hamon
+
+#endif
+
+#endif // HAMON_FORMAT_VISIT_FORMAT_ARG_HPP
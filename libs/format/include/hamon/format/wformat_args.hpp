@@ -0,0 +1,20 @@
+﻿/**
+ *	@file	wformat_args.hpp
+ *
+ *	@brief	wformat_args の定義
+ */
+
+#ifndef HAMON_FORMAT_WFORMAT_ARGS_HPP
+#define HAMON_FORMAT_WFORMAT_ARGS_HPP
+
+#include <hamon/format/basic_format_args.hpp>
+#include <hamon/format/wformat_context.hpp>
+
+namespace hamon
+{
+
+using wformat_args = hamon::basic_format_args<hamon::wformat_context>;
+
+}	// namespace hamon
+
+#endif // HAMON_FORMAT_WFORMAT_ARGS_HPP
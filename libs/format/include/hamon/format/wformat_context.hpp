@@ -0,0 +1,35 @@
+﻿/**
+ *	@file	wformat_context.hpp
+ *
+ *	@brief	wformat_context の定義
+ */
+
+#ifndef HAMON_FORMAT_WFORMAT_CONTEXT_HPP
+#define HAMON_FORMAT_WFORMAT_CONTEXT_HPP
+
+#include <hamon/format/config.hpp>
+
+#if defined(HAMON_USE_STD_FORMAT)
+
+namespace hamon
+{
+
+using std::wformat_context;
+
+}	// namespace hamon
+
+#else
+
+#include <hamon/format/basic_format_context.hpp>
+#include <hamon/format/detail/format_buffer.hpp>
+
+namespace hamon
+{
+
+using wformat_context = hamon::basic_format_context<detail::format_buffer_iterator<wchar_t>, wchar_t>;
+
+}	// namespace hamon
+
+#endif
+
+#endif // HAMON_FORMAT_WFORMAT_CONTEXT_HPP
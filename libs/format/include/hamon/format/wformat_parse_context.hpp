@@ -0,0 +1,19 @@
+﻿/**
+ *	@file	wformat_parse_context.hpp
+ *
+ *	@brief	wformat_parse_context の定義
+ */
+
+#ifndef HAMON_FORMAT_WFORMAT_PARSE_CONTEXT_HPP
+#define HAMON_FORMAT_WFORMAT_PARSE_CONTEXT_HPP
+
+#include <hamon/format/basic_format_parse_context.hpp>
+
+namespace hamon
+{
+
+using wformat_parse_context = hamon::basic_format_parse_context<wchar_t>;
+
+}	// namespace hamon
+
+#endif // HAMON_FORMAT_WFORMAT_PARSE_CONTEXT_HPP
@@ -0,0 +1,7 @@
+﻿/**
+ *	@file	unit_test_format.cpp
+ *
+ *	@brief	format のテスト
+ */
+
+#include <hamon/format.hpp>
@@ -0,0 +1,197 @@
+﻿/**
+ *	@file	unit_test_format_format.cpp
+ *
+ *	@brief	format のテスト
+ */
+
+#include <hamon/format/format.hpp>
+#include <hamon/format/format_context.hpp>
+#include <hamon/format/format_error.hpp>
+#include <hamon/format/format_parse_context.hpp>
+#include <hamon/format/formatter.hpp>
+#include <hamon/format/format_string.hpp>
+#include <hamon/format/runtime_format.hpp>
+#include <hamon/limits.hpp>
+#include <hamon/string.hpp>
+#include <hamon/vector.hpp>
+#include <gtest/gtest.h>
+#include <string>
+
+namespace hamon_format_test
+{
+
+namespace format_test
+{
+
+struct Point
+{
+	int x;
+	int y;
+};
+
+}	// namespace format_test
+
+}	// namespace hamon_format_test
+
+HAMON_FORMAT_START_NAMESPACE
+
+template <>
+struct formatter<hamon_format_test::format_test::Point, char>
+{
+	formatter<int, char> m_int;
+
+	HAMON_CXX14_CONSTEXPR format_parse_context::iterator
+	parse(format_parse_context& pc)
+	{
+		return m_int.parse(pc);
+	}
+
+	format_context::iterator
+	format(hamon_format_test::format_test::Point const& p, format_context& ctx) const
+	{
+		auto out = ctx.out();
+		*out++ = '(';
+		ctx.advance_to(out);
+		out = m_int.format(p.x, ctx);
+		*out++ = ',';
+		ctx.advance_to(out);
+		out = m_int.format(p.y, ctx);
+		*out++ = ')';
+		return out;
+	}
+};
+
+HAMON_FORMAT_END_NAMESPACE
+
+namespace hamon_format_test
+{
+
+namespace format_test
+{
+
+GTEST_TEST(FormatTest, BasicTest)
+{
+	EXPECT_EQ("", hamon::format(""));
+	EXPECT_EQ("hello", hamon::format("hello"));
+	EXPECT_EQ("{}", hamon::format("{{}}"));
+	EXPECT_EQ("hello 42 world!", hamon::format("hello {} {}!", 42, "world"));
+	EXPECT_EQ("x y x", hamon::format("{0} {1} {0}", "x", "y"));
+	EXPECT_EQ("stdstr", hamon::format("{}", std::string("stdstr")));
+	EXPECT_EQ("hamonstr", hamon::format("{}", hamon::string("hamonstr")));
+	EXPECT_EQ("(1,2) (03,04)", hamon::format("{} {:02}", Point{1, 2}, Point{3, 4}));
+}
+
+GTEST_TEST(FormatTest, IntegerTest)
+{
+	EXPECT_EQ("0", hamon::format("{}", 0));
+	EXPECT_EQ("-42", hamon::format("{}", -42));
+	EXPECT_EQ("200 -5", hamon::format("{} {}", static_cast<unsigned char>(200), static_cast<signed char>(-5)));
+	EXPECT_EQ("9223372036854775808", hamon::format("{}", 1ull << 63));
+	EXPECT_EQ("-9223372036854775808", hamon::format("{}", (-9223372036854775807ll - 1)));
+	EXPECT_EQ("18446744073709551615", hamon::format("{}", 18446744073709551615ull));
+	EXPECT_EQ("0xff 0XFF 0b101 010", hamon::format("{:#x} {:#X} {:#b} {:#o}", 255, 255, 5, 8));
+	EXPECT_EQ("+3  3 3", hamon::format("{:+d} {: d} {:-d}", 3, 3, 3));
+	EXPECT_EQ("-0000042 0x000000ff", hamon::format("{:08d} {:#010x}", -42, 255));
+	EXPECT_EQ("A", hamon::format("{:c}", 65));
+}
+
+GTEST_TEST(FormatTest, FloatingTest)
+{
+	auto const inf = hamon::numeric_limits<double>::infinity();
+	EXPECT_EQ("1.5 0.1 1e+300 -0", hamon::format("{} {} {} {}", 1.5, 0.1, 1e300, -0.0));
+	EXPECT_EQ("1e+16 123456789", hamon::format("{} {}", 1e16, 123456789.0));
+	EXPECT_EQ("1e-05 3", hamon::format("{} {}", 1e-5, 3.0f));
+	EXPECT_EQ("3.142 3.14e+04 0.0001", hamon::format("{:.3f} {:.2e} {:g}", 3.14159, 31415.9, 0.0001));
+	EXPECT_EQ("1.8p+0 1.8P+0", hamon::format("{:a} {:A}", 1.5, 1.5));
+	EXPECT_EQ("     0.667", hamon::format("{:10.3}", 2.0 / 3));
+	EXPECT_EQ("0.100000000000000005551115123126", hamon::format("{:.30f}", 0.1));
+	EXPECT_EQ("1. 1.00000 0.000000e+00", hamon::format("{:#.0f} {:#g} {:e}", 1.0, 1.0, 0.0));
+	EXPECT_EQ("inf -inf", hamon::format("{} {}", inf, -inf));
+	EXPECT_EQ("      -inf +1", hamon::format("{:010} {:+}", -inf, 1.0f));
+}
+
+GTEST_TEST(FormatTest, BoolCharStringTest)
+{
+	EXPECT_EQ("true false 1 0x1", hamon::format("{} {:s} {:d} {:#x}", true, false, true, true));
+	EXPECT_EQ("a 97", hamon::format("{} {:d}", 'a', 'a'));
+	EXPECT_EQ("'\\n' \"a\\tb\\\"c\"", hamon::format("{:?} {:?}", '\n', "a\tb\"c"));
+	EXPECT_EQ("abc xy   |", hamon::format("{:.3} {:5.2}|", "abcdef", "xyz"));
+}
+
+GTEST_TEST(FormatTest, PointerTest)
+{
+	EXPECT_EQ("0x1234 0x0 0XABC", hamon::format("{:p} {} {:P}",
+		reinterpret_cast<void*>(0x1234), nullptr, reinterpret_cast<void const*>(0xabc)));
+}
+
+GTEST_TEST(FormatTest, AlignTest)
+{
+	EXPECT_EQ("       1|2       |   3    |", hamon::format("{:>8}|{:<8}|{:^8}|", 1, 2, 3));
+	EXPECT_EQ("***ab****", hamon::format("{:*^9}", "ab"));
+	EXPECT_EQ("    7 3.14", hamon::format("{:{}} {:.{}f}", 7, 5, 3.14159, 2));
+	EXPECT_EQ("  7", hamon::format("{0:{1}}", 7, 3));
+}
+
+GTEST_TEST(FormatTest, WideTest)
+{
+	EXPECT_EQ(L"wide c 42", hamon::format(L"{} {} {}", L"wide", 'c', 42));
+	EXPECT_EQ(L"  1.5", hamon::format(L"{:>5}", 1.5));
+}
+
+GTEST_TEST(FormatTest, RuntimeFormatTest)
+{
+	int const a = 1;
+	EXPECT_EQ("1", hamon::format(hamon::runtime_format("{}"), a));
+	EXPECT_THROW((void)hamon::format(hamon::runtime_format("{"), a), hamon::format_error);
+	EXPECT_THROW((void)hamon::format(hamon::runtime_format("}"), a), hamon::format_error);
+	EXPECT_THROW((void)hamon::format(hamon::runtime_format("{} {}"), a), hamon::format_error);
+	EXPECT_THROW((void)hamon::format(hamon::runtime_format("{0} {}"), a), hamon::format_error);
+	EXPECT_THROW((void)hamon::format(hamon::runtime_format("{:d}"), "x"), hamon::format_error);
+	EXPECT_THROW((void)hamon::format(hamon::runtime_format("{:{}}"), a, "x"), hamon::format_error);
+}
+
+#if defined(HAMON_HAS_CXX20_CONSTEVAL)
+template <typename... Args>
+bool is_compiled(hamon::format_string<Args...> fmt)
+{
+	return hamon::detail::format_string_access::compiled(fmt).compiled();
+}
+#endif
+
+GTEST_TEST(FormatTest, CompiledFormatStringTest)
+{
+	// コンパイル時に解析した書式文字列でも、runtime_format と同じ結果になる
+	hamon::vector<int> const v{1, 2};
+	EXPECT_EQ("a{b}c1d}", hamon::format("a{{b}}c{}d}}", 1));
+	EXPECT_EQ("a{b}c1d}", hamon::format(hamon::runtime_format("a{{b}}c{}d}}"), 1));
+	EXPECT_EQ("12", hamon::format("{}{}", 1, 2));
+	EXPECT_EQ("12", hamon::format(hamon::runtime_format("{}{}"), 1, 2));
+	EXPECT_EQ("1", hamon::format("{}", 1, 2));
+	EXPECT_EQ("1", hamon::format(hamon::runtime_format("{}"), 1, 2));
+	EXPECT_EQ("2 1", hamon::format("{1} {0}", 1, 2));
+	EXPECT_EQ("2 1", hamon::format(hamon::runtime_format("{1} {0}"), 1, 2));
+	EXPECT_EQ("[1, 2]|   [1, 2]", hamon::format("{}|{:>9}", v, v));
+	EXPECT_EQ("[1, 2]|   [1, 2]", hamon::format(hamon::runtime_format("{}|{:>9}"), v, v));
+	EXPECT_EQ("   [1, 2]", hamon::format("{:>{}}", v, 9));
+	EXPECT_EQ("   [1, 2]", hamon::format(hamon::runtime_format("{:>{}}"), v, 9));
+	EXPECT_EQ("(1,2) 0x2a true x", hamon::format("{} {:#x} {} {}", Point{1, 2}, 42, true, 'x'));
+	EXPECT_EQ("(1,2) 0x2a true x", hamon::format(hamon::runtime_format("{} {:#x} {} {}"), Point{1, 2}, 42, true, 'x'));
+
+#if defined(HAMON_HAS_CXX20_CONSTEVAL)
+	// 引数を先頭から順に1回ずつ使う場合だけ、解析結果を保持する
+	EXPECT_TRUE ((is_compiled<>("text only")));
+	EXPECT_TRUE ((is_compiled<int, char const*>("a{{b}}c{:>4}d{}")));
+	EXPECT_TRUE ((is_compiled<int, int>("{0} {1}")));
+	EXPECT_TRUE ((is_compiled<int, int>("{}")));
+	EXPECT_TRUE ((is_compiled<int, int>("{0:{1}}")));
+	EXPECT_TRUE ((is_compiled<hamon::vector<int>, double>("{:n} {:.3f}")));
+	EXPECT_FALSE((is_compiled<int, int>("{1} {0}")));
+	EXPECT_FALSE((is_compiled<int, int>("{0} {0}")));
+	EXPECT_FALSE((is_compiled<int, int, int>("{:{}} {}")));
+	EXPECT_FALSE((is_compiled<hamon::vector<int>, int>("{:>{}}")));
+#endif
+}
+
+}	// namespace format_test
+
+}	// namespace hamon_format_test
@@ -0,0 +1,64 @@
+﻿/**
+ *	@file	unit_test_format_format_to.cpp
+ *
+ *	@brief	format_to のテスト
+ */
+
+#include <hamon/format/format_to.hpp>
+#include <hamon/format/vformat_to.hpp>
+#include <hamon/format/make_format_args.hpp>
+#include <hamon/iterator/back_inserter.hpp>
+#include <hamon/string.hpp>
+#include <hamon/vector.hpp>
+#include <gtest/gtest.h>
+#include <string>
+
+namespace hamon_format_test
+{
+
+namespace format_to_test
+{
+
+GTEST_TEST(FormatToTest, BasicTest)
+{
+	{
+		std::string s;
+		auto it = hamon::format_to(hamon::back_inserter(s), "{}-{}", 1, "a");
+		*it++ = '!';
+		EXPECT_EQ("1-a!", s);
+	}
+	{
+		hamon::string s = "x";
+		hamon::format_to(hamon::back_inserter(s), "{:>4}", 12);
+		EXPECT_EQ("x  12", s);
+	}
+	{
+		hamon::vector<char> v;
+		hamon::format_to(hamon::back_inserter(v), "{:#x}", 255);
+		EXPECT_EQ((hamon::vector<char>{'0', 'x', 'f', 'f'}), v);
+	}
+	{
+		char buf[16]{};
+		char* last = hamon::format_to(buf, "{}{}", 12, 3.5);
+		EXPECT_EQ(5, last - buf);
+		EXPECT_EQ(hamon::string("123.5"), hamon::string(buf, last));
+	}
+	{
+		wchar_t buf[16]{};
+		wchar_t* last = hamon::format_to(buf, L"{:*<4}", L"ab");
+		EXPECT_EQ(hamon::wstring(L"ab**"), hamon::wstring(buf, last));
+	}
+}
+
+GTEST_TEST(FormatToTest, VFormatToTest)
+{
+	std::string s;
+	int const a = 10;
+	char const* b = "abc";
+	hamon::vformat_to(hamon::back_inserter(s), "{1}:{0:x}", hamon::make_format_args(a, b));
+	EXPECT_EQ("abc:a", s);
+}
+
+}	// namespace format_to_test
+
+}	// namespace hamon_format_test
@@ -0,0 +1,55 @@
+﻿/**
+ *	@file	unit_test_format_format_to_n.cpp
+ *
+ *	@brief	format_to_n のテスト
+ */
+
+#include <hamon/format/format_to_n.hpp>
+#include <hamon/string.hpp>
+#include <gtest/gtest.h>
+
+namespace hamon_format_test
+{
+
+namespace format_to_n_test
+{
+
+GTEST_TEST(FormatToNTest, BasicTest)
+{
+	{
+		char buf[8]{};
+		auto r = hamon::format_to_n(buf, 5, "{}", 1234567);
+		EXPECT_EQ(buf + 5, r.out);
+		EXPECT_EQ(7, r.size);
+		EXPECT_EQ(hamon::string("12345"), hamon::string(buf, r.out));
+	}
+	{
+		char buf[8]{};
+		auto r = hamon::format_to_n(buf, 8, "{}-{}", 1, 2);
+		EXPECT_EQ(buf + 3, r.out);
+		EXPECT_EQ(3, r.size);
+		EXPECT_EQ(hamon::string("1-2"), hamon::string(buf, r.out));
+	}
+	{
+		char buf[8]{};
+		auto r = hamon::format_to_n(buf, 0, "{:>10}", 1);
+		EXPECT_EQ(buf, r.out);
+		EXPECT_EQ(10, r.size);
+	}
+	{
+		char buf[8]{};
+		auto r = hamon::format_to_n(buf, -1, "{}", "abc");
+		EXPECT_EQ(buf, r.out);
+		EXPECT_EQ(3, r.size);
+	}
+	{
+		wchar_t buf[8]{};
+		auto r = hamon::format_to_n(buf, 3, L"{:*^7}", 1);
+		EXPECT_EQ(7, r.size);
+		EXPECT_EQ(hamon::wstring(L"***"), hamon::wstring(buf, r.out));
+	}
+}
+
+}	// namespace format_to_n_test
+
+}	// namespace hamon_format_test
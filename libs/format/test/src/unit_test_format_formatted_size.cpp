@@ -0,0 +1,28 @@
+﻿/**
+ *	@file	unit_test_format_formatted_size.cpp
+ *
+ *	@brief	formatted_size のテスト
+ */
+
+#include <hamon/format/formatted_size.hpp>
+#include <gtest/gtest.h>
+
+namespace hamon_format_test
+{
+
+namespace formatted_size_test
+{
+
+GTEST_TEST(FormattedSizeTest, BasicTest)
+{
+	EXPECT_EQ(0u, hamon::formatted_size(""));
+	EXPECT_EQ(10u, hamon::formatted_size("{:>10}", 1));
+	EXPECT_EQ(3u, hamon::formatted_size("{}", -12));
+	EXPECT_EQ(9u, hamon::formatted_size("{} {}", "hello", 3.5));
+	EXPECT_EQ(4u, hamon::formatted_size("{{{}}}", 10));
+	EXPECT_EQ(5u, hamon::formatted_size(L"{:5}", L"a"));
+}
+
+}	// namespace formatted_size_test
+
+}	// namespace hamon_format_test
@@ -0,0 +1,59 @@
+﻿/**
+ *	@file	unit_test_format_formatter_tuple.cpp
+ *
+ *	@brief	pair と tuple の formatter のテスト
+ */
+
+#include <hamon/format/format.hpp>
+#include <hamon/format/formattable.hpp>
+#include <hamon/format/runtime_format.hpp>
+#include <hamon/format/format_error.hpp>
+#include <hamon/pair.hpp>
+#include <hamon/string.hpp>
+#include <hamon/tuple.hpp>
+#include <gtest/gtest.h>
+#include <string>
+#include <tuple>
+#include <utility>
+
+namespace hamon_format_test
+{
+
+namespace formatter_tuple_test
+{
+
+static_assert( hamon::formattable_t<hamon::pair<int, char>, char>::value, "");
+static_assert( hamon::formattable_t<hamon::tuple<int, double, hamon::string>, char>::value, "");
+static_assert( hamon::formattable_t<hamon::tuple<>, char>::value, "");
+static_assert(!hamon::formattable_t<hamon::tuple<int, int*>, char>::value, "");
+
+GTEST_TEST(FormatterTupleTest, PairTest)
+{
+	EXPECT_EQ("(1, \"x\")", hamon::format("{}", hamon::make_pair(1, "x")));
+	EXPECT_EQ("1: 'c'", hamon::format("{:m}", hamon::make_pair(1, 'c')));
+	EXPECT_EQ("1, 2", hamon::format("{:n}", hamon::make_pair(1, 2)));
+	EXPECT_EQ("(1, 2)", hamon::format("{}", std::make_pair(1, 2)));
+}
+
+GTEST_TEST(FormatterTupleTest, TupleTest)
+{
+	EXPECT_EQ("()", hamon::format("{}", hamon::tuple<>{}));
+	EXPECT_EQ("(1, 2.5, \"s\", 'c')", hamon::format("{}", hamon::make_tuple(1, 2.5, "s", 'c')));
+	EXPECT_EQ("1, \"s\"", hamon::format("{:n}", std::make_tuple(1, std::string("s"))));
+	EXPECT_EQ("    (1, 2)", hamon::format("{:>10}", hamon::make_tuple(1, 2)));
+	EXPECT_EQ("(1, 2)----", hamon::format("{:-<10}", hamon::make_tuple(1, 2)));
+	EXPECT_EQ("--(1, 2)--", hamon::format("{:-^10}", hamon::make_tuple(1, 2)));
+	EXPECT_EQ("  (\"\xe3\x81\x82\", 1)", hamon::format("{:>11}", hamon::make_tuple(hamon::string("\xe3\x81\x82"), 1)));
+	EXPECT_EQ(L"(1, \"a\")", hamon::format(L"{}", hamon::make_tuple(1, L"a")));
+}
+
+GTEST_TEST(FormatterTupleTest, ErrorTest)
+{
+	auto const t = hamon::make_tuple(1, 2, 3);
+	EXPECT_THROW((void)hamon::format(hamon::runtime_format("{:m}"), t), hamon::format_error);
+	EXPECT_THROW((void)hamon::format(hamon::runtime_format("{:.2}"), t), hamon::format_error);
+}
+
+}	// namespace formatter_tuple_test
+
+}	// namespace hamon_format_test
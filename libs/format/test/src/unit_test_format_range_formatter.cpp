@@ -0,0 +1,211 @@
+﻿/**
+ *	@file	unit_test_format_range_formatter.cpp
+ *
+ *	@brief	range_formatter のテスト
+ */
+
+#include <hamon/format/range_formatter.hpp>
+#include <hamon/format/format.hpp>
+#include <hamon/format/format_context.hpp>
+#include <hamon/format/format_parse_context.hpp>
+#include <hamon/format/formatter.hpp>
+#include <hamon/format/format_kind.hpp>
+#include <hamon/format/formattable.hpp>
+#include <hamon/format/range_format.hpp>
+#include <hamon/array.hpp>
+#include <hamon/cstddef.hpp>
+#include <hamon/iterator.hpp>
+#include <hamon/ranges.hpp>
+#include <hamon/list.hpp>
+#include <hamon/map.hpp>
+#include <hamon/pair.hpp>
+#include <hamon/set.hpp>
+#include <hamon/string.hpp>
+#include <hamon/vector.hpp>
+#include <gtest/gtest.h>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace hamon_format_test
+{
+
+namespace range_formatter_test
+{
+
+struct IntList
+{
+	hamon::vector<int> m_values;
+};
+
+}	// namespace range_formatter_test
+
+}	// namespace hamon_format_test
+
+HAMON_FORMAT_START_NAMESPACE
+
+template <>
+struct formatter<hamon_format_test::range_formatter_test::IntList, char>
+{
+	range_formatter<int, char> m_formatter;
+
+	HAMON_CXX14_CONSTEXPR formatter()
+	{
+		m_formatter.set_separator("; ");
+		m_formatter.set_brackets("<", ">");
+	}
+
+	HAMON_CXX14_CONSTEXPR format_parse_context::iterator
+	parse(format_parse_context& pc)
+	{
+		return m_formatter.parse(pc);
+	}
+
+	format_context::iterator
+	format(hamon_format_test::range_formatter_test::IntList const& l, format_context& ctx) const
+	{
+		return m_formatter.format(l.m_values, ctx);
+	}
+};
+
+HAMON_FORMAT_END_NAMESPACE
+
+namespace hamon_format_test
+{
+
+namespace range_formatter_test
+{
+
+static_assert(HAMON_FORMAT_KIND(hamon::vector<int>) == hamon::range_format::sequence, "");
+static_assert(HAMON_FORMAT_KIND(hamon::list<int>) == hamon::range_format::sequence, "");
+static_assert(HAMON_FORMAT_KIND(hamon::set<int>) == hamon::range_format::set, "");
+static_assert(HAMON_FORMAT_KIND(hamon::map<int, int>) == hamon::range_format::map, "");
+static_assert(HAMON_FORMAT_KIND(std::map<int, int>) == hamon::range_format::map, "");
+
+static_assert( hamon::formattable_t<hamon::vector<int>, char>::value, "");
+static_assert( hamon::formattable_t<hamon::vector<hamon::vector<int>>, char>::value, "");
+static_assert( hamon::formattable_t<hamon::map<int, hamon::string>, char>::value, "");
+static_assert(!hamon::formattable_t<hamon::vector<int*>, char>::value, "");
+
+GTEST_TEST(RangeFormatterTest, SequenceTest)
+{
+	hamon::vector<int> const v{1, 2, 3};
+	EXPECT_EQ("[1, 2, 3]", hamon::format("{}", v));
+	EXPECT_EQ("[0x1, 0x2, 0x3]", hamon::format("{::#x}", v));
+	EXPECT_EQ("1, 2, 3", hamon::format("{:n}", v));
+	EXPECT_EQ("      [1, 2, 3]", hamon::format("{:>15}", v));
+	EXPECT_EQ("*[01, 02, 03]**", hamon::format("{:*^15:02}", v));
+	EXPECT_EQ("[]", hamon::format("{}", hamon::vector<int>{}));
+
+	hamon::list<int> const l{4, 5};
+	EXPECT_EQ("[4, 5]", hamon::format("{}", l));
+
+	int const arr[] = {5, 6};
+	EXPECT_EQ("[5, 6]", hamon::format("{}", arr));
+
+	hamon::array<double, 2> const a{{1.5, 2.5}};
+	EXPECT_EQ("[1.50, 2.50]", hamon::format("{::.2f}", a));
+
+	hamon::vector<hamon::vector<int>> const vv{{1, 2}, {3}};
+	EXPECT_EQ("[[1, 2], [3]]", hamon::format("{}", vv));
+
+	EXPECT_EQ(L"[1, 2]", hamon::format(L"{}", hamon::vector<int>{1, 2}));
+}
+
+GTEST_TEST(RangeFormatterTest, StringElementTest)
+{
+	std::vector<std::string> const vs{"a", "b\n"};
+	EXPECT_EQ("[\"a\", \"b\\n\"]", hamon::format("{}", vs));
+	EXPECT_EQ("[a, b\n]", hamon::format("{::}", vs));
+
+	hamon::vector<char> const cv{'h', 'i', '\t'};
+	EXPECT_EQ("['h', 'i', '\\t']", hamon::format("{}", cv));
+	EXPECT_EQ("hi\t", hamon::format("{:s}", cv));
+	EXPECT_EQ("\"hi\\t\"", hamon::format("{:?s}", cv));
+}
+
+GTEST_TEST(RangeFormatterTest, SetMapTest)
+{
+	hamon::set<int> const s{3, 1};
+	EXPECT_EQ("{1, 3}", hamon::format("{}", s));
+
+	hamon::map<int, hamon::string> const m{{1, "one"}, {2, "two"}};
+	EXPECT_EQ("{1: \"one\", 2: \"two\"}", hamon::format("{}", m));
+	EXPECT_EQ("1: \"one\", 2: \"two\"", hamon::format("{:n}", m));
+
+	std::map<std::string, double> const sm{{"x", 1.5}};
+	EXPECT_EQ("{\"x\": 1.5}", hamon::format("{}", sm));
+
+	hamon::vector<hamon::pair<int, int>> const vp{{1, 2}, {3, 4}};
+	EXPECT_EQ("[(1, 2), (3, 4)]", hamon::format("{}", vp));
+	EXPECT_EQ("{1: 2, 3: 4}", hamon::format("{:m}", vp));
+}
+
+// 1回しか走査できない範囲
+struct InputRange
+{
+	struct iterator
+	{
+		using iterator_concept = hamon::input_iterator_tag;
+		using iterator_category = hamon::input_iterator_tag;
+		using value_type = int;
+		using difference_type = hamon::ptrdiff_t;
+
+		int const* m_ptr;
+
+		int const& operator*() const { return *m_ptr; }
+		iterator& operator++() { ++m_ptr; return *this; }
+		void operator++(int) { ++m_ptr; }
+		bool operator==(iterator const& rhs) const { return m_ptr == rhs.m_ptr; }
+		bool operator!=(iterator const& rhs) const { return m_ptr != rhs.m_ptr; }
+	};
+
+	int const* m_first;
+	int const* m_last;
+
+	iterator begin() const { return {m_first}; }
+	iterator end() const { return {m_last}; }
+};
+
+GTEST_TEST(RangeFormatterTest, PaddingTest)
+{
+	// 表示幅を数えるバッファの大きさを超え、途中でコードポイントが切れる長さにする
+	hamon::vector<hamon::string> v;
+	hamon::string elements;
+	for (int i = 0; i < 100; ++i)
+	{
+		v.push_back("\xe3\x81\x82");	// "あ" (表示幅 2)
+		elements += (i == 0) ? "" : ", ";
+		elements += "\xe3\x81\x82";
+	}
+	hamon::string const s = "[" + elements + "]";	// 表示幅 400
+
+	EXPECT_EQ(s + "*****", hamon::format("{:*<405:}", v));
+	EXPECT_EQ("*****" + s, hamon::format("{:*>405:}", v));
+	EXPECT_EQ("**" + s + "***", hamon::format("{:*^405:}", v));
+	EXPECT_EQ(s, hamon::format("{:*^400:}", v));
+
+	int const arr[] = {1, 2, 3};
+	InputRange const r{arr, arr + 3};
+	static_assert(!hamon::ranges::forward_range_t<InputRange const>::value, "");
+	EXPECT_EQ("[1, 2, 3]--", hamon::format("{:-<11}", r));
+	EXPECT_EQ("--[1, 2, 3]", hamon::format("{:->11}", r));
+	EXPECT_EQ("-[1, 2, 3]-", hamon::format("{:-^11}", r));
+
+	hamon::vector<char> const cv{'h', 'i', '\t'};
+	EXPECT_EQ("hi\t  ", hamon::format("{:5s}", cv));
+	EXPECT_EQ("**\"hi\\t\"", hamon::format("{:*>8?s}", cv));
+	EXPECT_EQ("\"hi\\t\"*", hamon::format("{:*<7?s}", cv));
+}
+
+GTEST_TEST(RangeFormatterTest, CustomFormatterTest)
+{
+	IntList const l{{1, 2, 3}};
+	EXPECT_EQ("<1; 2; 3>", hamon::format("{}", l));
+	EXPECT_EQ("<01; 02; 03>", hamon::format("{::02}", l));
+	EXPECT_EQ("1; 2; 3", hamon::format("{:n}", l));
+}
+
+}	// namespace range_formatter_test
+
+}	// namespace hamon_format_test
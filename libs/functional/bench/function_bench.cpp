@@ -0,0 +1,207 @@
+﻿/**
+ *	@file	function_bench.cpp
+ *
+ *	@brief	型消去した関数オブジェクトのベンチマーク
+ *
+ *	std::function, hamon::function, hamon::move_only_function,
+ *	hamon::function_ref, hamon::inplace_function について、次の時間を出力する。
+ *		call          : 格納済みの関数オブジェクトを呼び出す1回あたりの時間
+ *		construct 8B  : 8バイトの状態を持つ関数オブジェクトから構築して破棄する1回あたりの時間
+ *		construct 40B : 40バイトの状態を持つ関数オブジェクトから構築して破棄する1回あたりの時間
+ *
+ *	呼び出しは2種類の関数オブジェクトを交互に格納した配列に対して行うので、
+ *	コンパイラは呼び出し先を特定できない。
+ *
+ *	使い方:
+ *		function_bench
+ */
+
+#include <hamon/functional/function.hpp>
+#include <hamon/functional/function_ref.hpp>
+#include <hamon/functional/inplace_function.hpp>
+#include <hamon/functional/move_only_function.hpp>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <functional>
+#include <vector>
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+int const kCount = 1024;
+
+struct Small
+{
+	int const* p;
+	int operator()(int x) const { return x + *p; }
+};
+
+struct Small2
+{
+	int const* p;
+	int operator()(int x) const { return x ^ *p; }
+};
+
+struct Large
+{
+	explicit Large(int const* q) : p(q), a{1, 2, 3, 4} {}
+
+	int const* p;
+	long long a[4];
+	int operator()(int x) const { return x + *p + static_cast<int>(a[x & 3]); }
+};
+
+// f を 300ms 繰り返し、1回あたりの時間 [ns] を返す (f は kCount 回の処理を行う)
+template <typename F>
+double measure(F f)
+{
+	long long sink = 0;
+	long long count = 0;
+	auto const start = Clock::now();
+	auto end = start;
+	do
+	{
+		sink += f();
+		count += kCount;
+		end = Clock::now();
+	}
+	while (end - start < std::chrono::milliseconds(300));
+	if (sink == 0)
+	{
+		std::printf(" ");
+	}
+	return std::chrono::duration<double, std::nano>(end - start).count() / static_cast<double>(count);
+}
+
+template <typename Function>
+double call_bench()
+{
+	static int const value = 1;
+	std::vector<Function> v;
+	v.reserve(kCount);
+	for (int i = 0; i < kCount; ++i)
+	{
+		if (i % 2 == 0)
+		{
+			v.emplace_back(Small{&value});
+		}
+		else
+		{
+			v.emplace_back(Small2{&value});
+		}
+	}
+
+	return measure([&]
+	{
+		long long sum = 0;
+		for (int i = 0; i < kCount; ++i)
+		{
+			sum += v[static_cast<std::size_t>(i)](i);
+		}
+		return sum;
+	});
+}
+
+double call_bench_ref()
+{
+	static int const value = 1;
+	Small  s1{&value};
+	Small2 s2{&value};
+	std::vector<hamon::function_ref<int(int)>> v;
+	v.reserve(kCount);
+	for (int i = 0; i < kCount; ++i)
+	{
+		if (i % 2 == 0)
+		{
+			v.emplace_back(s1);
+		}
+		else
+		{
+			v.emplace_back(s2);
+		}
+	}
+
+	return measure([&]
+	{
+		long long sum = 0;
+		for (int i = 0; i < kCount; ++i)
+		{
+			sum += v[static_cast<std::size_t>(i)](i);
+		}
+		return sum;
+	});
+}
+
+template <typename Function, typename Callable>
+double construct_bench()
+{
+	static int const value = 1;
+	std::vector<Function> v;
+	v.reserve(kCount);
+
+	return measure([&]
+	{
+		for (int i = 0; i < kCount; ++i)
+		{
+			v.emplace_back(Callable{&value});
+		}
+		long long const result = v[static_cast<std::size_t>(kCount / 2)](1);
+		v.clear();
+		return result;
+	});
+}
+
+double construct_bench_ref()
+{
+	static int const value = 1;
+	Small const s{&value};
+	std::vector<hamon::function_ref<int(int)>> v;
+	v.reserve(kCount);
+
+	return measure([&]
+	{
+		for (int i = 0; i < kCount; ++i)
+		{
+			v.emplace_back(s);
+		}
+		long long const result = v[static_cast<std::size_t>(kCount / 2)](1);
+		v.clear();
+		return result;
+	});
+}
+
+}	// namespace
+
+int main()
+{
+	using std_function   = std::function<int(int)>;
+	using function       = hamon::function<int(int)>;
+	using mo_function    = hamon::move_only_function<int(int)>;
+	using inplace_small  = hamon::inplace_function<int(int)>;
+	using inplace_large  = hamon::inplace_function<int(int), 48>;
+
+	std::printf("%-22s %12s %18s %18s\n", "", "call [ns]", "construct 8B [ns]", "construct 40B [ns]");
+	std::printf("%-22s %12.2f %18.2f %18.2f\n", "std::function",
+		call_bench<std_function>(),
+		construct_bench<std_function, Small>(),
+		construct_bench<std_function, Large>());
+	std::printf("%-22s %12.2f %18.2f %18.2f\n", "function",
+		call_bench<function>(),
+		construct_bench<function, Small>(),
+		construct_bench<function, Large>());
+	std::printf("%-22s %12.2f %18.2f %18.2f\n", "move_only_function",
+		call_bench<mo_function>(),
+		construct_bench<mo_function, Small>(),
+		construct_bench<mo_function, Large>());
+	std::printf("%-22s %12.2f %18.2f %18s\n", "function_ref",
+		call_bench_ref(),
+		construct_bench_ref(),
+		"-");
+	std::printf("%-22s %12.2f %18.2f %18.2f\n", "inplace_function<48>",
+		call_bench<inplace_large>(),
+		construct_bench<inplace_small, Small>(),
+		construct_bench<inplace_large, Large>());
+}
@@ -8,6 +8,7 @@
 #define HAMON_FUNCTIONAL_HPP
 
 //#include <hamon/functional/bind.hpp>
+#include <hamon/functional/bad_function_call.hpp>
 #include <hamon/functional/bind_back.hpp>
 #include <hamon/functional/bind_front.hpp>
 #include <hamon/functional/bit_and.hpp>
@@ -21,12 +22,14 @@
 #include <hamon/functional/default_searcher.hpp>
 #include <hamon/functional/divides.hpp>
 #include <hamon/functional/equal_to.hpp>
-//#include <hamon/functional/function.hpp>
+#include <hamon/functional/function.hpp>
+#include <hamon/functional/function_ref.hpp>
 #include <hamon/functional/greater.hpp>
 #include <hamon/functional/greater_equal.hpp>
 #include <hamon/functional/hash.hpp>
 #include <hamon/functional/hash_combine.hpp>
 #include <hamon/functional/identity.hpp>
+#include <hamon/functional/inplace_function.hpp>
 #include <hamon/functional/invoke.hpp>
 #include <hamon/functional/invoke_r.hpp>
 //#include <hamon/functional/is_bind_expression.hpp>
@@ -38,6 +41,7 @@
 #include <hamon/functional/logical_or.hpp>
 #include <hamon/functional/minus.hpp>
 #include <hamon/functional/modulus.hpp>
+#include <hamon/functional/move_only_function.hpp>
 #include <hamon/functional/multiplies.hpp>
 #include <hamon/functional/negate.hpp>
 #include <hamon/functional/not_equal_to.hpp>
@@ -0,0 +1,36 @@
+﻿/**
+ *	@file	bad_function_call.hpp
+ *
+ *	@brief	bad_function_call の定義
+ */
+
+#ifndef HAMON_FUNCTIONAL_BAD_FUNCTION_CALL_HPP
+#define HAMON_FUNCTIONAL_BAD_FUNCTION_CALL_HPP
+
+#include <hamon/cstdlib/abort.hpp>
+#include <hamon/config.hpp>
+#include <functional>
+
+namespace hamon
+{
+
+// [func.wrap.badcall], class bad_function_call
+using std::bad_function_call;
+
+namespace detail
+{
+
+HAMON_NORETURN inline void throw_bad_function_call()
+{
+#if !defined(HAMON_NO_EXCEPTIONS)
+	throw hamon::bad_function_call();
+#else
+	hamon::abort();
+#endif
+}
+
+}	// namespace detail
+
+}	// namespace hamon
+
+#endif // HAMON_FUNCTIONAL_BAD_FUNCTION_CALL_HPP
@@ -0,0 +1,47 @@
+﻿/**
+ *	@file	callable_is_null.hpp
+ *
+ *	@brief	callable_is_null の定義
+ */
+
+#ifndef HAMON_FUNCTIONAL_DETAIL_CALLABLE_IS_NULL_HPP
+#define HAMON_FUNCTIONAL_DETAIL_CALLABLE_IS_NULL_HPP
+
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+namespace detail
+{
+
+// 関数ポインタやメンバポインタが null かどうか。
+// function 等は null の関数ポインタから構築したとき空になる。
+// ([func.wrap.func.con]/8, [func.wrap.move.ctor]/8)
+
+template <typename F>
+HAMON_CXX11_CONSTEXPR bool
+callable_is_null(F const&) HAMON_NOEXCEPT
+{
+	return false;
+}
+
+template <typename T>
+HAMON_CXX11_CONSTEXPR bool
+callable_is_null(T* p) HAMON_NOEXCEPT
+{
+	return p == nullptr;
+}
+
+template <typename T, typename C>
+HAMON_CXX11_CONSTEXPR bool
+callable_is_null(T C::* p) HAMON_NOEXCEPT
+{
+	return p == nullptr;
+}
+
+}	// namespace detail
+
+}	// namespace hamon
+
+#endif // HAMON_FUNCTIONAL_DETAIL_CALLABLE_IS_NULL_HPP
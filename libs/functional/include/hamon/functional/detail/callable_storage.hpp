@@ -0,0 +1,236 @@
+﻿/**
+ *	@file	callable_storage.hpp
+ *
+ *	@brief	callable_storage の定義
+ */
+
+#ifndef HAMON_FUNCTIONAL_DETAIL_CALLABLE_STORAGE_HPP
+#define HAMON_FUNCTIONAL_DETAIL_CALLABLE_STORAGE_HPP
+
+#include <hamon/cstddef/byte.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/memory/construct_at.hpp>
+#include <hamon/memory/destroy_at.hpp>
+#include <hamon/type_traits/bool_constant.hpp>
+#include <hamon/type_traits/is_nothrow_move_constructible.hpp>
+#include <hamon/type_traits/is_trivially_copyable.hpp>
+#include <hamon/utility/forward.hpp>
+#include <hamon/utility/move.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+namespace detail
+{
+
+/**
+ *	@brief	型消去された関数オブジェクトを格納する
+ *
+ *	@tparam	Size		オブジェクト内部のバッファの大きさ
+ *	@tparam	Align		オブジェクト内部のバッファのアライメント
+ *	@tparam	Copyable	コピーできるかどうか
+ *	@tparam	AllowHeap	バッファに収まらないオブジェクトをヒープに確保するかどうか
+ *						(false のときは、収まらないオブジェクトを格納しようとするとコンパイルエラー)
+ *
+ *	バッファに収まり、例外を投げずにムーブできるオブジェクトはバッファに直接構築する。
+ *	バッファに収まり、トリビアルにコピーできるオブジェクトは管理関数を持たず、
+ *	ムーブとコピーはバッファのコピー、破棄は何もしない。
+ *
+ *	空かどうかはこのクラスでは管理しない (呼び出し関数を持つ側で管理する)。
+ */
+template <hamon::size_t Size, hamon::size_t Align, bool Copyable, bool AllowHeap>
+class callable_storage
+{
+private:
+	enum class Action
+	{
+		Copy,
+		Move,
+		Destroy,
+	};
+
+	union Storage
+	{
+		void* m_ptr;
+		alignas(Align) hamon::byte m_buf[Size];
+	};
+
+	using ManagerType = void(*)(Action, callable_storage*, callable_storage*);
+
+public:
+	// オブジェクト内部のバッファに格納するかどうか
+	template <typename T>
+	struct is_local
+		: public hamon::bool_constant<
+			(sizeof(T) <= Size) &&
+			(Align % alignof(T) == 0) &&
+			hamon::is_nothrow_move_constructible<T>::value
+		>
+	{};
+
+private:
+	template <typename T, bool = is_local<T>::value>
+	struct Impl
+	{
+		static void manage(Action action, callable_storage* lhs, callable_storage* rhs)
+		{
+			switch (action)
+			{
+			case Action::Copy:
+				copy(lhs, rhs, hamon::bool_constant<Copyable>{});
+				break;
+			case Action::Move:
+				lhs->m_storage.m_ptr = rhs->m_storage.m_ptr;
+				break;
+			case Action::Destroy:
+				delete get(lhs->m_storage);
+				break;
+			}
+		}
+
+		static void copy(callable_storage* lhs, callable_storage* rhs, hamon::true_type)
+		{
+			lhs->m_storage.m_ptr = new T(*get(rhs->m_storage));
+		}
+
+		static void copy(callable_storage*, callable_storage*, hamon::false_type)
+		{
+		}
+
+		template <typename... Args>
+		static void construct(callable_storage* self, Args&&... args)
+		{
+			static_assert(AllowHeap,
+				"The callable object must fit in the buffer and be nothrow move constructible.");
+			self->m_storage.m_ptr = new T(hamon::forward<Args>(args)...);
+			self->m_manager = &Impl::manage;
+		}
+
+		static T* get(Storage& s) HAMON_NOEXCEPT
+		{
+			return static_cast<T*>(s.m_ptr);
+		}
+	};
+
+	template <typename T>
+	struct Impl<T, true>
+	{
+		static void manage(Action action, callable_storage* lhs, callable_storage* rhs)
+		{
+			switch (action)
+			{
+			case Action::Copy:
+				copy(lhs, rhs, hamon::bool_constant<Copyable>{});
+				break;
+			case Action::Move:
+				hamon::construct_at(get(lhs->m_storage), hamon::move(*get(rhs->m_storage)));
+				hamon::destroy_at(get(rhs->m_storage));
+				break;
+			case Action::Destroy:
+				hamon::destroy_at(get(lhs->m_storage));
+				break;
+			}
+		}
+
+		static void copy(callable_storage* lhs, callable_storage* rhs, hamon::true_type)
+		{
+			hamon::construct_at(get(lhs->m_storage), *get(rhs->m_storage));
+		}
+
+		static void copy(callable_storage*, callable_storage*, hamon::false_type)
+		{
+		}
+
+		template <typename... Args>
+		static void construct(callable_storage* self, Args&&... args)
+		{
+			hamon::construct_at(get(self->m_storage), hamon::forward<Args>(args)...);
+			self->m_manager =
+				hamon::is_trivially_copyable<T>::value ? nullptr : &Impl::manage;
+		}
+
+		static T* get(Storage& s) HAMON_NOEXCEPT
+		{
+			return static_cast<T*>(static_cast<void*>(s.m_buf));
+		}
+	};
+
+	Storage		m_storage;
+	ManagerType	m_manager;
+
+public:
+	callable_storage() HAMON_NOEXCEPT
+		: m_manager(nullptr)
+	{}
+
+	callable_storage(callable_storage const&) = delete;
+	callable_storage& operator=(callable_storage const&) = delete;
+
+	~callable_storage()
+	{
+		destroy();
+	}
+
+	// 格納しているオブジェクトを T として取得する
+	template <typename T>
+	T* get() HAMON_NOEXCEPT
+	{
+		return Impl<T>::get(m_storage);
+	}
+
+	// 空の状態で呼ぶ
+	template <typename T, typename... Args>
+	void construct(Args&&... args)
+	{
+		Impl<T>::construct(this, hamon::forward<Args>(args)...);
+	}
+
+	// 空の状態にする。
+	// 既にオブジェクトが無い (またはトリビアルに破棄できる) ときは何もしない
+	void destroy() HAMON_NOEXCEPT
+	{
+		if (m_manager != nullptr)
+		{
+			m_manager(Action::Destroy, this, nullptr);
+			m_manager = nullptr;
+		}
+	}
+
+	// 空の状態で呼ぶ。rhs は空の状態になる
+	void move_from(callable_storage& rhs) HAMON_NOEXCEPT
+	{
+		if (rhs.m_manager != nullptr)
+		{
+			rhs.m_manager(Action::Move, this, &rhs);
+			m_manager = rhs.m_manager;
+			rhs.m_manager = nullptr;
+		}
+		else
+		{
+			m_storage = rhs.m_storage;
+		}
+	}
+
+	// 空の状態で呼ぶ
+	void copy_from(callable_storage const& rhs)
+	{
+		static_assert(Copyable, "");
+		auto& r = const_cast<callable_storage&>(rhs);
+		if (r.m_manager != nullptr)
+		{
+			r.m_manager(Action::Copy, this, &r);
+			m_manager = r.m_manager;
+		}
+		else
+		{
+			m_storage = r.m_storage;
+		}
+	}
+};
+
+}	// namespace detail
+
+}	// namespace hamon
+
+#endif // HAMON_FUNCTIONAL_DETAIL_CALLABLE_STORAGE_HPP
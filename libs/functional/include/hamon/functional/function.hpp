@@ -0,0 +1,227 @@
+﻿/**
+ *	@file	function.hpp
+ *
+ *	@brief	function の定義
+ */
+
+#ifndef HAMON_FUNCTIONAL_FUNCTION_HPP
+#define HAMON_FUNCTIONAL_FUNCTION_HPP
+
+#include <hamon/functional/bad_function_call.hpp>
+#include <hamon/functional/invoke_r.hpp>
+#include <hamon/functional/detail/callable_is_null.hpp>
+#include <hamon/functional/detail/callable_storage.hpp>
+#include <hamon/cstddef/max_align_t.hpp>
+#include <hamon/cstddef/nullptr_t.hpp>
+#include <hamon/type_traits/decay.hpp>
+#include <hamon/type_traits/enable_if.hpp>
+#include <hamon/type_traits/is_copy_constructible.hpp>
+#include <hamon/type_traits/is_invocable_r.hpp>
+#include <hamon/type_traits/is_same.hpp>
+#include <hamon/type_traits/remove_cvref.hpp>
+#include <hamon/utility/forward.hpp>
+#include <hamon/utility/move.hpp>
+#include <hamon/utility/swap.hpp>
+#include <hamon/config.hpp>
+
+// function がメモリ確保せずに格納できる関数オブジェクトの大きさ
+#if !defined(HAMON_FUNCTION_INLINE_SIZE)
+#  define HAMON_FUNCTION_INLINE_SIZE (sizeof(void*) * 6)
+#endif
+
+namespace hamon
+{
+
+// [func.wrap.func], class template function
+template <typename>
+class function;	// not defined
+
+/**
+ *	@brief	コピーできる関数オブジェクトを型消去して保持する
+ *
+ *	std::function との違い:
+ *	・HAMON_FUNCTION_INLINE_SIZE バイト (デフォルトはポインタ6個分) までの、
+ *	  例外を投げずにムーブできる関数オブジェクトはメモリ確保せずに格納する
+ *	・target() と target_type() は持たない
+ */
+template <typename R, typename... Args>
+class function<R(Args...)>
+{
+private:
+	using storage_type = hamon::detail::callable_storage<
+		HAMON_FUNCTION_INLINE_SIZE, alignof(hamon::max_align_t), true, true>;
+
+	using invoker_type = R(*)(storage_type&, Args&&...);
+
+	template <typename T>
+	static R invoke_impl(storage_type& s, Args&&... args)
+	{
+		return hamon::invoke_r<R>(*s.template get<T>(), hamon::forward<Args>(args)...);
+	}
+
+	template <typename F>
+	static bool is_null(F const& f) HAMON_NOEXCEPT
+	{
+		return hamon::detail::callable_is_null(f);
+	}
+
+	template <typename Sig>
+	static bool is_null(function<Sig> const& f) HAMON_NOEXCEPT
+	{
+		return !f;
+	}
+
+	mutable storage_type	m_storage;
+	invoker_type			m_invoker = nullptr;
+
+public:
+	using result_type = R;
+
+	// [func.wrap.func.con], construct/copy/destroy
+	function() HAMON_NOEXCEPT
+	{}
+
+	function(hamon::nullptr_t) HAMON_NOEXCEPT
+	{}
+
+	function(function const& f)
+	{
+		if (f.m_invoker != nullptr)
+		{
+			m_storage.copy_from(f.m_storage);
+			m_invoker = f.m_invoker;
+		}
+	}
+
+	function(function&& f) HAMON_NOEXCEPT
+	{
+		m_storage.move_from(f.m_storage);
+		m_invoker = f.m_invoker;
+		f.m_invoker = nullptr;
+	}
+
+	template <typename F,
+		typename FD = hamon::decay_t<F>,
+		typename = hamon::enable_if_t<
+			!hamon::is_same<hamon::remove_cvref_t<F>, function>::value &&
+			hamon::is_invocable_r<R, FD&, Args...>::value
+		>
+	>
+	function(F&& f)
+	{
+		// [func.wrap.func.con]/10
+		static_assert(hamon::is_copy_constructible<FD>::value, "");
+
+		if (!is_null(f))
+		{
+			m_storage.template construct<FD>(hamon::forward<F>(f));
+			m_invoker = &invoke_impl<FD>;
+		}
+	}
+
+	function& operator=(function const& f)
+	{
+		function(f).swap(*this);
+		return *this;
+	}
+
+	function& operator=(function&& f) HAMON_NOEXCEPT
+	{
+		if (this != &f)
+		{
+			m_storage.destroy();
+			m_storage.move_from(f.m_storage);
+			m_invoker = f.m_invoker;
+			f.m_invoker = nullptr;
+		}
+		return *this;
+	}
+
+	function& operator=(hamon::nullptr_t) HAMON_NOEXCEPT
+	{
+		m_storage.destroy();
+		m_invoker = nullptr;
+		return *this;
+	}
+
+	template <typename F,
+		typename = hamon::enable_if_t<
+			!hamon::is_same<hamon::remove_cvref_t<F>, function>::value &&
+			hamon::is_invocable_r<R, hamon::decay_t<F>&, Args...>::value
+		>
+	>
+	function& operator=(F&& f)
+	{
+		function(hamon::forward<F>(f)).swap(*this);
+		return *this;
+	}
+
+	~function() = default;
+
+	// [func.wrap.func.mod], function modifiers
+	void swap(function& other) HAMON_NOEXCEPT
+	{
+		storage_type tmp;
+		tmp.move_from(other.m_storage);
+		other.m_storage.move_from(m_storage);
+		m_storage.move_from(tmp);
+		hamon::swap(m_invoker, other.m_invoker);
+	}
+
+	// [func.wrap.func.cap], function capacity
+	explicit operator bool() const HAMON_NOEXCEPT
+	{
+		return m_invoker != nullptr;
+	}
+
+	// [func.wrap.func.inv], function invocation
+	R operator()(Args... args) const
+	{
+		if (m_invoker == nullptr)
+		{
+			hamon::detail::throw_bad_function_call();
+		}
+
+		return m_invoker(m_storage, hamon::forward<Args>(args)...);
+	}
+
+	// [func.wrap.func.nullptr], null pointer comparison operator functions
+	friend bool operator==(function const& f, hamon::nullptr_t) HAMON_NOEXCEPT
+	{
+		return !f;
+	}
+
+#if !defined(HAMON_HAS_CXX20_THREE_WAY_COMPARISON)
+	friend bool operator==(hamon::nullptr_t, function const& f) HAMON_NOEXCEPT
+	{
+		return !f;
+	}
+
+	friend bool operator!=(function const& f, hamon::nullptr_t) HAMON_NOEXCEPT
+	{
+		return static_cast<bool>(f);
+	}
+
+	friend bool operator!=(hamon::nullptr_t, function const& f) HAMON_NOEXCEPT
+	{
+		return static_cast<bool>(f);
+	}
+#endif
+
+	// [func.wrap.func.alg], specialized algorithms
+	friend void swap(function& f1, function& f2) HAMON_NOEXCEPT
+	{
+		f1.swap(f2);
+	}
+};
+
+#if defined(HAMON_HAS_CXX17_DEDUCTION_GUIDES)
+
+template <typename R, typename... Args>
+function(R(*)(Args...)) -> function<R(Args...)>;
+
+#endif
+
+}	// namespace hamon
+
+#endif // HAMON_FUNCTIONAL_FUNCTION_HPP
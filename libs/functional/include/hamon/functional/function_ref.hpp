@@ -0,0 +1,205 @@
+﻿/**
+ *	@file	function_ref.hpp
+ *
+ *	@brief	function_ref の定義
+ */
+
+#ifndef HAMON_FUNCTIONAL_FUNCTION_REF_HPP
+#define HAMON_FUNCTIONAL_FUNCTION_REF_HPP
+
+#include <hamon/functional/invoke_r.hpp>
+#include <hamon/memory/addressof.hpp>
+#include <hamon/type_traits/bool_constant.hpp>
+#include <hamon/type_traits/conditional.hpp>
+#include <hamon/type_traits/enable_if.hpp>
+#include <hamon/type_traits/is_function.hpp>
+#include <hamon/type_traits/is_invocable_r.hpp>
+#include <hamon/type_traits/is_member_pointer.hpp>
+#include <hamon/type_traits/is_nothrow_invocable_r.hpp>
+#include <hamon/type_traits/is_pointer.hpp>
+#include <hamon/type_traits/is_same.hpp>
+#include <hamon/type_traits/remove_cvref.hpp>
+#include <hamon/type_traits/remove_reference.hpp>
+#include <hamon/utility/forward.hpp>
+#include <hamon/preprocessor/empty.hpp>
+#include <hamon/assert.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+// [func.wrap.ref.class], class template function_ref
+template <typename... S>
+class function_ref;	// not defined
+
+namespace detail
+{
+
+namespace function_ref_detail
+{
+
+// [func.wrap.ref.class]/1 bound-entity
+union bound_entity
+{
+	void* m_obj;
+	void (*m_fn)();
+};
+
+/**
+ *	@brief	function_ref の operator() 以外の実装
+ *
+ *	呼び出す関数オブジェクトへのポインタと、呼び出し関数へのポインタだけを持つ。
+ *	関数オブジェクトの寿命は管理しない。
+ */
+template <typename Derived, bool Const, bool Noex, typename R, typename... Args>
+class function_ref_base
+{
+private:
+	template <typename T>
+	using cv = hamon::conditional_t<Const, T const, T>;
+
+	// [func.wrap.ref.class]/2
+	template <typename T>
+	struct is_invocable_using
+		: public hamon::conditional_t<Noex,
+			hamon::is_nothrow_invocable_r<R, T, Args...>,
+			hamon::is_invocable_r<R, T, Args...>
+		>
+	{};
+
+	using thunk_type = R(*)(bound_entity, Args&&...);
+
+	template <typename F>
+	static R fn_thunk(bound_entity e, Args&&... args) HAMON_NOEXCEPT_IF(Noex)
+	{
+		return hamon::invoke_r<R>(reinterpret_cast<F*>(e.m_fn), hamon::forward<Args>(args)...);
+	}
+
+	template <typename T>
+	static R obj_thunk(bound_entity e, Args&&... args) HAMON_NOEXCEPT_IF(Noex)
+	{
+		return hamon::invoke_r<R>(
+			static_cast<cv<T>&>(*static_cast<cv<T>*>(e.m_obj)), hamon::forward<Args>(args)...);
+	}
+
+	template <typename F>
+	void bind(F* f, hamon::true_type) HAMON_NOEXCEPT
+	{
+		m_bound.m_fn = reinterpret_cast<void(*)()>(f);
+		m_thunk = &fn_thunk<F>;
+	}
+
+	template <typename T>
+	void bind(T* obj, hamon::false_type) HAMON_NOEXCEPT
+	{
+		m_bound.m_obj = const_cast<void*>(static_cast<void const*>(obj));
+		m_thunk = &obj_thunk<T>;
+	}
+
+	bound_entity	m_bound;
+	thunk_type		m_thunk;
+
+public:
+	// [func.wrap.ref.ctor], constructors and assignment operators
+	template <typename F,
+		typename = hamon::enable_if_t<
+			hamon::is_function<F>::value &&
+			is_invocable_using<F>::value
+		>
+	>
+	function_ref_base(F* f) HAMON_NOEXCEPT
+	{
+		// [func.wrap.ref.ctor]/2
+		HAMON_ASSERT(f != nullptr);
+		bind(f, hamon::true_type{});
+	}
+
+	template <typename F,
+		typename T = hamon::remove_reference_t<F>,
+		typename = hamon::enable_if_t<
+			!hamon::is_same<hamon::remove_cvref_t<F>, Derived>::value &&
+			!hamon::is_member_pointer<T>::value &&
+			is_invocable_using<cv<T>&>::value
+		>
+	>
+	function_ref_base(F&& f) HAMON_NOEXCEPT
+	{
+		bind(hamon::addressof(f), hamon::is_function<T>{});
+	}
+
+	function_ref_base(function_ref_base const&) HAMON_NOEXCEPT = default;
+
+	function_ref_base& operator=(function_ref_base const&) HAMON_NOEXCEPT = default;
+
+	// [func.wrap.ref.ctor]/16
+	template <typename T,
+		typename = hamon::enable_if_t<
+			!hamon::is_same<T, Derived>::value &&
+			!hamon::is_pointer<T>::value
+		>
+	>
+	Derived& operator=(T) = delete;
+
+protected:
+	R call(Args&&... args) const HAMON_NOEXCEPT_IF(Noex)
+	{
+		return m_thunk(m_bound, hamon::forward<Args>(args)...);
+	}
+};
+
+}	// namespace function_ref_detail
+
+}	// namespace detail
+
+#define HAMON_FUNCTION_REF_SPEC(CV, CONST, NOEX_SPEC, NOEX)                      \
+template <typename R, typename... Args>                                         \
+class function_ref<R(Args...) CV NOEX_SPEC>                                     \
+	: public detail::function_ref_detail::function_ref_base<                    \
+		function_ref<R(Args...) CV NOEX_SPEC>, CONST, NOEX, R, Args...>         \
+{                                                                               \
+private:                                                                        \
+	using base_type = detail::function_ref_detail::function_ref_base<           \
+		function_ref, CONST, NOEX, R, Args...>;                                 \
+                                                                                \
+public:                                                                         \
+	using base_type::base_type;                                                 \
+	using base_type::operator=;                                                 \
+                                                                                \
+	/* [func.wrap.ref.inv], invocation */                                       \
+	R operator()(Args... args) const NOEX_SPEC                                  \
+	{                                                                           \
+		return this->call(hamon::forward<Args>(args)...);                       \
+	}                                                                           \
+}
+
+#if defined(HAMON_HAS_CXX17_NOEXCEPT_FUNCTION_TYPE)
+
+#define HAMON_FUNCTION_REF_SPEC_NOEX(CV, CONST)                    \
+	HAMON_FUNCTION_REF_SPEC(CV, CONST, HAMON_PP_EMPTY(), false);   \
+	HAMON_FUNCTION_REF_SPEC(CV, CONST, noexcept, true)
+
+#else
+
+#define HAMON_FUNCTION_REF_SPEC_NOEX(CV, CONST)                    \
+	HAMON_FUNCTION_REF_SPEC(CV, CONST, HAMON_PP_EMPTY(), false)
+
+#endif
+
+HAMON_FUNCTION_REF_SPEC_NOEX(HAMON_PP_EMPTY(), false);
+HAMON_FUNCTION_REF_SPEC_NOEX(const,            true);
+
+#undef HAMON_FUNCTION_REF_SPEC_NOEX
+#undef HAMON_FUNCTION_REF_SPEC
+
+#if defined(HAMON_HAS_CXX17_DEDUCTION_GUIDES)
+
+// [func.wrap.ref.deduct], deduction guides
+template <typename F,
+	typename = hamon::enable_if_t<hamon::is_function<F>::value>>
+function_ref(F*) -> function_ref<F>;
+
+#endif
+
+}	// namespace hamon
+
+#endif // HAMON_FUNCTIONAL_FUNCTION_REF_HPP
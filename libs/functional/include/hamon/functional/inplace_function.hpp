@@ -0,0 +1,224 @@
+﻿/**
+ *	@file	inplace_function.hpp
+ *
+ *	@brief	inplace_function の定義
+ */
+
+#ifndef HAMON_FUNCTIONAL_INPLACE_FUNCTION_HPP
+#define HAMON_FUNCTIONAL_INPLACE_FUNCTION_HPP
+
+#include <hamon/functional/bad_function_call.hpp>
+#include <hamon/functional/invoke_r.hpp>
+#include <hamon/functional/detail/callable_is_null.hpp>
+#include <hamon/functional/detail/callable_storage.hpp>
+#include <hamon/cstddef/max_align_t.hpp>
+#include <hamon/cstddef/nullptr_t.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/type_traits/decay.hpp>
+#include <hamon/type_traits/enable_if.hpp>
+#include <hamon/type_traits/is_copy_constructible.hpp>
+#include <hamon/type_traits/is_invocable_r.hpp>
+#include <hamon/type_traits/is_same.hpp>
+#include <hamon/type_traits/remove_cvref.hpp>
+#include <hamon/utility/forward.hpp>
+#include <hamon/utility/move.hpp>
+#include <hamon/utility/swap.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+template <typename Signature,
+	hamon::size_t Capacity = sizeof(void*) * 4,
+	hamon::size_t Alignment = alignof(hamon::max_align_t)>
+class inplace_function;	// not defined
+
+/**
+ *	@brief	メモリ確保をしない function
+ *
+ *	@tparam	Capacity	格納できる関数オブジェクトの最大の大きさ
+ *	@tparam	Alignment	格納できる関数オブジェクトの最大のアライメント
+ *
+ *	関数オブジェクトは常にオブジェクト内部のバッファに格納する。
+ *	Capacity と Alignment に収まらない関数オブジェクトや、
+ *	例外を投げずにムーブできない関数オブジェクトを格納しようとするとコンパイルエラーになる。
+ *
+ *	その他は function と同じ。
+ */
+template <typename R, typename... Args, hamon::size_t Capacity, hamon::size_t Alignment>
+class inplace_function<R(Args...), Capacity, Alignment>
+{
+private:
+	using storage_type = hamon::detail::callable_storage<Capacity, Alignment, true, false>;
+
+	using invoker_type = R(*)(storage_type&, Args&&...);
+
+	template <typename T>
+	static R invoke_impl(storage_type& s, Args&&... args)
+	{
+		return hamon::invoke_r<R>(*s.template get<T>(), hamon::forward<Args>(args)...);
+	}
+
+	template <typename F>
+	static bool is_null(F const& f) HAMON_NOEXCEPT
+	{
+		return hamon::detail::callable_is_null(f);
+	}
+
+	template <typename Sig, hamon::size_t C, hamon::size_t A>
+	static bool is_null(inplace_function<Sig, C, A> const& f) HAMON_NOEXCEPT
+	{
+		return !f;
+	}
+
+	mutable storage_type	m_storage;
+	invoker_type			m_invoker = nullptr;
+
+public:
+	using result_type = R;
+
+	HAMON_CXX11_STATIC_CONSTEXPR hamon::size_t capacity = Capacity;
+	HAMON_CXX11_STATIC_CONSTEXPR hamon::size_t alignment = Alignment;
+
+	inplace_function() HAMON_NOEXCEPT
+	{}
+
+	inplace_function(hamon::nullptr_t) HAMON_NOEXCEPT
+	{}
+
+	inplace_function(inplace_function const& f)
+	{
+		if (f.m_invoker != nullptr)
+		{
+			m_storage.copy_from(f.m_storage);
+			m_invoker = f.m_invoker;
+		}
+	}
+
+	inplace_function(inplace_function&& f) HAMON_NOEXCEPT
+	{
+		m_storage.move_from(f.m_storage);
+		m_invoker = f.m_invoker;
+		f.m_invoker = nullptr;
+	}
+
+	template <typename F,
+		typename FD = hamon::decay_t<F>,
+		typename = hamon::enable_if_t<
+			!hamon::is_same<hamon::remove_cvref_t<F>, inplace_function>::value &&
+			hamon::is_invocable_r<R, FD&, Args...>::value
+		>
+	>
+	inplace_function(F&& f)
+	{
+		static_assert(hamon::is_copy_constructible<FD>::value, "");
+
+		if (!is_null(f))
+		{
+			m_storage.template construct<FD>(hamon::forward<F>(f));
+			m_invoker = &invoke_impl<FD>;
+		}
+	}
+
+	inplace_function& operator=(inplace_function const& f)
+	{
+		inplace_function(f).swap(*this);
+		return *this;
+	}
+
+	inplace_function& operator=(inplace_function&& f) HAMON_NOEXCEPT
+	{
+		if (this != &f)
+		{
+			m_storage.destroy();
+			m_storage.move_from(f.m_storage);
+			m_invoker = f.m_invoker;
+			f.m_invoker = nullptr;
+		}
+		return *this;
+	}
+
+	inplace_function& operator=(hamon::nullptr_t) HAMON_NOEXCEPT
+	{
+		m_storage.destroy();
+		m_invoker = nullptr;
+		return *this;
+	}
+
+	template <typename F,
+		typename = hamon::enable_if_t<
+			!hamon::is_same<hamon::remove_cvref_t<F>, inplace_function>::value &&
+			hamon::is_invocable_r<R, hamon::decay_t<F>&, Args...>::value
+		>
+	>
+	inplace_function& operator=(F&& f)
+	{
+		inplace_function(hamon::forward<F>(f)).swap(*this);
+		return *this;
+	}
+
+	~inplace_function() = default;
+
+	void swap(inplace_function& other) HAMON_NOEXCEPT
+	{
+		storage_type tmp;
+		tmp.move_from(other.m_storage);
+		other.m_storage.move_from(m_storage);
+		m_storage.move_from(tmp);
+		hamon::swap(m_invoker, other.m_invoker);
+	}
+
+	explicit operator bool() const HAMON_NOEXCEPT
+	{
+		return m_invoker != nullptr;
+	}
+
+	R operator()(Args... args) const
+	{
+		if (m_invoker == nullptr)
+		{
+			hamon::detail::throw_bad_function_call();
+		}
+
+		return m_invoker(m_storage, hamon::forward<Args>(args)...);
+	}
+
+	friend bool operator==(inplace_function const& f, hamon::nullptr_t) HAMON_NOEXCEPT
+	{
+		return !f;
+	}
+
+#if !defined(HAMON_HAS_CXX20_THREE_WAY_COMPARISON)
+	friend bool operator==(hamon::nullptr_t, inplace_function const& f) HAMON_NOEXCEPT
+	{
+		return !f;
+	}
+
+	friend bool operator!=(inplace_function const& f, hamon::nullptr_t) HAMON_NOEXCEPT
+	{
+		return static_cast<bool>(f);
+	}
+
+	friend bool operator!=(hamon::nullptr_t, inplace_function const& f) HAMON_NOEXCEPT
+	{
+		return static_cast<bool>(f);
+	}
+#endif
+
+	friend void swap(inplace_function& f1, inplace_function& f2) HAMON_NOEXCEPT
+	{
+		f1.swap(f2);
+	}
+};
+
+#if !defined(HAMON_HAS_CXX17_INLINE_VARIABLES)
+template <typename R, typename... Args, hamon::size_t Capacity, hamon::size_t Alignment>
+HAMON_CXX11_CONSTEXPR hamon::size_t inplace_function<R(Args...), Capacity, Alignment>::capacity;
+
+template <typename R, typename... Args, hamon::size_t Capacity, hamon::size_t Alignment>
+HAMON_CXX11_CONSTEXPR hamon::size_t inplace_function<R(Args...), Capacity, Alignment>::alignment;
+#endif
+
+}	// namespace hamon
+
+#endif // HAMON_FUNCTIONAL_INPLACE_FUNCTION_HPP
@@ -0,0 +1,350 @@
+﻿/**
+ *	@file	move_only_function.hpp
+ *
+ *	@brief	move_only_function の定義
+ */
+
+#ifndef HAMON_FUNCTIONAL_MOVE_ONLY_FUNCTION_HPP
+#define HAMON_FUNCTIONAL_MOVE_ONLY_FUNCTION_HPP
+
+#include <hamon/functional/invoke_r.hpp>
+#include <hamon/functional/detail/callable_is_null.hpp>
+#include <hamon/functional/detail/callable_storage.hpp>
+#include <hamon/cstddef/max_align_t.hpp>
+#include <hamon/cstddef/nullptr_t.hpp>
+#include <hamon/type_traits/conditional.hpp>
+#include <hamon/type_traits/conjunction.hpp>
+#include <hamon/type_traits/decay.hpp>
+#include <hamon/type_traits/enable_if.hpp>
+#include <hamon/type_traits/is_constructible.hpp>
+#include <hamon/type_traits/is_invocable_r.hpp>
+#include <hamon/type_traits/is_nothrow_invocable_r.hpp>
+#include <hamon/type_traits/is_same.hpp>
+#include <hamon/type_traits/remove_cvref.hpp>
+#include <hamon/utility/forward.hpp>
+#include <hamon/utility/in_place_type_t.hpp>
+#include <hamon/utility/move.hpp>
+#include <hamon/utility/swap.hpp>
+#include <hamon/preprocessor/empty.hpp>
+#include <hamon/assert.hpp>
+#include <hamon/config.hpp>
+#include <initializer_list>
+
+// move_only_function がメモリ確保せずに格納できる関数オブジェクトの大きさ
+#if !defined(HAMON_MOVE_ONLY_FUNCTION_INLINE_SIZE)
+#  define HAMON_MOVE_ONLY_FUNCTION_INLINE_SIZE (sizeof(void*) * 6)
+#endif
+
+namespace hamon
+{
+
+// [func.wrap.move.class], class template move_only_function
+template <typename... S>
+class move_only_function;	// not defined
+
+namespace detail
+{
+
+namespace move_only_function_detail
+{
+
+// [func.wrap.move.class]/1
+// cv_ref<T>: VT cv ref
+// inv<T>:    VT inv-quals
+struct quals_none
+{
+	template <typename T> using cv_ref = T;
+	template <typename T> using inv = T&;
+};
+
+struct quals_lref
+{
+	template <typename T> using cv_ref = T&;
+	template <typename T> using inv = T&;
+};
+
+struct quals_rref
+{
+	template <typename T> using cv_ref = T&&;
+	template <typename T> using inv = T&&;
+};
+
+struct quals_c
+{
+	template <typename T> using cv_ref = T const;
+	template <typename T> using inv = T const&;
+};
+
+struct quals_clref
+{
+	template <typename T> using cv_ref = T const&;
+	template <typename T> using inv = T const&;
+};
+
+struct quals_crref
+{
+	template <typename T> using cv_ref = T const&&;
+	template <typename T> using inv = T const&&;
+};
+
+/**
+ *	@brief	move_only_function の operator() 以外の実装
+ *
+ *	HAMON_MOVE_ONLY_FUNCTION_INLINE_SIZE バイト (デフォルトはポインタ6個分) までの、
+ *	例外を投げずにムーブできる関数オブジェクトはメモリ確保せずに格納する。
+ */
+template <typename Derived, typename Quals, bool Noex, typename R, typename... Args>
+class move_only_function_base
+{
+private:
+	using storage_type = hamon::detail::callable_storage<
+		HAMON_MOVE_ONLY_FUNCTION_INLINE_SIZE, alignof(hamon::max_align_t), false, true>;
+
+	using invoker_type = R(*)(storage_type&, Args&&...);
+
+	template <typename T>
+	static R invoke_impl(storage_type& s, Args&&... args) HAMON_NOEXCEPT_IF(Noex)
+	{
+		using inv_type = typename Quals::template inv<T>;
+		return hamon::invoke_r<R>(
+			static_cast<inv_type>(*s.template get<T>()), hamon::forward<Args>(args)...);
+	}
+
+	// [func.wrap.move.ctor]/1
+	template <typename VT>
+	struct is_callable_from
+		: public hamon::conditional_t<Noex,
+			hamon::conjunction<
+				hamon::is_nothrow_invocable_r<R, typename Quals::template cv_ref<VT>, Args...>,
+				hamon::is_nothrow_invocable_r<R, typename Quals::template inv<VT>, Args...>
+			>,
+			hamon::conjunction<
+				hamon::is_invocable_r<R, typename Quals::template cv_ref<VT>, Args...>,
+				hamon::is_invocable_r<R, typename Quals::template inv<VT>, Args...>
+			>
+		>
+	{};
+
+	template <typename F>
+	static bool is_null(F const& f) HAMON_NOEXCEPT
+	{
+		return hamon::detail::callable_is_null(f);
+	}
+
+	template <typename... S>
+	static bool is_null(hamon::move_only_function<S...> const& f) HAMON_NOEXCEPT
+	{
+		return !f;
+	}
+
+	template <typename T, typename... CArgs>
+	void construct(CArgs&&... args)
+	{
+		m_storage.template construct<T>(hamon::forward<CArgs>(args)...);
+		m_invoker = &invoke_impl<T>;
+	}
+
+	mutable storage_type	m_storage;
+	invoker_type			m_invoker = nullptr;
+
+public:
+	using result_type = R;
+
+	// [func.wrap.move.ctor], constructors, assignment, and destructor
+	move_only_function_base() HAMON_NOEXCEPT
+	{}
+
+	move_only_function_base(hamon::nullptr_t) HAMON_NOEXCEPT
+	{}
+
+	move_only_function_base(move_only_function_base&& f) HAMON_NOEXCEPT
+	{
+		m_storage.move_from(f.m_storage);
+		m_invoker = f.m_invoker;
+		f.m_invoker = nullptr;
+	}
+
+	move_only_function_base(move_only_function_base const&) = delete;
+
+	template <typename F,
+		typename VT = hamon::decay_t<F>,
+		typename = hamon::enable_if_t<
+			!hamon::is_same<hamon::remove_cvref_t<F>, Derived>::value &&
+			!hamon::is_in_place_type<F>::value &&
+			is_callable_from<VT>::value
+		>
+	>
+	move_only_function_base(F&& f)
+	{
+		// [func.wrap.move.ctor]/8
+		if (!is_null(f))
+		{
+			construct<VT>(hamon::forward<F>(f));
+		}
+	}
+
+	template <typename T, typename... CArgs,
+		typename = hamon::enable_if_t<
+			hamon::is_constructible<T, CArgs...>::value &&
+			is_callable_from<T>::value
+		>
+	>
+	explicit move_only_function_base(hamon::in_place_type_t<T>, CArgs&&... args)
+	{
+		// [func.wrap.move.ctor]/13
+		static_assert(hamon::is_same<T, hamon::decay_t<T>>::value, "");
+		construct<T>(hamon::forward<CArgs>(args)...);
+	}
+
+	template <typename T, typename U, typename... CArgs,
+		typename = hamon::enable_if_t<
+			hamon::is_constructible<T, std::initializer_list<U>&, CArgs...>::value &&
+			is_callable_from<T>::value
+		>
+	>
+	explicit move_only_function_base(hamon::in_place_type_t<T>, std::initializer_list<U> ilist, CArgs&&... args)
+	{
+		// [func.wrap.move.ctor]/20
+		static_assert(hamon::is_same<T, hamon::decay_t<T>>::value, "");
+		construct<T>(ilist, hamon::forward<CArgs>(args)...);
+	}
+
+	move_only_function_base& operator=(move_only_function_base&& f) HAMON_NOEXCEPT
+	{
+		if (this != &f)
+		{
+			m_storage.destroy();
+			m_storage.move_from(f.m_storage);
+			m_invoker = f.m_invoker;
+			f.m_invoker = nullptr;
+		}
+		return *this;
+	}
+
+	move_only_function_base& operator=(move_only_function_base const&) = delete;
+
+	Derived& operator=(hamon::nullptr_t) HAMON_NOEXCEPT
+	{
+		m_storage.destroy();
+		m_invoker = nullptr;
+		return static_cast<Derived&>(*this);
+	}
+
+	template <typename F,
+		typename = hamon::enable_if_t<
+			!hamon::is_same<hamon::remove_cvref_t<F>, Derived>::value &&
+			hamon::is_constructible<Derived, F>::value
+		>
+	>
+	Derived& operator=(F&& f)
+	{
+		Derived(hamon::forward<F>(f)).swap(static_cast<Derived&>(*this));
+		return static_cast<Derived&>(*this);
+	}
+
+	~move_only_function_base() = default;
+
+	// [func.wrap.move.inv], invocation
+	explicit operator bool() const HAMON_NOEXCEPT
+	{
+		return m_invoker != nullptr;
+	}
+
+	// [func.wrap.move.util], utility
+	void swap(Derived& other) HAMON_NOEXCEPT
+	{
+		auto& o = static_cast<move_only_function_base&>(other);
+		storage_type tmp;
+		tmp.move_from(o.m_storage);
+		o.m_storage.move_from(m_storage);
+		m_storage.move_from(tmp);
+		hamon::swap(m_invoker, o.m_invoker);
+	}
+
+	friend void swap(Derived& f1, Derived& f2) HAMON_NOEXCEPT
+	{
+		f1.swap(f2);
+	}
+
+	friend bool operator==(Derived const& f, hamon::nullptr_t) HAMON_NOEXCEPT
+	{
+		return !f;
+	}
+
+#if !defined(HAMON_HAS_CXX20_THREE_WAY_COMPARISON)
+	friend bool operator==(hamon::nullptr_t, Derived const& f) HAMON_NOEXCEPT
+	{
+		return !f;
+	}
+
+	friend bool operator!=(Derived const& f, hamon::nullptr_t) HAMON_NOEXCEPT
+	{
+		return static_cast<bool>(f);
+	}
+
+	friend bool operator!=(hamon::nullptr_t, Derived const& f) HAMON_NOEXCEPT
+	{
+		return static_cast<bool>(f);
+	}
+#endif
+
+protected:
+	R call(Args&&... args) const HAMON_NOEXCEPT_IF(Noex)
+	{
+		// [func.wrap.move.inv]/2
+		HAMON_ASSERT(m_invoker != nullptr);
+		return m_invoker(m_storage, hamon::forward<Args>(args)...);
+	}
+};
+
+}	// namespace move_only_function_detail
+
+}	// namespace detail
+
+#define HAMON_MOVE_ONLY_FUNCTION_SPEC(CV_REF, QUALS, NOEX_SPEC, NOEX)           \
+template <typename R, typename... Args>                                         \
+class move_only_function<R(Args...) CV_REF NOEX_SPEC>                           \
+	: public detail::move_only_function_detail::move_only_function_base<        \
+		move_only_function<R(Args...) CV_REF NOEX_SPEC>,                        \
+		detail::move_only_function_detail::QUALS, NOEX, R, Args...>             \
+{                                                                               \
+private:                                                                        \
+	using base_type = detail::move_only_function_detail::move_only_function_base< \
+		move_only_function, detail::move_only_function_detail::QUALS, NOEX, R, Args...>; \
+                                                                                \
+public:                                                                         \
+	using base_type::base_type;                                                 \
+	using base_type::operator=;                                                 \
+                                                                                \
+	R operator()(Args... args) CV_REF NOEX_SPEC                                 \
+	{                                                                           \
+		return this->call(hamon::forward<Args>(args)...);                       \
+	}                                                                           \
+}
+
+#if defined(HAMON_HAS_CXX17_NOEXCEPT_FUNCTION_TYPE)
+
+#define HAMON_MOVE_ONLY_FUNCTION_SPEC_NOEX(CV_REF, QUALS)            \
+	HAMON_MOVE_ONLY_FUNCTION_SPEC(CV_REF, QUALS, HAMON_PP_EMPTY(), false); \
+	HAMON_MOVE_ONLY_FUNCTION_SPEC(CV_REF, QUALS, noexcept, true)
+
+#else
+
+#define HAMON_MOVE_ONLY_FUNCTION_SPEC_NOEX(CV_REF, QUALS)            \
+	HAMON_MOVE_ONLY_FUNCTION_SPEC(CV_REF, QUALS, HAMON_PP_EMPTY(), false)
+
+#endif
+
+HAMON_MOVE_ONLY_FUNCTION_SPEC_NOEX(HAMON_PP_EMPTY(), quals_none);
+HAMON_MOVE_ONLY_FUNCTION_SPEC_NOEX(&,                quals_lref);
+HAMON_MOVE_ONLY_FUNCTION_SPEC_NOEX(&&,               quals_rref);
+HAMON_MOVE_ONLY_FUNCTION_SPEC_NOEX(const,            quals_c);
+HAMON_MOVE_ONLY_FUNCTION_SPEC_NOEX(const&,           quals_clref);
+HAMON_MOVE_ONLY_FUNCTION_SPEC_NOEX(const&&,          quals_crref);
+
+#undef HAMON_MOVE_ONLY_FUNCTION_SPEC_NOEX
+#undef HAMON_MOVE_ONLY_FUNCTION_SPEC
+
+}	// namespace hamon
+
+#endif // HAMON_FUNCTIONAL_MOVE_ONLY_FUNCTION_HPP
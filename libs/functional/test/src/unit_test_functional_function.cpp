@@ -0,0 +1,215 @@
+﻿/**
+ *	@file	unit_test_functional_function.cpp
+ *
+ *	@brief	function のテスト
+ */
+
+#include <hamon/functional/function.hpp>
+#include <hamon/functional/bad_function_call.hpp>
+#include <hamon/type_traits/is_constructible.hpp>
+#include <hamon/type_traits/is_nothrow_move_constructible.hpp>
+#include <hamon/type_traits/is_same.hpp>
+#include <hamon/utility/move.hpp>
+#include <hamon/config.hpp>
+#include <gtest/gtest.h>
+
+namespace hamon_functional_test
+{
+
+namespace function_test
+{
+
+int add(int x, int y)
+{
+	return x + y;
+}
+
+struct Counter
+{
+	int value;
+
+	int get() const { return value; }
+	int add(int x) { return value += x; }
+};
+
+// 生存しているオブジェクトの数を数える関数オブジェクト
+template <hamon::size_t N>
+struct Tracked
+{
+	static int s_alive;
+
+	int  m_value;
+	char m_padding[N];
+
+	explicit Tracked(int v) : m_value(v), m_padding{} { ++s_alive; }
+	Tracked(Tracked const& x) : m_value(x.m_value), m_padding{} { ++s_alive; }
+	Tracked(Tracked&& x) noexcept : m_value(x.m_value), m_padding{} { ++s_alive; }
+	~Tracked() { --s_alive; }
+
+	int operator()(int x) const { return m_value + x; }
+};
+
+template <hamon::size_t N>
+int Tracked<N>::s_alive = 0;
+
+using Small = Tracked<8>;		// バッファに収まる
+using Large = Tracked<128>;		// バッファに収まらない
+
+static_assert( hamon::is_same<hamon::function<int(int)>::result_type, int>::value, "");
+static_assert( hamon::is_nothrow_move_constructible<hamon::function<int(int)>>::value, "");
+static_assert( hamon::is_constructible<hamon::function<int(int)>, int(*)(int, int)>::value == false, "");
+static_assert( hamon::is_constructible<hamon::function<int(int, int)>, int(*)(int, int)>::value, "");
+static_assert( hamon::is_constructible<hamon::function<long(int, int)>, int(*)(int, int)>::value, "");
+static_assert( hamon::is_constructible<hamon::function<void(int, int)>, int(*)(int, int)>::value, "");
+static_assert( hamon::is_constructible<hamon::function<int(Counter&)>, int (Counter::*)() const>::value, "");
+
+GTEST_TEST(FunctionalTest, FunctionTest)
+{
+	// 空
+	{
+		hamon::function<int(int, int)> f;
+		EXPECT_FALSE(f);
+		EXPECT_TRUE(f == nullptr);
+		EXPECT_TRUE(nullptr == f);
+		EXPECT_FALSE(f != nullptr);
+		EXPECT_FALSE(nullptr != f);
+#if !defined(HAMON_NO_EXCEPTIONS)
+		EXPECT_THROW((void)f(1, 2), hamon::bad_function_call);
+#endif
+	}
+	{
+		hamon::function<int(int, int)> f = nullptr;
+		EXPECT_FALSE(f);
+	}
+	// 関数ポインタ
+	{
+		hamon::function<int(int, int)> f = add;
+		EXPECT_TRUE(f);
+		EXPECT_TRUE(f != nullptr);
+		EXPECT_EQ(5, f(2, 3));
+	}
+	{
+		int (*p)(int, int) = nullptr;
+		hamon::function<int(int, int)> f = p;
+		EXPECT_FALSE(f);
+	}
+	// メンバポインタ
+	{
+		hamon::function<int(Counter const&)> f = &Counter::get;
+		hamon::function<int(Counter&, int)> g = &Counter::add;
+		Counter c{3};
+		EXPECT_EQ(3, f(c));
+		EXPECT_EQ(7, g(c, 4));
+		EXPECT_EQ(7, f(c));
+
+		int Counter::* pm = &Counter::value;
+		hamon::function<int(Counter const&)> h = pm;
+		EXPECT_EQ(7, h(c));
+
+		pm = nullptr;
+		hamon::function<int(Counter const&)> h2 = pm;
+		EXPECT_FALSE(h2);
+	}
+	// ラムダ式
+	{
+		int n = 10;
+		hamon::function<int(int)> f = [n](int x) { return n * x; };
+		EXPECT_EQ(30, f(3));
+
+		hamon::function<void(int)> g = [&n](int x) { n += x; };
+		g(5);
+		EXPECT_EQ(15, n);
+	}
+	// 戻り値の変換
+	{
+		hamon::function<long(int, int)> f = add;
+		EXPECT_EQ(9, f(4, 5));
+		hamon::function<void(int, int)> g = add;
+		g(4, 5);
+	}
+	// 空の function から構築すると空
+	{
+		hamon::function<int(int, int)> f1;
+		hamon::function<long(int, int)> f2 = f1;
+		EXPECT_FALSE(f2);
+	}
+#if defined(HAMON_HAS_CXX17_DEDUCTION_GUIDES)
+	{
+		hamon::function f = add;
+		static_assert(hamon::is_same<decltype(f), hamon::function<int(int, int)>>::value, "");
+		EXPECT_EQ(3, f(1, 2));
+	}
+#endif
+}
+
+template <typename T>
+void FunctionLifetimeTest()
+{
+	EXPECT_EQ(0, T::s_alive);
+	{
+		hamon::function<int(int)> f1 = T{1};
+		EXPECT_EQ(1, T::s_alive);
+		EXPECT_EQ(3, f1(2));
+
+		// コピー
+		hamon::function<int(int)> f2 = f1;
+		EXPECT_EQ(2, T::s_alive);
+		EXPECT_EQ(3, f2(2));
+
+		// ムーブ
+		hamon::function<int(int)> f3 = hamon::move(f1);
+		EXPECT_EQ(2, T::s_alive);
+		EXPECT_FALSE(f1);
+		EXPECT_EQ(4, f3(3));
+
+		// コピー代入
+		f1 = f3;
+		EXPECT_EQ(3, T::s_alive);
+		EXPECT_EQ(5, f1(4));
+
+		// ムーブ代入
+		f2 = hamon::move(f3);
+		EXPECT_EQ(2, T::s_alive);
+		EXPECT_FALSE(f3);
+
+		// 関数オブジェクトの代入
+		f3 = T{10};
+		EXPECT_EQ(3, T::s_alive);
+		EXPECT_EQ(11, f3(1));
+
+		// nullptr の代入
+		f3 = nullptr;
+		EXPECT_EQ(2, T::s_alive);
+		EXPECT_FALSE(f3);
+
+		// 自己ムーブ代入
+		f2 = hamon::move(f2);
+		EXPECT_EQ(2, T::s_alive);
+
+		// swap
+		hamon::function<int(int)> f4 = [](int x) { return x * 100; };
+		f1.swap(f4);
+		EXPECT_EQ(200, f1(2));
+		EXPECT_EQ(3, f4(2));
+		swap(f1, f4);
+		EXPECT_EQ(3, f1(2));
+		EXPECT_EQ(200, f4(2));
+		EXPECT_EQ(2, T::s_alive);
+
+		f1.swap(f3);
+		EXPECT_FALSE(f1);
+		EXPECT_EQ(3, f3(2));
+		EXPECT_EQ(2, T::s_alive);
+	}
+	EXPECT_EQ(0, T::s_alive);
+}
+
+GTEST_TEST(FunctionalTest, FunctionLifetimeTest)
+{
+	FunctionLifetimeTest<Small>();
+	FunctionLifetimeTest<Large>();
+}
+
+}	// namespace function_test
+
+}	// namespace hamon_functional_test
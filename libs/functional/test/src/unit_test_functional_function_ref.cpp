@@ -0,0 +1,156 @@
+﻿/**
+ *	@file	unit_test_functional_function_ref.cpp
+ *
+ *	@brief	function_ref のテスト
+ */
+
+#include <hamon/functional/function_ref.hpp>
+#include <hamon/type_traits/is_assignable.hpp>
+#include <hamon/type_traits/is_constructible.hpp>
+#include <hamon/type_traits/is_invocable.hpp>
+#include <hamon/type_traits/is_nothrow_invocable.hpp>
+#include <hamon/type_traits/is_same.hpp>
+#include <hamon/type_traits/is_trivially_copyable.hpp>
+#include <hamon/config.hpp>
+#include <gtest/gtest.h>
+
+namespace hamon_functional_test
+{
+
+namespace function_ref_test
+{
+
+int add(int x, int y)
+{
+	return x + y;
+}
+
+int twice(int x)
+{
+	return x * 2;
+}
+
+struct Counter
+{
+	int m_value;
+
+	int operator()(int x) { return m_value += x; }
+	int operator()(int x) const { return m_value + x * 10; }
+};
+
+struct NonConstOnly
+{
+	int operator()(int x) { return x; }
+};
+
+struct S
+{
+	int value;
+	int get() const { return value; }
+};
+
+using R0 = hamon::function_ref<int(int)>;
+using R1 = hamon::function_ref<int(int) const>;
+
+static_assert(sizeof(R0) == sizeof(void*) * 2, "");
+static_assert(hamon::is_trivially_copyable<R0>::value, "");
+static_assert(hamon::is_trivially_copyable<R1>::value, "");
+
+static_assert( hamon::is_invocable<R0&, int>::value, "");
+static_assert( hamon::is_invocable<R0 const&, int>::value, "");
+static_assert( hamon::is_constructible<R0, NonConstOnly&>::value, "");
+static_assert(!hamon::is_constructible<R1, NonConstOnly&>::value, "");
+static_assert( hamon::is_constructible<R0, int(*)(int)>::value, "");
+static_assert(!hamon::is_constructible<R0, int(*)(int, int)>::value, "");
+static_assert(!hamon::is_constructible<R0>::value, "");
+
+// メンバポインタからは構築できない
+static_assert(!hamon::is_constructible<hamon::function_ref<int(S const&)>, int (S::*)() const>::value, "");
+static_assert(!hamon::is_constructible<hamon::function_ref<int(S const&)>, int S::*>::value, "");
+
+// function_ref 以外からの代入はできない
+static_assert( hamon::is_assignable<R0&, R0 const&>::value, "");
+static_assert(!hamon::is_assignable<R0&, NonConstOnly&>::value, "");
+
+#if defined(HAMON_HAS_CXX17_NOEXCEPT_FUNCTION_TYPE)
+static_assert(!hamon::is_nothrow_invocable<R0&, int>::value, "");
+static_assert( hamon::is_nothrow_invocable<hamon::function_ref<int(int) noexcept>&, int>::value, "");
+static_assert(!hamon::is_constructible<hamon::function_ref<int(int) noexcept>, int(*)(int)>::value, "");
+#endif
+
+int call_with(hamon::function_ref<int(int)> f, int x)
+{
+	return f(x);
+}
+
+GTEST_TEST(FunctionalTest, FunctionRefTest)
+{
+	// 関数
+	{
+		hamon::function_ref<int(int, int)> f = add;
+		EXPECT_EQ(5, f(2, 3));
+	}
+	// 関数ポインタ
+	{
+		hamon::function_ref<int(int, int)> f = &add;
+		EXPECT_EQ(7, f(3, 4));
+	}
+	// 戻り値の変換
+	{
+		hamon::function_ref<long(int)> f = twice;
+		EXPECT_EQ(8, f(4));
+		hamon::function_ref<void(int)> g = twice;
+		g(4);
+	}
+	// 関数オブジェクトへの参照
+	{
+		Counter c{1};
+		hamon::function_ref<int(int)> f = c;
+		EXPECT_EQ(3, f(2));
+		EXPECT_EQ(6, f(3));
+		EXPECT_EQ(6, c.m_value);
+
+		hamon::function_ref<int(int) const> g = c;
+		EXPECT_EQ(26, g(2));
+		EXPECT_EQ(6, c.m_value);
+
+		Counter const& cc = c;
+		hamon::function_ref<int(int)> h = cc;
+		EXPECT_EQ(16, h(1));
+	}
+	// 一時オブジェクト (関数呼び出しの間は有効)
+	{
+		int n = 3;
+		EXPECT_EQ(15, call_with([n](int x) { return n * x; }, 5));
+		EXPECT_EQ(10, call_with(twice, 5));
+	}
+	// コピーと代入
+	{
+		Counter c{0};
+		hamon::function_ref<int(int)> f = c;
+		hamon::function_ref<int(int)> g = twice;
+		EXPECT_EQ(4, g(2));
+		g = f;
+		EXPECT_EQ(2, g(2));
+		EXPECT_EQ(5, f(3));
+		EXPECT_EQ(5, c.m_value);
+	}
+#if defined(HAMON_HAS_CXX17_NOEXCEPT_FUNCTION_TYPE)
+	{
+		auto l = [](int x) noexcept { return x + 1; };
+		hamon::function_ref<int(int) noexcept> f = l;
+		EXPECT_EQ(2, f(1));
+	}
+#endif
+#if defined(HAMON_HAS_CXX17_DEDUCTION_GUIDES)
+	{
+		hamon::function_ref f = add;
+		static_assert(hamon::is_same<decltype(f), hamon::function_ref<int(int, int)>>::value, "");
+		EXPECT_EQ(3, f(1, 2));
+	}
+#endif
+}
+
+}	// namespace function_ref_test
+
+}	// namespace hamon_functional_test
@@ -0,0 +1,149 @@
+﻿/**
+ *	@file	unit_test_functional_inplace_function.cpp
+ *
+ *	@brief	inplace_function のテスト
+ */
+
+#include <hamon/functional/inplace_function.hpp>
+#include <hamon/functional/bad_function_call.hpp>
+#include <hamon/type_traits/is_constructible.hpp>
+#include <hamon/type_traits/is_nothrow_move_constructible.hpp>
+#include <hamon/type_traits/is_same.hpp>
+#include <hamon/utility/move.hpp>
+#include <hamon/config.hpp>
+#include <gtest/gtest.h>
+
+namespace hamon_functional_test
+{
+
+namespace inplace_function_test
+{
+
+int add(int x, int y)
+{
+	return x + y;
+}
+
+// 生存しているオブジェクトの数を数える関数オブジェクト
+template <hamon::size_t N>
+struct Tracked
+{
+	static int s_alive;
+
+	int  m_value;
+	char m_padding[N];
+
+	explicit Tracked(int v) : m_value(v), m_padding{} { ++s_alive; }
+	Tracked(Tracked const& x) : m_value(x.m_value), m_padding{} { ++s_alive; }
+	Tracked(Tracked&& x) noexcept : m_value(x.m_value), m_padding{} { ++s_alive; }
+	~Tracked() { --s_alive; }
+
+	int operator()(int x) const { return m_value + x; }
+};
+
+template <hamon::size_t N>
+int Tracked<N>::s_alive = 0;
+
+using F = hamon::inplace_function<int(int)>;
+using F64 = hamon::inplace_function<int(int), 64>;
+
+static_assert(F::capacity == sizeof(void*) * 4, "");
+static_assert(F64::capacity == 64, "");
+static_assert(F64::alignment == alignof(hamon::max_align_t), "");
+static_assert(sizeof(F64) <= 64 + sizeof(void*) * 2 + alignof(hamon::max_align_t), "");
+static_assert(hamon::is_same<F::result_type, int>::value, "");
+static_assert(hamon::is_nothrow_move_constructible<F>::value, "");
+static_assert(hamon::is_constructible<F, int(*)(int)>::value, "");
+static_assert(!hamon::is_constructible<F, int(*)(int, int)>::value, "");
+
+GTEST_TEST(FunctionalTest, InplaceFunctionTest)
+{
+	// 空
+	{
+		hamon::inplace_function<int(int, int)> f;
+		EXPECT_FALSE(f);
+		EXPECT_TRUE(f == nullptr);
+		EXPECT_TRUE(nullptr == f);
+		EXPECT_FALSE(f != nullptr);
+		EXPECT_FALSE(nullptr != f);
+#if !defined(HAMON_NO_EXCEPTIONS)
+		EXPECT_THROW((void)f(1, 2), hamon::bad_function_call);
+#endif
+	}
+	// 関数ポインタ
+	{
+		hamon::inplace_function<int(int, int)> f = add;
+		EXPECT_TRUE(f);
+		EXPECT_EQ(5, f(2, 3));
+
+		int (*p)(int, int) = nullptr;
+		f = p;
+		EXPECT_FALSE(f);
+	}
+	// ラムダ式
+	{
+		int a = 1, b = 2, c = 3;
+		F f = [a, b, c](int x) { return a + b + c + x; };
+		EXPECT_EQ(10, f(4));
+
+		// 別の inplace_function を格納するには、それが収まる大きさが必要
+		hamon::inplace_function<long(int), 64> g = f;
+		EXPECT_EQ(11, g(5));
+	}
+	// バッファいっぱいの関数オブジェクト
+	{
+		F64 f = Tracked<56>{7};
+		EXPECT_EQ(1, Tracked<56>::s_alive);
+		EXPECT_EQ(8, f(1));
+	}
+	EXPECT_EQ(0, Tracked<56>::s_alive);
+}
+
+GTEST_TEST(FunctionalTest, InplaceFunctionLifetimeTest)
+{
+	using T = Tracked<8>;
+
+	EXPECT_EQ(0, T::s_alive);
+	{
+		F f1 = T{1};
+		EXPECT_EQ(1, T::s_alive);
+		EXPECT_EQ(3, f1(2));
+
+		// コピー
+		F f2 = f1;
+		EXPECT_EQ(2, T::s_alive);
+		EXPECT_EQ(3, f2(2));
+
+		// ムーブ
+		F f3 = hamon::move(f1);
+		EXPECT_EQ(2, T::s_alive);
+		EXPECT_FALSE(f1);
+		EXPECT_EQ(4, f3(3));
+
+		// コピー代入
+		f1 = f3;
+		EXPECT_EQ(3, T::s_alive);
+
+		// ムーブ代入
+		f2 = hamon::move(f3);
+		EXPECT_EQ(2, T::s_alive);
+		EXPECT_FALSE(f3);
+
+		// nullptr の代入
+		f1 = nullptr;
+		EXPECT_EQ(1, T::s_alive);
+		EXPECT_FALSE(f1);
+
+		// swap
+		f1 = [](int x) { return x * 100; };
+		swap(f1, f2);
+		EXPECT_EQ(3, f1(2));
+		EXPECT_EQ(200, f2(2));
+		EXPECT_EQ(1, T::s_alive);
+	}
+	EXPECT_EQ(0, T::s_alive);
+}
+
+}	// namespace inplace_function_test
+
+}	// namespace hamon_functional_test
@@ -0,0 +1,271 @@
+﻿/**
+ *	@file	unit_test_functional_move_only_function.cpp
+ *
+ *	@brief	move_only_function のテスト
+ */
+
+#include <hamon/functional/move_only_function.hpp>
+#include <hamon/memory/unique_ptr.hpp>
+#include <hamon/memory/make_unique.hpp>
+#include <hamon/type_traits/is_constructible.hpp>
+#include <hamon/type_traits/is_copy_constructible.hpp>
+#include <hamon/type_traits/is_copy_assignable.hpp>
+#include <hamon/type_traits/is_invocable.hpp>
+#include <hamon/type_traits/is_nothrow_invocable.hpp>
+#include <hamon/type_traits/is_nothrow_move_constructible.hpp>
+#include <hamon/type_traits/is_same.hpp>
+#include <hamon/utility/in_place_type_t.hpp>
+#include <hamon/utility/move.hpp>
+#include <hamon/config.hpp>
+#include <gtest/gtest.h>
+#include <initializer_list>
+
+namespace hamon_functional_test
+{
+
+namespace move_only_function_test
+{
+
+int add(int x, int y)
+{
+	return x + y;
+}
+
+struct Qualified
+{
+	int operator()() &       { return 1; }
+	int operator()() &&      { return 2; }
+	int operator()() const&  { return 3; }
+	int operator()() const&& { return 4; }
+};
+
+struct UniqueHolder
+{
+	hamon::unique_ptr<int> m_ptr;
+
+	int operator()() const { return *m_ptr; }
+};
+
+struct NonConstOnly
+{
+	int operator()() { return 0; }
+};
+
+struct ListInit
+{
+	int m_sum;
+
+	ListInit(std::initializer_list<int> il, int base)
+		: m_sum(base)
+	{
+		for (int x : il)
+		{
+			m_sum += x;
+		}
+	}
+
+	int operator()() const { return m_sum; }
+};
+
+// 生存しているオブジェクトの数を数える、ムーブだけできる関数オブジェクト
+template <hamon::size_t N>
+struct Tracked
+{
+	static int s_alive;
+
+	int  m_value;
+	char m_padding[N];
+
+	explicit Tracked(int v) : m_value(v), m_padding{} { ++s_alive; }
+	Tracked(Tracked const&) = delete;
+	Tracked(Tracked&& x) noexcept : m_value(x.m_value), m_padding{} { ++s_alive; }
+	~Tracked() { --s_alive; }
+
+	int operator()(int x) { return m_value += x; }
+};
+
+template <hamon::size_t N>
+int Tracked<N>::s_alive = 0;
+
+using Small = Tracked<8>;		// バッファに収まる
+using Large = Tracked<128>;		// バッファに収まらない
+
+using F0 = hamon::move_only_function<int()>;
+using F1 = hamon::move_only_function<int()&>;
+using F2 = hamon::move_only_function<int()&&>;
+using F3 = hamon::move_only_function<int() const>;
+using F4 = hamon::move_only_function<int() const&>;
+using F5 = hamon::move_only_function<int() const&&>;
+
+static_assert( hamon::is_same<F0::result_type, int>::value, "");
+static_assert(!hamon::is_copy_constructible<F0>::value, "");
+static_assert(!hamon::is_copy_assignable<F0>::value, "");
+static_assert( hamon::is_nothrow_move_constructible<F0>::value, "");
+
+static_assert( hamon::is_invocable<F0&>::value, "");
+static_assert( hamon::is_invocable<F0&&>::value, "");
+static_assert( hamon::is_invocable<F0 const&>::value == false, "");
+static_assert( hamon::is_invocable<F1&>::value, "");
+static_assert( hamon::is_invocable<F1&&>::value == false, "");
+static_assert( hamon::is_invocable<F2&>::value == false, "");
+static_assert( hamon::is_invocable<F2&&>::value, "");
+static_assert( hamon::is_invocable<F3 const&>::value, "");
+static_assert( hamon::is_invocable<F3 const&&>::value, "");
+static_assert( hamon::is_invocable<F4 const&>::value, "");
+static_assert( hamon::is_invocable<F4 const&&>::value, "");
+static_assert( hamon::is_invocable<F5 const&>::value == false, "");
+static_assert( hamon::is_invocable<F5 const&&>::value, "");
+
+static_assert( hamon::is_constructible<F0, NonConstOnly>::value, "");
+static_assert( hamon::is_constructible<F1, NonConstOnly>::value, "");
+static_assert( hamon::is_constructible<F2, NonConstOnly>::value, "");
+static_assert(!hamon::is_constructible<F3, NonConstOnly>::value, "");
+static_assert(!hamon::is_constructible<F4, NonConstOnly>::value, "");
+static_assert(!hamon::is_constructible<F5, NonConstOnly>::value, "");
+static_assert( hamon::is_constructible<hamon::move_only_function<int(int)>, Small>::value, "");
+static_assert(!hamon::is_constructible<hamon::move_only_function<int(int) const>, Small>::value, "");
+
+#if defined(HAMON_HAS_CXX17_NOEXCEPT_FUNCTION_TYPE)
+static_assert(!hamon::is_nothrow_invocable<F0&>::value, "");
+static_assert( hamon::is_nothrow_invocable<hamon::move_only_function<int() noexcept>&>::value, "");
+static_assert( hamon::is_nothrow_invocable<hamon::move_only_function<int() const& noexcept>const&>::value, "");
+static_assert(!hamon::is_constructible<hamon::move_only_function<int(int, int) noexcept>, int(*)(int, int)>::value, "");
+static_assert( hamon::is_constructible<hamon::move_only_function<int() noexcept>, int(*)() noexcept>::value, "");
+#endif
+
+GTEST_TEST(FunctionalTest, MoveOnlyFunctionTest)
+{
+	// 空
+	{
+		hamon::move_only_function<int(int, int)> f;
+		EXPECT_FALSE(f);
+		EXPECT_TRUE(f == nullptr);
+		EXPECT_TRUE(nullptr == f);
+		EXPECT_FALSE(f != nullptr);
+		EXPECT_FALSE(nullptr != f);
+	}
+	{
+		hamon::move_only_function<int(int, int)> f = nullptr;
+		EXPECT_FALSE(f);
+	}
+	// 関数ポインタ
+	{
+		hamon::move_only_function<int(int, int)> f = add;
+		EXPECT_TRUE(f);
+		EXPECT_EQ(5, f(2, 3));
+	}
+	{
+		int (*p)(int, int) = nullptr;
+		hamon::move_only_function<int(int, int)> f = p;
+		EXPECT_FALSE(f);
+	}
+	// 空の move_only_function から構築すると空
+	{
+		hamon::move_only_function<int(int, int)> f1;
+		hamon::move_only_function<long(int, int)> f2 = hamon::move(f1);
+		EXPECT_FALSE(f2);
+	}
+	// ムーブだけできるオブジェクトを保持する
+	{
+		auto p = hamon::make_unique<int>(42);
+		hamon::move_only_function<int()> f = UniqueHolder{hamon::move(p)};
+		EXPECT_EQ(42, f());
+		hamon::move_only_function<int()> g = hamon::move(f);
+		EXPECT_FALSE(f);
+		EXPECT_EQ(42, g());
+	}
+	// cv と参照の修飾
+	{
+		F0 f0 = Qualified{};
+		F1 f1 = Qualified{};
+		F2 f2 = Qualified{};
+		F3 f3 = Qualified{};
+		F4 f4 = Qualified{};
+		F5 f5 = Qualified{};
+		EXPECT_EQ(1, f0());
+		EXPECT_EQ(1, f1());
+		EXPECT_EQ(2, hamon::move(f2)());
+		EXPECT_EQ(3, f3());
+		EXPECT_EQ(3, f4());
+		EXPECT_EQ(4, hamon::move(f5)());
+	}
+	// in_place_type
+	{
+		hamon::move_only_function<int(int)> f(hamon::in_place_type_t<Small>{}, 5);
+		EXPECT_EQ(1, Small::s_alive);
+		EXPECT_EQ(7, f(2));
+		EXPECT_EQ(10, f(3));
+	}
+	EXPECT_EQ(0, Small::s_alive);
+	{
+		hamon::move_only_function<int() const> f(hamon::in_place_type_t<ListInit>{}, {1, 2, 3}, 10);
+		EXPECT_EQ(16, f());
+	}
+#if defined(HAMON_HAS_CXX17_NOEXCEPT_FUNCTION_TYPE)
+	{
+		hamon::move_only_function<int(int) noexcept> f = [](int x) noexcept { return x * 2; };
+		EXPECT_EQ(8, f(4));
+	}
+#endif
+}
+
+template <typename T>
+void MoveOnlyFunctionLifetimeTest()
+{
+	EXPECT_EQ(0, T::s_alive);
+	{
+		hamon::move_only_function<int(int)> f1 = T{1};
+		EXPECT_EQ(1, T::s_alive);
+		EXPECT_EQ(3, f1(2));
+
+		// ムーブ
+		hamon::move_only_function<int(int)> f2 = hamon::move(f1);
+		EXPECT_EQ(1, T::s_alive);
+		EXPECT_FALSE(f1);
+		EXPECT_EQ(6, f2(3));
+
+		// 関数オブジェクトの代入
+		f1 = T{10};
+		EXPECT_EQ(2, T::s_alive);
+		EXPECT_EQ(11, f1(1));
+
+		// ムーブ代入
+		f1 = hamon::move(f2);
+		EXPECT_EQ(1, T::s_alive);
+		EXPECT_FALSE(f2);
+		EXPECT_EQ(7, f1(1));
+
+		// 自己ムーブ代入
+		f1 = hamon::move(f1);
+		EXPECT_EQ(1, T::s_alive);
+
+		// swap
+		f2 = [](int x) { return x * 100; };
+		f1.swap(f2);
+		EXPECT_EQ(200, f1(2));
+		EXPECT_EQ(9, f2(2));
+		swap(f1, f2);
+		EXPECT_EQ(10, f1(1));
+		EXPECT_EQ(200, f2(2));
+		EXPECT_EQ(1, T::s_alive);
+
+		// nullptr の代入
+		f1 = nullptr;
+		EXPECT_EQ(0, T::s_alive);
+		EXPECT_FALSE(f1);
+
+		f1 = T{20};
+		EXPECT_EQ(1, T::s_alive);
+	}
+	EXPECT_EQ(0, T::s_alive);
+}
+
+GTEST_TEST(FunctionalTest, MoveOnlyFunctionLifetimeTest)
+{
+	MoveOnlyFunctionLifetimeTest<Small>();
+	MoveOnlyFunctionLifetimeTest<Large>();
+}
+
+}	// namespace move_only_function_test
+
+}	// namespace hamon_functional_test
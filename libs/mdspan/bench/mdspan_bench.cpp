@@ -0,0 +1,179 @@
+﻿/**
+ *	@file	mdspan_bench.cpp
+ *
+ *	@brief	mdspan のレイアウトごとの走査と転置のベンチマーク
+ *
+ *	N x N の float の2次元配列について、次の1回あたりの時間を出力する。
+ *		sum, row traversal          : layout_right を行ごとに走査して合計する
+ *		sum, column traversal       : layout_right を列ごとに走査して合計する
+ *		sum, layout_left columns    : layout_left を列ごとに走査して合計する
+ *		sum, padded row traversal   : layout_right_padded<16> を行ごとに走査して合計する
+ *		transpose, naive            : layout_right から layout_right へ要素ごとに転置する
+ *		transpose, 32x32 blocked    : layout_right から layout_right へ 32x32 のブロックごとに転置する
+ *		transpose, layout_tiled     : layout_tiled<32, 32> から layout_tiled<32, 32> へタイルごとに転置する
+ *
+ *	使い方:
+ *		mdspan_bench [N (32 の倍数、既定値は 2048)]
+ */
+
+#include <hamon/mdspan.hpp>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+int const kTile = 32;
+
+template <typename MDSpan>
+typename MDSpan::reference at(MDSpan const& m, int i, int j)
+{
+#if defined(HAMON_HAS_CXX23_MULTIDIMENSIONAL_SUBSCRIPT)
+	return m[i, j];
+#else
+	return m(i, j);
+#endif
+}
+
+// f を少なくとも 300ms 繰り返し、1回あたりの時間 [ms] を返す
+template <typename F>
+double measure(F f)
+{
+	double sink = 0;
+	long long count = 0;
+	auto const start = Clock::now();
+	auto end = start;
+	do
+	{
+		sink += f();
+		++count;
+		end = Clock::now();
+	}
+	while (end - start < std::chrono::milliseconds(300));
+	if (sink == 0)
+	{
+		std::printf(" ");
+	}
+	return std::chrono::duration<double, std::milli>(end - start).count() / static_cast<double>(count);
+}
+
+template <typename MDSpan>
+double sum_rows(MDSpan const& m)
+{
+	double sum = 0;
+	for (int i = 0; i < m.extent(0); ++i)
+	{
+		for (int j = 0; j < m.extent(1); ++j)
+		{
+			sum += at(m, i, j);
+		}
+	}
+	return sum;
+}
+
+template <typename MDSpan>
+double sum_cols(MDSpan const& m)
+{
+	double sum = 0;
+	for (int j = 0; j < m.extent(1); ++j)
+	{
+		for (int i = 0; i < m.extent(0); ++i)
+		{
+			sum += at(m, i, j);
+		}
+	}
+	return sum;
+}
+
+template <typename Src, typename Dst>
+double transpose_naive(Src const& src, Dst const& dst)
+{
+	for (int i = 0; i < src.extent(0); ++i)
+	{
+		for (int j = 0; j < src.extent(1); ++j)
+		{
+			at(dst, j, i) = at(src, i, j);
+		}
+	}
+	return at(dst, 1, 0);
+}
+
+// 32x32 のブロックごとに転置する。
+// layout_tiled<32, 32> の場合は、ブロックがそのままタイルになる
+template <typename Src, typename Dst>
+double transpose_blocked(Src const& src, Dst const& dst)
+{
+	for (int bi = 0; bi < src.extent(0); bi += kTile)
+	{
+		for (int bj = 0; bj < src.extent(1); bj += kTile)
+		{
+			for (int i = bi; i < bi + kTile; ++i)
+			{
+				for (int j = bj; j < bj + kTile; ++j)
+				{
+					at(dst, j, i) = at(src, i, j);
+				}
+			}
+		}
+	}
+	return at(dst, 1, 0);
+}
+
+}	// namespace
+
+int main(int argc, char* argv[])
+{
+	int n = 2048;
+	if (argc > 1)
+	{
+		n = std::atoi(argv[1]);
+	}
+	if (n < kTile || n % kTile != 0)
+	{
+		std::printf("N must be a positive multiple of %d\n", kTile);
+		return 1;
+	}
+
+	using ext_t    = hamon::dextents<int, 2>;
+	using right_t  = hamon::mdspan<float, ext_t, hamon::layout_right>;
+	using left_t   = hamon::mdspan<float, ext_t, hamon::layout_left>;
+	using padded_t = hamon::mdspan<float, ext_t, hamon::layout_right_padded<16>>;
+	using tiled_t  = hamon::mdspan<float, ext_t, hamon::layout_tiled<kTile, kTile>>;
+
+	auto const size = static_cast<std::size_t>(n) * static_cast<std::size_t>(n);
+	std::vector<float> a(size);
+	std::vector<float> b(size);
+	for (std::size_t i = 0; i < size; ++i)
+	{
+		a[i] = static_cast<float>(i % 1000);
+	}
+
+	// 行の長さを 16 の倍数に切り上げる (n - 1 列にして、パディングが入るようにする)
+	auto const padded_cols = n - 1;
+	std::vector<float> p(static_cast<std::size_t>(n) * static_cast<std::size_t>((padded_cols + 15) / 16 * 16));
+	for (std::size_t i = 0; i < p.size(); ++i)
+	{
+		p[i] = static_cast<float>(i % 1000);
+	}
+
+	right_t  src(a.data(), n, n);
+	right_t  dst(b.data(), n, n);
+	left_t   src_left(a.data(), n, n);
+	padded_t src_padded(p.data(), n, padded_cols);
+	tiled_t  src_tiled(a.data(), n, n);
+	tiled_t  dst_tiled(b.data(), n, n);
+
+	std::printf("N = %d\n", n);
+	std::printf("%-28s %10.2f ms\n", "sum, row traversal",        measure([&]{ return sum_rows(src); }));
+	std::printf("%-28s %10.2f ms\n", "sum, column traversal",     measure([&]{ return sum_cols(src); }));
+	std::printf("%-28s %10.2f ms\n", "sum, layout_left columns",  measure([&]{ return sum_cols(src_left); }));
+	std::printf("%-28s %10.2f ms\n", "sum, padded row traversal", measure([&]{ return sum_rows(src_padded); }));
+	std::printf("%-28s %10.2f ms\n", "transpose, naive",          measure([&]{ return transpose_naive(src, dst); }));
+	std::printf("%-28s %10.2f ms\n", "transpose, 32x32 blocked",  measure([&]{ return transpose_blocked(src, dst); }));
+	std::printf("%-28s %10.2f ms\n", "transpose, layout_tiled",   measure([&]{ return transpose_blocked(src_tiled, dst_tiled); }));
+}
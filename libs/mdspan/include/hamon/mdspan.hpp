@@ -0,0 +1,29 @@
+﻿/**
+ *	@file	mdspan.hpp
+ *
+ *	@brief	MDSpan library
+ */
+
+#ifndef HAMON_MDSPAN_HPP
+#define HAMON_MDSPAN_HPP
+
+#include <hamon/mdspan/aligned_accessor.hpp>
+#include <hamon/mdspan/default_accessor.hpp>
+#include <hamon/mdspan/dextents.hpp>
+#include <hamon/mdspan/dims.hpp>
+#include <hamon/mdspan/extents.hpp>
+#include <hamon/mdspan/full_extent.hpp>
+#include <hamon/mdspan/layout_left.hpp>
+#include <hamon/mdspan/layout_left_padded.hpp>
+#include <hamon/mdspan/layout_right.hpp>
+#include <hamon/mdspan/layout_right_padded.hpp>
+#include <hamon/mdspan/layout_stride.hpp>
+#include <hamon/mdspan/layout_tiled.hpp>
+#include <hamon/mdspan/mdspan.hpp>
+#include <hamon/mdspan/strided_slice.hpp>
+#include <hamon/mdspan/submdspan.hpp>
+#include <hamon/mdspan/submdspan_extents.hpp>
+#include <hamon/mdspan/submdspan_mapping.hpp>
+#include <hamon/mdspan/submdspan_mapping_result.hpp>
+
+#endif // HAMON_MDSPAN_HPP
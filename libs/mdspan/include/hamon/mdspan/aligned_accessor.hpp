@@ -0,0 +1,106 @@
+﻿/**
+ *	@file	aligned_accessor.hpp
+ *
+ *	@brief	aligned_accessor の定義
+ */
+
+#ifndef HAMON_MDSPAN_ALIGNED_ACCESSOR_HPP
+#define HAMON_MDSPAN_ALIGNED_ACCESSOR_HPP
+
+#include <hamon/mdspan/config.hpp>
+
+#if defined(HAMON_USE_STD_MDSPAN)
+
+namespace hamon
+{
+
+using std::aligned_accessor;
+
+}	// namespace hamon
+
+#else
+
+#include <hamon/mdspan/mdspan_fwd.hpp>
+#include <hamon/mdspan/default_accessor.hpp>
+#include <hamon/bit/has_single_bit.hpp>
+#include <hamon/memory/assume_aligned.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/type_traits/enable_if.hpp>
+#include <hamon/type_traits/is_convertible.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+// [mdspan.accessor.aligned.overview]
+// data_handle_type が ByteAlignment バイトにアライメントされていることを
+// コンパイラに伝えるアクセサ。
+// layout_right_padded などと組み合わせることで、各行の先頭がアライメントされた
+// SIMD 向きのデータ構造を表すことができる。
+template <typename ElementType, hamon::size_t ByteAlignment>
+struct aligned_accessor
+{
+	// [mdspan.accessor.aligned.overview]/1
+	static_assert(hamon::has_single_bit(ByteAlignment), "");
+	static_assert(ByteAlignment >= alignof(ElementType), "");
+
+	using offset_policy = hamon::default_accessor<ElementType>;
+	using element_type = ElementType;
+	using reference = ElementType&;
+	using data_handle_type = ElementType*;
+
+	static HAMON_CXX11_CONSTEXPR hamon::size_t byte_alignment = ByteAlignment;
+
+	HAMON_CXX11_CONSTEXPR aligned_accessor() HAMON_NOEXCEPT = default;
+
+	// [mdspan.accessor.aligned.members]/1
+	template <typename OtherElementType, hamon::size_t OtherByteAlignment,
+		typename = hamon::enable_if_t<
+			hamon::is_convertible<OtherElementType(*)[], element_type(*)[]>::value &&	// [mdspan.accessor.aligned.members]/1.1
+			OtherByteAlignment >= ByteAlignment>>										// [mdspan.accessor.aligned.members]/1.2
+	HAMON_CXX11_CONSTEXPR
+	aligned_accessor(aligned_accessor<OtherElementType, OtherByteAlignment>) HAMON_NOEXCEPT {}
+
+	// [mdspan.accessor.aligned.members]/3
+	template <typename OtherElementType,
+		typename = hamon::enable_if_t<
+			hamon::is_convertible<OtherElementType(*)[], element_type(*)[]>::value>>
+	HAMON_CXX11_CONSTEXPR explicit
+	aligned_accessor(hamon::default_accessor<OtherElementType>) HAMON_NOEXCEPT {}
+
+	// [mdspan.accessor.aligned.members]/4
+	template <typename OtherElementType,
+		typename = hamon::enable_if_t<
+			hamon::is_convertible<element_type(*)[], OtherElementType(*)[]>::value>>
+	HAMON_CXX11_CONSTEXPR
+	operator hamon::default_accessor<OtherElementType>() const HAMON_NOEXCEPT
+	{
+		return {};
+	}
+
+	HAMON_CXX11_CONSTEXPR reference
+	access(data_handle_type p, hamon::size_t i) const HAMON_NOEXCEPT
+	{
+		// [mdspan.accessor.aligned.members]/6
+		return hamon::assume_aligned<ByteAlignment>(p)[i];
+	}
+
+	HAMON_CXX11_CONSTEXPR typename offset_policy::data_handle_type
+	offset(data_handle_type p, hamon::size_t i) const HAMON_NOEXCEPT
+	{
+		// [mdspan.accessor.aligned.members]/8
+		return p + i;
+	}
+};
+
+#if !defined(HAMON_HAS_CXX17_INLINE_VARIABLES)
+template <typename ElementType, hamon::size_t ByteAlignment>
+HAMON_CXX11_CONSTEXPR hamon::size_t
+aligned_accessor<ElementType, ByteAlignment>::byte_alignment;
+#endif
+
+}	// namespace hamon
+
+#endif
+
+#endif // HAMON_MDSPAN_ALIGNED_ACCESSOR_HPP
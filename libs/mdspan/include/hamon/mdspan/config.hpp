@@ -0,0 +1,24 @@
+﻿/**
+ *	@file	config.hpp
+ *
+ *	@brief
+ */
+
+#ifndef HAMON_MDSPAN_CONFIG_HPP
+#define HAMON_MDSPAN_CONFIG_HPP
+
+#include <hamon/config.hpp>
+#include <hamon/span/config.hpp>
+
+#if (HAMON_CXX_STANDARD >= 23) && HAMON_HAS_INCLUDE(<mdspan>)
+#include <mdspan>
+#endif
+
+#if defined(__cpp_lib_mdspan) && (__cpp_lib_mdspan >= 202406L) && \
+	defined(__cpp_lib_submdspan) && (__cpp_lib_submdspan >= 202411L) && \
+	defined(__cpp_lib_aligned_accessor) && (__cpp_lib_aligned_accessor >= 202411L) && \
+	defined(HAMON_USE_STD_SPAN)
+#  define HAMON_USE_STD_MDSPAN
+#endif
+
+#endif // HAMON_MDSPAN_CONFIG_HPP
@@ -0,0 +1,76 @@
+﻿/**
+ *	@file	default_accessor.hpp
+ *
+ *	@brief	default_accessor の定義
+ */
+
+#ifndef HAMON_MDSPAN_DEFAULT_ACCESSOR_HPP
+#define HAMON_MDSPAN_DEFAULT_ACCESSOR_HPP
+
+#include <hamon/mdspan/config.hpp>
+
+#if defined(HAMON_USE_STD_MDSPAN)
+
+namespace hamon
+{
+
+using std::default_accessor;
+
+}	// namespace hamon
+
+#else
+
+#include <hamon/mdspan/mdspan_fwd.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/type_traits/enable_if.hpp>
+#include <hamon/type_traits/is_abstract.hpp>
+#include <hamon/type_traits/is_array.hpp>
+#include <hamon/type_traits/is_convertible.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+// [mdspan.accessor.default.overview]
+template <typename ElementType>
+struct default_accessor
+{
+	// [mdspan.accessor.default.overview]/2
+	static_assert(sizeof(ElementType) > 0, "");
+	static_assert(!hamon::is_abstract<ElementType>::value, "");
+	static_assert(!hamon::is_array<ElementType>::value, "");
+
+	using offset_policy = default_accessor;
+	using element_type = ElementType;
+	using reference = ElementType&;
+	using data_handle_type = ElementType*;
+
+	HAMON_CXX11_CONSTEXPR default_accessor() HAMON_NOEXCEPT = default;
+
+	// [mdspan.accessor.default.members]/1
+	template <typename OtherElementType,
+		typename = hamon::enable_if_t<
+			hamon::is_convertible<OtherElementType(*)[], element_type(*)[]>::value>>
+	HAMON_CXX11_CONSTEXPR
+	default_accessor(default_accessor<OtherElementType>) HAMON_NOEXCEPT {}
+
+	HAMON_CXX11_CONSTEXPR reference
+	access(data_handle_type p, hamon::size_t i) const HAMON_NOEXCEPT
+	{
+		// [mdspan.accessor.default.members]/2
+		return p[i];
+	}
+
+	HAMON_CXX11_CONSTEXPR data_handle_type
+	offset(data_handle_type p, hamon::size_t i) const HAMON_NOEXCEPT
+	{
+		// [mdspan.accessor.default.members]/3
+		return p + i;
+	}
+};
+
+}	// namespace hamon
+
+#endif
+
+#endif // HAMON_MDSPAN_DEFAULT_ACCESSOR_HPP
@@ -0,0 +1,60 @@
+﻿/**
+ *	@file	extents_storage.hpp
+ *
+ *	@brief	extents_storage の定義
+ */
+
+#ifndef HAMON_MDSPAN_DETAIL_EXTENTS_STORAGE_HPP
+#define HAMON_MDSPAN_DETAIL_EXTENTS_STORAGE_HPP
+
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+namespace detail
+{
+
+/**
+ *	@brief	extents の動的な要素数を保持する
+ *
+ *	動的な要素数が無いときは空のクラスになる。
+ */
+template <typename IndexType, hamon::size_t N>
+struct extents_storage
+{
+	IndexType	m_values[N];
+
+	template <typename... Values>
+	HAMON_CXX11_CONSTEXPR
+	extents_storage(Values... values) HAMON_NOEXCEPT
+		: m_values{values...}
+	{}
+
+	HAMON_CXX11_CONSTEXPR IndexType
+	get(hamon::size_t i) const HAMON_NOEXCEPT
+	{
+		return m_values[i];
+	}
+};
+
+template <typename IndexType>
+struct extents_storage<IndexType, 0>
+{
+	HAMON_CXX11_CONSTEXPR
+	extents_storage() HAMON_NOEXCEPT
+	{}
+
+	HAMON_CXX11_CONSTEXPR IndexType
+	get(hamon::size_t) const HAMON_NOEXCEPT
+	{
+		return 0;
+	}
+};
+
+}	// namespace detail
+
+}	// namespace hamon
+
+#endif // HAMON_MDSPAN_DETAIL_EXTENTS_STORAGE_HPP
@@ -0,0 +1,33 @@
+﻿/**
+ *	@file	is_extents.hpp
+ *
+ *	@brief	is_extents の定義
+ */
+
+#ifndef HAMON_MDSPAN_DETAIL_IS_EXTENTS_HPP
+#define HAMON_MDSPAN_DETAIL_IS_EXTENTS_HPP
+
+#include <hamon/mdspan/mdspan_fwd.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/type_traits/bool_constant.hpp>
+
+namespace hamon
+{
+
+namespace detail
+{
+
+// [mdspan.layout.reqmts]/1 is-extents
+template <typename T>
+struct is_extents
+	: public hamon::false_type {};
+
+template <typename IndexType, hamon::size_t... Extents>
+struct is_extents<hamon::extents<IndexType, Extents...>>
+	: public hamon::true_type {};
+
+}	// namespace detail
+
+}	// namespace hamon
+
+#endif // HAMON_MDSPAN_DETAIL_IS_EXTENTS_HPP
@@ -0,0 +1,33 @@
+﻿/**
+ *	@file	is_index_convertible.hpp
+ *
+ *	@brief	is_index_convertible の定義
+ */
+
+#ifndef HAMON_MDSPAN_DETAIL_IS_INDEX_CONVERTIBLE_HPP
+#define HAMON_MDSPAN_DETAIL_IS_INDEX_CONVERTIBLE_HPP
+
+#include <hamon/type_traits/bool_constant.hpp>
+#include <hamon/type_traits/is_convertible.hpp>
+#include <hamon/type_traits/is_nothrow_constructible.hpp>
+
+namespace hamon
+{
+
+namespace detail
+{
+
+// is_convertible_v<T, IndexType> && is_nothrow_constructible_v<IndexType, T>
+template <typename T, typename IndexType>
+struct is_index_convertible
+	: public hamon::bool_constant<
+		hamon::is_convertible<T, IndexType>::value &&
+		hamon::is_nothrow_constructible<IndexType, T>::value
+	>
+{};
+
+}	// namespace detail
+
+}	// namespace hamon
+
+#endif // HAMON_MDSPAN_DETAIL_IS_INDEX_CONVERTIBLE_HPP
@@ -0,0 +1,41 @@
+﻿/**
+ *	@file	is_integral_constant_like.hpp
+ *
+ *	@brief	is_integral_constant_like の定義
+ */
+
+#ifndef HAMON_MDSPAN_DETAIL_IS_INTEGRAL_CONSTANT_LIKE_HPP
+#define HAMON_MDSPAN_DETAIL_IS_INTEGRAL_CONSTANT_LIKE_HPP
+
+#include <hamon/type_traits/bool_constant.hpp>
+#include <hamon/type_traits/is_convertible.hpp>
+#include <hamon/type_traits/is_integral.hpp>
+#include <hamon/type_traits/is_same.hpp>
+#include <hamon/type_traits/remove_cv.hpp>
+#include <hamon/type_traits/void_t.hpp>
+
+namespace hamon
+{
+
+namespace detail
+{
+
+// [span.syn]/2 integral-constant-like
+template <typename T, typename = void>
+struct is_integral_constant_like
+	: public hamon::false_type {};
+
+template <typename T>
+struct is_integral_constant_like<T, hamon::void_t<decltype(T::value)>>
+	: public hamon::bool_constant<
+		hamon::is_integral<hamon::remove_cv_t<decltype(T::value)>>::value &&
+		!hamon::is_same<bool, hamon::remove_cv_t<decltype(T::value)>>::value &&
+		hamon::is_convertible<T, hamon::remove_cv_t<decltype(T::value)>>::value
+	>
+{};
+
+}	// namespace detail
+
+}	// namespace hamon
+
+#endif // HAMON_MDSPAN_DETAIL_IS_INTEGRAL_CONSTANT_LIKE_HPP
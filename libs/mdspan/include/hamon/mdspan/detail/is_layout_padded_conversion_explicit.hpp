@@ -0,0 +1,37 @@
+﻿/**
+ *	@file	is_layout_padded_conversion_explicit.hpp
+ *
+ *	@brief	is_layout_padded_conversion_explicit の定義
+ */
+
+#ifndef HAMON_MDSPAN_DETAIL_IS_LAYOUT_PADDED_CONVERSION_EXPLICIT_HPP
+#define HAMON_MDSPAN_DETAIL_IS_LAYOUT_PADDED_CONVERSION_EXPLICIT_HPP
+
+#include <hamon/span/dynamic_extent.hpp>
+#include <hamon/type_traits/bool_constant.hpp>
+#include <hamon/type_traits/is_convertible.hpp>
+
+namespace hamon
+{
+
+namespace detail
+{
+
+// [mdspan.layout.leftpad.cons]/16
+// [mdspan.layout.rightpad.cons]/16
+// パディングされたマッピング同士の変換が explicit になるかどうか
+template <typename From, typename To>
+struct is_layout_padded_conversion_explicit
+	: public hamon::bool_constant<
+		(To::extents_type::rank() > 1 &&
+			(To::padding_value != hamon::dynamic_extent ||
+			 From::padding_value == hamon::dynamic_extent)) ||
+		!hamon::is_convertible<typename From::extents_type, typename To::extents_type>::value
+	>
+{};
+
+}	// namespace detail
+
+}	// namespace hamon
+
+#endif // HAMON_MDSPAN_DETAIL_IS_LAYOUT_PADDED_CONVERSION_EXPLICIT_HPP
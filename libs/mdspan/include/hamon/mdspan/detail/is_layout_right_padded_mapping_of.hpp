@@ -0,0 +1,39 @@
+﻿/**
+ *	@file	is_layout_right_padded_mapping_of.hpp
+ *
+ *	@brief	is_layout_right_padded_mapping_of の定義
+ */
+
+#ifndef HAMON_MDSPAN_DETAIL_IS_LAYOUT_RIGHT_PADDED_MAPPING_OF_HPP
+#define HAMON_MDSPAN_DETAIL_IS_LAYOUT_RIGHT_PADDED_MAPPING_OF_HPP
+
+#include <hamon/mdspan/mdspan_fwd.hpp>
+#include <hamon/type_traits/bool_constant.hpp>
+#include <hamon/type_traits/is_same.hpp>
+#include <hamon/type_traits/void_t.hpp>
+
+namespace hamon
+{
+
+namespace detail
+{
+
+// [mdspan.layout.policy.overview]/3 is-layout-right-padded-mapping-of
+template <typename Mapping, typename = void>
+struct is_layout_right_padded_mapping_of
+	: public hamon::false_type {};
+
+template <typename Mapping>
+struct is_layout_right_padded_mapping_of<Mapping,
+	hamon::void_t<decltype(Mapping::padding_value), typename Mapping::extents_type>>
+	: public hamon::is_same<
+		typename hamon::layout_right_padded<Mapping::padding_value>::template mapping<typename Mapping::extents_type>,
+		Mapping
+	>
+{};
+
+}	// namespace detail
+
+}	// namespace hamon
+
+#endif // HAMON_MDSPAN_DETAIL_IS_LAYOUT_RIGHT_PADDED_MAPPING_OF_HPP
@@ -0,0 +1,37 @@
+﻿/**
+ *	@file	is_mapping_of.hpp
+ *
+ *	@brief	is_mapping_of の定義
+ */
+
+#ifndef HAMON_MDSPAN_DETAIL_IS_MAPPING_OF_HPP
+#define HAMON_MDSPAN_DETAIL_IS_MAPPING_OF_HPP
+
+#include <hamon/type_traits/bool_constant.hpp>
+#include <hamon/type_traits/is_same.hpp>
+#include <hamon/type_traits/void_t.hpp>
+
+namespace hamon
+{
+
+namespace detail
+{
+
+// [mdspan.layout.policy.overview]/1 is-mapping-of
+template <typename Layout, typename Mapping, typename = void>
+struct is_mapping_of
+	: public hamon::false_type {};
+
+template <typename Layout, typename Mapping>
+struct is_mapping_of<Layout, Mapping, hamon::void_t<typename Mapping::extents_type>>
+	: public hamon::is_same<
+		typename Layout::template mapping<typename Mapping::extents_type>,
+		Mapping
+	>
+{};
+
+}	// namespace detail
+
+}	// namespace hamon
+
+#endif // HAMON_MDSPAN_DETAIL_IS_MAPPING_OF_HPP
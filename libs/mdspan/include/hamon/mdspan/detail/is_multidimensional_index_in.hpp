@@ -0,0 +1,67 @@
+﻿/**
+ *	@file	is_multidimensional_index_in.hpp
+ *
+ *	@brief	is_multidimensional_index_in の定義
+ */
+
+#ifndef HAMON_MDSPAN_DETAIL_IS_MULTIDIMENSIONAL_INDEX_IN_HPP
+#define HAMON_MDSPAN_DETAIL_IS_MULTIDIMENSIONAL_INDEX_IN_HPP
+
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/type_traits/bool_constant.hpp>
+#include <hamon/type_traits/is_signed.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+namespace detail
+{
+
+template <typename T>
+HAMON_CXX11_CONSTEXPR bool
+is_non_negative_index(T i, hamon::true_type) HAMON_NOEXCEPT
+{
+	return i >= 0;
+}
+
+template <typename T>
+HAMON_CXX11_CONSTEXPR bool
+is_non_negative_index(T, hamon::false_type) HAMON_NOEXCEPT
+{
+	return true;
+}
+
+template <typename Extents>
+HAMON_CXX11_CONSTEXPR bool
+is_multidimensional_index_in_impl(Extents const&, hamon::size_t) HAMON_NOEXCEPT
+{
+	return true;
+}
+
+template <typename Extents, typename... Rest>
+HAMON_CXX11_CONSTEXPR bool
+is_multidimensional_index_in_impl(Extents const& e, hamon::size_t r,
+	typename Extents::index_type i, Rest... rest) HAMON_NOEXCEPT
+{
+	return
+		hamon::detail::is_non_negative_index(i, hamon::is_signed<typename Extents::index_type>{}) &&
+		i < e.extent(r) &&
+		hamon::detail::is_multidimensional_index_in_impl(e, r + 1, rest...);
+}
+
+// [mdspan.overview]/5
+// 各添字 i[k] が 0 <= i[k] < e.extent(k) を満たすかどうか
+template <typename Extents, typename... Indices>
+HAMON_CXX11_CONSTEXPR bool
+is_multidimensional_index_in(Extents const& e, Indices... indices) HAMON_NOEXCEPT
+{
+	return hamon::detail::is_multidimensional_index_in_impl(e, 0,
+		static_cast<typename Extents::index_type>(indices)...);
+}
+
+}	// namespace detail
+
+}	// namespace hamon
+
+#endif // HAMON_MDSPAN_DETAIL_IS_MULTIDIMENSIONAL_INDEX_IN_HPP
@@ -0,0 +1,48 @@
+﻿/**
+ *	@file	layout_mapping_alike.hpp
+ *
+ *	@brief	layout_mapping_alike の定義
+ */
+
+#ifndef HAMON_MDSPAN_DETAIL_LAYOUT_MAPPING_ALIKE_HPP
+#define HAMON_MDSPAN_DETAIL_LAYOUT_MAPPING_ALIKE_HPP
+
+#include <hamon/mdspan/detail/is_extents.hpp>
+#include <hamon/type_traits/bool_constant.hpp>
+#include <hamon/type_traits/is_same.hpp>
+#include <hamon/type_traits/void_t.hpp>
+#include <hamon/utility/declval.hpp>
+
+namespace hamon
+{
+
+namespace detail
+{
+
+// [mdspan.layout.stride.expo]/1 layout-mapping-alike
+template <typename M, typename = void>
+struct layout_mapping_alike
+	: public hamon::false_type {};
+
+template <typename M>
+struct layout_mapping_alike<M, hamon::void_t<
+	typename M::extents_type,
+	typename M::index_type,
+	typename M::rank_type,
+	typename M::layout_type,
+	decltype(hamon::declval<M const&>().extents()),
+	hamon::bool_constant<M::is_always_strided()>,
+	hamon::bool_constant<M::is_always_exhaustive()>,
+	hamon::bool_constant<M::is_always_unique()>>>
+	: public hamon::bool_constant<
+		hamon::detail::is_extents<typename M::extents_type>::value &&
+		hamon::is_same<typename M::index_type, typename M::extents_type::index_type>::value &&
+		hamon::is_same<typename M::rank_type, typename M::extents_type::rank_type>::value
+	>
+{};
+
+}	// namespace detail
+
+}	// namespace hamon
+
+#endif // HAMON_MDSPAN_DETAIL_LAYOUT_MAPPING_ALIKE_HPP
@@ -0,0 +1,31 @@
+﻿/**
+ *	@file	least_multiple_at_least.hpp
+ *
+ *	@brief	least_multiple_at_least の定義
+ */
+
+#ifndef HAMON_MDSPAN_DETAIL_LEAST_MULTIPLE_AT_LEAST_HPP
+#define HAMON_MDSPAN_DETAIL_LEAST_MULTIPLE_AT_LEAST_HPP
+
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+namespace detail
+{
+
+// [mdspan.layout.policy.overview]/2 LEAST-MULTIPLE-AT-LEAST
+// y 以上で最小の x の倍数
+template <typename T>
+HAMON_CXX11_CONSTEXPR T
+least_multiple_at_least(T x, T y) HAMON_NOEXCEPT
+{
+	return x == 0 ? y : static_cast<T>(x * ((y + x - 1) / x));
+}
+
+}	// namespace detail
+
+}	// namespace hamon
+
+#endif // HAMON_MDSPAN_DETAIL_LEAST_MULTIPLE_AT_LEAST_HPP
@@ -0,0 +1,36 @@
+﻿/**
+ *	@file	maybe_static_ext.hpp
+ *
+ *	@brief	maybe_static_ext の定義
+ */
+
+#ifndef HAMON_MDSPAN_DETAIL_MAYBE_STATIC_EXT_HPP
+#define HAMON_MDSPAN_DETAIL_MAYBE_STATIC_EXT_HPP
+
+#include <hamon/mdspan/detail/is_integral_constant_like.hpp>
+#include <hamon/span/dynamic_extent.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/type_traits/integral_constant.hpp>
+
+namespace hamon
+{
+
+namespace detail
+{
+
+// [span.syn]/3 maybe-static-ext
+template <typename T, bool = hamon::detail::is_integral_constant_like<T>::value>
+struct maybe_static_ext
+	: public hamon::integral_constant<hamon::size_t, static_cast<hamon::size_t>(T::value)>
+{};
+
+template <typename T>
+struct maybe_static_ext<T, false>
+	: public hamon::integral_constant<hamon::size_t, hamon::dynamic_extent>
+{};
+
+}	// namespace detail
+
+}	// namespace hamon
+
+#endif // HAMON_MDSPAN_DETAIL_MAYBE_STATIC_EXT_HPP
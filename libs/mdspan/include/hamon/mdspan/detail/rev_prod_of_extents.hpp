@@ -0,0 +1,36 @@
+﻿/**
+ *	@file	rev_prod_of_extents.hpp
+ *
+ *	@brief	rev_prod_of_extents の定義
+ */
+
+#ifndef HAMON_MDSPAN_DETAIL_REV_PROD_OF_EXTENTS_HPP
+#define HAMON_MDSPAN_DETAIL_REV_PROD_OF_EXTENTS_HPP
+
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+namespace detail
+{
+
+// [mdspan.extents.expo]/10
+// [i + 1, rank) の要素数の積
+template <typename Extents>
+HAMON_CXX11_CONSTEXPR typename Extents::index_type
+rev_prod_of_extents(Extents const& e, hamon::size_t i) HAMON_NOEXCEPT
+{
+	using index_type = typename Extents::index_type;
+	return i + 1 >= Extents::rank() ?
+		index_type(1) :
+		static_cast<index_type>(
+			e.extent(i + 1) * hamon::detail::rev_prod_of_extents(e, i + 1));
+}
+
+}	// namespace detail
+
+}	// namespace hamon
+
+#endif // HAMON_MDSPAN_DETAIL_REV_PROD_OF_EXTENTS_HPP
@@ -0,0 +1,84 @@
+﻿/**
+ *	@file	static_extents_helper.hpp
+ *
+ *	@brief	static_extents_helper の定義
+ */
+
+#ifndef HAMON_MDSPAN_DETAIL_STATIC_EXTENTS_HELPER_HPP
+#define HAMON_MDSPAN_DETAIL_STATIC_EXTENTS_HELPER_HPP
+
+#include <hamon/span/dynamic_extent.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+namespace detail
+{
+
+/**
+ *	@brief	静的な要素数のリストに対する問い合わせ
+ *
+ *	rank は小さいので、再帰で書いてもインライン展開されて定数になる。
+ */
+template <hamon::size_t... Extents>
+struct static_extents_helper
+{
+	static HAMON_CXX11_CONSTEXPR hamon::size_t
+	static_extent(hamon::size_t) HAMON_NOEXCEPT
+	{
+		return 0;
+	}
+
+	static HAMON_CXX11_CONSTEXPR hamon::size_t
+	dynamic_index(hamon::size_t) HAMON_NOEXCEPT
+	{
+		return 0;
+	}
+
+	static HAMON_CXX11_CONSTEXPR hamon::size_t
+	dynamic_index_inv(hamon::size_t) HAMON_NOEXCEPT
+	{
+		return 0;
+	}
+};
+
+template <hamon::size_t E, hamon::size_t... Rest>
+struct static_extents_helper<E, Rest...>
+{
+private:
+	using next = static_extents_helper<Rest...>;
+
+public:
+	// r 番目の静的な要素数
+	static HAMON_CXX11_CONSTEXPR hamon::size_t
+	static_extent(hamon::size_t r) HAMON_NOEXCEPT
+	{
+		return r == 0 ? E : next::static_extent(r - 1);
+	}
+
+	// [mdspan.extents.expo]/4
+	// [0, r) にある動的な要素数の数
+	static HAMON_CXX11_CONSTEXPR hamon::size_t
+	dynamic_index(hamon::size_t r) HAMON_NOEXCEPT
+	{
+		return r == 0 ? 0 : (E == hamon::dynamic_extent ? 1 : 0) + next::dynamic_index(r - 1);
+	}
+
+	// [mdspan.extents.expo]/6
+	// i 番目の動的な要素数が何番目の次元か
+	static HAMON_CXX11_CONSTEXPR hamon::size_t
+	dynamic_index_inv(hamon::size_t i) HAMON_NOEXCEPT
+	{
+		return E == hamon::dynamic_extent ?
+			(i == 0 ? 0 : 1 + next::dynamic_index_inv(i - 1)) :
+			1 + next::dynamic_index_inv(i);
+	}
+};
+
+}	// namespace detail
+
+}	// namespace hamon
+
+#endif // HAMON_MDSPAN_DETAIL_STATIC_EXTENTS_HELPER_HPP
@@ -0,0 +1,258 @@
+﻿/**
+ *	@file	submdspan_slice.hpp
+ *
+ *	@brief	submdspan のスライス指定子を扱うための関数群
+ */
+
+#ifndef HAMON_MDSPAN_DETAIL_SUBMDSPAN_SLICE_HPP
+#define HAMON_MDSPAN_DETAIL_SUBMDSPAN_SLICE_HPP
+
+#include <hamon/mdspan/full_extent.hpp>
+#include <hamon/mdspan/strided_slice.hpp>
+#include <hamon/mdspan/detail/is_index_convertible.hpp>
+#include <hamon/mdspan/detail/is_integral_constant_like.hpp>
+#include <hamon/mdspan/detail/maybe_static_ext.hpp>
+#include <hamon/span/dynamic_extent.hpp>
+#include <hamon/tuple/adl_get.hpp>
+#include <hamon/tuple/tuple_element.hpp>
+#include <hamon/tuple/concepts/pair_like.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/type_traits/bool_constant.hpp>
+#include <hamon/type_traits/enable_if.hpp>
+#include <hamon/type_traits/integral_constant.hpp>
+#include <hamon/type_traits/is_same.hpp>
+#include <hamon/type_traits/remove_cvref.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+namespace detail
+{
+
+// スライス指定子の種類
+enum class submdspan_slice_kind
+{
+	index,		// インデックス (その次元は取り除かれる)
+	full,		// full_extent_t
+	pair,		// pair-like な [first, last) の範囲
+	strided,	// strided_slice
+	invalid,
+};
+
+template <typename T>
+struct is_strided_slice
+	: public hamon::false_type {};
+
+template <typename OffsetType, typename ExtentType, typename StrideType>
+struct is_strided_slice<hamon::strided_slice<OffsetType, ExtentType, StrideType>>
+	: public hamon::true_type {};
+
+// [mdspan.sub.extents]/2
+template <typename IndexType, typename S,
+	typename T = hamon::remove_cvref_t<S>>
+struct submdspan_slice_kind_of
+	: public hamon::integral_constant<submdspan_slice_kind,
+		hamon::detail::is_index_convertible<S, IndexType>::value ?
+			submdspan_slice_kind::index :
+		hamon::is_same<T, hamon::full_extent_t>::value ?
+			submdspan_slice_kind::full :
+		hamon::detail::is_strided_slice<T>::value ?
+			submdspan_slice_kind::strided :
+		hamon::pair_like_t<T>::value ?
+			submdspan_slice_kind::pair :
+			submdspan_slice_kind::invalid
+	>
+{};
+
+template <submdspan_slice_kind K>
+using submdspan_slice_kind_tag = hamon::integral_constant<submdspan_slice_kind, K>;
+
+// [mdspan.sub.helpers]/4 first_
+template <typename IndexType, typename S>
+HAMON_CXX11_CONSTEXPR IndexType
+submdspan_first_impl(S const& s, submdspan_slice_kind_tag<submdspan_slice_kind::index>)
+{
+	return static_cast<IndexType>(s);
+}
+
+template <typename IndexType, typename S>
+HAMON_CXX11_CONSTEXPR IndexType
+submdspan_first_impl(S const&, submdspan_slice_kind_tag<submdspan_slice_kind::full>)
+{
+	return 0;
+}
+
+template <typename IndexType, typename S>
+HAMON_CXX11_CONSTEXPR IndexType
+submdspan_first_impl(S const& s, submdspan_slice_kind_tag<submdspan_slice_kind::pair>)
+{
+	return static_cast<IndexType>(hamon::adl_get<0>(s));
+}
+
+template <typename IndexType, typename S>
+HAMON_CXX11_CONSTEXPR IndexType
+submdspan_first_impl(S const& s, submdspan_slice_kind_tag<submdspan_slice_kind::strided>)
+{
+	return static_cast<IndexType>(s.offset);
+}
+
+template <typename IndexType, typename S>
+HAMON_CXX11_CONSTEXPR IndexType
+submdspan_first(S const& s)
+{
+	return hamon::detail::submdspan_first_impl<IndexType>(
+		s, hamon::detail::submdspan_slice_kind_of<IndexType, S>{});
+}
+
+// [mdspan.sub.helpers]/6 last_
+template <typename IndexType, typename S>
+HAMON_CXX11_CONSTEXPR IndexType
+submdspan_last_impl(S const& s, IndexType, submdspan_slice_kind_tag<submdspan_slice_kind::index>)
+{
+	return static_cast<IndexType>(static_cast<IndexType>(s) + 1);
+}
+
+template <typename IndexType, typename S>
+HAMON_CXX11_CONSTEXPR IndexType
+submdspan_last_impl(S const&, IndexType extent, submdspan_slice_kind_tag<submdspan_slice_kind::full>)
+{
+	return extent;
+}
+
+template <typename IndexType, typename S>
+HAMON_CXX11_CONSTEXPR IndexType
+submdspan_last_impl(S const& s, IndexType, submdspan_slice_kind_tag<submdspan_slice_kind::pair>)
+{
+	return static_cast<IndexType>(hamon::adl_get<1>(s));
+}
+
+template <typename IndexType, typename S>
+HAMON_CXX11_CONSTEXPR IndexType
+submdspan_last_impl(S const& s, IndexType, submdspan_slice_kind_tag<submdspan_slice_kind::strided>)
+{
+	return static_cast<IndexType>(static_cast<IndexType>(s.offset) + static_cast<IndexType>(s.extent));
+}
+
+template <typename IndexType, typename S>
+HAMON_CXX11_CONSTEXPR IndexType
+submdspan_last(S const& s, IndexType extent)
+{
+	return hamon::detail::submdspan_last_impl<IndexType>(
+		s, extent, hamon::detail::submdspan_slice_kind_of<IndexType, S>{});
+}
+
+// [mdspan.sub.extents]/5
+// 部分mdspanでのその次元の要素数
+template <typename IndexType, typename S>
+HAMON_CXX11_CONSTEXPR IndexType
+submdspan_sub_extent_impl(S const& s, IndexType, submdspan_slice_kind_tag<submdspan_slice_kind::strided>)
+{
+	return static_cast<IndexType>(s.extent) == 0 ?
+		IndexType(0) :
+		static_cast<IndexType>(
+			1 + (static_cast<IndexType>(s.extent) - 1) / static_cast<IndexType>(s.stride));
+}
+
+template <typename IndexType, typename S, submdspan_slice_kind K>
+HAMON_CXX11_CONSTEXPR IndexType
+submdspan_sub_extent_impl(S const& s, IndexType extent, submdspan_slice_kind_tag<K>)
+{
+	return static_cast<IndexType>(
+		hamon::detail::submdspan_last(s, extent) -
+		hamon::detail::submdspan_first<IndexType>(s));
+}
+
+template <typename IndexType, typename S>
+HAMON_CXX11_CONSTEXPR IndexType
+submdspan_sub_extent(S const& s, IndexType extent)
+{
+	return hamon::detail::submdspan_sub_extent_impl(
+		s, extent, hamon::detail::submdspan_slice_kind_of<IndexType, S>{});
+}
+
+// [mdspan.sub.map.common]/5
+// 部分mdspanでのストライドに掛ける係数
+template <typename IndexType, typename S>
+HAMON_CXX11_CONSTEXPR IndexType
+submdspan_stride_factor_impl(S const& s, submdspan_slice_kind_tag<submdspan_slice_kind::strided>)
+{
+	return static_cast<IndexType>(s.stride) < static_cast<IndexType>(s.extent) ?
+		static_cast<IndexType>(s.stride) :
+		IndexType(1);
+}
+
+template <typename IndexType, typename S, submdspan_slice_kind K>
+HAMON_CXX11_CONSTEXPR IndexType
+submdspan_stride_factor_impl(S const&, submdspan_slice_kind_tag<K>)
+{
+	return 1;
+}
+
+template <typename IndexType, typename S>
+HAMON_CXX11_CONSTEXPR IndexType
+submdspan_stride_factor(S const& s)
+{
+	return hamon::detail::submdspan_stride_factor_impl<IndexType>(
+		s, hamon::detail::submdspan_slice_kind_of<IndexType, S>{});
+}
+
+// [mdspan.sub.extents]/4
+// 部分mdspanでのその次元の静的な要素数
+template <typename Extents, hamon::size_t K, typename S,
+	submdspan_slice_kind = submdspan_slice_kind_of<typename Extents::index_type, S>::value,
+	typename = void>
+struct submdspan_static_sub_extent
+	: public hamon::integral_constant<hamon::size_t, hamon::dynamic_extent> {};
+
+// [mdspan.sub.extents]/4.1
+template <typename Extents, hamon::size_t K, typename S>
+struct submdspan_static_sub_extent<Extents, K, S, submdspan_slice_kind::full>
+	: public hamon::integral_constant<hamon::size_t, Extents::static_extent(K)> {};
+
+// [mdspan.sub.extents]/4.2
+template <typename Extents, hamon::size_t K, typename S>
+struct submdspan_static_sub_extent<Extents, K, S, submdspan_slice_kind::pair,
+	hamon::enable_if_t<
+		hamon::detail::is_integral_constant_like<hamon::tuple_element_t<0, hamon::remove_cvref_t<S>>>::value &&
+		hamon::detail::is_integral_constant_like<hamon::tuple_element_t<1, hamon::remove_cvref_t<S>>>::value>>
+	: public hamon::integral_constant<hamon::size_t,
+		static_cast<hamon::size_t>(
+			hamon::tuple_element_t<1, hamon::remove_cvref_t<S>>::value -
+			hamon::tuple_element_t<0, hamon::remove_cvref_t<S>>::value)> {};
+
+// [mdspan.sub.extents]/4.3, 4.4
+template <typename Extents, hamon::size_t K, typename S>
+struct submdspan_static_sub_extent<Extents, K, S, submdspan_slice_kind::strided,
+	hamon::enable_if_t<
+		hamon::detail::is_integral_constant_like<typename hamon::remove_cvref_t<S>::extent_type>::value>>
+	: public hamon::integral_constant<hamon::size_t,
+		hamon::remove_cvref_t<S>::extent_type::value == 0 ?
+			0 :
+		hamon::detail::is_integral_constant_like<typename hamon::remove_cvref_t<S>::stride_type>::value ?
+			static_cast<hamon::size_t>(
+				1 + (hamon::remove_cvref_t<S>::extent_type::value - 1) /
+				hamon::detail::maybe_static_ext<typename hamon::remove_cvref_t<S>::stride_type>::value) :
+			hamon::dynamic_extent> {};
+
+// [mdspan.sub.map.common]/2 is-unit-stride-slice
+template <typename IndexType, typename S,
+	submdspan_slice_kind = submdspan_slice_kind_of<IndexType, S>::value>
+struct is_submdspan_unit_stride_slice
+	: public hamon::bool_constant<
+		submdspan_slice_kind_of<IndexType, S>::value == submdspan_slice_kind::full ||
+		submdspan_slice_kind_of<IndexType, S>::value == submdspan_slice_kind::pair>
+{};
+
+template <typename IndexType, typename S>
+struct is_submdspan_unit_stride_slice<IndexType, S, submdspan_slice_kind::strided>
+	: public hamon::bool_constant<
+		hamon::detail::is_integral_constant_like<typename hamon::remove_cvref_t<S>::stride_type>::value &&
+		hamon::detail::maybe_static_ext<typename hamon::remove_cvref_t<S>::stride_type>::value == 1>
+{};
+
+}	// namespace detail
+
+}	// namespace hamon
+
+#endif // HAMON_MDSPAN_DETAIL_SUBMDSPAN_SLICE_HPP
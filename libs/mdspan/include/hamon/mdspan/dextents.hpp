@@ -0,0 +1,54 @@
+﻿/**
+ *	@file	dextents.hpp
+ *
+ *	@brief	dextents の定義
+ */
+
+#ifndef HAMON_MDSPAN_DEXTENTS_HPP
+#define HAMON_MDSPAN_DEXTENTS_HPP
+
+#include <hamon/mdspan/config.hpp>
+
+#if defined(HAMON_USE_STD_MDSPAN)
+
+namespace hamon
+{
+
+using std::dextents;
+
+}	// namespace hamon
+
+#else
+
+#include <hamon/mdspan/extents.hpp>
+#include <hamon/span/dynamic_extent.hpp>
+#include <hamon/cstddef/size_t.hpp>
+
+namespace hamon
+{
+
+namespace detail
+{
+
+template <typename IndexType, hamon::size_t Rank, hamon::size_t... Extents>
+struct make_dextents
+	: public make_dextents<IndexType, Rank - 1, hamon::dynamic_extent, Extents...>
+{};
+
+template <typename IndexType, hamon::size_t... Extents>
+struct make_dextents<IndexType, 0, Extents...>
+{
+	using type = hamon::extents<IndexType, Extents...>;
+};
+
+}	// namespace detail
+
+// [mdspan.extents.dextents], alias template dextents
+template <typename IndexType, hamon::size_t Rank>
+using dextents = typename hamon::detail::make_dextents<IndexType, Rank>::type;
+
+}	// namespace hamon
+
+#endif
+
+#endif // HAMON_MDSPAN_DEXTENTS_HPP
@@ -0,0 +1,37 @@
+﻿/**
+ *	@file	dims.hpp
+ *
+ *	@brief	dims の定義
+ */
+
+#ifndef HAMON_MDSPAN_DIMS_HPP
+#define HAMON_MDSPAN_DIMS_HPP
+
+#include <hamon/mdspan/config.hpp>
+
+#if defined(HAMON_USE_STD_MDSPAN)
+
+namespace hamon
+{
+
+using std::dims;
+
+}	// namespace hamon
+
+#else
+
+#include <hamon/mdspan/dextents.hpp>
+#include <hamon/cstddef/size_t.hpp>
+
+namespace hamon
+{
+
+// [mdspan.extents.dims], alias template dims
+template <hamon::size_t Rank, typename IndexType = hamon::size_t>
+using dims = hamon::dextents<IndexType, Rank>;
+
+}	// namespace hamon
+
+#endif
+
+#endif // HAMON_MDSPAN_DIMS_HPP
@@ -0,0 +1,362 @@
+﻿/**
+ *	@file	extents.hpp
+ *
+ *	@brief	extents の定義
+ */
+
+#ifndef HAMON_MDSPAN_EXTENTS_HPP
+#define HAMON_MDSPAN_EXTENTS_HPP
+
+#include <hamon/mdspan/config.hpp>
+
+#if defined(HAMON_USE_STD_MDSPAN)
+
+namespace hamon
+{
+
+using std::extents;
+
+}	// namespace hamon
+
+#else
+
+#include <hamon/mdspan/mdspan_fwd.hpp>
+#include <hamon/mdspan/detail/extents_storage.hpp>
+#include <hamon/mdspan/detail/is_index_convertible.hpp>
+#include <hamon/mdspan/detail/maybe_static_ext.hpp>
+#include <hamon/mdspan/detail/static_extents_helper.hpp>
+#include <hamon/span/dynamic_extent.hpp>
+#include <hamon/span/span.hpp>
+#include <hamon/array/array.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/limits/numeric_limits.hpp>
+#include <hamon/type_traits/bool_constant.hpp>
+#include <hamon/type_traits/conjunction.hpp>
+#include <hamon/type_traits/disjunction.hpp>
+#include <hamon/type_traits/enable_if.hpp>
+#include <hamon/type_traits/is_convertible.hpp>
+#include <hamon/type_traits/is_integral.hpp>
+#include <hamon/type_traits/is_same.hpp>
+#include <hamon/type_traits/make_unsigned.hpp>
+#include <hamon/utility/cmp_equal.hpp>
+#include <hamon/utility/cmp_less.hpp>
+#include <hamon/utility/in_range.hpp>
+#include <hamon/utility/make_index_sequence.hpp>
+#include <hamon/utility/index_sequence.hpp>
+#include <hamon/assert.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+namespace detail
+{
+
+// [mdspan.extents.cons]/1.2
+template <typename From, typename To, bool = (From::rank() == To::rank())>
+struct is_extents_convertible
+	: public hamon::false_type {};
+
+template <typename OtherIndexType, hamon::size_t... OtherExtents,
+	typename IndexType, hamon::size_t... Extents>
+struct is_extents_convertible<
+	hamon::extents<OtherIndexType, OtherExtents...>,
+	hamon::extents<IndexType, Extents...>, true>
+	: public hamon::conjunction<
+		hamon::bool_constant<
+			OtherExtents == hamon::dynamic_extent ||
+			Extents == hamon::dynamic_extent ||
+			OtherExtents == Extents>...
+	>
+{};
+
+// [mdspan.extents.cons]/4
+template <typename From, typename To>
+struct is_extents_conversion_explicit;
+
+template <typename OtherIndexType, hamon::size_t... OtherExtents,
+	typename IndexType, hamon::size_t... Extents>
+struct is_extents_conversion_explicit<
+	hamon::extents<OtherIndexType, OtherExtents...>,
+	hamon::extents<IndexType, Extents...>>
+	: public hamon::bool_constant<
+		hamon::disjunction<
+			hamon::bool_constant<
+				Extents != hamon::dynamic_extent &&
+				OtherExtents == hamon::dynamic_extent>...
+		>::value ||
+		hamon::cmp_less(
+			hamon::numeric_limits<IndexType>::max(),
+			hamon::numeric_limits<OtherIndexType>::max())
+	>
+{};
+
+}	// namespace detail
+
+// [mdspan.extents.overview]
+template <typename IndexType, hamon::size_t... Extents>
+class extents
+{
+	// [mdspan.extents.overview]/1.1
+	static_assert(hamon::is_integral<IndexType>::value && !hamon::is_same<IndexType, bool>::value, "");
+
+	// [mdspan.extents.overview]/1.2
+	static_assert(hamon::conjunction<hamon::bool_constant<
+		Extents == hamon::dynamic_extent || hamon::in_range<IndexType>(Extents)>...>::value, "");
+
+public:
+	using index_type = IndexType;
+	using size_type = hamon::make_unsigned_t<index_type>;
+	using rank_type = hamon::size_t;
+
+private:
+	using helper = hamon::detail::static_extents_helper<Extents...>;
+
+	using storage_type = hamon::detail::extents_storage<
+		index_type, helper::dynamic_index(sizeof...(Extents))>;
+
+	template <bool B>
+	using from_dynamic_tag = hamon::bool_constant<B>;
+
+	template <typename I, hamon::size_t... E>
+	static HAMON_CXX11_CONSTEXPR index_type
+	value_at(hamon::extents<I, E...> const& e, rank_type r) HAMON_NOEXCEPT
+	{
+		return static_cast<index_type>(e.extent(r));
+	}
+
+	template <typename Arr>
+	static HAMON_CXX11_CONSTEXPR index_type
+	value_at(Arr const& a, rank_type r) HAMON_NOEXCEPT
+	{
+		return static_cast<index_type>(a[r]);
+	}
+
+	// 静的な要素数の次元で、値が一致しているかどうか
+	template <typename Src>
+	static HAMON_CXX11_CONSTEXPR bool
+	matches_static_extents(Src const& src, rank_type r = 0) HAMON_NOEXCEPT
+	{
+		return r >= sizeof...(Extents) || (
+			(helper::static_extent(r) == hamon::dynamic_extent ||
+			 hamon::cmp_equal(value_at(src, r), helper::static_extent(r))) &&
+			matches_static_extents(src, r + 1));
+	}
+
+	// 動的な要素数だけが渡された
+	template <typename Src, hamon::size_t... Is>
+	HAMON_CXX11_CONSTEXPR
+	extents(from_dynamic_tag<true>, Src const& src, hamon::index_sequence<Is...>) HAMON_NOEXCEPT
+		: m_dynamic(value_at(src, Is)...)
+	{}
+
+	// 全ての次元の要素数が渡された
+	template <typename Src, hamon::size_t... Is>
+	HAMON_CXX11_CONSTEXPR
+	extents(from_dynamic_tag<false>, Src const& src, hamon::index_sequence<Is...>) HAMON_NOEXCEPT
+		: m_dynamic((
+			HAMON_ASSERT(matches_static_extents(src)),	// [mdspan.extents.cons]/7.1, 10.1
+			storage_type(value_at(src, helper::dynamic_index_inv(Is))...)))
+	{}
+
+	template <typename T>
+	using is_index_convertible = hamon::detail::is_index_convertible<T, index_type>;
+
+public:
+	// [mdspan.extents.obs], observers of the multidimensional index space
+	static HAMON_CXX11_CONSTEXPR rank_type
+	rank() HAMON_NOEXCEPT
+	{
+		return sizeof...(Extents);
+	}
+
+	static HAMON_CXX11_CONSTEXPR rank_type
+	rank_dynamic() HAMON_NOEXCEPT
+	{
+		return helper::dynamic_index(rank());
+	}
+
+	static HAMON_CXX11_CONSTEXPR hamon::size_t
+	static_extent(rank_type i) HAMON_NOEXCEPT
+	{
+		return helper::static_extent(i);
+	}
+
+	HAMON_CXX11_CONSTEXPR index_type
+	extent(rank_type i) const HAMON_NOEXCEPT
+	{
+		return helper::static_extent(i) == hamon::dynamic_extent ?
+			m_dynamic.get(helper::dynamic_index(i)) :
+			static_cast<index_type>(helper::static_extent(i));
+	}
+
+	// [mdspan.extents.cons], constructors
+	HAMON_CXX11_CONSTEXPR extents() HAMON_NOEXCEPT = default;
+
+#if defined(HAMON_HAS_CXX20_CONDITIONAL_EXPLICIT)
+	template <typename OtherIndexType, hamon::size_t... OtherExtents,
+		typename OtherExtentsType = hamon::extents<OtherIndexType, OtherExtents...>,
+		typename = hamon::enable_if_t<
+			hamon::detail::is_extents_convertible<OtherExtentsType, extents>::value>>
+	HAMON_CXX11_CONSTEXPR
+	explicit(hamon::detail::is_extents_conversion_explicit<OtherExtentsType, extents>::value)
+	extents(hamon::extents<OtherIndexType, OtherExtents...> const& other) HAMON_NOEXCEPT
+		: extents(from_dynamic_tag<false>{}, other, hamon::make_index_sequence<rank_dynamic()>{})
+	{}
+#else
+	template <typename OtherIndexType, hamon::size_t... OtherExtents,
+		typename OtherExtentsType = hamon::extents<OtherIndexType, OtherExtents...>,
+		typename = hamon::enable_if_t<
+			hamon::detail::is_extents_convertible<OtherExtentsType, extents>::value>,
+		hamon::enable_if_t<
+			hamon::detail::is_extents_conversion_explicit<OtherExtentsType, extents>::value>* = nullptr>
+	HAMON_CXX11_CONSTEXPR explicit
+	extents(hamon::extents<OtherIndexType, OtherExtents...> const& other) HAMON_NOEXCEPT
+		: extents(from_dynamic_tag<false>{}, other, hamon::make_index_sequence<rank_dynamic()>{})
+	{}
+
+	template <typename OtherIndexType, hamon::size_t... OtherExtents,
+		typename OtherExtentsType = hamon::extents<OtherIndexType, OtherExtents...>,
+		typename = hamon::enable_if_t<
+			hamon::detail::is_extents_convertible<OtherExtentsType, extents>::value>,
+		hamon::enable_if_t<
+			!hamon::detail::is_extents_conversion_explicit<OtherExtentsType, extents>::value>* = nullptr>
+	HAMON_CXX11_CONSTEXPR
+	extents(hamon::extents<OtherIndexType, OtherExtents...> const& other) HAMON_NOEXCEPT
+		: extents(from_dynamic_tag<false>{}, other, hamon::make_index_sequence<rank_dynamic()>{})
+	{}
+#endif
+
+	template <typename... OtherIndexTypes,
+		typename = hamon::enable_if_t<
+			hamon::conjunction<is_index_convertible<OtherIndexTypes>...>::value &&	// [mdspan.extents.cons]/6.1, 6.2
+			(sizeof...(OtherIndexTypes) == rank_dynamic() ||						// [mdspan.extents.cons]/6.3
+			 sizeof...(OtherIndexTypes) == rank())
+		>>
+	HAMON_CXX11_CONSTEXPR explicit
+	extents(OtherIndexTypes... exts) HAMON_NOEXCEPT
+		: extents(
+			from_dynamic_tag<sizeof...(OtherIndexTypes) == rank_dynamic()>{},
+			hamon::array<index_type, sizeof...(OtherIndexTypes)>{{static_cast<index_type>(exts)...}},
+			hamon::make_index_sequence<rank_dynamic()>{})
+	{}
+
+#if defined(HAMON_HAS_CXX20_CONDITIONAL_EXPLICIT)
+	template <typename OtherIndexType, hamon::size_t N,
+		typename = hamon::enable_if_t<
+			is_index_convertible<OtherIndexType const&>::value &&	// [mdspan.extents.cons]/9.1, 9.2
+			(N == rank_dynamic() || N == rank())					// [mdspan.extents.cons]/9.3
+		>>
+	HAMON_CXX11_CONSTEXPR explicit(N != rank_dynamic())
+	extents(hamon::span<OtherIndexType, N> exts) HAMON_NOEXCEPT
+		: extents(from_dynamic_tag<N == rank_dynamic()>{}, exts,
+			hamon::make_index_sequence<rank_dynamic()>{})
+	{}
+
+	template <typename OtherIndexType, hamon::size_t N,
+		typename = hamon::enable_if_t<
+			is_index_convertible<OtherIndexType const&>::value &&	// [mdspan.extents.cons]/9.1, 9.2
+			(N == rank_dynamic() || N == rank())					// [mdspan.extents.cons]/9.3
+		>>
+	HAMON_CXX11_CONSTEXPR explicit(N != rank_dynamic())
+	extents(hamon::array<OtherIndexType, N> const& exts) HAMON_NOEXCEPT
+		: extents(from_dynamic_tag<N == rank_dynamic()>{}, exts,
+			hamon::make_index_sequence<rank_dynamic()>{})
+	{}
+#else
+	template <typename OtherIndexType, hamon::size_t N,
+		typename = hamon::enable_if_t<
+			is_index_convertible<OtherIndexType const&>::value &&	// [mdspan.extents.cons]/9.1, 9.2
+			(N == rank_dynamic() || N == rank())					// [mdspan.extents.cons]/9.3
+		>,
+		hamon::enable_if_t<N != rank_dynamic()>* = nullptr>
+	HAMON_CXX11_CONSTEXPR explicit
+	extents(hamon::span<OtherIndexType, N> exts) HAMON_NOEXCEPT
+		: extents(from_dynamic_tag<false>{}, exts,
+			hamon::make_index_sequence<rank_dynamic()>{})
+	{}
+
+	template <typename OtherIndexType, hamon::size_t N,
+		typename = hamon::enable_if_t<
+			is_index_convertible<OtherIndexType const&>::value	// [mdspan.extents.cons]/9.1, 9.2
+		>,
+		hamon::enable_if_t<N == rank_dynamic()>* = nullptr>
+	HAMON_CXX11_CONSTEXPR
+	extents(hamon::span<OtherIndexType, N> exts) HAMON_NOEXCEPT
+		: extents(from_dynamic_tag<true>{}, exts,
+			hamon::make_index_sequence<rank_dynamic()>{})
+	{}
+
+	template <typename OtherIndexType, hamon::size_t N,
+		typename = hamon::enable_if_t<
+			is_index_convertible<OtherIndexType const&>::value &&	// [mdspan.extents.cons]/9.1, 9.2
+			(N == rank_dynamic() || N == rank())					// [mdspan.extents.cons]/9.3
+		>,
+		hamon::enable_if_t<N != rank_dynamic()>* = nullptr>
+	HAMON_CXX11_CONSTEXPR explicit
+	extents(hamon::array<OtherIndexType, N> const& exts) HAMON_NOEXCEPT
+		: extents(from_dynamic_tag<false>{}, exts,
+			hamon::make_index_sequence<rank_dynamic()>{})
+	{}
+
+	template <typename OtherIndexType, hamon::size_t N,
+		typename = hamon::enable_if_t<
+			is_index_convertible<OtherIndexType const&>::value	// [mdspan.extents.cons]/9.1, 9.2
+		>,
+		hamon::enable_if_t<N == rank_dynamic()>* = nullptr>
+	HAMON_CXX11_CONSTEXPR
+	extents(hamon::array<OtherIndexType, N> const& exts) HAMON_NOEXCEPT
+		: extents(from_dynamic_tag<true>{}, exts,
+			hamon::make_index_sequence<rank_dynamic()>{})
+	{}
+#endif
+
+private:
+	template <typename OtherExtents>
+	static HAMON_CXX11_CONSTEXPR bool
+	equal_impl(extents const& lhs, OtherExtents const& rhs, rank_type r) HAMON_NOEXCEPT
+	{
+		return r >= rank() || (
+			hamon::cmp_equal(lhs.extent(r), rhs.extent(r)) &&
+			equal_impl(lhs, rhs, r + 1));
+	}
+
+public:
+	// [mdspan.extents.cmp], comparison operators
+	template <typename OtherIndexType, hamon::size_t... OtherExtents>
+	friend HAMON_CXX11_CONSTEXPR bool
+	operator==(extents const& lhs, hamon::extents<OtherIndexType, OtherExtents...> const& rhs) HAMON_NOEXCEPT
+	{
+		// [mdspan.extents.cmp]/1
+		return lhs.rank() == rhs.rank() && equal_impl(lhs, rhs, 0);
+	}
+
+#if !defined(HAMON_HAS_CXX20_THREE_WAY_COMPARISON)
+	template <typename OtherIndexType, hamon::size_t... OtherExtents>
+	friend HAMON_CXX11_CONSTEXPR bool
+	operator!=(extents const& lhs, hamon::extents<OtherIndexType, OtherExtents...> const& rhs) HAMON_NOEXCEPT
+	{
+		return !(lhs == rhs);
+	}
+#endif
+
+private:
+	HAMON_NO_UNIQUE_ADDRESS storage_type	m_dynamic;
+};
+
+#if defined(HAMON_HAS_CXX17_DEDUCTION_GUIDES)
+
+// [mdspan.extents.cons]/13
+template <typename... Integrals,
+	typename = hamon::enable_if_t<hamon::conjunction<
+		hamon::is_convertible<Integrals, hamon::size_t>...>::value>>
+explicit extents(Integrals...)
+-> extents<hamon::size_t, hamon::detail::maybe_static_ext<Integrals>::value...>;
+
+#endif
+
+}	// namespace hamon
+
+#endif
+
+#endif // HAMON_MDSPAN_EXTENTS_HPP
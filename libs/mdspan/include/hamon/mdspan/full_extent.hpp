@@ -0,0 +1,42 @@
+﻿/**
+ *	@file	full_extent.hpp
+ *
+ *	@brief	full_extent_t, full_extent の定義
+ */
+
+#ifndef HAMON_MDSPAN_FULL_EXTENT_HPP
+#define HAMON_MDSPAN_FULL_EXTENT_HPP
+
+#include <hamon/mdspan/config.hpp>
+
+#if defined(HAMON_USE_STD_MDSPAN)
+
+namespace hamon
+{
+
+using std::full_extent_t;
+using std::full_extent;
+
+}	// namespace hamon
+
+#else
+
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+// [mdspan.sub.overview]
+// submdspan で次元全体を選択するためのスライス指定子
+struct full_extent_t
+{
+	explicit full_extent_t() = default;
+};
+
+HAMON_INLINE_VAR HAMON_CONSTEXPR full_extent_t full_extent {};
+
+}	// namespace hamon
+
+#endif
+
+#endif // HAMON_MDSPAN_FULL_EXTENT_HPP
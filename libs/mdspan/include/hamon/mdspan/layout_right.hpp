@@ -0,0 +1,303 @@
+﻿/**
+ *	@file	layout_right.hpp
+ *
+ *	@brief	layout_right の定義
+ */
+
+#ifndef HAMON_MDSPAN_LAYOUT_RIGHT_HPP
+#define HAMON_MDSPAN_LAYOUT_RIGHT_HPP
+
+#include <hamon/mdspan/config.hpp>
+
+#if defined(HAMON_USE_STD_MDSPAN)
+
+namespace hamon
+{
+
+using std::layout_right;
+
+}	// namespace hamon
+
+#else
+
+#include <hamon/mdspan/mdspan_fwd.hpp>
+#include <hamon/mdspan/extents.hpp>
+#include <hamon/mdspan/detail/fwd_prod_of_extents.hpp>
+#include <hamon/mdspan/detail/rev_prod_of_extents.hpp>
+#include <hamon/mdspan/detail/is_extents.hpp>
+#include <hamon/mdspan/detail/is_index_convertible.hpp>
+#include <hamon/mdspan/detail/is_layout_right_padded_mapping_of.hpp>
+#include <hamon/mdspan/detail/is_multidimensional_index_in.hpp>
+#include <hamon/type_traits/conjunction.hpp>
+#include <hamon/type_traits/enable_if.hpp>
+#include <hamon/type_traits/is_constructible.hpp>
+#include <hamon/type_traits/is_convertible.hpp>
+#include <hamon/assert.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+// [mdspan.layout.right.overview]
+template <typename Extents>
+class layout_right::mapping
+{
+	// [mdspan.layout.right.overview]/2
+	static_assert(hamon::detail::is_extents<Extents>::value, "");
+
+public:
+	using extents_type = Extents;
+	using index_type = typename extents_type::index_type;
+	using size_type = typename extents_type::size_type;
+	using rank_type = typename extents_type::rank_type;
+	using layout_type = layout_right;
+
+private:
+	// ((i[0] * e[1] + i[1]) * e[2] + i[2]) * ...
+	HAMON_CXX11_CONSTEXPR index_type
+	offset_impl(rank_type, index_type acc) const HAMON_NOEXCEPT
+	{
+		return acc;
+	}
+
+	template <typename... Rest>
+	HAMON_CXX11_CONSTEXPR index_type
+	offset_impl(rank_type r, index_type acc, index_type i, Rest... rest) const HAMON_NOEXCEPT
+	{
+		return offset_impl(r + 1, static_cast<index_type>(acc * m_extents.extent(r) + i), rest...);
+	}
+
+	template <typename StridedMapping>
+	static HAMON_CXX11_CONSTEXPR bool
+	has_layout_right_strides(StridedMapping const& other, rank_type r = 0) HAMON_NOEXCEPT
+	{
+		return r >= extents_type::rank() || (
+			other.stride(r) == hamon::detail::rev_prod_of_extents(other.extents(), r) &&
+			has_layout_right_strides(other, r + 1));
+	}
+
+public:
+	// [mdspan.layout.right.cons], constructors
+	HAMON_CXX11_CONSTEXPR mapping() HAMON_NOEXCEPT = default;
+
+	HAMON_CXX11_CONSTEXPR mapping(mapping const&) HAMON_NOEXCEPT = default;
+
+	HAMON_CXX11_CONSTEXPR
+	mapping(extents_type const& e) HAMON_NOEXCEPT
+		: m_extents(e)	// [mdspan.layout.right.cons]/2
+	{}
+
+#if defined(HAMON_HAS_CXX20_CONDITIONAL_EXPLICIT)
+	template <typename OtherExtents,
+		typename = hamon::enable_if_t<
+			hamon::is_constructible<extents_type, OtherExtents>::value>>	// [mdspan.layout.right.cons]/3
+	HAMON_CXX11_CONSTEXPR
+	explicit(!hamon::is_convertible<OtherExtents, extents_type>::value)
+	mapping(mapping<OtherExtents> const& other) HAMON_NOEXCEPT
+		: m_extents(other.extents())	// [mdspan.layout.right.cons]/5
+	{}
+#else
+	template <typename OtherExtents,
+		typename = hamon::enable_if_t<
+			hamon::is_constructible<extents_type, OtherExtents>::value>,	// [mdspan.layout.right.cons]/3
+		hamon::enable_if_t<!hamon::is_convertible<OtherExtents, extents_type>::value>* = nullptr>
+	HAMON_CXX11_CONSTEXPR explicit
+	mapping(mapping<OtherExtents> const& other) HAMON_NOEXCEPT
+		: m_extents(other.extents())	// [mdspan.layout.right.cons]/5
+	{}
+
+	template <typename OtherExtents,
+		typename = hamon::enable_if_t<
+			hamon::is_constructible<extents_type, OtherExtents>::value>,	// [mdspan.layout.right.cons]/3
+		hamon::enable_if_t<hamon::is_convertible<OtherExtents, extents_type>::value>* = nullptr>
+	HAMON_CXX11_CONSTEXPR
+	mapping(mapping<OtherExtents> const& other) HAMON_NOEXCEPT
+		: m_extents(other.extents())	// [mdspan.layout.right.cons]/5
+	{}
+#endif
+
+#if defined(HAMON_HAS_CXX20_CONDITIONAL_EXPLICIT)
+	template <typename OtherExtents,
+		typename = hamon::enable_if_t<
+			extents_type::rank() <= 1 &&											// [mdspan.layout.right.cons]/6.1
+			hamon::is_constructible<extents_type, OtherExtents>::value>>			// [mdspan.layout.right.cons]/6.2
+	HAMON_CXX11_CONSTEXPR
+	explicit(!hamon::is_convertible<OtherExtents, extents_type>::value)
+	mapping(layout_left::mapping<OtherExtents> const& other) HAMON_NOEXCEPT
+		: m_extents(other.extents())	// [mdspan.layout.right.cons]/8
+	{}
+#else
+	template <typename OtherExtents,
+		typename = hamon::enable_if_t<
+			extents_type::rank() <= 1 &&											// [mdspan.layout.right.cons]/6.1
+			hamon::is_constructible<extents_type, OtherExtents>::value>,			// [mdspan.layout.right.cons]/6.2
+		hamon::enable_if_t<!hamon::is_convertible<OtherExtents, extents_type>::value>* = nullptr>
+	HAMON_CXX11_CONSTEXPR explicit
+	mapping(layout_left::mapping<OtherExtents> const& other) HAMON_NOEXCEPT
+		: m_extents(other.extents())	// [mdspan.layout.right.cons]/8
+	{}
+
+	template <typename OtherExtents,
+		typename = hamon::enable_if_t<
+			extents_type::rank() <= 1 &&											// [mdspan.layout.right.cons]/6.1
+			hamon::is_constructible<extents_type, OtherExtents>::value>,			// [mdspan.layout.right.cons]/6.2
+		hamon::enable_if_t<hamon::is_convertible<OtherExtents, extents_type>::value>* = nullptr>
+	HAMON_CXX11_CONSTEXPR
+	mapping(layout_left::mapping<OtherExtents> const& other) HAMON_NOEXCEPT
+		: m_extents(other.extents())	// [mdspan.layout.right.cons]/8
+	{}
+#endif
+
+#if defined(HAMON_HAS_CXX20_CONDITIONAL_EXPLICIT)
+	template <typename LayoutRightPaddedMapping,
+		typename OtherExtents = typename LayoutRightPaddedMapping::extents_type,
+		typename = hamon::enable_if_t<
+			hamon::detail::is_layout_right_padded_mapping_of<LayoutRightPaddedMapping>::value &&	// [mdspan.layout.right.cons]/9.1
+			hamon::is_constructible<extents_type, OtherExtents>::value>>						// [mdspan.layout.right.cons]/9.2
+	HAMON_CXX11_CONSTEXPR
+	explicit(!hamon::is_convertible<OtherExtents, extents_type>::value)
+	mapping(LayoutRightPaddedMapping const& other) HAMON_NOEXCEPT
+		: m_extents((
+			HAMON_ASSERT(other.is_exhaustive()),	// [mdspan.layout.right.cons]/11
+			other.extents()))						// [mdspan.layout.right.cons]/12
+	{}
+#else
+	template <typename LayoutRightPaddedMapping,
+		typename OtherExtents = typename LayoutRightPaddedMapping::extents_type,
+		typename = hamon::enable_if_t<
+			hamon::detail::is_layout_right_padded_mapping_of<LayoutRightPaddedMapping>::value &&	// [mdspan.layout.right.cons]/9.1
+			hamon::is_constructible<extents_type, OtherExtents>::value>,						// [mdspan.layout.right.cons]/9.2
+		hamon::enable_if_t<!hamon::is_convertible<OtherExtents, extents_type>::value>* = nullptr>
+	HAMON_CXX11_CONSTEXPR explicit
+	mapping(LayoutRightPaddedMapping const& other) HAMON_NOEXCEPT
+		: m_extents((
+			HAMON_ASSERT(other.is_exhaustive()),	// [mdspan.layout.right.cons]/11
+			other.extents()))						// [mdspan.layout.right.cons]/12
+	{}
+
+	template <typename LayoutRightPaddedMapping,
+		typename OtherExtents = typename LayoutRightPaddedMapping::extents_type,
+		typename = hamon::enable_if_t<
+			hamon::detail::is_layout_right_padded_mapping_of<LayoutRightPaddedMapping>::value &&	// [mdspan.layout.right.cons]/9.1
+			hamon::is_constructible<extents_type, OtherExtents>::value>,						// [mdspan.layout.right.cons]/9.2
+		hamon::enable_if_t<hamon::is_convertible<OtherExtents, extents_type>::value>* = nullptr>
+	HAMON_CXX11_CONSTEXPR
+	mapping(LayoutRightPaddedMapping const& other) HAMON_NOEXCEPT
+		: m_extents((
+			HAMON_ASSERT(other.is_exhaustive()),	// [mdspan.layout.right.cons]/11
+			other.extents()))						// [mdspan.layout.right.cons]/12
+	{}
+#endif
+
+#if defined(HAMON_HAS_CXX20_CONDITIONAL_EXPLICIT)
+	template <typename OtherExtents,
+		typename = hamon::enable_if_t<
+			hamon::is_constructible<extents_type, OtherExtents>::value>>	// [mdspan.layout.right.cons]/13
+	HAMON_CXX11_CONSTEXPR
+	explicit(extents_type::rank() > 0)
+	mapping(layout_stride::mapping<OtherExtents> const& other) HAMON_NOEXCEPT
+		: m_extents((
+			HAMON_ASSERT(has_layout_right_strides(other)),	// [mdspan.layout.right.cons]/14.1
+			other.extents()))								// [mdspan.layout.right.cons]/15
+	{}
+#else
+	template <typename OtherExtents,
+		typename = hamon::enable_if_t<
+			hamon::is_constructible<extents_type, OtherExtents>::value>,	// [mdspan.layout.right.cons]/13
+		hamon::enable_if_t<(OtherExtents::rank() > 0)>* = nullptr>
+	HAMON_CXX11_CONSTEXPR explicit
+	mapping(layout_stride::mapping<OtherExtents> const& other) HAMON_NOEXCEPT
+		: m_extents((
+			HAMON_ASSERT(has_layout_right_strides(other)),	// [mdspan.layout.right.cons]/14.1
+			other.extents()))								// [mdspan.layout.right.cons]/15
+	{}
+
+	template <typename OtherExtents,
+		typename = hamon::enable_if_t<
+			hamon::is_constructible<extents_type, OtherExtents>::value>,	// [mdspan.layout.right.cons]/13
+		hamon::enable_if_t<(OtherExtents::rank() == 0)>* = nullptr>
+	HAMON_CXX11_CONSTEXPR
+	mapping(layout_stride::mapping<OtherExtents> const& other) HAMON_NOEXCEPT
+		: m_extents((
+			HAMON_ASSERT(has_layout_right_strides(other)),	// [mdspan.layout.right.cons]/14.1
+			other.extents()))								// [mdspan.layout.right.cons]/15
+	{}
+#endif
+
+	HAMON_CXX14_CONSTEXPR mapping& operator=(mapping const&) HAMON_NOEXCEPT = default;
+
+	// [mdspan.layout.right.obs], observers
+	HAMON_CXX11_CONSTEXPR extents_type const&
+	extents() const HAMON_NOEXCEPT
+	{
+		return m_extents;
+	}
+
+	HAMON_CXX11_CONSTEXPR index_type
+	required_span_size() const HAMON_NOEXCEPT
+	{
+		// [mdspan.layout.right.obs]/1
+		return hamon::detail::fwd_prod_of_extents(m_extents, extents_type::rank());
+	}
+
+	template <typename... Indices,
+		typename = hamon::enable_if_t<
+			sizeof...(Indices) == extents_type::rank() &&		// [mdspan.layout.right.obs]/2.1
+			hamon::conjunction<
+				hamon::detail::is_index_convertible<Indices, index_type>...	// [mdspan.layout.right.obs]/2.2, 2.3
+			>::value>>
+	HAMON_CXX11_CONSTEXPR index_type
+	operator()(Indices... i) const HAMON_NOEXCEPT
+	{
+		return
+			HAMON_ASSERT(hamon::detail::is_multidimensional_index_in(m_extents, i...)),	// [mdspan.layout.right.obs]/3
+			offset_impl(0, 0, static_cast<index_type>(i)...);							// [mdspan.layout.right.obs]/4
+	}
+
+	static HAMON_CXX11_CONSTEXPR bool is_always_unique() HAMON_NOEXCEPT { return true; }
+	static HAMON_CXX11_CONSTEXPR bool is_always_exhaustive() HAMON_NOEXCEPT { return true; }
+	static HAMON_CXX11_CONSTEXPR bool is_always_strided() HAMON_NOEXCEPT { return true; }
+
+	static HAMON_CXX11_CONSTEXPR bool is_unique() HAMON_NOEXCEPT { return true; }
+	static HAMON_CXX11_CONSTEXPR bool is_exhaustive() HAMON_NOEXCEPT { return true; }
+	static HAMON_CXX11_CONSTEXPR bool is_strided() HAMON_NOEXCEPT { return true; }
+
+	template <typename E = extents_type,
+		typename = hamon::enable_if_t<(E::rank() > 0)>>	// [mdspan.layout.right.obs]/5
+	HAMON_CXX11_CONSTEXPR index_type
+	stride(rank_type i) const HAMON_NOEXCEPT
+	{
+		return
+			HAMON_ASSERT(i < extents_type::rank()),					// [mdspan.layout.right.obs]/6
+			hamon::detail::rev_prod_of_extents(m_extents, i);		// [mdspan.layout.right.obs]/7
+	}
+
+	template <typename OtherExtents,
+		typename = hamon::enable_if_t<
+			OtherExtents::rank() == extents_type::rank()>>	// [mdspan.layout.right.obs]/8
+	friend HAMON_CXX11_CONSTEXPR bool
+	operator==(mapping const& x, mapping<OtherExtents> const& y) HAMON_NOEXCEPT
+	{
+		return x.extents() == y.extents();	// [mdspan.layout.right.obs]/9
+	}
+
+#if !defined(HAMON_HAS_CXX20_THREE_WAY_COMPARISON)
+	template <typename OtherExtents,
+		typename = hamon::enable_if_t<
+			OtherExtents::rank() == extents_type::rank()>>
+	friend HAMON_CXX11_CONSTEXPR bool
+	operator!=(mapping const& x, mapping<OtherExtents> const& y) HAMON_NOEXCEPT
+	{
+		return !(x == y);
+	}
+#endif
+
+private:
+	HAMON_NO_UNIQUE_ADDRESS extents_type	m_extents{};
+};
+
+}	// namespace hamon
+
+#endif
+
+#endif // HAMON_MDSPAN_LAYOUT_RIGHT_HPP
@@ -0,0 +1,508 @@
+﻿/**
+ *	@file	layout_right_padded.hpp
+ *
+ *	@brief	layout_right_padded の定義
+ */
+
+#ifndef HAMON_MDSPAN_LAYOUT_RIGHT_PADDED_HPP
+#define HAMON_MDSPAN_LAYOUT_RIGHT_PADDED_HPP
+
+#include <hamon/mdspan/config.hpp>
+
+#if defined(HAMON_USE_STD_MDSPAN)
+
+namespace hamon
+{
+
+using std::layout_right_padded;
+
+}	// namespace hamon
+
+#else
+
+#include <hamon/mdspan/mdspan_fwd.hpp>
+#include <hamon/mdspan/extents.hpp>
+#include <hamon/mdspan/layout_right.hpp>
+#include <hamon/mdspan/layout_stride.hpp>
+#include <hamon/mdspan/detail/is_extents.hpp>
+#include <hamon/mdspan/detail/is_index_convertible.hpp>
+#include <hamon/mdspan/detail/is_layout_left_padded_mapping_of.hpp>
+#include <hamon/mdspan/detail/is_layout_padded_conversion_explicit.hpp>
+#include <hamon/mdspan/detail/is_layout_right_padded_mapping_of.hpp>
+#include <hamon/mdspan/detail/is_mapping_of.hpp>
+#include <hamon/mdspan/detail/is_multidimensional_index_in.hpp>
+#include <hamon/mdspan/detail/least_multiple_at_least.hpp>
+#include <hamon/span/dynamic_extent.hpp>
+#include <hamon/array/array.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/type_traits/conjunction.hpp>
+#include <hamon/type_traits/enable_if.hpp>
+#include <hamon/type_traits/is_constructible.hpp>
+#include <hamon/type_traits/is_convertible.hpp>
+#include <hamon/utility/index_sequence.hpp>
+#include <hamon/utility/make_index_sequence.hpp>
+#include <hamon/assert.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+namespace detail
+{
+
+// [mdspan.layout.rightpad.expo]/1 static-padding-stride
+template <hamon::size_t PaddingValue, typename Extents,
+	bool = (Extents::rank() <= 1)>
+struct layout_right_padded_static_stride
+{
+	static HAMON_CXX11_CONSTEXPR hamon::size_t last_static_extent = Extents::static_extent(Extents::rank() - 1);
+
+	static HAMON_CXX11_CONSTEXPR hamon::size_t value =
+		(PaddingValue == hamon::dynamic_extent || last_static_extent == hamon::dynamic_extent) ?
+			hamon::dynamic_extent :
+			hamon::detail::least_multiple_at_least(PaddingValue, last_static_extent);
+};
+
+template <hamon::size_t PaddingValue, typename Extents>
+struct layout_right_padded_static_stride<PaddingValue, Extents, true>
+{
+	static HAMON_CXX11_CONSTEXPR hamon::size_t value = 0;
+};
+
+}	// namespace detail
+
+// [mdspan.layout.rightpad.overview]
+template <hamon::size_t PaddingValue>
+template <typename Extents>
+class layout_right_padded<PaddingValue>::mapping
+{
+	// [mdspan.layout.rightpad.overview]/2
+	static_assert(hamon::detail::is_extents<Extents>::value, "");
+
+public:
+	static HAMON_CXX11_CONSTEXPR hamon::size_t padding_value = PaddingValue;
+
+	using extents_type = Extents;
+	using index_type = typename extents_type::index_type;
+	using size_type = typename extents_type::size_type;
+	using rank_type = typename extents_type::rank_type;
+	using layout_type = layout_right_padded<PaddingValue>;
+
+private:
+	static HAMON_CXX11_CONSTEXPR hamon::size_t s_rank = extents_type::rank();
+
+	static HAMON_CXX11_CONSTEXPR hamon::size_t s_static_padding_stride =
+		hamon::detail::layout_right_padded_static_stride<PaddingValue, extents_type>::value;
+
+	// stride(rank() - 2) を保持する。
+	// 静的に決まる場合 (rank() <= 1 の場合を含む) はサイズ0になる。
+	using stride_storage_type = hamon::extents<index_type, s_static_padding_stride>;
+
+	static HAMON_CXX11_CONSTEXPR stride_storage_type
+	make_stride(index_type pad, extents_type const& ext) HAMON_NOEXCEPT
+	{
+		return s_rank <= 1 ?
+			stride_storage_type() :
+			stride_storage_type(hamon::detail::least_multiple_at_least(pad, ext.extent(s_rank - 1)));
+	}
+
+	// [mdspan.layout.rightpad.cons]/3
+	static HAMON_CXX11_CONSTEXPR stride_storage_type
+	make_stride(extents_type const& ext) HAMON_NOEXCEPT
+	{
+		return
+			s_rank <= 1 ?
+				stride_storage_type() :
+			padding_value == hamon::dynamic_extent ?
+				stride_storage_type(ext.extent(s_rank - 1)) :
+			make_stride(static_cast<index_type>(padding_value), ext);
+	}
+
+	template <typename OtherMapping>
+	static HAMON_CXX11_CONSTEXPR stride_storage_type
+	stride_of(OtherMapping const& other) HAMON_NOEXCEPT
+	{
+		return s_rank <= 1 ?
+			stride_storage_type() :
+			stride_storage_type(static_cast<index_type>(other.stride(s_rank - 2)));
+	}
+
+	HAMON_CXX11_CONSTEXPR index_type
+	padding_stride() const HAMON_NOEXCEPT
+	{
+		return m_stride.extent(0);
+	}
+
+	// extent(first) * ... * extent(last - 1)
+	HAMON_CXX11_CONSTEXPR index_type
+	prod_of_extents(rank_type first, rank_type last) const HAMON_NOEXCEPT
+	{
+		return first >= last ?
+			index_type(1) :
+			static_cast<index_type>(m_extents.extent(first) * prod_of_extents(first + 1, last));
+	}
+
+	HAMON_CXX11_CONSTEXPR index_type
+	offset_impl(rank_type, index_type acc) const HAMON_NOEXCEPT
+	{
+		return acc;
+	}
+
+	// ((i[0] * e[1] + i[1]) * e[2] + ...) * stride(rank() - 2) + i[rank() - 1]
+	template <typename... Rest>
+	HAMON_CXX11_CONSTEXPR index_type
+	offset_impl(rank_type r, index_type acc, index_type i, Rest... rest) const HAMON_NOEXCEPT
+	{
+		return offset_impl(r + 1,
+			static_cast<index_type>(
+				acc * (r == s_rank - 1 ? padding_stride() : m_extents.extent(r)) + i),
+			rest...);
+	}
+
+	HAMON_CXX11_CONSTEXPR bool
+	has_empty_extent(rank_type r = 0) const HAMON_NOEXCEPT
+	{
+		return r < s_rank && (m_extents.extent(r) == 0 || has_empty_extent(r + 1));
+	}
+
+	// 1 + (e[0] - 1) * stride(0) + (e[1] - 1) * stride(1) + ...
+	HAMON_CXX11_CONSTEXPR index_type
+	required_span_size_impl(rank_type r) const HAMON_NOEXCEPT
+	{
+		return r >= s_rank ?
+			index_type(1) :
+			static_cast<index_type>(
+				(m_extents.extent(r) - 1) * stride(r) + required_span_size_impl(r + 1));
+	}
+
+	template <hamon::size_t... Is>
+	HAMON_CXX11_CONSTEXPR hamon::array<index_type, s_rank>
+	strides_impl(hamon::index_sequence<Is...>) const HAMON_NOEXCEPT
+	{
+		return {{stride(Is)...}};
+	}
+
+public:
+	// [mdspan.layout.rightpad.cons], constructors
+	HAMON_CXX11_CONSTEXPR
+	mapping() HAMON_NOEXCEPT
+		: mapping(extents_type{})
+	{}
+
+	HAMON_CXX11_CONSTEXPR mapping(mapping const&) HAMON_NOEXCEPT = default;
+
+	HAMON_CXX11_CONSTEXPR
+	mapping(extents_type const& ext)
+		: m_stride(make_stride(ext))	// [mdspan.layout.rightpad.cons]/3
+		, m_extents(ext)
+	{}
+
+	template <typename OtherIndexType,
+		typename = hamon::enable_if_t<
+			hamon::detail::is_index_convertible<OtherIndexType, index_type>::value>>	// [mdspan.layout.rightpad.cons]/4
+	HAMON_CXX11_CONSTEXPR
+	mapping(extents_type const& ext, OtherIndexType pad)
+		: m_stride((
+			HAMON_ASSERT(padding_value == hamon::dynamic_extent ||
+				hamon::cmp_equal(padding_value, static_cast<index_type>(pad))),	// [mdspan.layout.rightpad.cons]/5.3
+			make_stride(static_cast<index_type>(pad), ext)))						// [mdspan.layout.rightpad.cons]/6
+		, m_extents(ext)
+	{}
+
+#if defined(HAMON_HAS_CXX20_CONDITIONAL_EXPLICIT)
+	template <typename OtherExtents,
+		typename = hamon::enable_if_t<
+			hamon::is_constructible<extents_type, OtherExtents>::value>>	// [mdspan.layout.rightpad.cons]/7
+	HAMON_CXX11_CONSTEXPR
+	explicit(!hamon::is_convertible<OtherExtents, extents_type>::value)
+	mapping(layout_right::mapping<OtherExtents> const& other)
+		: m_stride(stride_of(other))	// [mdspan.layout.rightpad.cons]/10
+		, m_extents(other.extents())
+	{
+		// [mdspan.layout.rightpad.cons]/8
+		static_assert(OtherExtents::rank() <= 1 ||
+			s_static_padding_stride == hamon::dynamic_extent ||
+			OtherExtents::static_extent(OtherExtents::rank() - 1) == hamon::dynamic_extent ||
+			s_static_padding_stride == OtherExtents::static_extent(OtherExtents::rank() - 1), "");
+	}
+#else
+	template <typename OtherExtents,
+		typename = hamon::enable_if_t<
+			hamon::is_constructible<extents_type, OtherExtents>::value>,	// [mdspan.layout.rightpad.cons]/7
+		hamon::enable_if_t<!hamon::is_convertible<OtherExtents, extents_type>::value>* = nullptr>
+	HAMON_CXX11_CONSTEXPR explicit
+	mapping(layout_right::mapping<OtherExtents> const& other)
+		: m_stride(stride_of(other))	// [mdspan.layout.rightpad.cons]/10
+		, m_extents(other.extents())
+	{
+		// [mdspan.layout.rightpad.cons]/8
+		static_assert(OtherExtents::rank() <= 1 ||
+			s_static_padding_stride == hamon::dynamic_extent ||
+			OtherExtents::static_extent(OtherExtents::rank() - 1) == hamon::dynamic_extent ||
+			s_static_padding_stride == OtherExtents::static_extent(OtherExtents::rank() - 1), "");
+	}
+
+	template <typename OtherExtents,
+		typename = hamon::enable_if_t<
+			hamon::is_constructible<extents_type, OtherExtents>::value>,	// [mdspan.layout.rightpad.cons]/7
+		hamon::enable_if_t<hamon::is_convertible<OtherExtents, extents_type>::value>* = nullptr>
+	HAMON_CXX11_CONSTEXPR
+	mapping(layout_right::mapping<OtherExtents> const& other)
+		: m_stride(stride_of(other))	// [mdspan.layout.rightpad.cons]/10
+		, m_extents(other.extents())
+	{
+		// [mdspan.layout.rightpad.cons]/8
+		static_assert(OtherExtents::rank() <= 1 ||
+			s_static_padding_stride == hamon::dynamic_extent ||
+			OtherExtents::static_extent(OtherExtents::rank() - 1) == hamon::dynamic_extent ||
+			s_static_padding_stride == OtherExtents::static_extent(OtherExtents::rank() - 1), "");
+	}
+#endif
+
+#if defined(HAMON_HAS_CXX20_CONDITIONAL_EXPLICIT)
+	template <typename OtherExtents,
+		typename = hamon::enable_if_t<
+			hamon::is_constructible<extents_type, OtherExtents>::value>>	// [mdspan.layout.rightpad.cons]/11
+	HAMON_CXX11_CONSTEXPR
+	explicit(OtherExtents::rank() > 0)
+	mapping(layout_stride::mapping<OtherExtents> const& other)
+		: m_stride(stride_of(other))	// [mdspan.layout.rightpad.cons]/13
+		, m_extents(other.extents())
+	{}
+#else
+	template <typename OtherExtents,
+		typename = hamon::enable_if_t<
+			hamon::is_constructible<extents_type, OtherExtents>::value>,	// [mdspan.layout.rightpad.cons]/11
+		hamon::enable_if_t<(OtherExtents::rank() > 0)>* = nullptr>
+	HAMON_CXX11_CONSTEXPR explicit
+	mapping(layout_stride::mapping<OtherExtents> const& other)
+		: m_stride(stride_of(other))	// [mdspan.layout.rightpad.cons]/13
+		, m_extents(other.extents())
+	{}
+
+	template <typename OtherExtents,
+		typename = hamon::enable_if_t<
+			hamon::is_constructible<extents_type, OtherExtents>::value>,	// [mdspan.layout.rightpad.cons]/11
+		hamon::enable_if_t<(OtherExtents::rank() == 0)>* = nullptr>
+	HAMON_CXX11_CONSTEXPR
+	mapping(layout_stride::mapping<OtherExtents> const& other)
+		: m_stride(stride_of(other))	// [mdspan.layout.rightpad.cons]/13
+		, m_extents(other.extents())
+	{}
+#endif
+
+#if defined(HAMON_HAS_CXX20_CONDITIONAL_EXPLICIT)
+	template <typename LayoutRightPaddedMapping,
+		typename = hamon::enable_if_t<
+			hamon::detail::is_layout_right_padded_mapping_of<LayoutRightPaddedMapping>::value &&	// [mdspan.layout.rightpad.cons]/14.1
+			hamon::is_constructible<extents_type,
+				typename LayoutRightPaddedMapping::extents_type>::value>>						// [mdspan.layout.rightpad.cons]/14.2
+	HAMON_CXX11_CONSTEXPR
+	explicit(hamon::detail::is_layout_padded_conversion_explicit<LayoutRightPaddedMapping, mapping>::value)
+	mapping(LayoutRightPaddedMapping const& other)
+		: m_stride(stride_of(other))	// [mdspan.layout.rightpad.cons]/17
+		, m_extents(other.extents())
+	{
+		// [mdspan.layout.rightpad.cons]/15
+		static_assert(s_rank <= 1 ||
+			padding_value == hamon::dynamic_extent ||
+			LayoutRightPaddedMapping::padding_value == hamon::dynamic_extent ||
+			padding_value == LayoutRightPaddedMapping::padding_value, "");
+	}
+#else
+	template <typename LayoutRightPaddedMapping,
+		typename = hamon::enable_if_t<
+			hamon::detail::is_layout_right_padded_mapping_of<LayoutRightPaddedMapping>::value &&	// [mdspan.layout.rightpad.cons]/14.1
+			hamon::is_constructible<extents_type,
+				typename LayoutRightPaddedMapping::extents_type>::value>,						// [mdspan.layout.rightpad.cons]/14.2
+		hamon::enable_if_t<hamon::detail::is_layout_padded_conversion_explicit<LayoutRightPaddedMapping, mapping>::value>* = nullptr>
+	HAMON_CXX11_CONSTEXPR explicit
+	mapping(LayoutRightPaddedMapping const& other)
+		: m_stride(stride_of(other))	// [mdspan.layout.rightpad.cons]/17
+		, m_extents(other.extents())
+	{
+		// [mdspan.layout.rightpad.cons]/15
+		static_assert(s_rank <= 1 ||
+			padding_value == hamon::dynamic_extent ||
+			LayoutRightPaddedMapping::padding_value == hamon::dynamic_extent ||
+			padding_value == LayoutRightPaddedMapping::padding_value, "");
+	}
+
+	template <typename LayoutRightPaddedMapping,
+		typename = hamon::enable_if_t<
+			hamon::detail::is_layout_right_padded_mapping_of<LayoutRightPaddedMapping>::value &&	// [mdspan.layout.rightpad.cons]/14.1
+			hamon::is_constructible<extents_type,
+				typename LayoutRightPaddedMapping::extents_type>::value>,						// [mdspan.layout.rightpad.cons]/14.2
+		hamon::enable_if_t<!hamon::detail::is_layout_padded_conversion_explicit<LayoutRightPaddedMapping, mapping>::value>* = nullptr>
+	HAMON_CXX11_CONSTEXPR
+	mapping(LayoutRightPaddedMapping const& other)
+		: m_stride(stride_of(other))	// [mdspan.layout.rightpad.cons]/17
+		, m_extents(other.extents())
+	{
+		// [mdspan.layout.rightpad.cons]/15
+		static_assert(s_rank <= 1 ||
+			padding_value == hamon::dynamic_extent ||
+			LayoutRightPaddedMapping::padding_value == hamon::dynamic_extent ||
+			padding_value == LayoutRightPaddedMapping::padding_value, "");
+	}
+#endif
+
+#if defined(HAMON_HAS_CXX20_CONDITIONAL_EXPLICIT)
+	template <typename LayoutLeftPaddedMapping,
+		hamon::enable_if_t<
+			(hamon::detail::is_layout_left_padded_mapping_of<LayoutLeftPaddedMapping>::value ||
+			 hamon::detail::is_mapping_of<hamon::layout_left, LayoutLeftPaddedMapping>::value) &&	// [mdspan.layout.rightpad.cons]/19.1
+			LayoutLeftPaddedMapping::extents_type::rank() <= 1 &&										// [mdspan.layout.rightpad.cons]/19.2
+			hamon::is_constructible<extents_type,
+				typename LayoutLeftPaddedMapping::extents_type>::value>* = nullptr>						// [mdspan.layout.rightpad.cons]/19.3
+	HAMON_CXX11_CONSTEXPR
+	explicit(!hamon::is_convertible<typename LayoutLeftPaddedMapping::extents_type, extents_type>::value)
+	mapping(LayoutLeftPaddedMapping const& other) HAMON_NOEXCEPT
+		: m_stride()
+		, m_extents(other.extents())	// [mdspan.layout.rightpad.cons]/21
+	{}
+#else
+	template <typename LayoutLeftPaddedMapping,
+		hamon::enable_if_t<
+			(hamon::detail::is_layout_left_padded_mapping_of<LayoutLeftPaddedMapping>::value ||
+			 hamon::detail::is_mapping_of<hamon::layout_left, LayoutLeftPaddedMapping>::value) &&	// [mdspan.layout.rightpad.cons]/19.1
+			LayoutLeftPaddedMapping::extents_type::rank() <= 1 &&										// [mdspan.layout.rightpad.cons]/19.2
+			hamon::is_constructible<extents_type,
+				typename LayoutLeftPaddedMapping::extents_type>::value>* = nullptr,						// [mdspan.layout.rightpad.cons]/19.3
+		hamon::enable_if_t<!hamon::is_convertible<typename LayoutLeftPaddedMapping::extents_type, extents_type>::value>* = nullptr>
+	HAMON_CXX11_CONSTEXPR explicit
+	mapping(LayoutLeftPaddedMapping const& other) HAMON_NOEXCEPT
+		: m_stride()
+		, m_extents(other.extents())	// [mdspan.layout.rightpad.cons]/21
+	{}
+
+	template <typename LayoutLeftPaddedMapping,
+		hamon::enable_if_t<
+			(hamon::detail::is_layout_left_padded_mapping_of<LayoutLeftPaddedMapping>::value ||
+			 hamon::detail::is_mapping_of<hamon::layout_left, LayoutLeftPaddedMapping>::value) &&	// [mdspan.layout.rightpad.cons]/19.1
+			LayoutLeftPaddedMapping::extents_type::rank() <= 1 &&										// [mdspan.layout.rightpad.cons]/19.2
+			hamon::is_constructible<extents_type,
+				typename LayoutLeftPaddedMapping::extents_type>::value>* = nullptr,						// [mdspan.layout.rightpad.cons]/19.3
+		hamon::enable_if_t<hamon::is_convertible<typename LayoutLeftPaddedMapping::extents_type, extents_type>::value>* = nullptr>
+	HAMON_CXX11_CONSTEXPR
+	mapping(LayoutLeftPaddedMapping const& other) HAMON_NOEXCEPT
+		: m_stride()
+		, m_extents(other.extents())	// [mdspan.layout.rightpad.cons]/21
+	{}
+#endif
+
+	HAMON_CXX14_CONSTEXPR mapping& operator=(mapping const&) HAMON_NOEXCEPT = default;
+
+	// [mdspan.layout.rightpad.obs], observers
+	HAMON_CXX11_CONSTEXPR extents_type const&
+	extents() const HAMON_NOEXCEPT
+	{
+		return m_extents;
+	}
+
+	HAMON_CXX11_CONSTEXPR hamon::array<index_type, s_rank>
+	strides() const HAMON_NOEXCEPT
+	{
+		// [mdspan.layout.rightpad.obs]/1
+		return strides_impl(hamon::make_index_sequence<s_rank>{});
+	}
+
+	HAMON_CXX11_CONSTEXPR index_type
+	required_span_size() const HAMON_NOEXCEPT
+	{
+		// [mdspan.layout.rightpad.obs]/2
+		return has_empty_extent() ? index_type(0) : required_span_size_impl(0);
+	}
+
+	template <typename... Indices,
+		typename = hamon::enable_if_t<
+			sizeof...(Indices) == s_rank &&									// [mdspan.layout.rightpad.obs]/3.1
+			hamon::conjunction<
+				hamon::detail::is_index_convertible<Indices, index_type>...	// [mdspan.layout.rightpad.obs]/3.2, 3.3
+			>::value>>
+	HAMON_CXX11_CONSTEXPR index_type
+	operator()(Indices... i) const HAMON_NOEXCEPT
+	{
+		return
+			HAMON_ASSERT(hamon::detail::is_multidimensional_index_in(m_extents, i...)),	// [mdspan.layout.rightpad.obs]/4
+			offset_impl(0, index_type(0), static_cast<index_type>(i)...);								// [mdspan.layout.rightpad.obs]/5
+	}
+
+	static HAMON_CXX11_CONSTEXPR bool is_always_unique() HAMON_NOEXCEPT { return true; }
+
+	static HAMON_CXX11_CONSTEXPR bool
+	is_always_exhaustive() HAMON_NOEXCEPT
+	{
+		// [mdspan.layout.rightpad.obs]/6
+		return
+			s_rank <= 1 ||
+			(s_static_padding_stride != hamon::dynamic_extent &&
+			 extents_type::static_extent(s_rank - 1) != hamon::dynamic_extent &&
+			 s_static_padding_stride == extents_type::static_extent(s_rank - 1));
+	}
+
+	static HAMON_CXX11_CONSTEXPR bool is_always_strided() HAMON_NOEXCEPT { return true; }
+
+	static HAMON_CXX11_CONSTEXPR bool is_unique() HAMON_NOEXCEPT { return true; }
+
+	HAMON_CXX11_CONSTEXPR bool
+	is_exhaustive() const HAMON_NOEXCEPT
+	{
+		// [mdspan.layout.rightpad.obs]/7
+		return s_rank < 2 || m_extents.extent(s_rank - 1) == padding_stride();
+	}
+
+	static HAMON_CXX11_CONSTEXPR bool is_strided() HAMON_NOEXCEPT { return true; }
+
+	HAMON_CXX11_CONSTEXPR index_type
+	stride(rank_type r) const HAMON_NOEXCEPT
+	{
+		// [mdspan.layout.rightpad.obs]/8
+		return
+			HAMON_ASSERT(r < extents_type::rank()),
+			r == s_rank - 1 ?
+				index_type(1) :
+				static_cast<index_type>(padding_stride() * prod_of_extents(r + 1, s_rank - 1));
+	}
+
+	template <typename LayoutRightPaddedMapping,
+		typename = hamon::enable_if_t<
+			hamon::detail::is_layout_right_padded_mapping_of<LayoutRightPaddedMapping>::value &&	// [mdspan.layout.rightpad.obs]/9.1
+			LayoutRightPaddedMapping::extents_type::rank() == s_rank>>							// [mdspan.layout.rightpad.obs]/9.2
+	friend HAMON_CXX11_CONSTEXPR bool
+	operator==(mapping const& x, LayoutRightPaddedMapping const& y) HAMON_NOEXCEPT
+	{
+		// [mdspan.layout.rightpad.obs]/10
+		return x.extents() == y.extents() &&
+			(s_rank < 2 || hamon::cmp_equal(x.stride(s_rank - 2), y.stride(s_rank - 2)));
+	}
+
+#if !defined(HAMON_HAS_CXX20_THREE_WAY_COMPARISON)
+	template <typename LayoutRightPaddedMapping,
+		typename = hamon::enable_if_t<
+			hamon::detail::is_layout_right_padded_mapping_of<LayoutRightPaddedMapping>::value &&
+			LayoutRightPaddedMapping::extents_type::rank() == s_rank>>
+	friend HAMON_CXX11_CONSTEXPR bool
+	operator!=(mapping const& x, LayoutRightPaddedMapping const& y) HAMON_NOEXCEPT
+	{
+		return !(x == y);
+	}
+#endif
+
+private:
+	HAMON_NO_UNIQUE_ADDRESS stride_storage_type	m_stride;
+	HAMON_NO_UNIQUE_ADDRESS extents_type			m_extents;
+};
+
+#if !defined(HAMON_HAS_CXX17_INLINE_VARIABLES)
+template <hamon::size_t PaddingValue>
+template <typename Extents>
+HAMON_CXX11_CONSTEXPR hamon::size_t
+layout_right_padded<PaddingValue>::mapping<Extents>::padding_value;
+#endif
+
+}	// namespace hamon
+
+#endif
+
+#endif // HAMON_MDSPAN_LAYOUT_RIGHT_PADDED_HPP
@@ -0,0 +1,349 @@
+﻿/**
+ *	@file	layout_stride.hpp
+ *
+ *	@brief	layout_stride の定義
+ */
+
+#ifndef HAMON_MDSPAN_LAYOUT_STRIDE_HPP
+#define HAMON_MDSPAN_LAYOUT_STRIDE_HPP
+
+#include <hamon/mdspan/config.hpp>
+
+#if defined(HAMON_USE_STD_MDSPAN)
+
+namespace hamon
+{
+
+using std::layout_stride;
+
+}	// namespace hamon
+
+#else
+
+#include <hamon/mdspan/mdspan_fwd.hpp>
+#include <hamon/mdspan/extents.hpp>
+#include <hamon/mdspan/detail/fwd_prod_of_extents.hpp>
+#include <hamon/mdspan/detail/rev_prod_of_extents.hpp>
+#include <hamon/mdspan/detail/is_extents.hpp>
+#include <hamon/mdspan/detail/is_index_convertible.hpp>
+#include <hamon/mdspan/detail/is_layout_left_padded_mapping_of.hpp>
+#include <hamon/mdspan/detail/is_layout_right_padded_mapping_of.hpp>
+#include <hamon/mdspan/detail/is_mapping_of.hpp>
+#include <hamon/mdspan/detail/is_multidimensional_index_in.hpp>
+#include <hamon/mdspan/detail/layout_mapping_alike.hpp>
+#include <hamon/span/span.hpp>
+#include <hamon/array/array.hpp>
+#include <hamon/type_traits/bool_constant.hpp>
+#include <hamon/type_traits/conjunction.hpp>
+#include <hamon/type_traits/enable_if.hpp>
+#include <hamon/type_traits/integral_constant.hpp>
+#include <hamon/type_traits/is_constructible.hpp>
+#include <hamon/type_traits/is_convertible.hpp>
+#include <hamon/utility/index_sequence.hpp>
+#include <hamon/utility/make_index_sequence.hpp>
+#include <hamon/assert.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+namespace detail
+{
+
+// [mdspan.layout.stride.cons]/8
+template <typename StridedLayoutMapping, typename Extents>
+struct is_layout_stride_conversion_implicit
+	: public hamon::bool_constant<
+		hamon::is_convertible<typename StridedLayoutMapping::extents_type, Extents>::value &&
+		(hamon::detail::is_mapping_of<hamon::layout_left, StridedLayoutMapping>::value ||
+		 hamon::detail::is_mapping_of<hamon::layout_right, StridedLayoutMapping>::value ||
+		 hamon::detail::is_layout_left_padded_mapping_of<StridedLayoutMapping>::value ||
+		 hamon::detail::is_layout_right_padded_mapping_of<StridedLayoutMapping>::value ||
+		 hamon::detail::is_mapping_of<hamon::layout_stride, StridedLayoutMapping>::value)
+	>
+{};
+
+template <typename StridedLayoutMapping, typename Extents, typename = void>
+struct is_layout_stride_constructible_from
+	: public hamon::false_type {};
+
+template <typename StridedLayoutMapping, typename Extents>
+struct is_layout_stride_constructible_from<StridedLayoutMapping, Extents,
+	hamon::enable_if_t<hamon::detail::layout_mapping_alike<StridedLayoutMapping>::value>>
+	: public hamon::bool_constant<
+		hamon::is_constructible<Extents, typename StridedLayoutMapping::extents_type>::value &&	// [mdspan.layout.stride.cons]/6.2
+		StridedLayoutMapping::is_always_unique() &&												// [mdspan.layout.stride.cons]/6.3
+		StridedLayoutMapping::is_always_strided()												// [mdspan.layout.stride.cons]/6.4
+	>
+{};
+
+}	// namespace detail
+
+// [mdspan.layout.stride.overview]
+template <typename Extents>
+class layout_stride::mapping
+{
+	// [mdspan.layout.stride.overview]/2
+	static_assert(hamon::detail::is_extents<Extents>::value, "");
+
+public:
+	using extents_type = Extents;
+	using index_type = typename extents_type::index_type;
+	using size_type = typename extents_type::size_type;
+	using rank_type = typename extents_type::rank_type;
+	using layout_type = layout_stride;
+
+private:
+	static HAMON_CXX11_CONSTEXPR rank_type s_rank = extents_type::rank();
+
+	using strides_type = hamon::array<index_type, s_rank>;
+
+	// 既定のストライドは layout_right と同じ
+	template <hamon::size_t... Is>
+	static HAMON_CXX11_CONSTEXPR strides_type
+	default_strides(hamon::index_sequence<Is...>) HAMON_NOEXCEPT
+	{
+		return strides_type{{hamon::detail::rev_prod_of_extents(extents_type(), Is)...}};
+	}
+
+	template <typename Strides, hamon::size_t... Is>
+	static HAMON_CXX11_CONSTEXPR strides_type
+	make_strides(Strides const& s, hamon::index_sequence<Is...>) HAMON_NOEXCEPT
+	{
+		return strides_type{{static_cast<index_type>(s[Is])...}};
+	}
+
+	template <typename StridedLayoutMapping, hamon::size_t... Is>
+	static HAMON_CXX11_CONSTEXPR strides_type
+	strides_of(StridedLayoutMapping const& other, hamon::index_sequence<Is...>) HAMON_NOEXCEPT
+	{
+		return strides_type{{static_cast<index_type>(other.stride(Is))...}};
+	}
+
+	// rank() == 0 のとき hamon::array<index_type, 0> は operator[] を使えない
+	HAMON_CXX11_CONSTEXPR index_type
+	stride_impl(rank_type r, hamon::true_type) const HAMON_NOEXCEPT
+	{
+		return m_strides[r];
+	}
+
+	HAMON_CXX11_CONSTEXPR index_type
+	stride_impl(rank_type, hamon::false_type) const HAMON_NOEXCEPT
+	{
+		return 0;
+	}
+
+	HAMON_CXX11_CONSTEXPR index_type
+	stride_impl(rank_type r) const HAMON_NOEXCEPT
+	{
+		return stride_impl(r, hamon::bool_constant<(s_rank > 0)>{});
+	}
+
+	HAMON_CXX11_CONSTEXPR index_type
+	offset_impl(rank_type) const HAMON_NOEXCEPT
+	{
+		return 0;
+	}
+
+	template <typename... Rest>
+	HAMON_CXX11_CONSTEXPR index_type
+	offset_impl(rank_type r, index_type i, Rest... rest) const HAMON_NOEXCEPT
+	{
+		return static_cast<index_type>(i * m_strides[r] + offset_impl(r + 1, rest...));
+	}
+
+	// 1 + (e[0] - 1) * s[0] + (e[1] - 1) * s[1] + ...
+	HAMON_CXX11_CONSTEXPR index_type
+	required_span_size_impl(rank_type r) const HAMON_NOEXCEPT
+	{
+		return r >= s_rank ?
+			index_type(1) :
+			m_extents.extent(r) == 0 ?
+				index_type(0) :
+			static_cast<index_type>(
+				(m_extents.extent(r) - 1) * stride_impl(r) + required_span_size_impl(r + 1));
+	}
+
+	template <typename OtherMapping>
+	HAMON_CXX11_CONSTEXPR bool
+	strides_equal(OtherMapping const& other, rank_type r = 0) const HAMON_NOEXCEPT
+	{
+		return r >= s_rank || (
+			stride_impl(r) == other.stride(r) &&
+			strides_equal(other, r + 1));
+	}
+
+	// [mdspan.layout.stride.expo]/2 OFFSET
+	template <typename OtherMapping, hamon::size_t... Is>
+	static HAMON_CXX11_CONSTEXPR typename OtherMapping::index_type
+	offset_of(OtherMapping const& m, hamon::index_sequence<Is...>) HAMON_NOEXCEPT
+	{
+		return m.required_span_size() == 0 ? 0 :
+			m(((void)Is, typename OtherMapping::index_type(0))...);
+	}
+
+public:
+	// [mdspan.layout.stride.cons], constructors
+	HAMON_CXX11_CONSTEXPR
+	mapping() HAMON_NOEXCEPT
+		: m_extents()
+		, m_strides(default_strides(hamon::make_index_sequence<s_rank>{}))	// [mdspan.layout.stride.cons]/2
+	{}
+
+	HAMON_CXX11_CONSTEXPR mapping(mapping const&) HAMON_NOEXCEPT = default;
+
+	template <typename OtherIndexType,
+		typename = hamon::enable_if_t<
+			hamon::detail::is_index_convertible<OtherIndexType const&, index_type>::value>>	// [mdspan.layout.stride.cons]/3
+	HAMON_CXX11_CONSTEXPR
+	mapping(extents_type const& e, hamon::span<OtherIndexType, s_rank> s) HAMON_NOEXCEPT
+		: m_extents(e)
+		, m_strides(make_strides(s, hamon::make_index_sequence<s_rank>{}))	// [mdspan.layout.stride.cons]/5
+	{}
+
+	template <typename OtherIndexType,
+		typename = hamon::enable_if_t<
+			hamon::detail::is_index_convertible<OtherIndexType const&, index_type>::value>>	// [mdspan.layout.stride.cons]/3
+	HAMON_CXX11_CONSTEXPR
+	mapping(extents_type const& e, hamon::array<OtherIndexType, s_rank> const& s) HAMON_NOEXCEPT
+		: m_extents(e)
+		, m_strides(make_strides(s, hamon::make_index_sequence<s_rank>{}))	// [mdspan.layout.stride.cons]/5
+	{}
+
+#if defined(HAMON_HAS_CXX20_CONDITIONAL_EXPLICIT)
+	template <typename StridedLayoutMapping,
+		typename = hamon::enable_if_t<
+			hamon::detail::is_layout_stride_constructible_from<StridedLayoutMapping, extents_type>::value>>
+	HAMON_CXX11_CONSTEXPR
+	explicit(!hamon::detail::is_layout_stride_conversion_implicit<StridedLayoutMapping, extents_type>::value)
+	mapping(StridedLayoutMapping const& other) HAMON_NOEXCEPT
+		: m_extents(other.extents())											// [mdspan.layout.stride.cons]/7
+		, m_strides(strides_of(other, hamon::make_index_sequence<s_rank>{}))
+	{}
+#else
+	template <typename StridedLayoutMapping,
+		typename = hamon::enable_if_t<
+			hamon::detail::is_layout_stride_constructible_from<StridedLayoutMapping, extents_type>::value>,
+		hamon::enable_if_t<
+			!hamon::detail::is_layout_stride_conversion_implicit<StridedLayoutMapping, extents_type>::value>* = nullptr>
+	HAMON_CXX11_CONSTEXPR explicit
+	mapping(StridedLayoutMapping const& other) HAMON_NOEXCEPT
+		: m_extents(other.extents())											// [mdspan.layout.stride.cons]/7
+		, m_strides(strides_of(other, hamon::make_index_sequence<s_rank>{}))
+	{}
+
+	template <typename StridedLayoutMapping,
+		typename = hamon::enable_if_t<
+			hamon::detail::is_layout_stride_constructible_from<StridedLayoutMapping, extents_type>::value>,
+		hamon::enable_if_t<
+			hamon::detail::is_layout_stride_conversion_implicit<StridedLayoutMapping, extents_type>::value>* = nullptr>
+	HAMON_CXX11_CONSTEXPR
+	mapping(StridedLayoutMapping const& other) HAMON_NOEXCEPT
+		: m_extents(other.extents())											// [mdspan.layout.stride.cons]/7
+		, m_strides(strides_of(other, hamon::make_index_sequence<s_rank>{}))
+	{}
+#endif
+
+	HAMON_CXX14_CONSTEXPR mapping& operator=(mapping const&) HAMON_NOEXCEPT = default;
+
+	// [mdspan.layout.stride.obs], observers
+	HAMON_CXX11_CONSTEXPR extents_type const&
+	extents() const HAMON_NOEXCEPT
+	{
+		return m_extents;
+	}
+
+	HAMON_CXX11_CONSTEXPR strides_type
+	strides() const HAMON_NOEXCEPT
+	{
+		return m_strides;
+	}
+
+	HAMON_CXX11_CONSTEXPR index_type
+	required_span_size() const HAMON_NOEXCEPT
+	{
+		// [mdspan.layout.stride.obs]/1
+		return required_span_size_impl(0);
+	}
+
+	template <typename... Indices,
+		typename = hamon::enable_if_t<
+			sizeof...(Indices) == s_rank &&									// [mdspan.layout.stride.obs]/2.1
+			hamon::conjunction<
+				hamon::detail::is_index_convertible<Indices, index_type>...	// [mdspan.layout.stride.obs]/2.2, 2.3
+			>::value>>
+	HAMON_CXX11_CONSTEXPR index_type
+	operator()(Indices... i) const HAMON_NOEXCEPT
+	{
+		return
+			HAMON_ASSERT(hamon::detail::is_multidimensional_index_in(m_extents, i...)),	// [mdspan.layout.stride.obs]/3
+			offset_impl(0, static_cast<index_type>(i)...);								// [mdspan.layout.stride.obs]/4
+	}
+
+	static HAMON_CXX11_CONSTEXPR bool is_always_unique() HAMON_NOEXCEPT { return true; }
+	static HAMON_CXX11_CONSTEXPR bool is_always_exhaustive() HAMON_NOEXCEPT { return false; }
+	static HAMON_CXX11_CONSTEXPR bool is_always_strided() HAMON_NOEXCEPT { return true; }
+
+	static HAMON_CXX11_CONSTEXPR bool is_unique() HAMON_NOEXCEPT { return true; }
+
+	HAMON_CXX11_CONSTEXPR bool
+	is_exhaustive() const HAMON_NOEXCEPT
+	{
+		// [mdspan.layout.stride.obs]/5
+		// 重なりが無い (unique) ので、要素数とrequired_span_sizeが等しければ隙間も無い
+		return s_rank == 0 ||
+			required_span_size() == hamon::detail::fwd_prod_of_extents(m_extents, s_rank);
+	}
+
+	static HAMON_CXX11_CONSTEXPR bool is_strided() HAMON_NOEXCEPT { return true; }
+
+	HAMON_CXX11_CONSTEXPR index_type
+	stride(rank_type i) const HAMON_NOEXCEPT
+	{
+		return stride_impl(i);
+	}
+
+	template <typename OtherMapping,
+		typename = hamon::enable_if_t<
+			hamon::detail::layout_mapping_alike<OtherMapping>::value &&		// [mdspan.layout.stride.obs]/7.1
+			OtherMapping::extents_type::rank() == s_rank &&					// [mdspan.layout.stride.obs]/7.2
+			OtherMapping::is_always_strided()>>								// [mdspan.layout.stride.obs]/7.3
+	friend HAMON_CXX11_CONSTEXPR bool
+	operator==(mapping const& x, OtherMapping const& y) HAMON_NOEXCEPT
+	{
+		// [mdspan.layout.stride.obs]/9
+		return
+			x.extents() == y.extents() &&
+			offset_of(y, hamon::make_index_sequence<s_rank>{}) == 0 &&
+			x.strides_equal(y);
+	}
+
+#if !defined(HAMON_HAS_CXX20_THREE_WAY_COMPARISON)
+	template <typename OtherMapping,
+		typename = hamon::enable_if_t<
+			hamon::detail::layout_mapping_alike<OtherMapping>::value &&
+			OtherMapping::extents_type::rank() == s_rank &&
+			OtherMapping::is_always_strided()>>
+	friend HAMON_CXX11_CONSTEXPR bool
+	operator!=(mapping const& x, OtherMapping const& y) HAMON_NOEXCEPT
+	{
+		return !(x == y);
+	}
+#endif
+
+private:
+	HAMON_NO_UNIQUE_ADDRESS extents_type	m_extents;
+	strides_type	m_strides;
+};
+
+#if !defined(HAMON_HAS_CXX17_INLINE_VARIABLES)
+template <typename Extents>
+HAMON_CXX11_CONSTEXPR typename layout_stride::mapping<Extents>::rank_type
+layout_stride::mapping<Extents>::s_rank;
+#endif
+
+}	// namespace hamon
+
+#endif
+
+#endif // HAMON_MDSPAN_LAYOUT_STRIDE_HPP
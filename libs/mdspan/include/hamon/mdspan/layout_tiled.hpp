@@ -0,0 +1,216 @@
+﻿/**
+ *	@file	layout_tiled.hpp
+ *
+ *	@brief	layout_tiled の定義
+ */
+
+#ifndef HAMON_MDSPAN_LAYOUT_TILED_HPP
+#define HAMON_MDSPAN_LAYOUT_TILED_HPP
+
+#include <hamon/mdspan/extents.hpp>
+#include <hamon/mdspan/detail/is_extents.hpp>
+#include <hamon/mdspan/detail/is_index_convertible.hpp>
+#include <hamon/mdspan/detail/is_multidimensional_index_in.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/type_traits/conjunction.hpp>
+#include <hamon/type_traits/enable_if.hpp>
+#include <hamon/type_traits/is_constructible.hpp>
+#include <hamon/type_traits/is_convertible.hpp>
+#include <hamon/assert.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+/**
+ *	@brief	2次元配列を TileRows x TileCols のタイルに分割して配置するレイアウト
+ *
+ *	タイル同士は行優先で並び、各タイルの中の要素も行優先で並ぶ。
+ *	1つのタイルの要素はメモリ上で連続するため、
+ *	タイル単位で走査するアルゴリズム(行列の転置や乗算など)のキャッシュ効率が良くなる。
+ *
+ *	extent(1) が TileCols の倍数でないとき、各タイル行の末尾のタイルには使われない領域ができる。
+ *	同様に extent(0) が TileRows の倍数でないとき、最後のタイル行には使われない領域ができる。
+ *
+ *	標準のレイアウトではないため、submdspan には対応していない。
+ */
+template <hamon::size_t TileRows, hamon::size_t TileCols>
+struct layout_tiled
+{
+	static_assert(TileRows > 0, "");
+	static_assert(TileCols > 0, "");
+
+	template <typename Extents>
+	class mapping;
+};
+
+template <hamon::size_t TileRows, hamon::size_t TileCols>
+template <typename Extents>
+class layout_tiled<TileRows, TileCols>::mapping
+{
+	static_assert(hamon::detail::is_extents<Extents>::value, "");
+	static_assert(Extents::rank() == 2, "layout_tiled supports only rank 2 extents");
+
+public:
+	using extents_type = Extents;
+	using index_type = typename extents_type::index_type;
+	using size_type = typename extents_type::size_type;
+	using rank_type = typename extents_type::rank_type;
+	using layout_type = layout_tiled<TileRows, TileCols>;
+
+private:
+	static HAMON_CXX11_CONSTEXPR index_type s_tile_rows = static_cast<index_type>(TileRows);
+	static HAMON_CXX11_CONSTEXPR index_type s_tile_cols = static_cast<index_type>(TileCols);
+	static HAMON_CXX11_CONSTEXPR index_type s_tile_size = static_cast<index_type>(TileRows * TileCols);
+
+	// 横方向のタイルの数
+	HAMON_CXX11_CONSTEXPR index_type
+	tiles_per_row() const HAMON_NOEXCEPT
+	{
+		return static_cast<index_type>((m_extents.extent(1) + s_tile_cols - 1) / s_tile_cols);
+	}
+
+	// 縦方向のタイルの数
+	HAMON_CXX11_CONSTEXPR index_type
+	tiles_per_col() const HAMON_NOEXCEPT
+	{
+		return static_cast<index_type>((m_extents.extent(0) + s_tile_rows - 1) / s_tile_rows);
+	}
+
+	HAMON_CXX11_CONSTEXPR index_type
+	offset_impl(index_type i, index_type j) const HAMON_NOEXCEPT
+	{
+		return static_cast<index_type>(
+			((i / s_tile_rows) * tiles_per_row() + (j / s_tile_cols)) * s_tile_size +
+			(i % s_tile_rows) * s_tile_cols +
+			(j % s_tile_cols));
+	}
+
+public:
+	HAMON_CXX11_CONSTEXPR mapping() HAMON_NOEXCEPT = default;
+
+	HAMON_CXX11_CONSTEXPR mapping(mapping const&) HAMON_NOEXCEPT = default;
+
+	HAMON_CXX11_CONSTEXPR
+	mapping(extents_type const& e) HAMON_NOEXCEPT
+		: m_extents(e)
+	{}
+
+#if defined(HAMON_HAS_CXX20_CONDITIONAL_EXPLICIT)
+	template <typename OtherExtents,
+		typename = hamon::enable_if_t<
+			hamon::is_constructible<extents_type, OtherExtents>::value>>
+	HAMON_CXX11_CONSTEXPR
+	explicit(!hamon::is_convertible<OtherExtents, extents_type>::value)
+	mapping(mapping<OtherExtents> const& other) HAMON_NOEXCEPT
+		: m_extents(other.extents())
+	{}
+#else
+	template <typename OtherExtents,
+		typename = hamon::enable_if_t<
+			hamon::is_constructible<extents_type, OtherExtents>::value>,
+		hamon::enable_if_t<!hamon::is_convertible<OtherExtents, extents_type>::value>* = nullptr>
+	HAMON_CXX11_CONSTEXPR explicit
+	mapping(mapping<OtherExtents> const& other) HAMON_NOEXCEPT
+		: m_extents(other.extents())
+	{}
+
+	template <typename OtherExtents,
+		typename = hamon::enable_if_t<
+			hamon::is_constructible<extents_type, OtherExtents>::value>,
+		hamon::enable_if_t<hamon::is_convertible<OtherExtents, extents_type>::value>* = nullptr>
+	HAMON_CXX11_CONSTEXPR
+	mapping(mapping<OtherExtents> const& other) HAMON_NOEXCEPT
+		: m_extents(other.extents())
+	{}
+#endif
+
+	HAMON_CXX14_CONSTEXPR mapping& operator=(mapping const&) HAMON_NOEXCEPT = default;
+
+	HAMON_CXX11_CONSTEXPR extents_type const&
+	extents() const HAMON_NOEXCEPT
+	{
+		return m_extents;
+	}
+
+	HAMON_CXX11_CONSTEXPR index_type
+	required_span_size() const HAMON_NOEXCEPT
+	{
+		// 端のタイルの使われない領域も含む
+		return (m_extents.extent(0) == 0 || m_extents.extent(1) == 0) ?
+			index_type(0) :
+			static_cast<index_type>(tiles_per_col() * tiles_per_row() * s_tile_size);
+	}
+
+	template <typename I0, typename I1,
+		typename = hamon::enable_if_t<hamon::conjunction<
+			hamon::detail::is_index_convertible<I0, index_type>,
+			hamon::detail::is_index_convertible<I1, index_type>
+		>::value>>
+	HAMON_CXX11_CONSTEXPR index_type
+	operator()(I0 i, I1 j) const HAMON_NOEXCEPT
+	{
+		return
+			HAMON_ASSERT(hamon::detail::is_multidimensional_index_in(m_extents, i, j)),
+			offset_impl(static_cast<index_type>(i), static_cast<index_type>(j));
+	}
+
+	static HAMON_CXX11_CONSTEXPR bool is_always_unique() HAMON_NOEXCEPT { return true; }
+	static HAMON_CXX11_CONSTEXPR bool is_always_exhaustive() HAMON_NOEXCEPT { return false; }
+	static HAMON_CXX11_CONSTEXPR bool is_always_strided() HAMON_NOEXCEPT { return false; }
+
+	static HAMON_CXX11_CONSTEXPR bool is_unique() HAMON_NOEXCEPT { return true; }
+
+	HAMON_CXX11_CONSTEXPR bool
+	is_exhaustive() const HAMON_NOEXCEPT
+	{
+		// 端のタイルに使われない領域が無い
+		return m_extents.extent(0) % s_tile_rows == 0 &&
+			   m_extents.extent(1) % s_tile_cols == 0;
+	}
+
+	HAMON_CXX11_CONSTEXPR bool
+	is_strided() const HAMON_NOEXCEPT
+	{
+		// タイルの幅が1、または横方向のタイルが1つだけのときは layout_right と同じ形になる
+		return s_tile_rows == 1 || m_extents.extent(1) <= s_tile_cols;
+	}
+
+	HAMON_CXX11_CONSTEXPR index_type
+	stride(rank_type r) const HAMON_NOEXCEPT
+	{
+		return
+			HAMON_ASSERT(is_strided()),
+			HAMON_ASSERT(r < extents_type::rank()),
+			r == 1 ?
+				index_type(1) :
+			s_tile_rows == 1 ?
+				static_cast<index_type>(tiles_per_row() * s_tile_cols) :
+				s_tile_cols;
+	}
+
+	template <typename OtherExtents,
+		typename = hamon::enable_if_t<OtherExtents::rank() == extents_type::rank()>>
+	friend HAMON_CXX11_CONSTEXPR bool
+	operator==(mapping const& x, mapping<OtherExtents> const& y) HAMON_NOEXCEPT
+	{
+		return x.extents() == y.extents();
+	}
+
+#if !defined(HAMON_HAS_CXX20_THREE_WAY_COMPARISON)
+	template <typename OtherExtents,
+		typename = hamon::enable_if_t<OtherExtents::rank() == extents_type::rank()>>
+	friend HAMON_CXX11_CONSTEXPR bool
+	operator!=(mapping const& x, mapping<OtherExtents> const& y) HAMON_NOEXCEPT
+	{
+		return !(x == y);
+	}
+#endif
+
+private:
+	HAMON_NO_UNIQUE_ADDRESS extents_type	m_extents{};
+};
+
+}	// namespace hamon
+
+#endif // HAMON_MDSPAN_LAYOUT_TILED_HPP
@@ -0,0 +1,464 @@
+﻿/**
+ *	@file	mdspan.hpp
+ *
+ *	@brief	mdspan の定義
+ */
+
+#ifndef HAMON_MDSPAN_MDSPAN_HPP
+#define HAMON_MDSPAN_MDSPAN_HPP
+
+#include <hamon/mdspan/config.hpp>
+#include <hamon/mdspan/mdspan_fwd.hpp>
+
+#if defined(HAMON_USE_STD_MDSPAN)
+
+namespace hamon
+{
+
+using std::mdspan;
+
+}	// namespace hamon
+
+#else
+
+#include <hamon/mdspan/extents.hpp>
+#include <hamon/mdspan/dextents.hpp>
+#include <hamon/mdspan/layout_right.hpp>
+#include <hamon/mdspan/default_accessor.hpp>
+#include <hamon/mdspan/detail/fwd_prod_of_extents.hpp>
+#include <hamon/mdspan/detail/is_extents.hpp>
+#include <hamon/mdspan/detail/is_index_convertible.hpp>
+#include <hamon/mdspan/detail/is_multidimensional_index_in.hpp>
+#include <hamon/mdspan/detail/maybe_static_ext.hpp>
+#include <hamon/span/span.hpp>
+#include <hamon/array/array.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/type_traits/bool_constant.hpp>
+#include <hamon/type_traits/conjunction.hpp>
+#include <hamon/type_traits/enable_if.hpp>
+#include <hamon/type_traits/extent.hpp>
+#include <hamon/type_traits/is_abstract.hpp>
+#include <hamon/type_traits/is_array.hpp>
+#include <hamon/type_traits/is_constructible.hpp>
+#include <hamon/type_traits/is_convertible.hpp>
+#include <hamon/type_traits/is_default_constructible.hpp>
+#include <hamon/type_traits/is_pointer.hpp>
+#include <hamon/type_traits/is_same.hpp>
+#include <hamon/type_traits/rank.hpp>
+#include <hamon/type_traits/remove_all_extents.hpp>
+#include <hamon/type_traits/remove_cv.hpp>
+#include <hamon/type_traits/remove_pointer.hpp>
+#include <hamon/type_traits/remove_reference.hpp>
+#include <hamon/utility/as_const.hpp>
+#include <hamon/utility/index_sequence.hpp>
+#include <hamon/utility/make_index_sequence.hpp>
+#include <hamon/utility/move.hpp>
+#include <hamon/utility/swap.hpp>
+#include <hamon/assert.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+namespace detail
+{
+
+// [mdspan.mdspan.cons]/22
+template <typename From, typename To>
+struct is_mdspan_conversion_explicit
+	: public hamon::bool_constant<
+		!hamon::is_convertible<typename From::mapping_type const&, typename To::mapping_type>::value ||
+		!hamon::is_convertible<typename From::accessor_type const&, typename To::accessor_type>::value
+	>
+{};
+
+}	// namespace detail
+
+// [mdspan.mdspan.overview]
+template <typename ElementType, typename Extents, typename LayoutPolicy, typename AccessorPolicy>
+class mdspan
+{
+	// [mdspan.mdspan.overview]/2
+	static_assert(sizeof(ElementType) > 0, "");
+	static_assert(!hamon::is_abstract<ElementType>::value, "");
+	static_assert(!hamon::is_array<ElementType>::value, "");
+	static_assert(hamon::detail::is_extents<Extents>::value, "");
+	static_assert(hamon::is_same<ElementType, typename AccessorPolicy::element_type>::value, "");
+
+public:
+	using extents_type = Extents;
+	using layout_type = LayoutPolicy;
+	using accessor_type = AccessorPolicy;
+	using mapping_type = typename layout_type::template mapping<extents_type>;
+	using element_type = ElementType;
+	using value_type = hamon::remove_cv_t<element_type>;
+	using index_type = typename extents_type::index_type;
+	using size_type = typename extents_type::size_type;
+	using rank_type = typename extents_type::rank_type;
+	using data_handle_type = typename accessor_type::data_handle_type;
+	using reference = typename accessor_type::reference;
+
+	static HAMON_CXX11_CONSTEXPR rank_type rank() HAMON_NOEXCEPT { return extents_type::rank(); }
+	static HAMON_CXX11_CONSTEXPR rank_type rank_dynamic() HAMON_NOEXCEPT { return extents_type::rank_dynamic(); }
+	static HAMON_CXX11_CONSTEXPR hamon::size_t static_extent(rank_type r) HAMON_NOEXCEPT { return extents_type::static_extent(r); }
+	HAMON_CXX11_CONSTEXPR index_type extent(rank_type r) const HAMON_NOEXCEPT { return extents().extent(r); }
+
+private:
+	template <typename... Indices>
+	using is_indices = hamon::conjunction<
+		hamon::detail::is_index_convertible<Indices, index_type>...>;
+
+	template <typename OtherIndexType, hamon::size_t N>
+	using is_extents_array = hamon::bool_constant<
+		hamon::detail::is_index_convertible<OtherIndexType const&, index_type>::value &&	// [mdspan.mdspan.cons]/6.1, 6.2
+		(N == rank() || N == rank_dynamic()) &&												// [mdspan.mdspan.cons]/6.3
+		hamon::is_constructible<mapping_type, extents_type const&>::value &&				// [mdspan.mdspan.cons]/6.4
+		hamon::is_default_constructible<accessor_type>::value>;								// [mdspan.mdspan.cons]/6.5
+
+	template <typename... Indices>
+	HAMON_CXX11_CONSTEXPR reference
+	access_impl(Indices... indices) const
+	{
+		return
+			HAMON_ASSERT(hamon::detail::is_multidimensional_index_in(extents(), indices...)),	// [mdspan.mdspan.members]/3
+			m_acc.access(m_ptr, static_cast<hamon::size_t>(m_map(indices...)));					// [mdspan.mdspan.members]/2
+	}
+
+	template <typename Indices, hamon::size_t... Is>
+	HAMON_CXX11_CONSTEXPR reference
+	access_array(Indices const& indices, hamon::index_sequence<Is...>) const
+	{
+		// [mdspan.mdspan.members]/5
+		return access_impl(static_cast<index_type>(hamon::as_const(indices[Is]))...);
+	}
+
+	HAMON_CXX11_CONSTEXPR bool
+	empty_impl(rank_type r) const HAMON_NOEXCEPT
+	{
+		return r < rank() && (extent(r) == 0 || empty_impl(r + 1));
+	}
+
+public:
+	// [mdspan.mdspan.cons], constructors
+	template <typename E = extents_type,
+		typename = hamon::enable_if_t<
+			(E::rank_dynamic() > 0) &&										// [mdspan.mdspan.cons]/1.1
+			hamon::is_default_constructible<data_handle_type>::value &&		// [mdspan.mdspan.cons]/1.2
+			hamon::is_default_constructible<mapping_type>::value &&			// [mdspan.mdspan.cons]/1.3
+			hamon::is_default_constructible<accessor_type>::value>>			// [mdspan.mdspan.cons]/1.4
+	HAMON_CXX11_CONSTEXPR
+	mdspan()
+		: m_acc(), m_map(), m_ptr()	// [mdspan.mdspan.cons]/3
+	{}
+
+	HAMON_CXX11_CONSTEXPR mdspan(mdspan const&) = default;
+	HAMON_CXX11_CONSTEXPR mdspan(mdspan&&) = default;
+
+	template <typename... OtherIndexTypes,
+		typename = hamon::enable_if_t<
+			is_indices<OtherIndexTypes...>::value &&												// [mdspan.mdspan.cons]/4.1, 4.2
+			(sizeof...(OtherIndexTypes) == rank() || sizeof...(OtherIndexTypes) == rank_dynamic()) &&	// [mdspan.mdspan.cons]/4.3
+			hamon::is_constructible<mapping_type, extents_type const&>::value &&					// [mdspan.mdspan.cons]/4.4
+			hamon::is_default_constructible<accessor_type>::value>>									// [mdspan.mdspan.cons]/4.5
+	HAMON_CXX11_CONSTEXPR explicit
+	mdspan(data_handle_type p, OtherIndexTypes... exts)
+		: m_acc()
+		, m_map(extents_type(static_cast<index_type>(hamon::move(exts))...))	// [mdspan.mdspan.cons]/5
+		, m_ptr(hamon::move(p))
+	{}
+
+#if defined(HAMON_HAS_CXX20_CONDITIONAL_EXPLICIT)
+	template <typename OtherIndexType, hamon::size_t N,
+		typename = hamon::enable_if_t<is_extents_array<OtherIndexType, N>::value>>
+	HAMON_CXX11_CONSTEXPR explicit(N != rank_dynamic())
+	mdspan(data_handle_type p, hamon::span<OtherIndexType, N> exts)
+		: m_acc()
+		, m_map(extents_type(exts))	// [mdspan.mdspan.cons]/8
+		, m_ptr(hamon::move(p))
+	{}
+
+	template <typename OtherIndexType, hamon::size_t N,
+		typename = hamon::enable_if_t<is_extents_array<OtherIndexType, N>::value>>
+	HAMON_CXX11_CONSTEXPR explicit(N != rank_dynamic())
+	mdspan(data_handle_type p, hamon::array<OtherIndexType, N> const& exts)
+		: m_acc()
+		, m_map(extents_type(exts))	// [mdspan.mdspan.cons]/8
+		, m_ptr(hamon::move(p))
+	{}
+#else
+	template <typename OtherIndexType, hamon::size_t N,
+		typename = hamon::enable_if_t<is_extents_array<OtherIndexType, N>::value>,
+		hamon::enable_if_t<(N != extents_type::rank_dynamic())>* = nullptr>
+	HAMON_CXX11_CONSTEXPR explicit
+	mdspan(data_handle_type p, hamon::span<OtherIndexType, N> exts)
+		: m_acc()
+		, m_map(extents_type(exts))	// [mdspan.mdspan.cons]/8
+		, m_ptr(hamon::move(p))
+	{}
+
+	template <typename OtherIndexType, hamon::size_t N,
+		typename = hamon::enable_if_t<is_extents_array<OtherIndexType, N>::value>,
+		hamon::enable_if_t<(N == extents_type::rank_dynamic())>* = nullptr>
+	HAMON_CXX11_CONSTEXPR
+	mdspan(data_handle_type p, hamon::span<OtherIndexType, N> exts)
+		: m_acc()
+		, m_map(extents_type(exts))	// [mdspan.mdspan.cons]/8
+		, m_ptr(hamon::move(p))
+	{}
+
+	template <typename OtherIndexType, hamon::size_t N,
+		typename = hamon::enable_if_t<is_extents_array<OtherIndexType, N>::value>,
+		hamon::enable_if_t<(N != extents_type::rank_dynamic())>* = nullptr>
+	HAMON_CXX11_CONSTEXPR explicit
+	mdspan(data_handle_type p, hamon::array<OtherIndexType, N> const& exts)
+		: m_acc()
+		, m_map(extents_type(exts))	// [mdspan.mdspan.cons]/8
+		, m_ptr(hamon::move(p))
+	{}
+
+	template <typename OtherIndexType, hamon::size_t N,
+		typename = hamon::enable_if_t<is_extents_array<OtherIndexType, N>::value>,
+		hamon::enable_if_t<(N == extents_type::rank_dynamic())>* = nullptr>
+	HAMON_CXX11_CONSTEXPR
+	mdspan(data_handle_type p, hamon::array<OtherIndexType, N> const& exts)
+		: m_acc()
+		, m_map(extents_type(exts))	// [mdspan.mdspan.cons]/8
+		, m_ptr(hamon::move(p))
+	{}
+#endif
+
+	template <typename M = mapping_type,
+		typename = hamon::enable_if_t<
+			hamon::is_constructible<M, extents_type const&>::value &&	// [mdspan.mdspan.cons]/9.1
+			hamon::is_default_constructible<accessor_type>::value>>		// [mdspan.mdspan.cons]/9.2
+	HAMON_CXX11_CONSTEXPR
+	mdspan(data_handle_type p, extents_type const& ext)
+		: m_acc()
+		, m_map(ext)	// [mdspan.mdspan.cons]/11
+		, m_ptr(hamon::move(p))
+	{}
+
+	template <typename A = accessor_type,
+		typename = hamon::enable_if_t<
+			hamon::is_default_constructible<A>::value>>	// [mdspan.mdspan.cons]/12
+	HAMON_CXX11_CONSTEXPR
+	mdspan(data_handle_type p, mapping_type const& m)
+		: m_acc()
+		, m_map(m)	// [mdspan.mdspan.cons]/14
+		, m_ptr(hamon::move(p))
+	{}
+
+	HAMON_CXX11_CONSTEXPR
+	mdspan(data_handle_type p, mapping_type const& m, accessor_type const& a)
+		: m_acc(a)
+		, m_map(m)	// [mdspan.mdspan.cons]/16
+		, m_ptr(hamon::move(p))
+	{}
+
+#if defined(HAMON_HAS_CXX20_CONDITIONAL_EXPLICIT)
+	template <typename OtherElementType, typename OtherExtents,
+		typename OtherLayoutPolicy, typename OtherAccessor,
+		typename Other = mdspan<OtherElementType, OtherExtents, OtherLayoutPolicy, OtherAccessor>,
+		typename = hamon::enable_if_t<
+			hamon::is_constructible<mapping_type, typename Other::mapping_type const&>::value &&	// [mdspan.mdspan.cons]/17.1
+			hamon::is_constructible<accessor_type, OtherAccessor const&>::value>>					// [mdspan.mdspan.cons]/17.2
+	HAMON_CXX11_CONSTEXPR
+	explicit(hamon::detail::is_mdspan_conversion_explicit<Other, mdspan>::value)
+	mdspan(mdspan<OtherElementType, OtherExtents, OtherLayoutPolicy, OtherAccessor> const& other)
+		: m_acc(other.accessor())
+		, m_map(other.mapping())	// [mdspan.mdspan.cons]/21
+		, m_ptr(other.data_handle())
+	{
+		// [mdspan.mdspan.cons]/18
+		static_assert(hamon::is_constructible<data_handle_type, typename OtherAccessor::data_handle_type const&>::value, "");
+		static_assert(hamon::is_constructible<extents_type, OtherExtents>::value, "");
+	}
+#else
+	template <typename OtherElementType, typename OtherExtents,
+		typename OtherLayoutPolicy, typename OtherAccessor,
+		typename Other = mdspan<OtherElementType, OtherExtents, OtherLayoutPolicy, OtherAccessor>,
+		typename = hamon::enable_if_t<
+			hamon::is_constructible<mapping_type, typename Other::mapping_type const&>::value &&	// [mdspan.mdspan.cons]/17.1
+			hamon::is_constructible<accessor_type, OtherAccessor const&>::value>,					// [mdspan.mdspan.cons]/17.2
+		hamon::enable_if_t<hamon::detail::is_mdspan_conversion_explicit<Other, mdspan>::value>* = nullptr>
+	HAMON_CXX11_CONSTEXPR explicit
+	mdspan(mdspan<OtherElementType, OtherExtents, OtherLayoutPolicy, OtherAccessor> const& other)
+		: m_acc(other.accessor())
+		, m_map(other.mapping())	// [mdspan.mdspan.cons]/21
+		, m_ptr(other.data_handle())
+	{
+		// [mdspan.mdspan.cons]/18
+		static_assert(hamon::is_constructible<data_handle_type, typename OtherAccessor::data_handle_type const&>::value, "");
+		static_assert(hamon::is_constructible<extents_type, OtherExtents>::value, "");
+	}
+
+	template <typename OtherElementType, typename OtherExtents,
+		typename OtherLayoutPolicy, typename OtherAccessor,
+		typename Other = mdspan<OtherElementType, OtherExtents, OtherLayoutPolicy, OtherAccessor>,
+		typename = hamon::enable_if_t<
+			hamon::is_constructible<mapping_type, typename Other::mapping_type const&>::value &&	// [mdspan.mdspan.cons]/17.1
+			hamon::is_constructible<accessor_type, OtherAccessor const&>::value>,					// [mdspan.mdspan.cons]/17.2
+		hamon::enable_if_t<!hamon::detail::is_mdspan_conversion_explicit<Other, mdspan>::value>* = nullptr>
+	HAMON_CXX11_CONSTEXPR
+	mdspan(mdspan<OtherElementType, OtherExtents, OtherLayoutPolicy, OtherAccessor> const& other)
+		: m_acc(other.accessor())
+		, m_map(other.mapping())	// [mdspan.mdspan.cons]/21
+		, m_ptr(other.data_handle())
+	{
+		// [mdspan.mdspan.cons]/18
+		static_assert(hamon::is_constructible<data_handle_type, typename OtherAccessor::data_handle_type const&>::value, "");
+		static_assert(hamon::is_constructible<extents_type, OtherExtents>::value, "");
+	}
+#endif
+
+	HAMON_CXX14_CONSTEXPR mdspan& operator=(mdspan const&) = default;
+	HAMON_CXX14_CONSTEXPR mdspan& operator=(mdspan&&) = default;
+
+	// [mdspan.mdspan.members], members
+#if defined(HAMON_HAS_CXX23_MULTIDIMENSIONAL_SUBSCRIPT)
+	template <typename... OtherIndexTypes,
+		typename = hamon::enable_if_t<
+			is_indices<OtherIndexTypes...>::value &&		// [mdspan.mdspan.members]/1.1, 1.2
+			sizeof...(OtherIndexTypes) == rank()>>		// [mdspan.mdspan.members]/1.3
+	HAMON_CXX11_CONSTEXPR reference
+	operator[](OtherIndexTypes... indices) const
+	{
+		return access_impl(static_cast<index_type>(hamon::move(indices))...);
+	}
+#else
+	// 多次元添字演算子が使えない環境では、
+	// 1次元の場合のみ operator[] を提供し、
+	// 多次元の場合は代わりに operator() で要素にアクセスする。
+	template <typename OtherIndexType,
+		typename = hamon::enable_if_t<
+			is_indices<OtherIndexType>::value &&
+			1 == rank()>>
+	HAMON_CXX11_CONSTEXPR reference
+	operator[](OtherIndexType index) const
+	{
+		return access_impl(static_cast<index_type>(hamon::move(index)));
+	}
+
+	template <typename... OtherIndexTypes,
+		typename = hamon::enable_if_t<
+			is_indices<OtherIndexTypes...>::value &&
+			sizeof...(OtherIndexTypes) == rank()>>
+	HAMON_CXX11_CONSTEXPR reference
+	operator()(OtherIndexTypes... indices) const
+	{
+		return access_impl(static_cast<index_type>(hamon::move(indices))...);
+	}
+#endif
+
+	template <typename OtherIndexType,
+		typename = hamon::enable_if_t<
+			hamon::detail::is_index_convertible<OtherIndexType const&, index_type>::value>>	// [mdspan.mdspan.members]/4
+	HAMON_CXX11_CONSTEXPR reference
+	operator[](hamon::span<OtherIndexType, extents_type::rank()> indices) const
+	{
+		return access_array(indices, hamon::make_index_sequence<rank()>{});
+	}
+
+	template <typename OtherIndexType,
+		typename = hamon::enable_if_t<
+			hamon::detail::is_index_convertible<OtherIndexType const&, index_type>::value>>	// [mdspan.mdspan.members]/4
+	HAMON_CXX11_CONSTEXPR reference
+	operator[](hamon::array<OtherIndexType, extents_type::rank()> const& indices) const
+	{
+		return access_array(indices, hamon::make_index_sequence<rank()>{});
+	}
+
+	HAMON_CXX11_CONSTEXPR size_type
+	size() const HAMON_NOEXCEPT
+	{
+		// [mdspan.mdspan.members]/7
+		return static_cast<size_type>(hamon::detail::fwd_prod_of_extents(extents(), rank()));
+	}
+
+	HAMON_NODISCARD HAMON_CXX11_CONSTEXPR bool
+	empty() const HAMON_NOEXCEPT
+	{
+		// [mdspan.mdspan.members]/8
+		return empty_impl(0);
+	}
+
+	friend HAMON_CXX14_CONSTEXPR void
+	swap(mdspan& x, mdspan& y) HAMON_NOEXCEPT
+	{
+		// [mdspan.mdspan.members]/9
+		hamon::swap(x.m_ptr, y.m_ptr);
+		hamon::swap(x.m_map, y.m_map);
+		hamon::swap(x.m_acc, y.m_acc);
+	}
+
+	HAMON_CXX11_CONSTEXPR extents_type const& extents() const HAMON_NOEXCEPT { return m_map.extents(); }
+	HAMON_CXX11_CONSTEXPR data_handle_type const& data_handle() const HAMON_NOEXCEPT { return m_ptr; }
+	HAMON_CXX11_CONSTEXPR mapping_type const& mapping() const HAMON_NOEXCEPT { return m_map; }
+	HAMON_CXX11_CONSTEXPR accessor_type const& accessor() const HAMON_NOEXCEPT { return m_acc; }
+
+	static HAMON_CXX11_CONSTEXPR bool is_always_unique() { return mapping_type::is_always_unique(); }
+	static HAMON_CXX11_CONSTEXPR bool is_always_exhaustive() { return mapping_type::is_always_exhaustive(); }
+	static HAMON_CXX11_CONSTEXPR bool is_always_strided() { return mapping_type::is_always_strided(); }
+
+	HAMON_CXX11_CONSTEXPR bool is_unique() const { return m_map.is_unique(); }
+	HAMON_CXX11_CONSTEXPR bool is_exhaustive() const { return m_map.is_exhaustive(); }
+	HAMON_CXX11_CONSTEXPR bool is_strided() const { return m_map.is_strided(); }
+	HAMON_CXX11_CONSTEXPR index_type stride(rank_type r) const { return m_map.stride(r); }
+
+private:
+	HAMON_NO_UNIQUE_ADDRESS accessor_type	m_acc;
+	HAMON_NO_UNIQUE_ADDRESS mapping_type	m_map;
+	data_handle_type						m_ptr;
+};
+
+#if defined(HAMON_HAS_CXX17_DEDUCTION_GUIDES)
+
+// [mdspan.mdspan.overview]
+
+template <typename CArray,
+	typename = hamon::enable_if_t<
+		hamon::is_array<CArray>::value && hamon::rank<CArray>::value == 1>>
+mdspan(CArray&)
+-> mdspan<hamon::remove_all_extents_t<CArray>, hamon::extents<hamon::size_t, hamon::extent<CArray, 0>::value>>;
+
+template <typename Pointer,
+	typename = hamon::enable_if_t<
+		hamon::is_pointer<hamon::remove_reference_t<Pointer>>::value>>
+mdspan(Pointer&&)
+-> mdspan<hamon::remove_pointer_t<hamon::remove_reference_t<Pointer>>, hamon::extents<hamon::size_t>>;
+
+template <typename ElementType, typename... Integrals,
+	typename = hamon::enable_if_t<
+		hamon::conjunction<hamon::is_convertible<Integrals, hamon::size_t>...>::value &&
+		(sizeof...(Integrals) > 0)>>
+explicit mdspan(ElementType*, Integrals...)
+-> mdspan<ElementType, hamon::extents<hamon::size_t, hamon::detail::maybe_static_ext<Integrals>::value...>>;
+
+template <typename ElementType, typename OtherIndexType, hamon::size_t N>
+mdspan(ElementType*, hamon::span<OtherIndexType, N>)
+-> mdspan<ElementType, hamon::dextents<hamon::size_t, N>>;
+
+template <typename ElementType, typename OtherIndexType, hamon::size_t N>
+mdspan(ElementType*, hamon::array<OtherIndexType, N> const&)
+-> mdspan<ElementType, hamon::dextents<hamon::size_t, N>>;
+
+template <typename ElementType, typename IndexType, hamon::size_t... ExtentsPack>
+mdspan(ElementType*, hamon::extents<IndexType, ExtentsPack...> const&)
+-> mdspan<ElementType, hamon::extents<IndexType, ExtentsPack...>>;
+
+template <typename ElementType, typename MappingType>
+mdspan(ElementType*, MappingType const&)
+-> mdspan<ElementType, typename MappingType::extents_type, typename MappingType::layout_type>;
+
+template <typename MappingType, typename AccessorType>
+mdspan(typename AccessorType::data_handle_type const&, MappingType const&, AccessorType const&)
+-> mdspan<typename AccessorType::element_type, typename MappingType::extents_type,
+	typename MappingType::layout_type, AccessorType>;
+
+#endif
+
+}	// namespace hamon
+
+#endif
+
+#endif // HAMON_MDSPAN_MDSPAN_HPP
@@ -0,0 +1,92 @@
+﻿/**
+ *	@file	mdspan_fwd.hpp
+ *
+ *	@brief	mdspan の前方宣言
+ */
+
+#ifndef HAMON_MDSPAN_MDSPAN_FWD_HPP
+#define HAMON_MDSPAN_MDSPAN_FWD_HPP
+
+#include <hamon/mdspan/config.hpp>
+
+#if defined(HAMON_USE_STD_MDSPAN)
+
+namespace hamon
+{
+
+using std::extents;
+using std::layout_left;
+using std::layout_right;
+using std::layout_stride;
+using std::layout_left_padded;
+using std::layout_right_padded;
+using std::default_accessor;
+using std::aligned_accessor;
+using std::mdspan;
+
+}	// namespace hamon
+
+#else
+
+#include <hamon/span/dynamic_extent.hpp>
+#include <hamon/cstddef/size_t.hpp>
+
+namespace hamon
+{
+
+// [mdspan.extents], class template extents
+template <typename IndexType, hamon::size_t... Extents>
+class extents;
+
+// [mdspan.layout], layout mapping
+struct layout_left
+{
+	template <typename Extents>
+	class mapping;
+};
+
+struct layout_right
+{
+	template <typename Extents>
+	class mapping;
+};
+
+struct layout_stride
+{
+	template <typename Extents>
+	class mapping;
+};
+
+template <hamon::size_t PaddingValue = hamon::dynamic_extent>
+struct layout_left_padded
+{
+	template <typename Extents>
+	class mapping;
+};
+
+template <hamon::size_t PaddingValue = hamon::dynamic_extent>
+struct layout_right_padded
+{
+	template <typename Extents>
+	class mapping;
+};
+
+// [mdspan.accessor.default], class template default_accessor
+template <typename ElementType>
+struct default_accessor;
+
+// [mdspan.accessor.aligned], class template aligned_accessor
+template <typename ElementType, hamon::size_t ByteAlignment>
+struct aligned_accessor;
+
+// [mdspan.mdspan], class template mdspan
+template <typename ElementType, typename Extents,
+	typename LayoutPolicy = hamon::layout_right,
+	typename AccessorPolicy = hamon::default_accessor<ElementType>>
+class mdspan;
+
+}	// namespace hamon
+
+#endif
+
+#endif // HAMON_MDSPAN_MDSPAN_FWD_HPP
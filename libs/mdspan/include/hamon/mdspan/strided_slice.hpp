@@ -0,0 +1,71 @@
+﻿/**
+ *	@file	strided_slice.hpp
+ *
+ *	@brief	strided_slice の定義
+ */
+
+#ifndef HAMON_MDSPAN_STRIDED_SLICE_HPP
+#define HAMON_MDSPAN_STRIDED_SLICE_HPP
+
+#include <hamon/mdspan/config.hpp>
+
+#if defined(HAMON_USE_STD_MDSPAN)
+
+namespace hamon
+{
+
+using std::strided_slice;
+
+}	// namespace hamon
+
+#else
+
+#include <hamon/mdspan/detail/is_integral_constant_like.hpp>
+#include <hamon/type_traits/bool_constant.hpp>
+#include <hamon/type_traits/is_integral.hpp>
+#include <hamon/type_traits/is_same.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+namespace detail
+{
+
+// [mdspan.sub.strided.slice]/3
+template <typename T>
+struct is_strided_slice_index_type
+	: public hamon::bool_constant<
+		(hamon::is_integral<T>::value && !hamon::is_same<T, bool>::value) ||
+		hamon::detail::is_integral_constant_like<T>::value
+	>
+{};
+
+}	// namespace detail
+
+// [mdspan.sub.strided.slice]
+// offset から始まる extent 個の範囲のうち、stride 毎の要素を選択するスライス指定子
+template <typename OffsetType, typename ExtentType, typename StrideType>
+struct strided_slice
+{
+	// [mdspan.sub.strided.slice]/3
+	static_assert(hamon::detail::is_strided_slice_index_type<OffsetType>::value, "");
+	static_assert(hamon::detail::is_strided_slice_index_type<ExtentType>::value, "");
+	static_assert(hamon::detail::is_strided_slice_index_type<StrideType>::value, "");
+
+	using offset_type = OffsetType;
+	using extent_type = ExtentType;
+	using stride_type = StrideType;
+
+	// C++11 で集成体にするため、デフォルトメンバ初期化子は書かない。
+	// strided_slice<...>{} のように値初期化すれば各メンバは 0 になる。
+	HAMON_NO_UNIQUE_ADDRESS offset_type	offset;
+	HAMON_NO_UNIQUE_ADDRESS extent_type	extent;
+	HAMON_NO_UNIQUE_ADDRESS stride_type	stride;
+};
+
+}	// namespace hamon
+
+#endif
+
+#endif // HAMON_MDSPAN_STRIDED_SLICE_HPP
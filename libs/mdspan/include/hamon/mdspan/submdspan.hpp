@@ -0,0 +1,88 @@
+﻿/**
+ *	@file	submdspan.hpp
+ *
+ *	@brief	submdspan の定義
+ */
+
+#ifndef HAMON_MDSPAN_SUBMDSPAN_HPP
+#define HAMON_MDSPAN_SUBMDSPAN_HPP
+
+#include <hamon/mdspan/config.hpp>
+
+#if defined(HAMON_USE_STD_MDSPAN)
+
+namespace hamon
+{
+
+using std::submdspan;
+
+}	// namespace hamon
+
+#else
+
+#include <hamon/mdspan/mdspan.hpp>
+#include <hamon/mdspan/submdspan_mapping.hpp>
+#include <hamon/utility/declval.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+namespace detail
+{
+
+template <typename MDSpan, typename... SliceSpecifiers>
+struct submdspan_type
+{
+	using mapping_result = decltype(submdspan_mapping(
+		hamon::declval<typename MDSpan::mapping_type const&>(),
+		hamon::declval<SliceSpecifiers>()...));
+	using mapping_type = decltype(hamon::declval<mapping_result>().mapping);
+	using accessor_type = typename MDSpan::accessor_type::offset_policy;
+
+	using type = hamon::mdspan<
+		typename accessor_type::element_type,
+		typename mapping_type::extents_type,
+		typename mapping_type::layout_type,
+		accessor_type>;
+};
+
+template <typename SubMDSpan, typename MDSpan, typename MappingResult>
+HAMON_CXX11_CONSTEXPR SubMDSpan
+make_submdspan(MDSpan const& src, MappingResult const& sub_map_offset)
+{
+	// [mdspan.sub.sub]/5
+	return SubMDSpan(
+		src.accessor().offset(src.data_handle(), sub_map_offset.offset),
+		sub_map_offset.mapping,
+		typename SubMDSpan::accessor_type(src.accessor()));
+}
+
+}	// namespace detail
+
+// [mdspan.sub.sub]
+template <typename ElementType, typename Extents, typename LayoutPolicy,
+	typename AccessorPolicy, typename... SliceSpecifiers>
+HAMON_CXX11_CONSTEXPR auto
+submdspan(
+	hamon::mdspan<ElementType, Extents, LayoutPolicy, AccessorPolicy> const& src,
+	SliceSpecifiers... slices)
+-> typename hamon::detail::submdspan_type<
+	hamon::mdspan<ElementType, Extents, LayoutPolicy, AccessorPolicy>, SliceSpecifiers...>::type
+{
+	// [mdspan.sub.sub]/2
+	static_assert(sizeof...(SliceSpecifiers) == Extents::rank(), "");
+
+	using result_type = typename hamon::detail::submdspan_type<
+		hamon::mdspan<ElementType, Extents, LayoutPolicy, AccessorPolicy>, SliceSpecifiers...>::type;
+
+	// submdspan_mapping は ADL で探す
+	return hamon::detail::make_submdspan<result_type>(
+		src, submdspan_mapping(src.mapping(), slices...));
+}
+
+}	// namespace hamon
+
+#endif
+
+#endif // HAMON_MDSPAN_SUBMDSPAN_HPP
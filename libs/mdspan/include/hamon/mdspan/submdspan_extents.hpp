@@ -0,0 +1,164 @@
+﻿/**
+ *	@file	submdspan_extents.hpp
+ *
+ *	@brief	submdspan_extents の定義
+ */
+
+#ifndef HAMON_MDSPAN_SUBMDSPAN_EXTENTS_HPP
+#define HAMON_MDSPAN_SUBMDSPAN_EXTENTS_HPP
+
+#include <hamon/mdspan/config.hpp>
+
+#if defined(HAMON_USE_STD_MDSPAN)
+
+namespace hamon
+{
+
+using std::submdspan_extents;
+
+}	// namespace hamon
+
+#else
+
+#include <hamon/mdspan/extents.hpp>
+#include <hamon/mdspan/detail/is_multidimensional_index_in.hpp>
+#include <hamon/mdspan/detail/submdspan_slice.hpp>
+#include <hamon/array/array.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/type_traits/conditional.hpp>
+#include <hamon/type_traits/is_signed.hpp>
+#include <hamon/utility/index_sequence.hpp>
+#include <hamon/utility/make_index_sequence.hpp>
+#include <hamon/assert.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+namespace detail
+{
+
+// [mdspan.sub.extents]/4
+// 部分mdspanの extents の型と、部分mdspanの各次元が元のどの次元に対応するか
+template <typename Extents, hamon::size_t K, typename SubExtents, typename SrcRanks, typename... Slices>
+struct submdspan_extents_type_impl;
+
+template <typename Extents, hamon::size_t K, typename IndexType, hamon::size_t... Es, hamon::size_t... Rs>
+struct submdspan_extents_type_impl<Extents, K,
+	hamon::extents<IndexType, Es...>, hamon::index_sequence<Rs...>>
+{
+	using type = hamon::extents<IndexType, Es...>;
+	using src_ranks = hamon::index_sequence<Rs...>;
+};
+
+template <typename Extents, hamon::size_t K, typename IndexType, hamon::size_t... Es, hamon::size_t... Rs,
+	typename S, typename... Rest>
+struct submdspan_extents_type_impl<Extents, K,
+	hamon::extents<IndexType, Es...>, hamon::index_sequence<Rs...>, S, Rest...>
+	: public hamon::conditional_t<
+		submdspan_slice_kind_of<IndexType, S>::value == submdspan_slice_kind::index,
+		// インデックスが指定された次元は取り除かれる
+		submdspan_extents_type_impl<Extents, K + 1,
+			hamon::extents<IndexType, Es...>,
+			hamon::index_sequence<Rs...>, Rest...>,
+		submdspan_extents_type_impl<Extents, K + 1,
+			hamon::extents<IndexType, Es..., submdspan_static_sub_extent<Extents, K, S>::value>,
+			hamon::index_sequence<Rs..., K>, Rest...>
+	>
+{};
+
+template <typename Extents, typename... Slices>
+struct submdspan_extents_type
+	: public submdspan_extents_type_impl<Extents, 0,
+		hamon::extents<typename Extents::index_type>, hamon::index_sequence<>, Slices...>
+{
+	static_assert(sizeof...(Slices) == Extents::rank(), "");	// [mdspan.sub.extents]/1
+};
+
+// [mdspan.sub.extents]/3
+template <typename IndexType>
+HAMON_CXX11_CONSTEXPR bool
+is_valid_submdspan_range(IndexType first, IndexType last, IndexType extent)
+{
+	return
+		hamon::detail::is_non_negative_index(first, hamon::is_signed<IndexType>{}) &&
+		first <= last &&
+		last <= extent;
+}
+
+template <typename IndexType, typename S>
+HAMON_CXX11_CONSTEXPR bool
+is_valid_submdspan_stride(S const& s, submdspan_slice_kind_tag<submdspan_slice_kind::strided>)
+{
+	return static_cast<IndexType>(s.extent) == 0 || static_cast<IndexType>(s.stride) > 0;
+}
+
+template <typename IndexType, typename S, submdspan_slice_kind K>
+HAMON_CXX11_CONSTEXPR bool
+is_valid_submdspan_stride(S const&, submdspan_slice_kind_tag<K>)
+{
+	return true;
+}
+
+template <typename Extents>
+HAMON_CXX11_CONSTEXPR bool
+is_valid_submdspan_slices(Extents const&, hamon::size_t)
+{
+	return true;
+}
+
+template <typename Extents, typename S, typename... Rest>
+HAMON_CXX11_CONSTEXPR bool
+is_valid_submdspan_slices(Extents const& src, hamon::size_t k, S const& s, Rest const&... rest)
+{
+	using index_type = typename Extents::index_type;
+	return
+		hamon::detail::is_valid_submdspan_range(
+			hamon::detail::submdspan_first<index_type>(s),
+			hamon::detail::submdspan_last(s, src.extent(k)),
+			src.extent(k)) &&
+		hamon::detail::is_valid_submdspan_stride<index_type>(
+			s, hamon::detail::submdspan_slice_kind_of<index_type, S>{}) &&
+		hamon::detail::is_valid_submdspan_slices(src, k + 1, rest...);
+}
+
+template <typename SubExtents, typename Array, hamon::size_t... Rs>
+HAMON_CXX11_CONSTEXPR SubExtents
+make_submdspan_extents(Array const& sub_extents, hamon::index_sequence<Rs...>)
+{
+	return SubExtents(sub_extents[Rs]...);
+}
+
+template <typename Extents, typename... Slices, hamon::size_t... Is>
+HAMON_CXX11_CONSTEXPR typename submdspan_extents_type<Extents, Slices...>::type
+submdspan_extents_impl(hamon::index_sequence<Is...>, Extents const& src, Slices const&... slices)
+{
+	using index_type = typename Extents::index_type;
+	using traits = submdspan_extents_type<Extents, Slices...>;
+	using array_type = hamon::array<index_type, sizeof...(Slices)>;
+	return
+		HAMON_ASSERT(hamon::detail::is_valid_submdspan_slices(src, 0, slices...)),	// [mdspan.sub.extents]/3
+		// 元の各次元について部分mdspanでの要素数を求め、取り除かれない次元だけを取り出す
+		make_submdspan_extents<typename traits::type>(
+			array_type{{hamon::detail::submdspan_sub_extent(slices, src.extent(Is))...}},
+			typename traits::src_ranks{});
+}
+
+}	// namespace detail
+
+// [mdspan.sub.extents]
+template <typename IndexType, hamon::size_t... Extents, typename... SliceSpecifiers>
+HAMON_CXX11_CONSTEXPR auto
+submdspan_extents(hamon::extents<IndexType, Extents...> const& src, SliceSpecifiers... slices)
+-> typename hamon::detail::submdspan_extents_type<
+	hamon::extents<IndexType, Extents...>, SliceSpecifiers...>::type
+{
+	return hamon::detail::submdspan_extents_impl(
+		hamon::make_index_sequence<sizeof...(SliceSpecifiers)>{}, src, slices...);
+}
+
+}	// namespace hamon
+
+#endif
+
+#endif // HAMON_MDSPAN_SUBMDSPAN_EXTENTS_HPP
@@ -0,0 +1,206 @@
+﻿/**
+ *	@file	submdspan_mapping.hpp
+ *
+ *	@brief	submdspan_mapping の定義
+ */
+
+#ifndef HAMON_MDSPAN_SUBMDSPAN_MAPPING_HPP
+#define HAMON_MDSPAN_SUBMDSPAN_MAPPING_HPP
+
+#include <hamon/mdspan/config.hpp>
+
+#if !defined(HAMON_USE_STD_MDSPAN)
+
+#include <hamon/mdspan/layout_left.hpp>
+#include <hamon/mdspan/layout_right.hpp>
+#include <hamon/mdspan/layout_stride.hpp>
+#include <hamon/mdspan/layout_left_padded.hpp>
+#include <hamon/mdspan/layout_right_padded.hpp>
+#include <hamon/mdspan/submdspan_extents.hpp>
+#include <hamon/mdspan/submdspan_mapping_result.hpp>
+#include <hamon/mdspan/detail/is_layout_left_padded_mapping_of.hpp>
+#include <hamon/mdspan/detail/is_layout_right_padded_mapping_of.hpp>
+#include <hamon/mdspan/detail/is_mapping_of.hpp>
+#include <hamon/mdspan/detail/submdspan_slice.hpp>
+#include <hamon/array/array.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/type_traits/bool_constant.hpp>
+#include <hamon/type_traits/conditional.hpp>
+#include <hamon/type_traits/enable_if.hpp>
+#include <hamon/type_traits/is_same.hpp>
+#include <hamon/utility/index_sequence.hpp>
+#include <hamon/utility/make_index_sequence.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+namespace detail
+{
+
+// [mdspan.sub.map.left]/1.2
+// 先頭の SubRank-1 個が full_extent_t で、SubRank 番目が単位ストライドの範囲、残りがインデックス
+template <typename IndexType, hamon::size_t SubRank, hamon::size_t K, typename... Slices>
+struct is_layout_left_preserving_slices
+	: public hamon::true_type {};
+
+template <typename IndexType, hamon::size_t SubRank, hamon::size_t K, typename S, typename... Rest>
+struct is_layout_left_preserving_slices<IndexType, SubRank, K, S, Rest...>
+	: public hamon::bool_constant<
+		(K + 1 < SubRank ?
+			submdspan_slice_kind_of<IndexType, S>::value == submdspan_slice_kind::full :
+		 K + 1 == SubRank ?
+			is_submdspan_unit_stride_slice<IndexType, S>::value :
+			submdspan_slice_kind_of<IndexType, S>::value == submdspan_slice_kind::index) &&
+		is_layout_left_preserving_slices<IndexType, SubRank, K + 1, Rest...>::value
+	>
+{};
+
+// [mdspan.sub.map.right]/1.2
+// 末尾の SubRank-1 個が full_extent_t で、その前が単位ストライドの範囲、残りがインデックス
+template <typename IndexType, hamon::size_t SubRank, hamon::size_t Rank, hamon::size_t K, typename... Slices>
+struct is_layout_right_preserving_slices
+	: public hamon::true_type {};
+
+template <typename IndexType, hamon::size_t SubRank, hamon::size_t Rank, hamon::size_t K, typename S, typename... Rest>
+struct is_layout_right_preserving_slices<IndexType, SubRank, Rank, K, S, Rest...>
+	: public hamon::bool_constant<
+		(K + SubRank < Rank ?
+			submdspan_slice_kind_of<IndexType, S>::value == submdspan_slice_kind::index :
+		 K + SubRank == Rank ?
+			is_submdspan_unit_stride_slice<IndexType, S>::value :
+			submdspan_slice_kind_of<IndexType, S>::value == submdspan_slice_kind::full) &&
+		is_layout_right_preserving_slices<IndexType, SubRank, Rank, K + 1, Rest...>::value
+	>
+{};
+
+// 部分mdspanのマッピングの型
+// layout_left と layout_right は、スライスの形によって同じレイアウトを保つ。
+// それ以外は layout_stride になる。
+// (C++26 では layout_left_padded 等になる場合もあるが、ここでは layout_stride で表す)
+template <typename Layout, typename Extents, typename... Slices>
+struct submdspan_mapping_type
+{
+	using sub_extents_type = typename submdspan_extents_type<Extents, Slices...>::type;
+	using type = hamon::layout_stride::mapping<sub_extents_type>;
+};
+
+template <typename Extents, typename... Slices>
+struct submdspan_mapping_type<hamon::layout_left, Extents, Slices...>
+{
+	using sub_extents_type = typename submdspan_extents_type<Extents, Slices...>::type;
+	using type = hamon::conditional_t<
+		is_layout_left_preserving_slices<
+			typename Extents::index_type, sub_extents_type::rank(), 0, Slices...>::value,
+		hamon::layout_left::mapping<sub_extents_type>,
+		hamon::layout_stride::mapping<sub_extents_type>
+	>;
+};
+
+template <typename Extents, typename... Slices>
+struct submdspan_mapping_type<hamon::layout_right, Extents, Slices...>
+{
+	using sub_extents_type = typename submdspan_extents_type<Extents, Slices...>::type;
+	using type = hamon::conditional_t<
+		is_layout_right_preserving_slices<
+			typename Extents::index_type, sub_extents_type::rank(), Extents::rank(), 0, Slices...>::value,
+		hamon::layout_right::mapping<sub_extents_type>,
+		hamon::layout_stride::mapping<sub_extents_type>
+	>;
+};
+
+template <typename Mapping>
+struct is_submdspan_mapping_supported
+	: public hamon::bool_constant<
+		hamon::detail::is_mapping_of<hamon::layout_left, Mapping>::value ||
+		hamon::detail::is_mapping_of<hamon::layout_right, Mapping>::value ||
+		hamon::detail::is_mapping_of<hamon::layout_stride, Mapping>::value ||
+		hamon::detail::is_layout_left_padded_mapping_of<Mapping>::value ||
+		hamon::detail::is_layout_right_padded_mapping_of<Mapping>::value
+	>
+{};
+
+template <typename IndexType>
+HAMON_CXX11_CONSTEXPR IndexType
+submdspan_offset_sum(IndexType acc)
+{
+	return acc;
+}
+
+template <typename IndexType, typename... Rest>
+HAMON_CXX11_CONSTEXPR IndexType
+submdspan_offset_sum(IndexType acc, IndexType x, Rest... rest)
+{
+	return hamon::detail::submdspan_offset_sum(static_cast<IndexType>(acc + x), rest...);
+}
+
+// layout_left, layout_right
+template <typename SubMapping, typename SubExtents, typename Strides, hamon::size_t... Rs>
+HAMON_CXX11_CONSTEXPR SubMapping
+make_submdspan_mapping(SubExtents const& sub_ext, Strides const&, hamon::index_sequence<Rs...>, hamon::false_type)
+{
+	return SubMapping(sub_ext);
+}
+
+// layout_stride
+template <typename SubMapping, typename SubExtents, typename Strides, hamon::size_t... Rs>
+HAMON_CXX11_CONSTEXPR SubMapping
+make_submdspan_mapping(SubExtents const& sub_ext, Strides const& strides, hamon::index_sequence<Rs...>, hamon::true_type)
+{
+	// [mdspan.sub.map.common]/5
+	return SubMapping(sub_ext,
+		hamon::array<typename SubExtents::index_type, sizeof...(Rs)>{{strides[Rs]...}});
+}
+
+template <typename Mapping, typename... Slices, hamon::size_t... Is>
+HAMON_CXX11_CONSTEXPR
+submdspan_mapping_result<
+	typename submdspan_mapping_type<typename Mapping::layout_type, typename Mapping::extents_type, Slices...>::type>
+submdspan_mapping_impl(hamon::index_sequence<Is...>, Mapping const& src, Slices const&... slices)
+{
+	using index_type = typename Mapping::index_type;
+	using extents_type = typename Mapping::extents_type;
+	using sub_mapping_type = typename submdspan_mapping_type<
+		typename Mapping::layout_type, extents_type, Slices...>::type;
+	using array_type = hamon::array<index_type, sizeof...(Slices)>;
+
+	return {
+		hamon::detail::make_submdspan_mapping<sub_mapping_type>(
+			hamon::submdspan_extents(src.extents(), slices...),
+			// 元の各次元について、部分mdspanでのストライド
+			array_type{{static_cast<index_type>(
+				src.stride(Is) * hamon::detail::submdspan_stride_factor<index_type>(slices))...}},
+			typename submdspan_extents_type<extents_type, Slices...>::src_ranks{},
+			hamon::is_same<typename sub_mapping_type::layout_type, hamon::layout_stride>{}),
+		// [mdspan.sub.map.common]/8
+		// first_0 * stride(0) + first_1 * stride(1) + ...
+		static_cast<hamon::size_t>(hamon::detail::submdspan_offset_sum(index_type(0),
+			static_cast<index_type>(
+				hamon::detail::submdspan_first<index_type>(slices) * src.stride(Is))...))
+	};
+}
+
+}	// namespace detail
+
+// [mdspan.sub.map]
+// layout_left, layout_right, layout_stride, layout_left_padded, layout_right_padded の
+// マッピングに対する submdspan_mapping。
+// 標準ではそれぞれのマッピングの hidden friend として定義されるが、
+// ここでは名前空間スコープの関数として定義する。(ADL で見つかる点は同じ)
+template <typename Mapping, typename... SliceSpecifiers,
+	typename = hamon::enable_if_t<
+		hamon::detail::is_submdspan_mapping_supported<Mapping>::value>>
+HAMON_CXX11_CONSTEXPR auto
+submdspan_mapping(Mapping const& src, SliceSpecifiers... slices)
+-> submdspan_mapping_result<typename hamon::detail::submdspan_mapping_type<
+	typename Mapping::layout_type, typename Mapping::extents_type, SliceSpecifiers...>::type>
+{
+	return hamon::detail::submdspan_mapping_impl(
+		hamon::make_index_sequence<sizeof...(SliceSpecifiers)>{}, src, slices...);
+}
+
+}	// namespace hamon
+
+#endif
+
+#endif // HAMON_MDSPAN_SUBMDSPAN_MAPPING_HPP
@@ -0,0 +1,42 @@
+﻿/**
+ *	@file	submdspan_mapping_result.hpp
+ *
+ *	@brief	submdspan_mapping_result の定義
+ */
+
+#ifndef HAMON_MDSPAN_SUBMDSPAN_MAPPING_RESULT_HPP
+#define HAMON_MDSPAN_SUBMDSPAN_MAPPING_RESULT_HPP
+
+#include <hamon/mdspan/config.hpp>
+
+#if defined(HAMON_USE_STD_MDSPAN)
+
+namespace hamon
+{
+
+using std::submdspan_mapping_result;
+
+}	// namespace hamon
+
+#else
+
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+// [mdspan.sub.map.result]
+template <typename LayoutMapping>
+struct submdspan_mapping_result
+{
+	// C++11 で集成体にするため、デフォルトメンバ初期化子は書かない。
+	HAMON_NO_UNIQUE_ADDRESS LayoutMapping	mapping;
+	hamon::size_t							offset;
+};
+
+}	// namespace hamon
+
+#endif
+
+#endif // HAMON_MDSPAN_SUBMDSPAN_MAPPING_RESULT_HPP
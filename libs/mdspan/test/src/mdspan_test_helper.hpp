@@ -0,0 +1,29 @@
+﻿/**
+ *	@file	mdspan_test_helper.hpp
+ *
+ *	@brief
+ */
+
+#ifndef UNIT_TEST_MDSPAN_MDSPAN_TEST_HELPER_HPP
+#define UNIT_TEST_MDSPAN_MDSPAN_TEST_HELPER_HPP
+
+#include <hamon/config.hpp>
+
+namespace hamon_mdspan_test
+{
+
+// C++23 より前は多次元の operator[] が使えないので、operator() を使う
+template <typename MDSpan, typename... Indices>
+inline HAMON_CXX11_CONSTEXPR typename MDSpan::reference
+at(MDSpan const& m, Indices... i)
+{
+#if defined(HAMON_HAS_CXX23_MULTIDIMENSIONAL_SUBSCRIPT)
+	return m[i...];
+#else
+	return m(i...);
+#endif
+}
+
+}	// namespace hamon_mdspan_test
+
+#endif // UNIT_TEST_MDSPAN_MDSPAN_TEST_HELPER_HPP
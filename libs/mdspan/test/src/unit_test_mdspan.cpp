@@ -0,0 +1,7 @@
+﻿/**
+ *	@file	unit_test_mdspan.cpp
+ *
+ *	@brief	mdspan のテスト
+ */
+
+#include <hamon/mdspan.hpp>
@@ -0,0 +1,57 @@
+﻿/**
+ *	@file	unit_test_mdspan_aligned_accessor.cpp
+ *
+ *	@brief	aligned_accessor のテスト
+ */
+
+#include <hamon/mdspan/aligned_accessor.hpp>
+#include <hamon/mdspan/default_accessor.hpp>
+#include <hamon/mdspan/mdspan.hpp>
+#include <hamon/type_traits/is_constructible.hpp>
+#include <hamon/type_traits/is_convertible.hpp>
+#include <hamon/type_traits/is_same.hpp>
+#include <gtest/gtest.h>
+#include "mdspan_test_helper.hpp"
+
+namespace hamon_mdspan_test
+{
+
+namespace aligned_accessor_test
+{
+
+using A32 = hamon::aligned_accessor<float, 32>;
+using A16 = hamon::aligned_accessor<float, 16>;
+
+static_assert(A32::byte_alignment == 32, "");
+static_assert(hamon::is_same<A32::offset_policy, hamon::default_accessor<float>>::value, "");
+static_assert(hamon::is_same<A32::reference, float&>::value, "");
+static_assert( hamon::is_convertible<A32, A16>::value, "");
+static_assert(!hamon::is_convertible<A16, A32>::value, "");
+static_assert( hamon::is_convertible<A32, hamon::default_accessor<float>>::value, "");
+static_assert(!hamon::is_convertible<hamon::default_accessor<float>, A32>::value, "");
+static_assert( hamon::is_constructible<A32, hamon::default_accessor<float>>::value, "");
+static_assert( hamon::is_convertible<A32, hamon::aligned_accessor<float const, 32>>::value, "");
+
+GTEST_TEST(MDSpanTest, AlignedAccessorTest)
+{
+	alignas(32) float buf[16] = {};
+	for (int i = 0; i < 16; ++i)
+	{
+		buf[i] = static_cast<float>(i);
+	}
+
+	A32 acc;
+	EXPECT_EQ(5.0f, acc.access(buf, 5));
+	EXPECT_EQ(&buf[3], acc.offset(buf, 3));
+
+	hamon::mdspan<float, hamon::extents<int, 2, 8>, hamon::layout_right, A32> m(buf);
+	EXPECT_EQ(11.0f, at(m, 1, 3));
+
+	// default_accessor を使う mdspan へ変換できる
+	hamon::mdspan<float, hamon::extents<int, 2, 8>> d = m;
+	EXPECT_EQ(11.0f, at(d, 1, 3));
+}
+
+}	// namespace aligned_accessor_test
+
+}	// namespace hamon_mdspan_test
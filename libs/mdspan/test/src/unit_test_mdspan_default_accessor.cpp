@@ -0,0 +1,54 @@
+﻿/**
+ *	@file	unit_test_mdspan_default_accessor.cpp
+ *
+ *	@brief	default_accessor のテスト
+ */
+
+#include <hamon/mdspan/default_accessor.hpp>
+#include <hamon/type_traits/is_convertible.hpp>
+#include <hamon/type_traits/is_same.hpp>
+#include <gtest/gtest.h>
+#include "constexpr_test.hpp"
+
+namespace hamon_mdspan_test
+{
+
+namespace default_accessor_test
+{
+
+using A = hamon::default_accessor<int>;
+using CA = hamon::default_accessor<int const>;
+
+static_assert(hamon::is_same<A::offset_policy, A>::value, "");
+static_assert(hamon::is_same<A::element_type, int>::value, "");
+static_assert(hamon::is_same<A::reference, int&>::value, "");
+static_assert(hamon::is_same<A::data_handle_type, int*>::value, "");
+static_assert( hamon::is_convertible<A, CA>::value, "");
+static_assert(!hamon::is_convertible<CA, A>::value, "");
+
+#define VERIFY(...)	if (!(__VA_ARGS__)) { return false; }
+
+inline HAMON_CXX14_CONSTEXPR bool
+test()
+{
+	int a[] = {1, 2, 3, 4};
+	A acc;
+	VERIFY(acc.access(a, 2) == 3);
+	VERIFY(acc.offset(a, 1) == &a[1]);
+	acc.access(a, 0) = 10;
+	VERIFY(a[0] == 10);
+	CA cacc = acc;
+	VERIFY(cacc.access(a, 3) == 4);
+	return true;
+}
+
+#undef VERIFY
+
+GTEST_TEST(MDSpanTest, DefaultAccessorTest)
+{
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(test());
+}
+
+}	// namespace default_accessor_test
+
+}	// namespace hamon_mdspan_test
@@ -0,0 +1,127 @@
+﻿/**
+ *	@file	unit_test_mdspan_extents.cpp
+ *
+ *	@brief	extents のテスト
+ */
+
+#include <hamon/mdspan/extents.hpp>
+#include <hamon/mdspan/dextents.hpp>
+#include <hamon/mdspan/dims.hpp>
+#include <hamon/array.hpp>
+#include <hamon/span.hpp>
+#include <hamon/type_traits/is_constructible.hpp>
+#include <hamon/type_traits/is_convertible.hpp>
+#include <hamon/type_traits/is_same.hpp>
+#include <gtest/gtest.h>
+#include "constexpr_test.hpp"
+
+namespace hamon_mdspan_test
+{
+
+namespace extents_test
+{
+
+using E0  = hamon::extents<int>;
+using E1  = hamon::extents<int, 3>;
+using E2  = hamon::extents<int, 3, hamon::dynamic_extent>;
+using E3  = hamon::extents<unsigned char, hamon::dynamic_extent, 4, hamon::dynamic_extent>;
+using D2  = hamon::dextents<int, 2>;
+
+static_assert(E0::rank() == 0, "");
+static_assert(E0::rank_dynamic() == 0, "");
+static_assert(E2::rank() == 2, "");
+static_assert(E2::rank_dynamic() == 1, "");
+static_assert(E3::rank() == 3, "");
+static_assert(E3::rank_dynamic() == 2, "");
+static_assert(E2::static_extent(0) == 3, "");
+static_assert(E2::static_extent(1) == hamon::dynamic_extent, "");
+static_assert(hamon::is_same<E2::index_type, int>::value, "");
+static_assert(hamon::is_same<E2::size_type, unsigned int>::value, "");
+static_assert(hamon::is_same<E2::rank_type, hamon::size_t>::value, "");
+static_assert(hamon::is_same<D2, hamon::extents<int, hamon::dynamic_extent, hamon::dynamic_extent>>::value, "");
+static_assert(hamon::is_same<hamon::dims<2>, hamon::dextents<hamon::size_t, 2>>::value, "");
+static_assert(hamon::is_same<hamon::dims<1, short>, hamon::dextents<short, 1>>::value, "");
+
+// [mdspan.extents.cons]
+static_assert( hamon::is_constructible<E2, int>::value, "");
+static_assert( hamon::is_constructible<E2, int, int>::value, "");
+static_assert(!hamon::is_constructible<E2, int, int, int>::value, "");
+static_assert( hamon::is_constructible<E2, hamon::array<int, 1>>::value, "");
+static_assert( hamon::is_constructible<E2, hamon::array<int, 2>>::value, "");
+static_assert(!hamon::is_constructible<E2, hamon::array<int, 3>>::value, "");
+static_assert( hamon::is_constructible<E2, hamon::span<int, 1>>::value, "");
+static_assert( hamon::is_convertible<E2, D2>::value, "");
+static_assert(!hamon::is_convertible<D2, E2>::value, "");
+static_assert( hamon::is_constructible<E2, D2>::value, "");
+static_assert(!hamon::is_constructible<E1, E2>::value, "");
+
+#define VERIFY(...)	if (!(__VA_ARGS__)) { return false; }
+
+inline HAMON_CXX14_CONSTEXPR bool
+test()
+{
+	{
+		E0 e;
+		VERIFY(e.rank() == 0);
+	}
+	{
+		E2 e;
+		VERIFY(e.extent(0) == 3);
+		VERIFY(e.extent(1) == 0);
+	}
+	{
+		E2 e(5);
+		VERIFY(e.extent(0) == 3);
+		VERIFY(e.extent(1) == 5);
+	}
+	{
+		E2 e(3, 5);
+		VERIFY(e.extent(0) == 3);
+		VERIFY(e.extent(1) == 5);
+	}
+	{
+		E3 e(hamon::array<int, 2>{{2, 7}});
+		VERIFY(e.extent(0) == 2);
+		VERIFY(e.extent(1) == 4);
+		VERIFY(e.extent(2) == 7);
+	}
+	{
+		int a[] = {2, 4, 7};
+		E3 e(hamon::span<int, 3>{a});
+		VERIFY(e.extent(0) == 2);
+		VERIFY(e.extent(1) == 4);
+		VERIFY(e.extent(2) == 7);
+	}
+	{
+		D2 d = E2(5);
+		VERIFY(d.extent(0) == 3);
+		VERIFY(d.extent(1) == 5);
+		E2 e(d);
+		VERIFY(e.extent(1) == 5);
+		VERIFY(d == e);
+		VERIFY(d != E2(6));
+		VERIFY(!(d == E1()));
+	}
+	return true;
+}
+
+#undef VERIFY
+
+GTEST_TEST(MDSpanTest, ExtentsTest)
+{
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(test());
+}
+
+#if defined(HAMON_HAS_CXX17_DEDUCTION_GUIDES)
+GTEST_TEST(MDSpanTest, ExtentsDeductionTest)
+{
+	hamon::extents e(2, 3);
+	static_assert(hamon::is_same<decltype(e), hamon::dextents<hamon::size_t, 2>>::value, "");
+	EXPECT_EQ(2u, e.extent(0));
+	EXPECT_EQ(3u, e.extent(1));
+}
+#endif
+
+}	// namespace extents_test
+
+}	// namespace hamon_mdspan_test
@@ -0,0 +1,88 @@
+﻿/**
+ *	@file	unit_test_mdspan_layout_left.cpp
+ *
+ *	@brief	layout_left のテスト
+ */
+
+#include <hamon/mdspan/layout_left.hpp>
+#include <hamon/mdspan/layout_stride.hpp>
+#include <hamon/mdspan/extents.hpp>
+#include <hamon/mdspan/dextents.hpp>
+#include <hamon/array.hpp>
+#include <hamon/type_traits/is_constructible.hpp>
+#include <hamon/type_traits/is_convertible.hpp>
+#include <hamon/type_traits/is_same.hpp>
+#include <gtest/gtest.h>
+#include "constexpr_test.hpp"
+
+namespace hamon_mdspan_test
+{
+
+namespace layout_left_test
+{
+
+using E = hamon::extents<int, 3, hamon::dynamic_extent>;
+using M = hamon::layout_left::mapping<E>;
+using DM = hamon::layout_left::mapping<hamon::dextents<int, 2>>;
+
+static_assert(hamon::is_same<M::extents_type, E>::value, "");
+static_assert(hamon::is_same<M::index_type, int>::value, "");
+static_assert(hamon::is_same<M::layout_type, hamon::layout_left>::value, "");
+static_assert(M::is_always_unique(), "");
+static_assert(M::is_always_exhaustive(), "");
+static_assert(M::is_always_strided(), "");
+static_assert( hamon::is_convertible<M, DM>::value, "");
+static_assert(!hamon::is_convertible<DM, M>::value, "");
+static_assert( hamon::is_constructible<M, DM>::value, "");
+static_assert(!hamon::is_convertible<hamon::layout_stride::mapping<E>, M>::value, "");
+static_assert( hamon::is_constructible<M, hamon::layout_stride::mapping<E>>::value, "");
+
+#define VERIFY(...)	if (!(__VA_ARGS__)) { return false; }
+
+inline HAMON_CXX14_CONSTEXPR bool
+test()
+{
+	{
+		M m(E(4));
+		VERIFY(m.extents().extent(1) == 4);
+		VERIFY(m.required_span_size() == 12);
+		VERIFY(m.stride(0) == 1);
+		VERIFY(m.stride(1) == 3);
+		VERIFY(m(1, 2) == 1 + 2 * 3);
+		VERIFY(m(0, 0) == 0);
+		VERIFY(m(2, 3) == 11);
+		VERIFY(m.is_unique());
+		VERIFY(m.is_exhaustive());
+		VERIFY(m.is_strided());
+
+		DM d = m;
+		VERIFY(d == m);
+		VERIFY(d(1, 2) == m(1, 2));
+
+		hamon::layout_stride::mapping<E> s(m);
+		VERIFY(s == m);
+		M m2(s);
+		VERIFY(m2 == m);
+	}
+	{
+		hamon::layout_left::mapping<hamon::extents<int>> m;
+		VERIFY(m.required_span_size() == 1);
+		VERIFY(m() == 0);
+	}
+	{
+		hamon::layout_left::mapping<hamon::dextents<int, 3>> m(hamon::dextents<int, 3>(2, 0, 4));
+		VERIFY(m.required_span_size() == 0);
+	}
+	return true;
+}
+
+#undef VERIFY
+
+GTEST_TEST(MDSpanTest, LayoutLeftTest)
+{
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(test());
+}
+
+}	// namespace layout_left_test
+
+}	// namespace hamon_mdspan_test
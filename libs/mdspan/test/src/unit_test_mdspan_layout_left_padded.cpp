@@ -0,0 +1,105 @@
+﻿/**
+ *	@file	unit_test_mdspan_layout_left_padded.cpp
+ *
+ *	@brief	layout_left_padded のテスト
+ */
+
+#include <hamon/mdspan/layout_left_padded.hpp>
+#include <hamon/mdspan/layout_left.hpp>
+#include <hamon/mdspan/layout_stride.hpp>
+#include <hamon/mdspan/extents.hpp>
+#include <hamon/mdspan/dextents.hpp>
+#include <hamon/array.hpp>
+#include <hamon/type_traits/is_constructible.hpp>
+#include <hamon/type_traits/is_convertible.hpp>
+#include <gtest/gtest.h>
+#include "constexpr_test.hpp"
+
+namespace hamon_mdspan_test
+{
+
+namespace layout_left_padded_test
+{
+
+using E = hamon::extents<int, 3, hamon::dynamic_extent>;
+using M4 = hamon::layout_left_padded<4>::mapping<E>;
+using MD = hamon::layout_left_padded<hamon::dynamic_extent>::mapping<hamon::dextents<int, 2>>;
+
+static_assert(M4::padding_value == 4, "");
+static_assert(M4::is_always_unique(), "");
+static_assert(!M4::is_always_exhaustive(), "");
+static_assert(M4::is_always_strided(), "");
+static_assert(hamon::layout_left_padded<4>::mapping<hamon::extents<int, 4, 5>>::is_always_exhaustive(), "");
+static_assert( hamon::is_convertible<hamon::layout_left::mapping<hamon::dextents<int, 2>>, MD>::value, "");
+static_assert( hamon::is_convertible<M4, MD>::value, "");
+static_assert(!hamon::is_convertible<MD, M4>::value, "");
+static_assert( hamon::is_constructible<M4, MD>::value, "");
+static_assert(!hamon::is_convertible<hamon::layout_stride::mapping<E>, M4>::value, "");
+static_assert( hamon::is_constructible<M4, hamon::layout_stride::mapping<E>>::value, "");
+
+#define VERIFY(...)	if (!(__VA_ARGS__)) { return false; }
+
+inline HAMON_CXX14_CONSTEXPR bool
+test()
+{
+	{
+		// 列の長さ 3 が 4 の倍数に切り上げられる
+		M4 m(E(5));
+		VERIFY(m.stride(0) == 1);
+		VERIFY(m.stride(1) == 4);
+		VERIFY(m(1, 2) == 9);
+		VERIFY(m(2, 4) == 18);
+		VERIFY(m.required_span_size() == 19);
+		VERIFY(!m.is_exhaustive());
+		VERIFY(m.is_strided());
+		VERIFY(m.is_unique());
+	}
+	{
+		// 実行時に指定した padding
+		MD m(hamon::dextents<int, 2>(5, 3), 8);
+		VERIFY(m.stride(1) == 8);
+		VERIFY(m(4, 2) == 20);
+		VERIFY(m.required_span_size() == 21);
+
+		M4 m4(E(3));
+		MD md = m4;
+		VERIFY(md == m4);
+		VERIFY(md.stride(1) == 4);
+	}
+	{
+		hamon::layout_left::mapping<hamon::dextents<int, 2>> l(hamon::dextents<int, 2>(3, 5));
+		MD m(l);
+		VERIFY(m.stride(1) == 3);
+		VERIFY(m.is_exhaustive());
+
+		// 列の長さがちょうど padding の倍数なら layout_left と同じ
+		using E4 = hamon::extents<int, 4, hamon::dynamic_extent>;
+		hamon::layout_left_padded<4>::mapping<E4> m4(hamon::layout_left::mapping<E4>(E4(5)));
+		VERIFY(m4.is_exhaustive());
+		VERIFY(m4.stride(1) == 4);
+	}
+	{
+		hamon::layout_stride::mapping<E> s(E(5), hamon::array<int, 2>{{1, 4}});
+		M4 m(s);
+		VERIFY(m == M4(E(5)));
+		VERIFY(s == m);
+	}
+	{
+		hamon::layout_left_padded<4>::mapping<hamon::extents<int, 3>> m;
+		VERIFY(m.stride(0) == 1);
+		VERIFY(m.required_span_size() == 3);
+		VERIFY(m.is_exhaustive());
+	}
+	return true;
+}
+
+#undef VERIFY
+
+GTEST_TEST(MDSpanTest, LayoutLeftPaddedTest)
+{
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(test());
+}
+
+}	// namespace layout_left_padded_test
+
+}	// namespace hamon_mdspan_test
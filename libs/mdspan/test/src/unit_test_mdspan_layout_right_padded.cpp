@@ -0,0 +1,93 @@
+﻿/**
+ *	@file	unit_test_mdspan_layout_right_padded.cpp
+ *
+ *	@brief	layout_right_padded のテスト
+ */
+
+#include <hamon/mdspan/layout_right_padded.hpp>
+#include <hamon/mdspan/layout_right.hpp>
+#include <hamon/mdspan/layout_stride.hpp>
+#include <hamon/mdspan/extents.hpp>
+#include <hamon/mdspan/dextents.hpp>
+#include <hamon/array.hpp>
+#include <hamon/type_traits/is_constructible.hpp>
+#include <hamon/type_traits/is_convertible.hpp>
+#include <gtest/gtest.h>
+#include "constexpr_test.hpp"
+
+namespace hamon_mdspan_test
+{
+
+namespace layout_right_padded_test
+{
+
+using E = hamon::extents<int, hamon::dynamic_extent, 3>;
+using M4 = hamon::layout_right_padded<4>::mapping<E>;
+using MD = hamon::layout_right_padded<hamon::dynamic_extent>::mapping<hamon::dextents<int, 2>>;
+
+static_assert(M4::padding_value == 4, "");
+static_assert(M4::is_always_unique(), "");
+static_assert(!M4::is_always_exhaustive(), "");
+static_assert(M4::is_always_strided(), "");
+static_assert( hamon::is_convertible<hamon::layout_right::mapping<hamon::dextents<int, 2>>, MD>::value, "");
+static_assert( hamon::is_convertible<M4, MD>::value, "");
+static_assert(!hamon::is_convertible<MD, M4>::value, "");
+static_assert( hamon::is_constructible<M4, MD>::value, "");
+static_assert( hamon::is_constructible<M4, hamon::layout_stride::mapping<E>>::value, "");
+
+#define VERIFY(...)	if (!(__VA_ARGS__)) { return false; }
+
+inline HAMON_CXX14_CONSTEXPR bool
+test()
+{
+	{
+		// 行の長さ 3 が 4 の倍数に切り上げられる
+		M4 m(E(5));
+		VERIFY(m.stride(0) == 4);
+		VERIFY(m.stride(1) == 1);
+		VERIFY(m(1, 2) == 6);
+		VERIFY(m(4, 2) == 18);
+		VERIFY(m.required_span_size() == 19);
+		VERIFY(!m.is_exhaustive());
+		VERIFY(m.is_strided());
+	}
+	{
+		hamon::layout_right_padded<4>::mapping<hamon::extents<int, 2, 3, 5>> m;
+		VERIFY(m.stride(2) == 1);
+		VERIFY(m.stride(1) == 8);
+		VERIFY(m.stride(0) == 24);
+		VERIFY(m(1, 2, 3) == 43);
+	}
+	{
+		MD m(hamon::dextents<int, 2>(3, 5), 16);
+		VERIFY(m.stride(0) == 16);
+		VERIFY(m(2, 4) == 36);
+
+		M4 m4(E(2));
+		MD md = m4;
+		VERIFY(md == m4);
+	}
+	{
+		hamon::layout_right::mapping<hamon::dextents<int, 2>> r(hamon::dextents<int, 2>(5, 3));
+		MD md(r);
+		VERIFY(md.stride(0) == 3);
+		VERIFY(md.is_exhaustive());
+
+		M4 m(E(5));
+		hamon::layout_stride::mapping<E> s(E(5), hamon::array<int, 2>{{4, 1}});
+		VERIFY(M4(s) == m);
+		VERIFY(s == m);
+	}
+	return true;
+}
+
+#undef VERIFY
+
+GTEST_TEST(MDSpanTest, LayoutRightPaddedTest)
+{
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(test());
+}
+
+}	// namespace layout_right_padded_test
+
+}	// namespace hamon_mdspan_test
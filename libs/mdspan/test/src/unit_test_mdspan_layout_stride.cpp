@@ -0,0 +1,93 @@
+﻿/**
+ *	@file	unit_test_mdspan_layout_stride.cpp
+ *
+ *	@brief	layout_stride のテスト
+ */
+
+#include <hamon/mdspan/layout_stride.hpp>
+#include <hamon/mdspan/layout_left.hpp>
+#include <hamon/mdspan/layout_right.hpp>
+#include <hamon/mdspan/extents.hpp>
+#include <hamon/mdspan/dextents.hpp>
+#include <hamon/array.hpp>
+#include <hamon/span.hpp>
+#include <hamon/type_traits/is_constructible.hpp>
+#include <hamon/type_traits/is_convertible.hpp>
+#include <gtest/gtest.h>
+#include "constexpr_test.hpp"
+
+namespace hamon_mdspan_test
+{
+
+namespace layout_stride_test
+{
+
+using E = hamon::extents<int, 3, hamon::dynamic_extent>;
+using M = hamon::layout_stride::mapping<E>;
+
+static_assert(M::is_always_unique(), "");
+static_assert(!M::is_always_exhaustive(), "");
+static_assert(M::is_always_strided(), "");
+static_assert( hamon::is_constructible<M, E, hamon::array<int, 2>>::value, "");
+static_assert( hamon::is_constructible<M, E, hamon::span<int, 2>>::value, "");
+static_assert(!hamon::is_constructible<M, E, hamon::array<int, 3>>::value, "");
+static_assert( hamon::is_convertible<hamon::layout_right::mapping<E>, M>::value, "");
+static_assert( hamon::is_convertible<hamon::layout_left::mapping<E>, M>::value, "");
+
+#define VERIFY(...)	if (!(__VA_ARGS__)) { return false; }
+
+inline HAMON_CXX14_CONSTEXPR bool
+test()
+{
+	{
+		// 既定のストライドは layout_right と同じ
+		M m;
+		VERIFY(m.stride(0) == 0);
+		VERIFY(m.stride(1) == 1);
+		VERIFY(m.required_span_size() == 0);
+	}
+	{
+		// 行ごとに 2 要素の隙間がある 3x4
+		M m(E(4), hamon::array<int, 2>{{6, 1}});
+		VERIFY(m.stride(0) == 6);
+		VERIFY(m.stride(1) == 1);
+		VERIFY(m.strides()[0] == 6);
+		VERIFY(m(1, 2) == 8);
+		VERIFY(m(2, 3) == 15);
+		VERIFY(m.required_span_size() == 16);
+		VERIFY(m.is_unique());
+		VERIFY(!m.is_exhaustive());
+		VERIFY(m.is_strided());
+		VERIFY(m != hamon::layout_right::mapping<E>(E(4)));
+	}
+	{
+		int s[] = {1, 3};
+		M m(E(4), hamon::span<int, 2>(s));
+		VERIFY(m.is_exhaustive());
+		VERIFY(m == hamon::layout_left::mapping<E>(E(4)));
+		VERIFY(m(1, 2) == 7);
+	}
+	{
+		M m(hamon::layout_right::mapping<E>(E(4)));
+		VERIFY(m.stride(0) == 4);
+		VERIFY(m.stride(1) == 1);
+		VERIFY(m.is_exhaustive());
+	}
+	{
+		hamon::layout_stride::mapping<hamon::extents<int>> m;
+		VERIFY(m.required_span_size() == 1);
+		VERIFY(m() == 0);
+	}
+	return true;
+}
+
+#undef VERIFY
+
+GTEST_TEST(MDSpanTest, LayoutStrideTest)
+{
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(test());
+}
+
+}	// namespace layout_stride_test
+
+}	// namespace hamon_mdspan_test
@@ -0,0 +1,99 @@
+﻿/**
+ *	@file	unit_test_mdspan_layout_tiled.cpp
+ *
+ *	@brief	layout_tiled のテスト
+ */
+
+#include <hamon/mdspan/layout_tiled.hpp>
+#include <hamon/mdspan/extents.hpp>
+#include <hamon/mdspan/dextents.hpp>
+#include <hamon/type_traits/is_constructible.hpp>
+#include <hamon/type_traits/is_convertible.hpp>
+#include <gtest/gtest.h>
+#include "constexpr_test.hpp"
+
+namespace hamon_mdspan_test
+{
+
+namespace layout_tiled_test
+{
+
+using E = hamon::extents<int, 6, hamon::dynamic_extent>;
+using M = hamon::layout_tiled<2, 4>::mapping<E>;
+using DM = hamon::layout_tiled<2, 4>::mapping<hamon::dextents<int, 2>>;
+
+static_assert(M::is_always_unique(), "");
+static_assert(!M::is_always_exhaustive(), "");
+static_assert(!M::is_always_strided(), "");
+static_assert( hamon::is_convertible<M, DM>::value, "");
+static_assert(!hamon::is_convertible<DM, M>::value, "");
+static_assert( hamon::is_constructible<M, DM>::value, "");
+
+#define VERIFY(...)	if (!(__VA_ARGS__)) { return false; }
+
+inline HAMON_CXX14_CONSTEXPR bool
+test()
+{
+	{
+		// 6x8 を 2x4 のタイルに分ける (3x2 タイル)
+		M m(E(8));
+		VERIFY(m(0, 0) == 0);
+		VERIFY(m(0, 3) == 3);
+		VERIFY(m(1, 0) == 4);
+		VERIFY(m(1, 3) == 7);
+		VERIFY(m(0, 4) == 8);
+		VERIFY(m(1, 7) == 15);
+		VERIFY(m(2, 0) == 16);
+		VERIFY(m(5, 7) == 47);
+		VERIFY(m.required_span_size() == 48);
+		VERIFY(m.is_unique());
+		VERIFY(m.is_exhaustive());
+		VERIFY(!m.is_strided());
+	}
+	{
+		// 端のタイルは一部しか使われない
+		M m(E(5));
+		VERIFY(m(0, 4) == 8);
+		VERIFY(m(2, 0) == 16);
+		VERIFY(m(5, 4) == 44);
+		VERIFY(m.required_span_size() == 48);
+		VERIFY(!m.is_exhaustive());
+	}
+	{
+		// 横方向のタイルが1つなら layout_right と同じ形
+		M m(E(3));
+		VERIFY(m.is_strided());
+		VERIFY(m.stride(0) == 4);
+		VERIFY(m.stride(1) == 1);
+		VERIFY(m(3, 2) == 14);
+	}
+	{
+		// タイルの高さが1なら layout_right と同じ形
+		hamon::layout_tiled<1, 4>::mapping<E> m(E(10));
+		VERIFY(m.is_strided());
+		VERIFY(m.stride(0) == 12);
+		VERIFY(m(1, 5) == 17);
+	}
+	{
+		DM d = M(E(8));
+		VERIFY(d == M(E(8)));
+		VERIFY(d != M(E(4)));
+		VERIFY(d(5, 7) == 47);
+	}
+	{
+		M m(E(0));
+		VERIFY(m.required_span_size() == 0);
+	}
+	return true;
+}
+
+#undef VERIFY
+
+GTEST_TEST(MDSpanTest, LayoutTiledTest)
+{
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(test());
+}
+
+}	// namespace layout_tiled_test
+
+}	// namespace hamon_mdspan_test
@@ -0,0 +1,185 @@
+﻿/**
+ *	@file	unit_test_mdspan_mdspan.cpp
+ *
+ *	@brief	mdspan のテスト
+ */
+
+#include <hamon/mdspan/mdspan.hpp>
+#include <hamon/mdspan/extents.hpp>
+#include <hamon/mdspan/dextents.hpp>
+#include <hamon/mdspan/layout_left.hpp>
+#include <hamon/mdspan/layout_right.hpp>
+#include <hamon/mdspan/layout_stride.hpp>
+#include <hamon/mdspan/layout_right_padded.hpp>
+#include <hamon/mdspan/layout_tiled.hpp>
+#include <hamon/array.hpp>
+#include <hamon/span.hpp>
+#include <hamon/type_traits/is_constructible.hpp>
+#include <hamon/type_traits/is_convertible.hpp>
+#include <hamon/type_traits/is_same.hpp>
+#include <gtest/gtest.h>
+#include "constexpr_test.hpp"
+#include "mdspan_test_helper.hpp"
+
+namespace hamon_mdspan_test
+{
+
+namespace mdspan_test
+{
+
+using E = hamon::extents<int, 2, hamon::dynamic_extent>;
+using M = hamon::mdspan<int, E>;
+using CM = hamon::mdspan<int const, hamon::dextents<int, 2>>;
+
+static_assert(hamon::is_same<M::layout_type, hamon::layout_right>::value, "");
+static_assert(hamon::is_same<M::accessor_type, hamon::default_accessor<int>>::value, "");
+static_assert(hamon::is_same<M::reference, int&>::value, "");
+static_assert(hamon::is_same<M::data_handle_type, int*>::value, "");
+static_assert(M::rank() == 2, "");
+static_assert(M::rank_dynamic() == 1, "");
+static_assert(M::static_extent(0) == 2, "");
+static_assert( hamon::is_constructible<M, int*, int>::value, "");
+static_assert( hamon::is_constructible<M, int*, int, int>::value, "");
+static_assert(!hamon::is_constructible<M, int*, int, int, int>::value, "");
+static_assert( hamon::is_convertible<M, CM>::value, "");
+static_assert(!hamon::is_convertible<CM, M>::value, "");
+static_assert(!hamon::is_constructible<M, CM>::value, "");
+static_assert( hamon::is_constructible<hamon::mdspan<int const, E>, CM>::value, "");
+static_assert(!hamon::is_convertible<CM, hamon::mdspan<int const, E>>::value, "");
+
+#define VERIFY(...)	if (!(__VA_ARGS__)) { return false; }
+
+inline HAMON_CXX14_CONSTEXPR bool
+test()
+{
+	int a[] = {0, 1, 2, 3, 4, 5};
+	{
+		M m(a, 3);
+		VERIFY(m.data_handle() == a);
+		VERIFY(m.extent(0) == 2);
+		VERIFY(m.extent(1) == 3);
+		VERIFY(m.size() == 6);
+		VERIFY(!m.empty());
+		VERIFY(m.stride(0) == 3);
+		VERIFY(m.is_exhaustive());
+		VERIFY(at(m, 1, 2) == 5);
+		VERIFY(at(m, 0, 1) == 1);
+		VERIFY(m[hamon::array<int, 2>{{1, 0}}] == 3);
+
+		at(m, 1, 1) = 10;
+		VERIFY(a[4] == 10);
+		a[4] = 4;
+
+		CM c = m;
+		VERIFY(at(c, 1, 2) == 5);
+	}
+	{
+		M m(a, hamon::array<int, 1>{{3}});
+		VERIFY(m.extent(1) == 3);
+		int idx[] = {1, 1};
+		VERIFY(m[hamon::span<int, 2>(idx)] == 4);
+	}
+	{
+		hamon::mdspan<int, E, hamon::layout_left> m(a, E(3));
+		VERIFY(at(m, 1, 2) == 5);
+		VERIFY(at(m, 1, 0) == 1);
+		VERIFY(m.stride(1) == 2);
+	}
+	{
+		using S = hamon::layout_stride::mapping<E>;
+		hamon::mdspan<int, E, hamon::layout_stride> m(a, S(E(2), hamon::array<int, 2>{{1, 3}}));
+		VERIFY(at(m, 1, 1) == 4);
+		VERIFY(!m.is_exhaustive());
+	}
+	{
+		hamon::mdspan<int, hamon::extents<int, 4>> m(a + 1);
+		VERIFY(m[0] == 1);
+		VERIFY(m[3] == 4);
+	}
+	{
+		hamon::mdspan<int, hamon::extents<int>> m(a + 2);
+		VERIFY(m.size() == 1);
+		VERIFY(at(m) == 2);
+	}
+	{
+		M m1(a, 3);
+		M m2(a + 3, 1);
+		swap(m1, m2);
+		VERIFY(m1.data_handle() == a + 3);
+		VERIFY(m1.extent(1) == 1);
+		VERIFY(m2.data_handle() == a);
+		VERIFY(m2.extent(1) == 3);
+	}
+	{
+		M m(a, 0);
+		VERIFY(m.size() == 0);
+		VERIFY(m.empty());
+	}
+	return true;
+}
+
+#undef VERIFY
+
+GTEST_TEST(MDSpanTest, MDSpanTest)
+{
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(test());
+}
+
+GTEST_TEST(MDSpanTest, MDSpanPaddedTest)
+{
+	// 各行の先頭が 4 要素の倍数の位置になる
+	float buf[3 * 4] = {};
+	hamon::mdspan<float, hamon::dextents<int, 2>, hamon::layout_right_padded<4>> m(buf, 3, 3);
+	EXPECT_EQ(4, m.stride(0));
+	EXPECT_EQ(11, m.mapping().required_span_size());
+	at(m, 1, 0) = 1.0f;
+	at(m, 2, 2) = 2.0f;
+	EXPECT_EQ(1.0f, buf[4]);
+	EXPECT_EQ(2.0f, buf[10]);
+}
+
+GTEST_TEST(MDSpanTest, MDSpanTiledTest)
+{
+	int buf[4 * 4] = {};
+	hamon::mdspan<int, hamon::extents<int, 4, 4>, hamon::layout_tiled<2, 2>> m(buf);
+	for (int i = 0; i < 4; ++i)
+	{
+		for (int j = 0; j < 4; ++j)
+		{
+			at(m, i, j) = i * 4 + j;
+		}
+	}
+	int const expected[] = {0, 1, 4, 5, 2, 3, 6, 7, 8, 9, 12, 13, 10, 11, 14, 15};
+	for (int i = 0; i < 16; ++i)
+	{
+		EXPECT_EQ(expected[i], buf[i]);
+	}
+}
+
+#if defined(HAMON_HAS_CXX17_DEDUCTION_GUIDES)
+GTEST_TEST(MDSpanTest, MDSpanDeductionTest)
+{
+	int a[6] = {};
+	{
+		hamon::mdspan m(a);
+		static_assert(hamon::is_same<decltype(m), hamon::mdspan<int, hamon::extents<hamon::size_t, 6>>>::value, "");
+	}
+	{
+		hamon::mdspan m(a, 2, 3);
+		static_assert(hamon::is_same<decltype(m), hamon::mdspan<int, hamon::dextents<hamon::size_t, 2>>>::value, "");
+		EXPECT_EQ(3u, m.extent(1));
+	}
+	{
+		hamon::mdspan m(a, E(3));
+		static_assert(hamon::is_same<decltype(m), M>::value, "");
+	}
+	{
+		hamon::mdspan m(a, hamon::layout_left::mapping<E>(E(3)));
+		static_assert(hamon::is_same<decltype(m), hamon::mdspan<int, E, hamon::layout_left>>::value, "");
+	}
+}
+#endif
+
+}	// namespace mdspan_test
+
+}	// namespace hamon_mdspan_test
@@ -0,0 +1,169 @@
+﻿/**
+ *	@file	unit_test_mdspan_submdspan.cpp
+ *
+ *	@brief	submdspan のテスト
+ */
+
+#include <hamon/mdspan/submdspan.hpp>
+#include <hamon/mdspan/mdspan.hpp>
+#include <hamon/mdspan/extents.hpp>
+#include <hamon/mdspan/dextents.hpp>
+#include <hamon/mdspan/full_extent.hpp>
+#include <hamon/mdspan/strided_slice.hpp>
+#include <hamon/mdspan/layout_left.hpp>
+#include <hamon/mdspan/layout_right.hpp>
+#include <hamon/mdspan/layout_stride.hpp>
+#include <hamon/mdspan/layout_left_padded.hpp>
+#include <hamon/mdspan/aligned_accessor.hpp>
+#include <hamon/pair.hpp>
+#include <hamon/type_traits/integral_constant.hpp>
+#include <hamon/type_traits/is_same.hpp>
+#include <gtest/gtest.h>
+#include "constexpr_test.hpp"
+#include "mdspan_test_helper.hpp"
+
+namespace hamon_mdspan_test
+{
+
+namespace submdspan_test
+{
+
+using E = hamon::extents<int, 4, hamon::dynamic_extent, 6>;
+using P = hamon::pair<int, int>;
+
+#define VERIFY(...)	if (!(__VA_ARGS__)) { return false; }
+
+inline HAMON_CXX14_CONSTEXPR bool
+test_layout_right()
+{
+	int buf[4 * 5 * 6] {};
+	for (int i = 0; i < 4 * 5 * 6; ++i)
+	{
+		buf[i] = i;
+	}
+	hamon::mdspan<int, E> m(buf, 5);
+	{
+		// インデックス, 単位ストライドの範囲, full_extent の順なら layout_right のまま
+		auto s = hamon::submdspan(m, 1, P(1, 3), hamon::full_extent);
+		static_assert(hamon::is_same<decltype(s)::layout_type, hamon::layout_right>::value, "");
+		static_assert(hamon::is_same<decltype(s)::extents_type, hamon::extents<int, hamon::dynamic_extent, 6>>::value, "");
+		VERIFY(s.extent(0) == 2);
+		VERIFY(at(s, 1, 2) == at(m, 1, 2, 2));
+		VERIFY(s.data_handle() == &at(m, 1, 1, 0));
+	}
+	{
+		auto s = hamon::submdspan(m, hamon::full_extent, 2, P(1, 4));
+		static_assert(hamon::is_same<decltype(s)::layout_type, hamon::layout_stride>::value, "");
+		VERIFY(s.extent(0) == 4);
+		VERIFY(s.extent(1) == 3);
+		VERIFY(s.stride(0) == 30);
+		VERIFY(s.stride(1) == 1);
+		VERIFY(at(s, 3, 2) == at(m, 3, 2, 3));
+	}
+	{
+		auto s = hamon::submdspan(m, 1, hamon::strided_slice<int, int, int>{0, 5, 2}, 3);
+		static_assert(hamon::is_same<decltype(s)::layout_type, hamon::layout_stride>::value, "");
+		VERIFY(s.extent(0) == 3);
+		VERIFY(s.stride(0) == 12);
+		VERIFY(s[2] == at(m, 1, 4, 3));
+	}
+	{
+		auto s = hamon::submdspan(m, 1, 2, 3);
+		static_assert(decltype(s)::rank() == 0, "");
+		VERIFY(at(s) == at(m, 1, 2, 3));
+	}
+	{
+		// 部分ビューの部分ビュー
+		auto s1 = hamon::submdspan(m, P(1, 3), hamon::full_extent, hamon::full_extent);
+		static_assert(hamon::is_same<decltype(s1)::layout_type, hamon::layout_right>::value, "");
+		auto s2 = hamon::submdspan(s1, 1, P(2, 4), hamon::strided_slice<int, int, int>{1, 5, 2});
+		VERIFY(s2.extent(0) == 2);
+		VERIFY(s2.extent(1) == 3);
+		VERIFY(at(s2, 1, 2) == at(m, 2, 3, 5));
+	}
+	return true;
+}
+
+inline HAMON_CXX14_CONSTEXPR bool
+test_layout_left()
+{
+	int buf[4 * 5 * 6] {};
+	for (int i = 0; i < 4 * 5 * 6; ++i)
+	{
+		buf[i] = i;
+	}
+	hamon::mdspan<int, E, hamon::layout_left> m(buf, 5);
+	{
+		// full_extent, 単位ストライドの範囲, インデックス の順なら layout_left のまま
+		auto s = hamon::submdspan(m, hamon::full_extent, P(1, 3), 2);
+		static_assert(hamon::is_same<decltype(s)::layout_type, hamon::layout_left>::value, "");
+		static_assert(hamon::is_same<decltype(s)::extents_type, hamon::extents<int, 4, hamon::dynamic_extent>>::value, "");
+		VERIFY(at(s, 3, 1) == at(m, 3, 2, 2));
+	}
+	{
+		auto s = hamon::submdspan(m, 1, hamon::full_extent, hamon::full_extent);
+		static_assert(hamon::is_same<decltype(s)::layout_type, hamon::layout_stride>::value, "");
+		VERIFY(s.stride(0) == 4);
+		VERIFY(s.stride(1) == 20);
+		VERIFY(at(s, 4, 5) == at(m, 1, 4, 5));
+	}
+	return true;
+}
+
+inline HAMON_CXX14_CONSTEXPR bool
+test_layout_stride()
+{
+	int buf[32] {};
+	for (int i = 0; i < 32; ++i)
+	{
+		buf[i] = i;
+	}
+	using E2 = hamon::dextents<int, 2>;
+	using S = hamon::layout_stride::mapping<E2>;
+	hamon::mdspan<int, E2, hamon::layout_stride> m(buf, S(E2(3, 4), hamon::array<int, 2>{{8, 2}}));
+	auto s = hamon::submdspan(m, P(1, 3), hamon::strided_slice<int, int, int>{1, 3, 2});
+	static_assert(hamon::is_same<decltype(s)::layout_type, hamon::layout_stride>::value, "");
+	VERIFY(s.extent(0) == 2);
+	VERIFY(s.extent(1) == 2);
+	VERIFY(s.stride(0) == 8);
+	VERIFY(s.stride(1) == 4);
+	VERIFY(at(s, 1, 1) == at(m, 2, 3));
+	return true;
+}
+
+#undef VERIFY
+
+GTEST_TEST(MDSpanTest, SubmdspanTest)
+{
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(test_layout_right());
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(test_layout_left());
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(test_layout_stride());
+}
+
+GTEST_TEST(MDSpanTest, SubmdspanPaddedTest)
+{
+	float buf[8 * 3] = {};
+	using M = hamon::mdspan<float, hamon::dextents<int, 2>, hamon::layout_left_padded<8>>;
+	M m(buf, 5, 3);
+	at(m, 4, 2) = 1.0f;
+	auto s = hamon::submdspan(m, P(2, 5), hamon::full_extent);
+	static_assert(hamon::is_same<decltype(s)::layout_type, hamon::layout_stride>::value, "");
+	EXPECT_EQ(1, s.stride(0));
+	EXPECT_EQ(8, s.stride(1));
+	EXPECT_EQ(1.0f, at(s, 2, 2));
+}
+
+GTEST_TEST(MDSpanTest, SubmdspanAccessorTest)
+{
+	// 結果の accessor は offset_policy になる
+	alignas(16) float buf[16] = {};
+	buf[5] = 1.0f;
+	hamon::mdspan<float, hamon::extents<int, 4, 4>, hamon::layout_right, hamon::aligned_accessor<float, 16>> m(buf);
+	auto s = hamon::submdspan(m, 1, P(1, 3));
+	static_assert(hamon::is_same<decltype(s)::accessor_type, hamon::default_accessor<float>>::value, "");
+	EXPECT_EQ(1.0f, s[0]);
+}
+
+}	// namespace submdspan_test
+
+}	// namespace hamon_mdspan_test
@@ -0,0 +1,82 @@
+﻿/**
+ *	@file	unit_test_mdspan_submdspan_extents.cpp
+ *
+ *	@brief	submdspan_extents のテスト
+ */
+
+#include <hamon/mdspan/submdspan_extents.hpp>
+#include <hamon/mdspan/extents.hpp>
+#include <hamon/mdspan/dextents.hpp>
+#include <hamon/mdspan/full_extent.hpp>
+#include <hamon/mdspan/strided_slice.hpp>
+#include <hamon/array.hpp>
+#include <hamon/pair.hpp>
+#include <hamon/type_traits/integral_constant.hpp>
+#include <hamon/type_traits/is_same.hpp>
+#include <gtest/gtest.h>
+#include "constexpr_test.hpp"
+
+namespace hamon_mdspan_test
+{
+
+namespace submdspan_extents_test
+{
+
+using E = hamon::extents<int, 4, hamon::dynamic_extent, 6>;
+template <int N>
+using IC = hamon::integral_constant<int, N>;
+
+#define VERIFY(...)	if (!(__VA_ARGS__)) { return false; }
+
+inline HAMON_CXX14_CONSTEXPR bool
+test()
+{
+	E e(5);
+	{
+		auto s = hamon::submdspan_extents(e, hamon::full_extent, 2, hamon::pair<int, int>(1, 4));
+		static_assert(hamon::is_same<decltype(s), hamon::extents<int, 4, hamon::dynamic_extent>>::value, "");
+		VERIFY(s.extent(0) == 4);
+		VERIFY(s.extent(1) == 3);
+	}
+	{
+		auto s = hamon::submdspan_extents(e,
+			hamon::strided_slice<int, int, int>{1, 3, 2},
+			hamon::array<int, 2>{{0, 5}},
+			IC<3>{});
+		static_assert(hamon::is_same<decltype(s), hamon::dextents<int, 2>>::value, "");
+		VERIFY(s.extent(0) == 2);
+		VERIFY(s.extent(1) == 5);
+	}
+	{
+		// 整数定数を使うとコンパイル時に要素数が決まる
+		auto s = hamon::submdspan_extents(e,
+			hamon::strided_slice<int, IC<3>, IC<2>>{1, {}, {}},
+			hamon::full_extent,
+			hamon::pair<IC<1>, IC<4>>{});
+		static_assert(hamon::is_same<decltype(s), hamon::extents<int, 2, hamon::dynamic_extent, 3>>::value, "");
+		VERIFY(s.extent(1) == 5);
+	}
+	{
+		// 要素数 0 の strided_slice
+		auto s = hamon::submdspan_extents(e,
+			hamon::strided_slice<int, IC<0>, IC<2>>{1, {}, {}}, 0, 0);
+		static_assert(hamon::is_same<decltype(s), hamon::extents<int, 0>>::value, "");
+	}
+	{
+		auto s = hamon::submdspan_extents(e, 1, 2, 3);
+		static_assert(hamon::is_same<decltype(s), hamon::extents<int>>::value, "");
+		VERIFY(s.rank() == 0);
+	}
+	return true;
+}
+
+#undef VERIFY
+
+GTEST_TEST(MDSpanTest, SubmdspanExtentsTest)
+{
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(test());
+}
+
+}	// namespace submdspan_extents_test
+
+}	// namespace hamon_mdspan_test
@@ -0,0 +1,122 @@
+﻿/**
+ *	@file	atomic_shared_ptr_bench.cpp
+ *
+ *	@brief	atomic<shared_ptr<T>> の読み込みが多い場合のベンチマーク
+ *
+ *	1つの書き手がときどき値を置き換える間に、複数の読み手が load を繰り返し、
+ *	読み手の数ごとに1秒あたりの load の回数を出力する。
+ *	比較のため、mutex で保護した shared_ptr の結果も出力する。
+ *
+ *	使い方:
+ *		atomic_shared_ptr_bench [最大の読み手の数]
+ */
+
+#include <hamon/memory/atomic_shared_ptr.hpp>
+#include <hamon/memory/make_shared.hpp>
+#include <hamon/memory/shared_ptr.hpp>
+#include <hamon/atomic/atomic.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+struct MutexSharedPtr
+{
+	hamon::shared_ptr<int> load() const
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		return m_ptr;
+	}
+
+	void store(hamon::shared_ptr<int> p)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_ptr.swap(p);
+	}
+
+	mutable std::mutex		m_mutex;
+	hamon::shared_ptr<int>	m_ptr;
+};
+
+// 読み手の数が readers のときの、1秒あたりの load の回数を返す
+template <typename Atomic>
+double run(Atomic& a, int readers)
+{
+	std::atomic<bool> stop{false};
+	std::atomic<long long> total{0};
+	std::atomic<long long> sink{0};
+
+	std::vector<std::thread> threads;
+	for (int i = 0; i < readers; ++i)
+	{
+		threads.emplace_back([&]
+		{
+			long long count = 0;
+			long long sum = 0;
+			while (!stop.load(std::memory_order_relaxed))
+			{
+				for (int j = 0; j < 256; ++j)
+				{
+					sum += *a.load();
+				}
+				count += 256;
+			}
+			total += count;
+			sink += sum;
+		});
+	}
+
+	// 書き手は 1ms ごとに値を置き換える
+	auto const start = Clock::now();
+	auto const end = start + std::chrono::milliseconds(500);
+	int value = 0;
+	while (Clock::now() < end)
+	{
+		a.store(hamon::make_shared<int>(++value));
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+	stop = true;
+
+	for (auto& t : threads)
+	{
+		t.join();
+	}
+
+	auto const seconds = std::chrono::duration<double>(Clock::now() - start).count();
+	return static_cast<double>(total.load()) / seconds;
+}
+
+}	// namespace
+
+int main(int argc, char* argv[])
+{
+	int max_readers = static_cast<int>(std::thread::hardware_concurrency());
+	if (argc > 1)
+	{
+		max_readers = std::atoi(argv[1]);
+	}
+	if (max_readers < 1)
+	{
+		max_readers = 1;
+	}
+
+	std::printf("%8s %20s %20s\n", "readers", "atomic [Mload/s]", "mutex [Mload/s]");
+	for (int readers = 1; readers <= max_readers; readers *= 2)
+	{
+		hamon::atomic<hamon::shared_ptr<int>> a{hamon::make_shared<int>(0)};
+		MutexSharedPtr m;
+		m.store(hamon::make_shared<int>(0));
+
+		auto const r1 = run(a, readers);
+		auto const r2 = run(m, readers);
+		std::printf("%8d %20.2f %20.2f\n", readers, r1 / 1e6, r2 / 1e6);
+	}
+}
@@ -0,0 +1,67 @@
+﻿/**
+ *	@file	atomic_shared_ptr.hpp
+ *
+ *	@brief	atomic<shared_ptr<T>> の定義
+ */
+
+#ifndef HAMON_MEMORY_ATOMIC_SHARED_PTR_HPP
+#define HAMON_MEMORY_ATOMIC_SHARED_PTR_HPP
+
+#include <hamon/memory/shared_ptr.hpp>
+#include <hamon/memory/config.hpp>
+#include <hamon/atomic/atomic.hpp>
+
+#if !defined(HAMON_USE_STD_SHARED_PTR)
+
+#include <hamon/memory/detail/atomic_smart_ptr_base.hpp>
+#include <hamon/cstddef/nullptr_t.hpp>
+#include <hamon/utility/move.hpp>
+#include <hamon/config.hpp>
+
+#if defined(HAMON_USE_STD_ATOMIC)
+namespace std
+#else
+namespace hamon
+#endif
+{
+
+// 20.3.2.6.2 Partial specialization for shared_ptr[util.smartptr.atomic.shared]
+template <typename T>
+struct atomic<hamon::shared_ptr<T>>
+	: public hamon::detail::atomic_smart_ptr_base<hamon::shared_ptr<T>>
+{
+private:
+	using base_type = hamon::detail::atomic_smart_ptr_base<hamon::shared_ptr<T>>;
+
+public:
+	HAMON_CXX11_CONSTEXPR
+	atomic() noexcept = default;
+
+	HAMON_CXX11_CONSTEXPR
+	atomic(hamon::nullptr_t) noexcept
+		: atomic()
+	{}
+
+	atomic(hamon::shared_ptr<T> desired) noexcept
+		: base_type(hamon::move(desired))
+	{}
+
+	atomic(atomic const&) = delete;
+	void operator=(atomic const&) = delete;
+
+	void operator=(hamon::shared_ptr<T> desired) noexcept
+	{
+		this->store(hamon::move(desired));
+	}
+
+	void operator=(hamon::nullptr_t) noexcept
+	{
+		this->store(nullptr);
+	}
+};
+
+}	// namespace std / hamon
+
+#endif
+
+#endif // HAMON_MEMORY_ATOMIC_SHARED_PTR_HPP
@@ -0,0 +1,56 @@
+﻿/**
+ *	@file	atomic_weak_ptr.hpp
+ *
+ *	@brief	atomic<weak_ptr<T>> の定義
+ */
+
+#ifndef HAMON_MEMORY_ATOMIC_WEAK_PTR_HPP
+#define HAMON_MEMORY_ATOMIC_WEAK_PTR_HPP
+
+#include <hamon/memory/weak_ptr.hpp>
+#include <hamon/memory/config.hpp>
+#include <hamon/atomic/atomic.hpp>
+
+#if !defined(HAMON_USE_STD_SHARED_PTR)
+
+#include <hamon/memory/detail/atomic_smart_ptr_base.hpp>
+#include <hamon/utility/move.hpp>
+#include <hamon/config.hpp>
+
+#if defined(HAMON_USE_STD_ATOMIC)
+namespace std
+#else
+namespace hamon
+#endif
+{
+
+// 20.3.2.6.3 Partial specialization for weak_ptr[util.smartptr.atomic.weak]
+template <typename T>
+struct atomic<hamon::weak_ptr<T>>
+	: public hamon::detail::atomic_smart_ptr_base<hamon::weak_ptr<T>>
+{
+private:
+	using base_type = hamon::detail::atomic_smart_ptr_base<hamon::weak_ptr<T>>;
+
+public:
+	HAMON_CXX11_CONSTEXPR
+	atomic() noexcept = default;
+
+	atomic(hamon::weak_ptr<T> desired) noexcept
+		: base_type(hamon::move(desired))
+	{}
+
+	atomic(atomic const&) = delete;
+	void operator=(atomic const&) = delete;
+
+	void operator=(hamon::weak_ptr<T> desired) noexcept
+	{
+		this->store(hamon::move(desired));
+	}
+};
+
+}	// namespace std / hamon
+
+#endif
+
+#endif // HAMON_MEMORY_ATOMIC_WEAK_PTR_HPP
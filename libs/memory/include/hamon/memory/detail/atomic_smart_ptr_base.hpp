@@ -0,0 +1,721 @@
+﻿/**
+ *	@file	atomic_smart_ptr_base.hpp
+ *
+ *	@brief	atomic_smart_ptr_base を定義
+ */
+
+#ifndef HAMON_MEMORY_DETAIL_ATOMIC_SMART_PTR_BASE_HPP
+#define HAMON_MEMORY_DETAIL_ATOMIC_SMART_PTR_BASE_HPP
+
+#include <hamon/memory/shared_ptr_fwd.hpp>
+#include <hamon/memory/weak_ptr_fwd.hpp>
+#include <hamon/memory/detail/sp_ref_count.hpp>
+#include <hamon/atomic/memory_order.hpp>
+#include <hamon/atomic/detail/atomic_compare_exchange_weak.hpp>
+#include <hamon/atomic/detail/atomic_exchange.hpp>
+#include <hamon/atomic/detail/atomic_load.hpp>
+#include <hamon/atomic/detail/atomic_store.hpp>
+#include <hamon/atomic/detail/atomic_wait.hpp>
+#include <hamon/cstdint/uint64_t.hpp>
+#include <hamon/cstdint/uintptr_t.hpp>
+#include <hamon/utility/move.hpp>
+#include <hamon/assert.hpp>
+#include <hamon/config.hpp>
+#include <atomic>
+#include <thread>
+
+// 制御ブロックのアドレスの上位16ビットを、読み手が取り出した参照の数に使うかどうか。
+//
+// x86-64 のユーザー空間のアドレスは47ビットに収まる。
+// 5段階ページング(LA57)の Linux でも、47ビットを超えるアドレスを mmap のヒントに渡さない限り、
+// それより上のアドレスが返されることはない。そのようなアロケータを使う場合は
+// HAMON_MEMORY_ATOMIC_SMART_PTR_NO_SPLIT_COUNT を定義すること。
+// AArch64 などでは、ポインタの上位バイトにタグ(TBI/MTE)が入ることがあるので使わない。
+#if !defined(HAMON_MEMORY_ATOMIC_SMART_PTR_NO_SPLIT_COUNT) && \
+	(defined(__x86_64__) || defined(_M_X64))
+#  define HAMON_MEMORY_ATOMIC_SMART_PTR_SPLIT_COUNT
+#endif
+
+namespace hamon
+{
+
+namespace detail
+{
+
+#if defined(HAMON_MEMORY_ATOMIC_SMART_PTR_SPLIT_COUNT)
+
+// 20.3.2.6 Atomic specializations for smart pointers[util.smartptr.atomic]
+//
+// 参照カウントを分割して持つ(split reference count)。
+//
+// m_word には制御ブロックへのポインタと、読み手が取り出した参照の数(上位16ビット)を格納する。
+// 値を格納するときに、制御ブロックの参照カウントを kBatch だけ前払いしておき、
+// load は m_word に対する compare_exchange で、前払い分から参照を1つ受け取る。
+// 取り出された数が kRefill 以上になったら、受け取った読み手が前払い分を補充する。
+// 前払い分が尽きている(取り出された数が kBatch に達している)間は、補充されるまで受け取らない。
+// 取り出されなかった前払い分は、store や exchange で値を置き換えたときにまとめて返却する。
+//
+// 要素へのポインタ m_ptr は m_word と同時に更新できないため、書き手だけが更新するシーケンス番号 m_seq で
+// 読み手が一貫した組を読めたか検証する。読み手同士が互いを待つことはないが、
+// 書き手が値を置き換えている最中(数個のストアの間)だけは、読み手はやり直しになる。
+//
+// 上位16ビットを使うため、制御ブロックのアドレスは48ビットに収まっている必要がある。
+//
+// 値を格納している間、制御ブロックの use_count() は前払いした参照(最大 kBatch 個)を含む。
+// そのため use_count() == 1 で所有者が1つかどうかを判定することはできない。
+// 値を置き換えると前払い分が返却され、正確な数に戻る。
+template <typename SP>
+struct atomic_smart_ptr_base
+{
+private:
+	using element_type = typename SP::element_type;
+	using word_type = hamon::uint64_t;
+
+	static HAMON_CXX11_CONSTEXPR int       kCountShift = 48;
+	static HAMON_CXX11_CONSTEXPR word_type kCountOne   = word_type(1) << kCountShift;
+	static HAMON_CXX11_CONSTEXPR word_type kPtrMask    = kCountOne - 1;
+
+	// 格納時に前払いする参照の数
+	static HAMON_CXX11_CONSTEXPR long kBatch  = 0x4000;
+	// 取り出された数がこれ以上になったら、前払い分を補充する
+	static HAMON_CXX11_CONSTEXPR long kRefill = kBatch / 2;
+
+	static_assert(kBatch < (long(1) << (64 - kCountShift)), "");
+
+	// sp_ref_count_base* | (取り出された参照の数 << kCountShift)
+	mutable word_type			m_word;
+	// element_type*
+	hamon::uintptr_t			m_ptr;
+	// 書き手が値を置き換えている間は奇数になる
+	mutable hamon::uintptr_t	m_seq;
+
+	static hamon::detail::sp_ref_count_base*
+	to_ref_count(word_type word) noexcept
+	{
+		return reinterpret_cast<hamon::detail::sp_ref_count_base*>(
+			static_cast<hamon::uintptr_t>(word & kPtrMask));
+	}
+
+	static word_type
+	to_word(hamon::detail::sp_ref_count_base* ref_count) noexcept
+	{
+		auto const word = static_cast<word_type>(reinterpret_cast<hamon::uintptr_t>(ref_count));
+		HAMON_ASSERT((word & ~kPtrMask) == 0);
+		return word;
+	}
+
+	static long to_count(word_type word) noexcept
+	{
+		return static_cast<long>(word >> kCountShift);
+	}
+
+	static element_type* to_ptr(hamon::uintptr_t ptr) noexcept
+	{
+		return reinterpret_cast<element_type*>(ptr);
+	}
+
+	static hamon::uintptr_t from_ptr(element_type* ptr) noexcept
+	{
+		return reinterpret_cast<hamon::uintptr_t>(ptr);
+	}
+
+	template <typename T>
+	static void add_refs_impl(hamon::detail::sp_ref_count_base* ref_count, long n, hamon::shared_ptr<T> const*) noexcept
+	{
+		ref_count->increment_use_count(n);
+	}
+
+	template <typename T>
+	static void add_refs_impl(hamon::detail::sp_ref_count_base* ref_count, long n, hamon::weak_ptr<T> const*) noexcept
+	{
+		ref_count->increment_weak_count(n);
+	}
+
+	template <typename T>
+	static void release_refs_impl(hamon::detail::sp_ref_count_base* ref_count, long n, hamon::shared_ptr<T> const*) noexcept
+	{
+		ref_count->decrement_use_count(n);
+	}
+
+	template <typename T>
+	static void release_refs_impl(hamon::detail::sp_ref_count_base* ref_count, long n, hamon::weak_ptr<T> const*) noexcept
+	{
+		ref_count->decrement_weak_count(n);
+	}
+
+	static void add_refs(hamon::detail::sp_ref_count_base* ref_count, long n) noexcept
+	{
+		if (ref_count != nullptr && n != 0)
+		{
+			add_refs_impl(ref_count, n, static_cast<SP const*>(nullptr));
+		}
+	}
+
+	static void release_refs(hamon::detail::sp_ref_count_base* ref_count, long n) noexcept
+	{
+		if (ref_count != nullptr && n != 0)
+		{
+			release_refs_impl(ref_count, n, static_cast<SP const*>(nullptr));
+		}
+	}
+
+	// 参照カウントを増やさずに、sp の中身を取り出す
+	static hamon::detail::sp_ref_count_base* release(SP& sp) noexcept
+	{
+		auto const ref_count = sp.m_ref_count;
+		sp.m_ptr = nullptr;
+		sp.m_ref_count = nullptr;
+		return ref_count;
+	}
+
+	// 参照カウントを増やさずに、SP を作る
+	static SP adopt(element_type* ptr, hamon::detail::sp_ref_count_base* ref_count) noexcept
+	{
+		SP sp;
+		sp.m_ptr = ptr;
+		sp.m_ref_count = ref_count;
+		return sp;
+	}
+
+	// desired の所有権を引き取り、前払い分を足した m_word の値を返す
+	static word_type prepare(SP& desired) noexcept
+	{
+		auto const ref_count = release(desired);
+		add_refs(ref_count, kBatch);
+		return to_word(ref_count);
+	}
+
+	// 取り出されなかった前払い分を返却し、保持していた参照を SP として返す
+	static SP settle(hamon::uintptr_t ptr, word_type word) noexcept
+	{
+		auto const ref_count = to_ref_count(word);
+		if (ref_count != nullptr)
+		{
+			HAMON_ASSERT(to_count(word) <= kBatch);
+			release_refs(ref_count, kBatch - to_count(word));
+		}
+		return adopt(to_ptr(ptr), ref_count);
+	}
+
+	// 書き手同士を排他し、開始前のシーケンス番号を返す
+	hamon::uintptr_t begin_write() noexcept
+	{
+		hamon::uintptr_t seq = hamon::detail::atomic_load(&m_seq, hamon::memory_order::relaxed);
+		for (;;)
+		{
+			if (seq & 1)
+			{
+				std::this_thread::yield();
+				seq = hamon::detail::atomic_load(&m_seq, hamon::memory_order::relaxed);
+				continue;
+			}
+
+			if (hamon::detail::atomic_compare_exchange_weak(
+				&m_seq, &seq, seq + 1,
+				hamon::memory_order::acquire,
+				hamon::memory_order::relaxed))
+			{
+				break;
+			}
+		}
+
+		// 以降の m_ptr と m_word の更新が、m_seq を奇数にするより先に見えないようにする
+		std::atomic_thread_fence(std::memory_order_release);
+		return seq;
+	}
+
+	void end_write(hamon::uintptr_t seq) noexcept
+	{
+		hamon::detail::atomic_store(&m_seq, seq + 2, hamon::memory_order::release);
+	}
+
+	// 書き手の排他中に呼び出す。新しい値に置き換え、以前の m_word の値を返す
+	word_type replace_locked(hamon::uintptr_t ptr, word_type word) noexcept
+	{
+		hamon::detail::atomic_store(&m_ptr, ptr, hamon::memory_order::relaxed);
+		return hamon::detail::atomic_exchange(&m_word, word, hamon::memory_order::acq_rel);
+	}
+
+	// 前払い分から参照を1つ受け取り、受け取る前の m_word の値を word に書き込む。
+	// 前払い分が尽きているときは受け取らずに false を返す
+	bool claim(word_type& word) const noexcept
+	{
+		word = hamon::detail::atomic_load(&m_word, hamon::memory_order::relaxed);
+		for (;;)
+		{
+			if (to_ref_count(word) == nullptr)
+			{
+				// 空の場合は受け取る参照が無い
+				return true;
+			}
+
+			if (to_count(word) >= kBatch)
+			{
+				return false;
+			}
+
+			if (hamon::detail::atomic_compare_exchange_weak(
+				&m_word, &word, word + kCountOne,
+				hamon::memory_order::acquire,
+				hamon::memory_order::relaxed))
+			{
+				return true;
+			}
+		}
+	}
+
+	// 取り出された数が kRefill 以上のときに、参照を受け取った読み手が呼び出す。
+	// 取り出された分だけ制御ブロックに参照を足し、m_word の数を 0 に戻す
+	void refill(hamon::detail::sp_ref_count_base* ref_count) const noexcept
+	{
+		word_type word = hamon::detail::atomic_load(&m_word, hamon::memory_order::relaxed);
+		for (;;)
+		{
+			if (to_ref_count(word) != ref_count || to_count(word) < kRefill)
+			{
+				// 既に別の値に置き換えられているか、他の読み手が補充した
+				return;
+			}
+
+			auto const n = to_count(word);
+			add_refs(ref_count, n);
+			if (hamon::detail::atomic_compare_exchange_weak(
+				&m_word, &word, to_word(ref_count),
+				hamon::memory_order::acq_rel,
+				hamon::memory_order::relaxed))
+			{
+				return;
+			}
+
+			// 呼び出し元が参照を1つ持っているので、ここで破棄されることはない
+			release_refs(ref_count, n);
+		}
+	}
+
+public:
+	using value_type = SP;
+
+	// load は書き手の更新中にやり直すことがあるので、ロックフリーとはしない
+	static HAMON_CXX11_CONSTEXPR bool is_always_lock_free = false;
+
+	HAMON_CXX11_CONSTEXPR
+	atomic_smart_ptr_base() noexcept
+		: m_word(0), m_ptr(0), m_seq(0)
+	{}
+
+	explicit atomic_smart_ptr_base(SP desired) noexcept
+		: m_word(0), m_ptr(from_ptr(desired.m_ptr)), m_seq(0)
+	{
+		m_word = prepare(desired);
+	}
+
+	~atomic_smart_ptr_base()
+	{
+		// 保持している参照を手放す
+		settle(m_ptr, m_word);
+	}
+
+	atomic_smart_ptr_base(atomic_smart_ptr_base const&) = delete;
+	atomic_smart_ptr_base& operator=(atomic_smart_ptr_base const&) = delete;
+
+	bool is_lock_free() const noexcept
+	{
+		return is_always_lock_free;
+	}
+
+	void store(SP desired, hamon::memory_order order = hamon::memory_order::seq_cst) noexcept
+	{
+		// 以前の値は exchange の戻り値として、書き手の排他の外で破棄される
+		this->exchange(hamon::move(desired), order);
+	}
+
+	SP load(hamon::memory_order = hamon::memory_order::seq_cst) const noexcept
+	{
+		for (;;)
+		{
+			auto const seq = hamon::detail::atomic_load(&m_seq, hamon::memory_order::acquire);
+			if (seq & 1)
+			{
+				std::this_thread::yield();
+				continue;
+			}
+
+			// 前払い分から参照を1つ受け取る
+			word_type word;
+			if (!this->claim(word))
+			{
+				// 前払い分が尽きているので、参照を受け取った読み手が補充するのを待つ
+				std::this_thread::yield();
+				continue;
+			}
+			auto const ptr = hamon::detail::atomic_load(&m_ptr, hamon::memory_order::relaxed);
+			std::atomic_thread_fence(std::memory_order_acquire);
+
+			auto const ref_count = to_ref_count(word);
+			if (ref_count != nullptr && to_count(word) >= kRefill)
+			{
+				this->refill(ref_count);
+			}
+
+			if (hamon::detail::atomic_load(&m_seq, hamon::memory_order::relaxed) == seq)
+			{
+				return adopt(to_ptr(ptr), ref_count);
+			}
+
+			// 書き手と重なったので ptr は ref_count と対応していないかもしれない。
+			// 受け取った参照は ref_count のものなので、それを手放してやり直す
+			release_refs(ref_count, 1);
+		}
+	}
+
+	operator SP() const noexcept
+	{
+		return this->load();
+	}
+
+	SP exchange(SP desired, hamon::memory_order = hamon::memory_order::seq_cst) noexcept
+	{
+		auto const new_ptr = from_ptr(desired.m_ptr);
+		auto const new_word = prepare(desired);
+
+		auto const seq = this->begin_write();
+		auto const old_ptr = hamon::detail::atomic_load(&m_ptr, hamon::memory_order::relaxed);
+		auto const old_word = this->replace_locked(new_ptr, new_word);
+		this->end_write(seq);
+
+		return settle(old_ptr, old_word);
+	}
+
+	bool compare_exchange_strong(SP& expected, SP desired,
+		hamon::memory_order, hamon::memory_order) noexcept
+	{
+		auto const seq = this->begin_write();
+		auto const cur_ptr = hamon::detail::atomic_load(&m_ptr, hamon::memory_order::relaxed);
+		auto const cur_ref_count = to_ref_count(hamon::detail::atomic_load(&m_word, hamon::memory_order::relaxed));
+
+		if (to_ptr(cur_ptr) == expected.m_ptr && cur_ref_count == expected.m_ref_count)
+		{
+			// [util.smartptr.atomic.shared]/20
+			// 成功した場合は desired の所有権を移し、以前の値は書き手の排他の外で破棄する
+			auto const new_ptr = from_ptr(desired.m_ptr);
+			auto const old_word = this->replace_locked(new_ptr, prepare(desired));
+			this->end_write(seq);
+			settle(cur_ptr, old_word);
+			return true;
+		}
+
+		// 失敗した場合は現在の値を expected に書き込む。
+		// 書き手を排他している間は現在の値が破棄されることはない。
+		// expected が以前保持していた値は排他の外で破棄する
+		add_refs(cur_ref_count, 1);
+		this->end_write(seq);
+		expected = adopt(to_ptr(cur_ptr), cur_ref_count);
+		return false;
+	}
+
+	bool compare_exchange_weak(SP& expected, SP desired,
+		hamon::memory_order success, hamon::memory_order failure) noexcept
+	{
+		return this->compare_exchange_strong(expected, hamon::move(desired), success, failure);
+	}
+
+	bool compare_exchange_strong(SP& expected, SP desired,
+		hamon::memory_order order = hamon::memory_order::seq_cst) noexcept
+	{
+		return this->compare_exchange_strong(expected, hamon::move(desired), order, order);
+	}
+
+	bool compare_exchange_weak(SP& expected, SP desired,
+		hamon::memory_order order = hamon::memory_order::seq_cst) noexcept
+	{
+		return this->compare_exchange_strong(expected, hamon::move(desired), order, order);
+	}
+
+	void wait(SP old, hamon::memory_order = hamon::memory_order::seq_cst) const noexcept
+	{
+		// 値を置き換えるたびに m_seq が変わるので、m_seq で待機する
+		hamon::detail::atomic_wait(&m_seq, [this, &old]
+		{
+			SP const current = this->load();
+			return current.m_ptr == old.m_ptr && current.m_ref_count == old.m_ref_count;
+		});
+	}
+
+	void notify_one() noexcept
+	{
+		hamon::detail::atomic_notify_one(&m_seq);
+	}
+
+	void notify_all() noexcept
+	{
+		hamon::detail::atomic_notify_all(&m_seq);
+	}
+};
+
+#else
+
+// 20.3.2.6 Atomic specializations for smart pointers[util.smartptr.atomic]
+//
+// 制御ブロックのアドレスの上位ビットを使えない環境での実装。
+// 制御ブロックへのポインタと、そのポインタの最下位ビットを使ったロックフラグを1つの整数に格納する。
+// load はグローバルな mutex を使わず、このビットを立てている間に参照カウントを1つ増やすだけで完了する。
+// ロックを保持する区間では、参照カウントの減少(とそれに伴うオブジェクトの破棄)を行わない。
+template <typename SP>
+struct atomic_smart_ptr_base
+{
+private:
+	using element_type = typename SP::element_type;
+
+	static_assert(alignof(hamon::detail::sp_ref_count_base) >= 2, "");
+
+	static hamon::uintptr_t const kLockBit = 1;
+
+	element_type*	m_ptr;
+	// sp_ref_count_base* | kLockBit
+	mutable hamon::uintptr_t	m_ctrl;
+
+	static hamon::detail::sp_ref_count_base*
+	to_ref_count(hamon::uintptr_t ctrl) noexcept
+	{
+		return reinterpret_cast<hamon::detail::sp_ref_count_base*>(ctrl & ~kLockBit);
+	}
+
+	static hamon::uintptr_t
+	to_ctrl(hamon::detail::sp_ref_count_base* ref_count) noexcept
+	{
+		return reinterpret_cast<hamon::uintptr_t>(ref_count);
+	}
+
+	template <typename T>
+	static void add_ref(hamon::detail::sp_ref_count_base* ref_count, hamon::shared_ptr<T> const*) noexcept
+	{
+		ref_count->increment_use_count();
+	}
+
+	template <typename T>
+	static void add_ref(hamon::detail::sp_ref_count_base* ref_count, hamon::weak_ptr<T> const*) noexcept
+	{
+		ref_count->increment_weak_count();
+	}
+
+	// ロックを取得し、ロックビットを除いた値を返す
+	hamon::uintptr_t lock() const noexcept
+	{
+		hamon::uintptr_t cur = hamon::detail::atomic_load(&m_ctrl, hamon::memory_order::relaxed);
+		for (;;)
+		{
+			if (cur & kLockBit)
+			{
+				std::this_thread::yield();
+				cur = hamon::detail::atomic_load(&m_ctrl, hamon::memory_order::relaxed);
+				continue;
+			}
+
+			if (hamon::detail::atomic_compare_exchange_weak(
+				&m_ctrl, &cur, cur | kLockBit,
+				hamon::memory_order::acquire,
+				hamon::memory_order::relaxed))
+			{
+				return cur;
+			}
+		}
+	}
+
+	void unlock(hamon::uintptr_t ctrl) const noexcept
+	{
+		hamon::detail::atomic_store(&m_ctrl, ctrl, hamon::memory_order::release);
+	}
+
+	// 参照カウントを増やさずに、sp の中身を取り出す
+	static hamon::uintptr_t release(SP& sp) noexcept
+	{
+		auto const ctrl = to_ctrl(sp.m_ref_count);
+		sp.m_ptr = nullptr;
+		sp.m_ref_count = nullptr;
+		return ctrl;
+	}
+
+	// 参照カウントを増やさずに、SP を作る
+	static SP adopt(element_type* ptr, hamon::uintptr_t ctrl) noexcept
+	{
+		SP sp;
+		sp.m_ptr = ptr;
+		sp.m_ref_count = to_ref_count(ctrl);
+		return sp;
+	}
+
+	// ロックを取得している状態で呼び出す
+	SP copy_locked(hamon::uintptr_t ctrl) const noexcept
+	{
+		auto const ref_count = to_ref_count(ctrl);
+		if (ref_count)
+		{
+			add_ref(ref_count, static_cast<SP const*>(nullptr));
+		}
+		return adopt(m_ptr, ctrl);
+	}
+
+	bool equal_locked(hamon::uintptr_t ctrl, SP const& sp) const noexcept
+	{
+		return m_ptr == sp.m_ptr && to_ref_count(ctrl) == sp.m_ref_count;
+	}
+
+public:
+	using value_type = SP;
+
+	static HAMON_CXX11_CONSTEXPR bool is_always_lock_free = false;
+
+	HAMON_CXX11_CONSTEXPR
+	atomic_smart_ptr_base() noexcept
+		: m_ptr(nullptr), m_ctrl(0)
+	{}
+
+	explicit atomic_smart_ptr_base(SP desired) noexcept
+		: m_ptr(desired.m_ptr), m_ctrl(0)
+	{
+		m_ctrl = release(desired);
+	}
+
+	~atomic_smart_ptr_base()
+	{
+		// 保持している参照を手放す
+		adopt(m_ptr, m_ctrl);
+	}
+
+	atomic_smart_ptr_base(atomic_smart_ptr_base const&) = delete;
+	atomic_smart_ptr_base& operator=(atomic_smart_ptr_base const&) = delete;
+
+	bool is_lock_free() const noexcept
+	{
+		return is_always_lock_free;
+	}
+
+	void store(SP desired, hamon::memory_order order = hamon::memory_order::seq_cst) noexcept
+	{
+		// 以前の値は exchange の戻り値として、ロックの外で破棄される
+		this->exchange(hamon::move(desired), order);
+	}
+
+	SP load(hamon::memory_order = hamon::memory_order::seq_cst) const noexcept
+	{
+		auto const ctrl = this->lock();
+		SP result = this->copy_locked(ctrl);
+		this->unlock(ctrl);
+		return result;
+	}
+
+	operator SP() const noexcept
+	{
+		return this->load();
+	}
+
+	SP exchange(SP desired, hamon::memory_order = hamon::memory_order::seq_cst) noexcept
+	{
+		auto const new_ptr = desired.m_ptr;
+		auto const new_ctrl = release(desired);
+
+		auto const ctrl = this->lock();
+		auto const old_ptr = m_ptr;
+		m_ptr = new_ptr;
+		this->unlock(new_ctrl);
+
+		return adopt(old_ptr, ctrl);
+	}
+
+	bool compare_exchange_strong(SP& expected, SP desired,
+		hamon::memory_order, hamon::memory_order) noexcept
+	{
+		auto const ctrl = this->lock();
+
+		if (this->equal_locked(ctrl, expected))
+		{
+			// [util.smartptr.atomic.shared]/20
+			// 成功した場合は desired の所有権を移し、以前の値はロックの外で破棄する
+			auto const old_ptr = m_ptr;
+			m_ptr = desired.m_ptr;
+			this->unlock(release(desired));
+			adopt(old_ptr, ctrl);
+			return true;
+		}
+
+		// 失敗した場合は現在の値を expected に書き込む。
+		// expected が以前保持していた値はロックの外で破棄する
+		SP current = this->copy_locked(ctrl);
+		this->unlock(ctrl);
+		expected = hamon::move(current);
+		return false;
+	}
+
+	bool compare_exchange_weak(SP& expected, SP desired,
+		hamon::memory_order success, hamon::memory_order failure) noexcept
+	{
+		return this->compare_exchange_strong(expected, hamon::move(desired), success, failure);
+	}
+
+	bool compare_exchange_strong(SP& expected, SP desired,
+		hamon::memory_order order = hamon::memory_order::seq_cst) noexcept
+	{
+		return this->compare_exchange_strong(expected, hamon::move(desired), order, order);
+	}
+
+	bool compare_exchange_weak(SP& expected, SP desired,
+		hamon::memory_order order = hamon::memory_order::seq_cst) noexcept
+	{
+		return this->compare_exchange_strong(expected, hamon::move(desired), order, order);
+	}
+
+	void wait(SP old, hamon::memory_order = hamon::memory_order::seq_cst) const noexcept
+	{
+		hamon::detail::atomic_wait(&m_ctrl, [this, &old]
+		{
+			auto const ctrl = this->lock();
+			bool const result = this->equal_locked(ctrl, old);
+			this->unlock(ctrl);
+			return result;
+		});
+	}
+
+	void notify_one() noexcept
+	{
+		hamon::detail::atomic_notify_one(&m_ctrl);
+	}
+
+	void notify_all() noexcept
+	{
+		hamon::detail::atomic_notify_all(&m_ctrl);
+	}
+};
+
+#endif
+
+#if !defined(HAMON_HAS_CXX17_INLINE_VARIABLES)
+
+#if defined(HAMON_MEMORY_ATOMIC_SMART_PTR_SPLIT_COUNT)
+
+template <typename SP>
+constexpr int atomic_smart_ptr_base<SP>::kCountShift;
+
+template <typename SP>
+constexpr typename atomic_smart_ptr_base<SP>::word_type atomic_smart_ptr_base<SP>::kCountOne;
+
+template <typename SP>
+constexpr typename atomic_smart_ptr_base<SP>::word_type atomic_smart_ptr_base<SP>::kPtrMask;
+
+template <typename SP>
+constexpr long atomic_smart_ptr_base<SP>::kBatch;
+
+template <typename SP>
+constexpr long atomic_smart_ptr_base<SP>::kRefill;
+
+#endif
+
+template <typename SP>
+constexpr bool atomic_smart_ptr_base<SP>::is_always_lock_free;
+
+#endif
+
+}	// namespace detail
+
+}	// namespace hamon
+
+#endif // HAMON_MEMORY_DETAIL_ATOMIC_SMART_PTR_BASE_HPP
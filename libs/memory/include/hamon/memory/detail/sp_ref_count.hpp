@@ -11,6 +11,8 @@
 #include <hamon/memory/allocator_traits.hpp>
 #include <hamon/atomic/memory_order.hpp>
 #include <hamon/atomic/detail/atomic_decrement.hpp>
+#include <hamon/atomic/detail/atomic_fetch_add.hpp>
+#include <hamon/atomic/detail/atomic_fetch_sub.hpp>
 #include <hamon/atomic/detail/atomic_increment.hpp>
 #include <hamon/atomic/detail/atomic_load.hpp>
 #include <hamon/atomic/detail/atomic_compare_exchange_weak.hpp>
@@ -44,7 +46,8 @@ private:
 			return ++count;
 		}
 #endif
-		return hamon::detail::atomic_increment(&count);
+		// 参照カウントを増やす側は、既に参照を持っているので順序付けは不要
+		return hamon::detail::atomic_increment(&count, hamon::memory_order::relaxed);
 	}
 
 	template <typename T>
@@ -56,7 +59,8 @@ private:
 			return --count;
 		}
 #endif
-		return hamon::detail::atomic_decrement(&count);
+		// 0 になったスレッドが破棄を行うので、それまでの他のスレッドの操作が見えている必要がある
+		return hamon::detail::atomic_decrement(&count, hamon::memory_order::acq_rel);
 	}
 
 	template <typename T>
@@ -74,7 +78,7 @@ private:
 			return true;
 		}
 #endif
-		T t = hamon::detail::atomic_load(&count);
+		T t = hamon::detail::atomic_load(&count, hamon::memory_order::relaxed);
 		for (;;)
 		{
 			if (t == 0)
@@ -132,6 +136,34 @@ public:
 		}
 	}
 
+	// atomic<shared_ptr<T>> と atomic<weak_ptr<T>> が、参照をまとめて確保・返却するために使う
+	void increment_use_count(long n) noexcept
+	{
+		hamon::detail::atomic_fetch_add(&m_use_count, n, hamon::memory_order::relaxed);
+	}
+
+	void increment_weak_count(long n) noexcept
+	{
+		hamon::detail::atomic_fetch_add(&m_weak_count, n, hamon::memory_order::relaxed);
+	}
+
+	void decrement_use_count(long n) noexcept
+	{
+		if (hamon::detail::atomic_fetch_sub(&m_use_count, n, hamon::memory_order::acq_rel) == n)
+		{
+			this->destroy();
+			this->decrement_weak_count();
+		}
+	}
+
+	void decrement_weak_count(long n) noexcept
+	{
+		if (hamon::detail::atomic_fetch_sub(&m_weak_count, n, hamon::memory_order::acq_rel) == n)
+		{
+			this->delete_this();
+		}
+	}
+
 	template <typename T>
 	HAMON_CXX14_CONSTEXPR T* get_deleter() const noexcept
 	{
@@ -63,6 +63,9 @@ namespace detail
 
 struct sp_access;
 
+template <typename SP>
+struct atomic_smart_ptr_base;
+
 }	// namespace detail
 
 // 20.3.2.2 Class template shared_ptr[util.smartptr.shared]
@@ -598,6 +601,9 @@ private:
 	friend class weak_ptr;
 
 	friend struct hamon::detail::sp_access;
+
+	template <typename SP>
+	friend struct hamon::detail::atomic_smart_ptr_base;
 };
 
 #if defined(HAMON_HAS_CXX17_DEDUCTION_GUIDES)
@@ -797,10 +803,8 @@ operator<<(std::basic_ostream<E, T>& os, shared_ptr<Y> const& p)
 //template <typename T> struct hash<shared_ptr<T>>;
 
 
-//// [util.smartptr.atomic], atomic smart pointers
-//template <typename T> struct atomic;
-//template <typename T> struct atomic<shared_ptr<T>>;
-//template <typename T> struct atomic<weak_ptr<T>>;
+// [util.smartptr.atomic], atomic smart pointers
+// hamon/memory/atomic_shared_ptr.hpp, hamon/memory/atomic_weak_ptr.hpp で定義
 
 namespace detail {
 
@@ -26,6 +26,14 @@
 namespace hamon
 {
 
+namespace detail
+{
+
+template <typename SP>
+struct atomic_smart_ptr_base;
+
+}	// namespace detail
+
 // 20.3.2.3 Class template weak_ptr[util.smartptr.weak]
 template <typename T>
 class weak_ptr
@@ -269,6 +277,9 @@ private:
 
 	template <typename U>
 	friend class shared_ptr;
+
+	template <typename SP>
+	friend struct hamon::detail::atomic_smart_ptr_base;
 };
 
 #if defined(HAMON_HAS_CXX17_DEDUCTION_GUIDES)
@@ -0,0 +1,286 @@
+﻿/**
+ *	@file	unit_test_memory_atomic_shared_ptr.cpp
+ *
+ *	@brief	atomic<shared_ptr<T>> のテスト
+ */
+
+#include <hamon/memory/atomic_shared_ptr.hpp>
+#include <hamon/memory/make_shared.hpp>
+#include <hamon/memory/shared_ptr.hpp>
+#include <hamon/atomic/atomic.hpp>
+#include <hamon/atomic/memory_order.hpp>
+#include <hamon/type_traits/is_copy_constructible.hpp>
+#include <hamon/type_traits/is_copy_assignable.hpp>
+#include <hamon/type_traits/is_same.hpp>
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace hamon_memory_test
+{
+
+namespace atomic_shared_ptr_test
+{
+
+using AtomicSP = hamon::atomic<hamon::shared_ptr<int>>;
+
+static_assert(!hamon::is_copy_constructible<AtomicSP>::value, "");
+static_assert(!hamon::is_copy_assignable<AtomicSP>::value, "");
+static_assert(hamon::is_same<AtomicSP::value_type, hamon::shared_ptr<int>>::value, "");
+
+void test_basic()
+{
+	{
+		AtomicSP a;
+		EXPECT_FALSE(a.is_lock_free());
+		EXPECT_TRUE(a.load() == nullptr);
+	}
+	{
+		AtomicSP a{nullptr};
+		EXPECT_TRUE(a.load() == nullptr);
+	}
+	{
+		auto p = hamon::make_shared<int>(42);
+		AtomicSP a{p};
+		// 格納している間は、atomic が保持する参照 (と load のために前払いした参照) も use_count に含まれる
+		EXPECT_LT(1, p.use_count());
+
+		hamon::shared_ptr<int> q = a;
+		EXPECT_TRUE(q == p);
+		q.reset();
+
+		a.store(hamon::make_shared<int>(43), hamon::memory_order::release);
+		EXPECT_EQ(1, p.use_count());
+		EXPECT_EQ(43, *a.load(hamon::memory_order::acquire));
+
+		a = p;
+		EXPECT_LT(1, p.use_count());
+		EXPECT_EQ(42, *a.load());
+
+		auto r = a.exchange(hamon::make_shared<int>(44));
+		EXPECT_TRUE(r == p);
+		EXPECT_EQ(2, p.use_count());
+		EXPECT_EQ(44, *a.load());
+		r.reset();
+
+		a = nullptr;
+		EXPECT_TRUE(a.load() == nullptr);
+		EXPECT_EQ(1, p.use_count());
+	}
+}
+
+void test_compare_exchange()
+{
+	auto p1 = hamon::make_shared<int>(1);
+	auto p2 = hamon::make_shared<int>(2);
+	AtomicSP a{p1};
+
+	{
+		// 失敗した場合は expected に現在の値が書き込まれる
+		auto expected = p2;
+		EXPECT_FALSE(a.compare_exchange_strong(expected, p2));
+		EXPECT_TRUE(expected == p1);
+	}
+	{
+		// 成功した場合は desired が格納される
+		auto expected = p1;
+		EXPECT_TRUE(a.compare_exchange_strong(expected, p2,
+			hamon::memory_order::acq_rel, hamon::memory_order::acquire));
+		EXPECT_TRUE(expected == p1);
+		EXPECT_TRUE(a.load() == p2);
+	}
+	EXPECT_EQ(1, p1.use_count());
+	{
+		// 同じポインタでも所有権を共有していなければ等しくない
+		hamon::shared_ptr<int> alias(p1, p2.get());
+		auto expected = alias;
+		EXPECT_FALSE(a.compare_exchange_weak(expected, p1));
+		EXPECT_TRUE(expected == p2);
+		EXPECT_FALSE(expected.owner_before(p2) || p2.owner_before(expected));
+	}
+	{
+		auto expected = p2;
+		while (!a.compare_exchange_weak(expected, nullptr)) {}
+		EXPECT_TRUE(a.load() == nullptr);
+	}
+	EXPECT_EQ(1, p2.use_count());
+}
+
+void test_multi_thread()
+{
+	// 読み込みが多い状況で、load した値が常に有効であることを確認する
+	AtomicSP a{hamon::make_shared<int>(0)};
+	AtomicSP counter{hamon::make_shared<int>(0)};
+
+	int const kReaders = 4;
+	int const kWriters = 2;
+	int const kIterations = 2000;
+
+	std::thread readers[kReaders];
+	std::thread writers[kWriters];
+
+	for (auto& t : readers)
+	{
+		t = std::thread([&]
+		{
+			int last = 0;
+			for (int i = 0; i < kIterations * 4; ++i)
+			{
+				auto p = a.load();
+				EXPECT_TRUE(p != nullptr);
+				// 書き込み側は値を増やしていくだけなので、値が戻ることはない
+				EXPECT_LE(last, *p);
+				last = *p;
+			}
+		});
+	}
+
+	for (auto& t : writers)
+	{
+		t = std::thread([&]
+		{
+			for (int i = 0; i < kIterations; ++i)
+			{
+				auto expected = counter.load();
+				while (!counter.compare_exchange_weak(expected, hamon::make_shared<int>(*expected + 1)))
+				{
+				}
+
+				auto cur = a.load();
+				while (!a.compare_exchange_weak(cur, hamon::make_shared<int>(*cur + 1)))
+				{
+				}
+			}
+		});
+	}
+
+	for (auto& t : readers)
+	{
+		t.join();
+	}
+
+	for (auto& t : writers)
+	{
+		t.join();
+	}
+
+	EXPECT_EQ(kWriters * kIterations, *counter.load());
+	EXPECT_EQ(kWriters * kIterations, *a.load());
+	// 取り出した参照が過不足なく返却されていること
+	EXPECT_EQ(1, a.exchange(nullptr).use_count());
+}
+
+void test_prepaid_refs()
+{
+	// 前払いした参照を何度も使い切るだけ load しても、参照カウントが正しく保たれることを確認する
+	auto p = hamon::make_shared<int>(1);
+	AtomicSP a{p};
+
+	{
+		hamon::shared_ptr<int> copies[1000];
+		for (int i = 0; i < 100; ++i)
+		{
+			for (auto& c : copies)
+			{
+				c = a.load();
+			}
+		}
+
+		for (auto& c : copies)
+		{
+			EXPECT_TRUE(c == p);
+		}
+
+		// 値を置き換えると前払い分が返却され、正確な数になる
+		a.store(nullptr);
+		EXPECT_EQ(1001, p.use_count());
+	}
+	EXPECT_EQ(1, p.use_count());
+
+	{
+		AtomicSP b{p};
+		for (int i = 0; i < 100000; ++i)
+		{
+			auto q = b.load();
+			(void)q;
+		}
+	}
+	EXPECT_EQ(1, p.use_count());
+
+	{
+		// 複数の読み手が参照を保持したまま load を繰り返す。
+		// 合計は前払いする数と16ビットの上限を超えるが、前払い分を超えて受け取ることはない
+		int const kThreads = 8;
+		int const kCopies = 10000;
+		AtomicSP b{p};
+		std::vector<std::vector<hamon::shared_ptr<int>>> copies(kThreads);
+		std::vector<std::thread> threads;
+		for (int i = 0; i < kThreads; ++i)
+		{
+			threads.emplace_back([&b, &copies, i]
+			{
+				auto& v = copies[static_cast<std::size_t>(i)];
+				v.reserve(kCopies);
+				for (int j = 0; j < kCopies; ++j)
+				{
+					v.push_back(b.load());
+				}
+			});
+		}
+		for (auto& t : threads)
+		{
+			t.join();
+		}
+
+		for (auto const& v : copies)
+		{
+			for (auto const& c : v)
+			{
+				EXPECT_TRUE(c == p);
+			}
+		}
+
+		b.store(nullptr);
+		EXPECT_EQ(1 + kThreads * kCopies, p.use_count());
+	}
+	EXPECT_EQ(1, p.use_count());
+}
+
+void test_wait_notify()
+{
+	auto p1 = hamon::make_shared<int>(1);
+	auto p2 = hamon::make_shared<int>(2);
+	AtomicSP a{p1};
+
+	std::thread t([&]
+	{
+		a.wait(p1);
+		EXPECT_TRUE(a.load() == p2);
+		a.store(nullptr);
+		a.notify_one();
+	});
+
+	a.store(p2);
+	a.notify_all();
+	a.wait(p2);
+	EXPECT_TRUE(a.load() == nullptr);
+
+	t.join();
+
+	// 値が異なっていればすぐに戻る
+	a.wait(p1, hamon::memory_order::acquire);
+}
+
+GTEST_TEST(MemoryTest, AtomicSharedPtrTest)
+{
+	test_basic();
+	test_compare_exchange();
+	test_multi_thread();
+	test_prepaid_refs();
+	test_wait_notify();
+}
+
+}	// namespace atomic_shared_ptr_test
+
+}	// namespace hamon_memory_test
@@ -0,0 +1,142 @@
+﻿/**
+ *	@file	unit_test_memory_atomic_weak_ptr.cpp
+ *
+ *	@brief	atomic<weak_ptr<T>> のテスト
+ */
+
+#include <hamon/memory/atomic_weak_ptr.hpp>
+#include <hamon/memory/make_shared.hpp>
+#include <hamon/memory/shared_ptr.hpp>
+#include <hamon/memory/weak_ptr.hpp>
+#include <hamon/atomic/atomic.hpp>
+#include <hamon/atomic/memory_order.hpp>
+#include <hamon/type_traits/is_copy_constructible.hpp>
+#include <hamon/type_traits/is_copy_assignable.hpp>
+#include <hamon/type_traits/is_same.hpp>
+#include <gtest/gtest.h>
+#include <thread>
+
+namespace hamon_memory_test
+{
+
+namespace atomic_weak_ptr_test
+{
+
+using AtomicWP = hamon::atomic<hamon::weak_ptr<int>>;
+
+static_assert(!hamon::is_copy_constructible<AtomicWP>::value, "");
+static_assert(!hamon::is_copy_assignable<AtomicWP>::value, "");
+static_assert(hamon::is_same<AtomicWP::value_type, hamon::weak_ptr<int>>::value, "");
+
+bool same_owner(hamon::weak_ptr<int> const& a, hamon::weak_ptr<int> const& b)
+{
+	return !a.owner_before(b) && !b.owner_before(a);
+}
+
+void test_basic()
+{
+	auto p1 = hamon::make_shared<int>(1);
+	auto p2 = hamon::make_shared<int>(2);
+
+	AtomicWP a;
+	EXPECT_FALSE(a.is_lock_free());
+	EXPECT_TRUE(a.load().expired());
+
+	a = p1;
+	EXPECT_EQ(1, *a.load().lock());
+	EXPECT_EQ(1, p1.use_count());
+
+	a.store(p2, hamon::memory_order::release);
+	EXPECT_EQ(2, *a.load(hamon::memory_order::acquire).lock());
+
+	hamon::weak_ptr<int> w = a;
+	EXPECT_TRUE(same_owner(w, p2));
+
+	auto old = a.exchange(p1);
+	EXPECT_TRUE(same_owner(old, p2));
+	EXPECT_TRUE(same_owner(a.load(), p1));
+
+	// 所有しているオブジェクトが破棄されると expired になる
+	p1.reset();
+	EXPECT_TRUE(a.load().expired());
+}
+
+void test_compare_exchange()
+{
+	auto p1 = hamon::make_shared<int>(1);
+	auto p2 = hamon::make_shared<int>(2);
+	AtomicWP a{p1};
+
+	hamon::weak_ptr<int> expected = p2;
+	EXPECT_FALSE(a.compare_exchange_strong(expected, p2));
+	EXPECT_TRUE(same_owner(expected, p1));
+
+	EXPECT_TRUE(a.compare_exchange_strong(expected, p2,
+		hamon::memory_order::acq_rel, hamon::memory_order::acquire));
+	EXPECT_TRUE(same_owner(a.load(), p2));
+
+	expected = p2;
+	while (!a.compare_exchange_weak(expected, hamon::weak_ptr<int>{})) {}
+	EXPECT_TRUE(a.load().expired());
+}
+
+void test_multi_thread()
+{
+	auto p = hamon::make_shared<int>(42);
+	AtomicWP a{p};
+
+	std::thread readers[4];
+	for (auto& t : readers)
+	{
+		t = std::thread([&]
+		{
+			for (int i = 0; i < 5000; ++i)
+			{
+				auto sp = a.load().lock();
+				EXPECT_TRUE(sp == nullptr || *sp == 42);
+			}
+		});
+	}
+
+	for (int i = 0; i < 5000; ++i)
+	{
+		a.store(i % 2 == 0 ? hamon::weak_ptr<int>{} : hamon::weak_ptr<int>{p});
+	}
+
+	for (auto& t : readers)
+	{
+		t.join();
+	}
+
+	EXPECT_EQ(1, p.use_count());
+}
+
+void test_wait_notify()
+{
+	auto p1 = hamon::make_shared<int>(1);
+	auto p2 = hamon::make_shared<int>(2);
+	AtomicWP a{p1};
+
+	std::thread t([&]
+	{
+		a.wait(p1);
+		EXPECT_TRUE(same_owner(a.load(), p2));
+	});
+
+	a.store(p2);
+	a.notify_one();
+
+	t.join();
+}
+
+GTEST_TEST(MemoryTest, AtomicWeakPtrTest)
+{
+	test_basic();
+	test_compare_exchange();
+	test_multi_thread();
+	test_wait_notify();
+}
+
+}	// namespace atomic_weak_ptr_test
+
+}	// namespace hamon_memory_test
@@ -7,6 +7,7 @@
 #ifndef HAMON_QVM_HPP
 #define HAMON_QVM_HPP
 
+#include <hamon/qvm/batch.hpp>
 #include <hamon/qvm/common.hpp>
 #include <hamon/qvm/matrix.hpp>
 #include <hamon/qvm/quaternion.hpp>
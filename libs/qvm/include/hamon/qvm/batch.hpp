@@ -0,0 +1,18 @@
+﻿/**
+ *	@file	batch.hpp
+ *
+ *	@brief	複数の vector, quaternion をまとめて処理する関数
+ */
+
+#ifndef HAMON_QVM_BATCH_HPP
+#define HAMON_QVM_BATCH_HPP
+
+#include <hamon/qvm/batch/cross.hpp>
+#include <hamon/qvm/batch/dot.hpp>
+#include <hamon/qvm/batch/lerp.hpp>
+#include <hamon/qvm/batch/normalize.hpp>
+#include <hamon/qvm/batch/slerp.hpp>
+#include <hamon/qvm/batch/transform_normals.hpp>
+#include <hamon/qvm/batch/transform_points.hpp>
+
+#endif // HAMON_QVM_BATCH_HPP
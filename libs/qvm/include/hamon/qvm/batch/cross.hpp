@@ -0,0 +1,109 @@
+﻿/**
+ *	@file	cross.hpp
+ *
+ *	@brief	cross の定義
+ */
+
+#ifndef HAMON_QVM_BATCH_CROSS_HPP
+#define HAMON_QVM_BATCH_CROSS_HPP
+
+#include <hamon/qvm/batch/detail/batch_soa.hpp>
+#include <hamon/qvm/detail/simd/simd_vec4.hpp>
+#include <hamon/qvm/vector/vector.hpp>
+#include <hamon/qvm/vector/cross.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/span.hpp>
+#include <hamon/type_traits/bool_constant.hpp>
+#include <hamon/type_traits/type_identity.hpp>
+#include <hamon/assert.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+namespace qvm
+{
+
+namespace batch
+{
+
+namespace detail
+{
+
+template <typename T>
+inline void
+cross_impl(
+	hamon::span<vector<T, 3> const> a,
+	hamon::span<vector<T, 3> const> b,
+	hamon::span<vector<T, 3>> out,
+	hamon::false_type) HAMON_NOEXCEPT
+{
+	for (hamon::size_t i = 0; i < out.size(); ++i)
+	{
+		out[i] = hamon::qvm::cross(a[i], b[i]);
+	}
+}
+
+template <typename T>
+inline void
+cross_impl(
+	hamon::span<vector<T, 3> const> a,
+	hamon::span<vector<T, 3> const> b,
+	hamon::span<vector<T, 3>> out,
+	hamon::true_type) HAMON_NOEXCEPT
+{
+	using V = hamon::qvm::detail::simd_vec4<T>;
+	using soa = detail::batch_soa3<T>;
+
+	hamon::size_t const n = out.size();
+	hamon::size_t i = 0;
+	for (; i + 4 <= n; i += 4)
+	{
+		soa const va = soa::load(a.data() + i);
+		soa const vb = soa::load(b.data() + i);
+		soa const r =
+		{
+			V::sub(V::mul(va.y, vb.z), V::mul(va.z, vb.y)),
+			V::sub(V::mul(va.z, vb.x), V::mul(va.x, vb.z)),
+			V::sub(V::mul(va.x, vb.y), V::mul(va.y, vb.x)),
+		};
+		r.store(out.data() + i);
+	}
+
+	for (; i < n; ++i)
+	{
+		out[i] = hamon::qvm::cross(a[i], b[i]);
+	}
+}
+
+}	// namespace detail
+
+/**
+ *	@brief	複数の vector の外積をまとめて計算します
+ *
+ *	@param	a	vector の配列
+ *	@param	b	vector の配列
+ *	@param	out	結果を格納する配列
+ *
+ *	out[i] = cross(a[i], b[i]) を計算する。a, b, out の要素数は同じでなければならない。
+ *	out は a または b と同じ範囲でもよいが、一部だけが重なっていてはいけない。
+ */
+template <typename T>
+inline void
+cross(
+	hamon::type_identity_t<hamon::span<vector<T, 3> const>> a,
+	hamon::type_identity_t<hamon::span<vector<T, 3> const>> b,
+	hamon::span<vector<T, 3>> out) HAMON_NOEXCEPT
+{
+	HAMON_ASSERT(a.size() == out.size());
+	HAMON_ASSERT(b.size() == out.size());
+	detail::cross_impl(a, b, out, hamon::qvm::detail::simd_vec4<T>{});
+}
+
+}	// namespace batch
+
+}	// namespace qvm
+
+}	// namespace hamon
+
+#endif // HAMON_QVM_BATCH_CROSS_HPP
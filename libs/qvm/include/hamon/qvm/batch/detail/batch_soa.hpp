@@ -0,0 +1,125 @@
+﻿/**
+ *	@file	batch_soa.hpp
+ *
+ *	@brief	batch_soa3, batch_soa4 の定義
+ */
+
+#ifndef HAMON_QVM_BATCH_DETAIL_BATCH_SOA_HPP
+#define HAMON_QVM_BATCH_DETAIL_BATCH_SOA_HPP
+
+#include <hamon/qvm/detail/simd/simd_vec4.hpp>
+#include <hamon/qvm/quaternion/quaternion.hpp>
+#include <hamon/qvm/vector/vector.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+namespace qvm
+{
+
+namespace batch
+{
+
+namespace detail
+{
+
+/**
+ *	@brief	要素数3の vector 4つを SoA 形式で保持する
+ *
+ *	x, y, z のそれぞれが、4つの vector の同じ成分を並べた SIMD レジスタになる。
+ */
+template <typename T>
+struct batch_soa3
+{
+	using V = hamon::qvm::detail::simd_vec4<T>;
+	using reg = typename V::type;
+
+	reg x;
+	reg y;
+	reg z;
+
+	static batch_soa3 load(vector<T, 3> const* p) HAMON_NOEXCEPT
+	{
+		T xs[4];
+		T ys[4];
+		T zs[4];
+		for (hamon::size_t k = 0; k < 4; ++k)
+		{
+			xs[k] = p[k][0];
+			ys[k] = p[k][1];
+			zs[k] = p[k][2];
+		}
+		return { V::load(xs), V::load(ys), V::load(zs) };
+	}
+
+	void store(vector<T, 3>* p) const HAMON_NOEXCEPT
+	{
+		T xs[4];
+		T ys[4];
+		T zs[4];
+		V::store(xs, x);
+		V::store(ys, y);
+		V::store(zs, z);
+		for (hamon::size_t k = 0; k < 4; ++k)
+		{
+			p[k][0] = xs[k];
+			p[k][1] = ys[k];
+			p[k][2] = zs[k];
+		}
+	}
+};
+
+/**
+ *	@brief	quaternion 4つを SoA 形式で保持する
+ *
+ *	quaternion は要素数4なので、4つ読み込んでレジスタ上で転置する。
+ */
+template <typename T>
+struct batch_soa4
+{
+	using V = hamon::qvm::detail::simd_vec4<T>;
+	using reg = typename V::type;
+
+	reg x;
+	reg y;
+	reg z;
+	reg w;
+
+	static batch_soa4 load(quaternion<T> const* p) HAMON_NOEXCEPT
+	{
+		batch_soa4 r =
+		{
+			V::load(p[0].data()),
+			V::load(p[1].data()),
+			V::load(p[2].data()),
+			V::load(p[3].data()),
+		};
+		V::transpose(r.x, r.y, r.z, r.w);
+		return r;
+	}
+
+	void store(quaternion<T>* p) const HAMON_NOEXCEPT
+	{
+		reg r0 = x;
+		reg r1 = y;
+		reg r2 = z;
+		reg r3 = w;
+		V::transpose(r0, r1, r2, r3);
+		V::store(p[0].data(), r0);
+		V::store(p[1].data(), r1);
+		V::store(p[2].data(), r2);
+		V::store(p[3].data(), r3);
+	}
+};
+
+}	// namespace detail
+
+}	// namespace batch
+
+}	// namespace qvm
+
+}	// namespace hamon
+
+#endif // HAMON_QVM_BATCH_DETAIL_BATCH_SOA_HPP
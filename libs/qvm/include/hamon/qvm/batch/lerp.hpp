@@ -0,0 +1,129 @@
+﻿/**
+ *	@file	lerp.hpp
+ *
+ *	@brief	lerp の定義
+ */
+
+#ifndef HAMON_QVM_BATCH_LERP_HPP
+#define HAMON_QVM_BATCH_LERP_HPP
+
+#include <hamon/qvm/batch/detail/batch_soa.hpp>
+#include <hamon/qvm/detail/simd/simd_vec4.hpp>
+#include <hamon/qvm/vector/vector.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/span.hpp>
+#include <hamon/type_traits/bool_constant.hpp>
+#include <hamon/type_traits/type_identity.hpp>
+#include <hamon/assert.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+namespace qvm
+{
+
+namespace batch
+{
+
+namespace detail
+{
+
+template <typename T>
+inline vector<T, 3>
+lerp_one(vector<T, 3> const& a, vector<T, 3> const& b, T t) HAMON_NOEXCEPT
+{
+	return
+	{
+		a[0] + t * (b[0] - a[0]),
+		a[1] + t * (b[1] - a[1]),
+		a[2] + t * (b[2] - a[2]),
+	};
+}
+
+template <typename T>
+inline void
+lerp_impl(
+	hamon::span<vector<T, 3> const> a,
+	hamon::span<vector<T, 3> const> b,
+	T t,
+	hamon::span<vector<T, 3>> out,
+	hamon::false_type) HAMON_NOEXCEPT
+{
+	for (hamon::size_t i = 0; i < out.size(); ++i)
+	{
+		out[i] = lerp_one(a[i], b[i], t);
+	}
+}
+
+template <typename T>
+inline void
+lerp_impl(
+	hamon::span<vector<T, 3> const> a,
+	hamon::span<vector<T, 3> const> b,
+	T t,
+	hamon::span<vector<T, 3>> out,
+	hamon::true_type) HAMON_NOEXCEPT
+{
+	using V = hamon::qvm::detail::simd_vec4<T>;
+	using soa = detail::batch_soa3<T>;
+
+	auto const vt = V::set1(t);
+
+	hamon::size_t const n = out.size();
+	hamon::size_t i = 0;
+	for (; i + 4 <= n; i += 4)
+	{
+		soa const va = soa::load(a.data() + i);
+		soa const vb = soa::load(b.data() + i);
+		soa const r =
+		{
+			V::add(va.x, V::mul(vt, V::sub(vb.x, va.x))),
+			V::add(va.y, V::mul(vt, V::sub(vb.y, va.y))),
+			V::add(va.z, V::mul(vt, V::sub(vb.z, va.z))),
+		};
+		r.store(out.data() + i);
+	}
+
+	for (; i < n; ++i)
+	{
+		out[i] = lerp_one(a[i], b[i], t);
+	}
+}
+
+}	// namespace detail
+
+/**
+ *	@brief	複数の vector をまとめて線形補間します
+ *
+ *	@param	a	開始 vector の配列
+ *	@param	b	終了 vector の配列
+ *	@param	t	補間係数
+ *	@param	out	結果を格納する配列
+ *
+ *	out[i] = a[i] + t * (b[i] - a[i]) を計算する。
+ *	hamon::lerp と違い、t == 1 のときに結果が b[i] と厳密に一致することは保証しない。
+ *
+ *	a, b, out の要素数は同じでなければならない。
+ *	out は a または b と同じ範囲でもよいが、一部だけが重なっていてはいけない。
+ */
+template <typename T>
+inline void
+lerp(
+	hamon::type_identity_t<hamon::span<vector<T, 3> const>> a,
+	hamon::type_identity_t<hamon::span<vector<T, 3> const>> b,
+	hamon::type_identity_t<T> t,
+	hamon::span<vector<T, 3>> out) HAMON_NOEXCEPT
+{
+	HAMON_ASSERT(a.size() == out.size());
+	HAMON_ASSERT(b.size() == out.size());
+	detail::lerp_impl(a, b, t, out, hamon::qvm::detail::simd_vec4<T>{});
+}
+
+}	// namespace batch
+
+}	// namespace qvm
+
+}	// namespace hamon
+
+#endif // HAMON_QVM_BATCH_LERP_HPP
@@ -0,0 +1,190 @@
+﻿/**
+ *	@file	normalize.hpp
+ *
+ *	@brief	normalize の定義
+ */
+
+#ifndef HAMON_QVM_BATCH_NORMALIZE_HPP
+#define HAMON_QVM_BATCH_NORMALIZE_HPP
+
+#include <hamon/qvm/batch/detail/batch_soa.hpp>
+#include <hamon/qvm/detail/simd/simd_vec4.hpp>
+#include <hamon/qvm/quaternion/quaternion.hpp>
+#include <hamon/qvm/quaternion/normalize.hpp>
+#include <hamon/qvm/quaternion/operators.hpp>
+#include <hamon/qvm/vector/vector.hpp>
+#include <hamon/qvm/vector/normalize.hpp>
+#include <hamon/qvm/vector/operators.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/span.hpp>
+#include <hamon/type_traits/bool_constant.hpp>
+#include <hamon/type_traits/type_identity.hpp>
+#include <hamon/assert.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+namespace qvm
+{
+
+namespace batch
+{
+
+namespace detail
+{
+
+template <typename T>
+inline void
+normalize_impl(
+	hamon::span<vector<T, 3> const> in,
+	hamon::span<vector<T, 3>> out,
+	hamon::false_type) HAMON_NOEXCEPT
+{
+	for (hamon::size_t i = 0; i < out.size(); ++i)
+	{
+		out[i] = hamon::qvm::normalize(in[i]);
+	}
+}
+
+template <typename T>
+inline void
+normalize_impl(
+	hamon::span<vector<T, 3> const> in,
+	hamon::span<vector<T, 3>> out,
+	hamon::true_type) HAMON_NOEXCEPT
+{
+	using V = hamon::qvm::detail::simd_vec4<T>;
+	using soa = detail::batch_soa3<T>;
+
+	hamon::size_t const n = out.size();
+	hamon::size_t i = 0;
+	for (; i + 4 <= n; i += 4)
+	{
+		soa const v = soa::load(in.data() + i);
+		auto const lsq = V::add(V::add(V::mul(v.x, v.x), V::mul(v.y, v.y)), V::mul(v.z, v.z));
+		auto const len = V::sqrt(lsq);
+		soa const r = { V::div(v.x, len), V::div(v.y, len), V::div(v.z, len) };
+		r.store(out.data() + i);
+
+		// 長さが 0 の要素は、スカラー版と同じくゼロベクトルにする
+		T l[4];
+		V::store(l, lsq);
+		for (hamon::size_t k = 0; k < 4; ++k)
+		{
+			if (l[k] == 0)
+			{
+				out[i + k] = vector<T, 3>{};
+			}
+		}
+	}
+
+	for (; i < n; ++i)
+	{
+		out[i] = hamon::qvm::normalize(in[i]);
+	}
+}
+
+template <typename T>
+inline void
+normalize_impl(
+	hamon::span<quaternion<T> const> in,
+	hamon::span<quaternion<T>> out,
+	hamon::false_type) HAMON_NOEXCEPT
+{
+	for (hamon::size_t i = 0; i < out.size(); ++i)
+	{
+		out[i] = hamon::qvm::normalize(in[i]);
+	}
+}
+
+template <typename T>
+inline void
+normalize_impl(
+	hamon::span<quaternion<T> const> in,
+	hamon::span<quaternion<T>> out,
+	hamon::true_type) HAMON_NOEXCEPT
+{
+	using V = hamon::qvm::detail::simd_vec4<T>;
+	using soa = detail::batch_soa4<T>;
+
+	hamon::size_t const n = out.size();
+	hamon::size_t i = 0;
+	for (; i + 4 <= n; i += 4)
+	{
+		soa const q = soa::load(in.data() + i);
+		auto const lsq = V::add(V::add(V::add(
+			V::mul(q.x, q.x), V::mul(q.y, q.y)), V::mul(q.z, q.z)), V::mul(q.w, q.w));
+		auto const len = V::sqrt(lsq);
+		soa const r = { V::div(q.x, len), V::div(q.y, len), V::div(q.z, len), V::div(q.w, len) };
+		r.store(out.data() + i);
+
+		// 長さが 0 の要素は、スカラー版と同じく単位クォータニオンにする
+		T l[4];
+		V::store(l, lsq);
+		for (hamon::size_t k = 0; k < 4; ++k)
+		{
+			if (l[k] == 0)
+			{
+				out[i + k] = quaternion<T>::identity();
+			}
+		}
+	}
+
+	for (; i < n; ++i)
+	{
+		out[i] = hamon::qvm::normalize(in[i]);
+	}
+}
+
+}	// namespace detail
+
+/**
+ *	@brief	複数の vector をまとめて正規化します
+ *
+ *	@param	in	正規化する vector の配列
+ *	@param	out	結果を格納する配列
+ *
+ *	out[i] = normalize(in[i]) を計算する。長さが 0 の要素はゼロベクトルになる。
+ *
+ *	in と out の要素数は同じでなければならない。
+ *	in と out は同じ範囲でもよいが、一部だけが重なっていてはいけない。
+ */
+template <typename T>
+inline void
+normalize(
+	hamon::type_identity_t<hamon::span<vector<T, 3> const>> in,
+	hamon::span<vector<T, 3>> out) HAMON_NOEXCEPT
+{
+	HAMON_ASSERT(in.size() == out.size());
+	detail::normalize_impl(in, out, hamon::qvm::detail::simd_vec4<T>{});
+}
+
+/**
+ *	@brief	複数の quaternion をまとめて正規化します
+ *
+ *	@param	in	正規化する quaternion の配列
+ *	@param	out	結果を格納する配列
+ *
+ *	out[i] = normalize(in[i]) を計算する。長さが 0 の要素は単位クォータニオンになる。
+ *
+ *	in と out の要素数は同じでなければならない。
+ *	in と out は同じ範囲でもよいが、一部だけが重なっていてはいけない。
+ */
+template <typename T>
+inline void
+normalize(
+	hamon::type_identity_t<hamon::span<quaternion<T> const>> in,
+	hamon::span<quaternion<T>> out) HAMON_NOEXCEPT
+{
+	HAMON_ASSERT(in.size() == out.size());
+	detail::normalize_impl(in, out, hamon::qvm::detail::simd_vec4<T>{});
+}
+
+}	// namespace batch
+
+}	// namespace qvm
+
+}	// namespace hamon
+
+#endif // HAMON_QVM_BATCH_NORMALIZE_HPP
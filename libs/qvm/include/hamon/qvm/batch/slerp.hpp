@@ -0,0 +1,170 @@
+﻿/**
+ *	@file	slerp.hpp
+ *
+ *	@brief	slerp の定義
+ */
+
+#ifndef HAMON_QVM_BATCH_SLERP_HPP
+#define HAMON_QVM_BATCH_SLERP_HPP
+
+#include <hamon/qvm/batch/detail/batch_soa.hpp>
+#include <hamon/qvm/common/lerp.hpp>
+#include <hamon/qvm/detail/simd/simd_vec4.hpp>
+#include <hamon/qvm/quaternion/quaternion.hpp>
+#include <hamon/qvm/quaternion/operators.hpp>
+#include <hamon/qvm/quaternion/slerp.hpp>
+#include <hamon/cmath/acos.hpp>
+#include <hamon/cmath/sin.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/span.hpp>
+#include <hamon/type_traits/bool_constant.hpp>
+#include <hamon/type_traits/type_identity.hpp>
+#include <hamon/assert.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+namespace qvm
+{
+
+namespace batch
+{
+
+namespace detail
+{
+
+template <typename T>
+inline void
+slerp_impl(
+	hamon::span<quaternion<T> const> a,
+	hamon::span<quaternion<T> const> b,
+	T t,
+	hamon::span<quaternion<T>> out,
+	hamon::false_type) HAMON_NOEXCEPT
+{
+	for (hamon::size_t i = 0; i < out.size(); ++i)
+	{
+		out[i] = hamon::qvm::slerp(a[i], b[i], t);
+	}
+}
+
+template <typename T>
+inline void
+slerp_impl(
+	hamon::span<quaternion<T> const> a,
+	hamon::span<quaternion<T> const> b,
+	T t,
+	hamon::span<quaternion<T>> out,
+	hamon::true_type) HAMON_NOEXCEPT
+{
+	using V = hamon::qvm::detail::simd_vec4<T>;
+	using soa = detail::batch_soa4<T>;
+
+	hamon::size_t const n = out.size();
+
+	// t が範囲外のときは全ての要素が端点になる(スカラー版と同じ)
+	if (t <= T(0.0) || t >= T(1.0))
+	{
+		auto const& src = (t <= T(0.0)) ? a : b;
+		for (hamon::size_t i = 0; i < n; ++i)
+		{
+			out[i] = src[i];
+		}
+		return;
+	}
+
+	hamon::size_t i = 0;
+	for (; i + 4 <= n; i += 4)
+	{
+		soa const qa = soa::load(a.data() + i);
+		soa const qb = soa::load(b.data() + i);
+
+		T c[4];
+		V::store(c, V::add(V::add(V::add(
+			V::mul(qa.x, qb.x), V::mul(qa.y, qb.y)), V::mul(qa.z, qb.z)), V::mul(qa.w, qb.w)));
+
+		// 三角関数はスカラーで計算し、補間だけを SIMD で行う。
+		// cos >= 1 の要素はスカラー版と同じく線形補間になるので、別に計算しておく。
+		T ra[4];
+		T rb[4];
+		quaternion<T> fallback[4];
+		bool use_fallback[4];
+		for (hamon::size_t k = 0; k < 4; ++k)
+		{
+			use_fallback[k] = !(c[k] < T(1.0));
+			if (use_fallback[k])
+			{
+				fallback[k] = hamon::qvm::slerp(a[i + k], b[i + k], t);
+				ra[k] = T(0.0);
+				rb[k] = T(0.0);
+				continue;
+			}
+
+			T const half_theta = hamon::acos(c[k]);
+			T const inv_sin_half_theta = T(1.0) / hamon::sin(half_theta);
+			ra[k] = hamon::sin(half_theta * (T(1.0) - t)) * inv_sin_half_theta;
+			rb[k] = hamon::sin(half_theta * t) * inv_sin_half_theta;
+		}
+
+		auto const va = V::load(ra);
+		auto const vb = V::load(rb);
+		soa const r =
+		{
+			V::add(V::mul(qa.x, va), V::mul(qb.x, vb)),
+			V::add(V::mul(qa.y, va), V::mul(qb.y, vb)),
+			V::add(V::mul(qa.z, va), V::mul(qb.z, vb)),
+			V::add(V::mul(qa.w, va), V::mul(qb.w, vb)),
+		};
+		r.store(out.data() + i);
+
+		for (hamon::size_t k = 0; k < 4; ++k)
+		{
+			if (use_fallback[k])
+			{
+				out[i + k] = fallback[k];
+			}
+		}
+	}
+
+	for (; i < n; ++i)
+	{
+		out[i] = hamon::qvm::slerp(a[i], b[i], t);
+	}
+}
+
+}	// namespace detail
+
+/**
+ *	@brief	複数の quaternion をまとめて球面線形補間します
+ *
+ *	@param	a	開始クォータニオンの配列
+ *	@param	b	終了クォータニオンの配列
+ *	@param	t	補間係数
+ *	@param	out	結果を格納する配列
+ *
+ *	out[i] = slerp(a[i], b[i], t) を計算する。
+ *
+ *	a, b, out の要素数は同じでなければならない。
+ *	out は a または b と同じ範囲でもよいが、一部だけが重なっていてはいけない。
+ */
+template <typename T>
+inline void
+slerp(
+	hamon::type_identity_t<hamon::span<quaternion<T> const>> a,
+	hamon::type_identity_t<hamon::span<quaternion<T> const>> b,
+	hamon::type_identity_t<T> t,
+	hamon::span<quaternion<T>> out) HAMON_NOEXCEPT
+{
+	HAMON_ASSERT(a.size() == out.size());
+	HAMON_ASSERT(b.size() == out.size());
+	detail::slerp_impl(a, b, t, out, hamon::qvm::detail::simd_vec4<T>{});
+}
+
+}	// namespace batch
+
+}	// namespace qvm
+
+}	// namespace hamon
+
+#endif // HAMON_QVM_BATCH_SLERP_HPP
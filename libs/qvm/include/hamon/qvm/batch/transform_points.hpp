@@ -0,0 +1,137 @@
+﻿/**
+ *	@file	transform_points.hpp
+ *
+ *	@brief	transform_points の定義
+ */
+
+#ifndef HAMON_QVM_BATCH_TRANSFORM_POINTS_HPP
+#define HAMON_QVM_BATCH_TRANSFORM_POINTS_HPP
+
+#include <hamon/qvm/batch/detail/batch_soa.hpp>
+#include <hamon/qvm/detail/simd/simd_vec4.hpp>
+#include <hamon/qvm/matrix/matrix.hpp>
+#include <hamon/qvm/vector/vector.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/span.hpp>
+#include <hamon/type_traits/bool_constant.hpp>
+#include <hamon/type_traits/type_identity.hpp>
+#include <hamon/assert.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+namespace qvm
+{
+
+namespace batch
+{
+
+namespace detail
+{
+
+template <typename T>
+inline vector<T, 3>
+transform_point(vector<T, 3> const& v, matrix<T, 4, 4> const& m) HAMON_NOEXCEPT
+{
+	return
+	{
+		v[0] * m[0][0] + v[1] * m[1][0] + v[2] * m[2][0] + m[3][0],
+		v[0] * m[0][1] + v[1] * m[1][1] + v[2] * m[2][1] + m[3][1],
+		v[0] * m[0][2] + v[1] * m[1][2] + v[2] * m[2][2] + m[3][2],
+	};
+}
+
+template <typename T>
+inline void
+transform_points_impl(
+	hamon::span<vector<T, 3> const> in,
+	matrix<T, 4, 4> const& m,
+	hamon::span<vector<T, 3>> out,
+	hamon::false_type) HAMON_NOEXCEPT
+{
+	for (hamon::size_t i = 0; i < out.size(); ++i)
+	{
+		out[i] = transform_point(in[i], m);
+	}
+}
+
+template <typename T>
+inline void
+transform_points_impl(
+	hamon::span<vector<T, 3> const> in,
+	matrix<T, 4, 4> const& m,
+	hamon::span<vector<T, 3>> out,
+	hamon::true_type) HAMON_NOEXCEPT
+{
+	using V = hamon::qvm::detail::simd_vec4<T>;
+	using soa = detail::batch_soa3<T>;
+	using reg = typename V::type;
+
+	// 行列の要素はループの外で1度だけ読み込む
+	reg const m00 = V::set1(m[0][0]);
+	reg const m01 = V::set1(m[0][1]);
+	reg const m02 = V::set1(m[0][2]);
+	reg const m10 = V::set1(m[1][0]);
+	reg const m11 = V::set1(m[1][1]);
+	reg const m12 = V::set1(m[1][2]);
+	reg const m20 = V::set1(m[2][0]);
+	reg const m21 = V::set1(m[2][1]);
+	reg const m22 = V::set1(m[2][2]);
+	reg const m30 = V::set1(m[3][0]);
+	reg const m31 = V::set1(m[3][1]);
+	reg const m32 = V::set1(m[3][2]);
+
+	hamon::size_t const n = out.size();
+	hamon::size_t i = 0;
+	for (; i + 4 <= n; i += 4)
+	{
+		soa const v = soa::load(in.data() + i);
+		soa const r =
+		{
+			V::add(V::add(V::add(V::mul(v.x, m00), V::mul(v.y, m10)), V::mul(v.z, m20)), m30),
+			V::add(V::add(V::add(V::mul(v.x, m01), V::mul(v.y, m11)), V::mul(v.z, m21)), m31),
+			V::add(V::add(V::add(V::mul(v.x, m02), V::mul(v.y, m12)), V::mul(v.z, m22)), m32),
+		};
+		r.store(out.data() + i);
+	}
+
+	for (; i < n; ++i)
+	{
+		out[i] = transform_point(in[i], m);
+	}
+}
+
+}	// namespace detail
+
+/**
+ *	@brief	複数の位置ベクトルを1つの行列で変換します
+ *
+ *	@param	in	変換する位置ベクトルの配列
+ *	@param	m	変換行列
+ *	@param	out	結果を格納する配列
+ *
+ *	in の各要素を w = 1 の同次座標として m を掛け、x, y, z を out に格納する。
+ *	m はアフィン変換であることを前提とし、w による除算は行わない。
+ *
+ *	in と out の要素数は同じでなければならない。
+ *	in と out は同じ範囲でもよいが、一部だけが重なっていてはいけない。
+ */
+template <typename T>
+inline void
+transform_points(
+	hamon::type_identity_t<hamon::span<vector<T, 3> const>> in,
+	matrix<T, 4, 4> const& m,
+	hamon::span<vector<T, 3>> out) HAMON_NOEXCEPT
+{
+	HAMON_ASSERT(in.size() == out.size());
+	detail::transform_points_impl(in, m, out, hamon::qvm::detail::simd_vec4<T>{});
+}
+
+}	// namespace batch
+
+}	// namespace qvm
+
+}	// namespace hamon
+
+#endif // HAMON_QVM_BATCH_TRANSFORM_POINTS_HPP
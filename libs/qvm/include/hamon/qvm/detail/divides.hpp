@@ -8,9 +8,13 @@
 #define HAMON_QVM_DETAIL_DIVIDES_HPP
 
 #include <hamon/qvm/detail/transform.hpp>
+#include <hamon/qvm/detail/simd/config.hpp>
+#include <hamon/qvm/detail/simd/simd_transform.hpp>
+#include <hamon/qvm/detail/simd/simd_vec4.hpp>
 #include <hamon/cstddef/size_t.hpp>
 #include <hamon/functional/divides.hpp>
 #include <hamon/type_traits/arithmetic_promote.hpp>
+#include <hamon/type_traits/is_constant_evaluated.hpp>
 #include <hamon/config.hpp>
 
 namespace hamon
@@ -35,6 +39,30 @@ divides(GenType<T, Ns...> const& lhs, GenType<T, Ns...> const& rhs) HAMON_NOEXCE
 	return hamon::qvm::detail::transform(lhs, rhs, hamon::divides<>{});
 }
 
+/**
+ *	@brief	divides
+ *
+ *	要素数が4のときのオーバーロード
+ */
+template <
+	template <typename, hamon::size_t...> class GenType,
+	typename T
+>
+HAMON_NODISCARD inline HAMON_CONSTEXPR GenType<T, 4>
+divides(GenType<T, 4> const& lhs, GenType<T, 4> const& rhs) HAMON_NOEXCEPT
+{
+#if defined(HAMON_QVM_SIMD_DISPATCH)
+	if constexpr (simd_vec4<T>::value)
+	{
+		if (!hamon::is_constant_evaluated())
+		{
+			return hamon::qvm::detail::simd_transform(lhs, rhs, simd_vec4<T>::div);
+		}
+	}
+#endif
+	return hamon::qvm::detail::transform(lhs, rhs, hamon::divides<>{});
+}
+
 /**
  *	@brief	divides
  *
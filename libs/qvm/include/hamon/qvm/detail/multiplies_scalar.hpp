@@ -8,9 +8,13 @@
 #define HAMON_QVM_DETAIL_MULTIPLIES_SCALAR_HPP
 
 #include <hamon/qvm/detail/transform.hpp>
+#include <hamon/qvm/detail/simd/config.hpp>
+#include <hamon/qvm/detail/simd/simd_transform.hpp>
+#include <hamon/qvm/detail/simd/simd_vec4.hpp>
 #include <hamon/cstddef/size_t.hpp>
 #include <hamon/type_traits/arithmetic_promote.hpp>
 #include <hamon/type_traits/enable_if.hpp>
+#include <hamon/type_traits/is_constant_evaluated.hpp>
 #include <hamon/type_traits/is_arithmetic.hpp>
 #include <hamon/config.hpp>
 
@@ -50,6 +54,30 @@ multiplies_scalar(GenType<T1, Ns...> const& lhs, T2 const& rhs) HAMON_NOEXCEPT
 	return hamon::qvm::detail::transform(Promoted{lhs}, multiplies_scalar_fn<T3>{static_cast<T3>(rhs)});
 }
 
+/**
+ *	@brief	multiplies_scalar
+ *
+ *	要素数が4で、スカラーの型が要素の型と同じときのオーバーロード
+ */
+template <
+	template <typename, hamon::size_t...> class GenType,
+	typename T
+>
+HAMON_NODISCARD inline HAMON_CONSTEXPR GenType<T, 4>
+multiplies_scalar(GenType<T, 4> const& lhs, T const& rhs) HAMON_NOEXCEPT
+{
+#if defined(HAMON_QVM_SIMD_DISPATCH)
+	if constexpr (simd_vec4<T>::value)
+	{
+		if (!hamon::is_constant_evaluated())
+		{
+			return hamon::qvm::detail::simd_transform(lhs, rhs, simd_vec4<T>::mul);
+		}
+	}
+#endif
+	return hamon::qvm::detail::transform(lhs, multiplies_scalar_fn<T>{rhs});
+}
+
 }	// namespace detail
 
 }	// namespace qvm
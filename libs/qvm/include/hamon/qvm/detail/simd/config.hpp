@@ -0,0 +1,29 @@
+﻿/**
+ *	@file	config.hpp
+ *
+ *	@brief	qvm の SIMD 実装の設定
+ *
+ *	使用できる命令は <hamon/config.hpp> で判定する。
+ *	HAMON_NO_SIMD を定義すると、SIMD 実装を使用しない。
+ */
+
+#ifndef HAMON_QVM_DETAIL_SIMD_CONFIG_HPP
+#define HAMON_QVM_DETAIL_SIMD_CONFIG_HPP
+
+#include <hamon/config.hpp>
+
+// 定数評価中かどうかを判定できる場合だけ、実行時に SIMD 実装を選択する。
+// 定数評価では今まで通り constexpr の実装を使う。
+#if defined(HAMON_SIMD) && defined(HAMON_HAS_CXX20_IS_CONSTANT_EVALUATED)
+#  define HAMON_QVM_SIMD_DISPATCH
+#endif
+
+#if defined(HAMON_SIMD_AVX)
+#  include <immintrin.h>
+#elif defined(HAMON_SIMD_SSE2)
+#  include <emmintrin.h>
+#elif defined(HAMON_SIMD_NEON)
+#  include <arm_neon.h>
+#endif
+
+#endif // HAMON_QVM_DETAIL_SIMD_CONFIG_HPP
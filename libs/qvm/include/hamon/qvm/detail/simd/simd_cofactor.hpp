@@ -0,0 +1,122 @@
+﻿/**
+ *	@file	simd_cofactor.hpp
+ *
+ *	@brief	simd_cofactor の定義
+ */
+
+#ifndef HAMON_QVM_DETAIL_SIMD_SIMD_COFACTOR_HPP
+#define HAMON_QVM_DETAIL_SIMD_SIMD_COFACTOR_HPP
+
+#include <hamon/qvm/detail/simd/simd_vec4.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+namespace qvm
+{
+
+namespace detail
+{
+
+/**
+ *	@brief	4x4 行列の余因子行列と行列式 (SIMD 実装)
+ *
+ *	Intel AP-928 "Streaming SIMD Extensions - Inverse of 4x4 Matrix" のアルゴリズム。
+ *	cof[i] は余因子行列の転置(= 行列式 * 逆行列)の i 行目、
+ *	det は全要素に行列式が入ったレジスタ。
+ *
+ *	シャッフルは swap_pairs と swap_halves だけを使うので、
+ *	どのバックエンドでも単純な命令で実現できる。
+ */
+template <typename T>
+struct simd_cofactor
+{
+	using V = simd_vec4<T>;
+	using reg = typename V::type;
+
+	reg cof[4];
+	reg det;
+
+	template <
+		template <typename, hamon::size_t, hamon::size_t> class Matrix
+	>
+	explicit simd_cofactor(Matrix<T, 4, 4> const& m) HAMON_NOEXCEPT
+	{
+		reg r0 = V::load(m[0].data());
+		reg r1 = V::load(m[1].data());
+		reg r2 = V::load(m[2].data());
+		reg r3 = V::load(m[3].data());
+		V::transpose(r0, r1, r2, r3);
+		r1 = V::swap_halves(r1);
+		r3 = V::swap_halves(r3);
+
+		reg m0, m1, m2, m3;
+		reg tmp;
+
+		tmp = V::swap_pairs(V::mul(r2, r3));
+		m0 = V::mul(r1, tmp);
+		m1 = V::mul(r0, tmp);
+		tmp = V::swap_halves(tmp);
+		m0 = V::sub(V::mul(r1, tmp), m0);
+		m1 = V::sub(V::mul(r0, tmp), m1);
+		m1 = V::swap_halves(m1);
+
+		tmp = V::swap_pairs(V::mul(r1, r2));
+		m0 = V::add(V::mul(r3, tmp), m0);
+		m3 = V::mul(r0, tmp);
+		tmp = V::swap_halves(tmp);
+		m0 = V::sub(m0, V::mul(r3, tmp));
+		m3 = V::sub(V::mul(r0, tmp), m3);
+		m3 = V::swap_halves(m3);
+
+		tmp = V::swap_pairs(V::mul(V::swap_halves(r1), r3));
+		r2 = V::swap_halves(r2);
+		m0 = V::add(V::mul(r2, tmp), m0);
+		m2 = V::mul(r0, tmp);
+		tmp = V::swap_halves(tmp);
+		m0 = V::sub(m0, V::mul(r2, tmp));
+		m2 = V::sub(V::mul(r0, tmp), m2);
+		m2 = V::swap_halves(m2);
+
+		tmp = V::swap_pairs(V::mul(r0, r1));
+		m2 = V::add(V::mul(r3, tmp), m2);
+		m3 = V::sub(V::mul(r2, tmp), m3);
+		tmp = V::swap_halves(tmp);
+		m2 = V::sub(V::mul(r3, tmp), m2);
+		m3 = V::sub(m3, V::mul(r2, tmp));
+
+		tmp = V::swap_pairs(V::mul(r0, r3));
+		m1 = V::sub(m1, V::mul(r2, tmp));
+		m2 = V::add(V::mul(r1, tmp), m2);
+		tmp = V::swap_halves(tmp);
+		m1 = V::add(V::mul(r2, tmp), m1);
+		m2 = V::sub(m2, V::mul(r1, tmp));
+
+		tmp = V::swap_pairs(V::mul(r0, r2));
+		m1 = V::add(V::mul(r3, tmp), m1);
+		m3 = V::sub(m3, V::mul(r1, tmp));
+		tmp = V::swap_halves(tmp);
+		m1 = V::sub(m1, V::mul(r3, tmp));
+		m3 = V::add(V::mul(r1, tmp), m3);
+
+		reg d = V::mul(r0, m0);
+		d = V::add(V::swap_halves(d), d);
+		d = V::add(V::swap_pairs(d), d);
+
+		cof[0] = m0;
+		cof[1] = m1;
+		cof[2] = m2;
+		cof[3] = m3;
+		det = d;
+	}
+};
+
+}	// namespace detail
+
+}	// namespace qvm
+
+}	// namespace hamon
+
+#endif // HAMON_QVM_DETAIL_SIMD_SIMD_COFACTOR_HPP
@@ -0,0 +1,45 @@
+﻿/**
+ *	@file	simd_determinant.hpp
+ *
+ *	@brief	simd_determinant の定義
+ */
+
+#ifndef HAMON_QVM_DETAIL_SIMD_SIMD_DETERMINANT_HPP
+#define HAMON_QVM_DETAIL_SIMD_SIMD_DETERMINANT_HPP
+
+#include <hamon/qvm/detail/simd/simd_cofactor.hpp>
+#include <hamon/qvm/detail/simd/simd_vec4.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+namespace qvm
+{
+
+namespace detail
+{
+
+/**
+ *	@brief	4x4 行列の行列式 (SIMD 実装)
+ *
+ *	使わない余因子の計算はインライン展開後に取り除かれる。
+ */
+template <
+	template <typename, hamon::size_t, hamon::size_t> class Matrix,
+	typename T
+>
+inline T
+simd_determinant(Matrix<T, 4, 4> const& m) HAMON_NOEXCEPT
+{
+	return simd_vec4<T>::first(simd_cofactor<T>(m).det);
+}
+
+}	// namespace detail
+
+}	// namespace qvm
+
+}	// namespace hamon
+
+#endif // HAMON_QVM_DETAIL_SIMD_SIMD_DETERMINANT_HPP
@@ -0,0 +1,58 @@
+﻿/**
+ *	@file	simd_inverse.hpp
+ *
+ *	@brief	simd_inverse の定義
+ */
+
+#ifndef HAMON_QVM_DETAIL_SIMD_SIMD_INVERSE_HPP
+#define HAMON_QVM_DETAIL_SIMD_SIMD_INVERSE_HPP
+
+#include <hamon/qvm/detail/simd/simd_cofactor.hpp>
+#include <hamon/qvm/detail/simd/simd_vec4.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+namespace qvm
+{
+
+namespace detail
+{
+
+/**
+ *	@brief	4x4 行列の逆行列 (SIMD 実装)
+ *
+ *	スカラー実装と同じく、行列式が 0 のときは単位行列を返す。
+ */
+template <
+	template <typename, hamon::size_t, hamon::size_t> class Matrix,
+	typename T
+>
+inline Matrix<T, 4, 4>
+simd_inverse(Matrix<T, 4, 4> const& m) HAMON_NOEXCEPT
+{
+	using V = simd_vec4<T>;
+
+	simd_cofactor<T> const c(m);
+	if (V::first(c.det) == 0)
+	{
+		return Matrix<T, 4, 4>::identity();
+	}
+
+	Matrix<T, 4, 4> result;
+	V::store(result[0].data(), V::div(c.cof[0], c.det));
+	V::store(result[1].data(), V::div(c.cof[1], c.det));
+	V::store(result[2].data(), V::div(c.cof[2], c.det));
+	V::store(result[3].data(), V::div(c.cof[3], c.det));
+	return result;
+}
+
+}	// namespace detail
+
+}	// namespace qvm
+
+}	// namespace hamon
+
+#endif // HAMON_QVM_DETAIL_SIMD_SIMD_INVERSE_HPP
@@ -0,0 +1,64 @@
+﻿/**
+ *	@file	simd_mul_matrix.hpp
+ *
+ *	@brief	simd_mul_matrix の定義
+ */
+
+#ifndef HAMON_QVM_DETAIL_SIMD_SIMD_MUL_MATRIX_HPP
+#define HAMON_QVM_DETAIL_SIMD_SIMD_MUL_MATRIX_HPP
+
+#include <hamon/qvm/detail/simd/simd_vec4.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+namespace qvm
+{
+
+namespace detail
+{
+
+/**
+ *	@brief	Nx4 行列と 4x4 行列の積 (SIMD 実装)
+ *
+ *	N == 1 のときは vector * matrix になる。
+ *	結果の各行を、左辺の要素をブロードキャストした値と右辺の各行との積の和で求める。
+ *	加算の順番はスカラー実装と同じなので、結果も(ゼロの符号を除いて)一致する。
+ */
+template <
+	template <typename, hamon::size_t, hamon::size_t> class Matrix,
+	typename T, hamon::size_t N
+>
+inline Matrix<T, N, 4>
+simd_mul_matrix(Matrix<T, N, 4> const& lhs, Matrix<T, 4, 4> const& rhs) HAMON_NOEXCEPT
+{
+	using V = simd_vec4<T>;
+	using reg = typename V::type;
+
+	reg const b0 = V::load(rhs[0].data());
+	reg const b1 = V::load(rhs[1].data());
+	reg const b2 = V::load(rhs[2].data());
+	reg const b3 = V::load(rhs[3].data());
+
+	Matrix<T, N, 4> result;
+	for (hamon::size_t i = 0; i < N; ++i)
+	{
+		reg const a = V::load(lhs[i].data());
+		reg r =         V::mul(V::template splat<0>(a), b0);
+		r = V::add(r,   V::mul(V::template splat<1>(a), b1));
+		r = V::add(r,   V::mul(V::template splat<2>(a), b2));
+		r = V::add(r,   V::mul(V::template splat<3>(a), b3));
+		V::store(result[i].data(), r);
+	}
+	return result;
+}
+
+}	// namespace detail
+
+}	// namespace qvm
+
+}	// namespace hamon
+
+#endif // HAMON_QVM_DETAIL_SIMD_SIMD_MUL_MATRIX_HPP
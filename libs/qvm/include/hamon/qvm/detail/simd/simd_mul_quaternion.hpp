@@ -0,0 +1,63 @@
+﻿/**
+ *	@file	simd_mul_quaternion.hpp
+ *
+ *	@brief	simd_mul_quaternion の定義
+ */
+
+#ifndef HAMON_QVM_DETAIL_SIMD_SIMD_MUL_QUATERNION_HPP
+#define HAMON_QVM_DETAIL_SIMD_SIMD_MUL_QUATERNION_HPP
+
+#include <hamon/qvm/detail/simd/simd_vec4.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+namespace qvm
+{
+
+namespace detail
+{
+
+/**
+ *	@brief	クォータニオンの積 (SIMD 実装)
+ *
+ *	lhs.w * rhs + lhs.x * (w,-z, y,-x) + lhs.y * (z, w,-x,-y) + lhs.z * (-y, x, w,-z)
+ *
+ *	項を足す順番と符号の付け方はスカラー実装と同じなので、結果も一致する。
+ */
+template <
+	template <typename, hamon::size_t...> class Quaternion,
+	typename T
+>
+inline Quaternion<T, 4>
+simd_mul_quaternion(Quaternion<T, 4> const& lhs, Quaternion<T, 4> const& rhs) HAMON_NOEXCEPT
+{
+	using V = simd_vec4<T>;
+	using reg = typename V::type;
+
+	reg const a = V::load(lhs.data());
+	reg const b = V::load(rhs.data());
+
+	reg const bx = V::mul(V::swap_pairs(V::swap_halves(b)), V::set( 1, -1,  1, -1));
+	reg const by = V::mul(V::swap_halves(b),                V::set( 1,  1, -1, -1));
+	reg const bz = V::mul(V::swap_pairs(b),                 V::set(-1,  1,  1, -1));
+
+	reg r =       V::mul(V::template splat<3>(a), b);
+	r = V::add(r, V::mul(V::template splat<0>(a), bx));
+	r = V::add(r, V::mul(V::template splat<1>(a), by));
+	r = V::add(r, V::mul(V::template splat<2>(a), bz));
+
+	Quaternion<T, 4> result;
+	V::store(result.data(), r);
+	return result;
+}
+
+}	// namespace detail
+
+}	// namespace qvm
+
+}	// namespace hamon
+
+#endif // HAMON_QVM_DETAIL_SIMD_SIMD_MUL_QUATERNION_HPP
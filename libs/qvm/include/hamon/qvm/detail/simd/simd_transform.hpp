@@ -0,0 +1,63 @@
+﻿/**
+ *	@file	simd_transform.hpp
+ *
+ *	@brief	simd_transform の定義
+ */
+
+#ifndef HAMON_QVM_DETAIL_SIMD_SIMD_TRANSFORM_HPP
+#define HAMON_QVM_DETAIL_SIMD_SIMD_TRANSFORM_HPP
+
+#include <hamon/qvm/detail/simd/simd_vec4.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+namespace qvm
+{
+
+namespace detail
+{
+
+/**
+ *	@brief	要素4つの vector, quaternion の要素ごとの演算 (SIMD 実装)
+ *
+ *	binary_op は simd_vec4<T>::add などの、レジスタ2つを受け取る関数
+ */
+template <
+	template <typename, hamon::size_t...> class GenType,
+	typename T, typename F
+>
+inline GenType<T, 4>
+simd_transform(GenType<T, 4> const& lhs, GenType<T, 4> const& rhs, F binary_op) HAMON_NOEXCEPT
+{
+	using V = simd_vec4<T>;
+	GenType<T, 4> result;
+	V::store(result.data(), binary_op(V::load(lhs.data()), V::load(rhs.data())));
+	return result;
+}
+
+/**
+ *	@brief	要素4つの vector, quaternion とスカラーの演算 (SIMD 実装)
+ */
+template <
+	template <typename, hamon::size_t...> class GenType,
+	typename T, typename F
+>
+inline GenType<T, 4>
+simd_transform(GenType<T, 4> const& lhs, T const& rhs, F binary_op) HAMON_NOEXCEPT
+{
+	using V = simd_vec4<T>;
+	GenType<T, 4> result;
+	V::store(result.data(), binary_op(V::load(lhs.data()), V::set1(rhs)));
+	return result;
+}
+
+}	// namespace detail
+
+}	// namespace qvm
+
+}	// namespace hamon
+
+#endif // HAMON_QVM_DETAIL_SIMD_SIMD_TRANSFORM_HPP
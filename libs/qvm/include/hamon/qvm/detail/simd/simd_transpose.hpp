@@ -0,0 +1,56 @@
+﻿/**
+ *	@file	simd_transpose.hpp
+ *
+ *	@brief	simd_transpose の定義
+ */
+
+#ifndef HAMON_QVM_DETAIL_SIMD_SIMD_TRANSPOSE_HPP
+#define HAMON_QVM_DETAIL_SIMD_SIMD_TRANSPOSE_HPP
+
+#include <hamon/qvm/detail/simd/simd_vec4.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+namespace qvm
+{
+
+namespace detail
+{
+
+/**
+ *	@brief	4x4 行列の転置 (SIMD 実装)
+ */
+template <
+	template <typename, hamon::size_t, hamon::size_t> class Matrix,
+	typename T
+>
+inline Matrix<T, 4, 4>
+simd_transpose(Matrix<T, 4, 4> const& m) HAMON_NOEXCEPT
+{
+	using V = simd_vec4<T>;
+	using reg = typename V::type;
+
+	reg r0 = V::load(m[0].data());
+	reg r1 = V::load(m[1].data());
+	reg r2 = V::load(m[2].data());
+	reg r3 = V::load(m[3].data());
+	V::transpose(r0, r1, r2, r3);
+
+	Matrix<T, 4, 4> result;
+	V::store(result[0].data(), r0);
+	V::store(result[1].data(), r1);
+	V::store(result[2].data(), r2);
+	V::store(result[3].data(), r3);
+	return result;
+}
+
+}	// namespace detail
+
+}	// namespace qvm
+
+}	// namespace hamon
+
+#endif // HAMON_QVM_DETAIL_SIMD_SIMD_TRANSPOSE_HPP
@@ -0,0 +1,299 @@
+﻿/**
+ *	@file	simd_vec4.hpp
+ *
+ *	@brief	simd_vec4 の定義
+ */
+
+#ifndef HAMON_QVM_DETAIL_SIMD_SIMD_VEC4_HPP
+#define HAMON_QVM_DETAIL_SIMD_SIMD_VEC4_HPP
+
+#include <hamon/qvm/detail/simd/config.hpp>
+#include <hamon/type_traits/bool_constant.hpp>
+#include <hamon/config.hpp>
+
+#if defined(HAMON_SIMD_NEON) && !defined(HAMON_SIMD_NEON64)
+#include <cmath>
+#endif
+
+namespace hamon
+{
+
+namespace qvm
+{
+
+namespace detail
+{
+
+/**
+ *	@brief	要素4つの SIMD レジスタの操作
+ *
+ *	SIMD 実装がある要素型に対してだけ特殊化され、value が true になる。
+ *	各バックエンドは以下の操作を提供する。
+ *
+ *	load, store, set1, set, first,
+ *	add, sub, mul, div, sqrt,
+ *	splat<I>    : I 番目の要素を全要素にコピー
+ *	swap_pairs  : {0,1,2,3} -> {1,0,3,2}
+ *	swap_halves : {0,1,2,3} -> {2,3,0,1}
+ *	transpose   : 4x4 の転置
+ */
+template <typename T>
+struct simd_vec4
+	: public hamon::false_type
+{};
+
+#if defined(HAMON_SIMD_SSE2)
+
+template <>
+struct simd_vec4<float>
+	: public hamon::true_type
+{
+	using type = __m128;
+
+	static type load(float const* p) HAMON_NOEXCEPT { return _mm_loadu_ps(p); }
+	static void store(float* p, type v) HAMON_NOEXCEPT { _mm_storeu_ps(p, v); }
+	static type set1(float x) HAMON_NOEXCEPT { return _mm_set1_ps(x); }
+	static type set(float x, float y, float z, float w) HAMON_NOEXCEPT { return _mm_setr_ps(x, y, z, w); }
+	static float first(type v) HAMON_NOEXCEPT { return _mm_cvtss_f32(v); }
+
+	static type add(type a, type b) HAMON_NOEXCEPT { return _mm_add_ps(a, b); }
+	static type sub(type a, type b) HAMON_NOEXCEPT { return _mm_sub_ps(a, b); }
+	static type mul(type a, type b) HAMON_NOEXCEPT { return _mm_mul_ps(a, b); }
+	static type div(type a, type b) HAMON_NOEXCEPT { return _mm_div_ps(a, b); }
+	static type sqrt(type v) HAMON_NOEXCEPT { return _mm_sqrt_ps(v); }
+
+	template <int I>
+	static type splat(type v) HAMON_NOEXCEPT { return _mm_shuffle_ps(v, v, _MM_SHUFFLE(I, I, I, I)); }
+	static type swap_pairs(type v) HAMON_NOEXCEPT { return _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1)); }
+	static type swap_halves(type v) HAMON_NOEXCEPT { return _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 0, 3, 2)); }
+
+	static void transpose(type& r0, type& r1, type& r2, type& r3) HAMON_NOEXCEPT
+	{
+		_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+	}
+};
+
+#if defined(HAMON_SIMD_AVX)
+
+template <>
+struct simd_vec4<double>
+	: public hamon::true_type
+{
+	using type = __m256d;
+
+	static type load(double const* p) HAMON_NOEXCEPT { return _mm256_loadu_pd(p); }
+	static void store(double* p, type v) HAMON_NOEXCEPT { _mm256_storeu_pd(p, v); }
+	static type set1(double x) HAMON_NOEXCEPT { return _mm256_set1_pd(x); }
+	static type set(double x, double y, double z, double w) HAMON_NOEXCEPT { return _mm256_setr_pd(x, y, z, w); }
+	static double first(type v) HAMON_NOEXCEPT { return _mm_cvtsd_f64(_mm256_castpd256_pd128(v)); }
+
+	static type add(type a, type b) HAMON_NOEXCEPT { return _mm256_add_pd(a, b); }
+	static type sub(type a, type b) HAMON_NOEXCEPT { return _mm256_sub_pd(a, b); }
+	static type mul(type a, type b) HAMON_NOEXCEPT { return _mm256_mul_pd(a, b); }
+	static type div(type a, type b) HAMON_NOEXCEPT { return _mm256_div_pd(a, b); }
+	static type sqrt(type v) HAMON_NOEXCEPT { return _mm256_sqrt_pd(v); }
+
+	template <int I>
+	static type splat(type v) HAMON_NOEXCEPT
+	{
+		// AVX2 の permute4x64 を使わずに、128bit 単位の複製とレーン内の選択で実現する
+		type const h = _mm256_permute2f128_pd(v, v, (I < 2) ? 0x00 : 0x11);
+		return _mm256_permute_pd(h, (I % 2 == 0) ? 0x0 : 0xF);
+	}
+	static type swap_pairs(type v) HAMON_NOEXCEPT { return _mm256_permute_pd(v, 0x5); }
+	static type swap_halves(type v) HAMON_NOEXCEPT { return _mm256_permute2f128_pd(v, v, 0x01); }
+
+	static void transpose(type& r0, type& r1, type& r2, type& r3) HAMON_NOEXCEPT
+	{
+		type const t0 = _mm256_unpacklo_pd(r0, r1);
+		type const t1 = _mm256_unpackhi_pd(r0, r1);
+		type const t2 = _mm256_unpacklo_pd(r2, r3);
+		type const t3 = _mm256_unpackhi_pd(r2, r3);
+		r0 = _mm256_permute2f128_pd(t0, t2, 0x20);
+		r1 = _mm256_permute2f128_pd(t1, t3, 0x20);
+		r2 = _mm256_permute2f128_pd(t0, t2, 0x31);
+		r3 = _mm256_permute2f128_pd(t1, t3, 0x31);
+	}
+};
+
+#else
+
+template <>
+struct simd_vec4<double>
+	: public hamon::true_type
+{
+	struct type
+	{
+		__m128d lo;
+		__m128d hi;
+	};
+
+	static type load(double const* p) HAMON_NOEXCEPT { return { _mm_loadu_pd(p), _mm_loadu_pd(p + 2) }; }
+	static void store(double* p, type v) HAMON_NOEXCEPT { _mm_storeu_pd(p, v.lo); _mm_storeu_pd(p + 2, v.hi); }
+	static type set1(double x) HAMON_NOEXCEPT { return { _mm_set1_pd(x), _mm_set1_pd(x) }; }
+	static type set(double x, double y, double z, double w) HAMON_NOEXCEPT { return { _mm_setr_pd(x, y), _mm_setr_pd(z, w) }; }
+	static double first(type v) HAMON_NOEXCEPT { return _mm_cvtsd_f64(v.lo); }
+
+	static type add(type a, type b) HAMON_NOEXCEPT { return { _mm_add_pd(a.lo, b.lo), _mm_add_pd(a.hi, b.hi) }; }
+	static type sub(type a, type b) HAMON_NOEXCEPT { return { _mm_sub_pd(a.lo, b.lo), _mm_sub_pd(a.hi, b.hi) }; }
+	static type mul(type a, type b) HAMON_NOEXCEPT { return { _mm_mul_pd(a.lo, b.lo), _mm_mul_pd(a.hi, b.hi) }; }
+	static type div(type a, type b) HAMON_NOEXCEPT { return { _mm_div_pd(a.lo, b.lo), _mm_div_pd(a.hi, b.hi) }; }
+	static type sqrt(type v) HAMON_NOEXCEPT { return { _mm_sqrt_pd(v.lo), _mm_sqrt_pd(v.hi) }; }
+
+	template <int I>
+	static type splat(type v) HAMON_NOEXCEPT
+	{
+		__m128d const h = (I < 2) ? v.lo : v.hi;
+		__m128d const s = _mm_shuffle_pd(h, h, (I % 2 == 0) ? 0x0 : 0x3);
+		return { s, s };
+	}
+	static type swap_pairs(type v) HAMON_NOEXCEPT { return { _mm_shuffle_pd(v.lo, v.lo, 0x1), _mm_shuffle_pd(v.hi, v.hi, 0x1) }; }
+	static type swap_halves(type v) HAMON_NOEXCEPT { return { v.hi, v.lo }; }
+
+	static void transpose(type& r0, type& r1, type& r2, type& r3) HAMON_NOEXCEPT
+	{
+		type const t0 = { _mm_unpacklo_pd(r0.lo, r1.lo), _mm_unpacklo_pd(r2.lo, r3.lo) };
+		type const t1 = { _mm_unpackhi_pd(r0.lo, r1.lo), _mm_unpackhi_pd(r2.lo, r3.lo) };
+		type const t2 = { _mm_unpacklo_pd(r0.hi, r1.hi), _mm_unpacklo_pd(r2.hi, r3.hi) };
+		type const t3 = { _mm_unpackhi_pd(r0.hi, r1.hi), _mm_unpackhi_pd(r2.hi, r3.hi) };
+		r0 = t0;
+		r1 = t1;
+		r2 = t2;
+		r3 = t3;
+	}
+};
+
+#endif	// defined(HAMON_SIMD_AVX)
+
+#elif defined(HAMON_SIMD_NEON)
+
+template <>
+struct simd_vec4<float>
+	: public hamon::true_type
+{
+	using type = float32x4_t;
+
+	static type load(float const* p) HAMON_NOEXCEPT { return vld1q_f32(p); }
+	static void store(float* p, type v) HAMON_NOEXCEPT { vst1q_f32(p, v); }
+	static type set1(float x) HAMON_NOEXCEPT { return vdupq_n_f32(x); }
+	static type set(float x, float y, float z, float w) HAMON_NOEXCEPT
+	{
+		float const tmp[4] = { x, y, z, w };
+		return vld1q_f32(tmp);
+	}
+	static float first(type v) HAMON_NOEXCEPT { return vgetq_lane_f32(v, 0); }
+
+	static type add(type a, type b) HAMON_NOEXCEPT { return vaddq_f32(a, b); }
+	static type sub(type a, type b) HAMON_NOEXCEPT { return vsubq_f32(a, b); }
+	static type mul(type a, type b) HAMON_NOEXCEPT { return vmulq_f32(a, b); }
+	static type div(type a, type b) HAMON_NOEXCEPT
+	{
+#if defined(HAMON_SIMD_NEON64)
+		return vdivq_f32(a, b);
+#else
+		// ARMv7 の NEON には除算命令が無いので、
+		// 逆数近似の精度の問題を避けるためにスカラーで計算する
+		float x[4];
+		float y[4];
+		vst1q_f32(x, a);
+		vst1q_f32(y, b);
+		for (int i = 0; i < 4; ++i)
+		{
+			x[i] /= y[i];
+		}
+		return vld1q_f32(x);
+#endif
+	}
+	static type sqrt(type v) HAMON_NOEXCEPT
+	{
+#if defined(HAMON_SIMD_NEON64)
+		return vsqrtq_f32(v);
+#else
+		// 除算と同じ理由でスカラーで計算する
+		float x[4];
+		vst1q_f32(x, v);
+		for (int i = 0; i < 4; ++i)
+		{
+			x[i] = std::sqrt(x[i]);
+		}
+		return vld1q_f32(x);
+#endif
+	}
+
+	template <int I>
+	static type splat(type v) HAMON_NOEXCEPT { return vdupq_n_f32(vgetq_lane_f32(v, I)); }
+	static type swap_pairs(type v) HAMON_NOEXCEPT { return vrev64q_f32(v); }
+	static type swap_halves(type v) HAMON_NOEXCEPT { return vextq_f32(v, v, 2); }
+
+	static void transpose(type& r0, type& r1, type& r2, type& r3) HAMON_NOEXCEPT
+	{
+		float32x4x2_t const t01 = vtrnq_f32(r0, r1);
+		float32x4x2_t const t23 = vtrnq_f32(r2, r3);
+		r0 = vcombine_f32(vget_low_f32(t01.val[0]),  vget_low_f32(t23.val[0]));
+		r1 = vcombine_f32(vget_low_f32(t01.val[1]),  vget_low_f32(t23.val[1]));
+		r2 = vcombine_f32(vget_high_f32(t01.val[0]), vget_high_f32(t23.val[0]));
+		r3 = vcombine_f32(vget_high_f32(t01.val[1]), vget_high_f32(t23.val[1]));
+	}
+};
+
+#if defined(HAMON_SIMD_NEON64)
+
+template <>
+struct simd_vec4<double>
+	: public hamon::true_type
+{
+	struct type
+	{
+		float64x2_t lo;
+		float64x2_t hi;
+	};
+
+	static type load(double const* p) HAMON_NOEXCEPT { return { vld1q_f64(p), vld1q_f64(p + 2) }; }
+	static void store(double* p, type v) HAMON_NOEXCEPT { vst1q_f64(p, v.lo); vst1q_f64(p + 2, v.hi); }
+	static type set1(double x) HAMON_NOEXCEPT { return { vdupq_n_f64(x), vdupq_n_f64(x) }; }
+	static type set(double x, double y, double z, double w) HAMON_NOEXCEPT
+	{
+		double const tmp[4] = { x, y, z, w };
+		return load(tmp);
+	}
+	static double first(type v) HAMON_NOEXCEPT { return vgetq_lane_f64(v.lo, 0); }
+
+	static type add(type a, type b) HAMON_NOEXCEPT { return { vaddq_f64(a.lo, b.lo), vaddq_f64(a.hi, b.hi) }; }
+	static type sub(type a, type b) HAMON_NOEXCEPT { return { vsubq_f64(a.lo, b.lo), vsubq_f64(a.hi, b.hi) }; }
+	static type mul(type a, type b) HAMON_NOEXCEPT { return { vmulq_f64(a.lo, b.lo), vmulq_f64(a.hi, b.hi) }; }
+	static type div(type a, type b) HAMON_NOEXCEPT { return { vdivq_f64(a.lo, b.lo), vdivq_f64(a.hi, b.hi) }; }
+	static type sqrt(type v) HAMON_NOEXCEPT { return { vsqrtq_f64(v.lo), vsqrtq_f64(v.hi) }; }
+
+	template <int I>
+	static type splat(type v) HAMON_NOEXCEPT
+	{
+		float64x2_t const s = vdupq_laneq_f64((I < 2) ? v.lo : v.hi, I % 2);
+		return { s, s };
+	}
+	static type swap_pairs(type v) HAMON_NOEXCEPT { return { vextq_f64(v.lo, v.lo, 1), vextq_f64(v.hi, v.hi, 1) }; }
+	static type swap_halves(type v) HAMON_NOEXCEPT { return { v.hi, v.lo }; }
+
+	static void transpose(type& r0, type& r1, type& r2, type& r3) HAMON_NOEXCEPT
+	{
+		type const t0 = { vzip1q_f64(r0.lo, r1.lo), vzip1q_f64(r2.lo, r3.lo) };
+		type const t1 = { vzip2q_f64(r0.lo, r1.lo), vzip2q_f64(r2.lo, r3.lo) };
+		type const t2 = { vzip1q_f64(r0.hi, r1.hi), vzip1q_f64(r2.hi, r3.hi) };
+		type const t3 = { vzip2q_f64(r0.hi, r1.hi), vzip2q_f64(r2.hi, r3.hi) };
+		r0 = t0;
+		r1 = t1;
+		r2 = t2;
+		r3 = t3;
+	}
+};
+
+#endif	// defined(HAMON_SIMD_NEON64)
+
+#endif
+
+}	// namespace detail
+
+}	// namespace qvm
+
+}	// namespace hamon
+
+#endif // HAMON_QVM_DETAIL_SIMD_SIMD_VEC4_HPP
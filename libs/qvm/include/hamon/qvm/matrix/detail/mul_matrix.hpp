@@ -8,9 +8,13 @@
 #define HAMON_QVM_MATRIX_DETAIL_MUL_MATRIX_HPP
 
 #include <hamon/qvm/detail/reduce.hpp>
+#include <hamon/qvm/detail/simd/config.hpp>
+#include <hamon/qvm/detail/simd/simd_mul_matrix.hpp>
+#include <hamon/qvm/detail/simd/simd_vec4.hpp>
 #include <hamon/cstddef/size_t.hpp>
 #include <hamon/utility/make_index_sequence.hpp>
 #include <hamon/type_traits/arithmetic_promote.hpp>
+#include <hamon/type_traits/is_constant_evaluated.hpp>
 #include <hamon/config.hpp>
 
 namespace hamon
@@ -70,6 +74,30 @@ mul_matrix(Matrix<T, N, L> const& lhs, Matrix<T, L, M> const& rhs) HAMON_NOEXCEP
 	return mul_matrix_impl(lhs, rhs, hamon::make_index_sequence<N>{});
 }
 
+/**
+ *	@brief	mul_matrix
+ *
+ *	Nx4 行列と 4x4 行列の積のときのオーバーロード (vector * matrix を含む)
+ */
+template <
+	template <typename, hamon::size_t, hamon::size_t> class Matrix,
+	typename T, hamon::size_t N
+>
+HAMON_NODISCARD inline HAMON_CONSTEXPR Matrix<T, N, 4>
+mul_matrix(Matrix<T, N, 4> const& lhs, Matrix<T, 4, 4> const& rhs) HAMON_NOEXCEPT
+{
+#if defined(HAMON_QVM_SIMD_DISPATCH)
+	if constexpr (simd_vec4<T>::value)
+	{
+		if (!hamon::is_constant_evaluated())
+		{
+			return hamon::qvm::detail::simd_mul_matrix(lhs, rhs);
+		}
+	}
+#endif
+	return mul_matrix_impl(lhs, rhs, hamon::make_index_sequence<N>{});
+}
+
 /**
  *	@brief	mul_matrix
  *
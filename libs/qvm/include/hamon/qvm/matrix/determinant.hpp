@@ -8,6 +8,10 @@
 #define HAMON_QVM_MATRIX_DETERMINANT_HPP
 
 #include <hamon/qvm/matrix/matrix.hpp>
+#include <hamon/qvm/detail/simd/config.hpp>
+#include <hamon/qvm/detail/simd/simd_determinant.hpp>
+#include <hamon/qvm/detail/simd/simd_vec4.hpp>
+#include <hamon/type_traits/is_constant_evaluated.hpp>
 #include <hamon/config.hpp>
 
 namespace hamon
@@ -49,6 +53,15 @@ template <typename T>
 HAMON_NODISCARD inline HAMON_CONSTEXPR T
 determinant(matrix<T, 4, 4> const& m) HAMON_NOEXCEPT
 {
+#if defined(HAMON_QVM_SIMD_DISPATCH)
+	if constexpr (hamon::qvm::detail::simd_vec4<T>::value)
+	{
+		if (!hamon::is_constant_evaluated())
+		{
+			return hamon::qvm::detail::simd_determinant(m);
+		}
+	}
+#endif
 	return
 		m[0][0] * (m[1][1]*m[2][2]*m[3][3] +
 		           m[1][2]*m[2][3]*m[3][1] +
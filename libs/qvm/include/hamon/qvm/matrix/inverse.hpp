@@ -8,6 +8,10 @@
 #define HAMON_QVM_MATRIX_INVERSE_HPP
 
 #include <hamon/qvm/matrix/matrix.hpp>
+#include <hamon/qvm/detail/simd/config.hpp>
+#include <hamon/qvm/detail/simd/simd_inverse.hpp>
+#include <hamon/qvm/detail/simd/simd_vec4.hpp>
+#include <hamon/type_traits/is_constant_evaluated.hpp>
 #include <hamon/config.hpp>
 
 namespace hamon
@@ -99,6 +103,15 @@ template <typename T>
 HAMON_NODISCARD inline HAMON_CONSTEXPR matrix<T, 4, 4>
 inverse(matrix<T, 4, 4> const& m) HAMON_NOEXCEPT
 {
+#if defined(HAMON_QVM_SIMD_DISPATCH)
+	if constexpr (detail::simd_vec4<T>::value)
+	{
+		if (!hamon::is_constant_evaluated())
+		{
+			return detail::simd_inverse(m);
+		}
+	}
+#endif
 	return detail::inverse_impl(
 		m,
 		matrix<T, 4, 4>
@@ -8,7 +8,11 @@
 #define HAMON_QVM_MATRIX_TRANSPOSE_HPP
 
 #include <hamon/qvm/matrix/matrix.hpp>
+#include <hamon/qvm/detail/simd/config.hpp>
+#include <hamon/qvm/detail/simd/simd_transpose.hpp>
+#include <hamon/qvm/detail/simd/simd_vec4.hpp>
 #include <hamon/cstddef/size_t.hpp>
+#include <hamon/type_traits/is_constant_evaluated.hpp>
 #include <hamon/utility/make_index_sequence.hpp>
 #include <hamon/config.hpp>
 
@@ -42,6 +46,22 @@ transpose_impl(matrix<T, R, C> const& m) HAMON_NOEXCEPT
 	return transpose_impl(m, hamon::make_index_sequence<C>{});
 }
 
+template <typename T>
+HAMON_NODISCARD inline HAMON_CONSTEXPR matrix<T, 4, 4>
+transpose_impl(matrix<T, 4, 4> const& m) HAMON_NOEXCEPT
+{
+#if defined(HAMON_QVM_SIMD_DISPATCH)
+	if constexpr (simd_vec4<T>::value)
+	{
+		if (!hamon::is_constant_evaluated())
+		{
+			return hamon::qvm::detail::simd_transpose(m);
+		}
+	}
+#endif
+	return transpose_impl(m, hamon::make_index_sequence<4>{});
+}
+
 }	// namespace detail
 
 /**
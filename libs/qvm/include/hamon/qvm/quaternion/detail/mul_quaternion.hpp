@@ -8,7 +8,11 @@
 #define HAMON_QVM_QUATERNION_DETAIL_MUL_QUATERNION_HPP
 
 #include <hamon/qvm/quaternion/quaternion.hpp>
+#include <hamon/qvm/detail/simd/config.hpp>
+#include <hamon/qvm/detail/simd/simd_mul_quaternion.hpp>
+#include <hamon/qvm/detail/simd/simd_vec4.hpp>
 #include <hamon/type_traits/arithmetic_promote.hpp>
+#include <hamon/type_traits/is_constant_evaluated.hpp>
 #include <hamon/config.hpp>
 
 namespace hamon
@@ -27,6 +31,15 @@ template <typename T>
 HAMON_NODISCARD inline HAMON_CONSTEXPR quaternion<T>
 mul_quaternion(quaternion<T> const& lhs, quaternion<T> const& rhs) HAMON_NOEXCEPT
 {
+#if defined(HAMON_QVM_SIMD_DISPATCH)
+	if constexpr (simd_vec4<T>::value)
+	{
+		if (!hamon::is_constant_evaluated())
+		{
+			return hamon::qvm::detail::simd_mul_quaternion(lhs, rhs);
+		}
+	}
+#endif
 	return
 	{
 		(lhs.w() * rhs.x()) + (lhs.x() * rhs.w()) + (lhs.y() * rhs.z()) - (lhs.z() * rhs.y()),
@@ -0,0 +1,114 @@
+﻿/**
+ *	@file	batch_test.hpp
+ *
+ *	@brief
+ */
+
+#ifndef UNIT_TEST_QVM_BATCH_BATCH_TEST_HPP
+#define UNIT_TEST_QVM_BATCH_BATCH_TEST_HPP
+
+#include <hamon/qvm/matrix/matrix.hpp>
+#include <hamon/qvm/quaternion/quaternion.hpp>
+#include <hamon/qvm/vector/vector.hpp>
+#include <hamon/cmath/fabs.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/limits.hpp>
+#include <hamon/vector.hpp>
+#include <gtest/gtest.h>
+
+namespace hamon_qvm_test
+{
+
+namespace batch_test
+{
+
+// SIMD のブロック(4要素)と端数の両方を通るような要素数
+static hamon::size_t const s_batch_sizes[] = { 0, 1, 3, 4, 5, 8, 13, 31 };
+
+using BatchTestTypes = ::testing::Types<float, double, long double>;
+
+template <typename T>
+class BatchTest : public ::testing::Test {};
+
+TYPED_TEST_SUITE(BatchTest, BatchTestTypes);
+
+// テストに使う値
+//
+// 乱数は使わず、要素の位置 i と成分 k から決まる -10 ～ 10 の 0.5 刻みの値にする。
+// どの型でも正確に表せるので、積和だけの計算 (dot, cross, 行列との積など) は丸め誤差なしに一致する。
+// seed を変えると別の値の列になる。
+template <typename T>
+T test_value(hamon::size_t i, hamon::size_t k, hamon::size_t seed)
+{
+	auto const x = (i * 7 + k * 13 + seed * 17 + 5) % 41;
+	return T(static_cast<int>(x) - 20) / T(2);
+}
+
+template <typename T>
+hamon::vector<hamon::qvm::vector<T, 3>> make_vector3s(hamon::size_t n, hamon::size_t seed)
+{
+	hamon::vector<hamon::qvm::vector<T, 3>> result(n);
+	for (hamon::size_t i = 0; i < n; ++i)
+	{
+		for (hamon::size_t k = 0; k < 3; ++k)
+		{
+			result[i][k] = test_value<T>(i, k, seed);
+		}
+	}
+	return result;
+}
+
+template <typename T>
+hamon::vector<hamon::qvm::quaternion<T>> make_quaternions(hamon::size_t n, hamon::size_t seed)
+{
+	hamon::vector<hamon::qvm::quaternion<T>> result(n);
+	for (hamon::size_t i = 0; i < n; ++i)
+	{
+		for (hamon::size_t k = 0; k < 4; ++k)
+		{
+			result[i][k] = test_value<T>(i, k, seed);
+		}
+	}
+	return result;
+}
+
+template <typename T>
+hamon::qvm::matrix<T, 4, 4> make_matrix4x4(hamon::size_t seed)
+{
+	hamon::qvm::matrix<T, 4, 4> m;
+	for (hamon::size_t i = 0; i < 4; ++i)
+	{
+		for (hamon::size_t j = 0; j < 4; ++j)
+		{
+			m[i][j] = test_value<T>(i, j, seed);
+		}
+	}
+	return m;
+}
+
+// expected と actual の差が max_ulps * epsilon * max(|expected|, 1) 以下であるか
+//
+// EXPECT_NEAR は double で比較するので、long double でも使えるように自前で比較する
+template <typename T>
+void expect_near(T expected, T actual, int max_ulps)
+{
+	T const scale = hamon::fabs(expected) < T(1) ? T(1) : hamon::fabs(expected);
+	T const tolerance = hamon::numeric_limits<T>::epsilon() * T(max_ulps) * scale;
+	EXPECT_LE(hamon::fabs(expected - actual), tolerance)
+		<< "expected: " << expected << ", actual: " << actual;
+}
+
+template <typename GenType>
+void expect_near_elements(GenType const& expected, GenType const& actual, int max_ulps)
+{
+	for (hamon::size_t i = 0; i < expected.size(); ++i)
+	{
+		expect_near(expected[i], actual[i], max_ulps);
+	}
+}
+
+}	// namespace batch_test
+
+}	// namespace hamon_qvm_test
+
+#endif // UNIT_TEST_QVM_BATCH_BATCH_TEST_HPP
@@ -0,0 +1,50 @@
+﻿/**
+ *	@file	unit_test_qvm_batch_cross.cpp
+ *
+ *	@brief	batch::crossのテスト
+ */
+
+#include <hamon/qvm/batch/cross.hpp>
+#include <hamon/qvm/vector/vector.hpp>
+#include <hamon/qvm/vector/cross.hpp>
+#include <hamon/span.hpp>
+#include "batch_test.hpp"
+
+namespace hamon_qvm_test
+{
+
+namespace batch_test
+{
+
+TYPED_TEST(BatchTest, CrossTest)
+{
+	using T = TypeParam;
+	using vector3 = hamon::qvm::vector<T, 3>;
+
+	for (auto n : s_batch_sizes)
+	{
+		auto const a = make_vector3s<T>(n, 0);
+		auto const b = make_vector3s<T>(n, 1);
+		hamon::vector<vector3> out(n);
+
+		hamon::qvm::batch::cross(a, b, hamon::span<vector3>(out));
+
+		for (hamon::size_t i = 0; i < n; ++i)
+		{
+			// 入力は正確に表せる値なので、計算順序が違っても結果は一致する
+			EXPECT_EQ(hamon::qvm::cross(a[i], b[i]), out[i]);
+		}
+
+		// out と a が同じ範囲
+		auto c = a;
+		hamon::qvm::batch::cross(c, b, hamon::span<vector3>(c));
+		for (hamon::size_t i = 0; i < n; ++i)
+		{
+			EXPECT_EQ(out[i], c[i]);
+		}
+	}
+}
+
+}	// namespace batch_test
+
+}	// namespace hamon_qvm_test
@@ -0,0 +1,41 @@
+﻿/**
+ *	@file	unit_test_qvm_batch_dot.cpp
+ *
+ *	@brief	batch::dotのテスト
+ */
+
+#include <hamon/qvm/batch/dot.hpp>
+#include <hamon/qvm/vector/vector.hpp>
+#include <hamon/qvm/vector/dot.hpp>
+#include <hamon/span.hpp>
+#include "batch_test.hpp"
+
+namespace hamon_qvm_test
+{
+
+namespace batch_test
+{
+
+TYPED_TEST(BatchTest, DotTest)
+{
+	using T = TypeParam;
+
+	for (auto n : s_batch_sizes)
+	{
+		auto const a = make_vector3s<T>(n, 0);
+		auto const b = make_vector3s<T>(n, 1);
+		hamon::vector<T> out(n);
+
+		hamon::qvm::batch::dot(a, b, hamon::span<T>(out));
+
+		for (hamon::size_t i = 0; i < n; ++i)
+		{
+			// 入力は正確に表せる値なので、計算順序が違っても結果は一致する
+			EXPECT_EQ(hamon::qvm::dot(a[i], b[i]), out[i]);
+		}
+	}
+}
+
+}	// namespace batch_test
+
+}	// namespace hamon_qvm_test
@@ -0,0 +1,72 @@
+﻿/**
+ *	@file	unit_test_qvm_batch_lerp.cpp
+ *
+ *	@brief	batch::lerpのテスト
+ */
+
+#include <hamon/qvm/batch/lerp.hpp>
+#include <hamon/qvm/common/lerp.hpp>
+#include <hamon/qvm/vector/vector.hpp>
+#include <hamon/span.hpp>
+#include "batch_test.hpp"
+
+namespace hamon_qvm_test
+{
+
+namespace batch_test
+{
+
+TYPED_TEST(BatchTest, LerpTest)
+{
+	using T = TypeParam;
+	using vector3 = hamon::qvm::vector<T, 3>;
+
+	for (auto n : s_batch_sizes)
+	{
+		auto const a = make_vector3s<T>(n, 0);
+		auto const b = make_vector3s<T>(n, 1);
+		hamon::vector<vector3> out(n);
+
+		for (T t : { T(0), T(0.25), T(0.5), T(1), T(1.5), T(-0.5) })
+		{
+			hamon::qvm::batch::lerp(a, b, t, hamon::span<vector3>(out));
+
+			for (hamon::size_t i = 0; i < n; ++i)
+			{
+				// 入力も t も正確に表せる値なので、結果は一致する
+				EXPECT_EQ(hamon::qvm::lerp(a[i], b[i], t), out[i]);
+			}
+		}
+	}
+
+	{
+		hamon::vector<vector3> const a
+		{
+			vector3{0, 0, 0},
+			vector3{1, 2, 3},
+			vector3{-4, 0, 4},
+			vector3{10, 20, 30},
+			vector3{2, 2, 2},
+		};
+		hamon::vector<vector3> const b
+		{
+			vector3{2, 4, 6},
+			vector3{3, 2, 1},
+			vector3{4, 0, -4},
+			vector3{0, 0, 0},
+			vector3{2, 2, 2},
+		};
+		hamon::vector<vector3> out(a.size());
+
+		hamon::qvm::batch::lerp(a, b, 0.5f, hamon::span<vector3>(out));
+		EXPECT_EQ(vector3( 1,  2,  3), out[0]);
+		EXPECT_EQ(vector3( 2,  2,  2), out[1]);
+		EXPECT_EQ(vector3( 0,  0,  0), out[2]);
+		EXPECT_EQ(vector3( 5, 10, 15), out[3]);
+		EXPECT_EQ(vector3( 2,  2,  2), out[4]);
+	}
+}
+
+}	// namespace batch_test
+
+}	// namespace hamon_qvm_test
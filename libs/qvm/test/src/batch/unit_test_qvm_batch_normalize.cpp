@@ -0,0 +1,76 @@
+﻿/**
+ *	@file	unit_test_qvm_batch_normalize.cpp
+ *
+ *	@brief	batch::normalizeのテスト
+ */
+
+#include <hamon/qvm/batch/normalize.hpp>
+#include <hamon/qvm/quaternion/quaternion.hpp>
+#include <hamon/qvm/quaternion/normalize.hpp>
+#include <hamon/qvm/vector/vector.hpp>
+#include <hamon/qvm/vector/normalize.hpp>
+#include <hamon/span.hpp>
+#include "batch_test.hpp"
+
+namespace hamon_qvm_test
+{
+
+namespace batch_test
+{
+
+TYPED_TEST(BatchTest, NormalizeVectorTest)
+{
+	using T = TypeParam;
+	using vector3 = hamon::qvm::vector<T, 3>;
+
+	for (auto n : s_batch_sizes)
+	{
+		auto in = make_vector3s<T>(n, 0);
+		if (n > 1)
+		{
+			// 長さが 0 の要素
+			in[1] = vector3{};
+		}
+		hamon::vector<vector3> out(n);
+
+		hamon::qvm::batch::normalize(in, hamon::span<vector3>(out));
+
+		for (hamon::size_t i = 0; i < n; ++i)
+		{
+			expect_near_elements(hamon::qvm::normalize(in[i]), out[i], 4);
+		}
+	}
+}
+
+TYPED_TEST(BatchTest, NormalizeQuaternionTest)
+{
+	using T = TypeParam;
+	using quaternion = hamon::qvm::quaternion<T>;
+
+	for (auto n : s_batch_sizes)
+	{
+		auto in = make_quaternions<T>(n, 0);
+		if (n > 2)
+		{
+			// 長さが 0 の要素
+			in[2] = quaternion{0, 0, 0, 0};
+		}
+
+		// in と out が同じ範囲
+		auto out = in;
+		hamon::qvm::batch::normalize(out, hamon::span<quaternion>(out));
+
+		for (hamon::size_t i = 0; i < n; ++i)
+		{
+			expect_near_elements(hamon::qvm::normalize(in[i]), out[i], 4);
+		}
+		if (n > 2)
+		{
+			EXPECT_EQ(quaternion::identity(), out[2]);
+		}
+	}
+}
+
+}	// namespace batch_test
+
+}	// namespace hamon_qvm_test
@@ -0,0 +1,63 @@
+﻿/**
+ *	@file	unit_test_qvm_batch_slerp.cpp
+ *
+ *	@brief	batch::slerpのテスト
+ */
+
+#include <hamon/qvm/batch/slerp.hpp>
+#include <hamon/qvm/quaternion/quaternion.hpp>
+#include <hamon/qvm/quaternion/normalize.hpp>
+#include <hamon/qvm/quaternion/slerp.hpp>
+#include <hamon/span.hpp>
+#include "batch_test.hpp"
+
+namespace hamon_qvm_test
+{
+
+namespace batch_test
+{
+
+TYPED_TEST(BatchTest, SlerpTest)
+{
+	using T = TypeParam;
+	using quaternion = hamon::qvm::quaternion<T>;
+
+	for (auto n : s_batch_sizes)
+	{
+		auto a = make_quaternions<T>(n, 0);
+		auto b = make_quaternions<T>(n, 1);
+		for (hamon::size_t i = 0; i < n; ++i)
+		{
+			a[i] = hamon::qvm::normalize(a[i]);
+			b[i] = hamon::qvm::normalize(b[i]);
+		}
+		if (n > 3)
+		{
+			// 同じ向きの要素は線形補間になる
+			b[3] = a[3];
+		}
+		hamon::vector<quaternion> out(n);
+
+		for (T t : { T(0), T(0.25), T(0.5), T(0.75), T(1), T(-1), T(2) })
+		{
+			hamon::qvm::batch::slerp(a, b, t, hamon::span<quaternion>(out));
+
+			for (hamon::size_t i = 0; i < n; ++i)
+			{
+				expect_near_elements(hamon::qvm::slerp(a[i], b[i], t), out[i], 64);
+			}
+		}
+
+		// out と b が同じ範囲
+		auto c = b;
+		hamon::qvm::batch::slerp(a, c, T(0.5), hamon::span<quaternion>(c));
+		for (hamon::size_t i = 0; i < n; ++i)
+		{
+			expect_near_elements(hamon::qvm::slerp(a[i], b[i], T(0.5)), c[i], 64);
+		}
+	}
+}
+
+}	// namespace batch_test
+
+}	// namespace hamon_qvm_test
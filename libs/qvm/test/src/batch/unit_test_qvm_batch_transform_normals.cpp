@@ -0,0 +1,67 @@
+﻿/**
+ *	@file	unit_test_qvm_batch_transform_normals.cpp
+ *
+ *	@brief	batch::transform_normalsのテスト
+ */
+
+#include <hamon/qvm/batch/transform_normals.hpp>
+#include <hamon/qvm/matrix/matrix.hpp>
+#include <hamon/qvm/matrix/operators.hpp>
+#include <hamon/qvm/vector/vector.hpp>
+#include <hamon/qvm/vector/operators.hpp>
+#include <hamon/span.hpp>
+#include "batch_test.hpp"
+
+namespace hamon_qvm_test
+{
+
+namespace batch_test
+{
+
+TYPED_TEST(BatchTest, TransformNormalsTest)
+{
+	using T = TypeParam;
+	using vector3 = hamon::qvm::vector<T, 3>;
+	using vector4 = hamon::qvm::vector<T, 4>;
+	using matrix4x4 = hamon::qvm::matrix<T, 4, 4>;
+
+	for (auto n : s_batch_sizes)
+	{
+		auto const m = make_matrix4x4<T>(n);
+		auto const in = make_vector3s<T>(n, 0);
+		hamon::vector<vector3> out(n);
+
+		hamon::qvm::batch::transform_normals(in, m, hamon::span<vector3>(out));
+
+		for (hamon::size_t i = 0; i < n; ++i)
+		{
+			auto const v = vector4{in[i][0], in[i][1], in[i][2], T(0)} * m;
+			// 入力は正確に表せる値なので、計算順序が違っても結果は一致する
+			EXPECT_EQ((vector3{v[0], v[1], v[2]}), out[i]);
+		}
+	}
+
+	// 平行移動は無視される
+	{
+		auto const m = matrix4x4::translation(1, 2, 3);
+		hamon::vector<vector3> const in
+		{
+			vector3{0, 0, 1},
+			vector3{1, 0, 0},
+			vector3{0, -1, 0},
+			vector3{4, 5, 6},
+			vector3{10, 20, 30},
+		};
+		hamon::vector<vector3> out(in.size());
+
+		hamon::qvm::batch::transform_normals(in, m, hamon::span<vector3>(out));
+		for (hamon::size_t i = 0; i < in.size(); ++i)
+		{
+			EXPECT_EQ(in[i], out[i]);
+		}
+	}
+}
+
+}	// namespace batch_test
+
+}	// namespace hamon_qvm_test
@@ -0,0 +1,68 @@
+﻿/**
+ *	@file	unit_test_qvm_batch_transform_points.cpp
+ *
+ *	@brief	batch::transform_pointsのテスト
+ */
+
+#include <hamon/qvm/batch/transform_points.hpp>
+#include <hamon/qvm/matrix/matrix.hpp>
+#include <hamon/qvm/matrix/operators.hpp>
+#include <hamon/qvm/vector/vector.hpp>
+#include <hamon/qvm/vector/operators.hpp>
+#include <hamon/span.hpp>
+#include "batch_test.hpp"
+
+namespace hamon_qvm_test
+{
+
+namespace batch_test
+{
+
+TYPED_TEST(BatchTest, TransformPointsTest)
+{
+	using T = TypeParam;
+	using vector3 = hamon::qvm::vector<T, 3>;
+	using vector4 = hamon::qvm::vector<T, 4>;
+	using matrix4x4 = hamon::qvm::matrix<T, 4, 4>;
+
+	for (auto n : s_batch_sizes)
+	{
+		auto const m = make_matrix4x4<T>(n);
+		auto const in = make_vector3s<T>(n, 0);
+		hamon::vector<vector3> out(n);
+
+		hamon::qvm::batch::transform_points(in, m, hamon::span<vector3>(out));
+
+		for (hamon::size_t i = 0; i < n; ++i)
+		{
+			auto const v = vector4{in[i][0], in[i][1], in[i][2], T(1)} * m;
+			// 入力は正確に表せる値なので、計算順序が違っても結果は一致する
+			EXPECT_EQ((vector3{v[0], v[1], v[2]}), out[i]);
+		}
+	}
+
+	// 平行移動
+	{
+		auto const m = matrix4x4::translation(1, 2, 3);
+		hamon::vector<vector3> v
+		{
+			vector3{0, 0, 0},
+			vector3{1, 1, 1},
+			vector3{-1, 2, -3},
+			vector3{4, 5, 6},
+			vector3{10, 20, 30},
+		};
+
+		// in と out が同じ範囲
+		hamon::qvm::batch::transform_points(v, m, hamon::span<vector3>(v));
+		EXPECT_EQ(vector3( 1,  2,  3), v[0]);
+		EXPECT_EQ(vector3( 2,  3,  4), v[1]);
+		EXPECT_EQ(vector3( 0,  4,  0), v[2]);
+		EXPECT_EQ(vector3( 5,  7,  9), v[3]);
+		EXPECT_EQ(vector3(11, 22, 33), v[4]);
+	}
+}
+
+}	// namespace batch_test
+
+}	// namespace hamon_qvm_test
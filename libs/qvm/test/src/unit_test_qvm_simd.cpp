@@ -0,0 +1,246 @@
+﻿/**
+ *	@file	unit_test_qvm_simd.cpp
+ *
+ *	@brief	SIMD 実装のテスト
+ *
+ *	実行時の結果(SIMD 実装が選ばれる)を、スカラーで計算した結果と比較する。
+ */
+
+#include <hamon/qvm.hpp>
+#include <hamon/cmath/fabs.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <gtest/gtest.h>
+#include "get_random_value.hpp"
+
+namespace hamon_qvm_test
+{
+
+namespace simd_test
+{
+
+template <typename T>
+class SimdTest : public ::testing::Test {};
+
+using SimdTestTypes = ::testing::Types<float, double>;
+TYPED_TEST_SUITE(SimdTest, SimdTestTypes);
+
+template <typename T>
+hamon::qvm::matrix<T, 4, 4> make_random_matrix4x4()
+{
+	hamon::qvm::matrix<T, 4, 4> m;
+	for (hamon::size_t i = 0; i < 4; ++i)
+	{
+		for (hamon::size_t j = 0; j < 4; ++j)
+		{
+			m[i][j] = get_random_value<T>(T(-10), T(10));
+		}
+	}
+	return m;
+}
+
+template <typename T>
+hamon::qvm::vector<T, 4> make_random_vector4()
+{
+	return
+	{
+		get_random_value<T>(T(-10), T(10)),
+		get_random_value<T>(T(-10), T(10)),
+		get_random_value<T>(T(-10), T(10)),
+		get_random_value<T>(T(-10), T(10)),
+	};
+}
+
+template <typename T>
+hamon::qvm::quaternion<T> make_random_quaternion()
+{
+	return
+	{
+		get_random_value<T>(T(-10), T(10)),
+		get_random_value<T>(T(-10), T(10)),
+		get_random_value<T>(T(-10), T(10)),
+		get_random_value<T>(T(-10), T(10)),
+	};
+}
+
+template <typename T>
+T determinant3x3(hamon::qvm::matrix<T, 4, 4> const& m, hamon::size_t row, hamon::size_t col)
+{
+	T a[3][3] {};
+	for (hamon::size_t i = 0, y = 0; i < 4; ++i)
+	{
+		if (i == row) { continue; }
+		for (hamon::size_t j = 0, x = 0; j < 4; ++j)
+		{
+			if (j == col) { continue; }
+			a[y][x] = m[i][j];
+			++x;
+		}
+		++y;
+	}
+	return
+		a[0][0] * (a[1][1] * a[2][2] - a[1][2] * a[2][1]) -
+		a[0][1] * (a[1][0] * a[2][2] - a[1][2] * a[2][0]) +
+		a[0][2] * (a[1][0] * a[2][1] - a[1][1] * a[2][0]);
+}
+
+template <typename T>
+T determinant4x4(hamon::qvm::matrix<T, 4, 4> const& m)
+{
+	T result = 0;
+	T sign = 1;
+	for (hamon::size_t j = 0; j < 4; ++j)
+	{
+		result += sign * m[0][j] * determinant3x3(m, 0, j);
+		sign = -sign;
+	}
+	return result;
+}
+
+TYPED_TEST(SimdTest, VectorTest)
+{
+	using T = TypeParam;
+
+	for (int n = 0; n < 100; ++n)
+	{
+		auto const a = make_random_vector4<T>();
+		auto const b = make_random_vector4<T>();
+		auto const s = get_random_value<T>(T(1), T(10));
+
+		auto const add = a + b;
+		auto const sub = a - b;
+		auto const mul = a * b;
+		auto const div = a / s;
+		auto const muls = a * s;
+		for (hamon::size_t i = 0; i < 4; ++i)
+		{
+			EXPECT_EQ(a[i] + b[i], add[i]);
+			EXPECT_EQ(a[i] - b[i], sub[i]);
+			EXPECT_EQ(a[i] * b[i], mul[i]);
+			EXPECT_EQ(a[i] / s,    div[i]);
+			EXPECT_EQ(a[i] * s,    muls[i]);
+		}
+	}
+}
+
+TYPED_TEST(SimdTest, MatrixMultipliesTest)
+{
+	using T = TypeParam;
+
+	for (int n = 0; n < 100; ++n)
+	{
+		auto const a = make_random_matrix4x4<T>();
+		auto const b = make_random_matrix4x4<T>();
+		auto const v = make_random_vector4<T>();
+
+		auto const m = a * b;
+		for (hamon::size_t i = 0; i < 4; ++i)
+		{
+			for (hamon::size_t j = 0; j < 4; ++j)
+			{
+				T x = 0;
+				for (hamon::size_t k = 0; k < 4; ++k)
+				{
+					x += a[i][k] * b[k][j];
+				}
+				EXPECT_EQ(x, m[i][j]);
+			}
+		}
+
+		auto const r = v * a;
+		for (hamon::size_t j = 0; j < 4; ++j)
+		{
+			T x = 0;
+			for (hamon::size_t k = 0; k < 4; ++k)
+			{
+				x += v[k] * a[k][j];
+			}
+			EXPECT_EQ(x, r[j]);
+		}
+	}
+}
+
+TYPED_TEST(SimdTest, MatrixTransposeTest)
+{
+	using T = TypeParam;
+
+	for (int n = 0; n < 100; ++n)
+	{
+		auto const a = make_random_matrix4x4<T>();
+		auto const t = hamon::qvm::transpose(a);
+		for (hamon::size_t i = 0; i < 4; ++i)
+		{
+			for (hamon::size_t j = 0; j < 4; ++j)
+			{
+				EXPECT_EQ(a[i][j], t[j][i]);
+			}
+		}
+	}
+}
+
+TYPED_TEST(SimdTest, MatrixInverseTest)
+{
+	using T = TypeParam;
+
+	for (int n = 0; n < 100; ++n)
+	{
+		auto const a = make_random_matrix4x4<T>();
+		T const det = hamon::qvm::determinant(a);
+		T const expected = determinant4x4(a);
+		EXPECT_NEAR(expected, det, hamon::fabs(expected) * T(1e-4) + T(1e-2));
+
+		if (hamon::fabs(det) < T(1))
+		{
+			continue;
+		}
+
+		auto const inv = hamon::qvm::inverse(a);
+		auto const id = a * inv;
+		for (hamon::size_t i = 0; i < 4; ++i)
+		{
+			for (hamon::size_t j = 0; j < 4; ++j)
+			{
+				EXPECT_NEAR(i == j ? T(1) : T(0), id[i][j], T(1e-3));
+			}
+		}
+	}
+
+	// 行列式が 0 のときは単位行列を返す
+	{
+		hamon::qvm::matrix<T, 4, 4> const a
+		{
+			1, 2, 3, 4,
+			2, 4, 6, 8,
+			5, 6, 7, 8,
+			9, 8, 7, 6,
+		};
+		EXPECT_EQ(T(0), hamon::qvm::determinant(a));
+		EXPECT_EQ((hamon::qvm::matrix<T, 4, 4>::identity()), hamon::qvm::inverse(a));
+	}
+}
+
+TYPED_TEST(SimdTest, QuaternionTest)
+{
+	using T = TypeParam;
+
+	for (int n = 0; n < 100; ++n)
+	{
+		auto const a = make_random_quaternion<T>();
+		auto const b = make_random_quaternion<T>();
+
+		auto const q = a * b;
+		EXPECT_EQ((a.w() * b.x()) + (a.x() * b.w()) + (a.y() * b.z()) - (a.z() * b.y()), q.x());
+		EXPECT_EQ((a.w() * b.y()) - (a.x() * b.z()) + (a.y() * b.w()) + (a.z() * b.x()), q.y());
+		EXPECT_EQ((a.w() * b.z()) + (a.x() * b.y()) - (a.y() * b.x()) + (a.z() * b.w()), q.z());
+		EXPECT_EQ((a.w() * b.w()) - (a.x() * b.x()) - (a.y() * b.y()) - (a.z() * b.z()), q.w());
+
+		auto const from = hamon::qvm::normalize(a);
+		auto const to = hamon::qvm::normalize(b);
+		auto const t = get_random_value<T>(T(0), T(1));
+		auto const s = hamon::qvm::slerp(from, to, t);
+		EXPECT_NEAR(T(1), hamon::qvm::length(s), T(1e-4));
+	}
+}
+
+}	// namespace simd_test
+
+}	// namespace hamon_qvm_test
@@ -0,0 +1,79 @@
+﻿/**
+ *	@file	random_generate_bench.cpp
+ *
+ *	@brief	ranges::generate_random でバッファを乱数で埋める場合のベンチマーク
+ *
+ *	16KiB のバッファを ranges::generate_random で繰り返し埋め、
+ *	エンジンごとに1秒あたりに生成したバイト数 [GB/s] を出力する。
+ *
+ *	使い方:
+ *		random_generate_bench [バッファのバイト数 (既定値は 16384)]
+ */
+
+#include <hamon/random.hpp>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+// buf を 300ms の間繰り返し埋めたときの、1秒あたりのバイト数 [GB/s] を返す
+template <typename Engine>
+double run(std::vector<std::uint64_t>& buf)
+{
+	Engine g;
+	std::uint64_t sink = 0;
+	long long count = 0;
+	auto const start = Clock::now();
+	auto end = start;
+	do
+	{
+		hamon::ranges::generate_random(buf, g);
+		sink ^= buf[buf.size() / 2];
+		++count;
+		end = Clock::now();
+	}
+	while (end - start < std::chrono::milliseconds(300));
+	if (sink == 0)
+	{
+		std::printf(" ");
+	}
+
+	auto const bytes = static_cast<double>(count) * static_cast<double>(buf.size() * sizeof(std::uint64_t));
+	auto const seconds = std::chrono::duration<double>(end - start).count();
+	return bytes / seconds / 1e9;
+}
+
+}	// namespace
+
+int main(int argc, char* argv[])
+{
+	std::size_t bytes = 16 * 1024;
+	if (argc > 1)
+	{
+		bytes = static_cast<std::size_t>(std::atoll(argv[1]));
+	}
+	std::vector<std::uint64_t> buf((bytes + 7) / 8);
+
+#if defined(HAMON_SIMD_AVX2)
+	char const* simd = "AVX2";
+#elif defined(HAMON_SIMD_SSE2)
+	char const* simd = "SSE2";
+#elif defined(HAMON_SIMD_NEON64)
+	char const* simd = "NEON";
+#else
+	char const* simd = "none";
+#endif
+	std::printf("SIMD: %s, buffer: %zu bytes\n", simd, buf.size() * sizeof(std::uint64_t));
+	std::printf("%-20s %10s\n", "engine", "[GB/s]");
+	std::printf("%-20s %10.2f\n", "mt19937_64",      run<hamon::mt19937_64>(buf));
+	std::printf("%-20s %10.2f\n", "xoshiro256++",    run<hamon::xoshiro256plusplus>(buf));
+	std::printf("%-20s %10.2f\n", "xoshiro256++ x4", run<hamon::xoshiro256plusplus_x4>(buf));
+	std::printf("%-20s %10.2f\n", "xoshiro256++ x8", run<hamon::xoshiro256plusplus_x8>(buf));
+}
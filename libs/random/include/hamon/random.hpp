@@ -10,6 +10,8 @@
 #include <hamon/random/concepts.hpp>
 #include <hamon/random/distributions.hpp>
 #include <hamon/random/engines.hpp>
+#include <hamon/random/generate_canonical.hpp>
+#include <hamon/random/generate_random.hpp>
 #include <hamon/random/seed_seq.hpp>
 
 #endif // HAMON_RANDOM_HPP
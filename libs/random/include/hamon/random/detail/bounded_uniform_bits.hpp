@@ -0,0 +1,49 @@
+﻿/**
+ *	@file	bounded_uniform_bits.hpp
+ *
+ *	@brief	bounded_uniform_bits の定義
+ */
+
+#ifndef HAMON_RANDOM_DETAIL_BOUNDED_UNIFORM_BITS_HPP
+#define HAMON_RANDOM_DETAIL_BOUNDED_UNIFORM_BITS_HPP
+
+#include <hamon/random/detail/mul_wide.hpp>
+#include <hamon/random/detail/uniform_bits.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+namespace detail
+{
+
+/**
+ *	@brief	一様な UInt x から [0, s) の一様な整数を作る (s != 0)
+ *
+ *	Lemire の方法 ("Fast Random Integer Generation in an Interval", 2019)。
+ *	x * s の上位を結果にする。下位が 2^W mod s より小さい場合だけ偏るので、
+ *	その場合は g から新しい値を作ってやり直す。除算はその判定に1回だけ行う。
+ */
+template <typename UInt, typename URBG>
+HAMON_CXX14_CONSTEXPR UInt
+bounded_uniform_bits(URBG& g, UInt x, UInt s)
+{
+	UInt lo = 0;
+	UInt r = hamon::detail::mul_wide(x, s, lo);
+	if (lo < s)
+	{
+		UInt const t = static_cast<UInt>(static_cast<UInt>(0 - s) % s);
+		while (lo < t)
+		{
+			x = hamon::detail::generate_uniform_bits<UInt>(g);
+			r = hamon::detail::mul_wide(x, s, lo);
+		}
+	}
+	return r;
+}
+
+}	// namespace detail
+
+}	// namespace hamon
+
+#endif // HAMON_RANDOM_DETAIL_BOUNDED_UNIFORM_BITS_HPP
@@ -0,0 +1,58 @@
+﻿/**
+ *	@file	mul_wide.hpp
+ *
+ *	@brief	mul_wide の定義
+ */
+
+#ifndef HAMON_RANDOM_DETAIL_MUL_WIDE_HPP
+#define HAMON_RANDOM_DETAIL_MUL_WIDE_HPP
+
+#include <hamon/cstdint/uint32_t.hpp>
+#include <hamon/cstdint/uint64_t.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+namespace detail
+{
+
+// a * b を計算して、上位を返し、下位を lo に格納する
+
+inline HAMON_CXX14_CONSTEXPR hamon::uint32_t
+mul_wide(hamon::uint32_t a, hamon::uint32_t b, hamon::uint32_t& lo) HAMON_NOEXCEPT
+{
+	hamon::uint64_t const m = static_cast<hamon::uint64_t>(a) * b;
+	lo = static_cast<hamon::uint32_t>(m);
+	return static_cast<hamon::uint32_t>(m >> 32);
+}
+
+inline HAMON_CXX14_CONSTEXPR hamon::uint64_t
+mul_wide(hamon::uint64_t a, hamon::uint64_t b, hamon::uint64_t& lo) HAMON_NOEXCEPT
+{
+#if defined(__SIZEOF_INT128__)
+	__uint128_t const m = static_cast<__uint128_t>(a) * b;
+	lo = static_cast<hamon::uint64_t>(m);
+	return static_cast<hamon::uint64_t>(m >> 64);
+#else
+	hamon::uint64_t const a_lo = a & 0xFFFFFFFF;
+	hamon::uint64_t const a_hi = a >> 32;
+	hamon::uint64_t const b_lo = b & 0xFFFFFFFF;
+	hamon::uint64_t const b_hi = b >> 32;
+
+	hamon::uint64_t const ll = a_lo * b_lo;
+	hamon::uint64_t const lh = a_lo * b_hi;
+	hamon::uint64_t const hl = a_hi * b_lo;
+	hamon::uint64_t const hh = a_hi * b_hi;
+
+	hamon::uint64_t const mid = (ll >> 32) + (lh & 0xFFFFFFFF) + (hl & 0xFFFFFFFF);
+	lo = (mid << 32) | (ll & 0xFFFFFFFF);
+	return hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+#endif
+}
+
+}	// namespace detail
+
+}	// namespace hamon
+
+#endif // HAMON_RANDOM_DETAIL_MUL_WIDE_HPP
@@ -0,0 +1,160 @@
+﻿/**
+ *	@file	uniform_bits.hpp
+ *
+ *	@brief	generate_uniform_bits の定義
+ */
+
+#ifndef HAMON_RANDOM_DETAIL_UNIFORM_BITS_HPP
+#define HAMON_RANDOM_DETAIL_UNIFORM_BITS_HPP
+
+#include <hamon/random/generate_random.hpp>
+#include <hamon/bit/bit_width.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/cstdint/uint64_t.hpp>
+#include <hamon/limits.hpp>
+#include <hamon/type_traits/bool_constant.hpp>
+#include <hamon/type_traits/is_same.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+namespace detail
+{
+
+// エンジン URBG の1回の呼び出しから、一様なビットを何ビット取り出せるか
+//
+// 値の範囲 (max - min + 1) が 2 のべき乗なら全てのビットを使う。
+// そうでなければ、範囲に収まる最大の 2 のべき乗を超える値を棄却する。
+template <typename URBG>
+struct uniform_bits_traits
+{
+	static HAMON_CONSTEXPR hamon::uint64_t range =
+		static_cast<hamon::uint64_t>(URBG::max()) -
+		static_cast<hamon::uint64_t>(URBG::min());
+
+	static HAMON_CONSTEXPR bool is_pow2 = ((range + 1) & range) == 0;
+
+	static HAMON_CONSTEXPR int bits =
+		static_cast<int>(hamon::bit_width(range)) - (is_pow2 ? 0 : 1);
+
+	static HAMON_CONSTEXPR hamon::uint64_t limit =
+		is_pow2 ? 0 : (hamon::uint64_t(1) << bits);
+
+	static HAMON_CXX14_CONSTEXPR hamon::uint64_t draw(URBG& g)
+	{
+		for (;;)
+		{
+			auto const x =
+				static_cast<hamon::uint64_t>(g()) -
+				static_cast<hamon::uint64_t>(URBG::min());
+			if (is_pow2 || x < limit)
+			{
+				return x;
+			}
+		}
+	}
+};
+
+// エンジンが UInt 以上のビット数を返す場合は、上位のビットを使う
+template <typename UInt, typename URBG>
+HAMON_CXX14_CONSTEXPR UInt
+generate_uniform_bits_impl(URBG& g, hamon::true_type)
+{
+	using traits = uniform_bits_traits<URBG>;
+	return static_cast<UInt>(
+		traits::draw(g) >> (traits::bits - hamon::numeric_limits<UInt>::digits));
+}
+
+// エンジンが UInt より少ないビット数を返す場合は、複数回呼び出して連結する
+template <typename UInt, typename URBG>
+HAMON_CXX14_CONSTEXPR UInt
+generate_uniform_bits_impl(URBG& g, hamon::false_type)
+{
+	using traits = uniform_bits_traits<URBG>;
+	UInt result = 0;
+	for (int n = 0; n < hamon::numeric_limits<UInt>::digits; n += traits::bits)
+	{
+		result = static_cast<UInt>(
+			(result << traits::bits) | static_cast<UInt>(traits::draw(g)));
+	}
+	return result;
+}
+
+/**
+ *	@brief	g から一様な UInt (全てのビットが一様) を1つ作る
+ *
+ *	エンジンの値の範囲にだけ依存し、処理系に依存しない。
+ */
+template <typename UInt, typename URBG>
+HAMON_CXX14_CONSTEXPR UInt
+generate_uniform_bits(URBG& g)
+{
+	return hamon::detail::generate_uniform_bits_impl<UInt>(g,
+		hamon::bool_constant<(uniform_bits_traits<URBG>::bits >= hamon::numeric_limits<UInt>::digits)>{});
+}
+
+// エンジンの generate でそのまま UInt を作れるかどうか
+template <typename UInt, typename URBG>
+using is_uniform_bits_engine = hamon::bool_constant<
+	hamon::is_same<typename URBG::result_type, UInt>::value &&
+	URBG::min() == 0 &&
+	URBG::max() == hamon::numeric_limits<UInt>::max()>;
+
+HAMON_STATIC_CONSTEXPR hamon::size_t uniform_bits_chunk_size = 256;
+
+// エンジンの全ての値が一様で、1回の呼び出しで UInt 以上のビット数を返す場合は、
+// エンジンの generate でまとめて生成してから上位のビットを使う
+template <typename UInt, typename URBG>
+using is_bulk_uniform_bits_engine = hamon::bool_constant<
+	is_uniform_bits_engine<typename URBG::result_type, URBG>::value &&
+	(hamon::numeric_limits<typename URBG::result_type>::digits >= hamon::numeric_limits<UInt>::digits)>;
+
+template <typename UInt, typename URBG, typename F>
+void for_each_uniform_bits_impl(URBG& g, hamon::size_t n, F& f, hamon::true_type)
+{
+	using word_type = typename URBG::result_type;
+	HAMON_STATIC_CONSTEXPR int shift =
+		hamon::numeric_limits<word_type>::digits - hamon::numeric_limits<UInt>::digits;
+
+	word_type buf[uniform_bits_chunk_size];
+	while (n != 0)
+	{
+		hamon::size_t const m = n < uniform_bits_chunk_size ? n : uniform_bits_chunk_size;
+		hamon::ranges::generate_random(g, buf, buf + m);
+		for (hamon::size_t i = 0; i < m; ++i)
+		{
+			f(static_cast<UInt>(buf[i] >> shift));
+		}
+		n -= m;
+	}
+}
+
+template <typename UInt, typename URBG, typename F>
+void for_each_uniform_bits_impl(URBG& g, hamon::size_t n, F& f, hamon::false_type)
+{
+	for (; n != 0; --n)
+	{
+		f(hamon::detail::generate_uniform_bits<UInt>(g));
+	}
+}
+
+/**
+ *	@brief	一様な UInt を n 個作って、1つずつ f に渡す
+ *
+ *	generate_uniform_bits(g) を n 回呼ぶのと同じ値を f に渡す。
+ *	エンジンが使える場合は uniform_bits_chunk_size 個ずつまとめて生成する。
+ *	分布の generate は、これで受け取った値を変換して出力する。
+ */
+template <typename UInt, typename URBG, typename F>
+void for_each_uniform_bits(URBG& g, hamon::size_t n, F&& f)
+{
+	hamon::detail::for_each_uniform_bits_impl<UInt>(
+		g, n, f, is_bulk_uniform_bits_engine<UInt, URBG>{});
+}
+
+}	// namespace detail
+
+}	// namespace hamon
+
+#endif // HAMON_RANDOM_DETAIL_UNIFORM_BITS_HPP
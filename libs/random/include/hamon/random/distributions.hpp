@@ -7,6 +7,10 @@
 #ifndef HAMON_RANDOM_DISTRIBUTIONS_HPP
 #define HAMON_RANDOM_DISTRIBUTIONS_HPP
 
+#include <hamon/random/distributions/bernoulli_distribution.hpp>
+#include <hamon/random/distributions/discrete_distribution.hpp>
+#include <hamon/random/distributions/exponential_distribution.hpp>
+#include <hamon/random/distributions/normal_distribution.hpp>
 #include <hamon/random/distributions/uniform_int_distribution.hpp>
 #include <hamon/random/distributions/uniform_real_distribution.hpp>
 
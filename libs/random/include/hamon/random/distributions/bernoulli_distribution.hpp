@@ -0,0 +1,184 @@
+﻿/**
+ *	@file	bernoulli_distribution.hpp
+ *
+ *	@brief	bernoulli_distribution の定義
+ */
+
+#ifndef HAMON_RANDOM_DISTRIBUTIONS_BERNOULLI_DISTRIBUTION_HPP
+#define HAMON_RANDOM_DISTRIBUTIONS_BERNOULLI_DISTRIBUTION_HPP
+
+#include <hamon/random/detail/uniform_bits.hpp>
+#include <hamon/cstdint/uint64_t.hpp>
+#include <hamon/ios/flags_saver.hpp>
+#include <hamon/limits.hpp>
+#include <hamon/span.hpp>
+#include <hamon/config.hpp>
+#include <istream>
+#include <ostream>
+
+namespace hamon
+{
+
+/**
+ *	@brief	確率 p で true を返す分布
+ *
+ *	p * 2^64 を閾値にして、64bit の一様な整数がそれより小さいかどうかを返す。
+ *	浮動小数点数の演算は閾値の計算だけなので、処理系によらず同じ結果になる。
+ *	(p < 1 で p * 2^64 を整数に切り捨てるため、2^-64 未満の誤差がある)
+ */
+class bernoulli_distribution
+{
+public:
+	using result_type = bool;
+
+	class param_type
+	{
+	public:
+		using distribution_type = bernoulli_distribution;
+
+		HAMON_CXX11_CONSTEXPR param_type() HAMON_NOEXCEPT
+			: param_type(0.5)
+		{}
+
+		explicit HAMON_CXX11_CONSTEXPR
+		param_type(double p) HAMON_NOEXCEPT
+			: m_p(p)
+			, m_threshold(to_threshold(p))
+		{}
+
+		HAMON_CXX11_CONSTEXPR double p() const HAMON_NOEXCEPT { return m_p; }
+
+		friend HAMON_CXX11_CONSTEXPR bool
+		operator==(param_type const& lhs, param_type const& rhs) HAMON_NOEXCEPT
+		{
+			return lhs.m_p == rhs.m_p;
+		}
+
+		friend HAMON_CXX11_CONSTEXPR bool
+		operator!=(param_type const& lhs, param_type const& rhs) HAMON_NOEXCEPT
+		{
+			return !(lhs == rhs);
+		}
+
+	private:
+		static HAMON_CXX11_CONSTEXPR hamon::uint64_t
+		to_threshold(double p) HAMON_NOEXCEPT
+		{
+			// p >= 1 は常に true なので、閾値を最大にして別に判定する
+			return
+				!(p > 0.0) ? 0 :
+				p >= 1.0 ? hamon::numeric_limits<hamon::uint64_t>::max() :
+				static_cast<hamon::uint64_t>(p * 18446744073709551616.0);
+		}
+
+		HAMON_CXX11_CONSTEXPR bool test(hamon::uint64_t w) const HAMON_NOEXCEPT
+		{
+			return w < m_threshold || m_p >= 1.0;
+		}
+
+		double          m_p;
+		hamon::uint64_t m_threshold;
+
+		friend class bernoulli_distribution;
+	};
+
+	HAMON_CXX11_CONSTEXPR bernoulli_distribution() HAMON_NOEXCEPT
+		: bernoulli_distribution(0.5)
+	{}
+
+	explicit HAMON_CXX11_CONSTEXPR
+	bernoulli_distribution(double p) HAMON_NOEXCEPT
+		: m_param(p)
+	{}
+
+	explicit HAMON_CXX11_CONSTEXPR
+	bernoulli_distribution(param_type const& parm) HAMON_NOEXCEPT
+		: m_param(parm)
+	{}
+
+	HAMON_CXX14_CONSTEXPR void reset() HAMON_NOEXCEPT {}
+
+	template <typename URBG>
+	HAMON_CXX14_CONSTEXPR result_type operator()(URBG& g)
+	{
+		return (*this)(g, m_param);
+	}
+
+	template <typename URBG>
+	HAMON_CXX14_CONSTEXPR result_type operator()(URBG& g, param_type const& parm)
+	{
+		return parm.test(hamon::detail::generate_uniform_bits<hamon::uint64_t>(g));
+	}
+
+	/**
+	 *	@brief	out の全ての要素を乱数で埋める
+	 *
+	 *	operator() を out.size() 回呼んだ場合と同じ結果になる。
+	 */
+	template <typename URBG>
+	void generate(URBG& g, hamon::span<result_type> out)
+	{
+		this->generate(g, out, m_param);
+	}
+
+	template <typename URBG>
+	void generate(URBG& g, hamon::span<result_type> out, param_type const& parm)
+	{
+		result_type* p = out.data();
+		hamon::detail::for_each_uniform_bits<hamon::uint64_t>(g, out.size(),
+			[&](hamon::uint64_t w) { *p++ = parm.test(w); });
+	}
+
+	HAMON_CXX11_CONSTEXPR double p() const HAMON_NOEXCEPT { return m_param.p(); }
+
+	HAMON_CXX11_CONSTEXPR param_type param() const HAMON_NOEXCEPT { return m_param; }
+	HAMON_CXX14_CONSTEXPR void param(param_type const& parm) HAMON_NOEXCEPT { m_param = parm; }
+
+	HAMON_CXX11_CONSTEXPR result_type min() const HAMON_NOEXCEPT { return false; }
+	HAMON_CXX11_CONSTEXPR result_type max() const HAMON_NOEXCEPT { return true; }
+
+	friend HAMON_CXX11_CONSTEXPR bool
+	operator==(bernoulli_distribution const& lhs, bernoulli_distribution const& rhs) HAMON_NOEXCEPT
+	{
+		return lhs.m_param == rhs.m_param;
+	}
+
+	friend HAMON_CXX11_CONSTEXPR bool
+	operator!=(bernoulli_distribution const& lhs, bernoulli_distribution const& rhs) HAMON_NOEXCEPT
+	{
+		return !(lhs == rhs);
+	}
+
+private:
+	param_type m_param;
+
+	template <typename CharT, typename Traits>
+	friend std::basic_ostream<CharT, Traits>&
+	operator<<(std::basic_ostream<CharT, Traits>& os, bernoulli_distribution const& d)
+	{
+		hamon::ios::flags_saver lx(os);
+		os.flags(std::ios_base::dec | std::ios_base::left | std::ios_base::scientific);
+		auto const prec = os.precision(hamon::numeric_limits<double>::max_digits10);
+		os << d.p();
+		os.precision(prec);
+		return os;
+	}
+
+	template <typename CharT, typename Traits>
+	friend std::basic_istream<CharT, Traits>&
+	operator>>(std::basic_istream<CharT, Traits>& is, bernoulli_distribution& d)
+	{
+		hamon::ios::flags_saver lx(is);
+		is.flags(std::ios_base::dec | std::ios_base::skipws);
+		double p {};
+		if (is >> p)
+		{
+			d.param(param_type(p));
+		}
+		return is;
+	}
+};
+
+}	// namespace hamon
+
+#endif // HAMON_RANDOM_DISTRIBUTIONS_BERNOULLI_DISTRIBUTION_HPP
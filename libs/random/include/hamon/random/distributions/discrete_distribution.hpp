@@ -0,0 +1,361 @@
+﻿/**
+ *	@file	discrete_distribution.hpp
+ *
+ *	@brief	discrete_distribution の定義
+ */
+
+#ifndef HAMON_RANDOM_DISTRIBUTIONS_DISCRETE_DISTRIBUTION_HPP
+#define HAMON_RANDOM_DISTRIBUTIONS_DISCRETE_DISTRIBUTION_HPP
+
+#include <hamon/random/detail/bounded_uniform_bits.hpp>
+#include <hamon/random/detail/uniform_bits.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/cstdint/uint64_t.hpp>
+#include <hamon/ios/flags_saver.hpp>
+#include <hamon/limits.hpp>
+#include <hamon/span.hpp>
+#include <hamon/vector.hpp>
+#include <hamon/config.hpp>
+#include <initializer_list>
+#include <istream>
+#include <ostream>
+
+namespace hamon
+{
+
+/**
+ *	@brief	i を重み w[i] に比例する確率で返す分布
+ *
+ *	Vose の alias 法で表を作り、1つの値を O(1) で生成する。
+ *	64bit の一様な整数2つのうち、1つ目で列 i を選び、
+ *	2つ目の上位 53bit が閾値より小さければ i を、そうでなければ alias[i] を返す。
+ *	表は double の演算だけで作るので、処理系によらず同じ結果になる。
+ */
+template <typename IntType = int>
+class discrete_distribution
+{
+public:
+	using result_type = IntType;
+
+	class param_type
+	{
+	public:
+		using distribution_type = discrete_distribution;
+
+		param_type()
+		{
+			this->init();
+		}
+
+		template <typename InputIterator>
+		param_type(InputIterator first, InputIterator last)
+			: m_prob(first, last)
+		{
+			this->init();
+		}
+
+		param_type(std::initializer_list<double> wl)
+			: m_prob(wl.begin(), wl.end())
+		{
+			this->init();
+		}
+
+		template <typename UnaryOperation>
+		param_type(hamon::size_t nw, double xmin, double xmax, UnaryOperation fw)
+		{
+			if (nw == 0)
+			{
+				nw = 1;
+			}
+			double const delta = (xmax - xmin) / static_cast<double>(nw);
+			m_prob.reserve(nw);
+			for (hamon::size_t k = 0; k < nw; ++k)
+			{
+				m_prob.push_back(fw(xmin + static_cast<double>(k) * delta + delta / 2));
+			}
+			this->init();
+		}
+
+		hamon::vector<double> probabilities() const
+		{
+			return m_prob;
+		}
+
+		friend bool
+		operator==(param_type const& lhs, param_type const& rhs)
+		{
+			return lhs.m_prob == rhs.m_prob;
+		}
+
+		friend bool
+		operator!=(param_type const& lhs, param_type const& rhs)
+		{
+			return !(lhs == rhs);
+		}
+
+	private:
+		static HAMON_CONSTEXPR double two_pow_53 = 9007199254740992.0;
+
+		// 重みを正規化して alias 表を作る
+		void init()
+		{
+			if (m_prob.empty())
+			{
+				m_prob.push_back(1.0);
+			}
+
+			hamon::size_t const n = m_prob.size();
+
+			double sum = 0;
+			for (auto w : m_prob)
+			{
+				sum += w;
+			}
+			for (auto& w : m_prob)
+			{
+				// 重みの合計が 0 の場合は一様にする
+				w = sum > 0 ? w / sum : 1.0 / static_cast<double>(n);
+			}
+
+			hamon::vector<double> q(n);
+			hamon::vector<hamon::size_t> small;
+			hamon::vector<hamon::size_t> large;
+			for (hamon::size_t i = 0; i < n; ++i)
+			{
+				q[i] = m_prob[i] * static_cast<double>(n);
+				(q[i] < 1.0 ? small : large).push_back(i);
+			}
+
+			m_threshold.assign(n, 0);
+			m_alias.assign(n, 0);
+			for (hamon::size_t i = 0; i < n; ++i)
+			{
+				m_alias[i] = i;
+			}
+
+			while (!small.empty() && !large.empty())
+			{
+				hamon::size_t const s = small.back();
+				small.pop_back();
+				hamon::size_t const l = large.back();
+
+				m_threshold[s] = to_threshold(q[s]);
+				m_alias[s] = l;
+
+				q[l] = (q[l] + q[s]) - 1.0;
+				if (q[l] < 1.0)
+				{
+					large.pop_back();
+					small.push_back(l);
+				}
+			}
+
+			// 丸め誤差で残ったものは確率 1 とする
+			for (auto i : small)
+			{
+				m_threshold[i] = to_threshold(1.0);
+			}
+			for (auto i : large)
+			{
+				m_threshold[i] = to_threshold(1.0);
+			}
+		}
+
+		static hamon::uint64_t to_threshold(double q) HAMON_NOEXCEPT
+		{
+			return
+				!(q > 0.0) ? 0 :
+				q >= 1.0 ? static_cast<hamon::uint64_t>(two_pow_53) :
+				static_cast<hamon::uint64_t>(q * two_pow_53);
+		}
+
+		hamon::size_t size() const HAMON_NOEXCEPT
+		{
+			return m_prob.size();
+		}
+
+		// 列 i と一様な整数 w から値を選ぶ
+		hamon::size_t pick(hamon::size_t i, hamon::uint64_t w) const HAMON_NOEXCEPT
+		{
+			return (w >> 11) < m_threshold[i] ? i : m_alias[i];
+		}
+
+		hamon::vector<double>          m_prob;
+		hamon::vector<hamon::uint64_t> m_threshold;
+		hamon::vector<hamon::size_t>   m_alias;
+
+		friend class discrete_distribution;
+	};
+
+	discrete_distribution()
+		: m_param()
+	{}
+
+	template <typename InputIterator>
+	discrete_distribution(InputIterator first, InputIterator last)
+		: m_param(first, last)
+	{}
+
+	discrete_distribution(std::initializer_list<double> wl)
+		: m_param(wl)
+	{}
+
+	template <typename UnaryOperation>
+	discrete_distribution(hamon::size_t nw, double xmin, double xmax, UnaryOperation fw)
+		: m_param(nw, xmin, xmax, fw)
+	{}
+
+	explicit discrete_distribution(param_type const& parm)
+		: m_param(parm)
+	{}
+
+	void reset() HAMON_NOEXCEPT {}
+
+	template <typename URBG>
+	result_type operator()(URBG& g)
+	{
+		return (*this)(g, m_param);
+	}
+
+	template <typename URBG>
+	result_type operator()(URBG& g, param_type const& parm)
+	{
+		auto const i = select(g, hamon::detail::generate_uniform_bits<hamon::uint64_t>(g), parm);
+		return static_cast<result_type>(
+			parm.pick(i, hamon::detail::generate_uniform_bits<hamon::uint64_t>(g)));
+	}
+
+	/**
+	 *	@brief	out の全ての要素を乱数で埋める
+	 *
+	 *	1つの値に一様な整数を2つずつ使う。列の選択で棄却された場合の追加の値は、
+	 *	その都度エンジンから作るので、operator() を繰り返し呼んだ場合と結果が同じになるとは限らない。
+	 */
+	template <typename URBG>
+	void generate(URBG& g, hamon::span<result_type> out)
+	{
+		this->generate(g, out, m_param);
+	}
+
+	template <typename URBG>
+	void generate(URBG& g, hamon::span<result_type> out, param_type const& parm)
+	{
+		result_type* p = out.data();
+		hamon::size_t i = 0;
+		bool coin = false;
+		hamon::detail::for_each_uniform_bits<hamon::uint64_t>(g, out.size() * 2,
+			[&](hamon::uint64_t w)
+			{
+				if (coin)
+				{
+					*p++ = static_cast<result_type>(parm.pick(i, w));
+				}
+				else
+				{
+					i = select(g, w, parm);
+				}
+				coin = !coin;
+			});
+	}
+
+	hamon::vector<double> probabilities() const
+	{
+		return m_param.probabilities();
+	}
+
+	param_type param() const
+	{
+		return m_param;
+	}
+
+	void param(param_type const& parm)
+	{
+		m_param = parm;
+	}
+
+	result_type min() const HAMON_NOEXCEPT
+	{
+		return result_type(0);
+	}
+
+	result_type max() const HAMON_NOEXCEPT
+	{
+		return static_cast<result_type>(m_param.size() - 1);
+	}
+
+	friend bool
+	operator==(discrete_distribution const& lhs, discrete_distribution const& rhs)
+	{
+		return lhs.m_param == rhs.m_param;
+	}
+
+	friend bool
+	operator!=(discrete_distribution const& lhs, discrete_distribution const& rhs)
+	{
+		return !(lhs == rhs);
+	}
+
+private:
+	// 一様な整数 w から列を選ぶ
+	template <typename URBG>
+	static hamon::size_t
+	select(URBG& g, hamon::uint64_t w, param_type const& parm)
+	{
+		return static_cast<hamon::size_t>(hamon::detail::bounded_uniform_bits(
+			g, w, static_cast<hamon::uint64_t>(parm.size())));
+	}
+
+	param_type m_param;
+
+	template <typename CharT, typename Traits>
+	friend std::basic_ostream<CharT, Traits>&
+	operator<<(std::basic_ostream<CharT, Traits>& os, discrete_distribution const& d)
+	{
+		hamon::ios::flags_saver lx(os);
+		os.flags(std::ios_base::dec | std::ios_base::left | std::ios_base::scientific);
+		CharT sp = os.widen(' ');
+		os.fill(sp);
+		auto const prec = os.precision(hamon::numeric_limits<double>::max_digits10);
+		auto const prob = d.probabilities();
+		os << prob.size();
+		for (auto x : prob)
+		{
+			os << sp << x;
+		}
+		os.precision(prec);
+		return os;
+	}
+
+	template <typename CharT, typename Traits>
+	friend std::basic_istream<CharT, Traits>&
+	operator>>(std::basic_istream<CharT, Traits>& is, discrete_distribution& d)
+	{
+		hamon::ios::flags_saver lx(is);
+		is.flags(std::ios_base::dec | std::ios_base::skipws);
+		hamon::size_t n = 0;
+		if (!(is >> n))
+		{
+			return is;
+		}
+		hamon::vector<double> prob(n);
+		for (auto& x : prob)
+		{
+			if (!(is >> x))
+			{
+				return is;
+			}
+		}
+		d.param(param_type(prob.begin(), prob.end()));
+		return is;
+	}
+};
+
+#if !defined(HAMON_HAS_CXX17_INLINE_VARIABLES)
+template <typename IntType>
+HAMON_CONSTEXPR double
+discrete_distribution<IntType>::param_type::two_pow_53;
+#endif
+
+}	// namespace hamon
+
+#endif // HAMON_RANDOM_DISTRIBUTIONS_DISCRETE_DISTRIBUTION_HPP
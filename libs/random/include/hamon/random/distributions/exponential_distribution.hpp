@@ -0,0 +1,182 @@
+﻿/**
+ *	@file	exponential_distribution.hpp
+ *
+ *	@brief	exponential_distribution の定義
+ */
+
+#ifndef HAMON_RANDOM_DISTRIBUTIONS_EXPONENTIAL_DISTRIBUTION_HPP
+#define HAMON_RANDOM_DISTRIBUTIONS_EXPONENTIAL_DISTRIBUTION_HPP
+
+#include <hamon/random/generate_canonical.hpp>
+#include <hamon/random/detail/uniform_bits.hpp>
+#include <hamon/cmath/batch/detail/log_kernel.hpp>
+#include <hamon/cstdint/uint64_t.hpp>
+#include <hamon/ios/flags_saver.hpp>
+#include <hamon/limits.hpp>
+#include <hamon/span.hpp>
+#include <hamon/config.hpp>
+#include <istream>
+#include <ostream>
+
+namespace hamon
+{
+
+/**
+ *	@brief	パラメータ lambda の指数分布
+ *
+ *	64bit の一様な整数1つから (0, 1) の値 u を作り、-log(u) / lambda を返す。
+ *	棄却がないので、1つの値に使うエンジンの出力は常に1つ。
+ *	log は hamon::batch の多項式近似を使うので、libm の実装に依存しない。
+ */
+template <typename RealType = double>
+class exponential_distribution
+{
+public:
+	using result_type = RealType;
+
+	class param_type
+	{
+	public:
+		using distribution_type = exponential_distribution;
+
+		HAMON_CXX11_CONSTEXPR param_type() HAMON_NOEXCEPT
+			: param_type(1)
+		{}
+
+		explicit HAMON_CXX11_CONSTEXPR
+		param_type(RealType lambda) HAMON_NOEXCEPT
+			: m_lambda(lambda)
+		{}
+
+		HAMON_CXX11_CONSTEXPR result_type lambda() const HAMON_NOEXCEPT { return m_lambda; }
+
+		friend HAMON_CXX11_CONSTEXPR bool
+		operator==(param_type const& lhs, param_type const& rhs) HAMON_NOEXCEPT
+		{
+			return lhs.m_lambda == rhs.m_lambda;
+		}
+
+		friend HAMON_CXX11_CONSTEXPR bool
+		operator!=(param_type const& lhs, param_type const& rhs) HAMON_NOEXCEPT
+		{
+			return !(lhs == rhs);
+		}
+
+	private:
+		RealType m_lambda;
+	};
+
+	HAMON_CXX11_CONSTEXPR exponential_distribution() HAMON_NOEXCEPT
+		: exponential_distribution(1)
+	{}
+
+	explicit HAMON_CXX11_CONSTEXPR
+	exponential_distribution(RealType lambda) HAMON_NOEXCEPT
+		: m_param(lambda)
+	{}
+
+	explicit HAMON_CXX11_CONSTEXPR
+	exponential_distribution(param_type const& parm) HAMON_NOEXCEPT
+		: m_param(parm)
+	{}
+
+	HAMON_CXX14_CONSTEXPR void reset() HAMON_NOEXCEPT {}
+
+	template <typename URBG>
+	result_type operator()(URBG& g)
+	{
+		return (*this)(g, m_param);
+	}
+
+	template <typename URBG>
+	result_type operator()(URBG& g, param_type const& parm)
+	{
+		return transform(hamon::detail::generate_uniform_bits<hamon::uint64_t>(g), parm);
+	}
+
+	/**
+	 *	@brief	out の全ての要素を乱数で埋める
+	 *
+	 *	operator() を out.size() 回呼んだ場合と同じ結果になる。
+	 */
+	template <typename URBG>
+	void generate(URBG& g, hamon::span<result_type> out)
+	{
+		this->generate(g, out, m_param);
+	}
+
+	template <typename URBG>
+	void generate(URBG& g, hamon::span<result_type> out, param_type const& parm)
+	{
+		result_type* p = out.data();
+		hamon::detail::for_each_uniform_bits<hamon::uint64_t>(g, out.size(),
+			[&](hamon::uint64_t w) { *p++ = transform(w, parm); });
+	}
+
+	HAMON_CXX11_CONSTEXPR result_type lambda() const HAMON_NOEXCEPT { return m_param.lambda(); }
+
+	HAMON_CXX11_CONSTEXPR param_type param() const HAMON_NOEXCEPT { return m_param; }
+	HAMON_CXX14_CONSTEXPR void param(param_type const& parm) HAMON_NOEXCEPT { m_param = parm; }
+
+	HAMON_CXX11_CONSTEXPR result_type min() const HAMON_NOEXCEPT
+	{
+		return RealType(0);
+	}
+
+	HAMON_CXX11_CONSTEXPR result_type max() const HAMON_NOEXCEPT
+	{
+		return hamon::numeric_limits<RealType>::infinity();
+	}
+
+	friend HAMON_CXX11_CONSTEXPR bool
+	operator==(exponential_distribution const& lhs, exponential_distribution const& rhs) HAMON_NOEXCEPT
+	{
+		return lhs.m_param == rhs.m_param;
+	}
+
+	friend HAMON_CXX11_CONSTEXPR bool
+	operator!=(exponential_distribution const& lhs, exponential_distribution const& rhs) HAMON_NOEXCEPT
+	{
+		return !(lhs == rhs);
+	}
+
+private:
+	static result_type
+	transform(hamon::uint64_t w, param_type const& parm)
+	{
+		double const z = -hamon::batch::detail::log_kernel(hamon::detail::canonical_open_double(w));
+		return static_cast<RealType>(z) / parm.lambda();
+	}
+
+	param_type m_param;
+
+	template <typename CharT, typename Traits>
+	friend std::basic_ostream<CharT, Traits>&
+	operator<<(std::basic_ostream<CharT, Traits>& os, exponential_distribution const& d)
+	{
+		hamon::ios::flags_saver lx(os);
+		os.flags(std::ios_base::dec | std::ios_base::left | std::ios_base::scientific);
+		auto const prec = os.precision(hamon::numeric_limits<RealType>::max_digits10);
+		os << d.lambda();
+		os.precision(prec);
+		return os;
+	}
+
+	template <typename CharT, typename Traits>
+	friend std::basic_istream<CharT, Traits>&
+	operator>>(std::basic_istream<CharT, Traits>& is, exponential_distribution& d)
+	{
+		hamon::ios::flags_saver lx(is);
+		is.flags(std::ios_base::dec | std::ios_base::skipws);
+		RealType lambda {};
+		if (is >> lambda)
+		{
+			d.param(param_type(lambda));
+		}
+		return is;
+	}
+};
+
+}	// namespace hamon
+
+#endif // HAMON_RANDOM_DISTRIBUTIONS_EXPONENTIAL_DISTRIBUTION_HPP
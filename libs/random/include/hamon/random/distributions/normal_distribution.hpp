@@ -0,0 +1,255 @@
+﻿/**
+ *	@file	normal_distribution.hpp
+ *
+ *	@brief	normal_distribution の定義
+ */
+
+#ifndef HAMON_RANDOM_DISTRIBUTIONS_NORMAL_DISTRIBUTION_HPP
+#define HAMON_RANDOM_DISTRIBUTIONS_NORMAL_DISTRIBUTION_HPP
+
+#include <hamon/random/distributions/detail/ziggurat_normal_tables.hpp>
+#include <hamon/random/generate_canonical.hpp>
+#include <hamon/random/detail/uniform_bits.hpp>
+#include <hamon/cmath/batch/detail/exp_kernel.hpp>
+#include <hamon/cmath/batch/detail/log_kernel.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/cstdint/uint64_t.hpp>
+#include <hamon/ios/flags_saver.hpp>
+#include <hamon/limits.hpp>
+#include <hamon/span.hpp>
+#include <hamon/config.hpp>
+#include <istream>
+#include <ostream>
+
+namespace hamon
+{
+
+namespace detail
+{
+
+// 64bit の一様な整数 w から標準正規分布の値を作る (Marsaglia, Tsang の ziggurat 法)
+//
+// 下位 8bit で層を選び、上位 53bit で [-1, 1) の値を作る。
+// ほとんどの場合は比較1回で決まり、それ以外の場合だけ g から追加の値を作る。
+// exp と log は hamon::batch の多項式近似を使うので、libm の実装に依存しない。
+template <typename URBG>
+inline double
+ziggurat_normal(URBG& g, hamon::uint64_t w)
+{
+	auto const& X = hamon::detail::ziggurat_normal_x();
+	auto const& F = hamon::detail::ziggurat_normal_f();
+	auto const R = hamon::detail::ziggurat_normal_r;
+	using canonical = hamon::detail::canonical_traits<double, 53>;
+
+	for (;;)
+	{
+		auto const i = static_cast<hamon::size_t>(w & 0xFF);
+		double const u = 2.0 * canonical::from_bits(w) - 1.0;
+		double const x = u * X[i];
+
+		if ((x < 0 ? -x : x) < X[i + 1])
+		{
+			return x;
+		}
+
+		if (i == 0)
+		{
+			// 裾 (|x| > R) は指数分布を使った棄却法で作る
+			auto open01 = [&g]()
+			{
+				return hamon::detail::canonical_open_double(
+					hamon::detail::generate_uniform_bits<hamon::uint64_t>(g));
+			};
+
+			double tx = 0;
+			double ty = 0;
+			do
+			{
+				tx = hamon::batch::detail::log_kernel(open01()) / R;
+				ty = hamon::batch::detail::log_kernel(open01());
+			}
+			while (-2.0 * ty < tx * tx);
+
+			return u < 0 ? tx - R : R - tx;
+		}
+
+		double const c = canonical::from_bits(
+			hamon::detail::generate_uniform_bits<hamon::uint64_t>(g));
+		if (F[i + 1] + (F[i] - F[i + 1]) * c < hamon::batch::detail::exp_kernel(-0.5 * x * x))
+		{
+			return x;
+		}
+
+		w = hamon::detail::generate_uniform_bits<hamon::uint64_t>(g);
+	}
+}
+
+}	// namespace detail
+
+/**
+ *	@brief	平均 mean, 標準偏差 stddev の正規分布
+ *
+ *	ziggurat 法で double の標準正規分布の値 z を作り、RealType(z) * stddev + mean を返す。
+ *	IEEE 754 の double で計算する限り、処理系によらず同じ結果になる。
+ *	(long double の場合も z の精度は double と同じ)
+ */
+template <typename RealType = double>
+class normal_distribution
+{
+public:
+	using result_type = RealType;
+
+	class param_type
+	{
+	public:
+		using distribution_type = normal_distribution;
+
+		HAMON_CXX11_CONSTEXPR param_type() HAMON_NOEXCEPT
+			: param_type(0)
+		{}
+
+		explicit HAMON_CXX11_CONSTEXPR
+		param_type(RealType mean, RealType stddev = RealType(1)) HAMON_NOEXCEPT
+			: m_mean(mean), m_stddev(stddev)
+		{}
+
+		HAMON_CXX11_CONSTEXPR result_type mean() const HAMON_NOEXCEPT { return m_mean; }
+		HAMON_CXX11_CONSTEXPR result_type stddev() const HAMON_NOEXCEPT { return m_stddev; }
+
+		friend HAMON_CXX11_CONSTEXPR bool
+		operator==(param_type const& lhs, param_type const& rhs) HAMON_NOEXCEPT
+		{
+			return lhs.m_mean == rhs.m_mean && lhs.m_stddev == rhs.m_stddev;
+		}
+
+		friend HAMON_CXX11_CONSTEXPR bool
+		operator!=(param_type const& lhs, param_type const& rhs) HAMON_NOEXCEPT
+		{
+			return !(lhs == rhs);
+		}
+
+	private:
+		RealType m_mean;
+		RealType m_stddev;
+	};
+
+	HAMON_CXX11_CONSTEXPR normal_distribution() HAMON_NOEXCEPT
+		: normal_distribution(0)
+	{}
+
+	explicit HAMON_CXX11_CONSTEXPR
+	normal_distribution(RealType mean, RealType stddev = RealType(1)) HAMON_NOEXCEPT
+		: m_param(mean, stddev)
+	{}
+
+	explicit HAMON_CXX11_CONSTEXPR
+	normal_distribution(param_type const& parm) HAMON_NOEXCEPT
+		: m_param(parm)
+	{}
+
+	HAMON_CXX14_CONSTEXPR void reset() HAMON_NOEXCEPT {}
+
+	template <typename URBG>
+	result_type operator()(URBG& g)
+	{
+		return (*this)(g, m_param);
+	}
+
+	template <typename URBG>
+	result_type operator()(URBG& g, param_type const& parm)
+	{
+		return transform(g, hamon::detail::generate_uniform_bits<hamon::uint64_t>(g), parm);
+	}
+
+	/**
+	 *	@brief	out の全ての要素を乱数で埋める
+	 *
+	 *	棄却された場合の追加の値は、その都度エンジンから作るので、
+	 *	operator() を繰り返し呼んだ場合と結果が同じになるとは限らない。
+	 */
+	template <typename URBG>
+	void generate(URBG& g, hamon::span<result_type> out)
+	{
+		this->generate(g, out, m_param);
+	}
+
+	template <typename URBG>
+	void generate(URBG& g, hamon::span<result_type> out, param_type const& parm)
+	{
+		result_type* p = out.data();
+		hamon::detail::for_each_uniform_bits<hamon::uint64_t>(g, out.size(),
+			[&](hamon::uint64_t w) { *p++ = transform(g, w, parm); });
+	}
+
+	HAMON_CXX11_CONSTEXPR result_type mean() const HAMON_NOEXCEPT { return m_param.mean(); }
+	HAMON_CXX11_CONSTEXPR result_type stddev() const HAMON_NOEXCEPT { return m_param.stddev(); }
+
+	HAMON_CXX11_CONSTEXPR param_type param() const HAMON_NOEXCEPT { return m_param; }
+	HAMON_CXX14_CONSTEXPR void param(param_type const& parm) HAMON_NOEXCEPT { m_param = parm; }
+
+	HAMON_CXX11_CONSTEXPR result_type min() const HAMON_NOEXCEPT
+	{
+		return -hamon::numeric_limits<RealType>::infinity();
+	}
+
+	HAMON_CXX11_CONSTEXPR result_type max() const HAMON_NOEXCEPT
+	{
+		return hamon::numeric_limits<RealType>::infinity();
+	}
+
+	friend HAMON_CXX11_CONSTEXPR bool
+	operator==(normal_distribution const& lhs, normal_distribution const& rhs) HAMON_NOEXCEPT
+	{
+		return lhs.m_param == rhs.m_param;
+	}
+
+	friend HAMON_CXX11_CONSTEXPR bool
+	operator!=(normal_distribution const& lhs, normal_distribution const& rhs) HAMON_NOEXCEPT
+	{
+		return !(lhs == rhs);
+	}
+
+private:
+	template <typename URBG>
+	static result_type
+	transform(URBG& g, hamon::uint64_t w, param_type const& parm)
+	{
+		auto const z = static_cast<RealType>(hamon::detail::ziggurat_normal(g, w));
+		return z * parm.stddev() + parm.mean();
+	}
+
+	param_type m_param;
+
+	template <typename CharT, typename Traits>
+	friend std::basic_ostream<CharT, Traits>&
+	operator<<(std::basic_ostream<CharT, Traits>& os, normal_distribution const& d)
+	{
+		hamon::ios::flags_saver lx(os);
+		os.flags(std::ios_base::dec | std::ios_base::left | std::ios_base::scientific);
+		CharT sp = os.widen(' ');
+		os.fill(sp);
+		auto const prec = os.precision(hamon::numeric_limits<RealType>::max_digits10);
+		os << d.mean() << sp << d.stddev();
+		os.precision(prec);
+		return os;
+	}
+
+	template <typename CharT, typename Traits>
+	friend std::basic_istream<CharT, Traits>&
+	operator>>(std::basic_istream<CharT, Traits>& is, normal_distribution& d)
+	{
+		hamon::ios::flags_saver lx(is);
+		is.flags(std::ios_base::dec | std::ios_base::skipws);
+		RealType mean {};
+		RealType stddev {};
+		if (is >> mean >> stddev)
+		{
+			d.param(param_type(mean, stddev));
+		}
+		return is;
+	}
+};
+
+}	// namespace hamon
+
+#endif // HAMON_RANDOM_DISTRIBUTIONS_NORMAL_DISTRIBUTION_HPP
@@ -7,12 +7,195 @@
 #ifndef HAMON_RANDOM_DISTRIBUTIONS_UNIFORM_INT_DISTRIBUTION_HPP
 #define HAMON_RANDOM_DISTRIBUTIONS_UNIFORM_INT_DISTRIBUTION_HPP
 
-#include <random>
+#include <hamon/random/detail/bounded_uniform_bits.hpp>
+#include <hamon/random/detail/uniform_bits.hpp>
+#include <hamon/cstdint/uint32_t.hpp>
+#include <hamon/cstdint/uint64_t.hpp>
+#include <hamon/ios/flags_saver.hpp>
+#include <hamon/limits.hpp>
+#include <hamon/span.hpp>
+#include <hamon/type_traits/conditional.hpp>
+#include <hamon/type_traits/make_unsigned.hpp>
+#include <hamon/config.hpp>
+#include <istream>
+#include <ostream>
 
 namespace hamon
 {
 
-using std::uniform_int_distribution;
+/**
+ *	@brief	[a, b] の一様な整数を生成する
+ *
+ *	Lemire の方法 (detail::bounded_uniform_bits) で生成する。
+ *	ほとんどの場合、乗算1回で値が決まり、除算は棄却が必要かもしれない場合にだけ1回行う。
+ *
+ *	範囲が 32bit に収まる型は 32bit、それ以外は 64bit の一様な整数を使う。
+ *	エンジンが同じ値を返せば、処理系によらず同じ結果になる。
+ */
+template <typename IntType = int>
+class uniform_int_distribution
+{
+private:
+	using unsigned_type = hamon::make_unsigned_t<IntType>;
+
+	using word_type = hamon::conditional_t<
+		(hamon::numeric_limits<unsigned_type>::digits <= 32),
+		hamon::uint32_t,
+		hamon::uint64_t>;
+
+public:
+	using result_type = IntType;
+
+	class param_type
+	{
+	public:
+		using distribution_type = uniform_int_distribution;
+
+		HAMON_CXX11_CONSTEXPR param_type() HAMON_NOEXCEPT
+			: param_type(0)
+		{}
+
+		explicit HAMON_CXX11_CONSTEXPR
+		param_type(IntType a, IntType b = hamon::numeric_limits<IntType>::max()) HAMON_NOEXCEPT
+			: m_a(a), m_b(b)
+		{}
+
+		HAMON_CXX11_CONSTEXPR result_type a() const HAMON_NOEXCEPT { return m_a; }
+		HAMON_CXX11_CONSTEXPR result_type b() const HAMON_NOEXCEPT { return m_b; }
+
+		friend HAMON_CXX11_CONSTEXPR bool
+		operator==(param_type const& lhs, param_type const& rhs) HAMON_NOEXCEPT
+		{
+			return lhs.m_a == rhs.m_a && lhs.m_b == rhs.m_b;
+		}
+
+		friend HAMON_CXX11_CONSTEXPR bool
+		operator!=(param_type const& lhs, param_type const& rhs) HAMON_NOEXCEPT
+		{
+			return !(lhs == rhs);
+		}
+
+	private:
+		IntType m_a;
+		IntType m_b;
+	};
+
+	HAMON_CXX11_CONSTEXPR uniform_int_distribution() HAMON_NOEXCEPT
+		: uniform_int_distribution(0)
+	{}
+
+	explicit HAMON_CXX11_CONSTEXPR
+	uniform_int_distribution(IntType a, IntType b = hamon::numeric_limits<IntType>::max()) HAMON_NOEXCEPT
+		: m_param(a, b)
+	{}
+
+	explicit HAMON_CXX11_CONSTEXPR
+	uniform_int_distribution(param_type const& parm) HAMON_NOEXCEPT
+		: m_param(parm)
+	{}
+
+	HAMON_CXX14_CONSTEXPR void reset() HAMON_NOEXCEPT {}
+
+	template <typename URBG>
+	HAMON_CXX14_CONSTEXPR result_type operator()(URBG& g)
+	{
+		return (*this)(g, m_param);
+	}
+
+	template <typename URBG>
+	HAMON_CXX14_CONSTEXPR result_type operator()(URBG& g, param_type const& parm)
+	{
+		return transform(g, hamon::detail::generate_uniform_bits<word_type>(g), parm);
+	}
+
+	/**
+	 *	@brief	out の全ての要素を乱数で埋める
+	 *
+	 *	一様な整数をエンジンの generate でまとめて作ってから変換する。
+	 *	棄却された場合の追加の値は、その都度エンジンから作るので、
+	 *	operator() を繰り返し呼んだ場合と結果が同じになるとは限らない。
+	 */
+	template <typename URBG>
+	void generate(URBG& g, hamon::span<result_type> out)
+	{
+		this->generate(g, out, m_param);
+	}
+
+	template <typename URBG>
+	void generate(URBG& g, hamon::span<result_type> out, param_type const& parm)
+	{
+		result_type* p = out.data();
+		hamon::detail::for_each_uniform_bits<word_type>(g, out.size(),
+			[&](word_type x) { *p++ = transform(g, x, parm); });
+	}
+
+	HAMON_CXX11_CONSTEXPR result_type a() const HAMON_NOEXCEPT { return m_param.a(); }
+	HAMON_CXX11_CONSTEXPR result_type b() const HAMON_NOEXCEPT { return m_param.b(); }
+
+	HAMON_CXX11_CONSTEXPR param_type param() const HAMON_NOEXCEPT { return m_param; }
+	HAMON_CXX14_CONSTEXPR void param(param_type const& parm) HAMON_NOEXCEPT { m_param = parm; }
+
+	HAMON_CXX11_CONSTEXPR result_type min() const HAMON_NOEXCEPT { return a(); }
+	HAMON_CXX11_CONSTEXPR result_type max() const HAMON_NOEXCEPT { return b(); }
+
+	friend HAMON_CXX11_CONSTEXPR bool
+	operator==(uniform_int_distribution const& lhs, uniform_int_distribution const& rhs) HAMON_NOEXCEPT
+	{
+		return lhs.m_param == rhs.m_param;
+	}
+
+	friend HAMON_CXX11_CONSTEXPR bool
+	operator!=(uniform_int_distribution const& lhs, uniform_int_distribution const& rhs) HAMON_NOEXCEPT
+	{
+		return !(lhs == rhs);
+	}
+
+private:
+	// 一様な整数 x を [a, b] に写す。棄却する場合は g から新しい値を作る。
+	template <typename URBG>
+	static HAMON_CXX14_CONSTEXPR result_type
+	transform(URBG& g, word_type x, param_type const& parm)
+	{
+		// unsigned_type が int より狭いと差が int に昇格して負になり得るので、
+		// いったん unsigned_type に戻してから word_type に広げる
+		auto const range = static_cast<word_type>(static_cast<unsigned_type>(
+			static_cast<unsigned_type>(parm.b()) - static_cast<unsigned_type>(parm.a())));
+
+		word_type const r = range == hamon::numeric_limits<word_type>::max() ? x :
+			hamon::detail::bounded_uniform_bits(g, x, static_cast<word_type>(range + 1));
+
+		return static_cast<result_type>(static_cast<unsigned_type>(
+			static_cast<unsigned_type>(parm.a()) + static_cast<unsigned_type>(r)));
+	}
+
+	param_type m_param;
+
+	template <typename CharT, typename Traits>
+	friend std::basic_ostream<CharT, Traits>&
+	operator<<(std::basic_ostream<CharT, Traits>& os, uniform_int_distribution const& d)
+	{
+		hamon::ios::flags_saver lx(os);
+		os.flags(std::ios_base::dec | std::ios_base::left);
+		CharT sp = os.widen(' ');
+		os.fill(sp);
+		return os << d.a() << sp << d.b();
+	}
+
+	template <typename CharT, typename Traits>
+	friend std::basic_istream<CharT, Traits>&
+	operator>>(std::basic_istream<CharT, Traits>& is, uniform_int_distribution& d)
+	{
+		hamon::ios::flags_saver lx(is);
+		is.flags(std::ios_base::dec | std::ios_base::skipws);
+		IntType a {};
+		IntType b {};
+		if (is >> a >> b)
+		{
+			d.param(param_type(a, b));
+		}
+		return is;
+	}
+};
 
 }	// namespace hamon
 
@@ -7,12 +7,190 @@
 #ifndef HAMON_RANDOM_DISTRIBUTIONS_UNIFORM_REAL_DISTRIBUTION_HPP
 #define HAMON_RANDOM_DISTRIBUTIONS_UNIFORM_REAL_DISTRIBUTION_HPP
 
-#include <random>
+#include <hamon/random/generate_canonical.hpp>
+#include <hamon/random/detail/uniform_bits.hpp>
+#include <hamon/ios/flags_saver.hpp>
+#include <hamon/limits.hpp>
+#include <hamon/span.hpp>
+#include <hamon/config.hpp>
+#include <istream>
+#include <ostream>
 
 namespace hamon
 {
 
-using std::uniform_real_distribution;
+/**
+ *	@brief	[a, b) の一様な浮動小数点数を生成する
+ *
+ *	generate_canonical で作った [0, 1) の値 u から u * (b - a) + a を計算する。
+ *	丸めで b になった場合は棄却するので、結果は常に b より小さい。
+ *
+ *	IEEE 754 の float, double では、処理系によらず同じ結果になる。
+ */
+template <typename RealType = double>
+class uniform_real_distribution
+{
+private:
+	using canonical = hamon::detail::canonical_traits<
+		RealType, hamon::numeric_limits<RealType>::digits>;
+
+	using word_type = typename canonical::word_type;
+
+public:
+	using result_type = RealType;
+
+	class param_type
+	{
+	public:
+		using distribution_type = uniform_real_distribution;
+
+		HAMON_CXX11_CONSTEXPR param_type() HAMON_NOEXCEPT
+			: param_type(0)
+		{}
+
+		explicit HAMON_CXX11_CONSTEXPR
+		param_type(RealType a, RealType b = RealType(1)) HAMON_NOEXCEPT
+			: m_a(a), m_b(b)
+		{}
+
+		HAMON_CXX11_CONSTEXPR result_type a() const HAMON_NOEXCEPT { return m_a; }
+		HAMON_CXX11_CONSTEXPR result_type b() const HAMON_NOEXCEPT { return m_b; }
+
+		friend HAMON_CXX11_CONSTEXPR bool
+		operator==(param_type const& lhs, param_type const& rhs) HAMON_NOEXCEPT
+		{
+			return lhs.m_a == rhs.m_a && lhs.m_b == rhs.m_b;
+		}
+
+		friend HAMON_CXX11_CONSTEXPR bool
+		operator!=(param_type const& lhs, param_type const& rhs) HAMON_NOEXCEPT
+		{
+			return !(lhs == rhs);
+		}
+
+	private:
+		RealType m_a;
+		RealType m_b;
+	};
+
+	HAMON_CXX11_CONSTEXPR uniform_real_distribution() HAMON_NOEXCEPT
+		: uniform_real_distribution(0)
+	{}
+
+	explicit HAMON_CXX11_CONSTEXPR
+	uniform_real_distribution(RealType a, RealType b = RealType(1)) HAMON_NOEXCEPT
+		: m_param(a, b)
+	{}
+
+	explicit HAMON_CXX11_CONSTEXPR
+	uniform_real_distribution(param_type const& parm) HAMON_NOEXCEPT
+		: m_param(parm)
+	{}
+
+	HAMON_CXX14_CONSTEXPR void reset() HAMON_NOEXCEPT {}
+
+	template <typename URBG>
+	HAMON_CXX14_CONSTEXPR result_type operator()(URBG& g)
+	{
+		return (*this)(g, m_param);
+	}
+
+	template <typename URBG>
+	HAMON_CXX14_CONSTEXPR result_type operator()(URBG& g, param_type const& parm)
+	{
+		return transform(g, hamon::detail::generate_uniform_bits<word_type>(g), parm);
+	}
+
+	/**
+	 *	@brief	out の全ての要素を乱数で埋める
+	 *
+	 *	棄却された場合の追加の値は、その都度エンジンから作るので、
+	 *	operator() を繰り返し呼んだ場合と結果が同じになるとは限らない。
+	 */
+	template <typename URBG>
+	void generate(URBG& g, hamon::span<result_type> out)
+	{
+		this->generate(g, out, m_param);
+	}
+
+	template <typename URBG>
+	void generate(URBG& g, hamon::span<result_type> out, param_type const& parm)
+	{
+		result_type* p = out.data();
+		hamon::detail::for_each_uniform_bits<word_type>(g, out.size(),
+			[&](word_type x) { *p++ = transform(g, x, parm); });
+	}
+
+	HAMON_CXX11_CONSTEXPR result_type a() const HAMON_NOEXCEPT { return m_param.a(); }
+	HAMON_CXX11_CONSTEXPR result_type b() const HAMON_NOEXCEPT { return m_param.b(); }
+
+	HAMON_CXX11_CONSTEXPR param_type param() const HAMON_NOEXCEPT { return m_param; }
+	HAMON_CXX14_CONSTEXPR void param(param_type const& parm) HAMON_NOEXCEPT { m_param = parm; }
+
+	HAMON_CXX11_CONSTEXPR result_type min() const HAMON_NOEXCEPT { return a(); }
+	HAMON_CXX11_CONSTEXPR result_type max() const HAMON_NOEXCEPT { return b(); }
+
+	friend HAMON_CXX11_CONSTEXPR bool
+	operator==(uniform_real_distribution const& lhs, uniform_real_distribution const& rhs) HAMON_NOEXCEPT
+	{
+		return lhs.m_param == rhs.m_param;
+	}
+
+	friend HAMON_CXX11_CONSTEXPR bool
+	operator!=(uniform_real_distribution const& lhs, uniform_real_distribution const& rhs) HAMON_NOEXCEPT
+	{
+		return !(lhs == rhs);
+	}
+
+private:
+	template <typename URBG>
+	static HAMON_CXX14_CONSTEXPR result_type
+	transform(URBG& g, word_type x, param_type const& parm)
+	{
+		RealType const a = parm.a();
+		RealType const b = parm.b();
+		for (;;)
+		{
+			RealType const r = canonical::from_bits(x) * (b - a) + a;
+			if (!(a < b) || r < b)
+			{
+				return r;
+			}
+			x = hamon::detail::generate_uniform_bits<word_type>(g);
+		}
+	}
+
+	param_type m_param;
+
+	template <typename CharT, typename Traits>
+	friend std::basic_ostream<CharT, Traits>&
+	operator<<(std::basic_ostream<CharT, Traits>& os, uniform_real_distribution const& d)
+	{
+		hamon::ios::flags_saver lx(os);
+		os.flags(std::ios_base::dec | std::ios_base::left | std::ios_base::scientific);
+		CharT sp = os.widen(' ');
+		os.fill(sp);
+		auto const prec = os.precision(hamon::numeric_limits<RealType>::max_digits10);
+		os << d.a() << sp << d.b();
+		os.precision(prec);
+		return os;
+	}
+
+	template <typename CharT, typename Traits>
+	friend std::basic_istream<CharT, Traits>&
+	operator>>(std::basic_istream<CharT, Traits>& is, uniform_real_distribution& d)
+	{
+		hamon::ios::flags_saver lx(is);
+		is.flags(std::ios_base::dec | std::ios_base::skipws);
+		RealType a {};
+		RealType b {};
+		if (is >> a >> b)
+		{
+			d.param(param_type(a, b));
+		}
+		return is;
+	}
+};
 
 }	// namespace hamon
 
@@ -7,7 +7,9 @@
 #ifndef HAMON_RANDOM_ENGINES_HPP
 #define HAMON_RANDOM_ENGINES_HPP
 
+#include <hamon/random/engines/generate_independent_engines.hpp>
 #include <hamon/random/engines/mersenne_twister_engine.hpp>
+#include <hamon/random/engines/multi_lane_xoshiro.hpp>
 #include <hamon/random/engines/xoroshiro.hpp>
 #include <hamon/random/engines/xorshift.hpp>
 #include <hamon/random/engines/xoshiro.hpp>
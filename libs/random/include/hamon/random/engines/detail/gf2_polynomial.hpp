@@ -0,0 +1,198 @@
+﻿/**
+ *	@file	gf2_polynomial.hpp
+ *
+ *	@brief	gf2_polynomial の定義
+ */
+
+#ifndef HAMON_RANDOM_ENGINES_DETAIL_GF2_POLYNOMIAL_HPP
+#define HAMON_RANDOM_ENGINES_DETAIL_GF2_POLYNOMIAL_HPP
+
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/cstdint/uint64_t.hpp>
+
+namespace hamon
+{
+
+namespace detail
+{
+
+// GF(2) 上の多項式 (Degree 次まで)
+//
+// i ビット目が t^i の係数を表す。
+template <hamon::size_t Degree>
+struct gf2_polynomial
+{
+	static hamon::size_t const word_count = Degree / 64 + 1;
+
+	hamon::uint64_t	m_words[word_count] {};
+
+	bool test(hamon::size_t i) const
+	{
+		return ((m_words[i / 64] >> (i % 64)) & 1) != 0;
+	}
+
+	void flip(hamon::size_t i)
+	{
+		m_words[i / 64] ^= hamon::uint64_t(1) << (i % 64);
+	}
+
+	gf2_polynomial& operator^=(gf2_polynomial const& rhs)
+	{
+		for (hamon::size_t i = 0; i < word_count; ++i)
+		{
+			m_words[i] ^= rhs.m_words[i];
+		}
+		return *this;
+	}
+
+	// *this ^= rhs * t^n
+	void xor_shifted(gf2_polynomial const& rhs, hamon::size_t n)
+	{
+		hamon::size_t const q = n / 64;
+		hamon::size_t const r = n % 64;
+		for (hamon::size_t i = word_count; i-- > q;)
+		{
+			hamon::uint64_t w = rhs.m_words[i - q] << r;
+			if (r != 0 && i > q)
+			{
+				w |= rhs.m_words[i - q - 1] >> (64 - r);
+			}
+			m_words[i] ^= w;
+		}
+	}
+
+	// *this *= t
+	void shift_left_1()
+	{
+		for (hamon::size_t i = word_count; i-- > 1;)
+		{
+			m_words[i] = (m_words[i] << 1) | (m_words[i - 1] >> 63);
+		}
+		m_words[0] <<= 1;
+	}
+};
+
+// a * b mod p (p は Degree 次、a と b は Degree 次未満)
+template <hamon::size_t Degree>
+inline gf2_polynomial<Degree>
+gf2_mulmod(
+	gf2_polynomial<Degree> const& a,
+	gf2_polynomial<Degree> const& b,
+	gf2_polynomial<Degree> const& p)
+{
+	gf2_polynomial<Degree> result;
+	for (hamon::size_t i = Degree; i-- > 0;)
+	{
+		result.shift_left_1();
+		if (result.test(Degree))
+		{
+			result ^= p;
+		}
+		if (b.test(i))
+		{
+			result ^= a;
+		}
+	}
+	return result;
+}
+
+// t^(2^e) mod p
+template <hamon::size_t Degree>
+inline gf2_polynomial<Degree>
+gf2_pow2_mod(hamon::size_t e, gf2_polynomial<Degree> const& p)
+{
+	gf2_polynomial<Degree> result;
+	result.flip(1);
+	for (; e != 0; --e)
+	{
+		result = gf2_mulmod(result, result, p);
+	}
+	return result;
+}
+
+// t^n mod p
+template <hamon::size_t Degree>
+inline gf2_polynomial<Degree>
+gf2_pow_mod(unsigned long long n, gf2_polynomial<Degree> const& p)
+{
+	gf2_polynomial<Degree> result;
+	result.flip(0);
+	gf2_polynomial<Degree> x;
+	x.flip(1);
+	for (; n != 0; n >>= 1)
+	{
+		if (n & 1)
+		{
+			result = gf2_mulmod(result, x, p);
+		}
+		x = gf2_mulmod(x, x, p);
+	}
+	return result;
+}
+
+// Berlekamp-Massey 法で、ビット列 s[0], ..., s[2 * Degree - 1] を生成する
+// 最小の線形漸化式の特性多項式を求める。
+//
+// s は bool を返す関数オブジェクトで、呼ぶたびに次のビットを返す。
+// 周期が最大の線形な生成器であれば、結果は状態遷移行列の特性多項式(Degree 次)になる。
+template <hamon::size_t Degree, typename BitGenerator>
+inline gf2_polynomial<Degree>
+gf2_berlekamp_massey(BitGenerator& s)
+{
+	bool seq[2 * Degree];
+	for (hamon::size_t i = 0; i < 2 * Degree; ++i)
+	{
+		seq[i] = s();
+	}
+
+	// c(t) = 1 + c_1 t + ... + c_L t^L
+	gf2_polynomial<Degree> c;
+	gf2_polynomial<Degree> b;
+	c.flip(0);
+	b.flip(0);
+	hamon::size_t l = 0;
+	hamon::size_t m = 1;
+	for (hamon::size_t n = 0; n < 2 * Degree; ++n)
+	{
+		bool d = seq[n];
+		for (hamon::size_t i = 1; i <= l; ++i)
+		{
+			d ^= c.test(i) && seq[n - i];
+		}
+
+		if (!d)
+		{
+			++m;
+		}
+		else if (2 * l <= n)
+		{
+			auto const tmp = c;
+			c.xor_shifted(b, m);
+			l = n + 1 - l;
+			b = tmp;
+			m = 1;
+		}
+		else
+		{
+			c.xor_shifted(b, m);
+			++m;
+		}
+	}
+
+	// 特性多項式は c の係数を逆順にしたもの
+	gf2_polynomial<Degree> result;
+	for (hamon::size_t i = 0; i <= l; ++i)
+	{
+		if (c.test(i))
+		{
+			result.flip(l - i);
+		}
+	}
+	return result;
+}
+
+}	// namespace detail
+
+}	// namespace hamon
+
+#endif // HAMON_RANDOM_ENGINES_DETAIL_GF2_POLYNOMIAL_HPP
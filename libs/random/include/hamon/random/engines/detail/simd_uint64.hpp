@@ -0,0 +1,45 @@
+﻿/**
+ *	@file	simd_uint64.hpp
+ *
+ *	@brief	multi_lane_xoshiro256plusplus の内部で使う SIMD 型の定義
+ */
+
+#ifndef HAMON_RANDOM_ENGINES_DETAIL_SIMD_UINT64_HPP
+#define HAMON_RANDOM_ENGINES_DETAIL_SIMD_UINT64_HPP
+
+#include <hamon/cmath/batch/detail/simd_uint64.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+namespace detail
+{
+
+// SIMD 型は batch 関数と共通のものを使う
+using hamon::batch::detail::simd_uint64;
+
+// シフト量がコンパイル時定数のシフトと回転
+template <int N>
+inline simd_uint64 shl(simd_uint64 a) HAMON_NOEXCEPT
+{
+	return hamon::batch::detail::shl(a, N);
+}
+
+template <int N>
+inline simd_uint64 shr(simd_uint64 a) HAMON_NOEXCEPT
+{
+	return hamon::batch::detail::shr(a, N);
+}
+
+template <int N>
+inline simd_uint64 rotl(simd_uint64 a) HAMON_NOEXCEPT
+{
+	return shl<N>(a) | shr<64 - N>(a);
+}
+
+}	// namespace detail
+
+}	// namespace hamon
+
+#endif // HAMON_RANDOM_ENGINES_DETAIL_SIMD_UINT64_HPP
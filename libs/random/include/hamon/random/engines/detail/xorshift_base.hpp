@@ -11,6 +11,7 @@
 #include <hamon/cstddef/size_t.hpp>
 #include <hamon/ios/flags_saver.hpp>
 #include <hamon/limits.hpp>
+#include <hamon/span.hpp>
 #include <hamon/config.hpp>
 #include <istream>
 #include <ostream>
@@ -70,6 +71,24 @@ public:
 		}
 	}
 
+	/**
+	 *	@brief	out の全ての要素を乱数で埋める
+	 *
+	 *	operator() を out.size() 回呼ぶのと同じ結果になる。
+	 */
+	void generate(hamon::span<result_type> out)
+	{
+		// out と m_state は同じ型なので、メンバを直接更新すると
+		// 書き込みの度に状態をメモリから読み直すことになる。
+		// ローカルのコピーで生成して、状態をレジスタに置いたままにする。
+		Derived e = *static_cast<Derived*>(this);
+		for (auto& x : out)
+		{
+			x = e();
+		}
+		*static_cast<Derived*>(this) = e;
+	}
+
 	bool operator==(xorshift_base const& rhs) const
 	{
 		for (hamon::size_t i = 0; i < N; ++i)
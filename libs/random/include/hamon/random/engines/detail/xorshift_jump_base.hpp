@@ -0,0 +1,158 @@
+﻿/**
+ *	@file	xorshift_jump_base.hpp
+ *
+ *	@brief	xorshift_jump_base の定義
+ */
+
+#ifndef HAMON_RANDOM_ENGINES_DETAIL_XORSHIFT_JUMP_BASE_HPP
+#define HAMON_RANDOM_ENGINES_DETAIL_XORSHIFT_JUMP_BASE_HPP
+
+#include <hamon/random/engines/detail/xorshift_base.hpp>
+#include <hamon/random/engines/detail/gf2_polynomial.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/limits.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+/**
+ *	@brief	状態遷移が GF(2) 上の線形写像である xorshift 系のエンジンの基底クラス
+ *
+ *	jump(), long_jump() と、O(log z) の discard(z) を提供する。
+ *
+ *	状態遷移行列の特性多項式 p(t) を求めておき、z 回進めた状態を
+ *	t^z mod p(t) の係数で状態の列を足し合わせて求める。
+ *	p(t) は最初に使う時に、エンジンが出力するビット列から Berlekamp-Massey 法で求める。
+ *
+ *	状態を配列の途中から使うエンジン(xoroshiro1024 など)は、
+ *	state_offset() で先頭の要素の位置を返すこと。
+ */
+template <typename UIntType, hamon::size_t N, typename Derived>
+class xorshift_jump_base : public xorshift_base<UIntType, N, Derived>
+{
+	using base_type = xorshift_base<UIntType, N, Derived>;
+public:
+	using typename base_type::result_type;
+
+	// 状態のビット数
+	static HAMON_CONSTEXPR hamon::size_t const state_bits =
+		N * static_cast<hamon::size_t>(hamon::numeric_limits<UIntType>::digits);
+
+	// 継承コンストラクタ
+	using base_type::base_type;
+
+	/**
+	 *	@brief	2^(state_bits / 2) 回 operator() を呼んだのと同じ状態にする
+	 *
+	 *	1つのシードから、重ならない 2^(state_bits / 2) 個の部分列を作るのに使う。
+	 */
+	void jump()
+	{
+		this->apply_polynomial(tables().jump);
+	}
+
+	/**
+	 *	@brief	2^(state_bits * 3 / 4) 回 operator() を呼んだのと同じ状態にする
+	 *
+	 *	long_jump で分けた部分列を、さらに jump で分けて使う。
+	 */
+	void long_jump()
+	{
+		this->apply_polynomial(tables().long_jump);
+	}
+
+	/**
+	 *	@brief	z 回 operator() を呼んだのと同じ状態にする
+	 *
+	 *	z が大きい場合は O(log z) で計算する。
+	 */
+	void discard(unsigned long long z)
+	{
+		// 多項式の計算より、直接進めた方が速い
+		if (z <= state_bits * 64)
+		{
+			base_type::discard(z);
+			return;
+		}
+
+		// apply_polynomial は state_bits 回 (N の倍数回) 進めるので、
+		// state_offset() の位置も z 回進めた場合と同じになるように、N で割った余りは直接進める
+		unsigned long long const r = z % N;
+		this->apply_polynomial(detail::gf2_pow_mod(z - r, tables().characteristic));
+		base_type::discard(r);
+	}
+
+protected:
+	hamon::size_t state_offset() const
+	{
+		return 0;
+	}
+
+private:
+	using polynomial_type = detail::gf2_polynomial<state_bits>;
+
+	struct jump_tables
+	{
+		polynomial_type characteristic;
+		polynomial_type jump;
+		polynomial_type long_jump;
+	};
+
+	static jump_tables const& tables()
+	{
+		static jump_tables const s_tables = make_tables();
+		return s_tables;
+	}
+
+	static jump_tables make_tables()
+	{
+		Derived e;
+		auto bit_generator = [&e]()
+		{
+			bool const b = (e.state_word(0) & 1) != 0;
+			(void)e();
+			return b;
+		};
+
+		jump_tables t;
+		t.characteristic = detail::gf2_berlekamp_massey<state_bits>(bit_generator);
+		t.jump = detail::gf2_pow2_mod(state_bits / 2, t.characteristic);
+		t.long_jump = detail::gf2_pow2_mod(state_bits / 4 * 3, t.characteristic);
+		return t;
+	}
+
+	result_type& state_word(hamon::size_t i)
+	{
+		auto const offset = static_cast<Derived const*>(this)->state_offset();
+		return this->m_state[(i + offset) % N];
+	}
+
+	// r(t) = Σ r_i t^i として、Σ r_i (i 回進めた状態) を新しい状態にする
+	void apply_polynomial(polynomial_type const& r)
+	{
+		auto derived = static_cast<Derived*>(this);
+
+		result_type acc[N] {};
+		for (hamon::size_t i = 0; i < state_bits; ++i)
+		{
+			if (r.test(i))
+			{
+				for (hamon::size_t j = 0; j < N; ++j)
+				{
+					acc[j] ^= state_word(j);
+				}
+			}
+			(void)derived->operator()();
+		}
+
+		for (hamon::size_t j = 0; j < N; ++j)
+		{
+			state_word(j) = acc[j];
+		}
+	}
+};
+
+}	// namespace hamon
+
+#endif // HAMON_RANDOM_ENGINES_DETAIL_XORSHIFT_JUMP_BASE_HPP
@@ -0,0 +1,49 @@
+﻿/**
+ *	@file	generate_independent_engines.hpp
+ *
+ *	@brief	generate_independent_engines の定義
+ */
+
+#ifndef HAMON_RANDOM_ENGINES_GENERATE_INDEPENDENT_ENGINES_HPP
+#define HAMON_RANDOM_ENGINES_GENERATE_INDEPENDENT_ENGINES_HPP
+
+#include <hamon/cstddef/size_t.hpp>
+
+namespace hamon
+{
+
+/**
+ *	@brief	1つのエンジンから、互いに重ならない部分列を生成する n 個のエンジンを作る
+ *
+ *	@param	first	結果を出力するイテレータ
+ *	@param	n		作るエンジンの数
+ *	@param	e		元になるエンジン (jump() を持つこと)
+ *
+ *	@return	最後に出力した要素の次を指すイテレータ
+ *
+ *	i 番目のエンジンは、e を i 回 jump() した状態になる。
+ *	各エンジンは、次のエンジンの最初の状態に追いつくまでに
+ *	2^(state_bits / 2) 個の値を生成できる。
+ *
+ *	スレッドごとに1つずつ渡すと、スレッドの実行順に関係なく
+ *	同じシードから同じ結果が得られる並列計算ができる。
+ */
+template <typename OutputIterator, typename Engine>
+inline OutputIterator
+generate_independent_engines(OutputIterator first, hamon::size_t n, Engine e)
+{
+	for (hamon::size_t i = 0; i < n; ++i)
+	{
+		if (i != 0)
+		{
+			e.jump();
+		}
+		*first = e;
+		++first;
+	}
+	return first;
+}
+
+}	// namespace hamon
+
+#endif // HAMON_RANDOM_ENGINES_GENERATE_INDEPENDENT_ENGINES_HPP
@@ -0,0 +1,432 @@
+﻿/**
+ *	@file	multi_lane_xoshiro.hpp
+ *
+ *	@brief	multi_lane_xoshiro256plusplus の定義
+ */
+
+#ifndef HAMON_RANDOM_ENGINES_MULTI_LANE_XOSHIRO_HPP
+#define HAMON_RANDOM_ENGINES_MULTI_LANE_XOSHIRO_HPP
+
+#include <hamon/random/engines/xoshiro.hpp>
+#include <hamon/random/engines/detail/simd_uint64.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/cstdint/uint64_t.hpp>
+#include <hamon/ios/flags_saver.hpp>
+#include <hamon/limits.hpp>
+#include <hamon/span.hpp>
+#include <hamon/utility/index_sequence.hpp>
+#include <hamon/utility/make_index_sequence.hpp>
+#include <hamon/config.hpp>
+#include <istream>
+#include <ostream>
+
+namespace hamon
+{
+
+/**
+ *	@brief	Lanes 個の xoshiro256++ を並べて、SIMD で同時に進めるエンジン
+ *
+ *	レーン i は、同じシードで初期化した xoshiro256++ を i 回 jump したもの。
+ *	出力はレーン順に交互に並び、k 番目のブロックのレーン i の値が (k * Lanes + i) 番目に出力される。
+ *	つまりレーン i の列は、出力を Lanes 個おきに取り出したものと一致する。
+ *
+ *	generate はまとめて生成する時に状態を SIMD レジスタに置いたままにするので、
+ *	operator() を繰り返し呼ぶよりずっと速い。
+ *
+ *	xoshiro256** ではなく xoshiro256++ を使うのは、AVX2 や SSE2 に 64bit の乗算命令が無く、
+ *	加算とシフトだけで出力を計算できるから。
+ */
+template <hamon::size_t Lanes>
+class multi_lane_xoshiro256plusplus
+{
+private:
+	using simd_type = hamon::detail::simd_uint64;
+
+	static_assert(Lanes > 0 && Lanes % simd_type::lanes == 0, "");
+
+	static HAMON_CONSTEXPR hamon::size_t regs = Lanes / simd_type::lanes;
+
+public:
+	using result_type = hamon::uint64_t;
+
+	static HAMON_CONSTEXPR hamon::size_t const lanes = Lanes;
+	static HAMON_CONSTEXPR result_type const default_seed = xoshiro256plusplus::default_seed;
+
+	static HAMON_CONSTEXPR result_type min() { return hamon::numeric_limits<result_type>::min(); }
+	static HAMON_CONSTEXPR result_type max() { return hamon::numeric_limits<result_type>::max(); }
+
+	explicit multi_lane_xoshiro256plusplus(result_type sd = default_seed)
+	{
+		seed(sd);
+	}
+
+	template <typename Sseq>
+	explicit multi_lane_xoshiro256plusplus(Sseq& q)
+	{
+		seed(q);
+	}
+
+	void seed(result_type sd = default_seed)
+	{
+		set_lanes(xoshiro256plusplus(sd));
+	}
+
+	template <typename Sseq>
+	void seed(Sseq& q)
+	{
+		set_lanes(xoshiro256plusplus(q));
+	}
+
+	result_type operator()()
+	{
+		if (m_index == Lanes)
+		{
+			refill();
+		}
+		return m_buffer[m_index++];
+	}
+
+	/**
+	 *	@brief	out の全ての要素を乱数で埋める
+	 *
+	 *	operator() を out.size() 回呼ぶのと同じ結果になる。
+	 */
+	void generate(hamon::span<result_type> out)
+	{
+		result_type* p = out.data();
+		hamon::size_t n = out.size();
+
+		// バッファに残っている値
+		for (; n != 0 && m_index != Lanes; --n)
+		{
+			*p++ = m_buffer[m_index++];
+		}
+
+		// Lanes 個ずつ直接書き込む
+		if (n >= Lanes)
+		{
+			simd_type s[4][regs];
+			load_state(s);
+			for (; n >= Lanes; n -= Lanes)
+			{
+				step(s, p);
+				p += Lanes;
+			}
+			store_state(s);
+		}
+
+		// 残り
+		for (; n != 0; --n)
+		{
+			*p++ = (*this)();
+		}
+	}
+
+	void discard(unsigned long long z)
+	{
+		for (; z != 0 && m_index != Lanes; --z)
+		{
+			++m_index;
+		}
+
+		// 各レーンを z / Lanes 回進める
+		unsigned long long const blocks = z / Lanes;
+		if (blocks != 0)
+		{
+			for (hamon::size_t i = 0; i < Lanes; ++i)
+			{
+				xoshiro256plusplus e = get_lane(i);
+				e.discard(blocks);
+				set_lane(i, e);
+			}
+		}
+
+		for (z %= Lanes; z != 0; --z)
+		{
+			(void)(*this)();
+		}
+	}
+
+	/**
+	 *	@brief	各レーンを Lanes 回 jump する
+	 *
+	 *	jump した後のエンジンのレーンは、元のエンジンのどのレーンとも 2^128 以上離れる。
+	 *	バッファに残っている値は捨てる。
+	 */
+	void jump()
+	{
+		for (hamon::size_t i = 0; i < Lanes; ++i)
+		{
+			xoshiro256plusplus e = get_lane(i);
+			for (hamon::size_t j = 0; j < Lanes; ++j)
+			{
+				e.jump();
+			}
+			set_lane(i, e);
+		}
+		m_index = Lanes;
+	}
+
+	/**
+	 *	@brief	各レーンを long_jump する
+	 *
+	 *	バッファに残っている値は捨てる。
+	 */
+	void long_jump()
+	{
+		for (hamon::size_t i = 0; i < Lanes; ++i)
+		{
+			xoshiro256plusplus e = get_lane(i);
+			e.long_jump();
+			set_lane(i, e);
+		}
+		m_index = Lanes;
+	}
+
+	bool operator==(multi_lane_xoshiro256plusplus const& rhs) const
+	{
+		for (hamon::size_t j = 0; j < 4; ++j)
+		{
+			for (hamon::size_t i = 0; i < Lanes; ++i)
+			{
+				if (m_state[j][i] != rhs.m_state[j][i])
+				{
+					return false;
+				}
+			}
+		}
+
+		if (m_index != rhs.m_index)
+		{
+			return false;
+		}
+
+		for (hamon::size_t i = m_index; i < Lanes; ++i)
+		{
+			if (m_buffer[i] != rhs.m_buffer[i])
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	bool operator!=(multi_lane_xoshiro256plusplus const& rhs) const
+	{
+		return !(*this == rhs);
+	}
+
+private:
+	// 状態を SoA で持つ。m_state[j][i] はレーン i の j 番目の状態。
+	result_type		m_state[4][Lanes];
+	result_type		m_buffer[Lanes] {};
+	hamon::size_t	m_index = Lanes;
+
+	void set_lanes(xoshiro256plusplus e)
+	{
+		for (hamon::size_t i = 0; i < Lanes; ++i)
+		{
+			set_lane(i, e);
+			e.jump();
+		}
+		m_index = Lanes;
+	}
+
+	xoshiro256plusplus get_lane(hamon::size_t i) const
+	{
+		xoshiro256plusplus e;
+		for (hamon::size_t j = 0; j < 4; ++j)
+		{
+			e.m_state[j] = m_state[j][i];
+		}
+		return e;
+	}
+
+	void set_lane(hamon::size_t i, xoshiro256plusplus const& e)
+	{
+		for (hamon::size_t j = 0; j < 4; ++j)
+		{
+			m_state[j][i] = e.m_state[j];
+		}
+	}
+
+	void load_state(simd_type (&s)[4][regs]) const
+	{
+		for (hamon::size_t j = 0; j < 4; ++j)
+		{
+			for (hamon::size_t r = 0; r < regs; ++r)
+			{
+				s[j][r] = simd_type::load(&m_state[j][r * simd_type::lanes]);
+			}
+		}
+	}
+
+	void store_state(simd_type const (&s)[4][regs])
+	{
+		for (hamon::size_t j = 0; j < 4; ++j)
+		{
+			for (hamon::size_t r = 0; r < regs; ++r)
+			{
+				s[j][r].store(&m_state[j][r * simd_type::lanes]);
+			}
+		}
+	}
+
+	// 1つのレジスタに入っているレーンを1つ進めて、出力を out に書き込む
+	static void step_one(
+		simd_type& s0, simd_type& s1, simd_type& s2, simd_type& s3, result_type* out)
+	{
+		using hamon::detail::shl;
+		using hamon::detail::rotl;
+
+		simd_type const result = rotl<23>(s0 + s3) + s0;
+		simd_type const t = shl<17>(s1);
+		s2 = s2 ^ s0;
+		s3 = s3 ^ s1;
+		s1 = s1 ^ s2;
+		s0 = s0 ^ s3;
+		s2 = s2 ^ t;
+		s3 = rotl<45>(s3);
+		result.store(out);
+	}
+
+	// 全てのレーンを1つ進めて、出力を out[0] ～ out[Lanes - 1] に書き込む
+	//
+	// ループで書くとコンパイラによっては展開されずに状態がメモリに置かれるので、
+	// index_sequence で展開する。
+	template <hamon::size_t... Is>
+	static void step(simd_type (&s)[4][regs], result_type* out, hamon::index_sequence<Is...>)
+	{
+		int dummy[] = { (step_one(s[0][Is], s[1][Is], s[2][Is], s[3][Is], out + Is * simd_type::lanes), 0)... };
+		(void)dummy;
+	}
+
+	static void step(simd_type (&s)[4][regs], result_type* out)
+	{
+		step(s, out, hamon::make_index_sequence<regs>{});
+	}
+
+	void refill()
+	{
+		simd_type s[4][regs];
+		load_state(s);
+		step(s, m_buffer);
+		store_state(s);
+		m_index = 0;
+	}
+
+	template <typename CharT, typename Traits>
+	friend std::basic_ostream<CharT, Traits>&
+	operator<<(
+		std::basic_ostream<CharT, Traits>& os,
+		multi_lane_xoshiro256plusplus const& e)
+	{
+		hamon::ios::flags_saver lx(os);
+		os.flags(
+			std::ios_base::dec |
+			std::ios_base::left |
+			std::ios_base::fixed |
+			std::ios_base::scientific);
+		CharT sp = os.widen(' ');
+
+		for (hamon::size_t j = 0; j < 4; ++j)
+		{
+			for (hamon::size_t i = 0; i < Lanes; ++i)
+			{
+				os << sp << e.m_state[j][i];
+			}
+		}
+
+		os << sp << e.m_index;
+		for (hamon::size_t i = e.m_index; i < Lanes; ++i)
+		{
+			os << sp << e.m_buffer[i];
+		}
+
+		return os;
+	}
+
+	template <typename CharT, typename Traits>
+	friend std::basic_istream<CharT, Traits>&
+	operator>>(
+		std::basic_istream<CharT, Traits>& is,
+		multi_lane_xoshiro256plusplus& e)
+	{
+		hamon::ios::flags_saver lx(is);
+		is.flags(
+			std::ios_base::dec |
+			std::ios_base::skipws |
+			std::ios_base::fixed |
+			std::ios_base::scientific);
+
+		result_type state[4][Lanes];
+		for (hamon::size_t j = 0; j < 4; ++j)
+		{
+			for (hamon::size_t i = 0; i < Lanes; ++i)
+			{
+				is >> state[j][i];
+			}
+		}
+
+		hamon::size_t index = 0;
+		is >> index;
+		if (index > Lanes)
+		{
+			is.setstate(std::ios_base::failbit);
+			return is;
+		}
+
+		result_type buffer[Lanes] {};
+		for (hamon::size_t i = index; i < Lanes; ++i)
+		{
+			is >> buffer[i];
+		}
+
+		if (!is.fail())
+		{
+			for (hamon::size_t j = 0; j < 4; ++j)
+			{
+				for (hamon::size_t i = 0; i < Lanes; ++i)
+				{
+					e.m_state[j][i] = state[j][i];
+				}
+			}
+			for (hamon::size_t i = 0; i < Lanes; ++i)
+			{
+				e.m_buffer[i] = buffer[i];
+			}
+			e.m_index = index;
+		}
+
+		return is;
+	}
+};
+
+#if !defined(HAMON_HAS_CXX17_INLINE_VARIABLES)
+template <hamon::size_t Lanes>
+HAMON_CONSTEXPR hamon::size_t
+multi_lane_xoshiro256plusplus<Lanes>::regs;
+
+template <hamon::size_t Lanes>
+HAMON_CONSTEXPR hamon::size_t const
+multi_lane_xoshiro256plusplus<Lanes>::lanes;
+
+template <hamon::size_t Lanes>
+HAMON_CONSTEXPR typename multi_lane_xoshiro256plusplus<Lanes>::result_type const
+multi_lane_xoshiro256plusplus<Lanes>::default_seed;
+#endif
+
+/**
+ *	@brief	xoshiro256++ を 4 レーン並べたもの
+ */
+using xoshiro256plusplus_x4 = multi_lane_xoshiro256plusplus<4>;
+
+/**
+ *	@brief	xoshiro256++ を 8 レーン並べたもの
+ */
+using xoshiro256plusplus_x8 = multi_lane_xoshiro256plusplus<8>;
+
+}	// namespace hamon
+
+#endif // HAMON_RANDOM_ENGINES_MULTI_LANE_XOSHIRO_HPP
@@ -7,8 +7,9 @@
 #ifndef HAMON_RANDOM_ENGINES_XOROSHIRO_HPP
 #define HAMON_RANDOM_ENGINES_XOROSHIRO_HPP
 
-#include <hamon/random/engines/detail/xorshift_base.hpp>
+#include <hamon/random/engines/detail/xorshift_jump_base.hpp>
 #include <hamon/bit/rotl.hpp>
+#include <hamon/cstddef/size_t.hpp>
 #include <hamon/cstdint/uint32_t.hpp>
 #include <hamon/cstdint/uint64_t.hpp>
 
@@ -18,9 +19,9 @@ namespace hamon
 /**
  *	@brief	xoroshiro128** (XOR/rotate/shift/rotate)
  */
-class xoroshiro128starstar : public xorshift_base<hamon::uint64_t, 2, xoroshiro128starstar>
+class xoroshiro128starstar : public xorshift_jump_base<hamon::uint64_t, 2, xoroshiro128starstar>
 {
-	using base_type = xorshift_base<hamon::uint64_t, 2, xoroshiro128starstar>;
+	using base_type = xorshift_jump_base<hamon::uint64_t, 2, xoroshiro128starstar>;
 public:
 	// 継承コンストラクタ
 	using base_type::base_type;
@@ -47,9 +48,9 @@ public:
 /**
  *	@brief	xoroshiro128*
  */
-class xoroshiro128star : public xorshift_base<hamon::uint64_t, 2, xoroshiro128star>
+class xoroshiro128star : public xorshift_jump_base<hamon::uint64_t, 2, xoroshiro128star>
 {
-	using base_type = xorshift_base<hamon::uint64_t, 2, xoroshiro128star>;
+	using base_type = xorshift_jump_base<hamon::uint64_t, 2, xoroshiro128star>;
 public:
 	// 継承コンストラクタ
 	using base_type::base_type;
@@ -71,12 +72,39 @@ public:
 	}
 };
 
+/**
+ *	@brief	xoroshiro128++
+ */
+class xoroshiro128plusplus : public xorshift_jump_base<hamon::uint64_t, 2, xoroshiro128plusplus>
+{
+	using base_type = xorshift_jump_base<hamon::uint64_t, 2, xoroshiro128plusplus>;
+public:
+	// 継承コンストラクタ
+	using base_type::base_type;
+
+	result_type operator()()
+	{
+		result_type const A = 49;
+		result_type const B = 21;
+		result_type const C = 28;
+		result_type const R = 17;
+
+		auto const s0 = m_state[0];
+		auto       s1 = m_state[1];
+		auto const result = hamon::rotl(s0 + s1, R) + s0;
+		s1 ^= s0;
+		m_state[0] = hamon::rotl(s0, A) ^ s1 ^ (s1 << B);
+		m_state[1] = hamon::rotl(s1, C);
+		return result;
+	}
+};
+
 /**
  *	@brief	xoroshiro128+
  */
-class xoroshiro128plus : public xorshift_base<hamon::uint64_t, 2, xoroshiro128plus>
+class xoroshiro128plus : public xorshift_jump_base<hamon::uint64_t, 2, xoroshiro128plus>
 {
-	using base_type = xorshift_base<hamon::uint64_t, 2, xoroshiro128plus>;
+	using base_type = xorshift_jump_base<hamon::uint64_t, 2, xoroshiro128plus>;
 public:
 	// 継承コンストラクタ
 	using base_type::base_type;
@@ -100,9 +128,9 @@ public:
 /**
  *	@brief	xoroshiro64**
  */
-class xoroshiro64starstar : public xorshift_base<hamon::uint32_t, 2, xoroshiro64starstar>
+class xoroshiro64starstar : public xorshift_jump_base<hamon::uint32_t, 2, xoroshiro64starstar>
 {
-	using base_type = xorshift_base<hamon::uint32_t, 2, xoroshiro64starstar>;
+	using base_type = xorshift_jump_base<hamon::uint32_t, 2, xoroshiro64starstar>;
 public:
 	// 継承コンストラクタ
 	using base_type::base_type;
@@ -129,9 +157,9 @@ public:
 /**
  *	@brief	xoroshiro64*
  */
-class xoroshiro64star : public xorshift_base<hamon::uint32_t, 2, xoroshiro64star>
+class xoroshiro64star : public xorshift_jump_base<hamon::uint32_t, 2, xoroshiro64star>
 {
-	using base_type = xorshift_base<hamon::uint32_t, 2, xoroshiro64star>;
+	using base_type = xorshift_jump_base<hamon::uint32_t, 2, xoroshiro64star>;
 public:
 	// 継承コンストラクタ
 	using base_type::base_type;
@@ -153,12 +181,52 @@ public:
 	}
 };
 
+/**
+ *	@brief	xoroshiro1024++
+ */
+class xoroshiro1024plusplus : public xorshift_jump_base<hamon::uint64_t, 16, xoroshiro1024plusplus>
+{
+	using base_type = xorshift_jump_base<hamon::uint64_t, 16, xoroshiro1024plusplus>;
+public:
+	// 継承コンストラクタ
+	using base_type::base_type;
+
+	result_type operator()()
+	{
+		result_type const A = 25;
+		result_type const B = 27;
+		result_type const C = 36;
+		result_type const R = 23;
+
+		auto const p = ((m_p + 1) & 15);
+		auto const q = m_p;
+		auto const s0 = m_state[p];
+		auto       s1 = m_state[q];
+		auto const result = hamon::rotl(s0 + s1, R) + s1;
+		s1 ^= s0;
+		m_state[q] = hamon::rotl(s0, A) ^ s1 ^ (s1 << B);
+		m_state[p] = hamon::rotl(s1, C);
+		m_p = p;
+		return result;
+	}
+
+private:
+	friend base_type;
+
+	hamon::size_t state_offset() const
+	{
+		return static_cast<hamon::size_t>(m_p);
+	}
+
+	int		m_p = 0;
+};
+
 /**
  *	@brief	xoroshiro1024+
  */
-class xoroshiro1024plus : public xorshift_base<hamon::uint64_t, 16, xoroshiro1024plus>
+class xoroshiro1024plus : public xorshift_jump_base<hamon::uint64_t, 16, xoroshiro1024plus>
 {
-	using base_type = xorshift_base<hamon::uint64_t, 16, xoroshiro1024plus>;
+	using base_type = xorshift_jump_base<hamon::uint64_t, 16, xoroshiro1024plus>;
 public:
 	// 継承コンストラクタ
 	using base_type::base_type;
@@ -182,15 +250,22 @@ public:
 	}
 
 private:
+	friend base_type;
+
+	hamon::size_t state_offset() const
+	{
+		return static_cast<hamon::size_t>(m_p);
+	}
+
 	int		m_p = 0;
 };
 
 /**
  *	@brief	xoroshiro1024*
  */
-class xoroshiro1024star : public xorshift_base<hamon::uint64_t, 16, xoroshiro1024star>
+class xoroshiro1024star : public xorshift_jump_base<hamon::uint64_t, 16, xoroshiro1024star>
 {
-	using base_type = xorshift_base<hamon::uint64_t, 16, xoroshiro1024star>;
+	using base_type = xorshift_jump_base<hamon::uint64_t, 16, xoroshiro1024star>;
 public:
 	// 継承コンストラクタ
 	using base_type::base_type;
@@ -215,15 +290,22 @@ public:
 	}
 
 private:
+	friend base_type;
+
+	hamon::size_t state_offset() const
+	{
+		return static_cast<hamon::size_t>(m_p);
+	}
+
 	int		m_p = 0;
 };
 
 /**
  *	@brief	xoroshiro1024**
  */
-class xoroshiro1024starstar : public xorshift_base<hamon::uint64_t, 16, xoroshiro1024starstar>
+class xoroshiro1024starstar : public xorshift_jump_base<hamon::uint64_t, 16, xoroshiro1024starstar>
 {
-	using base_type = xorshift_base<hamon::uint64_t, 16, xoroshiro1024starstar>;
+	using base_type = xorshift_jump_base<hamon::uint64_t, 16, xoroshiro1024starstar>;
 public:
 	// 継承コンストラクタ
 	using base_type::base_type;
@@ -250,6 +332,13 @@ public:
 	}
 
 private:
+	friend base_type;
+
+	hamon::size_t state_offset() const
+	{
+		return static_cast<hamon::size_t>(m_p);
+	}
+
 	int		m_p = 0;
 };
 
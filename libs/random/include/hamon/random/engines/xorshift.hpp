@@ -8,6 +8,8 @@
 #define HAMON_RANDOM_ENGINES_XORSHIFT_HPP
 
 #include <hamon/random/engines/detail/xorshift_base.hpp>
+#include <hamon/random/engines/detail/xorshift_jump_base.hpp>
+#include <hamon/cstddef/size_t.hpp>
 #include <hamon/cstdint/uint32_t.hpp>
 #include <hamon/cstdint/uint64_t.hpp>
 
@@ -17,9 +19,9 @@ namespace hamon
 /**
  *	@brief	xorshift32
  */
-class xorshift32 : public xorshift_base<hamon::uint32_t, 1, xorshift32>
+class xorshift32 : public xorshift_jump_base<hamon::uint32_t, 1, xorshift32>
 {
-	using base_type = xorshift_base<hamon::uint32_t, 1, xorshift32>;
+	using base_type = xorshift_jump_base<hamon::uint32_t, 1, xorshift32>;
 public:
 	// 継承コンストラクタ
 	using base_type::base_type;
@@ -42,9 +44,9 @@ public:
 /**
  *	@brief	xorshift64
  */
-class xorshift64 : public xorshift_base<hamon::uint64_t, 1, xorshift64>
+class xorshift64 : public xorshift_jump_base<hamon::uint64_t, 1, xorshift64>
 {
-	using base_type = xorshift_base<hamon::uint64_t, 1, xorshift64>;
+	using base_type = xorshift_jump_base<hamon::uint64_t, 1, xorshift64>;
 public:
 	// 継承コンストラクタ
 	using base_type::base_type;
@@ -67,9 +69,9 @@ public:
 /**
  *	@brief	xorshift128
  */
-class xorshift128 : public xorshift_base<hamon::uint32_t, 4, xorshift128>
+class xorshift128 : public xorshift_jump_base<hamon::uint32_t, 4, xorshift128>
 {
-	using base_type = xorshift_base<hamon::uint32_t, 4, xorshift128>;
+	using base_type = xorshift_jump_base<hamon::uint32_t, 4, xorshift128>;
 public:
 	// 継承コンストラクタ
 	using base_type::base_type;
@@ -128,9 +130,9 @@ public:
 /**
  *	@brief	xorshift64star
  */
-class xorshift64star : public xorshift_base<hamon::uint64_t, 1, xorshift64star>
+class xorshift64star : public xorshift_jump_base<hamon::uint64_t, 1, xorshift64star>
 {
-	using base_type = xorshift_base<hamon::uint64_t, 1, xorshift64star>;
+	using base_type = xorshift_jump_base<hamon::uint64_t, 1, xorshift64star>;
 public:
 	// 継承コンストラクタ
 	using base_type::base_type;
@@ -154,9 +156,9 @@ public:
 /**
  *	@brief	xorshift1024star
  */
-class xorshift1024star : public xorshift_base<hamon::uint64_t, 16, xorshift1024star>
+class xorshift1024star : public xorshift_jump_base<hamon::uint64_t, 16, xorshift1024star>
 {
-	using base_type = xorshift_base<hamon::uint64_t, 16, xorshift1024star>;
+	using base_type = xorshift_jump_base<hamon::uint64_t, 16, xorshift1024star>;
 public:
 	// 継承コンストラクタ
 	using base_type::base_type;
@@ -179,15 +181,22 @@ public:
 	}
 
 private:
+	friend base_type;
+
+	hamon::size_t state_offset() const
+	{
+		return static_cast<hamon::size_t>(m_p);
+	}
+
 	int	m_p = 0;
 };
 
 /**
  *	@brief	xorshift128plus
  */
-class xorshift128plus : public xorshift_base<hamon::uint64_t, 2, xorshift128plus>
+class xorshift128plus : public xorshift_jump_base<hamon::uint64_t, 2, xorshift128plus>
 {
-	using base_type = xorshift_base<hamon::uint64_t, 2, xorshift128plus>;
+	using base_type = xorshift_jump_base<hamon::uint64_t, 2, xorshift128plus>;
 public:
 	// 継承コンストラクタ
 	using base_type::base_type;
@@ -7,20 +7,24 @@
 #ifndef HAMON_RANDOM_ENGINES_XOSHIRO_HPP
 #define HAMON_RANDOM_ENGINES_XOSHIRO_HPP
 
-#include <hamon/random/engines/detail/xorshift_base.hpp>
+#include <hamon/random/engines/detail/xorshift_jump_base.hpp>
 #include <hamon/bit/rotl.hpp>
+#include <hamon/cstddef/size_t.hpp>
 #include <hamon/cstdint/uint32_t.hpp>
 #include <hamon/cstdint/uint64_t.hpp>
 
 namespace hamon
 {
 
+template <hamon::size_t Lanes>
+class multi_lane_xoshiro256plusplus;
+
 /**
  *	@brief	xoshiro256** (XOR/shift/rotate)
  */
-class xoshiro256starstar : public xorshift_base<hamon::uint64_t, 4, xoshiro256starstar>
+class xoshiro256starstar : public xorshift_jump_base<hamon::uint64_t, 4, xoshiro256starstar>
 {
-	using base_type = xorshift_base<hamon::uint64_t, 4, xoshiro256starstar>;
+	using base_type = xorshift_jump_base<hamon::uint64_t, 4, xoshiro256starstar>;
 public:
 	// 継承コンストラクタ
 	using base_type::base_type;
@@ -45,12 +49,44 @@ public:
 	}
 };
 
+/**
+ *	@brief	xoshiro256++
+ */
+class xoshiro256plusplus : public xorshift_jump_base<hamon::uint64_t, 4, xoshiro256plusplus>
+{
+	using base_type = xorshift_jump_base<hamon::uint64_t, 4, xoshiro256plusplus>;
+public:
+	// 継承コンストラクタ
+	using base_type::base_type;
+
+	result_type operator()()
+	{
+		result_type const A = 17;
+		result_type const B = 45;
+		result_type const R = 23;
+
+		result_type const result = hamon::rotl(m_state[0] + m_state[3], R) + m_state[0];
+		result_type const t = m_state[1] << A;
+		m_state[2] ^= m_state[0];
+		m_state[3] ^= m_state[1];
+		m_state[1] ^= m_state[2];
+		m_state[0] ^= m_state[3];
+		m_state[2] ^= t;
+		m_state[3] = hamon::rotl(m_state[3], B);
+		return result;
+	}
+
+private:
+	template <hamon::size_t>
+	friend class multi_lane_xoshiro256plusplus;
+};
+
 /**
  *	@brief	xoshiro256+
  */
-class xoshiro256plus : public xorshift_base<hamon::uint64_t, 4, xoshiro256plus>
+class xoshiro256plus : public xorshift_jump_base<hamon::uint64_t, 4, xoshiro256plus>
 {
-	using base_type = xorshift_base<hamon::uint64_t, 4, xoshiro256plus>;
+	using base_type = xorshift_jump_base<hamon::uint64_t, 4, xoshiro256plus>;
 public:
 	// 継承コンストラクタ
 	using base_type::base_type;
@@ -75,9 +111,9 @@ public:
 /**
  *	@brief	xoshiro128**
  */
-class xoshiro128starstar : public xorshift_base<hamon::uint32_t, 4, xoshiro128starstar>
+class xoshiro128starstar : public xorshift_jump_base<hamon::uint32_t, 4, xoshiro128starstar>
 {
-	using base_type = xorshift_base<hamon::uint32_t, 4, xoshiro128starstar>;
+	using base_type = xorshift_jump_base<hamon::uint32_t, 4, xoshiro128starstar>;
 public:
 	// 継承コンストラクタ
 	using base_type::base_type;
@@ -102,12 +138,40 @@ public:
 	}
 };
 
+/**
+ *	@brief	xoshiro128++
+ */
+class xoshiro128plusplus : public xorshift_jump_base<hamon::uint32_t, 4, xoshiro128plusplus>
+{
+	using base_type = xorshift_jump_base<hamon::uint32_t, 4, xoshiro128plusplus>;
+public:
+	// 継承コンストラクタ
+	using base_type::base_type;
+
+	result_type operator()()
+	{
+		result_type const A = 9;
+		result_type const B = 11;
+		result_type const R = 7;
+
+		result_type const result = hamon::rotl(m_state[0] + m_state[3], R) + m_state[0];
+		result_type const t = m_state[1] << A;
+		m_state[2] ^= m_state[0];
+		m_state[3] ^= m_state[1];
+		m_state[1] ^= m_state[2];
+		m_state[0] ^= m_state[3];
+		m_state[2] ^= t;
+		m_state[3] = hamon::rotl(m_state[3], B);
+		return result;
+	}
+};
+
 /**
  *	@brief	xoshiro128+
  */
-class xoshiro128plus : public xorshift_base<hamon::uint32_t, 4, xoshiro128plus>
+class xoshiro128plus : public xorshift_jump_base<hamon::uint32_t, 4, xoshiro128plus>
 {
-	using base_type = xorshift_base<hamon::uint32_t, 4, xoshiro128plus>;
+	using base_type = xorshift_jump_base<hamon::uint32_t, 4, xoshiro128plus>;
 public:
 	// 継承コンストラクタ
 	using base_type::base_type;
@@ -132,9 +196,9 @@ public:
 /**
  *	@brief	xoshiro512**
  */
-class xoshiro512starstar : public xorshift_base<hamon::uint64_t, 8, xoshiro512starstar>
+class xoshiro512starstar : public xorshift_jump_base<hamon::uint64_t, 8, xoshiro512starstar>
 {
-	using base_type = xorshift_base<hamon::uint64_t, 8, xoshiro512starstar>;
+	using base_type = xorshift_jump_base<hamon::uint64_t, 8, xoshiro512starstar>;
 public:
 	// 継承コンストラクタ
 	using base_type::base_type;
@@ -163,12 +227,44 @@ public:
 	}
 };
 
+/**
+ *	@brief	xoshiro512++
+ */
+class xoshiro512plusplus : public xorshift_jump_base<hamon::uint64_t, 8, xoshiro512plusplus>
+{
+	using base_type = xorshift_jump_base<hamon::uint64_t, 8, xoshiro512plusplus>;
+public:
+	// 継承コンストラクタ
+	using base_type::base_type;
+
+	result_type operator()()
+	{
+		result_type const A = 11;
+		result_type const B = 21;
+		result_type const R = 17;
+
+		result_type const result = hamon::rotl(m_state[0] + m_state[2], R) + m_state[2];
+		result_type const t = m_state[1] << A;
+		m_state[2] ^= m_state[0];
+		m_state[5] ^= m_state[1];
+		m_state[1] ^= m_state[2];
+		m_state[7] ^= m_state[3];
+		m_state[3] ^= m_state[4];
+		m_state[4] ^= m_state[5];
+		m_state[0] ^= m_state[6];
+		m_state[6] ^= m_state[7];
+		m_state[6] ^= t;
+		m_state[7] = hamon::rotl(m_state[7], B);
+		return result;
+	}
+};
+
 /**
  *	@brief	xoshiro512+
  */
-class xoshiro512plus : public xorshift_base<hamon::uint64_t, 8, xoshiro512plus>
+class xoshiro512plus : public xorshift_jump_base<hamon::uint64_t, 8, xoshiro512plus>
 {
-	using base_type = xorshift_base<hamon::uint64_t, 8, xoshiro512plus>;
+	using base_type = xorshift_jump_base<hamon::uint64_t, 8, xoshiro512plus>;
 public:
 	// 継承コンストラクタ
 	using base_type::base_type;
@@ -0,0 +1,84 @@
+﻿/**
+ *	@file	generate_canonical.hpp
+ *
+ *	@brief	generate_canonical の定義
+ */
+
+#ifndef HAMON_RANDOM_GENERATE_CANONICAL_HPP
+#define HAMON_RANDOM_GENERATE_CANONICAL_HPP
+
+#include <hamon/random/detail/uniform_bits.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/cstdint/uint32_t.hpp>
+#include <hamon/cstdint/uint64_t.hpp>
+#include <hamon/limits.hpp>
+#include <hamon/type_traits/conditional.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+namespace detail
+{
+
+// [0, 1) の一様な浮動小数点数を、Bits ビットの整数から作る
+//
+// 使うビット数は Bits と RealType の仮数部の桁数と 64 のうち最も小さい値。
+// 整数を 2^bits で割るだけなので、結果は丸めを含まず、処理系に依存しない。
+template <typename RealType, hamon::size_t Bits>
+struct canonical_traits
+{
+	static HAMON_CONSTEXPR hamon::size_t digits =
+		static_cast<hamon::size_t>(hamon::numeric_limits<RealType>::digits);
+
+	static HAMON_CONSTEXPR hamon::size_t bits =
+		Bits == 0 ? 1 :
+		Bits < digits ? (Bits < 64 ? Bits : 64) :
+		(digits < 64 ? digits : 64);
+
+	using word_type = hamon::conditional_t<(bits <= 32), hamon::uint32_t, hamon::uint64_t>;
+
+	static HAMON_CONSTEXPR hamon::size_t word_digits =
+		static_cast<hamon::size_t>(hamon::numeric_limits<word_type>::digits);
+
+	static HAMON_CXX11_CONSTEXPR RealType
+	from_bits(word_type w) HAMON_NOEXCEPT
+	{
+		// 2^-bits を掛ける。bits == 64 の場合も桁あふれしないように 2^(bits-1) で割ってから半分にする。
+		return static_cast<RealType>(w >> (word_digits - bits)) *
+			(RealType(0.5) / static_cast<RealType>(word_type(1) << (bits - 1)));
+	}
+};
+
+// (0, 1) の一様な double を作る。使う 53bit の最下位を 1 にして 0 を除く。
+inline HAMON_CXX11_CONSTEXPR double
+canonical_open_double(hamon::uint64_t w) HAMON_NOEXCEPT
+{
+	return canonical_traits<double, 53>::from_bits(w | 0x800);
+}
+
+}	// namespace detail
+
+/**
+ *	@brief	[0, 1) の一様な浮動小数点数を作る
+ *
+ *	@tparam	RealType	浮動小数点数型
+ *	@tparam	Bits		使うビット数
+ *
+ *	std::generate_canonical と違い、エンジンから 32bit か 64bit の一様な整数を1つ作って、
+ *	その上位 Bits ビットを 2^Bits で割る。Bits は RealType の仮数部の桁数と 64 で制限される。
+ *	結果は常に 1 より小さく、同じエンジンの出力からは処理系によらず同じ値が得られる。
+ *	(long double は処理系によって仮数部の桁数が違うので、使うビット数も変わる)
+ */
+template <typename RealType, hamon::size_t Bits, typename URBG>
+HAMON_CXX14_CONSTEXPR RealType
+generate_canonical(URBG& g)
+{
+	using traits = hamon::detail::canonical_traits<RealType, Bits>;
+	return traits::from_bits(
+		hamon::detail::generate_uniform_bits<typename traits::word_type>(g));
+}
+
+}	// namespace hamon
+
+#endif // HAMON_RANDOM_GENERATE_CANONICAL_HPP
@@ -0,0 +1,194 @@
+﻿/**
+ *	@file	generate_random.hpp
+ *
+ *	@brief	ranges::generate_random の定義
+ */
+
+#ifndef HAMON_RANDOM_GENERATE_RANDOM_HPP
+#define HAMON_RANDOM_GENERATE_RANDOM_HPP
+
+#include <hamon/random/concepts/uniform_random_bit_generator.hpp>
+#include <hamon/concepts/detail/constrained_param.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/detail/overload_priority.hpp>
+#include <hamon/iterator/concepts/contiguous_iterator.hpp>
+#include <hamon/iterator/concepts/output_iterator.hpp>
+#include <hamon/iterator/concepts/sentinel_for.hpp>
+#include <hamon/iterator/concepts/sized_sentinel_for.hpp>
+#include <hamon/iterator/iter_difference_t.hpp>
+#include <hamon/iterator/iter_value_t.hpp>
+#include <hamon/memory/to_address.hpp>
+#include <hamon/ranges/concepts/output_range.hpp>
+#include <hamon/ranges/borrowed_iterator_t.hpp>
+#include <hamon/ranges/begin.hpp>
+#include <hamon/ranges/end.hpp>
+#include <hamon/span.hpp>
+#include <hamon/type_traits/bool_constant.hpp>
+#include <hamon/type_traits/conjunction.hpp>
+#include <hamon/type_traits/enable_if.hpp>
+#include <hamon/type_traits/invoke_result.hpp>
+#include <hamon/type_traits/is_same.hpp>
+#include <hamon/type_traits/remove_cvref.hpp>
+#include <hamon/type_traits/void_t.hpp>
+#include <hamon/utility/declval.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+namespace ranges
+{
+
+namespace detail
+{
+
+// g.generate(span<T>) を呼び出せるかどうか
+template <typename G, typename T, typename = void>
+struct has_generate_member
+	: public hamon::false_type {};
+
+template <typename G, typename T>
+struct has_generate_member<G, T, hamon::void_t<
+	decltype(hamon::declval<G&>().generate(hamon::declval<hamon::span<T>>()))>>
+	: public hamon::true_type {};
+
+// d.generate(g, span<T>) を呼び出せるかどうか
+template <typename D, typename G, typename T, typename = void>
+struct has_distribution_generate_member
+	: public hamon::false_type {};
+
+template <typename D, typename G, typename T>
+struct has_distribution_generate_member<D, G, T, hamon::void_t<
+	decltype(hamon::declval<D&>().generate(hamon::declval<G&>(), hamon::declval<hamon::span<T>>()))>>
+	: public hamon::true_type {};
+
+}	// namespace detail
+
+// [alg.rand.generate]
+//
+// P1068 (C++26) の generate_random。
+// 範囲が連続していて、g がメンバ関数 generate(span<result_type>) を持つ場合はそれを使い、
+// まとめて生成する。そうでない場合は g() を1つずつ呼び出す。
+// 分布 d を渡した場合も同様に、d.generate(g, span<result_type>) があればそれを使い、
+// そうでなければ d(g) を1つずつ呼び出す。
+struct generate_random_fn
+{
+private:
+	template <typename G, typename O, typename S,
+		typename T = hamon::iter_value_t<O>,
+		typename = hamon::enable_if_t<hamon::conjunction<
+			hamon::contiguous_iterator_t<O>,
+			hamon::sized_sentinel_for_t<S, O>,
+			hamon::is_same<T, hamon::invoke_result_t<G&>>,
+			detail::has_generate_member<G, T>
+		>::value>
+	>
+	static O impl(G& g, O first, S last, hamon::detail::overload_priority<1>)
+	{
+		auto const n = last - first;
+		g.generate(hamon::span<T>(hamon::to_address(first), static_cast<hamon::size_t>(n)));
+		return first + static_cast<hamon::iter_difference_t<O>>(n);
+	}
+
+	template <typename G, typename O, typename S>
+	static O impl(G& g, O first, S last, hamon::detail::overload_priority<0>)
+	{
+		for (; first != last; ++first)
+		{
+			*first = g();
+		}
+		return first;
+	}
+
+	template <typename G, typename D, typename O, typename S,
+		typename T = hamon::iter_value_t<O>,
+		typename = hamon::enable_if_t<hamon::conjunction<
+			hamon::contiguous_iterator_t<O>,
+			hamon::sized_sentinel_for_t<S, O>,
+			hamon::is_same<T, hamon::invoke_result_t<D&, G&>>,
+			detail::has_distribution_generate_member<D, G, T>
+		>::value>
+	>
+	static O impl(G& g, D& d, O first, S last, hamon::detail::overload_priority<1>)
+	{
+		auto const n = last - first;
+		d.generate(g, hamon::span<T>(hamon::to_address(first), static_cast<hamon::size_t>(n)));
+		return first + static_cast<hamon::iter_difference_t<O>>(n);
+	}
+
+	template <typename G, typename D, typename O, typename S>
+	static O impl(G& g, D& d, O first, S last, hamon::detail::overload_priority<0>)
+	{
+		for (; first != last; ++first)
+		{
+			*first = d(g);
+		}
+		return first;
+	}
+
+public:
+	template <
+		typename G,
+		HAMON_CONSTRAINED_PARAM(hamon::output_iterator, hamon::invoke_result_t<G&>, O),
+		HAMON_CONSTRAINED_PARAM(hamon::sentinel_for, O, S),
+		typename = hamon::enable_if_t<
+			hamon::uniform_random_bit_generator_t<hamon::remove_cvref_t<G>>::value>
+	>
+	O operator()(G&& g, O first, S last) const
+	{
+		return impl(g, first, last, hamon::detail::overload_priority<1>{});
+	}
+
+	template <
+		typename R,
+		typename G,
+		typename = hamon::enable_if_t<hamon::conjunction<
+			hamon::uniform_random_bit_generator_t<hamon::remove_cvref_t<G>>,
+			ranges::output_range_t<R, hamon::invoke_result_t<G&>>
+		>::value>
+	>
+	ranges::borrowed_iterator_t<R> operator()(R&& r, G&& g) const
+	{
+		return impl(g, ranges::begin(r), ranges::end(r), hamon::detail::overload_priority<1>{});
+	}
+
+	template <
+		typename G,
+		typename D,
+		HAMON_CONSTRAINED_PARAM(hamon::output_iterator, hamon::invoke_result_t<D&, G&>, O),
+		HAMON_CONSTRAINED_PARAM(hamon::sentinel_for, O, S),
+		typename = hamon::enable_if_t<
+			hamon::uniform_random_bit_generator_t<hamon::remove_cvref_t<G>>::value>
+	>
+	O operator()(G&& g, D&& d, O first, S last) const
+	{
+		return impl(g, d, first, last, hamon::detail::overload_priority<1>{});
+	}
+
+	template <
+		typename R,
+		typename G,
+		typename D,
+		typename = hamon::enable_if_t<hamon::conjunction<
+			hamon::uniform_random_bit_generator_t<hamon::remove_cvref_t<G>>,
+			ranges::output_range_t<R, hamon::invoke_result_t<D&, G&>>
+		>::value>
+	>
+	ranges::borrowed_iterator_t<R> operator()(R&& r, G&& g, D&& d) const
+	{
+		return impl(g, d, ranges::begin(r), ranges::end(r), hamon::detail::overload_priority<1>{});
+	}
+};
+
+inline namespace cpo
+{
+
+HAMON_INLINE_VAR HAMON_CONSTEXPR generate_random_fn generate_random{};
+
+}	// inline namespace cpo
+
+}	// namespace ranges
+
+}	// namespace hamon
+
+#endif // HAMON_RANDOM_GENERATE_RANDOM_HPP
@@ -0,0 +1,139 @@
+﻿/**
+ *	@file	unit_test_random_distributions_bernoulli_distribution.cpp
+ *
+ *	@brief	bernoulli_distribution のテスト
+ */
+
+#include <hamon/random/distributions/bernoulli_distribution.hpp>
+#include <hamon/random/engines/xorshift.hpp>
+#include <hamon/random/engines/xoshiro.hpp>
+#include <hamon/random/generate_random.hpp>
+#include <hamon/span.hpp>
+#include <hamon/type_traits/is_same.hpp>
+#include <gtest/gtest.h>
+#include <random>
+#include <sstream>
+#include "constexpr_test.hpp"
+
+namespace hamon_random_test
+{
+
+namespace bernoulli_distribution_test
+{
+
+GTEST_TEST(BernoulliDistributionTest, ParamTest)
+{
+	{
+		hamon::bernoulli_distribution dist;
+		static_assert(hamon::is_same<decltype(dist)::result_type, bool>::value, "");
+		EXPECT_EQ(0.5, dist.p());
+		EXPECT_EQ(false, dist.min());
+		EXPECT_EQ(true, dist.max());
+	}
+	{
+		HAMON_CXX11_CONSTEXPR hamon::bernoulli_distribution dist(0.25);
+		HAMON_CXX11_CONSTEXPR_EXPECT_TRUE(dist.p() == 0.25);
+	}
+	{
+		using dist_type = hamon::bernoulli_distribution;
+		using param_type = dist_type::param_type;
+		static_assert(hamon::is_same<param_type::distribution_type, dist_type>::value, "");
+		param_type p(0.1);
+		dist_type d1(p);
+		dist_type d2;
+		EXPECT_TRUE(d1 != d2);
+		d2.param(p);
+		EXPECT_TRUE(d1 == d2);
+	}
+}
+
+GTEST_TEST(BernoulliDistributionTest, ReferenceTest)
+{
+	// 処理系によらず同じ値になる
+	hamon::xoshiro256plusplus g;
+	hamon::bernoulli_distribution dist(0.3);
+	bool const expected[] =
+	{
+		1, 0, 1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 1, 1,
+		0, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 0, 0, 0,
+	};
+	for (auto x : expected)
+	{
+		EXPECT_EQ(x, dist(g));
+	}
+}
+
+GTEST_TEST(BernoulliDistributionTest, ProbabilityTest)
+{
+	hamon::xorshift32 g;
+	{
+		hamon::bernoulli_distribution dist(0.0);
+		for (int i = 0; i < 1000; ++i)
+		{
+			EXPECT_FALSE(dist(g));
+		}
+	}
+	{
+		hamon::bernoulli_distribution dist(1.0);
+		for (int i = 0; i < 1000; ++i)
+		{
+			EXPECT_TRUE(dist(g));
+		}
+	}
+	{
+		hamon::bernoulli_distribution dist(0.7);
+		int const n = 100000;
+		int count = 0;
+		for (int i = 0; i < n; ++i)
+		{
+			count += dist(g) ? 1 : 0;
+		}
+		EXPECT_NEAR(n * 0.7, count, n * 0.01);
+	}
+}
+
+template <typename Engine>
+void generate_test()
+{
+	hamon::bernoulli_distribution dist(0.4);
+
+	// operator() と同じ結果になる
+	Engine g1;
+	Engine g2;
+	bool v[700] {};
+	dist.generate(g1, hamon::span<bool>(v));
+	for (auto x : v)
+	{
+		EXPECT_EQ(dist(g2), x);
+	}
+	EXPECT_TRUE(g1 == g2);
+
+	Engine g3;
+	bool v2[700] {};
+	hamon::ranges::generate_random(v2, g3, dist);
+	for (int i = 0; i < 700; ++i)
+	{
+		EXPECT_EQ(v[i], v2[i]);
+	}
+}
+
+GTEST_TEST(BernoulliDistributionTest, GenerateTest)
+{
+	generate_test<hamon::xoshiro256plusplus>();
+	generate_test<hamon::xorshift32>();
+	generate_test<std::mt19937>();
+}
+
+GTEST_TEST(BernoulliDistributionTest, OutputInputTest)
+{
+	hamon::bernoulli_distribution d1(0.3);
+	hamon::bernoulli_distribution d2;
+	std::stringstream ss;
+	ss << d1;
+	ss >> d2;
+	EXPECT_TRUE(d1 == d2);
+}
+
+}	// namespace bernoulli_distribution_test
+
+}	// namespace hamon_random_test
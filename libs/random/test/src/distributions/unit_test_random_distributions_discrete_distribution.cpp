@@ -0,0 +1,152 @@
+﻿/**
+ *	@file	unit_test_random_distributions_discrete_distribution.cpp
+ *
+ *	@brief	discrete_distribution のテスト
+ */
+
+#include <hamon/random/distributions/discrete_distribution.hpp>
+#include <hamon/random/engines/xorshift.hpp>
+#include <hamon/random/engines/xoshiro.hpp>
+#include <hamon/random/generate_random.hpp>
+#include <hamon/span.hpp>
+#include <hamon/type_traits/is_same.hpp>
+#include <hamon/vector.hpp>
+#include <gtest/gtest.h>
+#include <random>
+#include <sstream>
+
+namespace hamon_random_test
+{
+
+namespace discrete_distribution_test
+{
+
+GTEST_TEST(DiscreteDistributionTest, ParamTest)
+{
+	{
+		hamon::discrete_distribution<> dist;
+		static_assert(hamon::is_same<decltype(dist)::result_type, int>::value, "");
+		EXPECT_TRUE(dist.probabilities() == hamon::vector<double>{1.0});
+		EXPECT_EQ(0, dist.min());
+		EXPECT_EQ(0, dist.max());
+	}
+	{
+		hamon::discrete_distribution<long> dist{1, 3, 0, 4};
+		EXPECT_TRUE(dist.probabilities() == (hamon::vector<double>{0.125, 0.375, 0.0, 0.5}));
+		EXPECT_EQ(0, dist.min());
+		EXPECT_EQ(3, dist.max());
+	}
+	{
+		double const w[] = { 2, 2 };
+		hamon::discrete_distribution<short> dist(w, w + 2);
+		EXPECT_TRUE(dist.probabilities() == (hamon::vector<double>{0.5, 0.5}));
+	}
+	{
+		hamon::discrete_distribution<> dist(4, 0.0, 8.0, [](double x) { return x; });
+		EXPECT_TRUE(dist.probabilities() == (hamon::vector<double>{0.0625, 0.1875, 0.3125, 0.4375}));
+	}
+	{
+		using dist_type = hamon::discrete_distribution<>;
+		using param_type = dist_type::param_type;
+		static_assert(hamon::is_same<param_type::distribution_type, dist_type>::value, "");
+		param_type p{1, 2};
+		dist_type d1(p);
+		dist_type d2;
+		EXPECT_TRUE(d1 != d2);
+		d2.param(p);
+		EXPECT_TRUE(d1 == d2);
+	}
+}
+
+GTEST_TEST(DiscreteDistributionTest, ReferenceTest)
+{
+	// 処理系によらず同じ値になる
+	hamon::xoshiro256plusplus g(8);
+	hamon::discrete_distribution<> dist{1, 2, 3, 4};
+	int const expected[] =
+	{
+		1, 1, 3, 1, 1, 3, 3, 2, 0, 3, 0, 3, 1, 2, 2, 2,
+		1, 3, 1, 3, 0, 3, 3, 2, 2, 3, 1, 2, 1, 2, 3, 1,
+	};
+	for (auto x : expected)
+	{
+		EXPECT_EQ(x, dist(g));
+	}
+}
+
+template <typename Engine>
+void probability_test(hamon::vector<double> const& w)
+{
+	Engine g;
+	hamon::discrete_distribution<> dist(w.begin(), w.end());
+	auto const p = dist.probabilities();
+	hamon::vector<int> count(w.size());
+	int const n = 200000;
+	for (int i = 0; i < n; ++i)
+	{
+		auto const x = dist(g);
+		ASSERT_LE(0, x);
+		ASSERT_GT(static_cast<int>(w.size()), x);
+		++count[static_cast<hamon::size_t>(x)];
+	}
+	for (hamon::size_t i = 0; i < w.size(); ++i)
+	{
+		EXPECT_NEAR(p[i] * n, count[i], n * 0.005);
+		if (p[i] == 0)
+		{
+			EXPECT_EQ(0, count[i]);
+		}
+	}
+}
+
+GTEST_TEST(DiscreteDistributionTest, ProbabilityTest)
+{
+	probability_test<hamon::xoshiro256plusplus>({1, 2, 3, 4});
+	probability_test<hamon::xoshiro256plusplus>({0, 5, 0, 1, 0});
+	probability_test<hamon::xorshift32>({0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7});
+	probability_test<std::mt19937>({1000, 1, 1});
+	probability_test<hamon::xoshiro256plusplus>({0, 0, 0});
+}
+
+template <typename Engine>
+void generate_test()
+{
+	hamon::discrete_distribution<> dist{5, 1, 3};
+
+	Engine g1;
+	Engine g2;
+	hamon::vector<int> v1(1000);
+	hamon::vector<int> v2(1000);
+	dist.generate(g1, hamon::span<int>(v1.data(), v1.size()));
+	hamon::ranges::generate_random(v2, g2, dist);
+	EXPECT_TRUE(v1 == v2);
+	EXPECT_TRUE(g1 == g2);
+
+	// 棄却されなければ operator() と同じ結果になる
+	Engine g3;
+	for (hamon::size_t i = 0; i < 10; ++i)
+	{
+		EXPECT_EQ(dist(g3), v1[i]);
+	}
+}
+
+GTEST_TEST(DiscreteDistributionTest, GenerateTest)
+{
+	generate_test<hamon::xoshiro256plusplus>();
+	generate_test<hamon::xorshift32>();
+	generate_test<std::mt19937_64>();
+}
+
+GTEST_TEST(DiscreteDistributionTest, OutputInputTest)
+{
+	hamon::discrete_distribution<> d1{0.5, 1, 2.5};
+	hamon::discrete_distribution<> d2;
+	std::stringstream ss;
+	ss << d1;
+	ss >> d2;
+	EXPECT_TRUE(d1 == d2);
+}
+
+}	// namespace discrete_distribution_test
+
+}	// namespace hamon_random_test
@@ -0,0 +1,132 @@
+﻿/**
+ *	@file	unit_test_random_distributions_exponential_distribution.cpp
+ *
+ *	@brief	exponential_distribution のテスト
+ */
+
+#include <hamon/random/distributions/exponential_distribution.hpp>
+#include <hamon/random/engines/xorshift.hpp>
+#include <hamon/random/engines/xoshiro.hpp>
+#include <hamon/random/generate_random.hpp>
+#include <hamon/limits.hpp>
+#include <hamon/span.hpp>
+#include <hamon/type_traits/is_same.hpp>
+#include <hamon/vector.hpp>
+#include <gtest/gtest.h>
+#include <random>
+#include <sstream>
+#include "constexpr_test.hpp"
+
+namespace hamon_random_test
+{
+
+namespace exponential_distribution_test
+{
+
+GTEST_TEST(ExponentialDistributionTest, ParamTest)
+{
+	{
+		hamon::exponential_distribution<> dist;
+		static_assert(hamon::is_same<decltype(dist)::result_type, double>::value, "");
+		EXPECT_EQ(1.0, dist.lambda());
+		EXPECT_EQ(0.0, dist.min());
+		EXPECT_EQ(hamon::numeric_limits<double>::infinity(), dist.max());
+	}
+	{
+		HAMON_CXX11_CONSTEXPR hamon::exponential_distribution<float> dist(2.0f);
+		HAMON_CXX11_CONSTEXPR_EXPECT_TRUE(dist.lambda() == 2.0f);
+	}
+	{
+		using dist_type = hamon::exponential_distribution<double>;
+		using param_type = dist_type::param_type;
+		static_assert(hamon::is_same<param_type::distribution_type, dist_type>::value, "");
+		param_type p(3);
+		dist_type d1(p);
+		dist_type d2;
+		EXPECT_TRUE(d1 != d2);
+		d2.param(p);
+		EXPECT_TRUE(d1 == d2);
+	}
+}
+
+GTEST_TEST(ExponentialDistributionTest, ReferenceTest)
+{
+	// 処理系によらず同じ値になる
+	hamon::xoshiro256plusplus g(7);
+	hamon::exponential_distribution<double> dist(1.5);
+	double const expected[] =
+	{
+		1.929260055560566, 1.1730583043626415, 0.22125082315651445, 0.5669866709115893,
+		0.024678159885478394, 0.5094704715432664, 0.21539481088455018, 0.7394328800348134,
+	};
+	for (auto x : expected)
+	{
+		EXPECT_EQ(x, dist(g));
+	}
+}
+
+template <typename RealType, typename Engine>
+void moment_test(RealType lambda)
+{
+	Engine g;
+	hamon::exponential_distribution<RealType> dist(lambda);
+	int const n = 100000;
+	double sum = 0;
+	for (int i = 0; i < n; ++i)
+	{
+		auto const x = dist(g);
+		EXPECT_LT(RealType(0), x);
+		sum += static_cast<double>(x);
+	}
+	EXPECT_NEAR(1.0 / static_cast<double>(lambda), sum / n, 0.01 / static_cast<double>(lambda));
+}
+
+GTEST_TEST(ExponentialDistributionTest, MomentTest)
+{
+	moment_test<double, hamon::xoshiro256plusplus>(1);
+	moment_test<float, hamon::xorshift32>(0.25f);
+	moment_test<long double, std::mt19937>(4);
+}
+
+template <typename RealType, typename Engine>
+void generate_test()
+{
+	hamon::exponential_distribution<RealType> dist(2);
+
+	// operator() と同じ結果になる
+	Engine g1;
+	Engine g2;
+	hamon::vector<RealType> v(1000);
+	dist.generate(g1, hamon::span<RealType>(v.data(), v.size()));
+	for (auto x : v)
+	{
+		EXPECT_EQ(dist(g2), x);
+	}
+	EXPECT_TRUE(g1 == g2);
+
+	Engine g3;
+	hamon::vector<RealType> v2(1000);
+	hamon::ranges::generate_random(v2, g3, dist);
+	EXPECT_TRUE(v == v2);
+}
+
+GTEST_TEST(ExponentialDistributionTest, GenerateTest)
+{
+	generate_test<float, hamon::xoshiro256plusplus>();
+	generate_test<double, hamon::xoshiro256plusplus>();
+	generate_test<double, hamon::xorshift32>();
+}
+
+GTEST_TEST(ExponentialDistributionTest, OutputInputTest)
+{
+	hamon::exponential_distribution<double> d1(0.3);
+	hamon::exponential_distribution<double> d2;
+	std::stringstream ss;
+	ss << d1;
+	ss >> d2;
+	EXPECT_TRUE(d1 == d2);
+}
+
+}	// namespace exponential_distribution_test
+
+}	// namespace hamon_random_test
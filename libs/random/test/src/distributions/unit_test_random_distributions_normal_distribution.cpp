@@ -0,0 +1,162 @@
+﻿/**
+ *	@file	unit_test_random_distributions_normal_distribution.cpp
+ *
+ *	@brief	normal_distribution のテスト
+ */
+
+#include <hamon/random/distributions/normal_distribution.hpp>
+#include <hamon/random/engines/multi_lane_xoshiro.hpp>
+#include <hamon/random/engines/xorshift.hpp>
+#include <hamon/random/engines/xoshiro.hpp>
+#include <hamon/random/generate_random.hpp>
+#include <hamon/limits.hpp>
+#include <hamon/span.hpp>
+#include <hamon/type_traits/is_same.hpp>
+#include <hamon/vector.hpp>
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+#include <sstream>
+#include "constexpr_test.hpp"
+
+namespace hamon_random_test
+{
+
+namespace normal_distribution_test
+{
+
+GTEST_TEST(NormalDistributionTest, ParamTest)
+{
+	{
+		hamon::normal_distribution<> dist;
+		static_assert(hamon::is_same<decltype(dist)::result_type, double>::value, "");
+		EXPECT_EQ(0.0, dist.mean());
+		EXPECT_EQ(1.0, dist.stddev());
+		EXPECT_EQ(-hamon::numeric_limits<double>::infinity(), dist.min());
+		EXPECT_EQ( hamon::numeric_limits<double>::infinity(), dist.max());
+	}
+	{
+		HAMON_CXX11_CONSTEXPR hamon::normal_distribution<float> dist(2.0f, 0.5f);
+		HAMON_CXX11_CONSTEXPR_EXPECT_TRUE(dist.mean() == 2.0f);
+		HAMON_CXX11_CONSTEXPR_EXPECT_TRUE(dist.stddev() == 0.5f);
+	}
+	{
+		using dist_type = hamon::normal_distribution<double>;
+		using param_type = dist_type::param_type;
+		static_assert(hamon::is_same<param_type::distribution_type, dist_type>::value, "");
+		param_type p(1, 2);
+		dist_type d1(p);
+		dist_type d2;
+		EXPECT_TRUE(d1 != d2);
+		d2.param(p);
+		EXPECT_TRUE(d1 == d2);
+	}
+}
+
+GTEST_TEST(NormalDistributionTest, ReferenceTest)
+{
+	// 処理系によらず同じ値になる
+	hamon::xoshiro256plusplus g;
+	hamon::normal_distribution<double> dist;
+	double const expected[] =
+	{
+		-1.28808202833768, 0.22536809594851606, -1.7895980852557187, 0.29392934517933733,
+		0.053834600508471844, -0.23595126822456464, 0.9087657304576469, -0.4844820237692092,
+		0.055798463255182146, -1.309377907052666, 0.11722347722560854, 0.8898982148243532,
+		1.96139201600235, 0.8720835341632132, -0.5056890242647748, -1.1031785884496266,
+	};
+	for (auto x : expected)
+	{
+		EXPECT_EQ(x, dist(g));
+	}
+
+	hamon::normal_distribution<float> dist2(10, 2);
+	hamon::xoshiro256plusplus g2;
+	for (auto x : expected)
+	{
+		EXPECT_EQ(static_cast<float>(x) * 2.0f + 10.0f, dist2(g2));
+	}
+}
+
+template <typename RealType, typename Engine>
+void moment_test(RealType mean, RealType stddev)
+{
+	Engine g;
+	hamon::normal_distribution<RealType> dist(mean, stddev);
+	int const n = 200000;
+	double sum = 0;
+	double sum2 = 0;
+	int tail = 0;
+	for (int i = 0; i < n; ++i)
+	{
+		double const x = static_cast<double>(dist(g));
+		sum += x;
+		sum2 += x * x;
+		double const z = (x - static_cast<double>(mean)) / static_cast<double>(stddev);
+		if (z > 3.654152885361008796 || z < -3.654152885361008796)
+		{
+			++tail;
+		}
+	}
+	double const m = sum / n;
+	double const v = sum2 / n - m * m;
+	EXPECT_NEAR(static_cast<double>(mean), m, 0.01 * static_cast<double>(stddev));
+	EXPECT_NEAR(static_cast<double>(stddev * stddev), v, 0.02 * static_cast<double>(stddev * stddev));
+	// P(|z| > R) ~= 0.000258
+	EXPECT_LT(20, tail);
+	EXPECT_GT(110, tail);
+}
+
+GTEST_TEST(NormalDistributionTest, MomentTest)
+{
+	moment_test<double, hamon::xoshiro256plusplus>(0, 1);
+	moment_test<double, hamon::xorshift32>(-5, 3);
+	moment_test<float, std::mt19937_64>(1, 0.5f);
+	moment_test<long double, std::mt19937>(100, 10);
+}
+
+template <typename RealType, typename Engine>
+void generate_test()
+{
+	hamon::normal_distribution<RealType> dist(1, 2);
+
+	Engine g1;
+	Engine g2;
+	hamon::vector<RealType> v1(2000);
+	hamon::vector<RealType> v2(2000);
+	dist.generate(g1, hamon::span<RealType>(v1.data(), v1.size()));
+	hamon::ranges::generate_random(v2, g2, dist);
+	EXPECT_TRUE(v1 == v2);
+	EXPECT_TRUE(g1 == g2);
+
+	// 最初の値は operator() と同じ
+	Engine g3;
+	EXPECT_EQ(dist(g3), v1[0]);
+
+	for (auto x : v1)
+	{
+		EXPECT_TRUE(std::isfinite(x));
+	}
+}
+
+GTEST_TEST(NormalDistributionTest, GenerateTest)
+{
+	generate_test<float, hamon::xoshiro256plusplus>();
+	generate_test<double, hamon::xoshiro256plusplus>();
+	generate_test<double, hamon::xoshiro256plusplus_x4>();
+	generate_test<double, hamon::xorshift32>();
+}
+
+GTEST_TEST(NormalDistributionTest, OutputInputTest)
+{
+	hamon::normal_distribution<double> d1(-0.1, 0.7);
+	hamon::normal_distribution<double> d2;
+	std::stringstream ss;
+	ss << d1;
+	ss >> d2;
+	EXPECT_TRUE(d1 == d2);
+}
+
+}	// namespace normal_distribution_test
+
+}	// namespace hamon_random_test
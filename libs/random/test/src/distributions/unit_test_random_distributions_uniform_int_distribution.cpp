@@ -0,0 +1,352 @@
+﻿/**
+ *	@file	unit_test_random_distributions_uniform_int_distribution.cpp
+ *
+ *	@brief	uniform_int_distribution のテスト
+ */
+
+#include <hamon/random/distributions/uniform_int_distribution.hpp>
+#include <hamon/random/engines/multi_lane_xoshiro.hpp>
+#include <hamon/random/engines/xorshift.hpp>
+#include <hamon/random/engines/xoshiro.hpp>
+#include <hamon/random/generate_random.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/cstdint.hpp>
+#include <hamon/limits.hpp>
+#include <hamon/span.hpp>
+#include <hamon/type_traits/is_same.hpp>
+#include <hamon/vector.hpp>
+#include <gtest/gtest.h>
+#include <random>
+#include <sstream>
+#include "constexpr_test.hpp"
+
+namespace hamon_random_test
+{
+
+namespace uniform_int_distribution_test
+{
+
+// constexpr で使えるエンジン (split_mix64)
+struct constexpr_engine
+{
+	using result_type = hamon::uint64_t;
+	static constexpr result_type min() { return 0; }
+	static constexpr result_type max() { return 0xFFFFFFFFFFFFFFFF; }
+
+	HAMON_CXX14_CONSTEXPR result_type operator()()
+	{
+		result_type z = (m_state += 0x9e3779b97f4a7c15);
+		z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+		z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+		return z ^ (z >> 31);
+	}
+
+	result_type m_state;
+};
+
+// 値の範囲が 2 のべき乗でないエンジン
+struct small_engine
+{
+	using result_type = hamon::uint32_t;
+	static constexpr result_type min() { return 1; }
+	static constexpr result_type max() { return 1000; }
+	result_type operator()() { return m_dist(m_engine); }
+	std::minstd_rand m_engine;
+	std::uniform_int_distribution<result_type> m_dist{1, 1000};
+};
+
+HAMON_CXX14_CONSTEXPR bool constexpr_test()
+{
+	constexpr_engine g{42};
+	hamon::uniform_int_distribution<int> dist(-3, 3);
+	int count[7] {};
+	for (int i = 0; i < 700; ++i)
+	{
+		int const x = dist(g);
+		if (x < -3 || 3 < x)
+		{
+			return false;
+		}
+		++count[x + 3];
+	}
+	for (auto c : count)
+	{
+		if (c == 0)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+GTEST_TEST(UniformIntDistributionTest, ConstexprTest)
+{
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(constexpr_test());
+}
+
+GTEST_TEST(UniformIntDistributionTest, ParamTest)
+{
+	{
+		hamon::uniform_int_distribution<> dist;
+		static_assert(hamon::is_same<decltype(dist)::result_type, int>::value, "");
+		EXPECT_EQ(0, dist.a());
+		EXPECT_EQ(hamon::numeric_limits<int>::max(), dist.b());
+		EXPECT_EQ(0, dist.min());
+		EXPECT_EQ(hamon::numeric_limits<int>::max(), dist.max());
+	}
+	{
+		HAMON_CXX11_CONSTEXPR hamon::uniform_int_distribution<short> dist(-5, 10);
+		HAMON_CXX11_CONSTEXPR_EXPECT_TRUE(dist.a() == -5);
+		HAMON_CXX11_CONSTEXPR_EXPECT_TRUE(dist.b() == 10);
+		HAMON_CXX11_CONSTEXPR_EXPECT_TRUE(dist.param().a() == -5);
+		HAMON_CXX11_CONSTEXPR_EXPECT_TRUE(dist.param().b() == 10);
+	}
+	{
+		using dist_type = hamon::uniform_int_distribution<long>;
+		using param_type = dist_type::param_type;
+		static_assert(hamon::is_same<param_type::distribution_type, dist_type>::value, "");
+		param_type p(1, 2);
+		dist_type d1(p);
+		dist_type d2;
+		EXPECT_TRUE(d1 != d2);
+		d2.param(p);
+		EXPECT_TRUE(d1 == d2);
+		EXPECT_TRUE(d1.param() == p);
+		EXPECT_FALSE(d1.param() != p);
+	}
+}
+
+GTEST_TEST(UniformIntDistributionTest, ReferenceTest)
+{
+	// 処理系によらず同じ値になる
+	{
+		hamon::xoshiro256plusplus g;
+		hamon::uniform_int_distribution<int> dist(0, 99);
+		int const expected[] = { 14, 59, 2, 73, 52, 33, 92, 23, 51, 22, 52, 79, 90, 70, 20, 17 };
+		for (auto x : expected)
+		{
+			EXPECT_EQ(x, dist(g));
+		}
+	}
+	{
+		// 32bit のエンジン
+		hamon::xorshift32 g;
+		hamon::uniform_int_distribution<int> dist(-50, 50);
+		int const expected[] = { -9, 11, 45, -19, -47, 13, -34, 47, 13, 40, 33, 10, -2, -5, 33, 16 };
+		for (auto x : expected)
+		{
+			EXPECT_EQ(x, dist(g));
+		}
+	}
+	{
+		hamon::xoshiro256plusplus g(1);
+		hamon::uniform_int_distribution<hamon::int64_t> dist(-1000000000000, 1000000000000);
+		hamon::int64_t const expected[] =
+		{
+			623224317764, 494209432317, -799698192933, 492433741234,
+			-630642855762, 180957769464, 973748157283, 46833727981,
+		};
+		for (auto x : expected)
+		{
+			EXPECT_EQ(x, dist(g));
+		}
+	}
+	{
+		// 全範囲
+		hamon::xoshiro256plusplus g(2);
+		hamon::uniform_int_distribution<hamon::uint64_t> dist(0, 0xFFFFFFFFFFFFFFFF);
+		hamon::uint64_t const expected[] =
+		{
+			14116099294885116970u, 9908902983784002248u, 12014208703938729165u, 5418364696612899442u,
+		};
+		for (auto x : expected)
+		{
+			EXPECT_EQ(x, dist(g));
+		}
+	}
+	{
+		// 32bit のエンジンから 64bit を作る
+		hamon::xorshift32 g(3);
+		hamon::uniform_int_distribution<hamon::uint64_t> dist(0, 6);
+		hamon::uint64_t const expected[] = { 4, 5, 5, 0, 4, 0, 2, 5, 4, 2, 3, 1, 3, 5, 1, 6 };
+		for (auto x : expected)
+		{
+			EXPECT_EQ(x, dist(g));
+		}
+	}
+	{
+		hamon::xoshiro256plusplus g;
+		hamon::uniform_int_distribution<int> dist(hamon::numeric_limits<int>::min(), hamon::numeric_limits<int>::max());
+		int const expected[] = { -1524290656, 399597747, -2055070999, 1023199128 };
+		for (auto x : expected)
+		{
+			EXPECT_EQ(x, dist(g));
+		}
+	}
+}
+
+template <typename IntType, typename Engine>
+void range_test(IntType a, IntType b)
+{
+	Engine g;
+	hamon::uniform_int_distribution<IntType> dist(a, b);
+	for (int i = 0; i < 1000; ++i)
+	{
+		auto const x = dist(g);
+		EXPECT_LE(a, x);
+		EXPECT_GE(b, x);
+	}
+}
+
+GTEST_TEST(UniformIntDistributionTest, RangeTest)
+{
+	range_test<int, hamon::xoshiro256plusplus>(0, 0);
+	range_test<int, hamon::xoshiro256plusplus>(-1, 1);
+	range_test<signed char, hamon::xoshiro256plusplus>(-128, 127);
+	range_test<unsigned char, hamon::xorshift32>(10, 20);
+	range_test<hamon::int64_t, hamon::xorshift32>(-3, 1000000000000);
+	range_test<hamon::uint64_t, small_engine>(0, 0xFFFFFFFFFFFFFFFF);
+	range_test<int, small_engine>(-1000, 1000);
+	range_test<unsigned int, std::mt19937>(5, 8);
+	range_test<long long, std::mt19937_64>(-7, 7);
+
+	// int より狭い型
+	range_test<short, hamon::xoshiro256plusplus>(-1, 1);
+	range_test<short, hamon::xoshiro256plusplus>(-100, 100);
+	range_test<short, hamon::xorshift32>(-32768, 32767);
+	range_test<short, std::mt19937>(-32768, -32760);
+	range_test<unsigned short, hamon::xoshiro256plusplus>(0, 65535);
+	range_test<unsigned short, hamon::xorshift32>(100, 200);
+	range_test<signed char, hamon::xoshiro256plusplus>(-1, 1);
+}
+
+// [a, b] の全ての値が出現することを確認する
+template <typename IntType, typename Engine>
+void cover_test(IntType a, IntType b)
+{
+	Engine g;
+	hamon::uniform_int_distribution<IntType> dist(a, b);
+	int const n = static_cast<int>(b) - static_cast<int>(a) + 1;
+	hamon::vector<int> count(static_cast<hamon::size_t>(n));
+	for (int i = 0; i < n * 100; ++i)
+	{
+		auto const x = dist(g);
+		ASSERT_LE(a, x);
+		ASSERT_GE(b, x);
+		++count[static_cast<hamon::size_t>(static_cast<int>(x) - static_cast<int>(a))];
+	}
+	for (auto c : count)
+	{
+		EXPECT_LT(0, c);
+	}
+
+	// generate でも同じ範囲になる
+	hamon::vector<IntType> v(1000);
+	dist.generate(g, hamon::span<IntType>(v.data(), v.size()));
+	for (auto x : v)
+	{
+		EXPECT_LE(a, x);
+		EXPECT_GE(b, x);
+	}
+}
+
+GTEST_TEST(UniformIntDistributionTest, NarrowTypeTest)
+{
+	cover_test<short, hamon::xoshiro256plusplus>(-1, 1);
+	cover_test<short, hamon::xoshiro256plusplus_x4>(-100, 100);
+	cover_test<short, std::mt19937>(-32768, -32700);
+	cover_test<short, hamon::xorshift32>(32700, 32767);
+	cover_test<unsigned short, hamon::xoshiro256plusplus>(0, 10);
+	cover_test<unsigned short, hamon::xorshift32>(65500, 65535);
+	cover_test<signed char, hamon::xoshiro256plusplus>(-128, 127);
+	cover_test<unsigned char, std::mt19937>(0, 255);
+}
+
+GTEST_TEST(UniformIntDistributionTest, UniformityTest)
+{
+	hamon::xoshiro256plusplus g;
+	hamon::uniform_int_distribution<int> dist(0, 9);
+	int count[10] {};
+	int const n = 100000;
+	for (int i = 0; i < n; ++i)
+	{
+		++count[dist(g)];
+	}
+	for (auto c : count)
+	{
+		EXPECT_NEAR(n / 10, c, n / 100);
+	}
+}
+
+template <typename Engine>
+void generate_test()
+{
+	hamon::uniform_int_distribution<int> dist(-100, 100);
+
+	// 同じ状態からは同じ結果になる
+	Engine g1;
+	Engine g2;
+	hamon::vector<int> v1(1000);
+	hamon::vector<int> v2(1000);
+	dist.generate(g1, hamon::span<int>(v1.data(), v1.size()));
+	dist.generate(g2, hamon::span<int>(v2.data(), v2.size()));
+	EXPECT_TRUE(v1 == v2);
+	EXPECT_TRUE(g1 == g2);
+	for (auto x : v1)
+	{
+		EXPECT_LE(-100, x);
+		EXPECT_GE(100, x);
+	}
+
+	// 棄却されない範囲では operator() と同じ結果になる
+	Engine g3;
+	hamon::uniform_int_distribution<int> dist2(0, 255);
+	hamon::vector<int> v3(300);
+	dist2.generate(g3, hamon::span<int>(v3.data(), v3.size()));
+	Engine g4;
+	for (auto x : v3)
+	{
+		EXPECT_EQ(dist2(g4), x);
+	}
+
+	// param を指定する
+	hamon::vector<int> v4(10);
+	dist.generate(g1, hamon::span<int>(v4.data(), v4.size()), decltype(dist)::param_type(7, 7));
+	for (auto x : v4)
+	{
+		EXPECT_EQ(7, x);
+	}
+
+	// ranges::generate_random
+	Engine g5;
+	Engine g6;
+	hamon::vector<int> v5(1000);
+	hamon::ranges::generate_random(v5, g5, dist);
+	EXPECT_TRUE(v5 == v1);
+	hamon::vector<int> v6(1000);
+	hamon::ranges::generate_random(g6, dist, v6.begin(), v6.end());
+	EXPECT_TRUE(v6 == v1);
+	EXPECT_TRUE(g5 == g6);
+}
+
+GTEST_TEST(UniformIntDistributionTest, GenerateTest)
+{
+	generate_test<hamon::xoshiro256plusplus>();
+	generate_test<hamon::xoshiro256plusplus_x4>();
+	generate_test<hamon::xorshift32>();
+	generate_test<std::mt19937>();
+}
+
+GTEST_TEST(UniformIntDistributionTest, OutputInputTest)
+{
+	hamon::uniform_int_distribution<int> d1(-3, 42);
+	hamon::uniform_int_distribution<int> d2;
+	std::stringstream ss;
+	ss << d1;
+	ss >> d2;
+	EXPECT_TRUE(d1 == d2);
+}
+
+}	// namespace uniform_int_distribution_test
+
+}	// namespace hamon_random_test
@@ -0,0 +1,191 @@
+﻿/**
+ *	@file	unit_test_random_distributions_uniform_real_distribution.cpp
+ *
+ *	@brief	uniform_real_distribution のテスト
+ */
+
+#include <hamon/random/distributions/uniform_real_distribution.hpp>
+#include <hamon/random/engines/xorshift.hpp>
+#include <hamon/random/engines/xoshiro.hpp>
+#include <hamon/random/generate_random.hpp>
+#include <hamon/span.hpp>
+#include <hamon/type_traits/is_same.hpp>
+#include <hamon/vector.hpp>
+#include <gtest/gtest.h>
+#include <random>
+#include <sstream>
+#include "constexpr_test.hpp"
+
+namespace hamon_random_test
+{
+
+namespace uniform_real_distribution_test
+{
+
+GTEST_TEST(UniformRealDistributionTest, ParamTest)
+{
+	{
+		hamon::uniform_real_distribution<> dist;
+		static_assert(hamon::is_same<decltype(dist)::result_type, double>::value, "");
+		EXPECT_EQ(0.0, dist.a());
+		EXPECT_EQ(1.0, dist.b());
+		EXPECT_EQ(0.0, dist.min());
+		EXPECT_EQ(1.0, dist.max());
+	}
+	{
+		HAMON_CXX11_CONSTEXPR hamon::uniform_real_distribution<float> dist(-0.5f, 2.5f);
+		HAMON_CXX11_CONSTEXPR_EXPECT_TRUE(dist.a() == -0.5f);
+		HAMON_CXX11_CONSTEXPR_EXPECT_TRUE(dist.b() == 2.5f);
+	}
+	{
+		using dist_type = hamon::uniform_real_distribution<double>;
+		using param_type = dist_type::param_type;
+		static_assert(hamon::is_same<param_type::distribution_type, dist_type>::value, "");
+		param_type p(1, 2);
+		dist_type d1(p);
+		dist_type d2;
+		EXPECT_TRUE(d1 != d2);
+		d2.param(p);
+		EXPECT_TRUE(d1 == d2);
+	}
+}
+
+GTEST_TEST(UniformRealDistributionTest, ReferenceTest)
+{
+	// 処理系によらず同じ値になる
+	{
+		hamon::xoshiro256plusplus g;
+		hamon::uniform_real_distribution<double> dist;
+		double const expected[] =
+		{
+			0.14509842562729014, 0.5930386007431868, 0.021516496738401614, 0.7382321116375781,
+			0.5208082692753648, 0.33737506141295603, 0.9262708664956983, 0.2388829778640218,
+		};
+		for (auto x : expected)
+		{
+			EXPECT_EQ(x, dist(g));
+		}
+	}
+	{
+		hamon::xoshiro256plusplus g(4);
+		hamon::uniform_real_distribution<double> dist(-2, 3);
+		double const expected[] =
+		{
+			1.3978626744222442, 1.030877370147373, -0.7436147062779768, 1.62796711737972,
+			-1.2165397280461518, 1.811235052385502, 1.2033279728176, 2.794533476182644,
+		};
+		for (auto x : expected)
+		{
+			EXPECT_EQ(x, dist(g));
+		}
+	}
+	{
+		hamon::xoshiro256plusplus g(5);
+		hamon::uniform_real_distribution<float> dist(1, 2);
+		float const expected[] =
+		{
+			1.2920228242874146f, 1.6114394664764404f, 1.0979632139205933f, 1.0586111545562744f,
+			1.5270564556121826f, 1.7032057046890259f, 1.4597160816192627f, 1.0679908990859985f,
+		};
+		for (auto x : expected)
+		{
+			EXPECT_EQ(x, dist(g));
+		}
+	}
+	{
+		// 32bit のエンジン
+		hamon::xorshift32 g(6);
+		hamon::uniform_real_distribution<double> dist;
+		double const expected[] =
+		{
+			0.422223454207006, 0.8292743778967555, 0.04537543844452363, 0.48747072537592884,
+			0.963036211961287, 0.028586796274603365, 0.3076876044364606, 0.5735923491562708,
+		};
+		for (auto x : expected)
+		{
+			EXPECT_EQ(x, dist(g));
+		}
+	}
+}
+
+template <typename RealType, typename Engine>
+void range_test(RealType a, RealType b)
+{
+	Engine g;
+	hamon::uniform_real_distribution<RealType> dist(a, b);
+	for (int i = 0; i < 1000; ++i)
+	{
+		auto const x = dist(g);
+		EXPECT_LE(a, x);
+		EXPECT_GT(b, x);
+	}
+}
+
+GTEST_TEST(UniformRealDistributionTest, RangeTest)
+{
+	range_test<float, hamon::xoshiro256plusplus>(0, 1);
+	range_test<float, hamon::xorshift32>(-1, 1);
+	range_test<double, hamon::xoshiro256plusplus>(-100, -99);
+	range_test<double, std::mt19937>(1, 1.0000001);
+	range_test<long double, std::mt19937_64>(0, 1);
+
+	// b - a が b に比べて小さい場合、丸めで b になる値は棄却される
+	range_test<float, hamon::xoshiro256plusplus>(1000000, 1000000.0625f);
+}
+
+GTEST_TEST(UniformRealDistributionTest, MeanTest)
+{
+	hamon::xoshiro256plusplus g;
+	hamon::uniform_real_distribution<double> dist(2, 4);
+	double sum = 0;
+	int const n = 100000;
+	for (int i = 0; i < n; ++i)
+	{
+		sum += dist(g);
+	}
+	EXPECT_NEAR(3.0, sum / n, 0.01);
+}
+
+template <typename RealType, typename Engine>
+void generate_test()
+{
+	hamon::uniform_real_distribution<RealType> dist(-1, 1);
+
+	// 棄却されない範囲では operator() と同じ結果になる
+	Engine g1;
+	Engine g2;
+	hamon::vector<RealType> v(1000);
+	dist.generate(g1, hamon::span<RealType>(v.data(), v.size()));
+	for (auto x : v)
+	{
+		EXPECT_EQ(dist(g2), x);
+	}
+	EXPECT_TRUE(g1 == g2);
+
+	Engine g3;
+	hamon::vector<RealType> v2(1000);
+	hamon::ranges::generate_random(v2, g3, dist);
+	EXPECT_TRUE(v == v2);
+}
+
+GTEST_TEST(UniformRealDistributionTest, GenerateTest)
+{
+	generate_test<float, hamon::xoshiro256plusplus>();
+	generate_test<double, hamon::xoshiro256plusplus>();
+	generate_test<double, hamon::xorshift32>();
+	generate_test<double, std::mt19937_64>();
+}
+
+GTEST_TEST(UniformRealDistributionTest, OutputInputTest)
+{
+	hamon::uniform_real_distribution<double> d1(-0.1, 0.7);
+	hamon::uniform_real_distribution<double> d2;
+	std::stringstream ss;
+	ss << d1;
+	ss >> d2;
+	EXPECT_TRUE(d1 == d2);
+}
+
+}	// namespace uniform_real_distribution_test
+
+}	// namespace hamon_random_test
@@ -0,0 +1,78 @@
+﻿/**
+ *	@file	unit_test_random_engines_generate.cpp
+ *
+ *	@brief	generate(span) のテスト
+ */
+
+#include <hamon/random/engines/xoroshiro.hpp>
+#include <hamon/random/engines/xorshift.hpp>
+#include <hamon/random/engines/xoshiro.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/span.hpp>
+#include <hamon/vector.hpp>
+#include <gtest/gtest.h>
+
+namespace hamon_random_test
+{
+
+namespace generate_test
+{
+
+using GenerateTestTypes = ::testing::Types<
+	hamon::xoshiro256starstar,
+	hamon::xoshiro256plusplus,
+	hamon::xoshiro256plus,
+	hamon::xoshiro128starstar,
+	hamon::xoshiro128plusplus,
+	hamon::xoshiro128plus,
+	hamon::xoshiro512starstar,
+	hamon::xoshiro512plusplus,
+	hamon::xoshiro512plus,
+	hamon::xoroshiro128starstar,
+	hamon::xoroshiro128star,
+	hamon::xoroshiro128plusplus,
+	hamon::xoroshiro128plus,
+	hamon::xoroshiro64starstar,
+	hamon::xoroshiro64star,
+	hamon::xoroshiro1024starstar,
+	hamon::xoroshiro1024star,
+	hamon::xoroshiro1024plusplus,
+	hamon::xoroshiro1024plus,
+	hamon::xorshift32,
+	hamon::xorshift64,
+	hamon::xorshift128,
+	hamon::xorwow,
+	hamon::xorshift64star,
+	hamon::xorshift1024star,
+	hamon::xorshift128plus
+>;
+
+template <typename T>
+class GenerateTest : public ::testing::Test {};
+TYPED_TEST_SUITE(GenerateTest, GenerateTestTypes);
+
+TYPED_TEST(GenerateTest, GenerateSpanTest)
+{
+	using Engine = TypeParam;
+	using result_type = typename Engine::result_type;
+
+	hamon::size_t const sizes[] = { 0, 1, 2, 17, 100 };
+
+	Engine e1(7);
+	Engine e2(7);
+	for (auto n : sizes)
+	{
+		hamon::vector<result_type> v(n);
+		e1.generate(hamon::span<result_type>(v));
+		for (hamon::size_t i = 0; i < n; ++i)
+		{
+			EXPECT_EQ(e2(), v[i]);
+		}
+		EXPECT_TRUE(e1 == e2);
+		EXPECT_EQ(e2(), e1());
+	}
+}
+
+}	// namespace generate_test
+
+}	// namespace hamon_random_test
@@ -0,0 +1,258 @@
+﻿/**
+ *	@file	unit_test_random_engines_jump.cpp
+ *
+ *	@brief	jump, long_jump, discard のテスト
+ */
+
+#include <hamon/random/engines/xoroshiro.hpp>
+#include <hamon/random/engines/xorshift.hpp>
+#include <hamon/random/engines/xoshiro.hpp>
+#include <hamon/random/engines/generate_independent_engines.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/cstdint/uint32_t.hpp>
+#include <hamon/cstdint/uint64_t.hpp>
+#include <gtest/gtest.h>
+#include <sstream>
+
+namespace hamon_random_test
+{
+
+namespace jump_test
+{
+
+using JumpTestTypes = ::testing::Types<
+	hamon::xoshiro256starstar,
+	hamon::xoshiro256plusplus,
+	hamon::xoshiro256plus,
+	hamon::xoshiro128starstar,
+	hamon::xoshiro128plusplus,
+	hamon::xoshiro128plus,
+	hamon::xoshiro512starstar,
+	hamon::xoshiro512plusplus,
+	hamon::xoshiro512plus,
+	hamon::xoroshiro128starstar,
+	hamon::xoroshiro128star,
+	hamon::xoroshiro128plusplus,
+	hamon::xoroshiro128plus,
+	hamon::xoroshiro64starstar,
+	hamon::xoroshiro64star,
+	hamon::xoroshiro1024plus,
+	hamon::xoroshiro1024plusplus,
+	hamon::xoroshiro1024star,
+	hamon::xoroshiro1024starstar,
+	hamon::xorshift32,
+	hamon::xorshift64,
+	hamon::xorshift128,
+	hamon::xorshift64star,
+	hamon::xorshift1024star,
+	hamon::xorshift128plus
+>;
+
+template <typename T>
+class JumpTest : public ::testing::Test {};
+TYPED_TEST_SUITE(JumpTest, JumpTestTypes);
+
+template <typename Engine>
+void naive_discard(Engine& e, unsigned long long z)
+{
+	for (; z; --z)
+	{
+		(void)e();
+	}
+}
+
+TYPED_TEST(JumpTest, DiscardTest)
+{
+	using Engine = TypeParam;
+
+	unsigned long long const tbl[] =
+	{
+		0, 1, 5, 1000,
+		Engine::state_bits * 64,
+		Engine::state_bits * 64 + 1,
+		100000,
+	};
+
+	for (auto z : tbl)
+	{
+		Engine e1(42);
+		Engine e2(42);
+		(void)e1();
+		(void)e2();
+		e1.discard(z);
+		naive_discard(e2, z);
+		EXPECT_TRUE(e1 == e2) << z;
+		EXPECT_EQ(e1(), e2()) << z;
+		EXPECT_EQ(e1(), e2()) << z;
+	}
+}
+
+TYPED_TEST(JumpTest, JumpTest)
+{
+	using Engine = TypeParam;
+
+	// jump と discard は交換できる
+	{
+		Engine e1;
+		Engine e2;
+		e1.jump();
+		EXPECT_TRUE(e1 != e2);
+		e1.discard(3);
+		e2.discard(3);
+		e2.jump();
+		EXPECT_TRUE(e1 == e2);
+		EXPECT_EQ(e1(), e2());
+	}
+	{
+		Engine e1;
+		Engine e2;
+		e1.long_jump();
+		EXPECT_TRUE(e1 != e2);
+		e1.discard(5);
+		e2.discard(5);
+		e2.long_jump();
+		EXPECT_TRUE(e1 == e2);
+		EXPECT_EQ(e1(), e2());
+	}
+	// jump した結果は元の列と異なる
+	{
+		Engine e1;
+		Engine e2 = e1;
+		Engine e3 = e1;
+		e2.jump();
+		e3.long_jump();
+		EXPECT_TRUE(e1 != e2);
+		EXPECT_TRUE(e1 != e3);
+		EXPECT_TRUE(e2 != e3);
+	}
+}
+
+GTEST_TEST(JumpTest, Xorshift32Test)
+{
+	// 状態が小さいエンジンでは、実際に進めた結果と比較できる
+	{
+		hamon::xorshift32 e1;
+		hamon::xorshift32 e2;
+		e1.jump();
+		naive_discard(e2, 1ull << 16);
+		EXPECT_TRUE(e1 == e2);
+	}
+	{
+		hamon::xorshift32 e1;
+		hamon::xorshift32 e2;
+		e1.long_jump();
+		naive_discard(e2, 1ull << 24);
+		EXPECT_TRUE(e1 == e2);
+	}
+}
+
+// 参照実装の jump 多項式の定数で進める
+template <typename Engine, typename UIntType, hamon::size_t N, hamon::size_t M>
+void reference_jump(Engine& e, UIntType const (&jump)[M])
+{
+	UIntType t[N] {};
+	for (hamon::size_t i = 0; i < M; ++i)
+	{
+		for (int b = 0; b < hamon::numeric_limits<UIntType>::digits; ++b)
+		{
+			if ((jump[i] >> b) & 1)
+			{
+				std::stringstream ss;
+				ss << e;
+				for (hamon::size_t j = 0; j < N; ++j)
+				{
+					UIntType s;
+					ss >> s;
+					t[j] ^= s;
+				}
+			}
+			(void)e();
+		}
+	}
+
+	std::stringstream ss;
+	for (hamon::size_t j = 0; j < N; ++j)
+	{
+		ss << t[j] << " ";
+	}
+	ss >> e;
+}
+
+template <typename Engine, hamon::size_t N, typename UIntType, hamon::size_t M>
+void test_reference_jump(UIntType const (&jump)[M], UIntType const (&long_jump)[M])
+{
+	{
+		Engine e1(123);
+		Engine e2(123);
+		e1.jump();
+		reference_jump<Engine, UIntType, N>(e2, jump);
+		EXPECT_TRUE(e1 == e2);
+	}
+	{
+		Engine e1(123);
+		Engine e2(123);
+		e1.long_jump();
+		reference_jump<Engine, UIntType, N>(e2, long_jump);
+		EXPECT_TRUE(e1 == e2);
+	}
+}
+
+GTEST_TEST(JumpTest, ReferenceTest)
+{
+	// 参照実装 (https://prng.di.unimi.it/) の jump, long_jump と同じ結果になる
+	{
+		hamon::uint64_t const jump[] =
+			{ 0x180ec6d33cfd0aba, 0xd5a61266f0c9392c, 0xa9582618e03fc9aa, 0x39abdc4529b1661c };
+		hamon::uint64_t const long_jump[] =
+			{ 0x76e15d3efefdcbbf, 0xc5004e441c522fb3, 0x77710069854ee241, 0x39109bb02acbe635 };
+		test_reference_jump<hamon::xoshiro256starstar, 4>(jump, long_jump);
+		test_reference_jump<hamon::xoshiro256plus, 4>(jump, long_jump);
+	}
+	{
+		hamon::uint32_t const jump[] =
+			{ 0x8764000b, 0xf542d2d3, 0x6fa035c3, 0x77f2db5b };
+		hamon::uint32_t const long_jump[] =
+			{ 0xb523952e, 0x0b6f099f, 0xccf5a0ef, 0x1c580662 };
+		test_reference_jump<hamon::xoshiro128starstar, 4>(jump, long_jump);
+		test_reference_jump<hamon::xoshiro128plus, 4>(jump, long_jump);
+	}
+	{
+		hamon::uint64_t const jump[] =
+		{
+			0x33ed89b6e7a353f9, 0x760083d7955323be, 0x2837f2fbb5f22fae, 0x4b8c5674d309511c,
+			0xb11ac47a7ba28c25, 0xf1be7667092bcc1c, 0x53851efdb6df0aaf, 0x1ebbc8b23eaf25db,
+		};
+		hamon::uint64_t const long_jump[] =
+		{
+			0x11467fef8f921d28, 0xa2a819f2e79c8ea8, 0xa8299fc284b3959a, 0xb4d347340ca63ee1,
+			0x1cb0940bedbff6ce, 0xd956c5c4fa1f8e17, 0x915e38fd4eda93bc, 0x5b3ccdfa5d7daca5,
+		};
+		test_reference_jump<hamon::xoshiro512starstar, 8>(jump, long_jump);
+		test_reference_jump<hamon::xoshiro512plus, 8>(jump, long_jump);
+	}
+	{
+		hamon::uint64_t const jump[] = { 0xdf900294d8f554a5, 0x170865df4b3201fc };
+		hamon::uint64_t const long_jump[] = { 0xd2a98b26625eee7b, 0xdddf9b1090aa7ac1 };
+		test_reference_jump<hamon::xoroshiro128starstar, 2>(jump, long_jump);
+		test_reference_jump<hamon::xoroshiro128plus, 2>(jump, long_jump);
+	}
+}
+
+GTEST_TEST(JumpTest, GenerateIndependentEnginesTest)
+{
+	hamon::xoshiro256starstar const e(7);
+	hamon::xoshiro256starstar engines[4];
+	auto const last = hamon::generate_independent_engines(engines, 4, e);
+	EXPECT_TRUE(last == engines + 4);
+
+	hamon::xoshiro256starstar expected = e;
+	for (auto& x : engines)
+	{
+		EXPECT_TRUE(x == expected);
+		expected.jump();
+	}
+}
+
+}	// namespace jump_test
+
+}	// namespace hamon_random_test
@@ -0,0 +1,211 @@
+﻿/**
+ *	@file	unit_test_random_engines_multi_lane_xoshiro.cpp
+ *
+ *	@brief	multi_lane_xoshiro256plusplus のテスト
+ */
+
+#include <hamon/random/engines/multi_lane_xoshiro.hpp>
+#include <hamon/random/engines/xoshiro.hpp>
+#include <hamon/random/seed_seq.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/cstdint/uint64_t.hpp>
+#include <hamon/span.hpp>
+#include <hamon/vector.hpp>
+#include <gtest/gtest.h>
+#include <sstream>
+
+namespace hamon_random_test
+{
+
+namespace multi_lane_xoshiro_test
+{
+
+using MultiLaneXoshiroTestTypes = ::testing::Types<
+	hamon::xoshiro256plusplus_x4,
+	hamon::xoshiro256plusplus_x8
+>;
+
+template <typename T>
+class MultiLaneXoshiroTest : public ::testing::Test {};
+TYPED_TEST_SUITE(MultiLaneXoshiroTest, MultiLaneXoshiroTestTypes);
+
+// レーン i の列は、xoshiro256++ を i 回 jump したものと一致する
+template <typename Engine>
+void check_lanes(Engine& e, hamon::xoshiro256plusplus base, hamon::size_t blocks)
+{
+	hamon::size_t const L = Engine::lanes;
+
+	hamon::vector<hamon::xoshiro256plusplus> lanes;
+	for (hamon::size_t i = 0; i < L; ++i)
+	{
+		lanes.push_back(base);
+		base.jump();
+	}
+
+	for (hamon::size_t k = 0; k < blocks; ++k)
+	{
+		for (hamon::size_t i = 0; i < L; ++i)
+		{
+			EXPECT_EQ(lanes[i](), e());
+		}
+	}
+}
+
+TYPED_TEST(MultiLaneXoshiroTest, LaneTest)
+{
+	using Engine = TypeParam;
+	{
+		Engine e;
+		check_lanes(e, hamon::xoshiro256plusplus{}, 100);
+	}
+	{
+		Engine e(42);
+		check_lanes(e, hamon::xoshiro256plusplus{42}, 100);
+	}
+	{
+		unsigned const a[] ={3, 5, 7};
+		hamon::seed_seq sseq1(a, a+3);
+		hamon::seed_seq sseq2(a, a+3);
+		Engine e(sseq1);
+		check_lanes(e, hamon::xoshiro256plusplus{sseq2}, 100);
+	}
+}
+
+TYPED_TEST(MultiLaneXoshiroTest, GenerateTest)
+{
+	using Engine = TypeParam;
+	using result_type = typename Engine::result_type;
+
+	hamon::size_t const sizes[] = { 0, 1, 3, 7, 8, 9, 16, 31, 100, 1000 };
+
+	Engine e1(1);
+	Engine e2(1);
+	for (auto n : sizes)
+	{
+		hamon::vector<result_type> v(n);
+		e1.generate(hamon::span<result_type>(v));
+		for (hamon::size_t i = 0; i < n; ++i)
+		{
+			EXPECT_EQ(e2(), v[i]);
+		}
+		EXPECT_TRUE(e1 == e2);
+
+		// operator() と混ぜても同じ列になる
+		EXPECT_EQ(e2(), e1());
+		EXPECT_TRUE(e1 == e2);
+	}
+}
+
+TYPED_TEST(MultiLaneXoshiroTest, DiscardTest)
+{
+	using Engine = TypeParam;
+
+	unsigned long long const counts[] = { 0, 1, 2, 5, 8, 13, 100, 1001 };
+
+	for (auto z : counts)
+	{
+		Engine e1(3);
+		Engine e2(3);
+		(void)e1();
+		(void)e2();
+		e1.discard(z);
+		for (unsigned long long i = 0; i < z; ++i)
+		{
+			(void)e2();
+		}
+		EXPECT_TRUE(e1 == e2);
+		EXPECT_EQ(e2(), e1());
+	}
+}
+
+TYPED_TEST(MultiLaneXoshiroTest, JumpTest)
+{
+	using Engine = TypeParam;
+	hamon::size_t const L = Engine::lanes;
+
+	// jump の後のレーン i は、xoshiro256++ を (L + i) 回 jump したもの
+	{
+		Engine e;
+		e.jump();
+
+		hamon::xoshiro256plusplus base;
+		for (hamon::size_t i = 0; i < L; ++i)
+		{
+			base.jump();
+		}
+		check_lanes(e, base, 10);
+	}
+	// バッファに残っている値は捨てる
+	{
+		Engine e;
+		(void)e();
+		e.jump();
+
+		hamon::xoshiro256plusplus base;
+		(void)base();
+		for (hamon::size_t i = 0; i < L; ++i)
+		{
+			base.jump();
+		}
+		check_lanes(e, base, 10);
+	}
+	{
+		Engine e;
+		e.long_jump();
+
+		hamon::xoshiro256plusplus base;
+		base.long_jump();
+		check_lanes(e, base, 10);
+	}
+}
+
+TYPED_TEST(MultiLaneXoshiroTest, CompareTest)
+{
+	using Engine = TypeParam;
+
+	Engine e1;
+	Engine e2;
+	EXPECT_TRUE(e1 == e2);
+	(void)e1();
+	EXPECT_TRUE(e1 != e2);
+	(void)e2();
+	EXPECT_TRUE(e1 == e2);
+
+	Engine e3(5);
+	EXPECT_TRUE(e1 != e3);
+	e3.seed(Engine::default_seed);
+	(void)e3();
+	EXPECT_TRUE(e1 == e3);
+
+	Engine e4 = e1;
+	EXPECT_TRUE(e1 == e4);
+	EXPECT_EQ(e1(), e4());
+}
+
+TYPED_TEST(MultiLaneXoshiroTest, MinMaxTest)
+{
+	using Engine = TypeParam;
+	EXPECT_EQ(Engine::min(), 0u);
+	EXPECT_EQ(Engine::max(), hamon::uint64_t(~0ull));
+}
+
+TYPED_TEST(MultiLaneXoshiroTest, InputOutputTest)
+{
+	using Engine = TypeParam;
+
+	Engine e1;
+	e1.discard(101);
+	std::ostringstream os;
+	os << e1;
+	std::istringstream is(os.str());
+	Engine e2;
+	EXPECT_TRUE(e1 != e2);
+	is >> e2;
+	EXPECT_TRUE(e1 == e2);
+	EXPECT_EQ(e1(), e2());
+	EXPECT_EQ(e1(), e2());
+}
+
+}	// namespace multi_lane_xoshiro_test
+
+}	// namespace hamon_random_test
@@ -19,11 +19,13 @@ namespace xoroshiro_test
 using XoroshiroTestTypes = ::testing::Types<
 	hamon::xoroshiro128starstar,
 	hamon::xoroshiro128star,
+	hamon::xoroshiro128plusplus,
 	hamon::xoroshiro128plus,
 	hamon::xoroshiro64starstar,
 	hamon::xoroshiro64star,
 	hamon::xoroshiro1024starstar,
 	hamon::xoroshiro1024star,
+	hamon::xoroshiro1024plusplus,
 	hamon::xoroshiro1024plus
 >;
 
@@ -49,6 +51,14 @@ GTEST_TEST(Xoroshiro128Test, GenerateTest)
 		EXPECT_EQ( 4679223458511799590U, e());
 		EXPECT_EQ(10872016672379670585U, e());
 	}
+	{
+		hamon::xoroshiro128plusplus	e;
+		EXPECT_EQ( 9874437113983204801U, e());
+		EXPECT_EQ(16438831180911423187U, e());
+		EXPECT_EQ(  109312203430861103U, e());
+		EXPECT_EQ(16009976890899590334U, e());
+		EXPECT_EQ(15078883749030661395U, e());
+	}
 	{
 		hamon::xoroshiro128plus	e;
 		EXPECT_EQ( 5935771268297859122U, e());
@@ -97,6 +107,14 @@ GTEST_TEST(Xoroshiro1024Test, GenerateTest)
 		EXPECT_EQ( 1458544928678517903U, e());
 		EXPECT_EQ( 8293522010231248698U, e());
 	}
+	{
+		hamon::xoroshiro1024plusplus	e;
+		EXPECT_EQ(11131918694809831693U, e());
+		EXPECT_EQ( 3239107798121085734U, e());
+		EXPECT_EQ( 2582766629136019913U, e());
+		EXPECT_EQ(  170527232129580108U, e());
+		EXPECT_EQ( 9370082452964364121U, e());
+	}
 	{
 		hamon::xoroshiro1024plus	e;
 		EXPECT_EQ( 5935771268297859122U, e());
@@ -18,10 +18,13 @@ namespace xoshiro_test
 
 using XoshiroTestTypes = ::testing::Types<
 	hamon::xoshiro256starstar,
+	hamon::xoshiro256plusplus,
 	hamon::xoshiro256plus,
 	hamon::xoshiro128starstar,
+	hamon::xoshiro128plusplus,
 	hamon::xoshiro128plus,
 	hamon::xoshiro512starstar,
+	hamon::xoshiro512plusplus,
 	hamon::xoshiro512plus
 >;
 
@@ -39,6 +42,14 @@ GTEST_TEST(Xoshiro256Test, GenerateTest)
 		EXPECT_EQ(14316270549696789139U, e());
 		EXPECT_EQ( 3587917546556971649U, e());
 	}
+	{
+		hamon::xoshiro256plusplus	e;
+		EXPECT_EQ( 2676593523044801881U, e());
+		EXPECT_EQ(10939631293740387248U, e());
+		EXPECT_EQ(  396909308696101970U, e());
+		EXPECT_EQ(13617978830372581617U, e());
+		EXPECT_EQ( 9607216854794265508U, e());
+	}
 	{
 		hamon::xoshiro256plus	e;
 		EXPECT_EQ( 6919976103715683355U, e());
@@ -59,6 +70,14 @@ GTEST_TEST(Xoshiro128Test, GenerateTest)
 		EXPECT_EQ(3373243000U, e());
 		EXPECT_EQ(1488122016U, e());
 	}
+	{
+		hamon::xoshiro128plusplus	e;
+		EXPECT_EQ(3433064103U, e());
+		EXPECT_EQ( 820867534U, e());
+		EXPECT_EQ( 600422036U, e());
+		EXPECT_EQ(1883698669U, e());
+		EXPECT_EQ(3768553746U, e());
+	}
 	{
 		hamon::xoshiro128plus	e;
 		EXPECT_EQ(1277836315U, e());
@@ -79,6 +98,14 @@ GTEST_TEST(Xoshiro512Test, GenerateTest)
 		EXPECT_EQ(16246517855431934821U, e());
 		EXPECT_EQ( 3391123419404408030U, e());
 	}
+	{
+		hamon::xoshiro512plusplus	e;
+		EXPECT_EQ( 2254525397617395443U, e());
+		EXPECT_EQ( 2308871098121066386U, e());
+		EXPECT_EQ( 9096431638017013280U, e());
+		EXPECT_EQ(13259606351415944930U, e());
+		EXPECT_EQ( 1429283108090737622U, e());
+	}
 	{
 		hamon::xoshiro512plus	e;
 		EXPECT_EQ(12743888657125588542U, e());
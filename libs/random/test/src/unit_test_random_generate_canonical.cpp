@@ -0,0 +1,97 @@
+﻿/**
+ *	@file	unit_test_random_generate_canonical.cpp
+ *
+ *	@brief	generate_canonical のテスト
+ */
+
+#include <hamon/random/generate_canonical.hpp>
+#include <hamon/random/engines/xorshift.hpp>
+#include <hamon/random/engines/xoshiro.hpp>
+#include <hamon/cstdint/uint32_t.hpp>
+#include <hamon/cstdint/uint64_t.hpp>
+#include <hamon/limits.hpp>
+#include <gtest/gtest.h>
+#include <random>
+#include "constexpr_test.hpp"
+
+namespace hamon_random_test
+{
+
+namespace generate_canonical_test
+{
+
+// 決まった値を返すエンジン
+template <typename UInt>
+struct fixed_engine
+{
+	using result_type = UInt;
+	static constexpr result_type min() { return 0; }
+	static constexpr result_type max() { return hamon::numeric_limits<UInt>::max(); }
+	HAMON_CXX14_CONSTEXPR result_type operator()() { return m_value; }
+	result_type m_value;
+};
+
+template <typename RealType, hamon::size_t Bits, typename UInt>
+HAMON_CXX14_CONSTEXPR RealType canonical(UInt x)
+{
+	fixed_engine<UInt> g{x};
+	return hamon::generate_canonical<RealType, Bits>(g);
+}
+
+GTEST_TEST(GenerateCanonicalTest, FixedTest)
+{
+	using u32 = hamon::uint32_t;
+	using u64 = hamon::uint64_t;
+
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE((canonical<double, 53>(u64(0)) == 0.0));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE((canonical<double, 53>(u64(1) << 63) == 0.5));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE((canonical<double, 53>(~u64(0)) == 1.0 - 1.0 / 9007199254740992.0));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE((canonical<double, 64>(~u64(0)) == 1.0 - 1.0 / 9007199254740992.0));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE((canonical<double, 1>(~u64(0)) == 0.5));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE((canonical<double, 0>(~u64(0)) == 0.5));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE((canonical<float, 24>(~u32(0)) == 1.0f - 1.0f / 16777216.0f));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE((canonical<float, 32>(u32(3) << 30) == 0.75f));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE((canonical<float, 24>(~u64(0)) == 1.0f - 1.0f / 16777216.0f));
+
+	// 32bit のエンジンから 53bit を作る
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE((canonical<double, 53>(~u32(0)) == 1.0 - 1.0 / 9007199254740992.0));
+	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE((canonical<double, 53>(u32(1) << 31) == 0.5 + 0.5 / 4294967296.0));
+}
+
+template <typename RealType, hamon::size_t Bits, typename Engine>
+void range_test()
+{
+	Engine g;
+	for (int i = 0; i < 1000; ++i)
+	{
+		auto const x = hamon::generate_canonical<RealType, Bits>(g);
+		EXPECT_LE(RealType(0), x);
+		EXPECT_GT(RealType(1), x);
+	}
+}
+
+GTEST_TEST(GenerateCanonicalTest, RangeTest)
+{
+	range_test<float, 24, hamon::xoshiro256plusplus>();
+	range_test<float, 64, hamon::xorshift32>();
+	range_test<double, 53, hamon::xoshiro256plusplus>();
+	range_test<double, 10, std::mt19937>();
+	range_test<long double, 64, std::mt19937_64>();
+	range_test<double, 53, std::minstd_rand>();
+}
+
+GTEST_TEST(GenerateCanonicalTest, ReferenceTest)
+{
+	// 上位 53bit を 2^53 で割った値
+	hamon::xoshiro256plusplus g1;
+	hamon::xoshiro256plusplus g2;
+	for (int i = 0; i < 100; ++i)
+	{
+		double const expected = static_cast<double>(g2() >> 11) / 9007199254740992.0;
+		EXPECT_EQ(expected, (hamon::generate_canonical<double, 53>(g1)));
+	}
+}
+
+}	// namespace generate_canonical_test
+
+}	// namespace hamon_random_test
@@ -0,0 +1,117 @@
+﻿/**
+ *	@file	unit_test_random_generate_random.cpp
+ *
+ *	@brief	ranges::generate_random のテスト
+ */
+
+#include <hamon/random/generate_random.hpp>
+#include <hamon/random/engines/multi_lane_xoshiro.hpp>
+#include <hamon/random/engines/xoshiro.hpp>
+#include <hamon/random/engines/xorshift.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/cstdint/uint32_t.hpp>
+#include <hamon/cstdint/uint64_t.hpp>
+#include <hamon/type_traits/is_same.hpp>
+#include <hamon/vector.hpp>
+#include <gtest/gtest.h>
+#include <list>
+#include <random>
+
+namespace hamon_random_test
+{
+
+namespace generate_random_test
+{
+
+// generate を持たないエンジン
+struct counter_engine
+{
+	using result_type = hamon::uint32_t;
+	static constexpr result_type min() { return 0; }
+	static constexpr result_type max() { return 0xFFFFFFFF; }
+	result_type operator()() { return m_value++; }
+	result_type m_value = 0;
+};
+
+template <typename Engine>
+void test_engine()
+{
+	using result_type = typename Engine::result_type;
+
+	// range
+	{
+		Engine e1;
+		Engine e2;
+		hamon::vector<result_type> v(37);
+		auto it = hamon::ranges::generate_random(v, e1);
+		EXPECT_TRUE(it == v.end());
+		for (auto x : v)
+		{
+			EXPECT_EQ(e2(), x);
+		}
+		EXPECT_EQ(e2(), e1());
+	}
+
+	// iterator, sentinel
+	{
+		Engine e1;
+		Engine e2;
+		result_type a[20] {};
+		auto it = hamon::ranges::generate_random(e1, a + 1, a + 19);
+		EXPECT_TRUE(it == a + 19);
+		EXPECT_EQ(result_type(0), a[0]);
+		for (hamon::size_t i = 1; i < 19; ++i)
+		{
+			EXPECT_EQ(e2(), a[i]);
+		}
+		EXPECT_EQ(result_type(0), a[19]);
+		EXPECT_EQ(e2(), e1());
+	}
+
+	// 連続していない範囲
+	{
+		Engine e1;
+		Engine e2;
+		std::list<result_type> l(10);
+		auto it = hamon::ranges::generate_random(l, e1);
+		EXPECT_TRUE(it == l.end());
+		for (auto x : l)
+		{
+			EXPECT_EQ(e2(), x);
+		}
+	}
+
+	// 要素の型が result_type と違う範囲
+	{
+		Engine e1;
+		Engine e2;
+		hamon::vector<long double> v(5);
+		hamon::ranges::generate_random(v, e1);
+		for (auto x : v)
+		{
+			EXPECT_EQ(static_cast<long double>(e2()), x);
+		}
+	}
+}
+
+GTEST_TEST(GenerateRandomTest, EngineTest)
+{
+	test_engine<hamon::xorshift32>();
+	test_engine<hamon::xoshiro256plusplus>();
+	test_engine<hamon::xoshiro256plusplus_x4>();
+	test_engine<hamon::xoshiro256plusplus_x8>();
+	test_engine<std::mt19937>();
+	test_engine<std::mt19937_64>();
+	test_engine<counter_engine>();
+}
+
+GTEST_TEST(GenerateRandomTest, DanglingTest)
+{
+	hamon::xoshiro256plusplus e;
+	auto it = hamon::ranges::generate_random(hamon::vector<hamon::uint64_t>(3), e);
+	static_assert(hamon::is_same<decltype(it), hamon::ranges::dangling>::value, "");
+}
+
+}	// namespace generate_random_test
+
+}	// namespace hamon_random_test
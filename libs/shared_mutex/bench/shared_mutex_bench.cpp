@@ -0,0 +1,113 @@
+﻿/**
+ *	@file	shared_mutex_bench.cpp
+ *
+ *	@brief	読み手の数を増やしたときの shared_mutex のベンチマーク
+ *
+ *	読み手のスレッドが lock_shared と unlock_shared を繰り返し、
+ *	読み手の数 (1, 2, 4, ... 最大の読み手の数) ごとに1秒あたりのロックの回数を出力する。
+ *	比較のため、std::mutex で排他ロックした場合の結果も出力する。
+ *
+ *	使い方:
+ *		shared_mutex_bench [最大の読み手の数 (既定値は 64)]
+ */
+
+#include <hamon/shared_mutex.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+// std::mutex を shared_mutex と同じように使うためのラッパー
+struct ExclusiveMutex
+{
+	void lock_shared() { m_mutex.lock(); }
+	void unlock_shared() { m_mutex.unlock(); }
+
+	std::mutex m_mutex;
+};
+
+// 読み手の数が readers のときの、1秒あたりのロックの回数を返す
+template <typename Mutex>
+double run(int readers)
+{
+	Mutex mtx;
+	long long shared_value = 1;
+	std::atomic<bool> start{false};
+	std::atomic<bool> stop{false};
+	std::atomic<long long> total{0};
+	std::atomic<long long> sink{0};
+
+	std::vector<std::thread> threads;
+	for (int i = 0; i < readers; ++i)
+	{
+		threads.emplace_back([&]
+		{
+			while (!start.load(std::memory_order_acquire))
+			{
+				std::this_thread::yield();
+			}
+
+			long long count = 0;
+			long long sum = 0;
+			while (!stop.load(std::memory_order_relaxed))
+			{
+				for (int j = 0; j < 256; ++j)
+				{
+					mtx.lock_shared();
+					sum += shared_value;
+					mtx.unlock_shared();
+				}
+				count += 256;
+			}
+			total += count;
+			sink += sum;
+		});
+	}
+
+	auto const begin = Clock::now();
+	start.store(true, std::memory_order_release);
+	std::this_thread::sleep_for(std::chrono::milliseconds(300));
+	stop = true;
+
+	for (auto& t : threads)
+	{
+		t.join();
+	}
+
+	auto const seconds = std::chrono::duration<double>(Clock::now() - begin).count();
+	return static_cast<double>(total.load()) / seconds;
+}
+
+}	// namespace
+
+int main(int argc, char* argv[])
+{
+	int max_readers = 64;
+	if (argc > 1)
+	{
+		max_readers = std::atoi(argv[1]);
+	}
+	if (max_readers < 1)
+	{
+		max_readers = 1;
+	}
+
+	std::printf("hardware_concurrency: %u\n", std::thread::hardware_concurrency());
+	std::printf("%8s %24s %24s %24s\n",
+		"readers", "shared_mutex [Mlock/s]", "big_reader [Mlock/s]", "std::mutex [Mlock/s]");
+	for (int readers = 1; readers <= max_readers; readers *= 2)
+	{
+		auto const r1 = run<hamon::shared_mutex>(readers);
+		auto const r2 = run<hamon::big_reader_shared_mutex<>>(readers);
+		auto const r3 = run<ExclusiveMutex>(readers);
+		std::printf("%8d %24.2f %24.2f %24.2f\n", readers, r1 / 1e6, r2 / 1e6, r3 / 1e6);
+	}
+}
@@ -7,6 +7,7 @@
 #ifndef HAMON_SHARED_MUTEX_HPP
 #define HAMON_SHARED_MUTEX_HPP
 
+#include <hamon/shared_mutex/big_reader_shared_mutex.hpp>
 #include <hamon/shared_mutex/shared_lock.hpp>
 #include <hamon/shared_mutex/shared_mutex.hpp>
 #include <hamon/shared_mutex/shared_timed_mutex.hpp>
@@ -0,0 +1,206 @@
+﻿/**
+ *	@file	big_reader_shared_mutex.hpp
+ *
+ *	@brief	big_reader_shared_mutex の定義
+ */
+
+#ifndef HAMON_SHARED_MUTEX_BIG_READER_SHARED_MUTEX_HPP
+#define HAMON_SHARED_MUTEX_BIG_READER_SHARED_MUTEX_HPP
+
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/config.hpp>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <functional>
+
+namespace hamon
+{
+
+namespace detail
+{
+
+// 呼び出し元のスレッドに割り当てられた読み込み用スロットの番号
+inline hamon::size_t
+big_reader_thread_index()
+{
+#if defined(HAMON_HAS_CXX11_THREAD_LOCAL)
+	// スレッドごとに一度だけ割り当てることで、スロットの偏りを少なくする
+	static std::atomic<hamon::size_t> s_next{0};
+	thread_local hamon::size_t const index =
+		s_next.fetch_add(1, std::memory_order_relaxed);
+	return index;
+#else
+	return std::hash<std::thread::id>{}(std::this_thread::get_id());
+#endif
+}
+
+}	// namespace detail
+
+/**
+ *	@brief	読み込みが極端に多い場合のための shared_mutex
+ *
+ *	@tparam	SlotCount	読み込み側のカウンタの数
+ *
+ *	読み込み側の数をキャッシュラインごとに分けた SlotCount 個のカウンタで数える。
+ *	各スレッドは自分に割り当てられたカウンタだけを変更するので、
+ *	多数のスレッドが同時に lock_shared/unlock_shared を呼び出しても
+ *	同じキャッシュラインを奪い合うことがない。
+ *
+ *	その代わり、lock/try_lock は全てのカウンタを確認する必要があるため、
+ *	hamon::shared_mutex よりも遅い。
+ *	また、sizeof(big_reader_shared_mutex) は SlotCount * 64 バイト以上になる。
+ *
+ *	使用するカウンタは呼び出し元のスレッドで決まるため、
+ *	unlock_shared は lock_shared を呼び出したスレッドで呼び出す必要がある。
+ */
+template <hamon::size_t SlotCount = 64>
+class big_reader_shared_mutex
+{
+	static_assert(SlotCount > 0, "");
+
+	// 隣のカウンタと同じキャッシュラインに乗らないようにする
+	struct alignas(64) slot
+	{
+		std::atomic<unsigned> readers{0};
+	};
+
+	slot m_slots[SlotCount];
+	std::atomic<bool> m_write_entered;
+	std::mutex m_mut;
+	std::condition_variable m_gate;
+
+	static slot& this_thread_slot(slot* slots)
+	{
+		return slots[hamon::detail::big_reader_thread_index() % SlotCount];
+	}
+
+	bool has_readers() const
+	{
+		for (auto const& s : m_slots)
+		{
+			if (s.readers.load(std::memory_order_seq_cst) != 0)
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	// 読み込み側を減らした結果、書き込み側が待機しているかもしれない場合に起こす
+	void release_reader(slot& s)
+	{
+		s.readers.fetch_sub(1, std::memory_order_seq_cst);
+		if (m_write_entered.load(std::memory_order_seq_cst))
+		{
+			{
+				std::lock_guard<std::mutex> _(m_mut);
+			}
+			m_gate.notify_all();
+		}
+	}
+
+	// 自分のカウンタを増やしてから書き込み側がいないことを確認する。
+	// 書き込み側はフラグを立ててから全てのカウンタを確認するので、
+	// どちらの操作も seq_cst で行うことで、少なくとも一方が相手に気付く。
+	bool try_add_reader(slot& s)
+	{
+		s.readers.fetch_add(1, std::memory_order_seq_cst);
+		if (!m_write_entered.load(std::memory_order_seq_cst))
+		{
+			return true;
+		}
+
+		release_reader(s);
+		return false;
+	}
+
+public:
+	big_reader_shared_mutex() : m_slots(), m_write_entered(false) {}
+	~big_reader_shared_mutex() = default;
+
+	big_reader_shared_mutex(big_reader_shared_mutex const&) = delete;
+	big_reader_shared_mutex& operator=(big_reader_shared_mutex const&) = delete;
+
+	// exclusive ownership
+	void lock()		// blocking
+	{
+		std::unique_lock<std::mutex> lk(m_mut);
+
+		while (m_write_entered.load(std::memory_order_relaxed))
+		{
+			m_gate.wait(lk);
+		}
+
+		m_write_entered.store(true, std::memory_order_seq_cst);
+
+		while (has_readers())
+		{
+			m_gate.wait(lk);
+		}
+	}
+
+	bool try_lock()
+	{
+		std::unique_lock<std::mutex> lk(m_mut);
+
+		if (m_write_entered.load(std::memory_order_relaxed))
+		{
+			return false;
+		}
+
+		m_write_entered.store(true, std::memory_order_seq_cst);
+
+		if (has_readers())
+		{
+			m_write_entered.store(false, std::memory_order_relaxed);
+			lk.unlock();
+			m_gate.notify_all();
+			return false;
+		}
+
+		return true;
+	}
+
+	void unlock()
+	{
+		{
+			std::lock_guard<std::mutex> _(m_mut);
+			m_write_entered.store(false, std::memory_order_release);
+		}
+		m_gate.notify_all();
+	}
+
+	// shared ownership
+	void lock_shared()	// blocking
+	{
+		slot& s = this_thread_slot(m_slots);
+
+		// fast path
+		while (!try_add_reader(s))
+		{
+			// slow path
+			std::unique_lock<std::mutex> lk(m_mut);
+			while (m_write_entered.load(std::memory_order_relaxed))
+			{
+				m_gate.wait(lk);
+			}
+		}
+	}
+
+	bool try_lock_shared()
+	{
+		return try_add_reader(this_thread_slot(m_slots));
+	}
+
+	void unlock_shared()
+	{
+		release_reader(this_thread_slot(m_slots));
+	}
+};
+
+}	// namespace hamon
+
+#endif // HAMON_SHARED_MUTEX_BIG_READER_SHARED_MUTEX_HPP
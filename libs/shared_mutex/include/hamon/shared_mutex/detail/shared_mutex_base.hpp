@@ -8,6 +8,7 @@
 #define HAMON_SHARED_MUTEX_DETAIL_SHARED_MUTEX_BASE_HPP
 
 #include <hamon/chrono/time_point.hpp>
+#include <atomic>
 #include <mutex>
 #include <condition_variable>
 #include <climits>
@@ -18,17 +19,42 @@ namespace hamon
 namespace detail
 {
 
+// 状態は1つの atomic 変数 m_state で管理する。
+//
+// 最上位ビットは書き込み側がロックを取得中(もしくは取得待ち)であることを、
+// 残りのビットは共有ロックを取得している読み込み側の数を表す。
+//
+// 書き込み側がいない場合、lock_shared/unlock_shared は m_state への
+// 1回の read-modify-write だけで完了し、m_mut には触れない。
+// m_mut と条件変数は、書き込み側と競合したときの待機にだけ使う。
 struct shared_mutex_base
 {
 private:
 	std::mutex m_mut;
-	std::condition_variable m_gate1;
-	std::condition_variable m_gate2;
-	unsigned m_state;
+	std::condition_variable m_gate1;	// 書き込み側が抜けるのを待つ
+	std::condition_variable m_gate2;	// 読み込み側が抜けるのを待つ
+	std::atomic<unsigned> m_state;
 
 	static unsigned const kWriteEntered = 1U << (sizeof(unsigned) * CHAR_BIT - 1);
 	static unsigned const kNReaders     = ~kWriteEntered;
 
+	// 書き込み側がおらず、読み込み側の数が上限に達していなければ、読み込み側の数を1増やす
+	bool try_add_reader(unsigned& state)
+	{
+		while ((state & kWriteEntered) == 0 && (state & kNReaders) != kNReaders)
+		{
+			if (m_state.compare_exchange_weak(
+				state, state + 1,
+				std::memory_order_acquire,
+				std::memory_order_relaxed))
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
 public:
 	shared_mutex_base() : m_state(0) {}
 	~shared_mutex_base() = default;
@@ -37,18 +63,22 @@ public:
 	shared_mutex_base& operator=(shared_mutex_base const&) = delete;
 
 	// Exclusive ownership
+	//
+	// kWriteEntered を変更するのは m_mut を取得している書き込み側だけ。
+	// 読み込み側は m_mut の外で読み込み側の数を変更するため、
+	// m_state の変更は常に atomic な操作で行う。
 	void lock()	// blocking
 	{
 		std::unique_lock<std::mutex> lk(m_mut);
 
-		while (m_state & kWriteEntered)
+		while (m_state.load(std::memory_order_relaxed) & kWriteEntered)
 		{
 			m_gate1.wait(lk);
 		}
 
-		m_state |= kWriteEntered;
+		m_state.fetch_or(kWriteEntered, std::memory_order_relaxed);
 
-		while (m_state & kNReaders)
+		while (m_state.load(std::memory_order_acquire) & kNReaders)
 		{
 			m_gate2.wait(lk);
 		}
@@ -58,13 +88,11 @@ public:
 	{
 		std::unique_lock<std::mutex> lk(m_mut);
 
-		if (m_state == 0)
-		{
-			m_state = kWriteEntered;
-			return true;
-		}
-
-		return false;
+		unsigned expected = 0;
+		return m_state.compare_exchange_strong(
+			expected, kWriteEntered,
+			std::memory_order_acquire,
+			std::memory_order_relaxed);
 	}
 
 	template <typename Clock, typename Duration>
@@ -77,12 +105,12 @@ public:
 		auto const std_abs_time = std_time_point{std_duration{abs_time.time_since_epoch().count()}};
 
 		std::unique_lock<std::mutex> lk(m_mut);
-		if (m_state & kWriteEntered)
+		if (m_state.load(std::memory_order_relaxed) & kWriteEntered)
 		{
 			while (true)
 			{
 				std::cv_status status = m_gate1.wait_until(lk, std_abs_time);
-				if ((m_state & kWriteEntered) == 0)
+				if ((m_state.load(std::memory_order_relaxed) & kWriteEntered) == 0)
 				{
 					break;
 				}
@@ -94,21 +122,22 @@ public:
 			}
 		}
 
-		m_state |= kWriteEntered;
+		m_state.fetch_or(kWriteEntered, std::memory_order_relaxed);
 
-		if (m_state & kNReaders)
+		if (m_state.load(std::memory_order_acquire) & kNReaders)
 		{
 			while (true)
 			{
 				std::cv_status status = m_gate2.wait_until(lk, std_abs_time);
-				if ((m_state & kNReaders) == 0)
+				if ((m_state.load(std::memory_order_acquire) & kNReaders) == 0)
 				{
 					break;
 				}
 
 				if (status == std::cv_status::timeout)
 				{
-					m_state &= ~kWriteEntered;
+					m_state.fetch_and(~kWriteEntered, std::memory_order_relaxed);
+					lk.unlock();
 					m_gate1.notify_all();
 					return false;
 				}
@@ -122,7 +151,7 @@ public:
 	{
 		{
 			std::lock_guard<std::mutex> _(m_mut);
-			m_state = 0;
+			m_state.store(0, std::memory_order_release);
 		}
 		m_gate1.notify_all();
 	}
@@ -130,81 +159,79 @@ public:
 	// Shared ownership
 	void lock_shared() // blocking
 	{
+		// fast path
+		unsigned state = m_state.load(std::memory_order_relaxed);
+		if (try_add_reader(state))
+		{
+			return;
+		}
+
+		// slow path
 		std::unique_lock<std::mutex> lk(m_mut);
 
-		while ((m_state & kWriteEntered) || (m_state & kNReaders) == kNReaders)
+		state = m_state.load(std::memory_order_relaxed);
+		while (!try_add_reader(state))
 		{
 			m_gate1.wait(lk);
+			state = m_state.load(std::memory_order_relaxed);
 		}
-
-		unsigned num_readers = (m_state & kNReaders) + 1;
-		m_state &= ~kNReaders;
-		m_state |= num_readers;
 	}
 
 	bool try_lock_shared()
 	{
-		std::unique_lock<std::mutex> lk(m_mut);
-		unsigned num_readers = m_state & kNReaders;
-
-		if (!(m_state & kWriteEntered) && num_readers != kNReaders)
-		{
-			++num_readers;
-			m_state &= ~kNReaders;
-			m_state |= num_readers;
-			return true;
-		}
-
-		return false;
+		unsigned state = m_state.load(std::memory_order_relaxed);
+		return try_add_reader(state);
 	}
 
 	template <typename Clock, typename Duration>
 	bool try_lock_shared_until(hamon::chrono::time_point<Clock, Duration> const& abs_time)
 	{
+		// fast path
+		unsigned state = m_state.load(std::memory_order_relaxed);
+		if (try_add_reader(state))
+		{
+			return true;
+		}
+
 		// TODO hamon::chrono::time_point から std::chrono::time_point への変換を簡単にする
 		using std_period = std::ratio<Duration::period::num, Duration::period::den>;
 		using std_duration = std::chrono::duration<typename Duration::rep, std_period>;
 		using std_time_point = std::chrono::time_point<std::chrono::system_clock, std_duration>;
 		auto const std_abs_time = std_time_point{std_duration{abs_time.time_since_epoch().count()}};
 
+		// slow path
 		std::unique_lock<std::mutex> lk(m_mut);
-		if ((m_state & kWriteEntered) ||
-			(m_state & kNReaders) == kNReaders)
+
+		state = m_state.load(std::memory_order_relaxed);
+		while (!try_add_reader(state))
 		{
-			while (true)
+			std::cv_status status = m_gate1.wait_until(lk, std_abs_time);
+			state = m_state.load(std::memory_order_relaxed);
+			if (status == std::cv_status::timeout)
 			{
-				std::cv_status status = m_gate1.wait_until(lk, std_abs_time);
-				if ((m_state & kWriteEntered) == 0 &&
-					(m_state & kNReaders) < kNReaders)
-				{
-					break;
-				}
-
-				if (status == std::cv_status::timeout)
-				{
-					return false;
-				}
+				return try_add_reader(state);
 			}
 		}
 
-		unsigned num_readers = (m_state & kNReaders) + 1;
-		m_state &= ~kNReaders;
-		m_state |= num_readers;
 		return true;
 	}
 
 	void unlock_shared()
 	{
-		std::unique_lock<std::mutex> lk(m_mut);
-		unsigned num_readers = (m_state & kNReaders) - 1;
-		m_state &= ~kNReaders;
-		m_state |= num_readers;
-
-		if (m_state & kWriteEntered)
+		// fast path
+		unsigned const prev = m_state.fetch_sub(1, std::memory_order_release);
+		unsigned const num_readers = (prev & kNReaders) - 1;
+
+		// slow path
+		// 待機している側は m_mut を取得した状態で m_state を確認してから待機するので、
+		// m_mut を取得してから通知することで通知の取りこぼしを防ぐ
+		if (prev & kWriteEntered)
 		{
 			if (num_readers == 0)
 			{
-				lk.unlock();
+				{
+					std::lock_guard<std::mutex> _(m_mut);
+				}
 				m_gate2.notify_one();
 			}
 		}
@@ -212,7 +239,9 @@ public:
 		{
 			if (num_readers == kNReaders - 1)
 			{
-				lk.unlock();
+				{
+					std::lock_guard<std::mutex> _(m_mut);
+				}
 				m_gate1.notify_one();
 			}
 		}
@@ -183,6 +183,55 @@ void test_try_lock_and_try_lock_shared()
 	}
 }
 
+void test_readers_and_writers()
+{
+	// Readers never observe a half-written state.
+	hamon::shared_mutex mut;
+	int a = 0;
+	int b = 0;
+	std::atomic<bool> ok(true);
+	hamon::vector<std::thread> threads;
+
+	for (int i = 0; i < 2; ++i)
+	{
+		threads.emplace_back([&]
+		{
+			for (int j = 0; j < 1000; ++j)
+			{
+				mut.lock();
+				++a;
+				++b;
+				mut.unlock();
+			}
+		});
+	}
+
+	for (int i = 0; i < 4; ++i)
+	{
+		threads.emplace_back([&]
+		{
+			for (int j = 0; j < 1000; ++j)
+			{
+				mut.lock_shared();
+				if (a != b)
+				{
+					ok = false;
+				}
+				mut.unlock_shared();
+			}
+		});
+	}
+
+	for (auto& t : threads)
+	{
+		t.join();
+	}
+
+	EXPECT_TRUE(ok);
+	EXPECT_EQ(2000, a);
+	EXPECT_EQ(2000, b);
+}
+
 GTEST_TEST(SharedMutexTest, SharedMutexTest)
 {
 	test_one_writer();
@@ -190,6 +239,7 @@ GTEST_TEST(SharedMutexTest, SharedMutexTest)
 	test_writer_blocking_readers();
 	test_readers_blocking_writer();
 	test_try_lock_and_try_lock_shared();
+	test_readers_and_writers();
 }
 
 }	// namespace shared_mutex_test
@@ -0,0 +1,86 @@
+﻿/**
+ *	@file	string_append_bench.cpp
+ *
+ *	@brief	basic_string に少しずつ追加していく場合のベンチマーク
+ *
+ *	空の文字列に push_back で1文字ずつ、または append で16文字ずつ追加していき、
+ *	最終的な長さ (1KiB, 4KiB, ... 最大の長さ) ごとに1バイトあたりの時間を出力する。
+ *	追加が償却 O(1) であれば、1バイトあたりの時間は長さに関係なくほぼ一定になる。
+ *	比較のため、std::string の結果も出力する。
+ *
+ *	使い方:
+ *		string_append_bench [最大の長さ (MiB 単位、既定値は 1024)]
+ */
+
+#include <hamon/string.hpp>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+// 長さが n になるまで push_back したときの、1バイトあたりの時間 [ns] を返す
+template <typename String>
+double run_push_back(std::size_t n)
+{
+	auto const start = Clock::now();
+	String s;
+	for (std::size_t i = 0; i < n; ++i)
+	{
+		s.push_back(static_cast<char>('a' + (i % 26)));
+	}
+	auto const end = Clock::now();
+	if (s.size() != n)
+	{
+		std::abort();
+	}
+	return std::chrono::duration<double, std::nano>(end - start).count() / static_cast<double>(n);
+}
+
+// 長さが n になるまで16文字ずつ append したときの、1バイトあたりの時間 [ns] を返す
+template <typename String>
+double run_append(std::size_t n)
+{
+	static char const token[] = "0123456789abcdef";
+	auto const start = Clock::now();
+	String s;
+	for (std::size_t i = 0; i < n; i += 16)
+	{
+		s.append(token, 16);
+	}
+	auto const end = Clock::now();
+	if (s.size() < n)
+	{
+		std::abort();
+	}
+	return std::chrono::duration<double, std::nano>(end - start).count() / static_cast<double>(n);
+}
+
+}	// namespace
+
+int main(int argc, char* argv[])
+{
+	std::size_t max_mib = 1024;
+	if (argc > 1)
+	{
+		max_mib = static_cast<std::size_t>(std::atoll(argv[1]));
+	}
+	std::size_t const max_size = max_mib * 1024 * 1024;
+
+	std::printf("%12s %22s %22s %22s %22s\n", "size [KiB]",
+		"hamon push_back [ns/B]", "std push_back [ns/B]",
+		"hamon append [ns/B]", "std append [ns/B]");
+	for (std::size_t n = 1024; n <= max_size; n *= 4)
+	{
+		auto const r1 = run_push_back<hamon::string>(n);
+		auto const r2 = run_push_back<std::string>(n);
+		auto const r3 = run_append<hamon::string>(n);
+		auto const r4 = run_append<std::string>(n);
+		std::printf("%12zu %22.3f %22.3f %22.3f %22.3f\n", n / 1024, r1, r2, r3, r4);
+	}
+}
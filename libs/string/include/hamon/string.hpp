@@ -13,7 +13,9 @@
 #include <hamon/string/erase.hpp>
 #include <hamon/string/erase_if.hpp>
 #include <hamon/string/getline.hpp>
+#include <hamon/string/rope.hpp>
 #include <hamon/string/string.hpp>
+#include <hamon/string/string_builder.hpp>
 #include <hamon/string/to_string.hpp>
 #include <hamon/string/to_wstring.hpp>
 #include <hamon/string/u8string.hpp>
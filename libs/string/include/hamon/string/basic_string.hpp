@@ -27,12 +27,14 @@ using std::basic_string;
 #include <hamon/string/char_traits.hpp>
 #include <hamon/string/detail/is_allocator.hpp>
 #include <hamon/string_view.hpp>
+#include <hamon/algorithm/max.hpp>
 #include <hamon/algorithm/min.hpp>
 #include <hamon/bit/bitsof.hpp>
 #include <hamon/concepts/detail/constrained_param.hpp>
 #include <hamon/cstddef/nullptr_t.hpp>
 #include <hamon/cstddef/size_t.hpp>
 #include <hamon/detail/overload_priority.hpp>
+#include <hamon/functional/less.hpp>
 #include <hamon/iterator/concepts/sized_sentinel_for.hpp>
 #include <hamon/iterator/detail/is_integer_like.hpp>
 #include <hamon/iterator/detail/cpp17_input_iterator.hpp>
@@ -276,6 +278,107 @@ private:
 	HAMON_NO_UNIQUE_ADDRESS	allocator_type m_allocator;
 	Rep	m_rep;
 
+	// new_size 文字を格納するために確保する要素数(終端文字を含む)を返す。
+	//
+	// 容量を指数的に大きくすることによって、append や push_back を繰り返したときに
+	// 償却定数時間になる。(vector_impl::GrowCapacity と同じく1.5倍)
+	HAMON_CXX14_CONSTEXPR size_type
+	GrowCapacity(size_type new_size) const
+	{
+		auto const requested = new_size + 1;
+		auto const cap = m_rep.GetCapacity();
+		if (cap >= this->max_size() - cap / 2)
+		{
+			return requested;
+		}
+		return hamon::max(static_cast<size_type>(cap + cap / 2), requested);
+	}
+
+	// s が自身の文字列を指している可能性があるかどうか
+	HAMON_CXX14_CONSTEXPR bool
+	IsInside(CharT const* s) const HAMON_NOEXCEPT
+	{
+#if defined(HAMON_HAS_CXX20_IS_CONSTANT_EVALUATED)
+		if (hamon::is_constant_evaluated())
+		{
+			// 定数評価中は無関係なポインタ同士を比較できないので、
+			// 常に重なっているものとして扱う
+			return true;
+		}
+#endif
+		auto const first = this->data();
+		auto const last = first + this->size();
+		return !hamon::less<CharT const*>{}(s, first) && !hamon::less<CharT const*>{}(last, s);
+	}
+
+	struct CopyChars
+	{
+		CharT const* m_s;
+
+		HAMON_CXX14_CONSTEXPR void
+		operator()(pointer p, size_type n) const
+		{
+			Traits::copy(p, m_s, n);
+		}
+	};
+
+	struct AssignChars
+	{
+		CharT m_c;
+
+		HAMON_CXX14_CONSTEXPR void
+		operator()(pointer p, size_type n) const
+		{
+			Traits::assign(p, n, m_c);
+		}
+	};
+
+	// [pos, pos + n1) を n2 文字で置き換える。
+	// fill(p, n2) は p に n2 文字を書き込む。
+	//
+	// 容量が足りないとき、または reallocate が true のときは新しいメモリを確保する。
+	// 以前のメモリは fill を呼び出した後で解放されるので、fill は自身の文字列を読み込んでもよい。
+	//
+	// resize_and_overwrite を使わないのは次の理由による。
+	// ・resize_and_overwrite は容量が足りないときに reserve で全体をコピーしてから op を呼ぶので、
+	//   途中に挿入すると後ろの部分をもう一度ずらすことになる。ここでは各部分を1回コピーするだけで済む。
+	// ・reserve は op を呼ぶ前に以前のメモリを解放するので、自身の文字列を読み込む fill を扱えない。
+	// 容量の増やし方 (GrowCapacity) は resize_and_overwrite と共通にしている。
+	template <typename Fill>
+	HAMON_CXX14_CONSTEXPR void
+	ReplaceImpl(size_type pos, size_type n1, size_type n2, Fill fill, bool reallocate = false)
+	{
+		auto const old_size = this->size();
+		auto const new_size = old_size - n1 + n2;
+		auto const tail = old_size - pos - n1;
+		auto const cap = m_rep.GetCapacity();
+
+		if (reallocate || new_size + 1 > cap)
+		{
+			Rep new_one{};
+			new_one.Allocate(m_allocator, new_size + 1 > cap ? GrowCapacity(new_size) : cap);
+			auto const dst = new_one.GetData();
+			auto const src = m_rep.GetData();
+			Traits::copy(dst, src, pos);
+			fill(dst + pos, n2);
+			Traits::copy(dst + pos + n2, src + pos + n1, tail);
+			hamon::swap(new_one, m_rep);
+			new_one.Deallocate(m_allocator);
+		}
+		else
+		{
+			auto const p = m_rep.GetData();
+			if (n1 != n2)
+			{
+				Traits::move(p + pos + n2, p + pos + n1, tail);
+			}
+			fill(p + pos, n2);
+		}
+
+		m_rep.SetSize(new_size);
+		m_rep.NullTerminate();
+	}
+
 public:
 	// 23.4.3.3		[string.cons], construct/copy/destroy
 	HAMON_CXX11_CONSTEXPR
@@ -775,7 +878,12 @@ public:
 	HAMON_CXX14_CONSTEXPR void
 	resize_and_overwrite(size_type n, Operation op)
 	{
-		reserve(n + 1);
+		if (n + 1 > capacity())
+		{
+			// 少しずつ大きくしながら呼び出されても償却定数時間になるように、
+			// reserve と違って容量を指数的に増やす
+			reserve(GrowCapacity(n));
+		}
 		auto p = data();
 		size_type const m = n;			// [string.capacity]/7.4
 		auto r = hamon::move(op)(p, m);	// [string.capacity]/7.5, 7.6
@@ -1001,24 +1109,8 @@ HAMON_WARNING_POP()
 		// [string.append]/8
 		if (n != 0)
 		{
-			auto const cur_size = this->size();
-			auto const new_size = cur_size + n;
-			auto const new_capacity = new_size + 1;
-			if (new_capacity > m_rep.GetCapacity())
-			{
-				Rep new_one{};
-				new_one.Allocate(m_allocator, new_capacity);
-				Traits::copy(new_one.GetData(), m_rep.GetData(), m_rep.GetSize());
-				Traits::copy(new_one.GetData() + cur_size, s, n);
-				hamon::swap(new_one, m_rep);
-				new_one.Deallocate(m_allocator);
-			}
-			else
-			{
-				Traits::copy(m_rep.GetData() + cur_size, s, n);
-			}
-			m_rep.SetSize(new_size);
-			m_rep.NullTerminate();
+			// 追加する領域は既存の文字列と重ならないので、s が自身を指していても再確保は不要
+			ReplaceImpl(this->size(), 0, n, CopyChars{s});
 		}
 
 		// [string.append]/9
@@ -1038,24 +1130,7 @@ HAMON_WARNING_POP()
 		// [string.append]/11
 		if (n != 0)
 		{
-			auto const cur_size = this->size();
-			auto const new_size = cur_size + n;
-			auto const new_capacity = new_size + 1;
-			if (new_capacity > m_rep.GetCapacity())
-			{
-				Rep new_one{};
-				new_one.Allocate(m_allocator, new_capacity);
-				Traits::copy(new_one.GetData(), m_rep.GetData(), m_rep.GetSize());
-				Traits::assign(new_one.GetData() + cur_size, n, c);
-				hamon::swap(new_one, m_rep);
-				new_one.Deallocate(m_allocator);
-			}
-			else
-			{
-				Traits::assign(m_rep.GetData() + cur_size, n, c);
-			}
-			m_rep.SetSize(new_size);
-			m_rep.NullTerminate();
+			ReplaceImpl(this->size(), 0, n, AssignChars{c});
 		}
 
 		// [string.append]/12
@@ -1089,7 +1164,17 @@ HAMON_WARNING_POP()
 	push_back(CharT c)
 	{
 		// [string.append]/17
-		append(size_type{1}, c);
+		auto const sz = this->size();
+		if (sz + 1 < m_rep.GetCapacity())
+		{
+			Traits::assign(m_rep.GetData()[sz], c);
+			m_rep.SetSize(sz + 1);
+			m_rep.NullTerminate();
+		}
+		else
+		{
+			append(size_type{1}, c);
+		}
 	}
 
 	// 23.4.3.7.3	[string.assign]
@@ -1252,27 +1337,8 @@ HAMON_WARNING_POP()
 		// [string.insert]/8
 		if (n != 0)
 		{
-			auto const new_size = this->size() + n;
-			auto const new_capacity = new_size + 1;
-			//if (new_capacity > m_rep.GetCapacity())
-			{
-				Rep new_one{};
-				new_one.Allocate(m_allocator, new_capacity);
-				Traits::copy(new_one.GetData(), m_rep.GetData(), pos);
-				Traits::copy(new_one.GetData() + pos, s, n);
-				Traits::copy(new_one.GetData() + pos + n, m_rep.GetData() + pos, m_rep.GetSize() - pos);
-				hamon::swap(new_one, m_rep);
-				new_one.Deallocate(m_allocator);
-			}
-			// TODO
-			/*else
-			{
-				auto p = m_rep.GetData();
-				Traits::move(p + pos + n, p + pos, m_rep.GetSize() - pos);
-				Traits::move(p + pos, s, n);
-			}*/
-			m_rep.SetSize(new_size);
-			m_rep.NullTerminate();
+			// s が自身を指している場合は、移動によって s の指す文字が変わってしまうので再確保する
+			ReplaceImpl(pos, 0, n, CopyChars{s}, IsInside(s));
 		}
 
 		// [string.insert]/9
@@ -1304,25 +1370,7 @@ HAMON_WARNING_POP()
 		// [string.insert]/12
 		if (n != 0)
 		{
-			auto const new_size = this->size() + n;
-			auto const new_capacity = new_size + 1;
-			if (new_capacity > m_rep.GetCapacity())
-			{
-				Rep new_one{};
-				new_one.Allocate(m_allocator, new_capacity);
-				Traits::copy(new_one.GetData(), m_rep.GetData(), pos);
-				Traits::assign(new_one.GetData() + pos, n, c);
-				Traits::copy(new_one.GetData() + pos + n, m_rep.GetData() + pos, m_rep.GetSize() - pos);
-				hamon::swap(new_one, m_rep);
-				new_one.Deallocate(m_allocator);
-			}
-			else
-			{
-				Traits::move(m_rep.GetData() + pos + n, m_rep.GetData() + pos, m_rep.GetSize() - pos);
-				Traits::assign(m_rep.GetData() + pos, n, c);
-			}
-			m_rep.SetSize(new_size);
-			m_rep.NullTerminate();
+			ReplaceImpl(pos, 0, n, AssignChars{c});
 		}
 
 		// [string.insert]/13
@@ -1488,26 +1536,8 @@ HAMON_WARNING_POP()
 		}
 
 		// [string.replace]/8
-		auto const new_size = this->size() - xlen + n2;
-		auto const new_capacity = new_size + 1;
-		//if (new_capacity > m_rep.GetCapacity())
-		{
-			Rep new_one{};
-			new_one.Allocate(m_allocator, new_capacity);
-			Traits::copy(new_one.GetData(), m_rep.GetData(), pos1);
-			Traits::copy(new_one.GetData() + pos1, s, n2);
-			Traits::copy(new_one.GetData() + pos1 + n2, m_rep.GetData() + pos1 + xlen, m_rep.GetSize() - pos1 - xlen);
-			hamon::swap(new_one, m_rep);
-			new_one.Deallocate(m_allocator);
-		}
-		// TODO
-		//else
-		//{
-		//	Traits::move(m_rep.GetData() + pos1 + n2, m_rep.GetData() + pos1 + xlen, m_rep.GetSize() - pos1 - xlen);
-		//	Traits::move(m_rep.GetData() + pos1, s, n2);
-		//}
-		m_rep.SetSize(new_size);
-		m_rep.NullTerminate();
+		// s が自身を指している場合は、移動によって s の指す文字が変わってしまうので再確保する
+		ReplaceImpl(pos1, xlen, n2, CopyChars{s}, IsInside(s));
 
 		// [string.replace]/9
 		return *this;
@@ -1538,25 +1568,7 @@ HAMON_WARNING_POP()
 		}
 
 		// [string.replace]/12
-		auto const new_size = this->size() - xlen + n2;
-		auto const new_capacity = new_size + 1;
-		if (new_capacity > m_rep.GetCapacity())
-		{
-			Rep new_one{};
-			new_one.Allocate(m_allocator, new_capacity);
-			Traits::copy(new_one.GetData(), m_rep.GetData(), pos1);
-			Traits::assign(new_one.GetData() + pos1, n2, c);
-			Traits::copy(new_one.GetData() + pos1 + n2, m_rep.GetData() + pos1 + xlen, m_rep.GetSize() - pos1 - xlen);
-			hamon::swap(new_one, m_rep);
-			new_one.Deallocate(m_allocator);
-		}
-		else
-		{
-			Traits::move(m_rep.GetData() + pos1 + n2, m_rep.GetData() + pos1 + xlen, m_rep.GetSize() - pos1 - xlen);
-			Traits::assign(m_rep.GetData() + pos1, n2, c);
-		}
-		m_rep.SetSize(new_size);
-		m_rep.NullTerminate();
+		ReplaceImpl(pos1, xlen, n2, AssignChars{c});
 
 		// [string.replace]/13
 		return *this;
@@ -0,0 +1,698 @@
+﻿/**
+ *	@file	rope.hpp
+ *
+ *	@brief	basic_rope の定義
+ */
+
+#ifndef HAMON_STRING_ROPE_HPP
+#define HAMON_STRING_ROPE_HPP
+
+#include <hamon/string/basic_string.hpp>
+#include <hamon/string/char_traits.hpp>
+#include <hamon/string_view/basic_string_view.hpp>
+#include <hamon/algorithm/max.hpp>
+#include <hamon/algorithm/min.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/cstdint/uint32_t.hpp>
+#include <hamon/detail/exception_guard.hpp>
+#include <hamon/memory/allocator.hpp>
+#include <hamon/memory/allocator_traits.hpp>
+#include <hamon/stdexcept/out_of_range.hpp>
+#include <hamon/utility/exchange.hpp>
+#include <hamon/utility/swap.hpp>
+#include <hamon/assert.hpp>
+#include <hamon/config.hpp>
+#include <ostream>
+
+namespace hamon
+{
+
+/**
+ *	@brief	途中への挿入や削除が O(log n) で行える文字列
+ *
+ *	文字列を kLeafSize 文字以下の断片に分け、断片を要素とする平衡二分木(Treap)で管理する。
+ *	各ノードは部分木の文字数を持っているので、位置を指定した操作は木の高さに比例する時間で行える。
+ *
+ *	- insert / erase / operator[] : 期待値 O(log n)
+ *	- append                      : 期待値 O(log n) (追加する文字数に比例する時間を除く)
+ *	- str / copy                  : O(n)
+ */
+template <
+	typename CharT,
+	typename Traits = hamon::char_traits<CharT>,
+	typename Allocator = hamon::allocator<CharT>>
+class basic_rope
+{
+public:
+	using traits_type      = Traits;
+	using value_type       = CharT;
+	using allocator_type   = Allocator;
+	using size_type        = typename hamon::allocator_traits<Allocator>::size_type;
+	using string_type      = hamon::basic_string<CharT, Traits, Allocator>;
+	using string_view_type = hamon::basic_string_view<CharT, Traits>;
+
+	static HAMON_CXX11_CONSTEXPR size_type npos = size_type(-1);
+
+private:
+	// 1つのノードが持つ文字数の上限
+	static HAMON_CXX11_CONSTEXPR size_type kLeafSize = 256 / sizeof(CharT);
+
+	struct Node
+	{
+		Node*				left;
+		Node*				right;
+		size_type			total;		// 部分木全体の文字数
+		size_type			size;		// このノードの文字数
+		hamon::uint32_t		priority;
+		CharT				data[kLeafSize];
+	};
+
+	using NodeAllocator  = typename hamon::allocator_traits<Allocator>::template rebind_alloc<Node>;
+	using NodeAllocTraits = hamon::allocator_traits<NodeAllocator>;
+
+	HAMON_NO_UNIQUE_ADDRESS	NodeAllocator m_allocator;
+	Node*			m_root = nullptr;
+	hamon::uint32_t	m_seed = 2463534242u;
+
+	static size_type Total(Node const* t) HAMON_NOEXCEPT
+	{
+		return t == nullptr ? 0 : t->total;
+	}
+
+	static void Update(Node* t) HAMON_NOEXCEPT
+	{
+		t->total = Total(t->left) + t->size + Total(t->right);
+	}
+
+	// xorshift32
+	hamon::uint32_t NextPriority() HAMON_NOEXCEPT
+	{
+		m_seed ^= m_seed << 13;
+		m_seed ^= m_seed >> 17;
+		m_seed ^= m_seed << 5;
+		return m_seed;
+	}
+
+	Node* NewNode(CharT const* s, size_type n)
+	{
+		HAMON_ASSERT(n <= kLeafSize);
+		Node* t = NodeAllocTraits::allocate(m_allocator, 1);
+		t->left     = nullptr;
+		t->right    = nullptr;
+		t->total    = n;
+		t->size     = n;
+		t->priority = NextPriority();
+		Traits::copy(t->data, s, n);
+		return t;
+	}
+
+	void DeleteNode(Node* t) HAMON_NOEXCEPT
+	{
+		NodeAllocTraits::deallocate(m_allocator, t, 1);
+	}
+
+	void DestroyTree(Node* t) HAMON_NOEXCEPT
+	{
+		while (t != nullptr)
+		{
+			DestroyTree(t->left);
+			Node* right = t->right;
+			DeleteNode(t);
+			t = right;
+		}
+	}
+
+	static Node* Merge(Node* a, Node* b) HAMON_NOEXCEPT
+	{
+		if (a == nullptr)
+		{
+			return b;
+		}
+
+		if (b == nullptr)
+		{
+			return a;
+		}
+
+		if (a->priority > b->priority)
+		{
+			a->right = Merge(a->right, b);
+			Update(a);
+			return a;
+		}
+		else
+		{
+			b->left = Merge(a, b->left);
+			Update(b);
+			return b;
+		}
+	}
+
+	// t を先頭から pos 文字の l と残りの r に分ける。
+	// ノードの途中で分ける場合は新しいノードを確保する。
+	// 例外が投げられた場合、t は変更されない。
+	void Split(Node* t, size_type pos, Node*& l, Node*& r)
+	{
+		if (t == nullptr)
+		{
+			l = nullptr;
+			r = nullptr;
+			return;
+		}
+
+		auto const ls = Total(t->left);
+		if (pos <= ls)
+		{
+			Split(t->left, pos, l, t->left);
+			Update(t);
+			r = t;
+		}
+		else if (pos >= ls + t->size)
+		{
+			Split(t->right, pos - ls - t->size, t->right, r);
+			Update(t);
+			l = t;
+		}
+		else
+		{
+			auto const k = pos - ls;
+			Node* tail = NewNode(t->data + k, t->size - k);
+			t->size = k;
+			r = Merge(tail, t->right);
+			t->right = nullptr;
+			Update(t);
+			l = t;
+		}
+	}
+
+	// s から n 文字を持つ木を作る
+	Node* Build(CharT const* s, size_type n)
+	{
+		Node* result = nullptr;
+		auto gd = hamon::detail::make_exception_guard([&]() noexcept
+		{
+			DestroyTree(result);
+		});
+
+		while (n != 0)
+		{
+			auto const k = hamon::min(n, kLeafSize);
+			result = Merge(result, NewNode(s, k));
+			s += k;
+			n -= k;
+		}
+
+		gd.complete();
+		return result;
+	}
+
+	Node* CloneTree(Node const* t)
+	{
+		if (t == nullptr)
+		{
+			return nullptr;
+		}
+
+		Node* result = NewNode(t->data, t->size);
+		result->priority = t->priority;
+		auto gd = hamon::detail::make_exception_guard([&]() noexcept
+		{
+			DestroyTree(result);
+		});
+		result->left  = CloneTree(t->left);
+		result->right = CloneTree(t->right);
+		result->total = t->total;
+		gd.complete();
+		return result;
+	}
+
+	// pos を含むノードに空きがあれば、木の形を変えずにそのノードへ挿入する
+	static bool InsertInPlace(Node* t, size_type pos, CharT const* s, size_type n) HAMON_NOEXCEPT
+	{
+		if (t == nullptr)
+		{
+			return false;
+		}
+
+		auto const ls = Total(t->left);
+		bool inserted = false;
+		if (pos < ls)
+		{
+			inserted = InsertInPlace(t->left, pos, s, n);
+		}
+		else if (pos <= ls + t->size)
+		{
+			if (t->size + n <= kLeafSize)
+			{
+				auto const k = pos - ls;
+				Traits::move(t->data + k + n, t->data + k, t->size - k);
+				Traits::copy(t->data + k, s, n);
+				t->size += n;
+				inserted = true;
+			}
+		}
+		else
+		{
+			inserted = InsertInPlace(t->right, pos - ls - t->size, s, n);
+		}
+
+		if (inserted)
+		{
+			t->total += n;
+		}
+		return inserted;
+	}
+
+	// t の [pos, pos + n) を削除する。メモリの確保は行わない。
+	Node* EraseImpl(Node* t, size_type pos, size_type n) HAMON_NOEXCEPT
+	{
+		if (t == nullptr || n == 0)
+		{
+			return t;
+		}
+
+		if (pos == 0 && n >= t->total)
+		{
+			DestroyTree(t);
+			return nullptr;
+		}
+
+		auto const first = pos;
+		auto const last  = pos + n;
+		auto const ls = Total(t->left);
+		auto const le = ls + t->size;
+
+		if (first < ls)
+		{
+			t->left = EraseImpl(t->left, first, hamon::min(last, ls) - first);
+		}
+
+		if (first < le && last > ls)
+		{
+			auto const b = hamon::max(first, ls) - ls;
+			auto const e = hamon::min(last, le) - ls;
+			Traits::move(t->data + b, t->data + e, t->size - e);
+			t->size -= e - b;
+		}
+
+		if (last > le)
+		{
+			auto const b = hamon::max(first, le);
+			t->right = EraseImpl(t->right, b - le, last - b);
+		}
+
+		if (t->size == 0)
+		{
+			Node* result = Merge(t->left, t->right);
+			DeleteNode(t);
+			return result;
+		}
+
+		Update(t);
+		return t;
+	}
+
+	template <typename F>
+	static void ForEachChunk(Node const* t, F& f)
+	{
+		while (t != nullptr)
+		{
+			ForEachChunk(t->left, f);
+			f(string_view_type(t->data, t->size));
+			t = t->right;
+		}
+	}
+
+	// [pos, pos + n) の部分を順番に f に渡す
+	template <typename F>
+	static void ForEachChunk(Node const* t, size_type pos, size_type n, F& f)
+	{
+		while (t != nullptr && n != 0)
+		{
+			auto const ls = Total(t->left);
+			if (pos < ls)
+			{
+				auto const k = hamon::min(n, ls - pos);
+				ForEachChunk(t->left, pos, k, f);
+				pos += k;
+				n -= k;
+			}
+
+			if (n != 0 && pos < ls + t->size)
+			{
+				auto const b = pos - ls;
+				auto const k = hamon::min(n, t->size - b);
+				f(string_view_type(t->data + b, k));
+				pos += k;
+				n -= k;
+			}
+
+			pos -= ls + t->size;
+			t = t->right;
+		}
+	}
+
+public:
+	basic_rope() = default;
+
+	explicit basic_rope(Allocator const& a) HAMON_NOEXCEPT
+		: m_allocator(a)
+	{}
+
+	explicit basic_rope(string_view_type sv, Allocator const& a = Allocator())
+		: m_allocator(a)
+	{
+		m_root = Build(sv.data(), sv.size());
+	}
+
+	explicit basic_rope(CharT const* s, Allocator const& a = Allocator())
+		: basic_rope(string_view_type(s), a)
+	{}
+
+	basic_rope(basic_rope const& x)
+		: m_allocator(NodeAllocTraits::select_on_container_copy_construction(x.m_allocator))
+		, m_seed(x.m_seed)
+	{
+		m_root = CloneTree(x.m_root);
+	}
+
+	basic_rope(basic_rope&& x) HAMON_NOEXCEPT
+		: m_allocator(x.m_allocator)
+		, m_root(hamon::exchange(x.m_root, nullptr))
+		, m_seed(x.m_seed)
+	{}
+
+	basic_rope& operator=(basic_rope const& x)
+	{
+		if (this != &x)
+		{
+			basic_rope tmp(x);
+			this->swap(tmp);
+		}
+		return *this;
+	}
+
+	basic_rope& operator=(basic_rope&& x) HAMON_NOEXCEPT
+	{
+		if (this != &x)
+		{
+			this->clear();
+			m_allocator = x.m_allocator;
+			m_root = hamon::exchange(x.m_root, nullptr);
+			m_seed = x.m_seed;
+		}
+		return *this;
+	}
+
+	~basic_rope()
+	{
+		this->clear();
+	}
+
+	allocator_type get_allocator() const HAMON_NOEXCEPT
+	{
+		return allocator_type(m_allocator);
+	}
+
+	size_type size() const HAMON_NOEXCEPT
+	{
+		return Total(m_root);
+	}
+
+	size_type length() const HAMON_NOEXCEPT
+	{
+		return this->size();
+	}
+
+	bool empty() const HAMON_NOEXCEPT
+	{
+		return m_root == nullptr;
+	}
+
+	void clear() HAMON_NOEXCEPT
+	{
+		DestroyTree(m_root);
+		m_root = nullptr;
+	}
+
+	CharT operator[](size_type pos) const HAMON_NOEXCEPT
+	{
+		HAMON_ASSERT(pos < this->size());
+
+		Node const* t = m_root;
+		for (;;)
+		{
+			auto const ls = Total(t->left);
+			if (pos < ls)
+			{
+				t = t->left;
+			}
+			else if (pos < ls + t->size)
+			{
+				return t->data[pos - ls];
+			}
+			else
+			{
+				pos -= ls + t->size;
+				t = t->right;
+			}
+		}
+	}
+
+	CharT at(size_type pos) const
+	{
+		if (pos >= this->size())
+		{
+			hamon::detail::throw_out_of_range("basic_rope::at");
+		}
+
+		return (*this)[pos];
+	}
+
+	/**
+	 *	@brief	pos の位置に sv を挿入する
+	 *
+	 *	sv は *this の中身を参照していてはいけない。
+	 */
+	basic_rope& insert(size_type pos, string_view_type sv)
+	{
+		if (pos > this->size())
+		{
+			hamon::detail::throw_out_of_range("basic_rope::insert");
+		}
+
+		if (sv.empty())
+		{
+			return *this;
+		}
+
+		if (InsertInPlace(m_root, pos, sv.data(), sv.size()))
+		{
+			return *this;
+		}
+
+		Node* l;
+		Node* r;
+		Split(m_root, pos, l, r);
+
+		Node* mid = nullptr;
+		{
+			auto gd = hamon::detail::make_exception_guard([&]() noexcept
+			{
+				m_root = Merge(l, r);
+			});
+			mid = Build(sv.data(), sv.size());
+			gd.complete();
+		}
+
+		m_root = Merge(Merge(l, mid), r);
+		return *this;
+	}
+
+	basic_rope& insert(size_type pos, basic_rope const& r)
+	{
+		// r の中身を一旦文字列にして挿入する
+		return this->insert(pos, string_view_type(r.str()));
+	}
+
+	basic_rope& append(string_view_type sv)
+	{
+		return this->insert(this->size(), sv);
+	}
+
+	basic_rope& operator+=(string_view_type sv)
+	{
+		return this->append(sv);
+	}
+
+	void push_back(CharT c)
+	{
+		this->append(string_view_type(&c, 1));
+	}
+
+	/**
+	 *	@brief	[pos, pos + n) を削除する
+	 *
+	 *	削除のためにメモリを確保することはない。
+	 */
+	basic_rope& erase(size_type pos = 0, size_type n = npos)
+	{
+		auto const sz = this->size();
+		if (pos > sz)
+		{
+			hamon::detail::throw_out_of_range("basic_rope::erase");
+		}
+
+		m_root = EraseImpl(m_root, pos, hamon::min(n, sz - pos));
+		return *this;
+	}
+
+	/**
+	 *	@brief	各断片を順番に f(string_view_type) に渡す
+	 */
+	template <typename F>
+	void for_each_chunk(F f) const
+	{
+		ForEachChunk(m_root, f);
+	}
+
+	/**
+	 *	@brief	[pos, pos + n) の部分を順番に f(string_view_type) に渡す
+	 */
+	template <typename F>
+	void for_each_chunk(size_type pos, size_type n, F f) const
+	{
+		auto const sz = this->size();
+		if (pos > sz)
+		{
+			hamon::detail::throw_out_of_range("basic_rope::for_each_chunk");
+		}
+
+		ForEachChunk(m_root, pos, hamon::min(n, sz - pos), f);
+	}
+
+	size_type copy(CharT* dest, size_type n, size_type pos = 0) const
+	{
+		auto const sz = this->size();
+		if (pos > sz)
+		{
+			hamon::detail::throw_out_of_range("basic_rope::copy");
+		}
+
+		auto const rlen = hamon::min(n, sz - pos);
+		this->for_each_chunk(pos, rlen, [&dest](string_view_type sv)
+		{
+			Traits::copy(dest, sv.data(), sv.size());
+			dest += sv.size();
+		});
+		return rlen;
+	}
+
+	string_type substr(size_type pos = 0, size_type n = npos) const
+	{
+		auto const sz = this->size();
+		if (pos > sz)
+		{
+			hamon::detail::throw_out_of_range("basic_rope::substr");
+		}
+
+		auto const rlen = hamon::min(n, sz - pos);
+		string_type result(this->get_allocator());
+		result.resize_and_overwrite(rlen, [this, pos](CharT* p, size_type k)
+		{
+			return this->copy(p, k, pos);
+		});
+		return result;
+	}
+
+	string_type str() const
+	{
+		return this->substr();
+	}
+
+	int compare(string_view_type sv) const HAMON_NOEXCEPT
+	{
+		int result = 0;
+		size_type offset = 0;
+		auto const n = hamon::min(this->size(), sv.size());
+		auto f = [&](string_view_type chunk)
+		{
+			if (result == 0)
+			{
+				result = Traits::compare(chunk.data(), sv.data() + offset, chunk.size());
+				offset += chunk.size();
+			}
+		};
+		ForEachChunk(m_root, 0, n, f);
+
+		if (result != 0)
+		{
+			return result;
+		}
+
+		return this->size() < sv.size() ? -1 : (this->size() > sv.size() ? 1 : 0);
+	}
+
+	void swap(basic_rope& x) HAMON_NOEXCEPT
+	{
+		hamon::swap(m_allocator, x.m_allocator);
+		hamon::swap(m_root, x.m_root);
+		hamon::swap(m_seed, x.m_seed);
+	}
+
+	friend bool operator==(basic_rope const& lhs, string_view_type rhs) HAMON_NOEXCEPT
+	{
+		return lhs.size() == rhs.size() && lhs.compare(rhs) == 0;
+	}
+
+#if !defined(HAMON_HAS_CXX20_THREE_WAY_COMPARISON)
+	friend bool operator==(string_view_type lhs, basic_rope const& rhs) HAMON_NOEXCEPT
+	{
+		return rhs == lhs;
+	}
+
+	friend bool operator!=(basic_rope const& lhs, string_view_type rhs) HAMON_NOEXCEPT
+	{
+		return !(lhs == rhs);
+	}
+
+	friend bool operator!=(string_view_type lhs, basic_rope const& rhs) HAMON_NOEXCEPT
+	{
+		return !(rhs == lhs);
+	}
+#endif
+
+	template <typename Traits2>
+	friend std::basic_ostream<CharT, Traits2>&
+	operator<<(std::basic_ostream<CharT, Traits2>& os, basic_rope const& r)
+	{
+		r.for_each_chunk([&os](string_view_type sv)
+		{
+			os.write(sv.data(), static_cast<std::streamsize>(sv.size()));
+		});
+		return os;
+	}
+};
+
+#if !defined(HAMON_HAS_CXX17_INLINE_VARIABLES)
+template <typename CharT, typename Traits, typename Allocator>
+HAMON_CXX11_CONSTEXPR typename basic_rope<CharT, Traits, Allocator>::size_type
+basic_rope<CharT, Traits, Allocator>::npos;
+
+template <typename CharT, typename Traits, typename Allocator>
+HAMON_CXX11_CONSTEXPR typename basic_rope<CharT, Traits, Allocator>::size_type
+basic_rope<CharT, Traits, Allocator>::kLeafSize;
+#endif
+
+template <typename CharT, typename Traits, typename Allocator>
+void swap(basic_rope<CharT, Traits, Allocator>& lhs, basic_rope<CharT, Traits, Allocator>& rhs) HAMON_NOEXCEPT
+{
+	lhs.swap(rhs);
+}
+
+using rope  = hamon::basic_rope<char>;
+using wrope = hamon::basic_rope<wchar_t>;
+
+}	// namespace hamon
+
+#endif // HAMON_STRING_ROPE_HPP
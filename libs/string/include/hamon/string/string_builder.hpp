@@ -0,0 +1,407 @@
+﻿/**
+ *	@file	string_builder.hpp
+ *
+ *	@brief	basic_string_builder の定義
+ */
+
+#ifndef HAMON_STRING_STRING_BUILDER_HPP
+#define HAMON_STRING_STRING_BUILDER_HPP
+
+#include <hamon/string/basic_string.hpp>
+#include <hamon/string/char_traits.hpp>
+#include <hamon/string_view/basic_string_view.hpp>
+#include <hamon/algorithm/max.hpp>
+#include <hamon/algorithm/min.hpp>
+#include <hamon/charconv/to_chars.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/detail/exception_guard.hpp>
+#include <hamon/limits/numeric_limits.hpp>
+#include <hamon/memory/allocator.hpp>
+#include <hamon/memory/allocator_traits.hpp>
+#include <hamon/type_traits/enable_if.hpp>
+#include <hamon/type_traits/is_integral.hpp>
+#include <hamon/type_traits/is_same.hpp>
+#include <hamon/utility/exchange.hpp>
+#include <hamon/config.hpp>
+#include <ostream>
+
+namespace hamon
+{
+
+/**
+ *	@brief	断片を連結して大きな文字列を組み立てるためのクラス
+ *
+ *	追加された断片はチャンクの連結リストに書き込まれる。
+ *	チャンクがいっぱいになったら新しいチャンクを確保するだけで、
+ *	それまでに書き込んだ文字をコピーし直すことはない。
+ *
+ *	str() を呼び出すと、全体の長さの basic_string を一度だけ確保して、
+ *	全てのチャンクをコピーする。
+ */
+template <
+	typename CharT,
+	typename Traits = hamon::char_traits<CharT>,
+	typename Allocator = hamon::allocator<CharT>>
+class basic_string_builder
+{
+public:
+	using traits_type    = Traits;
+	using value_type     = CharT;
+	using allocator_type = Allocator;
+	using size_type      = typename hamon::allocator_traits<Allocator>::size_type;
+	using string_type    = hamon::basic_string<CharT, Traits, Allocator>;
+	using string_view_type = hamon::basic_string_view<CharT, Traits>;
+
+private:
+	using CharAllocTraits = hamon::allocator_traits<Allocator>;
+	using pointer = typename CharAllocTraits::pointer;
+
+	struct Chunk
+	{
+		Chunk*		next;
+		pointer		data;
+		size_type	size;
+		size_type	capacity;
+	};
+
+	using ChunkAllocator  = typename CharAllocTraits::template rebind_alloc<Chunk>;
+	using ChunkAllocTraits = hamon::allocator_traits<ChunkAllocator>;
+
+	// 最初のチャンクの大きさ
+	static HAMON_CXX11_CONSTEXPR size_type kInitialChunkSize = 256;
+	// チャンクの大きさは倍々に増やしていくが、この大きさより大きくはしない
+	static HAMON_CXX11_CONSTEXPR size_type kMaxChunkSize = (1u << 20) / sizeof(CharT);
+
+	HAMON_NO_UNIQUE_ADDRESS	allocator_type m_allocator;
+	Chunk*		m_head = nullptr;
+	Chunk*		m_tail = nullptr;
+	size_type	m_size = 0;
+	size_type	m_next_chunk_size = kInitialChunkSize;
+
+	// 少なくとも n 文字書き込めるチャンクを末尾に用意する
+	void NextChunk(size_type n)
+	{
+		// clear() の後は、確保済みのチャンクを使い回す
+		if (m_tail != nullptr && m_tail->next != nullptr)
+		{
+			m_tail = m_tail->next;
+			return;
+		}
+
+		auto const capacity = hamon::max(n, m_next_chunk_size);
+		m_next_chunk_size = hamon::min(
+			static_cast<size_type>(m_next_chunk_size * 2), kMaxChunkSize);
+
+		ChunkAllocator chunk_alloc(m_allocator);
+		Chunk* chunk = ChunkAllocTraits::allocate(chunk_alloc, 1);
+		chunk->next     = nullptr;
+		chunk->data     = nullptr;
+		chunk->size     = 0;
+		chunk->capacity = 0;
+
+		{
+			auto gd = hamon::detail::make_exception_guard([&]() noexcept
+			{
+				ChunkAllocTraits::deallocate(chunk_alloc, chunk, 1);
+			});
+			chunk->data = CharAllocTraits::allocate(m_allocator, capacity);
+			gd.complete();
+		}
+		chunk->capacity = capacity;
+
+		if (m_tail == nullptr)
+		{
+			m_head = chunk;
+		}
+		else
+		{
+			m_tail->next = chunk;
+		}
+		m_tail = chunk;
+	}
+
+	// 末尾のチャンクに書き込める文字数
+	size_type Available() const HAMON_NOEXCEPT
+	{
+		return m_tail == nullptr ? 0 : m_tail->capacity - m_tail->size;
+	}
+
+	// 末尾に n 文字追加する。
+	// fill(p, k) は p に k 文字書き込む。チャンクをまたぐ場合は複数回呼び出される。
+	template <typename Fill>
+	void AppendImpl(size_type n, Fill fill)
+	{
+		while (n != 0)
+		{
+			if (Available() == 0)
+			{
+				NextChunk(n);
+			}
+
+			auto const k = hamon::min(n, Available());
+			fill(m_tail->data + m_tail->size, k);
+			m_tail->size += k;
+			m_size += k;
+			n -= k;
+		}
+	}
+
+	void Release() HAMON_NOEXCEPT
+	{
+		ChunkAllocator chunk_alloc(m_allocator);
+		for (Chunk* p = m_head; p != nullptr;)
+		{
+			Chunk* next = p->next;
+			CharAllocTraits::deallocate(m_allocator, p->data, p->capacity);
+			ChunkAllocTraits::deallocate(chunk_alloc, p, 1);
+			p = next;
+		}
+
+		m_head = nullptr;
+		m_tail = nullptr;
+		m_size = 0;
+		m_next_chunk_size = kInitialChunkSize;
+	}
+
+public:
+	basic_string_builder() = default;
+
+	explicit basic_string_builder(Allocator const& a) HAMON_NOEXCEPT
+		: m_allocator(a)
+	{}
+
+	basic_string_builder(basic_string_builder&& x) HAMON_NOEXCEPT
+		: m_allocator(x.m_allocator)
+		, m_head(hamon::exchange(x.m_head, nullptr))
+		, m_tail(hamon::exchange(x.m_tail, nullptr))
+		, m_size(hamon::exchange(x.m_size, size_type{0}))
+		, m_next_chunk_size(hamon::exchange(x.m_next_chunk_size, kInitialChunkSize))
+	{}
+
+	basic_string_builder& operator=(basic_string_builder&& x) HAMON_NOEXCEPT
+	{
+		if (this != &x)
+		{
+			this->Release();
+			m_allocator       = x.m_allocator;
+			m_head            = hamon::exchange(x.m_head, nullptr);
+			m_tail            = hamon::exchange(x.m_tail, nullptr);
+			m_size            = hamon::exchange(x.m_size, size_type{0});
+			m_next_chunk_size = hamon::exchange(x.m_next_chunk_size, kInitialChunkSize);
+		}
+		return *this;
+	}
+
+	basic_string_builder(basic_string_builder const&) = delete;
+	basic_string_builder& operator=(basic_string_builder const&) = delete;
+
+	~basic_string_builder()
+	{
+		this->Release();
+	}
+
+	allocator_type get_allocator() const HAMON_NOEXCEPT
+	{
+		return m_allocator;
+	}
+
+	/**
+	 *	@brief	組み立て中の文字列の長さ
+	 */
+	size_type size() const HAMON_NOEXCEPT
+	{
+		return m_size;
+	}
+
+	bool empty() const HAMON_NOEXCEPT
+	{
+		return m_size == 0;
+	}
+
+	/**
+	 *	@brief	次に確保するチャンクに、少なくとも n 文字書き込めるようにする
+	 */
+	void reserve(size_type n)
+	{
+		if (Available() < n)
+		{
+			m_next_chunk_size = hamon::max(m_next_chunk_size, n);
+		}
+	}
+
+	/**
+	 *	@brief	組み立て中の文字列を空にする
+	 *
+	 *	確保済みのチャンクは解放せず、次の append で再利用する。
+	 */
+	void clear() HAMON_NOEXCEPT
+	{
+		for (Chunk* p = m_head; p != nullptr; p = p->next)
+		{
+			p->size = 0;
+		}
+		m_tail = m_head;
+		m_size = 0;
+	}
+
+	basic_string_builder& append(CharT const* s, size_type n)
+	{
+		AppendImpl(n, [&s](pointer p, size_type k)
+		{
+			Traits::copy(p, s, k);
+			s += k;
+		});
+		return *this;
+	}
+
+	basic_string_builder& append(string_view_type sv)
+	{
+		return this->append(sv.data(), sv.size());
+	}
+
+	basic_string_builder& append(size_type n, CharT c)
+	{
+		AppendImpl(n, [c](pointer p, size_type k)
+		{
+			Traits::assign(p, k, c);
+		});
+		return *this;
+	}
+
+	void push_back(CharT c)
+	{
+		if (Available() == 0)
+		{
+			NextChunk(1);
+		}
+		Traits::assign(m_tail->data[m_tail->size], c);
+		++m_tail->size;
+		++m_size;
+	}
+
+	/**
+	 *	@brief	整数を hamon::to_chars で文字列に変換して追加する
+	 */
+	template <typename T,
+		typename = hamon::enable_if_t<
+			hamon::is_integral<T>::value &&
+			!hamon::is_same<T, bool>::value
+		>
+	>
+	basic_string_builder& append_integer(T value, int base = 10)
+	{
+		// 2進数の場合が一番長くなる
+		char buf[hamon::numeric_limits<T>::digits + 2];
+		auto const result = hamon::to_chars(buf, buf + sizeof(buf), value, base);
+		auto const n = static_cast<size_type>(result.ptr - buf);
+		char const* s = buf;
+		AppendImpl(n, [&s](pointer p, size_type k)
+		{
+			for (size_type i = 0; i < k; ++i)
+			{
+				Traits::assign(p[i], static_cast<CharT>(*s++));
+			}
+		});
+		return *this;
+	}
+
+	basic_string_builder& operator<<(string_view_type sv)
+	{
+		return this->append(sv);
+	}
+
+	basic_string_builder& operator<<(CharT const* s)
+	{
+		return this->append(s, Traits::length(s));
+	}
+
+	basic_string_builder& operator<<(CharT c)
+	{
+		this->push_back(c);
+		return *this;
+	}
+
+	template <typename T,
+		typename = hamon::enable_if_t<
+			hamon::is_integral<T>::value &&
+			!hamon::is_same<T, bool>::value &&
+			!hamon::is_same<T, CharT>::value &&
+			!hamon::is_same<T, char>::value
+		>
+	>
+	basic_string_builder& operator<<(T value)
+	{
+		return this->append_integer(value);
+	}
+
+	/**
+	 *	@brief	チャンクごとに f(string_view_type) を呼び出す
+	 */
+	template <typename F>
+	void for_each_chunk(F f) const
+	{
+		for (Chunk const* p = m_head; p != nullptr && p->size != 0; p = p->next)
+		{
+			f(string_view_type(p->data, p->size));
+		}
+	}
+
+	/**
+	 *	@brief	組み立て中の文字列を dest にコピーし、書き込んだ末尾を返す
+	 *
+	 *	dest は少なくとも size() 文字書き込める必要がある。
+	 */
+	CharT* copy_to(CharT* dest) const
+	{
+		this->for_each_chunk([&dest](string_view_type sv)
+		{
+			Traits::copy(dest, sv.data(), sv.size());
+			dest += sv.size();
+		});
+		return dest;
+	}
+
+	/**
+	 *	@brief	組み立てた文字列を返す
+	 *
+	 *	メモリの確保は一度だけ行われる。
+	 */
+	string_type str() const
+	{
+		string_type result(m_allocator);
+		result.resize_and_overwrite(m_size, [this](CharT* p, size_type n)
+		{
+			this->copy_to(p);
+			return n;
+		});
+		return result;
+	}
+
+	template <typename Traits2>
+	friend std::basic_ostream<CharT, Traits2>&
+	operator<<(std::basic_ostream<CharT, Traits2>& os, basic_string_builder const& sb)
+	{
+		sb.for_each_chunk([&os](string_view_type sv)
+		{
+			os.write(sv.data(), static_cast<std::streamsize>(sv.size()));
+		});
+		return os;
+	}
+};
+
+#if !defined(HAMON_HAS_CXX17_INLINE_VARIABLES)
+template <typename CharT, typename Traits, typename Allocator>
+HAMON_CXX11_CONSTEXPR typename basic_string_builder<CharT, Traits, Allocator>::size_type
+basic_string_builder<CharT, Traits, Allocator>::kInitialChunkSize;
+
+template <typename CharT, typename Traits, typename Allocator>
+HAMON_CXX11_CONSTEXPR typename basic_string_builder<CharT, Traits, Allocator>::size_type
+basic_string_builder<CharT, Traits, Allocator>::kMaxChunkSize;
+#endif
+
+using string_builder  = hamon::basic_string_builder<char>;
+using wstring_builder = hamon::basic_string_builder<wchar_t>;
+
+}	// namespace hamon
+
+#endif // HAMON_STRING_STRING_BUILDER_HPP
@@ -552,6 +552,37 @@ TYPED_TEST(StringTest, AppendTest)
 	HAMON_CXX20_CONSTEXPR_EXPECT_TRUE(AppendTest<TypeParam>());
 }
 
+TYPED_TEST(StringTest, AppendGrowthTest)
+{
+	using CharT = TypeParam;
+	using string = hamon::basic_string<CharT>;
+	using Helper = StringTestHelper<CharT>;
+
+	// 少しずつ追加しても、メモリの再確保は対数回しか行われない
+	auto p = Helper::abcde();
+	string s;
+	int reallocations = 0;
+	auto cap = s.capacity();
+	for (int i = 0; i < 20000; ++i)
+	{
+		switch (i % 4)
+		{
+		case 0: s.append(p, 3); break;
+		case 1: s.append(2, p[4]); break;
+		case 2: s += p[1]; break;
+		case 3: s.insert(0, p, 1); break;
+		}
+		if (s.capacity() != cap)
+		{
+			cap = s.capacity();
+			++reallocations;
+		}
+	}
+	EXPECT_TRUE(GeneralCheck(s));
+	EXPECT_EQ(35000u, s.size());
+	EXPECT_LT(reallocations, 64);
+}
+
 }	// namespace append_test
 }	// namespace string_test
 }	// namespace hamon_test
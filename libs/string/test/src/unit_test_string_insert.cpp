@@ -442,6 +442,24 @@ InsertTest()
 		}
 	}
 
+	// 自身の一部を挿入
+	{
+		auto p = Helper::abcde();
+		string s = p;
+		s.reserve(64);
+		s.insert(1, s.data() + 2, 3);
+		VERIFY(GeneralCheck(s));
+		VERIFY(s.size() == 8);
+		VERIFY(s[0] == p[0]);
+		VERIFY(s[1] == p[2]);
+		VERIFY(s[2] == p[3]);
+		VERIFY(s[3] == p[4]);
+		VERIFY(s[4] == p[1]);
+		VERIFY(s[5] == p[2]);
+		VERIFY(s[6] == p[3]);
+		VERIFY(s[7] == p[4]);
+	}
+
 	return true;
 }
 
@@ -57,6 +57,35 @@ TYPED_TEST(StringTest, PushBackTest)
 	HAMON_CXX20_CONSTEXPR_EXPECT_TRUE(PushBackTest<TypeParam>());
 }
 
+TYPED_TEST(StringTest, PushBackGrowthTest)
+{
+	using CharT = TypeParam;
+	using string = hamon::basic_string<CharT>;
+	using Helper = StringTestHelper<CharT>;
+
+	// 1文字ずつ追加しても、メモリの再確保は対数回しか行われない
+	auto p = Helper::abcde();
+	string s;
+	int reallocations = 0;
+	auto cap = s.capacity();
+	for (int i = 0; i < 100000; ++i)
+	{
+		s.push_back(p[i % 5]);
+		if (s.capacity() != cap)
+		{
+			cap = s.capacity();
+			++reallocations;
+		}
+	}
+	EXPECT_TRUE(GeneralCheck(s));
+	EXPECT_EQ(100000u, s.size());
+	EXPECT_LT(reallocations, 64);
+	for (int i = 0; i < 100000; ++i)
+	{
+		EXPECT_EQ(p[i % 5], s[static_cast<hamon::size_t>(i)]);
+	}
+}
+
 }	// namespace push_back_test
 }	// namespace string_test
 }	// namespace hamon_test
@@ -417,6 +417,33 @@ ReplaceTest()
 		}
 	}
 
+	// 自身の一部で置き換え
+	{
+		auto p = Helper::abcde();
+		string s = p;
+		s.reserve(64);
+		s.replace(0, 2, s.data() + 3, 2);
+		VERIFY(GeneralCheck(s));
+		VERIFY(s.size() == 5);
+		VERIFY(s[0] == p[3]);
+		VERIFY(s[1] == p[4]);
+		VERIFY(s[2] == p[2]);
+		VERIFY(s[3] == p[3]);
+		VERIFY(s[4] == p[4]);
+
+		s.replace(1, 1, s.data(), 4);
+		VERIFY(GeneralCheck(s));
+		VERIFY(s.size() == 8);
+		VERIFY(s[0] == p[3]);
+		VERIFY(s[1] == p[3]);
+		VERIFY(s[2] == p[4]);
+		VERIFY(s[3] == p[2]);
+		VERIFY(s[4] == p[3]);
+		VERIFY(s[5] == p[2]);
+		VERIFY(s[6] == p[3]);
+		VERIFY(s[7] == p[4]);
+	}
+
 	return true;
 }
 
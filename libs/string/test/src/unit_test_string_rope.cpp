@@ -0,0 +1,180 @@
+﻿/**
+ *	@file	unit_test_string_rope.cpp
+ *
+ *	@brief	basic_rope のテスト
+ */
+
+#include <hamon/string/rope.hpp>
+#include <hamon/string/string.hpp>
+#include <hamon/string_view.hpp>
+#include <hamon/config.hpp>
+#include <gtest/gtest.h>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+namespace hamon_test
+{
+namespace string_test
+{
+namespace rope_test
+{
+
+GTEST_TEST(StringTest, RopeTest)
+{
+	{
+		hamon::rope r;
+		EXPECT_TRUE(r.empty());
+		EXPECT_EQ(0u, r.size());
+		EXPECT_TRUE(r == "");
+		EXPECT_EQ("", r.str());
+	}
+	{
+		hamon::rope r("Hello World");
+		EXPECT_FALSE(r.empty());
+		EXPECT_EQ(11u, r.size());
+		EXPECT_EQ(11u, r.length());
+		EXPECT_EQ('H', r[0]);
+		EXPECT_EQ('d', r.at(10));
+		EXPECT_TRUE(r == "Hello World");
+		EXPECT_TRUE(r != "Hello");
+		EXPECT_TRUE("Hello World" == r);
+
+		r.insert(5, ",");
+		EXPECT_TRUE(r == "Hello, World");
+		r.append("!");
+		EXPECT_TRUE(r == "Hello, World!");
+		r.erase(0, 7);
+		EXPECT_TRUE(r == "World!");
+		r.push_back('?');
+		r += hamon::string_view("?");
+		EXPECT_EQ("World!??", r.str());
+		EXPECT_EQ("rld", r.substr(2, 3));
+		EXPECT_EQ("??", r.substr(6));
+
+		EXPECT_LT(0, r.compare("Apple"));
+		EXPECT_GT(0, r.compare("Zoo"));
+		EXPECT_GT(0, r.compare("World!???"));
+		EXPECT_LT(0, r.compare("World"));
+
+		char buf[4] = {};
+		EXPECT_EQ(3u, r.copy(buf, 3, 1));
+		EXPECT_EQ('o', buf[0]);
+		EXPECT_EQ('l', buf[2]);
+
+		std::stringstream ss;
+		ss << r;
+		EXPECT_EQ("World!??", ss.str());
+
+		r.erase(3);
+		EXPECT_TRUE(r == "Wor");
+		r.erase();
+		EXPECT_TRUE(r.empty());
+	}
+	{
+		hamon::rope r1("abc");
+		hamon::rope r2 = r1;
+		r2.insert(1, "xyz");
+		EXPECT_TRUE(r1 == "abc");
+		EXPECT_TRUE(r2 == "axyzbc");
+
+		r1 = r2;
+		EXPECT_TRUE(r1 == "axyzbc");
+
+		hamon::rope r3 = hamon::move(r2);
+		EXPECT_TRUE(r2.empty());
+		EXPECT_TRUE(r3 == "axyzbc");
+
+		r3.insert(0, r1);
+		EXPECT_TRUE(r3 == "axyzbcaxyzbc");
+
+		swap(r1, r3);
+		EXPECT_TRUE(r1 == "axyzbcaxyzbc");
+		EXPECT_TRUE(r3 == "axyzbc");
+	}
+#if !defined(HAMON_NO_EXCEPTIONS)
+	{
+		hamon::rope r("abc");
+		EXPECT_THROW((void)r.at(3), std::out_of_range);
+		EXPECT_THROW(r.insert(4, "x"), std::out_of_range);
+		EXPECT_THROW(r.erase(4), std::out_of_range);
+		EXPECT_THROW((void)r.substr(4), std::out_of_range);
+		EXPECT_TRUE(r == "abc");
+	}
+#endif
+	{
+		hamon::wrope r(L"abc");
+		r.insert(1, L"12345");
+		EXPECT_TRUE(r == L"a12345bc");
+		EXPECT_TRUE(r.str() == L"a12345bc");
+	}
+}
+
+GTEST_TEST(StringTest, RopeRandomTest)
+{
+	// std::string と同じ操作を行って結果を比較する
+	std::mt19937 engine(12345);
+	std::string expected;
+	hamon::rope r;
+
+	auto rand = [&](std::size_t n)
+	{
+		return std::uniform_int_distribution<std::size_t>(0, n)(engine);
+	};
+
+	for (int i = 0; i < 3000; ++i)
+	{
+		auto const op = rand(9);
+		if (op < 5)
+		{
+			auto const pos = rand(expected.size());
+			std::string s(rand(op == 0 ? 1000 : 20), static_cast<char>('a' + rand(25)));
+			expected.insert(pos, s);
+			r.insert(pos, hamon::string_view(s.data(), s.size()));
+		}
+		else if (op < 8)
+		{
+			auto const pos = rand(expected.size());
+			auto const n = rand(op == 5 ? 1000 : 20);
+			expected.erase(pos, n);
+			r.erase(pos, n);
+		}
+		else
+		{
+			expected.push_back('#');
+			r.push_back('#');
+		}
+
+		ASSERT_EQ(expected.size(), r.size());
+		if (!expected.empty())
+		{
+			auto const pos = rand(expected.size() - 1);
+			ASSERT_EQ(expected[pos], r[pos]);
+		}
+	}
+
+	auto const s = r.str();
+	EXPECT_EQ(expected, std::string(s.data(), s.size()));
+	EXPECT_TRUE(r == hamon::string_view(expected.data(), expected.size()));
+
+	std::size_t offset = 0;
+	r.for_each_chunk([&](hamon::string_view sv)
+	{
+		EXPECT_EQ(expected.substr(offset, sv.size()), std::string(sv.data(), sv.size()));
+		offset += sv.size();
+	});
+	EXPECT_EQ(expected.size(), offset);
+
+	offset = 100;
+	r.for_each_chunk(100, 500, [&](hamon::string_view sv)
+	{
+		EXPECT_EQ(expected.substr(offset, sv.size()), std::string(sv.data(), sv.size()));
+		offset += sv.size();
+	});
+	EXPECT_EQ(600u, offset);
+}
+
+}	// namespace rope_test
+}	// namespace string_test
+}	// namespace hamon_test
@@ -0,0 +1,126 @@
+﻿/**
+ *	@file	unit_test_string_string_builder.cpp
+ *
+ *	@brief	basic_string_builder のテスト
+ */
+
+#include <hamon/string/string_builder.hpp>
+#include <hamon/string/string.hpp>
+#include <hamon/string/to_string.hpp>
+#include <hamon/string_view.hpp>
+#include <hamon/limits.hpp>
+#include <hamon/cstdint.hpp>
+#include <hamon/type_traits/is_copy_constructible.hpp>
+#include <hamon/type_traits/is_nothrow_move_constructible.hpp>
+#include <hamon/utility/move.hpp>
+#include <hamon/config.hpp>
+#include <gtest/gtest.h>
+#include <sstream>
+
+namespace hamon_test
+{
+namespace string_test
+{
+namespace string_builder_test
+{
+
+static_assert(!hamon::is_copy_constructible<hamon::string_builder>::value, "");
+static_assert( hamon::is_nothrow_move_constructible<hamon::string_builder>::value, "");
+
+GTEST_TEST(StringTest, StringBuilderTest)
+{
+	{
+		hamon::string_builder sb;
+		EXPECT_TRUE(sb.empty());
+		EXPECT_EQ(0u, sb.size());
+		EXPECT_EQ("", sb.str());
+	}
+	{
+		hamon::string_builder sb;
+		sb << "abc" << hamon::string_view("de") << 'f' << 123 << ' ' << -45L;
+		sb.append(3, 'x');
+		sb.append("hello", 2);
+		sb.push_back('!');
+		EXPECT_FALSE(sb.empty());
+		EXPECT_EQ(19u, sb.size());
+		EXPECT_EQ("abcdef123 -45xxxhe!", sb.str());
+	}
+	{
+		hamon::string_builder sb;
+		sb.append_integer(255, 16);
+		sb << ',';
+		sb.append_integer(5u, 2);
+		sb << ',';
+		sb.append_integer(hamon::numeric_limits<hamon::int64_t>::min());
+		sb << ',' << hamon::numeric_limits<hamon::uint64_t>::max();
+		EXPECT_EQ("ff,101,-9223372036854775808,18446744073709551615", sb.str());
+	}
+	{
+		// チャンクをまたいで書き込む
+		hamon::string expected;
+		hamon::string_builder sb;
+		for (int i = 0; i < 10000; ++i)
+		{
+			sb << i << ',';
+			expected += hamon::to_string(i);
+			expected += ',';
+		}
+		hamon::string big(5000, 'z');
+		sb << big;
+		expected += big;
+
+		EXPECT_EQ(expected.size(), sb.size());
+		auto const s = sb.str();
+		EXPECT_TRUE(s == expected);
+
+		hamon::size_t total = 0;
+		int chunks = 0;
+		sb.for_each_chunk([&](hamon::string_view sv)
+		{
+			EXPECT_TRUE(sv == hamon::string_view(expected).substr(total, sv.size()));
+			total += sv.size();
+			++chunks;
+		});
+		EXPECT_EQ(expected.size(), total);
+		EXPECT_GT(chunks, 1);
+
+		std::stringstream ss;
+		ss << sb;
+		EXPECT_TRUE(ss.str() == std::string(expected.data(), expected.size()));
+
+		// clear した後は確保済みのチャンクを再利用する
+		sb.clear();
+		EXPECT_TRUE(sb.empty());
+		sb << "reuse";
+		EXPECT_EQ("reuse", sb.str());
+
+		// ムーブ
+		hamon::string_builder sb2 = hamon::move(sb);
+		EXPECT_TRUE(sb.empty());
+		EXPECT_EQ("reuse", sb2.str());
+		sb2 << 1;
+		sb = hamon::move(sb2);
+		EXPECT_EQ("reuse1", sb.str());
+	}
+	{
+		hamon::string_builder sb;
+		sb.reserve(100000);
+		sb.append(100000, 'a');
+		int chunks = 0;
+		sb.for_each_chunk([&](hamon::string_view) { ++chunks; });
+		EXPECT_EQ(1, chunks);
+
+		char buf[100000];
+		EXPECT_EQ(buf + 100000, sb.copy_to(buf));
+		EXPECT_EQ('a', buf[99999]);
+	}
+	{
+		hamon::wstring_builder sb;
+		sb << L"abc" << 42 << L'!';
+		EXPECT_TRUE(sb.str() == L"abc42!");
+	}
+}
+
+}	// namespace string_builder_test
+}	// namespace string_test
+}	// namespace hamon_test
@@ -7,402 +7,387 @@
 #ifndef HAMON_VALARRAY_DETAIL_VALARRAY_BINARY_HPP
 #define HAMON_VALARRAY_DETAIL_VALARRAY_BINARY_HPP
 
-#include <hamon/cstddef/size_t.hpp>
+#include <hamon/valarray/detail/valarray_closure.hpp>
+#include <hamon/valarray/detail/valarray_expr.hpp>
+#include <hamon/valarray/detail/valarray_ops.hpp>
+#include <hamon/functional/bit_and.hpp>
+#include <hamon/functional/bit_or.hpp>
+#include <hamon/functional/bit_xor.hpp>
+#include <hamon/functional/divides.hpp>
+#include <hamon/functional/minus.hpp>
+#include <hamon/functional/modulus.hpp>
+#include <hamon/functional/multiplies.hpp>
+#include <hamon/functional/plus.hpp>
+#include <hamon/type_traits/type_identity.hpp>
 #include <hamon/config.hpp>
 
 namespace hamon
 {
 
 // 29.6.3.1 Binary operators[valarray.binary]
-
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<T>
-operator*(valarray<T> const& lhs, valarray<T> const& rhs)
+//
+// 演算の結果は valarray_expr として遅延評価される。
+// オペランドには valarray の他に valarray_expr と
+// slice_array, gslice_array, mask_array, indirect_array も渡せる(拡張)。
+
+template <typename L, typename R, typename T = hamon::detail::valarray_common_value_t<L, R>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_binary_expr_t<T, hamon::multiplies<>,
+	hamon::detail::valarray_closure_t<L>,
+	hamon::detail::valarray_closure_t<R>>
+operator*(L const& lhs, R const& rhs)
 {
-	hamon::size_t const size = lhs.size();
-	valarray<T> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
-	{
-		result[i] = lhs[i] * rhs[i];
-	}
-	return result;
+	return hamon::detail::make_valarray_binary_expr<T, hamon::multiplies<>>(
+		hamon::detail::make_valarray_closure(lhs),
+		hamon::detail::make_valarray_closure(rhs));
 }
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<T>
-operator*(valarray<T> const& lhs, typename valarray<T>::value_type const& rhs)
+template <typename L, typename T = hamon::detail::valarray_operand_value_t<L>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_binary_expr_t<T, hamon::multiplies<>,
+	hamon::detail::valarray_closure_t<L>,
+	hamon::detail::valarray_scalar_closure<T>>
+operator*(L const& lhs, hamon::type_identity_t<T> const& rhs)
 {
-	hamon::size_t const size = lhs.size();
-	valarray<T> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
-	{
-		result[i] = lhs[i] * rhs;
-	}
-	return result;
+	return hamon::detail::make_valarray_binary_expr<T, hamon::multiplies<>>(
+		hamon::detail::make_valarray_closure(lhs),
+		hamon::detail::valarray_scalar_closure<T>(rhs));
 }
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<T>
-operator*(typename valarray<T>::value_type const& lhs, valarray<T> const& rhs)
+template <typename R, typename T = hamon::detail::valarray_operand_value_t<R>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_binary_expr_t<T, hamon::multiplies<>,
+	hamon::detail::valarray_scalar_closure<T>,
+	hamon::detail::valarray_closure_t<R>>
+operator*(hamon::type_identity_t<T> const& lhs, R const& rhs)
 {
-	hamon::size_t const size = rhs.size();
-	valarray<T> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
-	{
-		result[i] = lhs * rhs[i];
-	}
-	return result;
+	return hamon::detail::make_valarray_binary_expr<T, hamon::multiplies<>>(
+		hamon::detail::valarray_scalar_closure<T>(lhs),
+		hamon::detail::make_valarray_closure(rhs));
 }
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<T>
-operator/(valarray<T> const& lhs, valarray<T> const& rhs)
+template <typename L, typename R, typename T = hamon::detail::valarray_common_value_t<L, R>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_binary_expr_t<T, hamon::divides<>,
+	hamon::detail::valarray_closure_t<L>,
+	hamon::detail::valarray_closure_t<R>>
+operator/(L const& lhs, R const& rhs)
 {
-	hamon::size_t const size = lhs.size();
-	valarray<T> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
-	{
-		result[i] = lhs[i] / rhs[i];
-	}
-	return result;
+	return hamon::detail::make_valarray_binary_expr<T, hamon::divides<>>(
+		hamon::detail::make_valarray_closure(lhs),
+		hamon::detail::make_valarray_closure(rhs));
 }
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<T>
-operator/(valarray<T> const& lhs, typename valarray<T>::value_type const& rhs)
+template <typename L, typename T = hamon::detail::valarray_operand_value_t<L>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_binary_expr_t<T, hamon::divides<>,
+	hamon::detail::valarray_closure_t<L>,
+	hamon::detail::valarray_scalar_closure<T>>
+operator/(L const& lhs, hamon::type_identity_t<T> const& rhs)
 {
-	hamon::size_t const size = lhs.size();
-	valarray<T> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
-	{
-		result[i] = lhs[i] / rhs;
-	}
-	return result;
+	return hamon::detail::make_valarray_binary_expr<T, hamon::divides<>>(
+		hamon::detail::make_valarray_closure(lhs),
+		hamon::detail::valarray_scalar_closure<T>(rhs));
 }
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<T>
-operator/(typename valarray<T>::value_type const& lhs, valarray<T> const& rhs)
+template <typename R, typename T = hamon::detail::valarray_operand_value_t<R>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_binary_expr_t<T, hamon::divides<>,
+	hamon::detail::valarray_scalar_closure<T>,
+	hamon::detail::valarray_closure_t<R>>
+operator/(hamon::type_identity_t<T> const& lhs, R const& rhs)
 {
-	hamon::size_t const size = rhs.size();
-	valarray<T> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
-	{
-		result[i] = lhs / rhs[i];
-	}
-	return result;
+	return hamon::detail::make_valarray_binary_expr<T, hamon::divides<>>(
+		hamon::detail::valarray_scalar_closure<T>(lhs),
+		hamon::detail::make_valarray_closure(rhs));
 }
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<T>
-operator%(valarray<T> const& lhs, valarray<T> const& rhs)
+template <typename L, typename R, typename T = hamon::detail::valarray_common_value_t<L, R>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_binary_expr_t<T, hamon::modulus<>,
+	hamon::detail::valarray_closure_t<L>,
+	hamon::detail::valarray_closure_t<R>>
+operator%(L const& lhs, R const& rhs)
 {
-	hamon::size_t const size = lhs.size();
-	valarray<T> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
-	{
-		result[i] = lhs[i] % rhs[i];
-	}
-	return result;
+	return hamon::detail::make_valarray_binary_expr<T, hamon::modulus<>>(
+		hamon::detail::make_valarray_closure(lhs),
+		hamon::detail::make_valarray_closure(rhs));
 }
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<T>
-operator%(valarray<T> const& lhs, typename valarray<T>::value_type const& rhs)
+template <typename L, typename T = hamon::detail::valarray_operand_value_t<L>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_binary_expr_t<T, hamon::modulus<>,
+	hamon::detail::valarray_closure_t<L>,
+	hamon::detail::valarray_scalar_closure<T>>
+operator%(L const& lhs, hamon::type_identity_t<T> const& rhs)
 {
-	hamon::size_t const size = lhs.size();
-	valarray<T> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
-	{
-		result[i] = lhs[i] % rhs;
-	}
-	return result;
+	return hamon::detail::make_valarray_binary_expr<T, hamon::modulus<>>(
+		hamon::detail::make_valarray_closure(lhs),
+		hamon::detail::valarray_scalar_closure<T>(rhs));
 }
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<T>
-operator%(typename valarray<T>::value_type const& lhs, valarray<T> const& rhs)
+template <typename R, typename T = hamon::detail::valarray_operand_value_t<R>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_binary_expr_t<T, hamon::modulus<>,
+	hamon::detail::valarray_scalar_closure<T>,
+	hamon::detail::valarray_closure_t<R>>
+operator%(hamon::type_identity_t<T> const& lhs, R const& rhs)
 {
-	hamon::size_t const size = rhs.size();
-	valarray<T> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
-	{
-		result[i] = lhs % rhs[i];
-	}
-	return result;
+	return hamon::detail::make_valarray_binary_expr<T, hamon::modulus<>>(
+		hamon::detail::valarray_scalar_closure<T>(lhs),
+		hamon::detail::make_valarray_closure(rhs));
 }
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<T>
-operator+(valarray<T> const& lhs, valarray<T> const& rhs)
+template <typename L, typename R, typename T = hamon::detail::valarray_common_value_t<L, R>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_binary_expr_t<T, hamon::plus<>,
+	hamon::detail::valarray_closure_t<L>,
+	hamon::detail::valarray_closure_t<R>>
+operator+(L const& lhs, R const& rhs)
 {
-	hamon::size_t const size = lhs.size();
-	valarray<T> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
-	{
-		result[i] = lhs[i] + rhs[i];
-	}
-	return result;
+	return hamon::detail::make_valarray_binary_expr<T, hamon::plus<>>(
+		hamon::detail::make_valarray_closure(lhs),
+		hamon::detail::make_valarray_closure(rhs));
 }
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<T>
-operator+(valarray<T> const& lhs, typename valarray<T>::value_type const& rhs)
+template <typename L, typename T = hamon::detail::valarray_operand_value_t<L>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_binary_expr_t<T, hamon::plus<>,
+	hamon::detail::valarray_closure_t<L>,
+	hamon::detail::valarray_scalar_closure<T>>
+operator+(L const& lhs, hamon::type_identity_t<T> const& rhs)
 {
-	hamon::size_t const size = lhs.size();
-	valarray<T> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
-	{
-		result[i] = lhs[i] + rhs;
-	}
-	return result;
+	return hamon::detail::make_valarray_binary_expr<T, hamon::plus<>>(
+		hamon::detail::make_valarray_closure(lhs),
+		hamon::detail::valarray_scalar_closure<T>(rhs));
 }
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<T>
-operator+(typename valarray<T>::value_type const& lhs, valarray<T> const& rhs)
+template <typename R, typename T = hamon::detail::valarray_operand_value_t<R>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_binary_expr_t<T, hamon::plus<>,
+	hamon::detail::valarray_scalar_closure<T>,
+	hamon::detail::valarray_closure_t<R>>
+operator+(hamon::type_identity_t<T> const& lhs, R const& rhs)
 {
-	hamon::size_t const size = rhs.size();
-	valarray<T> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
-	{
-		result[i] = lhs + rhs[i];
-	}
-	return result;
+	return hamon::detail::make_valarray_binary_expr<T, hamon::plus<>>(
+		hamon::detail::valarray_scalar_closure<T>(lhs),
+		hamon::detail::make_valarray_closure(rhs));
 }
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<T>
-operator-(valarray<T> const& lhs, valarray<T> const& rhs)
+template <typename L, typename R, typename T = hamon::detail::valarray_common_value_t<L, R>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_binary_expr_t<T, hamon::minus<>,
+	hamon::detail::valarray_closure_t<L>,
+	hamon::detail::valarray_closure_t<R>>
+operator-(L const& lhs, R const& rhs)
 {
-	hamon::size_t const size = lhs.size();
-	valarray<T> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
-	{
-		result[i] = lhs[i] - rhs[i];
-	}
-	return result;
+	return hamon::detail::make_valarray_binary_expr<T, hamon::minus<>>(
+		hamon::detail::make_valarray_closure(lhs),
+		hamon::detail::make_valarray_closure(rhs));
 }
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<T>
-operator-(valarray<T> const& lhs, typename valarray<T>::value_type const& rhs)
+template <typename L, typename T = hamon::detail::valarray_operand_value_t<L>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_binary_expr_t<T, hamon::minus<>,
+	hamon::detail::valarray_closure_t<L>,
+	hamon::detail::valarray_scalar_closure<T>>
+operator-(L const& lhs, hamon::type_identity_t<T> const& rhs)
 {
-	hamon::size_t const size = lhs.size();
-	valarray<T> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
-	{
-		result[i] = lhs[i] - rhs;
-	}
-	return result;
+	return hamon::detail::make_valarray_binary_expr<T, hamon::minus<>>(
+		hamon::detail::make_valarray_closure(lhs),
+		hamon::detail::valarray_scalar_closure<T>(rhs));
 }
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<T>
-operator-(typename valarray<T>::value_type const& lhs, valarray<T> const& rhs)
+template <typename R, typename T = hamon::detail::valarray_operand_value_t<R>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_binary_expr_t<T, hamon::minus<>,
+	hamon::detail::valarray_scalar_closure<T>,
+	hamon::detail::valarray_closure_t<R>>
+operator-(hamon::type_identity_t<T> const& lhs, R const& rhs)
 {
-	hamon::size_t const size = rhs.size();
-	valarray<T> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
-	{
-		result[i] = lhs - rhs[i];
-	}
-	return result;
+	return hamon::detail::make_valarray_binary_expr<T, hamon::minus<>>(
+		hamon::detail::valarray_scalar_closure<T>(lhs),
+		hamon::detail::make_valarray_closure(rhs));
 }
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<T>
-operator^(valarray<T> const& lhs, valarray<T> const& rhs)
+template <typename L, typename R, typename T = hamon::detail::valarray_common_value_t<L, R>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_binary_expr_t<T, hamon::bit_xor<>,
+	hamon::detail::valarray_closure_t<L>,
+	hamon::detail::valarray_closure_t<R>>
+operator^(L const& lhs, R const& rhs)
 {
-	hamon::size_t const size = lhs.size();
-	valarray<T> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
-	{
-		result[i] = lhs[i] ^ rhs[i];
-	}
-	return result;
+	return hamon::detail::make_valarray_binary_expr<T, hamon::bit_xor<>>(
+		hamon::detail::make_valarray_closure(lhs),
+		hamon::detail::make_valarray_closure(rhs));
 }
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<T>
-operator^(valarray<T> const& lhs, typename valarray<T>::value_type const& rhs)
+template <typename L, typename T = hamon::detail::valarray_operand_value_t<L>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_binary_expr_t<T, hamon::bit_xor<>,
+	hamon::detail::valarray_closure_t<L>,
+	hamon::detail::valarray_scalar_closure<T>>
+operator^(L const& lhs, hamon::type_identity_t<T> const& rhs)
 {
-	hamon::size_t const size = lhs.size();
-	valarray<T> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
-	{
-		result[i] = lhs[i] ^ rhs;
-	}
-	return result;
+	return hamon::detail::make_valarray_binary_expr<T, hamon::bit_xor<>>(
+		hamon::detail::make_valarray_closure(lhs),
+		hamon::detail::valarray_scalar_closure<T>(rhs));
 }
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<T>
-operator^(typename valarray<T>::value_type const& lhs, valarray<T> const& rhs)
+template <typename R, typename T = hamon::detail::valarray_operand_value_t<R>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_binary_expr_t<T, hamon::bit_xor<>,
+	hamon::detail::valarray_scalar_closure<T>,
+	hamon::detail::valarray_closure_t<R>>
+operator^(hamon::type_identity_t<T> const& lhs, R const& rhs)
 {
-	hamon::size_t const size = rhs.size();
-	valarray<T> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
-	{
-		result[i] = lhs ^ rhs[i];
-	}
-	return result;
+	return hamon::detail::make_valarray_binary_expr<T, hamon::bit_xor<>>(
+		hamon::detail::valarray_scalar_closure<T>(lhs),
+		hamon::detail::make_valarray_closure(rhs));
 }
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<T>
-operator&(valarray<T> const& lhs, valarray<T> const& rhs)
+template <typename L, typename R, typename T = hamon::detail::valarray_common_value_t<L, R>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_binary_expr_t<T, hamon::bit_and<>,
+	hamon::detail::valarray_closure_t<L>,
+	hamon::detail::valarray_closure_t<R>>
+operator&(L const& lhs, R const& rhs)
 {
-	hamon::size_t const size = lhs.size();
-	valarray<T> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
-	{
-		result[i] = lhs[i] & rhs[i];
-	}
-	return result;
+	return hamon::detail::make_valarray_binary_expr<T, hamon::bit_and<>>(
+		hamon::detail::make_valarray_closure(lhs),
+		hamon::detail::make_valarray_closure(rhs));
 }
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<T>
-operator&(valarray<T> const& lhs, typename valarray<T>::value_type const& rhs)
+template <typename L, typename T = hamon::detail::valarray_operand_value_t<L>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_binary_expr_t<T, hamon::bit_and<>,
+	hamon::detail::valarray_closure_t<L>,
+	hamon::detail::valarray_scalar_closure<T>>
+operator&(L const& lhs, hamon::type_identity_t<T> const& rhs)
 {
-	hamon::size_t const size = lhs.size();
-	valarray<T> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
-	{
-		result[i] = lhs[i] & rhs;
-	}
-	return result;
+	return hamon::detail::make_valarray_binary_expr<T, hamon::bit_and<>>(
+		hamon::detail::make_valarray_closure(lhs),
+		hamon::detail::valarray_scalar_closure<T>(rhs));
 }
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<T>
-operator&(typename valarray<T>::value_type const& lhs, valarray<T> const& rhs)
+template <typename R, typename T = hamon::detail::valarray_operand_value_t<R>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_binary_expr_t<T, hamon::bit_and<>,
+	hamon::detail::valarray_scalar_closure<T>,
+	hamon::detail::valarray_closure_t<R>>
+operator&(hamon::type_identity_t<T> const& lhs, R const& rhs)
 {
-	hamon::size_t const size = rhs.size();
-	valarray<T> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
-	{
-		result[i] = lhs & rhs[i];
-	}
-	return result;
+	return hamon::detail::make_valarray_binary_expr<T, hamon::bit_and<>>(
+		hamon::detail::valarray_scalar_closure<T>(lhs),
+		hamon::detail::make_valarray_closure(rhs));
 }
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<T>
-operator|(valarray<T> const& lhs, valarray<T> const& rhs)
+template <typename L, typename R, typename T = hamon::detail::valarray_common_value_t<L, R>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_binary_expr_t<T, hamon::bit_or<>,
+	hamon::detail::valarray_closure_t<L>,
+	hamon::detail::valarray_closure_t<R>>
+operator|(L const& lhs, R const& rhs)
 {
-	hamon::size_t const size = lhs.size();
-	valarray<T> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
-	{
-		result[i] = lhs[i] | rhs[i];
-	}
-	return result;
+	return hamon::detail::make_valarray_binary_expr<T, hamon::bit_or<>>(
+		hamon::detail::make_valarray_closure(lhs),
+		hamon::detail::make_valarray_closure(rhs));
 }
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<T>
-operator|(valarray<T> const& lhs, typename valarray<T>::value_type const& rhs)
+template <typename L, typename T = hamon::detail::valarray_operand_value_t<L>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_binary_expr_t<T, hamon::bit_or<>,
+	hamon::detail::valarray_closure_t<L>,
+	hamon::detail::valarray_scalar_closure<T>>
+operator|(L const& lhs, hamon::type_identity_t<T> const& rhs)
 {
-	hamon::size_t const size = lhs.size();
-	valarray<T> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
-	{
-		result[i] = lhs[i] | rhs;
-	}
-	return result;
+	return hamon::detail::make_valarray_binary_expr<T, hamon::bit_or<>>(
+		hamon::detail::make_valarray_closure(lhs),
+		hamon::detail::valarray_scalar_closure<T>(rhs));
 }
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<T>
-operator|(typename valarray<T>::value_type const& lhs, valarray<T> const& rhs)
+template <typename R, typename T = hamon::detail::valarray_operand_value_t<R>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_binary_expr_t<T, hamon::bit_or<>,
+	hamon::detail::valarray_scalar_closure<T>,
+	hamon::detail::valarray_closure_t<R>>
+operator|(hamon::type_identity_t<T> const& lhs, R const& rhs)
 {
-	hamon::size_t const size = rhs.size();
-	valarray<T> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
-	{
-		result[i] = lhs | rhs[i];
-	}
-	return result;
+	return hamon::detail::make_valarray_binary_expr<T, hamon::bit_or<>>(
+		hamon::detail::valarray_scalar_closure<T>(lhs),
+		hamon::detail::make_valarray_closure(rhs));
 }
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<T>
-operator<<(valarray<T> const& lhs, valarray<T> const& rhs)
+template <typename L, typename R, typename T = hamon::detail::valarray_common_value_t<L, R>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_binary_expr_t<T, hamon::detail::valarray_shift_left,
+	hamon::detail::valarray_closure_t<L>,
+	hamon::detail::valarray_closure_t<R>>
+operator<<(L const& lhs, R const& rhs)
 {
-	hamon::size_t const size = lhs.size();
-	valarray<T> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
-	{
-		result[i] = static_cast<T>(lhs[i] << rhs[i]);
-	}
-	return result;
+	return hamon::detail::make_valarray_binary_expr<T, hamon::detail::valarray_shift_left>(
+		hamon::detail::make_valarray_closure(lhs),
+		hamon::detail::make_valarray_closure(rhs));
 }
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<T>
-operator<<(valarray<T> const& lhs, typename valarray<T>::value_type const& rhs)
+template <typename L, typename T = hamon::detail::valarray_operand_value_t<L>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_binary_expr_t<T, hamon::detail::valarray_shift_left,
+	hamon::detail::valarray_closure_t<L>,
+	hamon::detail::valarray_scalar_closure<T>>
+operator<<(L const& lhs, hamon::type_identity_t<T> const& rhs)
 {
-	hamon::size_t const size = lhs.size();
-	valarray<T> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
-	{
-		result[i] = static_cast<T>(lhs[i] << rhs);
-	}
-	return result;
+	return hamon::detail::make_valarray_binary_expr<T, hamon::detail::valarray_shift_left>(
+		hamon::detail::make_valarray_closure(lhs),
+		hamon::detail::valarray_scalar_closure<T>(rhs));
 }
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<T>
-operator<<(typename valarray<T>::value_type const& lhs, valarray<T> const& rhs)
+template <typename R, typename T = hamon::detail::valarray_operand_value_t<R>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_binary_expr_t<T, hamon::detail::valarray_shift_left,
+	hamon::detail::valarray_scalar_closure<T>,
+	hamon::detail::valarray_closure_t<R>>
+operator<<(hamon::type_identity_t<T> const& lhs, R const& rhs)
 {
-	hamon::size_t const size = rhs.size();
-	valarray<T> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
-	{
-		result[i] = static_cast<T>(lhs << rhs[i]);
-	}
-	return result;
+	return hamon::detail::make_valarray_binary_expr<T, hamon::detail::valarray_shift_left>(
+		hamon::detail::valarray_scalar_closure<T>(lhs),
+		hamon::detail::make_valarray_closure(rhs));
 }
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<T>
-operator>>(valarray<T> const& lhs, valarray<T> const& rhs)
+template <typename L, typename R, typename T = hamon::detail::valarray_common_value_t<L, R>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_binary_expr_t<T, hamon::detail::valarray_shift_right,
+	hamon::detail::valarray_closure_t<L>,
+	hamon::detail::valarray_closure_t<R>>
+operator>>(L const& lhs, R const& rhs)
 {
-	hamon::size_t const size = lhs.size();
-	valarray<T> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
-	{
-		result[i] = static_cast<T>(lhs[i] >> rhs[i]);
-	}
-	return result;
+	return hamon::detail::make_valarray_binary_expr<T, hamon::detail::valarray_shift_right>(
+		hamon::detail::make_valarray_closure(lhs),
+		hamon::detail::make_valarray_closure(rhs));
 }
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<T>
-operator>>(valarray<T> const& lhs, typename valarray<T>::value_type const& rhs)
+template <typename L, typename T = hamon::detail::valarray_operand_value_t<L>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_binary_expr_t<T, hamon::detail::valarray_shift_right,
+	hamon::detail::valarray_closure_t<L>,
+	hamon::detail::valarray_scalar_closure<T>>
+operator>>(L const& lhs, hamon::type_identity_t<T> const& rhs)
 {
-	hamon::size_t const size = lhs.size();
-	valarray<T> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
-	{
-		result[i] = static_cast<T>(lhs[i] >> rhs);
-	}
-	return result;
+	return hamon::detail::make_valarray_binary_expr<T, hamon::detail::valarray_shift_right>(
+		hamon::detail::make_valarray_closure(lhs),
+		hamon::detail::valarray_scalar_closure<T>(rhs));
 }
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<T>
-operator>>(typename valarray<T>::value_type const& lhs, valarray<T> const& rhs)
+template <typename R, typename T = hamon::detail::valarray_operand_value_t<R>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_binary_expr_t<T, hamon::detail::valarray_shift_right,
+	hamon::detail::valarray_scalar_closure<T>,
+	hamon::detail::valarray_closure_t<R>>
+operator>>(hamon::type_identity_t<T> const& lhs, R const& rhs)
 {
-	hamon::size_t const size = rhs.size();
-	valarray<T> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
-	{
-		result[i] = static_cast<T>(lhs >> rhs[i]);
-	}
-	return result;
+	return hamon::detail::make_valarray_binary_expr<T, hamon::detail::valarray_shift_right>(
+		hamon::detail::valarray_scalar_closure<T>(lhs),
+		hamon::detail::make_valarray_closure(rhs));
 }
 
 }	// namespace hamon
@@ -13,10 +13,17 @@
 #include <hamon/valarray/indirect_array_fwd.hpp>
 #include <hamon/valarray/mask_array_fwd.hpp>
 #include <hamon/valarray/slice_array_fwd.hpp>
+#include <hamon/valarray/detail/valarray_closure.hpp>
+#include <hamon/valarray/detail/valarray_expr.hpp>
+#include <hamon/valarray/detail/valarray_ops.hpp>
 
 #include <hamon/algorithm/copy_n.hpp>
 #include <hamon/algorithm/fill_n.hpp>
 #include <hamon/cstddef/size_t.hpp>
+#include <hamon/detail/exception_guard.hpp>
+#include <hamon/functional/bit_not.hpp>
+#include <hamon/functional/logical_not.hpp>
+#include <hamon/functional/negate.hpp>
 #include <hamon/memory/addressof.hpp>
 #include <hamon/memory/allocator.hpp>
 #include <hamon/memory/allocator_traits.hpp>
@@ -67,6 +74,53 @@ private:
 		}
 	}
 
+	// クロージャの各要素を評価しながら、1回のループで要素を構築する
+	template <typename Closure>
+	HAMON_CXX20_CONSTEXPR
+	void construct_from(Closure const& c)
+	{
+		hamon::size_t const size = c.size();
+		this->allocate(size);
+
+		Allocator allocator;
+		hamon::size_t i = 0;
+		auto guard = hamon::detail::make_exception_guard([&]() noexcept
+		{
+			hamon::detail::destroy_impl(allocator, m_data, m_data + i);
+			AllocTraits::deallocate(allocator, m_data, size);
+			m_data = nullptr;
+			m_size = 0;
+		});
+		for (; i < size; ++i)
+		{
+			AllocTraits::construct(allocator, m_data + i, c[i]);
+		}
+		guard.complete();
+	}
+
+	template <typename Closure>
+	HAMON_CXX20_CONSTEXPR
+	void assign_from(Closure const& c)
+	{
+		hamon::size_t const size = c.size();
+		if (this->size() != size)
+		{
+			// クロージャが *this を参照していることがあるので、
+			// 新しい領域で評価してから置き換える
+			valarray tmp;
+			tmp.construct_from(c);
+			this->swap(tmp);
+			return;
+		}
+
+		// [valarray.assign]/10
+		// 左辺の要素の値が、左辺の他の要素の値に依存する場合の動作は未定義
+		for (hamon::size_t i = 0; i < size; ++i)
+		{
+			m_data[i] = c[i];
+		}
+	}
+
 public:
 	using value_type = T;
 
@@ -117,25 +171,32 @@ public:
 	HAMON_CXX20_CONSTEXPR
 	valarray(slice_array<T> const& slicearr)
 	{
-		*this = slicearr;
+		this->construct_from(hamon::detail::valarray_array_ref_closure<slice_array<T>>(slicearr));
 	}
 
 	HAMON_CXX20_CONSTEXPR
 	valarray(gslice_array<T> const& gslicearr)
 	{
-		*this = gslicearr;
+		this->construct_from(hamon::detail::valarray_array_ref_closure<gslice_array<T>>(gslicearr));
 	}
 
 	HAMON_CXX20_CONSTEXPR
 	valarray(mask_array<T> const& maskarr)
 	{
-		*this = maskarr;
+		this->construct_from(hamon::detail::valarray_array_ref_closure<mask_array<T>>(maskarr));
 	}
 
 	HAMON_CXX20_CONSTEXPR
 	valarray(indirect_array<T> const& indarr)
 	{
-		*this = indarr;
+		this->construct_from(hamon::detail::valarray_array_ref_closure<indirect_array<T>>(indarr));
+	}
+
+	template <typename Closure>
+	HAMON_CXX20_CONSTEXPR
+	valarray(valarray_expr<T, Closure> const& e)
+	{
+		this->construct_from(e.closure());
 	}
 
 	HAMON_CXX20_CONSTEXPR
@@ -221,6 +282,14 @@ public:
 	HAMON_CXX20_CONSTEXPR valarray&
 	operator=(indirect_array<T> const& indarr);
 
+	template <typename Closure>
+	HAMON_CXX20_CONSTEXPR valarray&
+	operator=(valarray_expr<T, Closure> const& e)
+	{
+		this->assign_from(e.closure());
+		return *this;
+	}
+
 	// [valarray.access], element access
 	HAMON_NODISCARD HAMON_CXX20_CONSTEXPR T const&
 	operator[](hamon::size_t n) const HAMON_NOEXCEPT // noexcept as an extension
@@ -244,7 +313,7 @@ public:
 
 	// [valarray.sub], subset operations
 	HAMON_NODISCARD
-	HAMON_CXX20_CONSTEXPR valarray
+	HAMON_CXX20_CONSTEXPR valarray_expr<T, hamon::detail::valarray_slice_closure<T>>
 	operator[](slice slicearr) const;
 
 	HAMON_NODISCARD
@@ -252,7 +321,7 @@ public:
 	operator[](slice slicearr) HAMON_NOEXCEPT; // noexcept as an extension
 
 	HAMON_NODISCARD
-	HAMON_CXX20_CONSTEXPR valarray
+	HAMON_CXX20_CONSTEXPR valarray_expr<T, hamon::detail::valarray_indirect_closure<T>>
 	operator[](gslice const& gslicearr) const;
 
 	HAMON_NODISCARD
@@ -260,7 +329,7 @@ public:
 	operator[](gslice const& gslicearr);
 
 	HAMON_NODISCARD
-	HAMON_CXX20_CONSTEXPR valarray
+	HAMON_CXX20_CONSTEXPR valarray_expr<T, hamon::detail::valarray_indirect_closure<T>>
 	operator[](valarray<bool> const& boolarr) const;
 
 	HAMON_NODISCARD
@@ -268,7 +337,7 @@ public:
 	operator[](valarray<bool> const& boolarr);
 
 	HAMON_NODISCARD
-	HAMON_CXX20_CONSTEXPR valarray
+	HAMON_CXX20_CONSTEXPR valarray_expr<T, hamon::detail::valarray_indirect_closure<T>>
 	operator[](valarray<hamon::size_t> const& indarr) const;
 
 	HAMON_NODISCARD
@@ -277,55 +346,39 @@ public:
 
 	// [valarray.unary], unary operators
 	HAMON_NODISCARD	// nodiscard as an extension
-	HAMON_CXX20_CONSTEXPR valarray
+	HAMON_CXX20_CONSTEXPR
+	hamon::detail::valarray_unary_expr_t<T, hamon::detail::valarray_unary_plus, hamon::detail::valarray_ref_closure<T>>
 	operator+() const
 	{
-		hamon::size_t const size = m_size;
-		valarray<T> result(size);
-		for (hamon::size_t i = 0; i < size; ++i)
-		{
-			result[i] = +m_data[i];
-		}
-		return result;
+		return hamon::detail::make_valarray_unary_expr<T, hamon::detail::valarray_unary_plus>(
+			hamon::detail::valarray_ref_closure<T>(*this));
 	}
 
 	HAMON_NODISCARD	// nodiscard as an extension
-	HAMON_CXX20_CONSTEXPR valarray
+	HAMON_CXX20_CONSTEXPR
+	hamon::detail::valarray_unary_expr_t<T, hamon::negate<>, hamon::detail::valarray_ref_closure<T>>
 	operator-() const
 	{
-		hamon::size_t const size = m_size;
-		valarray<T> result(size);
-		for (hamon::size_t i = 0; i < size; ++i)
-		{
-			result[i] = -m_data[i];
-		}
-		return result;
+		return hamon::detail::make_valarray_unary_expr<T, hamon::negate<>>(
+			hamon::detail::valarray_ref_closure<T>(*this));
 	}
 
 	HAMON_NODISCARD	// nodiscard as an extension
-	HAMON_CXX20_CONSTEXPR valarray
+	HAMON_CXX20_CONSTEXPR
+	hamon::detail::valarray_unary_expr_t<T, hamon::bit_not<>, hamon::detail::valarray_ref_closure<T>>
 	operator~() const
 	{
-		hamon::size_t const size = m_size;
-		valarray<T> result(size);
-		for (hamon::size_t i = 0; i < size; ++i)
-		{
-			result[i] = ~m_data[i];
-		}
-		return result;
+		return hamon::detail::make_valarray_unary_expr<T, hamon::bit_not<>>(
+			hamon::detail::valarray_ref_closure<T>(*this));
 	}
 
 	HAMON_NODISCARD	// nodiscard as an extension
-	HAMON_CXX20_CONSTEXPR valarray<bool>
+	HAMON_CXX20_CONSTEXPR
+	hamon::detail::valarray_unary_expr_t<bool, hamon::logical_not<>, hamon::detail::valarray_ref_closure<T>>
 	operator!() const
 	{
-		hamon::size_t const size = m_size;
-		valarray<bool> result(size);
-		for (hamon::size_t i = 0; i < size; ++i)
-		{
-			result[i] = !m_data[i];
-		}
-		return result;
+		return hamon::detail::make_valarray_unary_expr<bool, hamon::logical_not<>>(
+			hamon::detail::valarray_ref_closure<T>(*this));
 	}
 
 	// [valarray.cassign], compound assignment
@@ -549,6 +602,126 @@ public:
 		return *this;
 	}
 
+	template <typename Closure>
+	HAMON_CXX20_CONSTEXPR valarray&
+	operator*=(valarray_expr<T, Closure> const& e)
+	{
+		hamon::size_t const size = m_size;
+		for (hamon::size_t i = 0; i < size; ++i)
+		{
+			m_data[i] *= e[i];
+		}
+		return *this;
+	}
+
+	template <typename Closure>
+	HAMON_CXX20_CONSTEXPR valarray&
+	operator/=(valarray_expr<T, Closure> const& e)
+	{
+		hamon::size_t const size = m_size;
+		for (hamon::size_t i = 0; i < size; ++i)
+		{
+			m_data[i] /= e[i];
+		}
+		return *this;
+	}
+
+	template <typename Closure>
+	HAMON_CXX20_CONSTEXPR valarray&
+	operator%=(valarray_expr<T, Closure> const& e)
+	{
+		hamon::size_t const size = m_size;
+		for (hamon::size_t i = 0; i < size; ++i)
+		{
+			m_data[i] %= e[i];
+		}
+		return *this;
+	}
+
+	template <typename Closure>
+	HAMON_CXX20_CONSTEXPR valarray&
+	operator+=(valarray_expr<T, Closure> const& e)
+	{
+		hamon::size_t const size = m_size;
+		for (hamon::size_t i = 0; i < size; ++i)
+		{
+			m_data[i] += e[i];
+		}
+		return *this;
+	}
+
+	template <typename Closure>
+	HAMON_CXX20_CONSTEXPR valarray&
+	operator-=(valarray_expr<T, Closure> const& e)
+	{
+		hamon::size_t const size = m_size;
+		for (hamon::size_t i = 0; i < size; ++i)
+		{
+			m_data[i] -= e[i];
+		}
+		return *this;
+	}
+
+	template <typename Closure>
+	HAMON_CXX20_CONSTEXPR valarray&
+	operator^=(valarray_expr<T, Closure> const& e)
+	{
+		hamon::size_t const size = m_size;
+		for (hamon::size_t i = 0; i < size; ++i)
+		{
+			m_data[i] ^= e[i];
+		}
+		return *this;
+	}
+
+	template <typename Closure>
+	HAMON_CXX20_CONSTEXPR valarray&
+	operator|=(valarray_expr<T, Closure> const& e)
+	{
+		hamon::size_t const size = m_size;
+		for (hamon::size_t i = 0; i < size; ++i)
+		{
+			m_data[i] |= e[i];
+		}
+		return *this;
+	}
+
+	template <typename Closure>
+	HAMON_CXX20_CONSTEXPR valarray&
+	operator&=(valarray_expr<T, Closure> const& e)
+	{
+		hamon::size_t const size = m_size;
+		for (hamon::size_t i = 0; i < size; ++i)
+		{
+			m_data[i] &= e[i];
+		}
+		return *this;
+	}
+
+	template <typename Closure>
+	HAMON_CXX20_CONSTEXPR valarray&
+	operator<<=(valarray_expr<T, Closure> const& e)
+	{
+		hamon::size_t const size = m_size;
+		for (hamon::size_t i = 0; i < size; ++i)
+		{
+			m_data[i] <<= e[i];
+		}
+		return *this;
+	}
+
+	template <typename Closure>
+	HAMON_CXX20_CONSTEXPR valarray&
+	operator>>=(valarray_expr<T, Closure> const& e)
+	{
+		hamon::size_t const size = m_size;
+		for (hamon::size_t i = 0; i < size; ++i)
+		{
+			m_data[i] >>= e[i];
+		}
+		return *this;
+	}
+
 	// [valarray.members], member functions
 	HAMON_CXX20_CONSTEXPR void
 	swap(valarray& v) HAMON_NOEXCEPT
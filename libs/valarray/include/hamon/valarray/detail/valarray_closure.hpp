@@ -0,0 +1,376 @@
+﻿/**
+ *	@file	valarray_closure.hpp
+ *
+ *	@brief	valarray の式テンプレートで使うクロージャの定義
+ */
+
+#ifndef HAMON_VALARRAY_DETAIL_VALARRAY_CLOSURE_HPP
+#define HAMON_VALARRAY_DETAIL_VALARRAY_CLOSURE_HPP
+
+#include <hamon/valarray/valarray_fwd.hpp>
+#include <hamon/valarray/gslice_array_fwd.hpp>
+#include <hamon/valarray/indirect_array_fwd.hpp>
+#include <hamon/valarray/mask_array_fwd.hpp>
+#include <hamon/valarray/slice_array_fwd.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/memory/addressof.hpp>
+#include <hamon/type_traits/enable_if.hpp>
+#include <hamon/type_traits/is_same.hpp>
+#include <hamon/utility/move.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+template <typename T, typename Closure>
+class valarray_expr;
+
+namespace detail
+{
+
+// クロージャは size() と operator[] を持ち、式の各要素を遅延評価する。
+// valarray や slice_array などのオペランドは参照で、
+// 部分式とスカラー値は値で保持する。
+
+// slice_array などの非公開メンバ size() と data(i) へのアクセス
+struct valarray_array_access
+{
+	template <typename A>
+	static HAMON_CXX20_CONSTEXPR hamon::size_t
+	size(A const& a) HAMON_NOEXCEPT
+	{
+		return a.size();
+	}
+
+	template <typename A>
+	static HAMON_CXX20_CONSTEXPR typename A::value_type const&
+	data(A const& a, hamon::size_t i) HAMON_NOEXCEPT
+	{
+		return a.data(i);
+	}
+};
+
+// valarray を参照するクロージャ
+template <typename T>
+class valarray_ref_closure
+{
+public:
+	using value_type = T;
+
+	explicit HAMON_CXX20_CONSTEXPR
+	valarray_ref_closure(valarray<T> const& v) HAMON_NOEXCEPT
+		: m_ptr(hamon::addressof(v))
+	{}
+
+	HAMON_CXX20_CONSTEXPR hamon::size_t
+	size() const HAMON_NOEXCEPT
+	{
+		return m_ptr->size();
+	}
+
+	HAMON_CXX20_CONSTEXPR T const&
+	operator[](hamon::size_t i) const HAMON_NOEXCEPT
+	{
+		return (*m_ptr)[i];
+	}
+
+private:
+	valarray<T> const* m_ptr;
+};
+
+// slice_array, gslice_array, mask_array, indirect_array を参照するクロージャ
+template <typename A>
+class valarray_array_ref_closure
+{
+public:
+	using value_type = typename A::value_type;
+
+	explicit HAMON_CXX20_CONSTEXPR
+	valarray_array_ref_closure(A const& a) HAMON_NOEXCEPT
+		: m_ptr(hamon::addressof(a))
+	{}
+
+	HAMON_CXX20_CONSTEXPR hamon::size_t
+	size() const HAMON_NOEXCEPT
+	{
+		return valarray_array_access::size(*m_ptr);
+	}
+
+	HAMON_CXX20_CONSTEXPR value_type const&
+	operator[](hamon::size_t i) const HAMON_NOEXCEPT
+	{
+		return valarray_array_access::data(*m_ptr, i);
+	}
+
+private:
+	A const* m_ptr;
+};
+
+// const な valarray の operator[](slice) の結果
+template <typename T>
+class valarray_slice_closure
+{
+public:
+	using value_type = T;
+
+	HAMON_CXX20_CONSTEXPR
+	valarray_slice_closure(
+		hamon::size_t start, hamon::size_t length, hamon::size_t stride, T const* ptr) HAMON_NOEXCEPT
+		: m_start(start), m_size(length), m_stride(stride), m_ptr(ptr)
+	{}
+
+	HAMON_CXX20_CONSTEXPR hamon::size_t
+	size() const HAMON_NOEXCEPT
+	{
+		return m_size;
+	}
+
+	HAMON_CXX20_CONSTEXPR T const&
+	operator[](hamon::size_t i) const HAMON_NOEXCEPT
+	{
+		return m_ptr[m_start + (i * m_stride)];
+	}
+
+private:
+	hamon::size_t m_start;
+	hamon::size_t m_size;
+	hamon::size_t m_stride;
+	T const* m_ptr;
+};
+
+// const な valarray の operator[](gslice), operator[](valarray<bool>),
+// operator[](valarray<size_t>) の結果
+//
+// IndArray は valarray<size_t> の定義より前に使えるようにするためのテンプレート引数
+template <typename T, typename IndArray = valarray<hamon::size_t>>
+class valarray_indirect_closure
+{
+public:
+	using value_type = T;
+
+	HAMON_CXX20_CONSTEXPR
+	valarray_indirect_closure(IndArray&& indarr, T const* ptr) HAMON_NOEXCEPT
+		: m_indarr(hamon::move(indarr)), m_ptr(ptr)
+	{}
+
+	HAMON_CXX20_CONSTEXPR hamon::size_t
+	size() const HAMON_NOEXCEPT
+	{
+		return m_indarr.size();
+	}
+
+	HAMON_CXX20_CONSTEXPR T const&
+	operator[](hamon::size_t i) const HAMON_NOEXCEPT
+	{
+		return m_ptr[m_indarr[i]];
+	}
+
+private:
+	IndArray m_indarr;
+	T const* m_ptr;
+};
+
+// 二項演算のスカラー側のオペランド
+template <typename T>
+class valarray_scalar_closure
+{
+public:
+	using value_type = T;
+
+	explicit HAMON_CXX20_CONSTEXPR
+	valarray_scalar_closure(T const& value)
+		: m_value(value)
+	{}
+
+	HAMON_CXX20_CONSTEXPR T const&
+	operator[](hamon::size_t) const HAMON_NOEXCEPT
+	{
+		return m_value;
+	}
+
+private:
+	T m_value;
+};
+
+template <typename L, typename R>
+HAMON_CXX20_CONSTEXPR hamon::size_t
+valarray_closure_size(L const& lhs, R const&) HAMON_NOEXCEPT
+{
+	return lhs.size();
+}
+
+template <typename T, typename R>
+HAMON_CXX20_CONSTEXPR hamon::size_t
+valarray_closure_size(valarray_scalar_closure<T> const&, R const& rhs) HAMON_NOEXCEPT
+{
+	return rhs.size();
+}
+
+template <typename T, typename Op, typename Closure>
+class valarray_unary_closure
+{
+public:
+	using value_type = T;
+
+	explicit HAMON_CXX20_CONSTEXPR
+	valarray_unary_closure(Closure const& c)
+		: m_closure(c)
+	{}
+
+	HAMON_CXX20_CONSTEXPR hamon::size_t
+	size() const HAMON_NOEXCEPT
+	{
+		return m_closure.size();
+	}
+
+	HAMON_CXX20_CONSTEXPR T
+	operator[](hamon::size_t i) const
+	{
+		return static_cast<T>(Op{}(m_closure[i]));
+	}
+
+private:
+	Closure m_closure;
+};
+
+template <typename T, typename Op, typename L, typename R>
+class valarray_binary_closure
+{
+public:
+	using value_type = T;
+
+	HAMON_CXX20_CONSTEXPR
+	valarray_binary_closure(L const& lhs, R const& rhs)
+		: m_lhs(lhs), m_rhs(rhs)
+	{}
+
+	HAMON_CXX20_CONSTEXPR hamon::size_t
+	size() const HAMON_NOEXCEPT
+	{
+		return valarray_closure_size(m_lhs, m_rhs);
+	}
+
+	HAMON_CXX20_CONSTEXPR T
+	operator[](hamon::size_t i) const
+	{
+		return static_cast<T>(Op{}(m_lhs[i], m_rhs[i]));
+	}
+
+private:
+	L m_lhs;
+	R m_rhs;
+};
+
+// 式のオペランドになれる型から、クロージャを作る
+template <typename V>
+struct valarray_operand
+{};
+
+template <typename T>
+struct valarray_operand<valarray<T>>
+{
+	using value_type = T;
+	using closure_type = valarray_ref_closure<T>;
+
+	static HAMON_CXX20_CONSTEXPR closure_type
+	make(valarray<T> const& v) HAMON_NOEXCEPT
+	{
+		return closure_type(v);
+	}
+};
+
+template <typename T, typename Closure>
+struct valarray_operand<hamon::valarray_expr<T, Closure>>
+{
+	using value_type = T;
+	using closure_type = Closure;
+
+	static HAMON_CXX20_CONSTEXPR closure_type const&
+	make(hamon::valarray_expr<T, Closure> const& e) HAMON_NOEXCEPT
+	{
+		return e.closure();
+	}
+};
+
+template <typename A>
+struct valarray_array_operand
+{
+	using value_type = typename A::value_type;
+	using closure_type = valarray_array_ref_closure<A>;
+
+	static HAMON_CXX20_CONSTEXPR closure_type
+	make(A const& a) HAMON_NOEXCEPT
+	{
+		return closure_type(a);
+	}
+};
+
+template <typename T>
+struct valarray_operand<slice_array<T>>
+	: public valarray_array_operand<slice_array<T>>
+{};
+
+template <typename T>
+struct valarray_operand<gslice_array<T>>
+	: public valarray_array_operand<gslice_array<T>>
+{};
+
+template <typename T>
+struct valarray_operand<mask_array<T>>
+	: public valarray_array_operand<mask_array<T>>
+{};
+
+template <typename T>
+struct valarray_operand<indirect_array<T>>
+	: public valarray_array_operand<indirect_array<T>>
+{};
+
+template <typename V>
+using valarray_operand_value_t = typename valarray_operand<V>::value_type;
+
+template <typename V>
+using valarray_closure_t = typename valarray_operand<V>::closure_type;
+
+// 要素の型が等しい2つのオペランドの、要素の型
+template <typename L, typename R>
+using valarray_common_value_t = hamon::enable_if_t<
+	hamon::is_same<valarray_operand_value_t<L>, valarray_operand_value_t<R>>::value,
+	valarray_operand_value_t<L>>;
+
+template <typename V>
+HAMON_CXX20_CONSTEXPR auto
+make_valarray_closure(V const& v) HAMON_NOEXCEPT
+->decltype(valarray_operand<V>::make(v))
+{
+	return valarray_operand<V>::make(v);
+}
+
+template <typename T, typename Op, typename Closure>
+using valarray_unary_expr_t =
+	hamon::valarray_expr<T, valarray_unary_closure<T, Op, Closure>>;
+
+template <typename T, typename Op, typename L, typename R>
+using valarray_binary_expr_t =
+	hamon::valarray_expr<T, valarray_binary_closure<T, Op, L, R>>;
+
+template <typename T, typename Op, typename Closure>
+HAMON_CXX20_CONSTEXPR valarray_unary_expr_t<T, Op, Closure>
+make_valarray_unary_expr(Closure const& c)
+{
+	return valarray_unary_expr_t<T, Op, Closure>(
+		valarray_unary_closure<T, Op, Closure>(c));
+}
+
+template <typename T, typename Op, typename L, typename R>
+HAMON_CXX20_CONSTEXPR valarray_binary_expr_t<T, Op, L, R>
+make_valarray_binary_expr(L const& lhs, R const& rhs)
+{
+	return valarray_binary_expr_t<T, Op, L, R>(
+		valarray_binary_closure<T, Op, L, R>(lhs, rhs));
+}
+
+}	// namespace detail
+
+}	// namespace hamon
+
+#endif // HAMON_VALARRAY_DETAIL_VALARRAY_CLOSURE_HPP
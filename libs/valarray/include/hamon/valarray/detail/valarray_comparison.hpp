@@ -7,324 +7,312 @@
 #ifndef HAMON_VALARRAY_DETAIL_VALARRAY_COMPARISON_HPP
 #define HAMON_VALARRAY_DETAIL_VALARRAY_COMPARISON_HPP
 
-#include <hamon/cstddef/size_t.hpp>
+#include <hamon/valarray/detail/valarray_closure.hpp>
+#include <hamon/valarray/detail/valarray_expr.hpp>
+#include <hamon/functional/equal_to.hpp>
+#include <hamon/functional/greater.hpp>
+#include <hamon/functional/greater_equal.hpp>
+#include <hamon/functional/less.hpp>
+#include <hamon/functional/less_equal.hpp>
+#include <hamon/functional/logical_and.hpp>
+#include <hamon/functional/logical_or.hpp>
+#include <hamon/functional/not_equal_to.hpp>
+#include <hamon/type_traits/type_identity.hpp>
 #include <hamon/config.hpp>
 
 namespace hamon
 {
 
 // 29.6.3.2 Logical operators[valarray.comparison]
+//
+// 演算の結果は valarray_expr として遅延評価される。
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<bool>
-operator&&(valarray<T> const& lhs, valarray<T> const& rhs)
+template <typename L, typename R, typename T = hamon::detail::valarray_common_value_t<L, R>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_binary_expr_t<bool, hamon::logical_and<>,
+	hamon::detail::valarray_closure_t<L>,
+	hamon::detail::valarray_closure_t<R>>
+operator&&(L const& lhs, R const& rhs)
 {
-	hamon::size_t const size = lhs.size();
-	valarray<bool> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
-	{
-		result[i] = (static_cast<bool>(lhs[i]) && static_cast<bool>(rhs[i]));
-	}
-	return result;
+	return hamon::detail::make_valarray_binary_expr<bool, hamon::logical_and<>>(
+		hamon::detail::make_valarray_closure(lhs),
+		hamon::detail::make_valarray_closure(rhs));
 }
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<bool>
-operator&&(valarray<T> const& lhs, typename valarray<T>::value_type const& rhs)
+template <typename L, typename T = hamon::detail::valarray_operand_value_t<L>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_binary_expr_t<bool, hamon::logical_and<>,
+	hamon::detail::valarray_closure_t<L>,
+	hamon::detail::valarray_scalar_closure<T>>
+operator&&(L const& lhs, hamon::type_identity_t<T> const& rhs)
 {
-	hamon::size_t const size = lhs.size();
-	valarray<bool> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
-	{
-		result[i] = (static_cast<bool>(lhs[i]) && static_cast<bool>(rhs));
-	}
-	return result;
+	return hamon::detail::make_valarray_binary_expr<bool, hamon::logical_and<>>(
+		hamon::detail::make_valarray_closure(lhs),
+		hamon::detail::valarray_scalar_closure<T>(rhs));
 }
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<bool>
-operator&&(typename valarray<T>::value_type const& lhs, valarray<T> const& rhs)
+template <typename R, typename T = hamon::detail::valarray_operand_value_t<R>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_binary_expr_t<bool, hamon::logical_and<>,
+	hamon::detail::valarray_scalar_closure<T>,
+	hamon::detail::valarray_closure_t<R>>
+operator&&(hamon::type_identity_t<T> const& lhs, R const& rhs)
 {
-	hamon::size_t const size = rhs.size();
-	valarray<bool> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
-	{
-		result[i] = (static_cast<bool>(lhs) && static_cast<bool>(rhs[i]));
-	}
-	return result;
+	return hamon::detail::make_valarray_binary_expr<bool, hamon::logical_and<>>(
+		hamon::detail::valarray_scalar_closure<T>(lhs),
+		hamon::detail::make_valarray_closure(rhs));
 }
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<bool>
-operator||(valarray<T> const& lhs, valarray<T> const& rhs)
+template <typename L, typename R, typename T = hamon::detail::valarray_common_value_t<L, R>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_binary_expr_t<bool, hamon::logical_or<>,
+	hamon::detail::valarray_closure_t<L>,
+	hamon::detail::valarray_closure_t<R>>
+operator||(L const& lhs, R const& rhs)
 {
-	hamon::size_t const size = lhs.size();
-	valarray<bool> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
-	{
-		result[i] = (static_cast<bool>(lhs[i]) || static_cast<bool>(rhs[i]));
-	}
-	return result;
+	return hamon::detail::make_valarray_binary_expr<bool, hamon::logical_or<>>(
+		hamon::detail::make_valarray_closure(lhs),
+		hamon::detail::make_valarray_closure(rhs));
 }
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<bool>
-operator||(valarray<T> const& lhs, typename valarray<T>::value_type const& rhs)
+template <typename L, typename T = hamon::detail::valarray_operand_value_t<L>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_binary_expr_t<bool, hamon::logical_or<>,
+	hamon::detail::valarray_closure_t<L>,
+	hamon::detail::valarray_scalar_closure<T>>
+operator||(L const& lhs, hamon::type_identity_t<T> const& rhs)
 {
-	hamon::size_t const size = lhs.size();
-	valarray<bool> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
-	{
-		result[i] = (static_cast<bool>(lhs[i]) || static_cast<bool>(rhs));
-	}
-	return result;
+	return hamon::detail::make_valarray_binary_expr<bool, hamon::logical_or<>>(
+		hamon::detail::make_valarray_closure(lhs),
+		hamon::detail::valarray_scalar_closure<T>(rhs));
 }
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<bool>
-operator||(typename valarray<T>::value_type const& lhs, valarray<T> const& rhs)
+template <typename R, typename T = hamon::detail::valarray_operand_value_t<R>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_binary_expr_t<bool, hamon::logical_or<>,
+	hamon::detail::valarray_scalar_closure<T>,
+	hamon::detail::valarray_closure_t<R>>
+operator||(hamon::type_identity_t<T> const& lhs, R const& rhs)
 {
-	hamon::size_t const size = rhs.size();
-	valarray<bool> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
-	{
-		result[i] = (static_cast<bool>(lhs) || static_cast<bool>(rhs[i]));
-	}
-	return result;
+	return hamon::detail::make_valarray_binary_expr<bool, hamon::logical_or<>>(
+		hamon::detail::valarray_scalar_closure<T>(lhs),
+		hamon::detail::make_valarray_closure(rhs));
 }
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<bool>
-operator==(valarray<T> const& lhs, valarray<T> const& rhs)
+template <typename L, typename R, typename T = hamon::detail::valarray_common_value_t<L, R>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_binary_expr_t<bool, hamon::equal_to<>,
+	hamon::detail::valarray_closure_t<L>,
+	hamon::detail::valarray_closure_t<R>>
+operator==(L const& lhs, R const& rhs)
 {
-	hamon::size_t const size = lhs.size();
-	valarray<bool> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
-	{
-		result[i] = (lhs[i] == rhs[i]);
-	}
-	return result;
+	return hamon::detail::make_valarray_binary_expr<bool, hamon::equal_to<>>(
+		hamon::detail::make_valarray_closure(lhs),
+		hamon::detail::make_valarray_closure(rhs));
 }
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<bool>
-operator==(valarray<T> const& lhs, typename valarray<T>::value_type const& rhs)
+template <typename L, typename T = hamon::detail::valarray_operand_value_t<L>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_binary_expr_t<bool, hamon::equal_to<>,
+	hamon::detail::valarray_closure_t<L>,
+	hamon::detail::valarray_scalar_closure<T>>
+operator==(L const& lhs, hamon::type_identity_t<T> const& rhs)
 {
-	hamon::size_t const size = lhs.size();
-	valarray<bool> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
-	{
-		result[i] = (lhs[i] == rhs);
-	}
-	return result;
+	return hamon::detail::make_valarray_binary_expr<bool, hamon::equal_to<>>(
+		hamon::detail::make_valarray_closure(lhs),
+		hamon::detail::valarray_scalar_closure<T>(rhs));
 }
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<bool>
-operator==(typename valarray<T>::value_type const& lhs, valarray<T> const& rhs)
+template <typename R, typename T = hamon::detail::valarray_operand_value_t<R>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_binary_expr_t<bool, hamon::equal_to<>,
+	hamon::detail::valarray_scalar_closure<T>,
+	hamon::detail::valarray_closure_t<R>>
+operator==(hamon::type_identity_t<T> const& lhs, R const& rhs)
 {
-	hamon::size_t const size = rhs.size();
-	valarray<bool> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
-	{
-		result[i] = (lhs == rhs[i]);
-	}
-	return result;
+	return hamon::detail::make_valarray_binary_expr<bool, hamon::equal_to<>>(
+		hamon::detail::valarray_scalar_closure<T>(lhs),
+		hamon::detail::make_valarray_closure(rhs));
 }
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<bool>
-operator!=(valarray<T> const& lhs, valarray<T> const& rhs)
+template <typename L, typename R, typename T = hamon::detail::valarray_common_value_t<L, R>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_binary_expr_t<bool, hamon::not_equal_to<>,
+	hamon::detail::valarray_closure_t<L>,
+	hamon::detail::valarray_closure_t<R>>
+operator!=(L const& lhs, R const& rhs)
 {
-	hamon::size_t const size = lhs.size();
-	valarray<bool> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
-	{
-		result[i] = (lhs[i] != rhs[i]);
-	}
-	return result;
+	return hamon::detail::make_valarray_binary_expr<bool, hamon::not_equal_to<>>(
+		hamon::detail::make_valarray_closure(lhs),
+		hamon::detail::make_valarray_closure(rhs));
 }
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<bool>
-operator!=(valarray<T> const& lhs, typename valarray<T>::value_type const& rhs)
+template <typename L, typename T = hamon::detail::valarray_operand_value_t<L>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_binary_expr_t<bool, hamon::not_equal_to<>,
+	hamon::detail::valarray_closure_t<L>,
+	hamon::detail::valarray_scalar_closure<T>>
+operator!=(L const& lhs, hamon::type_identity_t<T> const& rhs)
 {
-	hamon::size_t const size = lhs.size();
-	valarray<bool> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
-	{
-		result[i] = (lhs[i] != rhs);
-	}
-	return result;
+	return hamon::detail::make_valarray_binary_expr<bool, hamon::not_equal_to<>>(
+		hamon::detail::make_valarray_closure(lhs),
+		hamon::detail::valarray_scalar_closure<T>(rhs));
 }
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<bool>
-operator!=(typename valarray<T>::value_type const& lhs, valarray<T> const& rhs)
+template <typename R, typename T = hamon::detail::valarray_operand_value_t<R>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_binary_expr_t<bool, hamon::not_equal_to<>,
+	hamon::detail::valarray_scalar_closure<T>,
+	hamon::detail::valarray_closure_t<R>>
+operator!=(hamon::type_identity_t<T> const& lhs, R const& rhs)
 {
-	hamon::size_t const size = rhs.size();
-	valarray<bool> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
-	{
-		result[i] = (lhs != rhs[i]);
-	}
-	return result;
+	return hamon::detail::make_valarray_binary_expr<bool, hamon::not_equal_to<>>(
+		hamon::detail::valarray_scalar_closure<T>(lhs),
+		hamon::detail::make_valarray_closure(rhs));
 }
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<bool>
-operator<(valarray<T> const& lhs, valarray<T> const& rhs)
+template <typename L, typename R, typename T = hamon::detail::valarray_common_value_t<L, R>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_binary_expr_t<bool, hamon::less<>,
+	hamon::detail::valarray_closure_t<L>,
+	hamon::detail::valarray_closure_t<R>>
+operator<(L const& lhs, R const& rhs)
 {
-	hamon::size_t const size = lhs.size();
-	valarray<bool> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
-	{
-		result[i] = (lhs[i] < rhs[i]);
-	}
-	return result;
+	return hamon::detail::make_valarray_binary_expr<bool, hamon::less<>>(
+		hamon::detail::make_valarray_closure(lhs),
+		hamon::detail::make_valarray_closure(rhs));
 }
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<bool>
-operator<(valarray<T> const& lhs, typename valarray<T>::value_type const& rhs)
+template <typename L, typename T = hamon::detail::valarray_operand_value_t<L>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_binary_expr_t<bool, hamon::less<>,
+	hamon::detail::valarray_closure_t<L>,
+	hamon::detail::valarray_scalar_closure<T>>
+operator<(L const& lhs, hamon::type_identity_t<T> const& rhs)
 {
-	hamon::size_t const size = lhs.size();
-	valarray<bool> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
-	{
-		result[i] = (lhs[i] < rhs);
-	}
-	return result;
+	return hamon::detail::make_valarray_binary_expr<bool, hamon::less<>>(
+		hamon::detail::make_valarray_closure(lhs),
+		hamon::detail::valarray_scalar_closure<T>(rhs));
 }
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<bool>
-operator<(typename valarray<T>::value_type const& lhs, valarray<T> const& rhs)
+template <typename R, typename T = hamon::detail::valarray_operand_value_t<R>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_binary_expr_t<bool, hamon::less<>,
+	hamon::detail::valarray_scalar_closure<T>,
+	hamon::detail::valarray_closure_t<R>>
+operator<(hamon::type_identity_t<T> const& lhs, R const& rhs)
 {
-	hamon::size_t const size = rhs.size();
-	valarray<bool> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
-	{
-		result[i] = (lhs < rhs[i]);
-	}
-	return result;
+	return hamon::detail::make_valarray_binary_expr<bool, hamon::less<>>(
+		hamon::detail::valarray_scalar_closure<T>(lhs),
+		hamon::detail::make_valarray_closure(rhs));
 }
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<bool>
-operator>(valarray<T> const& lhs, valarray<T> const& rhs)
+template <typename L, typename R, typename T = hamon::detail::valarray_common_value_t<L, R>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_binary_expr_t<bool, hamon::greater<>,
+	hamon::detail::valarray_closure_t<L>,
+	hamon::detail::valarray_closure_t<R>>
+operator>(L const& lhs, R const& rhs)
 {
-	hamon::size_t const size = lhs.size();
-	valarray<bool> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
-	{
-		result[i] = (lhs[i] > rhs[i]);
-	}
-	return result;
+	return hamon::detail::make_valarray_binary_expr<bool, hamon::greater<>>(
+		hamon::detail::make_valarray_closure(lhs),
+		hamon::detail::make_valarray_closure(rhs));
 }
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<bool>
-operator>(valarray<T> const& lhs, typename valarray<T>::value_type const& rhs)
+template <typename L, typename T = hamon::detail::valarray_operand_value_t<L>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_binary_expr_t<bool, hamon::greater<>,
+	hamon::detail::valarray_closure_t<L>,
+	hamon::detail::valarray_scalar_closure<T>>
+operator>(L const& lhs, hamon::type_identity_t<T> const& rhs)
 {
-	hamon::size_t const size = lhs.size();
-	valarray<bool> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
-	{
-		result[i] = (lhs[i] > rhs);
-	}
-	return result;
+	return hamon::detail::make_valarray_binary_expr<bool, hamon::greater<>>(
+		hamon::detail::make_valarray_closure(lhs),
+		hamon::detail::valarray_scalar_closure<T>(rhs));
 }
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<bool>
-operator>(typename valarray<T>::value_type const& lhs, valarray<T> const& rhs)
+template <typename R, typename T = hamon::detail::valarray_operand_value_t<R>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_binary_expr_t<bool, hamon::greater<>,
+	hamon::detail::valarray_scalar_closure<T>,
+	hamon::detail::valarray_closure_t<R>>
+operator>(hamon::type_identity_t<T> const& lhs, R const& rhs)
 {
-	hamon::size_t const size = rhs.size();
-	valarray<bool> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
-	{
-		result[i] = (lhs > rhs[i]);
-	}
-	return result;
+	return hamon::detail::make_valarray_binary_expr<bool, hamon::greater<>>(
+		hamon::detail::valarray_scalar_closure<T>(lhs),
+		hamon::detail::make_valarray_closure(rhs));
 }
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<bool>
-operator<=(valarray<T> const& lhs, valarray<T> const& rhs)
+template <typename L, typename R, typename T = hamon::detail::valarray_common_value_t<L, R>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_binary_expr_t<bool, hamon::less_equal<>,
+	hamon::detail::valarray_closure_t<L>,
+	hamon::detail::valarray_closure_t<R>>
+operator<=(L const& lhs, R const& rhs)
 {
-	hamon::size_t const size = lhs.size();
-	valarray<bool> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
-	{
-		result[i] = (lhs[i] <= rhs[i]);
-	}
-	return result;
+	return hamon::detail::make_valarray_binary_expr<bool, hamon::less_equal<>>(
+		hamon::detail::make_valarray_closure(lhs),
+		hamon::detail::make_valarray_closure(rhs));
 }
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<bool>
-operator<=(valarray<T> const& lhs, typename valarray<T>::value_type const& rhs)
+template <typename L, typename T = hamon::detail::valarray_operand_value_t<L>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_binary_expr_t<bool, hamon::less_equal<>,
+	hamon::detail::valarray_closure_t<L>,
+	hamon::detail::valarray_scalar_closure<T>>
+operator<=(L const& lhs, hamon::type_identity_t<T> const& rhs)
 {
-	hamon::size_t const size = lhs.size();
-	valarray<bool> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
-	{
-		result[i] = (lhs[i] <= rhs);
-	}
-	return result;
+	return hamon::detail::make_valarray_binary_expr<bool, hamon::less_equal<>>(
+		hamon::detail::make_valarray_closure(lhs),
+		hamon::detail::valarray_scalar_closure<T>(rhs));
 }
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<bool>
-operator<=(typename valarray<T>::value_type const& lhs, valarray<T> const& rhs)
+template <typename R, typename T = hamon::detail::valarray_operand_value_t<R>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_binary_expr_t<bool, hamon::less_equal<>,
+	hamon::detail::valarray_scalar_closure<T>,
+	hamon::detail::valarray_closure_t<R>>
+operator<=(hamon::type_identity_t<T> const& lhs, R const& rhs)
 {
-	hamon::size_t const size = rhs.size();
-	valarray<bool> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
-	{
-		result[i] = (lhs <= rhs[i]);
-	}
-	return result;
+	return hamon::detail::make_valarray_binary_expr<bool, hamon::less_equal<>>(
+		hamon::detail::valarray_scalar_closure<T>(lhs),
+		hamon::detail::make_valarray_closure(rhs));
 }
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<bool>
-operator>=(valarray<T> const& lhs, valarray<T> const& rhs)
+template <typename L, typename R, typename T = hamon::detail::valarray_common_value_t<L, R>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_binary_expr_t<bool, hamon::greater_equal<>,
+	hamon::detail::valarray_closure_t<L>,
+	hamon::detail::valarray_closure_t<R>>
+operator>=(L const& lhs, R const& rhs)
 {
-	hamon::size_t const size = lhs.size();
-	valarray<bool> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
-	{
-		result[i] = (lhs[i] >= rhs[i]);
-	}
-	return result;
+	return hamon::detail::make_valarray_binary_expr<bool, hamon::greater_equal<>>(
+		hamon::detail::make_valarray_closure(lhs),
+		hamon::detail::make_valarray_closure(rhs));
 }
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<bool>
-operator>=(valarray<T> const& lhs, typename valarray<T>::value_type const& rhs)
+template <typename L, typename T = hamon::detail::valarray_operand_value_t<L>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_binary_expr_t<bool, hamon::greater_equal<>,
+	hamon::detail::valarray_closure_t<L>,
+	hamon::detail::valarray_scalar_closure<T>>
+operator>=(L const& lhs, hamon::type_identity_t<T> const& rhs)
 {
-	hamon::size_t const size = lhs.size();
-	valarray<bool> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
-	{
-		result[i] = (lhs[i] >= rhs);
-	}
-	return result;
+	return hamon::detail::make_valarray_binary_expr<bool, hamon::greater_equal<>>(
+		hamon::detail::make_valarray_closure(lhs),
+		hamon::detail::valarray_scalar_closure<T>(rhs));
 }
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<bool>
-operator>=(typename valarray<T>::value_type const& lhs, valarray<T> const& rhs)
+template <typename R, typename T = hamon::detail::valarray_operand_value_t<R>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_binary_expr_t<bool, hamon::greater_equal<>,
+	hamon::detail::valarray_scalar_closure<T>,
+	hamon::detail::valarray_closure_t<R>>
+operator>=(hamon::type_identity_t<T> const& lhs, R const& rhs)
 {
-	hamon::size_t const size = rhs.size();
-	valarray<bool> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
-	{
-		result[i] = (lhs >= rhs[i]);
-	}
-	return result;
+	return hamon::detail::make_valarray_binary_expr<bool, hamon::greater_equal<>>(
+		hamon::detail::valarray_scalar_closure<T>(lhs),
+		hamon::detail::make_valarray_closure(rhs));
 }
 
 }	// namespace hamon
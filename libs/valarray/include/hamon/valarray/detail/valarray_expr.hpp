@@ -0,0 +1,202 @@
+﻿/**
+ *	@file	valarray_expr.hpp
+ *
+ *	@brief	valarray_expr の定義
+ */
+
+#ifndef HAMON_VALARRAY_DETAIL_VALARRAY_EXPR_HPP
+#define HAMON_VALARRAY_DETAIL_VALARRAY_EXPR_HPP
+
+#include <hamon/valarray/detail/valarray_closure.hpp>
+#include <hamon/valarray/detail/valarray_ops.hpp>
+#include <hamon/valarray/valarray_fwd.hpp>
+#include <hamon/valarray/gslice_fwd.hpp>
+#include <hamon/valarray/slice_fwd.hpp>
+#include <hamon/functional/bit_not.hpp>
+#include <hamon/functional/logical_not.hpp>
+#include <hamon/functional/negate.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/assert.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+// 29.6.1 [valarray.syn]/3
+//
+// valarray<T> を返す関数は、valarray<T> の const メンバ関数を全て持ち
+// valarray<T> に変換できる別の型を返してもよい。
+//
+// valarray_expr は演算の結果を保持せず、要素にアクセスされた時に計算する。
+// 式全体は、valarray に変換(代入)される時に1回のループで評価される。
+// オペランドを参照で保持するため、式の評価はオペランドの寿命内で行うこと。
+template <typename T, typename Closure>
+class valarray_expr
+{
+public:
+	using value_type = T;
+
+	explicit HAMON_CXX20_CONSTEXPR
+	valarray_expr(Closure const& c)
+		: m_closure(c)
+	{}
+
+	HAMON_NODISCARD HAMON_CXX20_CONSTEXPR T
+	operator[](hamon::size_t i) const
+	{
+		HAMON_ASSERT(i < this->size());
+		return m_closure[i];
+	}
+
+	HAMON_NODISCARD
+	HAMON_CXX20_CONSTEXPR valarray<T>
+	operator[](slice slicearr) const;
+
+	HAMON_NODISCARD
+	HAMON_CXX20_CONSTEXPR valarray<T>
+	operator[](gslice const& gslicearr) const;
+
+	HAMON_NODISCARD
+	HAMON_CXX20_CONSTEXPR valarray<T>
+	operator[](valarray<bool> const& boolarr) const;
+
+	HAMON_NODISCARD
+	HAMON_CXX20_CONSTEXPR valarray<T>
+	operator[](valarray<hamon::size_t> const& indarr) const;
+
+	HAMON_NODISCARD	// nodiscard as an extension
+	HAMON_CXX20_CONSTEXPR hamon::size_t
+	size() const HAMON_NOEXCEPT	// noexcept as an extension
+	{
+		return m_closure.size();
+	}
+
+	HAMON_NODISCARD	// nodiscard as an extension
+	HAMON_CXX20_CONSTEXPR T
+	sum() const
+	{
+		HAMON_ASSERT(this->size() > 0u);
+
+		hamon::size_t const size = this->size();
+		T result = m_closure[0];
+		for (hamon::size_t i = 1; i < size; ++i)
+		{
+			result += m_closure[i];
+		}
+
+		return result;
+	}
+
+	HAMON_NODISCARD	// nodiscard as an extension
+	HAMON_CXX20_CONSTEXPR T
+	min() const
+	{
+		HAMON_ASSERT(this->size() > 0u);
+
+		hamon::size_t const size = this->size();
+		T result = m_closure[0];
+		for (hamon::size_t i = 1; i < size; ++i)
+		{
+			T const x = m_closure[i];
+			if (x < result)
+			{
+				result = x;
+			}
+		}
+
+		return result;
+	}
+
+	HAMON_NODISCARD	// nodiscard as an extension
+	HAMON_CXX20_CONSTEXPR T
+	max() const
+	{
+		HAMON_ASSERT(this->size() > 0u);
+
+		hamon::size_t const size = this->size();
+		T result = m_closure[0];
+		for (hamon::size_t i = 1; i < size; ++i)
+		{
+			T const x = m_closure[i];
+			if (result < x)
+			{
+				result = x;
+			}
+		}
+
+		return result;
+	}
+
+	HAMON_NODISCARD	// nodiscard as an extension
+	HAMON_CXX20_CONSTEXPR valarray<T>
+	shift(int n) const
+	{
+		return valarray<T>(*this).shift(n);
+	}
+
+	HAMON_NODISCARD	// nodiscard as an extension
+	HAMON_CXX20_CONSTEXPR valarray<T>
+	cshift(int n) const
+	{
+		return valarray<T>(*this).cshift(n);
+	}
+
+	HAMON_NODISCARD	// nodiscard as an extension
+	HAMON_CXX20_CONSTEXPR valarray<T>
+	apply(T func(T)) const
+	{
+		return valarray<T>(*this).apply(func);
+	}
+
+	HAMON_NODISCARD	// nodiscard as an extension
+	HAMON_CXX20_CONSTEXPR valarray<T>
+	apply(T func(T const&)) const
+	{
+		return valarray<T>(*this).apply(func);
+	}
+
+	HAMON_NODISCARD	// nodiscard as an extension
+	HAMON_CXX20_CONSTEXPR
+	hamon::detail::valarray_unary_expr_t<T, hamon::detail::valarray_unary_plus, Closure>
+	operator+() const
+	{
+		return hamon::detail::make_valarray_unary_expr<T, hamon::detail::valarray_unary_plus>(m_closure);
+	}
+
+	HAMON_NODISCARD	// nodiscard as an extension
+	HAMON_CXX20_CONSTEXPR
+	hamon::detail::valarray_unary_expr_t<T, hamon::negate<>, Closure>
+	operator-() const
+	{
+		return hamon::detail::make_valarray_unary_expr<T, hamon::negate<>>(m_closure);
+	}
+
+	HAMON_NODISCARD	// nodiscard as an extension
+	HAMON_CXX20_CONSTEXPR
+	hamon::detail::valarray_unary_expr_t<T, hamon::bit_not<>, Closure>
+	operator~() const
+	{
+		return hamon::detail::make_valarray_unary_expr<T, hamon::bit_not<>>(m_closure);
+	}
+
+	HAMON_NODISCARD	// nodiscard as an extension
+	HAMON_CXX20_CONSTEXPR
+	hamon::detail::valarray_unary_expr_t<bool, hamon::logical_not<>, Closure>
+	operator!() const
+	{
+		return hamon::detail::make_valarray_unary_expr<bool, hamon::logical_not<>>(m_closure);
+	}
+
+	HAMON_CXX20_CONSTEXPR Closure const&
+	closure() const HAMON_NOEXCEPT
+	{
+		return m_closure;
+	}
+
+private:
+	Closure m_closure;
+};
+
+}	// namespace hamon
+
+#endif // HAMON_VALARRAY_DETAIL_VALARRAY_EXPR_HPP
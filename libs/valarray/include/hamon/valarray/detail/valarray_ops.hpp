@@ -0,0 +1,54 @@
+﻿/**
+ *	@file	valarray_ops.hpp
+ *
+ *	@brief	valarray の式テンプレートで使う関数オブジェクトの定義
+ */
+
+#ifndef HAMON_VALARRAY_DETAIL_VALARRAY_OPS_HPP
+#define HAMON_VALARRAY_DETAIL_VALARRAY_OPS_HPP
+
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+namespace detail
+{
+
+// <functional> に対応するものが無い演算
+
+struct valarray_unary_plus
+{
+	template <typename T>
+	HAMON_CONSTEXPR auto operator()(T const& x) const
+	->decltype(+x)
+	{
+		return +x;
+	}
+};
+
+struct valarray_shift_left
+{
+	template <typename T, typename U>
+	HAMON_CONSTEXPR auto operator()(T const& lhs, U const& rhs) const
+	->decltype(lhs << rhs)
+	{
+		return lhs << rhs;
+	}
+};
+
+struct valarray_shift_right
+{
+	template <typename T, typename U>
+	HAMON_CONSTEXPR auto operator()(T const& lhs, U const& rhs) const
+	->decltype(lhs >> rhs)
+	{
+		return lhs >> rhs;
+	}
+};
+
+}	// namespace detail
+
+}	// namespace hamon
+
+#endif // HAMON_VALARRAY_DETAIL_VALARRAY_OPS_HPP
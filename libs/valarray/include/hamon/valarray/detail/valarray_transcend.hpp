@@ -7,6 +7,8 @@
 #ifndef HAMON_VALARRAY_DETAIL_VALARRAY_TRANSCEND_HPP
 #define HAMON_VALARRAY_DETAIL_VALARRAY_TRANSCEND_HPP
 
+#include <hamon/valarray/detail/valarray_closure.hpp>
+#include <hamon/valarray/detail/valarray_expr.hpp>
 #include <hamon/cmath/abs.hpp>
 #include <hamon/cmath/acos.hpp>
 #include <hamon/cmath/asin.hpp>
@@ -23,272 +25,391 @@
 #include <hamon/cmath/sqrt.hpp>
 #include <hamon/cmath/tan.hpp>
 #include <hamon/cmath/tanh.hpp>
-#include <hamon/cstddef/size_t.hpp>
+#include <hamon/type_traits/type_identity.hpp>
 #include <hamon/config.hpp>
 
 namespace hamon
 {
 
-// 29.6.3.3 Transcendentals[valarray.transcend]
+namespace detail
+{
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<T>
-abs(valarray<T> const& x)
+struct valarray_abs_fn
 {
-	hamon::size_t const size = x.size();
-	valarray<T> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
+	template <typename T>
+	HAMON_CXX20_CONSTEXPR T operator()(T const& x) const
 	{
-		result[i] = abs(x[i]);
+		using hamon::abs;
+		return static_cast<T>(abs(x));
 	}
-	return result;
-}
+};
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<T>
-acos(valarray<T> const& x)
+struct valarray_acos_fn
 {
-	hamon::size_t const size = x.size();
-	valarray<T> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
+	template <typename T>
+	HAMON_CXX20_CONSTEXPR T operator()(T const& x) const
 	{
-		result[i] = acos(x[i]);
+		using hamon::acos;
+		return static_cast<T>(acos(x));
 	}
-	return result;
-}
+};
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<T>
-asin(valarray<T> const& x)
+struct valarray_asin_fn
 {
-	hamon::size_t const size = x.size();
-	valarray<T> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
+	template <typename T>
+	HAMON_CXX20_CONSTEXPR T operator()(T const& x) const
 	{
-		result[i] = asin(x[i]);
+		using hamon::asin;
+		return static_cast<T>(asin(x));
 	}
-	return result;
-}
+};
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<T>
-atan(valarray<T> const& x)
+struct valarray_atan_fn
 {
-	hamon::size_t const size = x.size();
-	valarray<T> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
+	template <typename T>
+	HAMON_CXX20_CONSTEXPR T operator()(T const& x) const
 	{
-		result[i] = atan(x[i]);
+		using hamon::atan;
+		return static_cast<T>(atan(x));
 	}
-	return result;
-}
+};
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<T>
-atan2(valarray<T> const& x, valarray<T> const& y)
+struct valarray_atan2_fn
 {
-	hamon::size_t const size = x.size();
-	valarray<T> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
+	template <typename T>
+	HAMON_CXX20_CONSTEXPR T operator()(T const& x, T const& y) const
 	{
-		result[i] = atan2(x[i], y[i]);
+		using hamon::atan2;
+		return static_cast<T>(atan2(x, y));
 	}
-	return result;
-}
+};
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<T>
-atan2(valarray<T> const& x, typename valarray<T>::value_type const& y)
+struct valarray_cos_fn
 {
-	hamon::size_t const size = x.size();
-	valarray<T> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
+	template <typename T>
+	HAMON_CXX20_CONSTEXPR T operator()(T const& x) const
 	{
-		result[i] = atan2(x[i], y);
+		using hamon::cos;
+		return static_cast<T>(cos(x));
 	}
-	return result;
-}
+};
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<T>
-atan2(typename valarray<T>::value_type const& x, valarray<T> const& y)
+struct valarray_cosh_fn
 {
-	hamon::size_t const size = y.size();
-	valarray<T> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
+	template <typename T>
+	HAMON_CXX20_CONSTEXPR T operator()(T const& x) const
 	{
-		result[i] = atan2(x, y[i]);
+		using hamon::cosh;
+		return static_cast<T>(cosh(x));
 	}
-	return result;
-}
+};
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<T>
-cos(valarray<T> const& x)
+struct valarray_exp_fn
 {
-	hamon::size_t const size = x.size();
-	valarray<T> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
+	template <typename T>
+	HAMON_CXX20_CONSTEXPR T operator()(T const& x) const
 	{
-		result[i] = cos(x[i]);
+		using hamon::exp;
+		return static_cast<T>(exp(x));
 	}
-	return result;
-}
+};
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<T>
-cosh(valarray<T> const& x)
+struct valarray_log_fn
 {
-	hamon::size_t const size = x.size();
-	valarray<T> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
+	template <typename T>
+	HAMON_CXX20_CONSTEXPR T operator()(T const& x) const
 	{
-		result[i] = cosh(x[i]);
+		using hamon::log;
+		return static_cast<T>(log(x));
 	}
-	return result;
-}
+};
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<T>
-exp(valarray<T> const& x)
+struct valarray_log10_fn
 {
-	hamon::size_t const size = x.size();
-	valarray<T> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
+	template <typename T>
+	HAMON_CXX20_CONSTEXPR T operator()(T const& x) const
 	{
-		result[i] = exp(x[i]);
+		using hamon::log10;
+		return static_cast<T>(log10(x));
 	}
-	return result;
-}
+};
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<T>
-log(valarray<T> const& x)
+struct valarray_pow_fn
 {
-	hamon::size_t const size = x.size();
-	valarray<T> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
+	template <typename T>
+	HAMON_CXX20_CONSTEXPR T operator()(T const& x, T const& y) const
 	{
-		result[i] = log(x[i]);
+		using hamon::pow;
+		return static_cast<T>(pow(x, y));
 	}
-	return result;
-}
+};
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<T>
-log10(valarray<T> const& x)
+struct valarray_sin_fn
 {
-	hamon::size_t const size = x.size();
-	valarray<T> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
+	template <typename T>
+	HAMON_CXX20_CONSTEXPR T operator()(T const& x) const
 	{
-		result[i] = log10(x[i]);
+		using hamon::sin;
+		return static_cast<T>(sin(x));
 	}
-	return result;
-}
+};
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<T>
-pow(valarray<T> const& x, valarray<T> const& y)
+struct valarray_sinh_fn
 {
-	hamon::size_t const size = x.size();
-	valarray<T> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
+	template <typename T>
+	HAMON_CXX20_CONSTEXPR T operator()(T const& x) const
 	{
-		result[i] = pow(x[i], y[i]);
+		using hamon::sinh;
+		return static_cast<T>(sinh(x));
 	}
-	return result;
-}
+};
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<T>
-pow(valarray<T> const& x, typename valarray<T>::value_type const& y)
+struct valarray_sqrt_fn
 {
-	hamon::size_t const size = x.size();
-	valarray<T> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
+	template <typename T>
+	HAMON_CXX20_CONSTEXPR T operator()(T const& x) const
 	{
-		result[i] = pow(x[i], y);
+		using hamon::sqrt;
+		return static_cast<T>(sqrt(x));
 	}
-	return result;
-}
+};
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<T>
-pow(typename valarray<T>::value_type const& x, valarray<T> const& y)
+struct valarray_tan_fn
 {
-	hamon::size_t const size = y.size();
-	valarray<T> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
+	template <typename T>
+	HAMON_CXX20_CONSTEXPR T operator()(T const& x) const
 	{
-		result[i] = pow(x, y[i]);
+		using hamon::tan;
+		return static_cast<T>(tan(x));
 	}
-	return result;
-}
+};
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<T>
-sin(valarray<T> const& x)
+struct valarray_tanh_fn
 {
-	hamon::size_t const size = x.size();
-	valarray<T> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
+	template <typename T>
+	HAMON_CXX20_CONSTEXPR T operator()(T const& x) const
 	{
-		result[i] = sin(x[i]);
+		using hamon::tanh;
+		return static_cast<T>(tanh(x));
 	}
-	return result;
+};
+
+}	// namespace detail
+
+// 29.6.3.3 Transcendentals[valarray.transcend]
+//
+// 演算の結果は valarray_expr として遅延評価される。
+
+template <typename X, typename T = hamon::detail::valarray_operand_value_t<X>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_unary_expr_t<T, hamon::detail::valarray_abs_fn,
+	hamon::detail::valarray_closure_t<X>>
+abs(X const& x)
+{
+	return hamon::detail::make_valarray_unary_expr<T, hamon::detail::valarray_abs_fn>(
+		hamon::detail::make_valarray_closure(x));
 }
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<T>
-sinh(valarray<T> const& x)
+template <typename X, typename T = hamon::detail::valarray_operand_value_t<X>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_unary_expr_t<T, hamon::detail::valarray_acos_fn,
+	hamon::detail::valarray_closure_t<X>>
+acos(X const& x)
 {
-	hamon::size_t const size = x.size();
-	valarray<T> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
-	{
-		result[i] = sinh(x[i]);
-	}
-	return result;
+	return hamon::detail::make_valarray_unary_expr<T, hamon::detail::valarray_acos_fn>(
+		hamon::detail::make_valarray_closure(x));
 }
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<T>
-sqrt(valarray<T> const& x)
+template <typename X, typename T = hamon::detail::valarray_operand_value_t<X>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_unary_expr_t<T, hamon::detail::valarray_asin_fn,
+	hamon::detail::valarray_closure_t<X>>
+asin(X const& x)
 {
-	hamon::size_t const size = x.size();
-	valarray<T> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
-	{
-		result[i] = sqrt(x[i]);
-	}
-	return result;
+	return hamon::detail::make_valarray_unary_expr<T, hamon::detail::valarray_asin_fn>(
+		hamon::detail::make_valarray_closure(x));
 }
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<T>
-tan(valarray<T> const& x)
+template <typename X, typename T = hamon::detail::valarray_operand_value_t<X>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_unary_expr_t<T, hamon::detail::valarray_atan_fn,
+	hamon::detail::valarray_closure_t<X>>
+atan(X const& x)
 {
-	hamon::size_t const size = x.size();
-	valarray<T> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
-	{
-		result[i] = tan(x[i]);
-	}
-	return result;
+	return hamon::detail::make_valarray_unary_expr<T, hamon::detail::valarray_atan_fn>(
+		hamon::detail::make_valarray_closure(x));
 }
 
-template <typename T>
-HAMON_NODISCARD HAMON_CXX20_CONSTEXPR valarray<T>
-tanh(valarray<T> const& x)
+template <typename L, typename R, typename T = hamon::detail::valarray_common_value_t<L, R>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_binary_expr_t<T, hamon::detail::valarray_atan2_fn,
+	hamon::detail::valarray_closure_t<L>,
+	hamon::detail::valarray_closure_t<R>>
+atan2(L const& x, R const& y)
 {
-	hamon::size_t const size = x.size();
-	valarray<T> result(size);
-	for (hamon::size_t i = 0; i < size; ++i)
-	{
-		result[i] = tanh(x[i]);
-	}
-	return result;
+	return hamon::detail::make_valarray_binary_expr<T, hamon::detail::valarray_atan2_fn>(
+		hamon::detail::make_valarray_closure(x),
+		hamon::detail::make_valarray_closure(y));
+}
+
+template <typename L, typename T = hamon::detail::valarray_operand_value_t<L>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_binary_expr_t<T, hamon::detail::valarray_atan2_fn,
+	hamon::detail::valarray_closure_t<L>,
+	hamon::detail::valarray_scalar_closure<T>>
+atan2(L const& x, hamon::type_identity_t<T> const& y)
+{
+	return hamon::detail::make_valarray_binary_expr<T, hamon::detail::valarray_atan2_fn>(
+		hamon::detail::make_valarray_closure(x),
+		hamon::detail::valarray_scalar_closure<T>(y));
+}
+
+template <typename R, typename T = hamon::detail::valarray_operand_value_t<R>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_binary_expr_t<T, hamon::detail::valarray_atan2_fn,
+	hamon::detail::valarray_scalar_closure<T>,
+	hamon::detail::valarray_closure_t<R>>
+atan2(hamon::type_identity_t<T> const& x, R const& y)
+{
+	return hamon::detail::make_valarray_binary_expr<T, hamon::detail::valarray_atan2_fn>(
+		hamon::detail::valarray_scalar_closure<T>(x),
+		hamon::detail::make_valarray_closure(y));
+}
+
+template <typename X, typename T = hamon::detail::valarray_operand_value_t<X>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_unary_expr_t<T, hamon::detail::valarray_cos_fn,
+	hamon::detail::valarray_closure_t<X>>
+cos(X const& x)
+{
+	return hamon::detail::make_valarray_unary_expr<T, hamon::detail::valarray_cos_fn>(
+		hamon::detail::make_valarray_closure(x));
+}
+
+template <typename X, typename T = hamon::detail::valarray_operand_value_t<X>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_unary_expr_t<T, hamon::detail::valarray_cosh_fn,
+	hamon::detail::valarray_closure_t<X>>
+cosh(X const& x)
+{
+	return hamon::detail::make_valarray_unary_expr<T, hamon::detail::valarray_cosh_fn>(
+		hamon::detail::make_valarray_closure(x));
+}
+
+template <typename X, typename T = hamon::detail::valarray_operand_value_t<X>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_unary_expr_t<T, hamon::detail::valarray_exp_fn,
+	hamon::detail::valarray_closure_t<X>>
+exp(X const& x)
+{
+	return hamon::detail::make_valarray_unary_expr<T, hamon::detail::valarray_exp_fn>(
+		hamon::detail::make_valarray_closure(x));
+}
+
+template <typename X, typename T = hamon::detail::valarray_operand_value_t<X>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_unary_expr_t<T, hamon::detail::valarray_log_fn,
+	hamon::detail::valarray_closure_t<X>>
+log(X const& x)
+{
+	return hamon::detail::make_valarray_unary_expr<T, hamon::detail::valarray_log_fn>(
+		hamon::detail::make_valarray_closure(x));
+}
+
+template <typename X, typename T = hamon::detail::valarray_operand_value_t<X>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_unary_expr_t<T, hamon::detail::valarray_log10_fn,
+	hamon::detail::valarray_closure_t<X>>
+log10(X const& x)
+{
+	return hamon::detail::make_valarray_unary_expr<T, hamon::detail::valarray_log10_fn>(
+		hamon::detail::make_valarray_closure(x));
+}
+
+template <typename L, typename R, typename T = hamon::detail::valarray_common_value_t<L, R>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_binary_expr_t<T, hamon::detail::valarray_pow_fn,
+	hamon::detail::valarray_closure_t<L>,
+	hamon::detail::valarray_closure_t<R>>
+pow(L const& x, R const& y)
+{
+	return hamon::detail::make_valarray_binary_expr<T, hamon::detail::valarray_pow_fn>(
+		hamon::detail::make_valarray_closure(x),
+		hamon::detail::make_valarray_closure(y));
+}
+
+template <typename L, typename T = hamon::detail::valarray_operand_value_t<L>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_binary_expr_t<T, hamon::detail::valarray_pow_fn,
+	hamon::detail::valarray_closure_t<L>,
+	hamon::detail::valarray_scalar_closure<T>>
+pow(L const& x, hamon::type_identity_t<T> const& y)
+{
+	return hamon::detail::make_valarray_binary_expr<T, hamon::detail::valarray_pow_fn>(
+		hamon::detail::make_valarray_closure(x),
+		hamon::detail::valarray_scalar_closure<T>(y));
+}
+
+template <typename R, typename T = hamon::detail::valarray_operand_value_t<R>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_binary_expr_t<T, hamon::detail::valarray_pow_fn,
+	hamon::detail::valarray_scalar_closure<T>,
+	hamon::detail::valarray_closure_t<R>>
+pow(hamon::type_identity_t<T> const& x, R const& y)
+{
+	return hamon::detail::make_valarray_binary_expr<T, hamon::detail::valarray_pow_fn>(
+		hamon::detail::valarray_scalar_closure<T>(x),
+		hamon::detail::make_valarray_closure(y));
+}
+
+template <typename X, typename T = hamon::detail::valarray_operand_value_t<X>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_unary_expr_t<T, hamon::detail::valarray_sin_fn,
+	hamon::detail::valarray_closure_t<X>>
+sin(X const& x)
+{
+	return hamon::detail::make_valarray_unary_expr<T, hamon::detail::valarray_sin_fn>(
+		hamon::detail::make_valarray_closure(x));
+}
+
+template <typename X, typename T = hamon::detail::valarray_operand_value_t<X>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_unary_expr_t<T, hamon::detail::valarray_sinh_fn,
+	hamon::detail::valarray_closure_t<X>>
+sinh(X const& x)
+{
+	return hamon::detail::make_valarray_unary_expr<T, hamon::detail::valarray_sinh_fn>(
+		hamon::detail::make_valarray_closure(x));
+}
+
+template <typename X, typename T = hamon::detail::valarray_operand_value_t<X>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_unary_expr_t<T, hamon::detail::valarray_sqrt_fn,
+	hamon::detail::valarray_closure_t<X>>
+sqrt(X const& x)
+{
+	return hamon::detail::make_valarray_unary_expr<T, hamon::detail::valarray_sqrt_fn>(
+		hamon::detail::make_valarray_closure(x));
+}
+
+template <typename X, typename T = hamon::detail::valarray_operand_value_t<X>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_unary_expr_t<T, hamon::detail::valarray_tan_fn,
+	hamon::detail::valarray_closure_t<X>>
+tan(X const& x)
+{
+	return hamon::detail::make_valarray_unary_expr<T, hamon::detail::valarray_tan_fn>(
+		hamon::detail::make_valarray_closure(x));
+}
+
+template <typename X, typename T = hamon::detail::valarray_operand_value_t<X>>
+HAMON_NODISCARD HAMON_CXX20_CONSTEXPR
+hamon::detail::valarray_unary_expr_t<T, hamon::detail::valarray_tanh_fn,
+	hamon::detail::valarray_closure_t<X>>
+tanh(X const& x)
+{
+	return hamon::detail::make_valarray_unary_expr<T, hamon::detail::valarray_tanh_fn>(
+		hamon::detail::make_valarray_closure(x));
 }
 
 }	// namespace hamon
@@ -13,6 +13,7 @@
 #if !defined(HAMON_USE_STD_VALARRAY)
 
 #include <hamon/valarray/detail/valarray_class.hpp>
+#include <hamon/valarray/detail/valarray_closure.hpp>
 #include <hamon/cstddef/size_t.hpp>
 #include <hamon/config.hpp>
 
@@ -179,6 +180,7 @@ public:
 
 private:
 	friend valarray<T>;
+	friend struct hamon::detail::valarray_array_access;
 
 	HAMON_CXX20_CONSTEXPR
 	indirect_array(valarray<hamon::size_t> const& indarr, T* ptr)
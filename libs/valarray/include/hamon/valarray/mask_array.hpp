@@ -13,6 +13,7 @@
 #if !defined(HAMON_USE_STD_VALARRAY)
 
 #include <hamon/valarray/detail/valarray_class.hpp>
+#include <hamon/valarray/detail/valarray_closure.hpp>
 #include <hamon/valarray/detail/valarray_range.hpp>
 #include <hamon/algorithm/ranges/count.hpp>
 #include <hamon/cstddef/size_t.hpp>
@@ -181,6 +182,7 @@ public:
 
 private:
 	friend valarray<T>;
+	friend struct hamon::detail::valarray_array_access;
 
 	HAMON_CXX20_CONSTEXPR
 	mask_array(valarray<bool> const& maskarr, T* ptr)
@@ -32,7 +32,10 @@
 #include <hamon/valarray/gslice_array.hpp>
 #include <hamon/valarray/mask_array.hpp>
 #include <hamon/valarray/indirect_array.hpp>
+#include <hamon/valarray/detail/valarray_closure.hpp>
+#include <hamon/valarray/detail/valarray_expr.hpp>
 #include <hamon/cstddef/size_t.hpp>
+#include <hamon/utility/move.hpp>
 #include <hamon/config.hpp>
 
 namespace hamon
@@ -42,12 +45,7 @@ template <typename T>
 HAMON_CXX20_CONSTEXPR valarray<T>&
 valarray<T>::operator=(slice_array<T> const& slicearr)
 {
-	hamon::size_t const size = slicearr.size();
-	this->resize(size);
-	for (hamon::size_t i = 0; i < size; ++i)
-	{
-		m_data[i] = slicearr.data(i);
-	}
+	this->assign_from(hamon::detail::valarray_array_ref_closure<slice_array<T>>(slicearr));
 	return *this;
 }
 
@@ -55,12 +53,7 @@ template <typename T>
 HAMON_CXX20_CONSTEXPR valarray<T>&
 valarray<T>::operator=(gslice_array<T> const& gslicearr)
 {
-	hamon::size_t const size = gslicearr.size();
-	this->resize(size);
-	for (hamon::size_t i = 0; i < size; ++i)
-	{
-		m_data[i] = gslicearr.data(i);
-	}
+	this->assign_from(hamon::detail::valarray_array_ref_closure<gslice_array<T>>(gslicearr));
 	return *this;
 }
 
@@ -68,12 +61,7 @@ template <typename T>
 HAMON_CXX20_CONSTEXPR valarray<T>&
 valarray<T>::operator=(mask_array<T> const& maskarr)
 {
-	hamon::size_t const size = maskarr.size();
-	this->resize(size);
-	for (hamon::size_t i = 0; i < size; ++i)
-	{
-		m_data[i] = maskarr.data(i);
-	}
+	this->assign_from(hamon::detail::valarray_array_ref_closure<mask_array<T>>(maskarr));
 	return *this;
 }
 
@@ -81,21 +69,18 @@ template <typename T>
 HAMON_CXX20_CONSTEXPR valarray<T>&
 valarray<T>::operator=(indirect_array<T> const& indarr)
 {
-	hamon::size_t const size = indarr.size();
-	this->resize(size);
-	for (hamon::size_t i = 0; i < size; ++i)
-	{
-		m_data[i] = indarr.data(i);
-	}
+	this->assign_from(hamon::detail::valarray_array_ref_closure<indirect_array<T>>(indarr));
 	return *this;
 }
 
 template <typename T>
 HAMON_NODISCARD
-HAMON_CXX20_CONSTEXPR valarray<T>
+HAMON_CXX20_CONSTEXPR valarray_expr<T, hamon::detail::valarray_slice_closure<T>>
 valarray<T>::operator[](slice slicearr) const
 {
-	return valarray<T>(slice_array<T>(slicearr.start(), slicearr.size(), slicearr.stride(), m_data));
+	return valarray_expr<T, hamon::detail::valarray_slice_closure<T>>(
+		hamon::detail::valarray_slice_closure<T>(
+			slicearr.start(), slicearr.size(), slicearr.stride(), m_data));
 }
 
 template <typename T>
@@ -108,10 +93,12 @@ valarray<T>::operator[](slice slicearr) HAMON_NOEXCEPT // noexcept as an extensi
 
 template <typename T>
 HAMON_NODISCARD
-HAMON_CXX20_CONSTEXPR valarray<T>
+HAMON_CXX20_CONSTEXPR valarray_expr<T, hamon::detail::valarray_indirect_closure<T>>
 valarray<T>::operator[](gslice const& gslicearr) const
 {
-	return valarray<T>(gslice_array<T>(gslicearr.start(), gslicearr.size(), gslicearr.stride(), m_data));
+	gslice_array<T> arr(gslicearr.start(), gslicearr.size(), gslicearr.stride(), m_data);
+	return valarray_expr<T, hamon::detail::valarray_indirect_closure<T>>(
+		hamon::detail::valarray_indirect_closure<T>(hamon::move(arr.m_indarr), m_data));
 }
 
 template <typename T>
@@ -124,10 +111,12 @@ valarray<T>::operator[](gslice const& gslicearr)
 
 template <typename T>
 HAMON_NODISCARD
-HAMON_CXX20_CONSTEXPR valarray<T>
+HAMON_CXX20_CONSTEXPR valarray_expr<T, hamon::detail::valarray_indirect_closure<T>>
 valarray<T>::operator[](valarray<bool> const& boolarr) const
 {
-	return valarray<T>(mask_array<T>(boolarr, m_data));
+	mask_array<T> arr(boolarr, m_data);
+	return valarray_expr<T, hamon::detail::valarray_indirect_closure<T>>(
+		hamon::detail::valarray_indirect_closure<T>(hamon::move(arr.m_indarr), m_data));
 }
 
 template <typename T>
@@ -140,10 +129,11 @@ valarray<T>::operator[](valarray<bool> const& boolarr)
 
 template <typename T>
 HAMON_NODISCARD
-HAMON_CXX20_CONSTEXPR valarray<T>
+HAMON_CXX20_CONSTEXPR valarray_expr<T, hamon::detail::valarray_indirect_closure<T>>
 valarray<T>::operator[](valarray<hamon::size_t> const& indarr) const
 {
-	return valarray<T>(indirect_array<T>(indarr, m_data));
+	return valarray_expr<T, hamon::detail::valarray_indirect_closure<T>>(
+		hamon::detail::valarray_indirect_closure<T>(valarray<hamon::size_t>(indarr), m_data));
 }
 
 template <typename T>
@@ -154,6 +144,42 @@ valarray<T>::operator[](valarray<hamon::size_t> const& indarr)
 	return indirect_array<T>(indarr, m_data);
 }
 
+template <typename T, typename Closure>
+HAMON_NODISCARD
+HAMON_CXX20_CONSTEXPR valarray<T>
+valarray_expr<T, Closure>::operator[](slice slicearr) const
+{
+	valarray<T> const tmp(*this);
+	return valarray<T>(tmp[slicearr]);
+}
+
+template <typename T, typename Closure>
+HAMON_NODISCARD
+HAMON_CXX20_CONSTEXPR valarray<T>
+valarray_expr<T, Closure>::operator[](gslice const& gslicearr) const
+{
+	valarray<T> const tmp(*this);
+	return valarray<T>(tmp[gslicearr]);
+}
+
+template <typename T, typename Closure>
+HAMON_NODISCARD
+HAMON_CXX20_CONSTEXPR valarray<T>
+valarray_expr<T, Closure>::operator[](valarray<bool> const& boolarr) const
+{
+	valarray<T> const tmp(*this);
+	return valarray<T>(tmp[boolarr]);
+}
+
+template <typename T, typename Closure>
+HAMON_NODISCARD
+HAMON_CXX20_CONSTEXPR valarray<T>
+valarray_expr<T, Closure>::operator[](valarray<hamon::size_t> const& indarr) const
+{
+	valarray<T> const tmp(*this);
+	return valarray<T>(tmp[indarr]);
+}
+
 }	// namespace hamon
 
 #endif
@@ -35,7 +35,7 @@ HAMON_CXX20_CONSTEXPR bool test()
 		hamon::valarray<T> v2(a2, N);
 
 #if !defined(HAMON_USE_STD_VALARRAY)
-		static_assert(hamon::is_same<decltype(v1 + v2), hamon::valarray<T>>::value, "");
+		static_assert(hamon::is_same<typename decltype(v1 + v2)::value_type, T>::value, "");
 		static_assert(!noexcept(v1 + v2), "");
 #endif
 
@@ -56,7 +56,7 @@ HAMON_CXX20_CONSTEXPR bool test()
 		hamon::valarray<T> v1(a1, N);
 
 #if !defined(HAMON_USE_STD_VALARRAY)
-		static_assert(hamon::is_same<decltype(v1 + T{}), hamon::valarray<T>>::value, "");
+		static_assert(hamon::is_same<typename decltype(v1 + T{})::value_type, T>::value, "");
 		static_assert(!noexcept(v1 + T{}), "");
 #endif
 
@@ -76,7 +76,7 @@ HAMON_CXX20_CONSTEXPR bool test()
 		hamon::valarray<T> v1(a1, N);
 
 #if !defined(HAMON_USE_STD_VALARRAY)
-		static_assert(hamon::is_same<decltype(T{} + v1), hamon::valarray<T>>::value, "");
+		static_assert(hamon::is_same<typename decltype(T{} + v1)::value_type, T>::value, "");
 		static_assert(!noexcept(T{} + v1), "");
 #endif
 
@@ -0,0 +1,192 @@
+﻿/**
+ *	@file	unit_test_valarray_valarray_expr.cpp
+ *
+ *	@brief	valarray の式テンプレートのテスト
+ */
+
+#include <hamon/valarray/valarray.hpp>
+#include <hamon/valarray/slice.hpp>
+#include <hamon/valarray/slice_array.hpp>
+#include <hamon/valarray/mask_array.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/type_traits/is_convertible.hpp>
+#include <hamon/type_traits/is_same.hpp>
+#include <gtest/gtest.h>
+#include "constexpr_test.hpp"
+
+namespace hamon_valarray_test
+{
+
+namespace valarray_expr_test
+{
+
+#define VERIFY(...)	if (!(__VA_ARGS__)) { return false; }
+
+template <typename T>
+HAMON_CXX20_CONSTEXPR bool test()
+{
+	// 複数の演算を組み合わせた式
+	{
+		hamon::valarray<T> a = { 1, 2, 3, 4 };
+		hamon::valarray<T> b = { 5, 6, 7, 8 };
+		hamon::valarray<T> c = { 2, 2, 2, 2 };
+		hamon::valarray<T> d = { 1, 0, 1, 0 };
+
+#if !defined(HAMON_USE_STD_VALARRAY)
+		static_assert(hamon::is_convertible<decltype(a * b + c * d), hamon::valarray<T>>::value, "");
+		static_assert(hamon::is_same<typename decltype(a * b + c * d)::value_type, T>::value, "");
+		static_assert(hamon::is_same<typename decltype(a < b && c == d)::value_type, bool>::value, "");
+#endif
+
+		hamon::valarray<T> r = a * b + c * d;
+		VERIFY(r.size() == 4);
+		VERIFY(r[0] ==  7);
+		VERIFY(r[1] == 12);
+		VERIFY(r[2] == 23);
+		VERIFY(r[3] == 32);
+
+		r = -(a + T{1}) * T{2} - b;
+		VERIFY(r.size() == 4);
+		VERIFY(r[0] == -9);
+		VERIFY(r[1] == -12);
+		VERIFY(r[2] == -15);
+		VERIFY(r[3] == -18);
+
+		hamon::valarray<bool> m = a * c > b || !(d == T{0});
+		VERIFY(m.size() == 4);
+		VERIFY(m[0] == true);
+		VERIFY(m[1] == false);
+		VERIFY(m[2] == true);
+		VERIFY(m[3] == false);
+	}
+
+	// const メンバ関数
+	{
+		hamon::valarray<T> a = { 3, 1, 4, 1, 5 };
+		hamon::valarray<T> b = { 2, 7, 1, 8, 2 };
+
+		VERIFY((a + b).size() == 5);
+		VERIFY((a + b)[3] == 9);
+		VERIFY((a + b).sum() == 34);
+		VERIFY((a * b).min() == 4);
+		VERIFY((a * b).max() == 10);
+
+		hamon::valarray<T> s = (a + b).shift(1);
+		VERIFY(s.size() == 5);
+		VERIFY(s[0] == 8);
+		VERIFY(s[3] == 7);
+		VERIFY(s[4] == 0);
+
+		hamon::valarray<T> cs = (a - b + b).cshift(-1);
+		VERIFY(cs[0] == 5);
+		VERIFY(cs[1] == 3);
+	}
+
+	// 代入と複合代入
+	{
+		hamon::valarray<T> a = { 1, 2, 3 };
+		hamon::valarray<T> b = { 4, 5, 6 };
+
+		a += b * T{2};
+		VERIFY(a[0] ==  9);
+		VERIFY(a[1] == 12);
+		VERIFY(a[2] == 15);
+
+		a -= b + b;
+		VERIFY(a[0] == 1);
+		VERIFY(a[1] == 2);
+		VERIFY(a[2] == 3);
+
+		// 自身を含む式の代入
+		a = a * a + a;
+		VERIFY(a[0] ==  2);
+		VERIFY(a[1] ==  6);
+		VERIFY(a[2] == 12);
+
+		// サイズが異なる場合
+		hamon::valarray<T> c;
+		c = a + b;
+		VERIFY(c.size() == 3);
+		VERIFY(c[0] ==  6);
+		VERIFY(c[1] == 11);
+		VERIFY(c[2] == 18);
+	}
+
+	// slice_array と mask_array をオペランドにする
+	{
+		hamon::valarray<T> a = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+		hamon::valarray<T> const& ca = a;
+		hamon::valarray<T> b = { 10, 20, 30 };
+
+		hamon::valarray<T> r = ca[hamon::slice(1, 3, 3)] * b + ca[hamon::slice(0, 3, 1)];
+		VERIFY(r.size() == 3);
+		VERIFY(r[0] ==  10);
+		VERIFY(r[1] ==  81);
+		VERIFY(r[2] == 212);
+
+#if !defined(HAMON_USE_STD_VALARRAY)
+		// 非 const の operator[] の結果もオペランドにできる(拡張)
+		r = a[hamon::slice(1, 3, 3)] + b;
+		VERIFY(r[0] == 11);
+		VERIFY(r[1] == 24);
+		VERIFY(r[2] == 37);
+
+		hamon::valarray<bool> mask = a > T{6};
+		r = a[mask] * T{2} - b;
+		VERIFY(r.size() == 3);
+		VERIFY(r[0] == 4);
+		VERIFY(r[1] == -4);
+		VERIFY(r[2] == -12);
+#endif
+
+		r = ca[ca > T{6}] + b;
+		VERIFY(r.size() == 3);
+		VERIFY(r[0] == 17);
+		VERIFY(r[1] == 28);
+		VERIFY(r[2] == 39);
+
+#if !defined(HAMON_USE_STD_VALARRAY)
+		// 自身の一部から作った、サイズの異なる値の代入
+		a = a[hamon::slice(0, 5, 2)];
+		VERIFY(a.size() == 5);
+		VERIFY(a[0] == 0);
+		VERIFY(a[1] == 2);
+		VERIFY(a[4] == 8);
+#endif
+	}
+
+	return true;
+}
+
+template <typename T>
+HAMON_CXX20_CONSTEXPR bool test_transcend()
+{
+	hamon::valarray<T> a = { T(0.5), T(1.0), T(2.0) };
+	hamon::valarray<T> b = { T(1.0), T(2.0), T(3.0) };
+
+	hamon::valarray<T> const expected = { T(1.0), T(5.0), T(20.0) };
+	hamon::valarray<T> r = hamon::sqrt(a * a) + hamon::pow(b, T(2)) * hamon::abs(-a);
+	VERIFY(r.size() == 3);
+	VERIFY(hamon::abs(r - expected).max() < T(0.0001));
+
+	hamon::valarray<T> e = hamon::exp(hamon::log(b)) - b;
+	VERIFY(e.size() == 3);
+	VERIFY(hamon::abs(e).max() < T(0.0001));
+
+	return true;
+}
+
+#undef VERIFY
+
+GTEST_TEST(ValArrayTest, ValarrayExprTest)
+{
+	HAMON_CXX20_CONSTEXPR_EXPECT_TRUE((test<int>()));
+	HAMON_CXX20_CONSTEXPR_EXPECT_TRUE((test<long>()));
+
+	HAMON_CXX20_CONSTEXPR_EXPECT_TRUE((test_transcend<float>()));
+	HAMON_CXX20_CONSTEXPR_EXPECT_TRUE((test_transcend<double>()));
+}
+
+}	// namespace valarray_expr_test
+
+}	// namespace hamon_valarray_test
@@ -36,7 +36,7 @@ HAMON_CXX20_CONSTEXPR bool test()
 		const hamon::gslice sl(start, lengths, strides);
 
 #if !defined(HAMON_USE_STD_VALARRAY)
-		static_assert(hamon::is_same<decltype(va[sl]), hamon::valarray<T>>::value, "");
+		static_assert(hamon::is_same<typename decltype(va[sl])::value_type, T>::value, "");
 		static_assert(!noexcept(va[sl]), "");
 #endif
 
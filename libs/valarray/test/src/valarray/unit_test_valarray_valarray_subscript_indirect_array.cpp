@@ -31,7 +31,7 @@ HAMON_CXX20_CONSTEXPR bool test()
 		const hamon::valarray<hamon::size_t> mask = { 0, 2, 4 };
 
 #if !defined(HAMON_USE_STD_VALARRAY)
-		static_assert(hamon::is_same<decltype(va[mask]), hamon::valarray<T>>::value, "");
+		static_assert(hamon::is_same<typename decltype(va[mask])::value_type, T>::value, "");
 		static_assert(!noexcept(va[mask]), "");
 #endif
 
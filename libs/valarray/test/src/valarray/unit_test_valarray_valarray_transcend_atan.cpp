@@ -34,7 +34,7 @@ HAMON_CXX20_CONSTEXPR bool test()
 	hamon::valarray<T> v1(a1, N);
 
 #if !defined(HAMON_USE_STD_VALARRAY)
-	static_assert(hamon::is_same<decltype(atan(v1)), hamon::valarray<T>>::value, "");
+	static_assert(hamon::is_same<typename decltype(atan(v1))::value_type, T>::value, "");
 	static_assert(!noexcept(atan(v1)), "");
 #endif
 
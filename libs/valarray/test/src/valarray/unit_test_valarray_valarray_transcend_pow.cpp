@@ -40,7 +40,7 @@ HAMON_CXX20_CONSTEXPR bool test()
 		hamon::valarray<T> v2(a2, N);
 
 #if !defined(HAMON_USE_STD_VALARRAY)
-		static_assert(hamon::is_same<decltype(pow(v1, v2)), hamon::valarray<T>>::value, "");
+		static_assert(hamon::is_same<typename decltype(pow(v1, v2))::value_type, T>::value, "");
 		static_assert(!noexcept(pow(v1, v2)), "");
 #endif
 
@@ -64,7 +64,7 @@ HAMON_CXX20_CONSTEXPR bool test()
 		hamon::valarray<T> v1(a1, N);
 
 #if !defined(HAMON_USE_STD_VALARRAY)
-		static_assert(hamon::is_same<decltype(pow(v1, T{})), hamon::valarray<T>>::value, "");
+		static_assert(hamon::is_same<typename decltype(pow(v1, T{}))::value_type, T>::value, "");
 		static_assert(!noexcept(pow(v1, T{})), "");
 #endif
 
@@ -88,7 +88,7 @@ HAMON_CXX20_CONSTEXPR bool test()
 		hamon::valarray<T> v1(a1, N);
 
 #if !defined(HAMON_USE_STD_VALARRAY)
-		static_assert(hamon::is_same<decltype(pow(T{}, v1)), hamon::valarray<T>>::value, "");
+		static_assert(hamon::is_same<typename decltype(pow(T{}, v1))::value_type, T>::value, "");
 		static_assert(!noexcept(pow(T{}, v1)), "");
 #endif
 
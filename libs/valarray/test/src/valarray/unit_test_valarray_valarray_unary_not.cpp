@@ -27,7 +27,7 @@ HAMON_CXX20_CONSTEXPR bool test()
 		hamon::valarray<T> va(a, 5u);
 
 #if !defined(HAMON_USE_STD_VALARRAY)
-		static_assert(hamon::is_same<decltype(!va), hamon::valarray<bool>>::value, "");
+		static_assert(hamon::is_same<typename decltype(!va)::value_type, bool>::value, "");
 		static_assert(!noexcept(!va), "");
 #endif
 
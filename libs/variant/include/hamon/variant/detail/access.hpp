@@ -8,6 +8,7 @@
 #define HAMON_VARIANT_DETAIL_ACCESS_HPP
 
 #include <hamon/cstddef/size_t.hpp>
+#include <hamon/type_traits/enable_if.hpp>
 #include <hamon/utility/forward.hpp>
 #include <hamon/config.hpp>
 
@@ -31,6 +32,18 @@ private:
 		}
 	};
 
+	// 再帰の深さを減らすため、4つずつ進める
+	template <hamon::size_t N>
+	struct get_impl<N, hamon::enable_if_t<(N >= 4)>>
+	{
+		template <typename Union>
+		HAMON_CXX11_CONSTEXPR auto operator()(Union&& u) const HAMON_NOEXCEPT
+		->decltype(get_impl<N-4>{}(hamon::forward<Union>(u).m_tail.m_tail.m_tail.m_tail))
+		{
+			return get_impl<N-4>{}(hamon::forward<Union>(u).m_tail.m_tail.m_tail.m_tail);
+		}
+	};
+
 	template <typename Dummy>
 	struct get_impl<0, Dummy>
 	{
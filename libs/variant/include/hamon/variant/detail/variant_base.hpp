@@ -30,15 +30,14 @@ template <typename... Types>
 struct variant_base
 {
 private:
-#if 0
-	using index_type = hamon::size_t;
-#else
+	// 添字を保持できる最小の整数型。
+	// 無効な値を -1 で表すため、符号付き整数を使う。
+	// (index() で hamon::size_t に変換したときに variant_npos になる)
 	using index_type =
-		hamon::conditional_t<(sizeof...(Types) < (hamon::size_t)hamon::numeric_limits<hamon::int8_t>::max()),  hamon::int8_t,
-		hamon::conditional_t<(sizeof...(Types) < (hamon::size_t)hamon::numeric_limits<hamon::int16_t>::max()), hamon::int16_t,
-		hamon::conditional_t<(sizeof...(Types) < (hamon::size_t)hamon::numeric_limits<hamon::int32_t>::max()), hamon::int32_t,
+		hamon::conditional_t<(sizeof...(Types) <= (hamon::size_t)hamon::numeric_limits<hamon::int8_t>::max()),  hamon::int8_t,
+		hamon::conditional_t<(sizeof...(Types) <= (hamon::size_t)hamon::numeric_limits<hamon::int16_t>::max()), hamon::int16_t,
+		hamon::conditional_t<(sizeof...(Types) <= (hamon::size_t)hamon::numeric_limits<hamon::int32_t>::max()), hamon::int32_t,
 		hamon::size_t>>>;
-#endif
 
 	static const index_type s_invalid_index = static_cast<index_type>(-1);
 
@@ -9,14 +9,12 @@
 
 #include <hamon/variant/detail/access.hpp>
 #include <hamon/variant/detail/generic_variant_size.hpp>
-#include <hamon/array/array.hpp>
+#include <hamon/variant/detail/visit_dispatch.hpp>
 #include <hamon/cstddef/size_t.hpp>
 #include <hamon/functional/invoke_r.hpp>
 #include <hamon/type_traits/nth.hpp>
 #include <hamon/type_traits/remove_cvref.hpp>
 #include <hamon/utility/forward.hpp>
-#include <hamon/utility/index_sequence.hpp>
-#include <hamon/utility/make_index_sequence.hpp>
 #include <hamon/config.hpp>
 
 namespace hamon
@@ -28,37 +26,17 @@ namespace variant_detail
 struct visit_at
 {
 private:
-	template <typename F, hamon::size_t N>
-	struct Vtable;
-
-	template <typename Result, typename Visitor, typename... Variants, hamon::size_t N>
-	struct Vtable<Result(*)(Visitor, Variants...), N>
+	template <typename Result>
+	struct Caller
 	{
-	private:
-		using F = Result(*)(Visitor, Variants...);
-
-		template <hamon::size_t I>
+		template <hamon::size_t I, typename Visitor, typename... Variants>
 		static HAMON_CXX11_CONSTEXPR Result
-		invoke_visit(Visitor&& visitor, Variants&&... args)
+		call(Visitor&& visitor, Variants&&... args)
 		{
 			return hamon::invoke_r<Result>(
 				hamon::forward<Visitor>(visitor),
 				variant_detail::access::get<I>(hamon::forward<Variants>(args))...);
 		}
-
-		template <hamon::size_t... Is>
-		static HAMON_CXX11_CONSTEXPR hamon::array<F, N> const
-		get_func_table(hamon::index_sequence<Is...>)
-		{
-			return { &invoke_visit<Is>... };
-		}
-
-	public:
-		static HAMON_CXX11_CONSTEXPR F
-		get_func(hamon::size_t i)
-		{
-			return get_func_table(hamon::make_index_sequence<N>{})[i];
-		}
 	};
 
 public:
@@ -68,10 +46,10 @@ public:
 	{
 		using FirstVariant =
 			hamon::nth_t<0, hamon::remove_cvref_t<Variants>...>;
-		using vtbl_type = Vtable<
-			R(*)(Visitor&&, Variants&&...),
+		using dispatch_type = variant_detail::visit_dispatch<
+			R, Caller<R>,
 			variant_detail::generic_variant_size<FirstVariant>::value>;
-		return vtbl_type::get_func(i)(
+		return dispatch_type::invoke(i,
 			hamon::forward<Visitor>(visitor),
 			hamon::forward<Variants>(vars)...);
 	}
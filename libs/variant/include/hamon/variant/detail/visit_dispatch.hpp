@@ -0,0 +1,162 @@
+﻿/**
+ *	@file	visit_dispatch.hpp
+ *
+ *	@brief	visit_dispatch の定義
+ */
+
+#ifndef HAMON_VARIANT_DETAIL_VISIT_DISPATCH_HPP
+#define HAMON_VARIANT_DETAIL_VISIT_DISPATCH_HPP
+
+#include <hamon/array/array.hpp>
+#include <hamon/cstddef/size_t.hpp>
+#include <hamon/type_traits/bool_constant.hpp>
+#include <hamon/utility/forward.hpp>
+#include <hamon/utility/index_sequence.hpp>
+#include <hamon/utility/make_index_sequence.hpp>
+#include <hamon/utility/unreachable.hpp>
+#include <hamon/config.hpp>
+
+namespace hamon
+{
+
+namespace variant_detail
+{
+
+// switch 文で分岐する添字の最大数
+HAMON_INLINE_VAR HAMON_CONSTEXPR hamon::size_t visit_switch_max = 16;
+
+/**
+ *	@brief	実行時の添字 i から Caller::call<i>(args...) を呼び出す
+ *
+ *	N が visit_switch_max 以下のときは switch 文で分岐する。
+ *	関数ポインタのテーブルを経由しないので、呼び出し先をインライン展開できる。
+ *	N がそれより大きいときは関数ポインタのテーブルを使う。
+ */
+template <typename Result, typename Caller, hamon::size_t N, bool = (N <= visit_switch_max)>
+struct visit_dispatch;
+
+template <typename Result, typename Caller, hamon::size_t N>
+struct visit_dispatch<Result, Caller, N, true>
+{
+#if defined(HAMON_HAS_CXX14_CONSTEXPR)
+private:
+	template <hamon::size_t I, typename... Args>
+	static HAMON_CXX14_CONSTEXPR Result
+	invoke_case(hamon::true_type, Args&&... args)
+	{
+		return Caller::template call<I>(hamon::forward<Args>(args)...);
+	}
+
+	// N 以上の case には来ないことをコンパイラに伝える
+	template <hamon::size_t I, typename... Args>
+	static Result
+	invoke_case(hamon::false_type, Args&&...)
+	{
+		hamon::unreachable();
+	}
+
+public:
+	template <typename... Args>
+	static HAMON_CXX14_CONSTEXPR Result
+	invoke(hamon::size_t i, Args&&... args)
+	{
+#define HAMON_VARIANT_VISIT_CASE(I)	\
+		case I: return invoke_case<I>(hamon::bool_constant<((I) < N)>{}, hamon::forward<Args>(args)...)
+
+		switch (i)
+		{
+		HAMON_VARIANT_VISIT_CASE(0);
+		HAMON_VARIANT_VISIT_CASE(1);
+		HAMON_VARIANT_VISIT_CASE(2);
+		HAMON_VARIANT_VISIT_CASE(3);
+		HAMON_VARIANT_VISIT_CASE(4);
+		HAMON_VARIANT_VISIT_CASE(5);
+		HAMON_VARIANT_VISIT_CASE(6);
+		HAMON_VARIANT_VISIT_CASE(7);
+		HAMON_VARIANT_VISIT_CASE(8);
+		HAMON_VARIANT_VISIT_CASE(9);
+		HAMON_VARIANT_VISIT_CASE(10);
+		HAMON_VARIANT_VISIT_CASE(11);
+		HAMON_VARIANT_VISIT_CASE(12);
+		HAMON_VARIANT_VISIT_CASE(13);
+		HAMON_VARIANT_VISIT_CASE(14);
+		HAMON_VARIANT_VISIT_CASE(15);
+		default: break;
+		}
+
+#undef HAMON_VARIANT_VISIT_CASE
+
+		hamon::unreachable();
+	}
+#else
+private:
+	// C++11 の constexpr 関数では switch 文を使えないので、条件演算子をつなげる
+	template <hamon::size_t I, typename... Args>
+	static HAMON_CXX11_CONSTEXPR Result
+	invoke_impl(hamon::true_type, hamon::size_t, Args&&... args)
+	{
+		return Caller::template call<I>(hamon::forward<Args>(args)...);
+	}
+
+	template <hamon::size_t I, typename... Args>
+	static HAMON_CXX11_CONSTEXPR Result
+	invoke_impl(hamon::false_type, hamon::size_t i, Args&&... args)
+	{
+		return i == I ?
+			Caller::template call<I>(hamon::forward<Args>(args)...) :
+			invoke_impl<I + 1>(hamon::bool_constant<(I + 2 == N)>{}, i, hamon::forward<Args>(args)...);
+	}
+
+public:
+	template <typename... Args>
+	static HAMON_CXX11_CONSTEXPR Result
+	invoke(hamon::size_t i, Args&&... args)
+	{
+		return invoke_impl<0>(hamon::bool_constant<(N == 1)>{}, i, hamon::forward<Args>(args)...);
+	}
+#endif
+};
+
+template <typename Result, typename Caller, typename... Args, hamon::size_t... Is>
+inline HAMON_CXX11_CONSTEXPR hamon::array<Result(*)(Args&&...), sizeof...(Is)>
+make_visit_func_table(hamon::index_sequence<Is...>)
+{
+	return {{ &Caller::template call<Is, Args...>... }};
+}
+
+template <typename Result, typename Caller, hamon::size_t N>
+struct visit_dispatch<Result, Caller, N, false>
+{
+private:
+	template <typename... Args>
+	struct Vtable
+	{
+		using F = Result(*)(Args&&...);
+
+		// 呼び出しのたびにテーブルを作らないように、静的メンバ変数にする
+		static HAMON_CXX11_CONSTEXPR hamon::array<F, N> s_table =
+			variant_detail::make_visit_func_table<Result, Caller, Args...>(
+				hamon::make_index_sequence<N>{});
+	};
+
+public:
+	template <typename... Args>
+	static HAMON_CXX11_CONSTEXPR Result
+	invoke(hamon::size_t i, Args&&... args)
+	{
+		return Vtable<Args...>::s_table[i](hamon::forward<Args>(args)...);
+	}
+};
+
+#if !defined(HAMON_HAS_CXX17_INLINE_VARIABLES)
+template <typename Result, typename Caller, hamon::size_t N>
+template <typename... Args>
+HAMON_CXX11_CONSTEXPR hamon::array<Result(*)(Args&&...), N>
+visit_dispatch<Result, Caller, N, false>::Vtable<Args...>::s_table;
+#endif
+
+}	// namespace variant_detail
+
+}	// namespace hamon
+
+#endif // HAMON_VARIANT_DETAIL_VISIT_DISPATCH_HPP
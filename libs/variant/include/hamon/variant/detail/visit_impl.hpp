@@ -9,11 +9,12 @@
 
 #include <hamon/variant/detail/access.hpp>
 #include <hamon/variant/detail/generic_variant_size.hpp>
-#include <hamon/array/array.hpp>
+#include <hamon/variant/detail/visit_dispatch.hpp>
 #include <hamon/cstddef/size_t.hpp>
 #include <hamon/functional/invoke.hpp>
 #include <hamon/functional/invoke_r.hpp>
 #include <hamon/type_traits/conjunction.hpp>
+#include <hamon/type_traits/integral_constant.hpp>
 #include <hamon/type_traits/is_invocable.hpp>
 #include <hamon/type_traits/is_invocable_r.hpp>
 #include <hamon/type_traits/is_same.hpp>
@@ -30,63 +31,80 @@ namespace hamon
 namespace variant_detail
 {
 
+// Ns... の積
+template <hamon::size_t... Ns>
+struct visit_index_product
+	: public hamon::integral_constant<hamon::size_t, 1> {};
+
+template <hamon::size_t N, hamon::size_t... Ns>
+struct visit_index_product<N, Ns...>
+	: public hamon::integral_constant<hamon::size_t, N * visit_index_product<Ns...>::value> {};
+
+// 1次元にした添字 Flat を、各 variant の添字 Is... に戻す
+template <hamon::size_t Flat, typename IndexSequence, hamon::size_t... Ns>
+struct visit_unflatten_index
+{
+	using type = IndexSequence;
+};
+
+template <hamon::size_t Flat, hamon::size_t... Is, hamon::size_t N, hamon::size_t... Ns>
+struct visit_unflatten_index<Flat, hamon::index_sequence<Is...>, N, Ns...>
+	: public visit_unflatten_index<
+		Flat % visit_index_product<Ns...>::value,
+		hamon::index_sequence<Is..., Flat / visit_index_product<Ns...>::value>,
+		Ns...>
+{};
+
 struct visit_impl
 {
 private:
-	template <bool DeduceResult, typename F, typename IndexSequence, hamon::size_t... Ds>
-	struct MultiDimensionVtable;
+	// 各 variant の添字を Is... として visitor を呼び出す
+	template <bool DeduceResult, typename Result, typename IndexSequence>
+	struct Invoker;
 
 	// INVOKE を呼び出す特殊化 [variant.visit]/4
-	template <typename Result, typename Visitor, typename... Variants, hamon::size_t... Is>
-	struct MultiDimensionVtable<true, Result(*)(Visitor, Variants...), hamon::index_sequence<Is...>>
+	template <typename Result, hamon::size_t... Is>
+	struct Invoker<true, Result, hamon::index_sequence<Is...>>
 	{
-	private:
-		using F = Result(*)(Visitor, Variants...);
-
+		template <typename Visitor, typename... Variants>
 		static HAMON_CXX11_CONSTEXPR Result
-		invoke_impl(Visitor&& visitor, Variants&&... args)
+		invoke(Visitor&& visitor, Variants&&... args)
 		{
 			return hamon::invoke(
 				hamon::forward<Visitor>(visitor),
 				variant_detail::access::get<Is>(hamon::forward<Variants>(args))...);
 		}
 
-		using DeducedResult =
-			decltype(hamon::invoke(
-				hamon::declval<Visitor>(),
-				variant_detail::access::get<Is>(hamon::declval<Variants>())...));
-
-	public:
-		static HAMON_CXX11_CONSTEXPR F get_func() { return &invoke_impl; }
-
+		template <typename Visitor, typename... Variants>
 		using is_invocable =
 			hamon::conjunction<
 				hamon::is_invocable<
 					Visitor,
 					decltype(variant_detail::access::get<Is>(hamon::declval<Variants>()))...
 				>,
-				hamon::is_same<DeducedResult, Result>
+				hamon::is_same<
+					decltype(hamon::invoke(
+						hamon::declval<Visitor>(),
+						variant_detail::access::get<Is>(hamon::declval<Variants>())...)),
+					Result
+				>
 			>;
 	};
 
 	// INVOKE<R> を呼び出す特殊化 [variant.visit]/4
-	template <typename Result, typename Visitor, typename... Variants, hamon::size_t... Is>
-	struct MultiDimensionVtable<false, Result(*)(Visitor, Variants...), hamon::index_sequence<Is...>>
+	template <typename Result, hamon::size_t... Is>
+	struct Invoker<false, Result, hamon::index_sequence<Is...>>
 	{
-	private:
-		using F = Result(*)(Visitor, Variants...);
-
+		template <typename Visitor, typename... Variants>
 		static HAMON_CXX11_CONSTEXPR Result
-		invoke_impl(Visitor&& visitor, Variants&&... args)
+		invoke(Visitor&& visitor, Variants&&... args)
 		{
 			return hamon::invoke_r<Result>(
 				hamon::forward<Visitor>(visitor),
 				variant_detail::access::get<Is>(hamon::forward<Variants>(args))...);
 		}
 
-	public:
-		static HAMON_CXX11_CONSTEXPR F get_func() { return &invoke_impl; }
-
+		template <typename Visitor, typename... Variants>
 		using is_invocable =
 			hamon::is_invocable_r<
 				Result,
@@ -95,44 +113,66 @@ private:
 			>;
 	};
 
-	template <bool DeduceResult, typename F, hamon::size_t... Is, hamon::size_t D, hamon::size_t... Rest>
-	struct MultiDimensionVtable<DeduceResult, F, hamon::index_sequence<Is...>, D, Rest...>
+	// 各 variant の添字 (i0, i1, i2, ...) を1次元の添字 ((i0 * N1) + i1) * N2 + i2 ... にする
+	static HAMON_CXX11_CONSTEXPR hamon::size_t
+	flatten_index(hamon::size_t acc, hamon::index_sequence<>)
 	{
-	private:
-		template <hamon::size_t... Js, typename... Args>
-		static HAMON_CXX11_CONSTEXPR hamon::array<F, sizeof...(Js)> const
-		get_func_impl(hamon::index_sequence<Js...>, Args... rest)
+		return acc;
+	}
+
+	template <hamon::size_t N, hamon::size_t... Ns, typename... Rest>
+	static HAMON_CXX11_CONSTEXPR hamon::size_t
+	flatten_index(hamon::size_t acc, hamon::index_sequence<N, Ns...>, hamon::size_t i, Rest... rest)
+	{
+		return flatten_index(acc * N + i, hamon::index_sequence<Ns...>{}, rest...);
+	}
+
+	template <bool DeduceResult, typename Result, hamon::size_t... Ns>
+	struct Impl
+	{
+		template <hamon::size_t Flat>
+		using invoker_t = Invoker<DeduceResult, Result,
+			typename visit_unflatten_index<Flat, hamon::index_sequence<>, Ns...>::type>;
+
+		struct Caller
 		{
-			return
+			template <hamon::size_t Flat, typename Visitor, typename... Variants>
+			static HAMON_CXX11_CONSTEXPR Result
+			call(Visitor&& visitor, Variants&&... args)
 			{
-				MultiDimensionVtable<
-					DeduceResult, F, hamon::index_sequence<Is..., Js>, Rest...
-				>::get_func(rest...)...,
-			};
-		}
+				return invoker_t<Flat>::invoke(
+					hamon::forward<Visitor>(visitor),
+					hamon::forward<Variants>(args)...);
+			}
+		};
+
+		// 全ての variant の組み合わせを、1つの switch 文 (またはテーブル) で分岐する
+		using dispatch_type = variant_detail::visit_dispatch<
+			Result, Caller, visit_index_product<Ns...>::value>;
 
-	public:
-		template <typename... Args>
-		static HAMON_CXX11_CONSTEXPR F get_func(hamon::size_t i, Args... rest)
+		template <typename Visitor, typename... Variants>
+		static HAMON_CXX11_CONSTEXPR Result
+		invoke(Visitor&& visitor, Variants&&... vars)
 		{
-			return get_func_impl(hamon::make_index_sequence<D>{}, rest...)[i];
+			return dispatch_type::invoke(
+				flatten_index(0, hamon::index_sequence<Ns...>{}, vars.index()...),
+				hamon::forward<Visitor>(visitor),
+				hamon::forward<Variants>(vars)...);
 		}
 
-	private:
-		template <typename IndexSequence>
+		template <typename IndexSequence, typename Visitor, typename... Variants>
 		struct is_invocable_impl;
 
-		template <hamon::size_t... Js>
-		struct is_invocable_impl<hamon::index_sequence<Js...>>
-			: hamon::conjunction<
-				typename MultiDimensionVtable<
-					DeduceResult, F, hamon::index_sequence<Is..., Js>, Rest...
-				>::is_invocable...
+		template <hamon::size_t... Flats, typename Visitor, typename... Variants>
+		struct is_invocable_impl<hamon::index_sequence<Flats...>, Visitor, Variants...>
+			: public hamon::conjunction<
+				typename invoker_t<Flats>::template is_invocable<Visitor, Variants...>...
 			>
 		{};
 
-	public:
-		using is_invocable = is_invocable_impl<hamon::make_index_sequence<D>>;
+		template <typename Visitor, typename... Variants>
+		using is_invocable = is_invocable_impl<
+			hamon::make_index_sequence<visit_index_product<Ns...>::value>, Visitor, Variants...>;
 	};
 
 public:
@@ -146,13 +186,12 @@ private:
 	struct Unspecified;
 
 	template <typename R, typename Visitor, typename... Variants>
-	struct GenVtable
+	struct GenImpl
 	{
 		using result_type = R;
-		using type = MultiDimensionVtable<
+		using type = Impl<
 			false,
-			result_type(*)(Visitor&&, Variants&&...),
-			hamon::index_sequence<>,
+			result_type,
 			variant_detail::generic_variant_size<
 				hamon::remove_cvref_t<Variants>
 			>::value...
@@ -160,13 +199,12 @@ private:
 	};
 
 	template <typename Visitor, typename... Variants>
-	struct GenVtable<Unspecified, Visitor, Variants...>
+	struct GenImpl<Unspecified, Visitor, Variants...>
 	{
 		using result_type = deduced_result_t<Visitor, Variants...>;
-		using type = MultiDimensionVtable<
+		using type = Impl<
 			true,
-			result_type(*)(Visitor&&, Variants&&...),
-			hamon::index_sequence<>,
+			result_type,
 			variant_detail::generic_variant_size<
 				hamon::remove_cvref_t<Variants>
 			>::value...
@@ -175,22 +213,22 @@ private:
 
 public:
 	template <typename R = Unspecified, typename Visitor, typename... Variants>
-	static HAMON_CXX11_CONSTEXPR typename GenVtable<R, Visitor, Variants...>::result_type
+	static HAMON_CXX11_CONSTEXPR typename GenImpl<R, Visitor, Variants...>::result_type
 	invoke(Visitor&& visitor, Variants&&... vars)
 	{
-		using vtbl_type = typename GenVtable<R, Visitor, Variants...>::type;
-		return vtbl_type::get_func(vars.index()...)(
+		using impl_type = typename GenImpl<R, Visitor, Variants...>::type;
+		return impl_type::invoke(
 			hamon::forward<Visitor>(visitor),
 			hamon::forward<Variants>(vars)...);
 	}
 
 	template <typename Visitor, typename... Variants>
 	using is_invocable =
-		typename GenVtable<Unspecified, Visitor, Variants...>::type::is_invocable;
+		typename GenImpl<Unspecified, Visitor, Variants...>::type::template is_invocable<Visitor, Variants...>;
 
 	template <typename R, typename Visitor, typename... Variants>
 	using is_invocable_r =
-		typename GenVtable<R, Visitor, Variants...>::type::is_invocable;
+		typename GenImpl<R, Visitor, Variants...>::type::template is_invocable<Visitor, Variants...>;
 };
 
 }	// namespace variant_detail
@@ -300,6 +300,73 @@ inline void RuntimeTest()
 
 #if !defined(HAMON_NO_EXCEPTIONS)
 
+template <int N>
+struct Alt
+{
+	int value;
+
+	friend HAMON_CXX11_CONSTEXPR bool operator==(Alt const& lhs, Alt const& rhs) { return lhs.value == rhs.value; }
+	friend HAMON_CXX11_CONSTEXPR bool operator!=(Alt const& lhs, Alt const& rhs) { return lhs.value != rhs.value; }
+};
+
+struct AltVisitor
+{
+	template <int N>
+	HAMON_CXX11_CONSTEXPR int operator()(Alt<N> const& a) const { return N * 100 + a.value; }
+
+	template <int N, int M>
+	HAMON_CXX11_CONSTEXPR int operator()(Alt<N> const&, Alt<M> const&) const { return N * 10 + M; }
+
+	template <int N, int M, int L>
+	HAMON_CXX11_CONSTEXPR int operator()(Alt<N> const&, Alt<M> const&, Alt<L> const&) const { return N * 100 + M * 10 + L; }
+};
+
+inline void ManyAlternativesTest()
+{
+	// 添字の数が switch 文で分岐する数より多いとき
+	using V20 = hamon::variant<
+		Alt<0>,  Alt<1>,  Alt<2>,  Alt<3>,  Alt<4>,  Alt<5>,  Alt<6>,  Alt<7>,  Alt<8>,  Alt<9>,
+		Alt<10>, Alt<11>, Alt<12>, Alt<13>, Alt<14>, Alt<15>, Alt<16>, Alt<17>, Alt<18>, Alt<19>>;
+	{
+		HAMON_CXX11_CONSTEXPR V20 v0(hamon::in_place_index_t<0>{}, Alt<0>{1});
+		HAMON_CXX11_CONSTEXPR V20 v15(hamon::in_place_index_t<15>{}, Alt<15>{2});
+		HAMON_CXX11_CONSTEXPR V20 v16(hamon::in_place_index_t<16>{}, Alt<16>{3});
+		HAMON_CXX11_CONSTEXPR V20 v19(hamon::in_place_index_t<19>{}, Alt<19>{4});
+		HAMON_CXX11_CONSTEXPR_EXPECT_EQ(   1, hamon::visit(AltVisitor{}, v0));
+		HAMON_CXX11_CONSTEXPR_EXPECT_EQ(1502, hamon::visit(AltVisitor{}, v15));
+		HAMON_CXX11_CONSTEXPR_EXPECT_EQ(1603, hamon::visit(AltVisitor{}, v16));
+		HAMON_CXX11_CONSTEXPR_EXPECT_EQ(1904, hamon::visit(AltVisitor{}, v19));
+		HAMON_CXX11_CONSTEXPR_EXPECT_EQ( 190, hamon::visit(AltVisitor{}, v19, v0));
+		HAMON_CXX11_CONSTEXPR_EXPECT_EQ( 166, hamon::visit(AltVisitor{}, v15, v16));
+		HAMON_CXX11_CONSTEXPR_EXPECT_TRUE(v16 != v19);
+		HAMON_CXX11_CONSTEXPR_EXPECT_TRUE(v19 == v19);
+
+		V20 v = v16;
+		EXPECT_EQ(16u, v.index());
+		v = v19;
+		EXPECT_EQ(19u, v.index());
+		EXPECT_EQ(1904, hamon::visit(AltVisitor{}, v));
+	}
+	// 組み合わせの数が switch 文で分岐する数より多いとき
+	using V3 = hamon::variant<Alt<0>, Alt<1>, Alt<2>>;
+	{
+		HAMON_CXX11_CONSTEXPR V3 a(hamon::in_place_index_t<2>{}, Alt<2>{0});
+		HAMON_CXX11_CONSTEXPR V3 b(hamon::in_place_index_t<0>{}, Alt<0>{0});
+		HAMON_CXX11_CONSTEXPR V3 c(hamon::in_place_index_t<1>{}, Alt<1>{0});
+		HAMON_CXX11_CONSTEXPR_EXPECT_EQ(201, hamon::visit(AltVisitor{}, a, b, c));
+		HAMON_CXX11_CONSTEXPR_EXPECT_EQ(120, hamon::visit(AltVisitor{}, c, a, b));
+		HAMON_CXX11_CONSTEXPR_EXPECT_EQ(222, hamon::visit(AltVisitor{}, a, a, a));
+		HAMON_CXX11_CONSTEXPR_EXPECT_EQ( 21, hamon::visit(AltVisitor{}, b, a, c));
+	}
+	// 異なる大きさの variant
+	{
+		HAMON_CXX11_CONSTEXPR V3 a(hamon::in_place_index_t<2>{}, Alt<2>{0});
+		HAMON_CXX11_CONSTEXPR V20 b(hamon::in_place_index_t<17>{}, Alt<17>{0});
+		HAMON_CXX11_CONSTEXPR_EXPECT_EQ(37, hamon::visit(AltVisitor{}, a, b));
+		HAMON_CXX11_CONSTEXPR_EXPECT_EQ(172, hamon::visit(AltVisitor{}, b, a));
+	}
+}
+
 struct MakeEmptyT
 {
 	int value;
@@ -480,6 +547,7 @@ GTEST_TEST(VariantTest, VisitTest)
 	HAMON_CXX14_CONSTEXPR_EXPECT_TRUE(ReturnTypeTest());
 	ConstexprTest();
 	RuntimeTest();
+	ManyAlternativesTest();
 	ExceptionsTest();
 	DerivedFromVariantTest();
 	SfinaeTest();